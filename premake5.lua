@@ -26,6 +26,33 @@ defines({
   "UNICODE",
 })
 
+newoption({
+  trigger = "profiler",
+  description = "Backend of the profiling scopes (see xenia/base/profiling.h)",
+  value = "BACKEND",
+  default = "microprofile",
+  allowed = {
+    { "microprofile", "MicroProfile with the in-process UI (default)." },
+    { "tracy", "Tracy client, needs the source in third_party/tracy." },
+  },
+})
+
+if _OPTIONS["profiler"] == "tracy" then
+  defines({
+    "XE_OPTION_PROFILING_TRACY=1",
+    "TRACY_ENABLE",
+  })
+  filter("kind:ConsoleApp or WindowedApp or SharedLib")
+    links({
+      "tracy",
+    })
+  filter({"platforms:Windows", "kind:ConsoleApp or WindowedApp or SharedLib"})
+    links({
+      "dbghelp",
+    })
+  filter({})
+end
+
 cppdialect("C++17")
 exceptionhandling("On")
 rtti("On")
@@ -195,6 +222,7 @@ filter("platforms:Windows")
     "shlwapi",
     "dxguid",
     "bcrypt",
+    "synchronization",
   })
 
 -- Embed the manifest for things like dependencies and DPI awareness.
@@ -255,6 +283,13 @@ workspace("xenia")
   include("third_party/snappy.lua")
   include("third_party/xxhash.lua")
 
+  if _OPTIONS["profiler"] == "tracy" then
+    if not os.isfile("third_party/tracy/public/TracyClient.cpp") then
+      error("--profiler=tracy requires the Tracy source in third_party/tracy")
+    end
+    include("third_party/tracy.lua")
+  end
+
   if not os.istarget("android") then
     -- SDL2 requires sdl2-config, and as of November 2020 isn't high-quality on
     -- Android yet, most importantly in game controllers - the keycode and axis
@@ -0,0 +1,284 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/app/benchmark_runner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "third_party/fmt/include/fmt/format.h"
+#include "xenia/base/clock.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/threading.h"
+#include "xenia/cpu/ppc/ppc_frontend.h"
+#include "xenia/cpu/processor.h"
+#include "xenia/gpu/command_processor.h"
+#include "xenia/gpu/gpu_statistics.h"
+#include "xenia/gpu/graphics_system.h"
+#include "xenia/kernel/kernel_state.h"
+#include "xenia/kernel/xthread.h"
+
+DEFINE_uint32(benchmark_frames, 0,
+              "Run the launched title for this number of guest frames, then "
+              "write the performance measurements to --benchmark_output_path "
+              "and quit. Can be combined with --benchmark_seconds, whichever "
+              "is reached first. Use with --headless for unattended runs.",
+              "General");
+DEFINE_uint32(benchmark_seconds, 0,
+              "Run the launched title for this number of seconds, then write "
+              "the performance measurements to --benchmark_output_path and "
+              "quit.",
+              "General");
+DEFINE_path(benchmark_output_path, "benchmark.json",
+            "File the benchmark results are written to as JSON.", "General");
+DEFINE_path(benchmark_input_script, "",
+            "Text file with the gamepad states to play back as the first "
+            "user's controller during the benchmark, one \"<milliseconds> "
+            "<buttons> [<lt> <rt> <lx> <ly> <rx> <ry>]\" line per state, "
+            "with the buttons like \"a+start\", or \"-\" for none.",
+            "General");
+
+namespace xe {
+namespace app {
+
+namespace {
+
+std::string EscapeJsonString(const std::string_view string) {
+  std::string escaped;
+  escaped.reserve(string.size());
+  for (char c : string) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+      escaped += c;
+    } else if (uint8_t(c) < 0x20) {
+      escaped += fmt::format("\\u{:04x}", uint8_t(c));
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+// Per-thread CPU times of the guest threads, by the thread ID.
+std::unordered_map<uint32_t, uint64_t> QueryGuestThreadCpuTimes(
+    kernel::KernelState* kernel_state) {
+  std::unordered_map<uint32_t, uint64_t> cpu_times;
+  for (const auto& thread :
+       kernel_state->object_table()->GetObjectsByType<kernel::XThread>()) {
+    threading::Thread* host_thread = thread->thread();
+    if (host_thread) {
+      cpu_times.emplace(thread->thread_id(),
+                        host_thread->QueryCpuTimeMicros());
+    }
+  }
+  return cpu_times;
+}
+
+}  // namespace
+
+bool BenchmarkRunner::IsRequested() {
+  return cvars::benchmark_frames || cvars::benchmark_seconds;
+}
+
+BenchmarkRunner::BenchmarkRunner(Emulator* emulator,
+                                 std::function<void()> quit_function)
+    : emulator_(emulator), quit_function_(std::move(quit_function)) {
+  if (BenchmarkTuner::IsRequested()) {
+    tuner_ = std::make_unique<BenchmarkTuner>(*emulator_);
+  }
+}
+
+BenchmarkRunner::~BenchmarkRunner() {
+  stop_requested_.store(true, std::memory_order_relaxed);
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+std::unique_ptr<hid::InputDriver> BenchmarkRunner::CreateInputDriver(
+    ui::Window* window, size_t window_z_order) {
+  if (cvars::benchmark_input_script.empty()) {
+    return nullptr;
+  }
+  std::unique_ptr<hid::ScriptedInputDriver> driver =
+      hid::ScriptedInputDriver::Create(window, window_z_order,
+                                       cvars::benchmark_input_script);
+  input_driver_ = driver.get();
+  return driver;
+}
+
+void BenchmarkRunner::OnLaunch(uint32_t title_id,
+                               const std::string_view title_name) {
+  if (started_.exchange(true, std::memory_order_relaxed)) {
+    return;
+  }
+  thread_ = std::thread(&BenchmarkRunner::Run, this, title_id,
+                        std::string(title_name));
+}
+
+void BenchmarkRunner::Run(uint32_t title_id, std::string title_name) {
+  threading::set_name("Benchmark");
+
+  gpu::GpuStatistics& statistics =
+      emulator_->graphics_system()->command_processor()->statistics();
+  cpu::ppc::PPCFrontend* frontend = emulator_->processor()->frontend();
+  kernel::KernelState* kernel_state = emulator_->kernel_state();
+
+  XELOGI("Benchmark: measuring {:08X} {}", title_id, title_name);
+  if (input_driver_) {
+    input_driver_->Start();
+  }
+  statistics.BeginFrameIntervalRecording();
+  gpu::GpuStatistics::Values gpu_start;
+  uint64_t frame_start = statistics.GetTotals(gpu_start);
+  uint64_t translations_start = frontend->translation_count();
+  uint64_t translation_time_start = frontend->QueryTranslationTimeMicros();
+  std::unordered_map<uint32_t, uint64_t> thread_cpu_times_start =
+      QueryGuestThreadCpuTimes(kernel_state);
+  uint64_t time_start = Clock::QueryHostUptimeMillis();
+
+  gpu::GpuStatistics::Values gpu_end;
+  uint64_t frame_end = frame_start;
+  uint64_t time_end = time_start;
+  while (!stop_requested_.load(std::memory_order_relaxed)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    frame_end = statistics.GetTotals(gpu_end);
+    time_end = Clock::QueryHostUptimeMillis();
+    if ((cvars::benchmark_frames &&
+         frame_end - frame_start >= cvars::benchmark_frames) ||
+        (cvars::benchmark_seconds &&
+         time_end - time_start >= uint64_t(cvars::benchmark_seconds) * 1000)) {
+      break;
+    }
+  }
+  if (stop_requested_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  std::vector<uint64_t> frame_intervals_us =
+      statistics.EndFrameIntervalRecording();
+  uint64_t translations = frontend->translation_count() - translations_start;
+  uint64_t translation_time_us =
+      frontend->QueryTranslationTimeMicros() - translation_time_start;
+  std::unordered_map<uint32_t, uint64_t> thread_cpu_times_end =
+      QueryGuestThreadCpuTimes(kernel_state);
+
+  FILE* output = xe::filesystem::OpenFile(cvars::benchmark_output_path, "wb");
+  if (!output) {
+    XELOGE("Benchmark: failed to open {} for writing",
+           xe::path_to_utf8(cvars::benchmark_output_path));
+    quit_function_();
+    return;
+  }
+
+  uint64_t frames = frame_end - frame_start;
+  double duration_s = double(time_end - time_start) * 0.001;
+  fmt::print(output,
+             "{{\n  \"title_id\": \"{:08X}\",\n  \"title\": \"{}\",\n"
+             "  \"duration_s\": {:.3f},\n  \"frames\": {},\n"
+             "  \"guest_fps\": {:.2f},\n",
+             title_id, EscapeJsonString(title_name), duration_s, frames,
+             duration_s ? double(frames) / duration_s : 0.0);
+
+  // Nearest-rank percentiles of the host time between the guest frames.
+  std::sort(frame_intervals_us.begin(), frame_intervals_us.end());
+  auto frame_time_percentile_ms = [&](uint32_t percentile) {
+    if (frame_intervals_us.empty()) {
+      return 0.0;
+    }
+    size_t rank = (frame_intervals_us.size() * percentile + 99) / 100;
+    return double(frame_intervals_us[std::max(rank, size_t(1)) - 1]) * 0.001;
+  };
+  uint64_t frame_intervals_total_us = 0;
+  for (uint64_t frame_interval_us : frame_intervals_us) {
+    frame_intervals_total_us += frame_interval_us;
+  }
+  double frame_time_mean_ms = frame_intervals_us.empty()
+                                  ? 0.0
+                                  : double(frame_intervals_total_us) * 0.001 /
+                                        double(frame_intervals_us.size());
+  fmt::print(output,
+             "  \"frame_time_ms\": {{\"mean\": {:.3f}, \"p50\": {:.3f}, "
+             "\"p90\": {:.3f}, \"p99\": {:.3f}, \"max\": {:.3f}}},\n",
+             frame_time_mean_ms, frame_time_percentile_ms(50),
+             frame_time_percentile_ms(90), frame_time_percentile_ms(99),
+             frame_time_percentile_ms(100));
+
+  fmt::print(output, "  \"gpu\": {{");
+  for (uint32_t i = 0; i < gpu::GpuStatistics::kCounterCount; ++i) {
+    auto counter = gpu::GpuStatistics::Counter(i);
+    fmt::print(output, "\n    \"{}\": {},",
+               gpu::GpuStatistics::GetCounterName(counter),
+               gpu_end[counter] - gpu_start[counter]);
+  }
+  fmt::print(output,
+             "\n    \"submissions\": {},\n    \"gpu_time_ms\": {:.3f}\n  }},\n",
+             gpu_end.submissions - gpu_start.submissions,
+             double(gpu_end.gpu_time_ns - gpu_start.gpu_time_ns) * 0.000001);
+
+  fmt::print(output,
+             "  \"cpu\": {{\n    \"translations\": {},\n"
+             "    \"translation_time_ms\": {:.3f}\n  }},\n",
+             translations, double(translation_time_us) * 0.001);
+
+  if (tuner_) {
+    // Timing out before reaching the frame count may indicate that the
+    // emulation has been broken by the settings.
+    tuner_->OnMeasured(title_id,
+                       !frame_intervals_us.empty() &&
+                           frames >= cvars::benchmark_frames,
+                       frame_time_mean_ms);
+    fmt::print(output,
+               "  \"tuning\": {{\"candidate\": \"{}\", \"accepted\": [",
+               tuner_->measured_candidate());
+    const std::vector<std::string>& accepted_candidates =
+        tuner_->accepted_candidates();
+    for (size_t i = 0; i < accepted_candidates.size(); ++i) {
+      fmt::print(output, "{}\"{}\"", i ? ", " : "", accepted_candidates[i]);
+    }
+    fmt::print(output, "], \"done\": {}}},\n", tuner_->is_done());
+  }
+
+  fmt::print(output, "  \"threads\": [");
+  bool first_thread = true;
+  for (const auto& thread :
+       kernel_state->object_table()->GetObjectsByType<kernel::XThread>()) {
+    auto cpu_time_end_it = thread_cpu_times_end.find(thread->thread_id());
+    if (cpu_time_end_it == thread_cpu_times_end.end()) {
+      continue;
+    }
+    // Threads created during the measurement have spent all their time in it.
+    uint64_t cpu_time_us = cpu_time_end_it->second;
+    auto cpu_time_start_it = thread_cpu_times_start.find(thread->thread_id());
+    if (cpu_time_start_it != thread_cpu_times_start.end()) {
+      cpu_time_us -= std::min(cpu_time_start_it->second, cpu_time_us);
+    }
+    fmt::print(output,
+               "{}\n    {{\"id\": {}, \"name\": \"{}\", "
+               "\"cpu_time_ms\": {:.3f}}}",
+               first_thread ? "" : ",", thread->thread_id(),
+               EscapeJsonString(thread->name()), double(cpu_time_us) * 0.001);
+    first_thread = false;
+  }
+  fmt::print(output, "\n  ]\n}}\n");
+  fclose(output);
+
+  XELOGI("Benchmark: {} frames in {:.3f} s written to {}", frames, duration_s,
+         xe::path_to_utf8(cvars::benchmark_output_path));
+  quit_function_();
+}
+
+}  // namespace app
+}  // namespace xe
@@ -0,0 +1,77 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_APP_BENCHMARK_RUNNER_H_
+#define XENIA_APP_BENCHMARK_RUNNER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "xenia/app/benchmark_tuner.h"
+#include "xenia/emulator.h"
+#include "xenia/hid/input_driver.h"
+#include "xenia/hid/scripted_input_driver.h"
+#include "xenia/ui/window.h"
+
+namespace xe {
+namespace app {
+
+// Measures the performance of the emulator running the launched title for a
+// number of guest frames or a duration specified with --benchmark_frames or
+// --benchmark_seconds, optionally playing the gamepad input back from
+// --benchmark_input_script, and writes the results as JSON to
+// --benchmark_output_path, requesting the app to quit afterwards. The runs may
+// also be used for tuning the settings of the title with
+// --benchmark_tune_path.
+class BenchmarkRunner {
+ public:
+  // Whether the benchmark mode has been enabled with the cvars.
+  static bool IsRequested();
+
+  // The quit function is called from the benchmark thread when the results
+  // have been written. Must be created in the UI thread before the emulator
+  // is set up.
+  BenchmarkRunner(Emulator* emulator, std::function<void()> quit_function);
+  BenchmarkRunner(const BenchmarkRunner& runner) = delete;
+  BenchmarkRunner& operator=(const BenchmarkRunner& runner) = delete;
+  ~BenchmarkRunner();
+
+  // Creates the driver playing the input script back, to be placed before the
+  // other input drivers, or returns nullptr if no script has been specified
+  // or it couldn't be loaded.
+  std::unique_ptr<hid::InputDriver> CreateInputDriver(ui::Window* window,
+                                                      size_t window_z_order);
+
+  // Starts the measurement, to be called when the title has been launched.
+  // Only the first launch is measured.
+  void OnLaunch(uint32_t title_id, std::string_view title_name);
+
+ private:
+  void Run(uint32_t title_id, std::string title_name);
+
+  Emulator* emulator_;
+  std::function<void()> quit_function_;
+  // Owned by the input system.
+  hid::ScriptedInputDriver* input_driver_ = nullptr;
+  std::unique_ptr<BenchmarkTuner> tuner_;
+
+  std::atomic<bool> started_ = {false};
+  std::atomic<bool> stop_requested_ = {false};
+  std::thread thread_;
+};
+
+}  // namespace app
+}  // namespace xe
+
+#endif  // XENIA_APP_BENCHMARK_RUNNER_H_
@@ -0,0 +1,338 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/app/benchmark_tuner.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string_view>
+#include <utility>
+
+#include "third_party/cpptoml/include/cpptoml.h"
+#include "third_party/fmt/include/fmt/format.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/utf8.h"
+#include "xenia/config.h"
+
+DEFINE_path(
+    benchmark_tune_path, "",
+    "File to keep the progress of tuning the settings of the benchmarked title "
+    "in. Every benchmark run with the same command line measures one "
+    "candidate setting, and when all the candidates have been measured, the "
+    "settings that made the title faster are written to the per-game config "
+    "of the title. Delete the file to tune again.",
+    "General");
+DEFINE_string(
+    benchmark_tune_candidates, "",
+    "Comma-separated candidate settings for --benchmark_tune_path to try, or "
+    "empty to try all: clock_source_raw, inline_mmio_access, "
+    "d3d12_readback_resolve, render_target_path_vulkan, draw_resolution_scale, "
+    "texture_cache_memory_limit. Rendering correctness is not checked, so "
+    "only the settings known to be correct for the titles should be tried.",
+    "General");
+DEFINE_uint32(benchmark_tune_min_gain, 3,
+              "Minimum reduction of the mean frame time, in percent, for "
+              "--benchmark_tune_path to accept a candidate setting.",
+              "General");
+
+namespace xe {
+namespace app {
+
+namespace {
+
+struct TuningSetting {
+  const char* cvar_name;
+  // TOML.
+  const char* value;
+};
+
+struct TuningCandidate {
+  const char* name;
+  TuningSetting settings[2];
+};
+
+// In the order of measurement - the earlier candidates have less potential to
+// break the emulation.
+const TuningCandidate kTuningCandidates[] = {
+    {"clock_source_raw", {{"clock_source_raw", "true"}}},
+    {"inline_mmio_access", {{"inline_mmio_access", "true"}}},
+    {"d3d12_readback_resolve", {{"d3d12_readback_resolve", "false"}}},
+    {"texture_cache_memory_limit",
+     {{"texture_cache_memory_limit_soft", "768"},
+      {"texture_cache_memory_limit_hard", "1536"}}},
+    {"render_target_path_vulkan", {{"render_target_path_vulkan", "\"fbo\""}}},
+    {"draw_resolution_scale",
+     {{"draw_resolution_scale_x", "1"}, {"draw_resolution_scale_y", "1"}}},
+};
+constexpr size_t kTuningCandidateCount = std::size(kTuningCandidates);
+
+cvar::IConfigVar* FindConfigVar(const char* name) {
+  if (!cvar::ConfigVars) {
+    return nullptr;
+  }
+  auto it = cvar::ConfigVars->find(name);
+  return it != cvar::ConfigVars->end() ? it->second : nullptr;
+}
+
+size_t FindCandidate(const std::string_view name) {
+  for (size_t i = 0; i < kTuningCandidateCount; ++i) {
+    if (name == kTuningCandidates[i].name) {
+      return i;
+    }
+  }
+  return kTuningCandidateCount;
+}
+
+// The options of the candidate may not exist on the platform, such as the
+// Direct3D 12 ones.
+bool IsCandidateEnabled(size_t index) {
+  const TuningCandidate& candidate = kTuningCandidates[index];
+  for (const TuningSetting& setting : candidate.settings) {
+    if (setting.cvar_name && !FindConfigVar(setting.cvar_name)) {
+      return false;
+    }
+  }
+  if (cvars::benchmark_tune_candidates.empty()) {
+    return true;
+  }
+  for (std::string_view name :
+       xe::utf8::split(cvars::benchmark_tune_candidates, ",", true)) {
+    if (xe::utf8::equal_case(name, candidate.name)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+bool BenchmarkTuner::IsRequested() {
+  return !cvars::benchmark_tune_path.empty();
+}
+
+BenchmarkTuner::BenchmarkTuner(Emulator& emulator)
+    : GameConfigLoadCallback(emulator),
+      state_path_(cvars::benchmark_tune_path) {
+  LoadState();
+
+  if (!done_ && !next_candidate_.empty()) {
+    size_t next_index = FindCandidate(next_candidate_);
+    if (next_index >= kTuningCandidateCount) {
+      XELOGW("Benchmark tuning: unknown candidate {} in {}, starting over",
+             next_candidate_, xe::path_to_utf8(state_path_));
+      ResetState(std::string());
+    } else if (!IsCandidateEnabled(next_index)) {
+      // The candidates have been changed since the previous run.
+      next_index = FindNextCandidate(std::ptrdiff_t(next_index));
+      if (next_index < kTuningCandidateCount) {
+        next_candidate_ = kTuningCandidates[next_index].name;
+      } else {
+        Finish();
+        SaveState();
+      }
+    }
+  }
+
+  for (const std::string& accepted_candidate : accepted_candidates_) {
+    size_t index = FindCandidate(accepted_candidate);
+    if (index < kTuningCandidateCount) {
+      applied_candidates_.push_back(index);
+    }
+  }
+  if (done_) {
+    XELOGI("Benchmark tuning: {} has been tuned, measuring the result",
+           title_id_);
+  } else if (next_candidate_.empty()) {
+    XELOGI("Benchmark tuning: measuring the baseline");
+  } else {
+    measured_candidate_ = next_candidate_;
+    applied_candidates_.push_back(FindCandidate(measured_candidate_));
+    XELOGI("Benchmark tuning: measuring {} for {}", measured_candidate_,
+           title_id_);
+  }
+  ApplySettings();
+}
+
+void BenchmarkTuner::PostGameConfigLoad() { ApplySettings(); }
+
+void BenchmarkTuner::OnMeasured(uint32_t title_id, bool completed,
+                                double frame_time_ms) {
+  std::string title_id_string = fmt::format("{:08X}", title_id);
+  if (title_id_ != title_id_string) {
+    if (!title_id_.empty()) {
+      // This run has been made with the settings of the other title.
+      XELOGW(
+          "Benchmark tuning: the progress in {} is for {}, starting over for "
+          "{}",
+          xe::path_to_utf8(state_path_), title_id_, title_id_string);
+      ResetState(title_id_string);
+      SaveState();
+      return;
+    }
+    title_id_ = std::move(title_id_string);
+  }
+
+  if (done_) {
+    XELOGI("Benchmark tuning: {:.3f} ms per frame with the tuned settings",
+           frame_time_ms);
+    return;
+  }
+
+  if (measured_candidate_.empty()) {
+    if (!completed) {
+      XELOGW(
+          "Benchmark tuning: the baseline run hasn't reached the frame count, "
+          "measuring the baseline again in the next run");
+      SaveState();
+      return;
+    }
+    best_frame_time_ms_ = frame_time_ms;
+    XELOGI("Benchmark tuning: baseline {:.3f} ms per frame", frame_time_ms);
+  } else if (!completed) {
+    XELOGI(
+        "Benchmark tuning: rejected {} - the run hasn't reached the frame "
+        "count",
+        measured_candidate_);
+  } else if (frame_time_ms <=
+             best_frame_time_ms_ *
+                 (1.0 - double(cvars::benchmark_tune_min_gain) * 0.01)) {
+    XELOGI("Benchmark tuning: accepted {} - {:.3f} ms per frame, was {:.3f}",
+           measured_candidate_, frame_time_ms, best_frame_time_ms_);
+    accepted_candidates_.push_back(measured_candidate_);
+    best_frame_time_ms_ = frame_time_ms;
+  } else {
+    XELOGI("Benchmark tuning: rejected {} - {:.3f} ms per frame, best {:.3f}",
+           measured_candidate_, frame_time_ms, best_frame_time_ms_);
+  }
+
+  size_t next_index = FindNextCandidate(
+      measured_candidate_.empty()
+          ? std::ptrdiff_t(-1)
+          : std::ptrdiff_t(FindCandidate(measured_candidate_)));
+  if (next_index < kTuningCandidateCount) {
+    next_candidate_ = kTuningCandidates[next_index].name;
+  } else {
+    Finish();
+  }
+  SaveState();
+}
+
+size_t BenchmarkTuner::FindNextCandidate(std::ptrdiff_t after) {
+  for (size_t i = size_t(after + 1); i < kTuningCandidateCount; ++i) {
+    if (IsCandidateEnabled(i)) {
+      return i;
+    }
+  }
+  return kTuningCandidateCount;
+}
+
+void BenchmarkTuner::LoadState() {
+  ResetState(std::string());
+  std::ifstream file(state_path_);
+  if (!file.is_open()) {
+    return;
+  }
+  try {
+    std::shared_ptr<cpptoml::table> state = cpptoml::parser(file).parse();
+    title_id_ = state->get_as<std::string>("title_id").value_or("");
+    next_candidate_ = state->get_as<std::string>("next_candidate").value_or("");
+    best_frame_time_ms_ =
+        state->get_as<double>("best_frame_time_ms").value_or(0.0);
+    accepted_candidates_ =
+        state->get_array_of<std::string>("accepted_candidates")
+            .value_or(std::vector<std::string>());
+    done_ = state->get_as<bool>("done").value_or(false);
+  } catch (cpptoml::parse_exception e) {
+    XELOGW("Benchmark tuning: failed to parse {}, starting over: {}",
+           xe::path_to_utf8(state_path_), e.what());
+    ResetState(std::string());
+  }
+}
+
+void BenchmarkTuner::ResetState(const std::string& title_id) {
+  title_id_ = title_id;
+  next_candidate_.clear();
+  best_frame_time_ms_ = 0.0;
+  accepted_candidates_.clear();
+  done_ = false;
+}
+
+void BenchmarkTuner::SaveState() const {
+  FILE* file = xe::filesystem::OpenFile(state_path_, "wb");
+  if (!file) {
+    XELOGE("Benchmark tuning: failed to open {} for writing",
+           xe::path_to_utf8(state_path_));
+    return;
+  }
+  fmt::print(file,
+             "# Progress of --benchmark_tune_path, delete this file to tune "
+             "again.\ntitle_id = \"{}\"\nnext_candidate = \"{}\"\n"
+             "best_frame_time_ms = {:.6f}\naccepted_candidates = [",
+             title_id_, next_candidate_, best_frame_time_ms_);
+  for (size_t i = 0; i < accepted_candidates_.size(); ++i) {
+    fmt::print(file, "{}\"{}\"", i ? ", " : "", accepted_candidates_[i]);
+  }
+  fmt::print(file, "]\ndone = {}\n", done_);
+  fclose(file);
+}
+
+void BenchmarkTuner::ApplySettings() const {
+  for (size_t index : applied_candidates_) {
+    for (const TuningSetting& setting : kTuningCandidates[index].settings) {
+      if (!setting.cvar_name) {
+        continue;
+      }
+      cvar::IConfigVar* config_var = FindConfigVar(setting.cvar_name);
+      if (!config_var) {
+        continue;
+      }
+      std::istringstream value_stream(std::string("value = ") + setting.value);
+      config_var->LoadGameConfigValue(
+          cpptoml::parser(value_stream).parse()->get("value"));
+    }
+  }
+}
+
+void BenchmarkTuner::Finish() {
+  done_ = true;
+  next_candidate_.clear();
+  if (accepted_candidates_.empty()) {
+    XELOGI("Benchmark tuning: no faster settings found for {}", title_id_);
+    return;
+  }
+  std::vector<std::pair<std::string, std::string>> values;
+  for (const std::string& accepted_candidate : accepted_candidates_) {
+    size_t index = FindCandidate(accepted_candidate);
+    if (index >= kTuningCandidateCount) {
+      continue;
+    }
+    for (const TuningSetting& setting : kTuningCandidates[index].settings) {
+      if (!setting.cvar_name) {
+        continue;
+      }
+      const cvar::IConfigVar* config_var = FindConfigVar(setting.cvar_name);
+      if (config_var) {
+        values.emplace_back(config_var->category() + "." + config_var->name(),
+                            setting.value);
+      }
+    }
+  }
+  if (config::UpdateGameConfig(title_id_, values)) {
+    XELOGI("Benchmark tuning: {} tuned, {:.3f} ms per frame", title_id_,
+           best_frame_time_ms_);
+  }
+}
+
+}  // namespace app
+}  // namespace xe
@@ -0,0 +1,95 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_APP_BENCHMARK_TUNER_H_
+#define XENIA_APP_BENCHMARK_TUNER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "xenia/emulator.h"
+
+namespace xe {
+namespace app {
+
+// Finds the fastest settings for a title among the candidate settings trading
+// accuracy for performance, over a series of benchmark runs of the title with
+// the same command line and --benchmark_tune_path. The first run measures the
+// baseline, and each next run measures one more candidate on top of the ones
+// already accepted, accepting it if the mean frame time is lower by at least
+// --benchmark_tune_min_gain percent. Many of the settings are only read when
+// the emulator is initialized, so every candidate needs its own run. When all
+// the candidates have been measured, the accepted ones are written to the
+// per-game config of the title.
+//
+// Only whether the run has reached --benchmark_frames is checked, not whether
+// the title is rendered correctly - --benchmark_tune_candidates should be
+// limited to the settings known not to break the titles being tuned. Options
+// specified on the command line take precedence over the candidates.
+class BenchmarkTuner : public Emulator::GameConfigLoadCallback {
+ public:
+  // Whether tuning has been enabled with the cvars.
+  static bool IsRequested();
+
+  // Loads the progress and applies the settings to measure in this run. Must
+  // be created in the UI thread before the emulator is set up.
+  explicit BenchmarkTuner(Emulator& emulator);
+
+  // Applies the settings again over the per-game config.
+  void PostGameConfigLoad() override;
+
+  // Records the measurement of this run, advancing the tuning, and writes the
+  // accepted settings to the per-game config if all the candidates have been
+  // measured. completed is whether the run has reached --benchmark_frames
+  // rather than timing out.
+  void OnMeasured(uint32_t title_id, bool completed, double frame_time_ms);
+
+  // The candidate measured in this run, empty for the baseline.
+  const std::string& measured_candidate() const { return measured_candidate_; }
+  const std::vector<std::string>& accepted_candidates() const {
+    return accepted_candidates_;
+  }
+  bool is_done() const { return done_; }
+
+ private:
+  // Returns the index of the first enabled candidate after the one with the
+  // specified index (-1 to search from the beginning), or the candidate count
+  // if there are no more.
+  static size_t FindNextCandidate(std::ptrdiff_t after);
+
+  void LoadState();
+  void ResetState(const std::string& title_id);
+  void SaveState() const;
+  void ApplySettings() const;
+  // Marks the tuning as done and writes the accepted settings to the per-game
+  // config.
+  void Finish();
+
+  std::filesystem::path state_path_;
+
+  // Empty if not started yet.
+  std::string title_id_;
+  // Name of the next candidate to measure, empty for the baseline.
+  std::string next_candidate_;
+  double best_frame_time_ms_ = 0.0;
+  std::vector<std::string> accepted_candidates_;
+  bool done_ = false;
+
+  // Indices of the candidates applied in this run.
+  std::vector<size_t> applied_candidates_;
+  std::string measured_candidate_;
+};
+
+}  // namespace app
+}  // namespace xe
+
+#endif  // XENIA_APP_BENCHMARK_TUNER_H_
@@ -9,6 +9,9 @@
 
 #include "xenia/app/emulator_window.h"
 
+#include <array>
+#include <cfloat>
+#include <cinttypes>
 #include <filesystem>
 #include <functional>
 #include <memory>
@@ -18,6 +21,8 @@
 
 #include "third_party/fmt/include/fmt/format.h"
 #include "third_party/imgui/imgui.h"
+#include "xenia/apu/audio_system.h"
+#include "xenia/apu/xma_decoder.h"
 #include "xenia/base/assert.h"
 #include "xenia/base/clock.h"
 #include "xenia/base/cvar.h"
@@ -27,6 +32,7 @@
 #include "xenia/base/profiling.h"
 #include "xenia/base/system.h"
 #include "xenia/base/threading.h"
+#include "xenia/cpu/ppc/ppc_frontend.h"
 #include "xenia/cpu/processor.h"
 #include "xenia/emulator.h"
 #include "xenia/gpu/command_processor.h"
@@ -499,6 +505,209 @@ void EmulatorWindow::DisplayConfigDialog::OnDraw(ImGuiIO& io) {
   }
 }
 
+void EmulatorWindow::GpuStatisticsDialog::OnDraw(ImGuiIO& io) {
+  gpu::GraphicsSystem* graphics_system =
+      emulator_window_.emulator_->graphics_system();
+  if (!graphics_system) {
+    return;
+  }
+  gpu::CommandProcessor* command_processor =
+      graphics_system->command_processor();
+  if (!command_processor) {
+    return;
+  }
+
+  // In the top-right corner, not to overlap the post-processing dialog.
+  ImGui::SetNextWindowPos(ImVec2(io.DisplaySize.x - 20, 20),
+                          ImGuiCond_FirstUseEver, ImVec2(1, 0));
+  // Alpha from the Dear ImGui overlay demo as it's shown during gameplay.
+  ImGui::SetNextWindowBgAlpha(0.35f);
+  bool dialog_open = true;
+  if (!ImGui::Begin("GPU statistics", &dialog_open,
+                    ImGuiWindowFlags_NoCollapse |
+                        ImGuiWindowFlags_AlwaysAutoResize |
+                        ImGuiWindowFlags_NoFocusOnAppearing |
+                        ImGuiWindowFlags_NoNav)) {
+    ImGui::End();
+    return;
+  }
+
+  using Statistics = gpu::GpuStatistics;
+  Statistics::Values values;
+  std::array<float, Statistics::kFrameHistoryLength> gpu_time_ms_history;
+  uint64_t frame = command_processor->statistics().GetLastFrame(
+      values, &gpu_time_ms_history);
+  if (!frame) {
+    ImGui::TextUnformatted("No frames completed yet.");
+  } else {
+    ImGui::Text("Frame %" PRIu64, frame);
+    if (values.submissions_measured) {
+      ImGui::Text("Host GPU time: %.3f ms (%u of %u submissions measured)",
+                  double(values.gpu_time_ns) * 0.000001,
+                  values.submissions_measured, values.submissions);
+    } else {
+      ImGui::Text("Host GPU time: unknown (%u submissions)",
+                  values.submissions);
+    }
+    ImGui::PlotLines("##gpu_time", gpu_time_ms_history.data(),
+                     int(gpu_time_ms_history.size()), 0, nullptr, 0.0f,
+                     FLT_MAX, ImVec2(0, 48));
+    ImGui::Separator();
+    ImGui::Text("Draws: %" PRIu64, values[Statistics::Counter::kDraws]);
+    ImGui::Text("Resolves: %" PRIu64, values[Statistics::Counter::kResolves]);
+    ImGui::Text("EDRAM transfers: %" PRIu64,
+                values[Statistics::Counter::kEdramTransfers]);
+    ImGui::Text("EDRAM transfer render passes: %" PRIu64,
+                values[Statistics::Counter::kEdramTransferRenderPasses]);
+    ImGui::Text("Texture loads: %" PRIu64,
+                values[Statistics::Counter::kTextureLoads]);
+    ImGui::Text("Uploaded: %.1f KB",
+                double(values[Statistics::Counter::kUploadBytes]) / 1024.0);
+    ImGui::Text(
+        "Upload buffer space wasted: %.1f KB",
+        double(values[Statistics::Counter::kUploadBytesWasted]) / 1024.0);
+    ImGui::Text(
+        "Shared memory allocations: %" PRIu64 " (%.1f KB, %.1f KB predicted)",
+        values[Statistics::Counter::kSharedMemoryAllocations],
+        double(values[Statistics::Counter::kSharedMemoryAllocatedBytes]) /
+            1024.0,
+        double(values[Statistics::Counter::kSharedMemoryPredictedBytes]) /
+            1024.0);
+    ImGui::Text(
+        "Pipelines created: %" PRIu64 " (%" PRIu64
+        " more state combinations shared via dynamic state)",
+        values[Statistics::Counter::kPipelinesCreated],
+        values[Statistics::Counter::kPipelinesSharedByDynamicState]);
+    ImGui::Text("Barriers: %" PRIu64 " (%" PRIu64 " barrier commands)",
+                values[Statistics::Counter::kBarriers],
+                values[Statistics::Counter::kBarrierCommands]);
+  }
+
+  ImGui::End();
+
+  if (!dialog_open) {
+    emulator_window_.ToggleGpuStatisticsDialog();
+    // `this` might have been destroyed by ToggleGpuStatisticsDialog.
+    return;
+  }
+}
+
+void EmulatorWindow::PerformanceOverlayDialog::OnDraw(ImGuiIO& io) {
+  Emulator& emulator = *emulator_window_.emulator_;
+
+  // Update the rates of the totals exposed by the subsystems.
+  uint64_t time_ms = Clock::QueryHostUptimeMillis();
+  if (!rate_sample_time_ms_ ||
+      time_ms - rate_sample_time_ms_ >= kRateSampleIntervalMs) {
+    uint64_t translations = 0;
+    cpu::Processor* processor = emulator.processor();
+    if (processor && processor->frontend()) {
+      translations = processor->frontend()->translation_count();
+    }
+    uint64_t xma_decode_time_us = 0;
+    apu::AudioSystem* audio_system = emulator.audio_system();
+    if (audio_system && audio_system->xma_decoder()) {
+      xma_decode_time_us = audio_system->xma_decoder()->QueryDecodeTimeMicros();
+    }
+    if (rate_sample_time_ms_) {
+      float interval_s = float(time_ms - rate_sample_time_ms_) * 0.001f;
+      translations_per_second_ =
+          float(translations - rate_sample_translations_) / interval_s;
+      xma_decode_load_ =
+          float(xma_decode_time_us - rate_sample_xma_decode_time_us_) *
+          0.000001f / interval_s;
+    }
+    rate_sample_time_ms_ = time_ms;
+    rate_sample_translations_ = translations;
+    rate_sample_xma_decode_time_us_ = xma_decode_time_us;
+  }
+
+  // In the top-left corner, as the GPU statistics are in the top-right.
+  ImGui::SetNextWindowPos(ImVec2(20, 20), ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowBgAlpha(0.35f);
+  bool dialog_open = true;
+  if (!ImGui::Begin("Performance", &dialog_open,
+                    ImGuiWindowFlags_NoCollapse |
+                        ImGuiWindowFlags_AlwaysAutoResize |
+                        ImGuiWindowFlags_NoFocusOnAppearing |
+                        ImGuiWindowFlags_NoNav)) {
+    ImGui::End();
+    return;
+  }
+
+  gpu::CommandProcessor* command_processor = nullptr;
+  gpu::GraphicsSystem* graphics_system = emulator.graphics_system();
+  if (graphics_system) {
+    command_processor = graphics_system->command_processor();
+  }
+  if (command_processor) {
+    using Statistics = gpu::GpuStatistics;
+    const Statistics& statistics = command_processor->statistics();
+
+    // Frame rate from the frames in the history ended within the latest
+    // second.
+    std::array<float, Statistics::kFrameHistoryLength> frame_time_ms_history;
+    statistics.GetFrameTimeHistory(frame_time_ms_history);
+    float frame_rate_time_ms = 0.0f;
+    uint32_t frame_rate_frames = 0;
+    for (uint32_t i = Statistics::kFrameHistoryLength; i--;) {
+      float frame_time_ms = frame_time_ms_history[i];
+      if (!frame_time_ms || frame_rate_time_ms >= 1000.0f) {
+        break;
+      }
+      frame_rate_time_ms += frame_time_ms;
+      ++frame_rate_frames;
+    }
+    if (frame_rate_frames) {
+      ImGui::Text("%.1f FPS (%.2f ms)",
+                  1000.0f * float(frame_rate_frames) / frame_rate_time_ms,
+                  frame_time_ms_history[Statistics::kFrameHistoryLength - 1]);
+    } else {
+      ImGui::TextUnformatted("No frames yet");
+    }
+    ImGui::PlotLines("##frame_time", frame_time_ms_history.data(),
+                     int(frame_time_ms_history.size()), 0, nullptr, 0.0f,
+                     FLT_MAX, ImVec2(0, 48));
+
+    Statistics::Values values;
+    std::array<float, Statistics::kFrameHistoryLength> gpu_time_ms_history;
+    if (statistics.GetLastFrame(values, &gpu_time_ms_history) &&
+        values.submissions_measured) {
+      ImGui::Text("Host GPU: %.2f ms", double(values.gpu_time_ns) * 0.000001);
+      ImGui::PlotLines("##gpu_time", gpu_time_ms_history.data(),
+                       int(gpu_time_ms_history.size()), 0, nullptr, 0.0f,
+                       FLT_MAX, ImVec2(0, 48));
+    }
+
+    uint64_t texture_memory_limit_hard = statistics.GetGauge(
+        Statistics::Gauge::kTextureMemoryLimitHardBytes);
+    if (texture_memory_limit_hard) {
+      ImGui::Text(
+          "Textures: %.1f MB (limits %.1f / %.1f MB)",
+          double(statistics.GetGauge(Statistics::Gauge::kTextureMemoryBytes)) /
+              1048576.0,
+          double(statistics.GetGauge(
+              Statistics::Gauge::kTextureMemoryLimitSoftBytes)) /
+              1048576.0,
+          double(texture_memory_limit_hard) / 1048576.0);
+    }
+    ImGui::Text(
+        "Pipelines pending: %" PRIu64,
+        statistics.GetGauge(Statistics::Gauge::kPipelinesPending));
+  }
+
+  ImGui::Text("JIT translations: %.0f/s", translations_per_second_);
+  ImGui::Text("XMA decoding: %.0f%% of a thread", xma_decode_load_ * 100.0f);
+
+  ImGui::End();
+
+  if (!dialog_open) {
+    emulator_window_.TogglePerformanceOverlayDialog();
+    // `this` might have been destroyed by TogglePerformanceOverlayDialog.
+    return;
+  }
+}
+
 bool EmulatorWindow::Initialize() {
   window_->AddListener(&window_listener_);
   window_->AddInputListener(&window_listener_, kZOrderEmulatorWindowInput);
@@ -574,6 +783,12 @@ bool EmulatorWindow::Initialize() {
         MenuItem::Create(MenuItem::Type::kString, "&Clear Runtime Caches", "F5",
                          std::bind(&EmulatorWindow::GpuClearCaches, this)));
   }
+  gpu_menu->AddChild(MenuItem::Create(MenuItem::Type::kSeparator));
+  {
+    gpu_menu->AddChild(MenuItem::Create(
+        MenuItem::Type::kString, "Show &Statistics",
+        std::bind(&EmulatorWindow::ToggleGpuStatisticsDialog, this)));
+  }
   main_menu->AddChild(std::move(gpu_menu));
 
   // Display menu.
@@ -582,6 +797,9 @@ bool EmulatorWindow::Initialize() {
     display_menu->AddChild(MenuItem::Create(
         MenuItem::Type::kString, "&Post-processing settings", "F6",
         std::bind(&EmulatorWindow::ToggleDisplayConfigDialog, this)));
+    display_menu->AddChild(MenuItem::Create(
+        MenuItem::Type::kString, "Performance &overlay", "F9",
+        std::bind(&EmulatorWindow::TogglePerformanceOverlayDialog, this)));
   }
   display_menu->AddChild(MenuItem::Create(MenuItem::Type::kSeparator));
   {
@@ -757,6 +975,9 @@ void EmulatorWindow::OnKeyDown(ui::KeyEvent& e) {
     case ui::VirtualKey::kF6: {
       ToggleDisplayConfigDialog();
     } break;
+    case ui::VirtualKey::kF9: {
+      TogglePerformanceOverlayDialog();
+    } break;
     case ui::VirtualKey::kF11: {
       ToggleFullscreen();
     } break;
@@ -825,8 +1046,9 @@ void EmulatorWindow::FileOpen() {
   file_picker->set_multi_selection(false);
   file_picker->set_title("Select Content Package");
   file_picker->set_extensions({
-      {"Supported Files", "*.iso;*.xex;*.*"},
+      {"Supported Files", "*.iso;*.xcdi;*.xex;*.*"},
       {"Disc Image (*.iso)", "*.iso"},
+      {"Compressed Disc Image (*.xcdi)", "*.xcdi"},
       {"Xbox Executable (*.xex)", "*.xex"},
       //{"Content Package (*.xcp)", "*.xcp" },
       {"All Files (*.*)", "*.*"},
@@ -942,6 +1164,24 @@ void EmulatorWindow::ToggleDisplayConfigDialog() {
   }
 }
 
+void EmulatorWindow::ToggleGpuStatisticsDialog() {
+  if (!gpu_statistics_dialog_) {
+    gpu_statistics_dialog_ = std::unique_ptr<GpuStatisticsDialog>(
+        new GpuStatisticsDialog(imgui_drawer_.get(), *this));
+  } else {
+    gpu_statistics_dialog_.reset();
+  }
+}
+
+void EmulatorWindow::TogglePerformanceOverlayDialog() {
+  if (!performance_overlay_dialog_) {
+    performance_overlay_dialog_ = std::unique_ptr<PerformanceOverlayDialog>(
+        new PerformanceOverlayDialog(imgui_drawer_.get(), *this));
+  } else {
+    performance_overlay_dialog_.reset();
+  }
+}
+
 void EmulatorWindow::ShowCompatibility() {
   const std::string_view base_url =
       "https://github.com/xenia-project/game-compatibility/issues";
@@ -105,6 +105,46 @@ class EmulatorWindow {
     EmulatorWindow& emulator_window_;
   };
 
+  class GpuStatisticsDialog final : public ui::ImGuiDialog {
+   public:
+    GpuStatisticsDialog(ui::ImGuiDrawer* imgui_drawer,
+                        EmulatorWindow& emulator_window)
+        : ui::ImGuiDialog(imgui_drawer), emulator_window_(emulator_window) {}
+
+   protected:
+    void OnDraw(ImGuiIO& io) override;
+
+   private:
+    EmulatorWindow& emulator_window_;
+  };
+
+  // Compact overlay of the frame rate and the load of the subsystems, to be
+  // kept open during gameplay, unlike the detailed GPU statistics.
+  class PerformanceOverlayDialog final : public ui::ImGuiDialog {
+   public:
+    PerformanceOverlayDialog(ui::ImGuiDrawer* imgui_drawer,
+                             EmulatorWindow& emulator_window)
+        : ui::ImGuiDialog(imgui_drawer), emulator_window_(emulator_window) {}
+
+   protected:
+    void OnDraw(ImGuiIO& io) override;
+
+   private:
+    // Rates of the totals exposed by the subsystems are updated periodically
+    // rather than every paint for them to be readable.
+    static constexpr uint64_t kRateSampleIntervalMs = 500;
+
+    EmulatorWindow& emulator_window_;
+
+    // 0 if not sampled yet.
+    uint64_t rate_sample_time_ms_ = 0;
+    uint64_t rate_sample_translations_ = 0;
+    uint64_t rate_sample_xma_decode_time_us_ = 0;
+    float translations_per_second_ = 0.0f;
+    // Fraction of the time of one host thread.
+    float xma_decode_load_ = 0.0f;
+  };
+
   explicit EmulatorWindow(Emulator* emulator,
                           ui::WindowedAppContext& app_context);
 
@@ -138,6 +178,8 @@ class EmulatorWindow {
   void CpuBreakIntoHostDebugger();
   void GpuTraceFrame();
   void GpuClearCaches();
+  void ToggleGpuStatisticsDialog();
+  void TogglePerformanceOverlayDialog();
   void ToggleDisplayConfigDialog();
   void ShowCompatibility();
   void ShowFAQ();
@@ -159,6 +201,8 @@ class EmulatorWindow {
   bool initializing_shader_storage_ = false;
 
   std::unique_ptr<DisplayConfigDialog> display_config_dialog_;
+  std::unique_ptr<GpuStatisticsDialog> gpu_statistics_dialog_;
+  std::unique_ptr<PerformanceOverlayDialog> performance_overlay_dialog_;
 };
 
 }  // namespace app
@@ -15,6 +15,7 @@
 #include <thread>
 #include <vector>
 
+#include "xenia/app/benchmark_runner.h"
 #include "xenia/app/discord/discord_presence.h"
 #include "xenia/app/emulator_window.h"
 #include "xenia/base/assert.h"
@@ -222,6 +223,8 @@ class EmulatorApp final : public xe::ui::WindowedApp {
 
   std::unique_ptr<Emulator> emulator_;
   std::unique_ptr<EmulatorWindow> emulator_window_;
+  // Created if the benchmark mode has been requested.
+  std::unique_ptr<BenchmarkRunner> benchmark_runner_;
 
   // Created on demand, used by the emulator.
   std::unique_ptr<xe::debug::ui::DebugWindow> debug_window_;
@@ -448,6 +451,11 @@ bool EmulatorApp::OnInitialize() {
     return false;
   }
 
+  if (BenchmarkRunner::IsRequested()) {
+    benchmark_runner_ = std::make_unique<BenchmarkRunner>(
+        emulator_.get(), [this]() { app_context().RequestDeferredQuit(); });
+  }
+
   // Setup the emulator and run its loop in a separate thread.
   emulator_thread_quit_requested_.store(false, std::memory_order_relaxed);
   emulator_thread_event_ = xe::threading::Event::CreateAutoResetEvent(false);
@@ -486,7 +494,22 @@ void EmulatorApp::EmulatorThread() {
   // (unsupported system, memory issues, etc) this will fail early.
   X_STATUS result = emulator_->Setup(
       emulator_window_->window(), emulator_window_->imgui_drawer(), true,
-      CreateAudioSystem, CreateGraphicsSystem, CreateInputDrivers);
+      CreateAudioSystem, CreateGraphicsSystem, [this](ui::Window* window) {
+        std::vector<std::unique_ptr<hid::InputDriver>> drivers;
+        if (benchmark_runner_) {
+          // Before the other drivers to take over the first user.
+          std::unique_ptr<hid::InputDriver> benchmark_driver =
+              benchmark_runner_->CreateInputDriver(
+                  window, EmulatorWindow::kZOrderHidInput);
+          if (benchmark_driver) {
+            drivers.emplace_back(std::move(benchmark_driver));
+          }
+        }
+        for (auto& driver : CreateInputDrivers(window)) {
+          drivers.emplace_back(std::move(driver));
+        }
+        return drivers;
+      });
   if (XFAILED(result)) {
     XELOGE("Failed to setup emulator: {:08X}", result);
     app_context().RequestDeferredQuit();
@@ -578,6 +601,9 @@ void EmulatorApp::EmulatorThread() {
           game_title.empty() ? "Unknown Title" : std::string(game_title));
     }
     app_context().CallInUIThread([this]() { emulator_window_->UpdateTitle(); });
+    if (benchmark_runner_) {
+      benchmark_runner_->OnLaunch(title_id, game_title);
+    }
     emulator_thread_event_->Set();
   });
 
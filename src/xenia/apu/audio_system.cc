@@ -9,11 +9,15 @@
 
 #include "xenia/apu/audio_system.h"
 
+#include <algorithm>
+
 #include "xenia/apu/apu_flags.h"
 #include "xenia/apu/audio_driver.h"
 #include "xenia/apu/xma_decoder.h"
 #include "xenia/base/assert.h"
 #include "xenia/base/byte_stream.h"
+#include "xenia/base/clock.h"
+#include "xenia/base/cvar.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
 #include "xenia/base/profiling.h"
@@ -21,6 +25,7 @@
 #include "xenia/base/string_buffer.h"
 #include "xenia/base/threading.h"
 #include "xenia/cpu/thread_state.h"
+#include "xenia/kernel/kernel_state.h"
 
 // As with normal Microsoft, there are like twelve different ways to access
 // the audio APIs. Early games use XMA*() methods almost exclusively to touch
@@ -34,6 +39,13 @@
 // and let the normal AudioSystem handling take it, to prevent duplicate
 // implementations. They can be found in xboxkrnl_audio_xma.cc
 
+DEFINE_int32(apu_max_queued_frames, 64,
+             "Maximum number of audio frames (of 256 samples, about 5.3 ms at "
+             "48 kHz) that may be submitted to the audio driver ahead of "
+             "playback. Lower values reduce the audio latency, but may cause "
+             "crackling if the emulation can't keep up. From 4 to 64.",
+             "APU");
+
 namespace xe {
 namespace apu {
 
@@ -81,6 +93,9 @@ X_STATUS AudioSystem::Setup(kernel::KernelState* kernel_state) {
   worker_thread_->set_can_debugger_suspend(true);
   worker_thread_->set_name("Audio Worker");
   worker_thread_->Create();
+  kernel_state->host_processor_map().ApplyHostThreadAffinity(
+      worker_thread_->thread(),
+      kernel::util::HostProcessorMap::HostThread::kAudio);
 
   return X_STATUS_SUCCESS;
 }
@@ -89,11 +104,16 @@ void AudioSystem::WorkerThreadMain() {
   // Initialize driver and ringbuffer.
   Initialize();
 
+  // The client callbacks resolved by the worker, as the same callback is
+  // called for every frame.
+  uint32_t resolved_callbacks[kMaximumClientCount] = {};
+  cpu::Function* resolved_callback_functions[kMaximumClientCount] = {};
+
   // Main run loop.
   while (worker_running_) {
-    // These handles signify the number of submitted samples. Once we reach
-    // 64 samples, we wait until our audio backend releases a semaphore
-    // (signaling a sample has finished playing)
+    // These handles signify the number of submitted frames. Once we reach
+    // the queued frame limit, we wait until our audio backend releases a
+    // semaphore (signaling a frame has finished playing)
     auto result =
         xe::threading::WaitAny(wait_handles_, xe::countof(wait_handles_), true);
     if (result.first == xe::threading::WaitResult::kFailed) {
@@ -112,8 +132,8 @@ void AudioSystem::WorkerThreadMain() {
       continue;
     }
 
-    // Number of clients pumped
-    bool pumped = false;
+    // Woken up without a client to pump otherwise (by an APC, for instance) -
+    // go back to waiting right away, not to delay the next frame.
     if (result.first == xe::threading::WaitResult::kSuccess) {
       auto index = result.second;
 
@@ -124,28 +144,40 @@ void AudioSystem::WorkerThreadMain() {
 
       if (client_callback) {
         SCOPE_profile_cpu_i("apu", "xe::apu::AudioSystem->client_callback");
+        uint64_t callback_start_ticks = Clock::QueryHostTickCount();
+        if (resolved_callbacks[index] != client_callback) {
+          resolved_callbacks[index] = client_callback;
+          resolved_callback_functions[index] =
+              processor_->ResolveFunction(client_callback);
+        }
         uint64_t args[] = {client_callback_arg};
-        processor_->Execute(worker_thread_->thread_state(), client_callback,
-                            args, xe::countof(args));
+        if (resolved_callback_functions[index]) {
+          processor_->Execute(worker_thread_->thread_state(),
+                              resolved_callback_functions[index], args,
+                              xe::countof(args));
+        }
+        uint64_t callback_ticks =
+            Clock::QueryHostTickCount() - callback_start_ticks;
+        ++callback_count_;
+        callback_ticks_total_ += callback_ticks;
+        callback_ticks_max_ = std::max(callback_ticks_max_, callback_ticks);
       }
-
-      pumped = true;
     }
 
     if (!worker_running_) {
       break;
     }
-
-    if (!pumped) {
-      SCOPE_profile_cpu_i("apu", "Sleep");
-      xe::threading::Sleep(std::chrono::milliseconds(500));
-    }
   }
   worker_running_ = false;
 
   // TODO(benvanik): call module API to kill?
 }
 
+size_t AudioSystem::GetQueuedFrameLimit() {
+  return size_t(std::min(std::max(cvars::apu_max_queued_frames, int32_t(4)),
+                         int32_t(kMaximumQueuedFrames)));
+}
+
 int AudioSystem::FindFreeClient() {
   for (int i = 0; i < kMaximumClientCount; i++) {
     auto& client = clients_[i];
@@ -165,6 +197,15 @@ void AudioSystem::Shutdown() {
   if (worker_thread_) {
     worker_thread_->Wait(0, 0, 0, nullptr);
     worker_thread_.reset();
+    if (callback_count_) {
+      double ms_per_tick = 1000.0 / double(Clock::QueryHostTickFrequency());
+      XELOGI(
+          "Audio client callbacks: {} pumped, {:.3f} ms on average, {:.3f} ms "
+          "at most",
+          callback_count_,
+          callback_ticks_total_ * ms_per_tick / callback_count_,
+          callback_ticks_max_ * ms_per_tick);
+    }
   }
 }
 
@@ -176,7 +217,7 @@ X_STATUS AudioSystem::RegisterClient(uint32_t callback, uint32_t callback_arg,
   assert_true(index >= 0);
 
   auto client_semaphore = client_semaphores_[index].get();
-  auto ret = client_semaphore->Release(kMaximumQueuedFrames, nullptr);
+  auto ret = client_semaphore->Release(int(GetQueuedFrameLimit()), nullptr);
   assert_true(ret);
 
   AudioDriver* driver;
@@ -251,7 +292,7 @@ bool AudioSystem::Save(ByteStream* stream) {
     stream->Write(client.wrapped_callback_arg);
   }
 
-  return true;
+  return xma_decoder_->Save(stream);
 }
 
 bool AudioSystem::Restore(ByteStream* stream) {
@@ -279,7 +320,7 @@ bool AudioSystem::Restore(ByteStream* stream) {
     client.in_use = true;
 
     auto client_semaphore = client_semaphores_[id].get();
-    auto ret = client_semaphore->Release(kMaximumQueuedFrames, nullptr);
+    auto ret = client_semaphore->Release(int(GetQueuedFrameLimit()), nullptr);
     assert_true(ret);
 
     AudioDriver* driver = nullptr;
@@ -296,7 +337,7 @@ bool AudioSystem::Restore(ByteStream* stream) {
     client.driver = driver;
   }
 
-  return true;
+  return xma_decoder_->Restore(stream);
 }
 
 void AudioSystem::Pause() {
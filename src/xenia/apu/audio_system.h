@@ -30,6 +30,12 @@ class XmaDecoder;
 
 class AudioSystem {
  public:
+  // The number of frames that a client's driver may have queued at once, as
+  // limited by the client's semaphore.
+  // TODO(gibbed): respect XAUDIO2_MAX_QUEUED_BUFFERS somehow (ie min(64,
+  // XAUDIO2_MAX_QUEUED_BUFFERS))
+  static const size_t kMaximumQueuedFrames = 64;
+
   virtual ~AudioSystem();
 
   Memory* memory() const { return memory_; }
@@ -63,16 +69,17 @@ class AudioSystem {
                                 AudioDriver** out_driver) = 0;
   virtual void DestroyDriver(AudioDriver* driver) = 0;
 
-  // TODO(gibbed): respect XAUDIO2_MAX_QUEUED_BUFFERS somehow (ie min(64,
-  // XAUDIO2_MAX_QUEUED_BUFFERS))
-  static const size_t kMaximumQueuedFrames = 64;
-
   Memory* memory_ = nullptr;
   cpu::Processor* processor_ = nullptr;
   std::unique_ptr<XmaDecoder> xma_decoder_;
 
   std::atomic<bool> worker_running_ = {false};
   kernel::object_ref<kernel::XHostThread> worker_thread_;
+  // Execution time statistics of the client callbacks pumped by the worker, in
+  // host ticks.
+  uint64_t callback_count_ = 0;
+  uint64_t callback_ticks_total_ = 0;
+  uint64_t callback_ticks_max_ = 0;
 
   xe::global_critical_region global_critical_region_;
   static const size_t kMaximumClientCount = 8;
@@ -85,6 +92,9 @@ class AudioSystem {
   } clients_[kMaximumClientCount];
 
   int FindFreeClient();
+  // The number of frames within kMaximumQueuedFrames that the semaphore of a
+  // client allows to be queued, from the configuration.
+  static size_t GetQueuedFrameLimit();
 
   std::unique_ptr<xe::threading::Semaphore>
       client_semaphores_[kMaximumClientCount];
@@ -10,35 +10,57 @@
 #ifndef XENIA_APU_CONVERSION_H_
 #define XENIA_APU_CONVERSION_H_
 
+#include <cstddef>
 #include <cstdint>
 
+#include "xenia/base/assert.h"
 #include "xenia/base/byte_order.h"
 #include "xenia/base/platform.h"
 
+#if XE_ARCH_ARM64
+#include <arm_neon.h>
+#endif  // XE_ARCH_ARM64
+
 namespace xe {
 namespace apu {
 namespace conversion {
 
+// The input is 6 channels of big-endian samples stored sequentially, in the
+// default 5.1 channel mapping (fl, fr, fc, lf, bl, br):
+// https://docs.microsoft.com/en-us/windows/win32/xaudio2/xaudio2-default-channel-mapping
+// The output is interleaved little-endian samples. The vectorized versions
+// require the channel sample count to be a multiple of 4.
+
 #if XE_ARCH_AMD64
 inline void sequential_6_BE_to_interleaved_6_LE(float* output,
                                                 const float* input,
                                                 size_t ch_sample_count) {
-  const uint32_t* in = reinterpret_cast<const uint32_t*>(input);
-  uint32_t* out = reinterpret_cast<uint32_t*>(output);
+  assert_true(ch_sample_count % 4 == 0);
   const __m128i byte_swap_shuffle =
       _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
-  for (size_t sample = 0; sample < ch_sample_count; sample++) {
-    __m128i sample0 = _mm_set_epi32(
-        in[3 * ch_sample_count + sample], in[2 * ch_sample_count + sample],
-        in[1 * ch_sample_count + sample], in[0 * ch_sample_count + sample]);
-    uint32_t sample1 = in[4 * ch_sample_count + sample];
-    uint32_t sample2 = in[5 * ch_sample_count + sample];
-    sample0 = _mm_shuffle_epi8(sample0, byte_swap_shuffle);
-    _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[sample * 6]), sample0);
-    sample1 = xe::byte_swap(sample1);
-    out[sample * 6 + 4] = sample1;
-    sample2 = xe::byte_swap(sample2);
-    out[sample * 6 + 5] = sample2;
+  for (size_t sample = 0; sample < ch_sample_count; sample += 4) {
+    // Load 4 samples from 6 channels each and byte swap them.
+    __m128 channels[6];
+    for (size_t channel = 0; channel < 6; ++channel) {
+      channels[channel] = _mm_castsi128_ps(_mm_shuffle_epi8(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+              &input[channel * ch_sample_count + sample])),
+          byte_swap_shuffle));
+    }
+    // Channels 0:3 of each sample.
+    _MM_TRANSPOSE4_PS(channels[0], channels[1], channels[2], channels[3]);
+    // Channels 4:5 of samples 0:1 and 2:3.
+    __m128 channels_45_01 = _mm_unpacklo_ps(channels[4], channels[5]);
+    __m128 channels_45_23 = _mm_unpackhi_ps(channels[4], channels[5]);
+    float* out = &output[sample * 6];
+    _mm_storeu_ps(out, channels[0]);
+    _mm_storel_pi(reinterpret_cast<__m64*>(out + 4), channels_45_01);
+    _mm_storeu_ps(out + 6, channels[1]);
+    _mm_storeh_pi(reinterpret_cast<__m64*>(out + 10), channels_45_01);
+    _mm_storeu_ps(out + 12, channels[2]);
+    _mm_storel_pi(reinterpret_cast<__m64*>(out + 16), channels_45_23);
+    _mm_storeu_ps(out + 18, channels[3]);
+    _mm_storeh_pi(reinterpret_cast<__m64*>(out + 22), channels_45_23);
   }
 }
 
@@ -82,6 +104,61 @@ inline void sequential_6_BE_to_interleaved_2_LE(float* output,
     _mm_storeu_ps(&output[(sample + 2) * 2], _mm_unpackhi_ps(left, right));
   }
 }
+#elif XE_ARCH_ARM64
+inline void sequential_6_BE_to_interleaved_6_LE(float* output,
+                                                const float* input,
+                                                size_t ch_sample_count) {
+  assert_true(ch_sample_count % 4 == 0);
+  for (size_t sample = 0; sample < ch_sample_count; sample += 4) {
+    // Load 4 samples from 6 channels each, byte swap them, and interleave
+    // pairs of channels.
+    float32x4x2_t channel_pairs[3];
+    for (size_t pair = 0; pair < 3; ++pair) {
+      float32x4_t channel_0 = vreinterpretq_f32_u8(vrev32q_u8(vld1q_u8(
+          reinterpret_cast<const uint8_t*>(
+              &input[(pair * 2) * ch_sample_count + sample]))));
+      float32x4_t channel_1 = vreinterpretq_f32_u8(vrev32q_u8(vld1q_u8(
+          reinterpret_cast<const uint8_t*>(
+              &input[(pair * 2 + 1) * ch_sample_count + sample]))));
+      channel_pairs[pair] = vzipq_f32(channel_0, channel_1);
+    }
+    float* out = &output[sample * 6];
+    for (size_t pair = 0; pair < 3; ++pair) {
+      vst1_f32(out + pair * 2, vget_low_f32(channel_pairs[pair].val[0]));
+      vst1_f32(out + 6 + pair * 2, vget_high_f32(channel_pairs[pair].val[0]));
+      vst1_f32(out + 12 + pair * 2, vget_low_f32(channel_pairs[pair].val[1]));
+      vst1_f32(out + 18 + pair * 2,
+               vget_high_f32(channel_pairs[pair].val[1]));
+    }
+  }
+}
+
+inline void sequential_6_BE_to_interleaved_2_LE(float* output,
+                                                const float* input,
+                                                size_t ch_sample_count) {
+  assert_true(ch_sample_count % 4 == 0);
+  auto load_channel = [input, ch_sample_count](size_t channel,
+                                               size_t sample) {
+    return vreinterpretq_f32_u8(
+        vrev32q_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(
+            &input[channel * ch_sample_count + sample]))));
+  };
+  // put center on left and right, discard low frequency
+  for (size_t sample = 0; sample < ch_sample_count; sample += 4) {
+    float32x4_t fl = load_channel(0, sample);
+    float32x4_t fr = load_channel(1, sample);
+    float32x4_t fc = load_channel(2, sample);
+    float32x4_t bl = load_channel(4, sample);
+    float32x4_t br = load_channel(5, sample);
+    float32x4_t center_halved = vmulq_n_f32(fc, 0.5f);
+    float32x4x2_t left_right;
+    left_right.val[0] =
+        vmulq_n_f32(vaddq_f32(vaddq_f32(fl, bl), center_halved), 1.0f / 2.5f);
+    left_right.val[1] =
+        vmulq_n_f32(vaddq_f32(vaddq_f32(fr, br), center_halved), 1.0f / 2.5f);
+    vst2q_f32(&output[sample * 2], left_right);
+  }
+}
 #else
 inline void sequential_6_BE_to_interleaved_6_LE(float* output,
                                                 const float* input,
@@ -96,15 +173,13 @@ inline void sequential_6_BE_to_interleaved_6_LE(float* output,
 inline void sequential_6_BE_to_interleaved_2_LE(float* output,
                                                 const float* input,
                                                 size_t ch_sample_count) {
-  // Default 5.1 channel mapping is fl, fr, fc, lf, bl, br
-  // https://docs.microsoft.com/en-us/windows/win32/xaudio2/xaudio2-default-channel-mapping
   for (size_t sample = 0; sample < ch_sample_count; sample++) {
     // put center on left and right, discard low frequency
     float fl = xe::byte_swap(input[0 * ch_sample_count + sample]);
     float fr = xe::byte_swap(input[1 * ch_sample_count + sample]);
     float fc = xe::byte_swap(input[2 * ch_sample_count + sample]);
-    float br = xe::byte_swap(input[4 * ch_sample_count + sample]);
-    float bl = xe::byte_swap(input[5 * ch_sample_count + sample]);
+    float bl = xe::byte_swap(input[4 * ch_sample_count + sample]);
+    float br = xe::byte_swap(input[5 * ch_sample_count + sample]);
     float center_halved = fc * 0.5f;
     output[sample * 2] = (fl + bl + center_halved) * (1.0f / 2.5f);
     output[sample * 2 + 1] = (fr + br + center_halved) * (1.0f / 2.5f);
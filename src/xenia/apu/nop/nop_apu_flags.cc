@@ -8,3 +8,12 @@
  */
 
 #include "xenia/apu/nop/nop_apu_flags.h"
+
+DEFINE_path(
+    apu_nop_capture_path, "",
+    "For the nop audio system, path to a WAV file to write the audio output "
+    "of the first client to (with the client index appended to the name for "
+    "other clients). The frames are consumed at the real-time rate, with "
+    "underruns reported when the emulator is shut down. If empty, audio "
+    "clients can't be created.",
+    "APU");
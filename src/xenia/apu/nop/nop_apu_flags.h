@@ -10,4 +10,8 @@
 #ifndef XENIA_APU_NOP_NOP_APU_FLAGS_H_
 #define XENIA_APU_NOP_NOP_APU_FLAGS_H_
 
+#include "xenia/base/cvar.h"
+
+DECLARE_path(apu_nop_capture_path);
+
 #endif  // XENIA_APU_NOP_NOP_APU_FLAGS_H_
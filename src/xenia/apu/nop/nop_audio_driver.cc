@@ -0,0 +1,164 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/apu/nop/nop_audio_driver.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "xenia/apu/conversion.h"
+#include "xenia/base/assert.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+
+namespace xe {
+namespace apu {
+namespace nop {
+
+NopAudioDriver::NopAudioDriver(Memory* memory,
+                               xe::threading::Semaphore* semaphore)
+    : AudioDriver(memory), semaphore_(semaphore) {}
+
+NopAudioDriver::~NopAudioDriver() { assert_null(capture_thread_); }
+
+bool NopAudioDriver::Initialize(const std::filesystem::path& path) {
+  file_ = xe::filesystem::OpenFile(path, "wb");
+  if (!file_) {
+    XELOGE("Failed to open the audio capture file {}", xe::path_to_utf8(path));
+    return false;
+  }
+  // Written again with the final sizes on shutdown.
+  WriteWavHeader();
+
+  capture_running_ = true;
+  capture_thread_ = xe::threading::Thread::Create({}, [this]() {
+    CaptureThread();
+  });
+  if (!capture_thread_) {
+    capture_running_ = false;
+    return false;
+  }
+  capture_thread_->set_name("Audio Capture");
+  return true;
+}
+
+void NopAudioDriver::SubmitFrame(uint32_t frame_ptr) {
+  std::vector<float> frame;
+  {
+    std::lock_guard<std::mutex> lock(frames_mutex_);
+    if (!frames_unused_.empty()) {
+      frame = std::move(frames_unused_.back());
+      frames_unused_.pop_back();
+    }
+  }
+  frame.resize(kFrameSamples);
+  conversion::sequential_6_BE_to_interleaved_6_LE(
+      frame.data(), memory_->TranslateVirtual<float*>(frame_ptr),
+      kChannelSamples);
+  {
+    std::lock_guard<std::mutex> lock(frames_mutex_);
+    frames_queued_.push_back(std::move(frame));
+  }
+}
+
+void NopAudioDriver::Shutdown() {
+  if (capture_thread_) {
+    {
+      std::lock_guard<std::mutex> lock(frames_mutex_);
+      capture_running_ = false;
+    }
+    frames_cond_.notify_all();
+    xe::threading::Wait(capture_thread_.get(), false);
+    capture_thread_.reset();
+    XELOGI("Audio capture: {} frames played, {} underruns", frames_played_,
+           underrun_count_);
+  }
+  if (file_) {
+    WriteWavHeader();
+    fclose(file_);
+    file_ = nullptr;
+  }
+  frames_queued_.clear();
+  frames_unused_.clear();
+}
+
+void NopAudioDriver::CaptureThread() {
+  using Clock = std::chrono::steady_clock;
+  const Clock::duration frame_duration =
+      std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(
+          double(kChannelSamples) / double(kFrameFrequency)));
+  // Don't try to catch up for more than a few frames if the thread has been
+  // suspended, for instance, by the debugger.
+  const Clock::duration max_lag = frame_duration * 8;
+  static const float silence[kFrameSamples] = {};
+  bool frame_received = false;
+  Clock::time_point next_frame_time = Clock::now();
+  std::unique_lock<std::mutex> lock(frames_mutex_);
+  while (true) {
+    if (frames_cond_.wait_until(lock, next_frame_time,
+                                [this]() { return !capture_running_; })) {
+      break;
+    }
+    Clock::time_point now = Clock::now();
+    next_frame_time =
+        now - next_frame_time > max_lag ? now : next_frame_time;
+    next_frame_time += frame_duration;
+    if (frames_queued_.empty()) {
+      // Keep the timeline of the capture by writing silence after the first
+      // frame.
+      if (frame_received) {
+        ++underrun_count_;
+        lock.unlock();
+        data_size_ += fwrite(silence, 1, sizeof(silence), file_);
+        lock.lock();
+      }
+      continue;
+    }
+    frame_received = true;
+    std::vector<float> frame = std::move(frames_queued_.front());
+    frames_queued_.pop_front();
+    lock.unlock();
+    data_size_ +=
+        fwrite(frame.data(), 1, sizeof(float) * frame.size(), file_);
+    ++frames_played_;
+    auto ret = semaphore_->Release(1, nullptr);
+    assert_true(ret);
+    lock.lock();
+    frames_unused_.push_back(std::move(frame));
+  }
+}
+
+void NopAudioDriver::WriteWavHeader() {
+  static_assert(sizeof(WavHeader) == 44);
+  WavHeader header;
+  std::memcpy(header.riff_id, "RIFF", 4);
+  uint32_t data_size = uint32_t(
+      std::min(data_size_, uint64_t(UINT32_MAX - (sizeof(header) - 8))));
+  header.riff_size = uint32_t(sizeof(header) - 8) + data_size;
+  std::memcpy(header.wave_id, "WAVE", 4);
+  std::memcpy(header.fmt_id, "fmt ", 4);
+  header.fmt_size = 16;
+  // WAVE_FORMAT_IEEE_FLOAT.
+  header.format_tag = 3;
+  header.channels = kFrameChannels;
+  header.samples_per_second = kFrameFrequency;
+  header.bytes_per_second = kFrameFrequency * kFrameChannels * sizeof(float);
+  header.block_align = kFrameChannels * sizeof(float);
+  header.bits_per_sample = 32;
+  std::memcpy(header.data_id, "data", 4);
+  header.data_size = data_size;
+  xe::filesystem::Seek(file_, 0, SEEK_SET);
+  fwrite(&header, sizeof(header), 1, file_);
+  xe::filesystem::Seek(file_, 0, SEEK_END);
+}
+
+}  // namespace nop
+}  // namespace apu
+}  // namespace xe
@@ -0,0 +1,90 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_APU_NOP_NOP_AUDIO_DRIVER_H_
+#define XENIA_APU_NOP_NOP_AUDIO_DRIVER_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "xenia/apu/audio_driver.h"
+#include "xenia/base/threading.h"
+
+namespace xe {
+namespace apu {
+namespace nop {
+
+// Driver without an audio device that consumes the frames at the real-time
+// rate on its own thread and writes them to a WAV file, for measuring the
+// audio performance on machines without audio output.
+class NopAudioDriver : public AudioDriver {
+ public:
+  NopAudioDriver(Memory* memory, xe::threading::Semaphore* semaphore);
+  ~NopAudioDriver() override;
+
+  bool Initialize(const std::filesystem::path& path);
+  void SubmitFrame(uint32_t frame_ptr) override;
+  void Shutdown();
+
+ private:
+  struct WavHeader {
+    char riff_id[4];
+    uint32_t riff_size;
+    char wave_id[4];
+    char fmt_id[4];
+    uint32_t fmt_size;
+    uint16_t format_tag;
+    uint16_t channels;
+    uint32_t samples_per_second;
+    uint32_t bytes_per_second;
+    uint16_t block_align;
+    uint16_t bits_per_sample;
+    char data_id[4];
+    uint32_t data_size;
+  };
+
+  static constexpr uint32_t kFrameFrequency = 48000;
+  static constexpr uint32_t kFrameChannels = 6;
+  static constexpr uint32_t kChannelSamples = 256;
+  static constexpr uint32_t kFrameSamples = kFrameChannels * kChannelSamples;
+
+  void CaptureThread();
+  void WriteWavHeader();
+
+  xe::threading::Semaphore* semaphore_ = nullptr;
+
+  FILE* file_ = nullptr;
+  uint64_t data_size_ = 0;
+
+  // Interleaved little-endian frames waiting to be played and written, and
+  // the buffers to reuse for the new frames.
+  std::mutex frames_mutex_;
+  std::condition_variable frames_cond_;
+  std::deque<std::vector<float>> frames_queued_;
+  std::vector<std::vector<float>> frames_unused_;
+  bool capture_running_ = false;
+
+  std::unique_ptr<xe::threading::Thread> capture_thread_;
+
+  // Accessed only by the capture thread while it's running.
+  uint64_t frames_played_ = 0;
+  uint64_t underrun_count_ = 0;
+};
+
+}  // namespace nop
+}  // namespace apu
+}  // namespace xe
+
+#endif  // XENIA_APU_NOP_NOP_AUDIO_DRIVER_H_
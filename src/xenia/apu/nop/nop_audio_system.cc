@@ -9,7 +9,11 @@
 
 #include "xenia/apu/nop/nop_audio_system.h"
 
+#include <string>
+
 #include "xenia/apu/apu_flags.h"
+#include "xenia/apu/nop/nop_apu_flags.h"
+#include "xenia/apu/nop/nop_audio_driver.h"
 
 namespace xe {
 namespace apu {
@@ -27,10 +31,34 @@ NopAudioSystem::~NopAudioSystem() = default;
 X_STATUS NopAudioSystem::CreateDriver(size_t index,
                                       xe::threading::Semaphore* semaphore,
                                       AudioDriver** out_driver) {
-  return X_STATUS_NOT_IMPLEMENTED;
+  if (cvars::apu_nop_capture_path.empty()) {
+    return X_STATUS_NOT_IMPLEMENTED;
+  }
+  assert_not_null(out_driver);
+  std::filesystem::path path = cvars::apu_nop_capture_path;
+  if (index) {
+    path.replace_filename(path.stem());
+    path += "." + std::to_string(index);
+    path += cvars::apu_nop_capture_path.extension();
+  }
+  auto driver = new NopAudioDriver(memory_, semaphore);
+  if (!driver->Initialize(path)) {
+    driver->Shutdown();
+    delete driver;
+    return X_STATUS_UNSUCCESSFUL;
+  }
+
+  *out_driver = driver;
+  return X_STATUS_SUCCESS;
 }
 
-void NopAudioSystem::DestroyDriver(AudioDriver* driver) { assert_always(); }
+void NopAudioSystem::DestroyDriver(AudioDriver* driver) {
+  assert_not_null(driver);
+  auto nop_driver = dynamic_cast<NopAudioDriver*>(driver);
+  assert_not_null(nop_driver);
+  nop_driver->Shutdown();
+  delete nop_driver;
+}
 
 }  // namespace nop
 }  // namespace apu
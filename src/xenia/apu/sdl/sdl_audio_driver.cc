@@ -25,12 +25,11 @@ namespace sdl {
 
 SDLAudioDriver::SDLAudioDriver(Memory* memory,
                                xe::threading::Semaphore* semaphore)
-    : AudioDriver(memory), semaphore_(semaphore) {}
+    : AudioDriver(memory),
+      semaphore_(semaphore),
+      frame_ring_(new float[frame_samples_ * frame_ring_size_]) {}
 
-SDLAudioDriver::~SDLAudioDriver() {
-  assert_true(frames_queued_.empty());
-  assert_true(frames_unused_.empty());
-};
+SDLAudioDriver::~SDLAudioDriver() = default;
 
 bool SDLAudioDriver::Initialize() {
   SDL_version ver = {};
@@ -87,24 +86,22 @@ bool SDLAudioDriver::Initialize() {
 }
 
 void SDLAudioDriver::SubmitFrame(uint32_t frame_ptr) {
-  const auto input_frame = memory_->TranslateVirtual<float*>(frame_ptr);
-  float* output_frame;
-  {
-    std::unique_lock<std::mutex> guard(frames_mutex_);
-    if (frames_unused_.empty()) {
-      output_frame = new float[frame_samples_];
-    } else {
-      output_frame = frames_unused_.top();
-      frames_unused_.pop();
-    }
-  }
-
-  std::memcpy(output_frame, input_frame, frame_samples_ * sizeof(float));
-
-  {
-    std::unique_lock<std::mutex> guard(frames_mutex_);
-    frames_queued_.push(output_frame);
+  size_t write_index =
+      frame_ring_write_index_.load(std::memory_order_relaxed);
+  assert_true(write_index -
+                  frame_ring_read_index_.load(std::memory_order_acquire) <
+              frame_ring_size_);
+  size_t slot = write_index % frame_ring_size_;
+  // Don't copy the samples if they won't be played, but still queue the frame
+  // for the pacing of the client.
+  bool muted = cvars::mute;
+  frame_ring_muted_[slot] = muted;
+  if (!muted) {
+    std::memcpy(&frame_ring_[frame_samples_ * slot],
+                memory_->TranslateVirtual<float*>(frame_ptr),
+                frame_samples_ * sizeof(float));
   }
+  frame_ring_write_index_.store(write_index + 1, std::memory_order_release);
 }
 
 void SDLAudioDriver::Shutdown() {
@@ -116,15 +113,6 @@ void SDLAudioDriver::Shutdown() {
     SDL_QuitSubSystem(SDL_INIT_AUDIO);
     sdl_initialized_ = false;
   }
-  std::unique_lock<std::mutex> guard(frames_mutex_);
-  while (!frames_unused_.empty()) {
-    delete[] frames_unused_.top();
-    frames_unused_.pop();
-  };
-  while (!frames_queued_.empty()) {
-    delete[] frames_queued_.front();
-    frames_queued_.pop();
-  };
 }
 
 void SDLAudioDriver::SDLCallback(void* userdata, Uint8* stream, int len) {
@@ -137,15 +125,17 @@ void SDLAudioDriver::SDLCallback(void* userdata, Uint8* stream, int len) {
   assert_true(len ==
               sizeof(float) * channel_samples_ * driver->sdl_device_channels_);
 
-  std::unique_lock<std::mutex> guard(driver->frames_mutex_);
-  if (driver->frames_queued_.empty()) {
+  size_t read_index =
+      driver->frame_ring_read_index_.load(std::memory_order_relaxed);
+  if (read_index ==
+      driver->frame_ring_write_index_.load(std::memory_order_acquire)) {
     std::memset(stream, 0, len);
   } else {
-    auto buffer = driver->frames_queued_.front();
-    driver->frames_queued_.pop();
-    if (cvars::mute) {
+    size_t slot = read_index % frame_ring_size_;
+    if (driver->frame_ring_muted_[slot] || cvars::mute) {
       std::memset(stream, 0, len);
     } else {
+      const float* buffer = &driver->frame_ring_[frame_samples_ * slot];
       switch (driver->sdl_device_channels_) {
         case 2:
           conversion::sequential_6_BE_to_interleaved_2_LE(
@@ -160,7 +150,8 @@ void SDLAudioDriver::SDLCallback(void* userdata, Uint8* stream, int len) {
           break;
       }
     }
-    driver->frames_unused_.push(buffer);
+    driver->frame_ring_read_index_.store(read_index + 1,
+                                         std::memory_order_release);
 
     auto ret = driver->semaphore_->Release(1, nullptr);
     assert_true(ret);
@@ -10,12 +10,12 @@
 #ifndef XENIA_APU_SDL_SDL_AUDIO_DRIVER_H_
 #define XENIA_APU_SDL_SDL_AUDIO_DRIVER_H_
 
-#include <mutex>
-#include <queue>
-#include <stack>
+#include <atomic>
+#include <memory>
 
 #include "SDL.h"
 #include "xenia/apu/audio_driver.h"
+#include "xenia/apu/audio_system.h"
 #include "xenia/base/threading.h"
 
 namespace xe {
@@ -45,9 +45,17 @@ class SDLAudioDriver : public AudioDriver {
   static const uint32_t channel_samples_ = 256;
   static const uint32_t frame_samples_ = frame_channels_ * channel_samples_;
   static const uint32_t frame_size_ = sizeof(float) * frame_samples_;
-  std::queue<float*> frames_queued_ = {};
-  std::stack<float*> frames_unused_ = {};
-  std::mutex frames_mutex_ = {};
+
+  // Single-producer (SubmitFrame, serialized by the audio system),
+  // single-consumer (the SDL callback) ring of frames. The client's semaphore
+  // limits the number of queued frames, so the ring never overflows.
+  static const size_t frame_ring_size_ = AudioSystem::kMaximumQueuedFrames;
+  std::unique_ptr<float[]> frame_ring_;
+  // Whether the frame has been submitted while muted and contains no data.
+  bool frame_ring_muted_[frame_ring_size_] = {};
+  // Indices of the next frame to write and to read, not wrapped.
+  std::atomic<size_t> frame_ring_write_index_ = {0};
+  std::atomic<size_t> frame_ring_read_index_ = {0};
 };
 
 }  // namespace sdl
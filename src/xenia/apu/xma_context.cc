@@ -15,11 +15,16 @@
 #include "xenia/apu/xma_decoder.h"
 #include "xenia/apu/xma_helpers.h"
 #include "xenia/base/bit_stream.h"
+#include "xenia/base/clock.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/platform.h"
 #include "xenia/base/profiling.h"
 #include "xenia/base/ring_buffer.h"
 
+#if XE_ARCH_ARM64
+#include <arm_neon.h>
+#endif  // XE_ARCH_ARM64
+
 extern "C" {
 #if XE_COMPILER_MSVC
 #pragma warning(push)
@@ -98,10 +103,13 @@ bool XmaContext::Work() {
 
   set_is_enabled(false);
 
+  uint64_t work_start_ticks = Clock::QueryHostTickCount();
   auto context_ptr = memory()->TranslateVirtual(guest_ptr());
   XMA_CONTEXT_DATA data(context_ptr);
   Decode(&data);
   data.Store(context_ptr);
+  ++work_count_;
+  work_host_ticks_ += Clock::QueryHostTickCount() - work_start_ticks;
   return true;
 }
 
@@ -166,6 +174,38 @@ void XmaContext::Release() {
   std::memset(context_ptr, 0, sizeof(XMA_CONTEXT_DATA));  // Zero it.
 }
 
+void XmaContext::Save(ByteStream* stream) {
+  std::lock_guard<std::mutex> lock(lock_);
+  stream->Write(uint8_t(is_allocated_));
+  stream->Write(uint8_t(is_enabled_));
+  stream->Write(packets_skip_);
+  stream->Write(split_frame_len_);
+  stream->Write(split_frame_len_partial_);
+  stream->Write(split_frame_padding_start_);
+  // Only a part of a split frame needs to be kept between decoding calls.
+  if (split_frame_len_) {
+    stream->Write(xma_frame_.data(), xma_frame_.size());
+  }
+}
+
+void XmaContext::Restore(ByteStream* stream) {
+  std::lock_guard<std::mutex> lock(lock_);
+  is_allocated_ = stream->Read<uint8_t>() != 0;
+  is_enabled_ = stream->Read<uint8_t>() != 0;
+  packets_skip_ = stream->Read<uint32_t>();
+  split_frame_len_ = stream->Read<uint32_t>();
+  split_frame_len_partial_ = stream->Read<uint32_t>();
+  split_frame_padding_start_ = stream->Read<uint8_t>();
+  if (split_frame_len_) {
+    stream->Read(xma_frame_.data(), xma_frame_.size());
+  }
+  // The overlap of the previous frame kept internally by FFmpeg is not
+  // restored, so the first frame decoded after restoring may be slightly
+  // different - flush it not to mix it with the frames decoded before
+  // restoring.
+  avcodec_flush_buffers(av_context_);
+}
+
 void XmaContext::SwapInputBuffer(XMA_CONTEXT_DATA* data) {
   // No more frames.
   if (data->current_buffer == 0) {
@@ -615,13 +655,21 @@ void XmaContext::Decode(XMA_CONTEXT_DATA* data) {
       // assert_true(frame_is_split == (frame_idx == -1));
 
       //			dump_raw(av_frame_, id());
-      ConvertFrame((const uint8_t**)av_frame_->data, bool(data->is_stereo),
-                   raw_frame_.data());
       // decoded_consumed_samples_ += kSamplesPerFrame;
 
       auto byte_count = kBytesPerFrameChannel << data->is_stereo;
       assert_true(output_remaining_bytes >= byte_count);
-      output_rb.Write(raw_frame_.data(), byte_count);
+      if (output_rb.write_offset() + byte_count <= output_rb.capacity()) {
+        // Convert directly into the guest output buffer if the frame doesn't
+        // wrap around its end, which is the case for most frames.
+        ConvertFrame((const uint8_t**)av_frame_->data, bool(data->is_stereo),
+                     reinterpret_cast<uint8_t*>(output_rb.write_ptr()));
+        output_rb.set_write_offset(output_rb.write_offset() + byte_count);
+      } else {
+        ConvertFrame((const uint8_t**)av_frame_->data, bool(data->is_stereo),
+                     raw_frame_.data());
+        output_rb.Write(raw_frame_.data(), byte_count);
+      }
       output_remaining_bytes -= byte_count;
       data->output_buffer_write_offset = output_rb.write_offset() / 256;
 
@@ -913,6 +961,32 @@ void XmaContext::ConvertFrame(const uint8_t** samples, bool is_two_channel,
       _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i]), out_mm);
     }
   }
+#elif XE_ARCH_ARM64
+  static_assert(kSamplesPerFrame % 8 == 0);
+  const auto in_channel_0 = reinterpret_cast<const float*>(samples[0]);
+  const float32x4_t scale_v = vdupq_n_f32(scale);
+  // Rescales 8 samples, rounds them to the nearest like cvtps2dq, and packs
+  // them to big-endian int16 with saturation.
+  auto convert_8 = [scale_v](const float* in) {
+    int32x4_t in_low = vcvtnq_s32_f32(vmulq_f32(vld1q_f32(in), scale_v));
+    int32x4_t in_high = vcvtnq_s32_f32(vmulq_f32(vld1q_f32(in + 4), scale_v));
+    int16x8_t out_v = vcombine_s16(vqmovn_s32(in_low), vqmovn_s32(in_high));
+    return vreinterpretq_s16_u8(vrev16q_u8(vreinterpretq_u8_s16(out_v)));
+  };
+  if (is_two_channel) {
+    const auto in_channel_1 = reinterpret_cast<const float*>(samples[1]);
+    for (uint32_t i = 0; i < kSamplesPerFrame; i += 8) {
+      int16x8x2_t out_v;
+      out_v.val[0] = convert_8(&in_channel_0[i]);
+      out_v.val[1] = convert_8(&in_channel_1[i]);
+      // Interleave the channels.
+      vst2q_s16(&out[i * 2], out_v);
+    }
+  } else {
+    for (uint32_t i = 0; i < kSamplesPerFrame; i += 8) {
+      vst1q_s16(&out[i], convert_8(&in_channel_0[i]));
+    }
+  }
 #else
   uint32_t o = 0;
   for (uint32_t i = 0; i < kSamplesPerFrame; i++) {
@@ -16,6 +16,7 @@
 #include <queue>
 //#include <vector>
 
+#include "xenia/base/byte_stream.h"
 #include "xenia/memory.h"
 #include "xenia/xbox.h"
 
@@ -159,6 +160,13 @@ class XmaContext {
   void Disable();
   void Release();
 
+  // Host-side state of the context not stored in the guest context data, such
+  // as the position within the packets being skipped and the part of a frame
+  // split between packets that has already been read. If the context was
+  // enabled when saved, it will need to be kicked again after restoring.
+  void Save(ByteStream* stream);
+  void Restore(ByteStream* stream);
+
   Memory* memory() const { return memory_; }
 
   uint32_t id() { return id_; }
@@ -169,6 +177,12 @@ class XmaContext {
   void set_is_allocated(bool is_allocated) { is_allocated_ = is_allocated; }
   void set_is_enabled(bool is_enabled) { is_enabled_ = is_enabled; }
 
+  // Statistics of the decoding done by Work, in host ticks (see
+  // Clock::QueryHostTickFrequency), to be read when the decoder is not
+  // running.
+  uint64_t work_count() const { return work_count_; }
+  uint64_t work_host_ticks() const { return work_host_ticks_; }
+
  private:
   static void SwapInputBuffer(XMA_CONTEXT_DATA* data);
   static bool TrySetupNextLoop(XMA_CONTEXT_DATA* data,
@@ -203,6 +217,8 @@ class XmaContext {
   std::mutex lock_;
   bool is_allocated_ = false;
   bool is_enabled_ = false;
+  uint64_t work_count_ = 0;
+  uint64_t work_host_ticks_ = 0;
   // bool is_dirty_ = true;
 
   // ffmpeg structures
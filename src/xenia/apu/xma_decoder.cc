@@ -9,7 +9,11 @@
 
 #include "xenia/apu/xma_decoder.h"
 
+#include <algorithm>
+
+#include "third_party/fmt/include/fmt/format.h"
 #include "xenia/apu/xma_context.h"
+#include "xenia/base/clock.h"
 #include "xenia/base/cvar.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
@@ -18,6 +22,7 @@
 #include "xenia/base/string_buffer.h"
 #include "xenia/cpu/processor.h"
 #include "xenia/cpu/thread_state.h"
+#include "xenia/kernel/kernel_state.h"
 #include "xenia/kernel/xthread.h"
 
 extern "C" {
@@ -50,6 +55,10 @@ extern "C" {
 
 DEFINE_bool(ffmpeg_verbose, false, "Verbose FFmpeg output (debug and above)",
             "APU");
+DEFINE_int32(xma_decoder_threads, 0,
+             "Number of threads decoding XMA contexts in parallel (up to 16). "
+             "0 to choose based on the number of logical processors.",
+             "APU");
 
 namespace xe {
 namespace apu {
@@ -137,72 +146,184 @@ X_STATUS XmaDecoder::Setup(kernel::KernelState* kernel_state) {
   register_file_[XmaRegister::NextContextIndex] = 1;
   context_bitmap_.Resize(kContextCount);
 
+  uint32_t worker_count;
+  if (cvars::xma_decoder_threads > 0) {
+    worker_count = std::min(uint32_t(cvars::xma_decoder_threads),
+                            kMaxWorkerCount);
+  } else {
+    worker_count =
+        std::min(std::max(xe::threading::logical_processor_count() / 4,
+                          uint32_t(1)),
+                 uint32_t(4));
+  }
   worker_running_ = true;
-  work_event_ = xe::threading::Event::CreateAutoResetEvent(false);
-  assert_not_null(work_event_);
-  worker_thread_ = kernel::object_ref<kernel::XHostThread>(
-      new kernel::XHostThread(kernel_state, 128 * 1024, 0, [this]() {
-        WorkerThreadMain();
-        return 0;
-      }));
-  worker_thread_->set_name("XMA Decoder");
-  worker_thread_->set_can_debugger_suspend(true);
-  worker_thread_->Create();
+  workers_.reserve(worker_count);
+  for (uint32_t i = 0; i < worker_count; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  for (uint32_t i = 0; i < worker_count; ++i) {
+    Worker& worker = *workers_[i];
+    worker.thread = kernel::object_ref<kernel::XHostThread>(
+        new kernel::XHostThread(kernel_state, 128 * 1024, 0, [this, i]() {
+          WorkerThreadMain(i);
+          return 0;
+        }));
+    worker.thread->set_name(
+        worker_count > 1 ? fmt::format("XMA Decoder {}", i) : "XMA Decoder");
+    worker.thread->set_can_debugger_suspend(true);
+    worker.thread->Create();
+    kernel_state->host_processor_map().ApplyHostThreadAffinity(
+        worker.thread->thread(),
+        kernel::util::HostProcessorMap::HostThread::kAudio);
+  }
 
   return X_STATUS_SUCCESS;
 }
 
-void XmaDecoder::WorkerThreadMain() {
-  uint32_t idle_loop_count = 0;
+void XmaDecoder::WorkerThreadMain(uint32_t worker_index) {
+  Worker& worker = *workers_[worker_index];
   while (worker_running_) {
-    // Okay, let's loop through XMA contexts to find ones we need to decode!
+    // Work is only done for contexts enabled by a kick, and every kick queues
+    // the context after enabling it, so only the queued contexts need to be
+    // checked.
     bool did_work = false;
-    for (uint32_t n = 0; n < kContextCount; n++) {
-      XmaContext& context = contexts_[n];
-      did_work = context.Work() || did_work;
-
-      // TODO: Need thread safety to do this.
-      // Probably not too important though.
-      // registers_.current_context = n;
-      // registers_.next_context = (n + 1) % kContextCount;
+    uint32_t context_id;
+    uint64_t work_start_time = 0;
+    while (PopQueuedContext(context_id)) {
+      if (!did_work) {
+        did_work = true;
+        work_start_time = Clock::QueryHostTickCount();
+      }
+      contexts_[context_id].Work();
+      if (paused_ || !worker_running_) {
+        break;
+      }
     }
+    if (did_work) {
+      decode_time_total_.fetch_add(
+          Clock::QueryHostTickCount() - work_start_time,
+          std::memory_order_relaxed);
+    }
+
+    // TODO: Need thread safety to do this.
+    // Probably not too important though.
+    // registers_.current_context = context_id;
+    // registers_.next_context = (context_id + 1) % kContextCount;
 
     if (paused_) {
-      pause_fence_.Signal();
-      resume_fence_.Wait();
+      std::unique_lock<std::mutex> pause_lock(pause_mutex_);
+      ++paused_worker_count_;
+      pause_cond_.notify_all();
+      pause_cond_.wait(pause_lock,
+                       [this]() { return !paused_ || !worker_running_; });
+      --paused_worker_count_;
     }
 
     if (!did_work) {
-      idle_loop_count++;
-    } else {
-      idle_loop_count = 0;
+      worker.waiter.Wait(
+          [this]() {
+            return !worker_running_ || paused_ ||
+                   queued_context_count_.load() != 0;
+          },
+          false, std::chrono::milliseconds::max());
     }
+  }
+}
 
-    if (idle_loop_count > 500) {
-      // Idle for an extended period. Introduce a 20ms wait.
-      xe::threading::Wait(work_event_.get(), false,
-                          std::chrono::milliseconds(20));
+uint64_t XmaDecoder::QueryDecodeTimeMicros() const {
+  uint64_t ticks = decode_time_total_.load(std::memory_order_relaxed);
+  uint64_t frequency = Clock::QueryHostTickFrequency();
+  return ticks / frequency * 1000000 + ticks % frequency * 1000000 / frequency;
+}
+
+void XmaDecoder::QueueContext(uint32_t context_id) {
+  {
+    std::lock_guard<std::mutex> lock(queued_contexts_mutex_);
+    uint64_t& queued_bits = queued_context_bits_[context_id >> 6];
+    uint64_t context_bit = uint64_t(1) << (context_id & 63);
+    if (queued_bits & context_bit) {
+      return;
     }
+    queued_bits |= context_bit;
+    queued_contexts_.push_back(context_id);
+    queued_context_count_.fetch_add(1);
+  }
+  for (const std::unique_ptr<Worker>& worker : workers_) {
+    worker->waiter.Wake();
+  }
+}
 
-    xe::threading::MaybeYield();
+bool XmaDecoder::PopQueuedContext(uint32_t& context_id_out) {
+  if (!queued_context_count_.load(std::memory_order_relaxed)) {
+    return false;
   }
+  std::lock_guard<std::mutex> lock(queued_contexts_mutex_);
+  if (queued_contexts_.empty()) {
+    return false;
+  }
+  uint32_t context_id = queued_contexts_.front();
+  queued_contexts_.pop_front();
+  queued_context_count_.fetch_sub(1);
+  // Allow the context to be queued again while it's being decoded, so a kick
+  // during the decoding is not lost.
+  queued_context_bits_[context_id >> 6] &= ~(uint64_t(1) << (context_id & 63));
+  context_id_out = context_id;
+  return true;
 }
 
 void XmaDecoder::Shutdown() {
   worker_running_ = false;
-
-  if (work_event_) {
-    work_event_->Set();
+  {
+    // Wake the paused workers.
+    std::lock_guard<std::mutex> pause_lock(pause_mutex_);
+    paused_ = false;
   }
-
-  if (paused_) {
-    Resume();
+  pause_cond_.notify_all();
+  for (const std::unique_ptr<Worker>& worker : workers_) {
+    worker->waiter.Wake();
   }
 
-  if (worker_thread_) {
+  for (uint32_t i = 0; i < uint32_t(workers_.size()); ++i) {
+    Worker& worker = *workers_[i];
+    if (!worker.thread) {
+      continue;
+    }
     // Wait for work thread.
-    xe::threading::Wait(worker_thread_->thread(), false);
-    worker_thread_.reset();
+    xe::threading::Wait(worker.thread->thread(), false);
+    worker.thread.reset();
+
+    xe::threading::AdaptiveWaiter::Stats worker_stats = worker.waiter.stats();
+    uint64_t worker_total_ticks =
+        std::max(worker_stats.total_ticks(), uint64_t(1));
+    XELOGI(
+        "XMA decoder thread {}: {:.1f}% busy, {:.1f}% spinning, {:.1f}% "
+        "blocked",
+        i, 100.0 * worker_stats.busy_ticks / worker_total_ticks,
+        100.0 * worker_stats.spin_ticks / worker_total_ticks,
+        100.0 * worker_stats.block_ticks / worker_total_ticks);
+  }
+  workers_.clear();
+
+  // Decoding time statistics of the contexts that have been used.
+  double ms_per_tick = 1000.0 / double(Clock::QueryHostTickFrequency());
+  uint64_t total_work_count = 0;
+  uint64_t total_work_ticks = 0;
+  for (uint32_t i = 0; i < kContextCount; ++i) {
+    const XmaContext& context = contexts_[i];
+    uint64_t work_count = context.work_count();
+    if (!work_count) {
+      continue;
+    }
+    uint64_t work_ticks = context.work_host_ticks();
+    XELOGD("XMA context {}: decoded {} times, {:.3f} ms in total", i,
+           work_count, work_ticks * ms_per_tick);
+    total_work_count += work_count;
+    total_work_ticks += work_ticks;
+  }
+  if (total_work_count) {
+    XELOGI("XMA decoding: {} times, {:.3f} ms in total, {:.3f} ms on average",
+           total_work_count, total_work_ticks * ms_per_tick,
+           total_work_ticks * ms_per_tick / total_work_count);
   }
 
   if (context_data_first_ptr_) {
@@ -313,10 +434,10 @@ void XmaDecoder::WriteRegister(uint32_t addr, uint32_t value) {
         uint32_t context_id = base_context_id + i;
         auto& context = contexts_[context_id];
         context.Enable();
+        // Signal a decoder thread to start processing.
+        QueueContext(context_id);
       }
     }
-    // Signal the decoder thread to start processing.
-    work_event_->Set();
   } else if (r >= XmaRegister::Context0Lock && r <= XmaRegister::Context9Lock) {
     // Context lock command.
     // This requests a lock by flagging the context.
@@ -329,8 +450,6 @@ void XmaDecoder::WriteRegister(uint32_t addr, uint32_t value) {
         context.Disable();
       }
     }
-    // Signal the decoder thread to start processing.
-    // work_event_->Set();
   } else if (r >= XmaRegister::Context0Clear &&
              r <= XmaRegister::Context9Clear) {
     // Context clear command.
@@ -362,22 +481,66 @@ void XmaDecoder::WriteRegister(uint32_t addr, uint32_t value) {
   }
 }
 
+bool XmaDecoder::Save(ByteStream* stream) {
+  stream->Write(kXmaSaveSignature);
+  const std::vector<uint64_t>& context_bitmap_data = context_bitmap_.data();
+  stream->Write(uint32_t(context_bitmap_data.size()));
+  stream->Write(context_bitmap_data.data(),
+                sizeof(uint64_t) * context_bitmap_data.size());
+  for (uint32_t i = 0; i < kContextCount; ++i) {
+    contexts_[i].Save(stream);
+  }
+  return true;
+}
+
+bool XmaDecoder::Restore(ByteStream* stream) {
+  if (stream->Read<uint32_t>() != kXmaSaveSignature) {
+    XELOGE("XmaDecoder::Restore - Invalid magic value!");
+    return false;
+  }
+  std::vector<uint64_t>& context_bitmap_data = context_bitmap_.data();
+  if (stream->Read<uint32_t>() != context_bitmap_data.size()) {
+    XELOGE("XmaDecoder::Restore - Context count mismatch!");
+    return false;
+  }
+  stream->Read(context_bitmap_data.data(),
+               sizeof(uint64_t) * context_bitmap_data.size());
+  for (uint32_t i = 0; i < kContextCount; ++i) {
+    XmaContext& context = contexts_[i];
+    context.Restore(stream);
+    // The kick that enabled the context has been lost with the queue.
+    if (context.is_allocated() && context.is_enabled()) {
+      QueueContext(i);
+    }
+  }
+  return true;
+}
+
 void XmaDecoder::Pause() {
   if (paused_) {
     return;
   }
   paused_ = true;
+  for (const std::unique_ptr<Worker>& worker : workers_) {
+    worker->waiter.Wake();
+  }
 
-  pause_fence_.Wait();
+  // Wait for all the workers to be paused.
+  std::unique_lock<std::mutex> pause_lock(pause_mutex_);
+  pause_cond_.wait(pause_lock, [this]() {
+    return paused_worker_count_ >= uint32_t(workers_.size());
+  });
 }
 
 void XmaDecoder::Resume() {
   if (!paused_) {
     return;
   }
-  paused_ = false;
-
-  resume_fence_.Signal();
+  {
+    std::lock_guard<std::mutex> pause_lock(pause_mutex_);
+    paused_ = false;
+  }
+  pause_cond_.notify_all();
 }
 
 }  // namespace apu
@@ -11,8 +11,12 @@
 #define XENIA_APU_XMA_DECODER_H_
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <queue>
+#include <vector>
 
 #include "xenia/apu/xma_context.h"
 #include "xenia/apu/xma_register_file.h"
@@ -23,6 +27,8 @@
 namespace xe {
 namespace apu {
 
+constexpr fourcc_t kXmaSaveSignature = make_fourcc("XXMA");
+
 struct XMA_CONTEXT_DATA;
 
 class XmaDecoder {
@@ -47,7 +53,14 @@ class XmaDecoder {
   uint32_t ReadRegister(uint32_t addr);
   void WriteRegister(uint32_t addr, uint32_t value);
 
-  bool is_paused() const { return paused_; }
+  // Must be called while paused.
+  bool Save(ByteStream* stream);
+  bool Restore(ByteStream* stream);
+
+  // Total host time spent decoding by all the workers, for statistics.
+  uint64_t QueryDecodeTimeMicros() const;
+
+  bool is_paused() const { return paused_.load(std::memory_order_relaxed); }
   void Pause();
   void Resume();
 
@@ -55,7 +68,16 @@ class XmaDecoder {
   int GetContextId(uint32_t guest_ptr);
 
  private:
-  void WorkerThreadMain();
+  struct Worker {
+    kernel::object_ref<kernel::XHostThread> thread;
+    xe::threading::AdaptiveWaiter waiter;
+  };
+
+  void WorkerThreadMain(uint32_t worker_index);
+  // Adds the context to the queue of contexts to decode and wakes the workers
+  // if it's not in the queue already.
+  void QueueContext(uint32_t context_id);
+  bool PopQueuedContext(uint32_t& context_id_out);
 
   static uint32_t MMIOReadRegisterThunk(void* ppc_context, XmaDecoder* as,
                                         uint32_t addr) {
@@ -70,17 +92,34 @@ class XmaDecoder {
   Memory* memory_ = nullptr;
   cpu::Processor* processor_ = nullptr;
 
-  std::atomic<bool> worker_running_ = {false};
-  kernel::object_ref<kernel::XHostThread> worker_thread_;
-  std::unique_ptr<xe::threading::Event> work_event_ = nullptr;
+  static const uint32_t kContextCount = 320;
+  static const uint32_t kMaxWorkerCount = 16;
 
-  bool paused_ = false;
-  xe::threading::Fence pause_fence_;   // Signaled when worker paused.
-  xe::threading::Fence resume_fence_;  // Signaled when resume requested.
+  // Contexts are decoded by a pool of workers. A context is claimed by one
+  // worker at a time by its lock, and all the work enabled for it is done in
+  // one go, so the order of the decoding within a context is preserved.
+  std::atomic<bool> worker_running_ = {false};
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  // Contexts kicked by the guest, to be decoded by the first worker that is
+  // available.
+  std::mutex queued_contexts_mutex_;
+  std::deque<uint32_t> queued_contexts_;
+  uint64_t queued_context_bits_[(kContextCount + 63) / 64] = {};
+  // For checking whether there's queued work without locking the mutex.
+  std::atomic<uint32_t> queued_context_count_ = {0};
+  // In host ticks.
+  std::atomic<uint64_t> decode_time_total_ = {0};
+
+  std::atomic<bool> paused_ = {false};
+  // Protects the pause state of the workers, notified when a worker is paused
+  // and when resuming is requested.
+  std::mutex pause_mutex_;
+  std::condition_variable pause_cond_;
+  uint32_t paused_worker_count_ = 0;
 
   XmaRegisterFile register_file_;
 
-  static const uint32_t kContextCount = 320;
   XmaContext contexts_[kContextCount];
   BitMap context_bitmap_;
 
@@ -83,8 +83,27 @@ void* Arena::Alloc(size_t size, size_t align) {
   return p;
 }
 
+char* Arena::CopyString(const std::string_view value) {
+  auto p = reinterpret_cast<char*>(Alloc(value.size() + 1, 1));
+  std::memcpy(p, value.data(), value.size());
+  p[value.size()] = '\0';
+  return p;
+}
+
 void Arena::Rewind(size_t size) { active_chunk_->offset -= size; }
 
+void Arena::Rollback(const Marker& marker) {
+  if (!marker.chunk) {
+    Reset();
+    return;
+  }
+  // The chunks after the marker's one are reused when the allocations reach
+  // them again.
+  active_chunk_ = marker.chunk;
+  assert_true(marker.offset <= active_chunk_->offset);
+  active_chunk_->offset = marker.offset;
+}
+
 size_t Arena::CalculateSize() {
   size_t total_length = 0;
   Chunk* chunk = head_chunk_;
@@ -12,6 +12,10 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "xenia/base/literals.h"
@@ -21,7 +25,31 @@ namespace xe {
 using namespace xe::literals;
 
 class Arena {
+  class Chunk;
+
  public:
+  // Position in the arena that can be rolled back to, making everything
+  // allocated after it was taken available again.
+  struct Marker {
+    Chunk* chunk;
+    size_t offset;
+  };
+
+  // Rolls the arena back to where it was at construction when going out of
+  // scope, for temporary allocations in a long-lived arena.
+  class ScopedRollback {
+   public:
+    explicit ScopedRollback(Arena& arena)
+        : arena_(arena), marker_(arena.GetMarker()) {}
+    ~ScopedRollback() { arena_.Rollback(marker_); }
+    ScopedRollback(const ScopedRollback&) = delete;
+    ScopedRollback& operator=(const ScopedRollback&) = delete;
+
+   private:
+    Arena& arena_;
+    Marker marker_;
+  };
+
   explicit Arena(size_t chunk_size = 4_MiB);
   ~Arena();
 
@@ -33,10 +61,39 @@ class Arena {
   T* Alloc() {
     return reinterpret_cast<T*>(Alloc(sizeof(T), alignof(T)));
   }
+  // Objects in the arena are never destroyed, so only types that don't need
+  // destruction may be constructed in it.
+  template <typename T, typename... Args>
+  T* New(Args&&... args) {
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "Arena objects are not destroyed");
+    return new (Alloc(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+  }
+  // Value-initializes the elements.
+  template <typename T>
+  T* NewArray(size_t count) {
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "Arena objects are not destroyed");
+    T* elements = reinterpret_cast<T*>(Alloc(sizeof(T) * count, alignof(T)));
+    for (size_t i = 0; i < count; ++i) {
+      new (&elements[i]) T();
+    }
+    return elements;
+  }
+  // Copies the string into the arena with a null terminator.
+  char* CopyString(const std::string_view value);
+
   // When rewinding aligned allocations, any padding that was applied during
   // allocation will be leaked
   void Rewind(size_t size);
 
+  Marker GetMarker() const {
+    return {active_chunk_, active_chunk_ ? active_chunk_->offset : 0};
+  }
+  // Only markers taken after the latest Reset or earlier rollback target may
+  // be rolled back to.
+  void Rollback(const Marker& marker);
+
   void* CloneContents();
   template <typename T>
   void CloneContents(std::vector<T>* buffer) {
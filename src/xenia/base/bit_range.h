@@ -74,6 +74,35 @@ std::pair<size_t, size_t> NextUnsetRange(const Block* bits, size_t first,
   return std::make_pair(first + length, size_t(0));
 }
 
+// Checks whole blocks instead of individual bits.
+template <typename Block>
+bool AnyInRange(const Block* bits, size_t first, size_t length) {
+  if (!length) {
+    return false;
+  }
+  size_t last = first + length - 1;
+  const size_t block_bits = sizeof(Block) * CHAR_BIT;
+  size_t block_first = first / block_bits;
+  size_t block_last = last / block_bits;
+  Block mask_first = ~((Block(1) << (first & (block_bits - 1))) - 1);
+  Block mask_last = ~Block(0);
+  if ((last & (block_bits - 1)) != (block_bits - 1)) {
+    mask_last &= (Block(1) << ((last & (block_bits - 1)) + 1)) - 1;
+  }
+  if (block_first == block_last) {
+    return (bits[block_first] & mask_first & mask_last) != 0;
+  }
+  if (bits[block_first] & mask_first) {
+    return true;
+  }
+  for (size_t i = block_first + 1; i < block_last; ++i) {
+    if (bits[i]) {
+      return true;
+    }
+  }
+  return (bits[block_last] & mask_last) != 0;
+}
+
 template <typename Block>
 void SetRange(Block* bits, size_t first, size_t length) {
   if (!length) {
@@ -38,13 +38,87 @@ uint64_t guest_system_time_base_ = Clock::QueryHostSystemTime();
 // Computed by RecomputeGuestTickScalar.
 std::pair<uint64_t, uint64_t> guest_tick_ratio_ = std::make_pair(1, 1);
 
-// Native guest ticks.
-uint64_t last_guest_tick_count_ = 0;
-// Last sampled host tick count.
-uint64_t last_host_tick_count_ = Clock::QueryHostTickCount();
-// Mutex to ensure last_host_tick_count_ and last_guest_tick_count_ are in sync
+// Mapping of the host tick count to the guest tick count with scaling, starting
+// at zero guest ticks. Modified only with tick_mutex_ locked.
+Clock::GuestTickMapping guest_tick_mapping_ = {
+    {0}, {Clock::QueryHostTickCount()}, {0}, {1}, {0}};
+// Whether the host base of the mapping is from the raw clock source, to avoid
+// mixing the two sources if the mapping was created before loading the
+// configuration.
+bool guest_tick_mapping_host_raw_ = false;
+// Mutex serializing the modifications of guest_tick_mapping_.
 std::mutex tick_mutex_;
 
+// Returns false if the mapping is being modified by another thread.
+bool TryMapHostTickCount(uint64_t host_tick_count,
+                         uint64_t& guest_tick_count_out) {
+  uint64_t sequence =
+      guest_tick_mapping_.sequence.load(std::memory_order_acquire);
+  if (sequence & 1) {
+    return false;
+  }
+  uint64_t host_base =
+      guest_tick_mapping_.host_base.load(std::memory_order_relaxed);
+  uint64_t guest_base =
+      guest_tick_mapping_.guest_base.load(std::memory_order_relaxed);
+  uint64_t multiplier =
+      guest_tick_mapping_.multiplier.load(std::memory_order_relaxed);
+  uint64_t shift = guest_tick_mapping_.shift.load(std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (guest_tick_mapping_.sequence.load(std::memory_order_relaxed) !=
+      sequence) {
+    return false;
+  }
+  guest_tick_count_out =
+      guest_base +
+      Clock::MultiplyShiftRight(
+          host_tick_count > host_base ? host_tick_count - host_base : 0,
+          multiplier, uint32_t(shift));
+  return true;
+}
+
+uint64_t MapHostTickCount(uint64_t host_tick_count) {
+  uint64_t guest_tick_count;
+  if (!TryMapHostTickCount(host_tick_count, guest_tick_count)) {
+    // Wait until another thread has finished updating the mapping.
+    std::lock_guard<std::mutex> lock(tick_mutex_);
+    TryMapHostTickCount(host_tick_count, guest_tick_count);
+  }
+  return guest_tick_count;
+}
+
+// Moves the base of the mapping to the current host tick count, applying the
+// current tick ratio from now on, and optionally moving the guest time forward.
+// tick_mutex_ must be locked.
+void RebaseGuestTickMapping(uint64_t guest_tick_advance) {
+  uint64_t host_tick_count = Clock::QueryHostTickCount();
+  uint64_t guest_tick_count =
+      guest_tick_mapping_.guest_base.load(std::memory_order_relaxed);
+  bool host_raw = false;
+#if XE_CLOCK_RAW_AVAILABLE
+  host_raw = cvars::clock_source_raw;
+#endif
+  if (host_raw == guest_tick_mapping_host_raw_) {
+    TryMapHostTickCount(host_tick_count, guest_tick_count);
+  }
+  guest_tick_mapping_host_raw_ = host_raw;
+  guest_tick_count += guest_tick_advance;
+  uint64_t multiplier;
+  uint32_t shift;
+  Clock::GetRatioMultiplierShift(guest_tick_ratio_, multiplier, shift);
+  uint64_t sequence =
+      guest_tick_mapping_.sequence.load(std::memory_order_relaxed);
+  guest_tick_mapping_.sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  guest_tick_mapping_.host_base.store(host_tick_count,
+                                      std::memory_order_relaxed);
+  guest_tick_mapping_.guest_base.store(guest_tick_count,
+                                       std::memory_order_relaxed);
+  guest_tick_mapping_.multiplier.store(multiplier, std::memory_order_relaxed);
+  guest_tick_mapping_.shift.store(shift, std::memory_order_relaxed);
+  guest_tick_mapping_.sequence.store(sequence + 2, std::memory_order_release);
+}
+
 void RecomputeGuestTickScalar() {
   // Create a rational number with numerator (first) and denominator (second)
   auto frac =
@@ -63,6 +137,9 @@ void RecomputeGuestTickScalar() {
 
   std::lock_guard<std::mutex> lock(tick_mutex_);
   guest_tick_ratio_ = frac;
+  // The host time that has passed until now is still scaled with the previous
+  // ratio.
+  RebaseGuestTickMapping(0);
 }
 
 // Update the guest timer for all threads.
@@ -75,22 +152,7 @@ uint64_t UpdateGuestClock() {
     return host_tick_count * guest_tick_ratio_.first / guest_tick_ratio_.second;
   }
 
-  std::unique_lock<std::mutex> lock(tick_mutex_, std::defer_lock);
-  if (lock.try_lock()) {
-    // Translate host tick count to guest tick count.
-    uint64_t host_tick_delta = host_tick_count > last_host_tick_count_
-                                   ? host_tick_count - last_host_tick_count_
-                                   : 0;
-    last_host_tick_count_ = host_tick_count;
-    uint64_t guest_tick_delta =
-        host_tick_delta * guest_tick_ratio_.first / guest_tick_ratio_.second;
-    last_guest_tick_count_ += guest_tick_delta;
-    return last_guest_tick_count_;
-  } else {
-    // Wait until another thread has finished updating the clock.
-    lock.lock();
-    return last_guest_tick_count_;
-  }
+  return MapHostTickCount(host_tick_count);
 }
 
 // Offset of the current guest system file time relative to the guest base time.
@@ -141,6 +203,54 @@ std::pair<uint64_t, uint64_t> Clock::guest_tick_ratio() {
   return guest_tick_ratio_;
 }
 
+const Clock::GuestTickMapping& Clock::guest_tick_mapping() {
+  return guest_tick_mapping_;
+}
+
+void Clock::GetRatioMultiplierShift(std::pair<uint64_t, uint64_t> ratio,
+                                    uint64_t& multiplier_out,
+                                    uint32_t& shift_out) {
+  assert_not_zero(ratio.second);
+  // Long division of the numerator shifted left, one bit at a time, keeping
+  // the multiplier below 2^63.
+  uint64_t quotient = ratio.first / ratio.second;
+  uint64_t remainder = ratio.first % ratio.second;
+  uint32_t shift = 0;
+  while (shift < 63 && quotient < (uint64_t(1) << 62)) {
+    quotient <<= 1;
+    // The remainder is smaller than the denominator, which is not expected to
+    // be as large as 2^63.
+    remainder <<= 1;
+    if (remainder >= ratio.second) {
+      remainder -= ratio.second;
+      quotient |= 1;
+    }
+    ++shift;
+  }
+  multiplier_out = quotient;
+  shift_out = shift;
+}
+
+uint64_t Clock::MultiplyShiftRight(uint64_t value, uint64_t multiplier,
+                                   uint32_t shift) {
+  assert_true(shift < 64);
+  uint64_t value_low = uint32_t(value), value_high = value >> 32;
+  uint64_t multiplier_low = uint32_t(multiplier),
+           multiplier_high = multiplier >> 32;
+  uint64_t low_low = value_low * multiplier_low;
+  uint64_t high_low = value_high * multiplier_low;
+  // Can't overflow - at most (2^32 - 1) * 2 + (2^32 - 1)^2.
+  uint64_t middle =
+      (low_low >> 32) + uint32_t(high_low) + value_low * multiplier_high;
+  uint64_t product_high = value_high * multiplier_high + (high_low >> 32) +
+                          (middle >> 32);
+  uint64_t product_low = (middle << 32) | uint32_t(low_low);
+  if (!shift) {
+    return product_low;
+  }
+  return (product_low >> shift) | (product_high << (64 - shift));
+}
+
 uint64_t Clock::guest_tick_frequency() { return guest_tick_frequency_; }
 
 void Clock::set_guest_tick_frequency(uint64_t frequency) {
@@ -185,6 +295,16 @@ void Clock::SetGuestSystemTime(uint64_t system_time) {
   guest_system_time_base_ = system_time - guest_system_time_offset;
 }
 
+void Clock::AdvanceGuestTickCount(uint64_t guest_ticks) {
+  if (cvars::clock_no_scaling) {
+    // Time is fixed to host time.
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(tick_mutex_);
+  RebaseGuestTickMapping(guest_ticks);
+}
+
 uint32_t Clock::ScaleGuestDurationMillis(uint32_t guest_ms) {
   if (cvars::clock_no_scaling) {
     return guest_ms;
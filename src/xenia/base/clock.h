@@ -10,8 +10,10 @@
 #ifndef XENIA_BASE_CLOCK_H_
 #define XENIA_BASE_CLOCK_H_
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <utility>
 
 #include "xenia/base/cvar.h"
 #include "xenia/base/platform.h"
@@ -29,6 +31,21 @@ namespace xe {
 
 class Clock {
  public:
+  // Linear mapping of the host tick count to the guest tick count with scaling
+  // enabled, published through a sequence lock so the guest tick count can be
+  // calculated without locking, including by the code emitted by the JIT:
+  // guest_base + (max(host - host_base, 0) * multiplier) >> shift, with a
+  // 128-bit product. The sequence is odd while the mapping is being updated -
+  // readers must retry or fall back to QueryGuestTickCount if it's odd, or if
+  // it has changed while reading the rest of the mapping.
+  struct GuestTickMapping {
+    std::atomic<uint64_t> sequence;
+    std::atomic<uint64_t> host_base;
+    std::atomic<uint64_t> guest_base;
+    std::atomic<uint64_t> multiplier;
+    std::atomic<uint64_t> shift;
+  };
+
   // Host ticks-per-second. Generally QueryHostTickFrequency should be used.
   // Either from platform suplied time source or from hardware directly.
   static uint64_t host_tick_frequency_platform();
@@ -57,6 +74,16 @@ class Clock {
   static void set_guest_time_scalar(double scalar);
   // Get the tick ration between host and guest including time scaling if set.
   static std::pair<uint64_t, uint64_t> guest_tick_ratio();
+  // The current mapping of host ticks to guest ticks with scaling enabled.
+  static const GuestTickMapping& guest_tick_mapping();
+  // Converts a ratio (numerator, denominator) to a multiplier and a right shift
+  // (up to 63) approximating it, for scaling without division.
+  static void GetRatioMultiplierShift(std::pair<uint64_t, uint64_t> ratio,
+                                      uint64_t& multiplier_out,
+                                      uint32_t& shift_out);
+  // Calculates (value * multiplier) >> shift with a 128-bit product.
+  static uint64_t MultiplyShiftRight(uint64_t value, uint64_t multiplier,
+                                     uint32_t shift);
   // Guest ticks-per-second.
   static uint64_t guest_tick_frequency();
   // Sets the guest ticks-per-second.
@@ -77,6 +104,10 @@ class Clock {
 
   // Sets the system time of the guest.
   static void SetGuestSystemTime(uint64_t system_time);
+  // Moves the guest time (the tick count, the system time and the uptime)
+  // forward without the host time passing, for skipping the time while the
+  // guest is idle. Ignored with clock_no_scaling.
+  static void AdvanceGuestTickCount(uint64_t guest_ticks);
 
   // Scales a time duration in milliseconds, from guest time.
   static uint32_t ScaleGuestDurationMillis(uint32_t guest_ms);
@@ -24,5 +24,30 @@ bool CreateParentFolder(const std::filesystem::path& path) {
   return true;
 }
 
+bool TryUpgradeStdioFileLock(FILE* file) {
+  if (LockStdioFile(file, StdioFileLock::kExclusive, false)) {
+    return true;
+  }
+  LockStdioFile(file, StdioFileLock::kShared, true);
+  return false;
+}
+
+bool FileHandle::ReadVectored(size_t file_offset, const ReadSegment* segments,
+                              size_t segment_count, size_t* out_bytes_read) {
+  *out_bytes_read = 0;
+  for (size_t i = 0; i < segment_count; ++i) {
+    size_t bytes_read = 0;
+    if (!Read(file_offset + *out_bytes_read, segments[i].buffer,
+              segments[i].length, &bytes_read)) {
+      return false;
+    }
+    *out_bytes_read += bytes_read;
+    if (bytes_read != segments[i].length) {
+      break;
+    }
+  }
+  return true;
+}
+
 }  // namespace filesystem
 }  // namespace xe
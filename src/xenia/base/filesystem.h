@@ -61,6 +61,37 @@ int64_t Tell(FILE* file);
 // undefined.
 bool TruncateStdioFile(FILE* file, uint64_t length);
 
+// Hints that the range of a stdio file is going to be read soon, so it can be
+// loaded asynchronously. May be ignored.
+void PrefetchStdioFile(FILE* file, uint64_t offset, uint64_t length);
+
+enum class StdioFileLock {
+  kNone,
+  kShared,
+  kExclusive,
+};
+
+// Changes the advisory lock held via a stdio file for coordinating with other
+// processes using it, such as multiple emulator instances sharing a cache
+// directory. The lock is released when the file is closed. Changing the lock
+// is not atomic - another process may take a conflicting lock in between, so
+// if this returns false with wait being false, the previous lock is not held
+// anymore. The lock must not be relied upon for protecting the data itself,
+// only for agreement between processes that use it.
+bool LockStdioFile(FILE* file, StdioFileLock lock, bool wait);
+
+// With a shared lock held via the file, tries to take the exclusive lock if no
+// other process has the file locked. If failed, waits for the shared lock to be
+// held again and returns false.
+bool TryUpgradeStdioFileLock(FILE* file);
+
+// Appends the data to the end of a stdio file opened in an append mode as one
+// write, after flushing the data buffered in the stream. Unlike with buffered
+// writes, appends from different processes to the same file are not
+// interleaved, though appends interrupted by an error (like the disk running
+// out of space) may still leave a partially written record in the end.
+bool AppendToStdioFile(FILE* file, const void* data, size_t size);
+
 struct FileAccess {
   // Implies kFileReadData.
   static const uint32_t kGenericRead = 0x80000000;
@@ -73,6 +104,12 @@ struct FileAccess {
   static const uint32_t kFileAppendData = 0x00000004;
 };
 
+// Destination of a part of a vectored read.
+struct ReadSegment {
+  void* buffer;
+  size_t length;
+};
+
 class FileHandle {
  public:
   // Opens the file, failing if it doesn't exist.
@@ -90,6 +127,12 @@ class FileHandle {
   virtual bool Read(size_t file_offset, void* buffer, size_t buffer_length,
                     size_t* out_bytes_read) = 0;
 
+  // Reads consecutive bytes from the file starting at the given offset into
+  // the segments in order, stopping at the end of the file. By default, reads
+  // every segment separately, but may be done in one vectored operation.
+  virtual bool ReadVectored(size_t file_offset, const ReadSegment* segments,
+                            size_t segment_count, size_t* out_bytes_read);
+
   // Writes the given buffer to the file starting at the given offset.
   // The total number of bytes written is returned only if the complete
   // write succeeds.
@@ -10,19 +10,24 @@
 #include "xenia/base/assert.h"
 #include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
+#include "xenia/base/math.h"
 #include "xenia/base/string.h"
 
 #include <assert.h>
 #include <dirent.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <ftw.h>
 #include <libgen.h>
 #include <pwd.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/file.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
+#include <algorithm>
 #include <iostream>
 
 namespace xe {
@@ -106,6 +111,58 @@ bool TruncateStdioFile(FILE* file, uint64_t length) {
   return true;
 }
 
+void PrefetchStdioFile(FILE* file, uint64_t offset, uint64_t length) {
+  posix_fadvise64(fileno(file), off64_t(offset), off64_t(length),
+                  POSIX_FADV_WILLNEED);
+}
+
+bool LockStdioFile(FILE* file, StdioFileLock lock, bool wait) {
+  int operation;
+  switch (lock) {
+    case StdioFileLock::kShared:
+      operation = LOCK_SH;
+      break;
+    case StdioFileLock::kExclusive:
+      operation = LOCK_EX;
+      break;
+    default:
+      operation = LOCK_UN;
+      break;
+  }
+  if (!wait) {
+    operation |= LOCK_NB;
+  }
+  int result;
+  do {
+    result = flock(fileno(file), operation);
+  } while (result && errno == EINTR);
+  return !result;
+}
+
+bool AppendToStdioFile(FILE* file, const void* data, size_t size) {
+  // The stream must be opened in an append mode, so the writes are done with
+  // O_APPEND, atomically moving to the end.
+  if (fflush(file)) {
+    return false;
+  }
+  const uint8_t* data_remaining = reinterpret_cast<const uint8_t*>(data);
+  while (size) {
+    ssize_t bytes_written = write(fileno(file), data_remaining, size);
+    if (bytes_written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    if (!bytes_written) {
+      return false;
+    }
+    data_remaining += bytes_written;
+    size -= size_t(bytes_written);
+  }
+  return true;
+}
+
 static int removeCallback(const char* fpath, const struct stat* sb,
                           int typeflag, struct FTW* ftwbuf) {
   int rv = remove(fpath);
@@ -145,6 +202,32 @@ class PosixFileHandle : public FileHandle {
     *out_bytes_read = out;
     return out >= 0 ? true : false;
   }
+  bool ReadVectored(size_t file_offset, const ReadSegment* segments,
+                    size_t segment_count, size_t* out_bytes_read) override {
+    *out_bytes_read = 0;
+    iovec iov[64];
+    while (segment_count) {
+      int iov_count = int(std::min(segment_count, xe::countof(iov)));
+      size_t requested = 0;
+      for (int i = 0; i < iov_count; ++i) {
+        iov[i].iov_base = segments[i].buffer;
+        iov[i].iov_len = segments[i].length;
+        requested += segments[i].length;
+      }
+      ssize_t out =
+          preadv(handle_, iov, iov_count, file_offset + *out_bytes_read);
+      if (out < 0) {
+        return false;
+      }
+      *out_bytes_read += out;
+      if (size_t(out) != requested) {
+        break;
+      }
+      segments += iov_count;
+      segment_count -= iov_count;
+    }
+    return true;
+  }
   bool Write(size_t file_offset, const void* buffer, size_t buffer_length,
              size_t* out_bytes_written) override {
     ssize_t out = pwrite(handle_, buffer, buffer_length, file_offset);
@@ -197,9 +280,13 @@ bool GetInfo(const std::filesystem::path& path, FileInfo* out_info) {
   if (stat(path.c_str(), &st) == 0) {
     if (S_ISDIR(st.st_mode)) {
       out_info->type = FileInfo::Type::kDirectory;
+      out_info->total_size = 0;
     } else {
       out_info->type = FileInfo::Type::kFile;
+      out_info->total_size = st.st_size;
     }
+    out_info->path = path.parent_path();
+    out_info->name = path.filename();
     out_info->create_timestamp = convertUnixtimeToWinFiletime(st.st_ctime);
     out_info->access_timestamp = convertUnixtimeToWinFiletime(st.st_atime);
     out_info->write_timestamp = convertUnixtimeToWinFiletime(st.st_mtime);
@@ -216,21 +303,29 @@ std::vector<FileInfo> ListFiles(const std::filesystem::path& path) {
     return result;
   }
 
+  // Querying the children relatively to the directory descriptor rather than
+  // by full paths, so the path to the directory isn't resolved for each.
+  int dir_fd = dirfd(dir);
   while (auto ent = readdir(dir)) {
     if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) {
       continue;
     }
 
+    struct stat st;
+    if (fstatat(dir_fd, ent->d_name, &st, 0) != 0) {
+      continue;
+    }
+
     FileInfo info;
 
     info.name = ent->d_name;
-    struct stat st;
-    stat((path / info.name).c_str(), &st);
     info.create_timestamp = convertUnixtimeToWinFiletime(st.st_ctime);
     info.access_timestamp = convertUnixtimeToWinFiletime(st.st_atime);
     info.write_timestamp = convertUnixtimeToWinFiletime(st.st_mtime);
     info.path = path;
-    if (ent->d_type == DT_DIR) {
+    // d_type may be DT_UNKNOWN on some file systems, and doesn't follow
+    // symbolic links.
+    if (S_ISDIR(st.st_mode)) {
       info.type = FileInfo::Type::kDirectory;
       info.total_size = 0;
     } else {
@@ -10,6 +10,7 @@
 #include <io.h>
 #include <shlobj.h>
 
+#include <algorithm>
 #include <string>
 
 #undef CreateFile
@@ -103,6 +104,64 @@ bool TruncateStdioFile(FILE* file, uint64_t length) {
   return true;
 }
 
+void PrefetchStdioFile(FILE* file, uint64_t offset, uint64_t length) {
+  // No asynchronous readahead hint for file handles on Windows - the cache
+  // manager already detects sequential reads by itself.
+}
+
+bool LockStdioFile(FILE* file, StdioFileLock lock, bool wait) {
+  HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file)));
+  if (handle == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  // Locks on Windows are mandatory, so lock a byte far beyond the end of any
+  // real file rather than the contents, which would block reads and writes
+  // even by the process holding a shared lock.
+  OVERLAPPED overlapped = {};
+  overlapped.Offset = UINT32_MAX;
+  overlapped.OffsetHigh = UINT32_MAX >> 1;
+  UnlockFileEx(handle, 0, 1, 0, &overlapped);
+  if (lock == StdioFileLock::kNone) {
+    return true;
+  }
+  DWORD flags = 0;
+  if (lock == StdioFileLock::kExclusive) {
+    flags |= LOCKFILE_EXCLUSIVE_LOCK;
+  }
+  if (!wait) {
+    flags |= LOCKFILE_FAIL_IMMEDIATELY;
+  }
+  return LockFileEx(handle, flags, 0, 1, 0, &overlapped) != 0;
+}
+
+bool AppendToStdioFile(FILE* file, const void* data, size_t size) {
+  if (fflush(file)) {
+    return false;
+  }
+  HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file)));
+  if (handle == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  const uint8_t* data_remaining = reinterpret_cast<const uint8_t*>(data);
+  while (size) {
+    // The offset of all ones makes the write an atomic append, like with
+    // FILE_APPEND_DATA access, rather than seeking to the end and writing.
+    OVERLAPPED overlapped = {};
+    overlapped.Offset = UINT32_MAX;
+    overlapped.OffsetHigh = UINT32_MAX;
+    DWORD bytes_written;
+    if (!WriteFile(handle, data_remaining,
+                   DWORD(std::min(size, size_t(UINT32_MAX))), &bytes_written,
+                   &overlapped) ||
+        !bytes_written) {
+      return false;
+    }
+    data_remaining += bytes_written;
+    size -= bytes_written;
+  }
+  return true;
+}
+
 class Win32FileHandle : public FileHandle {
  public:
   Win32FileHandle(const std::filesystem::path& path, HANDLE handle)
@@ -230,8 +289,12 @@ bool GetInfo(const std::filesystem::path& path, FileInfo* out_info) {
 std::vector<FileInfo> ListFiles(const std::filesystem::path& path) {
   std::vector<FileInfo> result;
 
+  // The attributes are retrieved along with the names in large batches,
+  // without looking up the short names.
   WIN32_FIND_DATA ffd;
-  HANDLE handle = FindFirstFileW((path / "*").c_str(), &ffd);
+  HANDLE handle = FindFirstFileExW((path / "*").c_str(), FindExInfoBasic, &ffd,
+                                   FindExSearchNameMatch, nullptr,
+                                   FIND_FIRST_EX_LARGE_FETCH);
   if (handle == INVALID_HANDLE_VALUE) {
     return result;
   }
@@ -13,13 +13,10 @@
 #include <atomic>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
 #include <mutex>
 #include <vector>
 
-#include "third_party/disruptorplus/include/disruptorplus/multi_threaded_claim_strategy.hpp"
-#include "third_party/disruptorplus/include/disruptorplus/ring_buffer.hpp"
-#include "third_party/disruptorplus/include/disruptorplus/sequence_barrier.hpp"
-#include "third_party/disruptorplus/include/disruptorplus/spin_wait_strategy.hpp"
 #include "xenia/base/assert.h"
 #include "xenia/base/atomic.h"
 #include "xenia/base/console.h"
@@ -30,7 +27,6 @@
 #include "xenia/base/math.h"
 #include "xenia/base/memory.h"
 #include "xenia/base/platform.h"
-#include "xenia/base/ring_buffer.h"
 #include "xenia/base/string.h"
 #include "xenia/base/system.h"
 #include "xenia/base/threading.h"
@@ -60,7 +56,6 @@ DEFINE_int32(
     "Maximum level to be logged. (0=error, 1=warning, 2=info, 3=debug)",
     "Logging");
 
-namespace dp = disruptorplus;
 using namespace xe::literals;
 
 namespace xe {
@@ -70,13 +65,59 @@ class Logger;
 Logger* logger_ = nullptr;
 
 struct LogLine {
-  size_t buffer_length;
+  // Order of the line among the lines of all threads.
+  uint64_t sequence;
+  uint32_t buffer_length;
   uint32_t thread_id;
-  uint16_t _pad_0;  // (2b) padding
-  bool terminate;
   char prefix_char;
 };
 
+// Lines appended by a single thread, read by the writer thread, so the
+// threads don't contend for a shared buffer.
+struct ThreadLogBuffer {
+  static constexpr size_t kSize = 256_KiB;
+  static constexpr size_t kAlignment = alignof(LogLine);
+
+  // Total byte counts, the offsets in data are modulo kSize.
+  std::atomic<size_t> write_position = {0};
+  std::atomic<size_t> read_position = {0};
+  // Set when the thread exits, for the writer thread to drop the buffer once
+  // it's empty.
+  std::atomic<bool> abandoned = {false};
+  uint8_t data[kSize];
+
+  void CopyOut(size_t position, void* out, size_t length) const {
+    size_t offset = position % kSize;
+    size_t first_length = std::min(length, kSize - offset);
+    std::memcpy(out, data + offset, first_length);
+    std::memcpy(static_cast<uint8_t*>(out) + first_length, data,
+                length - first_length);
+  }
+  void CopyIn(size_t position, const void* in, size_t length) {
+    size_t offset = position % kSize;
+    size_t first_length = std::min(length, kSize - offset);
+    std::memcpy(data + offset, in, first_length);
+    std::memcpy(data, static_cast<const uint8_t*>(in) + first_length,
+                length - first_length);
+  }
+};
+
+// The buffer of the thread in the current logger, identified by its
+// generation as loggers may be recreated.
+struct ThreadLogBufferReference {
+  ~ThreadLogBufferReference() {
+    if (buffer) {
+      buffer->abandoned.store(true, std::memory_order_release);
+    }
+  }
+
+  std::shared_ptr<ThreadLogBuffer> buffer;
+  uint32_t logger_generation = 0;
+};
+
+thread_local ThreadLogBufferReference thread_log_buffer_reference_;
+std::atomic<uint32_t> logger_generation_ = {0};
+
 thread_local char thread_log_buffer_[64_KiB];
 
 FileLogSink::~FileLogSink() {
@@ -217,11 +258,7 @@ void AndroidLogSink::WriteLineBuffer() {
 class Logger {
  public:
   explicit Logger(const std::string_view app_name)
-      : wait_strategy_(),
-        claim_strategy_(kBlockCount, wait_strategy_),
-        consumed_(wait_strategy_) {
-    claim_strategy_.add_claim_barrier(consumed_);
-
+      : generation_(logger_generation_.fetch_add(1) + 1) {
     write_thread_ =
         xe::threading::Thread::Create({}, [this]() { WriteThread(); });
     assert_not_null(write_thread_);
@@ -229,7 +266,8 @@ class Logger {
   }
 
   ~Logger() {
-    AppendLine(0, '\0', nullptr, 0, true);  // append a terminator
+    // The writer thread drains all the buffers before exiting.
+    terminate_.store(true, std::memory_order_release);
     xe::threading::Wait(write_thread_.get(), true);
   }
 
@@ -238,27 +276,17 @@ class Logger {
   }
 
  private:
-  static const size_t kBufferSize = 8_MiB;
-  uint8_t buffer_[kBufferSize];
+  // Idle polls of the buffers before sleeping between polls.
+  static constexpr size_t kIdleLoopsBeforeSleep = 1000;
 
-  static const size_t kBlockSize = 256;
-  static const size_t kBlockCount = kBufferSize / kBlockSize;
-  static const size_t kBlockIndexMask = kBlockCount - 1;
+  const uint32_t generation_;
+  std::atomic<uint64_t> next_sequence_ = {0};
+  std::atomic<bool> terminate_ = {false};
 
-  static const size_t kClaimStrategyFootprint =
-      sizeof(std::atomic<dp::sequence_t>[kBlockCount]);
-
-  static size_t BlockOffset(dp::sequence_t sequence) {
-    return (sequence & kBlockIndexMask) * kBlockSize;
-  }
-
-  static size_t BlockCount(size_t byte_size) {
-    return (byte_size + (kBlockSize - 1)) / kBlockSize;
-  }
-
-  dp::spin_wait_strategy wait_strategy_;
-  dp::multi_threaded_claim_strategy<dp::spin_wait_strategy> claim_strategy_;
-  dp::sequence_barrier<dp::spin_wait_strategy> consumed_;
+  // Buffers of all threads that have logged, including exited threads whose
+  // lines haven't been written yet.
+  std::mutex thread_buffers_mutex_;
+  std::vector<std::shared_ptr<ThreadLogBuffer>> thread_buffers_;
 
   std::vector<std::unique_ptr<LogSink>> sinks_;
 
@@ -270,157 +298,191 @@ class Logger {
     }
   }
 
-  void WriteThread() {
-    RingBuffer rb(buffer_, kBufferSize);
-
-    size_t idle_loops = 0;
-
-    dp::sequence_t next_sequence = 0;
-    dp::sequence_t last_sequence = -1;
-
-    size_t desired_count = 1;
-    while (true) {
-      // We want one block to find out how many blocks we need or we know how
-      // many blocks needed for at least one log line.
-      auto next_range = dp::sequence_range(next_sequence, desired_count);
-
-      claim_strategy_.wait_until_published(next_range.last(), last_sequence);
-
-      size_t read_count = 0;
-      auto available_range = next_range;
-      auto available_count = available_range.size();
-
-      rb.set_write_offset(BlockOffset(available_range.end()));
-
-      bool terminate = false;
-      for (size_t i = available_range.first(); i != available_range.end();) {
-        rb.set_read_offset(BlockOffset(i));
-
-        LogLine line;
-        rb.Read(&line, sizeof(line));
-
-        auto needed_count = BlockCount(sizeof(LogLine) + line.buffer_length);
-        if (read_count + needed_count > available_count) {
-          // More blocks are needed for a complete line.
-          desired_count = needed_count;
-          break;
-        } else {
-          // Enough blocks to read this log line, advance by that many.
-          read_count += needed_count;
-          i += needed_count;
-
-          if (line.prefix_char) {
-            char prefix[] = {
-                line.prefix_char,
-                '>',
-                ' ',
-                '?',  // Thread ID gets placed here (8 chars).
-                '?',
-                '?',
-                '?',
-                '?',
-                '?',
-                '?',
-                '?',
-                ' ',
-                0,
-            };
-            fmt::format_to_n(prefix + 3, sizeof(prefix) - 3, "{:08X}",
-                             line.thread_id);
-            Write(prefix, sizeof(prefix) - 1);
-          }
+  ThreadLogBuffer& GetThreadBuffer() {
+    ThreadLogBufferReference& reference = thread_log_buffer_reference_;
+    if (!reference.buffer || reference.logger_generation != generation_) {
+      if (reference.buffer) {
+        reference.buffer->abandoned.store(true, std::memory_order_release);
+      }
+      reference.buffer = std::make_shared<ThreadLogBuffer>();
+      reference.logger_generation = generation_;
+      std::lock_guard<std::mutex> lock(thread_buffers_mutex_);
+      thread_buffers_.push_back(reference.buffer);
+    }
+    return *reference.buffer;
+  }
 
-          if (line.buffer_length) {
-            // Get access to the line data - which may be split in the ring
-            // buffer - and write it out in parts.
-            auto line_range = rb.BeginRead(line.buffer_length);
-            Write(reinterpret_cast<const char*>(line_range.first),
-                  line_range.first_length);
-            if (line_range.second_length) {
-              Write(reinterpret_cast<const char*>(line_range.second),
-                    line_range.second_length);
-            }
-
-            // Always ensure there is a newline.
-            char last_char =
-                line_range.second
-                    ? line_range.second[line_range.second_length - 1]
-                    : line_range.first[line_range.first_length - 1];
-            if (last_char != '\n') {
-              const char suffix[1] = {'\n'};
-              Write(suffix, 1);
-            }
-
-            rb.EndRead(std::move(line_range));
-          } else {
-            // Always ensure there is a newline.
-            const char suffix[1] = {'\n'};
-            Write(suffix, 1);
-          }
+  void WriteLine(const ThreadLogBuffer& buffer, size_t position,
+                 const LogLine& line) {
+    if (line.prefix_char) {
+      char prefix[] = {
+          line.prefix_char,
+          '>',
+          ' ',
+          '?',  // Thread ID gets placed here (8 chars).
+          '?',
+          '?',
+          '?',
+          '?',
+          '?',
+          '?',
+          '?',
+          ' ',
+          0,
+      };
+      fmt::format_to_n(prefix + 3, sizeof(prefix) - 3, "{:08X}",
+                       line.thread_id);
+      Write(prefix, sizeof(prefix) - 1);
+    }
 
-          if (line.terminate) {
-            terminate = true;
-            break;
-          }
-        }
+    char last_char = '\0';
+    if (line.buffer_length) {
+      // The line data may be split in the ring buffer, write it out in parts.
+      size_t offset = (position + sizeof(LogLine)) % ThreadLogBuffer::kSize;
+      size_t first_length =
+          std::min(size_t(line.buffer_length), ThreadLogBuffer::kSize - offset);
+      Write(reinterpret_cast<const char*>(buffer.data + offset), first_length);
+      if (first_length < line.buffer_length) {
+        Write(reinterpret_cast<const char*>(buffer.data),
+              line.buffer_length - first_length);
       }
+      buffer.CopyOut(position + sizeof(LogLine) + line.buffer_length - 1,
+                     &last_char, 1);
+    }
+    // Always ensure there is a newline.
+    if (last_char != '\n') {
+      const char suffix[1] = {'\n'};
+      Write(suffix, 1);
+    }
+  }
 
-      if (terminate) {
-        break;
+  // Writes the available lines of all threads in the order they were
+  // appended, returns the number of lines written.
+  size_t WriteAvailableLines(
+      const std::vector<std::shared_ptr<ThreadLogBuffer>>& buffers) {
+    struct Head {
+      ThreadLogBuffer* buffer;
+      size_t read_position;
+      size_t write_position;
+      LogLine line;
+    };
+    std::vector<Head> heads;
+    heads.reserve(buffers.size());
+    for (const auto& buffer : buffers) {
+      size_t read_position =
+          buffer->read_position.load(std::memory_order_relaxed);
+      size_t write_position =
+          buffer->write_position.load(std::memory_order_acquire);
+      if (read_position == write_position) {
+        continue;
       }
+      Head head = {buffer.get(), read_position, write_position};
+      buffer->CopyOut(read_position, &head.line, sizeof(LogLine));
+      heads.push_back(head);
+    }
+    size_t line_count = 0;
+    while (!heads.empty()) {
+      // Merge by the sequence numbers. Lines appended concurrently may be
+      // published after a later one, only those may be reordered.
+      auto head_it = std::min_element(
+          heads.begin(), heads.end(), [](const Head& a, const Head& b) {
+            return a.line.sequence < b.line.sequence;
+          });
+      Head& head = *head_it;
+      WriteLine(*head.buffer, head.read_position, head.line);
+      ++line_count;
+      head.read_position +=
+          xe::round_up(sizeof(LogLine) + head.line.buffer_length,
+                       ThreadLogBuffer::kAlignment);
+      head.buffer->read_position.store(head.read_position,
+                                       std::memory_order_release);
+      if (head.read_position == head.write_position) {
+        heads.erase(head_it);
+      } else {
+        head.buffer->CopyOut(head.read_position, &head.line, sizeof(LogLine));
+      }
+    }
+    return line_count;
+  }
 
-      if (read_count) {
-        // Advance by the number of blocks we read.
-        auto read_range = dp::sequence_range(next_sequence, read_count);
-        next_sequence = read_range.end();
-        last_sequence = read_range.last();
-        consumed_.publish(last_sequence);
-
-        desired_count = 1;
+  void WriteThread() {
+    std::vector<std::shared_ptr<ThreadLogBuffer>> buffers;
+    size_t idle_loops = 0;
+    while (true) {
+      // Checked before draining so that all lines appended before the
+      // termination are written.
+      bool terminate = terminate_.load(std::memory_order_acquire);
+      {
+        std::lock_guard<std::mutex> lock(thread_buffers_mutex_);
+        // Drop the buffers of exited threads that have been drained.
+        thread_buffers_.erase(
+            std::remove_if(
+                thread_buffers_.begin(), thread_buffers_.end(),
+                [](const std::shared_ptr<ThreadLogBuffer>& buffer) {
+                  return buffer->abandoned.load(std::memory_order_acquire) &&
+                         buffer->read_position.load(
+                             std::memory_order_relaxed) ==
+                             buffer->write_position.load(
+                                 std::memory_order_acquire);
+                }),
+            thread_buffers_.end());
+        buffers = thread_buffers_;
+      }
 
+      if (WriteAvailableLines(buffers)) {
         if (cvars::flush_log) {
           for (const auto& sink : sinks_) {
             sink->Flush();
           }
         }
-
         idle_loops = 0;
+      } else if (terminate) {
+        break;
+      } else if (idle_loops >= kIdleLoopsBeforeSleep) {
+        // Introduce a waiting period.
+        xe::threading::Sleep(std::chrono::milliseconds(50));
       } else {
-        if (idle_loops >= 1000) {
-          // Introduce a waiting period.
-          xe::threading::Sleep(std::chrono::milliseconds(50));
-        } else {
-          idle_loops++;
-        }
+        idle_loops++;
       }
     }
+    for (const auto& sink : sinks_) {
+      sink->Flush();
+    }
   }
 
  public:
   void AppendLine(uint32_t thread_id, const char prefix_char,
-                  const char* buffer_data, size_t buffer_length,
-                  bool terminate = false) {
-    size_t count = BlockCount(sizeof(LogLine) + buffer_length);
-
-    auto range = claim_strategy_.claim(count);
-    assert_true(range.size() == count);
-
-    RingBuffer rb(buffer_, kBufferSize);
-    rb.set_write_offset(BlockOffset(range.first()));
-    rb.set_read_offset(BlockOffset(range.end()));
+                  const char* buffer_data, size_t buffer_length) {
+    ThreadLogBuffer& buffer = GetThreadBuffer();
+    // Lines longer than the whole buffer are truncated.
+    buffer_length =
+        std::min(buffer_length, ThreadLogBuffer::kSize - sizeof(LogLine));
+    size_t record_size = xe::round_up(sizeof(LogLine) + buffer_length,
+                                      ThreadLogBuffer::kAlignment);
+
+    // Only this thread writes to the buffer, wait for the writer thread to
+    // free enough space if needed.
+    size_t write_position =
+        buffer.write_position.load(std::memory_order_relaxed);
+    while (ThreadLogBuffer::kSize -
+               (write_position -
+                buffer.read_position.load(std::memory_order_acquire)) <
+           record_size) {
+      xe::threading::MaybeYield();
+    }
 
     LogLine line = {};
-    line.buffer_length = buffer_length;
+    line.sequence = next_sequence_.fetch_add(1, std::memory_order_relaxed);
+    line.buffer_length = uint32_t(buffer_length);
     line.thread_id = thread_id;
     line.prefix_char = prefix_char;
-    line.terminate = terminate;
-
-    rb.Write(&line, sizeof(LogLine));
+    buffer.CopyIn(write_position, &line, sizeof(LogLine));
     if (buffer_length) {
-      rb.Write(buffer_data, buffer_length);
+      buffer.CopyIn(write_position + sizeof(LogLine), buffer_data,
+                    buffer_length);
     }
-
-    claim_strategy_.publish(range);
+    buffer.write_position.store(write_position + record_size,
+                                std::memory_order_release);
   }
 };
 
@@ -59,6 +59,11 @@ class MappedMemory {
   // Changes the offset inside the file. This will update data() and size()!
   virtual bool Remap(size_t offset, size_t length) { return false; }
 
+  // Asynchronously starts loading the range into the memory, so the later
+  // accesses will not cause synchronous page faults. This is only a hint, and
+  // it may be ignored.
+  void Prefetch(size_t offset, size_t length);
+
  protected:
   void* data_;
   size_t size_;
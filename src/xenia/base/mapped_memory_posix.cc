@@ -13,9 +13,11 @@
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <algorithm>
 #include <memory>
 
 #include "xenia/base/filesystem.h"
+#include "xenia/base/memory.h"
 #include "xenia/base/platform.h"
 
 namespace xe {
@@ -58,7 +60,7 @@ class PosixMappedMemory : public MappedMemory {
 
     void* data =
         mmap(0, map_length, protection, MAP_SHARED, file_descriptor, offset);
-    if (!data) {
+    if (data == MAP_FAILED) {
       close(file_descriptor);
       return nullptr;
     }
@@ -107,6 +109,19 @@ std::unique_ptr<MappedMemory> MappedMemory::Open(
                                                length);
 }
 
+void MappedMemory::Prefetch(size_t offset, size_t length) {
+  if (offset >= size_ || !length) {
+    return;
+  }
+  length = std::min(length, size_ - offset);
+  // madvise requires the address to be page-aligned.
+  uintptr_t address = reinterpret_cast<uintptr_t>(data()) + offset;
+  uintptr_t aligned_address =
+      address & ~uintptr_t(xe::memory::page_size() - 1);
+  madvise(reinterpret_cast<void*>(aligned_address),
+          length + (address - aligned_address), MADV_WILLNEED);
+}
+
 #if XE_PLATFORM_ANDROID
 std::unique_ptr<MappedMemory> MappedMemory::OpenForAndroidContentUri(
     const std::string_view uri, Mode mode, size_t offset, size_t length) {
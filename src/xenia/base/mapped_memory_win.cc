@@ -7,6 +7,7 @@
  ******************************************************************************
  */
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -111,7 +112,9 @@ std::unique_ptr<MappedMemory> MappedMemory::Open(
   switch (mode) {
     case Mode::kRead:
       file_access |= GENERIC_READ;
-      file_share |= FILE_SHARE_READ;
+      // Other processes may append to files mapped for reading, such as shared
+      // caches.
+      file_share |= FILE_SHARE_READ | FILE_SHARE_WRITE;
       create_mode |= OPEN_EXISTING;
       mapping_protect |= PAGE_READONLY;
       view_access |= FILE_MAP_READ;
@@ -179,6 +182,29 @@ std::unique_ptr<MappedMemory> MappedMemory::Open(
   return std::move(mm);
 }
 
+void MappedMemory::Prefetch(size_t offset, size_t length) {
+  if (offset >= size_ || !length) {
+    return;
+  }
+  // PrefetchVirtualMemory is available only since Windows 8.
+  typedef BOOL(WINAPI * PrefetchVirtualMemoryFn)(
+      HANDLE hProcess, ULONG_PTR NumberOfEntries,
+      PWIN32_MEMORY_RANGE_ENTRY VirtualAddresses, ULONG Flags);
+  static const PrefetchVirtualMemoryFn prefetch_virtual_memory = []() {
+    HMODULE kernel = GetModuleHandleW(L"kernel32.dll");
+    return kernel ? PrefetchVirtualMemoryFn(GetProcAddress(
+                        kernel, "PrefetchVirtualMemory"))
+                  : nullptr;
+  }();
+  if (!prefetch_virtual_memory) {
+    return;
+  }
+  WIN32_MEMORY_RANGE_ENTRY range;
+  range.VirtualAddress = data() + offset;
+  range.NumberOfBytes = std::min(length, size_ - offset);
+  prefetch_virtual_memory(GetCurrentProcess(), 1, &range, 0);
+}
+
 class Win32ChunkedMappedMemoryWriter : public ChunkedMappedMemoryWriter {
  public:
   Win32ChunkedMappedMemoryWriter(const std::filesystem::path& path,
@@ -9,12 +9,17 @@
 
 #include "xenia/base/memory.h"
 #include "xenia/base/cvar.h"
+#include "xenia/base/math.h"
 #include "xenia/base/platform.h"
 
 #if XE_ARCH_ARM64
 #include <arm_neon.h>
 #endif
 
+#if XE_ARCH_AMD64 && !XE_PLATFORM_WIN32
+#include <cpuid.h>
+#endif
+
 #include <algorithm>
 
 DEFINE_bool(
@@ -33,7 +38,6 @@ bool IsWritableExecutableMemoryPreferred() {
 
 }  // namespace memory
 
-// TODO(benvanik): fancy AVX versions.
 // https://github.com/gnuradio/volk/blob/master/kernels/volk/volk_16u_byteswap.h
 // https://github.com/gnuradio/volk/blob/master/kernels/volk/volk_32u_byteswap.h
 // https://github.com/gnuradio/volk/blob/master/kernels/volk/volk_64u_byteswap.h
@@ -48,6 +52,228 @@ void copy_128_aligned(void* dest, const void* src, size_t count) {
 
 #if XE_ARCH_AMD64
 
+// The build targets AVX, so AVX2 and AVX-512 kernels are compiled for their
+// instruction sets individually and only called if the host supports them.
+#if XE_COMPILER_MSVC
+#define XE_TARGET_AVX2
+#define XE_TARGET_AVX512
+#else
+#define XE_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#define XE_TARGET_AVX512 \
+  __attribute__((target("avx2,avx512f,avx512bw,popcnt")))
+#endif
+
+namespace {
+
+enum class VectorWidth : uint32_t {
+  k128,
+  k256,
+  k512,
+};
+
+void QueryCpuid(uint32_t leaf, uint32_t regs_out[4]) {
+#if XE_PLATFORM_WIN32
+  __cpuidex(reinterpret_cast<int*>(regs_out), int(leaf), 0);
+#else
+  __cpuid_count(leaf, 0, regs_out[0], regs_out[1], regs_out[2], regs_out[3]);
+#endif
+}
+
+uint64_t QueryXcr0() {
+#if XE_PLATFORM_WIN32
+  return _xgetbv(0);
+#else
+  uint32_t eax, edx;
+  __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (uint64_t(edx) << 32) | eax;
+#endif
+}
+
+VectorWidth DetectVectorWidth() {
+  uint32_t regs[4];
+  QueryCpuid(0, regs);
+  if (regs[0] < 7) {
+    return VectorWidth::k128;
+  }
+  // OSXSAVE and POPCNT.
+  const uint32_t leaf1_ecx_mask = (uint32_t(1) << 27) | (uint32_t(1) << 23);
+  QueryCpuid(1, regs);
+  if ((regs[2] & leaf1_ecx_mask) != leaf1_ecx_mask) {
+    return VectorWidth::k128;
+  }
+  uint64_t xcr0 = QueryXcr0();
+  QueryCpuid(7, regs);
+  // XMM and YMM state, AVX2.
+  if ((xcr0 & 0x6) != 0x6 || !(regs[1] & (uint32_t(1) << 5))) {
+    return VectorWidth::k128;
+  }
+  // Opmask and ZMM state, AVX-512F and AVX-512BW.
+  const uint32_t leaf7_ebx_avx512_mask =
+      (uint32_t(1) << 16) | (uint32_t(1) << 30);
+  if ((xcr0 & 0xE6) == 0xE6 &&
+      (regs[1] & leaf7_ebx_avx512_mask) == leaf7_ebx_avx512_mask) {
+    return VectorWidth::k512;
+  }
+  return VectorWidth::k256;
+}
+
+// Zero (128-bit) before dynamic initialization, in case the functions here are
+// called during static initialization of other translation units.
+const VectorWidth host_vector_width = DetectVectorWidth();
+
+// The shuffle_bytes functions apply a 128-bit shuffle to each 128-bit lane of
+// the beginning of the buffers and return how many bytes have been processed,
+// for the caller to continue with 128-bit vectors and the residual elements.
+
+XE_TARGET_AVX2 size_t shuffle_bytes_avx2(uint8_t* dest, const uint8_t* src,
+                                         size_t size, __m128i shufmask) {
+  __m256i shufmask_256 = _mm256_broadcastsi128_si256(shufmask);
+  size_t i;
+  for (i = 0; i + 32 <= size; i += 32) {
+    __m256i input =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i]));
+    __m256i output = _mm256_shuffle_epi8(input, shufmask_256);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dest[i]), output);
+  }
+  return i;
+}
+
+XE_TARGET_AVX512 size_t shuffle_bytes_avx512(uint8_t* dest, const uint8_t* src,
+                                             size_t size, __m128i shufmask) {
+  __m512i shufmask_512 = _mm512_broadcast_i32x4(shufmask);
+  size_t i;
+  for (i = 0; i + 64 <= size; i += 64) {
+    __m512i input = _mm512_loadu_si512(&src[i]);
+    __m512i output = _mm512_shuffle_epi8(input, shufmask_512);
+    _mm512_storeu_si512(&dest[i], output);
+  }
+  return i;
+}
+
+size_t shuffle_bytes_wide(void* dest_ptr, const void* src_ptr, size_t size,
+                          __m128i shufmask) {
+  auto dest = reinterpret_cast<uint8_t*>(dest_ptr);
+  auto src = reinterpret_cast<const uint8_t*>(src_ptr);
+  switch (host_vector_width) {
+    case VectorWidth::k512:
+      return shuffle_bytes_avx512(dest, src, size, shufmask);
+    case VectorWidth::k256:
+      return shuffle_bytes_avx2(dest, src, size, shufmask);
+    default:
+      return 0;
+  }
+}
+
+// The functions below also return how many elements have been processed, for
+// the caller to handle the rest with scalar code.
+
+XE_TARGET_AVX2 size_t count_equal_bytes_avx2(const uint8_t* a,
+                                             const uint8_t* b, size_t size,
+                                             size_t& count) {
+  size_t i;
+  for (i = 0; i + 32 <= size; i += 32) {
+    __m256i equal = _mm256_cmpeq_epi8(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&a[i])),
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&b[i])));
+    count += xe::bit_count(uint32_t(_mm256_movemask_epi8(equal)));
+  }
+  return i;
+}
+
+XE_TARGET_AVX512 size_t count_equal_bytes_avx512(const uint8_t* a,
+                                                 const uint8_t* b, size_t size,
+                                                 size_t& count) {
+  size_t i;
+  for (i = 0; i + 64 <= size; i += 64) {
+    __mmask64 equal = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(&a[i]),
+                                             _mm512_loadu_si512(&b[i]));
+    count += xe::bit_count(uint64_t(equal));
+  }
+  return i;
+}
+
+XE_TARGET_AVX2 size_t count_equal_32_avx2(const uint32_t* p, uint32_t value,
+                                          size_t n, size_t& count) {
+  __m256i value_256 = _mm256_set1_epi32(int(value));
+  size_t i;
+  for (i = 0; i + 8 <= n; i += 8) {
+    __m256i equal = _mm256_cmpeq_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&p[i])),
+        value_256);
+    count += xe::bit_count(
+        uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(equal))));
+  }
+  return i;
+}
+
+XE_TARGET_AVX512 size_t count_equal_32_avx512(const uint32_t* p,
+                                              uint32_t value, size_t n,
+                                              size_t& count) {
+  __m512i value_512 = _mm512_set1_epi32(int(value));
+  size_t i;
+  for (i = 0; i + 16 <= n; i += 16) {
+    __mmask16 equal = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(&p[i]),
+                                              value_512);
+    count += xe::bit_count(uint32_t(equal));
+  }
+  return i;
+}
+
+XE_TARGET_AVX2 size_t fill_32_avx2(uint32_t* p, uint32_t value, size_t n) {
+  __m256i value_256 = _mm256_set1_epi32(int(value));
+  size_t i;
+  for (i = 0; i + 8 <= n; i += 8) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&p[i]), value_256);
+  }
+  return i;
+}
+
+XE_TARGET_AVX512 size_t fill_32_avx512(uint32_t* p, uint32_t value,
+                                       size_t n) {
+  __m512i value_512 = _mm512_set1_epi32(int(value));
+  size_t i;
+  for (i = 0; i + 16 <= n; i += 16) {
+    _mm512_storeu_si512(&p[i], value_512);
+  }
+  return i;
+}
+
+// If there's a match, return its index with found_out set to true.
+XE_TARGET_AVX2 size_t find_32_avx2(const uint32_t* p, uint32_t value,
+                                   size_t n, bool& found_out) {
+  __m256i value_256 = _mm256_set1_epi32(int(value));
+  size_t i;
+  for (i = 0; i + 8 <= n; i += 8) {
+    __m256i equal = _mm256_cmpeq_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&p[i])),
+        value_256);
+    uint32_t equal_mask =
+        uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(equal)));
+    if (equal_mask) {
+      found_out = true;
+      return i + xe::tzcnt(equal_mask);
+    }
+  }
+  return i;
+}
+
+XE_TARGET_AVX512 size_t find_32_avx512(const uint32_t* p, uint32_t value,
+                                       size_t n, bool& found_out) {
+  __m512i value_512 = _mm512_set1_epi32(int(value));
+  size_t i;
+  for (i = 0; i + 16 <= n; i += 16) {
+    __mmask16 equal =
+        _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(&p[i]), value_512);
+    if (equal) {
+      found_out = true;
+      return i + xe::tzcnt(uint32_t(equal));
+    }
+  }
+  return i;
+}
+
+}  // namespace
+
 // This works around a GCC bug
 // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=100801
 // TODO(Joel Linn): Remove this when fixed GCC versions are common place.
@@ -68,8 +294,8 @@ void copy_and_swap_16_aligned(void* dest_ptr, const void* src_ptr,
       _mm_set_epi8(0x0E, 0x0F, 0x0C, 0x0D, 0x0A, 0x0B, 0x08, 0x09, 0x06, 0x07,
                    0x04, 0x05, 0x02, 0x03, 0x00, 0x01);
 
-  size_t i = 0;
-  for (i = 0; i + 8 <= count; i += 8) {
+  size_t i = shuffle_bytes_wide(dest, src, count * 2, shufmask) / 2;
+  for (; i + 8 <= count; i += 8) {
     __m128i input = _mm_load_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output = _mm_shuffle_epi8(input, shufmask);
     _mm_store_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
@@ -88,8 +314,8 @@ void copy_and_swap_16_unaligned(void* dest_ptr, const void* src_ptr,
       _mm_set_epi8(0x0E, 0x0F, 0x0C, 0x0D, 0x0A, 0x0B, 0x08, 0x09, 0x06, 0x07,
                    0x04, 0x05, 0x02, 0x03, 0x00, 0x01);
 
-  size_t i;
-  for (i = 0; i + 8 <= count; i += 8) {
+  size_t i = shuffle_bytes_wide(dest, src, count * 2, shufmask) / 2;
+  for (; i + 8 <= count; i += 8) {
     __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output = _mm_shuffle_epi8(input, shufmask);
     _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
@@ -111,8 +337,8 @@ void copy_and_swap_32_aligned(void* dest_ptr, const void* src_ptr,
       _mm_set_epi8(0x0C, 0x0D, 0x0E, 0x0F, 0x08, 0x09, 0x0A, 0x0B, 0x04, 0x05,
                    0x06, 0x07, 0x00, 0x01, 0x02, 0x03);
 
-  size_t i;
-  for (i = 0; i + 4 <= count; i += 4) {
+  size_t i = shuffle_bytes_wide(dest, src, count * 4, shufmask) / 4;
+  for (; i + 4 <= count; i += 4) {
     __m128i input = _mm_load_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output = _mm_shuffle_epi8(input, shufmask);
     _mm_store_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
@@ -131,8 +357,8 @@ void copy_and_swap_32_unaligned(void* dest_ptr, const void* src_ptr,
       _mm_set_epi8(0x0C, 0x0D, 0x0E, 0x0F, 0x08, 0x09, 0x0A, 0x0B, 0x04, 0x05,
                    0x06, 0x07, 0x00, 0x01, 0x02, 0x03);
 
-  size_t i;
-  for (i = 0; i + 4 <= count; i += 4) {
+  size_t i = shuffle_bytes_wide(dest, src, count * 4, shufmask) / 4;
+  for (; i + 4 <= count; i += 4) {
     __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output = _mm_shuffle_epi8(input, shufmask);
     _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
@@ -154,8 +380,8 @@ void copy_and_swap_64_aligned(void* dest_ptr, const void* src_ptr,
       _mm_set_epi8(0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01,
                    0x02, 0x03, 0x04, 0x05, 0x06, 0x07);
 
-  size_t i;
-  for (i = 0; i + 2 <= count; i += 2) {
+  size_t i = shuffle_bytes_wide(dest, src, count * 8, shufmask) / 8;
+  for (; i + 2 <= count; i += 2) {
     __m128i input = _mm_load_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output = _mm_shuffle_epi8(input, shufmask);
     _mm_store_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
@@ -174,8 +400,8 @@ void copy_and_swap_64_unaligned(void* dest_ptr, const void* src_ptr,
       _mm_set_epi8(0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01,
                    0x02, 0x03, 0x04, 0x05, 0x06, 0x07);
 
-  size_t i;
-  for (i = 0; i + 2 <= count; i += 2) {
+  size_t i = shuffle_bytes_wide(dest, src, count * 8, shufmask) / 8;
+  for (; i + 2 <= count; i += 2) {
     __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output = _mm_shuffle_epi8(input, shufmask);
     _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
@@ -190,8 +416,12 @@ void copy_and_swap_16_in_32_aligned(void* dest_ptr, const void* src_ptr,
                                     size_t count) {
   auto dest = reinterpret_cast<uint32_t*>(dest_ptr);
   auto src = reinterpret_cast<const uint32_t*>(src_ptr);
-  size_t i;
-  for (i = 0; i + 4 <= count; i += 4) {
+  __m128i shufmask =
+      _mm_set_epi8(0x0D, 0x0C, 0x0F, 0x0E, 0x09, 0x08, 0x0B, 0x0A, 0x05, 0x04,
+                   0x07, 0x06, 0x01, 0x00, 0x03, 0x02);
+
+  size_t i = shuffle_bytes_wide(dest, src, count * 4, shufmask) / 4;
+  for (; i + 4 <= count; i += 4) {
     __m128i input = _mm_load_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output =
         _mm_or_si128(_mm_slli_epi32(input, 16), _mm_srli_epi32(input, 16));
@@ -207,8 +437,12 @@ void copy_and_swap_16_in_32_unaligned(void* dest_ptr, const void* src_ptr,
                                       size_t count) {
   auto dest = reinterpret_cast<uint32_t*>(dest_ptr);
   auto src = reinterpret_cast<const uint32_t*>(src_ptr);
-  size_t i;
-  for (i = 0; i + 4 <= count; i += 4) {
+  __m128i shufmask =
+      _mm_set_epi8(0x0D, 0x0C, 0x0F, 0x0E, 0x09, 0x08, 0x0B, 0x0A, 0x05, 0x04,
+                   0x07, 0x06, 0x01, 0x00, 0x03, 0x02);
+
+  size_t i = shuffle_bytes_wide(dest, src, count * 4, shufmask) / 4;
+  for (; i + 4 <= count; i += 4) {
     __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
     __m128i output =
         _mm_or_si128(_mm_slli_epi32(input, 16), _mm_srli_epi32(input, 16));
@@ -406,4 +640,114 @@ void copy_and_swap_16_in_32_unaligned(void* dst_ptr, const void* src_ptr,
 
 #endif
 
+size_t count_equal_bytes(const void* a_ptr, const void* b_ptr, size_t size) {
+  auto a = reinterpret_cast<const uint8_t*>(a_ptr);
+  auto b = reinterpret_cast<const uint8_t*>(b_ptr);
+  size_t count = 0;
+  size_t i = 0;
+#if XE_ARCH_AMD64
+  if (host_vector_width == VectorWidth::k512) {
+    i = count_equal_bytes_avx512(a, b, size, count);
+  } else if (host_vector_width == VectorWidth::k256) {
+    i = count_equal_bytes_avx2(a, b, size, count);
+  }
+#endif
+  for (; i < size; ++i) {
+    if (a[i] == b[i]) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+size_t count_equal_32(const void* ptr, uint32_t value, size_t count) {
+  auto p = reinterpret_cast<const uint32_t*>(ptr);
+  size_t equal_count = 0;
+  size_t i = 0;
+#if XE_ARCH_AMD64
+  if (host_vector_width == VectorWidth::k512) {
+    i = count_equal_32_avx512(p, value, count, equal_count);
+  } else if (host_vector_width == VectorWidth::k256) {
+    i = count_equal_32_avx2(p, value, count, equal_count);
+  }
+#endif
+  for (; i < count; ++i) {
+    if (p[i] == value) {
+      ++equal_count;
+    }
+  }
+  return equal_count;
+}
+
+void fill_32(void* dest, uint32_t value, size_t count) {
+  auto p = reinterpret_cast<uint32_t*>(dest);
+  size_t i = 0;
+#if XE_ARCH_AMD64
+  if (host_vector_width == VectorWidth::k512) {
+    i = fill_32_avx512(p, value, count);
+  } else if (host_vector_width == VectorWidth::k256) {
+    i = fill_32_avx2(p, value, count);
+  }
+#endif
+  for (; i < count; ++i) {
+    p[i] = value;
+  }
+}
+
+void copy_non_temporal(void* dest, const void* src, size_t size) {
+  auto d = reinterpret_cast<uint8_t*>(dest);
+  auto s = reinterpret_cast<const uint8_t*>(src);
+#if XE_ARCH_AMD64
+  // Non-temporal stores require 16-byte alignment of the destination.
+  size_t head =
+      std::min(size, size_t(-reinterpret_cast<intptr_t>(d) & 15));
+  std::memcpy(d, s, head);
+  d += head;
+  s += head;
+  size -= head;
+  size_t body = size & ~size_t(63);
+  for (size_t i = 0; i < body; i += 64) {
+    auto src_vectors = reinterpret_cast<const __m128i*>(s + i);
+    auto dest_vectors = reinterpret_cast<__m128i*>(d + i);
+    __m128i v0 = _mm_loadu_si128(src_vectors);
+    __m128i v1 = _mm_loadu_si128(src_vectors + 1);
+    __m128i v2 = _mm_loadu_si128(src_vectors + 2);
+    __m128i v3 = _mm_loadu_si128(src_vectors + 3);
+    _mm_stream_si128(dest_vectors, v0);
+    _mm_stream_si128(dest_vectors + 1, v1);
+    _mm_stream_si128(dest_vectors + 2, v2);
+    _mm_stream_si128(dest_vectors + 3, v3);
+  }
+  // Order the non-temporal stores before the subsequent ones.
+  _mm_sfence();
+  d += body;
+  s += body;
+  size -= body;
+#endif
+  std::memcpy(d, s, size);
+}
+
+const uint32_t* find_32(const uint32_t* begin, const uint32_t* end,
+                        uint32_t value) {
+  size_t count = size_t(end - begin);
+  size_t i = 0;
+#if XE_ARCH_AMD64
+  bool found = false;
+  if (host_vector_width == VectorWidth::k512) {
+    i = find_32_avx512(begin, value, count, found);
+  } else if (host_vector_width == VectorWidth::k256) {
+    i = find_32_avx2(begin, value, count, found);
+  }
+  if (found) {
+    return begin + i;
+  }
+#endif
+  for (; i < count; ++i) {
+    if (begin[i] == value) {
+      return begin + i;
+    }
+  }
+  return end;
+}
+
 }  // namespace xe
@@ -16,6 +16,8 @@
 #include <functional>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "xenia/base/assert.h"
 #include "xenia/base/byte_order.h"
@@ -89,6 +91,35 @@ bool Protect(void* base_address, size_t length, PageAccess access,
 // the region.
 bool QueryProtect(void* base_address, size_t& length, PageAccess& access_out);
 
+// Requests backing a mapped page-aligned range with large pages (2 MB on x86)
+// to reduce TLB misses, as transparent huge pages on Linux. Changing the
+// protection of a part of a large page splits it into normal pages. Returns
+// false if not supported by the host.
+bool AdviseLargePages(void* base_address, size_t length);
+
+// Requests allocating the pages of a mapped page-aligned range that haven't
+// been accessed yet from the memory of a NUMA node, moving the existing pages
+// to it if possible, falling back to other nodes if the node is out of memory.
+// Returns false if not supported by the host.
+bool BindToNumaNode(void* base_address, size_t length, uint32_t node);
+// Replaces the contents of bytes_out with the numbers of bytes of the pages of
+// the mappings starting within a range resident in the memory of each NUMA
+// node, indexed by the node. Returns false if not supported by the host.
+bool GetNumaNodeResidentBytes(void* base_address, size_t length,
+                              std::vector<uint64_t>& bytes_out);
+
+// Starts tracking writes to the pages of a mapped page-aligned range by the
+// host, without access violations, initially considering all pages not written
+// to. Returns false if not supported by the host - requires userfaultfd
+// asynchronous write protection and PAGEMAP_SCAN on Linux (6.7+).
+bool EnableWriteTracking(void* base_address, size_t length);
+// Appends the host address ranges (start, length) of the pages within a range
+// with write tracking enabled that have been written to since it was enabled or
+// since the previous call, considering them not written to again.
+bool GetAndResetWrittenRanges(
+    void* base_address, size_t length,
+    std::vector<std::pair<void*, size_t>>& ranges_out);
+
 // Allocates a block of memory for a type with the given alignment.
 // The memory must be freed with AlignedFree.
 template <typename T>
@@ -162,6 +193,21 @@ void copy_and_swap_16_in_32_aligned(void* dest, const void* src, size_t count);
 void copy_and_swap_16_in_32_unaligned(void* dest, const void* src,
                                       size_t count);
 
+// Number of bytes equal to the bytes at the same offsets in the other buffer.
+size_t count_equal_bytes(const void* a, const void* b, size_t size);
+// Number of 32-bit values equal to the value, compared as they're stored in
+// memory, without swapping.
+size_t count_equal_32(const void* ptr, uint32_t value, size_t count);
+// Stores the 32-bit value as is, without swapping.
+void fill_32(void* dest, uint32_t value, size_t count);
+// Copies with non-temporal stores where supported, so the destination doesn't
+// evict the contents of the host caches, for large copies that aren't read
+// back soon. The ranges must not overlap.
+void copy_non_temporal(void* dest, const void* src, size_t size);
+// Returns end if there are no values equal to the value in [begin, end).
+const uint32_t* find_32(const uint32_t* begin, const uint32_t* end,
+                        uint32_t value);
+
 template <typename T>
 void copy_and_swap(T* dest, const T* src, size_t count) {
   bool is_aligned = reinterpret_cast<uintptr_t>(dest) % 32 == 0 &&
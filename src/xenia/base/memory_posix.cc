@@ -13,6 +13,10 @@
 #include <sys/mman.h>
 #include <unistd.h>
 #include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
 
 #include "xenia/base/math.h"
 #include "xenia/base/platform.h"
@@ -27,6 +31,18 @@
 #include "xenia/base/main_android.h"
 #endif
 
+#if XE_PLATFORM_LINUX
+#include <linux/fs.h>
+#include <linux/mempolicy.h>
+#include <linux/userfaultfd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+// Uses the write tracking added in Linux 6.7 if the headers have it.
+#if defined(PAGEMAP_SCAN) && defined(UFFD_FEATURE_WP_ASYNC)
+#define XE_MEMORY_WRITE_TRACKING_UFFD 1
+#endif
+#endif
+
 namespace xe {
 namespace memory {
 
@@ -112,6 +128,201 @@ bool QueryProtect(void* base_address, size_t& length, PageAccess& access_out) {
   return false;
 }
 
+bool AdviseLargePages(void* base_address, size_t length) {
+#ifdef MADV_HUGEPAGE
+  // Works with transparent huge pages enabled in the "always" or "madvise"
+  // mode, otherwise the range just keeps using normal pages.
+  return madvise(base_address, length, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
+bool BindToNumaNode(void* base_address, size_t length, uint32_t node) {
+#if XE_PLATFORM_LINUX && defined(SYS_mbind)
+  if (node >= 64) {
+    return false;
+  }
+  // Preferring the node rather than binding to it so the allocations don't
+  // fail, and the guest isn't killed, if the node is out of memory.
+  unsigned long node_mask = 1ul << node;
+  return syscall(SYS_mbind, base_address, length, MPOL_PREFERRED, &node_mask,
+                 sizeof(node_mask) * 8 + 1, MPOL_MF_MOVE) == 0;
+#else
+  return false;
+#endif
+}
+
+bool GetNumaNodeResidentBytes(void* base_address, size_t length,
+                              std::vector<uint64_t>& bytes_out) {
+  bytes_out.clear();
+#if XE_PLATFORM_LINUX
+  FILE* numa_maps = fopen("/proc/self/numa_maps", "r");
+  if (!numa_maps) {
+    return false;
+  }
+  uintptr_t range_start = reinterpret_cast<uintptr_t>(base_address);
+  uintptr_t range_end = range_start + length;
+  // Each line is the start address of a mapping, its policy, and properties
+  // including the page counts on the nodes (N<node>=<pages>) and the size of
+  // the pages (kernelpagesize_kB=<size>).
+  char line[4096];
+  std::vector<uint64_t> line_pages;
+  while (fgets(line, sizeof(line), numa_maps)) {
+    char* position;
+    uintptr_t mapping_start = uintptr_t(std::strtoull(line, &position, 16));
+    if (position == line || mapping_start < range_start ||
+        mapping_start >= range_end) {
+      continue;
+    }
+    line_pages.clear();
+    uint64_t page_size = 4096;
+    while (*position) {
+      while (*position == ' ') {
+        ++position;
+      }
+      if (*position == 'N' && position[1] >= '0' && position[1] <= '9') {
+        char* end;
+        unsigned long node = std::strtoul(position + 1, &end, 10);
+        if (*end == '=' && node < 64) {
+          if (line_pages.size() <= node) {
+            line_pages.resize(node + 1);
+          }
+          line_pages[node] += std::strtoull(end + 1, &end, 10);
+        }
+        position = end;
+      } else if (!std::strncmp(position, "kernelpagesize_kB=", 18)) {
+        page_size = uint64_t(std::strtoull(position + 18, &position, 10)) *
+                    1024;
+      }
+      while (*position && *position != ' ') {
+        ++position;
+      }
+    }
+    if (bytes_out.size() < line_pages.size()) {
+      bytes_out.resize(line_pages.size());
+    }
+    for (size_t i = 0; i < line_pages.size(); ++i) {
+      bytes_out[i] += line_pages[i] * page_size;
+    }
+  }
+  fclose(numa_maps);
+  return true;
+#else
+  return false;
+#endif
+}
+
+#if XE_MEMORY_WRITE_TRACKING_UFFD
+// With asynchronous write protection, writes to the protected pages are
+// resolved by the kernel without notifying the userfaultfd, and PAGEMAP_SCAN
+// returns the pages written to since and protects them again atomically.
+static std::mutex write_tracking_mutex_;
+static bool write_tracking_initialized_ = false;
+static int write_tracking_uffd_ = -1;
+static int write_tracking_pagemap_ = -1;
+
+static bool InitializeWriteTracking() {
+  if (write_tracking_initialized_) {
+    return write_tracking_pagemap_ >= 0;
+  }
+  write_tracking_initialized_ = true;
+  int uffd = int(syscall(SYS_userfaultfd,
+                         O_CLOEXEC | O_NONBLOCK | UFFD_USER_MODE_ONLY));
+  if (uffd < 0) {
+    return false;
+  }
+  uffdio_api api = {};
+  api.api = UFFD_API;
+  api.features = UFFD_FEATURE_WP_ASYNC | UFFD_FEATURE_WP_HUGETLBFS_SHMEM |
+                 UFFD_FEATURE_WP_UNPOPULATED;
+  if (ioctl(uffd, UFFDIO_API, &api) != 0) {
+    close(uffd);
+    return false;
+  }
+  int pagemap = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+  if (pagemap < 0) {
+    close(uffd);
+    return false;
+  }
+  write_tracking_uffd_ = uffd;
+  write_tracking_pagemap_ = pagemap;
+  return true;
+}
+#endif  // XE_MEMORY_WRITE_TRACKING_UFFD
+
+bool EnableWriteTracking(void* base_address, size_t length) {
+#if XE_MEMORY_WRITE_TRACKING_UFFD
+  std::lock_guard<std::mutex> lock(write_tracking_mutex_);
+  if (!InitializeWriteTracking()) {
+    return false;
+  }
+  uffdio_register uffd_register = {};
+  uffd_register.range.start = uint64_t(uintptr_t(base_address));
+  uffd_register.range.len = length;
+  uffd_register.mode = UFFDIO_REGISTER_MODE_WP;
+  if (ioctl(write_tracking_uffd_, UFFDIO_REGISTER, &uffd_register) != 0) {
+    return false;
+  }
+  uffdio_writeprotect writeprotect = {};
+  writeprotect.range = uffd_register.range;
+  writeprotect.mode = UFFDIO_WRITEPROTECT_MODE_WP;
+  if (ioctl(write_tracking_uffd_, UFFDIO_WRITEPROTECT, &writeprotect) != 0) {
+    ioctl(write_tracking_uffd_, UFFDIO_UNREGISTER, &uffd_register.range);
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif  // XE_MEMORY_WRITE_TRACKING_UFFD
+}
+
+bool GetAndResetWrittenRanges(
+    void* base_address, size_t length,
+    std::vector<std::pair<void*, size_t>>& ranges_out) {
+#if XE_MEMORY_WRITE_TRACKING_UFFD
+  int pagemap;
+  {
+    std::lock_guard<std::mutex> lock(write_tracking_mutex_);
+    pagemap = write_tracking_pagemap_;
+  }
+  if (pagemap < 0) {
+    return false;
+  }
+  page_region regions[64];
+  uint64_t start = uint64_t(uintptr_t(base_address));
+  uint64_t end = start + length;
+  while (start < end) {
+    pm_scan_arg scan = {};
+    scan.size = sizeof(scan);
+    scan.flags = PM_SCAN_WP_MATCHING | PM_SCAN_CHECK_WPASYNC;
+    scan.start = start;
+    scan.end = end;
+    scan.vec = uint64_t(uintptr_t(regions));
+    scan.vec_len = xe::countof(regions);
+    scan.category_mask = PAGE_IS_WRITTEN;
+    scan.return_mask = PAGE_IS_WRITTEN;
+    long region_count = ioctl(pagemap, PAGEMAP_SCAN, &scan);
+    if (region_count < 0) {
+      return false;
+    }
+    for (long i = 0; i < region_count; ++i) {
+      ranges_out.emplace_back(reinterpret_cast<void*>(regions[i].start),
+                              size_t(regions[i].end - regions[i].start));
+    }
+    // The scan stops early only when no more regions can be returned.
+    if (size_t(region_count) < xe::countof(regions) ||
+        scan.walk_end <= start) {
+      break;
+    }
+    start = scan.walk_end;
+  }
+  return true;
+#else
+  return false;
+#endif  // XE_MEMORY_WRITE_TRACKING_UFFD
+}
+
 FileMappingHandle CreateFileMappingHandle(const std::filesystem::path& path,
                                           size_t length, PageAccess access,
                                           bool commit) {
@@ -172,6 +172,37 @@ bool QueryProtect(void* base_address, size_t& length, PageAccess& access_out) {
   return true;
 }
 
+bool AdviseLargePages(void* base_address, size_t length) {
+  // Large pages on Windows require the whole section to be committed with
+  // SEC_LARGE_PAGES and the lock memory privilege, and can't be protected in
+  // parts, which the guest memory relies on.
+  return false;
+}
+
+bool BindToNumaNode(void* base_address, size_t length, uint32_t node) {
+  // The node of the views of a file mapping can only be specified when they
+  // are mapped. Without it, the pages are allocated from the node of the
+  // processor of the thread touching them first.
+  return false;
+}
+
+bool GetNumaNodeResidentBytes(void* base_address, size_t length,
+                              std::vector<uint64_t>& bytes_out) {
+  return false;
+}
+
+bool EnableWriteTracking(void* base_address, size_t length) {
+  // GetWriteWatch only works for allocations made with MEM_WRITE_WATCH, not
+  // for views of file mappings.
+  return false;
+}
+
+bool GetAndResetWrittenRanges(
+    void* base_address, size_t length,
+    std::vector<std::pair<void*, size_t>>& ranges_out) {
+  return false;
+}
+
 FileMappingHandle CreateFileMappingHandle(const std::filesystem::path& path,
                                           size_t length, PageAccess access,
                                           bool commit) {
@@ -9,6 +9,8 @@
 
 #include "xenia/base/mutex.h"
 
+#include "xenia/base/profiling.h"
+
 namespace xe {
 
 std::recursive_mutex& global_critical_region::mutex() {
@@ -16,4 +18,11 @@ std::recursive_mutex& global_critical_region::mutex() {
   return global_mutex;
 }
 
+#if XE_OPTION_PROFILING_TRACY
+void global_critical_region::LockMutexContended() {
+  SCOPE_profile_cpu_i("base", "global_critical_region contended");
+  mutex().lock();
+}
+#endif  // XE_OPTION_PROFILING_TRACY
+
 }  // namespace xe
@@ -56,17 +56,31 @@ class global_critical_region {
  public:
   static std::recursive_mutex& mutex();
 
+  // Locks the global critical section mutex without a std::unique_lock, for
+  // code managing the lock manually (such as the guest code entering the
+  // region). Must be unlocked with mutex().unlock().
+  static void LockMutex() {
+#if XE_OPTION_PROFILING_TRACY
+    if (!mutex().try_lock()) {
+      LockMutexContended();
+    }
+#else
+    mutex().lock();
+#endif  // XE_OPTION_PROFILING_TRACY
+  }
+
   // Acquires a lock on the global critical section.
   // Use this when keeping an instance is not possible. Otherwise, prefer
   // to keep an instance of global_critical_region near the members requiring
   // it to keep things readable.
   static std::unique_lock<std::recursive_mutex> AcquireDirect() {
-    return std::unique_lock<std::recursive_mutex>(mutex());
+    LockMutex();
+    return std::unique_lock<std::recursive_mutex>(mutex(), std::adopt_lock);
   }
 
   // Acquires a lock on the global critical section.
   inline std::unique_lock<std::recursive_mutex> Acquire() {
-    return std::unique_lock<std::recursive_mutex>(mutex());
+    return AcquireDirect();
   }
 
   // Acquires a deferred lock on the global critical section.
@@ -79,6 +93,13 @@ class global_critical_region {
   inline std::unique_lock<std::recursive_mutex> TryAcquire() {
     return std::unique_lock<std::recursive_mutex>(mutex(), std::try_to_lock);
   }
+
+ private:
+#if XE_OPTION_PROFILING_TRACY
+  // Waits for the region held by another thread, marking the wait in the
+  // profiler.
+  static void LockMutexContended();
+#endif  // XE_OPTION_PROFILING_TRACY
 };
 
 }  // namespace xe
@@ -8,6 +8,7 @@
  */
 
 #include <algorithm>
+#include <cstring>
 #include <string>
 
 // NOTE: this must be included before microprofile as macro expansion needs
@@ -41,9 +42,19 @@
 #include "xenia/ui/virtual_key.h"
 #include "xenia/ui/window.h"
 
-#if XE_OPTION_PROFILING
+#if XE_OPTION_PROFILING_MICROPROFILE
 #include "third_party/microprofile/microprofileui.h"
-#endif  // XE_OPTION_PROFILING
+#endif  // XE_OPTION_PROFILING_MICROPROFILE
+
+#if XE_OPTION_PROFILING_TRACY
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include "third_party/tracy/public/tracy/TracyC.h"
+#endif  // XE_OPTION_PROFILING_TRACY
 
 #if XE_OPTION_PROFILING_UI
 #include "xenia/ui/microprofile_drawer.h"
@@ -55,7 +66,7 @@ DEFINE_bool(show_profiler, false, "Show profiling UI by default.", "UI");
 
 namespace xe {
 
-#if XE_OPTION_PROFILING
+#if XE_OPTION_PROFILING_MICROPROFILE
 
 Profiler::ProfilerWindowInputListener Profiler::input_listener_;
 size_t Profiler::z_order_ = 0;
@@ -128,6 +139,22 @@ void Profiler::ThreadEnter(const char* name) {
 
 void Profiler::ThreadExit() { MicroProfileOnThreadExit(); }
 
+// MicroProfile only takes the name when the thread is activated.
+void Profiler::SetThreadName(const char* name) {}
+
+void Profiler::AddToCounter(const char* name, int64_t count) {
+  MicroProfileCounterAdd(MicroProfileGetCounterToken(name), count);
+}
+
+bool Profiler::are_gpu_timelines_supported() { return false; }
+uint8_t Profiler::CreateGpuTimeline(GpuTimelineType type, const char* name,
+                                    int64_t timestamp_now,
+                                    float timestamp_period_ns) {
+  return kGpuTimelineInvalid;
+}
+void Profiler::AddGpuZone(uint8_t timeline, const char* name,
+                          int64_t timestamp_begin, int64_t timestamp_end) {}
+
 void Profiler::ProfilerWindowInputListener::OnKeyDown(ui::KeyEvent& e) {
   // https://msdn.microsoft.com/en-us/library/windows/desktop/dd375731(v=vs.85).aspx
   bool handled = true;
@@ -331,6 +358,136 @@ void Profiler::PostInputEvent() {
   // Relying on continuous painting currently, no need to request drawing.
 }
 
+#elif XE_OPTION_PROFILING_TRACY
+
+namespace {
+// Values of tracy::GpuContextType.
+constexpr uint8_t kTracyGpuContextTypeVulkan = 2;
+constexpr uint8_t kTracyGpuContextTypeDirect3D12 = 4;
+
+std::atomic<uint32_t> tracy_gpu_timeline_count(0);
+// Accessed only by the thread adding the zones to each timeline.
+std::array<uint16_t, Profiler::kGpuTimelineInvalid>
+    tracy_gpu_timeline_next_query_ids = {};
+// The source locations are referenced by the zones until the end of the
+// capture.
+std::mutex tracy_source_locations_mutex;
+std::unordered_map<std::string_view, ___tracy_source_location_data>
+    tracy_source_locations;
+
+std::mutex tracy_counters_mutex;
+std::unordered_map<std::string_view, int64_t> tracy_counters;
+}  // namespace
+
+bool Profiler::is_enabled() { return true; }
+// Tracy is viewed in a separate application.
+bool Profiler::is_visible() { return false; }
+void Profiler::Initialize() {}
+void Profiler::Dump() {}
+void Profiler::Shutdown() {}
+
+uint32_t Profiler::GetColor(const char* str) {
+  std::hash<std::string> fn;
+  size_t value = fn(str);
+  return value & 0xFFFFFF;
+}
+
+void Profiler::ThreadEnter(const char* name) {
+  if (name) {
+    SetThreadName(name);
+  }
+}
+
+void Profiler::ThreadExit() {}
+
+void Profiler::SetThreadName(const char* name) { tracy::SetThreadName(name); }
+
+void Profiler::AddToCounter(const char* name, int64_t count) {
+  int64_t value;
+  {
+    std::lock_guard<std::mutex> lock(tracy_counters_mutex);
+    value = tracy_counters[name] += count;
+  }
+  TracyPlot(name, value);
+}
+
+bool Profiler::are_gpu_timelines_supported() { return true; }
+
+uint8_t Profiler::CreateGpuTimeline(GpuTimelineType type, const char* name,
+                                    int64_t timestamp_now,
+                                    float timestamp_period_ns) {
+  uint32_t timeline =
+      tracy_gpu_timeline_count.fetch_add(1, std::memory_order_relaxed);
+  if (timeline >= kGpuTimelineInvalid) {
+    return kGpuTimelineInvalid;
+  }
+  ___tracy_gpu_new_context_data new_context;
+  new_context.gpuTime = timestamp_now;
+  new_context.period = timestamp_period_ns;
+  new_context.context = uint8_t(timeline);
+  new_context.flags = 0;
+  new_context.type = type == GpuTimelineType::kD3D12
+                         ? kTracyGpuContextTypeDirect3D12
+                         : kTracyGpuContextTypeVulkan;
+  ___tracy_emit_gpu_new_context_serial(new_context);
+  ___tracy_gpu_context_name_data context_name;
+  context_name.context = uint8_t(timeline);
+  context_name.name = name;
+  context_name.len = uint16_t(std::strlen(name));
+  ___tracy_emit_gpu_context_name_serial(context_name);
+  return uint8_t(timeline);
+}
+
+void Profiler::AddGpuZone(uint8_t timeline, const char* name,
+                          int64_t timestamp_begin, int64_t timestamp_end) {
+  if (timeline >= kGpuTimelineInvalid) {
+    return;
+  }
+  const ___tracy_source_location_data* source_location;
+  {
+    std::lock_guard<std::mutex> lock(tracy_source_locations_mutex);
+    auto source_location_it = tracy_source_locations.find(name);
+    if (source_location_it == tracy_source_locations.end()) {
+      ___tracy_source_location_data new_source_location = {};
+      new_source_location.name = name;
+      new_source_location.function = name;
+      new_source_location.file = __FILE__;
+      new_source_location.line = __LINE__;
+      new_source_location.color = GetColor(name);
+      source_location_it =
+          tracy_source_locations.emplace(name, new_source_location).first;
+    }
+    source_location = &source_location_it->second;
+  }
+  uint16_t& next_query_id = tracy_gpu_timeline_next_query_ids[timeline];
+  uint16_t query_id_begin = next_query_id++;
+  uint16_t query_id_end = next_query_id++;
+  ___tracy_gpu_zone_begin_data zone_begin;
+  zone_begin.srcloc = uint64_t(source_location);
+  zone_begin.queryId = query_id_begin;
+  zone_begin.context = timeline;
+  ___tracy_emit_gpu_zone_begin_serial(zone_begin);
+  ___tracy_gpu_zone_end_data zone_end;
+  zone_end.queryId = query_id_end;
+  zone_end.context = timeline;
+  ___tracy_emit_gpu_zone_end_serial(zone_end);
+  ___tracy_gpu_time_data time;
+  time.context = timeline;
+  time.queryId = query_id_begin;
+  time.gpuTime = timestamp_begin;
+  ___tracy_emit_gpu_time_serial(time);
+  time.queryId = query_id_end;
+  time.gpuTime = timestamp_end;
+  ___tracy_emit_gpu_time_serial(time);
+}
+
+void Profiler::ToggleDisplay() {}
+void Profiler::TogglePause() {}
+void Profiler::SetUserIO(size_t z_order, ui::Window* window,
+                         ui::Presenter* presenter,
+                         ui::ImmediateDrawer* immediate_drawer) {}
+void Profiler::Flip() { FrameMark; }
+
 #else
 
 bool Profiler::is_enabled() { return false; }
@@ -341,6 +498,16 @@ void Profiler::Shutdown() {}
 uint32_t Profiler::GetColor(const char* str) { return 0; }
 void Profiler::ThreadEnter(const char* name) {}
 void Profiler::ThreadExit() {}
+void Profiler::SetThreadName(const char* name) {}
+void Profiler::AddToCounter(const char* name, int64_t count) {}
+bool Profiler::are_gpu_timelines_supported() { return false; }
+uint8_t Profiler::CreateGpuTimeline(GpuTimelineType type, const char* name,
+                                    int64_t timestamp_now,
+                                    float timestamp_period_ns) {
+  return kGpuTimelineInvalid;
+}
+void Profiler::AddGpuZone(uint8_t timeline, const char* name,
+                          int64_t timestamp_begin, int64_t timestamp_end) {}
 void Profiler::ToggleDisplay() {}
 void Profiler::TogglePause() {}
 void Profiler::SetUserIO(size_t z_order, ui::Window* window,
@@ -348,7 +515,7 @@ void Profiler::SetUserIO(size_t z_order, ui::Window* window,
                          ui::ImmediateDrawer* immediate_drawer) {}
 void Profiler::Flip() {}
 
-#endif  // XE_OPTION_PROFILING
+#endif  // XE_OPTION_PROFILING_MICROPROFILE
 
 }  // namespace xe
 
@@ -356,7 +523,7 @@ uint32_t MicroProfileGpuInsertTimeStamp() { return 0; }
 
 const char* MicroProfileGetThreadName() { return "TODO: get thread name!"; }
 
-#if XE_OPTION_PROFILING
+#if XE_OPTION_PROFILING_MICROPROFILE
 #if XE_OPTION_PROFILING_UI
 
 void MicroProfileDrawBox(int nX, int nY, int nX1, int nY1, uint32_t nColor,
@@ -389,4 +556,4 @@ void MicroProfileDrawText(int nX, int nY, uint32_t nColor, const char* pText,
 
 #endif  // XE_OPTION_PROFILING_UI
 
-#endif  // XE_OPTION_PROFILING
+#endif  // XE_OPTION_PROFILING_MICROPROFILE
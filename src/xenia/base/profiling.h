@@ -20,18 +20,32 @@
 #include "xenia/ui/virtual_key.h"
 #include "xenia/ui/window_listener.h"
 
-#if XE_PLATFORM_WIN32
+// The backend is chosen at build time (`xb premake --profiler=`):
+// - MicroProfile (default, Windows only) shows a live in-process UI.
+// - Tracy (XE_OPTION_PROFILING_TRACY, `--profiler=tracy`) streams the timeline
+//   to a Tracy server, possibly on another machine, so it can capture headless
+//   runs and long sessions. The host GPU submissions are shown as GPU zones.
+#if XE_OPTION_PROFILING_TRACY
 #define XE_OPTION_PROFILING 1
+#define XE_OPTION_PROFILING_MICROPROFILE 0
+#elif XE_PLATFORM_WIN32
+#define XE_OPTION_PROFILING 1
+#define XE_OPTION_PROFILING_MICROPROFILE 1
 #define XE_OPTION_PROFILING_UI 1
 #else
 #define XE_OPTION_PROFILING 0
-#endif  // XE_PLATFORM_WIN32
+#define XE_OPTION_PROFILING_MICROPROFILE 0
+#endif  // XE_OPTION_PROFILING_TRACY
 
-#if XE_OPTION_PROFILING
+#if XE_OPTION_PROFILING_MICROPROFILE
 // Pollutes the global namespace. Yuck.
 #define MICROPROFILE_MAX_THREADS 128
 #include <microprofile/microprofile.h>
-#endif  // XE_OPTION_PROFILING
+#endif  // XE_OPTION_PROFILING_MICROPROFILE
+
+#if XE_OPTION_PROFILING_TRACY
+#include "third_party/tracy/public/tracy/Tracy.hpp"
+#endif  // XE_OPTION_PROFILING_TRACY
 
 namespace xe {
 namespace ui {
@@ -44,7 +58,7 @@ class Window;
 
 namespace xe {
 
-#if XE_OPTION_PROFILING
+#if XE_OPTION_PROFILING_MICROPROFILE
 
 // Defines a profiling scope for CPU tasks.
 // Use `SCOPE_profile_cpu(name)` to activate the scope.
@@ -111,6 +125,29 @@ namespace xe {
 // Tracks a GPU value counter.
 #define COUNT_profile_gpu(name, count) MICROPROFILE_META_GPU(name, count)
 
+#elif XE_OPTION_PROFILING_TRACY
+
+// Tracy zones don't need to be defined in advance, and the scope and the
+// counter names must be string literals. Tracy has no groups, and the GPU
+// scopes are shown as CPU zones (the GPU timeline is filled by the backends).
+#define DEFINE_profile_cpu(name, group_name, scope_name)
+#define DEFINE_profile_gpu(name, group_name, scope_name)
+#define DECLARE_profile_cpu(name)
+#define DECLARE_profile_gpu(name)
+#define SCOPE_profile_cpu(name) ZoneScopedN(#name)
+#define SCOPE_profile_cpu_i(group_name, scope_name) ZoneScopedN(scope_name)
+#define SCOPE_profile_cpu_f(group_name) ZoneScoped
+#define SCOPE_profile_gpu(name) ZoneScopedN(#name)
+#define SCOPE_profile_gpu_i(group_name, scope_name) ZoneScopedN(scope_name)
+#define SCOPE_profile_gpu_f(group_name) ZoneScoped
+#define COUNT_profile_add(name, count) \
+  xe::Profiler::AddToCounter(name, int64_t(count))
+#define COUNT_profile_sub(name, count) \
+  xe::Profiler::AddToCounter(name, -int64_t(count))
+#define COUNT_profile_set(name, count) TracyPlot(name, int64_t(count))
+#define COUNT_profile_cpu(name, count) TracyPlot(name, int64_t(count))
+#define COUNT_profile_gpu(name, count) TracyPlot(name, int64_t(count))
+
 #else
 
 #define DEFINE_profile_cpu(name, group_name, scope_name)
@@ -156,7 +193,7 @@ namespace xe {
 #define MICROPROFILE_TEXT_HEIGHT 1
 #endif  // !MICROPROFILE_TEXT_WIDTH
 
-#endif  // XE_OPTION_PROFILING
+#endif  // XE_OPTION_PROFILING_MICROPROFILE
 
 class Profiler {
  public:
@@ -178,6 +215,33 @@ class Profiler {
   static void ThreadEnter(const char* name = nullptr);
   // Deactivates the calling thread for profiling.
   static void ThreadExit();
+  // Renames the calling thread after it has been activated, if supported by
+  // the backend.
+  static void SetThreadName(const char* name);
+
+  // Adds a (possibly negative) number to a counter, for the backends without
+  // their own counters. Use COUNT_profile_add and COUNT_profile_sub instead.
+  static void AddToCounter(const char* name, int64_t count);
+
+  // Timelines of the host GPU queues, for the backends displaying GPU zones.
+  enum class GpuTimelineType {
+    kD3D12,
+    kVulkan,
+  };
+  static constexpr uint8_t kGpuTimelineInvalid = UINT8_MAX;
+  static bool are_gpu_timelines_supported();
+  // Creates a timeline where the timestamp_now GPU timestamp corresponds to
+  // the current CPU time, with timestamp_period_ns nanoseconds per GPU tick.
+  // Returns kGpuTimelineInvalid if not supported or too many have been
+  // created. The name must be a string literal.
+  static uint8_t CreateGpuTimeline(GpuTimelineType type, const char* name,
+                                   int64_t timestamp_now,
+                                   float timestamp_period_ns);
+  // Adds a zone to the timeline once the GPU timestamps of its beginning and
+  // its end are known. Must be called from one thread for every timeline, in
+  // the order of the zones. The name must be a string literal.
+  static void AddGpuZone(uint8_t timeline, const char* name,
+                         int64_t timestamp_begin, int64_t timestamp_end);
 
   static void ToggleDisplay();
   static void TogglePause();
@@ -201,7 +265,7 @@ class Profiler {
   static void Flip();
 
  private:
-#if XE_OPTION_PROFILING
+#if XE_OPTION_PROFILING_MICROPROFILE
   class ProfilerWindowInputListener final : public ui::WindowInputListener {
    public:
     void OnKeyDown(ui::KeyEvent& e) override;
@@ -237,7 +301,7 @@ class Profiler {
   static std::unique_ptr<ui::MicroprofileDrawer> drawer_;
   static bool dpi_scaling_;
 #endif  // XE_OPTION_PROFILING_UI
-#endif  // XE_OPTION_PROFILING
+#endif  // XE_OPTION_PROFILING_MICROPROFILE
 };
 
 }  // namespace xe
@@ -11,12 +11,14 @@
 #define XENIA_BASE_RING_BUFFER_H_
 
 #include <cstdint>
+#include <cstring>
 #include <string>
 #include <type_traits>
 #include <vector>
 
 #include "xenia/base/assert.h"
 #include "xenia/base/byte_order.h"
+#include "xenia/base/memory.h"
 
 namespace xe {
 
@@ -89,12 +91,39 @@ class RingBuffer {
                   "Immediate read only supports basic types!");
 
     T imm;
-    size_t read = Read(reinterpret_cast<uint8_t*>(&imm), sizeof(T));
-    assert_true(read == sizeof(T));
+    // Inline path for the common case of a read not reaching the end of the
+    // buffer, as this is done for every dword of the command processor ring.
+    if (read_offset_ + sizeof(T) < capacity_) {
+      std::memcpy(&imm, buffer_ + read_offset_, sizeof(T));
+      read_offset_ += sizeof(T);
+    } else {
+      size_t read = Read(reinterpret_cast<uint8_t*>(&imm), sizeof(T));
+      assert_true(read == sizeof(T));
+    }
     imm = xe::byte_swap(imm);
     return imm;
   }
 
+  // Reads count elements (not bytes) of type T, byte-swapping them with the
+  // vectorized copy_and_swap, in at most two parts if the read wraps around.
+  // The capacity must be a multiple of the element size.
+  template <typename T>
+  void ReadAndSwapSpan(T* buffer, size_t count) {
+    static_assert(std::is_fundamental<T>::value,
+                  "Span read only supports basic types!");
+    assert_zero(capacity_ % sizeof(T));
+    ReadRange range = BeginRead(count * sizeof(T));
+    size_t first_count = range.first_length / sizeof(T);
+    xe::copy_and_swap(buffer, reinterpret_cast<const T*>(range.first),
+                      first_count);
+    if (range.second_length) {
+      xe::copy_and_swap(buffer + first_count,
+                        reinterpret_cast<const T*>(range.second),
+                        range.second_length / sizeof(T));
+    }
+    EndRead(range);
+  }
+
   size_t Write(const uint8_t* buffer, size_t count);
   template <typename T>
   size_t Write(const T* buffer, size_t count) {
@@ -33,10 +33,20 @@ class StringBuffer {
   void Append(const char* value);
   void Append(const std::string_view value);
 
+  // Formats directly into the buffer, growing it and formatting again only if
+  // the remaining capacity is not enough, without a temporary string.
   template <typename... Args>
   void AppendFormat(const char* format, const Args&... args) {
-    auto s = fmt::format(format, args...);
-    Append(s.c_str());
+    // There's always space left for the terminator.
+    size_t capacity_left = buffer_capacity_ - buffer_offset_;
+    auto result = fmt::format_to_n(buffer_ + buffer_offset_, capacity_left - 1,
+                                   format, args...);
+    if (result.size >= capacity_left) {
+      Grow(result.size + 1);
+      fmt::format_to_n(buffer_ + buffer_offset_, result.size, format, args...);
+    }
+    buffer_offset_ += result.size;
+    buffer_[buffer_offset_] = 0;
   }
 
   void AppendVarargs(const char* format, va_list args);
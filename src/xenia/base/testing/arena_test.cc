@@ -0,0 +1,75 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include <cstring>
+
+#include "xenia/base/arena.h"
+
+#include "third_party/catch/include/catch.hpp"
+
+namespace xe::base::test {
+
+struct ArenaTestObject {
+  ArenaTestObject(uint32_t a, uint64_t b) : a(a), b(b) {}
+  uint32_t a;
+  uint64_t b;
+};
+
+TEST_CASE("Arena::New", "[arena]") {
+  Arena arena(64_KiB);
+  auto object = arena.New<ArenaTestObject>(1, 2);
+  REQUIRE(object->a == 1);
+  REQUIRE(object->b == 2);
+  REQUIRE((reinterpret_cast<size_t>(object) & (alignof(ArenaTestObject) - 1)) ==
+          0);
+
+  auto elements = arena.NewArray<uint32_t>(16);
+  for (size_t i = 0; i < 16; ++i) {
+    REQUIRE(elements[i] == 0);
+  }
+
+  char* string = arena.CopyString("symbol_name");
+  REQUIRE(std::strcmp(string, "symbol_name") == 0);
+}
+
+TEST_CASE("Arena::Rollback", "[arena]") {
+  Arena arena(64_KiB);
+  arena.Alloc(16, 16);
+  Arena::Marker marker = arena.GetMarker();
+  void* first = arena.Alloc(256, 16);
+  arena.Rollback(marker);
+  REQUIRE(arena.Alloc(256, 16) == first);
+
+  // Rolling back across chunks reuses the later chunks.
+  arena.Rollback(marker);
+  void* later_chunk = nullptr;
+  for (size_t i = 0; i < 8; ++i) {
+    later_chunk = arena.Alloc(16_KiB, 16);
+  }
+  arena.Rollback(marker);
+  REQUIRE(arena.Alloc(256, 16) == first);
+  for (size_t i = 1; i < 8; ++i) {
+    arena.Alloc(16_KiB, 16);
+  }
+  REQUIRE(arena.Alloc(16_KiB, 16) == later_chunk);
+}
+
+TEST_CASE("Arena::ScopedRollback", "[arena]") {
+  Arena arena(64_KiB);
+  Arena::Marker marker = arena.GetMarker();
+  REQUIRE(marker.chunk == nullptr);
+  void* first;
+  {
+    Arena::ScopedRollback rollback(arena);
+    first = arena.Alloc(256, 16);
+  }
+  REQUIRE(arena.Alloc(256, 16) == first);
+}
+
+}  // namespace xe::base::test
@@ -0,0 +1,71 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/base/clock.h"
+
+#include "third_party/catch/include/catch.hpp"
+
+namespace xe::base::test {
+
+TEST_CASE("Clock multiply-shift ratio", "[clock]") {
+  SECTION("Integer ratio") {
+    uint64_t multiplier;
+    uint32_t shift;
+    Clock::GetRatioMultiplierShift(std::make_pair(uint64_t(5), uint64_t(1)),
+                                   multiplier, shift);
+    REQUIRE(Clock::MultiplyShiftRight(10000000, multiplier, shift) ==
+            50000000);
+  }
+
+  SECTION("50 MHz guest from 3 GHz host") {
+    uint64_t multiplier;
+    uint32_t shift;
+    Clock::GetRatioMultiplierShift(std::make_pair(uint64_t(1), uint64_t(60)),
+                                   multiplier, shift);
+    // A day of host ticks.
+    uint64_t host_ticks = uint64_t(3000000000) * 60 * 60 * 24;
+    uint64_t guest_ticks =
+        Clock::MultiplyShiftRight(host_ticks, multiplier, shift);
+    uint64_t expected = host_ticks / 60;
+    REQUIRE(guest_ticks <= expected);
+    REQUIRE(guest_ticks + 1 >= expected);
+  }
+
+  SECTION("128-bit product") {
+    REQUIRE(Clock::MultiplyShiftRight(UINT64_MAX, uint64_t(1) << 63, 63) ==
+            UINT64_MAX);
+    REQUIRE(Clock::MultiplyShiftRight(uint64_t(1) << 40, uint64_t(1) << 40,
+                                      40) == uint64_t(1) << 40);
+    REQUIRE(Clock::MultiplyShiftRight(123, 456, 0) == 123 * 456);
+  }
+}
+
+TEST_CASE("Guest tick count with scaling", "[clock]") {
+  cvars::clock_no_scaling = false;
+  Clock::set_guest_tick_frequency(50000000);
+  Clock::set_guest_time_scalar(1.0);
+
+  SECTION("Monotonic across time scalar changes") {
+    uint64_t last = Clock::QueryGuestTickCount();
+    for (double scalar : {2.0, 0.5, 1.0}) {
+      Clock::set_guest_time_scalar(scalar);
+      uint64_t now = Clock::QueryGuestTickCount();
+      REQUIRE(now >= last);
+      last = now;
+    }
+  }
+
+  SECTION("Advancing") {
+    uint64_t before = Clock::QueryGuestTickCount();
+    Clock::AdvanceGuestTickCount(50000000);
+    REQUIRE(Clock::QueryGuestTickCount() >= before + 50000000);
+  }
+}
+
+}  // namespace xe::base::test
@@ -0,0 +1,109 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include <vector>
+
+#include "third_party/catch/include/catch.hpp"
+#include "third_party/fmt/include/fmt/format.h"
+
+#include "xenia/base/clock.h"
+#include "xenia/base/memory.h"
+
+namespace xe {
+namespace base {
+namespace test {
+
+// Hidden, run with "[.benchmark]" in an optimized build, as titles use the
+// kernel memory routines on buffers of multiple megabytes during loading.
+constexpr size_t kBenchmarkBufferSize = 16 * 1024 * 1024;
+constexpr uint32_t kBenchmarkIterations = 16;
+
+template <typename F>
+void ReportThroughput(const char* name, F&& function) {
+  uint64_t start = Clock::QueryHostTickCount();
+  for (uint32_t i = 0; i < kBenchmarkIterations; ++i) {
+    function();
+  }
+  uint64_t ticks = Clock::QueryHostTickCount() - start;
+  double seconds = double(ticks) / double(Clock::QueryHostTickFrequency());
+  double megabytes =
+      double(kBenchmarkBufferSize) * kBenchmarkIterations / (1024.0 * 1024.0);
+  fmt::print("{:<32} {:>10.1f} MB/s\n", name,
+             seconds > 0.0 ? megabytes / seconds : 0.0);
+}
+
+TEST_CASE("memory_primitives_throughput", "[.benchmark]") {
+  std::vector<uint8_t> a(kBenchmarkBufferSize), b(kBenchmarkBufferSize);
+  for (size_t i = 0; i < kBenchmarkBufferSize; ++i) {
+    a[i] = uint8_t(i);
+    b[i] = uint8_t(i * 3);
+  }
+  auto a_32 = reinterpret_cast<uint32_t*>(a.data());
+  auto b_32 = reinterpret_cast<uint32_t*>(b.data());
+  size_t count_32 = kBenchmarkBufferSize / sizeof(uint32_t);
+  // Keeps the scalar references from being optimized out.
+  volatile size_t sink = 0;
+
+  ReportThroughput("count_equal_bytes (scalar)", [&]() {
+    size_t count = 0;
+    for (size_t i = 0; i < kBenchmarkBufferSize; ++i) {
+      count += a[i] == b[i];
+    }
+    sink = count;
+  });
+  ReportThroughput("count_equal_bytes", [&]() {
+    sink = count_equal_bytes(a.data(), b.data(), kBenchmarkBufferSize);
+  });
+
+  ReportThroughput("count_equal_32 (scalar)", [&]() {
+    size_t count = 0;
+    for (size_t i = 0; i < count_32; ++i) {
+      count += a_32[i] == 0x03020100;
+    }
+    sink = count;
+  });
+  ReportThroughput("count_equal_32", [&]() {
+    sink = count_equal_32(a_32, 0x03020100, count_32);
+  });
+
+  ReportThroughput("find_32 (scalar)", [&]() {
+    size_t i = 0;
+    while (i < count_32 && a_32[i] != 0xFFFFFFFF) {
+      ++i;
+    }
+    sink = i;
+  });
+  ReportThroughput("find_32", [&]() {
+    sink = size_t(find_32(a_32, a_32 + count_32, 0xFFFFFFFF) - a_32);
+  });
+
+  ReportThroughput("fill_32", [&]() { fill_32(b_32, 0xAABBCCDD, count_32); });
+
+  ReportThroughput("copy_and_swap_16_unaligned", [&]() {
+    copy_and_swap_16_unaligned(b.data(), a.data() + 1,
+                               (kBenchmarkBufferSize - 1) / 2);
+  });
+  ReportThroughput("copy_and_swap_32_unaligned", [&]() {
+    copy_and_swap_32_unaligned(b.data(), a.data() + 1,
+                               (kBenchmarkBufferSize - 1) / 4);
+  });
+  ReportThroughput("copy_and_swap_64_unaligned", [&]() {
+    copy_and_swap_64_unaligned(b.data(), a.data() + 1,
+                               (kBenchmarkBufferSize - 1) / 8);
+  });
+  ReportThroughput("copy_and_swap_16_in_32_unaligned", [&]() {
+    copy_and_swap_16_in_32_unaligned(b.data(), a.data() + 1,
+                                     (kBenchmarkBufferSize - 1) / 4);
+  });
+  (void)sink;
+}
+
+}  // namespace test
+}  // namespace base
+}  // namespace xe
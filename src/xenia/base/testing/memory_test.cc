@@ -15,6 +15,7 @@
 #include "xenia/base/clock.h"
 
 #include <array>
+#include <vector>
 
 namespace xe {
 namespace base {
@@ -506,6 +507,117 @@ TEST_CASE("copy_and_swap_16_in_32_unaligned", "[copy_and_swap]") {
   }
 }
 
+TEST_CASE("copy_and_swap_large", "[copy_and_swap]") {
+  // Long enough for the widest vectors, with residual elements.
+  constexpr size_t count = 1000;
+  std::vector<uint8_t> src(count * 8 + 1), dest(count * 8 + 1);
+  for (size_t i = 0; i < src.size(); ++i) {
+    src[i] = uint8_t(i * 7);
+  }
+  // Offset by one byte to also test the unaligned versions.
+  copy_and_swap_16_unaligned(&dest[1], &src[1], count);
+  for (size_t i = 0; i < count; ++i) {
+    REQUIRE(load<uint16_t>(&dest[1 + i * 2]) ==
+            byte_swap(load<uint16_t>(&src[1 + i * 2])));
+  }
+  copy_and_swap_32_unaligned(&dest[1], &src[1], count);
+  for (size_t i = 0; i < count; ++i) {
+    REQUIRE(load<uint32_t>(&dest[1 + i * 4]) ==
+            byte_swap(load<uint32_t>(&src[1 + i * 4])));
+  }
+  copy_and_swap_64_unaligned(&dest[1], &src[1], count);
+  for (size_t i = 0; i < count; ++i) {
+    REQUIRE(load<uint64_t>(&dest[1 + i * 8]) ==
+            byte_swap(load<uint64_t>(&src[1 + i * 8])));
+  }
+  copy_and_swap_16_in_32_unaligned(&dest[1], &src[1], count);
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t value = load<uint32_t>(&src[1 + i * 4]);
+    REQUIRE(load<uint32_t>(&dest[1 + i * 4]) ==
+            ((value >> 16) | (value << 16)));
+  }
+}
+
+TEST_CASE("count_equal_bytes", "[memory_primitives]") {
+  std::vector<uint8_t> a(1000), b(1000);
+  size_t expected = 0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    a[i] = uint8_t(i);
+    b[i] = uint8_t(i % 3 ? i : ~i);
+    if (a[i] == b[i]) {
+      ++expected;
+    }
+  }
+  REQUIRE(count_equal_bytes(a.data(), b.data(), 0) == 0);
+  REQUIRE(count_equal_bytes(a.data(), a.data(), a.size()) == a.size());
+  REQUIRE(count_equal_bytes(a.data(), b.data(), a.size()) == expected);
+  REQUIRE(count_equal_bytes(&a[1], &b[1], a.size() - 1) ==
+          expected - (a[0] == b[0] ? 1 : 0));
+}
+
+TEST_CASE("count_equal_32", "[memory_primitives]") {
+  std::vector<uint32_t> values(1000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = i % 5 ? uint32_t(i) : 0xAABBCCDD;
+  }
+  REQUIRE(count_equal_32(values.data(), 0xAABBCCDD, 0) == 0);
+  REQUIRE(count_equal_32(values.data(), 0xAABBCCDD, values.size()) == 200);
+  REQUIRE(count_equal_32(values.data(), 0xAABBCCDD, 999) == 200);
+  REQUIRE(count_equal_32(values.data(), 0xAABBCCDD, 996) == 200);
+  REQUIRE(count_equal_32(values.data(), 0xAABBCCDD, 995) == 199);
+  REQUIRE(count_equal_32(values.data(), 0x12345678, values.size()) == 0);
+}
+
+TEST_CASE("fill_32", "[memory_primitives]") {
+  std::vector<uint32_t> values(1000, 0);
+  fill_32(&values[1], 0x01234567, 997);
+  REQUIRE(values[0] == 0);
+  for (size_t i = 1; i < 998; ++i) {
+    REQUIRE(values[i] == 0x01234567);
+  }
+  REQUIRE(values[998] == 0);
+  REQUIRE(values[999] == 0);
+}
+
+TEST_CASE("copy_non_temporal", "[memory_primitives]") {
+  std::vector<uint8_t> src(1000);
+  for (size_t i = 0; i < src.size(); ++i) {
+    src[i] = uint8_t(i * 7);
+  }
+  // Different alignments of the destination relative to the source, and
+  // sizes not covering whole vectors.
+  for (size_t offset : {0, 1, 5, 16}) {
+    for (size_t size : {0, 3, 64, 200, 997}) {
+      std::vector<uint8_t> dest(1024, 0xCD);
+      copy_non_temporal(&dest[offset], &src[1], size);
+      for (size_t i = 0; i < offset; ++i) {
+        REQUIRE(dest[i] == 0xCD);
+      }
+      for (size_t i = 0; i < size; ++i) {
+        REQUIRE(dest[offset + i] == src[1 + i]);
+      }
+      REQUIRE(dest[offset + size] == 0xCD);
+    }
+  }
+}
+
+TEST_CASE("find_32", "[memory_primitives]") {
+  std::vector<uint32_t> values(1000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = uint32_t(i);
+  }
+  const uint32_t* begin = values.data();
+  const uint32_t* end = begin + values.size();
+  REQUIRE(find_32(begin, begin, 0) == begin);
+  REQUIRE(find_32(begin, end, 0) == begin);
+  REQUIRE(find_32(begin, end, 37) == begin + 37);
+  REQUIRE(find_32(begin, end, 999) == begin + 999);
+  REQUIRE(find_32(begin, end, 1000) == end);
+  REQUIRE(find_32(begin + 38, end, 37) == end);
+  values[500] = 37;
+  REQUIRE(find_32(begin + 38, end, 37) == begin + 500);
+}
+
 TEST_CASE("create_and_close_file_mapping", "Virtual Memory Mapping") {
   auto path = fmt::format("xenia_test_{}", Clock::QueryHostTickCount());
   auto memory = xe::memory::CreateFileMappingHandle(
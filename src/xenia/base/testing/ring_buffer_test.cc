@@ -0,0 +1,146 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/base/ring_buffer.h"
+
+#include <vector>
+
+#include "third_party/catch/include/catch.hpp"
+#include "third_party/fmt/include/fmt/format.h"
+
+#include "xenia/base/clock.h"
+
+namespace xe {
+namespace base {
+namespace test {
+
+// A ring of big-endian dwords 0, 1, 2... with the capacity of count dwords.
+std::vector<uint32_t> CreateSwappedDwords(uint32_t count) {
+  std::vector<uint32_t> dwords(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    dwords[i] = xe::byte_swap(i);
+  }
+  return dwords;
+}
+
+TEST_CASE("RingBuffer ReadAndSwap", "[ring_buffer]") {
+  std::vector<uint32_t> dwords = CreateSwappedDwords(16);
+  RingBuffer ring(reinterpret_cast<uint8_t*>(dwords.data()),
+                  dwords.size() * sizeof(uint32_t));
+  ring.set_read_offset(14 * sizeof(uint32_t));
+  ring.set_write_offset(4 * sizeof(uint32_t));
+  REQUIRE(ring.ReadAndSwap<uint32_t>() == 14);
+  // Reaching the end of the buffer.
+  REQUIRE(ring.ReadAndSwap<uint32_t>() == 15);
+  REQUIRE(ring.read_offset() == 0);
+  REQUIRE(ring.ReadAndSwap<uint32_t>() == 0);
+  REQUIRE(ring.read_offset() == sizeof(uint32_t));
+}
+
+TEST_CASE("RingBuffer ReadAndSwapSpan", "[ring_buffer]") {
+  std::vector<uint32_t> dwords = CreateSwappedDwords(16);
+  RingBuffer ring(reinterpret_cast<uint8_t*>(dwords.data()),
+                  dwords.size() * sizeof(uint32_t));
+  ring.set_write_offset(8 * sizeof(uint32_t));
+  uint32_t values[12];
+
+  SECTION("Contiguous") {
+    ring.set_read_offset(2 * sizeof(uint32_t));
+    ring.ReadAndSwapSpan(values, 5);
+    for (uint32_t i = 0; i < 5; ++i) {
+      REQUIRE(values[i] == 2 + i);
+    }
+    REQUIRE(ring.read_offset() == 7 * sizeof(uint32_t));
+  }
+
+  SECTION("Ending at the end of the buffer") {
+    ring.set_read_offset(12 * sizeof(uint32_t));
+    ring.ReadAndSwapSpan(values, 4);
+    for (uint32_t i = 0; i < 4; ++i) {
+      REQUIRE(values[i] == 12 + i);
+    }
+    REQUIRE(ring.read_offset() == 0);
+  }
+
+  SECTION("Wrapping around") {
+    ring.set_read_offset(10 * sizeof(uint32_t));
+    ring.ReadAndSwapSpan(values, 12);
+    for (uint32_t i = 0; i < 12; ++i) {
+      REQUIRE(values[i] == (10 + i) % 16);
+    }
+    REQUIRE(ring.read_offset() == 6 * sizeof(uint32_t));
+  }
+}
+
+// Hidden, run with "[.benchmark]" in an optimized build. Parses a ring of
+// type-0 PM4 packets (a header and a range of register values) into a
+// register file the way the command processor does, for short packets like
+// most state changes and long ones like shader constant uploads.
+TEST_CASE("ring_buffer_pm4_throughput", "[.benchmark]") {
+  constexpr uint32_t kRingDwords = 1024 * 1024;
+  constexpr uint32_t kRegisterCount = 0x2000;
+  constexpr uint32_t kIterations = 64;
+  std::vector<uint32_t> ring_dwords(kRingDwords);
+  std::vector<uint32_t> registers(kRegisterCount);
+  // Keeps the register writes from being optimized out.
+  volatile uint32_t sink = 0;
+
+  auto report = [&](const char* name, uint32_t packet_registers,
+                    auto&& parse_packet) {
+    uint32_t packet_dwords = 1 + packet_registers;
+    uint32_t packets = kRingDwords / packet_dwords;
+    for (uint32_t i = 0; i < packets * packet_dwords; ++i) {
+      uint32_t packet = ((packet_registers - 1) << 16) |
+                        ((i * 8) & (kRegisterCount - packet_registers));
+      ring_dwords[i] = xe::byte_swap(i % packet_dwords ? i : packet);
+    }
+    RingBuffer ring(reinterpret_cast<uint8_t*>(ring_dwords.data()),
+                    kRingDwords * sizeof(uint32_t));
+    uint64_t start = Clock::QueryHostTickCount();
+    for (uint32_t i = 0; i < kIterations; ++i) {
+      ring.set_read_offset(0);
+      for (uint32_t j = 0; j < packets; ++j) {
+        uint32_t packet = ring.ReadAndSwap<uint32_t>();
+        parse_packet(ring, packet & 0x1FFF, ((packet >> 16) & 0x3FFF) + 1);
+      }
+    }
+    uint64_t ticks = Clock::QueryHostTickCount() - start;
+    sink = registers[0x10];
+    double seconds = double(ticks) / double(Clock::QueryHostTickFrequency());
+    double megadwords =
+        double(packets) * packet_dwords * kIterations / (1024.0 * 1024.0);
+    fmt::print("{:<32} {:>3} {:>10.1f} Mdwords/s\n", name, packet_registers,
+               seconds > 0.0 ? megadwords / seconds : 0.0);
+  };
+
+  for (uint32_t packet_registers : {8, 256}) {
+    report("Read and byte_swap per dword", packet_registers,
+           [&](RingBuffer& ring, uint32_t base_index, uint32_t count) {
+             for (uint32_t i = 0; i < count; ++i) {
+               uint32_t value;
+               ring.Read(&value, sizeof(value));
+               registers[base_index + i] = xe::byte_swap(value);
+             }
+           });
+    report("ReadAndSwap per dword", packet_registers,
+           [&](RingBuffer& ring, uint32_t base_index, uint32_t count) {
+             for (uint32_t i = 0; i < count; ++i) {
+               registers[base_index + i] = ring.ReadAndSwap<uint32_t>();
+             }
+           });
+    report("ReadAndSwapSpan", packet_registers,
+           [&](RingBuffer& ring, uint32_t base_index, uint32_t count) {
+             ring.ReadAndSwapSpan(registers.data() + base_index, count);
+           });
+  }
+}
+
+}  // namespace test
+}  // namespace base
+}  // namespace xe
@@ -10,6 +10,7 @@
 #include <array>
 
 #include "xenia/base/threading.h"
+#include "xenia/base/threading_timer_queue.h"
 
 #define CATCH_CONFIG_ENABLE_CHRONO_STRINGMAKER
 #include "third_party/catch/include/catch.hpp"
@@ -133,6 +134,20 @@ TEST_CASE("Sleep Current Thread", "[sleep]") {
   REQUIRE(duration >= wait_time);
 }
 
+TEST_CASE("Sleep Current Thread Until Time", "[sleep]") {
+  auto wait_time = 5ms;
+  auto start = std::chrono::steady_clock::now();
+  SleepUntil(start + wait_time);
+  auto duration = std::chrono::steady_clock::now() - start;
+  REQUIRE(duration >= wait_time);
+
+  // Time in the past
+  start = std::chrono::steady_clock::now();
+  SleepUntil(start - wait_time);
+  duration = std::chrono::steady_clock::now() - start;
+  REQUIRE(duration < wait_time);
+}
+
 TEST_CASE("Sleep Current Thread in Alertable State", "[sleep]") {
   auto wait_time = 50ms;
   auto start = std::chrono::steady_clock::now();
@@ -303,6 +318,60 @@ TEST_CASE("HighResolutionTimer") {
   }
 }
 
+TEST_CASE("Timer Queue Callback Pool", "[timer_queue]") {
+  using clock = TimerQueueWaitItem::clock;
+
+  // A long callback must not delay the callback of another wait item
+  {
+    std::atomic<bool> long_started(false);
+    std::atomic<bool> long_done(false);
+    std::atomic<bool> short_done(false);
+    auto long_item = QueueTimerOnce(
+        [&](void*) {
+          long_started = true;
+          Sleep(200ms);
+          long_done = true;
+        },
+        nullptr, clock::now() + 5ms, true);
+    REQUIRE(spin_wait_for(1s, [&] { return long_started.load(); }));
+    QueueTimerOnce([&](void*) { short_done = true; }, nullptr,
+                   clock::now() + 10ms, true);
+    REQUIRE(spin_wait_for(150ms, [&] { return short_done.load(); }));
+    REQUIRE(!long_done);
+    REQUIRE(spin_wait_for(1s, [&] { return long_done.load(); }));
+  }
+
+  // Disarming from the callback itself
+  {
+    std::atomic<uint32_t> counter(0);
+    std::weak_ptr<TimerQueueWaitItem> wait_item;
+    std::atomic<bool> queued(false);
+    wait_item = QueueTimerRecurring(
+        [&](void*) {
+          spin_wait([&] { return queued.load(); });
+          if (++counter == 3) {
+            wait_item.lock()->Disarm();
+          }
+        },
+        nullptr, clock::now(), 5ms, true);
+    queued = true;
+    Sleep(100ms);
+    REQUIRE(counter == 3);
+  }
+
+  // Many wait items due at different times across the slots of the wheel
+  {
+    constexpr uint32_t item_count = 256;
+    std::atomic<uint32_t> counter(0);
+    auto start = clock::now();
+    for (uint32_t i = 0; i < item_count; ++i) {
+      QueueTimerOnce([&](void*) { ++counter; }, nullptr,
+                     start + std::chrono::milliseconds(i), (i & 1) != 0);
+    }
+    REQUIRE(spin_wait_for(2s, [&] { return counter == item_count; }));
+  }
+}
+
 TEST_CASE("Wait on Multiple Handles", "[wait]") {
   auto mutant = Mutant::Create(true);
   REQUIRE(mutant);
@@ -475,6 +544,115 @@ TEST_CASE("Wait on Multiple Events", "[event]") {
   REQUIRE(order[3] == '3');
 }
 
+TEST_CASE("Wait with AdaptiveWaiter", "[adaptive_waiter]") {
+  AdaptiveWaiter waiter;
+  std::atomic<bool> has_work = false;
+  auto has_work_function = [&has_work]() { return has_work.load(); };
+
+  // Spin and then block until timing out without work
+  REQUIRE_FALSE(waiter.Wait(has_work_function, false, 10ms));
+
+  // Return immediately with work
+  has_work = true;
+  REQUIRE(waiter.Wait(has_work_function, false, 10ms));
+  has_work = false;
+
+  // Wake from another thread while blocked
+  auto thread = Thread::Create({}, [&has_work, &waiter] {
+    Sleep(50ms);
+    has_work = true;
+    waiter.Wake();
+  });
+  REQUIRE(waiter.Wait(has_work_function, false, 5000ms));
+  REQUIRE(Wait(thread.get(), false, 1000ms) == WaitResult::kSuccess);
+
+  AdaptiveWaiter::Stats stats = waiter.stats();
+  REQUIRE(stats.spin_wait_count == 1);
+  REQUIRE(stats.block_wait_count == 2);
+  REQUIRE(stats.block_ticks > 0);
+}
+
+TEST_CASE("Run tasks in TaskScheduler", "[task_scheduler]") {
+  TaskScheduler scheduler(4);
+  REQUIRE(scheduler.worker_count() == 4);
+
+  // Task groups, with tasks submitted from the tasks
+  std::atomic<uint32_t> completed_count = 0;
+  {
+    TaskScheduler::TaskGroup group(TaskScheduler::Priority::kLatencyCritical,
+                                   scheduler);
+    for (uint32_t i = 0; i < 64; ++i) {
+      group.Run([&group, &completed_count] {
+        group.Run([&completed_count] { ++completed_count; });
+        ++completed_count;
+      });
+    }
+    group.Wait();
+    REQUIRE(completed_count == 128);
+  }
+
+  // Continuation after all the tasks of the group
+  completed_count = 0;
+  std::atomic<uint32_t> count_in_continuation = UINT32_MAX;
+  {
+    TaskScheduler::TaskGroup group(TaskScheduler::Priority::kBackground,
+                                   scheduler);
+    for (uint32_t i = 0; i < 16; ++i) {
+      group.Run(
+          [&completed_count] {
+            Sleep(1ms);
+            ++completed_count;
+          },
+          i);
+    }
+    group.Then([&completed_count, &count_in_continuation] {
+      count_in_continuation = completed_count.load();
+    });
+  }
+  REQUIRE(completed_count == 16);
+  REQUIRE(spin_wait_for(5000ms, [&count_in_continuation] {
+    return count_in_continuation != UINT32_MAX;
+  }));
+  REQUIRE(count_in_continuation == 16);
+
+  // Background tasks run on at most half of the workers
+  std::atomic<uint32_t> running_count = 0, max_running_count = 0;
+  {
+    TaskScheduler::TaskGroup group(TaskScheduler::Priority::kBackground,
+                                   scheduler);
+    for (uint32_t i = 0; i < 16; ++i) {
+      group.Run([&running_count, &max_running_count] {
+        uint32_t count = ++running_count;
+        uint32_t max_count = max_running_count.load();
+        while (count > max_count &&
+               !max_running_count.compare_exchange_weak(max_count, count)) {
+        }
+        Sleep(2ms);
+        --running_count;
+      });
+    }
+  }
+  REQUIRE(max_running_count >= 1);
+  REQUIRE(max_running_count <= 2);
+}
+
+TEST_CASE("ParallelFor", "[task_scheduler]") {
+  std::vector<std::atomic<uint32_t>> processed(1000);
+  ParallelFor(processed.size(), [&processed](size_t index) {
+    // Nested
+    if (index % 100 == 0) {
+      std::atomic<uint32_t> nested_count = 0;
+      ParallelFor(10, [&nested_count](size_t) { ++nested_count; });
+      REQUIRE(nested_count == 10);
+    }
+    ++processed[index];
+  });
+  for (const std::atomic<uint32_t>& count : processed) {
+    REQUIRE(count == 1);
+  }
+  ParallelFor(0, [](size_t) { FAIL(); });
+}
+
 TEST_CASE("Wait on Semaphore", "[semaphore]") {
   WaitResult result;
   std::unique_ptr<Semaphore> sem;
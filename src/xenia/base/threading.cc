@@ -9,6 +9,8 @@
 
 #include "xenia/base/threading.h"
 
+#include "xenia/base/clock.h"
+
 namespace xe {
 namespace threading {
 
@@ -29,5 +31,60 @@ uint32_t current_thread_id() {
 
 void set_current_thread_id(uint32_t id) { current_thread_id_ = id; }
 
+AdaptiveWaiter::AdaptiveWaiter()
+    : event_(Event::CreateAutoResetEvent(false)) {
+  assert_not_null(event_);
+  uint64_t tick_frequency = Clock::QueryHostTickFrequency();
+  // 10 microseconds to 2 milliseconds, starting at 200 microseconds.
+  min_spin_duration_ticks_ = std::max(tick_frequency / 100000, uint64_t(1));
+  max_spin_duration_ticks_ = tick_frequency / 500;
+  spin_duration_ticks_ = tick_frequency / 5000;
+  wait_end_tick_ = Clock::QueryHostTickCount();
+}
+
+AdaptiveWaiter::Stats AdaptiveWaiter::stats() const {
+  Stats stats;
+  stats.busy_ticks = busy_ticks_.load(std::memory_order_relaxed);
+  stats.spin_ticks = spin_ticks_.load(std::memory_order_relaxed);
+  stats.block_ticks = block_ticks_.load(std::memory_order_relaxed);
+  stats.spin_wait_count = spin_wait_count_.load(std::memory_order_relaxed);
+  stats.block_wait_count = block_wait_count_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void AdaptiveWaiter::BeginWait() {
+  wait_start_tick_ = Clock::QueryHostTickCount();
+  busy_ticks_.fetch_add(wait_start_tick_ - wait_end_tick_,
+                        std::memory_order_relaxed);
+  spin_end_tick_ = wait_start_tick_ + spin_duration_ticks_;
+}
+
+bool AdaptiveWaiter::IsSpinOver() const {
+  return Clock::QueryHostTickCount() >= spin_end_tick_;
+}
+
+void AdaptiveWaiter::EndWait(bool blocked) {
+  wait_end_tick_ = Clock::QueryHostTickCount();
+  if (!blocked) {
+    spin_ticks_.fetch_add(wait_end_tick_ - wait_start_tick_,
+                          std::memory_order_relaxed);
+    spin_wait_count_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  uint64_t block_duration_ticks = wait_end_tick_ - spin_end_tick_;
+  spin_ticks_.fetch_add(spin_end_tick_ - wait_start_tick_,
+                        std::memory_order_relaxed);
+  block_ticks_.fetch_add(block_duration_ticks, std::memory_order_relaxed);
+  block_wait_count_.fetch_add(1, std::memory_order_relaxed);
+  if (block_duration_ticks < spin_duration_ticks_) {
+    // Spinning for twice as long would have avoided blocking.
+    spin_duration_ticks_ =
+        std::min(spin_duration_ticks_ * 2, max_spin_duration_ticks_);
+  } else {
+    spin_duration_ticks_ =
+        std::max(spin_duration_ticks_ / 2, min_spin_duration_ticks_);
+  }
+}
+
 }  // namespace threading
 }  // namespace xe
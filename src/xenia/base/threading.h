@@ -16,6 +16,7 @@
 #include <climits>
 #include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -90,6 +91,33 @@ class Fence {
 // Returns the total number of logical processors in the host system.
 uint32_t logical_processor_count();
 
+struct LogicalProcessor {
+  // Index of the bit in the affinity masks.
+  uint32_t index;
+  // The same for the logical processors of one physical core (SMT siblings).
+  uint32_t core;
+  // The same for the logical processors sharing the last-level cache, such as
+  // a CCX on AMD processors.
+  uint32_t cache_group;
+  // Larger for the more performant types of the cores on hybrid processors,
+  // such as P-cores compared to E-cores, 0 if all the cores are the same.
+  uint32_t efficiency_class;
+  // The NUMA node with the memory local to the processor, 0 if the host is not
+  // a NUMA system or the node is unknown.
+  uint32_t numa_node;
+};
+// Returns the logical processors the process may run on that can be
+// addressed by the affinity masks (the first 64, in processor group 0 on
+// Windows), sorted by the index, or an empty vector if the topology couldn't
+// be obtained.
+std::vector<LogicalProcessor> GetLogicalProcessors();
+
+// Calls the function for every index in [0, count) from the calling thread and
+// the workers of the shared TaskScheduler, and returns once all of them have
+// been processed.
+void ParallelFor(size_t count,
+                 const std::function<void(size_t index)>& function);
+
 // Enables the current process to set thread affinity.
 // Must be called at startup before attempting to set thread affinity.
 void EnableAffinityConfiguration();
@@ -113,6 +141,18 @@ void MaybeYield();
 // Memory barrier (request - may be ignored).
 void SyncMemory();
 
+// Futex-style waiting keyed on an address rather than on a kernel object.
+// Blocks the calling thread if the 32-bit value at the 4-byte-aligned address
+// is equal to the expected value, until another thread calls WakeByAddress*
+// for the address. The check and the blocking are atomic with respect to the
+// wakes, but the waits may end spuriously, so the caller must check the value
+// again. On Linux, the key is the underlying memory page rather than the
+// virtual address, so the wakes also reach the waiters using a different view
+// of the same shared memory; on Windows, the virtual address must be the same.
+void WaitOnAddress(volatile void* address, uint32_t expected_value);
+void WakeByAddressSingle(volatile void* address);
+void WakeByAddressAll(volatile void* address);
+
 // Sleeps the current thread for at least as long as the given duration.
 void Sleep(std::chrono::microseconds duration);
 template <typename Rep, typename Period>
@@ -120,6 +160,11 @@ void Sleep(std::chrono::duration<Rep, Period> duration) {
   Sleep(std::chrono::duration_cast<std::chrono::microseconds>(duration));
 }
 
+// Sleeps the current thread until the steady clock time, with a resolution
+// finer than the scheduler tick where the host supports it (high-resolution
+// waitable timers on Windows, clock_nanosleep on POSIX).
+void SleepUntil(std::chrono::steady_clock::time_point time);
+
 enum class SleepResult {
   kSuccess,
   kAlerted,
@@ -300,6 +345,84 @@ class Event : public WaitHandle {
   virtual void Pulse() = 0;
 };
 
+// Waits for work produced by other threads, first spinning for a while to
+// avoid the latency of waking up, then blocking until Wake is called. The
+// spinning duration adapts to how work has been arriving recently: it's doubled
+// when the work arrives soon after the thread has started blocking (during
+// bursts of work, such as the command buffer writes within a frame), and halved
+// when the thread has been waiting for long (between frames or while idle).
+class AdaptiveWaiter {
+ public:
+  struct Stats {
+    // In host ticks, see Clock::QueryHostTickFrequency.
+    uint64_t busy_ticks;
+    uint64_t spin_ticks;
+    uint64_t block_ticks;
+    // Number of waits that were ended by work while spinning or blocked.
+    uint64_t spin_wait_count;
+    uint64_t block_wait_count;
+
+    uint64_t total_ticks() const {
+      return busy_ticks + spin_ticks + block_ticks;
+    }
+  };
+
+  AdaptiveWaiter();
+
+  // To be called by the producers after making the work visible to has_work
+  // of the waiting thread with sequentially consistent atomics.
+  void Wake() {
+    if (blocked_.load()) {
+      event_->Set();
+    }
+  }
+
+  // Returns when has_work returns true, or when blocked for max_block_time,
+  // whether there's work now.
+  template <typename HasWork>
+  bool Wait(HasWork&& has_work, bool is_alertable,
+            std::chrono::milliseconds max_block_time) {
+    BeginWait();
+    for (uint32_t i = 1; !has_work(); ++i) {
+      if (!(i & 15) && IsSpinOver()) {
+        blocked_.store(true);
+        if (!has_work()) {
+          xe::threading::Wait(event_.get(), is_alertable, max_block_time);
+        }
+        blocked_.store(false);
+        EndWait(true);
+        return has_work();
+      }
+      MaybeYield();
+    }
+    EndWait(false);
+    return true;
+  }
+
+  // Can be called from any thread.
+  Stats stats() const;
+
+ private:
+  void BeginWait();
+  bool IsSpinOver() const;
+  void EndWait(bool blocked);
+
+  std::unique_ptr<Event> event_;
+  std::atomic<bool> blocked_ = {false};
+  // Accessed only by the waiting thread.
+  uint64_t spin_duration_ticks_;
+  uint64_t min_spin_duration_ticks_;
+  uint64_t max_spin_duration_ticks_;
+  uint64_t wait_start_tick_ = 0;
+  uint64_t spin_end_tick_ = 0;
+  uint64_t wait_end_tick_ = 0;
+  std::atomic<uint64_t> busy_ticks_ = {0};
+  std::atomic<uint64_t> spin_ticks_ = {0};
+  std::atomic<uint64_t> block_ticks_ = {0};
+  std::atomic<uint64_t> spin_wait_count_ = {0};
+  std::atomic<uint64_t> block_wait_count_ = {0};
+};
+
 // Models a Win32-like semaphore object.
 // https://msdn.microsoft.com/en-us/library/windows/desktop/ms682438(v=vs.85).aspx
 class Semaphore : public WaitHandle {
@@ -446,6 +569,10 @@ class Thread : public WaitHandle {
   // process of a thread.
   virtual void set_affinity_mask(uint64_t new_affinity_mask) = 0;
 
+  // Returns the CPU time the thread has spent executing in the user and the
+  // kernel mode, in microseconds, or 0 if it can't be queried.
+  virtual uint64_t QueryCpuTimeMicros() = 0;
+
   // Adds a user-mode asynchronous procedure call request to the thread queue.
   // When a user-mode APC is queued, the thread is not directed to call the APC
   // function unless it is in an alertable state. After the thread is in an
@@ -470,6 +597,121 @@ class Thread : public WaitHandle {
   std::string name_;
 };
 
+// Pool of worker threads for short CPU-bound tasks, so subsystems submit their
+// work there instead of creating their own threads and oversubscribing the host
+// cores, taking time from the guest CPU and the GPU threads. Tasks must not
+// block for long, such as for I/O or for other threads, as they'd be occupying
+// a worker all that time.
+//
+// Every worker has its own queue. The tasks submitted from a worker are put in
+// its queue and taken from it in the LIFO order, while their data is likely
+// still in the cache, and idle workers steal the oldest tasks from the queues
+// of the other workers. The tasks submitted from other threads are put in the
+// queue of the worker chosen by the affinity hint, or in the shared queue.
+class TaskScheduler {
+ public:
+  enum class Priority : uint32_t {
+    // Work that something is waiting for, such as the parts of a ParallelFor.
+    kLatencyCritical,
+    // Runs on at most half of the workers at once, so the latency-critical
+    // tasks don't have to wait for long background tasks to be completed.
+    kBackground,
+
+    kCount,
+  };
+
+  static constexpr uint32_t kNoAffinity = UINT32_MAX;
+
+  using Task = std::function<void()>;
+
+  // Tasks that can be waited for together, or continued with other tasks.
+  class TaskGroup {
+   public:
+    explicit TaskGroup(Priority priority = Priority::kLatencyCritical,
+                       TaskScheduler& scheduler = TaskScheduler::Get());
+    TaskGroup(const TaskGroup& group) = delete;
+    TaskGroup& operator=(const TaskGroup& group) = delete;
+    // Waits for the tasks of the group.
+    ~TaskGroup();
+
+    void Run(Task task, uint32_t affinity_hint = kNoAffinity);
+
+    // Waits for all the tasks of the group to be completed, running the pending
+    // tasks of the scheduler on the calling thread meanwhile.
+    void Wait();
+
+    // Submits the task once all the tasks of the group that have been run so
+    // far are completed (immediately if they already are), without waiting.
+    void Then(Task continuation);
+
+   private:
+    struct State {
+      std::mutex mutex;
+      std::condition_variable completion_cv;
+      size_t pending_task_count = 0;
+      std::vector<Task> continuations;
+    };
+
+    TaskScheduler& scheduler_;
+    Priority priority_;
+    std::shared_ptr<State> state_;
+  };
+
+  // The scheduler shared by the whole process, with a worker for every logical
+  // processor except for one, created on the first use.
+  static TaskScheduler& Get();
+
+  explicit TaskScheduler(uint32_t worker_count);
+  TaskScheduler(const TaskScheduler& scheduler) = delete;
+  TaskScheduler& operator=(const TaskScheduler& scheduler) = delete;
+  // Completes the submitted tasks and stops the workers.
+  ~TaskScheduler();
+
+  uint32_t worker_count() const { return uint32_t(workers_.size()); }
+
+  // Tasks with the same affinity hint (an arbitrary number, not a processor
+  // index) are preferably run on the same worker for the locality of their
+  // data, though they may still be stolen by other workers.
+  void Submit(Task task, Priority priority = Priority::kBackground,
+              uint32_t affinity_hint = kNoAffinity);
+
+  // Runs one of the pending tasks with the priority or a more urgent one on the
+  // calling thread, for helping to complete the tasks while waiting for them.
+  // Returns whether a task has been run.
+  bool RunPendingTask(Priority max_priority = Priority::kLatencyCritical);
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Task> queues[size_t(Priority::kCount)];
+    std::unique_ptr<Thread> thread;
+  };
+
+  // own_worker is the index of the calling worker, or UINT32_MAX.
+  bool TakeTask(uint32_t own_worker, Priority max_priority, Task& task_out,
+                Priority& priority_out);
+  bool TakeTaskWithPriority(uint32_t own_worker, Priority priority,
+                            Task& task_out);
+  void RunTask(Task& task, Priority priority);
+  bool HasRunnableTasks() const;
+  void WorkerMain(uint32_t worker_index);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  std::mutex shared_queue_mutex_;
+  std::deque<Task> shared_queues_[size_t(Priority::kCount)];
+
+  std::atomic<size_t> pending_task_counts_[size_t(Priority::kCount)] = {};
+  std::atomic<uint32_t> running_background_task_count_ = {0};
+  uint32_t max_running_background_task_count_;
+
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+  std::atomic<uint32_t> sleeping_worker_count_ = {0};
+  // Protected by sleep_mutex_.
+  bool shutting_down_ = false;
+};
+
 }  // namespace threading
 }  // namespace xe
 
@@ -11,9 +11,11 @@
 
 #include "xenia/base/assert.h"
 #include "xenia/base/chrono_steady_cast.h"
+#include "xenia/base/math.h"
 #include "xenia/base/platform.h"
 #include "xenia/base/threading_timer_queue.h"
 
+#include <linux/futex.h>
 #include <pthread.h>
 #include <sched.h>
 #include <signal.h>
@@ -24,8 +26,13 @@
 #include <unistd.h>
 #include <array>
 #include <cstddef>
+#include <cstdio>
+#include <cstdlib>
 #include <ctime>
+#include <map>
 #include <memory>
+#include <string>
+#include <utility>
 
 #if XE_PLATFORM_ANDROID
 #include <dlfcn.h>
@@ -132,6 +139,125 @@ void install_signal_handler(SignalType type) {
 // TODO(dougvj)
 void EnableAffinityConfiguration() {}
 
+// Returns an empty string if the file couldn't be read.
+static std::string ReadSysfsString(const std::string& path) {
+  std::string value;
+  FILE* file = fopen(path.c_str(), "r");
+  if (!file) {
+    return value;
+  }
+  char buffer[256];
+  size_t read_size;
+  while ((read_size = fread(buffer, 1, sizeof(buffer), file)) != 0) {
+    value.append(buffer, read_size);
+  }
+  fclose(file);
+  while (!value.empty() && (value.back() == '\n' || value.back() == ' ')) {
+    value.pop_back();
+  }
+  return value;
+}
+
+// Parses a list of processors like "0-3,8,10-11" into a mask of the first 64.
+static uint64_t ParseSysfsCpuList(const std::string& list) {
+  uint64_t mask = 0;
+  const char* position = list.c_str();
+  while (*position) {
+    char* end;
+    unsigned long first = std::strtoul(position, &end, 10);
+    if (end == position) {
+      break;
+    }
+    unsigned long last = first;
+    position = end;
+    if (*position == '-') {
+      ++position;
+      last = std::strtoul(position, &end, 10);
+      if (end == position) {
+        break;
+      }
+      position = end;
+    }
+    for (unsigned long i = first; i <= last && i < 64; ++i) {
+      mask |= uint64_t(1) << i;
+    }
+    if (*position != ',') {
+      break;
+    }
+    ++position;
+  }
+  return mask;
+}
+
+std::vector<LogicalProcessor> GetLogicalProcessors() {
+  std::vector<LogicalProcessor> processors;
+  cpu_set_t process_cpu_set;
+  CPU_ZERO(&process_cpu_set);
+  if (sched_getaffinity(0, sizeof(process_cpu_set), &process_cpu_set)) {
+    return processors;
+  }
+  // Only on hybrid Intel processors.
+  uint64_t atom_mask =
+      ParseSysfsCpuList(ReadSysfsString("/sys/devices/cpu_atom/cpus"));
+  // Only on NUMA systems.
+  std::vector<std::pair<uint32_t, uint64_t>> numa_node_masks;
+  uint64_t numa_nodes_online =
+      ParseSysfsCpuList(ReadSysfsString("/sys/devices/system/node/online"));
+  uint32_t numa_node;
+  while (xe::bit_scan_forward(numa_nodes_online, &numa_node)) {
+    numa_nodes_online &= ~(uint64_t(1) << numa_node);
+    numa_node_masks.emplace_back(
+        numa_node, ParseSysfsCpuList(ReadSysfsString(
+                       "/sys/devices/system/node/node" +
+                       std::to_string(numa_node) + "/cpulist")));
+  }
+  std::map<std::string, uint32_t> cores;
+  std::map<std::string, uint32_t> cache_groups;
+  for (uint32_t i = 0; i < 64; ++i) {
+    if (!CPU_ISSET(i, &process_cpu_set)) {
+      continue;
+    }
+    std::string cpu_path = "/sys/devices/system/cpu/cpu" + std::to_string(i);
+    std::string core_id = ReadSysfsString(cpu_path + "/topology/core_id");
+    if (core_id.empty()) {
+      return std::vector<LogicalProcessor>();
+    }
+    std::string core_key =
+        ReadSysfsString(cpu_path + "/topology/physical_package_id") + ":" +
+        core_id;
+    std::string cache_key;
+    for (uint32_t j = 3; j >= 1 && cache_key.empty(); --j) {
+      cache_key = ReadSysfsString(cpu_path + "/cache/index" +
+                                  std::to_string(j) + "/shared_cpu_list");
+    }
+    LogicalProcessor& processor = processors.emplace_back();
+    processor.index = i;
+    processor.core =
+        cores.emplace(core_key, uint32_t(cores.size())).first->second;
+    processor.cache_group =
+        cache_groups.emplace(cache_key, uint32_t(cache_groups.size()))
+            .first->second;
+    // The relative performance of the cores on ARM and some x86 systems.
+    std::string capacity = ReadSysfsString(cpu_path + "/cpu_capacity");
+    if (!capacity.empty()) {
+      processor.efficiency_class = uint32_t(std::strtoul(capacity.c_str(),
+                                                         nullptr, 10));
+    } else {
+      processor.efficiency_class =
+          (atom_mask && !(atom_mask & (uint64_t(1) << i))) ? 1 : 0;
+    }
+    processor.numa_node = 0;
+    for (const std::pair<uint32_t, uint64_t>& numa_node_mask :
+         numa_node_masks) {
+      if (numa_node_mask.second & (uint64_t(1) << i)) {
+        processor.numa_node = numa_node_mask.first;
+        break;
+      }
+    }
+  }
+  return processors;
+}
+
 // uint64_t ticks() { return mach_absolute_time(); }
 
 uint32_t current_thread_system_id() {
@@ -145,6 +271,20 @@ void MaybeYield() {
 
 void SyncMemory() { __sync_synchronize(); }
 
+// Not FUTEX_PRIVATE_FLAG so the guest memory views aliasing the same pages
+// share the futexes.
+void WaitOnAddress(volatile void* address, uint32_t expected_value) {
+  syscall(SYS_futex, address, FUTEX_WAIT, expected_value, nullptr, nullptr, 0);
+}
+
+void WakeByAddressSingle(volatile void* address) {
+  syscall(SYS_futex, address, FUTEX_WAKE, 1, nullptr, nullptr, 0);
+}
+
+void WakeByAddressAll(volatile void* address) {
+  syscall(SYS_futex, address, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
 void Sleep(std::chrono::microseconds duration) {
   timespec rqtp = DurationToTimeSpec(duration);
   timespec rmtp = {};
@@ -159,6 +299,22 @@ void Sleep(std::chrono::microseconds duration) {
   } while (ret == -1 && errno == EINTR);
 }
 
+void SleepUntil(std::chrono::steady_clock::time_point time) {
+  auto duration = time - std::chrono::steady_clock::now();
+  if (duration <= std::chrono::steady_clock::duration::zero()) {
+    return;
+  }
+  // The steady clock epoch is not necessarily the one of CLOCK_MONOTONIC.
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  timespec deadline = DurationToTimeSpec(
+      std::chrono::seconds(now.tv_sec) + std::chrono::nanoseconds(now.tv_nsec) +
+      std::chrono::duration_cast<std::chrono::nanoseconds>(duration));
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) ==
+         EINTR) {
+  }
+}
+
 // TODO(bwrsandman) Implement by allowing alert interrupts from IO operations
 thread_local bool alertable_state_ = false;
 SleepResult AlertableSleep(std::chrono::microseconds duration) {
@@ -217,22 +373,18 @@ class PosixConditionBase {
   }
 
   static std::pair<WaitResult, size_t> WaitMultiple(
-      std::vector<PosixConditionBase*>&& handles, bool wait_all,
+      PosixConditionBase* const* handles, size_t handle_count, bool wait_all,
       std::chrono::milliseconds timeout) {
-    assert_true(handles.size() > 0);
+    assert_true(handle_count > 0);
 
     // Construct a condition for all or any depending on wait_all
-    std::function<bool()> predicate;
-    {
-      using iter_t = std::vector<PosixConditionBase*>::const_iterator;
+    const auto predicate = [handles, handle_count, wait_all]() {
       const auto predicate_inner = [](auto h) { return h->signaled(); };
-      const auto operation =
-          wait_all ? std::all_of<iter_t, decltype(predicate_inner)>
-                   : std::any_of<iter_t, decltype(predicate_inner)>;
-      predicate = [&handles, operation, predicate_inner] {
-        return operation(handles.cbegin(), handles.cend(), predicate_inner);
-      };
-    }
+      return wait_all ? std::all_of(handles, handles + handle_count,
+                                    predicate_inner)
+                      : std::any_of(handles, handles + handle_count,
+                                    predicate_inner);
+    };
 
     // TODO(bwrsandman, Triang3l) This is controversial, see issue #1677
     // This will probably cause a deadlock on the next thread doing any waiting
@@ -251,7 +403,7 @@ class PosixConditionBase {
     }
     if (wait_success) {
       auto first_signaled = std::numeric_limits<size_t>::max();
-      for (auto i = 0u; i < handles.size(); ++i) {
+      for (size_t i = 0; i < handle_count; ++i) {
         if (handles[i]->signaled()) {
           if (first_signaled > i) {
             first_signaled = i;
@@ -407,7 +559,7 @@ class PosixCondition<Timer> : public PosixConditionBase {
 
     callback_ = std::move(opt_callback);
     signal_ = false;
-    wait_item_ = QueueTimerOnce(&CompletionRoutine, this, due_time);
+    wait_item_ = QueueTimerOnce(&CompletionRoutine, this, due_time, true);
   }
 
   void SetRepeating(std::chrono::steady_clock::time_point due_time,
@@ -420,7 +572,7 @@ class PosixCondition<Timer> : public PosixConditionBase {
     callback_ = std::move(opt_callback);
     signal_ = false;
     wait_item_ =
-        QueueTimerRecurring(&CompletionRoutine, this, due_time, period);
+        QueueTimerRecurring(&CompletionRoutine, this, due_time, period, true);
   }
 
   void Cancel() {
@@ -601,6 +753,21 @@ class PosixCondition<Thread> : public PosixConditionBase {
 
   uint32_t system_id() const { return static_cast<uint32_t>(thread_); }
 
+  uint64_t QueryCpuTimeMicros() {
+    WaitStarted();
+    std::unique_lock<std::mutex> lock(state_mutex_);
+    if (state_ == State::kUninitialized || state_ == State::kFinished) {
+      return 0;
+    }
+    clockid_t clock_id;
+    timespec time;
+    if (pthread_getcpuclockid(thread_, &clock_id) != 0 ||
+        clock_gettime(clock_id, &time) != 0) {
+      return 0;
+    }
+    return uint64_t(time.tv_sec) * 1000000 + uint64_t(time.tv_nsec) / 1000;
+  }
+
   uint64_t affinity_mask() {
     WaitStarted();
     cpu_set_t cpu_set;
@@ -628,7 +795,7 @@ class PosixCondition<Thread> : public PosixConditionBase {
     cpu_set_t cpu_set;
     CPU_ZERO(&cpu_set);
     for (auto i = 0u; i < 64; i++) {
-      if (mask & (1 << i)) {
+      if (mask & (uint64_t(1) << i)) {
         CPU_SET(i, &cpu_set);
       }
     }
@@ -882,17 +1049,25 @@ std::pair<WaitResult, size_t> WaitMultiple(WaitHandle* wait_handles[],
                                            size_t wait_handle_count,
                                            bool wait_all, bool is_alertable,
                                            std::chrono::milliseconds timeout) {
-  std::vector<PosixConditionBase*> conditions;
-  conditions.reserve(wait_handle_count);
+  // Not allocating for the common small waits. Not reusing a thread-local
+  // array as user callbacks may wait from within an alertable wait.
+  constexpr size_t kMaxInlineConditions = 64;
+  PosixConditionBase* conditions_inline[kMaxInlineConditions];
+  std::vector<PosixConditionBase*> conditions_heap;
+  PosixConditionBase** conditions = conditions_inline;
+  if (wait_handle_count > kMaxInlineConditions) {
+    conditions_heap.resize(wait_handle_count);
+    conditions = conditions_heap.data();
+  }
   for (size_t i = 0u; i < wait_handle_count; ++i) {
     auto handle = dynamic_cast<PosixWaitHandle*>(wait_handles[i]);
     if (handle == nullptr) {
       return std::make_pair(WaitResult::kFailed, 0);
     }
-    conditions.push_back(&handle->condition());
+    conditions[i] = &handle->condition();
   }
   if (is_alertable) alertable_state_ = true;
-  auto result = PosixConditionBase::WaitMultiple(std::move(conditions),
+  auto result = PosixConditionBase::WaitMultiple(conditions, wait_handle_count,
                                                  wait_all, timeout);
   if (is_alertable) alertable_state_ = false;
   return result;
@@ -1037,6 +1212,10 @@ class PosixThread : public PosixConditionHandle<Thread> {
 
   uint32_t system_id() const override { return handle_.system_id(); }
 
+  uint64_t QueryCpuTimeMicros() override {
+    return handle_.QueryCpuTimeMicros();
+  }
+
   uint64_t affinity_mask() override { return handle_.affinity_mask(); }
   void set_affinity_mask(uint64_t mask) override {
     handle_.set_affinity_mask(mask);
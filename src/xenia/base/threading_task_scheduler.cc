@@ -0,0 +1,332 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include <algorithm>
+#include <string>
+
+#include "xenia/base/assert.h"
+#include "xenia/base/threading.h"
+
+namespace xe {
+namespace threading {
+
+namespace {
+thread_local const TaskScheduler* current_worker_scheduler_ = nullptr;
+thread_local uint32_t current_worker_index_ = UINT32_MAX;
+}  // namespace
+
+TaskScheduler::TaskGroup::TaskGroup(Priority priority,
+                                    TaskScheduler& scheduler)
+    : scheduler_(scheduler),
+      priority_(priority),
+      state_(std::make_shared<State>()) {}
+
+TaskScheduler::TaskGroup::~TaskGroup() { Wait(); }
+
+void TaskScheduler::TaskGroup::Run(Task task, uint32_t affinity_hint) {
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    ++state_->pending_task_count;
+  }
+  scheduler_.Submit(
+      [state = state_, task = std::move(task), scheduler = &scheduler_,
+       priority = priority_]() {
+        task();
+        std::vector<Task> continuations;
+        {
+          std::lock_guard<std::mutex> lock(state->mutex);
+          if (--state->pending_task_count) {
+            return;
+          }
+          continuations = std::move(state->continuations);
+          state->continuations.clear();
+          state->completion_cv.notify_all();
+        }
+        for (Task& continuation : continuations) {
+          scheduler->Submit(std::move(continuation), priority);
+        }
+      },
+      priority_, affinity_hint);
+}
+
+void TaskScheduler::TaskGroup::Wait() {
+  while (true) {
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      if (!state_->pending_task_count) {
+        return;
+      }
+    }
+    if (scheduler_.RunPendingTask(priority_)) {
+      continue;
+    }
+    // The remaining tasks are running on the workers, or can't be taken due to
+    // the limit of the background tasks - check again periodically in case new
+    // tasks that can be run here are submitted.
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->completion_cv.wait_for(lock, std::chrono::milliseconds(1), [&]() {
+      return !state_->pending_task_count;
+    });
+  }
+}
+
+void TaskScheduler::TaskGroup::Then(Task continuation) {
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (state_->pending_task_count) {
+      state_->continuations.push_back(std::move(continuation));
+      return;
+    }
+  }
+  scheduler_.Submit(std::move(continuation), priority_);
+}
+
+TaskScheduler& TaskScheduler::Get() {
+  static TaskScheduler scheduler(
+      std::max(logical_processor_count(), uint32_t(2)) - 1);
+  return scheduler;
+}
+
+TaskScheduler::TaskScheduler(uint32_t worker_count) {
+  worker_count = std::max(worker_count, uint32_t(1));
+  max_running_background_task_count_ = std::max(worker_count / 2, uint32_t(1));
+  workers_.reserve(worker_count);
+  for (uint32_t i = 0; i < worker_count; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  // Start the threads after all the workers have been created, as they steal
+  // from each other.
+  for (uint32_t i = 0; i < worker_count; ++i) {
+    Thread::CreationParameters params;
+    params.stack_size = 1_MiB;
+    Worker& worker = *workers_[i];
+    worker.thread = Thread::Create(params, [this, i]() { WorkerMain(i); });
+    assert_not_null(worker.thread);
+    worker.thread->set_name("Task Worker " + std::to_string(i));
+  }
+}
+
+TaskScheduler::~TaskScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    shutting_down_ = true;
+  }
+  sleep_cv_.notify_all();
+  for (std::unique_ptr<Worker>& worker : workers_) {
+    Wait(worker->thread.get(), false);
+  }
+}
+
+void TaskScheduler::Submit(Task task, Priority priority,
+                           uint32_t affinity_hint) {
+  size_t priority_index = size_t(priority);
+  uint32_t worker_index = UINT32_MAX;
+  if (affinity_hint != kNoAffinity) {
+    worker_index = affinity_hint % uint32_t(workers_.size());
+  } else if (current_worker_scheduler_ == this) {
+    worker_index = current_worker_index_;
+  }
+  if (worker_index != UINT32_MAX) {
+    Worker& worker = *workers_[worker_index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.queues[priority_index].push_back(std::move(task));
+  } else {
+    std::lock_guard<std::mutex> lock(shared_queue_mutex_);
+    shared_queues_[priority_index].push_back(std::move(task));
+  }
+  // Sequentially consistent with the sleeping worker counter, so either a
+  // worker about to sleep sees the task, or the task sees the worker and wakes
+  // it up (with the mutex, so the notification is not sent between the check
+  // and the beginning of the wait).
+  pending_task_counts_[priority_index].fetch_add(1);
+  if (sleeping_worker_count_.load()) {
+    { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+    sleep_cv_.notify_one();
+  }
+}
+
+bool TaskScheduler::RunPendingTask(Priority max_priority) {
+  uint32_t own_worker =
+      current_worker_scheduler_ == this ? current_worker_index_ : UINT32_MAX;
+  Task task;
+  Priority priority;
+  if (!TakeTask(own_worker, max_priority, task, priority)) {
+    return false;
+  }
+  RunTask(task, priority);
+  return true;
+}
+
+bool TaskScheduler::TakeTask(uint32_t own_worker, Priority max_priority,
+                             Task& task_out, Priority& priority_out) {
+  if (TakeTaskWithPriority(own_worker, Priority::kLatencyCritical, task_out)) {
+    priority_out = Priority::kLatencyCritical;
+    return true;
+  }
+  if (max_priority < Priority::kBackground) {
+    return false;
+  }
+  // Reserve a slot for running a background task.
+  uint32_t running_background_task_count =
+      running_background_task_count_.load(std::memory_order_relaxed);
+  do {
+    if (running_background_task_count >= max_running_background_task_count_) {
+      return false;
+    }
+  } while (!running_background_task_count_.compare_exchange_weak(
+      running_background_task_count, running_background_task_count + 1,
+      std::memory_order_relaxed));
+  if (TakeTaskWithPriority(own_worker, Priority::kBackground, task_out)) {
+    priority_out = Priority::kBackground;
+    return true;
+  }
+  running_background_task_count_.fetch_sub(1, std::memory_order_relaxed);
+  return false;
+}
+
+bool TaskScheduler::TakeTaskWithPriority(uint32_t own_worker,
+                                         Priority priority, Task& task_out) {
+  size_t priority_index = size_t(priority);
+  if (!pending_task_counts_[priority_index].load(std::memory_order_relaxed)) {
+    return false;
+  }
+  // The newest task from the own queue.
+  if (own_worker != UINT32_MAX) {
+    Worker& worker = *workers_[own_worker];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    std::deque<Task>& queue = worker.queues[priority_index];
+    if (!queue.empty()) {
+      task_out = std::move(queue.back());
+      queue.pop_back();
+      pending_task_counts_[priority_index].fetch_sub(1);
+      return true;
+    }
+  }
+  // The oldest task submitted from outside the workers.
+  {
+    std::lock_guard<std::mutex> lock(shared_queue_mutex_);
+    std::deque<Task>& queue = shared_queues_[priority_index];
+    if (!queue.empty()) {
+      task_out = std::move(queue.front());
+      queue.pop_front();
+      pending_task_counts_[priority_index].fetch_sub(1);
+      return true;
+    }
+  }
+  // Steal the oldest task from another worker.
+  uint32_t worker_count = uint32_t(workers_.size());
+  uint32_t first_victim = own_worker != UINT32_MAX ? own_worker + 1 : 0;
+  for (uint32_t i = 0; i < worker_count; ++i) {
+    uint32_t victim = (first_victim + i) % worker_count;
+    if (victim == own_worker) {
+      continue;
+    }
+    Worker& worker = *workers_[victim];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    std::deque<Task>& queue = worker.queues[priority_index];
+    if (!queue.empty()) {
+      task_out = std::move(queue.front());
+      queue.pop_front();
+      pending_task_counts_[priority_index].fetch_sub(1);
+      return true;
+    }
+  }
+  return false;
+}
+
+void TaskScheduler::RunTask(Task& task, Priority priority) {
+  task();
+  task = nullptr;
+  if (priority == Priority::kBackground) {
+    running_background_task_count_.fetch_sub(1, std::memory_order_relaxed);
+    // A background task that couldn't be taken due to the limit may be taken
+    // now.
+    if (pending_task_counts_[size_t(Priority::kBackground)].load() &&
+        sleeping_worker_count_.load()) {
+      { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+      sleep_cv_.notify_one();
+    }
+  }
+}
+
+bool TaskScheduler::HasRunnableTasks() const {
+  return pending_task_counts_[size_t(Priority::kLatencyCritical)].load() ||
+         (pending_task_counts_[size_t(Priority::kBackground)].load() &&
+          running_background_task_count_.load() <
+              max_running_background_task_count_);
+}
+
+void TaskScheduler::WorkerMain(uint32_t worker_index) {
+  current_worker_scheduler_ = this;
+  current_worker_index_ = worker_index;
+  Task task;
+  Priority priority;
+  while (true) {
+    if (TakeTask(worker_index, Priority::kBackground, task, priority)) {
+      RunTask(task, priority);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    sleeping_worker_count_.fetch_add(1);
+    sleep_cv_.wait(lock,
+                   [this]() { return shutting_down_ || HasRunnableTasks(); });
+    sleeping_worker_count_.fetch_sub(1);
+    if (shutting_down_ && !HasRunnableTasks()) {
+      break;
+    }
+  }
+}
+
+void ParallelFor(size_t count,
+                 const std::function<void(size_t index)>& function) {
+  if (!count) {
+    return;
+  }
+  // Shared with the helper tasks, which may start after all the indices have
+  // been processed and ParallelFor has returned, in which case they must not
+  // access the function anymore.
+  struct State {
+    size_t count;
+    const std::function<void(size_t index)>* function;
+    std::atomic<size_t> next_index = {0};
+    std::atomic<size_t> completed_count = {0};
+    std::mutex completion_mutex;
+    std::condition_variable completion_cv;
+  };
+  auto state = std::make_shared<State>();
+  state->count = count;
+  state->function = &function;
+  auto process = [](State& state) {
+    size_t index;
+    while ((index = state.next_index.fetch_add(
+                1, std::memory_order_relaxed)) < state.count) {
+      (*state.function)(index);
+      if (state.completed_count.fetch_add(1, std::memory_order_acq_rel) + 1 ==
+          state.count) {
+        std::lock_guard<std::mutex> lock(state.completion_mutex);
+        state.completion_cv.notify_all();
+      }
+    }
+  };
+
+  TaskScheduler& scheduler = TaskScheduler::Get();
+  size_t helper_count = std::min(count - 1, size_t(scheduler.worker_count()));
+  for (size_t i = 0; i < helper_count; ++i) {
+    scheduler.Submit([state, process]() { process(*state); },
+                     TaskScheduler::Priority::kLatencyCritical);
+  }
+  process(*state);
+  std::unique_lock<std::mutex> lock(state->completion_mutex);
+  state->completion_cv.wait(lock, [&]() {
+    return state->completed_count.load(std::memory_order_acquire) == count;
+  });
+}
+
+}  // namespace threading
+}  // namespace xe
@@ -8,15 +8,15 @@
  */
 
 #include <algorithm>
-#include <forward_list>
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
-#include "third_party/disruptorplus/include/disruptorplus/multi_threaded_claim_strategy.hpp"
-#include "third_party/disruptorplus/include/disruptorplus/ring_buffer.hpp"
-#include "third_party/disruptorplus/include/disruptorplus/sequence_barrier.hpp"
 #include "third_party/disruptorplus/include/disruptorplus/spin_wait.hpp"
-#include "third_party/disruptorplus/include/disruptorplus/spin_wait_strategy.hpp"
 
 #include "xenia/base/assert.h"
+#include "xenia/base/math.h"
 #include "xenia/base/threading.h"
 #include "xenia/base/threading_timer_queue.h"
 
@@ -27,135 +27,366 @@ namespace threading {
 
 using WaitItem = TimerQueueWaitItem;
 
+// The wait item whose callback is being executed on the current thread, for
+// detecting disarming from the callback itself.
+thread_local WaitItem* current_callback_wait_item_ = nullptr;
+
 class TimerQueue {
  public:
   using clock = WaitItem::clock;
   static_assert(clock::is_steady);
 
  public:
-  TimerQueue()
-      : buffer_(kWaitCount),
-        wait_strategy_(),
-        claim_strategy_(kWaitCount, wait_strategy_),
-        consumed_(wait_strategy_),
-        shutdown_(false) {
-    claim_strategy_.add_claim_barrier(consumed_);
+  TimerQueue() : current_tick_(GetTick(clock::now())) {
     dispatch_thread_ = std::thread(&TimerQueue::TimerThreadMain, this);
   }
 
   ~TimerQueue() {
-    shutdown_.store(true, std::memory_order_release);
+    {
+      std::lock_guard<std::mutex> lock(queue_mutex_);
+      shutdown_ = true;
+    }
+    queue_condition_.notify_all();
+    dispatch_thread_.join();
 
-    // Kick dispatch thread to check shutdown flag
-    auto wait_item = std::make_shared<WaitItem>(nullptr, nullptr, this,
-                                                clock::time_point::min(),
-                                                clock::duration::zero());
-    wait_item->Disarm();
-    QueueTimer(std::move(wait_item));
+    {
+      std::lock_guard<std::mutex> lock(callback_mutex_);
+      callback_shutdown_ = true;
+    }
+    callback_condition_.notify_all();
+    for (std::thread& callback_thread : callback_threads_) {
+      if (callback_thread.joinable()) {
+        callback_thread.join();
+      }
+    }
 
-    dispatch_thread_.join();
+    // Release the wait items that are still queued.
+    ReleaseList(new_items_);
+    ReleaseList(callback_items_head_);
+    for (auto& level : wheel_) {
+      for (WaitItem*& slot : level) {
+        ReleaseList(slot);
+      }
+    }
   }
 
   void TimerThreadMain() {
-    dp::sequence_t next_sequence = 0;
-    const auto comp = [](const std::shared_ptr<WaitItem>& left,
-                         const std::shared_ptr<WaitItem>& right) {
-      return left->due_ < right->due_;
-    };
-
     xe::threading::set_name("xe::threading::TimerQueue");
 
-    while (!shutdown_.load(std::memory_order_relaxed)) {
-      {
-        // Consume new wait items and add them to sorted wait queue
-        dp::sequence_t available = claim_strategy_.wait_until_published(
-            next_sequence, next_sequence - 1,
-            wait_queue_.empty() ? clock::time_point::max()
-                                : wait_queue_.front()->due_);
-
-        // Check for timeout
-        if (available != next_sequence - 1) {
-          std::forward_list<std::shared_ptr<WaitItem>> wait_items;
-          do {
-            wait_items.push_front(std::move(buffer_[next_sequence]));
-          } while (next_sequence++ != available);
-
-          consumed_.publish(available);
-
-          wait_items.sort(comp);
-          wait_queue_.merge(wait_items, comp);
-        }
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    while (!shutdown_) {
+      // Add the new wait items to the wheel.
+      WaitItem* new_items = new_items_;
+      new_items_ = nullptr;
+      lock.unlock();
+      while (new_items) {
+        WaitItem* next = new_items->queue_next_;
+        Insert(new_items);
+        new_items = next;
       }
 
-      {
-        // Check wait queue, invoke callbacks and reschedule
-        std::forward_list<std::shared_ptr<WaitItem>> wait_items;
-        while (!wait_queue_.empty() &&
-               wait_queue_.front()->due_ <= clock::now()) {
-          auto wait_item = std::move(wait_queue_.front());
-          wait_queue_.pop_front();
-
-          // Ensure that it isn't disarmed
-          auto state = WaitItem::State::kIdle;
-          if (wait_item->state_.compare_exchange_strong(
-                  state, WaitItem::State::kInCallback,
-                  std::memory_order_acq_rel)) {
-            // Possibility to dispatch to a thread pool here
-            assert_not_null(wait_item->callback_);
-            wait_item->callback_(wait_item->userdata_);
-
-            if (wait_item->interval_ != clock::duration::zero() &&
-                wait_item->state_.load(std::memory_order_acquire) !=
-                    WaitItem::State::kInCallbackSelfDisarmed) {
-              // Item is recurring and didn't self-disarm during callback:
-              wait_item->due_ += wait_item->interval_;
-              wait_item->state_.store(WaitItem::State::kIdle,
-                                      std::memory_order_release);
-              wait_items.push_front(std::move(wait_item));
-            } else {
-              wait_item->state_.store(WaitItem::State::kDisarmed,
-                                      std::memory_order_release);
-            }
-          } else {
-            // Specifically, kInCallback is illegal here
-            assert_true(WaitItem::State::kDisarmed == state);
-          }
-        }
-        wait_items.sort(comp);
-        wait_queue_.merge(wait_items, comp);
+      clock::time_point now = clock::now();
+      Advance(now);
+      clock::time_point wake = GetNextDue();
+
+      lock.lock();
+      if (shutdown_ || new_items_) {
+        continue;
+      }
+      if (wake == clock::time_point::max()) {
+        queue_condition_.wait(lock);
+      } else if (wake - now > kPreciseSleepMargin) {
+        // Wait for new items or for the nearest due time coarsely, keeping
+        // the final part of the sleep precise.
+        queue_condition_.wait_until(lock, wake - kPreciseSleepMargin);
+      } else {
+        lock.unlock();
+        xe::threading::SleepUntil(wake);
+        lock.lock();
       }
     }
   }
 
   std::weak_ptr<WaitItem> QueueTimer(std::shared_ptr<WaitItem> wait_item) {
     auto wait_item_weak = std::weak_ptr<WaitItem>(wait_item);
+    WaitItem* wait_item_ptr = wait_item.get();
+    wait_item_ptr->queue_reference_ = std::move(wait_item);
+    Requeue(wait_item_ptr);
+    return wait_item_weak;
+  }
 
+ private:
+  // Resolution of the slots of the wheel. The callbacks are still executed at
+  // the precise due time, the nearest slot only needs to be searched.
+  static constexpr clock::duration kTick = std::chrono::milliseconds(1);
+  static constexpr uint32_t kSlotBits = 6;
+  static constexpr uint32_t kSlotCount = uint32_t(1) << kSlotBits;
+  static constexpr uint32_t kSlotMask = kSlotCount - 1;
+  // With 1 ms ticks, 64^4 ms is more than 4 hours. Items due later are placed
+  // in the last slot of the last level within the range and are moved
+  // further when it's reached.
+  static constexpr uint32_t kLevelCount = 4;
+  // The duration of the end of the sleep done with a high-resolution sleep
+  // rather than a wait that new items can interrupt.
+  static constexpr clock::duration kPreciseSleepMargin =
+      std::chrono::milliseconds(1);
+  static constexpr size_t kCallbackThreadCount = 2;
+
+  static uint64_t GetTick(clock::time_point time) {
+    return uint64_t(std::max(time.time_since_epoch(), clock::duration::zero()) /
+                    kTick);
+  }
+
+  static void ReleaseList(WaitItem*& head) {
+    while (head) {
+      WaitItem* next = head->queue_next_;
+      head->queue_reference_.reset();
+      head = next;
+    }
+  }
+
+  void Requeue(WaitItem* wait_item) {
     // Mitigate callback flooding
     wait_item->due_ =
         std::max(clock::now() - wait_item->interval_, wait_item->due_);
+    {
+      std::lock_guard<std::mutex> lock(queue_mutex_);
+      wait_item->queue_next_ = new_items_;
+      new_items_ = wait_item;
+    }
+    queue_condition_.notify_one();
+  }
 
-    auto sequence = claim_strategy_.claim_one();
-    buffer_[sequence] = std::move(wait_item);
-    claim_strategy_.publish(sequence);
+  // Timer thread functions.
 
-    return wait_item_weak;
+  void Insert(WaitItem* wait_item) {
+    if (wait_item->state_.load(std::memory_order_acquire) ==
+        WaitItem::State::kDisarmed) {
+      wait_item->queue_reference_.reset();
+      return;
+    }
+    uint64_t tick = std::max(GetTick(wait_item->due_), current_tick_);
+    uint64_t delta = tick - current_tick_;
+    uint32_t level = 0;
+    while (level + 1 < kLevelCount &&
+           delta >= (uint64_t(1) << (kSlotBits * (level + 1)))) {
+      ++level;
+    }
+    uint64_t level_range = uint64_t(1) << (kSlotBits * (level + 1));
+    if (delta >= level_range) {
+      tick = current_tick_ + level_range - 1;
+    }
+    uint32_t slot = uint32_t(tick >> (kSlotBits * level)) & kSlotMask;
+    wait_item->queue_next_ = wheel_[level][slot];
+    wheel_[level][slot] = wait_item;
+    occupancy_[level] |= uint64_t(1) << slot;
+  }
+
+  // Moves the items from a slot of an upper level to the lower levels.
+  void Cascade(uint32_t level, uint32_t slot) {
+    WaitItem* wait_item = wheel_[level][slot];
+    wheel_[level][slot] = nullptr;
+    occupancy_[level] &= ~(uint64_t(1) << slot);
+    while (wait_item) {
+      WaitItem* next = wait_item->queue_next_;
+      Insert(wait_item);
+      wait_item = next;
+    }
   }
 
-  const std::thread& dispatch_thread() const { return dispatch_thread_; }
+  void Advance(clock::time_point now) {
+    uint64_t now_tick = GetTick(now);
+    while (true) {
+      // The slot of the current tick may also contain items due later within
+      // the tick, which are kept until they're due.
+      ExecuteDue(current_tick_ & kSlotMask, now);
+      if (current_tick_ >= now_tick) {
+        break;
+      }
+      if (!occupancy_[0] && !occupancy_[1] && !occupancy_[2] &&
+          !occupancy_[3]) {
+        current_tick_ = now_tick;
+        continue;
+      }
+      ++current_tick_;
+      for (uint32_t level = 1; level < kLevelCount; ++level) {
+        uint64_t lower_bits = current_tick_ >> (kSlotBits * (level - 1));
+        if (lower_bits & kSlotMask) {
+          break;
+        }
+        Cascade(level, uint32_t(lower_bits >> kSlotBits) & kSlotMask);
+      }
+    }
+  }
 
- private:
-  // This ring buffer will be used to introduce timers queued by the public API
-  static constexpr size_t kWaitCount = 512;
-  dp::ring_buffer<std::shared_ptr<WaitItem>> buffer_;
-  dp::spin_wait_strategy wait_strategy_;
-  dp::multi_threaded_claim_strategy<dp::spin_wait_strategy> claim_strategy_;
-  dp::sequence_barrier<dp::spin_wait_strategy> consumed_;
-
-  // This is a _sorted_ (ascending due_) list of active timers managed by a
-  // dedicated thread
-  std::forward_list<std::shared_ptr<WaitItem>> wait_queue_;
-  std::atomic_bool shutdown_;
+  void ExecuteDue(uint32_t slot, clock::time_point now) {
+    if (!(occupancy_[0] & (uint64_t(1) << slot))) {
+      return;
+    }
+    // Sorted by the due time.
+    WaitItem* due_items = nullptr;
+    WaitItem** slot_next = &wheel_[0][slot];
+    while (WaitItem* wait_item = *slot_next) {
+      if (wait_item->state_.load(std::memory_order_acquire) ==
+          WaitItem::State::kDisarmed) {
+        *slot_next = wait_item->queue_next_;
+        wait_item->queue_reference_.reset();
+        continue;
+      }
+      if (wait_item->due_ > now) {
+        slot_next = &wait_item->queue_next_;
+        continue;
+      }
+      *slot_next = wait_item->queue_next_;
+      WaitItem** due_next = &due_items;
+      while (*due_next && (*due_next)->due_ <= wait_item->due_) {
+        due_next = &(*due_next)->queue_next_;
+      }
+      wait_item->queue_next_ = *due_next;
+      *due_next = wait_item;
+    }
+    if (!wheel_[0][slot]) {
+      occupancy_[0] &= ~(uint64_t(1) << slot);
+    }
+
+    while (due_items) {
+      WaitItem* wait_item = due_items;
+      due_items = wait_item->queue_next_;
+      wait_item->queue_next_ = nullptr;
+      if (wait_item->use_callback_pool_) {
+        QueueCallback(wait_item);
+      } else {
+        ExecuteCallback(wait_item);
+      }
+    }
+  }
+
+  // Returns the nearest due time of the items in the wheel, or the nearest
+  // time when the items need to be moved to the lower levels.
+  clock::time_point GetNextDue() const {
+    clock::time_point due = clock::time_point::max();
+    if (occupancy_[0]) {
+      uint32_t current_slot = uint32_t(current_tick_) & kSlotMask;
+      uint64_t occupancy = occupancy_[0];
+      uint64_t rotated =
+          current_slot ? (occupancy >> current_slot) |
+                             (occupancy << (kSlotCount - current_slot))
+                       : occupancy;
+      uint32_t slot = (current_slot + xe::tzcnt(rotated)) & kSlotMask;
+      for (const WaitItem* wait_item = wheel_[0][slot]; wait_item;
+           wait_item = wait_item->queue_next_) {
+        due = std::min(due, wait_item->due_);
+      }
+    }
+    for (uint32_t level = 1; level < kLevelCount; ++level) {
+      if (occupancy_[level]) {
+        due = std::min(
+            due, clock::time_point(kTick * int64_t((current_tick_ | kSlotMask) +
+                                                   1)));
+        break;
+      }
+    }
+    return due;
+  }
+
+  // Timer thread and callback thread functions.
+
+  void ExecuteCallback(WaitItem* wait_item) {
+    // Ensure that it isn't disarmed
+    auto state = WaitItem::State::kIdle;
+    if (!wait_item->state_.compare_exchange_strong(
+            state, WaitItem::State::kInCallback,
+            std::memory_order_acq_rel)) {
+      // Specifically, kInCallback is illegal here
+      assert_true(WaitItem::State::kDisarmed == state);
+      wait_item->queue_reference_.reset();
+      return;
+    }
+
+    assert_not_null(wait_item->callback_);
+    current_callback_wait_item_ = wait_item;
+    wait_item->callback_(wait_item->userdata_);
+    current_callback_wait_item_ = nullptr;
+
+    if (wait_item->interval_ != clock::duration::zero() &&
+        wait_item->state_.load(std::memory_order_acquire) !=
+            WaitItem::State::kInCallbackSelfDisarmed) {
+      // Item is recurring and didn't self-disarm during callback:
+      wait_item->due_ += wait_item->interval_;
+      wait_item->state_.store(WaitItem::State::kIdle,
+                              std::memory_order_release);
+      Requeue(wait_item);
+    } else {
+      wait_item->state_.store(WaitItem::State::kDisarmed,
+                              std::memory_order_release);
+      wait_item->queue_reference_.reset();
+    }
+  }
+
+  void QueueCallback(WaitItem* wait_item) {
+    {
+      std::lock_guard<std::mutex> lock(callback_mutex_);
+      // Only the timer thread queues the callbacks, so the threads can be
+      // created lazily without additional synchronization.
+      if (!callback_threads_[0].joinable()) {
+        for (std::thread& callback_thread : callback_threads_) {
+          callback_thread = std::thread(&TimerQueue::CallbackThreadMain, this);
+        }
+      }
+      if (callback_items_tail_) {
+        callback_items_tail_->queue_next_ = wait_item;
+      } else {
+        callback_items_head_ = wait_item;
+      }
+      callback_items_tail_ = wait_item;
+    }
+    callback_condition_.notify_one();
+  }
+
+  void CallbackThreadMain() {
+    xe::threading::set_name("xe::threading::TimerQueue Callback");
+
+    std::unique_lock<std::mutex> lock(callback_mutex_);
+    while (true) {
+      callback_condition_.wait(lock, [this] {
+        return callback_items_head_ || callback_shutdown_;
+      });
+      if (callback_shutdown_) {
+        break;
+      }
+      WaitItem* wait_item = callback_items_head_;
+      callback_items_head_ = wait_item->queue_next_;
+      if (!callback_items_head_) {
+        callback_items_tail_ = nullptr;
+      }
+      wait_item->queue_next_ = nullptr;
+      lock.unlock();
+      ExecuteCallback(wait_item);
+      lock.lock();
+    }
+  }
+
+  // Wait items queued by the public API or rescheduled after a callback,
+  // added to the wheel by the timer thread.
+  std::mutex queue_mutex_;
+  std::condition_variable queue_condition_;
+  WaitItem* new_items_ = nullptr;
+  bool shutdown_ = false;
+
+  // Managed by the timer thread. The slots of every level are singly-linked
+  // lists of the wait items, with a bit of occupancy_ set for every non-empty
+  // slot.
+  uint64_t current_tick_;
+  std::array<std::array<WaitItem*, kSlotCount>, kLevelCount> wheel_ = {};
+  std::array<uint64_t, kLevelCount> occupancy_ = {};
   std::thread dispatch_thread_;
+
+  std::mutex callback_mutex_;
+  std::condition_variable callback_condition_;
+  WaitItem* callback_items_head_ = nullptr;
+  WaitItem* callback_items_tail_ = nullptr;
+  bool callback_shutdown_ = false;
+  std::array<std::thread, kCallbackThreadCount> callback_threads_;
 };
 
 xe::threading::TimerQueue timer_queue_;
@@ -164,7 +395,7 @@ void TimerQueueWaitItem::Disarm() {
   State state;
 
   // Special case for calling from a callback itself
-  if (std::this_thread::get_id() == parent_queue_->dispatch_thread().get_id()) {
+  if (current_callback_wait_item_ == this) {
     state = State::kInCallback;
     if (state_.compare_exchange_strong(state, State::kInCallbackSelfDisarmed,
                                        std::memory_order_acq_rel)) {
@@ -178,7 +409,7 @@ void TimerQueueWaitItem::Disarm() {
   dp::spin_wait spinner;
   state = State::kIdle;
   // Classes which hold WaitItems will often call Disarm() to cancel them during
-  // destruction. This may lead to race conditions when the dispatch thread
+  // destruction. This may lead to race conditions when a callback thread
   // executes a callback which accesses memory that is freed simultaneously due
   // to this. Therefore, we need to guarantee that no callbacks will be running
   // once Disarm() has returned.
@@ -196,17 +427,20 @@ void TimerQueueWaitItem::Disarm() {
 
 std::weak_ptr<WaitItem> QueueTimerOnce(std::function<void(void*)> callback,
                                        void* userdata,
-                                       WaitItem::clock::time_point due) {
-  return timer_queue_.QueueTimer(
-      std::make_shared<WaitItem>(std::move(callback), userdata, &timer_queue_,
-                                 due, WaitItem::clock::duration::zero()));
+                                       WaitItem::clock::time_point due,
+                                       bool use_callback_pool) {
+  return timer_queue_.QueueTimer(std::make_shared<WaitItem>(
+      std::move(callback), userdata, &timer_queue_, due,
+      WaitItem::clock::duration::zero(), use_callback_pool));
 }
 
 std::weak_ptr<WaitItem> QueueTimerRecurring(
     std::function<void(void*)> callback, void* userdata,
-    WaitItem::clock::time_point due, WaitItem::clock::duration interval) {
-  return timer_queue_.QueueTimer(std::make_shared<WaitItem>(
-      std::move(callback), userdata, &timer_queue_, due, interval));
+    WaitItem::clock::time_point due, WaitItem::clock::duration interval,
+    bool use_callback_pool) {
+  return timer_queue_.QueueTimer(
+      std::make_shared<WaitItem>(std::move(callback), userdata, &timer_queue_,
+                                 due, interval, use_callback_pool));
 }
 
 }  // namespace threading
@@ -16,7 +16,12 @@
 #include <memory>
 
 // This is a platform independent implementation of a timer queue similar to
-// Windows CreateTimerQueueTimer with WT_EXECUTEINTIMERTHREAD.
+// Windows CreateTimerQueueTimer with WT_EXECUTEINTIMERTHREAD. The wait items
+// are kept in a hierarchical timing wheel managed by a dedicated thread, which
+// sleeps with high resolution until the nearest due time. Callbacks are
+// executed on the timer thread in the order of their due times, or, if
+// requested, on a small pool of callback threads, so long callbacks of some
+// timers don't delay the others.
 
 namespace xe::threading {
 
@@ -27,12 +32,13 @@ struct TimerQueueWaitItem {
 
   TimerQueueWaitItem(std::function<void(void*)> callback, void* userdata,
                      TimerQueue* parent_queue, clock::time_point due,
-                     clock::duration interval)
+                     clock::duration interval, bool use_callback_pool)
       : callback_(std::move(callback)),
         userdata_(userdata),
         parent_queue_(parent_queue),
         due_(due),
         interval_(interval),
+        use_callback_pool_(use_callback_pool),
         state_(State::kIdle) {}
 
   // Cancel the pending wait item. No callbacks will be running after this call.
@@ -60,12 +66,21 @@ struct TimerQueueWaitItem {
   TimerQueue* parent_queue_;
   clock::time_point due_;
   clock::duration interval_;  // zero if not recurring
+  bool use_callback_pool_;
   std::atomic<State> state_;
+
+  // Owned by the queue while the item is queued. The queue's lists are
+  // intrusive, so no allocations are made when the item is scheduled.
+  std::shared_ptr<TimerQueueWaitItem> queue_reference_;
+  TimerQueueWaitItem* queue_next_ = nullptr;
 };
 
+// With use_callback_pool, the callback is executed on one of the callback
+// threads rather than on the timer thread, and may run concurrently with the
+// callbacks of other wait items.
 std::weak_ptr<TimerQueueWaitItem> QueueTimerOnce(
     std::function<void(void*)> callback, void* userdata,
-    TimerQueueWaitItem::clock::time_point due);
+    TimerQueueWaitItem::clock::time_point due, bool use_callback_pool = false);
 
 // Callback is first executed at due, then again repeatedly after interval
 // passes (unless interval == 0). The first callback will be scheduled at
@@ -73,7 +88,8 @@ std::weak_ptr<TimerQueueWaitItem> QueueTimerOnce(
 std::weak_ptr<TimerQueueWaitItem> QueueTimerRecurring(
     std::function<void(void*)> callback, void* userdata,
     TimerQueueWaitItem::clock::time_point due,
-    TimerQueueWaitItem::clock::duration interval);
+    TimerQueueWaitItem::clock::duration interval,
+    bool use_callback_pool = false);
 }  // namespace xe::threading
 
 #endif
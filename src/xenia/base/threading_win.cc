@@ -7,13 +7,20 @@
  ******************************************************************************
  */
 
+#include <algorithm>
+
 #include "xenia/base/assert.h"
 #include "xenia/base/chrono_steady_cast.h"
 #include "xenia/base/logging.h"
+#include "xenia/base/math.h"
 #include "xenia/base/platform_win.h"
 #include "xenia/base/threading.h"
 #include "xenia/base/threading_timer_queue.h"
 
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
 #define LOG_LASTERROR() \
   { XELOGI("Win32 Error 0x{:08X} in " __FUNCTION__ "(...)", GetLastError()); }
 
@@ -32,6 +39,96 @@ void EnableAffinityConfiguration() {
   SetProcessAffinityMask(process_handle, system_affinity_mask);
 }
 
+std::vector<LogicalProcessor> GetLogicalProcessors() {
+  std::vector<LogicalProcessor> processors;
+  DWORD_PTR process_affinity_mask, system_affinity_mask;
+  if (!GetProcessAffinityMask(GetCurrentProcess(), &process_affinity_mask,
+                              &system_affinity_mask)) {
+    return processors;
+  }
+  DWORD buffer_size = 0;
+  if (GetLogicalProcessorInformationEx(RelationAll, nullptr, &buffer_size) ||
+      GetLastError() != ERROR_INSUFFICIENT_BUFFER) {
+    return processors;
+  }
+  std::vector<uint8_t> buffer(buffer_size);
+  if (!GetLogicalProcessorInformationEx(
+          RelationAll,
+          reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(
+              buffer.data()),
+          &buffer_size)) {
+    return processors;
+  }
+  uint32_t core_count = 0;
+  BYTE cache_level = 0;
+  std::vector<KAFFINITY> cache_masks;
+  std::vector<std::pair<uint32_t, KAFFINITY>> numa_node_masks;
+  for (DWORD offset = 0; offset < buffer_size;) {
+    auto& info =
+        *reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(
+            buffer.data() + offset);
+    offset += info.Size;
+    if (info.Relationship == RelationProcessorCore) {
+      const PROCESSOR_RELATIONSHIP& core = info.Processor;
+      for (WORD i = 0; i < core.GroupCount; ++i) {
+        if (core.GroupMask[i].Group) {
+          continue;
+        }
+        uint64_t mask = core.GroupMask[i].Mask & process_affinity_mask;
+        uint32_t index;
+        while (xe::bit_scan_forward(mask, &index)) {
+          mask &= ~(uint64_t(1) << index);
+          LogicalProcessor& processor = processors.emplace_back();
+          processor.index = index;
+          processor.core = core_count;
+          processor.cache_group = 0;
+          processor.efficiency_class = core.EfficiencyClass;
+          processor.numa_node = 0;
+        }
+      }
+      ++core_count;
+    } else if (info.Relationship == RelationCache) {
+      const CACHE_RELATIONSHIP& cache = info.Cache;
+      if (cache.Type != CacheUnified && cache.Type != CacheData) {
+        continue;
+      }
+      if (cache.Level > cache_level) {
+        cache_level = cache.Level;
+        cache_masks.clear();
+      }
+      if (cache.Level == cache_level && !cache.GroupMask.Group) {
+        cache_masks.push_back(cache.GroupMask.Mask);
+      }
+    } else if (info.Relationship == RelationNumaNode) {
+      const NUMA_NODE_RELATIONSHIP& numa_node = info.NumaNode;
+      if (!numa_node.GroupMask.Group) {
+        numa_node_masks.emplace_back(uint32_t(numa_node.NodeNumber),
+                                     numa_node.GroupMask.Mask);
+      }
+    }
+  }
+  for (LogicalProcessor& processor : processors) {
+    for (size_t i = 0; i < cache_masks.size(); ++i) {
+      if (cache_masks[i] & (KAFFINITY(1) << processor.index)) {
+        processor.cache_group = uint32_t(i);
+        break;
+      }
+    }
+    for (const std::pair<uint32_t, KAFFINITY>& numa_node_mask :
+         numa_node_masks) {
+      if (numa_node_mask.second & (KAFFINITY(1) << processor.index)) {
+        processor.numa_node = numa_node_mask.first;
+        break;
+      }
+    }
+  }
+  std::sort(processors.begin(), processors.end(),
+            [](const LogicalProcessor& a, const LogicalProcessor& b) {
+              return a.index < b.index;
+            });
+  return processors;
+}
+
 uint32_t current_thread_system_id() {
   return static_cast<uint32_t>(GetCurrentThreadId());
 }
@@ -86,6 +183,18 @@ void MaybeYield() {
 
 void SyncMemory() { MemoryBarrier(); }
 
+void WaitOnAddress(volatile void* address, uint32_t expected_value) {
+  ::WaitOnAddress(address, &expected_value, sizeof(expected_value), INFINITE);
+}
+
+void WakeByAddressSingle(volatile void* address) {
+  ::WakeByAddressSingle(const_cast<void*>(address));
+}
+
+void WakeByAddressAll(volatile void* address) {
+  ::WakeByAddressAll(const_cast<void*>(address));
+}
+
 void Sleep(std::chrono::microseconds duration) {
   if (duration.count() < 100) {
     MaybeYield();
@@ -94,6 +203,43 @@ void Sleep(std::chrono::microseconds duration) {
   }
 }
 
+void SleepUntil(std::chrono::steady_clock::time_point time) {
+  auto duration = time - std::chrono::steady_clock::now();
+  if (duration <= std::chrono::steady_clock::duration::zero()) {
+    return;
+  }
+  // High-resolution waitable timers are available since Windows 10 1803, fall
+  // back to the regular sleep on older versions.
+  struct WaitableTimer {
+    WaitableTimer()
+        : handle(CreateWaitableTimerExW(
+              nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION,
+              TIMER_ALL_ACCESS)) {}
+    ~WaitableTimer() {
+      if (handle) {
+        CloseHandle(handle);
+      }
+    }
+    HANDLE handle;
+  };
+  thread_local WaitableTimer timer;
+  if (!timer.handle) {
+    Sleep(std::chrono::duration_cast<std::chrono::microseconds>(duration));
+    return;
+  }
+  LARGE_INTEGER due_time;
+  // Negative for relative time, in 100 ns units, rounded up.
+  using hundrednanoseconds =
+      std::chrono::duration<int64_t, std::ratio<1, 10000000>>;
+  due_time.QuadPart = -std::max(
+      int64_t(1), std::chrono::ceil<hundrednanoseconds>(duration).count());
+  if (!SetWaitableTimer(timer.handle, &due_time, 0, nullptr, nullptr, FALSE)) {
+    Sleep(std::chrono::duration_cast<std::chrono::microseconds>(duration));
+    return;
+  }
+  WaitForSingleObject(timer.handle, INFINITE);
+}
+
 SleepResult AlertableSleep(std::chrono::microseconds duration) {
   if (SleepEx(static_cast<DWORD>(duration.count() / 1000), TRUE) ==
       WAIT_IO_COMPLETION) {
@@ -178,18 +324,22 @@ std::pair<WaitResult, size_t> WaitMultiple(WaitHandle* wait_handles[],
                                            size_t wait_handle_count,
                                            bool wait_all, bool is_alertable,
                                            std::chrono::milliseconds timeout) {
-  std::vector<HANDLE> handles(wait_handle_count);
+  // WaitForMultipleObjectsEx doesn't support more handles anyway.
+  if (wait_handle_count > MAXIMUM_WAIT_OBJECTS) {
+    return std::pair<WaitResult, size_t>(WaitResult::kFailed, 0);
+  }
+  HANDLE handles[MAXIMUM_WAIT_OBJECTS];
   for (size_t i = 0; i < wait_handle_count; ++i) {
     handles[i] = wait_handles[i]->native_handle();
   }
   DWORD result = WaitForMultipleObjectsEx(
-      DWORD(handles.size()), handles.data(), wait_all ? TRUE : FALSE,
+      DWORD(wait_handle_count), handles, wait_all ? TRUE : FALSE,
       DWORD(timeout.count()), is_alertable ? TRUE : FALSE);
-  if (result >= WAIT_OBJECT_0 && result < WAIT_OBJECT_0 + handles.size()) {
+  if (result >= WAIT_OBJECT_0 && result < WAIT_OBJECT_0 + wait_handle_count) {
     return std::pair<WaitResult, size_t>(WaitResult::kSuccess,
                                          result - WAIT_OBJECT_0);
   } else if (result >= WAIT_ABANDONED_0 &&
-             result < WAIT_ABANDONED_0 + handles.size()) {
+             result < WAIT_ABANDONED_0 + wait_handle_count) {
     return std::pair<WaitResult, size_t>(WaitResult::kAbandoned,
                                          result - WAIT_ABANDONED_0);
   }
@@ -406,6 +556,20 @@ class Win32Thread : public Win32Handle<Thread> {
     SetThreadAffinityMask(handle_, new_affinity_mask);
   }
 
+  uint64_t QueryCpuTimeMicros() override {
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    if (!GetThreadTimes(handle_, &creation_time, &exit_time, &kernel_time,
+                        &user_time)) {
+      return 0;
+    }
+    // In 100-nanosecond intervals.
+    return ((uint64_t(kernel_time.dwHighDateTime) << 32 |
+             kernel_time.dwLowDateTime) +
+            (uint64_t(user_time.dwHighDateTime) << 32 |
+             user_time.dwLowDateTime)) /
+           10;
+  }
+
   struct ApcData {
     std::function<void()> callback;
   };
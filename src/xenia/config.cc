@@ -246,4 +246,50 @@ void LoadGameConfig(const std::string_view title_id) {
   }
 }
 
+bool UpdateGameConfig(
+    const std::string_view title_id,
+    const std::vector<std::pair<std::string, std::string>>& values) {
+  if (config_folder.empty()) {
+    return false;
+  }
+  const auto game_config_folder = config_folder / "config";
+  const auto game_config_path =
+      game_config_folder / (std::string(title_id) + game_config_suffix);
+  std::shared_ptr<cpptoml::table> config;
+  try {
+    config = std::filesystem::exists(game_config_path)
+                 ? ParseFile(game_config_path)
+                 : cpptoml::make_table();
+    for (const auto& value : values) {
+      size_t category_end = value.first.find('.');
+      assert_true(category_end != std::string::npos);
+      std::string category = value.first.substr(0, category_end);
+      std::string name = value.first.substr(category_end + 1);
+      std::istringstream value_stream("value = " + value.second);
+      auto value_table = cpptoml::parser(value_stream).parse();
+      auto category_table = config->get_table(category);
+      if (!category_table) {
+        category_table = cpptoml::make_table();
+        config->insert(category, category_table);
+      }
+      category_table->insert(name, value_table->get("value"));
+    }
+  } catch (cpptoml::parse_exception e) {
+    XELOGE("Failed to update the game config '{}': {}",
+           xe::path_to_utf8(game_config_path), e.what());
+    return false;
+  }
+  // The comments in the file are not preserved by cpptoml.
+  xe::filesystem::CreateParentFolder(game_config_path);
+  std::ofstream file(game_config_path, std::ios::trunc);
+  if (!file.is_open()) {
+    XELOGE("Failed to open '{}' for writing.",
+           xe::path_to_utf8(game_config_path));
+    return false;
+  }
+  file << *config;
+  XELOGI("Updated game config: {}", xe::path_to_utf8(game_config_path));
+  return true;
+}
+
 }  // namespace config
@@ -11,11 +11,22 @@
 #define XENIA_CONFIG_H_
 
 #include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace config {
 void SetupConfig(const std::filesystem::path& config_folder);
 void LoadGameConfig(const std::string_view title_id);
 void SaveConfig();
+// Sets the values of the options (qualified "category.name" keys and TOML
+// values) in the per-game config file of the title, keeping the other options
+// in it, to be loaded on the next launches of the title. Returns false if
+// failed to update the file.
+bool UpdateGameConfig(
+    const std::string_view title_id,
+    const std::vector<std::pair<std::string, std::string>>& values);
 }  // namespace config
 
 #endif  // XENIA_CONFIG_H_
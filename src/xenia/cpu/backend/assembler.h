@@ -41,6 +41,11 @@ class Assembler {
                         uint32_t debug_info_flags,
                         std::unique_ptr<FunctionDebugInfo> debug_info) = 0;
 
+  // Sets up the function with machine code generated in a previous run, if the
+  // backend has persistent code storage containing it. The extents of the
+  // function must be known already.
+  virtual bool AssembleStored(GuestFunction* function) { return false; }
+
  protected:
   Backend* backend_;
 };
@@ -10,6 +10,7 @@
 #ifndef XENIA_CPU_BACKEND_BACKEND_H_
 #define XENIA_CPU_BACKEND_BACKEND_H_
 
+#include <filesystem>
 #include <memory>
 
 #include "xenia/cpu/backend/machine_info.h"
@@ -22,6 +23,7 @@ class Function;
 class GuestFunction;
 class Module;
 class Processor;
+class ThreadState;
 }  // namespace cpu
 }  // namespace xe
 
@@ -43,17 +45,30 @@ class Backend {
 
   virtual bool Initialize(Processor* processor);
 
-  virtual void* AllocThreadData();
+  // Called when the thread state has been initialized, and before it's
+  // destroyed if the returned data is not null.
+  virtual void* AllocThreadData(ThreadState* thread_state);
   virtual void FreeThreadData(void* thread_data);
 
   virtual void CommitExecutableRange(uint32_t guest_low,
                                      uint32_t guest_high) = 0;
 
+  // Opens the persistent storage of generated code for the title, if the
+  // backend supports it and it's enabled.
+  virtual void InitializeCodeStorage(const std::filesystem::path& cache_root,
+                                     uint32_t title_id) {}
+  virtual void ShutdownCodeStorage() {}
+
   virtual std::unique_ptr<Assembler> CreateAssembler() = 0;
 
   virtual std::unique_ptr<GuestFunction> CreateGuestFunction(
       Module* module, uint32_t address) = 0;
 
+  // Makes the following calls of a function, which may be executing on other
+  // threads, go through Processor::ResolveFunction instead of to its current
+  // machine code, once its guest code has been modified.
+  virtual void InvalidateFunction(GuestFunction* function) {}
+
   // Calculates the next host instruction based on the current thread state and
   // current PC. This will look for branches and other control flow
   // instructions.
@@ -10,6 +10,7 @@ project("xenia-cpu-backend-x64")
     "capstone",
     "fmt",
     "xenia-base",
+    "xxhash",
     "xenia-cpu",
   })
   defines({
@@ -10,6 +10,7 @@
 #include "xenia/cpu/backend/x64/x64_assembler.h"
 
 #include <climits>
+#include <cstring>
 
 #include "third_party/capstone/include/capstone/capstone.h"
 #include "third_party/capstone/include/capstone/x86.h"
@@ -18,6 +19,8 @@
 #include "xenia/base/string.h"
 #include "xenia/cpu/backend/x64/x64_backend.h"
 #include "xenia/cpu/backend/x64/x64_code_cache.h"
+#include "xenia/cpu/backend/x64/x64_code_storage.h"
+#include "xenia/cpu/backend/x64/x64_constant_pool.h"
 #include "xenia/cpu/backend/x64/x64_emitter.h"
 #include "xenia/cpu/backend/x64/x64_function.h"
 #include "xenia/cpu/cpu_flags.h"
@@ -78,22 +81,25 @@ bool X64Assembler::Assemble(GuestFunction* function, HIRBuilder* builder,
   // Lower HIR -> x64.
   void* machine_code = nullptr;
   size_t code_size = 0;
+  std::vector<SourceMapEntry> source_map;
   if (!emitter_->Emit(function, builder, debug_info_flags, debug_info.get(),
-                      &machine_code, &code_size, &function->source_map())) {
+                      &machine_code, &code_size, &source_map)) {
     return false;
   }
+  function->set_source_map(source_map);
 
   // Stash generated machine code.
   if (debug_info_flags & DebugInfoFlags::kDebugInfoDisasmMachineCode) {
-    DumpMachineCode(machine_code, code_size, function->source_map(),
-                    &string_buffer_);
+    DumpMachineCode(machine_code, code_size, source_map, &string_buffer_);
     debug_info->set_machine_code_disasm(xe_strdup(string_buffer_.buffer()));
     string_buffer_.Reset();
   }
 
   function->set_debug_info(std::move(debug_info));
+  // Baseline code counts its frames (see X64Emitter::EmitFrameCountEnter).
   static_cast<X64Function*>(function)->Setup(
-      reinterpret_cast<uint8_t*>(machine_code), code_size);
+      reinterpret_cast<uint8_t*>(machine_code), code_size,
+      function->tier() == GuestFunction::Tier::kBaseline);
 
   // Install into indirection table.
   uint64_t host_address = reinterpret_cast<uint64_t>(machine_code);
@@ -102,6 +108,64 @@ bool X64Assembler::Assemble(GuestFunction* function, HIRBuilder* builder,
       ->AddIndirection(function->address(),
                        static_cast<uint32_t>(host_address));
 
+  // Free the code replaced earlier if possible now, not only when replacing
+  // more.
+  x64_backend_->ReclaimRetiredCode();
+
+  return true;
+}
+
+bool X64Assembler::AssembleStored(GuestFunction* function) {
+  X64CodeStorage* code_storage = x64_backend_->code_storage();
+  if (!code_storage) {
+    return false;
+  }
+  SCOPE_profile_cpu_f("cpu");
+
+  X64CodeStorage::StoredFunction stored_function;
+  if (!code_storage->LoadFunction(function,
+                                  X64CodeStorage::HashGuestCode(function),
+                                  stored_function)) {
+    return false;
+  }
+
+  // Add the constants to the pool of this run, which may be placed elsewhere.
+  X64ConstantPool* constant_pool = x64_backend_->constant_pool();
+  for (const X64CodeStorage::ConstantReference& reference :
+       stored_function.constant_references) {
+    uint32_t address =
+        constant_pool ? constant_pool->GetConstantAddress(vec128q(
+                            reference.value_low, reference.value_high))
+                      : 0;
+    if (!address) {
+      return false;
+    }
+    std::memcpy(stored_function.code.data() + reference.code_offset, &address,
+                sizeof(address));
+  }
+
+  auto code_cache = x64_backend_->code_cache();
+  void* code_execute_address;
+  void* code_write_address;
+  // Also installs the function into the indirection table.
+  code_cache->PlaceGuestCode(function->address(), stored_function.code.data(),
+                             stored_function.func_info, function,
+                             code_execute_address, code_write_address,
+                             &stored_function.source_map);
+  function->set_source_map(stored_function.source_map);
+  // Link the calls like X64Emitter::Emit does for newly emitted code.
+  Processor* processor = backend_->processor();
+  for (const X64CodeStorage::CallSite& call_site : stored_function.call_sites) {
+    Function* callee = processor->LookupFunction(call_site.guest_address);
+    if (callee && callee->is_guest()) {
+      static_cast<X64Function*>(callee)->AddCallSite(
+          reinterpret_cast<uint8_t*>(code_execute_address) +
+          call_site.code_offset);
+    }
+  }
+  static_cast<X64Function*>(function)->Setup(
+      reinterpret_cast<uint8_t*>(code_execute_address),
+      stored_function.func_info.code_size.total, false);
   return true;
 }
 
@@ -10,21 +10,31 @@
 #include "xenia/cpu/backend/x64/x64_backend.h"
 
 #include <stddef.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 #include "third_party/capstone/include/capstone/capstone.h"
 #include "third_party/capstone/include/capstone/x86.h"
 
+#include "build/version.h"
 #include "xenia/base/exception_handler.h"
 #include "xenia/base/logging.h"
+#include "xenia/base/math.h"
+#include "xenia/base/xxhash.h"
 #include "xenia/cpu/backend/x64/x64_assembler.h"
 #include "xenia/cpu/backend/x64/x64_code_cache.h"
+#include "xenia/cpu/backend/x64/x64_code_storage.h"
+#include "xenia/cpu/backend/x64/x64_constant_pool.h"
 #include "xenia/cpu/backend/x64/x64_emitter.h"
 #include "xenia/cpu/backend/x64/x64_function.h"
 #include "xenia/cpu/backend/x64/x64_sequences.h"
 #include "xenia/cpu/backend/x64/x64_stack_layout.h"
 #include "xenia/cpu/breakpoint.h"
+#include "xenia/cpu/cpu_flags.h"
 #include "xenia/cpu/processor.h"
 #include "xenia/cpu/stack_walker.h"
+#include "xenia/cpu/thread_state.h"
 
 DEFINE_int32(x64_extension_mask, -1,
              "Allow the detection and utilization of specific instruction set "
@@ -45,6 +55,33 @@ DEFINE_int32(x64_extension_mask, -1,
              " 4096 = AVX512VBMI\n"
              "   -1 = Detect and utilize all possible processor features\n",
              "x64");
+DEFINE_bool(x64_code_storage, false,
+            "Store the machine code generated for guest functions in the cache "
+            "root and reuse it in later runs of the same title instead of "
+            "translating the functions again. Functions whose guest code has "
+            "changed are translated again.",
+            "x64");
+DEFINE_uint32(x64_indirect_call_cache_size, 2,
+              "Number of targets (up to 4) remembered at every indirect call "
+              "site to call them directly instead of through the indirection "
+              "table. 0 to disable.",
+              "x64");
+DEFINE_bool(x64_indirect_call_cache_counters, false,
+            "Count the calls from every indirect call site that hit or miss "
+            "its cache, shown in the log when the emulator exits. Disables "
+            "the persistent code storage.",
+            "x64");
+DEFINE_bool(x64_instrumentation_counters, false,
+            "Count the calls from the generated code to native helpers, and "
+            "the traps and unimplemented instructions reached in it, per HIR "
+            "opcode, shown in the log when the emulator exits. Disables the "
+            "persistent code storage.",
+            "x64");
+DEFINE_bool(x64_patch_mmio_fault_sites, true,
+            "Replace loads and stores in the generated code that have caused "
+            "an exception by accessing MMIO with calls to a software access "
+            "path, so later accesses from them don't cause exceptions.",
+            "x64");
 
 namespace xe {
 namespace cpu {
@@ -58,6 +95,9 @@ class X64ThunkEmitter : public X64Emitter {
   HostToGuestThunk EmitHostToGuestThunk();
   GuestToHostThunk EmitGuestToHostThunk();
   ResolveFunctionThunk EmitResolveFunctionThunk();
+  // Stub for a host load or store that has accessed MMIO, called instead of
+  // the instruction (see X64Backend::PatchMMIOFaultSite).
+  void* EmitMMIOFaultSiteStub(const MMIOHandler::DecodedLoadStore& decoded);
 
  private:
   // The following four functions provide save/load functionality for registers.
@@ -79,12 +119,27 @@ X64Backend::X64Backend() : Backend(), code_cache_(nullptr) {
 }
 
 X64Backend::~X64Backend() {
+  if (cvars::x64_indirect_call_cache_counters) {
+    DumpIndirectCallCacheCounters();
+  }
+  if (cvars::x64_instrumentation_counters) {
+    DumpInstrumentationCounters();
+  }
+
+  code_storage_.reset();
+
   if (capstone_handle_) {
     cs_close(&capstone_handle_);
   }
 
   X64Emitter::FreeConstData(emitter_data_);
   ExceptionHandler::Uninstall(&ExceptionCallbackThunk, this);
+  if (mmio_fault_site_callback_installed_) {
+    MMIOHandler* mmio_handler = MMIOHandler::global_handler();
+    if (mmio_handler) {
+      mmio_handler->SetFaultSiteCallback(nullptr, nullptr);
+    }
+  }
 }
 
 bool X64Backend::Initialize(Processor* processor) {
@@ -121,6 +176,7 @@ bool X64Backend::Initialize(Processor* processor) {
 
   code_cache_ = X64CodeCache::Create();
   Backend::code_cache_ = code_cache_.get();
+  code_cache_->set_host_numa_node(processor()->memory()->host_numa_node());
   if (!code_cache_->Initialize()) {
     return false;
   }
@@ -131,6 +187,7 @@ bool X64Backend::Initialize(Processor* processor) {
   host_to_guest_thunk_ = thunk_emitter.EmitHostToGuestThunk();
   guest_to_host_thunk_ = thunk_emitter.EmitGuestToHostThunk();
   resolve_function_thunk_ = thunk_emitter.EmitResolveFunctionThunk();
+  emitter_feature_flags_ = thunk_emitter.feature_flags();
 
   // Set the code cache to use the ResolveFunction thunk for default
   // indirections.
@@ -143,10 +200,22 @@ bool X64Backend::Initialize(Processor* processor) {
 
   // Allocate emitter constant data.
   emitter_data_ = X64Emitter::PlaceConstData();
+  constant_pool_ = std::make_unique<X64ConstantPool>();
+  if (!constant_pool_->Initialize()) {
+    XELOGW("Failed to reserve the x64 constant pool");
+  }
 
   // Setup exception callback
   ExceptionHandler::Install(&ExceptionCallbackThunk, this);
 
+  if (cvars::x64_patch_mmio_fault_sites) {
+    MMIOHandler* mmio_handler = MMIOHandler::global_handler();
+    if (mmio_handler) {
+      mmio_handler->SetFaultSiteCallback(&MMIOFaultSiteCallbackThunk, this);
+      mmio_fault_site_callback_installed_ = true;
+    }
+  }
+
   return true;
 }
 
@@ -155,6 +224,49 @@ void X64Backend::CommitExecutableRange(uint32_t guest_low,
   code_cache_->CommitExecutableRange(guest_low, guest_high);
 }
 
+X64CodeStorage* X64Backend::code_storage() const {
+  return code_storage_ && code_storage_->is_open() ? code_storage_.get()
+                                                   : nullptr;
+}
+
+void X64Backend::InitializeCodeStorage(const std::filesystem::path& cache_root,
+                                       uint32_t title_id) {
+  ShutdownCodeStorage();
+  if (!cvars::x64_code_storage) {
+    return;
+  }
+  // Traced code references per-run data and can't be stored.
+  if (cvars::trace_functions || cvars::trace_function_coverage ||
+      cvars::trace_function_references || cvars::trace_function_data) {
+    XELOGW("x64 code storage is disabled while function tracing is enabled");
+    return;
+  }
+  // Stored code from earlier runs wouldn't be counted.
+  if (cvars::x64_instrumentation_counters) {
+    XELOGW(
+        "x64 code storage is disabled while instrumentation counters are "
+        "enabled");
+    return;
+  }
+  X64CodeStorage::Layout layout = {};
+  layout.build_hash = XXH3_64bits(XE_BUILD_COMMIT, sizeof(XE_BUILD_COMMIT));
+  layout.feature_flags = emitter_feature_flags_;
+  layout.emitter_data = uint32_t(emitter_data_);
+  layout.host_to_guest_thunk = uint32_t(uint64_t(host_to_guest_thunk_));
+  layout.guest_to_host_thunk = uint32_t(uint64_t(guest_to_host_thunk_));
+  layout.resolve_function_thunk = uint32_t(uint64_t(resolve_function_thunk_));
+  if (!code_storage_) {
+    code_storage_ = std::make_unique<X64CodeStorage>();
+  }
+  code_storage_->Initialize(cache_root, title_id, layout);
+}
+
+void X64Backend::ShutdownCodeStorage() {
+  if (code_storage_) {
+    code_storage_->Shutdown();
+  }
+}
+
 std::unique_ptr<Assembler> X64Backend::CreateAssembler() {
   return std::make_unique<X64Assembler>(this);
 }
@@ -164,6 +276,14 @@ std::unique_ptr<GuestFunction> X64Backend::CreateGuestFunction(
   return std::make_unique<X64Function>(module, address);
 }
 
+void X64Backend::InvalidateFunction(GuestFunction* function) {
+  // Both are linked again when the function is translated again (see
+  // X64Assembler::Assemble). Threads already executing the old code finish
+  // it, and it's freed like replaced baseline code if it counts its frames.
+  code_cache_->RemoveIndirection(function->address());
+  static_cast<X64Function*>(function)->UnlinkCallSites();
+}
+
 uint64_t ReadCapstoneReg(HostThreadContext* context, x86_reg reg) {
   switch (reg) {
     case X86_REG_RAX:
@@ -387,6 +507,151 @@ void X64Backend::UninstallBreakpoint(Breakpoint* breakpoint) {
   breakpoint->backend_data().clear();
 }
 
+X64Backend::IndirectCallCacheCounters*
+X64Backend::AllocateIndirectCallCacheCounters(uint32_t guest_address,
+                                              uint32_t entry_count) {
+  std::lock_guard<std::mutex> lock(indirect_call_cache_counters_mutex_);
+  IndirectCallCacheCounters& counters =
+      indirect_call_cache_counters_.emplace_back();
+  counters.guest_address = guest_address;
+  counters.entry_count = entry_count;
+  return &counters;
+}
+
+void X64Backend::DumpIndirectCallCacheCounters() {
+  std::lock_guard<std::mutex> lock(indirect_call_cache_counters_mutex_);
+  std::vector<const IndirectCallCacheCounters*> sorted_counters;
+  sorted_counters.reserve(indirect_call_cache_counters_.size());
+  uint64_t total_hits = 0, total_misses = 0;
+  for (const IndirectCallCacheCounters& counters :
+       indirect_call_cache_counters_) {
+    for (uint32_t i = 0; i < counters.entry_count; ++i) {
+      total_hits += counters.hits[i];
+    }
+    total_misses += counters.misses;
+    sorted_counters.push_back(&counters);
+  }
+  auto get_calls = [](const IndirectCallCacheCounters* counters) {
+    uint64_t calls = counters->misses;
+    for (uint32_t i = 0; i < counters->entry_count; ++i) {
+      calls += counters->hits[i];
+    }
+    return calls;
+  };
+  std::sort(sorted_counters.begin(), sorted_counters.end(),
+            [&get_calls](const IndirectCallCacheCounters* a,
+                         const IndirectCallCacheCounters* b) {
+              return get_calls(a) > get_calls(b);
+            });
+  XELOGI("Indirect call caches: {} sites, {} hits, {} misses",
+         sorted_counters.size(), total_hits, total_misses);
+  for (size_t i = 0; i < std::min(sorted_counters.size(), size_t(32)); ++i) {
+    const IndirectCallCacheCounters& counters = *sorted_counters[i];
+    XELOGI("  {:08X}: hits {} {} {} {}, misses {}", counters.guest_address,
+           counters.hits[0], counters.hits[1], counters.hits[2],
+           counters.hits[3], counters.misses);
+  }
+}
+
+uint32_t X64Backend::GetInstrumentationCounter(
+    const InstrumentationCounter& counter) {
+  std::lock_guard<std::mutex> lock(instrumentation_counters_mutex_);
+  if (instrumentation_counters_.empty()) {
+    // Shared by everything that doesn't fit.
+    InstrumentationCounter& other = instrumentation_counters_.emplace_back();
+    other.type = InstrumentationCounter::Type::kHelperCall;
+    other.opcode = nullptr;
+    other.value = 0;
+  }
+  auto key = std::make_tuple(counter.type, counter.opcode, counter.value);
+  auto it = instrumentation_counter_indices_.find(key);
+  if (it != instrumentation_counter_indices_.end()) {
+    return it->second;
+  }
+  if (instrumentation_counters_.size() >= kMaxInstrumentationCounters) {
+    return 0;
+  }
+  uint32_t index = uint32_t(instrumentation_counters_.size());
+  instrumentation_counters_.push_back(counter);
+  instrumentation_counter_indices_.emplace(key, index);
+  return index;
+}
+
+void X64Backend::DumpInstrumentationCounters() {
+  std::vector<uint64_t> counts(kMaxInstrumentationCounters);
+  {
+    std::lock_guard<std::mutex> lock(thread_contexts_mutex_);
+    if (!exited_thread_instrumentation_counts_.empty()) {
+      counts = exited_thread_instrumentation_counts_;
+    }
+    for (const ppc::PPCContext* context : thread_contexts_) {
+      if (!context->instrumentation_counters) {
+        continue;
+      }
+      for (uint32_t i = 0; i < kMaxInstrumentationCounters; ++i) {
+        counts[i] += context->instrumentation_counters[i];
+      }
+    }
+  }
+  std::lock_guard<std::mutex> lock(instrumentation_counters_mutex_);
+  std::vector<uint32_t> sorted_indices;
+  sorted_indices.reserve(instrumentation_counters_.size());
+  uint64_t total_count = 0;
+  for (uint32_t i = 0; i < uint32_t(instrumentation_counters_.size()); ++i) {
+    if (counts[i]) {
+      sorted_indices.push_back(i);
+      total_count += counts[i];
+    }
+  }
+  std::sort(sorted_indices.begin(), sorted_indices.end(),
+            [&counts](uint32_t a, uint32_t b) {
+              return counts[a] > counts[b];
+            });
+  XELOGI("Instrumentation counters: {} sites, {} events",
+         instrumentation_counters_.size(), total_count);
+  StackWalker* stack_walker = processor()->stack_walker();
+  for (size_t i = 0; i < std::min(sorted_indices.size(), size_t(64)); ++i) {
+    uint32_t index = sorted_indices[i];
+    if (!index) {
+      XELOGI("  {}: other", counts[index]);
+      continue;
+    }
+    const InstrumentationCounter& counter = instrumentation_counters_[index];
+    const char* opcode_name =
+        counter.opcode ? counter.opcode->name : "(no instruction)";
+    switch (counter.type) {
+      case InstrumentationCounter::Type::kHelperCall: {
+        uint64_t host_pc = counter.value;
+        StackFrame frame = {};
+        if (stack_walker) {
+          stack_walker->ResolveStack(&host_pc, &frame, 1);
+        }
+        if (frame.type == StackFrame::Type::kHost &&
+            frame.host_symbol.name[0]) {
+          XELOGI("  {}: {} calls {}", counts[index], opcode_name,
+                 frame.host_symbol.name);
+        } else {
+          XELOGI("  {}: {} calls {:016X}", counts[index], opcode_name,
+                 counter.value);
+        }
+      } break;
+      case InstrumentationCounter::Type::kMMIOFaultSiteStub:
+        XELOGI("  {}: {} MMIO fault site stub", counts[index], opcode_name);
+        break;
+      case InstrumentationCounter::Type::kTrap:
+        XELOGI("  {}: {} trap {}", counts[index], opcode_name, counter.value);
+        break;
+      case InstrumentationCounter::Type::kUnimplementedInstr:
+        XELOGI("  {}: {} unimplemented", counts[index], opcode_name);
+        break;
+      case InstrumentationCounter::Type::kMXCSRSwitch:
+        XELOGI("  {}: MXCSR switches in {:08X}", counts[index],
+               counter.value);
+        break;
+    }
+  }
+}
+
 bool X64Backend::ExceptionCallbackThunk(Exception* ex, void* data) {
   auto backend = reinterpret_cast<X64Backend*>(data);
   return backend->ExceptionCallback(ex);
@@ -412,6 +677,220 @@ bool X64Backend::ExceptionCallback(Exception* ex) {
   return processor()->OnThreadBreakpointHit(ex);
 }
 
+void X64Backend::MMIOFaultSiteCallbackThunk(
+    void* context, void* host_pc,
+    const MMIOHandler::DecodedLoadStore& decoded) {
+  reinterpret_cast<X64Backend*>(context)->PatchMMIOFaultSite(
+      reinterpret_cast<uint8_t*>(host_pc), decoded);
+}
+
+void X64Backend::PatchMMIOFaultSite(
+    uint8_t* host_pc, const MMIOHandler::DecodedLoadStore& decoded) {
+  // The instruction is replaced with a 5-byte call, which must not overwrite
+  // the next one as other threads may be about to execute it.
+  if (decoded.length < 5) {
+    return;
+  }
+  // The first two bytes must be replaceable atomically.
+  if ((uintptr_t(host_pc) & 7) == 7) {
+    return;
+  }
+  // The stub moves the stack pointer.
+  const uint8_t rsp_index = uint8_t(Xbyak::Operand::RSP);
+  if ((decoded.mem_has_base && decoded.mem_base_reg == rsp_index) ||
+      (decoded.mem_has_index && decoded.mem_index_reg == rsp_index) ||
+      (!decoded.is_constant && decoded.value_reg == rsp_index)) {
+    return;
+  }
+  // Only guest function bodies have the stack aligned like the stub expects,
+  // and don't keep anything in the flags or in xmm0 across a memory access.
+  if (!code_cache_->LookupFunction(uint64_t(host_pc))) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mmio_fault_sites_mutex_);
+  auto site_it = mmio_fault_sites_.emplace(host_pc, nullptr);
+  if (!site_it.second) {
+    // Already patched by another thread.
+    return;
+  }
+  XbyakAllocator allocator;
+  X64ThunkEmitter thunk_emitter(this, &allocator);
+  auto stub = reinterpret_cast<const uint8_t*>(
+      thunk_emitter.EmitMMIOFaultSiteStub(decoded));
+  site_it.first->second = const_cast<uint8_t*>(stub);
+
+  uint8_t call[5];
+  int64_t displacement = int64_t(uintptr_t(stub)) -
+                         int64_t(uintptr_t(host_pc + sizeof(call)));
+  assert_true(displacement == int32_t(displacement));
+  int32_t rel32 = int32_t(displacement);
+  call[0] = 0xE8;
+  std::memcpy(call + 1, &rel32, sizeof(rel32));
+  size_t offset_in_block = uintptr_t(host_pc) & 7;
+  if (offset_in_block + sizeof(call) <= sizeof(uint64_t)) {
+    code_cache_->PatchCode(host_pc, call, sizeof(call));
+    return;
+  }
+  // The call crosses an 8-byte boundary - make the threads reaching it wait in
+  // a jmp $ loop while the rest of the call is written, then replace the loop.
+  static const uint8_t kSpinLoop[] = {0xEB, 0xFE};
+  code_cache_->PatchCode(host_pc, kSpinLoop, sizeof(kSpinLoop));
+  size_t rest_in_block =
+      sizeof(uint64_t) - (offset_in_block + sizeof(kSpinLoop));
+  if (rest_in_block) {
+    code_cache_->PatchCode(host_pc + sizeof(kSpinLoop),
+                           call + sizeof(kSpinLoop), rest_in_block);
+  }
+  size_t rest_offset = sizeof(kSpinLoop) + rest_in_block;
+  code_cache_->PatchCode(host_pc + rest_offset, call + rest_offset,
+                         sizeof(call) - rest_offset);
+  code_cache_->PatchCode(host_pc, call, sizeof(kSpinLoop));
+}
+
+void* X64Backend::AllocThreadData(ThreadState* thread_state) {
+  ppc::PPCContext* context = thread_state->context();
+  if (cvars::x64_instrumentation_counters) {
+    context->instrumentation_counters =
+        new uint64_t[kMaxInstrumentationCounters]();
+  }
+  std::lock_guard<std::mutex> lock(thread_contexts_mutex_);
+  thread_contexts_.push_back(context);
+  return context;
+}
+
+void X64Backend::FreeThreadData(void* thread_data) {
+  auto context = static_cast<ppc::PPCContext*>(thread_data);
+  std::lock_guard<std::mutex> lock(thread_contexts_mutex_);
+  auto it =
+      std::find(thread_contexts_.begin(), thread_contexts_.end(), context);
+  if (it != thread_contexts_.end()) {
+    thread_contexts_.erase(it);
+  }
+  if (context->instrumentation_counters) {
+    exited_thread_instrumentation_counts_.resize(kMaxInstrumentationCounters);
+    for (uint32_t i = 0; i < kMaxInstrumentationCounters; ++i) {
+      exited_thread_instrumentation_counts_[i] +=
+          context->instrumentation_counters[i];
+    }
+    delete[] context->instrumentation_counters;
+    context->instrumentation_counters = nullptr;
+  }
+}
+
+void X64Backend::RetireCode(X64Function* function, uint8_t* machine_code,
+                            size_t machine_code_length) {
+  if (!code_cache_->has_indirection_table()) {
+    // Without the indirection table, calls embed the machine code address
+    // directly (see X64Emitter::Call), so it's never unreachable.
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(retired_code_mutex_);
+    RetiredCode retired_code;
+    retired_code.machine_code = machine_code;
+    retired_code.machine_code_length = machine_code_length;
+    retired_code.frame_counter = function->frame_counter();
+    retired_code.free_epoch = 0;
+    retired_code.free_entry_count = 0;
+    retired_code_.push_back(retired_code);
+  }
+  ReclaimRetiredCode();
+}
+
+void X64Backend::ReclaimRetiredCode() {
+  // Called after placing any code, not worth waiting for another thread.
+  std::unique_lock<std::mutex> lock(retired_code_mutex_, std::try_to_lock);
+  if (!lock.owns_lock() || retired_code_.empty()) {
+    return;
+  }
+
+  // Start a new epoch for the code that has no frames now. A thread may still
+  // be about to enter it using the address it has read before the code was
+  // replaced, or to leave it after decrementing the frame count, but not
+  // after passing a safe point after this.
+  uint64_t new_free_epoch = 0;
+  for (RetiredCode& retired_code : retired_code_) {
+    if (retired_code.free_epoch) {
+      continue;
+    }
+    uint64_t frame_counter = retired_code.frame_counter->load();
+    if (uint32_t(frame_counter)) {
+      continue;
+    }
+    if (!new_free_epoch) {
+      new_free_epoch = code_epoch_.fetch_add(1) + 1;
+    }
+    retired_code.free_epoch = new_free_epoch;
+    retired_code.free_entry_count = uint32_t(frame_counter >> 32);
+  }
+
+  // The oldest epoch that a thread in the generated code may have seen.
+  uint64_t oldest_thread_epoch = UINT64_MAX;
+  {
+    std::lock_guard<std::mutex> thread_contexts_lock(thread_contexts_mutex_);
+    for (ppc::PPCContext* context : thread_contexts_) {
+      uint64_t thread_epoch =
+          *reinterpret_cast<volatile uint64_t*>(&context->code_epoch);
+      if (thread_epoch) {
+        oldest_thread_epoch = std::min(oldest_thread_epoch, thread_epoch);
+      }
+    }
+  }
+  // The frame counters must be checked after the threads, as a thread being
+  // in host code may have entered the code after the previous check, and the
+  // frame will be seen.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  std::vector<RetiredCode> freeable_code;
+  auto retired_code_end = std::remove_if(
+      retired_code_.begin(), retired_code_.end(),
+      [&](RetiredCode& retired_code) {
+        if (!retired_code.free_epoch ||
+            retired_code.free_epoch > oldest_thread_epoch) {
+          return false;
+        }
+        uint64_t frame_counter = retired_code.frame_counter->load();
+        if (uint32_t(frame_counter) ||
+            uint32_t(frame_counter >> 32) != retired_code.free_entry_count) {
+          // Entered by a thread that has read the address before it was
+          // replaced - wait for it to leave and pass a safe point again.
+          retired_code.free_epoch = 0;
+          return false;
+        }
+        freeable_code.push_back(retired_code);
+        return true;
+      });
+  retired_code_.erase(retired_code_end, retired_code_.end());
+  lock.unlock();
+
+  for (const RetiredCode& retired_code : freeable_code) {
+    FreeRetiredCode(retired_code);
+  }
+}
+
+void X64Backend::FreeRetiredCode(const RetiredCode& retired_code) {
+  // The MMIO access stubs are called only from the code.
+  {
+    std::lock_guard<std::mutex> lock(mmio_fault_sites_mutex_);
+    for (auto it = mmio_fault_sites_.begin(); it != mmio_fault_sites_.end();) {
+      if (it->first >= retired_code.machine_code &&
+          it->first < retired_code.machine_code +
+                          retired_code.machine_code_length) {
+        if (it->second) {
+          code_cache_->FreeCode(it->second);
+        }
+        it = mmio_fault_sites_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  // The call sites in the code are dropped by the callees when they're patched
+  // next time (see X64Function::PatchCallSites).
+  code_cache_->FreeCode(retired_code.machine_code);
+}
+
 X64ThunkEmitter::X64ThunkEmitter(X64Backend* backend, XbyakAllocator* allocator)
     : X64Emitter(backend, allocator) {}
 
@@ -505,10 +984,21 @@ GuestToHostThunk X64ThunkEmitter::EmitGuestToHostThunk() {
   // Save off volatile registers.
   EmitSaveVolatileRegs();
 
+  // In the host code, and the generated code doesn't need to be kept alive
+  // anymore for this thread other than the code having frames on the stack
+  // (see X64Backend::ReclaimRetiredCode).
+  mov(qword[GetContextReg() + offsetof(ppc::PPCContext, code_epoch)], 0);
+
   mov(rax, rcx);              // function
   mov(rcx, GetContextReg());  // context
   call(rax);
 
+  // Back to the generated code - a safe point, as any code address read from
+  // now on is of the current code. rcx is restored below.
+  mov(rcx, reinterpret_cast<uint64_t>(backend()->code_epoch_address()));
+  mov(rcx, qword[rcx]);
+  mov(qword[GetContextReg() + offsetof(ppc::PPCContext, code_epoch)], rcx);
+
   EmitLoadVolatileRegs();
 
   code_offsets.epilog = getSize();
@@ -590,6 +1080,135 @@ ResolveFunctionThunk X64ThunkEmitter::EmitResolveFunctionThunk() {
   return (ResolveFunctionThunk)fn;
 }
 
+// Called by the MMIO fault site stubs through the guest to host thunk.
+static uint64_t MMIOFaultSiteLoad(void* raw_context, uint64_t host_address) {
+  return MMIOHandler::global_handler()->SoftwareLoad(
+      reinterpret_cast<const void*>(host_address));
+}
+static uint64_t MMIOFaultSiteStore(void* raw_context, uint64_t host_address,
+                                   uint64_t value) {
+  MMIOHandler::global_handler()->SoftwareStore(
+      reinterpret_cast<void*>(host_address), uint32_t(value));
+  return 0;
+}
+
+void* X64ThunkEmitter::EmitMMIOFaultSiteStub(
+    const MMIOHandler::DecodedLoadStore& decoded) {
+  // Called from the site in a guest function body, so after the return address
+  // and the saved registers, the stack is aligned like for calling the guest to
+  // host thunk. All registers other than the target of a load are preserved,
+  // like by the replaced instruction.
+
+  struct _code_offsets {
+    size_t prolog;
+    size_t prolog_stack_alloc;
+    size_t body;
+    size_t epilog;
+    size_t tail;
+  } code_offsets = {};
+
+  // Overwritten for calling the thunk.
+  static const int kSavedRegs[] = {Xbyak::Operand::RAX, Xbyak::Operand::RCX,
+                                   Xbyak::Operand::RDX, Xbyak::Operand::R8,
+                                   Xbyak::Operand::R9};
+  const size_t stack_size = sizeof(uint64_t) * xe::countof(kSavedRegs);
+  static_assert((sizeof(uint64_t) * xe::countof(kSavedRegs) + 8) % 16 == 0,
+                "The stack must be 16-byte aligned for calling the thunk");
+  const size_t saved_rdx_offset = sizeof(uint64_t) * 2;
+
+  code_offsets.prolog = getSize();
+
+  // rsp + 0 = return address
+  sub(rsp, stack_size);
+
+  code_offsets.prolog_stack_alloc = getSize();
+  code_offsets.body = getSize();
+
+  for (size_t i = 0; i < xe::countof(kSavedRegs); ++i) {
+    mov(qword[rsp + sizeof(uint64_t) * i], Xbyak::Reg64(kSavedRegs[i]));
+  }
+
+  EmitInstrumentationCounter(
+      X64Backend::InstrumentationCounter::Type::kMMIOFaultSiteStub);
+
+  // rdx = host address, computed from the original registers.
+  Xbyak::RegExp address(size_t(decoded.mem_displacement));
+  if (decoded.mem_has_base) {
+    address = address + Xbyak::Reg64(decoded.mem_base_reg);
+  }
+  if (decoded.mem_has_index) {
+    address =
+        address + Xbyak::Reg64(decoded.mem_index_reg) * decoded.mem_scale;
+  }
+  lea(rdx, ptr[address]);
+
+  // r8d = value to store in the guest memory byte order.
+  if (!decoded.is_load) {
+    if (decoded.is_constant) {
+      mov(r8d, uint32_t(decoded.constant));
+    } else if (decoded.value_reg == rdx.getIdx()) {
+      mov(r8d, dword[rsp + saved_rdx_offset]);
+    } else {
+      mov(r8d, Xbyak::Reg32(decoded.value_reg));
+    }
+    if (decoded.byte_swap) {
+      bswap(r8d);
+    }
+  }
+
+  mov(rax, reinterpret_cast<uint64_t>(backend()->guest_to_host_thunk()));
+  if (decoded.is_load) {
+    mov(rcx, reinterpret_cast<uint64_t>(&MMIOFaultSiteLoad));
+  } else {
+    mov(rcx, reinterpret_cast<uint64_t>(&MMIOFaultSiteStore));
+  }
+  call(rax);
+
+  int load_reg = -1;
+  if (decoded.is_load) {
+    load_reg = decoded.value_reg;
+    if (decoded.byte_swap) {
+      bswap(eax);
+    }
+  }
+  for (size_t i = 1; i < xe::countof(kSavedRegs); ++i) {
+    if (kSavedRegs[i] != load_reg) {
+      mov(Xbyak::Reg64(kSavedRegs[i]), qword[rsp + sizeof(uint64_t) * i]);
+    }
+  }
+  if (load_reg != Xbyak::Operand::RAX) {
+    if (load_reg >= 0) {
+      mov(Xbyak::Reg32(load_reg), eax);
+    }
+    mov(rax, qword[rsp]);
+  }
+
+  // Return after the replaced instruction rather than after the call.
+  if (decoded.length > 5) {
+    add(qword[rsp + stack_size], uint32_t(decoded.length - 5));
+  }
+
+  code_offsets.epilog = getSize();
+
+  add(rsp, stack_size);
+  ret();
+
+  code_offsets.tail = getSize();
+
+  assert_zero(code_offsets.prolog);
+  EmitFunctionInfo func_info = {};
+  func_info.code_size.total = getSize();
+  func_info.code_size.prolog = code_offsets.body - code_offsets.prolog;
+  func_info.code_size.body = code_offsets.epilog - code_offsets.body;
+  func_info.code_size.epilog = code_offsets.tail - code_offsets.epilog;
+  func_info.code_size.tail = getSize() - code_offsets.tail;
+  func_info.prolog_stack_alloc_offset =
+      code_offsets.prolog_stack_alloc - code_offsets.prolog;
+  func_info.stack_size = stack_size;
+
+  return Emplace(func_info);
+}
+
 void X64ThunkEmitter::EmitSaveVolatileRegs() {
   // Save off volatile registers.
   // mov(qword[rsp + offsetof(StackLayout::Thunk, r[0])], rax);
@@ -10,12 +10,28 @@
 #ifndef XENIA_CPU_BACKEND_X64_X64_BACKEND_H_
 #define XENIA_CPU_BACKEND_X64_X64_BACKEND_H_
 
+#include <atomic>
+#include <deque>
+#include <filesystem>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 #include "xenia/base/cvar.h"
 #include "xenia/cpu/backend/backend.h"
+#include "xenia/cpu/hir/opcodes.h"
+#include "xenia/cpu/mmio_handler.h"
+#include "xenia/cpu/ppc/ppc_context.h"
 
 DECLARE_int32(x64_extension_mask);
+DECLARE_bool(x64_code_storage);
+DECLARE_uint32(x64_indirect_call_cache_size);
+DECLARE_bool(x64_indirect_call_cache_counters);
+DECLARE_bool(x64_instrumentation_counters);
+DECLARE_bool(x64_patch_mmio_fault_sites);
 
 namespace xe {
 class Exception;
@@ -26,6 +42,9 @@ namespace backend {
 namespace x64 {
 
 class X64CodeCache;
+class X64CodeStorage;
+class X64ConstantPool;
+class X64Function;
 
 typedef void* (*HostToGuestThunk)(void* target, void* arg0, void* arg1);
 typedef void* (*GuestToHostThunk)(void* target, void* arg0, void* arg1);
@@ -35,11 +54,45 @@ class X64Backend : public Backend {
  public:
   static const uint32_t kForceReturnAddress = 0x9FFF0000u;
 
+  // Maximum number of targets cached at an indirect call site (see
+  // X64Emitter::CallIndirect).
+  static constexpr uint32_t kIndirectCallCacheMaxEntries = 4;
+  struct IndirectCallCacheCounters {
+    // Guest address of the call instruction.
+    uint32_t guest_address;
+    uint32_t entry_count;
+    uint64_t hits[kIndirectCallCacheMaxEntries];
+    uint64_t misses;
+  };
+
+  // Event in the generated code counted per thread with
+  // --x64_instrumentation_counters.
+  struct InstrumentationCounter {
+    enum class Type {
+      kHelperCall,
+      kMMIOFaultSiteStub,
+      kTrap,
+      kUnimplementedInstr,
+      kMXCSRSwitch,
+    };
+    Type type;
+    // HIR instruction being emitted, or null outside guest function bodies.
+    const hir::OpcodeInfo* opcode;
+    // Address of the helper for kHelperCall, trap type for kTrap, guest
+    // function address for kMXCSRSwitch.
+    uint64_t value;
+  };
+  // Counters beyond this are merged into the first.
+  static constexpr uint32_t kMaxInstrumentationCounters = 4096;
+
   explicit X64Backend();
   ~X64Backend() override;
 
   X64CodeCache* code_cache() const { return code_cache_.get(); }
+  // Persistent code storage, or nullptr if it's not open.
+  X64CodeStorage* code_storage() const;
   uintptr_t emitter_data() const { return emitter_data_; }
+  X64ConstantPool* constant_pool() const { return constant_pool_.get(); }
 
   // Call a generated function, saving all stack parameters.
   HostToGuestThunk host_to_guest_thunk() const { return host_to_guest_thunk_; }
@@ -52,13 +105,40 @@ class X64Backend : public Backend {
 
   bool Initialize(Processor* processor) override;
 
+  void* AllocThreadData(ThreadState* thread_state) override;
+  void FreeThreadData(void* thread_data) override;
+
+  // Advanced when retired code may become freeable. The threads running the
+  // generated code publish the epoch in PPCContext::code_epoch at safe points
+  // - when entering it from the host, and when returning to it from a call to
+  // the host (see X64ThunkEmitter::EmitGuestToHostThunk).
+  uint64_t code_epoch() const { return code_epoch_.load(); }
+  const std::atomic<uint64_t>* code_epoch_address() const {
+    return &code_epoch_;
+  }
+  // Takes code that has been replaced in the indirection table and in all the
+  // call sites (see X64Function::Setup) to free it once no thread may be
+  // executing it.
+  void RetireCode(X64Function* function, uint8_t* machine_code,
+                  size_t machine_code_length);
+  // Frees the retired code that has no frames on the stacks of the threads,
+  // and that no thread can enter anymore as they all have passed a safe point
+  // since.
+  void ReclaimRetiredCode();
+
   void CommitExecutableRange(uint32_t guest_low, uint32_t guest_high) override;
 
+  void InitializeCodeStorage(const std::filesystem::path& cache_root,
+                             uint32_t title_id) override;
+  void ShutdownCodeStorage() override;
+
   std::unique_ptr<Assembler> CreateAssembler() override;
 
   std::unique_ptr<GuestFunction> CreateGuestFunction(Module* module,
                                                      uint32_t address) override;
 
+  void InvalidateFunction(GuestFunction* function) override;
+
   uint64_t CalculateNextHostInstruction(ThreadDebugInfo* thread_info,
                                         uint64_t current_pc) override;
 
@@ -66,18 +146,81 @@ class X64Backend : public Backend {
   void InstallBreakpoint(Breakpoint* breakpoint, Function* fn) override;
   void UninstallBreakpoint(Breakpoint* breakpoint) override;
 
+  // Counters live until the backend is destroyed, and are written by the
+  // generated code without synchronization.
+  IndirectCallCacheCounters* AllocateIndirectCallCacheCounters(
+      uint32_t guest_address, uint32_t entry_count);
+  // Logs the indirect call sites with the most calls.
+  void DumpIndirectCallCacheCounters();
+
+  // Returns the index of the counter in PPCContext::instrumentation_counters.
+  uint32_t GetInstrumentationCounter(const InstrumentationCounter& counter);
+  // Logs the counted events, the most frequent first.
+  void DumpInstrumentationCounters();
+
  private:
   static bool ExceptionCallbackThunk(Exception* ex, void* data);
   bool ExceptionCallback(Exception* ex);
 
+  static void MMIOFaultSiteCallbackThunk(
+      void* context, void* host_pc,
+      const MMIOHandler::DecodedLoadStore& decoded);
+  // Replaces a load or store in guest function code that has accessed MMIO
+  // with a call to a stub doing the access via MMIOHandler::SoftwareLoad or
+  // SoftwareStore.
+  void PatchMMIOFaultSite(uint8_t* host_pc,
+                          const MMIOHandler::DecodedLoadStore& decoded);
+
+  struct RetiredCode {
+    uint8_t* machine_code;
+    size_t machine_code_length;
+    std::atomic<uint64_t>* frame_counter;
+    // Epoch started when the code has been observed to have no frames, or 0
+    // if it had frames at the last check.
+    uint64_t free_epoch;
+    // Number of entries into the code at that point.
+    uint32_t free_entry_count;
+  };
+
+  void FreeRetiredCode(const RetiredCode& retired_code);
+
   uintptr_t capstone_handle_ = 0;
 
   std::unique_ptr<X64CodeCache> code_cache_;
   uintptr_t emitter_data_ = 0;
+  std::unique_ptr<X64ConstantPool> constant_pool_;
+  uint32_t emitter_feature_flags_ = 0;
+  std::unique_ptr<X64CodeStorage> code_storage_;
 
   HostToGuestThunk host_to_guest_thunk_;
   GuestToHostThunk guest_to_host_thunk_;
   ResolveFunctionThunk resolve_function_thunk_;
+
+  std::mutex indirect_call_cache_counters_mutex_;
+  // Deque so the addresses are stable.
+  std::deque<IndirectCallCacheCounters> indirect_call_cache_counters_;
+
+  bool mmio_fault_site_callback_installed_ = false;
+  // Host instructions already replaced with a call to an MMIO access stub, as
+  // multiple threads may take an exception at one concurrently, and the stubs,
+  // freed along with the code containing the instructions.
+  std::mutex mmio_fault_sites_mutex_;
+  std::unordered_map<const uint8_t*, void*> mmio_fault_sites_;
+
+  std::atomic<uint64_t> code_epoch_{1};
+  std::mutex thread_contexts_mutex_;
+  std::vector<ppc::PPCContext*> thread_contexts_;
+  // Counts of the threads that have exited, protected by
+  // thread_contexts_mutex_.
+  std::vector<uint64_t> exited_thread_instrumentation_counts_;
+  std::mutex instrumentation_counters_mutex_;
+  std::vector<InstrumentationCounter> instrumentation_counters_;
+  std::map<std::tuple<InstrumentationCounter::Type, const hir::OpcodeInfo*,
+                      uint64_t>,
+           uint32_t>
+      instrumentation_counter_indices_;
+  std::mutex retired_code_mutex_;
+  std::vector<RetiredCode> retired_code_;
 };
 
 }  // namespace x64
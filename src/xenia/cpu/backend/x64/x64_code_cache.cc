@@ -9,18 +9,14 @@
 
 #include "xenia/cpu/backend/x64/x64_code_cache.h"
 
-#include <cstdlib>
+#include <algorithm>
 #include <cstring>
-
-#if ENABLE_VTUNE
-#include "third_party/vtune/include/jitprofiling.h"
-#pragma comment(lib, "../third_party/vtune/lib64/jitprofiling.lib")
-#endif
+#include <iterator>
 
 #include "third_party/fmt/include/fmt/format.h"
 #include "xenia/base/assert.h"
+#include "xenia/base/atomic.h"
 #include "xenia/base/clock.h"
-#include "xenia/base/literals.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
 #include "xenia/base/memory.h"
@@ -32,8 +28,6 @@ namespace cpu {
 namespace backend {
 namespace x64 {
 
-using namespace xe::literals;
-
 X64CodeCache::X64CodeCache() = default;
 
 X64CodeCache::~X64CodeCache() {
@@ -120,8 +114,7 @@ bool X64CodeCache::Initialize() {
     }
   }
 
-  // Preallocate the function map to a large, reasonable size.
-  generated_code_map_.reserve(kMaximumFunctionCount);
+  jit_symbols_.Initialize();
 
   return true;
 }
@@ -141,6 +134,10 @@ void X64CodeCache::AddIndirection(uint32_t guest_address,
   *indirection_slot = host_address;
 }
 
+void X64CodeCache::RemoveIndirection(uint32_t guest_address) {
+  AddIndirection(guest_address, indirection_default_value_);
+}
+
 void X64CodeCache::CommitExecutableRange(uint32_t guest_low,
                                          uint32_t guest_high) {
   if (!indirection_table_base_) {
@@ -170,114 +167,56 @@ void X64CodeCache::PlaceHostCode(uint32_t guest_address, void* machine_code,
                  code_execute_address_out, code_write_address_out);
 }
 
-void X64CodeCache::PlaceGuestCode(uint32_t guest_address, void* machine_code,
-                                  const EmitFunctionInfo& func_info,
-                                  GuestFunction* function_info,
-                                  void*& code_execute_address_out,
-                                  void*& code_write_address_out) {
-  // Hold a lock while we bump the pointers up. This is important as the
-  // unwind table requires entries AND code to be sorted in order.
-  size_t low_mark;
-  size_t high_mark;
+void X64CodeCache::PlaceGuestCode(
+    uint32_t guest_address, void* machine_code,
+    const EmitFunctionInfo& func_info, GuestFunction* function_info,
+    void*& code_execute_address_out, void*& code_write_address_out,
+    const std::vector<SourceMapEntry>* source_map) {
   uint8_t* code_execute_address;
-  UnwindReservation unwind_reservation;
   {
-    auto global_lock = global_critical_region_.Acquire();
-
-    low_mark = generated_code_offset_;
+    std::lock_guard<std::mutex> lock(allocation_mutex_);
 
     // Reserve code.
     // Always move the code to land on 16b alignment.
-    code_execute_address =
-        generated_code_execute_base_ + generated_code_offset_;
-    code_execute_address_out = code_execute_address;
-    uint8_t* code_write_address =
-        generated_code_write_base_ + generated_code_offset_;
-    code_write_address_out = code_write_address;
-    generated_code_offset_ += xe::round_up(func_info.code_size.total, 16);
-
-    auto tail_write_address =
-        generated_code_write_base_ + generated_code_offset_;
+    size_t code_size_aligned = xe::round_up(func_info.code_size.total, 16);
 
     // Reserve unwind info.
     // We go on the high size of the unwind info as we don't know how big we
     // need it, and a few extra bytes of padding isn't the worst thing.
-    unwind_reservation = RequestUnwindReservation(generated_code_write_base_ +
-                                                  generated_code_offset_);
-    generated_code_offset_ += xe::round_up(unwind_reservation.data_size, 16);
-
-    auto end_write_address =
-        generated_code_write_base_ + generated_code_offset_;
-
-    high_mark = generated_code_offset_;
-
-    // Store in map. It is maintained in sorted order of host PC dependent on
-    // us also being append-only.
-    generated_code_map_.emplace_back(
-        (uint64_t(code_execute_address - generated_code_execute_base_) << 32) |
-            generated_code_offset_,
-        function_info);
-
-    // TODO(DrChat): The following code doesn't really need to be under the
-    // global lock except for PlaceCode (but it depends on the previous code
-    // already being ran)
-
-    // If we are going above the high water mark of committed memory, commit
-    // some more. It's ok if multiple threads do this, as redundant commits
-    // aren't harmful.
-    size_t old_commit_mark, new_commit_mark;
-    do {
-      old_commit_mark = generated_code_commit_mark_;
-      if (high_mark <= old_commit_mark) break;
-
-      new_commit_mark = old_commit_mark + 16_MiB;
-      if (generated_code_execute_base_ == generated_code_write_base_) {
-        xe::memory::AllocFixed(generated_code_execute_base_, new_commit_mark,
-                               xe::memory::AllocationType::kCommit,
-                               xe::memory::PageAccess::kExecuteReadWrite);
-      } else {
-        xe::memory::AllocFixed(generated_code_execute_base_, new_commit_mark,
-                               xe::memory::AllocationType::kCommit,
-                               xe::memory::PageAccess::kExecuteReadOnly);
-        xe::memory::AllocFixed(generated_code_write_base_, new_commit_mark,
-                               xe::memory::AllocationType::kCommit,
-                               xe::memory::PageAccess::kReadWrite);
-      }
-    } while (generated_code_commit_mark_.compare_exchange_weak(
-        old_commit_mark, new_commit_mark));
+    UnwindReservation unwind_reservation;
+    unwind_reservation.data_size =
+        xe::round_up(GetUnwindReservationSize(), 16);
+
+    size_t total_size = code_size_aligned + unwind_reservation.data_size;
+    size_t offset = AllocateSpace(total_size);
+    code_execute_address = generated_code_execute_base_ + offset;
+    code_execute_address_out = code_execute_address;
+    uint8_t* code_write_address = generated_code_write_base_ + offset;
+    code_write_address_out = code_write_address;
+    unwind_reservation.entry_address = code_write_address + code_size_aligned;
+
+    CodeAllocation& allocation = allocations_[uint32_t(offset)];
+    allocation.code_size = uint32_t(func_info.code_size.total);
+    allocation.total_size = uint32_t(total_size);
+    allocation.function = function_info;
+    allocation.id = next_allocation_id_++;
 
     // Copy code.
     std::memcpy(code_write_address, machine_code, func_info.code_size.total);
 
     // Fill unused slots with 0xCC
-    std::memset(tail_write_address, 0xCC,
-                static_cast<size_t>(end_write_address - tail_write_address));
+    std::memset(code_write_address + func_info.code_size.total, 0xCC,
+                total_size - func_info.code_size.total);
 
     // Notify subclasses of placed code.
     PlaceCode(guest_address, machine_code, func_info, code_execute_address,
               unwind_reservation);
   }
 
-#if ENABLE_VTUNE
-  if (iJIT_IsProfilingActive() == iJIT_SAMPLING_ON) {
-    std::string method_name;
-    if (function_info && function_info->name().size() != 0) {
-      method_name = function_info->name();
-    } else {
-      method_name = xe::format_string("sub_%.8X", guest_address);
-    }
-
-    iJIT_Method_Load_V2 method = {0};
-    method.method_id = iJIT_GetNewMethodID();
-    method.method_load_address = code_execute_address;
-    method.method_size = uint32_t(code_size);
-    method.method_name = const_cast<char*>(method_name.data());
-    method.module_name = function_info
-                             ? (char*)function_info->module()->name().c_str()
-                             : nullptr;
-    iJIT_NotifyEvent(iJVM_EVENT_TYPE_METHOD_LOAD_FINISHED_V2, (void*)&method);
+  if (jit_symbols_.is_active()) {
+    jit_symbols_.OnCodePlaced(code_execute_address, func_info.code_size.total,
+                              guest_address, function_info, source_map);
   }
-#endif
 
   // Now that everything is ready, fix up the indirection table.
   // Note that we do support code that doesn't have an indirection fixup, so
@@ -291,75 +230,197 @@ void X64CodeCache::PlaceGuestCode(uint32_t guest_address, void* machine_code,
 }
 
 uint32_t X64CodeCache::PlaceData(const void* data, size_t length) {
-  // Hold a lock while we bump the pointers up.
-  size_t high_mark;
-  uint8_t* data_address = nullptr;
+  uint8_t* data_address;
   {
-    auto global_lock = global_critical_region_.Acquire();
+    std::lock_guard<std::mutex> lock(allocation_mutex_);
+    // Always move the data to land on 16b alignment.
+    data_address =
+        generated_code_write_base_ + AllocateSpace(xe::round_up(length, 16));
+  }
 
-    // Reserve code.
-    // Always move the code to land on 16b alignment.
-    data_address = generated_code_write_base_ + generated_code_offset_;
-    generated_code_offset_ += xe::round_up(length, 16);
+  // Copy data.
+  std::memcpy(data_address, data, length);
 
-    high_mark = generated_code_offset_;
-  }
+  return uint32_t(uintptr_t(data_address));
+}
 
-  // If we are going above the high water mark of committed memory, commit some
-  // more. It's ok if multiple threads do this, as redundant commits aren't
-  // harmful.
-  size_t old_commit_mark, new_commit_mark;
-  do {
-    old_commit_mark = generated_code_commit_mark_;
-    if (high_mark <= old_commit_mark) break;
+size_t X64CodeCache::AllocateSpace(size_t size) {
+  assert_zero(size & 15);
+  // Best fit from the space of freed code.
+  auto free_it = free_ranges_by_size_.lower_bound(
+      std::make_pair(uint32_t(size), uint32_t(0)));
+  if (free_it != free_ranges_by_size_.end()) {
+    uint32_t range_size = free_it->first;
+    uint32_t range_offset = free_it->second;
+    free_ranges_by_size_.erase(free_it);
+    free_ranges_.erase(range_offset);
+    if (range_size > size) {
+      uint32_t rest_offset = range_offset + uint32_t(size);
+      uint32_t rest_size = range_size - uint32_t(size);
+      free_ranges_.emplace(rest_offset, rest_size);
+      free_ranges_by_size_.emplace(rest_size, rest_offset);
+    }
+    return range_offset;
+  }
 
-    new_commit_mark = old_commit_mark + 16_MiB;
+  size_t offset = generated_code_offset_;
+  if (size > kGeneratedCodeSize - offset) {
+    xe::FatalError(
+        "The x64 code cache is full - too much code has been generated for "
+        "the guest functions.");
+  }
+  generated_code_offset_ += size;
+
+  // If we are going above the high water mark of committed memory, commit
+  // some more chunks.
+  while (generated_code_offset_ > generated_code_commit_mark_) {
+    size_t commit_size =
+        std::min(kGeneratedCodeChunkSize,
+                 kGeneratedCodeSize - generated_code_commit_mark_);
     if (generated_code_execute_base_ == generated_code_write_base_) {
-      xe::memory::AllocFixed(generated_code_execute_base_, new_commit_mark,
-                             xe::memory::AllocationType::kCommit,
-                             xe::memory::PageAccess::kExecuteReadWrite);
+      xe::memory::AllocFixed(
+          generated_code_execute_base_ + generated_code_commit_mark_,
+          commit_size, xe::memory::AllocationType::kCommit,
+          xe::memory::PageAccess::kExecuteReadWrite);
     } else {
-      xe::memory::AllocFixed(generated_code_execute_base_, new_commit_mark,
-                             xe::memory::AllocationType::kCommit,
-                             xe::memory::PageAccess::kExecuteReadOnly);
-      xe::memory::AllocFixed(generated_code_write_base_, new_commit_mark,
-                             xe::memory::AllocationType::kCommit,
-                             xe::memory::PageAccess::kReadWrite);
+      xe::memory::AllocFixed(
+          generated_code_execute_base_ + generated_code_commit_mark_,
+          commit_size, xe::memory::AllocationType::kCommit,
+          xe::memory::PageAccess::kExecuteReadOnly);
+      xe::memory::AllocFixed(
+          generated_code_write_base_ + generated_code_commit_mark_,
+          commit_size, xe::memory::AllocationType::kCommit,
+          xe::memory::PageAccess::kReadWrite);
     }
-  } while (generated_code_commit_mark_.compare_exchange_weak(old_commit_mark,
-                                                             new_commit_mark));
-
-  // Copy code.
-  std::memcpy(data_address, data, length);
+    if (host_numa_node_ != UINT32_MAX) {
+      // Committing replaces the mappings on some hosts, bind the new pages.
+      xe::memory::BindToNumaNode(
+          generated_code_execute_base_ + generated_code_commit_mark_,
+          commit_size, host_numa_node_);
+      if (generated_code_write_base_ != generated_code_execute_base_) {
+        xe::memory::BindToNumaNode(
+            generated_code_write_base_ + generated_code_commit_mark_,
+            commit_size, host_numa_node_);
+      }
+    }
+    generated_code_commit_mark_ += commit_size;
+  }
 
-  return uint32_t(uintptr_t(data_address));
+  return offset;
 }
 
-GuestFunction* X64CodeCache::LookupFunction(uint64_t host_pc) {
-  uint32_t key = uint32_t(host_pc - kGeneratedCodeExecuteBase);
-  void* fn_entry = std::bsearch(
-      &key, generated_code_map_.data(), generated_code_map_.size() + 1,
-      sizeof(std::pair<uint32_t, Function*>),
-      [](const void* key_ptr, const void* element_ptr) {
-        auto key = *reinterpret_cast<const uint32_t*>(key_ptr);
-        auto element =
-            reinterpret_cast<const std::pair<uint64_t, GuestFunction*>*>(
-                element_ptr);
-        if (key < (element->first >> 32)) {
-          return -1;
-        } else if (key > uint32_t(element->first)) {
-          return 1;
-        } else {
-          return 0;
-        }
-      });
-  if (fn_entry) {
-    return reinterpret_cast<const std::pair<uint64_t, GuestFunction*>*>(
-               fn_entry)
-        ->second;
+void X64CodeCache::FreeCode(void* code_execute_address) {
+  std::lock_guard<std::mutex> lock(allocation_mutex_);
+  uint32_t offset = uint32_t(reinterpret_cast<uint8_t*>(code_execute_address) -
+                             generated_code_execute_base_);
+  auto allocation_it = allocations_.find(offset);
+  assert_true(allocation_it != allocations_.end());
+  if (allocation_it == allocations_.end()) {
+    return;
+  }
+  const CodeAllocation& allocation = allocation_it->second;
+  FreeUnwindReservation(code_execute_address,
+                        GetUnwindEntryAddress(offset, allocation));
+  uint32_t size = allocation.total_size;
+  allocations_.erase(allocation_it);
+
+  // Trap if anything still jumps to the space until it's reused.
+  std::memset(generated_code_write_base_ + offset, 0xCC, size);
+
+  // Merge with the adjacent free ranges.
+  auto next_it = free_ranges_.lower_bound(offset);
+  if (next_it != free_ranges_.begin()) {
+    auto previous_it = std::prev(next_it);
+    if (previous_it->first + previous_it->second == offset) {
+      offset = previous_it->first;
+      size += previous_it->second;
+      free_ranges_by_size_.erase(
+          std::make_pair(previous_it->second, previous_it->first));
+      free_ranges_.erase(previous_it);
+    }
+  }
+  if (next_it != free_ranges_.end() && offset + size == next_it->first) {
+    size += next_it->second;
+    free_ranges_by_size_.erase(std::make_pair(next_it->second, next_it->first));
+    free_ranges_.erase(next_it);
+  }
+  if (offset + size == generated_code_offset_) {
+    // Keep the chunks committed, but return the space to bump allocation.
+    generated_code_offset_ = offset;
   } else {
+    free_ranges_.emplace(offset, size);
+    free_ranges_by_size_.emplace(size, offset);
+  }
+}
+
+const X64CodeCache::CodeAllocation* X64CodeCache::LookupAllocation(
+    uint64_t host_pc, uint32_t* offset_out) const {
+  if (host_pc < uint64_t(generated_code_execute_base_) ||
+      host_pc >=
+          uint64_t(generated_code_execute_base_) + generated_code_offset_) {
     return nullptr;
   }
+  uint32_t offset = uint32_t(host_pc - uint64_t(generated_code_execute_base_));
+  auto it = allocations_.upper_bound(offset);
+  if (it == allocations_.begin()) {
+    return nullptr;
+  }
+  --it;
+  if (offset - it->first >= it->second.total_size) {
+    return nullptr;
+  }
+  if (offset_out) {
+    *offset_out = it->first;
+  }
+  return &it->second;
+}
+
+uint64_t X64CodeCache::GetAllocationId(const void* code_execute_address) {
+  std::lock_guard<std::mutex> lock(allocation_mutex_);
+  const CodeAllocation* allocation =
+      LookupAllocation(uint64_t(code_execute_address), nullptr);
+  return allocation ? allocation->id : 0;
+}
+
+void X64CodeCache::PatchCode(void* code_execute_address, const void* data,
+                             size_t size) {
+  uintptr_t block_address = uintptr_t(code_execute_address) & ~uintptr_t(7);
+  size_t offset_in_block = uintptr_t(code_execute_address) - block_address;
+  assert_true(offset_in_block + size <= sizeof(uint64_t));
+  size_t block_offset =
+      size_t(block_address - uintptr_t(generated_code_execute_base_));
+  assert_true(block_offset + sizeof(uint64_t) <= kGeneratedCodeSize);
+  auto block_write_address = reinterpret_cast<volatile int64_t*>(
+      generated_code_write_base_ + block_offset);
+  std::lock_guard<std::mutex> lock(patch_mutex_);
+  uint8_t block[sizeof(uint64_t)];
+  std::memcpy(block, reinterpret_cast<const void*>(block_address),
+              sizeof(block));
+  std::memcpy(block + offset_in_block, data, size);
+  int64_t block_value;
+  std::memcpy(&block_value, block, sizeof(block_value));
+  // A single aligned store, so other threads never fetch a torn instruction.
+  xe::atomic_exchange(block_value, block_write_address);
+}
+
+bool X64CodeCache::PatchCode(void* code_execute_address, const void* data,
+                             size_t size, uint64_t allocation_id) {
+  // Holding the allocation mutex while patching so the code can't be freed in
+  // the meantime.
+  std::lock_guard<std::mutex> lock(allocation_mutex_);
+  const CodeAllocation* allocation =
+      LookupAllocation(uint64_t(code_execute_address), nullptr);
+  if (!allocation || allocation->id != allocation_id) {
+    return false;
+  }
+  PatchCode(code_execute_address, data, size);
+  return true;
+}
+
+GuestFunction* X64CodeCache::LookupFunction(uint64_t host_pc) {
+  std::lock_guard<std::mutex> lock(allocation_mutex_);
+  const CodeAllocation* allocation = LookupAllocation(host_pc, nullptr);
+  return allocation ? allocation->function : nullptr;
 }
 
 }  // namespace x64
@@ -10,17 +10,20 @@
 #ifndef XENIA_CPU_BACKEND_X64_X64_CODE_CACHE_H_
 #define XENIA_CPU_BACKEND_X64_X64_CODE_CACHE_H_
 
-#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "xenia/base/math.h"
 #include "xenia/base/memory.h"
-#include "xenia/base/mutex.h"
 #include "xenia/cpu/backend/code_cache.h"
+#include "xenia/cpu/backend/x64/x64_jit_symbols.h"
 
 namespace xe {
 namespace cpu {
@@ -47,6 +50,11 @@ class X64CodeCache : public CodeCache {
 
   virtual bool Initialize();
 
+  // The host NUMA node to place the generated code on, along with the guest
+  // memory, or UINT32_MAX to leave the placement to the host. Must be set
+  // before any code is placed.
+  void set_host_numa_node(uint32_t node) { host_numa_node_ = node; }
+
   const std::filesystem::path& file_name() const override { return file_name_; }
   uintptr_t execute_base_address() const override {
     return kGeneratedCodeExecuteBase;
@@ -60,6 +68,8 @@ class X64CodeCache : public CodeCache {
   bool has_indirection_table() { return indirection_table_base_ != nullptr; }
   void set_indirection_default(uint32_t default_value);
   void AddIndirection(uint32_t guest_address, uint32_t host_address);
+  // Resets the entry to the default, resolving the function on calls.
+  void RemoveIndirection(uint32_t guest_address);
 
   void CommitExecutableRange(uint32_t guest_low, uint32_t guest_high);
 
@@ -67,13 +77,34 @@ class X64CodeCache : public CodeCache {
                      const EmitFunctionInfo& func_info,
                      void*& code_execute_address_out,
                      void*& code_write_address_out);
+  // The source map, if available, is only used for the symbols for host
+  // profilers.
   void PlaceGuestCode(uint32_t guest_address, void* machine_code,
                       const EmitFunctionInfo& func_info,
                       GuestFunction* function_info,
                       void*& code_execute_address_out,
-                      void*& code_write_address_out);
+                      void*& code_write_address_out,
+                      const std::vector<SourceMapEntry>* source_map = nullptr);
   uint32_t PlaceData(const void* data, size_t length);
 
+  // Releases code placed by PlaceHostCode or PlaceGuestCode for reuse. The
+  // caller must ensure that no thread can execute it anymore, and nothing may
+  // patch it afterwards other than via the checked PatchCode.
+  void FreeCode(void* code_execute_address);
+
+  // Unique identifier of the placement containing the address, or 0 if it's
+  // not in placed code, for detecting that code has been freed.
+  uint64_t GetAllocationId(const void* code_execute_address);
+
+  // Atomically replaces a part of the generated code, which may be executing
+  // on other threads, such as to patch a call site. The range must not cross
+  // an 8-byte boundary.
+  void PatchCode(void* code_execute_address, const void* data, size_t size);
+  // Same, but only if the code is still in the placement with the identifier
+  // from GetAllocationId, returning whether it was patched.
+  bool PatchCode(void* code_execute_address, const void* data, size_t size,
+                 uint64_t allocation_id);
+
   GuestFunction* LookupFunction(uint64_t host_pc) override;
 
  protected:
@@ -81,43 +112,69 @@ class X64CodeCache : public CodeCache {
   // only map enough for lookups within that range.
   static const size_t kIndirectionTableSize = 0x1FFFFFFF;
   static const uintptr_t kIndirectionTableBase = 0x80000000;
-  // The code range is 512MB, but we know the total code games will have is
-  // pretty small (dozens of mb at most) and our expansion is reasonablish
-  // so 256MB should be more than enough.
-  static const size_t kGeneratedCodeSize = 0x0FFFFFFF;
+  // The code range is only reserved, and committed in chunks as it's filled.
+  // Code replaced by tiered compilation is freed and its space is reused, so
+  // this is just a bound on the live code. The execute and the write views
+  // must both be below 4 GB, as the indirection table, the call sites and the
+  // thunks use 32-bit addresses, and below the guest memory.
+  static const size_t kGeneratedCodeSize = 0x1FFFFFFF;
   static const uintptr_t kGeneratedCodeExecuteBase = 0xA0000000;
   // Used for writing when PageAccess::kExecuteReadWrite is not supported.
   static const uintptr_t kGeneratedCodeWriteBase =
       kGeneratedCodeExecuteBase + kGeneratedCodeSize + 1;
-
-  // This is picked to be high enough to cover whatever we can reasonably
-  // expect. If we hit issues with this it probably means some corner case
-  // in analysis triggering.
-  static const size_t kMaximumFunctionCount = 100000;
+  static const size_t kGeneratedCodeChunkSize = 0x2000000;
 
   struct UnwindReservation {
     size_t data_size = 0;
-    size_t table_slot = 0;
+    // In the write view.
     uint8_t* entry_address = 0;
   };
 
+  // Placed code and its unwind information.
+  struct CodeAllocation {
+    uint32_t code_size;
+    // Including the unwind information and the alignment.
+    uint32_t total_size;
+    GuestFunction* function;
+    uint64_t id;
+  };
+
   X64CodeCache();
 
-  virtual UnwindReservation RequestUnwindReservation(uint8_t* entry_address) {
-    return UnwindReservation();
-  }
+  // Size of the unwind information placed after the code of every function.
+  virtual size_t GetUnwindReservationSize() { return 0; }
   virtual void PlaceCode(uint32_t guest_address, void* machine_code,
                          const EmitFunctionInfo& func_info,
                          void* code_execute_address,
                          UnwindReservation unwind_reservation) {}
+  // Called with the allocation mutex held before the space is reused.
+  virtual void FreeUnwindReservation(void* code_execute_address,
+                                     uint8_t* unwind_entry_address) {}
+
+  // Returns the offset of the space for the given number of bytes (a multiple
+  // of 16) in the generated code, committing more chunks if needed. Called
+  // with the allocation mutex held.
+  size_t AllocateSpace(size_t size);
+  // Called with the allocation mutex held.
+  const CodeAllocation* LookupAllocation(uint64_t host_pc,
+                                         uint32_t* offset_out) const;
+  uint8_t* GetUnwindEntryAddress(uint32_t offset,
+                                 const CodeAllocation& allocation) const {
+    return generated_code_write_base_ + offset +
+           xe::round_up(allocation.code_size, uint32_t(16));
+  }
 
   std::filesystem::path file_name_;
   xe::memory::FileMappingHandle mapping_ =
       xe::memory::kFileMappingHandleInvalid;
 
-  // NOTE: the global critical region must be held when manipulating the offsets
-  // or counts of anything, to keep the tables consistent and ordered.
-  xe::global_critical_region global_critical_region_;
+  // Protects the allocations and the free space. Not the global critical
+  // region, as code may be freed or looked up (also from exception handlers)
+  // while other locks are held, so this must be taken last.
+  std::mutex allocation_mutex_;
+
+  // Serializes the read-modify-write of 8-byte blocks of code in PatchCode.
+  std::mutex patch_mutex_;
 
   // Value that the indirection table will be initialized with upon commit.
   uint32_t indirection_default_value_ = 0xFEEDF00D;
@@ -133,14 +190,21 @@ class X64CodeCache : public CodeCache {
   // PageAccess::kExecuteReadWrite is not supported, for writing the generated
   // code. Equals to generated_code_execute_base_ when it's supported.
   uint8_t* generated_code_write_base_ = nullptr;
-  // Current offset to empty space in generated code.
+  // Current offset to never used space in generated code.
   size_t generated_code_offset_ = 0;
-  // Current high water mark of COMMITTED code.
-  std::atomic<size_t> generated_code_commit_mark_ = {0};
-  // Sorted map by host PC base offsets to source function info.
-  // This can be used to bsearch on host PC to find the guest function.
-  // The key is [start address | end address].
-  std::vector<std::pair<uint64_t, GuestFunction*>> generated_code_map_;
+  // Current high water mark of COMMITTED code, a multiple of the chunk size.
+  size_t generated_code_commit_mark_ = 0;
+  uint32_t host_numa_node_ = UINT32_MAX;
+  // Placed code by the offset in the generated code, for looking up the
+  // function from the host PC.
+  std::map<uint32_t, CodeAllocation> allocations_;
+  uint64_t next_allocation_id_ = 1;
+  // Freed space below generated_code_offset_, by offset and by size for best
+  // fit allocation.
+  std::map<uint32_t, uint32_t> free_ranges_;
+  std::set<std::pair<uint32_t, uint32_t>> free_ranges_by_size_;
+
+  X64JitSymbols jit_symbols_;
 };
 
 }  // namespace x64
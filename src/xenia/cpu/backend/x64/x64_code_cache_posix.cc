@@ -2,18 +2,40 @@
  ******************************************************************************
  * Xenia : Xbox 360 Emulator Research Project                                 *
  ******************************************************************************
- * Copyright 2017 Ben Vanik. All rights reserved.                             *
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
  * Released under the BSD license - see LICENSE in the root for more details. *
  ******************************************************************************
  */
 
 #include "xenia/cpu/backend/x64/x64_code_cache.h"
 
+#include <cstring>
+
+#include "xenia/base/assert.h"
+
+// From the unwinder of libgcc, taking the beginning of an .eh_frame section
+// terminated by a zero length.
+extern "C" void __register_frame(void* begin);
+extern "C" void __deregister_frame(void* begin);
+
 namespace xe {
 namespace cpu {
 namespace backend {
 namespace x64 {
 
+// Minimal .eh_frame for every function: a CIE with the state at the entry and
+// an FDE describing the stack allocation in the prolog. Registers are not
+// saved in the prolog, and the epilog is not described, like on Windows.
+// CIE: 4 length, 4 ID, 1 version, 3 augmentation, 1 code alignment, 1 data
+// alignment, 1 return address register, 1 augmentation data length, 1 pointer
+// encoding, 3 DW_CFA_def_cfa, 2 DW_CFA_offset, padded to 8 bytes.
+static const uint32_t kEhFrameCieSize = 24;
+// FDE: 4 length, 4 CIE pointer, 8 start, 8 length, 1 augmentation data length,
+// 2 DW_CFA_advance_loc1, 1 + up to 5 DW_CFA_def_cfa_offset, padded to 8 bytes.
+static const uint32_t kEhFrameFdeSize = 40;
+// Followed by the terminator.
+static const uint32_t kEhFrameSize = kEhFrameCieSize + kEhFrameFdeSize + 4;
+
 class PosixX64CodeCache : public X64CodeCache {
  public:
   PosixX64CodeCache();
@@ -24,16 +46,21 @@ class PosixX64CodeCache : public X64CodeCache {
   void* LookupUnwindInfo(uint64_t host_pc) override { return nullptr; }
 
  private:
-  /*
-  UnwindReservation RequestUnwindReservation(uint8_t* entry_address) override;
-  void PlaceCode(uint32_t guest_address, void* machine_code, size_t code_size,
-                 size_t stack_size, void* code_execute_address,
+  size_t GetUnwindReservationSize() override { return kEhFrameSize; }
+  void PlaceCode(uint32_t guest_address, void* machine_code,
+                 const EmitFunctionInfo& func_info, void* code_execute_address,
                  UnwindReservation unwind_reservation) override;
+  void FreeUnwindReservation(void* code_execute_address,
+                             uint8_t* unwind_entry_address) override;
 
   void InitializeUnwindEntry(uint8_t* unwind_entry_address,
-                             size_t unwind_table_slot, void* code_address,
-                             size_t code_size, size_t stack_size);
-  */
+                             void* code_execute_address,
+                             const EmitFunctionInfo& func_info);
+
+  uint8_t* GetExecuteAddress(uint8_t* write_address) const {
+    return generated_code_execute_base_ +
+           (write_address - generated_code_write_base_);
+  }
 };
 
 std::unique_ptr<X64CodeCache> X64CodeCache::Create() {
@@ -41,11 +68,95 @@ std::unique_ptr<X64CodeCache> X64CodeCache::Create() {
 }
 
 PosixX64CodeCache::PosixX64CodeCache() = default;
-PosixX64CodeCache::~PosixX64CodeCache() = default;
+
+PosixX64CodeCache::~PosixX64CodeCache() {
+  // The unwinder must not reference the code after it's unmapped.
+  std::lock_guard<std::mutex> lock(allocation_mutex_);
+  for (const auto& allocation : allocations_) {
+    __deregister_frame(GetExecuteAddress(
+        GetUnwindEntryAddress(allocation.first, allocation.second)));
+  }
+}
 
 bool PosixX64CodeCache::Initialize() { return X64CodeCache::Initialize(); }
 
+void PosixX64CodeCache::PlaceCode(uint32_t guest_address, void* machine_code,
+                                  const EmitFunctionInfo& func_info,
+                                  void* code_execute_address,
+                                  UnwindReservation unwind_reservation) {
+  InitializeUnwindEntry(unwind_reservation.entry_address, code_execute_address,
+                        func_info);
+  __register_frame(GetExecuteAddress(unwind_reservation.entry_address));
+}
+
+void PosixX64CodeCache::FreeUnwindReservation(void* code_execute_address,
+                                              uint8_t* unwind_entry_address) {
+  __deregister_frame(GetExecuteAddress(unwind_entry_address));
+}
+
+void PosixX64CodeCache::InitializeUnwindEntry(
+    uint8_t* unwind_entry_address, void* code_execute_address,
+    const EmitFunctionInfo& func_info) {
+  std::memset(unwind_entry_address, 0, kEhFrameSize);
+
+  // CIE.
+  uint8_t* cie = unwind_entry_address;
+  uint32_t cie_length = kEhFrameCieSize - sizeof(uint32_t);
+  std::memcpy(cie, &cie_length, sizeof(cie_length));
+  // CIE ID (0) at 4.
+  cie[8] = 1;  // Version.
+  // Augmentation "zR" - pointer encoding in the augmentation data.
+  cie[9] = 'z';
+  cie[10] = 'R';
+  cie[11] = 0;
+  cie[12] = 1;     // Code alignment factor.
+  cie[13] = 0x78;  // Data alignment factor (SLEB128 -8).
+  cie[14] = 16;    // Return address register (RIP).
+  cie[15] = 1;     // Augmentation data length.
+  cie[16] = 0x00;  // DW_EH_PE_absptr.
+  // At the entry, CFA = rsp + 8.
+  cie[17] = 0x0C;  // DW_CFA_def_cfa.
+  cie[18] = 7;     // rsp.
+  cie[19] = 8;
+  // Return address at CFA - 8.
+  cie[20] = 0x80 | 16;  // DW_CFA_offset (RIP).
+  cie[21] = 1;
+  // DW_CFA_nop padding.
+
+  // FDE.
+  uint8_t* fde = unwind_entry_address + kEhFrameCieSize;
+  uint32_t fde_length = kEhFrameFdeSize - sizeof(uint32_t);
+  std::memcpy(fde, &fde_length, sizeof(fde_length));
+  // Offset from this field to the CIE.
+  uint32_t cie_pointer = kEhFrameCieSize + sizeof(uint32_t);
+  std::memcpy(fde + 4, &cie_pointer, sizeof(cie_pointer));
+  uint64_t pc_begin = uint64_t(code_execute_address);
+  std::memcpy(fde + 8, &pc_begin, sizeof(pc_begin));
+  uint64_t pc_range = func_info.code_size.total;
+  std::memcpy(fde + 16, &pc_range, sizeof(pc_range));
+  fde[24] = 0;  // Augmentation data length.
+  uint8_t* cfa_op = fde + 25;
+  if (func_info.stack_size) {
+    // After the stack allocation, CFA = rsp + stack_size + 8.
+    assert_true(func_info.prolog_stack_alloc_offset < 256);
+    *(cfa_op++) = 0x02;  // DW_CFA_advance_loc1.
+    *(cfa_op++) = uint8_t(func_info.prolog_stack_alloc_offset);
+    *(cfa_op++) = 0x0E;  // DW_CFA_def_cfa_offset.
+    uint64_t cfa_offset = func_info.stack_size + 8;
+    do {
+      uint8_t cfa_offset_byte = cfa_offset & 0x7F;
+      cfa_offset >>= 7;
+      if (cfa_offset) {
+        cfa_offset_byte |= 0x80;
+      }
+      *(cfa_op++) = cfa_offset_byte;
+    } while (cfa_offset);
+  }
+  assert_true(cfa_op <= fde + kEhFrameFdeSize);
+  // DW_CFA_nop padding, and the zero terminator after the FDE.
+}
+
 }  // namespace x64
 }  // namespace backend
 }  // namespace cpu
-}  // namespace xe
\ No newline at end of file
+}  // namespace xe
@@ -20,12 +20,6 @@
 #include "xenia/base/platform_win.h"
 #include "xenia/cpu/function.h"
 
-// Function pointer definitions
-using FnRtlAddGrowableFunctionTable = decltype(&RtlAddGrowableFunctionTable);
-using FnRtlGrowFunctionTable = decltype(&RtlGrowFunctionTable);
-using FnRtlDeleteGrowableFunctionTable =
-    decltype(&RtlDeleteGrowableFunctionTable);
-
 namespace xe {
 namespace cpu {
 namespace backend {
@@ -94,6 +88,11 @@ typedef struct _UNWIND_INFO {
 // TODO(benvanik): move this to emitter.
 static const uint32_t kUnwindInfoSize =
     sizeof(UNWIND_INFO) + (sizeof(UNWIND_CODE) * (6 - 1));
+// The function table entry is stored after the unwind info, as entries of
+// growable function tables must be sorted, which is not the case when the space
+// of freed code is reused.
+static const uint32_t kUnwindReservationSize =
+    kUnwindInfoSize + sizeof(RUNTIME_FUNCTION);
 
 class Win32X64CodeCache : public X64CodeCache {
  public:
@@ -105,28 +104,16 @@ class Win32X64CodeCache : public X64CodeCache {
   void* LookupUnwindInfo(uint64_t host_pc) override;
 
  private:
-  UnwindReservation RequestUnwindReservation(uint8_t* entry_address) override;
+  size_t GetUnwindReservationSize() override { return kUnwindReservationSize; }
   void PlaceCode(uint32_t guest_address, void* machine_code,
                  const EmitFunctionInfo& func_info, void* code_execute_address,
                  UnwindReservation unwind_reservation) override;
 
   void InitializeUnwindEntry(uint8_t* unwind_entry_address,
-                             size_t unwind_table_slot,
                              void* code_execute_address,
                              const EmitFunctionInfo& func_info);
 
-  // Growable function table system handle.
-  void* unwind_table_handle_ = nullptr;
-  // Actual unwind table entries.
-  std::vector<RUNTIME_FUNCTION> unwind_table_;
-  // Current number of entries in the table.
-  std::atomic<uint32_t> unwind_table_count_ = {0};
-  // Does this version of Windows support growable funciton tables?
-  bool supports_growable_table_ = false;
-
-  FnRtlAddGrowableFunctionTable add_growable_table_ = nullptr;
-  FnRtlDeleteGrowableFunctionTable delete_growable_table_ = nullptr;
-  FnRtlGrowFunctionTable grow_table_ = nullptr;
+  bool function_table_callback_installed_ = false;
 };
 
 std::unique_ptr<X64CodeCache> X64CodeCache::Create() {
@@ -136,15 +123,9 @@ std::unique_ptr<X64CodeCache> X64CodeCache::Create() {
 Win32X64CodeCache::Win32X64CodeCache() = default;
 
 Win32X64CodeCache::~Win32X64CodeCache() {
-  if (supports_growable_table_) {
-    if (unwind_table_handle_) {
-      delete_growable_table_(unwind_table_handle_);
-    }
-  } else {
-    if (generated_code_execute_base_) {
-      RtlDeleteFunctionTable(reinterpret_cast<PRUNTIME_FUNCTION>(
-          reinterpret_cast<DWORD64>(generated_code_execute_base_) | 0x3));
-    }
+  if (function_table_callback_installed_) {
+    RtlDeleteFunctionTable(reinterpret_cast<PRUNTIME_FUNCTION>(
+        reinterpret_cast<DWORD64>(generated_code_execute_base_) | 0x3));
   }
 }
 
@@ -153,85 +134,35 @@ bool Win32X64CodeCache::Initialize() {
     return false;
   }
 
-  // Compute total number of unwind entries we should allocate.
-  // We don't support reallocing right now, so this should be high.
-  unwind_table_.resize(kMaximumFunctionCount);
-
-  // Check if this version of Windows supports growable function tables.
-  auto ntdll_handle = GetModuleHandleW(L"ntdll.dll");
-  if (!ntdll_handle) {
-    add_growable_table_ = nullptr;
-    delete_growable_table_ = nullptr;
-    grow_table_ = nullptr;
-  } else {
-    add_growable_table_ = (FnRtlAddGrowableFunctionTable)GetProcAddress(
-        ntdll_handle, "RtlAddGrowableFunctionTable");
-    delete_growable_table_ = (FnRtlDeleteGrowableFunctionTable)GetProcAddress(
-        ntdll_handle, "RtlDeleteGrowableFunctionTable");
-    grow_table_ = (FnRtlGrowFunctionTable)GetProcAddress(
-        ntdll_handle, "RtlGrowFunctionTable");
-  }
-  supports_growable_table_ =
-      add_growable_table_ && delete_growable_table_ && grow_table_;
-
-  // Create table and register with the system. It's empty now, but we'll grow
-  // it as functions are added.
-  if (supports_growable_table_) {
-    if (add_growable_table_(
-            &unwind_table_handle_, unwind_table_.data(), unwind_table_count_,
-            DWORD(unwind_table_.size()),
-            reinterpret_cast<ULONG_PTR>(generated_code_execute_base_),
-            reinterpret_cast<ULONG_PTR>(generated_code_execute_base_ +
-                                        kGeneratedCodeSize))) {
-      XELOGE("Unable to create unwind function table");
-      return false;
-    }
-  } else {
-    // Install a callback that the debugger will use to lookup unwind info on
-    // demand.
-    if (!RtlInstallFunctionTableCallback(
-            reinterpret_cast<DWORD64>(generated_code_execute_base_) | 0x3,
-            reinterpret_cast<DWORD64>(generated_code_execute_base_),
-            kGeneratedCodeSize,
-            [](DWORD64 control_pc, PVOID context) {
-              auto code_cache = reinterpret_cast<Win32X64CodeCache*>(context);
-              return reinterpret_cast<PRUNTIME_FUNCTION>(
-                  code_cache->LookupUnwindInfo(control_pc));
-            },
-            this, nullptr)) {
-      XELOGE("Unable to install function table callback");
-      return false;
-    }
+  // Install a callback that the system and the debugger will use to lookup
+  // unwind info on demand, covering the whole code range no matter how much of
+  // it is used.
+  if (!RtlInstallFunctionTableCallback(
+          reinterpret_cast<DWORD64>(generated_code_execute_base_) | 0x3,
+          reinterpret_cast<DWORD64>(generated_code_execute_base_),
+          kGeneratedCodeSize,
+          [](DWORD64 control_pc, PVOID context) {
+            auto code_cache = reinterpret_cast<Win32X64CodeCache*>(context);
+            return reinterpret_cast<PRUNTIME_FUNCTION>(
+                code_cache->LookupUnwindInfo(control_pc));
+          },
+          this, nullptr)) {
+    XELOGE("Unable to install function table callback");
+    return false;
   }
+  function_table_callback_installed_ = true;
 
   return true;
 }
 
-Win32X64CodeCache::UnwindReservation
-Win32X64CodeCache::RequestUnwindReservation(uint8_t* entry_address) {
-  assert_false(unwind_table_count_ >= kMaximumFunctionCount);
-  UnwindReservation unwind_reservation;
-  unwind_reservation.data_size = xe::round_up(kUnwindInfoSize, 16);
-  unwind_reservation.table_slot = unwind_table_count_++;
-  unwind_reservation.entry_address = entry_address;
-  return unwind_reservation;
-}
-
 void Win32X64CodeCache::PlaceCode(uint32_t guest_address, void* machine_code,
                                   const EmitFunctionInfo& func_info,
                                   void* code_execute_address,
                                   UnwindReservation unwind_reservation) {
   // Add unwind info.
-  InitializeUnwindEntry(unwind_reservation.entry_address,
-                        unwind_reservation.table_slot, code_execute_address,
+  InitializeUnwindEntry(unwind_reservation.entry_address, code_execute_address,
                         func_info);
 
-  if (supports_growable_table_) {
-    // Notify that the unwind table has grown.
-    // We do this outside of the lock, but with the latest total count.
-    grow_table_(unwind_table_handle_, unwind_table_count_);
-  }
-
   // This isn't needed on x64 (probably), but is convention.
   // On UWP, FlushInstructionCache available starting from 10.0.16299.0.
   // https://docs.microsoft.com/en-us/uwp/win32-and-com/win32-apis
@@ -240,8 +171,8 @@ void Win32X64CodeCache::PlaceCode(uint32_t guest_address, void* machine_code,
 }
 
 void Win32X64CodeCache::InitializeUnwindEntry(
-    uint8_t* unwind_entry_address, size_t unwind_table_slot,
-    void* code_execute_address, const EmitFunctionInfo& func_info) {
+    uint8_t* unwind_entry_address, void* code_execute_address,
+    const EmitFunctionInfo& func_info) {
   auto unwind_info = reinterpret_cast<UNWIND_INFO*>(unwind_entry_address);
   UNWIND_CODE* unwind_code = nullptr;
 
@@ -303,32 +234,27 @@ void Win32X64CodeCache::InitializeUnwindEntry(
   }
 
   // Add entry.
-  auto& fn_entry = unwind_table_[unwind_table_slot];
-  fn_entry.BeginAddress =
+  auto fn_entry = reinterpret_cast<RUNTIME_FUNCTION*>(unwind_entry_address +
+                                                      kUnwindInfoSize);
+  fn_entry->BeginAddress =
       DWORD(reinterpret_cast<uint8_t*>(code_execute_address) -
             generated_code_execute_base_);
-  fn_entry.EndAddress =
-      DWORD(fn_entry.BeginAddress + func_info.code_size.total);
-  fn_entry.UnwindData =
-      DWORD(unwind_entry_address - generated_code_execute_base_);
+  fn_entry->EndAddress =
+      DWORD(fn_entry->BeginAddress + func_info.code_size.total);
+  fn_entry->UnwindData =
+      DWORD(unwind_entry_address - generated_code_write_base_);
 }
 
 void* Win32X64CodeCache::LookupUnwindInfo(uint64_t host_pc) {
-  return std::bsearch(
-      &host_pc, unwind_table_.data(), unwind_table_count_,
-      sizeof(RUNTIME_FUNCTION),
-      [](const void* key_ptr, const void* element_ptr) {
-        auto key = *reinterpret_cast<const uintptr_t*>(key_ptr) -
-                   kGeneratedCodeExecuteBase;
-        auto element = reinterpret_cast<const RUNTIME_FUNCTION*>(element_ptr);
-        if (key < element->BeginAddress) {
-          return -1;
-        } else if (key > element->EndAddress) {
-          return 1;
-        } else {
-          return 0;
-        }
-      });
+  std::lock_guard<std::mutex> lock(allocation_mutex_);
+  uint32_t offset;
+  const CodeAllocation* allocation = LookupAllocation(host_pc, &offset);
+  if (!allocation) {
+    return nullptr;
+  }
+  uint8_t* unwind_entry_address = GetUnwindEntryAddress(offset, *allocation);
+  return generated_code_execute_base_ +
+         (unwind_entry_address - generated_code_write_base_) + kUnwindInfoSize;
 }
 
 }  // namespace x64
@@ -0,0 +1,343 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/backend/x64/x64_code_storage.h"
+
+#include <cstring>
+
+#include "build/version.h"
+#include "third_party/fmt/include/fmt/format.h"
+#include "xenia/base/assert.h"
+#include "xenia/base/byte_order.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/string.h"
+#include "xenia/base/xxhash.h"
+#include "xenia/cpu/backend/x64/x64_function.h"
+#include "xenia/cpu/module.h"
+#include "xenia/memory.h"
+
+namespace xe {
+namespace cpu {
+namespace backend {
+namespace x64 {
+
+bool X64CodeStorage::Initialize(const std::filesystem::path& cache_root,
+                                uint32_t title_id, const Layout& layout) {
+  Shutdown();
+
+  auto storage_root = cache_root / "jit" / "local";
+  if (!std::filesystem::exists(storage_root)) {
+    if (!std::filesystem::create_directories(storage_root)) {
+      XELOGE(
+          "Failed to create the x64 code storage directory, persistent code "
+          "storage will be disabled: {}",
+          xe::path_to_utf8(storage_root));
+      return false;
+    }
+  }
+
+  auto file_path = storage_root / fmt::format("{:08X}.x64.xjit", title_id);
+  file_ = xe::filesystem::OpenFile(file_path, "a+b");
+  if (!file_) {
+    XELOGE(
+        "Failed to open the x64 code storage file for writing, persistent code "
+        "storage will be disabled: {}",
+        xe::path_to_utf8(file_path));
+    return false;
+  }
+
+  struct {
+    uint32_t magic;
+    uint32_t version_swapped;
+    Layout layout;
+  } file_header;
+  // 'XEXC'.
+  const uint32_t file_magic = 0x43584558;
+  uint64_t valid_bytes = 0;
+  if (fread(&file_header, sizeof(file_header), 1, file_) &&
+      file_header.magic == file_magic &&
+      xe::byte_swap(file_header.version_swapped) == kVersion &&
+      !std::memcmp(&file_header.layout, &layout, sizeof(layout))) {
+    valid_bytes = sizeof(file_header);
+    // Index the functions stored by previous runs, until the end of the file
+    // or a corrupted record.
+    StoredFunctionHeader function_header;
+    std::vector<uint8_t> record;
+    while (fread(&function_header, sizeof(function_header), 1, file_)) {
+      size_t record_size =
+          sizeof(function_header) - sizeof(function_header.record_hash) +
+          function_header.code_size_total +
+          sizeof(uint32_t) * function_header.host_image_relocation_count +
+          sizeof(CallSite) * function_header.call_site_count +
+          sizeof(ConstantReference) *
+              function_header.constant_reference_count +
+          sizeof(SourceMapEntry) * function_header.source_map_entry_count;
+      record.resize(record_size);
+      size_t header_rest_size =
+          sizeof(function_header) - sizeof(function_header.record_hash);
+      std::memcpy(record.data(),
+                  reinterpret_cast<const uint8_t*>(&function_header) +
+                      sizeof(function_header.record_hash),
+                  header_rest_size);
+      if (fread(record.data() + header_rest_size,
+                record_size - header_rest_size, 1, file_) != 1 ||
+          XXH3_64bits(record.data(), record_size) !=
+              function_header.record_hash) {
+        break;
+      }
+      // Later records for the same function (stored after the guest code has
+      // changed) replace earlier ones.
+      stored_functions_[GetFunctionKey(function_header.module_hash,
+                                       function_header.guest_address)] =
+          valid_bytes;
+      valid_bytes += sizeof(StoredFunctionHeader) + record_size -
+                     header_rest_size;
+    }
+  }
+  if (!valid_bytes) {
+    file_header.magic = file_magic;
+    file_header.version_swapped = xe::byte_swap(kVersion);
+    file_header.layout = layout;
+  }
+  // Drop everything that is corrupted or incompatible.
+  xe::filesystem::TruncateStdioFile(file_, valid_bytes);
+  if (!valid_bytes) {
+    fwrite(&file_header, sizeof(file_header), 1, file_);
+    fflush(file_);
+  }
+  XELOGI("Found {} functions in the x64 code storage",
+         stored_functions_.size());
+  return true;
+}
+
+void X64CodeStorage::Shutdown() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (file_) {
+    fclose(file_);
+    file_ = nullptr;
+  }
+  stored_functions_.clear();
+  module_hashes_.clear();
+}
+
+uint64_t X64CodeStorage::GetHostImageAnchor() {
+  return reinterpret_cast<uint64_t>(&X64CodeStorage::GetHostImageAnchor);
+}
+
+uint64_t X64CodeStorage::HashGuestCode(const GuestFunction* function) {
+  const Memory* memory = function->module()->memory();
+  uint32_t address = function->address();
+  // The end address is inclusive (the last instruction).
+  return XXH3_64bits(memory->TranslateVirtual(address),
+                     function->end_address() + 4 - address);
+}
+
+uint64_t X64CodeStorage::HashModule(const GuestFunction* function) {
+  // Called with the mutex held.
+  const Module* module = function->module();
+  auto it = module_hashes_.find(module);
+  if (it != module_hashes_.end()) {
+    return it->second;
+  }
+  const std::string& name = module->name();
+  uint64_t hash = XXH3_64bits(name.data(), name.size());
+  module_hashes_.emplace(module, hash);
+  return hash;
+}
+
+bool X64CodeStorage::LoadFunction(const GuestFunction* function,
+                                  uint64_t guest_code_hash,
+                                  StoredFunction& function_out) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!file_) {
+    return false;
+  }
+  uint64_t module_hash = HashModule(function);
+  auto it = stored_functions_.find(
+      GetFunctionKey(module_hash, function->address()));
+  if (it == stored_functions_.end()) {
+    return false;
+  }
+
+  StoredFunctionHeader function_header;
+  if (!xe::filesystem::Seek(file_, int64_t(it->second), SEEK_SET) ||
+      !fread(&function_header, sizeof(function_header), 1, file_)) {
+    return false;
+  }
+  if (function_header.module_hash != module_hash ||
+      function_header.guest_address != function->address() ||
+      function_header.guest_end_address != function->end_address() ||
+      function_header.guest_code_hash != guest_code_hash) {
+    // Patched or modified since it was stored - will be re-emitted and stored
+    // again.
+    return false;
+  }
+  function_out.code.resize(function_header.code_size_total);
+  function_out.host_image_relocations.resize(
+      function_header.host_image_relocation_count);
+  function_out.call_sites.resize(function_header.call_site_count);
+  function_out.constant_references.resize(
+      function_header.constant_reference_count);
+  function_out.source_map.resize(function_header.source_map_entry_count);
+  if (fread(function_out.code.data(), 1, function_out.code.size(), file_) !=
+          function_out.code.size() ||
+      fread(function_out.host_image_relocations.data(), sizeof(uint32_t),
+            function_out.host_image_relocations.size(),
+            file_) != function_out.host_image_relocations.size() ||
+      fread(function_out.call_sites.data(), sizeof(CallSite),
+            function_out.call_sites.size(),
+            file_) != function_out.call_sites.size() ||
+      fread(function_out.constant_references.data(),
+            sizeof(ConstantReference), function_out.constant_references.size(),
+            file_) != function_out.constant_references.size() ||
+      fread(function_out.source_map.data(), sizeof(SourceMapEntry),
+            function_out.source_map.size(),
+            file_) != function_out.source_map.size()) {
+    return false;
+  }
+
+  EmitFunctionInfo& func_info = function_out.func_info;
+  func_info.code_size.prolog = function_header.code_size_prolog;
+  func_info.code_size.body = function_header.code_size_body;
+  func_info.code_size.epilog = function_header.code_size_epilog;
+  func_info.code_size.tail = function_header.code_size_tail;
+  func_info.code_size.total = function_header.code_size_total;
+  func_info.prolog_stack_alloc_offset =
+      function_header.prolog_stack_alloc_offset;
+  func_info.stack_size = function_header.stack_size;
+
+  uint64_t anchor = GetHostImageAnchor();
+  for (uint32_t relocation_offset : function_out.host_image_relocations) {
+    if (relocation_offset + sizeof(uint64_t) > function_out.code.size()) {
+      return false;
+    }
+    uint8_t* relocation = function_out.code.data() + relocation_offset;
+    uint64_t value;
+    std::memcpy(&value, relocation, sizeof(value));
+    value += anchor;
+    std::memcpy(relocation, &value, sizeof(value));
+  }
+  for (const CallSite& call_site : function_out.call_sites) {
+    if (call_site.code_offset + X64Function::kCallSiteSize >
+        function_out.code.size()) {
+      return false;
+    }
+  }
+  for (const ConstantReference& reference : function_out.constant_references) {
+    if (reference.code_offset + sizeof(uint32_t) > function_out.code.size()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void X64CodeStorage::StoreFunction(
+    const GuestFunction* function, uint64_t guest_code_hash,
+    const uint8_t* code, const EmitFunctionInfo& func_info,
+    const std::vector<uint32_t>& host_image_relocations,
+    const std::vector<CallSite>& call_sites,
+    const std::vector<ConstantReference>& constant_references,
+    const std::vector<SourceMapEntry>& source_map) {
+  StoredFunctionHeader function_header;
+  function_header.guest_code_hash = guest_code_hash;
+  function_header.guest_address = function->address();
+  function_header.guest_end_address = function->end_address();
+  function_header.code_size_prolog = uint32_t(func_info.code_size.prolog);
+  function_header.code_size_body = uint32_t(func_info.code_size.body);
+  function_header.code_size_epilog = uint32_t(func_info.code_size.epilog);
+  function_header.code_size_tail = uint32_t(func_info.code_size.tail);
+  function_header.code_size_total = uint32_t(func_info.code_size.total);
+  function_header.prolog_stack_alloc_offset =
+      uint32_t(func_info.prolog_stack_alloc_offset);
+  function_header.stack_size = uint32_t(func_info.stack_size);
+  function_header.host_image_relocation_count =
+      uint32_t(host_image_relocations.size());
+  function_header.call_site_count = uint32_t(call_sites.size());
+  function_header.constant_reference_count =
+      uint32_t(constant_references.size());
+  function_header.source_map_entry_count = uint32_t(source_map.size());
+
+  // Build the record with relocations made relative to the anchor.
+  std::vector<uint8_t> record;
+  size_t header_rest_size =
+      sizeof(function_header) - sizeof(function_header.record_hash);
+  size_t code_offset = header_rest_size;
+  size_t relocations_offset = code_offset + func_info.code_size.total;
+  size_t call_sites_offset =
+      relocations_offset + sizeof(uint32_t) * host_image_relocations.size();
+  size_t constant_references_offset =
+      call_sites_offset + sizeof(CallSite) * call_sites.size();
+  size_t source_map_offset =
+      constant_references_offset +
+      sizeof(ConstantReference) * constant_references.size();
+  record.resize(source_map_offset +
+                sizeof(SourceMapEntry) * source_map.size());
+  std::memcpy(record.data() + code_offset, code, func_info.code_size.total);
+  uint64_t anchor = GetHostImageAnchor();
+  for (uint32_t relocation_offset : host_image_relocations) {
+    assert_true(relocation_offset + sizeof(uint64_t) <=
+                func_info.code_size.total);
+    uint8_t* relocation = record.data() + code_offset + relocation_offset;
+    uint64_t value;
+    std::memcpy(&value, relocation, sizeof(value));
+    value -= anchor;
+    std::memcpy(relocation, &value, sizeof(value));
+  }
+  for (const ConstantReference& reference : constant_references) {
+    assert_true(reference.code_offset + sizeof(uint32_t) <=
+                func_info.code_size.total);
+    std::memset(record.data() + code_offset + reference.code_offset, 0,
+                sizeof(uint32_t));
+  }
+  if (!host_image_relocations.empty()) {
+    std::memcpy(record.data() + relocations_offset,
+                host_image_relocations.data(),
+                sizeof(uint32_t) * host_image_relocations.size());
+  }
+  if (!call_sites.empty()) {
+    std::memcpy(record.data() + call_sites_offset, call_sites.data(),
+                sizeof(CallSite) * call_sites.size());
+  }
+  if (!constant_references.empty()) {
+    std::memcpy(record.data() + constant_references_offset,
+                constant_references.data(),
+                sizeof(ConstantReference) * constant_references.size());
+  }
+  if (!source_map.empty()) {
+    std::memcpy(record.data() + source_map_offset, source_map.data(),
+                sizeof(SourceMapEntry) * source_map.size());
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!file_) {
+    return;
+  }
+  function_header.module_hash = HashModule(function);
+  std::memcpy(record.data(),
+              reinterpret_cast<const uint8_t*>(&function_header) +
+                  sizeof(function_header.record_hash),
+              header_rest_size);
+  function_header.record_hash = XXH3_64bits(record.data(), record.size());
+  // Appending regardless of the current position since opened as "a+b".
+  xe::filesystem::Seek(file_, 0, SEEK_END);
+  uint64_t record_offset = uint64_t(xe::filesystem::Tell(file_));
+  fwrite(&function_header.record_hash, sizeof(function_header.record_hash), 1,
+         file_);
+  fwrite(record.data(), 1, record.size(), file_);
+  fflush(file_);
+  stored_functions_[GetFunctionKey(function_header.module_hash,
+                                   function_header.guest_address)] =
+      record_offset;
+}
+
+}  // namespace x64
+}  // namespace backend
+}  // namespace cpu
+}  // namespace xe
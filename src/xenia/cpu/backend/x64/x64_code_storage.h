@@ -0,0 +1,160 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_CPU_BACKEND_X64_X64_CODE_STORAGE_H_
+#define XENIA_CPU_BACKEND_X64_X64_CODE_STORAGE_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "xenia/base/hash.h"
+#include "xenia/cpu/backend/x64/x64_code_cache.h"
+#include "xenia/cpu/function.h"
+
+namespace xe {
+namespace cpu {
+namespace backend {
+namespace x64 {
+
+// Persistent storage of machine code emitted for guest functions, so later
+// runs of the same title can skip translation entirely.
+//
+// Stored code must not contain anything specific to the current process other
+// than:
+// - Addresses in the code cache and the emitter constant data, which are the
+//   same as long as the backend is set up identically - the layout of those is
+//   a part of the file header.
+// - Addresses within the Xenia executable, which are stored relative to an
+//   anchor in it and relocated when loading (see
+//   X64Emitter::MovHostImageAddress). The build is a part of the file header.
+// - Addresses of constants in the X64ConstantPool, which are stored as the
+//   values, added to the pool again when loading.
+// The emitter marks code referencing anything else (kernel objects, MMIO
+// callback contexts, trace data) as not persistable.
+class X64CodeStorage {
+ public:
+  // Describes everything that code generation depends on outside of the guest
+  // code itself. Files created with a different layout are discarded.
+  struct Layout {
+    uint64_t build_hash;
+    uint32_t feature_flags;
+    uint32_t emitter_data;
+    uint32_t host_to_guest_thunk;
+    uint32_t guest_to_host_thunk;
+    uint32_t resolve_function_thunk;
+    // Keeping the structure free of implicit padding for comparison.
+    uint32_t padding;
+  };
+
+  // Patchable call site in the code, stored unlinked (see X64Function).
+  struct CallSite {
+    uint32_t code_offset;
+    uint32_t guest_address;
+  };
+
+  // 32-bit displacement in the code addressing a constant in the
+  // X64ConstantPool, stored as zero.
+  struct ConstantReference {
+    uint32_t code_offset;
+    uint32_t padding;
+    uint64_t value_low;
+    uint64_t value_high;
+  };
+
+  struct StoredFunction {
+    EmitFunctionInfo func_info;
+    // Code with host image relocations stored as offsets from the anchor.
+    std::vector<uint8_t> code;
+    // Offsets of 64-bit host image addresses in the code.
+    std::vector<uint32_t> host_image_relocations;
+    std::vector<CallSite> call_sites;
+    std::vector<ConstantReference> constant_references;
+    std::vector<SourceMapEntry> source_map;
+  };
+
+  X64CodeStorage() = default;
+  X64CodeStorage(const X64CodeStorage& storage) = delete;
+  X64CodeStorage& operator=(const X64CodeStorage& storage) = delete;
+  ~X64CodeStorage() { Shutdown(); }
+
+  bool Initialize(const std::filesystem::path& cache_root, uint32_t title_id,
+                  const Layout& layout);
+  void Shutdown();
+  bool is_open() const { return file_ != nullptr; }
+
+  // All host image relocations are relative to this address.
+  static uint64_t GetHostImageAnchor();
+
+  // Hash identifying the guest code of a function to detect patches and
+  // self-modifying code between runs.
+  static uint64_t HashGuestCode(const GuestFunction* function);
+
+  // Returns the relocated machine code for the function if it has been stored
+  // previously and the guest code is unchanged.
+  bool LoadFunction(const GuestFunction* function, uint64_t guest_code_hash,
+                    StoredFunction& function_out);
+  // Writes the machine code of a function that has just been emitted. Host
+  // image relocations in the code must still contain absolute addresses.
+  void StoreFunction(const GuestFunction* function, uint64_t guest_code_hash,
+                     const uint8_t* code, const EmitFunctionInfo& func_info,
+                     const std::vector<uint32_t>& host_image_relocations,
+                     const std::vector<CallSite>& call_sites,
+                     const std::vector<ConstantReference>& constant_references,
+                     const std::vector<SourceMapEntry>& source_map);
+
+ private:
+  // Update if the format of anything stored or the layout of the entries
+  // changes, or if the layout of PPCContext changes, as its offsets are
+  // embedded in the code.
+  static constexpr uint32_t kVersion = 0x20221109;
+
+  XEPACKEDSTRUCT(StoredFunctionHeader, {
+    // XXH3 of everything in the record after this field.
+    uint64_t record_hash;
+    uint64_t module_hash;
+    uint64_t guest_code_hash;
+    uint32_t guest_address;
+    uint32_t guest_end_address;
+    uint32_t code_size_prolog;
+    uint32_t code_size_body;
+    uint32_t code_size_epilog;
+    uint32_t code_size_tail;
+    uint32_t code_size_total;
+    uint32_t prolog_stack_alloc_offset;
+    uint32_t stack_size;
+    uint32_t host_image_relocation_count;
+    uint32_t call_site_count;
+    uint32_t constant_reference_count;
+    uint32_t source_map_entry_count;
+  });
+
+  static uint64_t GetFunctionKey(uint64_t module_hash, uint32_t address) {
+    return module_hash ^ (uint64_t(address) * UINT64_C(0x9E3779B97F4A7C15));
+  }
+  uint64_t HashModule(const GuestFunction* function);
+
+  std::mutex mutex_;
+  FILE* file_ = nullptr;
+  // Key from GetFunctionKey -> offset of the StoredFunctionHeader in the file.
+  std::unordered_map<uint64_t, uint64_t, xe::hash::IdentityHasher<uint64_t>>
+      stored_functions_;
+  // Cache of module name hashes, since it's queried for every function.
+  std::unordered_map<const Module*, uint64_t> module_hashes_;
+};
+
+}  // namespace x64
+}  // namespace backend
+}  // namespace cpu
+}  // namespace xe
+
+#endif  // XENIA_CPU_BACKEND_X64_X64_CODE_STORAGE_H_
@@ -0,0 +1,79 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/backend/x64/x64_constant_pool.h"
+
+#include <cstring>
+
+#include "xenia/base/assert.h"
+#include "xenia/base/memory.h"
+
+namespace xe {
+namespace cpu {
+namespace backend {
+namespace x64 {
+
+// After the emitter constant data (see X64Emitter::PlaceConstData).
+static const uintptr_t kConstantPoolLocation = 0x21000000;
+// Must stay below 2 GB for the addresses not to be sign-extended.
+static const uintptr_t kConstantPoolLocationEnd = 0x7F000000;
+
+X64ConstantPool::~X64ConstantPool() {
+  if (base_) {
+    memory::DeallocFixed(base_, 0, memory::DeallocationType::kRelease);
+  }
+}
+
+bool X64ConstantPool::Initialize() {
+  for (uintptr_t location = kConstantPoolLocation;
+       !base_ && location + kReservedSize <= kConstantPoolLocationEnd;
+       location += kReservedSize) {
+    base_ = reinterpret_cast<uint8_t*>(memory::AllocFixed(
+        reinterpret_cast<void*>(location), kReservedSize,
+        memory::AllocationType::kReserve, memory::PageAccess::kNoAccess));
+  }
+  if (!base_) {
+    return false;
+  }
+  assert_zero(reinterpret_cast<uintptr_t>(base_ + kReservedSize) &
+              ~uintptr_t(0x7FFFFFFF));
+  return true;
+}
+
+uint32_t X64ConstantPool::GetConstantAddress(const vec128_t& value) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!base_) {
+    return 0;
+  }
+  auto it = addresses_.find(value);
+  if (it != addresses_.end()) {
+    return it->second;
+  }
+  if (used_size_ + sizeof(vec128_t) > committed_size_) {
+    size_t commit_size = memory::page_size();
+    if (committed_size_ + commit_size > kReservedSize ||
+        !memory::AllocFixed(base_ + committed_size_, commit_size,
+                            memory::AllocationType::kCommit,
+                            memory::PageAccess::kReadWrite)) {
+      return 0;
+    }
+    committed_size_ += commit_size;
+  }
+  uint8_t* constant = base_ + used_size_;
+  std::memcpy(constant, &value, sizeof(vec128_t));
+  used_size_ += sizeof(vec128_t);
+  uint32_t address = uint32_t(reinterpret_cast<uintptr_t>(constant));
+  addresses_.emplace(value, address);
+  return address;
+}
+
+}  // namespace x64
+}  // namespace backend
+}  // namespace cpu
+}  // namespace xe
@@ -0,0 +1,65 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_CPU_BACKEND_X64_X64_CONSTANT_POOL_H_
+#define XENIA_CPU_BACKEND_X64_X64_CONSTANT_POOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#include "xenia/base/hash.h"
+#include "xenia/base/vec128.h"
+
+namespace xe {
+namespace cpu {
+namespace backend {
+namespace x64 {
+
+// Constants loaded by the emitted code, shared by all functions, so every
+// distinct value is stored once, and the code loads it with a single
+// instruction instead of building it on the stack. Like the emitter constant
+// data, the pool is placed below 2 GB, so it's addressed with sign-extended
+// 32-bit absolute displacements.
+//
+// Addresses are specific to the current run, and code referencing the pool is
+// stored with the values instead (see X64CodeStorage::ConstantReference).
+class X64ConstantPool {
+ public:
+  X64ConstantPool() = default;
+  X64ConstantPool(const X64ConstantPool& pool) = delete;
+  X64ConstantPool& operator=(const X64ConstantPool& pool) = delete;
+  ~X64ConstantPool();
+
+  bool Initialize();
+
+  // Returns the address of the 16-byte-aligned copy of the value in the pool,
+  // adding it if needed, or 0 if the pool is full. Scalar constants are stored
+  // in the low bits with the rest zeroed. Thread-safe.
+  uint32_t GetConstantAddress(const vec128_t& value);
+
+ private:
+  // Enough for all the distinct constants of any title.
+  static constexpr size_t kReservedSize = 16 * 1024 * 1024;
+
+  std::mutex mutex_;
+  uint8_t* base_ = nullptr;
+  size_t committed_size_ = 0;
+  size_t used_size_ = 0;
+  std::unordered_map<vec128_t, uint32_t, xe::hash::XXHasher<vec128_t>>
+      addresses_;
+};
+
+}  // namespace x64
+}  // namespace backend
+}  // namespace cpu
+}  // namespace xe
+
+#endif  // XENIA_CPU_BACKEND_X64_X64_CONSTANT_POOL_H_
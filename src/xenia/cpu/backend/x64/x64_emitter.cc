@@ -11,8 +11,10 @@
 
 #include <stddef.h>
 
+#include <algorithm>
 #include <climits>
 #include <cstring>
+#include <mutex>
 
 #include "third_party/fmt/include/fmt/format.h"
 #include "xenia/base/assert.h"
@@ -26,6 +28,8 @@
 #include "xenia/base/vec128.h"
 #include "xenia/cpu/backend/x64/x64_backend.h"
 #include "xenia/cpu/backend/x64/x64_code_cache.h"
+#include "xenia/cpu/backend/x64/x64_code_storage.h"
+#include "xenia/cpu/backend/x64/x64_constant_pool.h"
 #include "xenia/cpu/backend/x64/x64_function.h"
 #include "xenia/cpu/backend/x64/x64_sequences.h"
 #include "xenia/cpu/backend/x64/x64_stack_layout.h"
@@ -116,6 +120,26 @@ bool X64Emitter::Emit(GuestFunction* function, HIRBuilder* builder,
   debug_info_flags_ = debug_info_flags;
   trace_data_ = &function->trace_data();
   source_map_arena_.Reset();
+  X64CodeStorage* code_storage = backend_->code_storage();
+  code_persistable_ = code_storage && !debug_info_flags;
+  host_image_relocations_.clear();
+  call_sites_.clear();
+  constant_references_.clear();
+  current_guest_address_ = function->address();
+  function_address_ = function->address();
+  tier_up_function_ = function->tier() == GuestFunction::Tier::kBaseline
+                          ? static_cast<X64Function*>(function)
+                          : nullptr;
+  if (tier_up_function_) {
+    // Baseline code is replaced soon anyway, and the counter is specific to
+    // this run.
+    MarkNotPersistable();
+  }
+  if (builder->attributes() & hir::FUNCTION_ATTRIB_HAS_INLINED_CALLS) {
+    // Only the guest code of the function itself is checked when loading, not
+    // of the inlined callees.
+    MarkNotPersistable();
+  }
 
   // Fill the generator with code.
   EmitFunctionInfo func_info = {};
@@ -123,18 +147,43 @@ bool X64Emitter::Emit(GuestFunction* function, HIRBuilder* builder,
     return false;
   }
 
+  // Stash source map.
+  source_map_arena_.CloneContents(out_source_map);
+
   // Copy the final code to the cache and relocate it.
   *out_code_size = getSize();
-  *out_code_address = Emplace(func_info, function);
+  void* code_write_address;
+  *out_code_address =
+      Emplace(func_info, function, &code_write_address, out_source_map);
+
+  if (code_persistable_) {
+    std::vector<X64CodeStorage::CallSite> stored_call_sites;
+    stored_call_sites.reserve(call_sites_.size());
+    for (const CallSite& call_site : call_sites_) {
+      stored_call_sites.push_back(
+          {call_site.code_offset, call_site.function->address()});
+    }
+    code_storage->StoreFunction(
+        function, X64CodeStorage::HashGuestCode(function),
+        reinterpret_cast<const uint8_t*>(code_write_address), func_info,
+        host_image_relocations_, stored_call_sites, constant_references_,
+        *out_source_map);
+  }
 
-  // Stash source map.
-  source_map_arena_.CloneContents(out_source_map);
+  // Link the calls now that the code is in its final location, but only after
+  // storing it, as the stored code must not depend on other functions.
+  for (const CallSite& call_site : call_sites_) {
+    call_site.function->AddCallSite(
+        reinterpret_cast<uint8_t*>(*out_code_address) + call_site.code_offset);
+  }
 
   return true;
 }
 
 void* X64Emitter::Emplace(const EmitFunctionInfo& func_info,
-                          GuestFunction* function) {
+                          GuestFunction* function,
+                          void** code_write_address_out,
+                          const std::vector<SourceMapEntry>* source_map) {
   // To avoid changing xbyak, we do a switcharoo here.
   // top_ points to the Xbyak buffer, and since we are in AutoGrow mode
   // it has pending relocations. We copy the top_ to our buffer, swap the
@@ -149,7 +198,8 @@ void* X64Emitter::Emplace(const EmitFunctionInfo& func_info,
   assert_true(func_info.code_size.total == size_);
   if (function) {
     code_cache_->PlaceGuestCode(function->address(), top_, func_info, function,
-                                new_execute_address, new_write_address);
+                                new_execute_address, new_write_address,
+                                source_map);
   } else {
     code_cache_->PlaceHostCode(0, top_, func_info, new_execute_address,
                                new_write_address);
@@ -158,6 +208,9 @@ void* X64Emitter::Emplace(const EmitFunctionInfo& func_info,
   ready();
   top_ = old_address;
   reset();
+  if (code_write_address_out) {
+    *code_write_address_out = new_write_address;
+  }
   return new_execute_address;
 }
 
@@ -246,6 +299,31 @@ bool X64Emitter::Emit(HIRBuilder* builder, EmitFunctionInfo& func_info) {
   mov(GetMembaseReg(),
       qword[GetContextReg() + offsetof(ppc::PPCContext, virtual_membase)]);
 
+  // Count loop iterations as well as calls, for functions mostly executing
+  // long loops.
+  std::vector<bool> loop_headers;
+  if (tier_up_function_) {
+    EmitFrameCountEnter();
+    EmitTierUpCheck();
+    for (auto block = builder->first_block(); block; block = block->next) {
+      for (auto instr = block->instr_head; instr; instr = instr->next) {
+        const hir::Label* target = nullptr;
+        if (instr->opcode == &hir::OPCODE_BRANCH_info) {
+          target = instr->src1.label;
+        } else if (instr->opcode == &hir::OPCODE_BRANCH_TRUE_info ||
+                   instr->opcode == &hir::OPCODE_BRANCH_FALSE_info) {
+          target = instr->src2.label;
+        }
+        if (target && target->block->ordinal <= block->ordinal) {
+          if (loop_headers.size() <= target->block->ordinal) {
+            loop_headers.resize(target->block->ordinal + 1);
+          }
+          loop_headers[target->block->ordinal] = true;
+        }
+      }
+    }
+  }
+
   // Body.
   auto block = builder->first_block();
   while (block) {
@@ -256,10 +334,15 @@ bool X64Emitter::Emit(HIRBuilder* builder, EmitFunctionInfo& func_info) {
       label = label->next;
     }
 
+    if (block->ordinal < loop_headers.size() && loop_headers[block->ordinal]) {
+      EmitTierUpCheck();
+    }
+
     // Process instructions.
     const Instr* instr = block->instr_head;
     while (instr) {
       const Instr* new_tail = instr;
+      current_instr_ = instr;
       if (!SelectSequence(this, instr, &new_tail)) {
         // No sequence found!
         // NOTE: If you encounter this after adding a new instruction, do a full
@@ -274,10 +357,13 @@ bool X64Emitter::Emit(HIRBuilder* builder, EmitFunctionInfo& func_info) {
     block = block->next;
   }
 
+  current_instr_ = nullptr;
+
   // Function epilog.
   L(epilog_label);
   epilog_label_ = nullptr;
   EmitTraceUserCallReturn();
+  EmitFrameCountExit();
   mov(GetContextReg(), qword[rsp + StackLayout::GUEST_CTX_HOME]);
 
   code_offsets.epilog = getSize();
@@ -310,6 +396,7 @@ bool X64Emitter::Emit(HIRBuilder* builder, EmitFunctionInfo& func_info) {
 void X64Emitter::MarkSourceOffset(const Instr* i) {
   auto entry = source_map_arena_.Alloc<SourceMapEntry>();
   entry->guest_address = static_cast<uint32_t>(i->src1.offset);
+  current_guest_address_ = entry->guest_address;
   entry->hir_offset = uint32_t(i->block->ordinal << 16) | i->ordinal;
   entry->code_offset = static_cast<uint32_t>(getSize());
 
@@ -337,6 +424,52 @@ void X64Emitter::EmitGetCurrentThreadId() {
 
 void X64Emitter::EmitTraceUserCallReturn() {}
 
+void X64Emitter::EmitFrameCountEnter() {
+  // At the beginning of the function, where rax and the flags are free.
+  mov(rax, reinterpret_cast<uint64_t>(tier_up_function_->frame_counter()));
+  // Frames.
+  lock();
+  inc(dword[rax]);
+  // Entries.
+  lock();
+  inc(dword[rax + 4]);
+}
+
+void X64Emitter::EmitFrameCountExit() {
+  if (!tier_up_function_) {
+    return;
+  }
+  // Before leaving the frame, where rcx and the flags are free (rax or rbx may
+  // contain the target of a tail call). Nothing after this in the function
+  // must be a safe point, as the code may be freed once all threads have
+  // passed one.
+  mov(rcx, reinterpret_cast<uint64_t>(tier_up_function_->frame_counter()));
+  lock();
+  dec(dword[rcx]);
+}
+
+// Called from baseline code of functions that have become hot.
+static uint64_t RequestFunctionOptimization(void* raw_context,
+                                            uint64_t function) {
+  auto thread_state = *reinterpret_cast<ThreadState**>(raw_context);
+  thread_state->processor()->RequestFunctionOptimization(
+      reinterpret_cast<GuestFunction*>(function));
+  return 0;
+}
+
+void X64Emitter::EmitTierUpCheck() {
+  // Only used at the beginning of the function and of blocks, where rax and
+  // the flags are free.
+  Xbyak::Label skip;
+  mov(rax, reinterpret_cast<uint64_t>(tier_up_function_->tier_up_counter()));
+  sub(dword[rax], 1);
+  // Only reaches exactly zero once, no need to call further.
+  jnz(skip, CodeGenerator::T_NEAR);
+  mov(GetNativeParam(0), reinterpret_cast<uint64_t>(tier_up_function_));
+  CallNativeSafe(reinterpret_cast<void*>(RequestFunctionOptimization));
+  L(skip);
+}
+
 void X64Emitter::DebugBreak() {
   // TODO(benvanik): notify debugger.
   db(0xCC);
@@ -367,6 +500,8 @@ uint64_t TrapDebugBreak(void* raw_context, uint64_t address) {
 }
 
 void X64Emitter::Trap(uint16_t trap_type) {
+  EmitInstrumentationCounter(X64Backend::InstrumentationCounter::Type::kTrap,
+                             trap_type);
   switch (trap_type) {
     case 20:
     case 26:
@@ -382,6 +517,11 @@ void X64Emitter::Trap(uint16_t trap_type) {
     case 25:
       // ?
       break;
+    case hir::TRAP_DEBUGGER_BREAK:
+      // The same instruction as the breakpoints patched into the code, handled
+      // by X64Backend::ExceptionCallback.
+      ud2();
+      break;
     default:
       XELOGW("Unknown trap type {}", trap_type);
       db(0xCC);
@@ -391,6 +531,8 @@ void X64Emitter::Trap(uint16_t trap_type) {
 
 void X64Emitter::UnimplementedInstr(const hir::Instr* i) {
   // TODO(benvanik): notify debugger.
+  EmitInstrumentationCounter(
+      X64Backend::InstrumentationCounter::Type::kUnimplementedInstr);
   db(0xCC);
   assert_always();
 }
@@ -411,25 +553,138 @@ uint64_t ResolveFunction(void* raw_context, uint64_t target_address) {
   return addr;
 }
 
+namespace {
+// Targets of an indirect call site are cached by patching the code emitted by
+// X64Emitter::EmitIndirectCallCache, which is followed by this descriptor
+// allowing the miss handler to locate the patchable parts. Everything is
+// relative to the code itself, so it's not specific to the current run.
+struct IndirectCallCacheDescriptor {
+  // Offsets are relative to the descriptor.
+  int32_t miss_handler_offset;
+  // Replacement for the 2-byte nop at miss_handler_offset skipping the call
+  // to the miss handler once all the entries are filled.
+  uint8_t miss_handler_skip[2];
+  uint16_t entry_count;
+  struct {
+    // 32-bit guest address immediate of a cmp instruction.
+    int32_t compare_offset;
+    // Patchable call site (see X64Function::AddCallSite).
+    int32_t call_site_offset;
+  } entries[X64Backend::kIndirectCallCacheMaxEntries];
+};
+// Never a function address since those are 4-byte aligned.
+constexpr uint32_t kIndirectCallCacheEmptyEntry = 1;
+
+std::mutex indirect_call_cache_mutex;
+
+// Called from an indirect call site on misses while it has empty entries.
+uint64_t UpdateIndirectCallCache(void* raw_context, uint64_t target_address,
+                                 uint64_t descriptor_address) {
+  auto thread_state = *reinterpret_cast<ThreadState**>(raw_context);
+  uint32_t guest_address = uint32_t(target_address);
+  if (guest_address & 3) {
+    return 0;
+  }
+  auto processor = thread_state->processor();
+  // The call will be done through the indirection table afterwards, resolving
+  // the function here just makes it possible to cache it on the first call.
+  Function* function = processor->ResolveFunction(guest_address);
+  if (!function || !function->is_guest()) {
+    return 0;
+  }
+  auto x64_function = static_cast<X64Function*>(function);
+  if (!x64_function->machine_code()) {
+    return 0;
+  }
+
+  auto descriptor_ptr = reinterpret_cast<uint8_t*>(descriptor_address);
+  IndirectCallCacheDescriptor descriptor;
+  std::memcpy(&descriptor, descriptor_ptr, sizeof(descriptor));
+  auto code_cache =
+      static_cast<X64Backend*>(processor->backend())->code_cache();
+
+  std::lock_guard<std::mutex> lock(indirect_call_cache_mutex);
+  uint32_t entry_index = 0;
+  for (; entry_index < descriptor.entry_count; ++entry_index) {
+    uint32_t cached_address;
+    std::memcpy(&cached_address,
+                descriptor_ptr + descriptor.entries[entry_index].compare_offset,
+                sizeof(cached_address));
+    if (cached_address == guest_address) {
+      // Added by another thread.
+      return 0;
+    }
+    if (cached_address == kIndirectCallCacheEmptyEntry) {
+      break;
+    }
+  }
+  if (entry_index >= descriptor.entry_count) {
+    return 0;
+  }
+  const auto& entry = descriptor.entries[entry_index];
+  // The call is unreachable until the comparison is patched, and calls
+  // through the indirection table until linked.
+  x64_function->AddCallSite(descriptor_ptr + entry.call_site_offset);
+  code_cache->PatchCode(descriptor_ptr + entry.compare_offset, &guest_address,
+                        sizeof(guest_address));
+  if (entry_index + 1 >= descriptor.entry_count) {
+    // Megamorphic or all targets known - stop calling the handler.
+    code_cache->PatchCode(descriptor_ptr + descriptor.miss_handler_offset,
+                          descriptor.miss_handler_skip,
+                          sizeof(descriptor.miss_handler_skip));
+  }
+  COUNT_profile_add("cpu/indirect_call_cache/entries", 1);
+  return 0;
+}
+}  // namespace
+
 void X64Emitter::Call(const hir::Instr* instr, GuestFunction* function) {
   assert_not_null(function);
   auto fn = static_cast<X64Function*>(function);
+  if (code_cache_->has_indirection_table()) {
+    // Emit a call through the indirection table entry in ebx, which will be
+    // replaced with a direct call or jump once the callee is defined and this
+    // code is placed (see X64Function::AddCallSite). Until then, the entry
+    // will either contain the address of the generated code or a thunk to
+    // ResolveAddress.
+    mov(ebx, function->address());
+    const uint8_t* call_site;
+    if (instr->flags & hir::CALL_TAIL) {
+      // Since we skip the prolog we need to mark the return here.
+      EmitTraceUserCallReturn();
+      EmitFrameCountExit();
+
+      // Pass the callers return address over.
+      mov(rcx, qword[rsp + StackLayout::GUEST_RET_ADDR]);
+
+      add(rsp, static_cast<uint32_t>(stack_size()));
+      call_site = X64Function::kCallSiteIndirectJump;
+    } else {
+      // Return address is from the previous SET_RETURN_ADDRESS.
+      mov(rcx, qword[rsp + StackLayout::GUEST_CALL_RET_ADDR]);
+      call_site = X64Function::kCallSiteIndirectCall;
+    }
+    // Code is placed with 16-byte alignment, so the offset within the function
+    // is enough to keep the site within an 8-byte block.
+    size_t call_site_offset = getSize();
+    while ((call_site_offset & 7) + X64Function::kCallSiteSize > 8) {
+      nop();
+      ++call_site_offset;
+    }
+    for (size_t i = 0; i < X64Function::kCallSiteSize; ++i) {
+      db(call_site[i]);
+    }
+    call_sites_.push_back({uint32_t(call_site_offset), fn});
+    return;
+  }
+
   // Resolve address to the function to call and store in rax.
   if (fn->machine_code()) {
-    // TODO(benvanik): is it worth it to do this? It removes the need for
-    // a ResolveFunction call, but makes the table less useful.
     assert_zero(uint64_t(fn->machine_code()) & 0xFFFFFFFF00000000);
     mov(eax, uint32_t(uint64_t(fn->machine_code())));
-  } else if (code_cache_->has_indirection_table()) {
-    // Load the pointer to the indirection table maintained in X64CodeCache.
-    // The target dword will either contain the address of the generated code
-    // or a thunk to ResolveAddress.
-    mov(ebx, function->address());
-    mov(eax, dword[ebx]);
   } else {
     // Old-style resolve.
     // Not too important because indirection table is almost always available.
-    // TODO: Overwrite the call-site with a straight call.
     CallNative(&ResolveFunction, function->address());
   }
 
@@ -437,6 +692,7 @@ void X64Emitter::Call(const hir::Instr* instr, GuestFunction* function) {
   if (instr->flags & hir::CALL_TAIL) {
     // Since we skip the prolog we need to mark the return here.
     EmitTraceUserCallReturn();
+    EmitFrameCountExit();
 
     // Pass the callers return address over.
     mov(rcx, qword[rsp + StackLayout::GUEST_RET_ADDR]);
@@ -466,12 +722,19 @@ void X64Emitter::CallIndirect(const hir::Instr* instr,
     if (reg.cvt32() != ebx) {
       mov(ebx, reg.cvt32());
     }
+    uint32_t cache_entry_count =
+        std::min(cvars::x64_indirect_call_cache_size,
+                 X64Backend::kIndirectCallCacheMaxEntries);
+    if (cache_entry_count) {
+      EmitIndirectCallCache(instr, cache_entry_count);
+      return;
+    }
     mov(eax, dword[ebx]);
   } else {
     // Old-style resolve.
     // Not too important because indirection table is almost always available.
     mov(edx, reg.cvt32());
-    mov(rax, reinterpret_cast<uint64_t>(ResolveFunction));
+    MovHostImageAddress(rax, reinterpret_cast<const void*>(ResolveFunction));
     mov(rcx, GetContextReg());
     call(rax);
   }
@@ -480,6 +743,7 @@ void X64Emitter::CallIndirect(const hir::Instr* instr,
   if (instr->flags & hir::CALL_TAIL) {
     // Since we skip the prolog we need to mark the return here.
     EmitTraceUserCallReturn();
+    EmitFrameCountExit();
 
     // Pass the callers return address over.
     mov(rcx, qword[rsp + StackLayout::GUEST_RET_ADDR]);
@@ -494,6 +758,121 @@ void X64Emitter::CallIndirect(const hir::Instr* instr,
   }
 }
 
+void X64Emitter::EmitIndirectCallCache(const hir::Instr* instr,
+                                       uint32_t entry_count) {
+  // ebx = target guest address
+  // Compared against up to entry_count previous targets, calling a hit
+  // directly. Misses call through the indirection table, first letting
+  // UpdateIndirectCallCache add the target if there are still empty entries.
+  bool is_tail = (instr->flags & hir::CALL_TAIL) != 0;
+  X64Backend::IndirectCallCacheCounters* counters = nullptr;
+  if (cvars::x64_indirect_call_cache_counters) {
+    counters = backend_->AllocateIndirectCallCacheCounters(
+        current_guest_address_, entry_count);
+    MarkNotPersistable();
+  }
+  // Patchable parts must not cross 8-byte boundaries.
+  auto align_patchable = [this](size_t prefix_size, size_t patch_size) {
+    while (((getSize() + prefix_size) & 7) + patch_size > 8) {
+      nop();
+    }
+  };
+
+  IndirectCallCacheDescriptor descriptor = {};
+  descriptor.entry_count = uint16_t(entry_count);
+  size_t compare_offsets[X64Backend::kIndirectCallCacheMaxEntries];
+  size_t call_site_offsets[X64Backend::kIndirectCallCacheMaxEntries];
+  Xbyak::Label hit_labels[X64Backend::kIndirectCallCacheMaxEntries];
+  Xbyak::Label descriptor_label, miss_handler_skip_label, done_label;
+  for (uint32_t i = 0; i < entry_count; ++i) {
+    // cmp ebx, imm32
+    align_patchable(2, sizeof(uint32_t));
+    db(0x81);
+    db(0xFB);
+    compare_offsets[i] = getSize();
+    dd(kIndirectCallCacheEmptyEntry);
+    je(hit_labels[i], CodeGenerator::T_NEAR);
+  }
+
+  // Miss.
+  if (counters) {
+    mov(rax, reinterpret_cast<uint64_t>(&counters->misses));
+    inc(qword[rax]);
+  }
+  align_patchable(0, 2);
+  size_t miss_handler_offset = getSize();
+  // 2-byte nop.
+  db(0x66);
+  db(0x90);
+  mov(GetNativeParam(0).cvt32(), ebx);
+  lea(GetNativeParam(1), ptr[rip + descriptor_label]);
+  CallNativeSafe(reinterpret_cast<void*>(UpdateIndirectCallCache));
+  L(miss_handler_skip_label);
+  size_t miss_handler_skip_distance = getSize() - (miss_handler_offset + 2);
+  assert_true(miss_handler_skip_distance <= INT8_MAX);
+  descriptor.miss_handler_skip[0] = 0xEB;
+  descriptor.miss_handler_skip[1] = uint8_t(miss_handler_skip_distance);
+  if (is_tail) {
+    EmitTraceUserCallReturn();
+    EmitFrameCountExit();
+    mov(rcx, qword[rsp + StackLayout::GUEST_RET_ADDR]);
+    add(rsp, static_cast<uint32_t>(stack_size()));
+  } else {
+    mov(rcx, qword[rsp + StackLayout::GUEST_CALL_RET_ADDR]);
+  }
+  mov(eax, dword[rbx]);
+  if (is_tail) {
+    jmp(rax);
+  } else {
+    call(rax);
+    jmp(done_label, CodeGenerator::T_NEAR);
+  }
+
+  // Hits.
+  for (uint32_t i = 0; i < entry_count; ++i) {
+    L(hit_labels[i]);
+    if (counters) {
+      mov(rax, reinterpret_cast<uint64_t>(&counters->hits[i]));
+      inc(qword[rax]);
+    }
+    if (is_tail) {
+      EmitTraceUserCallReturn();
+      EmitFrameCountExit();
+      mov(rcx, qword[rsp + StackLayout::GUEST_RET_ADDR]);
+      add(rsp, static_cast<uint32_t>(stack_size()));
+    } else {
+      mov(rcx, qword[rsp + StackLayout::GUEST_CALL_RET_ADDR]);
+    }
+    align_patchable(0, X64Function::kCallSiteSize);
+    call_site_offsets[i] = getSize();
+    const uint8_t* call_site = is_tail ? X64Function::kCallSiteIndirectJump
+                                       : X64Function::kCallSiteIndirectCall;
+    for (size_t j = 0; j < X64Function::kCallSiteSize; ++j) {
+      db(call_site[j]);
+    }
+    if (!is_tail) {
+      jmp(done_label, CodeGenerator::T_NEAR);
+    }
+  }
+
+  // Never executed, read with memcpy, so no alignment needed.
+  L(descriptor_label);
+  size_t descriptor_offset = getSize();
+  descriptor.miss_handler_offset =
+      int32_t(miss_handler_offset) - int32_t(descriptor_offset);
+  for (uint32_t i = 0; i < entry_count; ++i) {
+    descriptor.entries[i].compare_offset =
+        int32_t(compare_offsets[i]) - int32_t(descriptor_offset);
+    descriptor.entries[i].call_site_offset =
+        int32_t(call_site_offsets[i]) - int32_t(descriptor_offset);
+  }
+  auto descriptor_bytes = reinterpret_cast<const uint8_t*>(&descriptor);
+  for (size_t i = 0; i < sizeof(descriptor); ++i) {
+    db(descriptor_bytes[i]);
+  }
+  L(done_label);
+}
+
 uint64_t UndefinedCallExtern(void* raw_context, uint64_t function_ptr) {
   auto function = reinterpret_cast<Function*>(function_ptr);
   if (!cvars::ignore_undefined_externs) {
@@ -517,7 +896,10 @@ void X64Emitter::CallExtern(const hir::Instr* instr, const Function* function) {
       // r9  = arg2
       auto thunk = backend()->guest_to_host_thunk();
       mov(rax, reinterpret_cast<uint64_t>(thunk));
-      mov(rcx, reinterpret_cast<uint64_t>(builtin_function->handler()));
+      MovHostImageAddress(
+          rcx, reinterpret_cast<const void*>(builtin_function->handler()));
+      // The arguments are usually objects created at runtime.
+      MarkNotPersistable();
       mov(rdx, reinterpret_cast<uint64_t>(builtin_function->arg0()));
       mov(r8, reinterpret_cast<uint64_t>(builtin_function->arg1()));
       call(rax);
@@ -533,7 +915,8 @@ void X64Emitter::CallExtern(const hir::Instr* instr, const Function* function) {
       // r9  = arg2
       auto thunk = backend()->guest_to_host_thunk();
       mov(rax, reinterpret_cast<uint64_t>(thunk));
-      mov(rcx, reinterpret_cast<uint64_t>(extern_function->extern_handler()));
+      MovHostImageAddress(
+          rcx, reinterpret_cast<const void*>(extern_function->extern_handler()));
       mov(rdx,
           qword[GetContextReg() + offsetof(ppc::PPCContext, kernel_state)]);
       call(rax);
@@ -541,6 +924,7 @@ void X64Emitter::CallExtern(const hir::Instr* instr, const Function* function) {
     }
   }
   if (undefined) {
+    MarkNotPersistable();
     CallNative(UndefinedCallExtern, reinterpret_cast<uint64_t>(function));
   }
 }
@@ -566,13 +950,44 @@ void X64Emitter::CallNativeSafe(void* fn) {
   // rdx = arg0
   // r8  = arg1
   // r9  = arg2
+  EmitInstrumentationCounter(
+      X64Backend::InstrumentationCounter::Type::kHelperCall, uint64_t(fn));
   auto thunk = backend()->guest_to_host_thunk();
   mov(rax, reinterpret_cast<uint64_t>(thunk));
-  mov(rcx, reinterpret_cast<uint64_t>(fn));
+  MovHostImageAddress(rcx, fn);
   call(rax);
   // rax = host return
 }
 
+void X64Emitter::EmitInstrumentationCounter(
+    X64Backend::InstrumentationCounter::Type type, uint64_t value) {
+  if (!cvars::x64_instrumentation_counters) {
+    return;
+  }
+  X64Backend::InstrumentationCounter counter;
+  counter.type = type;
+  counter.opcode = current_instr_ ? current_instr_->opcode : nullptr;
+  counter.value = value;
+  uint32_t index = backend_->GetInstrumentationCounter(counter);
+  // The thread's own counters, not shared, so not incremented atomically.
+  mov(rax, qword[GetContextReg() +
+                 offsetof(ppc::PPCContext, instrumentation_counters)]);
+  inc(qword[rax + index * sizeof(uint64_t)]);
+  MarkNotPersistable();
+}
+
+void X64Emitter::MovHostImageAddress(const Xbyak::Reg64& reg,
+                                     const void* address) {
+  // Always use the full 10-byte movabs so the immediate can be relocated to
+  // any address.
+  db(0x48 | (reg.getIdx() >= 8 ? 0x01 : 0x00));
+  db(0xB8 | (reg.getIdx() & 7));
+  if (code_persistable_) {
+    host_image_relocations_.push_back(uint32_t(getSize()));
+  }
+  dq(reinterpret_cast<uint64_t>(address));
+}
+
 void X64Emitter::SetReturnAddress(uint64_t value) {
   mov(rax, value);
   mov(qword[rsp + StackLayout::GUEST_CALL_RET_ADDR], rax);
@@ -599,7 +1014,8 @@ void X64Emitter::ReloadContext() {
 }
 
 void X64Emitter::ReloadMembase() {
-  mov(GetMembaseReg(), qword[GetContextReg() + 8]);  // membase
+  mov(GetMembaseReg(),
+      qword[GetContextReg() + offsetof(ppc::PPCContext, virtual_membase)]);
 }
 
 // Len Assembly                                   Byte Sequence
@@ -737,6 +1153,10 @@ static const vec128_t xmm_consts[] = {
     vec128i(0x0000000Fu, 0x0000000Fu, 0x0000000Fu, 0x0000000Fu),
     /* XMMShiftMaskPS         */
     vec128i(0x0000001Fu, 0x0000001Fu, 0x0000001Fu, 0x0000001Fu),
+    /* XMMShiftMaskPI16       */
+    vec128i(0x000F000Fu, 0x000F000Fu, 0x000F000Fu, 0x000F000Fu),
+    /* XMMShiftMaskPI8        */
+    vec128i(0x07070707u, 0x07070707u, 0x07070707u, 0x07070707u),
     /* XMMShiftByteMask       */
     vec128i(0x000000FFu, 0x000000FFu, 0x000000FFu, 0x000000FFu),
     /* XMMSwapWordMask        */
@@ -818,9 +1238,10 @@ void X64Emitter::LoadConstantXmm(Xbyak::Xmm dest, const vec128_t& v) {
   } else if (v.low == ~uint64_t(0) && v.high == ~uint64_t(0)) {
     // 1111...
     vpcmpeqb(dest, dest);
+  } else if (uint32_t address = GetPooledConstantAddress(v)) {
+    vmovdqa(dest, ptr[reinterpret_cast<void*>(uintptr_t(address))]);
+    AddConstantReference(v);
   } else {
-    // TODO(benvanik): see what other common values are.
-    // TODO(benvanik): build constant table - 99% are reused.
     MovMem64(rsp + kStashOffset, v.low);
     MovMem64(rsp + kStashOffset + 8, v.high);
     vmovdqa(dest, ptr[rsp + kStashOffset]);
@@ -838,9 +1259,12 @@ void X64Emitter::LoadConstantXmm(Xbyak::Xmm dest, float v) {
   } else if (x.i == ~uint32_t(0)) {
     // 1111...
     vpcmpeqb(dest, dest);
+  } else if (uint32_t address =
+                 GetPooledConstantAddress(vec128i(x.i, 0, 0, 0))) {
+    // Zeroes the upper bits like vmovd.
+    vmovss(dest, dword[reinterpret_cast<void*>(uintptr_t(address))]);
+    AddConstantReference(vec128i(x.i, 0, 0, 0));
   } else {
-    // TODO(benvanik): see what other common values are.
-    // TODO(benvanik): build constant table - 99% are reused.
     mov(eax, x.i);
     vmovd(dest, eax);
   }
@@ -857,14 +1281,28 @@ void X64Emitter::LoadConstantXmm(Xbyak::Xmm dest, double v) {
   } else if (x.i == ~uint64_t(0)) {
     // 1111...
     vpcmpeqb(dest, dest);
+  } else if (uint32_t address = GetPooledConstantAddress(vec128q(x.i, 0))) {
+    // Zeroes the upper bits like vmovq.
+    vmovsd(dest, qword[reinterpret_cast<void*>(uintptr_t(address))]);
+    AddConstantReference(vec128q(x.i, 0));
   } else {
-    // TODO(benvanik): see what other common values are.
-    // TODO(benvanik): build constant table - 99% are reused.
     mov(rax, x.i);
     vmovq(dest, rax);
   }
 }
 
+uint32_t X64Emitter::GetPooledConstantAddress(const vec128_t& v) {
+  X64ConstantPool* constant_pool = backend_->constant_pool();
+  return constant_pool ? constant_pool->GetConstantAddress(v) : 0;
+}
+
+void X64Emitter::AddConstantReference(const vec128_t& v) {
+  if (code_persistable_) {
+    constant_references_.push_back(
+        {uint32_t(getSize() - sizeof(uint32_t)), 0, v.low, v.high});
+  }
+}
+
 Xbyak::Address X64Emitter::StashXmm(int index, const Xbyak::Xmm& r) {
   auto addr = ptr[rsp + kStashOffset + (index * 16)];
   vmovups(addr, r);
@@ -13,6 +13,8 @@
 #include <vector>
 
 #include "xenia/base/arena.h"
+#include "xenia/cpu/backend/x64/x64_backend.h"
+#include "xenia/cpu/backend/x64/x64_code_storage.h"
 #include "xenia/cpu/function.h"
 #include "xenia/cpu/function_trace_data.h"
 #include "xenia/cpu/hir/hir_builder.h"
@@ -37,6 +39,7 @@ namespace x64 {
 
 class X64Backend;
 class X64CodeCache;
+class X64Function;
 
 struct EmitFunctionInfo;
 
@@ -98,6 +101,8 @@ enum XmmConst {
   XMMMaskEvenPI16,
   XMMShiftMaskEvenPI16,
   XMMShiftMaskPS,
+  XMMShiftMaskPI16,
+  XMMShiftMaskPI8,
   XMMShiftByteMask,
   XMMSwapWordMask,
   XMMUnsignedDwordMax,
@@ -153,6 +158,8 @@ class X64Emitter : public Xbyak::CodeGenerator {
 
   Processor* processor() const { return processor_; }
   X64Backend* backend() const { return backend_; }
+  // Guest address of the function being emitted.
+  uint32_t function_address() const { return function_address_; }
 
   static uintptr_t PlaceConstData();
   static void FreeConstData(uintptr_t data);
@@ -209,6 +216,10 @@ class X64Emitter : public Xbyak::CodeGenerator {
   void CallNative(uint64_t (*fn)(void* raw_context, uint64_t arg0),
                   uint64_t arg0);
   void CallNativeSafe(void* fn);
+  // Increments the per-thread counter of the event with
+  // --x64_instrumentation_counters. Clobbers rax and the flags.
+  void EmitInstrumentationCounter(
+      X64Backend::InstrumentationCounter::Type type, uint64_t value = 0);
   void SetReturnAddress(uint64_t value);
 
   Xbyak::Reg64 GetNativeParam(uint32_t param);
@@ -228,6 +239,13 @@ class X64Emitter : public Xbyak::CodeGenerator {
   void LoadConstantXmm(Xbyak::Xmm dest, float v);
   void LoadConstantXmm(Xbyak::Xmm dest, double v);
   void LoadConstantXmm(Xbyak::Xmm dest, const vec128_t& v);
+  // Returns the address of the value in the X64ConstantPool, or 0 if the pool
+  // is full. AddConstantReference must be called right after emitting the
+  // instruction using it.
+  uint32_t GetPooledConstantAddress(const vec128_t& v);
+  // Records the 32-bit displacement ending the last emitted instruction as the
+  // address of the pooled constant for the persistent code storage.
+  void AddConstantReference(const vec128_t& v);
   Xbyak::Address StashXmm(int index, const Xbyak::Xmm& r);
   Xbyak::Address StashConstantXmm(int index, float v);
   Xbyak::Address StashConstantXmm(int index, double v);
@@ -236,6 +254,16 @@ class X64Emitter : public Xbyak::CodeGenerator {
   bool IsFeatureEnabled(uint32_t feature_flag) const {
     return (feature_flags_ & feature_flag) == feature_flag;
   }
+  uint32_t feature_flags() const { return feature_flags_; }
+
+  // Loads an address within the Xenia executable (a host function or static
+  // data), recording it so the code can be relocated if it's loaded from the
+  // persistent code storage in a later run.
+  void MovHostImageAddress(const Xbyak::Reg64& reg, const void* address);
+  // Must be called when emitting anything specific to the current run, such as
+  // pointers to heap objects, that can't be placed in the persistent code
+  // storage.
+  void MarkNotPersistable() { code_persistable_ = false; }
 
   FunctionDebugInfo* debug_info() const { return debug_info_; }
 
@@ -243,10 +271,18 @@ class X64Emitter : public Xbyak::CodeGenerator {
 
  protected:
   void* Emplace(const EmitFunctionInfo& func_info,
-                GuestFunction* function = nullptr);
+                GuestFunction* function = nullptr,
+                void** code_write_address_out = nullptr,
+                const std::vector<SourceMapEntry>* source_map = nullptr);
   bool Emit(hir::HIRBuilder* builder, EmitFunctionInfo& func_info);
+  void EmitIndirectCallCache(const hir::Instr* instr, uint32_t entry_count);
   void EmitGetCurrentThreadId();
   void EmitTraceUserCallReturn();
+  // Update the frame counter of tier_up_function_ (see
+  // X64Function::frame_counter).
+  void EmitFrameCountEnter();
+  void EmitFrameCountExit();
+  void EmitTierUpCheck();
 
  protected:
   Processor* processor_ = nullptr;
@@ -258,12 +294,34 @@ class X64Emitter : public Xbyak::CodeGenerator {
 
   Xbyak::Label* epilog_label_ = nullptr;
 
-  hir::Instr* current_instr_ = nullptr;
+  // HIR instruction being emitted.
+  const hir::Instr* current_instr_ = nullptr;
 
   FunctionDebugInfo* debug_info_ = nullptr;
   uint32_t debug_info_flags_ = 0;
   FunctionTraceData* trace_data_ = nullptr;
   Arena source_map_arena_;
+  // Guest address of the latest source offset.
+  uint32_t current_guest_address_ = 0;
+  // Guest address of the function being emitted.
+  uint32_t function_address_ = 0;
+  // Function being emitted if it's baseline code that needs to count calls
+  // for tiered compilation.
+  X64Function* tier_up_function_ = nullptr;
+
+  // Whether the function being emitted may be placed in the persistent code
+  // storage (if it's open).
+  bool code_persistable_ = false;
+  // Offsets of host image addresses in the code (see MovHostImageAddress).
+  std::vector<uint32_t> host_image_relocations_;
+  // Patchable direct calls to link once the code is placed.
+  struct CallSite {
+    uint32_t code_offset;
+    X64Function* function;
+  };
+  std::vector<CallSite> call_sites_;
+  // Pooled constants referenced by the code (see AddConstantReference).
+  std::vector<X64CodeStorage::ConstantReference> constant_references_;
 
   size_t stack_size_ = 0;
 
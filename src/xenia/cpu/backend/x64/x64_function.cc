@@ -9,7 +9,14 @@
 
 #include "xenia/cpu/backend/x64/x64_function.h"
 
+#include <algorithm>
+#include <cstring>
+
+#include "xenia/base/assert.h"
+#include "xenia/base/atomic.h"
 #include "xenia/cpu/backend/x64/x64_backend.h"
+#include "xenia/cpu/backend/x64/x64_code_cache.h"
+#include "xenia/cpu/cpu_flags.h"
 #include "xenia/cpu/processor.h"
 #include "xenia/cpu/thread_state.h"
 
@@ -19,23 +26,107 @@ namespace backend {
 namespace x64 {
 
 X64Function::X64Function(Module* module, uint32_t address)
-    : GuestFunction(module, address) {}
+    : GuestFunction(module, address),
+      tier_up_counter_(
+          int32_t(std::max(cvars::tiered_compilation_threshold, uint32_t(1)))) {}
 
 X64Function::~X64Function() {
   // machine_code_ is freed by code cache.
 }
 
-void X64Function::Setup(uint8_t* machine_code, size_t machine_code_length) {
-  machine_code_ = machine_code;
-  machine_code_length_ = machine_code_length;
+void X64Function::Setup(uint8_t* machine_code, size_t machine_code_length,
+                        bool counts_frames) {
+  uint8_t* old_machine_code;
+  size_t old_machine_code_length;
+  bool old_machine_code_counts_frames;
+  {
+    std::lock_guard<std::mutex> lock(call_sites_mutex_);
+    old_machine_code = machine_code_;
+    old_machine_code_length = machine_code_length_;
+    old_machine_code_counts_frames = machine_code_counts_frames_;
+    machine_code_ = machine_code;
+    machine_code_length_ = machine_code_length;
+    machine_code_counts_frames_ = counts_frames;
+    PatchCallSites(machine_code_);
+  }
+  // The indirection table entry and the call sites have been replaced, so only
+  // threads that have read the old address already may still enter the old
+  // code.
+  if (old_machine_code && old_machine_code != machine_code &&
+      old_machine_code_counts_frames) {
+    auto backend = static_cast<X64Backend*>(module()->processor()->backend());
+    backend->RetireCode(this, old_machine_code, old_machine_code_length);
+  }
+}
+
+void X64Function::AddCallSite(uint8_t* call_site) {
+  assert_true((uintptr_t(call_site) & 7) + kCallSiteSize <= 8);
+  auto code_cache = static_cast<X64CodeCache*>(
+      module()->processor()->backend()->code_cache());
+  CallSite new_call_site;
+  new_call_site.address = call_site;
+  new_call_site.code_allocation_id = code_cache->GetAllocationId(call_site);
+  new_call_site.is_jump = !std::memcmp(call_site, kCallSiteIndirectJump,
+                                       sizeof(kCallSiteIndirectJump));
+  assert_true(new_call_site.is_jump ||
+              !std::memcmp(call_site, kCallSiteIndirectCall,
+                           sizeof(kCallSiteIndirectCall)));
+  std::lock_guard<std::mutex> lock(call_sites_mutex_);
+  call_sites_.push_back(new_call_site);
+  if (machine_code_) {
+    PatchCallSite(new_call_site, machine_code_);
+  }
+}
+
+void X64Function::UnlinkCallSites() {
+  std::lock_guard<std::mutex> lock(call_sites_mutex_);
+  PatchCallSites(nullptr);
+}
+
+void X64Function::PatchCallSites(const uint8_t* target) {
+  // Called with the call site mutex held.
+  call_sites_.erase(std::remove_if(call_sites_.begin(), call_sites_.end(),
+                                   [this, target](const CallSite& call_site) {
+                                     return !PatchCallSite(call_site, target);
+                                   }),
+                    call_sites_.end());
+}
+
+bool X64Function::PatchCallSite(const CallSite& call_site,
+                                const uint8_t* target) {
+  uint8_t code[kCallSiteSize];
+  if (target) {
+    int64_t displacement = int64_t(uintptr_t(target)) -
+                           int64_t(uintptr_t(call_site.address + kCallSiteSize));
+    assert_true(displacement == int32_t(displacement));
+    int32_t rel32 = int32_t(displacement);
+    code[0] = call_site.is_jump ? 0xE9 : 0xE8;
+    std::memcpy(code + 1, &rel32, sizeof(rel32));
+  } else {
+    std::memcpy(code,
+                call_site.is_jump ? kCallSiteIndirectJump
+                                  : kCallSiteIndirectCall,
+                kCallSiteSize);
+  }
+  auto code_cache = static_cast<X64CodeCache*>(
+      module()->processor()->backend()->code_cache());
+  return code_cache->PatchCode(call_site.address, code, kCallSiteSize,
+                               call_site.code_allocation_id);
 }
 
 bool X64Function::CallImpl(ThreadState* thread_state, uint32_t return_address) {
   auto backend =
       reinterpret_cast<X64Backend*>(thread_state->processor()->backend());
   auto thunk = backend->host_to_guest_thunk();
-  thunk(machine_code_, thread_state->context(),
+  ppc::PPCContext* context = thread_state->context();
+  // A safe point, before reading the machine code pointer, which may be
+  // replaced concurrently.
+  uint64_t previous_code_epoch =
+      xe::atomic_exchange(backend->code_epoch(), &context->code_epoch);
+  thunk(machine_code_, context,
         reinterpret_cast<void*>(uintptr_t(return_address)));
+  // Back to the host code, or to the generated code that called it.
+  xe::atomic_exchange(previous_code_epoch, &context->code_epoch);
   return true;
 }
 
@@ -10,6 +10,11 @@
 #ifndef XENIA_CPU_BACKEND_X64_X64_FUNCTION_H_
 #define XENIA_CPU_BACKEND_X64_X64_FUNCTION_H_
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
 #include "xenia/cpu/function.h"
 #include "xenia/cpu/thread_state.h"
 
@@ -26,14 +31,74 @@ class X64Function : public GuestFunction {
   uint8_t* machine_code() const override { return machine_code_; }
   size_t machine_code_length() const override { return machine_code_length_; }
 
-  void Setup(uint8_t* machine_code, size_t machine_code_length);
+  // Also links the call sites waiting for the function to be defined. The
+  // previous machine code, if it counts its frames (baseline code, see
+  // frame_counter), is retired, to be freed by the backend once no thread can
+  // be executing it.
+  void Setup(uint8_t* machine_code, size_t machine_code_length,
+             bool counts_frames);
+
+  // Patchable call sites are 5 bytes not crossing an 8-byte boundary, so they
+  // can be replaced atomically while other threads may be executing them.
+  // Unlinked, they call the function through the indirection table entry that
+  // the caller has loaded the address of into rbx, and once the callee has
+  // machine code, they are replaced with a direct rel32 call or jump.
+  static constexpr size_t kCallSiteSize = 5;
+  // mov eax, dword [rbx]; call rax; nop
+  static constexpr uint8_t kCallSiteIndirectCall[kCallSiteSize] = {
+      0x8B, 0x03, 0xFF, 0xD0, 0x90};
+  // mov eax, dword [rbx]; jmp rax; nop
+  static constexpr uint8_t kCallSiteIndirectJump[kCallSiteSize] = {
+      0x8B, 0x03, 0xFF, 0xE0, 0x90};
+
+  // Makes an unlinked call site in the code of another function call this
+  // function directly, immediately if it already has machine code, or when
+  // it's set up.
+  void AddCallSite(uint8_t* call_site);
+  // Reverts the call sites to going through the indirection table, for when
+  // the machine code of the function is about to be replaced.
+  void UnlinkCallSites();
+
+  // Decremented by baseline code on calls and loop iterations, requesting
+  // optimization when it reaches zero.
+  int32_t* tier_up_counter() { return &tier_up_counter_; }
+
+  // Updated by baseline code on entry and on every exit with locked 32-bit
+  // increments and decrements, so it can be freed after being replaced. The
+  // low 32 bits are the number of frames of the code currently on the stack of
+  // any thread, and the high 32 bits are the number of entries, to detect
+  // entries that have been made while checking whether the code is still used.
+  std::atomic<uint64_t>* frame_counter() { return &frame_counter_; }
 
  protected:
   bool CallImpl(ThreadState* thread_state, uint32_t return_address) override;
 
  private:
+  struct CallSite {
+    uint8_t* address;
+    // Of the code containing the call site, to skip and drop the sites in code
+    // that has been freed.
+    uint64_t code_allocation_id;
+    bool is_jump;
+  };
+
+  // Links to target if it's not null, unlinks otherwise. Returns false if the
+  // code containing the call site has been freed.
+  bool PatchCallSite(const CallSite& call_site, const uint8_t* target);
+  // Patches all call sites, dropping the ones in freed code.
+  void PatchCallSites(const uint8_t* target);
+
   uint8_t* machine_code_ = nullptr;
   size_t machine_code_length_ = 0;
+  bool machine_code_counts_frames_ = false;
+
+  int32_t tier_up_counter_;
+  std::atomic<uint64_t> frame_counter_{0};
+
+  // Protects the call sites and their code.
+  std::mutex call_sites_mutex_;
+  // Back references to the call sites of the function in other machine code.
+  std::vector<CallSite> call_sites_;
 };
 
 }  // namespace x64
@@ -0,0 +1,320 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/backend/x64/x64_jit_symbols.h"
+
+#include <cstring>
+#include <filesystem>
+
+#include "xenia/base/platform.h"
+
+#if XE_PLATFORM_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#if ENABLE_VTUNE
+#include "third_party/vtune/include/jitprofiling.h"
+#pragma comment(lib, "../third_party/vtune/lib64/jitprofiling.lib")
+#endif
+
+#include "third_party/fmt/include/fmt/format.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/threading.h"
+#include "xenia/cpu/module.h"
+
+DEFINE_bool(x64_perf_map, false,
+            "Write the names of the generated functions to /tmp/perf-<pid>.map "
+            "for Linux perf.",
+            "x64");
+DEFINE_bool(x64_perf_jitdump, false,
+            "Write the generated functions, with the mapping of their code to "
+            "the guest addresses, to jit-<pid>.dump in --x64_perf_jitdump_path "
+            "for Linux perf (use perf record -k mono, then perf inject --jit).",
+            "x64");
+DEFINE_path(x64_perf_jitdump_path, "",
+            "Directory to write the file for --x64_perf_jitdump to, the "
+            "temporary directory if empty.",
+            "x64");
+
+namespace xe {
+namespace cpu {
+namespace backend {
+namespace x64 {
+
+namespace {
+
+#if XE_PLATFORM_LINUX
+// tools/perf/Documentation/jitdump-specification.txt in the Linux sources.
+struct JitDumpHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t total_size;
+  uint32_t elf_mach;
+  uint32_t pad1;
+  uint32_t pid;
+  uint64_t timestamp;
+  uint64_t flags;
+};
+static_assert(sizeof(JitDumpHeader) == 40);
+
+struct JitDumpRecordHeader {
+  uint32_t id;
+  uint32_t total_size;
+  uint64_t timestamp;
+};
+static_assert(sizeof(JitDumpRecordHeader) == 16);
+
+constexpr uint32_t kJitDumpMagic = 0x4A695444;  // 'JiTD'
+constexpr uint32_t kJitDumpVersion = 1;
+constexpr uint32_t kJitDumpElfMachineX86_64 = 62;
+constexpr uint32_t kJitDumpRecordCodeLoad = 0;
+constexpr uint32_t kJitDumpRecordCodeDebugInfo = 2;
+
+// Followed by the null-terminated name and the code.
+struct JitDumpCodeLoad {
+  uint32_t pid;
+  uint32_t tid;
+  uint64_t vma;
+  uint64_t code_addr;
+  uint64_t code_size;
+  uint64_t code_index;
+};
+
+// Followed by the entries.
+struct JitDumpDebugInfo {
+  uint64_t code_addr;
+  uint64_t nr_entry;
+};
+
+// Followed by the null-terminated file name.
+struct JitDumpDebugEntry {
+  uint64_t code_addr;
+  uint32_t line;
+  uint32_t discrim;
+};
+
+// Must be the clock of perf record -k mono.
+uint64_t GetJitDumpTimestamp() {
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return uint64_t(time.tv_sec) * 1000000000 + uint64_t(time.tv_nsec);
+}
+#endif  // XE_PLATFORM_LINUX
+
+template <typename T>
+void AppendBytes(std::vector<uint8_t>& bytes, const T& value) {
+  const uint8_t* value_bytes = reinterpret_cast<const uint8_t*>(&value);
+  bytes.insert(bytes.end(), value_bytes, value_bytes + sizeof(T));
+}
+
+void AppendString(std::vector<uint8_t>& bytes, const std::string& value) {
+  bytes.insert(bytes.end(), value.c_str(), value.c_str() + value.size() + 1);
+}
+
+}  // namespace
+
+X64JitSymbols::~X64JitSymbols() {
+#if XE_PLATFORM_LINUX
+  if (jitdump_marker_) {
+    munmap(jitdump_marker_, jitdump_marker_size_);
+  }
+#endif
+  if (jitdump_file_) {
+    fclose(jitdump_file_);
+  }
+  if (perf_map_file_) {
+    fclose(perf_map_file_);
+  }
+}
+
+void X64JitSymbols::Initialize() {
+#if XE_PLATFORM_LINUX
+  if (cvars::x64_perf_map) {
+    std::string path = fmt::format("/tmp/perf-{}.map", getpid());
+    perf_map_file_ = fopen(path.c_str(), "w");
+    if (perf_map_file_) {
+      XELOGI("Writing the symbols of the generated code to {}", path);
+    } else {
+      XELOGW("Failed to create {} for --x64_perf_map", path);
+    }
+  }
+
+  if (cvars::x64_perf_jitdump) {
+    std::filesystem::path directory = cvars::x64_perf_jitdump_path;
+    if (directory.empty()) {
+      directory = std::filesystem::temp_directory_path();
+    }
+    // perf relies on the file name.
+    std::filesystem::path path =
+        directory / fmt::format("jit-{}.dump", getpid());
+    int fd = open(path.c_str(), O_CREAT | O_TRUNC | O_RDWR, 0666);
+    if (fd >= 0) {
+      jitdump_marker_size_ = size_t(sysconf(_SC_PAGESIZE));
+      jitdump_marker_ = mmap(nullptr, jitdump_marker_size_,
+                             PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0);
+      if (jitdump_marker_ == MAP_FAILED) {
+        jitdump_marker_ = nullptr;
+        XELOGW("Failed to map {}, perf won't find it", xe::path_to_utf8(path));
+      }
+      jitdump_file_ = fdopen(fd, "wb");
+    }
+    if (jitdump_file_) {
+      JitDumpHeader header = {};
+      header.magic = kJitDumpMagic;
+      header.version = kJitDumpVersion;
+      header.total_size = sizeof(header);
+      header.elf_mach = kJitDumpElfMachineX86_64;
+      header.pid = uint32_t(getpid());
+      header.timestamp = GetJitDumpTimestamp();
+      fwrite(&header, sizeof(header), 1, jitdump_file_);
+      fflush(jitdump_file_);
+      XELOGI("Writing the generated code to {}", xe::path_to_utf8(path));
+    } else {
+      XELOGW("Failed to create {} for --x64_perf_jitdump",
+             xe::path_to_utf8(path));
+    }
+  }
+#endif  // XE_PLATFORM_LINUX
+
+#if ENABLE_VTUNE
+  is_vtune_active_ = iJIT_IsProfilingActive() == iJIT_SAMPLING_ON;
+#endif
+
+  is_active_ = perf_map_file_ || jitdump_file_ || is_vtune_active_;
+}
+
+std::string X64JitSymbols::GetSymbolName(uint32_t guest_address,
+                                         const GuestFunction* function) {
+  if (!function) {
+    return "xenia_host_code";
+  }
+  std::string name = function->name().empty()
+                         ? fmt::format("sub_{:08X}", guest_address)
+                         : function->name();
+  if (function->module()) {
+    name = fmt::format("{}!{}", function->module()->name(), name);
+  }
+  return name;
+}
+
+void X64JitSymbols::OnCodePlaced(
+    const void* code_execute_address, size_t code_size, uint32_t guest_address,
+    const GuestFunction* function,
+    const std::vector<SourceMapEntry>* source_map) {
+  if (!is_active_) {
+    return;
+  }
+  std::string name = GetSymbolName(guest_address, function);
+  uint64_t code_address = uint64_t(uintptr_t(code_execute_address));
+  // The guest addresses are used as the line numbers in the module.
+  std::string source_file_name;
+  if (function && function->module()) {
+    source_file_name = function->module()->name();
+  }
+
+#if ENABLE_VTUNE
+  if (is_vtune_active_) {
+    std::vector<LineNumberInfo> line_numbers;
+    if (source_map) {
+      line_numbers.reserve(source_map->size());
+      for (const SourceMapEntry& entry : *source_map) {
+        line_numbers.push_back({entry.code_offset, entry.guest_address});
+      }
+    }
+    iJIT_Method_Load method = {};
+    method.method_id = iJIT_GetNewMethodID();
+    method.method_name = const_cast<char*>(name.c_str());
+    method.method_load_address = const_cast<void*>(code_execute_address);
+    method.method_size = static_cast<unsigned int>(code_size);
+    method.line_number_size = static_cast<unsigned int>(line_numbers.size());
+    method.line_number_table =
+        line_numbers.empty() ? nullptr : line_numbers.data();
+    method.source_file_name = source_file_name.empty()
+                                  ? nullptr
+                                  : const_cast<char*>(source_file_name.c_str());
+    iJIT_NotifyEvent(iJVM_EVENT_TYPE_METHOD_LOAD_FINISHED, &method);
+  }
+#endif  // ENABLE_VTUNE
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (perf_map_file_) {
+    fmt::print(perf_map_file_, "{:x} {:x} {}\n", code_address, code_size,
+               name);
+    fflush(perf_map_file_);
+  }
+
+#if XE_PLATFORM_LINUX
+  if (jitdump_file_) {
+    // The debug information must precede the code.
+    if (source_map && !source_map->empty() && !source_file_name.empty()) {
+      jitdump_record_.clear();
+      AppendBytes(jitdump_record_, JitDumpDebugInfo());
+      uint64_t entry_count = 0;
+      uint32_t last_guest_address = 0;
+      for (const SourceMapEntry& entry : *source_map) {
+        if (entry.guest_address == last_guest_address) {
+          continue;
+        }
+        last_guest_address = entry.guest_address;
+        JitDumpDebugEntry debug_entry = {};
+        debug_entry.code_addr = code_address + entry.code_offset;
+        debug_entry.line = entry.guest_address;
+        AppendBytes(jitdump_record_, debug_entry);
+        AppendString(jitdump_record_, source_file_name);
+        ++entry_count;
+      }
+      JitDumpDebugInfo debug_info;
+      debug_info.code_addr = code_address;
+      debug_info.nr_entry = entry_count;
+      std::memcpy(jitdump_record_.data(), &debug_info, sizeof(debug_info));
+      WriteJitDumpRecord(kJitDumpRecordCodeDebugInfo, jitdump_record_.data(),
+                         jitdump_record_.size());
+    }
+
+    jitdump_record_.clear();
+    JitDumpCodeLoad code_load;
+    code_load.pid = uint32_t(getpid());
+    code_load.tid = xe::threading::current_thread_system_id();
+    code_load.vma = code_address;
+    code_load.code_addr = code_address;
+    code_load.code_size = code_size;
+    code_load.code_index = jitdump_code_index_++;
+    AppendBytes(jitdump_record_, code_load);
+    AppendString(jitdump_record_, name);
+    const uint8_t* code = static_cast<const uint8_t*>(code_execute_address);
+    jitdump_record_.insert(jitdump_record_.end(), code, code + code_size);
+    WriteJitDumpRecord(kJitDumpRecordCodeLoad, jitdump_record_.data(),
+                       jitdump_record_.size());
+    fflush(jitdump_file_);
+  }
+#endif  // XE_PLATFORM_LINUX
+}
+
+void X64JitSymbols::WriteJitDumpRecord(uint32_t id, const void* data,
+                                       size_t size) {
+#if XE_PLATFORM_LINUX
+  JitDumpRecordHeader header;
+  header.id = id;
+  header.total_size = uint32_t(sizeof(header) + size);
+  header.timestamp = GetJitDumpTimestamp();
+  fwrite(&header, sizeof(header), 1, jitdump_file_);
+  fwrite(data, 1, size, jitdump_file_);
+#endif  // XE_PLATFORM_LINUX
+}
+
+}  // namespace x64
+}  // namespace backend
+}  // namespace cpu
+}  // namespace xe
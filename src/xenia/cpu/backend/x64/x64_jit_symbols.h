@@ -0,0 +1,78 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_CPU_BACKEND_X64_X64_JIT_SYMBOLS_H_
+#define XENIA_CPU_BACKEND_X64_X64_JIT_SYMBOLS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "xenia/cpu/function.h"
+
+namespace xe {
+namespace cpu {
+namespace backend {
+namespace x64 {
+
+// Publishes the symbols of the placed code to host profilers, which otherwise
+// only see anonymous addresses in the code cache:
+// - --x64_perf_map: /tmp/perf-<pid>.map for Linux perf, with the names only.
+// - --x64_perf_jitdump: jit-<pid>.dump for perf inject --jit, also with the
+//   code itself and the mapping of the code to the guest addresses (as the
+//   line numbers in the module), and handling code being replaced in the
+//   reused space of the code cache.
+// - The VTune JIT profiling API when built with it, with the same mapping.
+class X64JitSymbols {
+ public:
+  X64JitSymbols() = default;
+  X64JitSymbols(const X64JitSymbols& jit_symbols) = delete;
+  X64JitSymbols& operator=(const X64JitSymbols& jit_symbols) = delete;
+  ~X64JitSymbols();
+
+  void Initialize();
+
+  // Whether OnCodePlaced needs to be called at all.
+  bool is_active() const { return is_active_; }
+
+  // function and source_map are null for host code. The source map entries
+  // must be in the order of the code offsets.
+  void OnCodePlaced(const void* code_execute_address, size_t code_size,
+                    uint32_t guest_address, const GuestFunction* function,
+                    const std::vector<SourceMapEntry>* source_map);
+
+ private:
+  static std::string GetSymbolName(uint32_t guest_address,
+                                   const GuestFunction* function);
+
+  void WriteJitDumpRecord(uint32_t id, const void* data, size_t size);
+
+  bool is_active_ = false;
+  bool is_vtune_active_ = false;
+
+  std::mutex mutex_;
+  FILE* perf_map_file_ = nullptr;
+  FILE* jitdump_file_ = nullptr;
+  // The first page of the jitdump file is mapped as executable, so perf
+  // record finds the file from the mapping events.
+  void* jitdump_marker_ = nullptr;
+  size_t jitdump_marker_size_ = 0;
+  uint64_t jitdump_code_index_ = 0;
+  std::vector<uint8_t> jitdump_record_;
+};
+
+}  // namespace x64
+}  // namespace backend
+}  // namespace cpu
+}  // namespace xe
+
+#endif  // XENIA_CPU_BACKEND_X64_X64_JIT_SYMBOLS_H_
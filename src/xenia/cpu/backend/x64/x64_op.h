@@ -617,6 +617,46 @@ struct Sequence {
   }
 };
 
+// Whether the instruction is an integer compare immediately followed by a
+// conditional branch on its result, which then jumps with the host flags set
+// by the compare rather than testing the result.
+inline bool IsCompareFusedWithBranch(const Instr* compare) {
+  switch (compare->opcode->num) {
+    case OPCODE_COMPARE_EQ:
+    case OPCODE_COMPARE_NE:
+    case OPCODE_COMPARE_SLT:
+    case OPCODE_COMPARE_SLE:
+    case OPCODE_COMPARE_SGT:
+    case OPCODE_COMPARE_SGE:
+    case OPCODE_COMPARE_ULT:
+    case OPCODE_COMPARE_ULE:
+    case OPCODE_COMPARE_UGT:
+    case OPCODE_COMPARE_UGE:
+      break;
+    default:
+      return false;
+  }
+  if (compare->src1.value->type > INT64_TYPE) {
+    return false;
+  }
+  const Instr* branch = compare->next;
+  return branch &&
+         (branch->opcode == &OPCODE_BRANCH_TRUE_info ||
+          branch->opcode == &OPCODE_BRANCH_FALSE_info) &&
+         branch->src1.value == compare->dest;
+}
+
+// Whether the result of the compare doesn't need to be written to its register
+// because it's used only by the fused branch.
+inline bool IsCompareResultUnused(const Instr* compare) {
+  if (!IsCompareFusedWithBranch(compare)) {
+    return false;
+  }
+  const Value* dest = compare->dest;
+  return !(dest->flags & VALUE_IS_LOOP_REGISTER) && dest->use_head &&
+         !dest->use_head->next && dest->use_head->instr == compare->next;
+}
+
 }  // namespace x64
 }  // namespace backend
 }  // namespace cpu
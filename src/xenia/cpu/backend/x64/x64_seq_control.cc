@@ -444,12 +444,129 @@ struct BRANCH : Sequence<BRANCH, I<OPCODE_BRANCH, VoidOp, LabelOp>> {
 };
 EMITTER_OPCODE_TABLE(OPCODE_BRANCH, BRANCH);
 
+// ============================================================================
+// Compare and branch fusion
+// ============================================================================
+// Jumps if the condition of the compare directly preceding the branch, with the
+// host flags still set by it, is the expected one.
+static void EmitFusedCompareBranch(X64Emitter& e, const Instr* compare,
+                                   bool expect_true, const char* label) {
+  Opcode condition = compare->opcode->num;
+  // The compare sequences swap the operands if only the first is a constant.
+  if (compare->src1.value->IsConstant()) {
+    switch (condition) {
+      case OPCODE_COMPARE_SLT:
+        condition = OPCODE_COMPARE_SGT;
+        break;
+      case OPCODE_COMPARE_SLE:
+        condition = OPCODE_COMPARE_SGE;
+        break;
+      case OPCODE_COMPARE_SGT:
+        condition = OPCODE_COMPARE_SLT;
+        break;
+      case OPCODE_COMPARE_SGE:
+        condition = OPCODE_COMPARE_SLE;
+        break;
+      case OPCODE_COMPARE_ULT:
+        condition = OPCODE_COMPARE_UGT;
+        break;
+      case OPCODE_COMPARE_ULE:
+        condition = OPCODE_COMPARE_UGE;
+        break;
+      case OPCODE_COMPARE_UGT:
+        condition = OPCODE_COMPARE_ULT;
+        break;
+      case OPCODE_COMPARE_UGE:
+        condition = OPCODE_COMPARE_ULE;
+        break;
+      default:
+        break;
+    }
+  }
+  if (!expect_true) {
+    switch (condition) {
+      case OPCODE_COMPARE_EQ:
+        condition = OPCODE_COMPARE_NE;
+        break;
+      case OPCODE_COMPARE_NE:
+        condition = OPCODE_COMPARE_EQ;
+        break;
+      case OPCODE_COMPARE_SLT:
+        condition = OPCODE_COMPARE_SGE;
+        break;
+      case OPCODE_COMPARE_SLE:
+        condition = OPCODE_COMPARE_SGT;
+        break;
+      case OPCODE_COMPARE_SGT:
+        condition = OPCODE_COMPARE_SLE;
+        break;
+      case OPCODE_COMPARE_SGE:
+        condition = OPCODE_COMPARE_SLT;
+        break;
+      case OPCODE_COMPARE_ULT:
+        condition = OPCODE_COMPARE_UGE;
+        break;
+      case OPCODE_COMPARE_ULE:
+        condition = OPCODE_COMPARE_UGT;
+        break;
+      case OPCODE_COMPARE_UGT:
+        condition = OPCODE_COMPARE_ULE;
+        break;
+      case OPCODE_COMPARE_UGE:
+        condition = OPCODE_COMPARE_ULT;
+        break;
+      default:
+        break;
+    }
+  }
+  switch (condition) {
+    case OPCODE_COMPARE_EQ:
+      e.je(label, e.T_NEAR);
+      break;
+    case OPCODE_COMPARE_NE:
+      e.jne(label, e.T_NEAR);
+      break;
+    case OPCODE_COMPARE_SLT:
+      e.jl(label, e.T_NEAR);
+      break;
+    case OPCODE_COMPARE_SLE:
+      e.jle(label, e.T_NEAR);
+      break;
+    case OPCODE_COMPARE_SGT:
+      e.jg(label, e.T_NEAR);
+      break;
+    case OPCODE_COMPARE_SGE:
+      e.jge(label, e.T_NEAR);
+      break;
+    case OPCODE_COMPARE_ULT:
+      e.jb(label, e.T_NEAR);
+      break;
+    case OPCODE_COMPARE_ULE:
+      e.jbe(label, e.T_NEAR);
+      break;
+    case OPCODE_COMPARE_UGT:
+      e.ja(label, e.T_NEAR);
+      break;
+    case OPCODE_COMPARE_UGE:
+      e.jae(label, e.T_NEAR);
+      break;
+    default:
+      assert_unhandled_case(condition);
+      break;
+  }
+}
+
 // ============================================================================
 // OPCODE_BRANCH_TRUE
 // ============================================================================
 struct BRANCH_TRUE_I8
     : Sequence<BRANCH_TRUE_I8, I<OPCODE_BRANCH_TRUE, VoidOp, I8Op, LabelOp>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
+    const Instr* prev = i.instr->prev;
+    if (prev && IsCompareFusedWithBranch(prev)) {
+      EmitFusedCompareBranch(e, prev, true, i.src2.value->name);
+      return;
+    }
     e.test(i.src1, i.src1);
     e.jnz(i.src2.value->name, e.T_NEAR);
   }
@@ -499,6 +616,11 @@ EMITTER_OPCODE_TABLE(OPCODE_BRANCH_TRUE, BRANCH_TRUE_I8, BRANCH_TRUE_I16,
 struct BRANCH_FALSE_I8
     : Sequence<BRANCH_FALSE_I8, I<OPCODE_BRANCH_FALSE, VoidOp, I8Op, LabelOp>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
+    const Instr* prev = i.instr->prev;
+    if (prev && IsCompareFusedWithBranch(prev)) {
+      EmitFusedCompareBranch(e, prev, false, i.src2.value->name);
+      return;
+    }
     e.test(i.src1, i.src1);
     e.jz(i.src2.value->name, e.T_NEAR);
   }
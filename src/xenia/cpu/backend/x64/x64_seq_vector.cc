@@ -167,14 +167,14 @@ struct LOAD_VECTOR_SHL_I8
     if (i.src1.is_constant) {
       auto sh = i.src1.constant();
       assert_true(sh < xe::countof(lvsl_table));
-      e.mov(e.rax, (uintptr_t)&lvsl_table[sh]);
+      e.MovHostImageAddress(e.rax, &lvsl_table[sh]);
       e.vmovaps(i.dest, e.ptr[e.rax]);
     } else {
       // TODO(benvanik): find a cheaper way of doing this.
       e.movzx(e.rdx, i.src1);
       e.and_(e.dx, 0xF);
       e.shl(e.dx, 4);
-      e.mov(e.rax, (uintptr_t)lvsl_table);
+      e.MovHostImageAddress(e.rax, lvsl_table);
       e.vmovaps(i.dest, e.ptr[e.rax + e.rdx]);
     }
   }
@@ -208,14 +208,14 @@ struct LOAD_VECTOR_SHR_I8
     if (i.src1.is_constant) {
       auto sh = i.src1.constant();
       assert_true(sh < xe::countof(lvsr_table));
-      e.mov(e.rax, (uintptr_t)&lvsr_table[sh]);
+      e.MovHostImageAddress(e.rax, &lvsr_table[sh]);
       e.vmovaps(i.dest, e.ptr[e.rax]);
     } else {
       // TODO(benvanik): find a cheaper way of doing this.
       e.movzx(e.rdx, i.src1);
       e.and_(e.dx, 0xF);
       e.shl(e.dx, 4);
-      e.mov(e.rax, (uintptr_t)lvsr_table);
+      e.MovHostImageAddress(e.rax, lvsr_table);
       e.vmovaps(i.dest, e.ptr[e.rax + e.rdx]);
     }
   }
@@ -793,6 +793,83 @@ EMITTER_OPCODE_TABLE(OPCODE_VECTOR_SUB, VECTOR_SUB);
 // ============================================================================
 // OPCODE_VECTOR_SHL
 // ============================================================================
+// Per-element shifts of the VECTOR_SHL/SHR/SHA sequences with AVX-512BW,
+// which can shift every word by its own count (vpsllvw/vpsrlvw/vpsravw).
+static void EmitVariableShiftAVX512(X64Emitter& e, Opcode opcode,
+                                    const Xmm& dest, const Xmm& src,
+                                    const Xmm& shamt) {
+  switch (opcode) {
+    case OPCODE_VECTOR_SHL:
+      e.vpsllvw(dest, src, shamt);
+      break;
+    case OPCODE_VECTOR_SHR:
+      e.vpsrlvw(dest, src, shamt);
+      break;
+    case OPCODE_VECTOR_SHA:
+      e.vpsravw(dest, src, shamt);
+      break;
+    default:
+      assert_unhandled_case(opcode);
+      break;
+  }
+}
+
+template <typename T>
+static void EmitVectorShiftInt16AVX512(X64Emitter& e, const T& i,
+                                       Opcode opcode) {
+  Xmm src1;
+  if (i.src1.is_constant) {
+    src1 = e.xmm1;
+    e.LoadConstantXmm(src1, i.src1.constant());
+  } else {
+    src1 = i.src1;
+  }
+  // Only the low 4 bits of the counts are used by the guest, while x86 shifts
+  // everything out with larger counts.
+  if (i.src2.is_constant) {
+    vec128_t masked = i.src2.constant();
+    for (size_t n = 0; n < 8; ++n) {
+      masked.u16[n] &= 0xF;
+    }
+    e.LoadConstantXmm(e.xmm0, masked);
+  } else {
+    e.vpand(e.xmm0, i.src2, e.GetXmmConstPtr(XMMShiftMaskPI16));
+  }
+  EmitVariableShiftAVX512(e, opcode, i.dest, src1, e.xmm0);
+}
+
+template <typename T>
+static void EmitVectorShiftInt8AVX512(X64Emitter& e, const T& i,
+                                      Opcode opcode) {
+  Xmm src1;
+  if (i.src1.is_constant) {
+    src1 = e.xmm1;
+    e.LoadConstantXmm(src1, i.src1.constant());
+  } else {
+    src1 = i.src1;
+  }
+  if (i.src2.is_constant) {
+    vec128_t masked = i.src2.constant();
+    for (size_t n = 0; n < 16; ++n) {
+      masked.u8[n] &= 0x7;
+    }
+    e.LoadConstantXmm(e.xmm0, masked);
+  } else {
+    e.vpand(e.xmm0, i.src2, e.GetXmmConstPtr(XMMShiftMaskPI8));
+  }
+  // There are no byte shifts, so widen the bytes to words, shift them and
+  // truncate back. ymm16-31 have no legacy SSE counterparts, so using them
+  // doesn't dirty the upper state and doesn't need a vzeroupper.
+  if (opcode == OPCODE_VECTOR_SHA) {
+    e.vpmovsxbw(e.ymm16, src1);
+  } else {
+    e.vpmovzxbw(e.ymm16, src1);
+  }
+  e.vpmovzxbw(e.ymm17, e.xmm0);
+  EmitVariableShiftAVX512(e, opcode, e.ymm16, e.ymm16, e.ymm17);
+  e.vpmovwb(i.dest, e.ymm16);
+}
+
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int> = 0>
 static __m128i EmulateVectorShl(void*, __m128i src1, __m128i src2) {
   alignas(16) T value[16 / sizeof(T)];
@@ -851,6 +928,12 @@ struct VECTOR_SHL_V128
           return;
         }
       }
+    }
+    if (e.IsFeatureEnabled(kX64EmitAVX512Ortho | kX64EmitAVX512BW)) {
+      EmitVectorShiftInt8AVX512(e, i, OPCODE_VECTOR_SHL);
+      return;
+    }
+    if (i.src2.is_constant) {
       e.lea(e.GetNativeParam(1), e.StashConstantXmm(1, i.src2.constant()));
     } else {
       e.lea(e.GetNativeParam(1), e.StashXmm(1, i.src2));
@@ -885,6 +968,11 @@ struct VECTOR_SHL_V128
       }
     }
 
+    if (e.IsFeatureEnabled(kX64EmitAVX512Ortho | kX64EmitAVX512BW)) {
+      EmitVectorShiftInt16AVX512(e, i, OPCODE_VECTOR_SHL);
+      return;
+    }
+
     // Shift 8 words in src1 by amount specified in src2.
     Xbyak::Label emu, end;
 
@@ -1059,6 +1147,12 @@ struct VECTOR_SHR_V128
           return;
         }
       }
+    }
+    if (e.IsFeatureEnabled(kX64EmitAVX512Ortho | kX64EmitAVX512BW)) {
+      EmitVectorShiftInt8AVX512(e, i, OPCODE_VECTOR_SHR);
+      return;
+    }
+    if (i.src2.is_constant) {
       e.lea(e.GetNativeParam(1), e.StashConstantXmm(1, i.src2.constant()));
     } else {
       e.lea(e.GetNativeParam(1), e.StashXmm(1, i.src2));
@@ -1085,6 +1179,11 @@ struct VECTOR_SHR_V128
       }
     }
 
+    if (e.IsFeatureEnabled(kX64EmitAVX512Ortho | kX64EmitAVX512BW)) {
+      EmitVectorShiftInt16AVX512(e, i, OPCODE_VECTOR_SHR);
+      return;
+    }
+
     // Shift 8 words in src1 by amount specified in src2.
     Xbyak::Label emu, end;
 
@@ -1244,6 +1343,12 @@ struct VECTOR_SHA_V128
           return;
         }
       }
+    }
+    if (e.IsFeatureEnabled(kX64EmitAVX512Ortho | kX64EmitAVX512BW)) {
+      EmitVectorShiftInt8AVX512(e, i, OPCODE_VECTOR_SHA);
+      return;
+    }
+    if (i.src2.is_constant) {
       e.lea(e.GetNativeParam(1), e.StashConstantXmm(1, i.src2.constant()));
     } else {
       e.lea(e.GetNativeParam(1), e.StashXmm(1, i.src2));
@@ -1270,6 +1375,11 @@ struct VECTOR_SHA_V128
       }
     }
 
+    if (e.IsFeatureEnabled(kX64EmitAVX512Ortho | kX64EmitAVX512BW)) {
+      EmitVectorShiftInt16AVX512(e, i, OPCODE_VECTOR_SHA);
+      return;
+    }
+
     // Shift 8 words in src1 by amount specified in src2.
     Xbyak::Label emu, end;
 
@@ -1659,7 +1769,7 @@ struct EXTRACT_I32
       e.mov(e.al, i.src2);
       e.and_(e.al, 0x03);
       e.shl(e.al, 4);
-      e.mov(e.rdx, reinterpret_cast<uint64_t>(extract_table_32));
+      e.MovHostImageAddress(e.rdx, extract_table_32);
       e.vmovaps(e.xmm0, e.ptr[e.rdx + e.rax]);
       e.vpshufb(e.xmm0, src1, e.xmm0);
       e.vpextrd(i.dest, e.xmm0, 0);
@@ -1814,6 +1924,27 @@ struct PERMUTE_I32
       } else {
         e.vpblendw(i.dest, e.xmm0, blend_control);  // $0 = $1 <blend> $2
       }
+    } else if (e.IsFeatureEnabled(kX64EmitAVX512Ortho)) {
+      // Permute by non-constant - each byte of the control selects a word,
+      // with bit 2 selecting src3, same as the indices of vpermi2d.
+      Xmm src2;
+      if (i.src2.is_constant) {
+        src2 = e.xmm1;
+        e.LoadConstantXmm(src2, i.src2.constant());
+      } else {
+        src2 = i.src2;
+      }
+      Xmm src3;
+      if (i.src3.is_constant) {
+        src3 = e.xmm2;
+        e.LoadConstantXmm(src3, i.src3.constant());
+      } else {
+        src3 = i.src3;
+      }
+      e.vmovd(e.xmm0, i.src1);
+      e.vpmovzxbd(e.xmm0, e.xmm0);
+      e.vpermi2d(e.xmm0, src2, src3);
+      e.vmovdqa(i.dest, e.xmm0);
     } else {
       // Permute by non-constant.
       assert_always();
@@ -2314,10 +2445,41 @@ struct PACK : Sequence<PACK, I<OPCODE_PACK, V128Op, V128Op, V128Op>> {
     }
     return _mm_load_si128(reinterpret_cast<__m128i*>(c));
   }
+  // Places src1 in the low and src2 in the high half of ymm16 to narrow both
+  // with a single AVX-512 down-convert.
+  static void EmitConcatenateAVX512(X64Emitter& e, const EmitArgType& i) {
+    Xmm src1;
+    if (i.src1.is_constant) {
+      src1 = e.xmm0;
+      e.LoadConstantXmm(src1, i.src1.constant());
+    } else {
+      src1 = i.src1;
+    }
+    Xmm src2;
+    if (i.src2.is_constant) {
+      src2 = e.xmm1;
+      e.LoadConstantXmm(src2, i.src2.constant());
+    } else {
+      src2 = i.src2;
+    }
+    e.vinserti32x4(e.ymm16, Xbyak::Ymm(src1.getIdx()), src2, 1);
+  }
   static void Emit8_IN_16(X64Emitter& e, const EmitArgType& i, uint32_t flags) {
     // TODO(benvanik): handle src2 (or src1) being constant zero
     if (IsPackInUnsigned(flags)) {
       if (IsPackOutUnsigned(flags)) {
+        if (e.IsFeatureEnabled(kX64EmitAVX512Ortho | kX64EmitAVX512BW)) {
+          EmitConcatenateAVX512(e, i);
+          if (IsPackOutSaturate(flags)) {
+            // unsigned -> unsigned + saturate
+            e.vpmovuswb(i.dest, e.ymm16);
+          } else {
+            // unsigned -> unsigned
+            e.vpmovwb(i.dest, e.ymm16);
+          }
+          e.vpshufb(i.dest, i.dest, e.GetXmmConstPtr(XMMByteOrderMask));
+          return;
+        }
         if (IsPackOutSaturate(flags)) {
           // unsigned -> unsigned + saturate
           if (i.src2.is_constant) {
@@ -2377,12 +2539,33 @@ struct PACK : Sequence<PACK, I<OPCODE_PACK, V128Op, V128Op, V128Op>> {
       }
     }
   }
+  // Swaps the words in each dword.
+  static void EmitSwapWords(X64Emitter& e, const Xmm& dest) {
+    if (e.IsFeatureEnabled(kX64EmitAVX512Ortho)) {
+      e.vprold(dest, dest, 16);
+    } else {
+      e.vpshuflw(dest, dest, 0b10110001);
+      e.vpshufhw(dest, dest, 0b10110001);
+    }
+  }
   // Pack 2 32-bit vectors into a 16-bit vector.
   static void Emit16_IN_32(X64Emitter& e, const EmitArgType& i,
                            uint32_t flags) {
     // TODO(benvanik): handle src2 (or src1) being constant zero
     if (IsPackInUnsigned(flags)) {
       if (IsPackOutUnsigned(flags)) {
+        if (e.IsFeatureEnabled(kX64EmitAVX512Ortho)) {
+          EmitConcatenateAVX512(e, i);
+          if (IsPackOutSaturate(flags)) {
+            // unsigned -> unsigned + saturate
+            e.vpmovusdw(i.dest, e.ymm16);
+          } else {
+            // unsigned -> unsigned
+            e.vpmovdw(i.dest, e.ymm16);
+          }
+          EmitSwapWords(e, i.dest);
+          return;
+        }
         if (IsPackOutSaturate(flags)) {
           // unsigned -> unsigned + saturate
           // Construct a saturation max value
@@ -2446,8 +2629,7 @@ struct PACK : Sequence<PACK, I<OPCODE_PACK, V128Op, V128Op, V128Op>> {
           // TMP[15:0] <- (DEST[31:0] < 0) ? 0 : DEST[15:0];
           // DEST[15:0] <- (DEST[31:0] > FFFFH) ? FFFFH : TMP[15:0];
           e.vpackusdw(i.dest, i.src1, i.src2);
-          e.vpshuflw(i.dest, i.dest, 0b10110001);
-          e.vpshufhw(i.dest, i.dest, 0b10110001);
+          EmitSwapWords(e, i.dest);
         } else {
           // signed -> unsigned
           assert_always();
@@ -2465,8 +2647,7 @@ struct PACK : Sequence<PACK, I<OPCODE_PACK, V128Op, V128Op, V128Op>> {
             e.LoadConstantXmm(src2, i.src2.constant());
           }
           e.vpackssdw(i.dest, i.src1, src2);
-          e.vpshuflw(i.dest, i.dest, 0b10110001);
-          e.vpshufhw(i.dest, i.dest, 0b10110001);
+          EmitSwapWords(e, i.dest);
         } else {
           // signed -> signed
           assert_always();
@@ -2805,8 +2986,7 @@ struct UNPACK : Sequence<UNPACK, I<OPCODE_UNPACK, V128Op, V128Op>> {
         } else {
           // signed -> signed
           e.vpshufb(i.dest, src, e.GetXmmConstPtr(XMMByteOrderMask));
-          e.vpunpcklbw(i.dest, i.dest, i.dest);
-          e.vpsraw(i.dest, 8);
+          e.vpmovsxbw(i.dest, i.dest);
         }
       }
     }
@@ -2857,8 +3037,7 @@ struct UNPACK : Sequence<UNPACK, I<OPCODE_UNPACK, V128Op, V128Op>> {
           assert_always();
         } else {
           // signed -> signed
-          e.vpunpcklwd(i.dest, src, src);
-          e.vpsrad(i.dest, 16);
+          e.vpmovsxwd(i.dest, src);
         }
       }
     }
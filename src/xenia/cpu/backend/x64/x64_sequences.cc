@@ -65,6 +65,7 @@ struct COMMENT : Sequence<COMMENT, I<OPCODE_COMMENT, VoidOp, OffsetOp>> {
       // TODO(benvanik): pass through.
       // TODO(benvanik): don't just leak this memory.
       auto str_copy = xe_strdup(str);
+      e.MarkNotPersistable();
       e.mov(e.rdx, reinterpret_cast<uint64_t>(str_copy));
       e.CallNative(reinterpret_cast<void*>(TraceString));
     }
@@ -96,37 +97,65 @@ EMITTER_OPCODE_TABLE(OPCODE_SOURCE_OFFSET, SOURCE_OFFSET);
 // ============================================================================
 struct ASSIGN_I8 : Sequence<ASSIGN_I8, I<OPCODE_ASSIGN, I8Op, I8Op>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
-    e.mov(i.dest, i.src1);
+    if (i.src1.is_constant) {
+      e.mov(i.dest, i.src1.constant());
+    } else {
+      e.mov(i.dest, i.src1);
+    }
   }
 };
 struct ASSIGN_I16 : Sequence<ASSIGN_I16, I<OPCODE_ASSIGN, I16Op, I16Op>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
-    e.mov(i.dest, i.src1);
+    if (i.src1.is_constant) {
+      e.mov(i.dest, i.src1.constant());
+    } else {
+      e.mov(i.dest, i.src1);
+    }
   }
 };
 struct ASSIGN_I32 : Sequence<ASSIGN_I32, I<OPCODE_ASSIGN, I32Op, I32Op>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
-    e.mov(i.dest, i.src1);
+    if (i.src1.is_constant) {
+      e.mov(i.dest, i.src1.constant());
+    } else {
+      e.mov(i.dest, i.src1);
+    }
   }
 };
 struct ASSIGN_I64 : Sequence<ASSIGN_I64, I<OPCODE_ASSIGN, I64Op, I64Op>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
-    e.mov(i.dest, i.src1);
+    if (i.src1.is_constant) {
+      e.mov(i.dest, i.src1.constant());
+    } else {
+      e.mov(i.dest, i.src1);
+    }
   }
 };
 struct ASSIGN_F32 : Sequence<ASSIGN_F32, I<OPCODE_ASSIGN, F32Op, F32Op>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
-    e.vmovaps(i.dest, i.src1);
+    if (i.src1.is_constant) {
+      e.LoadConstantXmm(i.dest, i.src1.constant());
+    } else {
+      e.vmovaps(i.dest, i.src1);
+    }
   }
 };
 struct ASSIGN_F64 : Sequence<ASSIGN_F64, I<OPCODE_ASSIGN, F64Op, F64Op>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
-    e.vmovaps(i.dest, i.src1);
+    if (i.src1.is_constant) {
+      e.LoadConstantXmm(i.dest, i.src1.constant());
+    } else {
+      e.vmovaps(i.dest, i.src1);
+    }
   }
 };
 struct ASSIGN_V128 : Sequence<ASSIGN_V128, I<OPCODE_ASSIGN, V128Op, V128Op>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
-    e.vmovaps(i.dest, i.src1);
+    if (i.src1.is_constant) {
+      e.LoadConstantXmm(i.dest, i.src1.constant());
+    } else {
+      e.vmovaps(i.dest, i.src1);
+    }
   }
 };
 EMITTER_OPCODE_TABLE(OPCODE_ASSIGN, ASSIGN_I8, ASSIGN_I16, ASSIGN_I32,
@@ -441,30 +470,60 @@ EMITTER_OPCODE_TABLE(OPCODE_ROUND, ROUND_F32, ROUND_F64, ROUND_V128);
 // ============================================================================
 struct LOAD_CLOCK : Sequence<LOAD_CLOCK, I<OPCODE_LOAD_CLOCK, I64Op>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
-    // When scaling is disabled and the raw clock source is selected, the code
-    // in the Clock class is actually just forwarding tick counts after one
-    // simple multiply and division. In that case we rather bake the scaling in
-    // here to cut extra function calls with CPU cache misses and stack frame
-    // overhead.
-    if (cvars::clock_no_scaling && cvars::clock_source_raw) {
-      auto ratio = Clock::guest_tick_ratio();
-      // The 360 CPU is an in-order CPU, AMD64 usually isn't. Without
-      // mfence/lfence magic the rdtsc instruction can be executed sooner or
-      // later in the cache window. Since it's resolution however is much higher
-      // than the 360's mftb instruction this can safely be ignored.
-
+    // With the raw clock source, the guest tick count is calculated inline
+    // from rdtsc to cut extra function calls with CPU cache misses and stack
+    // frame overhead. The 360 CPU is an in-order CPU, AMD64 usually isn't.
+    // Without mfence/lfence magic the rdtsc instruction can be executed sooner
+    // or later in the cache window. Since it's resolution however is much
+    // higher than the 360's mftb instruction this can safely be ignored.
+    if (cvars::clock_source_raw && cvars::clock_no_scaling) {
+      // The scaling is constant, bake it in here.
+      uint64_t multiplier;
+      uint32_t shift;
+      Clock::GetRatioMultiplierShift(Clock::guest_tick_ratio(), multiplier,
+                                     shift);
       // Read time stamp in edx (high part) and eax (low part).
       e.rdtsc();
       // Make it a 64 bit number in rax.
       e.shl(e.rdx, 32);
       e.or_(e.rax, e.rdx);
       // Apply tick frequency scaling.
-      e.mov(e.rcx, ratio.first);
+      e.mov(e.rcx, multiplier);
       e.mul(e.rcx);
       // We actually now have a 128 bit number in rdx:rax.
-      e.mov(e.rcx, ratio.second);
-      e.div(e.rcx);
+      if (shift) {
+        e.shrd(e.rax, e.rdx, uint8_t(shift));
+      }
+      e.mov(i.dest, e.rax);
+    } else if (cvars::clock_source_raw) {
+      // Read the mapping published by the Clock through a sequence lock,
+      // falling back to the Clock if it's being modified. x86 doesn't reorder
+      // loads with other loads, so no fences are needed.
+      using Mapping = Clock::GuestTickMapping;
+      Xbyak::Label fallback, done;
+      e.MovHostImageAddress(e.r9, &Clock::guest_tick_mapping());
+      e.mov(e.r8, e.qword[e.r9 + offsetof(Mapping, sequence)]);
+      e.test(e.r8d, 1);
+      e.jnz(fallback, CodeGenerator::T_NEAR);
+      e.rdtsc();
+      e.shl(e.rdx, 32);
+      e.or_(e.rax, e.rdx);
+      e.mov(e.edx, 0);
+      e.sub(e.rax, e.qword[e.r9 + offsetof(Mapping, host_base)]);
+      // Clamp to the base if the TSC is behind on this core.
+      e.cmovb(e.rax, e.rdx);
+      e.mul(e.qword[e.r9 + offsetof(Mapping, multiplier)]);
+      e.mov(e.rcx, e.qword[e.r9 + offsetof(Mapping, shift)]);
+      e.shrd(e.rax, e.rdx, e.cl);
+      e.add(e.rax, e.qword[e.r9 + offsetof(Mapping, guest_base)]);
+      e.cmp(e.r8, e.qword[e.r9 + offsetof(Mapping, sequence)]);
+      e.jne(fallback, CodeGenerator::T_NEAR);
+      e.mov(i.dest, e.rax);
+      e.jmp(done, CodeGenerator::T_NEAR);
+      e.L(fallback);
+      e.CallNative(LoadClock);
       e.mov(i.dest, e.rax);
+      e.L(done);
     } else {
       e.CallNative(LoadClock);
       e.mov(i.dest, e.rax);
@@ -929,7 +988,9 @@ struct COMPARE_EQ_I8
         [](X64Emitter& e, const Reg8& src1, int32_t constant) {
           e.cmp(src1, constant);
         });
-    e.sete(i.dest);
+    if (!IsCompareResultUnused(i.instr)) {
+      e.sete(i.dest);
+    }
   }
 };
 struct COMPARE_EQ_I16
@@ -943,7 +1004,9 @@ struct COMPARE_EQ_I16
         [](X64Emitter& e, const Reg16& src1, int32_t constant) {
           e.cmp(src1, constant);
         });
-    e.sete(i.dest);
+    if (!IsCompareResultUnused(i.instr)) {
+      e.sete(i.dest);
+    }
   }
 };
 struct COMPARE_EQ_I32
@@ -957,7 +1020,9 @@ struct COMPARE_EQ_I32
         [](X64Emitter& e, const Reg32& src1, int32_t constant) {
           e.cmp(src1, constant);
         });
-    e.sete(i.dest);
+    if (!IsCompareResultUnused(i.instr)) {
+      e.sete(i.dest);
+    }
   }
 };
 struct COMPARE_EQ_I64
@@ -971,7 +1036,9 @@ struct COMPARE_EQ_I64
         [](X64Emitter& e, const Reg64& src1, int32_t constant) {
           e.cmp(src1, constant);
         });
-    e.sete(i.dest);
+    if (!IsCompareResultUnused(i.instr)) {
+      e.sete(i.dest);
+    }
   }
 };
 struct COMPARE_EQ_F32
@@ -1012,7 +1079,9 @@ struct COMPARE_NE_I8
         [](X64Emitter& e, const Reg8& src1, int32_t constant) {
           e.cmp(src1, constant);
         });
-    e.setne(i.dest);
+    if (!IsCompareResultUnused(i.instr)) {
+      e.setne(i.dest);
+    }
   }
 };
 struct COMPARE_NE_I16
@@ -1026,7 +1095,9 @@ struct COMPARE_NE_I16
         [](X64Emitter& e, const Reg16& src1, int32_t constant) {
           e.cmp(src1, constant);
         });
-    e.setne(i.dest);
+    if (!IsCompareResultUnused(i.instr)) {
+      e.setne(i.dest);
+    }
   }
 };
 struct COMPARE_NE_I32
@@ -1040,7 +1111,9 @@ struct COMPARE_NE_I32
         [](X64Emitter& e, const Reg32& src1, int32_t constant) {
           e.cmp(src1, constant);
         });
-    e.setne(i.dest);
+    if (!IsCompareResultUnused(i.instr)) {
+      e.setne(i.dest);
+    }
   }
 };
 struct COMPARE_NE_I64
@@ -1054,7 +1127,9 @@ struct COMPARE_NE_I64
         [](X64Emitter& e, const Reg64& src1, int32_t constant) {
           e.cmp(src1, constant);
         });
-    e.setne(i.dest);
+    if (!IsCompareResultUnused(i.instr)) {
+      e.setne(i.dest);
+    }
   }
 };
 struct COMPARE_NE_F32
@@ -1084,24 +1159,31 @@ EMITTER_OPCODE_TABLE(OPCODE_COMPARE_NE, COMPARE_NE_I8, COMPARE_NE_I16,
       : Sequence<COMPARE_##op##_##type,                                 \
                  I<OPCODE_COMPARE_##op, I8Op, type, type>> {            \
     static void Emit(X64Emitter& e, const EmitArgType& i) {             \
+      bool store_result = !IsCompareResultUnused(i.instr);              \
       EmitAssociativeCompareOp(                                         \
           e, i,                                                         \
-          [](X64Emitter& e, const Reg8& dest, const reg_type& src1,     \
-             const reg_type& src2, bool inverse) {                      \
+          [store_result](X64Emitter& e, const Reg8& dest,               \
+                         const reg_type& src1, const reg_type& src2,    \
+                         bool inverse) {                                \
             e.cmp(src1, src2);                                          \
-            if (!inverse) {                                             \
-              e.instr(dest);                                            \
-            } else {                                                    \
-              e.inverse_instr(dest);                                    \
+            if (store_result) {                                         \
+              if (!inverse) {                                           \
+                e.instr(dest);                                          \
+              } else {                                                  \
+                e.inverse_instr(dest);                                  \
+              }                                                         \
             }                                                           \
           },                                                            \
-          [](X64Emitter& e, const Reg8& dest, const reg_type& src1,     \
-             int32_t constant, bool inverse) {                          \
+          [store_result](X64Emitter& e, const Reg8& dest,               \
+                         const reg_type& src1, int32_t constant,        \
+                         bool inverse) {                                \
             e.cmp(src1, constant);                                      \
-            if (!inverse) {                                             \
-              e.instr(dest);                                            \
-            } else {                                                    \
-              e.inverse_instr(dest);                                    \
+            if (store_result) {                                         \
+              if (!inverse) {                                           \
+                e.instr(dest);                                          \
+              } else {                                                  \
+                e.inverse_instr(dest);                                  \
+              }                                                         \
             }                                                           \
           });                                                           \
     }                                                                   \
@@ -3319,9 +3401,18 @@ struct SET_ROUNDING_MODE_I32
     : Sequence<SET_ROUNDING_MODE_I32,
                I<OPCODE_SET_ROUNDING_MODE, VoidOp, I32Op>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
+    e.EmitInstrumentationCounter(
+        X64Backend::InstrumentationCounter::Type::kMXCSRSwitch,
+        e.function_address());
+    if (i.src1.is_constant) {
+      // Known at translation time (see RoundingModeEliminationPass).
+      e.MovHostImageAddress(e.rax, &mxcsr_table[i.src1.constant() & 0x7]);
+      e.vldmxcsr(e.ptr[e.rax]);
+      return;
+    }
     e.mov(e.rcx, i.src1);
     e.and_(e.rcx, 0x7);
-    e.mov(e.rax, uintptr_t(mxcsr_table));
+    e.MovHostImageAddress(e.rax, mxcsr_table);
     e.vldmxcsr(e.ptr[e.rax + e.rcx * 4]);
   }
 };
@@ -0,0 +1,130 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/background_compiler.h"
+
+#include "xenia/base/assert.h"
+#include "xenia/base/profiling.h"
+#include "xenia/cpu/ppc/ppc_scanner.h"
+#include "xenia/cpu/processor.h"
+
+namespace xe {
+namespace cpu {
+
+namespace {
+// Depth of the request being translated on the current thread - 0 for guest
+// threads demanding a function.
+thread_local uint32_t current_request_depth = 0;
+}  // namespace
+
+BackgroundCompiler::BackgroundCompiler(Processor* processor,
+                                       uint32_t thread_count,
+                                       uint32_t max_depth)
+    : processor_(processor), max_depth_(max_depth) {
+  for (uint32_t i = 0; i < thread_count; ++i) {
+    xe::threading::Thread::CreationParameters params;
+    params.initial_priority = xe::threading::ThreadPriority::kLowest;
+    std::unique_ptr<xe::threading::Thread> thread =
+        xe::threading::Thread::Create(params, [this]() { WorkerThread(); });
+    assert_not_null(thread);
+    thread->set_name("Background Compiler");
+    threads_.push_back(std::move(thread));
+  }
+}
+
+BackgroundCompiler::~BackgroundCompiler() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shutdown_ = true;
+  }
+  request_cond_.notify_all();
+  for (auto& thread : threads_) {
+    xe::threading::Wait(thread.get(), false);
+  }
+}
+
+void BackgroundCompiler::OnFunctionDefined(GuestFunction* function) {
+  uint32_t depth = current_request_depth;
+  if (depth >= max_depth_) {
+    return;
+  }
+
+  std::vector<uint32_t> call_targets;
+  ppc::PPCScanner scanner(processor_->frontend());
+  scanner.FindBlocks(function, &call_targets);
+  if (call_targets.empty()) {
+    return;
+  }
+
+  size_t queued_count = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (shutdown_) {
+      return;
+    }
+    for (uint32_t target : call_targets) {
+      if (queued_addresses_.size() >= kMaxQueuedAddresses) {
+        break;
+      }
+      if (!queued_addresses_.insert(target).second) {
+        continue;
+      }
+      requests_.push({depth + 1, next_sequence_++, target, nullptr});
+      ++queued_count;
+    }
+  }
+  if (queued_count == 1) {
+    request_cond_.notify_one();
+  } else if (queued_count) {
+    request_cond_.notify_all();
+  }
+}
+
+void BackgroundCompiler::RequestOptimization(GuestFunction* function) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (shutdown_) {
+      return;
+    }
+    requests_.push({0, next_sequence_++, function->address(), function});
+  }
+  request_cond_.notify_one();
+}
+
+void BackgroundCompiler::WorkerThread() {
+  while (true) {
+    Request request;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      request_cond_.wait(lock,
+                         [this]() { return shutdown_ || !requests_.empty(); });
+      if (shutdown_) {
+        return;
+      }
+      request = requests_.top();
+      requests_.pop();
+    }
+    if (request.function) {
+      SCOPE_profile_cpu_i("cpu", "BackgroundCompiler::Optimize");
+      processor_->OptimizeFunction(request.function);
+      continue;
+    }
+    // Already translated by a guest thread.
+    if (processor_->QueryFunction(request.address)) {
+      continue;
+    }
+    SCOPE_profile_cpu_i("cpu", "BackgroundCompiler::Translate");
+    current_request_depth = request.depth;
+    // Failures are cached in the entry table like for demanded functions.
+    processor_->ResolveFunction(request.address);
+  }
+}
+
+}  // namespace cpu
+}  // namespace xe
@@ -0,0 +1,93 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_CPU_BACKGROUND_COMPILER_H_
+#define XENIA_CPU_BACKGROUND_COMPILER_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <unordered_set>
+#include <vector>
+
+#include "xenia/base/threading.h"
+#include "xenia/cpu/function.h"
+
+namespace xe {
+namespace cpu {
+
+class Processor;
+
+// Translates functions on background threads, so guest threads don't have to
+// stall for it.
+// Whenever a function is defined, the targets of its static calls are queued,
+// with the ones closest to code that has actually been demanded translated
+// first. Translation goes through Processor::ResolveFunction, so the entry
+// table and the symbol states make sure foreground and background requests
+// never translate the same function twice.
+// With tiered compilation, hot functions are also optimized here, before any
+// speculative translation.
+class BackgroundCompiler {
+ public:
+  // max_depth of 0 disables speculative translation.
+  BackgroundCompiler(Processor* processor, uint32_t thread_count,
+                     uint32_t max_depth);
+  ~BackgroundCompiler();
+
+  // Called after a function has been defined on any thread.
+  void OnFunctionDefined(GuestFunction* function);
+  // Queues Processor::OptimizeFunction for the function.
+  void RequestOptimization(GuestFunction* function);
+
+ private:
+  struct Request {
+    // Number of speculative calls from a demanded function, or 0 for
+    // optimization.
+    uint32_t depth;
+    // For FIFO order within one depth.
+    uint64_t sequence;
+    uint32_t address;
+    // To optimize if not null.
+    GuestFunction* function;
+
+    // std::priority_queue pops the largest element.
+    bool operator<(const Request& other) const {
+      if (depth != other.depth) {
+        return depth > other.depth;
+      }
+      return sequence > other.sequence;
+    }
+  };
+
+  // Cap on the number of discovered functions, to not keep translating
+  // forever if the call graph is huge.
+  static constexpr size_t kMaxQueuedAddresses = 1 << 18;
+
+  void WorkerThread();
+
+  Processor* processor_;
+  uint32_t max_depth_;
+
+  std::mutex mutex_;
+  std::condition_variable request_cond_;
+  std::priority_queue<Request> requests_;
+  // Addresses ever queued, to avoid queueing them repeatedly.
+  std::unordered_set<uint32_t> queued_addresses_;
+  uint64_t next_sequence_ = 0;
+  bool shutdown_ = false;
+
+  std::vector<std::unique_ptr<xe::threading::Thread>> threads_;
+};
+
+}  // namespace cpu
+}  // namespace xe
+
+#endif  // XENIA_CPU_BACKGROUND_COMPILER_H_
@@ -9,13 +9,79 @@
 
 #include "xenia/cpu/breakpoint.h"
 
+#include "third_party/fmt/include/fmt/format.h"
 #include "xenia/base/string_util.h"
+#include "xenia/base/utf8.h"
 #include "xenia/cpu/backend/backend.h"
 #include "xenia/cpu/backend/code_cache.h"
 
 namespace xe {
 namespace cpu {
 
+namespace {
+
+constexpr std::pair<const char*, BreakpointCondition::Op> kConditionOpNames[] =
+    {
+        {"eq", BreakpointCondition::Op::kEqual},
+        {"ne", BreakpointCondition::Op::kNotEqual},
+        {"slt", BreakpointCondition::Op::kSignedLess},
+        {"sle", BreakpointCondition::Op::kSignedLessEqual},
+        {"sgt", BreakpointCondition::Op::kSignedGreater},
+        {"sge", BreakpointCondition::Op::kSignedGreaterEqual},
+        {"ult", BreakpointCondition::Op::kUnsignedLess},
+        {"ule", BreakpointCondition::Op::kUnsignedLessEqual},
+        {"ugt", BreakpointCondition::Op::kUnsignedGreater},
+        {"uge", BreakpointCondition::Op::kUnsignedGreaterEqual},
+};
+
+}  // namespace
+
+bool BreakpointCondition::ParseOp(const std::string_view name, Op& op_out) {
+  for (const auto& op_name : kConditionOpNames) {
+    if (xe::utf8::equal_case(name, op_name.first)) {
+      op_out = op_name.second;
+      return true;
+    }
+  }
+  return false;
+}
+
+const char* BreakpointCondition::GetOpName(Op op) {
+  for (const auto& op_name : kConditionOpNames) {
+    if (op_name.second == op) {
+      return op_name.first;
+    }
+  }
+  return "?";
+}
+
+bool BreakpointCondition::Parse(const std::string_view text,
+                                BreakpointCondition& condition_out) {
+  auto parts = xe::utf8::split(text, " ", true);
+  if (parts.empty()) {
+    condition_out = BreakpointCondition();
+    return true;
+  }
+  // Validated before converting, as from_string asserts on errors.
+  if (parts.size() != 3 || parts[0].size() < 2 || parts[0].size() > 3 ||
+      (parts[0][0] != 'r' && parts[0][0] != 'R') ||
+      parts[0].find_first_not_of("0123456789", 1) != std::string_view::npos ||
+      parts[2].size() > 16 ||
+      parts[2].find_first_not_of("0123456789ABCDEFabcdef") !=
+          std::string_view::npos) {
+    return false;
+  }
+  BreakpointCondition condition;
+  condition.gpr = xe::string_util::from_string<int32_t>(parts[0].substr(1));
+  if (condition.gpr >= 32 || !ParseOp(parts[1], condition.op)) {
+    return false;
+  }
+  condition.value = xe::string_util::from_string<uint64_t>(parts[2], true);
+  condition.truncate = parts[2].size() <= 8;
+  condition_out = condition;
+  return true;
+}
+
 Breakpoint::Breakpoint(Processor* processor, AddressType address_type,
                        uint64_t address, HitCallback hit_callback)
     : processor_(processor),
@@ -23,29 +89,53 @@ Breakpoint::Breakpoint(Processor* processor, AddressType address_type,
       address_(address),
       hit_callback_(hit_callback) {}
 
+Breakpoint::Breakpoint(Processor* processor, uint32_t guest_address,
+                       const BreakpointCondition& condition,
+                       bool is_tracepoint, HitCallback hit_callback)
+    : processor_(processor),
+      address_type_(AddressType::kGuest),
+      address_(guest_address),
+      condition_(condition),
+      is_tracepoint_(is_tracepoint),
+      hit_callback_(hit_callback) {}
+
 Breakpoint::~Breakpoint() { assert_false(installed_); }
 
 void Breakpoint::Install() {
   assert_false(installed_);
-  processor_->backend()->InstallBreakpoint(this);
+  if (is_compiled()) {
+    assert_not_null(compiled_);
+    compiled_->armed.store(true, std::memory_order_release);
+  } else {
+    processor_->backend()->InstallBreakpoint(this);
+  }
   installed_ = true;
 }
 
 void Breakpoint::Uninstall() {
   assert_true(installed_);
-  processor_->backend()->UninstallBreakpoint(this);
+  if (is_compiled()) {
+    compiled_->armed.store(false, std::memory_order_release);
+  } else {
+    processor_->backend()->UninstallBreakpoint(this);
+  }
   installed_ = false;
 }
 
 std::string Breakpoint::to_string() const {
   if (address_type_ == AddressType::kGuest) {
-    auto str =
-        std::string("PPC ") + xe::string_util::to_hex_string(guest_address());
+    auto str = std::string(is_tracepoint_ ? "PPC trace " : "PPC ") +
+               xe::string_util::to_hex_string(guest_address());
     auto functions = processor_->FindFunctionsWithAddress(guest_address());
-    if (functions.empty()) {
-      return str;
+    if (!functions.empty()) {
+      str += " " + functions[0]->name();
+    }
+    if (condition_.gpr >= 0) {
+      str += fmt::format(" if r{} {} {:X}", condition_.gpr,
+                         BreakpointCondition::GetOpName(condition_.op),
+                         condition_.truncate ? uint32_t(condition_.value)
+                                             : condition_.value);
     }
-    str += " " + functions[0]->name();
     return str;
   } else {
     return std::string("x64 ") + xe::string_util::to_hex_string(host_address());
@@ -10,11 +10,62 @@
 #ifndef XENIA_CPU_BREAKPOINT_H_
 #define XENIA_CPU_BREAKPOINT_H_
 
+#include <atomic>
+#include <string_view>
+
 #include "xenia/cpu/processor.h"
 
 namespace xe {
 namespace cpu {
 
+// Register comparison checked by the code generated for a guest breakpoint.
+struct BreakpointCondition {
+  enum class Op {
+    kEqual,
+    kNotEqual,
+    kSignedLess,
+    kSignedLessEqual,
+    kSignedGreater,
+    kSignedGreaterEqual,
+    kUnsignedLess,
+    kUnsignedLessEqual,
+    kUnsignedGreater,
+    kUnsignedGreaterEqual,
+  };
+
+  // Parses the operators of --break_condition_op (eq, ne, slt, sle, sgt, sge,
+  // ult, ule, ugt, uge), case-insensitively.
+  static bool ParseOp(const std::string_view name, Op& op_out);
+  static const char* GetOpName(Op op);
+  // Parses "r<gpr> <op> <hexadecimal value>", with the value compared in full
+  // if it has more than 8 digits, or an empty string for no condition.
+  static bool Parse(const std::string_view text,
+                    BreakpointCondition& condition_out);
+
+  // GPR compared to the value, or -1 to always pass.
+  int32_t gpr = -1;
+  Op op = Op::kEqual;
+  uint64_t value = 0;
+  // Whether only the lower 32 bits are compared.
+  bool truncate = true;
+};
+
+// A conditional guest breakpoint or a tracepoint compiled into the code of the
+// functions containing it, registered by Processor::AddBreakpoint. Owned by the
+// processor and never destroyed, as the code checking it may still be running
+// after the breakpoint has been removed.
+struct CompiledBreakpoint {
+  uint32_t guest_address;
+  BreakpointCondition condition;
+  bool is_tracepoint;
+  // Builtin called by the generated code when the condition passes.
+  Function* hit_function = nullptr;
+  // Whether the breakpoint is installed - the code is only translated again
+  // when the breakpoint is added or removed, not when it's suspended.
+  std::atomic<bool> armed = {false};
+  std::atomic<uint64_t> hit_count = {0};
+};
+
 class Breakpoint {
  public:
   enum class AddressType {
@@ -26,6 +77,13 @@ class Breakpoint {
 
   Breakpoint(Processor* processor, AddressType address_type, uint64_t address,
              HitCallback hit_callback);
+  // A guest breakpoint stopping only if the condition passes, or a tracepoint
+  // recording the registers to the processor's tracepoint hit buffer without
+  // stopping (the hit callback is not called for tracepoints). Either is
+  // checked inline by the guest code (see CompiledBreakpoint).
+  Breakpoint(Processor* processor, uint32_t guest_address,
+             const BreakpointCondition& condition, bool is_tracepoint,
+             HitCallback hit_callback);
   ~Breakpoint();
 
   AddressType address_type() const { return address_type_; }
@@ -39,6 +97,20 @@ class Breakpoint {
     return static_cast<uintptr_t>(address_);
   }
 
+  const BreakpointCondition& condition() const { return condition_; }
+  bool is_tracepoint() const { return is_tracepoint_; }
+  // Whether the breakpoint is checked by the generated code rather than
+  // patched into it as a trap.
+  bool is_compiled() const {
+    return address_type_ == AddressType::kGuest &&
+           (condition_.gpr >= 0 || is_tracepoint_);
+  }
+  // The number of times the condition has passed, for compiled breakpoints.
+  uint64_t hit_count() const {
+    return compiled_ ? compiled_->hit_count.load(std::memory_order_relaxed)
+                     : 0;
+  }
+
   // Whether the breakpoint has been enabled by the user.
   bool is_enabled() const { return enabled_; }
 
@@ -124,6 +196,11 @@ class Breakpoint {
   AddressType address_type_;
   uint64_t address_ = 0;
 
+  BreakpointCondition condition_;
+  bool is_tracepoint_ = false;
+  // Created by the processor when the breakpoint is added for the first time.
+  CompiledBreakpoint* compiled_ = nullptr;
+
   HitCallback hit_callback_;
 
   // Opaque backend data. Don't touch this.
@@ -36,6 +36,7 @@ bool Compiler::Compile(xe::cpu::hir::HIRBuilder* builder) {
     if (!pass->Run(builder)) {
       return false;
     }
+    builder->RecycleRemoved();
   }
 
   return true;
@@ -18,11 +18,15 @@
 #include "xenia/cpu/compiler/passes/control_flow_simplification_pass.h"
 #include "xenia/cpu/compiler/passes/data_flow_analysis_pass.h"
 #include "xenia/cpu/compiler/passes/dead_code_elimination_pass.h"
+#include "xenia/cpu/compiler/passes/dead_store_elimination_pass.h"
 #include "xenia/cpu/compiler/passes/finalization_pass.h"
+#include "xenia/cpu/compiler/passes/inlining_pass.h"
 #include "xenia/cpu/compiler/passes/memory_sequence_combination_pass.h"
 #include "xenia/cpu/compiler/passes/register_allocation_pass.h"
+#include "xenia/cpu/compiler/passes/rounding_mode_elimination_pass.h"
 #include "xenia/cpu/compiler/passes/simplification_pass.h"
 #include "xenia/cpu/compiler/passes/validation_pass.h"
+#include "xenia/cpu/compiler/passes/value_numbering_pass.h"
 #include "xenia/cpu/compiler/passes/value_reduction_pass.h"
 
 #endif  // XENIA_CPU_COMPILER_COMPILER_PASSES_H_
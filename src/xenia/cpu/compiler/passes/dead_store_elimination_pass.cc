@@ -0,0 +1,181 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/compiler/passes/dead_store_elimination_pass.h"
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "xenia/base/cvar.h"
+#include "xenia/base/profiling.h"
+#include "xenia/cpu/compiler/compiler.h"
+#include "xenia/cpu/ppc/ppc_context.h"
+#include "xenia/cpu/processor.h"
+
+DECLARE_bool(debug);
+DECLARE_bool(store_all_context_values);
+
+namespace xe {
+namespace cpu {
+namespace compiler {
+namespace passes {
+
+// TODO(benvanik): remove when enums redefined.
+using namespace xe::cpu::hir;
+
+using xe::cpu::hir::Block;
+using xe::cpu::hir::HIRBuilder;
+using xe::cpu::hir::Instr;
+
+namespace {
+constexpr size_t kContextSize = sizeof(ppc::PPCContext);
+constexpr size_t kExitBlock = SIZE_MAX;
+
+// Whether the instruction may read the context in ways other than
+// LOAD_CONTEXT - calls, returns, traps, and anything else volatile except for
+// conditional branches, which are only volatile for the values within blocks.
+bool IsContextBarrier(const Instr* i) {
+  if (i->opcode == &OPCODE_BRANCH_TRUE_info ||
+      i->opcode == &OPCODE_BRANCH_FALSE_info) {
+    return false;
+  }
+  return (i->opcode->flags & OPCODE_FLAG_VOLATILE) ||
+         i->opcode == &OPCODE_CONTEXT_BARRIER_info;
+}
+}  // namespace
+
+DeadStoreEliminationPass::DeadStoreEliminationPass() : CompilerPass() {}
+
+DeadStoreEliminationPass::~DeadStoreEliminationPass() {}
+
+bool DeadStoreEliminationPass::Run(HIRBuilder* builder) {
+  // Stores are needed to recover register values when debugging.
+  if (cvars::debug || cvars::store_all_context_values) {
+    return true;
+  }
+
+  // Gather the CFG. Not relying on the edges from ControlFlowAnalysisPass as
+  // they may be outdated after simplification, and don't include
+  // fall-through.
+  block_infos_.clear();
+  std::unordered_map<const Block*, size_t> block_indices;
+  for (auto block = builder->first_block(); block; block = block->next) {
+    block_indices.emplace(block, block_infos_.size());
+    BlockInfo& block_info = block_infos_.emplace_back();
+    block_info.block = block;
+    block_info.live_out.resize(uint32_t(kContextSize));
+    block_info.live_in.resize(uint32_t(kContextSize));
+  }
+  for (BlockInfo& block_info : block_infos_) {
+    Block* block = block_info.block;
+    bool falls_through = true;
+    for (auto i = block->instr_head; i; i = i->next) {
+      const Label* target = nullptr;
+      if (i->opcode == &OPCODE_BRANCH_info) {
+        target = i->src1.label;
+        falls_through = false;
+      } else if (i->opcode == &OPCODE_BRANCH_TRUE_info ||
+                 i->opcode == &OPCODE_BRANCH_FALSE_info) {
+        target = i->src2.label;
+      } else if (i->opcode == &OPCODE_RETURN_info) {
+        block_info.successors.push_back(kExitBlock);
+        falls_through = false;
+      }
+      if (target) {
+        block_info.successors.push_back(block_indices[target->block]);
+      }
+      if (!falls_through) {
+        // Anything after an unconditional branch is unreachable.
+        break;
+      }
+    }
+    if (falls_through) {
+      block_info.successors.push_back(
+          block->next ? block_indices[block->next] : kExitBlock);
+    }
+  }
+
+  // Backward data flow analysis of which context bytes may be read later,
+  // iterating until nothing changes. Everything is live when leaving the
+  // function.
+  llvm::BitVector live(static_cast<uint32_t>(kContextSize));
+  bool changed;
+  do {
+    changed = false;
+    for (auto it = block_infos_.rbegin(); it != block_infos_.rend(); ++it) {
+      BlockInfo& block_info = *it;
+      live.reset();
+      for (size_t successor : block_info.successors) {
+        if (successor == kExitBlock) {
+          live.set();
+          break;
+        }
+        live |= block_infos_[successor].live_in;
+      }
+      block_info.live_out = live;
+      ProcessBlock(block_info, false, live);
+      if (live != block_info.live_in) {
+        block_info.live_in = live;
+        changed = true;
+      }
+    }
+  } while (changed);
+
+  for (BlockInfo& block_info : block_infos_) {
+    live = block_info.live_out;
+    ProcessBlock(block_info, true, live);
+  }
+
+  block_infos_.clear();
+  return true;
+}
+
+void DeadStoreEliminationPass::ProcessBlock(BlockInfo& block_info,
+                                            bool remove_dead_stores,
+                                            llvm::BitVector& live) {
+  Instr* i = block_info.block->instr_tail;
+  while (i) {
+    Instr* prev = i->prev;
+    if (IsContextBarrier(i)) {
+      live.set();
+    } else if (i->opcode == &OPCODE_LOAD_CONTEXT_info) {
+      size_t offset = i->src1.offset;
+      size_t size = GetTypeSize(i->dest->type);
+      if (offset + size <= kContextSize) {
+        live.set(uint32_t(offset), uint32_t(offset + size));
+      } else {
+        live.set();
+      }
+    } else if (i->opcode == &OPCODE_STORE_CONTEXT_info) {
+      size_t offset = i->src1.offset;
+      size_t size = GetTypeSize(i->src2.value->type);
+      if (offset + size <= kContextSize) {
+        bool is_live = false;
+        for (size_t byte = offset; byte < offset + size; ++byte) {
+          if (live.test(uint32_t(byte))) {
+            is_live = true;
+            break;
+          }
+        }
+        if (!is_live && remove_dead_stores) {
+          i->Remove();
+        } else {
+          // Only fully overwritten bytes are dead before the store.
+          live.reset(uint32_t(offset), uint32_t(offset + size));
+        }
+      }
+    }
+    i = prev;
+  }
+}
+
+}  // namespace passes
+}  // namespace compiler
+}  // namespace cpu
+}  // namespace xe
@@ -0,0 +1,67 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_CPU_COMPILER_PASSES_DEAD_STORE_ELIMINATION_PASS_H_
+#define XENIA_CPU_COMPILER_PASSES_DEAD_STORE_ELIMINATION_PASS_H_
+
+#include <vector>
+
+#include "xenia/base/platform.h"
+#include "xenia/cpu/compiler/compiler_pass.h"
+
+#if XE_COMPILER_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#include <llvm/ADT/BitVector.h>
+#pragma warning(pop)
+#else
+#include <llvm/ADT/BitVector.h>
+#endif  // XE_COMPILER_MSVC
+
+namespace xe {
+namespace cpu {
+namespace compiler {
+namespace passes {
+
+// Removes context stores that are overwritten on every path before the
+// context is read again, across blocks. ContextPromotionPass only handles
+// stores that are overwritten later in the same block.
+class DeadStoreEliminationPass : public CompilerPass {
+ public:
+  DeadStoreEliminationPass();
+  ~DeadStoreEliminationPass() override;
+
+  bool Run(hir::HIRBuilder* builder) override;
+
+ private:
+  struct BlockInfo {
+    hir::Block* block;
+    // Indices in block_infos_, or SIZE_MAX for leaving the function.
+    std::vector<size_t> successors;
+    // Context bytes that may be read after the end of the block.
+    llvm::BitVector live_out;
+    llvm::BitVector live_in;
+  };
+
+  // Walks the block backwards, updating live from the bytes live at the end
+  // of the block to those live at its beginning, optionally removing dead
+  // stores.
+  void ProcessBlock(BlockInfo& block_info, bool remove_dead_stores,
+                    llvm::BitVector& live);
+
+  std::vector<BlockInfo> block_infos_;
+};
+
+}  // namespace passes
+}  // namespace compiler
+}  // namespace cpu
+}  // namespace xe
+
+#endif  // XENIA_CPU_COMPILER_PASSES_DEAD_STORE_ELIMINATION_PASS_H_
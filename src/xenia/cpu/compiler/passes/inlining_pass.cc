@@ -0,0 +1,154 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/compiler/passes/inlining_pass.h"
+
+#include <algorithm>
+
+#include "xenia/base/cvar.h"
+#include "xenia/base/profiling.h"
+#include "xenia/cpu/compiler/compiler.h"
+#include "xenia/cpu/processor.h"
+
+DECLARE_bool(debug);
+
+DEFINE_uint32(inline_max_instructions, 24,
+              "Maximum size of guest leaf functions to inline into callers, "
+              "in instructions. 0 to disable inlining.",
+              "CPU");
+DEFINE_uint32(inline_max_total_instructions, 256,
+              "Maximum number of guest instructions inlined into a single "
+              "function.",
+              "CPU");
+DEFINE_uint32(trace_max_instructions, 128,
+              "Maximum size of hot guest functions to merge into hot callers "
+              "tail calling them, with their calls and branches to other "
+              "functions becoming side exits of the trace, in instructions. "
+              "Functions are only known to be hot with --tiered_compilation. "
+              "0 to disable trace formation.",
+              "CPU");
+
+namespace xe {
+namespace cpu {
+namespace compiler {
+namespace passes {
+
+// TODO(benvanik): remove when enums redefined.
+using namespace xe::cpu::hir;
+
+using xe::cpu::hir::Block;
+using xe::cpu::hir::HIRBuilder;
+using xe::cpu::hir::Instr;
+using xe::cpu::hir::Label;
+
+namespace {
+// Maximum number of functions chained into a trace after the caller.
+constexpr uint32_t kMaxTraceLength = 4;
+}  // namespace
+
+InliningPass::InliningPass() : CompilerPass() {}
+
+InliningPass::~InliningPass() {}
+
+bool InliningPass::Run(HIRBuilder* builder) {
+  // Breakpoints and stepping within inlined code are not possible.
+  if (cvars::debug || !cvars::inline_max_instructions) {
+    return true;
+  }
+
+  // Traces are only formed from the profile gathered by the baseline code.
+  bool form_traces =
+      cvars::trace_max_instructions && processor_->tiered_compilation();
+
+  // Gather the calls beforehand, as inlined code is appended to the function,
+  // with the calls in the inlined code gathered after inlining it.
+  calls_.clear();
+  GatherCalls(builder->first_block(), 0);
+
+  uint32_t total_instruction_count = 0;
+  for (size_t call_index = 0; call_index < calls_.size(); ++call_index) {
+    Instr* call = calls_[call_index].call;
+    uint32_t depth = calls_[call_index].depth;
+    Function* callee = call->src1.symbol;
+    bool is_tail_call = (call->flags & CALL_TAIL) != 0;
+    // Hot functions tail called by the hot function being optimized are
+    // merged into it as a trace, like leaf functions, but may exit it.
+    bool is_trace = form_traces && is_tail_call && callee &&
+                    callee->is_guest() && depth < kMaxTraceLength &&
+                    static_cast<GuestFunction*>(callee)
+                        ->optimization_requested();
+    uint32_t max_instruction_count = cvars::inline_max_instructions;
+    if (is_trace) {
+      max_instruction_count =
+          std::max(max_instruction_count, cvars::trace_max_instructions);
+    }
+    // Check the size before letting the frontend scan the code.
+    if (!callee || !callee->has_end_address() ||
+        (callee->end_address() - callee->address()) / 4 + 1 >
+            max_instruction_count) {
+      continue;
+    }
+    uint32_t instruction_count =
+        builder->GetInlinableInstructionCount(callee, is_tail_call, is_trace);
+    if (!instruction_count || total_instruction_count + instruction_count >
+                                  cvars::inline_max_total_instructions) {
+      continue;
+    }
+
+    // The source offset of the branch instruction precedes the call in the
+    // same block.
+    uint32_t call_address = 0;
+    for (auto i = call->prev; i; i = i->prev) {
+      if (i->opcode == &OPCODE_SOURCE_OFFSET_info) {
+        call_address = uint32_t(i->src1.offset);
+        break;
+      }
+    }
+    if (!call_address) {
+      continue;
+    }
+
+    // Non-tail calls continue after the call, tail calls return from the
+    // function from within the inlined code.
+    Label* return_label = nullptr;
+    if (!is_tail_call) {
+      return_label = builder->NewLabel();
+      builder->InsertLabel(return_label, call);
+    }
+    Label* entry_label = builder->NewLabel();
+    call->Replace(&OPCODE_BRANCH_info, 0);
+    call->src1.label = entry_label;
+    Block* last_block = builder->last_block();
+    builder->EmitInlined(callee, call_address, entry_label, return_label);
+    // Continue the trace through the calls in the inlined code.
+    GatherCalls(last_block->next, depth + 1);
+
+    total_instruction_count += instruction_count;
+    builder->set_attributes(builder->attributes() |
+                            FUNCTION_ATTRIB_HAS_INLINED_CALLS);
+  }
+  calls_.clear();
+
+  return true;
+}
+
+void InliningPass::GatherCalls(Block* first_block, uint32_t depth) {
+  for (auto block = first_block; block; block = block->next) {
+    for (auto i = block->instr_head; i; i = i->next) {
+      if (i->opcode == &OPCODE_CALL_info) {
+        calls_.push_back({i, depth});
+      }
+    }
+  }
+}
+
+}  // namespace passes
+}  // namespace compiler
+}  // namespace cpu
+}  // namespace xe
@@ -0,0 +1,62 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_CPU_COMPILER_PASSES_INLINING_PASS_H_
+#define XENIA_CPU_COMPILER_PASSES_INLINING_PASS_H_
+
+#include <vector>
+
+#include "xenia/cpu/compiler/compiler_pass.h"
+
+namespace xe {
+namespace cpu {
+namespace compiler {
+namespace passes {
+
+// Replaces direct calls to small guest leaf functions with their code. The
+// frontend decides which functions can be inlined and emits their body at the
+// end of the HIR - this pass only selects the calls within the size budget and
+// links the inlined code into the control flow.
+//
+// LR is still set by the call sequence as usual, and inlined code has the
+// guest address of the call instruction, so it's seen as the call site by the
+// stack walker and exception handling. Must run before control flow analysis.
+//
+// With --tiered_compilation, hot chains of functions are also merged into
+// traces - hot functions tail called by the hot function being optimized are
+// inlined even if they have calls and branches to other functions, which stay
+// calls and tail calls acting as the side exits of the trace, and the tail
+// calls in the inlined code are followed up to a few functions. Modifying the
+// code of any of them invalidates the trace along with the function (see
+// GuestFunction::inlined_functions).
+class InliningPass : public CompilerPass {
+ public:
+  InliningPass();
+  ~InliningPass() override;
+
+  bool Run(hir::HIRBuilder* builder) override;
+
+ private:
+  struct Call {
+    hir::Instr* call;
+    // Number of inlined functions the call is nested in.
+    uint32_t depth;
+  };
+
+  void GatherCalls(hir::Block* first_block, uint32_t depth);
+
+  std::vector<Call> calls_;
+};
+
+}  // namespace passes
+}  // namespace compiler
+}  // namespace cpu
+}  // namespace xe
+
+#endif  // XENIA_CPU_COMPILER_PASSES_INLINING_PASS_H_
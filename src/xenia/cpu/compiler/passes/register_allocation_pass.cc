@@ -11,11 +11,15 @@
 
 #include <algorithm>
 #include <cstring>
+#include <map>
+#include <unordered_set>
+#include <utility>
 
 #include "xenia/base/assert.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
 #include "xenia/base/profiling.h"
+#include "xenia/cpu/cpu_flags.h"
 
 namespace xe {
 namespace cpu {
@@ -26,8 +30,10 @@ namespace passes {
 using namespace xe::cpu::hir;
 
 using xe::cpu::backend::MachineInfo;
+using xe::cpu::hir::Block;
 using xe::cpu::hir::HIRBuilder;
 using xe::cpu::hir::Instr;
+using xe::cpu::hir::Label;
 using xe::cpu::hir::OpcodeSignatureType;
 using xe::cpu::hir::RegAssignment;
 using xe::cpu::hir::TypeName;
@@ -35,8 +41,9 @@ using xe::cpu::hir::Value;
 
 #define ASSERT_NO_CYCLES 0
 
-RegisterAllocationPass::RegisterAllocationPass(const MachineInfo* machine_info)
-    : CompilerPass() {
+RegisterAllocationPass::RegisterAllocationPass(const MachineInfo* machine_info,
+                                               bool allocate_loop_registers)
+    : CompilerPass(), allocate_loop_registers_(allocate_loop_registers) {
   // Initialize register sets.
   // TODO(benvanik): rewrite in a way that makes sense - this is terrible.
   auto mi_sets = machine_info->register_sets;
@@ -77,6 +84,13 @@ bool RegisterAllocationPass::Run(HIRBuilder* builder) {
   // Really, it'd just be nice to have someone who knew what they
   // were doing lower SSA and do this right.
 
+  // Values kept in registers across blocks of loops. Blocks are only
+  // appended, so the ordinals are the same as below.
+  reserved_registers_.clear();
+  if (allocate_loop_registers_) {
+    AllocateLoopRegisters(builder);
+  }
+
   uint16_t block_ordinal = 0;
   uint32_t instr_ordinal = 0;
   auto block = builder->first_block();
@@ -85,7 +99,7 @@ bool RegisterAllocationPass::Run(HIRBuilder* builder) {
     block->ordinal = block_ordinal++;
 
     // Reset all state.
-    PrepareBlockState();
+    PrepareBlockState(block);
 
     // Renumber all instructions in the block. This is required so that
     // we can sort the usage pointers below.
@@ -125,7 +139,11 @@ bool RegisterAllocationPass::Run(HIRBuilder* builder) {
         }
       }
 
-      if (GET_OPCODE_SIG_TYPE_DEST(signature) == OPCODE_SIG_TYPE_V) {
+      if (GET_OPCODE_SIG_TYPE_DEST(signature) == OPCODE_SIG_TYPE_V &&
+          (instr->dest->flags & VALUE_IS_LOOP_REGISTER)) {
+        // Allocated beforehand for the whole loop.
+        assert_not_null(instr->dest->reg.set);
+      } else if (GET_OPCODE_SIG_TYPE_DEST(signature) == OPCODE_SIG_TYPE_V) {
         // Must not have been set already.
         assert_null(instr->dest->reg.set);
 
@@ -173,6 +191,571 @@ bool RegisterAllocationPass::Run(HIRBuilder* builder) {
   return true;
 }
 
+namespace {
+// Whether control never falls through from the end of the block.
+bool IsBlockTerminated(const Block* block) {
+  const Instr* tail = block->instr_tail;
+  if (!tail) {
+    return false;
+  }
+  if (tail->opcode == &OPCODE_CALL_info ||
+      tail->opcode == &OPCODE_CALL_INDIRECT_info) {
+    return (tail->flags & CALL_TAIL) != 0;
+  }
+  return tail->opcode == &OPCODE_BRANCH_info ||
+         tail->opcode == &OPCODE_RETURN_info;
+}
+
+// Returns the label of the branch target, or null if not a branch.
+Label** GetBranchTargetLabel(Instr* instr) {
+  if (instr->opcode == &OPCODE_BRANCH_info) {
+    return &instr->src1.label;
+  }
+  if (instr->opcode == &OPCODE_BRANCH_TRUE_info ||
+      instr->opcode == &OPCODE_BRANCH_FALSE_info) {
+    return &instr->src2.label;
+  }
+  return nullptr;
+}
+
+// Keeping enough registers for the values within the blocks.
+constexpr uint32_t kLoopRegisterFraction = 3;
+
+// Whether the instruction can be executed once before the loop instead of in
+// every iteration if its operands don't change in the loop. It may also be
+// executed when the original one was conditional, so it must not fault.
+bool IsHoistable(const Instr* instr) {
+  if (instr->opcode->flags &
+      (OPCODE_FLAG_BRANCH | OPCODE_FLAG_MEMORY | OPCODE_FLAG_VOLATILE |
+       OPCODE_FLAG_PAIRED_PREV)) {
+    return false;
+  }
+  // The paired instruction reads the host state set by this one.
+  if (instr->next && (instr->next->opcode->flags & OPCODE_FLAG_PAIRED_PREV)) {
+    return false;
+  }
+  switch (instr->opcode->num) {
+    case OPCODE_ASSIGN:
+    case OPCODE_LOAD_CLOCK:
+    case OPCODE_LOAD_LOCAL:
+    case OPCODE_LOAD_CONTEXT:
+    // Integer division by zero faults on x64.
+    case OPCODE_DIV:
+      return false;
+    default:
+      return true;
+  }
+}
+
+// Whether the vector operands of the instruction are plain data that the
+// backend accepts in registers as well as constants, without special
+// sequences for specific constants like for shift amounts and permutations.
+bool HasVectorDataOperands(const Instr* instr) {
+  switch (instr->opcode->num) {
+    case OPCODE_ADD:
+    case OPCODE_SUB:
+    case OPCODE_MUL:
+    case OPCODE_MUL_ADD:
+    case OPCODE_MUL_SUB:
+    case OPCODE_MAX:
+    case OPCODE_MIN:
+    case OPCODE_VECTOR_MAX:
+    case OPCODE_VECTOR_MIN:
+    case OPCODE_VECTOR_ADD:
+    case OPCODE_VECTOR_SUB:
+    case OPCODE_VECTOR_COMPARE_EQ:
+    case OPCODE_VECTOR_COMPARE_SGT:
+    case OPCODE_VECTOR_COMPARE_SGE:
+    case OPCODE_VECTOR_COMPARE_UGT:
+    case OPCODE_VECTOR_COMPARE_UGE:
+    case OPCODE_SELECT:
+    case OPCODE_DOT_PRODUCT_3:
+    case OPCODE_DOT_PRODUCT_4:
+    case OPCODE_AND:
+    case OPCODE_AND_NOT:
+    case OPCODE_OR:
+    case OPCODE_XOR:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Zeros and ones are generated in the register without a memory access.
+bool IsCostlyVectorConstant(const Value* value) {
+  const vec128_t& v = value->constant.v128;
+  return (v.low || v.high) &&
+         (v.low != ~uint64_t(0) || v.high != ~uint64_t(0));
+}
+}  // namespace
+
+void RegisterAllocationPass::AllocateLoopRegisters(HIRBuilder* builder) {
+  loop_blocks_.clear();
+  for (auto block = builder->first_block(); block; block = block->next) {
+    if (loop_blocks_.size() >= UINT16_MAX) {
+      return;
+    }
+    block->ordinal = uint16_t(loop_blocks_.size());
+    loop_blocks_.push_back(block);
+  }
+  uint32_t block_count = uint32_t(loop_blocks_.size());
+
+  std::vector<Loop> loops;
+  for (Block* block : loop_blocks_) {
+    Loop loop;
+    if (FindLoop(block, block_count, loop)) {
+      loops.push_back(std::move(loop));
+    }
+  }
+  if (loops.empty()) {
+    return;
+  }
+
+  // Innermost loops first, where the values are accessed the most often.
+  // Registers are reserved for the whole loop, so the outer loops containing
+  // them are skipped.
+  std::stable_sort(loops.begin(), loops.end(),
+                   [](const Loop& a, const Loop& b) {
+                     return a.body.count() < b.body.count();
+                   });
+  reserved_registers_.resize(block_count * xe::countof(usage_sets_.all_sets));
+  llvm::BitVector promoted_blocks(block_count);
+  for (const Loop& loop : loops) {
+    if (promoted_blocks.anyCommon(loop.body)) {
+      continue;
+    }
+    if (PromoteLoop(builder, loop)) {
+      promoted_blocks |= loop.body;
+    }
+  }
+}
+
+bool RegisterAllocationPass::FindLoop(Block* header, uint32_t block_count,
+                                      Loop& loop_out) {
+  // The function entry is entered from outside of any loop.
+  if (!header->ordinal || !header->label_head) {
+    return false;
+  }
+  // Control can't fall through into the header, so all entries are branches
+  // that can be redirected.
+  if (!IsBlockTerminated(header->prev)) {
+    return false;
+  }
+
+  // Back edges, and the natural loop - everything reaching them without
+  // passing through the header.
+  loop_out.header = header;
+  loop_out.body.clear();
+  loop_out.body.resize(block_count);
+  std::vector<Block*> worklist;
+  for (auto edge = header->incoming_edge_head; edge;
+       edge = edge->incoming_next) {
+    if (edge->src->ordinal >= header->ordinal &&
+        !loop_out.body.test(edge->src->ordinal)) {
+      loop_out.body.set(edge->src->ordinal);
+      worklist.push_back(edge->src);
+    }
+  }
+  if (worklist.empty()) {
+    return false;
+  }
+  loop_out.body.set(header->ordinal);
+  while (!worklist.empty()) {
+    Block* block = worklist.back();
+    worklist.pop_back();
+    if (block == header) {
+      continue;
+    }
+    for (auto edge = block->incoming_edge_head; edge;
+         edge = edge->incoming_next) {
+      if (!loop_out.body.test(edge->src->ordinal)) {
+        loop_out.body.set(edge->src->ordinal);
+        worklist.push_back(edge->src);
+      }
+    }
+  }
+  // Reaching the function entry means the loop can be entered not only through
+  // the header.
+  if (loop_out.body.test(0)) {
+    return false;
+  }
+
+  for (int i = loop_out.body.find_first(); i >= 0;
+       i = loop_out.body.find_next(i)) {
+    Block* block = loop_blocks_[i];
+    // All exits must be branches, to store the values when leaving.
+    if (!block->instr_tail || block->instr_tail->opcode != &OPCODE_BRANCH_info) {
+      return false;
+    }
+    for (auto instr = block->instr_head; instr; instr = instr->next) {
+      // Calls (which don't preserve the registers), anything that may access
+      // the context from outside the function, or leave it.
+      if (instr->opcode == &OPCODE_CONTEXT_BARRIER_info ||
+          ((instr->opcode->flags & OPCODE_FLAG_VOLATILE) &&
+           instr->opcode != &OPCODE_BRANCH_TRUE_info &&
+           instr->opcode != &OPCODE_BRANCH_FALSE_info)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool RegisterAllocationPass::IsInLoop(const Loop& loop,
+                                      const Block* block) const {
+  // Blocks created for other loops are not in loop_blocks_.
+  return block->ordinal < loop_blocks_.size() &&
+         loop_blocks_[block->ordinal] == block &&
+         loop.body.test(block->ordinal);
+}
+
+bool RegisterAllocationPass::PromoteLoop(HIRBuilder* builder,
+                                         const Loop& loop) {
+  // Gather the context slots accessed in the loop, each accessed with one
+  // type, and not overlapping any other.
+  std::map<uint32_t, LoopContextSlot> slots;
+  for (int i = loop.body.find_first(); i >= 0; i = loop.body.find_next(i)) {
+    for (auto instr = loop_blocks_[i]->instr_head; instr;
+         instr = instr->next) {
+      TypeName type;
+      bool is_store;
+      if (instr->opcode == &OPCODE_LOAD_CONTEXT_info) {
+        type = instr->dest->type;
+        is_store = false;
+      } else if (instr->opcode == &OPCODE_STORE_CONTEXT_info) {
+        type = instr->src2.value->type;
+        is_store = true;
+      } else {
+        continue;
+      }
+      auto it = slots.emplace(uint32_t(instr->src1.offset),
+                              LoopContextSlot{type});
+      LoopContextSlot& slot = it.first->second;
+      if (slot.type != type) {
+        slot.is_valid = false;
+      }
+      ++slot.access_count;
+      slot.is_stored |= is_store;
+    }
+  }
+  LoopContextSlot* previous_slot = nullptr;
+  uint32_t previous_end = 0;
+  for (auto& slot_pair : slots) {
+    LoopContextSlot& slot = slot_pair.second;
+    if (previous_slot && slot_pair.first < previous_end) {
+      slot.is_valid = false;
+      previous_slot->is_valid = false;
+    }
+    uint32_t end = slot_pair.first + uint32_t(GetTypeSize(slot.type));
+    if (end > previous_end) {
+      previous_end = end;
+      previous_slot = &slot;
+    }
+  }
+
+  // Pick the most accessed slots in each register set, taking the highest
+  // registers as the allocation within blocks prefers the lowest ones.
+  std::vector<std::pair<uint32_t, LoopContextSlot*>> candidates;
+  for (auto& slot_pair : slots) {
+    if (slot_pair.second.is_valid) {
+      candidates.emplace_back(slot_pair.first, &slot_pair.second);
+    }
+  }
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const auto& a, const auto& b) {
+                     return a.second->access_count > b.second->access_count;
+                   });
+  uint32_t pinned_counts[xe::countof(usage_sets_.all_sets)] = {};
+  uint32_t reserved[xe::countof(usage_sets_.all_sets)] = {};
+  std::vector<std::pair<uint32_t, LoopContextSlot*>> pinned_slots;
+  for (auto& candidate : candidates) {
+    LoopContextSlot& slot = *candidate.second;
+    if (!ReserveLoopRegister(slot.type, pinned_counts, reserved, slot.reg)) {
+      continue;
+    }
+    slot.is_pinned = true;
+    pinned_slots.push_back(candidate);
+  }
+  if (pinned_slots.empty()) {
+    return false;
+  }
+
+  // Preheader loading the values, entered instead of the header from outside
+  // of the loop, including exits of other loops added previously.
+  Label* preheader_label = builder->NewLabel();
+  for (auto block = builder->first_block(); block; block = block->next) {
+    if (IsInLoop(loop, block)) {
+      continue;
+    }
+    for (auto instr = block->instr_tail;
+         instr && (instr->opcode->flags & OPCODE_FLAG_BRANCH);
+         instr = instr->prev) {
+      Label** label = GetBranchTargetLabel(instr);
+      if (label && (*label)->block == loop.header) {
+        *label = preheader_label;
+      }
+    }
+  }
+  builder->MarkLabel(preheader_label);
+  for (auto& pinned_slot : pinned_slots) {
+    LoopContextSlot& slot = *pinned_slot.second;
+    slot.value = builder->LoadContext(pinned_slot.first, slot.type);
+    slot.value->flags |= VALUE_IS_LOOP_REGISTER;
+    slot.value->reg = slot.reg;
+  }
+
+  // Replace the accesses within the loop.
+  for (int i = loop.body.find_first(); i >= 0; i = loop.body.find_next(i)) {
+    Block* block = loop_blocks_[i];
+    auto instr = block->instr_head;
+    while (instr) {
+      auto next_instr = instr->next;
+      bool is_load = instr->opcode == &OPCODE_LOAD_CONTEXT_info;
+      if (!is_load && instr->opcode != &OPCODE_STORE_CONTEXT_info) {
+        instr = next_instr;
+        continue;
+      }
+      uint32_t offset = uint32_t(instr->src1.offset);
+      auto it = slots.find(offset);
+      if (it == slots.end() || !it->second.is_pinned) {
+        instr = next_instr;
+        continue;
+      }
+      Value* pinned_value = it->second.value;
+      if (is_load) {
+        bool stored_later = false;
+        for (auto later_instr = instr->next; later_instr;
+             later_instr = later_instr->next) {
+          if (later_instr->opcode == &OPCODE_STORE_CONTEXT_info &&
+              later_instr->src1.offset == offset) {
+            stored_later = true;
+            break;
+          }
+        }
+        if (stored_later) {
+          // Copy, as the register is overwritten while the value is used.
+          instr->Replace(&OPCODE_ASSIGN_info, 0);
+          instr->set_src1(pinned_value);
+        } else {
+          // Use the register directly.
+          Value* value = instr->dest;
+          while (value->use_head) {
+            Instr* use_instr = value->use_head->instr;
+            if (use_instr->src1.value == value) {
+              use_instr->set_src1(pinned_value);
+            }
+            if (use_instr->src2.value == value) {
+              use_instr->set_src2(pinned_value);
+            }
+            if (use_instr->src3.value == value) {
+              use_instr->set_src3(pinned_value);
+            }
+          }
+          instr->Remove();
+        }
+      } else {
+        Value* value = instr->src2.value;
+        instr->Replace(&OPCODE_ASSIGN_info, 0);
+        instr->dest = pinned_value;
+        instr->set_src1(value);
+      }
+      instr = next_instr;
+    }
+  }
+
+  // Computations not depending on the iteration, and vector constants that
+  // are costly to materialize, are kept in the remaining loop registers.
+  std::vector<Instr*> invariant_instrs;
+  if (cvars::hoist_loop_invariants) {
+    FindLoopInvariants(loop, pinned_slots, pinned_counts, reserved,
+                       invariant_instrs);
+    HoistVectorConstants(builder, loop, pinned_counts, reserved);
+  }
+  builder->Branch(loop.header->label_head);
+  Instr* preheader_branch = builder->last_instr();
+  for (Instr* instr : invariant_instrs) {
+    instr->MoveBefore(preheader_branch);
+  }
+
+  // Store modified values when leaving the loop, in blocks between the loop
+  // and each exit target.
+  bool any_stored = false;
+  for (auto& pinned_slot : pinned_slots) {
+    any_stored |= pinned_slot.second->is_stored;
+  }
+  std::map<Block*, Label*> exit_labels;
+  for (int i = any_stored ? loop.body.find_first() : -1; i >= 0;
+       i = loop.body.find_next(i)) {
+    for (auto instr = loop_blocks_[i]->instr_tail;
+         instr && (instr->opcode->flags & OPCODE_FLAG_BRANCH);
+         instr = instr->prev) {
+      Label** label = GetBranchTargetLabel(instr);
+      if (!label) {
+        continue;
+      }
+      Block* target = (*label)->block;
+      if (IsInLoop(loop, target)) {
+        continue;
+      }
+      auto exit_it = exit_labels.find(target);
+      if (exit_it == exit_labels.end()) {
+        Label* exit_label = builder->NewLabel();
+        builder->MarkLabel(exit_label);
+        for (auto& pinned_slot : pinned_slots) {
+          if (pinned_slot.second->is_stored) {
+            builder->StoreContext(pinned_slot.first, pinned_slot.second->value);
+          }
+        }
+        builder->Branch(*label);
+        exit_it = exit_labels.emplace(target, exit_label).first;
+      }
+      *label = exit_it->second;
+    }
+  }
+
+  // Keep the registers for the values in the whole loop.
+  for (int i = loop.body.find_first(); i >= 0; i = loop.body.find_next(i)) {
+    for (size_t j = 0; j < xe::countof(usage_sets_.all_sets); ++j) {
+      reserved_registers_[size_t(i) * xe::countof(usage_sets_.all_sets) + j] |=
+          reserved[j];
+    }
+  }
+  return true;
+}
+
+bool RegisterAllocationPass::ReserveLoopRegister(TypeName type,
+                                                 uint32_t* loop_counts,
+                                                 uint32_t* reserved,
+                                                 RegAssignment& reg_out) {
+  RegisterSetUsage* usage_set = RegisterSetForType(type);
+  size_t set_index = RegisterSetIndex(usage_set);
+  if (loop_counts[set_index] >= usage_set->count / kLoopRegisterFraction) {
+    return false;
+  }
+  reg_out.set = usage_set->set;
+  reg_out.index = int32_t(usage_set->count - 1 - loop_counts[set_index]);
+  ++loop_counts[set_index];
+  reserved[set_index] |= uint32_t(1) << reg_out.index;
+  return true;
+}
+
+void RegisterAllocationPass::FindLoopInvariants(
+    const Loop& loop,
+    const std::vector<std::pair<uint32_t, LoopContextSlot*>>& pinned_slots,
+    uint32_t* loop_counts, uint32_t* reserved,
+    std::vector<Instr*>& invariants_out) {
+  for (int i = loop.body.find_first(); i >= 0; i = loop.body.find_next(i)) {
+    for (auto instr = loop_blocks_[i]->instr_head; instr;
+         instr = instr->next) {
+      // Floating-point results depend on the rounding mode.
+      if (instr->opcode == &OPCODE_SET_ROUNDING_MODE_info) {
+        return;
+      }
+    }
+  }
+
+  // Values of slots not stored in the loop are only defined in the preheader.
+  std::unordered_set<const Value*> invariant_values;
+  for (auto& pinned_slot : pinned_slots) {
+    if (!pinned_slot.second->is_stored) {
+      invariant_values.insert(pinned_slot.second->value);
+    }
+  }
+  auto is_invariant = [&invariant_values](OpcodeSignatureType sig_type,
+                                          const Instr::Op& op) {
+    return sig_type != OPCODE_SIG_TYPE_V || op.value->IsConstant() ||
+           invariant_values.count(op.value);
+  };
+  // Values are defined before their uses within the block, so the operands
+  // of an invariant instruction are hoisted before it.
+  for (int i = loop.body.find_first(); i >= 0; i = loop.body.find_next(i)) {
+    for (auto instr = loop_blocks_[i]->instr_head; instr;
+         instr = instr->next) {
+      if (!instr->dest || !IsHoistable(instr)) {
+        continue;
+      }
+      uint32_t signature = instr->opcode->signature;
+      if (!is_invariant(GET_OPCODE_SIG_TYPE_SRC1(signature), instr->src1) ||
+          !is_invariant(GET_OPCODE_SIG_TYPE_SRC2(signature), instr->src2) ||
+          !is_invariant(GET_OPCODE_SIG_TYPE_SRC3(signature), instr->src3)) {
+        continue;
+      }
+      Value* value = instr->dest;
+      if (!ReserveLoopRegister(value->type, loop_counts, reserved,
+                               value->reg)) {
+        continue;
+      }
+      value->flags |= VALUE_IS_LOOP_REGISTER;
+      invariant_values.insert(value);
+      invariants_out.push_back(instr);
+    }
+  }
+}
+
+void RegisterAllocationPass::HoistVectorConstants(HIRBuilder* builder,
+                                                  const Loop& loop,
+                                                  uint32_t* loop_counts,
+                                                  uint32_t* reserved) {
+  std::map<std::pair<uint64_t, uint64_t>, Value*> constant_values;
+  auto hoist = [&](Value* constant) -> Value* {
+    auto key = std::make_pair(constant->constant.v128.low,
+                              constant->constant.v128.high);
+    auto it = constant_values.find(key);
+    if (it != constant_values.end()) {
+      return it->second;
+    }
+    Value* value = builder->AllocValue(VEC128_TYPE);
+    if (!ReserveLoopRegister(VEC128_TYPE, loop_counts, reserved, value->reg)) {
+      return nullptr;
+    }
+    value->flags |= VALUE_IS_LOOP_REGISTER;
+    // Assign doesn't emit anything for constants.
+    builder->Nop();
+    Instr* assign = builder->last_instr();
+    assign->Replace(&OPCODE_ASSIGN_info, 0);
+    assign->dest = value;
+    value->def = assign;
+    assign->set_src1(constant);
+    constant_values.emplace(key, value);
+    return value;
+  };
+  for (int i = loop.body.find_first(); i >= 0; i = loop.body.find_next(i)) {
+    for (auto instr = loop_blocks_[i]->instr_head; instr;
+         instr = instr->next) {
+      // Hoisted instructions are executed only once.
+      if (!HasVectorDataOperands(instr) ||
+          (instr->dest->flags & VALUE_IS_LOOP_REGISTER)) {
+        continue;
+      }
+      uint32_t signature = instr->opcode->signature;
+      Value* src1 = instr->src1.value;
+      if (GET_OPCODE_SIG_TYPE_SRC1(signature) == OPCODE_SIG_TYPE_V &&
+          src1->type == VEC128_TYPE && src1->IsConstant() &&
+          IsCostlyVectorConstant(src1)) {
+        if (Value* value = hoist(src1)) {
+          instr->set_src1(value);
+        }
+      }
+      Value* src2 = instr->src2.value;
+      if (GET_OPCODE_SIG_TYPE_SRC2(signature) == OPCODE_SIG_TYPE_V &&
+          src2->type == VEC128_TYPE && src2->IsConstant() &&
+          IsCostlyVectorConstant(src2)) {
+        if (Value* value = hoist(src2)) {
+          instr->set_src2(value);
+        }
+      }
+      Value* src3 = instr->src3.value;
+      if (GET_OPCODE_SIG_TYPE_SRC3(signature) == OPCODE_SIG_TYPE_V &&
+          src3->type == VEC128_TYPE && src3->IsConstant() &&
+          IsCostlyVectorConstant(src3)) {
+        if (Value* value = hoist(src3)) {
+          instr->set_src3(value);
+        }
+      }
+    }
+  }
+}
+
 void RegisterAllocationPass::DumpUsage(const char* name) {
 #if 0
   fprintf(stdout, "\n%s:\n", name);
@@ -195,11 +778,17 @@ void RegisterAllocationPass::DumpUsage(const char* name) {
 #endif
 }
 
-void RegisterAllocationPass::PrepareBlockState() {
+void RegisterAllocationPass::PrepareBlockState(const Block* block) {
+  size_t reserved_index =
+      size_t(block->ordinal) * xe::countof(usage_sets_.all_sets);
   for (size_t i = 0; i < xe::countof(usage_sets_.all_sets); ++i) {
     auto usage_set = usage_sets_.all_sets[i];
     if (usage_set) {
       usage_set->availability.set();
+      if (reserved_index < reserved_registers_.size()) {
+        usage_set->availability &=
+            ~std::bitset<32>(reserved_registers_[reserved_index + i]);
+      }
       usage_set->upcoming_uses.clear();
     }
   }
@@ -473,15 +1062,31 @@ bool RegisterAllocationPass::SpillOneRegister(HIRBuilder* builder, Block* block,
 
 RegisterAllocationPass::RegisterSetUsage*
 RegisterAllocationPass::RegisterSetForValue(const Value* value) {
-  if (value->type <= INT64_TYPE) {
+  return RegisterSetForType(value->type);
+}
+
+RegisterAllocationPass::RegisterSetUsage*
+RegisterAllocationPass::RegisterSetForType(TypeName type) {
+  if (type <= INT64_TYPE) {
     return usage_sets_.int_set;
-  } else if (value->type <= FLOAT64_TYPE) {
+  } else if (type <= FLOAT64_TYPE) {
     return usage_sets_.float_set;
   } else {
     return usage_sets_.vec_set;
   }
 }
 
+size_t RegisterAllocationPass::RegisterSetIndex(
+    const RegisterSetUsage* usage_set) const {
+  for (size_t i = 0; i < xe::countof(usage_sets_.all_sets); ++i) {
+    if (usage_sets_.all_sets[i] == usage_set) {
+      return i;
+    }
+  }
+  assert_always();
+  return 0;
+}
+
 namespace {
 int CompareValueUse(const Value::Use* a, const Value::Use* b) {
   return a->instr->ordinal - b->instr->ordinal;
@@ -13,19 +13,39 @@
 #include <algorithm>
 #include <bitset>
 #include <functional>
+#include <utility>
 #include <vector>
 
+#include "xenia/base/platform.h"
 #include "xenia/cpu/backend/machine_info.h"
 #include "xenia/cpu/compiler/compiler_pass.h"
 
+#if XE_COMPILER_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#include <llvm/ADT/BitVector.h>
+#pragma warning(pop)
+#else
+#include <llvm/ADT/BitVector.h>
+#endif  // XE_COMPILER_MSVC
+
 namespace xe {
 namespace cpu {
 namespace compiler {
 namespace passes {
 
+// With allocate_loop_registers, context values accessed within natural loops
+// are kept in host registers reserved for the whole loop, instead of being
+// loaded and stored in every block of every iteration. With
+// hoist_loop_invariants, the remaining registers reserved for the loop hold
+// the results of computations not depending on the iteration and vector
+// constants, computed once before entering the loop. Requires an up to date
+// CFG from ControlFlowAnalysisPass.
 class RegisterAllocationPass : public CompilerPass {
  public:
-  explicit RegisterAllocationPass(const backend::MachineInfo* machine_info);
+  explicit RegisterAllocationPass(const backend::MachineInfo* machine_info,
+                                  bool allocate_loop_registers = false);
   ~RegisterAllocationPass() override;
 
   bool Run(hir::HIRBuilder* builder) override;
@@ -51,8 +71,46 @@ class RegisterAllocationPass : public CompilerPass {
     std::vector<RegisterUsage> upcoming_uses;
   };
 
+  struct Loop {
+    hir::Block* header;
+    // Block ordinals.
+    llvm::BitVector body;
+  };
+  struct LoopContextSlot {
+    hir::TypeName type;
+    uint32_t access_count = 0;
+    bool is_stored = false;
+    bool is_valid = true;
+    bool is_pinned = false;
+    hir::RegAssignment reg = {};
+    // Defined in the preheader and by every store in the loop.
+    hir::Value* value = nullptr;
+  };
+
+  void AllocateLoopRegisters(hir::HIRBuilder* builder);
+  bool FindLoop(hir::Block* header, uint32_t block_count, Loop& loop_out);
+  bool IsInLoop(const Loop& loop, const hir::Block* block) const;
+  bool PromoteLoop(hir::HIRBuilder* builder, const Loop& loop);
+  // Takes the next of the highest registers of the set for the type if the
+  // loop hasn't used its share yet.
+  bool ReserveLoopRegister(hir::TypeName type, uint32_t* loop_counts,
+                           uint32_t* reserved, hir::RegAssignment& reg_out);
+  // Assigns loop registers to the results of instructions whose operands are
+  // constants, values of slots not stored in the loop, or other invariants,
+  // to be moved to the preheader in the returned order.
+  void FindLoopInvariants(
+      const Loop& loop,
+      const std::vector<std::pair<uint32_t, LoopContextSlot*>>& pinned_slots,
+      uint32_t* loop_counts, uint32_t* reserved,
+      std::vector<hir::Instr*>& invariants_out);
+  // Loads vector constants other than zeros and ones, which would otherwise
+  // be written to the stack and loaded from there for every use, into loop
+  // registers at the end of the preheader being built.
+  void HoistVectorConstants(hir::HIRBuilder* builder, const Loop& loop,
+                            uint32_t* loop_counts, uint32_t* reserved);
+
   void DumpUsage(const char* name);
-  void PrepareBlockState();
+  void PrepareBlockState(const hir::Block* block);
   void AdvanceUses(hir::Instr* instr);
   bool IsRegInUse(const hir::RegAssignment& reg);
   RegisterSetUsage* MarkRegUsed(const hir::RegAssignment& reg,
@@ -66,6 +124,8 @@ class RegisterAllocationPass : public CompilerPass {
                         hir::TypeName required_type);
 
   RegisterSetUsage* RegisterSetForValue(const hir::Value* value);
+  RegisterSetUsage* RegisterSetForType(hir::TypeName type);
+  size_t RegisterSetIndex(const RegisterSetUsage* usage_set) const;
 
   void SortUsageList(hir::Value* value);
 
@@ -76,6 +136,12 @@ class RegisterAllocationPass : public CompilerPass {
     RegisterSetUsage* vec_set = nullptr;
     RegisterSetUsage* all_sets[3];
   } usage_sets_;
+
+  bool allocate_loop_registers_;
+  std::vector<hir::Block*> loop_blocks_;
+  // Registers reserved for loop values in every block, indexed by
+  // block ordinal * countof(all_sets) + register set index.
+  std::vector<uint32_t> reserved_registers_;
 };
 
 }  // namespace passes
@@ -0,0 +1,250 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/compiler/passes/rounding_mode_elimination_pass.h"
+
+#include <unordered_map>
+
+#include "xenia/base/cvar.h"
+#include "xenia/base/profiling.h"
+#include "xenia/cpu/compiler/compiler.h"
+
+DEFINE_bool(eliminate_redundant_rounding_mode_switches, true,
+            "Skip reloading the host floating-point control state where the "
+            "guest rounding mode is known to be unchanged on every path, "
+            "across blocks.",
+            "CPU");
+
+namespace xe {
+namespace cpu {
+namespace compiler {
+namespace passes {
+
+// TODO(benvanik): remove when enums redefined.
+using namespace xe::cpu::hir;
+
+using xe::cpu::hir::Block;
+using xe::cpu::hir::HIRBuilder;
+using xe::cpu::hir::Instr;
+using xe::cpu::hir::Value;
+
+namespace {
+constexpr uint32_t kModeMask = 0x7;
+// Deep enough for the mask and insert sequence emitted by mtfsfi.
+constexpr uint32_t kMaxKnownBitsDepth = 8;
+
+// Whether the instruction may run code changing the host floating-point
+// control state - calls, traps, and anything else volatile except for
+// branches within the function.
+bool IsModeBarrier(const Instr* i) {
+  if (i->opcode == &OPCODE_BRANCH_TRUE_info ||
+      i->opcode == &OPCODE_BRANCH_FALSE_info) {
+    return false;
+  }
+  return (i->opcode->flags & OPCODE_FLAG_VOLATILE) != 0;
+}
+
+// Gathers which of the mode bits of the value are known at translation time,
+// and their values.
+void GetKnownBits(const Value* value, uint32_t depth, uint32_t& known_mask,
+                  uint32_t& known_bits) {
+  known_mask = 0;
+  known_bits = 0;
+  if (value->IsConstant()) {
+    known_mask = kModeMask;
+    known_bits = uint32_t(const_cast<Value*>(value)->AsUint64()) & kModeMask;
+    return;
+  }
+  const Instr* def = value->def;
+  if (!def || depth >= kMaxKnownBitsDepth) {
+    return;
+  }
+  if (def->opcode == &OPCODE_ASSIGN_info ||
+      def->opcode == &OPCODE_TRUNCATE_info ||
+      def->opcode == &OPCODE_ZERO_EXTEND_info ||
+      def->opcode == &OPCODE_SIGN_EXTEND_info) {
+    // The low bits are preserved by all of them.
+    GetKnownBits(def->src1.value, depth + 1, known_mask, known_bits);
+    return;
+  }
+  if (def->opcode != &OPCODE_AND_info && def->opcode != &OPCODE_OR_info &&
+      def->opcode != &OPCODE_XOR_info) {
+    return;
+  }
+  uint32_t mask1, bits1, mask2, bits2;
+  GetKnownBits(def->src1.value, depth + 1, mask1, bits1);
+  GetKnownBits(def->src2.value, depth + 1, mask2, bits2);
+  uint32_t zeros1 = mask1 & ~bits1, zeros2 = mask2 & ~bits2;
+  uint32_t ones1 = mask1 & bits1, ones2 = mask2 & bits2;
+  uint32_t zeros, ones;
+  if (def->opcode == &OPCODE_AND_info) {
+    zeros = zeros1 | zeros2;
+    ones = ones1 & ones2;
+  } else if (def->opcode == &OPCODE_OR_info) {
+    zeros = zeros1 & zeros2;
+    ones = ones1 | ones2;
+  } else {
+    uint32_t both_known = mask1 & mask2;
+    ones = (bits1 ^ bits2) & both_known;
+    zeros = ~(bits1 ^ bits2) & both_known;
+  }
+  known_mask = (zeros | ones) & kModeMask;
+  known_bits = ones & kModeMask;
+}
+}  // namespace
+
+RoundingModeEliminationPass::RoundingModeEliminationPass() : CompilerPass() {}
+
+RoundingModeEliminationPass::~RoundingModeEliminationPass() {}
+
+uint32_t RoundingModeEliminationPass::GetKnownMode(const Value* value) {
+  uint32_t known_mask, known_bits;
+  GetKnownBits(value, 0, known_mask, known_bits);
+  return known_mask == kModeMask ? known_bits : kModeUnknown;
+}
+
+bool RoundingModeEliminationPass::Run(HIRBuilder* builder) {
+  if (!cvars::eliminate_redundant_rounding_mode_switches) {
+    return true;
+  }
+
+  SCOPE_profile_cpu_f("cpu");
+
+  // Nothing to do for the majority of functions not touching the FPSCR.
+  bool has_switches = false;
+  for (auto block = builder->first_block(); block && !has_switches;
+       block = block->next) {
+    for (auto i = block->instr_head; i; i = i->next) {
+      if (i->opcode == &OPCODE_SET_ROUNDING_MODE_info) {
+        has_switches = true;
+        break;
+      }
+    }
+  }
+  if (!has_switches) {
+    return true;
+  }
+
+  // Gather the CFG like DeadStoreEliminationPass, as the edges from
+  // ControlFlowAnalysisPass may be outdated after simplification, and don't
+  // include fall-through.
+  block_infos_.clear();
+  std::unordered_map<const Block*, size_t> block_indices;
+  for (auto block = builder->first_block(); block; block = block->next) {
+    block_indices.emplace(block, block_infos_.size());
+    BlockInfo& block_info = block_infos_.emplace_back();
+    block_info.block = block;
+    block_info.mode_in = kModeUnreached;
+    block_info.mode_out = kModeUnreached;
+  }
+  for (size_t block_index = 0; block_index < block_infos_.size();
+       ++block_index) {
+    Block* block = block_infos_[block_index].block;
+    bool falls_through = true;
+    for (auto i = block->instr_head; i; i = i->next) {
+      const Label* target = nullptr;
+      if (i->opcode == &OPCODE_BRANCH_info) {
+        target = i->src1.label;
+        falls_through = false;
+      } else if (i->opcode == &OPCODE_BRANCH_TRUE_info ||
+                 i->opcode == &OPCODE_BRANCH_FALSE_info) {
+        target = i->src2.label;
+      } else if (i->opcode == &OPCODE_RETURN_info) {
+        falls_through = false;
+      }
+      if (target) {
+        block_infos_[block_indices[target->block]].predecessors.push_back(
+            block_index);
+      }
+      if (!falls_through) {
+        // Anything after an unconditional branch is unreachable.
+        break;
+      }
+    }
+    if (falls_through && block->next) {
+      block_infos_[block_index + 1].predecessors.push_back(block_index);
+    }
+  }
+
+  // Forward data flow analysis of the mode at the beginning of every block,
+  // iterating until nothing changes. The mode is known only if it's the same
+  // on all the incoming paths, and is unknown when entering the function.
+  bool changed;
+  do {
+    changed = false;
+    for (size_t block_index = 0; block_index < block_infos_.size();
+         ++block_index) {
+      BlockInfo& block_info = block_infos_[block_index];
+      uint32_t mode = block_index ? kModeUnreached : kModeUnknown;
+      for (size_t predecessor : block_info.predecessors) {
+        uint32_t predecessor_mode = block_infos_[predecessor].mode_out;
+        if (predecessor_mode == kModeUnreached) {
+          continue;
+        }
+        if (mode == kModeUnreached) {
+          mode = predecessor_mode;
+        } else if (mode != predecessor_mode) {
+          mode = kModeUnknown;
+        }
+      }
+      block_info.mode_in = mode;
+      if (mode == kModeUnreached) {
+        continue;
+      }
+      ProcessBlock(builder, block_info, false, mode);
+      if (mode != block_info.mode_out) {
+        block_info.mode_out = mode;
+        changed = true;
+      }
+    }
+  } while (changed);
+
+  for (BlockInfo& block_info : block_infos_) {
+    uint32_t mode = block_info.mode_in;
+    ProcessBlock(builder, block_info, true, mode);
+  }
+
+  block_infos_.clear();
+  return true;
+}
+
+void RoundingModeEliminationPass::ProcessBlock(HIRBuilder* builder,
+                                               BlockInfo& block_info,
+                                               bool remove_redundant_switches,
+                                               uint32_t& mode) {
+  // Blocks not reachable from the entry aren't assumed to be in any mode.
+  if (mode == kModeUnreached) {
+    mode = kModeUnknown;
+  }
+  Instr* i = block_info.block->instr_head;
+  while (i) {
+    Instr* next = i->next;
+    if (i->opcode == &OPCODE_SET_ROUNDING_MODE_info) {
+      uint32_t new_mode = GetKnownMode(i->src1.value);
+      if (remove_redundant_switches && new_mode != kModeUnknown) {
+        if (new_mode == mode) {
+          i->Remove();
+        } else if (!i->src1.value->IsConstant() &&
+                   i->src1.value->type == INT32_TYPE) {
+          // Select the host state at translation time.
+          i->set_src1(builder->LoadConstantUint32(new_mode));
+        }
+      }
+      mode = new_mode;
+    } else if (IsModeBarrier(i)) {
+      mode = kModeUnknown;
+    }
+    i = next;
+  }
+}
+
+}  // namespace passes
+}  // namespace compiler
+}  // namespace cpu
+}  // namespace xe
@@ -0,0 +1,67 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_CPU_COMPILER_PASSES_ROUNDING_MODE_ELIMINATION_PASS_H_
+#define XENIA_CPU_COMPILER_PASSES_ROUNDING_MODE_ELIMINATION_PASS_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "xenia/cpu/compiler/compiler_pass.h"
+
+namespace xe {
+namespace cpu {
+namespace compiler {
+namespace passes {
+
+// Removes SET_ROUNDING_MODE instructions switching the host floating-point
+// control state to the mode it's already known to be in on every path
+// reaching them, across blocks, and replaces the operands of the remaining
+// ones with constants where the mode is known at translation time. The mode
+// is unknown when entering the function and after anything that may run
+// other code, such as calls.
+class RoundingModeEliminationPass : public CompilerPass {
+ public:
+  RoundingModeEliminationPass();
+  ~RoundingModeEliminationPass() override;
+
+  bool Run(hir::HIRBuilder* builder) override;
+
+ private:
+  // Known rounding modes are the low 3 bits of the FPSCR, 0 to 7.
+  static constexpr uint32_t kModeUnknown = UINT32_MAX;
+  // Not reached yet by the data flow analysis.
+  static constexpr uint32_t kModeUnreached = UINT32_MAX - 1;
+
+  struct BlockInfo {
+    hir::Block* block;
+    // Indices in block_infos_.
+    std::vector<size_t> predecessors;
+    uint32_t mode_in;
+    uint32_t mode_out;
+  };
+
+  // Returns the rounding mode the value selects if all its 3 low bits are
+  // known, or kModeUnknown.
+  static uint32_t GetKnownMode(const hir::Value* value);
+
+  // Walks the block forwards, updating mode from the mode at the beginning of
+  // the block to the mode at its end, optionally removing redundant switches.
+  void ProcessBlock(hir::HIRBuilder* builder, BlockInfo& block_info,
+                    bool remove_redundant_switches, uint32_t& mode);
+
+  std::vector<BlockInfo> block_infos_;
+};
+
+}  // namespace passes
+}  // namespace compiler
+}  // namespace cpu
+}  // namespace xe
+
+#endif  // XENIA_CPU_COMPILER_PASSES_ROUNDING_MODE_ELIMINATION_PASS_H_
@@ -73,7 +73,8 @@ bool ValidationPass::ValidateInstruction(Block* block, Instr* instr) {
     return false;
   }
 
-  if (instr->dest) {
+  // Loop register values are defined and used in multiple blocks.
+  if (instr->dest && !(instr->dest->flags & VALUE_IS_LOOP_REGISTER)) {
     assert_true(instr->dest->def == instr);
     auto use = instr->dest->use_head;
     while (use) {
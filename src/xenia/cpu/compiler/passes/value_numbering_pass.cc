@@ -0,0 +1,220 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/compiler/passes/value_numbering_pass.h"
+
+#include <algorithm>
+#include <tuple>
+
+#include "xenia/base/cvar.h"
+#include "xenia/base/profiling.h"
+#include "xenia/cpu/compiler/compiler.h"
+
+DEFINE_bool(eliminate_redundant_loads, true,
+            "Reuse the values of guest memory loads and stores for later loads "
+            "from the same address in the same block if no other access may "
+            "have modified the memory in between. MMIO accessed through "
+            "non-constant addresses may return a different value every time, "
+            "but is not known at translation time.",
+            "CPU");
+
+namespace xe {
+namespace cpu {
+namespace compiler {
+namespace passes {
+
+// TODO(benvanik): remove when enums redefined.
+using namespace xe::cpu::hir;
+
+using xe::cpu::hir::Block;
+using xe::cpu::hir::HIRBuilder;
+using xe::cpu::hir::Instr;
+using xe::cpu::hir::Value;
+
+namespace {
+enum OperandKind : uint64_t {
+  kOperandNone,
+  kOperandValue,
+  kOperandConstant,
+  kOperandOffset,
+};
+
+// Whether the result of the instruction depends only on its operands.
+bool IsPure(const Instr* i) {
+  if (i->opcode->flags & (OPCODE_FLAG_BRANCH | OPCODE_FLAG_MEMORY |
+                          OPCODE_FLAG_VOLATILE | OPCODE_FLAG_PAIRED_PREV)) {
+    return false;
+  }
+  // The paired instruction reads the host state set by this one.
+  if (i->next && (i->next->opcode->flags & OPCODE_FLAG_PAIRED_PREV)) {
+    return false;
+  }
+  switch (i->opcode->num) {
+    case OPCODE_ASSIGN:
+    case OPCODE_LOAD_CLOCK:
+    case OPCODE_LOAD_LOCAL:
+    case OPCODE_LOAD_CONTEXT:
+      return false;
+    default:
+      return true;
+  }
+}
+
+// Skips assignments, so copies of a value have the same number.
+Value* SkipAssignments(Value* value) {
+  while (value->def && value->def->opcode == &OPCODE_ASSIGN_info) {
+    value = value->def->src1.value;
+  }
+  return value;
+}
+
+bool IsMemoryLoad(const Instr* i) {
+  return i->opcode == &OPCODE_LOAD_info ||
+         i->opcode == &OPCODE_LOAD_OFFSET_info;
+}
+
+bool IsMemoryStore(const Instr* i) {
+  return i->opcode == &OPCODE_STORE_info ||
+         i->opcode == &OPCODE_STORE_OFFSET_info;
+}
+}  // namespace
+
+ValueNumberingPass::ValueNumberingPass() : CompilerPass() {}
+
+ValueNumberingPass::~ValueNumberingPass() {}
+
+bool ValueNumberingPass::Run(HIRBuilder* builder) {
+  SCOPE_profile_cpu_f("cpu");
+
+  for (auto block = builder->first_block(); block; block = block->next) {
+    ProcessBlock(block);
+  }
+  expressions_.clear();
+  return true;
+}
+
+void ValueNumberingPass::ProcessBlock(Block* block) {
+  expressions_.clear();
+  uint64_t memory_version = 0;
+
+  auto make_operand = [](OpcodeSignatureType sig_type, const Instr::Op& op) {
+    Operand operand = {};
+    switch (sig_type) {
+      case OPCODE_SIG_TYPE_X:
+        operand.kind = kOperandNone;
+        break;
+      case OPCODE_SIG_TYPE_V: {
+        Value* value = SkipAssignments(op.value);
+        if (value->IsConstant()) {
+          operand.kind = kOperandConstant | (uint64_t(value->type) << 8);
+          // Only the bits of the type are meaningful.
+          std::memcpy(&operand.low, &value->constant,
+                      std::min(GetTypeSize(value->type), sizeof(uint64_t)));
+          if (value->type == VEC128_TYPE) {
+            operand.high = value->constant.v128.high;
+          }
+        } else {
+          operand.kind = kOperandValue;
+          operand.low = uint64_t(value);
+        }
+      } break;
+      default:
+        // Offsets, symbols and labels.
+        operand.kind = kOperandOffset;
+        operand.low = op.offset;
+        break;
+    }
+    return operand;
+  };
+
+  auto make_key = [&](const Instr* i) {
+    ExpressionKey key;
+    std::memset(&key, 0, sizeof(key));
+    key.opcode = uint64_t(i->opcode);
+    key.flags = i->flags;
+    key.type = uint32_t(i->dest->type);
+    uint32_t signature = i->opcode->signature;
+    key.operands[0] =
+        make_operand(GET_OPCODE_SIG_TYPE_SRC1(signature), i->src1);
+    key.operands[1] =
+        make_operand(GET_OPCODE_SIG_TYPE_SRC2(signature), i->src2);
+    key.operands[2] =
+        make_operand(GET_OPCODE_SIG_TYPE_SRC3(signature), i->src3);
+    if (i->opcode->flags & OPCODE_FLAG_COMMUNATIVE) {
+      Operand& a = key.operands[0];
+      Operand& b = key.operands[1];
+      if (std::tie(a.kind, a.low, a.high) > std::tie(b.kind, b.low, b.high)) {
+        std::swap(a, b);
+      }
+    }
+    return key;
+  };
+
+  for (Instr* i = block->instr_head; i; i = i->next) {
+    if (i->opcode == &OPCODE_SET_ROUNDING_MODE_info) {
+      // Floating-point results depend on the rounding mode.
+      expressions_.clear();
+      continue;
+    }
+
+    bool is_load = IsMemoryLoad(i);
+    if (!is_load &&
+        (i->opcode->flags & (OPCODE_FLAG_MEMORY | OPCODE_FLAG_VOLATILE))) {
+      // Stores, MMIO, cache control, atomics, barriers and calls.
+      ++memory_version;
+    }
+
+    if (IsMemoryStore(i)) {
+      if (cvars::eliminate_redundant_loads) {
+        // A load from the same address with the same byte swapping returns
+        // the stored value until memory is modified again.
+        bool is_offset = i->opcode == &OPCODE_STORE_OFFSET_info;
+        Value* stored_value = is_offset ? i->src3.value : i->src2.value;
+        uint32_t signature = i->opcode->signature;
+        ExpressionKey key;
+        std::memset(&key, 0, sizeof(key));
+        key.opcode = uint64_t(is_offset ? &OPCODE_LOAD_OFFSET_info
+                                        : &OPCODE_LOAD_info);
+        key.flags = i->flags;
+        key.type = uint32_t(stored_value->type);
+        key.memory_version = memory_version;
+        key.operands[0] =
+            make_operand(GET_OPCODE_SIG_TYPE_SRC1(signature), i->src1);
+        if (is_offset) {
+          key.operands[1] =
+              make_operand(GET_OPCODE_SIG_TYPE_SRC2(signature), i->src2);
+        }
+        expressions_[key] = stored_value;
+      }
+      continue;
+    }
+
+    if (!i->dest) {
+      continue;
+    }
+    if (is_load ? !cvars::eliminate_redundant_loads : !IsPure(i)) {
+      continue;
+    }
+    ExpressionKey key = make_key(i);
+    if (is_load) {
+      key.memory_version = memory_version;
+    }
+    auto it = expressions_.emplace(key, i->dest);
+    if (!it.second) {
+      Value* value = it.first->second;
+      i->Replace(&OPCODE_ASSIGN_info, 0);
+      i->set_src1(value);
+    }
+  }
+}
+
+}  // namespace passes
+}  // namespace compiler
+}  // namespace cpu
+}  // namespace xe
@@ -0,0 +1,73 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_CPU_COMPILER_PASSES_VALUE_NUMBERING_PASS_H_
+#define XENIA_CPU_COMPILER_PASSES_VALUE_NUMBERING_PASS_H_
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
+#include "xenia/base/hash.h"
+#include "xenia/cpu/compiler/compiler_pass.h"
+
+namespace xe {
+namespace cpu {
+namespace compiler {
+namespace passes {
+
+// Replaces instructions computing the same value as an earlier instruction in
+// the block, including guest memory loads from the same address with no store
+// or other memory access that may change the memory in between, and loads
+// following a store to the same address, with assignments of the earlier
+// value, to be cleaned up by SimplificationPass. Values are not carried
+// across blocks, as they are not allowed to be used outside the block
+// defining them. Context loads are handled by ContextPromotionPass.
+class ValueNumberingPass : public CompilerPass {
+ public:
+  ValueNumberingPass();
+  ~ValueNumberingPass() override;
+
+  bool Run(hir::HIRBuilder* builder) override;
+
+ private:
+  struct Operand {
+    // Values are identified by the pointer, constants by the type and the
+    // bits, offsets, symbols and labels by the offset or the pointer.
+    uint64_t kind;
+    uint64_t low;
+    uint64_t high;
+  };
+  struct ExpressionKey {
+    uint64_t opcode;
+    uint32_t flags;
+    uint32_t type;
+    // Incremented whenever the guest memory may have been modified, for the
+    // keys of loads.
+    uint64_t memory_version;
+    Operand operands[3];
+
+    bool operator==(const ExpressionKey& key) const {
+      return !std::memcmp(this, &key, sizeof(*this));
+    }
+  };
+
+  void ProcessBlock(hir::Block* block);
+
+  std::unordered_map<ExpressionKey, hir::Value*,
+                     xe::hash::XXHasher<ExpressionKey>>
+      expressions_;
+};
+
+}  // namespace passes
+}  // namespace compiler
+}  // namespace cpu
+}  // namespace xe
+
+#endif  // XENIA_CPU_COMPILER_PASSES_VALUE_NUMBERING_PASS_H_
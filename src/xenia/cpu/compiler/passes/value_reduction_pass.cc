@@ -9,23 +9,14 @@
 
 #include "xenia/cpu/compiler/passes/value_reduction_pass.h"
 
+#include <cmath>
+
 #include "xenia/base/platform.h"
 #include "xenia/base/profiling.h"
 #include "xenia/cpu/backend/backend.h"
 #include "xenia/cpu/compiler/compiler.h"
 #include "xenia/cpu/processor.h"
 
-#if XE_COMPILER_MSVC
-#pragma warning(push)
-#pragma warning(disable : 4244)
-#pragma warning(disable : 4267)
-#include <llvm/ADT/BitVector.h>
-#pragma warning(pop)
-#else
-#include <llvm/ADT/BitVector.h>
-#include <cmath>
-#endif  // XE_COMPILER_MSVC
-
 namespace xe {
 namespace cpu {
 namespace compiler {
@@ -35,6 +26,7 @@ namespace passes {
 using namespace xe::cpu::hir;
 
 using xe::cpu::hir::HIRBuilder;
+using xe::cpu::hir::Instr;
 using xe::cpu::hir::OpcodeInfo;
 using xe::cpu::hir::Value;
 
@@ -59,76 +51,90 @@ void ValueReductionPass::ComputeLastUse(Value* value) {
   value->last_use = last_use ? last_use->instr : nullptr;
 }
 
-bool ValueReductionPass::Run(HIRBuilder* builder) {
-  // Walk each block and reuse variable ordinals as much as possible.
+bool ValueReductionPass::IsBlockLocal(const Value* value) {
+  if (!value->def) {
+    return false;
+  }
+  auto use = value->use_head;
+  while (use) {
+    if (use->instr->block != value->def->block) {
+      return false;
+    }
+    use = use->next;
+  }
+  return true;
+}
 
-  llvm::BitVector ordinals(builder->max_value_ordinal());
+void ValueReductionPass::ReleaseIfLastUse(Value* value, Instr* instr,
+                                          llvm::BitVector& ordinals) {
+  if (value->IsConstant() || !IsBlockLocal(value)) {
+    return;
+  }
+  if (!value->last_use) {
+    ComputeLastUse(value);
+  }
+  if (value->last_use == instr) {
+    // Available.
+    ordinals.reset(value->ordinal);
+  }
+}
 
+bool ValueReductionPass::Run(HIRBuilder* builder) {
+  // Walk each block and reuse variable ordinals as much as possible.
+  // Only values that are defined and used within a single block can share
+  // ordinals - anything live across blocks keeps a unique one.
+
+  // Renumber all instructions globally, so last uses can be compared, and
+  // reserve ordinals for values used outside of the defining block.
+  llvm::BitVector reserved_ordinals(builder->max_value_ordinal());
+  uint32_t next_reserved_ordinal = 0;
+  uint32_t instr_ordinal = 0;
   auto block = builder->first_block();
   while (block) {
-    // Reset used ordinals.
-    ordinals.reset();
-
-    // Renumber all instructions to make liveness tracking easier.
-    uint32_t instr_ordinal = 0;
     auto instr = block->instr_head;
     while (instr) {
       instr->ordinal = instr_ordinal++;
+      if (GET_OPCODE_SIG_TYPE_DEST(instr->opcode->signature) ==
+              OPCODE_SIG_TYPE_V &&
+          !IsBlockLocal(instr->dest)) {
+        reserved_ordinals.set(next_reserved_ordinal);
+        instr->dest->ordinal = next_reserved_ordinal++;
+      }
       instr = instr->next;
     }
+    block = block->next;
+  }
 
-    instr = block->instr_head;
+  llvm::BitVector ordinals(builder->max_value_ordinal());
+  block = builder->first_block();
+  while (block) {
+    // Reset used ordinals to only those live across blocks.
+    ordinals = reserved_ordinals;
+
+    auto instr = block->instr_head;
     while (instr) {
       const OpcodeInfo* info = instr->opcode;
       auto dest_type = GET_OPCODE_SIG_TYPE_DEST(info->signature);
-      auto src1_type = GET_OPCODE_SIG_TYPE_SRC1(info->signature);
-      auto src2_type = GET_OPCODE_SIG_TYPE_SRC2(info->signature);
-      auto src3_type = GET_OPCODE_SIG_TYPE_SRC3(info->signature);
-      if (src1_type == OPCODE_SIG_TYPE_V) {
-        auto v = instr->src1.value;
-        if (!v->last_use) {
-          ComputeLastUse(v);
-        }
-        if (v->last_use == instr) {
-          // Available.
-          if (!instr->src1.value->IsConstant()) {
-            ordinals.reset(v->ordinal);
-          }
-        }
+      if (GET_OPCODE_SIG_TYPE_SRC1(info->signature) == OPCODE_SIG_TYPE_V) {
+        ReleaseIfLastUse(instr->src1.value, instr, ordinals);
       }
-      if (src2_type == OPCODE_SIG_TYPE_V) {
-        auto v = instr->src2.value;
-        if (!v->last_use) {
-          ComputeLastUse(v);
-        }
-        if (v->last_use == instr) {
-          // Available.
-          if (!instr->src2.value->IsConstant()) {
-            ordinals.reset(v->ordinal);
-          }
-        }
+      if (GET_OPCODE_SIG_TYPE_SRC2(info->signature) == OPCODE_SIG_TYPE_V) {
+        ReleaseIfLastUse(instr->src2.value, instr, ordinals);
       }
-      if (src3_type == OPCODE_SIG_TYPE_V) {
-        auto v = instr->src3.value;
-        if (!v->last_use) {
-          ComputeLastUse(v);
-        }
-        if (v->last_use == instr) {
-          // Available.
-          if (!instr->src3.value->IsConstant()) {
-            ordinals.reset(v->ordinal);
-          }
-        }
+      if (GET_OPCODE_SIG_TYPE_SRC3(info->signature) == OPCODE_SIG_TYPE_V) {
+        ReleaseIfLastUse(instr->src3.value, instr, ordinals);
       }
-      if (dest_type == OPCODE_SIG_TYPE_V) {
+      if (dest_type == OPCODE_SIG_TYPE_V && IsBlockLocal(instr->dest)) {
         // Dest values are processed last, as they may be able to reuse a
         // source value ordinal.
         auto v = instr->dest;
         // Find a lower ordinal.
         for (auto n = 0u; n < ordinals.size(); n++) {
           if (!ordinals.test(n)) {
-            ordinals.set(n);
             v->ordinal = n;
+            if (v->use_head) {
+              ordinals.set(n);
+            }
             break;
           }
         }
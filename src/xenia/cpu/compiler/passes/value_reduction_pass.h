@@ -10,8 +10,19 @@
 #ifndef XENIA_CPU_COMPILER_PASSES_VALUE_REDUCTION_PASS_H_
 #define XENIA_CPU_COMPILER_PASSES_VALUE_REDUCTION_PASS_H_
 
+#include "xenia/base/platform.h"
 #include "xenia/cpu/compiler/compiler_pass.h"
 
+#if XE_COMPILER_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#include <llvm/ADT/BitVector.h>
+#pragma warning(pop)
+#else
+#include <llvm/ADT/BitVector.h>
+#endif  // XE_COMPILER_MSVC
+
 namespace xe {
 namespace cpu {
 namespace compiler {
@@ -26,6 +37,10 @@ class ValueReductionPass : public CompilerPass {
 
  private:
   void ComputeLastUse(hir::Value* value);
+  // Whether the value is defined and only used within a single block.
+  static bool IsBlockLocal(const hir::Value* value);
+  void ReleaseIfLastUse(hir::Value* value, hir::Instr* instr,
+                        llvm::BitVector& ordinals);
 };
 
 }  // namespace passes
@@ -38,6 +38,46 @@ DEFINE_bool(
 DEFINE_bool(validate_hir, false,
             "Perform validation checks on the HIR during compilation.", "CPU");
 
+DEFINE_bool(allocate_loop_registers, true,
+            "Keep guest registers accessed in loops without calls in host "
+            "registers for the whole loop.",
+            "CPU");
+DEFINE_bool(hoist_loop_invariants, true,
+            "With --allocate_loop_registers, compute the values not changing "
+            "within loops, such as address bases and constant vectors, once "
+            "before entering the loop. Guest memory is always accessed in "
+            "every iteration, as other threads and devices may modify it.",
+            "CPU");
+
+DEFINE_bool(tiered_compilation, false,
+            "Translate functions quickly with few optimizations first, and "
+            "translate them again with all optimizations in the background "
+            "once they are called or loop often enough.",
+            "CPU");
+DEFINE_uint32(tiered_compilation_threshold, 1000,
+              "Number of calls and loop iterations after which a function is "
+              "optimized with --tiered_compilation.",
+              "CPU");
+DEFINE_bool(invalidate_modified_code, false,
+            "Watch the guest memory pages containing translated code for "
+            "writes, and translate the functions in them again when they are "
+            "called after being modified, for titles loading code overlays or "
+            "patching their code at runtime.",
+            "CPU");
+
+DEFINE_bool(replace_guest_routines, true,
+            "Call host implementations of library routines such as memcpy, "
+            "memset and strlen in guest functions matching their signatures "
+            "from --routine_signatures_path.",
+            "CPU");
+DEFINE_path(routine_signatures_path, "",
+            "Text file with the signatures of guest library routines to "
+            "replace, with a \"<hash> <instruction count> <routine>\" line "
+            "per signature, as logged by --log_routine_signatures. Can be "
+            "specified in the per-game configuration for the routines linked "
+            "into the title.",
+            "CPU");
+
 DEFINE_uint64(
     pvr, 0x710700,
     "Processor version and revision number.\nBits 0 to 15 are the version "
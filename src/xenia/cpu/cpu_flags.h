@@ -26,6 +26,16 @@ DECLARE_bool(disable_global_lock);
 
 DECLARE_bool(validate_hir);
 
+DECLARE_bool(allocate_loop_registers);
+DECLARE_bool(hoist_loop_invariants);
+
+DECLARE_bool(tiered_compilation);
+DECLARE_uint32(tiered_compilation_threshold);
+DECLARE_bool(invalidate_modified_code);
+
+DECLARE_bool(replace_guest_routines);
+DECLARE_path(routine_signatures_path);
+
 DECLARE_uint64(pvr);
 
 // Breakpoints:
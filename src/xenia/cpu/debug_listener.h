@@ -49,6 +49,12 @@ class DebugListener {
   // Breakpoints may be hit during stepping.
   virtual void OnBreakpointHit(Breakpoint* breakpoint,
                                ThreadDebugInfo* thread_info) = 0;
+
+  // Handles a thread being created, exiting, being destroyed, or entering or
+  // leaving a wait, so the thread list can be updated incrementally instead of
+  // querying all threads. Called very frequently on the thread itself with the
+  // processor lock held, so it must be cheap and must not call the processor.
+  virtual void OnThreadStateChanged(ThreadDebugInfo* thread_info) = 0;
 };
 
 }  // namespace cpu
@@ -9,80 +9,158 @@
 
 #include "xenia/cpu/entry_table.h"
 
+#include "xenia/base/assert.h"
 #include "xenia/base/profiling.h"
-#include "xenia/base/threading.h"
+#include "xenia/cpu/function.h"
 
 namespace xe {
 namespace cpu {
 
-EntryTable::EntryTable() = default;
+EntryTable::Submap::Submap(size_t capacity)
+    : capacity(capacity), slots(new std::atomic<Entry*>[capacity]) {
+  for (size_t i = 0; i < capacity; ++i) {
+    slots[i].store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+EntryTable::EntryTable()
+    : root_(std::make_unique<Submap>(kInitialCapacity)), tail_(root_.get()) {}
 
 EntryTable::~EntryTable() {
   auto global_lock = global_critical_region_.Acquire();
-  for (auto it : map_) {
-    Entry* entry = it.second;
-    delete entry;
+  Submap* submap = root_.get();
+  while (submap) {
+    for (size_t i = 0; i < submap->capacity; ++i) {
+      delete submap->slots[i].load(std::memory_order_relaxed);
+    }
+    Submap* next = submap->next.load(std::memory_order_relaxed);
+    if (submap != root_.get()) {
+      delete submap;
+    }
+    submap = next;
   }
 }
 
-Entry* EntryTable::Get(uint32_t address) {
-  auto global_lock = global_critical_region_.Acquire();
-  const auto& it = map_.find(address);
-  Entry* entry = it != map_.end() ? it->second : nullptr;
-  if (entry) {
-    // TODO(benvanik): wait if needed?
-    if (entry->status != Entry::STATUS_READY) {
-      entry = nullptr;
+Entry* EntryTable::FindInSubmap(const Submap& submap, uint32_t address) {
+  size_t mask = submap.capacity - 1;
+  size_t index = HashAddress(address) & mask;
+  while (true) {
+    Entry* entry = submap.slots[index].load(std::memory_order_acquire);
+    if (!entry) {
+      return nullptr;
     }
+    if (entry->address == address) {
+      return entry;
+    }
+    index = (index + 1) & mask;
+  }
+}
+
+Entry* EntryTable::Find(uint32_t address) const {
+  const Submap* submap = root_.get();
+  while (submap) {
+    Entry* entry = FindInSubmap(*submap, address);
+    if (entry) {
+      return entry;
+    }
+    submap = submap->next.load(std::memory_order_acquire);
+  }
+  return nullptr;
+}
+
+Entry* EntryTable::Get(uint32_t address) {
+  Entry* entry = Find(address);
+  if (entry &&
+      entry->status.load(std::memory_order_acquire) != Entry::STATUS_READY) {
+    entry = nullptr;
   }
   return entry;
 }
 
 Entry::Status EntryTable::GetOrCreate(uint32_t address, Entry** out_entry) {
-  // TODO(benvanik): replace with a map with wait-free for find.
-  // https://github.com/facebook/folly/blob/master/folly/AtomicHashMap.h
-
-  auto global_lock = global_critical_region_.Acquire();
-  const auto& it = map_.find(address);
-  Entry* entry = it != map_.end() ? it->second : nullptr;
-  Entry::Status status;
-  if (entry) {
-    // If we aren't ready yet spin and wait.
-    if (entry->status == Entry::STATUS_COMPILING) {
-      // Still compiling, so spin.
-      do {
-        global_lock.unlock();
-        // TODO(benvanik): sleep for less time?
-        xe::threading::Sleep(std::chrono::microseconds(10));
-        global_lock.lock();
-      } while (entry->status == Entry::STATUS_COMPILING);
+  Entry* entry = Find(address);
+  if (!entry) {
+    auto global_lock = global_critical_region_.Acquire();
+    // Another thread may have inserted it while we were taking the lock.
+    entry = Find(address);
+    if (!entry) {
+      // Create and return for initialization.
+      entry = new Entry();
+      entry->address = address;
+      entry->end_address = 0;
+      entry->status.store(Entry::STATUS_COMPILING, std::memory_order_relaxed);
+      entry->function = nullptr;
+      // Keep the load factor at or below 1/2 so probe sequences stay short.
+      if ((tail_->count + 1) * 2 > tail_->capacity) {
+        auto new_submap = new Submap(tail_->capacity * 2);
+        tail_->next.store(new_submap, std::memory_order_release);
+        tail_ = new_submap;
+      }
+      size_t mask = tail_->capacity - 1;
+      size_t index = HashAddress(address) & mask;
+      while (tail_->slots[index].load(std::memory_order_relaxed)) {
+        index = (index + 1) & mask;
+      }
+      tail_->slots[index].store(entry, std::memory_order_release);
+      ++tail_->count;
+      *out_entry = entry;
+      return Entry::STATUS_NEW;
     }
-    status = entry->status;
-  } else {
-    // Create and return for initialization.
-    entry = new Entry();
-    entry->address = address;
-    entry->end_address = 0;
-    entry->status = Entry::STATUS_COMPILING;
-    entry->function = 0;
-    map_[address] = entry;
-    status = Entry::STATUS_NEW;
   }
-  global_lock.unlock();
+
+  Entry::Status status = entry->status.load(std::memory_order_acquire);
+  if (status == Entry::STATUS_COMPILING) {
+    // Still compiling on another thread - park until it's published.
+    SCOPE_profile_cpu_f("cpu");
+    WaitStripe& stripe = GetWaitStripe(address);
+    std::unique_lock<std::mutex> stripe_lock(stripe.mutex);
+    stripe.cond.wait(stripe_lock, [entry, &status]() {
+      status = entry->status.load(std::memory_order_acquire);
+      return status != Entry::STATUS_COMPILING;
+    });
+  }
   *out_entry = entry;
   return status;
 }
 
-std::vector<Function*> EntryTable::FindWithAddress(uint32_t address) {
-  auto global_lock = global_critical_region_.Acquire();
+void EntryTable::Publish(Entry* entry, Entry::Status status) {
+  assert_true(status == Entry::STATUS_READY || status == Entry::STATUS_FAILED);
+  WaitStripe& stripe = GetWaitStripe(entry->address);
+  {
+    // Store under the stripe mutex so a waiter can't miss the wakeup between
+    // checking the status and starting to wait.
+    std::lock_guard<std::mutex> stripe_lock(stripe.mutex);
+    entry->status.store(status, std::memory_order_release);
+  }
+  stripe.cond.notify_all();
+}
+
+std::vector<Function*> EntryTable::FindWithAddress(uint32_t address,
+                                                   bool include_inlining) {
   std::vector<Function*> fns;
-  for (auto& it : map_) {
-    Entry* entry = it.second;
-    if (address >= entry->address && address <= entry->end_address) {
-      if (entry->status == Entry::STATUS_READY) {
+  const Submap* submap = root_.get();
+  while (submap) {
+    for (size_t i = 0; i < submap->capacity; ++i) {
+      Entry* entry = submap->slots[i].load(std::memory_order_acquire);
+      if (!entry ||
+          entry->status.load(std::memory_order_acquire) !=
+              Entry::STATUS_READY) {
+        continue;
+      }
+      if (address >= entry->address && address <= entry->end_address) {
         fns.push_back(entry->function);
+      } else if (include_inlining && entry->function->is_guest()) {
+        for (GuestFunction* inlined_function :
+             static_cast<GuestFunction*>(entry->function)
+                 ->inlined_functions()) {
+          if (inlined_function->ContainsAddress(address)) {
+            fns.push_back(entry->function);
+            break;
+          }
+        }
       }
     }
+    submap = submap->next.load(std::memory_order_acquire);
   }
   return fns;
 }
@@ -10,7 +10,13 @@
 #ifndef XENIA_CPU_ENTRY_TABLE_H_
 #define XENIA_CPU_ENTRY_TABLE_H_
 
-#include <unordered_map>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "xenia/base/mutex.h"
@@ -30,24 +36,76 @@ typedef struct Entry_t {
 
   uint32_t address;
   uint32_t end_address;
-  Status status;
+  // Written once by the thread that created the entry (through
+  // EntryTable::Publish) and read without locking by everyone else.
+  std::atomic<Status> status;
   Function* function;
 } Entry;
 
+// Address -> Entry map optimized for concurrent lookups.
+// Entries are never removed, so the table is a chain of open-addressing
+// submaps (like folly::AtomicHashMap): lookups are wait-free and only
+// insertions take the global critical region. When the newest submap gets too
+// full a twice larger one is appended instead of rehashing, so readers never
+// observe a slot moving.
 class EntryTable {
  public:
   EntryTable();
   ~EntryTable();
 
+  // Returns the entry if it has been compiled successfully, without waiting or
+  // taking any locks.
   Entry* Get(uint32_t address);
+  // Returns STATUS_NEW if the entry was just created - the caller then owns it
+  // and must call Publish once it's done with it. If another thread is
+  // compiling the entry, blocks until it's published.
   Entry::Status GetOrCreate(uint32_t address, Entry** out_entry);
+  // Sets the final status (READY or FAILED) of an entry created by
+  // GetOrCreate and wakes up the threads waiting for it.
+  void Publish(Entry* entry, Entry::Status status);
 
-  std::vector<Function*> FindWithAddress(uint32_t address);
+  // Returns the ready functions containing the address, and optionally also
+  // the guest functions having a function containing it inlined.
+  std::vector<Function*> FindWithAddress(uint32_t address,
+                                         bool include_inlining = false);
 
  private:
+  struct Submap {
+    explicit Submap(size_t capacity);
+
+    size_t capacity;
+    // Only modified under the global critical region.
+    size_t count = 0;
+    std::unique_ptr<std::atomic<Entry*>[]> slots;
+    std::atomic<Submap*> next = {nullptr};
+  };
+
+  static constexpr size_t kInitialCapacity = 4096;
+  // Waiters are parked on one of a fixed set of condition variables selected
+  // by the address so unrelated entries rarely share wakeups.
+  static constexpr size_t kWaitStripeCount = 64;
+  struct WaitStripe {
+    std::mutex mutex;
+    std::condition_variable cond;
+  };
+
+  static size_t HashAddress(uint32_t address) {
+    // Functions are 4-byte aligned - drop the always-zero bits and spread the
+    // rest with a Fibonacci multiplier.
+    return size_t((address >> 2) * UINT32_C(2654435769));
+  }
+  static Entry* FindInSubmap(const Submap& submap, uint32_t address);
+  Entry* Find(uint32_t address) const;
+  WaitStripe& GetWaitStripe(uint32_t address) {
+    return wait_stripes_[HashAddress(address) % kWaitStripeCount];
+  }
+
   xe::global_critical_region global_critical_region_;
-  // TODO(benvanik): replace with a better data structure.
-  std::unordered_map<uint32_t, Entry*> map_;
+  std::unique_ptr<Submap> root_;
+  // Newest submap where insertions happen, protected by the global critical
+  // region.
+  Submap* tail_;
+  std::array<WaitStripe, kWaitStripeCount> wait_stripes_;
 };
 
 }  // namespace cpu
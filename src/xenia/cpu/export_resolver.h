@@ -82,7 +82,7 @@ class Export {
       : ordinal(ordinal),
         type(type),
         tags(tags),
-        function_data({nullptr, nullptr, 0}) {
+        function_data({nullptr, nullptr, nullptr, 0, nullptr}) {
     std::strncpy(this->name, name, xe::countof(this->name));
   }
 
@@ -108,7 +108,14 @@ class Export {
       // Trampoline that is called from the guest-to-host thunk.
       // Expects only PPC context as first arg.
       ExportTrampoline trampoline;
+      // Trampoline that doesn't log the call, used as the trampoline when the
+      // calls to the export wouldn't be logged with the current logging
+      // configuration, so the hot path doesn't need to check it.
+      ExportTrampoline fast_trampoline;
       uint64_t call_count;
+      // Statistics of the calls collected by the kernel call profiler, if it's
+      // enabled.
+      void* call_statistics;
     } function_data;
   };
 };
@@ -128,6 +135,12 @@ class ExportResolver {
       return exports_by_name_;
     }
 
+    Export* GetExportByOrdinal(uint16_t ordinal) const {
+      return ordinal < exports_by_ordinal_->size()
+                 ? (*exports_by_ordinal_)[ordinal]
+                 : nullptr;
+    }
+
    private:
     std::string module_name_;
     const std::vector<Export*>* exports_by_ordinal_ = nullptr;
@@ -144,6 +157,10 @@ class ExportResolver {
     return all_exports_by_name_;
   }
 
+  // Returns nullptr if the module is not a kernel module. For resolving many
+  // exports of one module without matching the module name for each.
+  const Table* GetTable(const std::string_view module_name) const;
+
   Export* GetExportByOrdinal(const std::string_view module_name,
                              uint16_t ordinal);
 
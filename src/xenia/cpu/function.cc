@@ -66,59 +66,159 @@ void GuestFunction::SetupExtern(ExternHandler handler, Export* export_data) {
   export_data_ = export_data;
 }
 
-const SourceMapEntry* GuestFunction::LookupGuestAddress(
-    uint32_t guest_address) const {
-  // TODO(benvanik): binary search? We know the list is sorted by code order.
-  for (size_t i = 0; i < source_map_.size(); ++i) {
-    const auto& entry = source_map_[i];
+namespace {
+
+// Source map entries are stored as LEB128 deltas from the previous entry, with
+// the guest address and the HIR offset deltas zigzag-encoded as they may go
+// backwards, while the code offsets only grow.
+
+void AppendSourceMapVarint(std::vector<uint8_t>& packed, uint32_t value) {
+  while (value >= 0x80) {
+    packed.push_back(uint8_t(value | 0x80));
+    value >>= 7;
+  }
+  packed.push_back(uint8_t(value));
+}
+
+void AppendSourceMapZigzag(std::vector<uint8_t>& packed, uint32_t value,
+                           uint32_t previous_value) {
+  int32_t delta = int32_t(value - previous_value);
+  AppendSourceMapVarint(packed,
+                        (uint32_t(delta) << 1) ^ uint32_t(delta >> 31));
+}
+
+class SourceMapReader {
+ public:
+  SourceMapReader(const std::vector<uint8_t>& packed, uint32_t entry_count)
+      : data_(packed.data()), entries_remaining_(entry_count) {}
+
+  bool Next(SourceMapEntry* out_entry) {
+    if (!entries_remaining_) {
+      return false;
+    }
+    --entries_remaining_;
+    entry_.guest_address += ReadZigzag();
+    entry_.hir_offset += ReadZigzag();
+    entry_.code_offset += ReadVarint();
+    *out_entry = entry_;
+    return true;
+  }
+
+ private:
+  uint32_t ReadVarint() {
+    uint32_t value = 0;
+    uint32_t shift = 0;
+    uint8_t byte;
+    do {
+      byte = *(data_++);
+      value |= uint32_t(byte & 0x7F) << shift;
+      shift += 7;
+    } while (byte & 0x80);
+    return value;
+  }
+  uint32_t ReadZigzag() {
+    uint32_t value = ReadVarint();
+    return (value >> 1) ^ (0 - (value & 1));
+  }
+
+  const uint8_t* data_;
+  uint32_t entries_remaining_;
+  SourceMapEntry entry_ = {};
+};
+
+}  // namespace
+
+std::vector<SourceMapEntry> GuestFunction::source_map() const {
+  std::vector<SourceMapEntry> source_map(source_map_entry_count_);
+  SourceMapReader reader(packed_source_map_, source_map_entry_count_);
+  for (SourceMapEntry& entry : source_map) {
+    reader.Next(&entry);
+  }
+  return source_map;
+}
+
+void GuestFunction::set_source_map(
+    const std::vector<SourceMapEntry>& source_map) {
+  std::vector<uint8_t> packed;
+  packed.reserve(source_map.size() * 4);
+  SourceMapEntry previous_entry = {};
+  for (const SourceMapEntry& entry : source_map) {
+    AppendSourceMapZigzag(packed, entry.guest_address,
+                          previous_entry.guest_address);
+    AppendSourceMapZigzag(packed, entry.hir_offset, previous_entry.hir_offset);
+    assert_true(entry.code_offset >= previous_entry.code_offset);
+    AppendSourceMapVarint(packed,
+                          entry.code_offset - previous_entry.code_offset);
+    previous_entry = entry;
+  }
+  // Copied to an allocation of the exact size, without the reserved space.
+  packed_source_map_ = std::vector<uint8_t>(packed.cbegin(), packed.cend());
+  source_map_entry_count_ = uint32_t(source_map.size());
+}
+
+bool GuestFunction::LookupGuestAddress(uint32_t guest_address,
+                                       SourceMapEntry* out_entry) const {
+  SourceMapReader reader(packed_source_map_, source_map_entry_count_);
+  SourceMapEntry entry;
+  while (reader.Next(&entry)) {
     if (entry.guest_address == guest_address) {
-      return &entry;
+      *out_entry = entry;
+      return true;
     }
   }
-  return nullptr;
+  return false;
 }
 
-const SourceMapEntry* GuestFunction::LookupHIROffset(uint32_t offset) const {
-  // TODO(benvanik): binary search? We know the list is sorted by code order.
-  for (size_t i = 0; i < source_map_.size(); ++i) {
-    const auto& entry = source_map_[i];
+bool GuestFunction::LookupHIROffset(uint32_t offset,
+                                    SourceMapEntry* out_entry) const {
+  SourceMapReader reader(packed_source_map_, source_map_entry_count_);
+  SourceMapEntry entry;
+  while (reader.Next(&entry)) {
     if (entry.hir_offset >= offset) {
-      return &entry;
+      *out_entry = entry;
+      return true;
     }
   }
-  return nullptr;
+  return false;
 }
 
-const SourceMapEntry* GuestFunction::LookupMachineCodeOffset(
-    uint32_t offset) const {
-  // TODO(benvanik): binary search? We know the list is sorted by code order.
-  for (int64_t i = source_map_.size() - 1; i >= 0; --i) {
-    const auto& entry = source_map_[i];
-    if (entry.code_offset <= offset) {
-      return &entry;
+bool GuestFunction::LookupMachineCodeOffset(uint32_t offset,
+                                            SourceMapEntry* out_entry) const {
+  // The last entry at or before the offset, or the first one if there's none.
+  SourceMapReader reader(packed_source_map_, source_map_entry_count_);
+  SourceMapEntry entry;
+  bool found = false;
+  while (reader.Next(&entry)) {
+    if (!found || entry.code_offset <= offset) {
+      *out_entry = entry;
     }
+    found = true;
   }
-  return source_map_.empty() ? nullptr : &source_map_[0];
+  return found;
 }
 
 uint32_t GuestFunction::MapGuestAddressToMachineCodeOffset(
     uint32_t guest_address) const {
-  auto entry = LookupGuestAddress(guest_address);
-  return entry ? entry->code_offset : 0;
+  SourceMapEntry entry;
+  return LookupGuestAddress(guest_address, &entry) ? entry.code_offset : 0;
 }
 
 uintptr_t GuestFunction::MapGuestAddressToMachineCode(
     uint32_t guest_address) const {
-  auto entry = LookupGuestAddress(guest_address);
+  SourceMapEntry entry;
   return reinterpret_cast<uintptr_t>(machine_code()) +
-         (entry ? entry->code_offset : 0);
+         (LookupGuestAddress(guest_address, &entry) ? entry.code_offset : 0);
 }
 
 uint32_t GuestFunction::MapMachineCodeToGuestAddress(
     uintptr_t host_address) const {
-  auto entry = LookupMachineCodeOffset(static_cast<uint32_t>(
-      host_address - reinterpret_cast<uintptr_t>(machine_code())));
-  return entry ? entry->guest_address : address();
+  SourceMapEntry entry;
+  return LookupMachineCodeOffset(
+             static_cast<uint32_t>(
+                 host_address - reinterpret_cast<uintptr_t>(machine_code())),
+             &entry)
+             ? entry.guest_address
+             : address();
 }
 
 bool GuestFunction::Call(ThreadState* thread_state, uint32_t return_address) {
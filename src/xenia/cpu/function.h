@@ -10,6 +10,7 @@
 #ifndef XENIA_CPU_FUNCTION_H_
 #define XENIA_CPU_FUNCTION_H_
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -116,15 +117,67 @@ class GuestFunction : public Function {
     debug_info_ = std::move(debug_info);
   }
   FunctionTraceData& trace_data() { return trace_data_; }
-  std::vector<SourceMapEntry>& source_map() { return source_map_; }
+
+  // The source map is kept delta-encoded (usually 3-4 bytes per entry) as it's
+  // needed for every translated function, but only read by the debugger, the
+  // profiler and when handling exceptions, so it's decoded on access.
+  uint32_t source_map_entry_count() const { return source_map_entry_count_; }
+  std::vector<SourceMapEntry> source_map() const;
+  void set_source_map(const std::vector<SourceMapEntry>& source_map);
+
+  // Optimization level of the latest translation (see --tiered_compilation).
+  enum class Tier {
+    kBaseline,
+    kOptimized,
+  };
+  Tier tier() const { return tier_; }
+  void set_tier(Tier tier) { tier_ = tier; }
+  // Returns true only the first time, so the function is only queued for
+  // optimization once.
+  bool RequestOptimization() {
+    return !optimization_requested_.exchange(true, std::memory_order_relaxed);
+  }
+  // Whether the baseline code has found the function hot.
+  bool optimization_requested() const {
+    return optimization_requested_.load(std::memory_order_relaxed);
+  }
+
+  // Functions whose code is inlined into the latest translation.
+  const std::vector<GuestFunction*>& inlined_functions() const {
+    return inlined_functions_;
+  }
+  void set_inlined_functions(const std::vector<GuestFunction*>& functions) {
+    inlined_functions_ = functions;
+  }
+
+  // Incremented when the guest code of the function or of the functions
+  // inlined into it may have been modified (see --invalidate_modified_code).
+  uint32_t code_modification_count() const {
+    return code_modification_count_.load(std::memory_order_acquire);
+  }
+  void MarkCodeModified() {
+    code_modification_count_.fetch_add(1, std::memory_order_acq_rel);
+  }
+  // Whether the code has been modified since it has been read for the latest
+  // translation, which Processor::ResolveFunction then redoes.
+  bool is_code_modified() const {
+    return code_modification_count() !=
+           translated_code_modification_count_.load(std::memory_order_acquire);
+  }
+  void set_translated_code_modification_count(uint32_t value) {
+    translated_code_modification_count_.store(value,
+                                              std::memory_order_release);
+  }
 
   ExternHandler extern_handler() const { return extern_handler_; }
   Export* export_data() const { return export_data_; }
   void SetupExtern(ExternHandler handler, Export* export_data = nullptr);
 
-  const SourceMapEntry* LookupGuestAddress(uint32_t guest_address) const;
-  const SourceMapEntry* LookupHIROffset(uint32_t offset) const;
-  const SourceMapEntry* LookupMachineCodeOffset(uint32_t offset) const;
+  bool LookupGuestAddress(uint32_t guest_address,
+                          SourceMapEntry* out_entry) const;
+  bool LookupHIROffset(uint32_t offset, SourceMapEntry* out_entry) const;
+  bool LookupMachineCodeOffset(uint32_t offset,
+                               SourceMapEntry* out_entry) const;
 
   uint32_t MapGuestAddressToMachineCodeOffset(uint32_t guest_address) const;
   uintptr_t MapGuestAddressToMachineCode(uint32_t guest_address) const;
@@ -138,7 +191,13 @@ class GuestFunction : public Function {
  protected:
   std::unique_ptr<FunctionDebugInfo> debug_info_;
   FunctionTraceData trace_data_;
-  std::vector<SourceMapEntry> source_map_;
+  std::vector<uint8_t> packed_source_map_;
+  uint32_t source_map_entry_count_ = 0;
+  Tier tier_ = Tier::kOptimized;
+  std::atomic<bool> optimization_requested_ = {false};
+  std::vector<GuestFunction*> inlined_functions_;
+  std::atomic<uint32_t> code_modification_count_ = {0};
+  std::atomic<uint32_t> translated_code_modification_count_ = {0};
   ExternHandler extern_handler_ = nullptr;
   Export* export_data_ = nullptr;
 };
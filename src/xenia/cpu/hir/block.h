@@ -46,6 +46,7 @@ class Edge {
 
 class Block {
  public:
+  HIRBuilder* builder;
   Arena* arena;
 
   Block* next;
@@ -9,9 +9,9 @@
 
 #include "xenia/cpu/hir/hir_builder.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdarg>
-#include <cstring>
 
 #include "xenia/base/assert.h"
 #include "xenia/base/profiling.h"
@@ -62,6 +62,10 @@ void HIRBuilder::Reset() {
   next_label_id_ = 0;
   next_value_ordinal_ = 0;
   locals_.clear();
+  removed_instrs_.clear();
+  free_instrs_.clear();
+  removed_uses_.clear();
+  free_uses_.clear();
   block_head_ = block_tail_ = NULL;
   current_block_ = NULL;
 #if SCRIBBLE_ARENA_ON_RESET
@@ -388,6 +392,7 @@ void HIRBuilder::InsertLabel(Label* label, Instr* prev_instr) {
   Block* new_block = arena_->Alloc<Block>();
   new_block->ordinal = UINT16_MAX;
   new_block->incoming_values = nullptr;
+  new_block->builder = this;
   new_block->arena = arena_;
   new_block->prev = prev_block;
   new_block->next = next_block;
@@ -633,6 +638,7 @@ Block* HIRBuilder::AppendBlock() {
   Block* block = arena_->Alloc<Block>();
   block->ordinal = UINT16_MAX;
   block->incoming_values = nullptr;
+  block->builder = this;
   block->arena = arena_;
   block->next = NULL;
   block->prev = block_tail_;
@@ -678,7 +684,13 @@ Instr* HIRBuilder::AppendInstr(const OpcodeInfo& opcode_info, uint16_t flags,
   }
   Block* block = current_block_;
 
-  Instr* instr = arena_->Alloc<Instr>();
+  Instr* instr;
+  if (!free_instrs_.empty()) {
+    instr = free_instrs_.back();
+    free_instrs_.pop_back();
+  } else {
+    instr = arena_->Alloc<Instr>();
+  }
   instr->next = NULL;
   instr->prev = block->instr_tail;
   if (block->instr_tail) {
@@ -703,6 +715,31 @@ Instr* HIRBuilder::AppendInstr(const OpcodeInfo& opcode_info, uint16_t flags,
   return instr;
 }
 
+Value::Use* HIRBuilder::AddUse(Value* value, Instr* instr) {
+  Value::Use* use;
+  if (!free_uses_.empty()) {
+    use = free_uses_.back();
+    free_uses_.pop_back();
+  } else {
+    use = arena_->Alloc<Value::Use>();
+  }
+  return value->AddUse(use, instr);
+}
+
+void HIRBuilder::RecycleRemoved() {
+  // An instruction may be removed more than once.
+  std::sort(removed_instrs_.begin(), removed_instrs_.end());
+  removed_instrs_.erase(
+      std::unique(removed_instrs_.begin(), removed_instrs_.end()),
+      removed_instrs_.end());
+  free_instrs_.insert(free_instrs_.end(), removed_instrs_.cbegin(),
+                      removed_instrs_.cend());
+  removed_instrs_.clear();
+  free_uses_.insert(free_uses_.end(), removed_uses_.cbegin(),
+                    removed_uses_.cend());
+  removed_uses_.clear();
+}
+
 Value* HIRBuilder::AllocValue(TypeName type) {
   Value* value = arena_->Alloc<Value>();
   value->ordinal = next_value_ordinal_++;
@@ -738,10 +775,7 @@ void HIRBuilder::Comment(std::string_view value) {
   if (value.empty()) {
     return;
   }
-  auto size = value.size();
-  auto p = reinterpret_cast<char*>(arena_->Alloc(size + 1, 1));
-  std::memcpy(p, value.data(), size);
-  p[size] = '\0';
+  char* p = arena_->CopyString(value);
   Instr* i = AppendInstr(OPCODE_COMMENT_info, 0);
   i->src1.offset = (uint64_t)p;
   i->src2.value = i->src3.value = NULL;
@@ -751,10 +785,7 @@ void HIRBuilder::Comment(const StringBuffer& value) {
   if (!value.length()) {
     return;
   }
-  auto size = value.length();
-  auto p = reinterpret_cast<char*>(arena_->Alloc(size + 1, 1));
-  std::memcpy(p, value.buffer(), size);
-  p[size] = '\0';
+  char* p = arena_->CopyString(value.to_string_view());
   Instr* i = AppendInstr(OPCODE_COMMENT_info, 0);
   i->src1.offset = (uint64_t)p;
   i->src2.value = i->src3.value = NULL;
@@ -28,6 +28,8 @@ namespace hir {
 
 enum FunctionAttributes {
   FUNCTION_ATTRIB_INLINE = (1 << 1),
+  // Contains code of other guest functions (see InliningPass).
+  FUNCTION_ATTRIB_HAS_INLINED_CALLS = (1 << 2),
 };
 
 class HIRBuilder {
@@ -38,11 +40,37 @@ class HIRBuilder {
   virtual void Reset();
   virtual bool Finalize();
 
+  // Inlining support for InliningPass, implemented by the frontend.
+  // Returns the number of guest instructions in the function if it can be
+  // inlined into the one being built, or 0 if it can't. With allow_exits,
+  // only for tail calls, the function may also contain calls and branches
+  // leaving it, which stay calls and tail calls of the inlined code, for
+  // forming traces across functions.
+  virtual uint32_t GetInlinableInstructionCount(Function* function,
+                                                bool is_tail_call,
+                                                bool allow_exits) {
+    return 0;
+  }
+  // Appends the body of the function to the end of the HIR, starting at
+  // entry_label. Returns branch to return_label, or are left as is for tail
+  // calls if it's null. Code is attributed to call_address for debugging.
+  virtual void EmitInlined(Function* function, uint32_t call_address,
+                           Label* entry_label, Label* return_label) {}
+
   void Dump(StringBuffer* str);
   void AssertNoCycles();
 
   Arena* arena() const { return arena_; }
 
+  // Instructions and value uses removed by passes are reused for new ones,
+  // rather than allocated from the arena again, once the pass that has removed
+  // them is done (see RecycleRemoved), as it may still be following them.
+  Value::Use* AddUse(Value* value, Instr* instr);
+  void OnUseRemoved(Value::Use* use) { removed_uses_.push_back(use); }
+  void OnInstrRemoved(Instr* instr) { removed_instrs_.push_back(instr); }
+  // Called by the compiler between passes.
+  void RecycleRemoved();
+
   uint32_t attributes() const { return attributes_; }
   void set_attributes(uint32_t value) { attributes_ = value; }
 
@@ -288,6 +316,12 @@ class HIRBuilder {
 
   std::vector<Value*> locals_;
 
+  // Kept across functions with the builder, so only grow in the first ones.
+  std::vector<Instr*> removed_instrs_;
+  std::vector<Instr*> free_instrs_;
+  std::vector<Value::Use*> removed_uses_;
+  std::vector<Value::Use*> free_uses_;
+
   Block* block_head_;
   Block* block_tail_;
   Block* current_block_;
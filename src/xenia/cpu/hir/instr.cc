@@ -10,6 +10,7 @@
 #include "xenia/cpu/hir/instr.h"
 
 #include "xenia/cpu/hir/block.h"
+#include "xenia/cpu/hir/hir_builder.h"
 
 namespace xe {
 namespace cpu {
@@ -21,9 +22,10 @@ void Instr::set_src1(Value* value) {
   }
   if (src1_use) {
     src1.value->RemoveUse(src1_use);
+    block->builder->OnUseRemoved(src1_use);
   }
   src1.value = value;
-  src1_use = value ? value->AddUse(block->arena, this) : NULL;
+  src1_use = value ? block->builder->AddUse(value, this) : NULL;
 }
 
 void Instr::set_src2(Value* value) {
@@ -32,9 +34,10 @@ void Instr::set_src2(Value* value) {
   }
   if (src2_use) {
     src2.value->RemoveUse(src2_use);
+    block->builder->OnUseRemoved(src2_use);
   }
   src2.value = value;
-  src2_use = value ? value->AddUse(block->arena, this) : NULL;
+  src2_use = value ? block->builder->AddUse(value, this) : NULL;
 }
 
 void Instr::set_src3(Value* value) {
@@ -43,9 +46,10 @@ void Instr::set_src3(Value* value) {
   }
   if (src3_use) {
     src3.value->RemoveUse(src3_use);
+    block->builder->OnUseRemoved(src3_use);
   }
   src3.value = value;
-  src3_use = value ? value->AddUse(block->arena, this) : NULL;
+  src3_use = value ? block->builder->AddUse(value, this) : NULL;
 }
 
 void Instr::MoveBefore(Instr* other) {
@@ -84,16 +88,19 @@ void Instr::Replace(const OpcodeInfo* new_opcode, uint16_t new_flags) {
 
   if (src1_use) {
     src1.value->RemoveUse(src1_use);
+    block->builder->OnUseRemoved(src1_use);
     src1.value = NULL;
     src1_use = NULL;
   }
   if (src2_use) {
     src2.value->RemoveUse(src2_use);
+    block->builder->OnUseRemoved(src2_use);
     src2.value = NULL;
     src2_use = NULL;
   }
   if (src3_use) {
     src3.value->RemoveUse(src3_use);
+    block->builder->OnUseRemoved(src3_use);
     src3.value = NULL;
     src3_use = NULL;
   }
@@ -113,6 +120,9 @@ void Instr::Remove() {
   } else {
     block->instr_tail = prev;
   }
+
+  // The links are kept, as passes may still be following them.
+  block->builder->OnInstrRemoved(this);
 }
 
 }  // namespace hir
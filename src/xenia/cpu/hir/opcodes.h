@@ -21,6 +21,12 @@ enum CallFlags {
   CALL_POSSIBLE_RETURN = (1 << 2),
 };
 
+// Trap codes other than the types of the guest trap instructions.
+enum TrapCodes : uint16_t {
+  // Pauses the thread in the debugger, for compiled breakpoints.
+  TRAP_DEBUGGER_BREAK = 0xFFFF,
+};
+
 enum BranchFlags {
   BRANCH_LIKELY = (1 << 1),
   BRANCH_UNLIKELY = (1 << 2),
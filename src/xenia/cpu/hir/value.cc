@@ -20,8 +20,7 @@ namespace xe {
 namespace cpu {
 namespace hir {
 
-Value::Use* Value::AddUse(Arena* arena, Instr* instr) {
-  Use* use = arena->Alloc<Use>();
+Value::Use* Value::AddUse(Use* use, Instr* instr) {
   use->instr = instr;
   use->prev = NULL;
   use->next = use_head;
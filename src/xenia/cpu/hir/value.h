@@ -61,6 +61,9 @@ inline size_t GetTypeSize(TypeName type_name) {
 enum ValueFlags {
   VALUE_IS_CONSTANT = (1 << 1),
   VALUE_IS_ALLOCATED = (1 << 2),  // Used by backends. Do not set.
+  // Kept in one register in all blocks of a loop, and assigned multiple times
+  // (see RegisterAllocationPass).
+  VALUE_IS_LOOP_REGISTER = (1 << 3),
 };
 
 struct RegAssignment {
@@ -106,7 +109,8 @@ class Value {
   // TODO(benvanik): remove to shrink size.
   void* tag;
 
-  Use* AddUse(Arena* arena, Instr* instr);
+  // Links the use, allocated by HIRBuilder::AddUse.
+  Use* AddUse(Use* use, Instr* instr);
   void RemoveUse(Use* use);
 
   void set_zero(TypeName new_type) {
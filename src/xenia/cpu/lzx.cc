@@ -93,9 +93,19 @@ mspack_system* mspack_memory_sys_create() {
 
 void mspack_memory_sys_destroy(struct mspack_system* sys) { free(sys); }
 
-int lzx_decompress(const void* lzx_data, size_t lzx_len, void* dest,
-                   size_t dest_len, uint32_t window_size, void* window_data,
-                   size_t window_data_len) {
+typedef struct mspack_stream_file_t {
+  const std::function<int(void* buffer, int length)>* read_function;
+} mspack_stream_file;
+
+int mspack_stream_read(mspack_file* file, void* buffer, int chars) {
+  auto streamfile = (mspack_stream_file*)file;
+  return (*streamfile->read_function)(buffer, chars);
+}
+
+static int lzx_decompress_file(mspack_system* sys, mspack_file* lzxsrc,
+                               void* dest, size_t dest_len,
+                               uint32_t window_size, void* window_data,
+                               size_t window_data_len) {
   int result_code = 1;
 
   uint32_t window_bits;
@@ -103,12 +113,9 @@ int lzx_decompress(const void* lzx_data, size_t lzx_len, void* dest,
     return result_code;
   }
 
-  mspack_system* sys = mspack_memory_sys_create();
-  mspack_memory_file* lzxsrc =
-      mspack_memory_open(sys, (void*)lzx_data, lzx_len);
   mspack_memory_file* lzxdst = mspack_memory_open(sys, dest, dest_len);
-  lzxd_stream* lzxd = lzxd_init(sys, (mspack_file*)lzxsrc, (mspack_file*)lzxdst,
-                                window_bits, 0, 0x8000, (off_t)dest_len, 0);
+  lzxd_stream* lzxd = lzxd_init(sys, lzxsrc, (mspack_file*)lzxdst, window_bits,
+                                0, 0x8000, (off_t)dest_len, 0);
 
   if (lzxd) {
     if (window_data) {
@@ -127,20 +134,57 @@ int lzx_decompress(const void* lzx_data, size_t lzx_len, void* dest,
     lzxd = NULL;
   }
 
+  if (lzxdst) {
+    mspack_memory_close(lzxdst);
+    lzxdst = NULL;
+  }
+
+  return result_code;
+}
+
+int lzx_decompress(const void* lzx_data, size_t lzx_len, void* dest,
+                   size_t dest_len, uint32_t window_size, void* window_data,
+                   size_t window_data_len) {
+  mspack_system* sys = mspack_memory_sys_create();
+  if (!sys) {
+    return 1;
+  }
+  mspack_memory_file* lzxsrc =
+      mspack_memory_open(sys, (void*)lzx_data, lzx_len);
+
+  int result_code =
+      lzx_decompress_file(sys, (mspack_file*)lzxsrc, dest, dest_len,
+                          window_size, window_data, window_data_len);
+
   if (lzxsrc) {
     mspack_memory_close(lzxsrc);
     lzxsrc = NULL;
   }
 
-  if (lzxdst) {
-    mspack_memory_close(lzxdst);
-    lzxdst = NULL;
-  }
+  mspack_memory_sys_destroy(sys);
+  sys = NULL;
+
+  return result_code;
+}
 
-  if (sys) {
-    mspack_memory_sys_destroy(sys);
-    sys = NULL;
+int lzx_decompress(
+    const std::function<int(void* buffer, int length)>& read_function,
+    void* dest, size_t dest_len, uint32_t window_size) {
+  mspack_system* sys = mspack_memory_sys_create();
+  if (!sys) {
+    return 1;
   }
+  // The input is only read and the output is only written, so the reads can
+  // go to the stream while the writes go to the memory file.
+  sys->read = mspack_stream_read;
+  mspack_stream_file lzxsrc;
+  lzxsrc.read_function = &read_function;
+
+  int result_code = lzx_decompress_file(sys, (mspack_file*)&lzxsrc, dest,
+                                        dest_len, window_size, nullptr, 0);
+
+  mspack_memory_sys_destroy(sys);
+  sys = NULL;
 
   return result_code;
 }
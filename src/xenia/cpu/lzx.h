@@ -10,6 +10,7 @@
 #ifndef XENIA_CPU_LZX_H_
 #define XENIA_CPU_LZX_H_
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -23,6 +24,14 @@ int lzx_decompress(const void* lzx_data, size_t lzx_len, void* dest,
                    size_t dest_len, uint32_t window_size, void* window_data,
                    size_t window_data_len);
 
+// Decompresses LZX data provided incrementally by read_function, so the
+// decompression can be overlapped with producing the data. read_function
+// copies up to length bytes of the data to the buffer and returns how many
+// bytes were copied, 0 at the end of the data, or -1 on failure.
+int lzx_decompress(
+    const std::function<int(void* buffer, int length)>& read_function,
+    void* dest, size_t dest_len, uint32_t window_size);
+
 int lzxdelta_apply_patch(xe::xex2_delta_patch* patch, size_t patch_len,
                          uint32_t window_size, void* dest);
 
@@ -115,6 +115,44 @@ bool MMIOHandler::CheckStore(uint32_t virtual_address, uint32_t value) {
   return false;
 }
 
+const MMIORange* MMIOHandler::LookupHostRange(
+    const void* host_address, uint32_t& guest_address_out) const {
+  // Only virtual ranges are supported.
+  if (host_address < virtual_membase_ || host_address >= physical_membase_) {
+    return nullptr;
+  }
+  uint32_t guest_address =
+      host_to_guest_virtual_(host_to_guest_virtual_context_, host_address);
+  for (const auto& range : mapped_ranges_) {
+    if ((guest_address & range.mask) == range.address) {
+      guest_address_out = guest_address;
+      return &range;
+    }
+  }
+  return nullptr;
+}
+
+uint32_t MMIOHandler::SoftwareLoad(const void* host_address) {
+  uint32_t guest_address;
+  const MMIORange* range = LookupHostRange(host_address, guest_address);
+  if (range) {
+    return xe::byte_swap(
+        range->read(nullptr, range->callback_context, guest_address));
+  }
+  return xe::load<uint32_t>(host_address);
+}
+
+void MMIOHandler::SoftwareStore(void* host_address, uint32_t value) {
+  uint32_t guest_address;
+  const MMIORange* range = LookupHostRange(host_address, guest_address);
+  if (range) {
+    range->write(nullptr, range->callback_context, guest_address,
+                 xe::byte_swap(value));
+    return;
+  }
+  xe::store<uint32_t>(host_address, value);
+}
+
 bool MMIOHandler::TryDecodeLoadStore(const uint8_t* p,
                                      DecodedLoadStore& decoded_out) {
   std::memset(&decoded_out, 0, sizeof(decoded_out));
@@ -214,7 +252,7 @@ bool MMIOHandler::TryDecodeLoadStore(const uint8_t* p,
   }
   if (has_sib) {
     uint8_t sib = p[i++];
-    decoded_out.mem_scale = 1 << ((sib & 0b11000000) >> 8);
+    decoded_out.mem_scale = 1 << ((sib & 0b11000000) >> 6);
     uint8_t sib_index = (sib & 0b00111000) >> 3;
     uint8_t sib_base = (sib & 0b00000111);
     switch (sib_index) {
@@ -415,40 +453,16 @@ bool MMIOHandler::ExceptionCallback(Exception* ex) {
   void* fault_host_address = reinterpret_cast<void*>(ex->fault_address());
 
   // Access violations are pretty rare, so we can do a linear search here.
-  // Only check if in the virtual range, as we only support virtual ranges.
-  const MMIORange* range = nullptr;
   uint32_t fault_guest_virtual_address = 0;
-  if (ex->fault_address() < uint64_t(physical_membase_)) {
-    fault_guest_virtual_address = host_to_guest_virtual_(
-        host_to_guest_virtual_context_, fault_host_address);
-    for (const auto& test_range : mapped_ranges_) {
-      if ((fault_guest_virtual_address & test_range.mask) ==
-          test_range.address) {
-        // Address is within the range of this mapping.
-        range = &test_range;
-        break;
-      }
-    }
-  }
+  const MMIORange* range =
+      LookupHostRange(fault_host_address, fault_guest_virtual_address);
   if (!range) {
-    // Recheck if the pages are still protected (race condition - another thread
-    // clears the watch we just hit).
-    // Do this under the lock so we don't introduce another race condition.
-    auto lock = global_critical_region_.Acquire();
-    memory::PageAccess cur_access;
-    size_t page_length = memory::page_size();
-    memory::QueryProtect(fault_host_address, page_length, cur_access);
-    if (cur_access != memory::PageAccess::kNoAccess &&
-        (!is_write || cur_access != memory::PageAccess::kReadOnly)) {
-      // Another thread has cleared this watch. Abort.
-      return true;
-    }
     // The address is not found within any range, so either a write watch or an
     // actual access violation.
     if (access_violation_callback_) {
-      return access_violation_callback_(std::move(lock),
-                                        access_violation_callback_context_,
-                                        fault_host_address, is_write);
+      return access_violation_callback_(
+          global_critical_region_.AcquireDeferred(),
+          access_violation_callback_context_, fault_host_address, is_write);
     }
     return false;
   }
@@ -561,6 +575,11 @@ bool MMIOHandler::ExceptionCallback(Exception* ex) {
   }
 #endif  // XE_ARCH_ARM64
 
+  if (fault_site_callback_) {
+    fault_site_callback_(fault_site_callback_context_,
+                         reinterpret_cast<void*>(rip), decoded_load_store);
+  }
+
   // Advance RIP to the next instruction so that we resume properly.
   ex->set_resume_pc(rip + decoded_load_store.length);
 
@@ -42,60 +42,8 @@ struct MMIORange {
 // NOTE: only one can exist at a time!
 class MMIOHandler {
  public:
-  virtual ~MMIOHandler();
-
-  typedef uint32_t (*HostToGuestVirtual)(const void* context,
-                                         const void* host_address);
-  typedef bool (*AccessViolationCallback)(
-      std::unique_lock<std::recursive_mutex> global_lock_locked_once,
-      void* context, void* host_address, bool is_write);
-
-  // access_violation_callback is called with global_critical_region locked once
-  // on the thread, so if multiple threads trigger an access violation in the
-  // same page, the callback will be called only once.
-  static std::unique_ptr<MMIOHandler> Install(
-      uint8_t* virtual_membase, uint8_t* physical_membase, uint8_t* membase_end,
-      HostToGuestVirtual host_to_guest_virtual,
-      const void* host_to_guest_virtual_context,
-      AccessViolationCallback access_violation_callback,
-      void* access_violation_callback_context);
-  static MMIOHandler* global_handler() { return global_handler_; }
-
-  bool RegisterRange(uint32_t virtual_address, uint32_t mask, uint32_t size,
-                     void* context, MMIOReadCallback read_callback,
-                     MMIOWriteCallback write_callback);
-  MMIORange* LookupRange(uint32_t virtual_address);
-
-  bool CheckLoad(uint32_t virtual_address, uint32_t* out_value);
-  bool CheckStore(uint32_t virtual_address, uint32_t value);
-
- protected:
-  MMIOHandler(uint8_t* virtual_membase, uint8_t* physical_membase,
-              uint8_t* membase_end, HostToGuestVirtual host_to_guest_virtual,
-              const void* host_to_guest_virtual_context,
-              AccessViolationCallback access_violation_callback,
-              void* access_violation_callback_context);
-
-  static bool ExceptionCallbackThunk(Exception* ex, void* data);
-  bool ExceptionCallback(Exception* ex);
-
-  uint8_t* virtual_membase_;
-  uint8_t* physical_membase_;
-  uint8_t* memory_end_;
-
-  std::vector<MMIORange> mapped_ranges_;
-
-  HostToGuestVirtual host_to_guest_virtual_;
-  const void* host_to_guest_virtual_context_;
-
-  AccessViolationCallback access_violation_callback_;
-  void* access_violation_callback_context_;
-
-  static MMIOHandler* global_handler_;
-
-  xe::global_critical_region global_critical_region_;
-
- private:
+  // Host load or store instruction that has accessed a range, as decoded by the
+  // exception handler.
   struct DecodedLoadStore {
     // Matches the Xn/Wn register number for 0 reads and ignored writes in many
     // usage cases.
@@ -147,6 +95,90 @@ class MMIOHandler {
     int32_t constant;
   };
 
+  // Called after an access to a registered range by the host instruction at
+  // host_pc has been handled, so the code generator can replace the
+  // instruction with an explicit call of the software access path and avoid
+  // taking an exception there again.
+  typedef void (*FaultSiteCallback)(void* context, void* host_pc,
+                                    const DecodedLoadStore& decoded);
+
+  virtual ~MMIOHandler();
+
+  typedef uint32_t (*HostToGuestVirtual)(const void* context,
+                                         const void* host_address);
+  typedef bool (*AccessViolationCallback)(
+      std::unique_lock<std::recursive_mutex> global_lock, void* context,
+      void* host_address, bool is_write);
+
+  // access_violation_callback is called with a deferred lock of
+  // global_critical_region, not locked, so it can return without locking for
+  // faults that another thread has already handled. Otherwise, it must lock it
+  // once and recheck whether the page is still protected, so if multiple
+  // threads trigger an access violation in the same page, it will be handled
+  // only once.
+  static std::unique_ptr<MMIOHandler> Install(
+      uint8_t* virtual_membase, uint8_t* physical_membase, uint8_t* membase_end,
+      HostToGuestVirtual host_to_guest_virtual,
+      const void* host_to_guest_virtual_context,
+      AccessViolationCallback access_violation_callback,
+      void* access_violation_callback_context);
+  static MMIOHandler* global_handler() { return global_handler_; }
+
+  bool RegisterRange(uint32_t virtual_address, uint32_t mask, uint32_t size,
+                     void* context, MMIOReadCallback read_callback,
+                     MMIOWriteCallback write_callback);
+  MMIORange* LookupRange(uint32_t virtual_address);
+
+  bool CheckLoad(uint32_t virtual_address, uint32_t* out_value);
+  bool CheckStore(uint32_t virtual_address, uint32_t value);
+
+  // 32-bit accesses to a host address within the guest address space, calling
+  // the callbacks of a registered range if it's in one, or accessing the memory
+  // directly otherwise. Values are in the guest memory byte order.
+  uint32_t SoftwareLoad(const void* host_address);
+  void SoftwareStore(void* host_address, uint32_t value);
+
+  // The callback is invoked from the exception handler.
+  void SetFaultSiteCallback(FaultSiteCallback callback, void* context) {
+    fault_site_callback_ = callback;
+    fault_site_callback_context_ = context;
+  }
+
+ protected:
+  MMIOHandler(uint8_t* virtual_membase, uint8_t* physical_membase,
+              uint8_t* membase_end, HostToGuestVirtual host_to_guest_virtual,
+              const void* host_to_guest_virtual_context,
+              AccessViolationCallback access_violation_callback,
+              void* access_violation_callback_context);
+
+  static bool ExceptionCallbackThunk(Exception* ex, void* data);
+  bool ExceptionCallback(Exception* ex);
+
+  uint8_t* virtual_membase_;
+  uint8_t* physical_membase_;
+  uint8_t* memory_end_;
+
+  std::vector<MMIORange> mapped_ranges_;
+
+  HostToGuestVirtual host_to_guest_virtual_;
+  const void* host_to_guest_virtual_context_;
+
+  AccessViolationCallback access_violation_callback_;
+  void* access_violation_callback_context_;
+
+  FaultSiteCallback fault_site_callback_ = nullptr;
+  void* fault_site_callback_context_ = nullptr;
+
+  static MMIOHandler* global_handler_;
+
+  xe::global_critical_region global_critical_region_;
+
+ private:
+  // Returns the range containing a host address in the virtual guest address
+  // space, or nullptr if it's not in any.
+  const MMIORange* LookupHostRange(const void* host_address,
+                                   uint32_t& guest_address_out) const;
+
   static bool TryDecodeLoadStore(const uint8_t* p,
                                  DecodedLoadStore& decoded_out);
 };
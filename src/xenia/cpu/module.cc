@@ -28,10 +28,47 @@ Module::~Module() = default;
 
 bool Module::ContainsAddress(uint32_t address) { return true; }
 
+Symbol* Module::FindSymbol(uint32_t address) const {
+  auto compare = [](const SymbolIndexEntry& entry, uint32_t address) {
+    return entry.address < address;
+  };
+  for (const std::vector<SymbolIndexEntry>* index :
+       {&recent_symbol_index_, &symbol_index_}) {
+    auto it = std::lower_bound(index->cbegin(), index->cend(), address,
+                               compare);
+    if (it != index->cend() && it->address == address) {
+      return list_[it->list_index].get();
+    }
+  }
+  return nullptr;
+}
+
+void Module::AddSymbol(Symbol* symbol) {
+  auto compare = [](const SymbolIndexEntry& a, const SymbolIndexEntry& b) {
+    return a.address < b.address;
+  };
+  SymbolIndexEntry new_entry;
+  new_entry.address = symbol->address();
+  new_entry.list_index = uint32_t(list_.size());
+  list_.emplace_back(symbol);
+  recent_symbol_index_.insert(
+      std::upper_bound(recent_symbol_index_.cbegin(),
+                       recent_symbol_index_.cend(), new_entry, compare),
+      new_entry);
+  if (recent_symbol_index_.size() < kRecentSymbolIndexMaxSize) {
+    return;
+  }
+  size_t old_size = symbol_index_.size();
+  symbol_index_.insert(symbol_index_.cend(), recent_symbol_index_.cbegin(),
+                       recent_symbol_index_.cend());
+  std::inplace_merge(symbol_index_.begin(), symbol_index_.begin() + old_size,
+                     symbol_index_.end(), compare);
+  recent_symbol_index_.clear();
+}
+
 Symbol* Module::LookupSymbol(uint32_t address, bool wait) {
   auto global_lock = global_critical_region_.Acquire();
-  const auto it = map_.find(address);
-  Symbol* symbol = it != map_.end() ? it->second : nullptr;
+  Symbol* symbol = FindSymbol(address);
   if (symbol) {
     if (symbol->status() == Symbol::Status::kDeclaring) {
       // Some other thread is declaring the symbol - wait.
@@ -56,8 +93,7 @@ Symbol::Status Module::DeclareSymbol(Symbol::Type type, uint32_t address,
                                      Symbol** out_symbol) {
   *out_symbol = nullptr;
   auto global_lock = global_critical_region_.Acquire();
-  auto it = map_.find(address);
-  Symbol* symbol = it != map_.end() ? it->second : nullptr;
+  Symbol* symbol = FindSymbol(address);
   Symbol::Status status;
   if (symbol) {
     // If we exist but are the wrong type, die.
@@ -86,8 +122,7 @@ Symbol::Status Module::DeclareSymbol(Symbol::Type type, uint32_t address,
         symbol = new Symbol(Symbol::Type::kVariable, this, address);
         break;
     }
-    map_[address] = symbol;
-    list_.emplace_back(symbol);
+    AddSymbol(symbol);
     status = Symbol::Status::kNew;
   }
   global_lock.unlock();
@@ -124,11 +159,19 @@ Symbol::Status Module::DefineSymbol(Symbol* symbol) {
     symbol->set_status(Symbol::Status::kDefining);
     status = Symbol::Status::kNew;
   } else if (symbol->status() == Symbol::Status::kDefining) {
-    // Still defining, so spin.
+    // Still defining on another thread, so spin. With tiered compilation and
+    // the background compiler, this is often a short baseline translation
+    // that has raced the demand, so only yield at first rather than waiting
+    // for the sleep granularity.
+    uint32_t wait_count = 0;
     do {
       global_lock.unlock();
-      // TODO(benvanik): sleep for less time?
-      xe::threading::Sleep(std::chrono::microseconds(100));
+      if (wait_count < kDefineSymbolYieldCount) {
+        ++wait_count;
+        xe::threading::MaybeYield();
+      } else {
+        xe::threading::Sleep(std::chrono::microseconds(100));
+      }
       global_lock.lock();
     } while (symbol->status() == Symbol::Status::kDefining);
     status = symbol->status();
@@ -173,6 +216,13 @@ size_t Module::QuerySymbolCount() {
   return list_.size();
 }
 
+const std::string& Module::InternSymbolName(const std::string_view name) {
+  auto global_lock = global_critical_region_.Acquire();
+  // There's no heterogeneous lookup in unordered containers in C++17, but
+  // symbol names are usually short enough not to allocate.
+  return *symbol_names_.insert(std::string(name)).first;
+}
+
 bool Module::ReadMap(const char* file_name) {
   std::ifstream infile(file_name);
 
@@ -13,7 +13,9 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "xenia/base/mutex.h"
@@ -31,12 +33,19 @@ class Module {
   explicit Module(Processor* processor);
   virtual ~Module();
 
+  Processor* processor() const { return processor_; }
   Memory* memory() const { return memory_; }
 
   virtual const std::string& name() const = 0;
   virtual bool is_executable() const = 0;
 
   virtual bool ContainsAddress(uint32_t address);
+  // Returns the contiguous [low, high) guest range ContainsAddress matches, if
+  // the module has one, so the processor can index modules by address.
+  virtual bool GetAddressRange(uint32_t* out_low_address,
+                               uint32_t* out_high_address) {
+    return false;
+  }
 
   Symbol* LookupSymbol(uint32_t address, bool wait = true);
   virtual Symbol::Status DeclareFunction(uint32_t address,
@@ -53,6 +62,10 @@ class Module {
 
   bool ReadMap(const char* file_name);
 
+  // Returns the module's single copy of the name, which stays valid for the
+  // lifetime of the module.
+  const std::string& InternSymbolName(const std::string_view name);
+
  protected:
   virtual std::unique_ptr<Function> CreateFunction(uint32_t address) = 0;
 
@@ -60,14 +73,37 @@ class Module {
   Memory* memory_ = nullptr;
 
  private:
+  // Yields while waiting for another thread to define a symbol before
+  // falling back to sleeping.
+  static constexpr uint32_t kDefineSymbolYieldCount = 256;
+
   Symbol::Status DeclareSymbol(Symbol::Type type, uint32_t address,
                                Symbol** out_symbol);
   Symbol::Status DefineSymbol(Symbol* symbol);
 
+  // Address lookup entry referencing a symbol in list_.
+  struct SymbolIndexEntry {
+    uint32_t address;
+    uint32_t list_index;
+  };
+  // New symbols are inserted into the small recent_symbol_index_ first, which
+  // is merged into symbol_index_ when it reaches this size, so declaring many
+  // symbols doesn't move the entire large index every time.
+  static constexpr size_t kRecentSymbolIndexMaxSize = 1024;
+
+  // Must be called with global_critical_region_ held.
+  Symbol* FindSymbol(uint32_t address) const;
+  void AddSymbol(Symbol* symbol);
+
   xe::global_critical_region global_critical_region_;
-  // TODO(benvanik): replace with a better data structure.
-  std::unordered_map<uint32_t, Symbol*> map_;
+  // Both sorted by the address. Dense arrays of 8-byte entries rather than a
+  // node-based map, as modules may contain hundreds of thousands of symbols.
+  std::vector<SymbolIndexEntry> symbol_index_;
+  std::vector<SymbolIndexEntry> recent_symbol_index_;
   std::vector<std::unique_ptr<Symbol>> list_;
+  // Protected by global_critical_region_. Node-based, so the strings are never
+  // moved.
+  std::unordered_set<std::string> symbol_names_;
 };
 
 }  // namespace cpu
@@ -10,6 +10,7 @@
 #ifndef XENIA_CPU_PPC_PPC_CONTEXT_H_
 #define XENIA_CPU_PPC_PPC_CONTEXT_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <mutex>
 #include <string>
@@ -253,18 +254,16 @@ typedef struct PPCContext_s {
   // TODO(benvanik): this is getting nasty. Must be here.
   uint8_t* virtual_membase;  // 0x8
 
-  // Most frequently used registers first.
-  uint64_t lr;      // 0x10 Link register
-  uint64_t ctr;     // 0x18 Count register
-  uint64_t r[32];   // 0x20 General purpose registers
-  double f[32];     // 0x120 Floating-point registers
-  vec128_t v[128];  // 0x220 VMX128 vector registers
-
-  // XER register:
-  // Split to make it easier to do individual updates.
-  uint8_t xer_ca;  // 0xA20
-  uint8_t xer_ov;  // 0xA21
-  uint8_t xer_so;  // 0xA22
+  // Hot fields are packed into as few cache lines as possible, as every
+  // LOAD_CONTEXT and STORE_CONTEXT goes through them (the context is 64-byte
+  // aligned): the link, count and condition registers share the first line,
+  // r1-r12 are in the next two, and XER, VSCR[SAT], the FPSCR, the
+  // reservation, the extern scratch and the code epoch are in the line after
+  // the GPRs. Everything only refers to the fields by offsetof, so this
+  // struct is the single description of the layout - changing it only
+  // invalidates the code in the persistent code storage.
+  uint64_t lr;   // 0x10 Link register
+  uint64_t ctr;  // 0x18 Count register
 
   // Condition registers:
   // These are split to make it easier to do DCE on unused stores.
@@ -279,7 +278,7 @@ typedef struct PPCContext_s {
                        // successfully
       uint8_t cr0_so;  // Summary Overflow (SO) - copy of XER[SO]
     };
-  } cr0;  // 0xA24
+  } cr0;  // 0x20
   union {
     uint32_t value;
     struct {
@@ -345,6 +344,15 @@ typedef struct PPCContext_s {
     };
   } cr7;
 
+  uint64_t r[32];  // 0x40 General purpose registers
+
+  // XER register:
+  // Split to make it easier to do individual updates.
+  uint8_t xer_ca;  // 0x140
+  uint8_t xer_ov;  // 0x141
+  uint8_t xer_so;  // 0x142
+  uint8_t vscr_sat;  // 0x143
+
   union {
     uint32_t value;
     struct {
@@ -393,9 +401,7 @@ typedef struct PPCContext_s {
       uint32_t
           fx : 1;  // FP exception summary                             -- sticky
     } bits;
-  } fpscr;  // Floating-point status and control register
-
-  uint8_t vscr_sat;
+  } fpscr;  // 0x144 Floating-point status and control register
 
   // uint32_t get_fprf() {
   //   return fpscr.value & 0x000F8000;
@@ -404,16 +410,42 @@ typedef struct PPCContext_s {
   //   fpscr.value = (fpscr.value & ~0x000F8000) | v;
   // }
 
+  // Reservation of the last reserved load (lwarx, ldarx) of the thread - the
+  // loaded value and the zero-extended 32-bit address, or
+  // kReservedAddressNone after a conditional store (stwcx., stdcx.) has lost
+  // it, which it does whether it succeeds or not.
+  static constexpr uint64_t kReservedAddressNone = UINT64_MAX;
+  uint64_t reserved_val;
+  uint64_t reserved_address;
+
+  // Used to shuttle data into externs. Contents volatile.
+  uint64_t scratch;
+
+  // Code epoch of the backend that the thread has last seen when passing a
+  // safe point in the generated code, or 0 while it's in host code called from
+  // the generated code. Replaced generated code is freed only after all threads
+  // have seen an epoch started after that code has become unreachable.
+  uint64_t code_epoch;
+
+  // Rarely accessed fields filling the rest of the cache line.
+
   // Thread ID assigned to this context.
   uint32_t thread_id;
 
+  // Counters of the events in the generated code executed by the thread (see
+  // X64Backend::InstrumentationCounter), or null if instrumentation is
+  // disabled.
+  uint64_t* instrumentation_counters;
+
+  uint8_t* physical_membase;
+
+  double f[32];     // 0x180 Floating-point registers
+  vec128_t v[128];  // 0x280 VMX128 vector registers
+
   // Global interrupt lock, held while interrupts are disabled or interrupts are
   // executing. This is shared among all threads and comes from the processor.
   std::recursive_mutex* global_mutex;
 
-  // Used to shuttle data into externs. Contents volatile.
-  uint64_t scratch;
-
   // Processor-specific data pointer. Used on callbacks to get access to the
   // current runtime and its data.
   Processor* processor;
@@ -421,10 +453,8 @@ typedef struct PPCContext_s {
   // Shared kernel state, for easy access from kernel exports.
   xe::kernel::KernelState* kernel_state;
 
-  uint8_t* physical_membase;
-
-  // Value of last reserved load
-  uint64_t reserved_val;
+  // Keeps the size a multiple of 64 bytes.
+  uint8_t padding[40];
 
   static std::string GetRegisterName(PPCRegister reg);
   std::string GetStringFromValue(PPCRegister reg) const;
@@ -436,6 +466,17 @@ typedef struct PPCContext_s {
 } PPCContext;
 #pragma pack(pop)
 static_assert(sizeof(PPCContext) % 64 == 0, "64b padded");
+static_assert(offsetof(PPCContext, thread_state) == 0x0 &&
+                  offsetof(PPCContext, virtual_membase) == 0x8,
+              "Thunks and generated code access these at fixed offsets");
+static_assert(offsetof(PPCContext, cr7) + sizeof(uint32_t) <= 0x40,
+              "LR, CTR and CR in the first cache line");
+static_assert(offsetof(PPCContext, r) % 0x40 == 0,
+              "GPRs r1-r12 in 2 cache lines");
+static_assert(offsetof(PPCContext, xer_ca) / 0x40 ==
+                  (offsetof(PPCContext, code_epoch) + sizeof(uint64_t) - 1) /
+                      0x40,
+              "Hot special registers in one cache line");
 
 }  // namespace ppc
 }  // namespace cpu
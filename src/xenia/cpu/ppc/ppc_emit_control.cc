@@ -85,6 +85,19 @@ int InstrEmit_branch(PPCHIRBuilder& f, const char* src, uint64_t cia,
         f.Call(function, call_flags);
       }
     }
+  } else if (!lk && nia_is_lr && f.inline_return_label()) {
+    // Return from an inlined function to the call site, LR is known to be
+    // the address after the call.
+    Label* label = f.inline_return_label();
+    if (cond) {
+      if (expect_true) {
+        f.BranchTrue(cond, label);
+      } else {
+        f.BranchFalse(cond, label);
+      }
+    } else {
+      f.Branch(label);
+    }
   } else {
 // Indirect branch to pointer.
 
@@ -205,7 +218,7 @@ int InstrEmit_bcx(PPCHIRBuilder& f, const InstrData& i) {
   if (select_bits(i.B.BO, 4, 4)) {
     // Ignore cond.
   } else {
-    Value* cr = f.LoadCRField(i.B.BI >> 2, i.B.BI & 3);
+    Value* cr = f.LoadCRFieldBranchCondition(i.B.BI >> 2, i.B.BI & 3);
     cond_ok = cr;
     if (select_bits(i.B.BO, 3, 3)) {
       // Expect true.
@@ -759,16 +759,14 @@ int InstrEmit_ldarx(PPCHIRBuilder& f, const InstrData& i) {
   // RESERVE_ADDR <- real_addr(EA)
   // RT <- MEM(EA, 8)
 
-  // NOTE: we assume we are within a global lock.
-  // We could assert here that the block (or its parent) has taken a global lock
-  // already, but I haven't see anything but interrupt callbacks (which are
-  // always under a global lock) do that yet.
+  // The reservation is emulated per thread (see PPCHIRBuilder::StoreReserved),
+  // no lock needs to be held.
   // We issue a memory barrier here to make sure that we get good values.
   f.MemoryBarrier();
 
   Value* ea = CalculateEA_0(f, i.X.RA, i.X.RB);
   Value* rt = f.ByteSwap(f.Load(ea, INT64_TYPE));
-  f.StoreReserved(rt);
+  f.StoreReserved(ea, rt);
   f.StoreGPR(i.X.RT, rt);
   return 0;
 }
@@ -784,16 +782,14 @@ int InstrEmit_lwarx(PPCHIRBuilder& f, const InstrData& i) {
   // RESERVE_ADDR <- real_addr(EA)
   // RT <- i32.0 || MEM(EA, 4)
 
-  // NOTE: we assume we are within a global lock.
-  // We could assert here that the block (or its parent) has taken a global lock
-  // already, but I haven't see anything but interrupt callbacks (which are
-  // always under a global lock) do that yet.
+  // The reservation is emulated per thread (see PPCHIRBuilder::StoreReserved),
+  // no lock needs to be held.
   // We issue a memory barrier here to make sure that we get good values.
   f.MemoryBarrier();
 
   Value* ea = CalculateEA_0(f, i.X.RA, i.X.RB);
   Value* rt = f.ZeroExtend(f.ByteSwap(f.Load(ea, INT32_TYPE)), INT64_TYPE);
-  f.StoreReserved(rt);
+  f.StoreReserved(ea, rt);
   f.StoreGPR(i.X.RT, rt);
   return 0;
 }
@@ -809,18 +805,21 @@ int InstrEmit_stdcx(PPCHIRBuilder& f, const InstrData& i) {
   // n <- 1 if store performed
   // CR0[LT GT EQ SO] = 0b00 || n || XER[SO]
 
-  // NOTE: we assume we are within a global lock.
-  // As we have been exclusively executing this entire time, we assume that no
-  // one else could have possibly touched the memory and must always succeed.
-  // We use atomic compare exchange here to support reserved load/store without
-  // being under the global lock (flag disable_global_lock - see mtmsr/mtmsrd).
-  // This will always succeed if under the global lock, however.
-
+  // Fails without storing if the reservation has been lost or is for another
+  // address. Otherwise, the store is done only if the memory still contains
+  // the reserved value, atomically, so other threads can do reserved loads and
+  // stores concurrently without a lock.
+  auto end_label = f.NewLabel();
+  f.StoreContext(offsetof(PPCContext, cr0.cr0_eq), f.LoadZeroInt8());
+  f.BranchFalse(f.ConsumeReservation(CalculateEA_0(f, i.X.RA, i.X.RB)),
+                end_label);
+  // The values are recalculated because a new block has started.
   Value* ea = CalculateEA_0(f, i.X.RA, i.X.RB);
   Value* rt = f.ByteSwap(f.LoadGPR(i.X.RT));
   Value* res = f.ByteSwap(f.LoadReserved());
   Value* v = f.AtomicCompareExchange(ea, res, rt);
   f.StoreContext(offsetof(PPCContext, cr0.cr0_eq), v);
+  f.MarkLabel(end_label);
   f.StoreContext(offsetof(PPCContext, cr0.cr0_lt), f.LoadZeroInt8());
   f.StoreContext(offsetof(PPCContext, cr0.cr0_gt), f.LoadZeroInt8());
 
@@ -842,18 +841,21 @@ int InstrEmit_stwcx(PPCHIRBuilder& f, const InstrData& i) {
   // n <- 1 if store performed
   // CR0[LT GT EQ SO] = 0b00 || n || XER[SO]
 
-  // NOTE: we assume we are within a global lock.
-  // As we have been exclusively executing this entire time, we assume that no
-  // one else could have possibly touched the memory and must always succeed.
-  // We use atomic compare exchange here to support reserved load/store without
-  // being under the global lock (flag disable_global_lock - see mtmsr/mtmsrd).
-  // This will always succeed if under the global lock, however.
-
+  // Fails without storing if the reservation has been lost or is for another
+  // address. Otherwise, the store is done only if the memory still contains
+  // the reserved value, atomically, so other threads can do reserved loads and
+  // stores concurrently without a lock.
+  auto end_label = f.NewLabel();
+  f.StoreContext(offsetof(PPCContext, cr0.cr0_eq), f.LoadZeroInt8());
+  f.BranchFalse(f.ConsumeReservation(CalculateEA_0(f, i.X.RA, i.X.RB)),
+                end_label);
+  // The values are recalculated because a new block has started.
   Value* ea = CalculateEA_0(f, i.X.RA, i.X.RB);
   Value* rt = f.ByteSwap(f.Truncate(f.LoadGPR(i.X.RT), INT32_TYPE));
   Value* res = f.ByteSwap(f.Truncate(f.LoadReserved(), INT32_TYPE));
   Value* v = f.AtomicCompareExchange(ea, res, rt);
   f.StoreContext(offsetof(PPCContext, cr0.cr0_eq), v);
+  f.MarkLabel(end_label);
   f.StoreContext(offsetof(PPCContext, cr0.cr0_lt), f.LoadZeroInt8());
   f.StoreContext(offsetof(PPCContext, cr0.cr0_gt), f.LoadZeroInt8());
 
@@ -10,7 +10,9 @@
 #include "xenia/cpu/ppc/ppc_frontend.h"
 
 #include "xenia/base/atomic.h"
+#include "xenia/base/clock.h"
 #include "xenia/base/logging.h"
+#include "xenia/base/mutex.h"
 #include "xenia/cpu/ppc/ppc_context.h"
 #include "xenia/cpu/ppc/ppc_emit.h"
 #include "xenia/cpu/ppc/ppc_opcode_info.h"
@@ -64,9 +66,10 @@ void CheckGlobalLock(PPCContext* ppc_context, void* arg0, void* arg1) {
 
 // Enters the global lock. Safe to recursion.
 void EnterGlobalLock(PPCContext* ppc_context, void* arg0, void* arg1) {
-  auto global_mutex = reinterpret_cast<std::recursive_mutex*>(arg0);
+  // arg0 is the mutex of the global critical region, locked through the region
+  // for contention tracking.
   auto global_lock_count = reinterpret_cast<int32_t*>(arg1);
-  global_mutex->lock();
+  xe::global_critical_region::LockMutex();
   xe::atomic_inc(global_lock_count);
 }
 
@@ -114,13 +117,23 @@ bool PPCFrontend::DeclareFunction(GuestFunction* function) {
 }
 
 bool PPCFrontend::DefineFunction(GuestFunction* function,
-                                 uint32_t debug_info_flags) {
+                                 uint32_t debug_info_flags, bool optimize) {
+  uint64_t start_time = Clock::QueryHostTickCount();
   auto translator = translator_pool_.Allocate(this);
-  bool result = translator->Translate(function, debug_info_flags);
+  bool result = translator->Translate(function, debug_info_flags, optimize);
   translator_pool_.Release(translator);
+  translation_time_total_.fetch_add(Clock::QueryHostTickCount() - start_time,
+                                    std::memory_order_relaxed);
+  translation_count_.fetch_add(1, std::memory_order_relaxed);
   return result;
 }
 
+uint64_t PPCFrontend::QueryTranslationTimeMicros() const {
+  uint64_t ticks = translation_time_total_.load(std::memory_order_relaxed);
+  uint64_t frequency = Clock::QueryHostTickFrequency();
+  return ticks / frequency * 1000000 + ticks % frequency * 1000000 / frequency;
+}
+
 }  // namespace ppc
 }  // namespace cpu
 }  // namespace xe
@@ -10,6 +10,7 @@
 #ifndef XENIA_CPU_PPC_PPC_FRONTEND_H_
 #define XENIA_CPU_PPC_PPC_FRONTEND_H_
 
+#include <atomic>
 #include <memory>
 
 #include "xenia/base/type_pool.h"
@@ -48,12 +49,24 @@ class PPCFrontend {
   PPCBuiltins* builtins() { return &builtins_; }
 
   bool DeclareFunction(GuestFunction* function);
-  bool DefineFunction(GuestFunction* function, uint32_t debug_info_flags);
+  bool DefineFunction(GuestFunction* function, uint32_t debug_info_flags,
+                      bool optimize = false);
+
+  // Totals of the translations done by DefineFunction, including the failed
+  // ones and the retranslations, for statistics.
+  uint64_t translation_count() const {
+    return translation_count_.load(std::memory_order_relaxed);
+  }
+  uint64_t QueryTranslationTimeMicros() const;
 
  private:
   Processor* processor_;
   PPCBuiltins builtins_ = {0};
   TypePool<PPCTranslator, PPCFrontend*> translator_pool_;
+
+  std::atomic<uint64_t> translation_count_ = {0};
+  // In host ticks.
+  std::atomic<uint64_t> translation_time_total_ = {0};
 };
 
 }  // namespace ppc
@@ -20,6 +20,7 @@
 #include "xenia/base/memory.h"
 #include "xenia/base/profiling.h"
 #include "xenia/base/string.h"
+#include "xenia/cpu/breakpoint.h"
 #include "xenia/cpu/cpu_flags.h"
 #include "xenia/cpu/hir/label.h"
 #include "xenia/cpu/ppc/ppc_context.h"
@@ -27,6 +28,7 @@
 #include "xenia/cpu/ppc/ppc_frontend.h"
 #include "xenia/cpu/ppc/ppc_opcode_info.h"
 #include "xenia/cpu/processor.h"
+#include "xenia/cpu/routine_signatures.h"
 
 DEFINE_bool(
     break_on_unimplemented_instructions, true,
@@ -78,15 +80,21 @@ void PPCHIRBuilder::Reset() {
   instr_count_ = 0;
   instr_offset_list_ = NULL;
   label_list_ = NULL;
+  decoded_instrs_ = nullptr;
+  inline_entry_label_ = nullptr;
+  inline_return_label_ = nullptr;
+  inline_call_address_ = 0;
+  inlined_functions_.clear();
+  std::memset(cr_field_compares_, 0, sizeof(cr_field_compares_));
   with_debug_info_ = false;
   HIRBuilder::Reset();
 }
 
-bool PPCHIRBuilder::Emit(GuestFunction* function, uint32_t flags) {
+bool PPCHIRBuilder::Emit(GuestFunction* function, uint32_t flags,
+                         const PPCDecodedInstr* decoded_instrs,
+                         Function* replacement) {
   SCOPE_profile_cpu_f("cpu");
 
-  Memory* memory = frontend_->memory();
-
   function_ = function;
   start_address_ = function_->address();
   instr_count_ = (function_->end_address() - function_->address()) / 4 + 1;
@@ -98,6 +106,27 @@ bool PPCHIRBuilder::Emit(GuestFunction* function, uint32_t flags) {
                   function_->name().c_str());
   }
 
+  if (replacement) {
+    // The builtin sets the scratch register if it has handled the call.
+    CallExtern(replacement);
+    ReturnTrue(LoadContext(offsetof(PPCContext, scratch), INT64_TYPE));
+  }
+
+  // Inlined functions are emitted later, during compilation.
+  decoded_instrs_ = decoded_instrs;
+  EmitInstructions();
+  decoded_instrs_ = nullptr;
+
+  if (false) {
+    DumpAllOpcodeCounts();
+  }
+
+  return Finalize();
+}
+
+void PPCHIRBuilder::EmitInstructions() {
+  Memory* memory = frontend_->memory();
+
   // Allocate offset list.
   // This is used to quickly map labels to instructions.
   // The list is built as the instructions are traversed, with the values
@@ -111,16 +140,22 @@ bool PPCHIRBuilder::Emit(GuestFunction* function, uint32_t flags) {
   std::memset(label_list_, 0, list_size);
 
   // Always mark entry with label.
-  label_list_[0] = NewLabel();
+  label_list_[0] = inline_entry_label_ ? inline_entry_label_ : NewLabel();
 
   uint32_t start_address = function_->address();
   uint32_t end_address = function_->end_address();
   for (uint32_t address = start_address, offset = 0; address <= end_address;
        address += 4, offset++) {
     trace_info_.dest_count = 0;
-    uint32_t code =
-        xe::load_and_swap<uint32_t>(memory->TranslateVirtual(address));
-    auto opcode = LookupOpcode(code);
+    uint32_t code;
+    PPCOpcode opcode;
+    if (decoded_instrs_) {
+      code = decoded_instrs_[offset].code;
+      opcode = decoded_instrs_[offset].opcode;
+    } else {
+      code = xe::load_and_swap<uint32_t>(memory->TranslateVirtual(address));
+      opcode = LookupOpcode(code);
+    }
     auto& opcode_info = GetOpcodeInfo(opcode);
 
     // Mark label, if we were assigned one earlier on in the walk.
@@ -136,16 +171,22 @@ bool PPCHIRBuilder::Emit(GuestFunction* function, uint32_t flags) {
       if (label) {
         AnnotateLabel(address, label);
       }
+      if (inline_entry_label_ && !offset) {
+        CommentFormat("inlined {:08X}-{:08X} {}", function_->address(),
+                      function_->end_address(), function_->name().c_str());
+      }
       comment_buffer_.Reset();
       comment_buffer_.AppendFormat("{:08X} {:08X} ", address, code);
-      DisasmPPC(address, code, &comment_buffer_);
+      DisasmPPC(address, code, opcode, &comment_buffer_);
       Comment(comment_buffer_);
       first_instr = last_instr();
     }
 
     // Mark source offset for debugging.
     // We could omit this if we never wanted to debug.
-    SourceOffset(address);
+    // Inlined code has no frame of its own, so it's attributed to the call
+    // site for stack walking.
+    SourceOffset(inline_entry_label_ ? inline_call_address_ : address);
     if (!first_instr) {
       first_instr = last_instr();
     }
@@ -169,6 +210,7 @@ bool PPCHIRBuilder::Emit(GuestFunction* function, uint32_t flags) {
     }
 
     MaybeBreakOnInstruction(address);
+    EmitCompiledBreakpoints(address);
 
     InstrData i;
     i.address = address;
@@ -187,12 +229,169 @@ bool PPCHIRBuilder::Emit(GuestFunction* function, uint32_t flags) {
       }
     }
   }
+}
 
-  if (false) {
-    DumpAllOpcodeCounts();
+uint32_t PPCHIRBuilder::GetInlinableInstructionCount(Function* function,
+                                                    bool is_tail_call,
+                                                    bool allow_exits) {
+  assert_true(is_tail_call || !allow_exits);
+  if (!function || !function->is_guest() ||
+      function->behavior() == Function::Behavior::kExtern ||
+      function == function_ || !function->has_end_address() ||
+      function->end_address() < function->address() ||
+      frontend_->processor()->HasCompiledBreakpoints(function->address(),
+                                                     function->end_address())) {
+    return 0;
   }
+  // Calls of the routines replaced with host implementations must stay calls.
+  if (cvars::replace_guest_routines &&
+      frontend_->processor()->routine_signatures()->FindReplacement(
+          static_cast<GuestFunction*>(function), false)) {
+    return 0;
+  }
+  Memory* memory = frontend_->memory();
+  uint32_t start_address = function->address();
+  uint32_t end_address = function->end_address();
+  for (uint32_t address = start_address; address <= end_address;
+       address += 4) {
+    uint32_t code =
+        xe::load_and_swap<uint32_t>(memory->TranslateVirtual(address));
+    auto opcode = LookupOpcode(code);
 
-  return Finalize();
+    PPCDecodeData d;
+    d.address = address;
+    d.code = code;
+
+    // Whether the instruction unconditionally leaves the function or loops
+    // within it, so it can be the last one.
+    bool is_unconditional_branch = false;
+    switch (opcode) {
+      case PPCOpcode::bcctrx:
+        // Indirect calls and tail calls.
+        if (!allow_exits) {
+          return 0;
+        }
+        is_unconditional_branch =
+            !d.XL.LK() && (d.XL.BO() & 0b10100) == 0b10100;
+        break;
+      case PPCOpcode::kInvalid:
+      case PPCOpcode::sc:
+      // Traps report the guest address of the instruction.
+      case PPCOpcode::td:
+      case PPCOpcode::tdi:
+      case PPCOpcode::tw:
+      case PPCOpcode::twi:
+        return 0;
+      case PPCOpcode::bx:
+        // Only local branches, no calls, unless exits are allowed.
+        if (!allow_exits && (d.I.LK() || d.I.ADDR() < start_address ||
+                             d.I.ADDR() > end_address)) {
+          return 0;
+        }
+        is_unconditional_branch = !d.I.LK();
+        break;
+      case PPCOpcode::bcx:
+        if (!allow_exits && (d.B.LK() || d.B.ADDR() < start_address ||
+                             d.B.ADDR() > end_address)) {
+          return 0;
+        }
+        is_unconditional_branch =
+            !d.B.LK() && (d.B.BO() & 0b10100) == 0b10100;
+        break;
+      case PPCOpcode::bclrx:
+        if (d.XL.LK() && !allow_exits) {
+          return 0;
+        }
+        is_unconditional_branch =
+            !d.XL.LK() && (d.XL.BO() & 0b10100) == 0b10100;
+        break;
+      case PPCOpcode::mtspr:
+        // With LR modified, returns don't go back to the call site.
+        if (!is_tail_call && d.XFX.TBR() == 8) {
+          return 0;
+        }
+        break;
+      default:
+        break;
+    }
+    // Must not fall through past the end of the function - the last
+    // instruction must be an unconditional blr, or with exits allowed, any
+    // unconditional branch.
+    if (address == end_address &&
+        (!is_unconditional_branch ||
+         (!allow_exits && opcode != PPCOpcode::bclrx))) {
+      return 0;
+    }
+  }
+  return (end_address - start_address) / 4 + 1;
+}
+
+void PPCHIRBuilder::EmitInlined(Function* function, uint32_t call_address,
+                                Label* entry_label, Label* return_label) {
+  assert_not_zero(
+      GetInlinableInstructionCount(function, !return_label, !return_label));
+
+  GuestFunction* caller = function_;
+  uint64_t caller_start_address = start_address_;
+  uint64_t caller_instr_count = instr_count_;
+  Instr** caller_instr_offset_list = instr_offset_list_;
+  Label** caller_label_list = label_list_;
+
+  function_ = static_cast<GuestFunction*>(function);
+  inlined_functions_.push_back(function_);
+  start_address_ = function_->address();
+  instr_count_ = (function_->end_address() - function_->address()) / 4 + 1;
+  inline_entry_label_ = entry_label;
+  inline_return_label_ = return_label;
+  inline_call_address_ = call_address;
+
+  EmitInstructions();
+
+  function_ = caller;
+  start_address_ = caller_start_address;
+  instr_count_ = caller_instr_count;
+  instr_offset_list_ = caller_instr_offset_list;
+  label_list_ = caller_label_list;
+  inline_entry_label_ = nullptr;
+  inline_return_label_ = nullptr;
+  inline_call_address_ = 0;
+
+  // Add fall-through branches within the inlined code.
+  Finalize();
+}
+
+Value* PPCHIRBuilder::EmitBreakpointCondition(
+    const BreakpointCondition& condition) {
+  auto left = LoadGPR(condition.gpr);
+  auto right = LoadConstantUint64(condition.value);
+  if (condition.truncate) {
+    left = Truncate(left, INT32_TYPE);
+    right = Truncate(right, INT32_TYPE);
+  }
+  switch (condition.op) {
+    case BreakpointCondition::Op::kEqual:
+      return CompareEQ(left, right);
+    case BreakpointCondition::Op::kNotEqual:
+      return CompareNE(left, right);
+    case BreakpointCondition::Op::kSignedLess:
+      return CompareSLT(left, right);
+    case BreakpointCondition::Op::kSignedLessEqual:
+      return CompareSLE(left, right);
+    case BreakpointCondition::Op::kSignedGreater:
+      return CompareSGT(left, right);
+    case BreakpointCondition::Op::kSignedGreaterEqual:
+      return CompareSGE(left, right);
+    case BreakpointCondition::Op::kUnsignedLess:
+      return CompareULT(left, right);
+    case BreakpointCondition::Op::kUnsignedLessEqual:
+      return CompareULE(left, right);
+    case BreakpointCondition::Op::kUnsignedGreater:
+      return CompareUGT(left, right);
+    case BreakpointCondition::Op::kUnsignedGreaterEqual:
+      return CompareUGE(left, right);
+  }
+  assert_unhandled_case(condition.op);
+  return CompareEQ(left, right);
 }
 
 void PPCHIRBuilder::MaybeBreakOnInstruction(uint32_t address) {
@@ -207,37 +406,47 @@ void PPCHIRBuilder::MaybeBreakOnInstruction(uint32_t address) {
     return;
   }
 
-  auto left = LoadGPR(cvars::break_condition_gpr);
-  auto right = LoadConstantUint64(cvars::break_condition_value);
-  if (cvars::break_condition_truncate) {
-    left = Truncate(left, INT32_TYPE);
-    right = Truncate(right, INT32_TYPE);
+  BreakpointCondition condition;
+  condition.gpr = cvars::break_condition_gpr;
+  condition.value = cvars::break_condition_value;
+  condition.truncate = cvars::break_condition_truncate;
+  if (!BreakpointCondition::ParseOp(cvars::break_condition_op,
+                                    condition.op)) {
+    assert_always();
+    return;
   }
+  TrapTrue(EmitBreakpointCondition(condition));
+}
 
-  auto op = cvars::break_condition_op.c_str();
-  // TODO(rick): table?
-  if (xe_strcasecmp(op, "eq") == 0) {
-    TrapTrue(CompareEQ(left, right));
-  } else if (xe_strcasecmp(op, "ne") == 0) {
-    TrapTrue(CompareNE(left, right));
-  } else if (xe_strcasecmp(op, "slt") == 0) {
-    TrapTrue(CompareSLT(left, right));
-  } else if (xe_strcasecmp(op, "sle") == 0) {
-    TrapTrue(CompareSLE(left, right));
-  } else if (xe_strcasecmp(op, "sgt") == 0) {
-    TrapTrue(CompareSGT(left, right));
-  } else if (xe_strcasecmp(op, "sge") == 0) {
-    TrapTrue(CompareSGE(left, right));
-  } else if (xe_strcasecmp(op, "ult") == 0) {
-    TrapTrue(CompareULT(left, right));
-  } else if (xe_strcasecmp(op, "ule") == 0) {
-    TrapTrue(CompareULE(left, right));
-  } else if (xe_strcasecmp(op, "ugt") == 0) {
-    TrapTrue(CompareUGT(left, right));
-  } else if (xe_strcasecmp(op, "uge") == 0) {
-    TrapTrue(CompareUGE(left, right));
-  } else {
-    assert_always();
+void PPCHIRBuilder::EmitCompiledBreakpoints(uint32_t address) {
+  // The traps of inlined code would be attributed to the call site, so
+  // functions with compiled breakpoints are not inlined.
+  if (inline_entry_label_) {
+    return;
+  }
+  for (const CompiledBreakpoint* breakpoint :
+       frontend_->processor()->GetCompiledBreakpoints(address)) {
+    if (with_debug_info_) {
+      Comment(breakpoint->is_tracepoint ? "compiled tracepoint"
+                                        : "compiled breakpoint");
+    }
+    // Only the passing checks leave the generated code. The registers must be
+    // in the context for the tracepoint records and the debugger.
+    ContextBarrier();
+    Label* skip_label = nullptr;
+    if (breakpoint->condition.gpr >= 0) {
+      skip_label = NewLabel();
+      BranchFalse(EmitBreakpointCondition(breakpoint->condition), skip_label,
+                  BRANCH_UNLIKELY);
+    }
+    CallExtern(breakpoint->hit_function);
+    if (!breakpoint->is_tracepoint) {
+      TrapTrue(LoadContext(offsetof(PPCContext, scratch), INT64_TYPE),
+               TRAP_DEBUGGER_BREAK);
+    }
+    if (skip_label) {
+      MarkLabel(skip_label);
+    }
   }
 }
 
@@ -357,6 +566,45 @@ Value* PPCHIRBuilder::LoadCRField(uint32_t n, uint32_t bit) {
   return LoadContext(offsetof(PPCContext, cr0) + (4 * n) + bit, INT8_TYPE);
 }
 
+Value* PPCHIRBuilder::LoadCRFieldBranchCondition(uint32_t n, uint32_t bit) {
+  // The stores of UpdateCR are still done for other readers, such as mfcr,
+  // and removed as dead if overwritten first.
+  if (bit > 2 || !IsCRFieldCompareCurrent(n)) {
+    return LoadCRField(n, bit);
+  }
+  const CRFieldCompare& compare = cr_field_compares_[n];
+  switch (bit) {
+    case 0:
+      return compare.is_signed ? CompareSLT(compare.lhs, compare.rhs)
+                               : CompareULT(compare.lhs, compare.rhs);
+    case 1:
+      return compare.is_signed ? CompareSGT(compare.lhs, compare.rhs)
+                               : CompareUGT(compare.lhs, compare.rhs);
+    default:
+      return CompareEQ(compare.lhs, compare.rhs);
+  }
+}
+
+bool PPCHIRBuilder::IsCRFieldCompareCurrent(uint32_t n) const {
+  const CRFieldCompare& compare = cr_field_compares_[n];
+  if (!compare.last_store || compare.last_store->block != current_block()) {
+    return false;
+  }
+  size_t field_offset = offsetof(PPCContext, cr0) + (4 * n);
+  for (const Instr* i = compare.last_store->next; i; i = i->next) {
+    if (i->opcode->flags & (OPCODE_FLAG_BRANCH | OPCODE_FLAG_VOLATILE) ||
+        i->opcode == &OPCODE_CONTEXT_BARRIER_info) {
+      return false;
+    }
+    if (i->opcode == &OPCODE_STORE_CONTEXT_info &&
+        i->src1.offset < field_offset + 4 &&
+        i->src1.offset + GetTypeSize(i->src2.value->type) > field_offset) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void PPCHIRBuilder::StoreCR(Value* value) {
   // All bits. This is expensive, but seems to be less used than the
   // field-specific StoreCR.
@@ -408,6 +656,12 @@ void PPCHIRBuilder::UpdateCR(uint32_t n, Value* lhs, Value* rhs,
   Value* eq = CompareEQ(lhs, rhs);
   StoreContext(offsetof(PPCContext, cr0) + (4 * n) + 2, eq);
 
+  CRFieldCompare& compare = cr_field_compares_[n];
+  compare.last_store = last_instr();
+  compare.lhs = lhs;
+  compare.rhs = rhs;
+  compare.is_signed = is_signed;
+
   // Value* so = AllocValue(UINT8_TYPE);
   // StoreContext(offsetof(PPCContext, cr) + (4 * n) + 3, so);
 
@@ -559,8 +813,11 @@ void PPCHIRBuilder::StoreVR(uint32_t reg, Value* value) {
   trace_reg.value = value;
 }
 
-void PPCHIRBuilder::StoreReserved(Value* val) {
+void PPCHIRBuilder::StoreReserved(Value* address, Value* val) {
   assert_true(val->type == INT64_TYPE);
+  // Memory is only accessed with the low 32 bits of the address.
+  StoreContext(offsetof(PPCContext, reserved_address),
+               ZeroExtend(Truncate(address, INT32_TYPE), INT64_TYPE));
   StoreContext(offsetof(PPCContext, reserved_val), val);
 }
 
@@ -568,6 +825,15 @@ Value* PPCHIRBuilder::LoadReserved() {
   return LoadContext(offsetof(PPCContext, reserved_val), INT64_TYPE);
 }
 
+Value* PPCHIRBuilder::ConsumeReservation(Value* address) {
+  Value* reserved_address =
+      LoadContext(offsetof(PPCContext, reserved_address), INT64_TYPE);
+  StoreContext(offsetof(PPCContext, reserved_address),
+               LoadConstantUint64(PPCContext::kReservedAddressNone));
+  return CompareEQ(reserved_address,
+                   ZeroExtend(Truncate(address, INT32_TYPE), INT64_TYPE));
+}
+
 }  // namespace ppc
 }  // namespace cpu
 }  // namespace xe
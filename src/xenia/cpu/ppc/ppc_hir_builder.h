@@ -10,12 +10,17 @@
 #ifndef XENIA_CPU_PPC_PPC_HIR_BUILDER_H_
 #define XENIA_CPU_PPC_PPC_HIR_BUILDER_H_
 
+#include <vector>
+
 #include "xenia/base/string_buffer.h"
 #include "xenia/cpu/function.h"
 #include "xenia/cpu/hir/hir_builder.h"
+#include "xenia/cpu/ppc/ppc_opcode_info.h"
 
 namespace xe {
 namespace cpu {
+struct BreakpointCondition;
+
 namespace ppc {
 
 struct PPCBuiltins;
@@ -38,7 +43,26 @@ class PPCHIRBuilder : public hir::HIRBuilder {
     // Emit comment nodes.
     EMIT_DEBUG_COMMENTS = 1 << 0,
   };
-  bool Emit(GuestFunction* function, uint32_t flags);
+  // If decoded_instrs is not null, it's the instructions of the function
+  // decoded by PPCScanner::Scan, otherwise they're decoded from the guest
+  // memory. If replacement is not null, it's the builtin implementing the
+  // function on the host, called before the guest code, which is executed only
+  // if the builtin can't handle the call.
+  bool Emit(GuestFunction* function, uint32_t flags,
+            const PPCDecodedInstr* decoded_instrs = nullptr,
+            Function* replacement = nullptr);
+
+  // Inlining support for InliningPass (see hir::HIRBuilder).
+  uint32_t GetInlinableInstructionCount(Function* function, bool is_tail_call,
+                                        bool allow_exits) override;
+  void EmitInlined(Function* function, uint32_t call_address,
+                   Label* entry_label, Label* return_label) override;
+  // Non-null while emitting an inlined non-tail call, returns branch here.
+  Label* inline_return_label() const { return inline_return_label_; }
+  // Functions inlined by EmitInlined since the last reset.
+  const std::vector<GuestFunction*>& inlined_functions() const {
+    return inlined_functions_;
+  }
 
   GuestFunction* function() const { return function_; }
   Function* LookupFunction(uint32_t address);
@@ -51,6 +75,10 @@ class PPCHIRBuilder : public hir::HIRBuilder {
   Value* LoadCR();
   Value* LoadCR(uint32_t n);
   Value* LoadCRField(uint32_t n, uint32_t bit);
+  // Like LoadCRField, but for a condition to branch on immediately. If the bit
+  // is still the result of the last compare in UpdateCR, the compare is
+  // repeated instead, so the backend can branch on the host flags it sets.
+  Value* LoadCRFieldBranchCondition(uint32_t n, uint32_t bit);
   void StoreCR(Value* value);
   void StoreCR(uint32_t n, Value* value);
   void StoreCRField(uint32_t n, uint32_t bit, Value* value);
@@ -78,12 +106,23 @@ class PPCHIRBuilder : public hir::HIRBuilder {
   Value* LoadVR(uint32_t reg);
   void StoreVR(uint32_t reg, Value* value);
 
-  void StoreReserved(Value* val);
+  // Reservations are emulated per thread without locking: a conditional
+  // store succeeds only for the address of the last reserved load, and, with a
+  // host atomic compare-exchange, only if the memory still contains the value
+  // loaded by it.
+  void StoreReserved(Value* address, Value* val);
   Value* LoadReserved();
+  // Returns whether the address is reserved, losing the reservation.
+  Value* ConsumeReservation(Value* address);
 
  private:
+  void EmitInstructions();
+  Value* EmitBreakpointCondition(const BreakpointCondition& condition);
   void MaybeBreakOnInstruction(uint32_t address);
+  // Checks of the conditional breakpoints and tracepoints of the instruction.
+  void EmitCompiledBreakpoints(uint32_t address);
   void AnnotateLabel(uint32_t address, Label* label);
+  bool IsCRFieldCompareCurrent(uint32_t n) const;
 
   PPCFrontend* frontend_;
 
@@ -97,6 +136,22 @@ class PPCHIRBuilder : public hir::HIRBuilder {
   uint64_t instr_count_;
   Instr** instr_offset_list_;
   Label** label_list_;
+  // Only for the function itself, not for the inlined ones.
+  const PPCDecodedInstr* decoded_instrs_ = nullptr;
+  // Set while emitting an inlined function.
+  Label* inline_entry_label_ = nullptr;
+  Label* inline_return_label_ = nullptr;
+  uint32_t inline_call_address_ = 0;
+  std::vector<GuestFunction*> inlined_functions_;
+  // Operands of the last UpdateCR of each CR field, current until the field
+  // may have been written again or the block has been left after last_store.
+  struct CRFieldCompare {
+    Instr* last_store;
+    Value* lhs;
+    Value* rhs;
+    bool is_signed;
+  };
+  CRFieldCompare cr_field_compares_[8];
 
   // Reset each instruction.
   struct {
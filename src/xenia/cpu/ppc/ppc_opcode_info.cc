@@ -16,7 +16,11 @@ namespace cpu {
 namespace ppc {
 
 bool DisasmPPC(uint32_t address, uint32_t code, StringBuffer* str) {
-  auto opcode = LookupOpcode(code);
+  return DisasmPPC(address, code, LookupOpcode(code), str);
+}
+
+bool DisasmPPC(uint32_t address, uint32_t code, PPCOpcode opcode,
+               StringBuffer* str) {
   if (opcode == PPCOpcode::kInvalid) {
     str->Append("DISASM ERROR");
     return false;
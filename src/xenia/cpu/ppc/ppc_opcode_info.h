@@ -146,6 +146,10 @@ struct PPCOpcodeDisasmInfo {
 };
 
 PPCOpcode LookupOpcode(uint32_t code);
+// Same as LookupOpcode, but walks dense tables indexed by the primary and the
+// extended opcode fields rather than nested switches (both are generated by
+// ppc-table-gen, see the decoder benchmark in the CPU tests).
+PPCOpcode LookupOpcodeTabular(uint32_t code);
 
 const PPCOpcodeInfo& GetOpcodeInfo(PPCOpcode opcode);
 const PPCOpcodeDisasmInfo& GetOpcodeDisasmInfo(PPCOpcode opcode);
@@ -157,7 +161,17 @@ inline const PPCOpcodeInfo& LookupOpcodeInfo(uint32_t code) {
   return GetOpcodeInfo(LookupOpcode(code));
 }
 
+// Guest instruction with its opcode looked up, so the passes over a function
+// after scanning it don't need to decode it again. The fields are extracted
+// from the code on access (see PPCDecodeData).
+struct PPCDecodedInstr {
+  uint32_t code;
+  PPCOpcode opcode;
+};
+
 bool DisasmPPC(uint32_t address, uint32_t code, StringBuffer* str);
+bool DisasmPPC(uint32_t address, uint32_t code, PPCOpcode opcode,
+               StringBuffer* str);
 
 }  // namespace ppc
 }  // namespace cpu
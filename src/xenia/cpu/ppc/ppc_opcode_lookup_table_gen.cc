@@ -0,0 +1,5263 @@
+// This code was autogenerated by ./tools/ppc-table-gen. Do not modify!
+// clang-format off
+#include <cstdint>
+#include <cstdlib>
+
+#include "xenia/cpu/ppc/ppc_opcode.h"
+#include "xenia/cpu/ppc/ppc_opcode_info.h"
+
+namespace xe {
+namespace cpu {
+namespace ppc {
+
+namespace {
+
+struct PrimaryEntry {
+  // The opcode if the primary opcode field identifies it alone.
+  uint16_t opcode;
+  uint8_t first_subtable;
+  uint8_t subtable_count;
+};
+struct SubtableEntry {
+  uint32_t first_opcode;
+  // The index in the subtable is up to two bit ranges of the code.
+  struct {
+    uint8_t shift;
+    uint8_t offset;
+    uint16_t mask;
+  } parts[2];
+};
+
+#define PPC_LOOKUP_PRIMARY(opcode, first_subtable, subtable_count) \
+    {uint16_t(PPCOpcode::opcode), first_subtable, subtable_count}
+const PrimaryEntry primary_table[64] = {
+  PPC_LOOKUP_PRIMARY(kInvalid, 0, 0),  // 0
+  PPC_LOOKUP_PRIMARY(kInvalid, 0, 0),  // 1
+  PPC_LOOKUP_PRIMARY(tdi, 0, 0),  // 2
+  PPC_LOOKUP_PRIMARY(twi, 0, 0),  // 3
+  PPC_LOOKUP_PRIMARY(kInvalid, 0, 5),  // 4
+  PPC_LOOKUP_PRIMARY(kInvalid, 5, 2),  // 5
+  PPC_LOOKUP_PRIMARY(kInvalid, 7, 5),  // 6
+  PPC_LOOKUP_PRIMARY(mulli, 0, 0),  // 7
+  PPC_LOOKUP_PRIMARY(subficx, 0, 0),  // 8
+  PPC_LOOKUP_PRIMARY(kInvalid, 0, 0),  // 9
+  PPC_LOOKUP_PRIMARY(cmpli, 0, 0),  // 10
+  PPC_LOOKUP_PRIMARY(cmpi, 0, 0),  // 11
+  PPC_LOOKUP_PRIMARY(addic, 0, 0),  // 12
+  PPC_LOOKUP_PRIMARY(addicx, 0, 0),  // 13
+  PPC_LOOKUP_PRIMARY(addi, 0, 0),  // 14
+  PPC_LOOKUP_PRIMARY(addis, 0, 0),  // 15
+  PPC_LOOKUP_PRIMARY(bcx, 0, 0),  // 16
+  PPC_LOOKUP_PRIMARY(sc, 0, 0),  // 17
+  PPC_LOOKUP_PRIMARY(bx, 0, 0),  // 18
+  PPC_LOOKUP_PRIMARY(kInvalid, 12, 1),  // 19
+  PPC_LOOKUP_PRIMARY(rlwimix, 0, 0),  // 20
+  PPC_LOOKUP_PRIMARY(rlwinmx, 0, 0),  // 21
+  PPC_LOOKUP_PRIMARY(kInvalid, 0, 0),  // 22
+  PPC_LOOKUP_PRIMARY(rlwnmx, 0, 0),  // 23
+  PPC_LOOKUP_PRIMARY(ori, 0, 0),  // 24
+  PPC_LOOKUP_PRIMARY(oris, 0, 0),  // 25
+  PPC_LOOKUP_PRIMARY(xori, 0, 0),  // 26
+  PPC_LOOKUP_PRIMARY(xoris, 0, 0),  // 27
+  PPC_LOOKUP_PRIMARY(andix, 0, 0),  // 28
+  PPC_LOOKUP_PRIMARY(andisx, 0, 0),  // 29
+  PPC_LOOKUP_PRIMARY(kInvalid, 13, 2),  // 30
+  PPC_LOOKUP_PRIMARY(kInvalid, 15, 4),  // 31
+  PPC_LOOKUP_PRIMARY(lwz, 0, 0),  // 32
+  PPC_LOOKUP_PRIMARY(lwzu, 0, 0),  // 33
+  PPC_LOOKUP_PRIMARY(lbz, 0, 0),  // 34
+  PPC_LOOKUP_PRIMARY(lbzu, 0, 0),  // 35
+  PPC_LOOKUP_PRIMARY(stw, 0, 0),  // 36
+  PPC_LOOKUP_PRIMARY(stwu, 0, 0),  // 37
+  PPC_LOOKUP_PRIMARY(stb, 0, 0),  // 38
+  PPC_LOOKUP_PRIMARY(stbu, 0, 0),  // 39
+  PPC_LOOKUP_PRIMARY(lhz, 0, 0),  // 40
+  PPC_LOOKUP_PRIMARY(lhzu, 0, 0),  // 41
+  PPC_LOOKUP_PRIMARY(lha, 0, 0),  // 42
+  PPC_LOOKUP_PRIMARY(lhau, 0, 0),  // 43
+  PPC_LOOKUP_PRIMARY(sth, 0, 0),  // 44
+  PPC_LOOKUP_PRIMARY(sthu, 0, 0),  // 45
+  PPC_LOOKUP_PRIMARY(lmw, 0, 0),  // 46
+  PPC_LOOKUP_PRIMARY(stmw, 0, 0),  // 47
+  PPC_LOOKUP_PRIMARY(lfs, 0, 0),  // 48
+  PPC_LOOKUP_PRIMARY(lfsu, 0, 0),  // 49
+  PPC_LOOKUP_PRIMARY(lfd, 0, 0),  // 50
+  PPC_LOOKUP_PRIMARY(lfdu, 0, 0),  // 51
+  PPC_LOOKUP_PRIMARY(stfs, 0, 0),  // 52
+  PPC_LOOKUP_PRIMARY(stfsu, 0, 0),  // 53
+  PPC_LOOKUP_PRIMARY(stfd, 0, 0),  // 54
+  PPC_LOOKUP_PRIMARY(stfdu, 0, 0),  // 55
+  PPC_LOOKUP_PRIMARY(kInvalid, 0, 0),  // 56
+  PPC_LOOKUP_PRIMARY(kInvalid, 0, 0),  // 57
+  PPC_LOOKUP_PRIMARY(kInvalid, 19, 1),  // 58
+  PPC_LOOKUP_PRIMARY(kInvalid, 20, 1),  // 59
+  PPC_LOOKUP_PRIMARY(kInvalid, 0, 0),  // 60
+  PPC_LOOKUP_PRIMARY(kInvalid, 0, 0),  // 61
+  PPC_LOOKUP_PRIMARY(kInvalid, 21, 1),  // 62
+  PPC_LOOKUP_PRIMARY(kInvalid, 22, 2),  // 63
+};
+
+#define PPC_LOOKUP_SUBTABLE(first_opcode, opcode_count, part0_shift, part0_mask, part0_offset, part1_shift, part1_mask, part1_offset) \
+    {first_opcode, {{part0_shift, part0_offset, part0_mask}, {part1_shift, part1_offset, part1_mask}}}
+const SubtableEntry subtables[] = {
+  PPC_LOOKUP_SUBTABLE(0, 512, 4, 0x7F, 2, 0, 0x3, 0),
+  PPC_LOOKUP_SUBTABLE(512, 2048, 0, 0x7FF, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(2560, 1024, 0, 0x3FF, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(3584, 64, 0, 0x3F, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(3648, 2, 4, 0x1, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(3650, 4, 9, 0x1, 1, 4, 0x1, 0),
+  PPC_LOOKUP_SUBTABLE(3654, 32, 6, 0xF, 1, 4, 0x1, 0),
+  PPC_LOOKUP_SUBTABLE(3686, 16, 9, 0x3, 2, 4, 0x3, 0),
+  PPC_LOOKUP_SUBTABLE(3702, 32, 8, 0x7, 2, 4, 0x3, 0),
+  PPC_LOOKUP_SUBTABLE(3734, 128, 4, 0x7F, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(3862, 16, 7, 0x7, 1, 4, 0x1, 0),
+  PPC_LOOKUP_SUBTABLE(3878, 32, 6, 0xF, 1, 4, 0x1, 0),
+  PPC_LOOKUP_SUBTABLE(3910, 1024, 1, 0x3FF, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(4934, 8, 2, 0x7, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(4942, 16, 1, 0xF, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(4958, 512, 2, 0x1FF, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(5470, 1024, 1, 0x3FF, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(6494, 512, 1, 0x1FF, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(7006, 32768, 21, 0x1F, 10, 1, 0x3FF, 0),
+  PPC_LOOKUP_SUBTABLE(39774, 4, 0, 0x3, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(39778, 32, 1, 0x1F, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(39810, 4, 0, 0x3, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(39814, 1024, 1, 0x3FF, 0, 0, 0x0, 0),
+  PPC_LOOKUP_SUBTABLE(40838, 32, 1, 0x1F, 0, 0, 0x0, 0),
+};
+
+#define O(opcode) uint16_t(PPCOpcode::opcode)
+const uint16_t opcodes[] = {
+  O(kInvalid), O(kInvalid), O(kInvalid), O(lvsl128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(lvsr128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(lvewx128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(lvx128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(stvewx128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(stvx128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(lvxl128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(stvxl128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(lvlx128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(lvrx128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(stvlx128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(stvrx128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(lvlxl128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(lvrxl128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(stvlxl128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(stvrxl128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vaddubm), O(kInvalid), O(vmaxub), O(kInvalid), O(vrlb), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vmuloub), O(kInvalid), O(vaddfp), O(kInvalid), O(vmrghb), O(kInvalid), O(vpkuhum), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vadduhm), O(kInvalid), O(vmaxuh), O(kInvalid), O(vrlh), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vmulouh), O(kInvalid), O(vsubfp), O(kInvalid), O(vmrghh), O(kInvalid), O(vpkuwum), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vadduwm), O(kInvalid), O(vmaxuw), O(kInvalid), O(vrlw), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vmrghw), O(kInvalid), O(vpkuhus), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vpkuwus), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(vmaxsb), O(kInvalid), O(vslb), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vmulosb), O(kInvalid), O(vrefp), O(kInvalid), O(vmrglb), O(kInvalid), O(vpkshus), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(vmaxsh), O(kInvalid), O(vslh), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vmulosh), O(kInvalid), O(vrsqrtefp), O(kInvalid), O(vmrglh), O(kInvalid), O(vpkswus), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vaddcuw), O(kInvalid), O(vmaxsw), O(kInvalid), O(vslw), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(vexptefp), O(kInvalid), O(vmrglw), O(kInvalid), O(vpkshss), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vsl), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(vlogefp), O(kInvalid), O(kInvalid), O(kInvalid), O(vpkswss), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vaddubs), O(kInvalid), O(vminub), O(kInvalid), O(vsrb), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vmuleub), O(kInvalid), O(vrfin), O(kInvalid), O(vspltb), O(kInvalid), O(vupkhsb), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vadduhs), O(kInvalid), O(vminuh), O(kInvalid), O(vsrh), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vmuleuh), O(kInvalid), O(vrfiz), O(kInvalid), O(vsplth), O(kInvalid), O(vupkhsh), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vadduws), O(kInvalid), O(vminuw), O(kInvalid), O(vsrw), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(vrfip), O(kInvalid), O(vspltw), O(kInvalid), O(vupklsb), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vsr), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(vrfim), O(kInvalid), O(kInvalid), O(kInvalid), O(vupklsh), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vaddsbs), O(kInvalid), O(vminsb), O(kInvalid), O(vsrab), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vmulesb), O(kInvalid), O(vcfux), O(kInvalid), O(vspltisb), O(kInvalid), O(vpkpx), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vaddshs), O(kInvalid), O(vminsh), O(kInvalid), O(vsrah), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vmulesh), O(kInvalid), O(vcfsx), O(kInvalid), O(vspltish), O(kInvalid), O(vupkhpx), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vaddsws), O(kInvalid), O(vminsw), O(kInvalid), O(vsraw), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(vctuxs), O(kInvalid), O(vspltisw), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(vctsxs), O(kInvalid), O(kInvalid), O(kInvalid), O(vupklpx), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsububm), O(kInvalid), O(vavgub), O(kInvalid), O(vand), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(vmaxfp), O(kInvalid), O(vslo), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsubuhm), O(kInvalid), O(vavguh), O(kInvalid), O(vandc), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(vminfp), O(kInvalid), O(vsro), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsubuwm), O(kInvalid), O(vavguw), O(kInvalid), O(vor), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vxor), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(vavgsb), O(kInvalid), O(vnor), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(vavgsh), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsubcuw), O(kInvalid), O(vavgsw), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsububs), O(kInvalid), O(kInvalid), O(kInvalid), O(mfvscr), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsum4ubs), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsubuhs), O(kInvalid), O(kInvalid), O(kInvalid), O(mtvscr), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsum4shs), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsubuws), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsum2sws), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsubsbs), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsum4sbs), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsubshs), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsubsws), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vsumsws), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vcmpequb), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vcmpequh), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vcmpequw), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vcmpeqfp), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vcmpgefp), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vcmpgtub), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vcmpgtuh), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vcmpgtuw), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vcmpgtfp), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vcmpgtsb), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vcmpgtsh), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vcmpgtsw), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vcmpbfp), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(vmhaddshs), O(vmhraddshs), O(vmladduhm), O(kInvalid), O(vmsumubm), O(vmsummbm), O(vmsumuhm), O(vmsumuhs),
+  O(vmsumshm), O(vmsumshs), O(vsel), O(vperm), O(vsldoi), O(kInvalid), O(vmaddfp), O(vnmsubfp),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(vsldoi128), O(vperm128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vaddfp128),
+  O(kInvalid), O(vsubfp128), O(kInvalid), O(vmulfp128), O(kInvalid), O(vmaddfp128), O(kInvalid), O(vmaddcfp128),
+  O(kInvalid), O(vnmsubfp128), O(kInvalid), O(vmsum3fp128), O(kInvalid), O(vmsum4fp128), O(vpkshss128), O(vand128),
+  O(vpkshus128), O(vandc128), O(vpkswss128), O(vnor128), O(vpkswus128), O(vor128), O(vpkuhum128), O(vxor128),
+  O(vpkuhus128), O(vsel128), O(vpkuwum128), O(vslo128), O(vpkuwus128), O(vsro128), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(vpermwi128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vpkd3d128),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(vrlimi128), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(vcfpsxws128), O(kInvalid), O(kInvalid), O(kInvalid), O(vcfpuxws128), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(vcsxwfp128), O(kInvalid), O(kInvalid), O(kInvalid), O(vcuxwfp128), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(vrfim128), O(kInvalid), O(kInvalid), O(kInvalid), O(vrfin128), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(vrfip128), O(kInvalid), O(kInvalid), O(kInvalid), O(vrfiz128), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(vrefp128), O(kInvalid), O(kInvalid), O(kInvalid), O(vrsqrtefp128), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(vexptefp128), O(kInvalid), O(kInvalid), O(kInvalid), O(vlogefp128), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(vspltw128), O(kInvalid), O(kInvalid), O(kInvalid), O(vspltisw128), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(vupkd3d128), O(vcmpeqfp128), O(kInvalid),
+  O(vcmpgefp128), O(kInvalid), O(vcmpgtfp128), O(kInvalid), O(vcmpbfp128), O(kInvalid), O(vcmpequw128), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(vrlw128), O(kInvalid), O(kInvalid), O(kInvalid), O(vslw128), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(vsraw128), O(kInvalid), O(kInvalid), O(kInvalid), O(vsrw128), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(vmaxfp128), O(kInvalid), O(vminfp128), O(kInvalid), O(vmrghw128), O(kInvalid),
+  O(vmrglw128), O(kInvalid), O(vupkhsb128), O(kInvalid), O(vupklsb128), O(kInvalid), O(mcrf), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(bclrx), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(crnor),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(crandc),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(isync), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(crxor),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(crnand),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(crand),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(creqv),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(crorc),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(cror),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(bcctrx), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(rldiclx), O(rldicrx),
+  O(rldicx), O(rldimix), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(rldclx), O(rldcrx),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(sradix), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(cmp), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(tw), O(kInvalid), O(lvsl), O(lvebx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(mfcr), O(lwarx), O(ldx), O(kInvalid), O(lwzx), O(slwx), O(kInvalid),
+  O(cntlzwx), O(sldx), O(andx), O(kInvalid), O(kInvalid), O(kInvalid), O(cmpl), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(lvsr), O(lvehx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(ldux), O(dcbst), O(lwzux), O(kInvalid), O(kInvalid),
+  O(cntlzdx), O(kInvalid), O(andcx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(td), O(kInvalid), O(kInvalid), O(lvewx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(mfmsr), O(ldarx), O(kInvalid), O(dcbf), O(lbzx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(lvx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(lbzux), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(norx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(stvebx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(mtcrf), O(kInvalid),
+  O(mtmsr), O(kInvalid), O(kInvalid), O(stdx), O(stwcx), O(stwx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(stvehx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(mtmsrd), O(kInvalid), O(kInvalid), O(stdux), O(kInvalid), O(stwux), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(stvewx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(stdcx), O(stbx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(stvx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(dcbtst), O(stbux), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(dcbt), O(lhzx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(eqvx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(lhzux), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(xorx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(mfspr), O(kInvalid), O(lwax), O(kInvalid), O(lhax), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(lvxl), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(mftb), O(kInvalid), O(lwaux), O(kInvalid), O(lhaux), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(sthx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(orcx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(sthux), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(orx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(mtspr), O(kInvalid), O(kInvalid), O(dcbi), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(nandx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(stvxl), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(mcrxr), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(lvlx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(ldbrx), O(lswx), O(lwbrx), O(lfsx), O(srwx), O(kInvalid),
+  O(kInvalid), O(srdx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(lvrx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(lfsux), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(lswi), O(sync), O(lfdx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(lfdux), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(stvlx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(stdbrx), O(stswx), O(stwbrx), O(stfsx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(stvrx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(stfsux), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(stswi), O(kInvalid), O(stfdx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(stfdux), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(lvlxl), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(lhbrx), O(kInvalid), O(srawx), O(kInvalid),
+  O(sradx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(lvrxl), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(srawix), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(eieio), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(stvlxl), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(sthbrx), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(extshx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(stvrxl), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(extsbx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(icbi), O(stfiwx), O(kInvalid), O(kInvalid),
+  O(extswx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(subfcx), O(mulhdux),
+  O(addcx), O(mulhwux), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(subfx), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(mulhdx),
+  O(kInvalid), O(mulhwx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(negx), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(subfex), O(kInvalid),
+  O(addex), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(subfzex), O(kInvalid),
+  O(addzex), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(subfmex), O(mulldx),
+  O(addmex), O(mullwx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(addx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(divdux),
+  O(kInvalid), O(divwux), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(divdx),
+  O(kInvalid), O(divwx), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(dcbz), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(dcbz128), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(ld), O(ldu),
+  O(lwa), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(fdivsx), O(kInvalid), O(fsubsx), O(faddsx),
+  O(fsqrtsx), O(kInvalid), O(fresx), O(fmulsx), O(kInvalid), O(kInvalid), O(fmsubsx), O(fmaddsx),
+  O(fnmsubsx), O(fnmaddsx), O(std), O(stdu), O(kInvalid), O(kInvalid), O(fcmpu), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(frspx), O(kInvalid), O(fctiwx), O(fctiwzx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(fcmpo), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(mtfsb1x), O(kInvalid), O(fnegx), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(mcrfs), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(mtfsb0x), O(kInvalid), O(fmrx), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(mtfsfix), O(kInvalid), O(fnabsx), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(fabsx), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(mffsx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(mtfsfx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(fctidx), O(fctidzx), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(fcfidx), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid), O(kInvalid),
+  O(fdivx), O(kInvalid), O(fsubx), O(faddx), O(fsqrtx), O(fselx), O(kInvalid), O(fmulx),
+  O(frsqrtex), O(kInvalid), O(fmsubx), O(fmaddx), O(fnmsubx), O(fnmaddx),
+};
+#undef O
+
+}  // namespace
+
+PPCOpcode LookupOpcodeTabular(uint32_t code) {
+  const PrimaryEntry& primary = primary_table[code >> 26];
+  for (uint32_t i = 0; i < primary.subtable_count; ++i) {
+    const SubtableEntry& subtable = subtables[primary.first_subtable + i];
+    uint32_t index = 0;
+    for (const auto& part : subtable.parts) {
+      index |= ((code >> part.shift) & part.mask) << part.offset;
+    }
+    uint16_t opcode = opcodes[subtable.first_opcode + index];
+    if (opcode != uint16_t(PPCOpcode::kInvalid)) {
+      return PPCOpcode(opcode);
+    }
+  }
+  return PPCOpcode(primary.opcode);
+}
+
+}  // namespace ppc
+}  // namespace cpu
+}  // namespace xe
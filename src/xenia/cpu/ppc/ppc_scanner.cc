@@ -41,7 +41,8 @@ bool PPCScanner::IsRestGprLr(uint32_t address) {
   return function && function->behavior() == Function::Behavior::kEpilogReturn;
 }
 
-bool PPCScanner::Scan(GuestFunction* function, FunctionDebugInfo* debug_info) {
+bool PPCScanner::Scan(GuestFunction* function, FunctionDebugInfo* debug_info,
+                      std::vector<PPCDecodedInstr>* decoded_instrs_out) {
   // This is a simple basic block analyizer. It walks the start address to the
   // end address looking for branches. Each span of instructions between
   // branches is considered a basic block. When the last blr (that has no
@@ -61,6 +62,9 @@ bool PPCScanner::Scan(GuestFunction* function, FunctionDebugInfo* debug_info) {
   uint32_t end_address = static_cast<uint32_t>(function->end_address());
   uint32_t address = start_address;
   uint32_t furthest_target = start_address;
+  if (decoded_instrs_out) {
+    decoded_instrs_out->clear();
+  }
   size_t blocks_found = 0;
   bool in_block = false;
   bool starts_with_mfspr_lr = false;
@@ -77,7 +81,13 @@ bool PPCScanner::Scan(GuestFunction* function, FunctionDebugInfo* debug_info) {
       break;
     }
 
-    auto opcode = LookupOpcode(code);
+    // The table-driven lookup is faster than the switches (see the decoder
+    // benchmark in the CPU tests), and this is where most instructions are
+    // decoded now.
+    auto opcode = LookupOpcodeTabular(code);
+    if (decoded_instrs_out) {
+      decoded_instrs_out->push_back({code, opcode});
+    }
 
     PPCDecodeData d;
     d.address = address;
@@ -275,6 +285,21 @@ bool PPCScanner::Scan(GuestFunction* function, FunctionDebugInfo* debug_info) {
   }
   function->set_end_address(address);
 
+  if (decoded_instrs_out) {
+    // The walk may have stopped after running one instruction over the
+    // expected bounds, which is still included in the function.
+    size_t instr_count =
+        address >= start_address ? (address - start_address) / 4 + 1 : 0;
+    size_t decoded_instr_count = decoded_instrs_out->size();
+    decoded_instrs_out->resize(instr_count);
+    for (size_t i = decoded_instr_count; i < instr_count; ++i) {
+      PPCDecodedInstr& decoded_instr = (*decoded_instrs_out)[i];
+      decoded_instr.code = xe::load_and_swap<uint32_t>(
+          memory->TranslateVirtual(start_address + uint32_t(i) * 4));
+      decoded_instr.opcode = LookupOpcodeTabular(decoded_instr.code);
+    }
+  }
+
   // If there's spare bits at the end, split the function.
   // TODO(benvanik): splitting?
 
@@ -292,7 +317,9 @@ bool PPCScanner::Scan(GuestFunction* function, FunctionDebugInfo* debug_info) {
   return true;
 }
 
-std::vector<BlockInfo> PPCScanner::FindBlocks(GuestFunction* function) {
+std::vector<BlockInfo> PPCScanner::FindBlocks(
+    GuestFunction* function, std::vector<uint32_t>* call_targets_out,
+    const PPCDecodedInstr* decoded_instrs) {
   Memory* memory = frontend_->memory();
 
   std::map<uint32_t, BlockInfo> block_map;
@@ -301,13 +328,17 @@ std::vector<BlockInfo> PPCScanner::FindBlocks(GuestFunction* function) {
   uint32_t end_address = function->end_address();
   bool in_block = false;
   uint32_t block_start = 0;
-  for (uint32_t address = start_address; address <= end_address; address += 4) {
+  for (uint32_t address = start_address, offset = 0; address <= end_address;
+       address += 4, ++offset) {
     uint32_t code =
-        xe::load_and_swap<uint32_t>(memory->TranslateVirtual(address));
+        decoded_instrs
+            ? decoded_instrs[offset].code
+            : xe::load_and_swap<uint32_t>(memory->TranslateVirtual(address));
     if (!code) {
       continue;
     }
-    auto opcode = xe::cpu::ppc::LookupOpcode(code);
+    PPCOpcode opcode =
+        decoded_instrs ? decoded_instrs[offset].opcode : LookupOpcode(code);
 
     if (!in_block) {
       in_block = true;
@@ -325,8 +356,14 @@ std::vector<BlockInfo> PPCScanner::FindBlocks(GuestFunction* function) {
       ends_block = true;
     } else if (opcode == PPCOpcode::bx) {
       // b/ba/bl/bla
-      // uint32_t target =
-      //    (uint32_t)XEEXTS26(i.I.LI << 2) + (i.I.AA ? 0 : (int32_t)address);
+      if (call_targets_out) {
+        PPCDecodeData d;
+        d.address = address;
+        d.code = code;
+        if (d.I.LK()) {
+          call_targets_out->push_back(d.I.ADDR());
+        }
+      }
       ends_block = true;
     } else if (opcode == PPCOpcode::bcx) {
       // bc/bca/bcl/bcla
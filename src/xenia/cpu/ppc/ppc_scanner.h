@@ -14,6 +14,7 @@
 
 #include "xenia/cpu/function.h"
 #include "xenia/cpu/function_debug_info.h"
+#include "xenia/cpu/ppc/ppc_opcode_info.h"
 
 namespace xe {
 namespace cpu {
@@ -31,9 +32,21 @@ class PPCScanner {
   explicit PPCScanner(PPCFrontend* frontend);
   ~PPCScanner();
 
-  bool Scan(GuestFunction* function, FunctionDebugInfo* debug_info);
-
-  std::vector<BlockInfo> FindBlocks(GuestFunction* function);
+  // Finds the extents of the function. If decoded_instrs_out is not null, it's
+  // filled with the instructions from the start to the end address of the
+  // function, for the later passes over it, like FindBlocks and
+  // PPCHIRBuilder::Emit, to reuse.
+  bool Scan(GuestFunction* function, FunctionDebugInfo* debug_info,
+            std::vector<PPCDecodedInstr>* decoded_instrs_out = nullptr);
+
+  // Splits the function into blocks. If call_targets_out is not null, the
+  // targets of static calls (bl/bla) from the function are appended to it.
+  // The instructions are decoded from the guest memory unless decoded_instrs
+  // from Scan is provided.
+  std::vector<BlockInfo> FindBlocks(
+      GuestFunction* function,
+      std::vector<uint32_t>* call_targets_out = nullptr,
+      const PPCDecodedInstr* decoded_instrs = nullptr);
 
  private:
   bool IsRestGprLr(uint32_t address);
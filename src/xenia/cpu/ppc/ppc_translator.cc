@@ -22,6 +22,7 @@
 #include "xenia/cpu/ppc/ppc_opcode_info.h"
 #include "xenia/cpu/ppc/ppc_scanner.h"
 #include "xenia/cpu/processor.h"
+#include "xenia/cpu/routine_signatures.h"
 
 namespace xe {
 namespace cpu {
@@ -42,6 +43,11 @@ PPCTranslator::PPCTranslator(PPCFrontend* frontend) : frontend_(frontend) {
 
   bool validate = cvars::validate_hir;
 
+  // Splice small leaf callees into the function before anything else, so the
+  // rest of the passes see them as a part of it.
+  compiler_->AddPass(std::make_unique<passes::InliningPass>());
+  if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
+
   // Merge blocks early. This will let us use more context in other passes.
   // The CFG is required for simplification and dirtied by it.
   compiler_->AddPass(std::make_unique<passes::ControlFlowAnalysisPass>());
@@ -61,6 +67,10 @@ PPCTranslator::PPCTranslator(PPCFrontend* frontend) : frontend_(frontend) {
   sap->AddPass(std::make_unique<passes::ConstantPropagationPass>());
   if (validate) sap->AddPass(std::make_unique<passes::ValidationPass>());
   compiler_->AddPass(std::move(sap));
+  compiler_->AddPass(std::make_unique<passes::ValueNumberingPass>());
+  if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
+  compiler_->AddPass(std::make_unique<passes::RoundingModeEliminationPass>());
+  if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
 
   if (backend->machine_info()->supports_extended_load_store) {
     // Backend supports the advanced LOAD/STORE instructions.
@@ -72,37 +82,83 @@ PPCTranslator::PPCTranslator(PPCFrontend* frontend) : frontend_(frontend) {
   }
   compiler_->AddPass(std::make_unique<passes::SimplificationPass>());
   if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
-  // compiler_->AddPass(std::make_unique<passes::DeadStoreEliminationPass>());
-  // if (validate)
-  // compiler_->AddPass(std::make_unique<passes::ValidationPass>());
+  compiler_->AddPass(std::make_unique<passes::DeadStoreEliminationPass>());
+  if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
   compiler_->AddPass(std::make_unique<passes::DeadCodeEliminationPass>());
   if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
 
-  //// Removes all unneeded variables. Try not to add new ones after this.
-  // compiler_->AddPass(new passes::ValueReductionPass());
-  // if (validate) compiler_->AddPass(new passes::ValidationPass());
+  // Removes all unneeded variables. Try not to add new ones after this.
+  compiler_->AddPass(std::make_unique<passes::ValueReductionPass>());
+  if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
 
   // Register allocation for the target backend.
   // Will modify the HIR to add loads/stores.
   // This should be the last pass before finalization, as after this all
   // registers are assigned and ready to be emitted.
+  // Loop register allocation needs the CFG after all the simplifications.
+  // Context access tracing must see every access.
+  bool allocate_loop_registers =
+      cvars::allocate_loop_registers && !cvars::trace_function_data;
+  if (allocate_loop_registers) {
+    compiler_->AddPass(std::make_unique<passes::ControlFlowAnalysisPass>());
+  }
   compiler_->AddPass(std::make_unique<passes::RegisterAllocationPass>(
-      backend->machine_info()));
+      backend->machine_info(), allocate_loop_registers));
   if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
 
   // Must come last. The HIR is not really HIR after this.
   compiler_->AddPass(std::make_unique<passes::FinalizationPass>());
+
+  if (frontend->processor()->tiered_compilation()) {
+    // Only what's cheap (a single walk over the blocks without iterating
+    // until no changes are made) and what helps the most.
+    baseline_compiler_.reset(new Compiler(frontend->processor()));
+    baseline_compiler_->AddPass(
+        std::make_unique<passes::ControlFlowAnalysisPass>());
+    baseline_compiler_->AddPass(
+        std::make_unique<passes::ControlFlowSimplificationPass>());
+    if (validate) {
+      baseline_compiler_->AddPass(std::make_unique<passes::ValidationPass>());
+    }
+    if (backend->machine_info()->supports_extended_load_store) {
+      baseline_compiler_->AddPass(
+          std::make_unique<passes::MemorySequenceCombinationPass>());
+      if (validate) {
+        baseline_compiler_->AddPass(
+            std::make_unique<passes::ValidationPass>());
+      }
+    }
+    baseline_compiler_->AddPass(
+        std::make_unique<passes::DeadCodeEliminationPass>());
+    if (validate) {
+      baseline_compiler_->AddPass(std::make_unique<passes::ValidationPass>());
+    }
+    baseline_compiler_->AddPass(
+        std::make_unique<passes::RegisterAllocationPass>(
+            backend->machine_info()));
+    if (validate) {
+      baseline_compiler_->AddPass(std::make_unique<passes::ValidationPass>());
+    }
+    baseline_compiler_->AddPass(std::make_unique<passes::FinalizationPass>());
+  }
 }
 
 PPCTranslator::~PPCTranslator() = default;
 
 bool PPCTranslator::Translate(GuestFunction* function,
-                              uint32_t debug_info_flags) {
+                              uint32_t debug_info_flags, bool optimize) {
   SCOPE_profile_cpu_f("cpu");
 
+  Compiler* compiler = compiler_.get();
+  GuestFunction::Tier tier = GuestFunction::Tier::kOptimized;
+  if (baseline_compiler_ && !optimize) {
+    compiler = baseline_compiler_.get();
+    tier = GuestFunction::Tier::kBaseline;
+  }
+
   // Reset() all caching when we leave.
   xe::make_reset_scope(builder_);
-  xe::make_reset_scope(compiler_);
+  xe::make_reset_scope(compiler);
   xe::make_reset_scope(assembler_);
   xe::make_reset_scope(&string_buffer_);
 
@@ -128,10 +184,28 @@ bool PPCTranslator::Translate(GuestFunction* function,
   }
 
   // Scan the function to find its extents and gather debug data.
-  if (!scanner_->Scan(function, debug_info.get())) {
+  if (!scanner_->Scan(function, debug_info.get(), &decoded_instrs_)) {
     return false;
   }
 
+  // Library routines replaced with host implementations call a builtin, so
+  // their code is never stored.
+  Function* replacement = nullptr;
+  if (cvars::replace_guest_routines) {
+    replacement =
+        frontend_->processor()->routine_signatures()->FindReplacement(function);
+  }
+
+  // Reuse the code generated in a previous run if possible, unless debug data
+  // that's only collected during translation is needed.
+  // Stored code is always optimized.
+  if (!replacement && !debug_info_flags &&
+      assembler_->AssembleStored(function)) {
+    function->set_tier(GuestFunction::Tier::kOptimized);
+    function->set_inlined_functions({});
+    return true;
+  }
+
   // Setup trace data, if needed.
   if (debug_info_flags & DebugInfoFlags::kDebugInfoTraceFunctions) {
     // Base trace data.
@@ -165,7 +239,8 @@ bool PPCTranslator::Translate(GuestFunction* function,
   if (debug_info) {
     emit_flags |= PPCHIRBuilder::EMIT_DEBUG_COMMENTS;
   }
-  if (!builder_->Emit(function, emit_flags)) {
+  if (!builder_->Emit(function, emit_flags, decoded_instrs_.data(),
+                      replacement)) {
     return false;
   }
 
@@ -177,7 +252,7 @@ bool PPCTranslator::Translate(GuestFunction* function,
   }
 
   // Compile/optimize/etc.
-  if (!compiler_->Compile(builder_.get())) {
+  if (!compiler->Compile(builder_.get())) {
     return false;
   }
 
@@ -188,32 +263,34 @@ bool PPCTranslator::Translate(GuestFunction* function,
     string_buffer_.Reset();
   }
 
-  // Assemble to backend machine code.
+  // Assemble to backend machine code. The tier tells the backend whether to
+  // count calls to request optimization later.
+  GuestFunction::Tier previous_tier = function->tier();
+  function->set_tier(tier);
   if (!assembler_->Assemble(function, builder_.get(), debug_info_flags,
                             std::move(debug_info))) {
+    function->set_tier(previous_tier);
     return false;
   }
+  function->set_inlined_functions(builder_->inlined_functions());
 
   return true;
 }
 
 void PPCTranslator::DumpSource(GuestFunction* function,
                                StringBuffer* string_buffer) {
-  Memory* memory = frontend_->memory();
-
   string_buffer->AppendFormat(
       "{} fn {:08X}-{:08X} {}\n", function->module()->name().c_str(),
       function->address(), function->end_address(), function->name().c_str());
 
-  auto blocks = scanner_->FindBlocks(function);
+  auto blocks = scanner_->FindBlocks(function, nullptr, decoded_instrs_.data());
 
   uint32_t start_address = function->address();
   uint32_t end_address = function->end_address();
   auto block_it = blocks.begin();
   for (uint32_t address = start_address, offset = 0; address <= end_address;
        address += 4, offset++) {
-    uint32_t code =
-        xe::load_and_swap<uint32_t>(memory->TranslateVirtual(address));
+    const PPCDecodedInstr& decoded_instr = decoded_instrs_[offset];
 
     // Check labels.
     if (block_it != blocks.end() && block_it->start_address == address) {
@@ -222,8 +299,9 @@ void PPCTranslator::DumpSource(GuestFunction* function,
       ++block_it;
     }
 
-    string_buffer->AppendFormat("{:08X} {:08X}   ", address, code);
-    DisasmPPC(address, code, string_buffer);
+    string_buffer->AppendFormat("{:08X} {:08X}   ", address,
+                                decoded_instr.code);
+    DisasmPPC(address, decoded_instr.code, decoded_instr.opcode, string_buffer);
     string_buffer->Append('\n');
   }
 }
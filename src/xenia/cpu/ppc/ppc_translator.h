@@ -11,11 +11,13 @@
 #define XENIA_CPU_PPC_PPC_TRANSLATOR_H_
 
 #include <memory>
+#include <vector>
 
 #include "xenia/base/string_buffer.h"
 #include "xenia/cpu/backend/assembler.h"
 #include "xenia/cpu/compiler/compiler.h"
 #include "xenia/cpu/function.h"
+#include "xenia/cpu/ppc/ppc_opcode_info.h"
 
 namespace xe {
 namespace cpu {
@@ -25,23 +27,38 @@ class PPCFrontend;
 class PPCHIRBuilder;
 class PPCScanner;
 
+// Translates one function at a time. Translators are pooled by the frontend,
+// so every function being translated concurrently, on guest threads or in the
+// background compiler, has its own scanner, HIR builder, compilers and
+// assembler, and only translations of the same function are serialized (by
+// Module::DefineFunction).
 class PPCTranslator {
  public:
   explicit PPCTranslator(PPCFrontend* frontend);
   ~PPCTranslator();
 
-  bool Translate(GuestFunction* function, uint32_t debug_info_flags);
+  // With tiered compilation, functions are translated with the baseline
+  // pipeline unless optimize is true.
+  bool Translate(GuestFunction* function, uint32_t debug_info_flags,
+                 bool optimize = false);
 
  private:
+  // Uses the instructions decoded by the latest Scan.
   void DumpSource(GuestFunction* function, StringBuffer* string_buffer);
 
   PPCFrontend* frontend_;
   std::unique_ptr<PPCScanner> scanner_;
   std::unique_ptr<PPCHIRBuilder> builder_;
   std::unique_ptr<compiler::Compiler> compiler_;
+  // Only with tiered compilation, for fast translation of functions that
+  // haven't been executed much yet.
+  std::unique_ptr<compiler::Compiler> baseline_compiler_;
   std::unique_ptr<backend::Assembler> assembler_;
 
   StringBuffer string_buffer_;
+  // Instructions of the function being translated, decoded once by the scanner
+  // for all the passes over it.
+  std::vector<PPCDecodedInstr> decoded_instrs_;
 };
 
 }  // namespace ppc
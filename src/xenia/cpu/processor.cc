@@ -9,10 +9,15 @@
 
 #include "xenia/cpu/processor.h"
 
+#include <algorithm>
+#include <cstring>
+
+#include "third_party/fmt/include/fmt/format.h"
 #include "xenia/base/assert.h"
 #include "xenia/base/atomic.h"
 #include "xenia/base/byte_order.h"
 #include "xenia/base/byte_stream.h"
+#include "xenia/base/clock.h"
 #include "xenia/base/cvar.h"
 #include "xenia/base/debugging.h"
 #include "xenia/base/exception_handler.h"
@@ -22,12 +27,15 @@
 #include "xenia/base/platform.h"
 #include "xenia/base/profiling.h"
 #include "xenia/base/threading.h"
+#include "xenia/cpu/background_compiler.h"
 #include "xenia/cpu/breakpoint.h"
 #include "xenia/cpu/cpu_flags.h"
 #include "xenia/cpu/export_resolver.h"
 #include "xenia/cpu/module.h"
 #include "xenia/cpu/ppc/ppc_decode_data.h"
 #include "xenia/cpu/ppc/ppc_frontend.h"
+#include "xenia/cpu/routine_signatures.h"
+#include "xenia/cpu/sampling_profiler.h"
 #include "xenia/cpu/stack_walker.h"
 #include "xenia/cpu/thread.h"
 #include "xenia/cpu/thread_state.h"
@@ -48,6 +56,30 @@ DEFINE_path(trace_function_data_path, "", "File to write trace data to.",
             "CPU");
 DEFINE_bool(break_on_start, false, "Break into the debugger on startup.",
             "CPU");
+DEFINE_bool(background_compilation, false,
+            "Translate functions statically called from already translated "
+            "ones on background threads before they are executed.",
+            "CPU");
+DEFINE_uint32(background_compilation_threads, 1,
+              "Number of threads for background compilation.", "CPU");
+DEFINE_uint32(background_compilation_depth, 2,
+              "Maximum number of static calls from executed code to follow "
+              "when looking for functions to compile in the background.",
+              "CPU");
+DEFINE_path(sampling_profiler_path, "",
+            "File to write the samples of the guest sampling profiler to when "
+            "exiting, enabling it if not empty. Collapsed stacks are written "
+            "for flame graphs, or Chrome trace events if the extension is "
+            ".json.",
+            "CPU");
+DEFINE_uint32(sampling_profiler_interval, 1000,
+              "Interval between the samples of guest threads taken by the "
+              "sampling profiler, in microseconds.",
+              "CPU");
+DEFINE_uint32(tracepoint_hit_buffer_size, 4096,
+              "Number of the latest tracepoint hits with the guest registers "
+              "kept for the debugger.",
+              "CPU");
 
 namespace xe {
 namespace kernel {
@@ -86,8 +118,24 @@ Processor::Processor(xe::Memory* memory, ExportResolver* export_resolver)
     : memory_(memory), export_resolver_(export_resolver) {}
 
 Processor::~Processor() {
+  if (invalidate_modified_code_) {
+    memory_->SetCodeWriteCallback(nullptr, nullptr);
+  }
+
+  // Symbolizes the samples using the modules when writing them.
+  sampling_profiler_.reset();
+
+  // Must be stopped before destroying anything it may be translating with.
+  background_compiler_.reset();
+
+  if (routine_signatures_) {
+    routine_signatures_->LogStatistics();
+  }
+
   {
     auto global_lock = global_critical_region_.Acquire();
+    module_index_.store(nullptr, std::memory_order_relaxed);
+    module_indices_.clear();
     modules_.clear();
   }
 
@@ -113,6 +161,9 @@ bool Processor::Setup(std::unique_ptr<backend::Backend> backend) {
   std::unique_ptr<Module> builtin_module(new BuiltinModule(this));
   builtin_module_ = builtin_module.get();
   modules_.push_back(std::move(builtin_module));
+  RebuildModuleIndex();
+
+  routine_signatures_ = std::make_unique<RoutineSignatures>(this);
 
   if (frontend_ || backend_) {
     return false;
@@ -147,6 +198,16 @@ bool Processor::Setup(std::unique_ptr<backend::Backend> backend) {
     }
   }
 
+  if (!cvars::sampling_profiler_path.empty()) {
+    if (stack_walker_) {
+      sampling_profiler_ = std::make_unique<SamplingProfiler>(
+          this, stack_walker_.get(), cvars::sampling_profiler_path,
+          cvars::sampling_profiler_interval);
+    } else {
+      XELOGW("Disabling the sampling profiler due to lack of stack walker");
+    }
+  }
+
   // Open the trace data path, if requested.
   functions_trace_path_ = cvars::trace_function_data_path;
   if (!functions_trace_path_.empty()) {
@@ -154,6 +215,27 @@ bool Processor::Setup(std::unique_ptr<backend::Backend> backend) {
         ChunkedMappedMemoryWriter::Open(functions_trace_path_, 32_MiB, true);
   }
 
+  invalidate_modified_code_ = cvars::invalidate_modified_code;
+  if (invalidate_modified_code_) {
+    memory_->SetCodeWriteCallback(CodeWriteCallbackThunk, this);
+  }
+
+  // Speculative translation would make breakpoints and stepping in code that
+  // hasn't been executed yet behave differently, and replacing code while it's
+  // being debugged would break the mapping between guest and host code, so
+  // both are only used without the debugger.
+  if (!cvars::debug && cvars::background_compilation_threads) {
+    uint32_t speculation_depth = cvars::background_compilation
+                                     ? cvars::background_compilation_depth
+                                     : 0;
+    tiered_compilation_ = cvars::tiered_compilation;
+    if (speculation_depth || tiered_compilation_) {
+      background_compiler_ = std::make_unique<BackgroundCompiler>(
+          this, std::min(cvars::background_compilation_threads, uint32_t(16)),
+          speculation_depth);
+    }
+  }
+
   return true;
 }
 
@@ -172,9 +254,106 @@ void Processor::PreLaunch() {
 bool Processor::AddModule(std::unique_ptr<Module> module) {
   auto global_lock = global_critical_region_.Acquire();
   modules_.push_back(std::move(module));
+  RebuildModuleIndex();
   return true;
 }
 
+void Processor::RebuildModuleIndex() {
+  static std::atomic<uint64_t> next_serial = {1};
+
+  auto global_lock = global_critical_region_.Acquire();
+  auto index = std::make_unique<ModuleIndex>();
+  index->serial = next_serial.fetch_add(1, std::memory_order_relaxed);
+  for (size_t i = 0; i < modules_.size(); ++i) {
+    Module* module = modules_[i].get();
+    ModuleIndex::Range range;
+    if (module->GetAddressRange(&range.low_address, &range.high_address)) {
+      range.module_order = i;
+      range.module = module;
+      index->ranges.push_back(range);
+    } else {
+      index->unranged_modules.emplace_back(i, module);
+    }
+  }
+  std::sort(index->ranges.begin(), index->ranges.end(),
+            [](const ModuleIndex::Range& a, const ModuleIndex::Range& b) {
+              return a.low_address < b.low_address;
+            });
+  // Binary search needs disjoint ranges. Overlaps shouldn't happen with real
+  // modules, but if they do, fall back to linear search for the later ones.
+  for (size_t i = 1; i < index->ranges.size();) {
+    const ModuleIndex::Range& previous = index->ranges[i - 1];
+    const ModuleIndex::Range& range = index->ranges[i];
+    if (range.low_address < previous.high_address) {
+      size_t removed = range.module_order > previous.module_order ? i : i - 1;
+      const ModuleIndex::Range& removed_range = index->ranges[removed];
+      index->unranged_modules.emplace_back(removed_range.module_order,
+                                           removed_range.module);
+      index->ranges.erase(index->ranges.begin() + removed);
+      i = std::max(size_t(1), removed);
+    } else {
+      ++i;
+    }
+  }
+  std::sort(index->unranged_modules.begin(), index->unranged_modules.end());
+  module_index_.store(index.get(), std::memory_order_release);
+  module_indices_.push_back(std::move(index));
+}
+
+Module* Processor::FindModuleWithAddress(uint32_t address) {
+  // Guest threads usually keep calling into the same module, so remember the
+  // last successful range lookup.
+  struct LastModuleCache {
+    uint64_t index_serial;
+    uint32_t low_address;
+    uint32_t high_address;
+    Module* module;
+  };
+  static thread_local LastModuleCache last_module = {};
+
+  const ModuleIndex* index = module_index_.load(std::memory_order_acquire);
+  if (!index) {
+    return nullptr;
+  }
+  if (last_module.index_serial == index->serial &&
+      address >= last_module.low_address &&
+      address < last_module.high_address) {
+    return last_module.module;
+  }
+
+  const ModuleIndex::Range* found_range = nullptr;
+  auto it = std::upper_bound(
+      index->ranges.cbegin(), index->ranges.cend(), address,
+      [](uint32_t address, const ModuleIndex::Range& range) {
+        return address < range.low_address;
+      });
+  if (it != index->ranges.cbegin()) {
+    --it;
+    if (address < it->high_address) {
+      found_range = &*it;
+    }
+  }
+
+  // Modules added earlier still take precedence, as with the linear search.
+  for (const auto& unranged_module : index->unranged_modules) {
+    if (found_range && unranged_module.first > found_range->module_order) {
+      break;
+    }
+    if (unranged_module.second->ContainsAddress(address)) {
+      return unranged_module.second;
+    }
+  }
+
+  if (!found_range) {
+    return nullptr;
+  }
+  last_module.index_serial = index->serial;
+  last_module.low_address = found_range->low_address;
+  last_module.high_address = found_range->high_address;
+  last_module.module = found_range->module;
+  return found_range->module;
+}
+
 Module* Processor::GetModule(const std::string_view name) {
   auto global_lock = global_critical_region_.Acquire();
   for (const auto& module : modules_) {
@@ -212,6 +391,14 @@ Function* Processor::DefineBuiltin(const std::string_view name,
   return function;
 }
 
+void Processor::LoadRoutineSignatures() {
+  if (!cvars::replace_guest_routines ||
+      cvars::routine_signatures_path.empty()) {
+    return;
+  }
+  routine_signatures_->LoadFile(cvars::routine_signatures_path);
+}
+
 Function* Processor::QueryFunction(uint32_t address) {
   auto entry = entry_table_.Get(address);
   if (!entry) {
@@ -233,21 +420,40 @@ Function* Processor::ResolveFunction(uint32_t address) {
     // Grab symbol declaration.
     auto function = LookupFunction(address);
     if (!function) {
-      entry->status = Entry::STATUS_FAILED;
+      entry_table_.Publish(entry, Entry::STATUS_FAILED);
       return nullptr;
     }
 
+    uint32_t breakpoint_generation =
+        compiled_breakpoint_generation_.load(std::memory_order_acquire);
     if (!DemandFunction(function)) {
-      entry->status = Entry::STATUS_FAILED;
+      entry_table_.Publish(entry, Entry::STATUS_FAILED);
       return nullptr;
     }
     entry->function = function;
     entry->end_address = function->end_address();
-    status = entry->status = Entry::STATUS_READY;
+    status = Entry::STATUS_READY;
+    entry_table_.Publish(entry, status);
+    // A compiled breakpoint registered while translating might have been
+    // missed, as the function hasn't been findable for invalidation yet.
+    if (function->is_guest() &&
+        compiled_breakpoint_generation_.load(std::memory_order_acquire) !=
+            breakpoint_generation) {
+      static_cast<GuestFunction*>(function)->MarkCodeModified();
+    }
   }
   if (status == Entry::STATUS_READY) {
-    // Ready to use.
-    return entry->function;
+    // Ready to use, unless the code has been modified since.
+    Function* function = entry->function;
+    if (function->is_guest() &&
+        static_cast<GuestFunction*>(function)->is_code_modified()) {
+      if (!RetranslateModifiedFunction(
+              static_cast<GuestFunction*>(function))) {
+        return nullptr;
+      }
+      entry->end_address = function->end_address();
+    }
+    return function;
   } else {
     // Failed or bad state.
     return nullptr;
@@ -258,18 +464,7 @@ Function* Processor::LookupFunction(uint32_t address) {
   // TODO(benvanik): fast reject invalid addresses/log errors.
 
   // Find the module that contains the address.
-  Module* code_module = nullptr;
-  {
-    auto global_lock = global_critical_region_.Acquire();
-    // TODO(benvanik): sort by code address (if contiguous) so can bsearch.
-    // TODO(benvanik): cache last module low/high, as likely to be in there.
-    for (const auto& module : modules_) {
-      if (module->ContainsAddress(address)) {
-        code_module = module.get();
-        break;
-      }
-    }
-  }
+  Module* code_module = FindModuleWithAddress(address);
   if (!code_module) {
     // No module found that could contain the address.
     return nullptr;
@@ -303,17 +498,26 @@ bool Processor::DemandFunction(Function* function) {
   if (symbol_status == Symbol::Status::kNew) {
     // Symbol is undefined, so define now.
     assert_true(function->is_guest());
-    if (!frontend_->DefineFunction(static_cast<GuestFunction*>(function),
-                                   debug_info_flags_)) {
+    auto guest_function = static_cast<GuestFunction*>(function);
+    uint32_t modification_count = guest_function->code_modification_count();
+    if (!frontend_->DefineFunction(guest_function, debug_info_flags_)) {
       function->set_status(Symbol::Status::kFailed);
       return false;
     }
+    if (invalidate_modified_code_) {
+      OnFunctionTranslated(guest_function, modification_count);
+    }
 
     // Before we give the symbol back to the rest, let the debugger know.
     OnFunctionDefined(function);
 
     function->set_status(Symbol::Status::kDefined);
     symbol_status = function->status();
+
+    if (background_compiler_) {
+      background_compiler_->OnFunctionDefined(
+          static_cast<GuestFunction*>(function));
+    }
   }
 
   if (symbol_status == Symbol::Status::kFailed) {
@@ -324,6 +528,129 @@ bool Processor::DemandFunction(Function* function) {
   return true;
 }
 
+void Processor::RequestFunctionOptimization(GuestFunction* function) {
+  if (!background_compiler_ || !function->RequestOptimization()) {
+    return;
+  }
+  background_compiler_->RequestOptimization(function);
+}
+
+bool Processor::OptimizeFunction(GuestFunction* function) {
+  assert_true(tiered_compilation_);
+  std::unique_lock<std::mutex> retranslation_lock(
+      function_retranslation_mutex_, std::defer_lock);
+  if (invalidate_modified_code_) {
+    retranslation_lock.lock();
+    // In case it has been modified and is waiting to be translated again.
+    WatchFunctionCode(function);
+  }
+  uint32_t modification_count = function->code_modification_count();
+  if (!frontend_->DefineFunction(function, debug_info_flags_, true)) {
+    XELOGW("Failed to optimize function {:08X}, keeping the baseline code",
+           function->address());
+    return false;
+  }
+  if (invalidate_modified_code_) {
+    OnFunctionTranslated(function, modification_count);
+  }
+  return true;
+}
+
+void Processor::CodeWriteCallbackThunk(void* context, uint32_t virtual_address,
+                                       uint32_t length) {
+  reinterpret_cast<Processor*>(context)->OnCodeWrite(virtual_address, length);
+}
+
+void Processor::OnCodeWrite(uint32_t virtual_address, uint32_t length) {
+  // Called with the global critical region locked, possibly in the access
+  // violation handler of the thread doing the write, which is resumed right
+  // after, so the functions are only marked to be translated again when
+  // they're called next.
+  auto global_lock = global_critical_region_.Acquire();
+  uint32_t system_page_size = uint32_t(xe::memory::page_size());
+  uint32_t page_last = (virtual_address + (length - 1)) / system_page_size;
+  for (uint32_t page = virtual_address / system_page_size; page <= page_last;
+       ++page) {
+    auto it = code_write_watch_functions_.find(page);
+    if (it == code_write_watch_functions_.end()) {
+      continue;
+    }
+    for (GuestFunction* function : it->second) {
+      function->MarkCodeModified();
+      backend_->InvalidateFunction(function);
+    }
+    code_write_watch_functions_.erase(it);
+  }
+}
+
+void Processor::WatchFunctionCode(GuestFunction* function) {
+  uint32_t system_page_size = uint32_t(xe::memory::page_size());
+  auto global_lock = global_critical_region_.Acquire();
+  auto watch_range = [&](uint32_t low_address, uint32_t high_address) {
+    for (uint32_t page = low_address / system_page_size;
+         page <= high_address / system_page_size; ++page) {
+      std::vector<GuestFunction*>& page_functions =
+          code_write_watch_functions_[page];
+      if (std::find(page_functions.cbegin(), page_functions.cend(),
+                    function) == page_functions.cend()) {
+        page_functions.push_back(function);
+      }
+    }
+    memory_->WatchCodeWrites(low_address, high_address - low_address + 4);
+  };
+  watch_range(function->address(), function->end_address());
+  for (GuestFunction* inlined_function : function->inlined_functions()) {
+    watch_range(inlined_function->address(), inlined_function->end_address());
+  }
+}
+
+void Processor::OnFunctionTranslated(GuestFunction* function,
+                                     uint32_t modification_count) {
+  auto global_lock = global_critical_region_.Acquire();
+  function->set_translated_code_modification_count(modification_count);
+  // The extents and the inlined functions may be different now.
+  WatchFunctionCode(function);
+  // The code may have been modified while being translated, in which case the
+  // translation may have read either version, and the code that has just been
+  // installed must not be called.
+  if (function->code_modification_count() != modification_count) {
+    backend_->InvalidateFunction(function);
+  }
+}
+
+bool Processor::RetranslateModifiedFunction(GuestFunction* function) {
+  std::lock_guard<std::mutex> retranslation_lock(function_retranslation_mutex_);
+  if (!function->is_code_modified()) {
+    // Translated again by another thread.
+    return true;
+  }
+  // The pages written to are not watched anymore, so they must be watched
+  // again before reading the code for the writes during the translation to be
+  // noticed. Without code invalidation, this is done for the compiled
+  // breakpoints.
+  if (invalidate_modified_code_) {
+    WatchFunctionCode(function);
+  }
+  uint32_t modification_count = function->code_modification_count();
+  // Optimized code stays optimized, and baseline code is optimized again once
+  // it's hot as usual.
+  if (!frontend_->DefineFunction(
+          function, debug_info_flags_,
+          function->tier() == GuestFunction::Tier::kOptimized)) {
+    XELOGE("Failed to translate modified function {:08X} again",
+           function->address());
+    return false;
+  }
+  if (invalidate_modified_code_) {
+    OnFunctionTranslated(function, modification_count);
+  } else {
+    function->set_translated_code_modification_count(modification_count);
+  }
+  // Breakpoints need to be installed in the new code.
+  OnFunctionDefined(function);
+  return true;
+}
+
 bool Processor::Execute(ThreadState* thread_state, uint32_t address) {
   SCOPE_profile_cpu_f("cpu");
 
@@ -335,6 +662,21 @@ bool Processor::Execute(ThreadState* thread_state, uint32_t address) {
     return false;
   }
 
+  return Execute(thread_state, function);
+}
+
+bool Processor::Execute(ThreadState* thread_state, Function* function) {
+  SCOPE_profile_cpu_f("cpu");
+
+  // Translated again if modified since it has been resolved.
+  if (function->is_guest() &&
+      static_cast<GuestFunction*>(function)->is_code_modified()) {
+    function = ResolveFunction(function->address());
+    if (!function) {
+      return false;
+    }
+  }
+
   auto context = thread_state->context();
 
   // Pad out stack a bit, as some games seem to overwrite the caller by about
@@ -373,6 +715,18 @@ uint64_t Processor::Execute(ThreadState* thread_state, uint32_t address,
                             uint64_t args[], size_t arg_count) {
   SCOPE_profile_cpu_f("cpu");
 
+  auto function = ResolveFunction(address);
+  if (!function) {
+    XELOGCPU("Execute({:08X}): failed to find function", address);
+    return 0xDEADBABE;
+  }
+  return Execute(thread_state, function, args, arg_count);
+}
+
+uint64_t Processor::Execute(ThreadState* thread_state, Function* function,
+                            uint64_t args[], size_t arg_count) {
+  SCOPE_profile_cpu_f("cpu");
+
   auto context = thread_state->context();
   for (size_t i = 0; i < std::min(arg_count, static_cast<size_t>(8)); ++i) {
     context->r[3 + i] = args[i];
@@ -389,7 +743,7 @@ uint64_t Processor::Execute(ThreadState* thread_state, uint32_t address,
     }
   }
 
-  if (!Execute(thread_state, address)) {
+  if (!Execute(thread_state, function)) {
     return 0xDEADBABE;
   }
   return context->r[3];
@@ -400,6 +754,19 @@ uint64_t Processor::ExecuteInterrupt(ThreadState* thread_state,
                                      size_t arg_count) {
   SCOPE_profile_cpu_f("cpu");
 
+  auto function = ResolveFunction(address);
+  if (!function) {
+    XELOGCPU("Execute({:08X}): failed to find function", address);
+    return 0xDEADBABE;
+  }
+  return ExecuteInterrupt(thread_state, function, args, arg_count);
+}
+
+uint64_t Processor::ExecuteInterrupt(ThreadState* thread_state,
+                                     Function* function, uint64_t args[],
+                                     size_t arg_count) {
+  SCOPE_profile_cpu_f("cpu");
+
   // Hold the global lock during interrupt dispatch.
   // This will block if any code is in a critical region (has interrupts
   // disabled) or if any other interrupt is executing.
@@ -418,7 +785,7 @@ uint64_t Processor::ExecuteInterrupt(ThreadState* thread_state,
   uint32_t old_tls_ptr = xe::load_and_swap<uint32_t>(pcr_address);
   xe::store_and_swap<uint32_t>(pcr_address, 0);
 
-  if (!Execute(thread_state, address)) {
+  if (!Execute(thread_state, function)) {
     return 0xDEADBABE;
   }
 
@@ -476,7 +843,8 @@ void Processor::OnFunctionDefined(Function* function) {
   for (auto breakpoint : breakpoints_) {
     if (breakpoint->address_type() == Breakpoint::AddressType::kGuest) {
       if (function->ContainsAddress(breakpoint->guest_address())) {
-        if (breakpoint->is_installed()) {
+        // Compiled breakpoints are already in the code.
+        if (breakpoint->is_installed() && !breakpoint->is_compiled()) {
           backend_->InstallBreakpoint(breakpoint, function);
         }
       }
@@ -493,7 +861,11 @@ void Processor::OnThreadCreated(uint32_t thread_handle,
   thread_info->thread = thread;
   thread_info->state = ThreadDebugInfo::State::kAlive;
   thread_info->suspended = false;
+  ThreadDebugInfo* thread_info_ptr = thread_info.get();
   thread_debug_infos_.emplace(thread_info->thread_id, std::move(thread_info));
+  if (debug_listener_) {
+    debug_listener_->OnThreadStateChanged(thread_info_ptr);
+  }
 }
 
 void Processor::OnThreadExit(uint32_t thread_id) {
@@ -502,6 +874,9 @@ void Processor::OnThreadExit(uint32_t thread_id) {
   assert_true(it != thread_debug_infos_.end());
   auto thread_info = it->second.get();
   thread_info->state = ThreadDebugInfo::State::kExited;
+  if (debug_listener_) {
+    debug_listener_->OnThreadStateChanged(thread_info);
+  }
 }
 
 void Processor::OnThreadDestroyed(uint32_t thread_id) {
@@ -511,6 +886,9 @@ void Processor::OnThreadDestroyed(uint32_t thread_id) {
   auto thread_info = it->second.get();
   thread_info->state = ThreadDebugInfo::State::kZombie;
   thread_info->thread = nullptr;
+  if (debug_listener_) {
+    debug_listener_->OnThreadStateChanged(thread_info);
+  }
 }
 
 void Processor::OnThreadEnteringWait(uint32_t thread_id) {
@@ -519,6 +897,9 @@ void Processor::OnThreadEnteringWait(uint32_t thread_id) {
   assert_true(it != thread_debug_infos_.end());
   auto thread_info = it->second.get();
   thread_info->state = ThreadDebugInfo::State::kWaiting;
+  if (debug_listener_) {
+    debug_listener_->OnThreadStateChanged(thread_info);
+  }
 }
 
 void Processor::OnThreadLeavingWait(uint32_t thread_id) {
@@ -528,6 +909,9 @@ void Processor::OnThreadLeavingWait(uint32_t thread_id) {
   auto thread_info = it->second.get();
   if (thread_info->state == ThreadDebugInfo::State::kWaiting) {
     thread_info->state = ThreadDebugInfo::State::kAlive;
+    if (debug_listener_) {
+      debug_listener_->OnThreadStateChanged(thread_info);
+    }
   }
 }
 
@@ -549,7 +933,42 @@ ThreadDebugInfo* Processor::QueryThreadDebugInfo(uint32_t thread_id) {
   return it->second.get();
 }
 
+bool Processor::UpdateThreadExecutionState(uint32_t thread_id) {
+  auto global_lock = global_critical_region_.Acquire();
+  auto it = thread_debug_infos_.find(thread_id);
+  if (it == thread_debug_infos_.end()) {
+    return false;
+  }
+  auto thread_info = it->second.get();
+  if (thread_info->suspended) {
+    if (thread_info->execution_state_stale) {
+      CaptureThreadExecutionState(thread_info);
+    }
+    return true;
+  }
+  auto thread = thread_info->thread;
+  if (thread_info->state == ThreadDebugInfo::State::kZombie ||
+      thread_info->state == ThreadDebugInfo::State::kExited ||
+      !thread->can_debugger_suspend() ||
+      (Thread::IsInThread() &&
+       thread_info->thread_id == Thread::GetCurrentThreadId())) {
+    return false;
+  }
+  // Take a sample of a running thread without stopping the others.
+  if (!thread->thread()->Suspend(nullptr)) {
+    return false;
+  }
+  CaptureThreadExecutionState(thread_info);
+  thread->thread()->Resume();
+  thread_info->execution_state_stale = true;
+  return true;
+}
+
 void Processor::AddBreakpoint(Breakpoint* breakpoint) {
+  if (breakpoint->is_compiled()) {
+    RegisterCompiledBreakpoint(breakpoint);
+  }
+
   auto global_lock = global_critical_region_.Acquire();
 
   // Add to breakpoints map.
@@ -571,6 +990,11 @@ void Processor::RemoveBreakpoint(Breakpoint* breakpoint) {
   // Remove from breakpoint map.
   auto it = std::find(breakpoints_.begin(), breakpoints_.end(), breakpoint);
   breakpoints_.erase(it);
+
+  if (breakpoint->is_compiled()) {
+    global_lock.unlock();
+    UnregisterCompiledBreakpoint(breakpoint);
+  }
 }
 
 Breakpoint* Processor::FindBreakpoint(uint32_t address) {
@@ -583,6 +1007,155 @@ Breakpoint* Processor::FindBreakpoint(uint32_t address) {
   return nullptr;
 }
 
+std::vector<const CompiledBreakpoint*> Processor::GetCompiledBreakpoints(
+    uint32_t address) {
+  std::vector<const CompiledBreakpoint*> result;
+  if (!compiled_breakpoint_count_.load(std::memory_order_acquire)) {
+    return result;
+  }
+  std::lock_guard<std::mutex> lock(compiled_breakpoints_mutex_);
+  auto range = compiled_breakpoints_.equal_range(address);
+  for (auto it = range.first; it != range.second; ++it) {
+    result.push_back(it->second);
+  }
+  return result;
+}
+
+bool Processor::HasCompiledBreakpoints(uint32_t low_address,
+                                       uint32_t high_address) {
+  if (!compiled_breakpoint_count_.load(std::memory_order_acquire)) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(compiled_breakpoints_mutex_);
+  auto it = compiled_breakpoints_.lower_bound(low_address);
+  return it != compiled_breakpoints_.end() && it->first <= high_address;
+}
+
+void Processor::RegisterCompiledBreakpoint(Breakpoint* breakpoint) {
+  CompiledBreakpoint* compiled_breakpoint = breakpoint->compiled_;
+  if (!compiled_breakpoint) {
+    auto new_compiled_breakpoint = std::make_unique<CompiledBreakpoint>();
+    compiled_breakpoint = new_compiled_breakpoint.get();
+    compiled_breakpoint->guest_address = breakpoint->guest_address();
+    compiled_breakpoint->condition = breakpoint->condition();
+    compiled_breakpoint->is_tracepoint = breakpoint->is_tracepoint();
+    {
+      auto global_lock = global_critical_region_.Acquire();
+      compiled_breakpoint->hit_function = DefineBuiltin(
+          fmt::format("CompiledBreakpointHit_{:08X}",
+                      compiled_breakpoint->guest_address),
+          CompiledBreakpointHitThunk, this, compiled_breakpoint);
+    }
+    {
+      std::lock_guard<std::mutex> lock(compiled_breakpoints_mutex_);
+      compiled_breakpoint_storage_.push_back(
+          std::move(new_compiled_breakpoint));
+    }
+    breakpoint->compiled_ = compiled_breakpoint;
+  }
+  {
+    std::lock_guard<std::mutex> lock(compiled_breakpoints_mutex_);
+    compiled_breakpoints_.emplace(compiled_breakpoint->guest_address,
+                                  compiled_breakpoint);
+    compiled_breakpoint_count_.store(compiled_breakpoints_.size(),
+                                     std::memory_order_release);
+    compiled_breakpoint_generation_.fetch_add(1, std::memory_order_acq_rel);
+  }
+  InvalidateFunctionsWithAddress(compiled_breakpoint->guest_address);
+}
+
+void Processor::UnregisterCompiledBreakpoint(Breakpoint* breakpoint) {
+  CompiledBreakpoint* compiled_breakpoint = breakpoint->compiled_;
+  assert_not_null(compiled_breakpoint);
+  {
+    std::lock_guard<std::mutex> lock(compiled_breakpoints_mutex_);
+    auto range =
+        compiled_breakpoints_.equal_range(compiled_breakpoint->guest_address);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == compiled_breakpoint) {
+        compiled_breakpoints_.erase(it);
+        break;
+      }
+    }
+    compiled_breakpoint_count_.store(compiled_breakpoints_.size(),
+                                     std::memory_order_release);
+    compiled_breakpoint_generation_.fetch_add(1, std::memory_order_acq_rel);
+  }
+  // The breakpoint is disarmed already, this only removes the check.
+  InvalidateFunctionsWithAddress(compiled_breakpoint->guest_address);
+}
+
+void Processor::InvalidateFunctionsWithAddress(uint32_t address) {
+  // Not retranslating while looking at the inlined functions.
+  std::lock_guard<std::mutex> retranslation_lock(function_retranslation_mutex_);
+  auto global_lock = global_critical_region_.Acquire();
+  for (Function* function : entry_table_.FindWithAddress(address, true)) {
+    if (!function->is_guest()) {
+      continue;
+    }
+    auto guest_function = static_cast<GuestFunction*>(function);
+    guest_function->MarkCodeModified();
+    backend_->InvalidateFunction(guest_function);
+  }
+}
+
+void Processor::CompiledBreakpointHitThunk(ppc::PPCContext* ppc_context,
+                                           void* arg0, void* arg1) {
+  reinterpret_cast<Processor*>(arg0)->OnCompiledBreakpointHit(
+      ppc_context, reinterpret_cast<CompiledBreakpoint*>(arg1));
+}
+
+void Processor::OnCompiledBreakpointHit(
+    ppc::PPCContext* ppc_context, CompiledBreakpoint* compiled_breakpoint) {
+  // The generated code traps to the debugger if scratch is set.
+  ppc_context->scratch = 0;
+  if (!compiled_breakpoint->armed.load(std::memory_order_acquire)) {
+    return;
+  }
+  compiled_breakpoint->hit_count.fetch_add(1, std::memory_order_relaxed);
+  if (!compiled_breakpoint->is_tracepoint) {
+    ppc_context->scratch = 1;
+    return;
+  }
+  std::lock_guard<std::mutex> lock(tracepoint_hits_mutex_);
+  if (tracepoint_hits_.size() != cvars::tracepoint_hit_buffer_size) {
+    tracepoint_hits_.resize(cvars::tracepoint_hit_buffer_size);
+    tracepoint_hit_count_ = 0;
+  }
+  if (tracepoint_hits_.empty()) {
+    return;
+  }
+  TracepointHit& hit =
+      tracepoint_hits_[tracepoint_hit_count_++ % tracepoint_hits_.size()];
+  hit.host_tick_count = Clock::QueryHostTickCount();
+  hit.guest_address = compiled_breakpoint->guest_address;
+  hit.thread_id = ppc_context->thread_id;
+  std::memcpy(hit.r, ppc_context->r, sizeof(hit.r));
+  hit.lr = ppc_context->lr;
+  hit.ctr = ppc_context->ctr;
+}
+
+std::vector<TracepointHit> Processor::QueryTracepointHits() {
+  std::lock_guard<std::mutex> lock(tracepoint_hits_mutex_);
+  std::vector<TracepointHit> hits;
+  if (tracepoint_hits_.empty()) {
+    return hits;
+  }
+  size_t capacity = tracepoint_hits_.size();
+  size_t count = size_t(std::min(tracepoint_hit_count_, uint64_t(capacity)));
+  hits.reserve(count);
+  for (uint64_t i = tracepoint_hit_count_ - count; i < tracepoint_hit_count_;
+       ++i) {
+    hits.push_back(tracepoint_hits_[i % capacity]);
+  }
+  return hits;
+}
+
+void Processor::ClearTracepointHits() {
+  std::lock_guard<std::mutex> lock(tracepoint_hits_mutex_);
+  tracepoint_hit_count_ = 0;
+}
+
 void Processor::set_debug_listener(DebugListener* debug_listener) {
   if (debug_listener == debug_listener_) {
     return;
@@ -637,10 +1210,13 @@ bool Processor::OnThreadBreakpointHit(Exception* ex) {
     SuspendAllBreakpoints();
   }
 
-  // Update all thread states with their latest values, using the context we
-  // got from the exception instead of a sampled value (as it would just show
-  // the exception handler).
-  UpdateThreadExecutionStates(thread_info->thread_id, ex->thread_context());
+  // Update the state of this thread with its latest values, using the context
+  // we got from the exception instead of a sampled value (as it would just show
+  // the exception handler). Other threads are sampled when the debugger needs
+  // them, as capturing and resolving the stacks of all threads on every break
+  // is slow in titles with many threads.
+  InvalidateThreadExecutionStates();
+  CaptureThreadExecutionState(thread_info, ex->thread_context());
 
   // Walk the captured thread stack and look for breakpoints at any address in
   // the stack. We just look for the first one.
@@ -657,6 +1233,18 @@ bool Processor::OnThreadBreakpointHit(Exception* ex) {
       }
     }
     if (breakpoint) {
+      if (!i && breakpoint->is_compiled()) {
+        // Trapped by the inline check before the instruction - continue
+        // after the trap rather than hitting it again.
+#if XE_ARCH_AMD64
+        uint64_t& host_pc = thread_info->host_context.rip;
+#elif XE_ARCH_ARM64
+        uint64_t& host_pc = thread_info->host_context.pc;
+#else
+#error Instruction pointer not specified for the target CPU architecture.
+#endif  // XE_ARCH
+        host_pc = backend_->CalculateNextHostInstruction(thread_info, host_pc);
+      }
       breakpoint->OnHit(thread_info, frame.host_pc);
       break;
     }
@@ -719,8 +1307,12 @@ bool Processor::OnUnhandledException(Exception* ex) {
   // Suspend all guest threads (but this one).
   SuspendAllThreads();
 
-  UpdateThreadExecutionStates(Thread::GetCurrentThreadId(),
-                              ex->thread_context());
+  InvalidateThreadExecutionStates();
+  auto thread_info_it = thread_debug_infos_.find(Thread::GetCurrentThreadId());
+  if (thread_info_it != thread_debug_infos_.end()) {
+    CaptureThreadExecutionState(thread_info_it->second.get(),
+                                ex->thread_context());
+  }
 
   // Stop and notify the listener.
   // This will take control.
@@ -784,6 +1376,7 @@ bool Processor::ResumeThread(uint32_t thread_id) {
   assert_false(thread_info->state == ThreadDebugInfo::State::kExited ||
                thread_info->state == ThreadDebugInfo::State::kZombie);
   thread_info->suspended = false;
+  thread_info->execution_state_stale = true;
   auto thread = thread_info->thread;
   return thread->thread()->Resume();
 }
@@ -810,66 +1403,67 @@ bool Processor::ResumeAllThreads() {
       continue;
     }
     thread_info->suspended = false;
+    thread_info->execution_state_stale = true;
     bool did_resume = thread->thread()->Resume();
     assert_true(did_resume);
   }
   return true;
 }
 
-void Processor::UpdateThreadExecutionStates(
-    uint32_t override_thread_id, HostThreadContext* override_context) {
+void Processor::InvalidateThreadExecutionStates() {
+  auto global_lock = global_critical_region_.Acquire();
+  for (auto& it : thread_debug_infos_) {
+    it.second->execution_state_stale = true;
+  }
+}
+
+void Processor::CaptureThreadExecutionState(
+    ThreadDebugInfo* thread_info, HostThreadContext* override_context) {
   auto global_lock = global_critical_region_.Acquire();
+  auto thread = thread_info->thread;
+  if (!thread) {
+    return;
+  }
   uint64_t frame_host_pcs[64];
   xe::cpu::StackFrame cpu_frames[64];
-  for (auto& it : thread_debug_infos_) {
-    auto thread_info = it.second.get();
-    auto thread = thread_info->thread;
-    if (!thread) {
-      continue;
-    }
 
-    // Grab PPC context.
-    // Note that this is only up to date if --store_all_context_values is
-    // enabled (or --debug).
-    if (thread->can_debugger_suspend()) {
-      std::memcpy(&thread_info->guest_context,
-                  thread->thread_state()->context(),
-                  sizeof(thread_info->guest_context));
-    }
+  // Grab PPC context.
+  // Note that this is only up to date if --store_all_context_values is
+  // enabled (or --debug).
+  if (thread->can_debugger_suspend()) {
+    std::memcpy(&thread_info->guest_context, thread->thread_state()->context(),
+                sizeof(thread_info->guest_context));
+  }
 
-    // Grab stack trace and X64 context then resolve all symbols.
-    uint64_t hash;
-    HostThreadContext* in_host_context = nullptr;
-    if (override_thread_id == thread_info->thread_id) {
-      // If we were passed an override context we use that. Otherwise, ask the
-      // stack walker for a new context.
-      in_host_context = override_context;
-    }
-    size_t count = stack_walker_->CaptureStackTrace(
-        thread->thread()->native_handle(), frame_host_pcs, 0,
-        xe::countof(frame_host_pcs), in_host_context,
-        &thread_info->host_context, &hash);
-    stack_walker_->ResolveStack(frame_host_pcs, cpu_frames, count);
-    thread_info->frames.resize(count);
-    for (size_t i = 0; i < count; ++i) {
-      auto& cpu_frame = cpu_frames[i];
-      auto& frame = thread_info->frames[i];
-      frame.host_pc = cpu_frame.host_pc;
-      frame.host_function_address = cpu_frame.host_symbol.address;
-      frame.guest_pc = cpu_frame.guest_pc;
-      frame.guest_function_address = 0;
-      frame.guest_function = nullptr;
-      auto function = cpu_frame.guest_symbol.function;
-      if (cpu_frame.type == cpu::StackFrame::Type::kGuest && function) {
-        frame.guest_function_address = function->address();
-        frame.guest_function = function;
-      } else {
-        std::strncpy(frame.name, cpu_frame.host_symbol.name,
-                     xe::countof(frame.name));
-        frame.name[xe::countof(frame.name) - 1] = 0;
-      }
+  // Grab stack trace and X64 context then resolve all symbols. If we were
+  // passed an override context we use that. Otherwise, ask the stack walker
+  // for a new context.
+  uint64_t hash;
+  size_t count = stack_walker_->CaptureStackTrace(
+      thread->thread()->native_handle(), frame_host_pcs, 0,
+      xe::countof(frame_host_pcs), override_context, &thread_info->host_context,
+      &hash);
+  stack_walker_->ResolveStack(frame_host_pcs, cpu_frames, count);
+  thread_info->frames.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    auto& cpu_frame = cpu_frames[i];
+    auto& frame = thread_info->frames[i];
+    frame.host_pc = cpu_frame.host_pc;
+    frame.host_function_address = cpu_frame.host_symbol.address;
+    frame.guest_pc = cpu_frame.guest_pc;
+    frame.guest_function_address = 0;
+    frame.guest_function = nullptr;
+    auto function = cpu_frame.guest_symbol.function;
+    if (cpu_frame.type == cpu::StackFrame::Type::kGuest && function) {
+      frame.guest_function_address = function->address();
+      frame.guest_function = function;
+    } else {
+      std::strncpy(frame.name, cpu_frame.host_symbol.name,
+                   xe::countof(frame.name));
+      frame.name[xe::countof(frame.name) - 1] = 0;
     }
   }
+  thread_info->execution_state_stale = false;
 }
 
 void Processor::SuspendAllBreakpoints() {
@@ -892,7 +1486,8 @@ void Processor::Pause() {
     assert_true(execution_state_ == ExecutionState::kRunning);
     SuspendAllThreads();
     SuspendAllBreakpoints();
-    UpdateThreadExecutionStates();
+    // Sampled when the debugger requests the state of each thread.
+    InvalidateThreadExecutionStates();
     execution_state_ = ExecutionState::kPaused;
     if (debug_listener_) {
       debug_listener_->OnExecutionPaused();
@@ -922,6 +1517,9 @@ void Processor::StepHostInstruction(uint32_t thread_id) {
   execution_state_ = ExecutionState::kStepping;
 
   auto thread_info = QueryThreadDebugInfo(thread_id);
+  if (thread_info->execution_state_stale) {
+    CaptureThreadExecutionState(thread_info);
+  }
   uint64_t new_host_pc = backend_->CalculateNextHostInstruction(
       thread_info, thread_info->frames[0].host_pc);
 
@@ -954,6 +1552,9 @@ void Processor::StepGuestInstruction(uint32_t thread_id) {
   execution_state_ = ExecutionState::kStepping;
 
   auto thread_info = QueryThreadDebugInfo(thread_id);
+  if (thread_info->execution_state_stale) {
+    CaptureThreadExecutionState(thread_info);
+  }
 
   uint32_t next_pc = CalculateNextGuestInstruction(
       thread_info, thread_info->frames[0].guest_pc);
@@ -10,9 +10,12 @@
 #ifndef XENIA_CPU_PROCESSOR_H_
 #define XENIA_CPU_PROCESSOR_H_
 
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "xenia/base/cvar.h"
@@ -36,7 +39,11 @@ namespace cpu {
 
 constexpr fourcc_t kProcessorSaveSignature = make_fourcc("PROC");
 
+class BackgroundCompiler;
 class Breakpoint;
+struct CompiledBreakpoint;
+class RoutineSignatures;
+class SamplingProfiler;
 class StackWalker;
 class XexModule;
 
@@ -61,6 +68,16 @@ enum class ExecutionState {
   kEnded,
 };
 
+// Guest registers recorded when a thread has passed a tracepoint.
+struct TracepointHit {
+  uint64_t host_tick_count;
+  uint32_t guest_address;
+  uint32_t thread_id;
+  uint64_t r[32];
+  uint64_t lr;
+  uint64_t ctr;
+};
+
 class Processor {
  public:
   Processor(Memory* memory, ExportResolver* export_resolver);
@@ -103,12 +120,24 @@ class Processor {
   bool AddModule(std::unique_ptr<Module> module);
   Module* GetModule(const std::string_view name);
   std::vector<Module*> GetModules();
+  // Republishes the address index used by LookupFunction. Must be called by
+  // modules whose address range changes after they have been added.
+  void RebuildModuleIndex();
 
   Module* builtin_module() const { return builtin_module_; }
   Function* DefineBuiltin(const std::string_view name,
                           BuiltinFunction::Handler handler, void* arg0,
                           void* arg1);
 
+  // Host implementations of recognized guest library routines.
+  RoutineSignatures* routine_signatures() const {
+    return routine_signatures_.get();
+  }
+  // Loads the routine signatures from --routine_signatures_path, which may be
+  // specified in the per-game configuration. Must be called before any
+  // function is translated.
+  void LoadRoutineSignatures();
+
   Function* QueryFunction(uint32_t address);
   std::vector<Function*> FindFunctionsWithAddress(uint32_t address);
 
@@ -116,12 +145,30 @@ class Processor {
   Function* LookupFunction(Module* module, uint32_t address);
   Function* ResolveFunction(uint32_t address);
 
+  // Whether functions are first translated with the baseline tier and
+  // optimized once they're hot (see --tiered_compilation).
+  bool tiered_compilation() const { return tiered_compilation_; }
+  // Called by baseline code once it has been executed enough. Queues the
+  // function to be translated with all optimizations in the background.
+  void RequestFunctionOptimization(GuestFunction* function);
+  // Translates a hot function again with all optimizations, replacing its
+  // baseline code.
+  bool OptimizeFunction(GuestFunction* function);
+
   bool Execute(ThreadState* thread_state, uint32_t address);
   bool ExecuteRaw(ThreadState* thread_state, uint32_t address);
   uint64_t Execute(ThreadState* thread_state, uint32_t address, uint64_t args[],
                    size_t arg_count);
   uint64_t ExecuteInterrupt(ThreadState* thread_state, uint32_t address,
                             uint64_t args[], size_t arg_count);
+  // Callbacks called repeatedly by host threads, such as audio client callbacks
+  // and interrupt handlers, may be executed through the function resolved by
+  // ResolveFunction once instead of looking it up by the address every time.
+  bool Execute(ThreadState* thread_state, Function* function);
+  uint64_t Execute(ThreadState* thread_state, Function* function,
+                   uint64_t args[], size_t arg_count);
+  uint64_t ExecuteInterrupt(ThreadState* thread_state, Function* function,
+                            uint64_t args[], size_t arg_count);
 
   Irql RaiseIrql(Irql new_value);
   void LowerIrql(Irql old_value);
@@ -137,6 +184,13 @@ class Processor {
   // Returns the debugger info for the given thread.
   ThreadDebugInfo* QueryThreadDebugInfo(uint32_t thread_id);
 
+  // Samples the contexts and the call stack of the thread into its debugger
+  // info. If the thread is suspended by the debugger, this is done only if the
+  // sampled state is stale. If it's running, only this thread is suspended
+  // briefly, and the state stays marked as stale. Returns false if the thread
+  // can't be sampled, such as if it's dead or is the calling thread.
+  bool UpdateThreadExecutionState(uint32_t thread_id);
+
   // Adds a breakpoint to the debugger and activates it (if enabled).
   // The given breakpoint will not be owned by the debugger and must remain
   // allocated so long as it is added.
@@ -151,6 +205,19 @@ class Processor {
   // Returns all currently registered breakpoints.
   std::vector<Breakpoint*> breakpoints() const;
 
+  // Returns the conditional breakpoints and tracepoints to check in the code
+  // of the guest instruction at the address. Called during translation.
+  std::vector<const CompiledBreakpoint*> GetCompiledBreakpoints(
+      uint32_t address);
+  // Whether there are conditional breakpoints or tracepoints in the range, in
+  // which case the code in it must not be inlined into other functions.
+  bool HasCompiledBreakpoints(uint32_t low_address, uint32_t high_address);
+
+  // Returns the latest tracepoint hits (up to --tracepoint_hit_buffer_size),
+  // oldest first.
+  std::vector<TracepointHit> QueryTracepointHits();
+  void ClearTracepointHits();
+
   // Shows the debug listener, focusing it if it already exists.
   void ShowDebugger();
 
@@ -210,11 +277,13 @@ class Processor {
   bool ResumeThread(uint32_t thread_id);
   // Resumes all known threads (except the caller).
   bool ResumeAllThreads();
-  // Updates all cached thread execution info (state, call stacks, etc).
-  // The given override thread handle and context will be used in place of
-  // sampled values for that thread.
-  void UpdateThreadExecutionStates(
-      uint32_t override_handle = 0,
+  // Marks the cached thread execution info (contexts, call stacks) of all
+  // threads as stale, to be updated on demand.
+  void InvalidateThreadExecutionStates();
+  // Updates the cached thread execution info of the thread. The given context
+  // will be used in place of sampled values if not null.
+  void CaptureThreadExecutionState(
+      ThreadDebugInfo* thread_info,
       HostThreadContext* override_context = nullptr);
 
   // Suspends all breakpoints, uninstalling them as required.
@@ -225,6 +294,18 @@ class Processor {
 
   void OnFunctionDefined(Function* function);
 
+  // Adds the inline checks of a conditional breakpoint or a tracepoint to the
+  // code, or removes them. Must be called without the global lock held.
+  void RegisterCompiledBreakpoint(Breakpoint* breakpoint);
+  void UnregisterCompiledBreakpoint(Breakpoint* breakpoint);
+  // Makes the functions containing the address, or having a function containing
+  // it inlined, translated again when they're called next.
+  void InvalidateFunctionsWithAddress(uint32_t address);
+  static void CompiledBreakpointHitThunk(ppc::PPCContext* ppc_context,
+                                         void* arg0, void* arg1);
+  void OnCompiledBreakpointHit(ppc::PPCContext* ppc_context,
+                               CompiledBreakpoint* compiled_breakpoint);
+
   static bool ExceptionCallbackThunk(Exception* ex, void* data);
   bool ExceptionCallback(Exception* ex);
   void OnStepCompleted(ThreadDebugInfo* thread_info);
@@ -238,6 +319,18 @@ class Processor {
 
   bool DemandFunction(Function* function);
 
+  // Invalidation of the functions translated from code that has been modified
+  // (see --invalidate_modified_code).
+  static void CodeWriteCallbackThunk(void* context, uint32_t virtual_address,
+                                     uint32_t length);
+  void OnCodeWrite(uint32_t virtual_address, uint32_t length);
+  // Watches the code of the function and of the functions inlined into it.
+  void WatchFunctionCode(GuestFunction* function);
+  // Called after a translation which has started with the modification count.
+  void OnFunctionTranslated(GuestFunction* function,
+                            uint32_t modification_count);
+  bool RetranslateModifiedFunction(GuestFunction* function);
+
   Memory* memory_ = nullptr;
   std::unique_ptr<StackWalker> stack_walker_;
 
@@ -252,12 +345,50 @@ class Processor {
 
   std::unique_ptr<ppc::PPCFrontend> frontend_;
   std::unique_ptr<backend::Backend> backend_;
+  // Exists only if background or tiered compilation is enabled.
+  std::unique_ptr<BackgroundCompiler> background_compiler_;
+  std::unique_ptr<SamplingProfiler> sampling_profiler_;
+  std::unique_ptr<RoutineSignatures> routine_signatures_;
+  bool tiered_compilation_ = false;
   ExportResolver* export_resolver_ = nullptr;
 
+  bool invalidate_modified_code_ = false;
+  // Functions with translated code in every watched system page, by the page
+  // number, protected by the global critical region.
+  std::unordered_map<uint32_t, std::vector<GuestFunction*>>
+      code_write_watch_functions_;
+  // Serializes the translations replacing the code of defined functions when
+  // code is invalidated.
+  std::mutex function_retranslation_mutex_;
+
+  // Immutable snapshot of the modules for lock-free address lookups, replaced
+  // as a whole whenever modules are added.
+  struct ModuleIndex {
+    struct Range {
+      uint32_t low_address;
+      uint32_t high_address;
+      // Position in modules_, to preserve the first-added-wins order.
+      size_t module_order;
+      Module* module;
+    };
+    // Non-overlapping ranges sorted by low_address.
+    std::vector<Range> ranges;
+    // Modules without a known contiguous range, checked with ContainsAddress,
+    // in the order they were added.
+    std::vector<std::pair<size_t, Module*>> unranged_modules;
+    // Unique across all processors, for validating thread-local caches.
+    uint64_t serial;
+  };
+  Module* FindModuleWithAddress(uint32_t address);
+
   EntryTable entry_table_;
   xe::global_critical_region global_critical_region_;
   ExecutionState execution_state_ = ExecutionState::kPaused;
   std::vector<std::unique_ptr<Module>> modules_;
+  std::atomic<const ModuleIndex*> module_index_ = {nullptr};
+  // Replaced indices are kept alive (modules are never removed, so there are
+  // as many as modules) because lookups may still be reading them.
+  std::vector<std::unique_ptr<const ModuleIndex>> module_indices_;
   Module* builtin_module_ = nullptr;
   uint32_t next_builtin_address_ = 0xFFFF0000u;
 
@@ -268,6 +399,21 @@ class Processor {
   // TODO(benvanik): cleanup/change structures.
   std::vector<Breakpoint*> breakpoints_;
 
+  std::mutex compiled_breakpoints_mutex_;
+  std::vector<std::unique_ptr<CompiledBreakpoint>> compiled_breakpoint_storage_;
+  // Registered ones by the guest address.
+  std::multimap<uint32_t, CompiledBreakpoint*> compiled_breakpoints_;
+  // For skipping the lookups during translation while there are none.
+  std::atomic<size_t> compiled_breakpoint_count_ = {0};
+  // Incremented on every registration change, for detecting translations
+  // which may have missed it.
+  std::atomic<uint32_t> compiled_breakpoint_generation_ = {0};
+
+  std::mutex tracepoint_hits_mutex_;
+  // Ring buffer of the latest hits.
+  std::vector<TracepointHit> tracepoint_hits_;
+  uint64_t tracepoint_hit_count_ = 0;
+
   Irql irql_;
 };
 
@@ -0,0 +1,321 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/routine_signatures.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "third_party/fmt/include/fmt/format.h"
+#include "xenia/base/byte_order.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/xxhash.h"
+#include "xenia/cpu/function.h"
+#include "xenia/cpu/processor.h"
+#include "xenia/memory.h"
+
+DEFINE_bool(log_routine_signatures, false,
+            "Log the signature of every translated guest function, for adding "
+            "the signatures of library routines to --routine_signatures_path.",
+            "CPU");
+
+namespace xe {
+namespace cpu {
+
+namespace {
+// GPU registers and writeback, accessed through MMIO handlers that can only
+// decode the instructions emitted by the JIT.
+constexpr uint32_t kMMIOBase = 0x7F000000;
+constexpr uint32_t kMMIOEnd = 0x80000000;
+
+// Returns the host pointer to the guest range if it can be accessed directly by
+// the host, which is the case if it doesn't overlap MMIO and doesn't leave the
+// 256 MB region, as every region is in a single heap mapped contiguously.
+uint8_t* TranslateRange(Memory* memory, uint32_t address, uint32_t length) {
+  uint32_t last = address + (length - 1);
+  if (!length || last < address || (address >> 28) != (last >> 28) ||
+      (address < kMMIOEnd && last >= kMMIOBase)) {
+    return nullptr;
+  }
+  return memory->TranslateVirtual(address);
+}
+
+// memcpy, memmove and XMemCpy (void* dest, const void* src, size_t count).
+bool CopyMemory(Memory* memory, ppc::PPCContext* ctx) {
+  uint32_t dest = uint32_t(ctx->r[3]);
+  uint32_t src = uint32_t(ctx->r[4]);
+  uint32_t count = uint32_t(ctx->r[5]);
+  if (count) {
+    uint8_t* host_dest = TranslateRange(memory, dest, count);
+    uint8_t* host_src = TranslateRange(memory, src, count);
+    if (!host_dest || !host_src) {
+      return false;
+    }
+    // The guest memcpy may be used for overlapping ranges.
+    std::memmove(host_dest, host_src, count);
+  }
+  ctx->r[3] = dest;
+  return true;
+}
+
+// memset and XMemSet (void* dest, int c, size_t count).
+bool SetMemory(Memory* memory, ppc::PPCContext* ctx) {
+  uint32_t dest = uint32_t(ctx->r[3]);
+  uint32_t count = uint32_t(ctx->r[5]);
+  if (count) {
+    uint8_t* host_dest = TranslateRange(memory, dest, count);
+    if (!host_dest) {
+      return false;
+    }
+    std::memset(host_dest, uint8_t(ctx->r[4]), count);
+  }
+  ctx->r[3] = dest;
+  return true;
+}
+
+// strlen (const char* str).
+bool StringLength(Memory* memory, ppc::PPCContext* ctx) {
+  uint32_t str = uint32_t(ctx->r[3]);
+  if (str >= kMMIOBase && str < kMMIOEnd) {
+    return false;
+  }
+  // Searching for the terminator until the end of the region.
+  uint64_t search_end = uint64_t(str | 0x0FFFFFFF) + 1;
+  if (str < kMMIOBase) {
+    search_end = std::min(search_end, uint64_t(kMMIOBase));
+  }
+  const uint8_t* host_str = memory->TranslateVirtual(str);
+  auto terminator = static_cast<const uint8_t*>(
+      std::memchr(host_str, 0, size_t(search_end - str)));
+  if (!terminator) {
+    return false;
+  }
+  ctx->r[3] = uint64_t(terminator - host_str);
+  return true;
+}
+
+struct HostRoutine {
+  const char* name;
+  bool (*handler)(Memory* memory, ppc::PPCContext* ctx);
+};
+
+const HostRoutine kHostRoutines[] = {
+    {"memcpy", CopyMemory},  {"memmove", CopyMemory}, {"XMemCpy", CopyMemory},
+    {"memset", SetMemory},   {"XMemSet", SetMemory},   {"strlen", StringLength},
+};
+}  // namespace
+
+RoutineSignatures::RoutineSignatures(Processor* processor)
+    : processor_(processor), lookups_(0), matches_(0) {
+  for (const HostRoutine& host_routine : kHostRoutines) {
+    auto routine = std::make_unique<Routine>();
+    routine->name = host_routine.name;
+    routine->handler = host_routine.handler;
+    routine->builtin = processor_->DefineBuiltin(
+        fmt::format("host_{}", host_routine.name), HandlerThunk,
+        processor_->memory(), routine.get());
+    routine->calls = 0;
+    routine->fallbacks = 0;
+    routines_.push_back(std::move(routine));
+  }
+}
+
+RoutineSignatures::~RoutineSignatures() = default;
+
+uint64_t RoutineSignatures::HashInstructions(uint32_t address,
+                                             const uint32_t* codes,
+                                             size_t count) {
+  uint32_t end_address = address + uint32_t(count * 4);
+  // Registers containing addresses built with lis, approximately, as the
+  // registers written by other instructions stay marked.
+  uint32_t lis_registers = 0;
+  std::vector<uint32_t> normalized_codes(codes, codes + count);
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t& code = normalized_codes[i];
+    uint32_t instr_address = address + uint32_t(i * 4);
+    uint32_t rt = (code >> 21) & 31;
+    uint32_t ra = (code >> 16) & 31;
+    bool is_lis_based = ra && (lis_registers & (1u << ra));
+    switch (code >> 26) {
+      case 16:    // bc
+      case 18: {  // b
+        bool is_bc = (code >> 26) == 16;
+        uint32_t mask = is_bc ? 0x0000FFFC : 0x03FFFFFC;
+        uint32_t sign = is_bc ? 0x00008000 : 0x02000000;
+        uint32_t displacement = code & mask;
+        if (displacement & sign) {
+          displacement |= ~mask & ~uint32_t(3);
+        }
+        uint32_t target =
+            (code & 0x2) ? displacement : instr_address + displacement;
+        // Calls and tail calls of functions linked elsewhere.
+        if ((code & 0x2) || target < address || target >= end_address) {
+          code &= ~mask;
+        }
+      } break;
+      case 15:  // addis, lis
+        if (!ra || is_lis_based) {
+          code &= ~uint32_t(0xFFFF);
+          lis_registers |= 1u << rt;
+        } else {
+          lis_registers &= ~(1u << rt);
+        }
+        break;
+      case 14:  // addi, li
+        if (is_lis_based) {
+          code &= ~uint32_t(0xFFFF);
+          lis_registers |= 1u << rt;
+        } else {
+          lis_registers &= ~(1u << rt);
+        }
+        break;
+      case 24:  // ori
+        if (rt && (lis_registers & (1u << rt))) {
+          code &= ~uint32_t(0xFFFF);
+          lis_registers |= 1u << ra;
+        }
+        break;
+      default: {
+        uint32_t primary = code >> 26;
+        // Loads and stores with a displacement.
+        bool is_load_store = primary >= 32 && primary <= 55;
+        if (primary == 58 || primary == 62) {
+          is_load_store = true;
+        }
+        if (!is_load_store) {
+          break;
+        }
+        if (is_lis_based) {
+          code &= ~uint32_t(primary >= 58 ? 0xFFFC : 0xFFFF);
+        }
+        // Integer loads.
+        if ((primary < 48 && !(primary & 4)) || primary == 58) {
+          lis_registers &= ~(1u << rt);
+        }
+      } break;
+    }
+  }
+  return XXH3_64bits(normalized_codes.data(),
+                     normalized_codes.size() * sizeof(uint32_t));
+}
+
+bool RoutineSignatures::AddSignature(uint64_t hash, uint32_t instruction_count,
+                                     const std::string_view routine_name) {
+  auto it = std::find_if(routines_.begin(), routines_.end(),
+                         [&](const std::unique_ptr<Routine>& routine) {
+                           return routine_name == routine->name;
+                         });
+  if (it == routines_.end()) {
+    return false;
+  }
+  signatures_[hash] = {instruction_count, it->get()};
+  return true;
+}
+
+bool RoutineSignatures::LoadFile(const std::filesystem::path& path) {
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    XELOGE("Failed to open the routine signatures {}", xe::path_to_utf8(path));
+    return false;
+  }
+  size_t signature_count = 0;
+  std::string line;
+  uint32_t line_number = 0;
+  while (std::getline(file, line)) {
+    ++line_number;
+    line = line.substr(0, line.find('#'));
+    std::istringstream tokens(line);
+    std::string hash_token, routine_name;
+    uint32_t instruction_count;
+    if (!(tokens >> hash_token)) {
+      continue;
+    }
+    char* hash_token_end;
+    uint64_t hash = std::strtoull(hash_token.c_str(), &hash_token_end, 16);
+    if (*hash_token_end || !(tokens >> instruction_count >> routine_name) ||
+        !AddSignature(hash, instruction_count, routine_name)) {
+      XELOGW("Invalid line {} in the routine signatures {}", line_number,
+             xe::path_to_utf8(path));
+      continue;
+    }
+    ++signature_count;
+  }
+  XELOGI("Loaded {} routine signatures from {}", signature_count,
+         xe::path_to_utf8(path));
+  return true;
+}
+
+Function* RoutineSignatures::FindReplacement(GuestFunction* function,
+                                             bool count_lookup) {
+  if (signatures_.empty() && !cvars::log_routine_signatures) {
+    return nullptr;
+  }
+  Memory* memory = processor_->memory();
+  uint32_t address = function->address();
+  size_t instruction_count = (function->end_address() - address) / 4 + 1;
+  std::vector<uint32_t> codes(instruction_count);
+  for (size_t i = 0; i < instruction_count; ++i) {
+    codes[i] = xe::load_and_swap<uint32_t>(
+        memory->TranslateVirtual(address + uint32_t(i * 4)));
+  }
+  uint64_t hash = HashInstructions(address, codes.data(), instruction_count);
+  if (count_lookup && cvars::log_routine_signatures) {
+    XELOGI("Routine signature of {:08X}: {:016X} {}", address, hash,
+           instruction_count);
+  }
+  if (count_lookup) {
+    ++lookups_;
+  }
+  auto it = signatures_.find(hash);
+  if (it == signatures_.end() ||
+      it->second.instruction_count != instruction_count) {
+    return nullptr;
+  }
+  if (count_lookup) {
+    ++matches_;
+  }
+  return it->second.routine->builtin;
+}
+
+void RoutineSignatures::LogStatistics() const {
+  if (signatures_.empty()) {
+    return;
+  }
+  XELOGI("Replaced {} of {} translated functions with host routines",
+         matches_.load(), lookups_.load());
+  for (const std::unique_ptr<Routine>& routine : routines_) {
+    uint64_t calls = routine->calls;
+    uint64_t fallbacks = routine->fallbacks;
+    if (calls || fallbacks) {
+      XELOGI("  {}: {} calls handled on the host, {} by the guest code",
+             routine->name, calls, fallbacks);
+    }
+  }
+}
+
+void RoutineSignatures::HandlerThunk(ppc::PPCContext* ctx, void* arg0,
+                                     void* arg1) {
+  auto memory = reinterpret_cast<Memory*>(arg0);
+  auto routine = reinterpret_cast<Routine*>(arg1);
+  if (routine->handler(memory, ctx)) {
+    routine->calls.fetch_add(1, std::memory_order_relaxed);
+    ctx->scratch = 1;
+  } else {
+    routine->fallbacks.fetch_add(1, std::memory_order_relaxed);
+    ctx->scratch = 0;
+  }
+}
+
+}  // namespace cpu
+}  // namespace xe
@@ -0,0 +1,106 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_CPU_ROUTINE_SIGNATURES_H_
+#define XENIA_CPU_ROUTINE_SIGNATURES_H_
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "xenia/cpu/ppc/ppc_context.h"
+
+namespace xe {
+class Memory;
+}  // namespace xe
+
+namespace xe {
+namespace cpu {
+
+class Function;
+class GuestFunction;
+class Processor;
+
+// Database of the signatures of library routines linked into many titles,
+// such as memcpy, memset and strlen, which are replaced with host
+// implementations when a guest function with a matching signature is
+// translated.
+//
+// A signature is the hash of the instructions of the function, with the
+// fields depending on where the code and the data it references are linked
+// (the displacements of branches leaving the function and the addresses built
+// with lis) masked out, and the number of instructions. The host
+// implementation is called at the entry of the function, and the guest code is
+// still translated after it, to be executed if the host implementation can't
+// handle the call, such as if it accesses MMIO.
+//
+// Signatures are loaded before the title is launched and not modified after
+// that, so they can be looked up concurrently without locking.
+class RoutineSignatures {
+ public:
+  explicit RoutineSignatures(Processor* processor);
+  ~RoutineSignatures();
+
+  // Hashes the instructions of a function starting at the address.
+  static uint64_t HashInstructions(uint32_t address, const uint32_t* codes,
+                                   size_t count);
+
+  // Adds a signature for the routine with the name, such as "memcpy".
+  // Returns false if no host implementation of the routine exists.
+  bool AddSignature(uint64_t hash, uint32_t instruction_count,
+                    const std::string_view routine_name);
+  // Loads signatures from a text file with a signature per line, in the form
+  // of "<hash in hex> <instruction count> <routine name>". Everything after #
+  // is a comment.
+  bool LoadFile(const std::filesystem::path& path);
+
+  bool empty() const { return signatures_.empty(); }
+
+  // Returns the builtin implementing the function on the host, or nullptr if
+  // the function doesn't match any signature. The end address of the function
+  // must be known.
+  Function* FindReplacement(GuestFunction* function,
+                            bool count_lookup = true);
+
+  // Logs how many of the translated functions were replaced, and how many of
+  // the calls of each routine were handled on the host.
+  void LogStatistics() const;
+
+ private:
+  struct Routine {
+    const char* name;
+    // Returns false if the call must be handled by the guest code.
+    bool (*handler)(Memory* memory, ppc::PPCContext* ctx);
+    Function* builtin;
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> fallbacks;
+  };
+  struct Signature {
+    uint32_t instruction_count;
+    Routine* routine;
+  };
+
+  static void HandlerThunk(ppc::PPCContext* ctx, void* arg0, void* arg1);
+
+  Processor* processor_;
+  std::vector<std::unique_ptr<Routine>> routines_;
+  std::unordered_map<uint64_t, Signature> signatures_;
+  std::atomic<uint64_t> lookups_;
+  std::atomic<uint64_t> matches_;
+};
+
+}  // namespace cpu
+}  // namespace xe
+
+#endif  // XENIA_CPU_ROUTINE_SIGNATURES_H_
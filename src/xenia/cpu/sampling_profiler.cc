@@ -0,0 +1,311 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/sampling_profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+
+#include "third_party/fmt/include/fmt/format.h"
+#include "xenia/base/assert.h"
+#include "xenia/base/clock.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/host_thread_context.h"
+#include "xenia/base/logging.h"
+#include "xenia/cpu/backend/code_cache.h"
+#include "xenia/cpu/processor.h"
+#include "xenia/cpu/stack_walker.h"
+#include "xenia/cpu/thread.h"
+
+namespace xe {
+namespace cpu {
+
+namespace {
+// Sorted guest functions for finding the callers from the link register.
+class FunctionIndex {
+ public:
+  explicit FunctionIndex(Processor* processor) {
+    for (Module* module : processor->GetModules()) {
+      module->ForEachFunction([this](Function* function) {
+        // Only declared functions don't have the end address yet.
+        if (function->is_guest() &&
+            function->end_address() >= function->address()) {
+          functions_.push_back(function);
+        }
+      });
+    }
+    std::sort(functions_.begin(), functions_.end(),
+              [](const Function* a, const Function* b) {
+                return a->address() < b->address();
+              });
+  }
+
+  const Function* Lookup(uint32_t address) const {
+    auto it = std::upper_bound(functions_.cbegin(), functions_.cend(), address,
+                               [](uint32_t value, const Function* function) {
+                                 return value < function->address();
+                               });
+    if (it == functions_.cbegin()) {
+      return nullptr;
+    }
+    --it;
+    return address <= (*it)->end_address() ? *it : nullptr;
+  }
+
+ private:
+  std::vector<const Function*> functions_;
+};
+
+void WriteJsonString(FILE* file, const std::string_view value) {
+  fputc('"', file);
+  for (char c : value) {
+    if (c == '"' || c == '\\') {
+      fputc('\\', file);
+      fputc(c, file);
+    } else if (uint8_t(c) < 0x20) {
+      fmt::print(file, "\\u{:04X}", uint8_t(c));
+    } else {
+      fputc(c, file);
+    }
+  }
+  fputc('"', file);
+}
+}  // namespace
+
+SamplingProfiler::SamplingProfiler(Processor* processor,
+                                   StackWalker* stack_walker,
+                                   const std::filesystem::path& output_path,
+                                   uint32_t interval_us)
+    : processor_(processor),
+      stack_walker_(stack_walker),
+      output_path_(output_path),
+      chrome_trace_(output_path.extension() == ".json"),
+      interval_us_(std::max(interval_us, uint32_t(1))),
+      start_host_tick_(Clock::QueryHostTickCount()) {
+  xe::threading::Thread::CreationParameters params;
+  params.initial_priority = xe::threading::ThreadPriority::kHighest;
+  thread_ =
+      xe::threading::Thread::Create(params, [this]() { SamplerThread(); });
+  assert_not_null(thread_);
+  thread_->set_name("Sampling Profiler");
+  XELOGI("Sampling guest threads every {} us to {}", interval_us_,
+         xe::path_to_utf8(output_path_));
+}
+
+SamplingProfiler::~SamplingProfiler() {
+  {
+    std::lock_guard<std::mutex> lock(shutdown_mutex_);
+    shutdown_ = true;
+  }
+  shutdown_cond_.notify_all();
+  xe::threading::Wait(thread_.get(), false);
+
+  FILE* file = xe::filesystem::OpenFile(output_path_, "wb");
+  if (!file) {
+    XELOGE("Failed to open the sampling profiler output file {}",
+           xe::path_to_utf8(output_path_));
+    return;
+  }
+  if (chrome_trace_) {
+    WriteChromeTrace(file);
+  } else {
+    WriteCollapsedStacks(file);
+  }
+  fclose(file);
+}
+
+void SamplingProfiler::SamplerThread() {
+  std::unique_lock<std::mutex> lock(shutdown_mutex_);
+  while (!shutdown_cond_.wait_for(lock,
+                                  std::chrono::microseconds(interval_us_),
+                                  [this]() { return shutdown_; })) {
+    lock.unlock();
+    TakeSamples();
+    lock.lock();
+  }
+}
+
+void SamplingProfiler::TakeSamples() {
+  struct Capture {
+    uint32_t thread_id;
+    uint32_t guest_lr;
+    uint64_t host_pc;
+  };
+  std::vector<Capture> captures;
+  uint64_t host_tick = Clock::QueryHostTickCount();
+  {
+    auto global_lock = global_critical_region_.Acquire();
+    std::vector<ThreadDebugInfo*> thread_infos =
+        processor_->QueryThreadDebugInfos();
+    // Nothing must be allocated while a thread is suspended, as it may be
+    // holding the heap lock.
+    captures.reserve(thread_infos.size());
+    for (ThreadDebugInfo* thread_info : thread_infos) {
+      // Only threads running guest code, and not the ones held by the
+      // debugger.
+      Thread* thread = thread_info->thread;
+      if (thread_info->state != ThreadDebugInfo::State::kAlive ||
+          thread_info->suspended || !thread ||
+          !thread->can_debugger_suspend()) {
+        continue;
+      }
+      if (thread_names_.find(thread_info->thread_id) == thread_names_.end()) {
+        thread_names_.emplace(
+            thread_info->thread_id,
+            fmt::format("{} ({:08X})", thread->thread_name(),
+                        thread_info->thread_id));
+      }
+      xe::threading::Thread* host_thread = thread->thread();
+      if (!host_thread->Suspend()) {
+        continue;
+      }
+      // No frames are walked, as unwinding through guest code takes code cache
+      // locks which the suspended thread may be holding.
+      HostThreadContext host_context;
+      host_context.rip = 0;
+      stack_walker_->CaptureStackTrace(host_thread->native_handle(), nullptr,
+                                       0, 0, nullptr, &host_context);
+      uint32_t guest_lr = uint32_t(thread->thread_state()->context()->lr);
+      host_thread->Resume();
+      if (host_context.rip) {
+        captures.push_back({thread_info->thread_id, guest_lr,
+                            host_context.rip});
+      }
+    }
+  }
+
+  // Resolved with the threads running again, since the lookup takes the code
+  // cache lock.
+  backend::CodeCache* code_cache = processor_->backend()->code_cache();
+  for (const Capture& capture : captures) {
+    GuestFunction* function = code_cache->LookupFunction(capture.host_pc);
+    StackKey stack = {capture.thread_id, capture.guest_lr, function};
+    ++stack_counts_[stack];
+    if (!chrome_trace_) {
+      continue;
+    }
+    if (samples_.size() >= kMaxSamples) {
+      if (!samples_dropped_) {
+        XELOGW("Sampling profiler buffer is full, dropping further samples");
+        samples_dropped_ = true;
+      }
+      continue;
+    }
+    Sample sample;
+    sample.host_tick = host_tick;
+    sample.stack = stack;
+    sample.guest_pc =
+        function ? function->MapMachineCodeToGuestAddress(capture.host_pc)
+                 : 0;
+    samples_.push_back(sample);
+  }
+}
+
+std::string SamplingProfiler::GetFunctionName(const Function* function) const {
+  // XEX imports and exports, and names from --load_module_map.
+  if (!function->name().empty()) {
+    return function->name();
+  }
+  return fmt::format("sub_{:08X}", function->address());
+}
+
+void SamplingProfiler::WriteCollapsedStacks(FILE* file) {
+  FunctionIndex function_index(processor_);
+  // Stacks with different link registers in the same caller are the same
+  // collapsed stack.
+  std::map<std::string, uint64_t> collapsed_counts;
+  for (const auto& stack_count : stack_counts_) {
+    const StackKey& stack = stack_count.first;
+    std::string collapsed = thread_names_[stack.thread_id];
+    const Function* caller = function_index.Lookup(stack.guest_lr);
+    // The link register points into the function itself after it has
+    // returned from a call.
+    if (caller && caller != stack.function) {
+      collapsed += ';';
+      collapsed += GetFunctionName(caller);
+    }
+    collapsed += ';';
+    collapsed += stack.function ? GetFunctionName(stack.function) : "[host]";
+    collapsed_counts[collapsed] += stack_count.second;
+  }
+  for (const auto& collapsed_count : collapsed_counts) {
+    fmt::print(file, "{} {}\n", collapsed_count.first, collapsed_count.second);
+  }
+}
+
+void SamplingProfiler::WriteChromeTrace(FILE* file) {
+  FunctionIndex function_index(processor_);
+  uint64_t host_tick_frequency = Clock::QueryHostTickFrequency();
+
+  fputs("{\"traceEvents\":[", file);
+  bool first = true;
+  for (const auto& thread_name : thread_names_) {
+    fmt::print(file,
+               "{}\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+               "\"tid\":{},\"args\":{{\"name\":",
+               first ? "" : ",", thread_name.first);
+    WriteJsonString(file, thread_name.second);
+    fputs("}}", file);
+    first = false;
+  }
+
+  // Frames are deduplicated by the parent frame and the name.
+  fputs("\n],\"stackFrames\":{", file);
+  std::map<std::pair<uint32_t, std::string>, uint32_t> frame_ids;
+  auto get_frame_id = [&](uint32_t parent_id, std::string name) {
+    auto it = frame_ids.find(std::make_pair(parent_id, name));
+    if (it != frame_ids.end()) {
+      return it->second;
+    }
+    uint32_t id = uint32_t(frame_ids.size() + 1);
+    fmt::print(file, "{}\n\"{}\":{{\"category\":\"guest\",\"name\":",
+               frame_ids.empty() ? "" : ",", id);
+    WriteJsonString(file, name);
+    if (parent_id) {
+      fmt::print(file, ",\"parent\":\"{}\"", parent_id);
+    }
+    fputc('}', file);
+    frame_ids.emplace(std::make_pair(parent_id, std::move(name)), id);
+    return id;
+  };
+  std::vector<uint32_t> sample_frame_ids;
+  sample_frame_ids.reserve(samples_.size());
+  for (const Sample& sample : samples_) {
+    uint32_t parent_id = 0;
+    const Function* caller = function_index.Lookup(sample.stack.guest_lr);
+    if (caller && caller != sample.stack.function) {
+      parent_id = get_frame_id(0, GetFunctionName(caller));
+    }
+    std::string name;
+    if (sample.stack.function) {
+      name = fmt::format("{}+{:X}", GetFunctionName(sample.stack.function),
+                         sample.guest_pc - sample.stack.function->address());
+    } else {
+      name = "[host]";
+    }
+    sample_frame_ids.push_back(get_frame_id(parent_id, std::move(name)));
+  }
+
+  fputs("\n},\"samples\":[", file);
+  for (size_t i = 0; i < samples_.size(); ++i) {
+    const Sample& sample = samples_[i];
+    uint64_t timestamp_us = (sample.host_tick - start_host_tick_) * 1000000 /
+                            host_tick_frequency;
+    fmt::print(file,
+               "{}\n{{\"cpu\":0,\"tid\":{},\"ts\":{},\"name\":\"sample\","
+               "\"sf\":\"{}\",\"weight\":1}}",
+               i ? "," : "", sample.stack.thread_id, timestamp_us,
+               sample_frame_ids[i]);
+  }
+  fputs("\n]}\n", file);
+}
+
+}  // namespace cpu
+}  // namespace xe
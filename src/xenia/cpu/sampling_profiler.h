@@ -0,0 +1,113 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_CPU_SAMPLING_PROFILER_H_
+#define XENIA_CPU_SAMPLING_PROFILER_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "xenia/base/mutex.h"
+#include "xenia/base/threading.h"
+#include "xenia/cpu/function.h"
+
+namespace xe {
+namespace cpu {
+
+class Processor;
+class StackWalker;
+
+// Finds where guest threads spend their time, with low enough overhead to be
+// used with release builds.
+// A host thread periodically suspends every running guest thread, takes its
+// host PC and maps it to the guest function and instruction through the code
+// cache and the source map of the function. The caller is taken from the link
+// register in the guest context - it's only as recent as the last store of it
+// by the emitted code, which always happens before calls, so it may be stale
+// in leaf functions.
+// When destroyed, the samples are written either as collapsed stacks (a
+// "thread;caller;function count" line per stack, for flamegraph.pl or
+// speedscope), or, if the path has the .json extension, in the Chrome trace
+// event format with a sample for every capture.
+class SamplingProfiler {
+ public:
+  SamplingProfiler(Processor* processor, StackWalker* stack_walker,
+                   const std::filesystem::path& output_path,
+                   uint32_t interval_us);
+  ~SamplingProfiler();
+
+ private:
+  // Captures of the same thread at the same function and caller are merged.
+  struct StackKey {
+    uint32_t thread_id;
+    uint32_t guest_lr;
+    // Null if the thread was in host code, such as a kernel export.
+    GuestFunction* function;
+
+    bool operator==(const StackKey& other) const {
+      return thread_id == other.thread_id && guest_lr == other.guest_lr &&
+             function == other.function;
+    }
+  };
+  struct StackKeyHasher {
+    size_t operator()(const StackKey& key) const {
+      return std::hash<const void*>()(key.function) ^
+             (size_t(key.guest_lr) << 1) ^ (size_t(key.thread_id) << 33);
+    }
+  };
+
+  struct Sample {
+    uint64_t host_tick;
+    StackKey stack;
+    uint32_t guest_pc;
+  };
+
+  // Cap on the samples kept for the Chrome trace format, about 64 MB.
+  static constexpr size_t kMaxSamples = size_t(1) << 21;
+
+  void SamplerThread();
+  void TakeSamples();
+
+  std::string GetFunctionName(const Function* function) const;
+  void WriteCollapsedStacks(FILE* file);
+  void WriteChromeTrace(FILE* file);
+
+  Processor* processor_;
+  StackWalker* stack_walker_;
+  std::filesystem::path output_path_;
+  bool chrome_trace_;
+  uint32_t interval_us_;
+  uint64_t start_host_tick_;
+
+  // Keeps guest threads from being destroyed while suspended.
+  xe::global_critical_region global_critical_region_;
+
+  std::mutex shutdown_mutex_;
+  std::condition_variable shutdown_cond_;
+  bool shutdown_ = false;
+  std::unique_ptr<xe::threading::Thread> thread_;
+
+  // Only accessed by the sampler thread until it's stopped.
+  std::unordered_map<StackKey, uint64_t, StackKeyHasher> stack_counts_;
+  std::vector<Sample> samples_;
+  bool samples_dropped_ = false;
+  std::unordered_map<uint32_t, std::string> thread_names_;
+};
+
+}  // namespace cpu
+}  // namespace xe
+
+#endif  // XENIA_CPU_SAMPLING_PROFILER_H_
@@ -0,0 +1,29 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/symbol.h"
+
+#include "xenia/base/assert.h"
+#include "xenia/cpu/module.h"
+
+namespace xe {
+namespace cpu {
+
+const std::string& Symbol::name() const {
+  static const std::string empty_name;
+  return name_ ? *name_ : empty_name;
+}
+
+void Symbol::set_name(const std::string_view value) {
+  assert_not_null(module_);
+  name_ = &module_->InternSymbolName(value);
+}
+
+}  // namespace cpu
+}  // namespace xe
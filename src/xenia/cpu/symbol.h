@@ -12,6 +12,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 namespace xe {
 namespace cpu {
@@ -44,8 +45,9 @@ class Symbol {
   void set_status(Status value) { status_ = value; }
   uint32_t address() const { return address_; }
 
-  const std::string& name() const { return name_; }
-  void set_name(const std::string_view value) { name_ = value; }
+  const std::string& name() const;
+  // The name is interned in the module, as many symbols share names.
+  void set_name(const std::string_view value);
 
  protected:
   Type type_ = Type::kVariable;
@@ -53,7 +55,8 @@ class Symbol {
   Status status_ = Status::kDefining;
   uint32_t address_ = 0;
 
-  std::string name_;
+  // Owned by Module::InternSymbolName, or nullptr if not named.
+  const std::string* name_ = nullptr;
 };
 
 }  // namespace cpu
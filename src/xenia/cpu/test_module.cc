@@ -14,6 +14,7 @@
 #include "xenia/base/reset_scope.h"
 #include "xenia/base/string.h"
 #include "xenia/cpu/compiler/compiler_passes.h"
+#include "xenia/cpu/cpu_flags.h"
 #include "xenia/cpu/processor.h"
 
 namespace xe {
@@ -58,8 +59,12 @@ TestModule::TestModule(Processor* processor, const std::string_view name,
   // Will modify the HIR to add loads/stores.
   // This should be the last pass before finalization, as after this all
   // registers are assigned and ready to be emitted.
+  // Loop register allocation needs the CFG after all the simplifications.
+  if (cvars::allocate_loop_registers) {
+    compiler_->AddPass(std::make_unique<passes::ControlFlowAnalysisPass>());
+  }
   compiler_->AddPass(std::make_unique<passes::RegisterAllocationPass>(
-      processor->backend()->machine_info()));
+      processor->backend()->machine_info(), cvars::allocate_loop_registers));
 
   // Must come last. The HIR is not really HIR after this.
   compiler_->AddPass(std::make_unique<passes::FinalizationPass>());
@@ -0,0 +1,910 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "third_party/fmt/include/fmt/format.h"
+#include "xenia/base/assert.h"
+#include "xenia/base/clock.h"
+#include "xenia/base/console_app_main.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/math.h"
+#include "xenia/base/memory.h"
+#include "xenia/cpu/backend/x64/x64_backend.h"
+#include "xenia/cpu/cpu_flags.h"
+#include "xenia/cpu/hir/hir_builder.h"
+#include "xenia/cpu/ppc/ppc_context.h"
+#include "xenia/cpu/processor.h"
+#include "xenia/cpu/raw_module.h"
+#include "xenia/cpu/test_module.h"
+#include "xenia/cpu/thread_state.h"
+
+DEFINE_path(benchmark_output, "cpu_benchmarks.json",
+            "File the results are written to as JSON.", "Other");
+DEFINE_string(benchmark_filter, "",
+              "Only run the benchmarks whose names contain this.", "Other");
+DEFINE_uint32(benchmark_iterations, 10000,
+              "Calls of every sequence benchmark function per batch.", "Other");
+DEFINE_path(benchmark_corpus_path, "src/xenia/cpu/ppc/testing/",
+            "Directory with the .s files translated to measure the "
+            "translation throughput.",
+            "Other");
+DEFINE_path(benchmark_corpus_bin_path, "src/xenia/cpu/ppc/testing/bin/",
+            "Directory with the binary outputs of the .s files.", "Other");
+
+namespace xe {
+namespace cpu {
+namespace benchmark {
+
+using namespace xe::cpu::hir;
+using xe::cpu::ppc::PPCContext;
+
+// Sequence benchmarks run a chain of dependent operations, so the result is
+// closer to the latency of the emitted sequence than to its throughput.
+constexpr uint32_t kOpsPerFunction = 64;
+// The fastest batch is taken to filter out interrupts and frequency changes.
+constexpr uint32_t kBatchCount = 5;
+
+constexpr uint32_t kFunctionAddress = 0x80000000;
+constexpr uint32_t kDataAddress = 0x10001000;
+
+struct SequenceBenchmark {
+  const char* name;
+  // Type of the value carried from one operation to the next.
+  TypeName type;
+  // Type of the second operand of every operation.
+  TypeName operand_type;
+  // Emits one operation, returning the next value of the chain.
+  std::function<Value*(HIRBuilder& b, Value* value, Value* operand)> emit;
+};
+
+Value* LoadDataAddress(HIRBuilder& b) {
+  return b.LoadContext(offsetof(PPCContext, r) + 6 * 8, INT64_TYPE);
+}
+
+const SequenceBenchmark kSequenceBenchmarks[] = {
+    // x64_sequences.cc.
+    {"ADD_I32", INT32_TYPE, INT32_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Add(v, o); }},
+    {"ADD_I64", INT64_TYPE, INT64_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Add(v, o); }},
+    {"SUB_I64", INT64_TYPE, INT64_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Sub(v, o); }},
+    {"MUL_I32", INT32_TYPE, INT32_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Mul(v, o); }},
+    {"MUL_I64", INT64_TYPE, INT64_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Mul(v, o); }},
+    {"MUL_HI_I64", INT64_TYPE, INT64_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.MulHi(v, o); }},
+    {"DIV_I32", INT32_TYPE, INT32_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Div(v, o); }},
+    {"DIV_I64", INT64_TYPE, INT64_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Div(v, o); }},
+    {"XOR_I64", INT64_TYPE, INT64_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Xor(v, o); }},
+    {"SHL_I64", INT64_TYPE, INT8_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Shl(v, o); }},
+    {"SHR_I64", INT64_TYPE, INT8_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Shr(v, o); }},
+    {"SHA_I64", INT64_TYPE, INT8_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Sha(v, o); }},
+    {"ROTATE_LEFT_I32", INT32_TYPE, INT8_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.RotateLeft(v, o); }},
+    {"BYTE_SWAP_I32", INT32_TYPE, INT32_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.ByteSwap(v); }},
+    {"SELECT_COMPARE_SLT_I64", INT64_TYPE, INT64_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.Select(b.CompareSLT(v, o), o, b.Add(v, o));
+     }},
+    {"ADD_F64", FLOAT64_TYPE, FLOAT64_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Add(v, o); }},
+    {"MUL_F64", FLOAT64_TYPE, FLOAT64_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Mul(v, o); }},
+    {"DIV_F64", FLOAT64_TYPE, FLOAT64_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Div(v, o); }},
+    {"MUL_ADD_F64", FLOAT64_TYPE, FLOAT64_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.MulAdd(v, o, o); }},
+    {"SQRT_F64", FLOAT64_TYPE, FLOAT64_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Sqrt(v); }},
+    {"CONVERT_F64_F32", FLOAT64_TYPE, FLOAT64_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.Convert(b.Convert(v, FLOAT32_TYPE, ROUND_TO_NEAREST),
+                        FLOAT64_TYPE);
+     }},
+    {"ADD_V128", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.Add(v, o); }},
+    {"MUL_ADD_V128", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.MulAdd(v, o, o); }},
+    {"DOT_PRODUCT_3", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.Splat(b.DotProduct3(v, o), VEC128_TYPE);
+     }},
+    {"BYTE_SWAP_V128", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) { return b.ByteSwap(v); }},
+
+    // x64_seq_vector.cc.
+    {"VECTOR_ADD_I8_SAT", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.VectorAdd(v, o, INT8_TYPE, ARITHMETIC_SATURATE);
+     }},
+    {"VECTOR_ADD_I32", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.VectorAdd(v, o, INT32_TYPE);
+     }},
+    {"VECTOR_SUB_I32_SAT_UNSIGNED", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.VectorSub(v, o, INT32_TYPE,
+                          ARITHMETIC_SATURATE | ARITHMETIC_UNSIGNED);
+     }},
+    {"VECTOR_MAX_I32", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.VectorMax(v, o, INT32_TYPE);
+     }},
+    {"VECTOR_COMPARE_SGT_I16", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.VectorCompareSGT(v, o, INT16_TYPE);
+     }},
+    {"VECTOR_SHL_I8", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.VectorShl(v, o, INT8_TYPE);
+     }},
+    {"VECTOR_SHL_I16", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.VectorShl(v, o, INT16_TYPE);
+     }},
+    {"VECTOR_SHL_I32", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.VectorShl(v, o, INT32_TYPE);
+     }},
+    {"VECTOR_SHR_I16", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.VectorShr(v, o, INT16_TYPE);
+     }},
+    {"VECTOR_SHA_I8", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.VectorSha(v, o, INT8_TYPE);
+     }},
+    {"VECTOR_ROTATE_LEFT_I32", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.VectorRotateLeft(v, o, INT32_TYPE);
+     }},
+    {"VECTOR_AVERAGE_I16", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.VectorAverage(v, o, INT16_TYPE, 0);
+     }},
+    {"VECTOR_CONVERT_I2F", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.VectorConvertI2F(v);
+     }},
+    {"VECTOR_CONVERT_F2I_SAT", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.VectorConvertF2I(v, ARITHMETIC_SATURATE);
+     }},
+    {"PERMUTE_I8", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.Permute(o, v, v, INT8_TYPE);
+     }},
+    {"PERMUTE_I32", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.Permute(b.LoadConstantUint32(0x03060104), v, o, INT32_TYPE);
+     }},
+    {"SWIZZLE", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.Swizzle(v, INT32_TYPE, SWIZZLE_XYZW_TO_YZWX);
+     }},
+    {"PACK_D3DCOLOR", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.Pack(v, PACK_TYPE_D3DCOLOR);
+     }},
+    {"PACK_FLOAT16_4", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.Pack(v, PACK_TYPE_FLOAT16_4);
+     }},
+    {"PACK_8_IN_16_SAT", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.Pack(v, o,
+                     PACK_TYPE_8_IN_16 | PACK_TYPE_IN_SIGNED |
+                         PACK_TYPE_OUT_SIGNED | PACK_TYPE_OUT_SATURATE);
+     }},
+    {"UNPACK_FLOAT16_4", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.Unpack(v, PACK_TYPE_FLOAT16_4);
+     }},
+    {"UNPACK_8_IN_16_HI", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.Unpack(v, PACK_TYPE_8_IN_16 | PACK_TYPE_TO_HI |
+                              PACK_TYPE_IN_SIGNED | PACK_TYPE_OUT_SIGNED);
+     }},
+    {"EXTRACT_INSERT_I32", VEC128_TYPE, INT8_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       return b.Insert(v, uint64_t(1), b.Extract(v, o, INT32_TYPE));
+     }},
+
+    // x64_seq_memory.cc. The operation is a load, an add and a store back.
+    {"LOAD_STORE_I32", INT32_TYPE, INT32_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       Value* address = LoadDataAddress(b);
+       Value* result = b.Add(b.Load(address, INT32_TYPE), v);
+       b.Store(address, result);
+       return result;
+     }},
+    {"LOAD_STORE_I32_BYTE_SWAP", INT32_TYPE, INT32_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       Value* address = LoadDataAddress(b);
+       Value* result =
+           b.Add(b.Load(address, INT32_TYPE, LOAD_STORE_BYTE_SWAP), v);
+       b.Store(address, result, LOAD_STORE_BYTE_SWAP);
+       return result;
+     }},
+    {"LOAD_STORE_V128", VEC128_TYPE, VEC128_TYPE,
+     [](HIRBuilder& b, Value* v, Value* o) {
+       Value* address = LoadDataAddress(b);
+       Value* result = b.VectorAdd(b.Load(address, VEC128_TYPE), v,
+                                   INT32_TYPE);
+       b.Store(address, result);
+       return result;
+     }},
+};
+
+// Loop benchmarks run the body kLoopIterations times in every call, stepping
+// r6 through the data by 16 bytes, with the loop invariants computed in every
+// iteration and once before the loop.
+constexpr uint32_t kLoopIterations = 256;
+
+struct LoopBenchmark {
+  const char* name;
+  // Emits one iteration, with r6 being the address of the data.
+  std::function<void(HIRBuilder& b, Value* address)> emit;
+};
+
+const LoopBenchmark kLoopBenchmarks[] = {
+    // Filling memory with a vector register, like memset and clearing of
+    // buffers, with the byte swapped value being invariant.
+    {"MEMSET_V128",
+     [](HIRBuilder& b, Value* address) {
+       Value* value = b.LoadContext(offsetof(PPCContext, v) + 4 * 16,
+                                    VEC128_TYPE);
+       b.Store(address, b.ByteSwap(value));
+     }},
+    // Transforming positions, like vertex skinning, by a matrix row scaled by
+    // a bone weight, masking the result and setting W with constant vectors.
+    {"SKINNING_V128",
+     [](HIRBuilder& b, Value* address) {
+       Value* row = b.LoadContext(offsetof(PPCContext, v) + 4 * 16,
+                                  VEC128_TYPE);
+       Value* weight = b.LoadContext(offsetof(PPCContext, v) + 5 * 16,
+                                     VEC128_TYPE);
+       Value* position = b.ByteSwap(b.Load(address, VEC128_TYPE));
+       Value* xyz = b.And(b.Mul(position, b.Mul(row, weight)),
+                          b.LoadConstantVec128(vec128i(
+                              0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0)));
+       Value* result =
+           b.Or(xyz, b.LoadConstantVec128(vec128f(0.0f, 0.0f, 0.0f, 1.0f)));
+       b.Store(address, b.ByteSwap(result));
+     }},
+};
+
+// Atomic increment of the 32-bit counter at r3, r4 times:
+//   mtctr r4
+// loop:
+//   lwarx r5, 0, r3
+//   addi r5, r5, 1
+//   stwcx. r5, 0, r3
+//   bne- loop
+//   bdnz loop
+//   blr
+const uint32_t kReservationIncrementCode[] = {
+    0x7C8903A6, 0x7CA01828, 0x38A50001, 0x7CA0192D,
+    0x4082FFF4, 0x4200FFF0, 0x4E800020,
+};
+
+// The context access benchmark calls a function on every context in turn,
+// reading the hot registers (r1-r12, LR, CTR, CR, XER[CA] and the
+// reservation) and writing some back, so with enough contexts to not fit in
+// the caches, the time mostly depends on how many cache lines of the context
+// the registers are in.
+constexpr uint32_t kMaxContextAccessContexts = 4096;
+
+void EmitContextAccess(HIRBuilder& b) {
+  Value* sum = b.Add(b.LoadContext(offsetof(PPCContext, lr), INT64_TYPE),
+                     b.LoadContext(offsetof(PPCContext, ctr), INT64_TYPE));
+  for (uint32_t reg = 1; reg <= 12; ++reg) {
+    sum = b.Add(sum,
+                b.LoadContext(offsetof(PPCContext, r) + reg * 8, INT64_TYPE));
+  }
+  for (uint32_t n = 0; n < 8; ++n) {
+    sum = b.Add(sum, b.ZeroExtend(b.LoadContext(offsetof(PPCContext, cr0) +
+                                                    n * 4,
+                                                INT32_TYPE),
+                                  INT64_TYPE));
+  }
+  sum = b.Add(sum, b.ZeroExtend(b.LoadContext(offsetof(PPCContext, xer_ca),
+                                              INT8_TYPE),
+                                INT64_TYPE));
+  sum = b.Add(sum, b.LoadContext(offsetof(PPCContext, reserved_address),
+                                 INT64_TYPE));
+  b.StoreContext(offsetof(PPCContext, r) + 3 * 8, sum);
+  b.StoreContext(offsetof(PPCContext, cr0.cr0_eq),
+                 b.CompareEQ(sum, b.LoadZeroInt64()));
+  b.StoreContext(offsetof(PPCContext, xer_ca), b.Truncate(sum, INT8_TYPE));
+}
+
+// Integer inputs are truncated from the GPRs, and single-precision inputs are
+// converted from the FPRs.
+Value* LoadInput(HIRBuilder& b, TypeName type, uint32_t reg) {
+  switch (type) {
+    case INT8_TYPE:
+    case INT16_TYPE:
+    case INT32_TYPE:
+      return b.Truncate(
+          b.LoadContext(offsetof(PPCContext, r) + reg * 8, INT64_TYPE), type);
+    case INT64_TYPE:
+      return b.LoadContext(offsetof(PPCContext, r) + reg * 8, INT64_TYPE);
+    case FLOAT32_TYPE:
+      return b.Convert(
+          b.LoadContext(offsetof(PPCContext, f) + reg * 8, FLOAT64_TYPE),
+          FLOAT32_TYPE, ROUND_TO_NEAREST);
+    case FLOAT64_TYPE:
+      return b.LoadContext(offsetof(PPCContext, f) + reg * 8, FLOAT64_TYPE);
+    case VEC128_TYPE:
+      return b.LoadContext(offsetof(PPCContext, v) + reg * 16, VEC128_TYPE);
+    default:
+      assert_unhandled_case(type);
+      return nullptr;
+  }
+}
+
+void StoreOutput(HIRBuilder& b, Value* value) {
+  switch (value->type) {
+    case INT8_TYPE:
+    case INT16_TYPE:
+    case INT32_TYPE:
+      b.StoreContext(offsetof(PPCContext, r) + 3 * 8,
+                     b.ZeroExtend(value, INT64_TYPE));
+      break;
+    case INT64_TYPE:
+      b.StoreContext(offsetof(PPCContext, r) + 3 * 8, value);
+      break;
+    case FLOAT32_TYPE:
+      b.StoreContext(offsetof(PPCContext, f) + 3 * 8,
+                     b.Convert(value, FLOAT64_TYPE));
+      break;
+    case FLOAT64_TYPE:
+      b.StoreContext(offsetof(PPCContext, f) + 3 * 8, value);
+      break;
+    case VEC128_TYPE:
+      b.StoreContext(offsetof(PPCContext, v) + 3 * 16, value);
+      break;
+    default:
+      assert_unhandled_case(value->type);
+      break;
+  }
+}
+
+// Inputs that keep the chains from reaching values with special timing, such
+// as denormals, for as long as possible.
+void SetInputs(PPCContext* ctx) {
+  ctx->r[4] = 0x0123456789ABCDEFull;
+  ctx->r[5] = 3;
+  ctx->r[6] = kDataAddress;
+  ctx->f[4] = 1.0000001;
+  ctx->f[5] = 0.9999999;
+  ctx->v[4] = vec128f(1.0f, 2.0f, 3.0f, 4.0f);
+  ctx->v[5] = vec128i(0x03020100, 0x07060504, 0x0B0A0908, 0x0F0E0D0C);
+}
+
+class BenchmarkRunner {
+ public:
+  BenchmarkRunner() {
+    memory_ = std::make_unique<Memory>();
+    memory_->Initialize();
+  }
+
+  ~BenchmarkRunner() { memory_.reset(); }
+
+  // Returns the TSC ticks of the fastest batch of calls of the function
+  // generated with ops_per_function operations, or 0 in case of an error.
+  uint64_t MeasureSequence(const SequenceBenchmark& benchmark,
+                           uint32_t ops_per_function) {
+    auto processor = CreateProcessor();
+    if (!processor) {
+      return 0;
+    }
+    auto module = std::make_unique<TestModule>(
+        processor.get(), "Benchmark",
+        [](uint64_t address) { return address == kFunctionAddress; },
+        [&benchmark, ops_per_function](HIRBuilder& b) {
+          Value* value = LoadInput(b, benchmark.type, 4);
+          Value* operand = LoadInput(b, benchmark.operand_type, 5);
+          for (uint32_t i = 0; i < ops_per_function; ++i) {
+            value = benchmark.emit(b, value, operand);
+          }
+          StoreOutput(b, value);
+          b.Return();
+          return true;
+        });
+    processor->AddModule(std::move(module));
+    processor->backend()->CommitExecutableRange(kFunctionAddress,
+                                                kFunctionAddress + 0x10000);
+    Function* function = processor->ResolveFunction(kFunctionAddress);
+    if (!function) {
+      XELOGE("Failed to translate the {} benchmark", benchmark.name);
+      return 0;
+    }
+
+    auto thread_state = std::make_unique<ThreadState>(processor.get(), 0x100);
+    PPCContext* ctx = thread_state->context();
+    SetInputs(ctx);
+    uint32_t iterations = std::max(cvars::benchmark_iterations, uint32_t(1));
+    uint64_t fastest_ticks = UINT64_MAX;
+    for (uint32_t batch = 0; batch < kBatchCount; ++batch) {
+      uint64_t start_ticks = Clock::host_tick_count_raw();
+      for (uint32_t i = 0; i < iterations; ++i) {
+        ctx->lr = 0xBCBCBCBC;
+        function->Call(thread_state.get(), uint32_t(ctx->lr));
+      }
+      fastest_ticks = std::min(fastest_ticks,
+                               Clock::host_tick_count_raw() - start_ticks);
+    }
+    return std::max(fastest_ticks, uint64_t(1));
+  }
+
+  // Returns the TSC ticks of the fastest batch of calls of the loop, or 0 in
+  // case of an error.
+  uint64_t MeasureLoop(const LoopBenchmark& benchmark) {
+    auto processor = CreateProcessor();
+    if (!processor) {
+      return 0;
+    }
+    auto module = std::make_unique<TestModule>(
+        processor.get(), "Benchmark",
+        [](uint64_t address) { return address == kFunctionAddress; },
+        [&benchmark](HIRBuilder& b) {
+          // Control can't fall through into the loop header.
+          Label* loop_label = b.NewLabel();
+          b.Branch(loop_label);
+          b.MarkLabel(loop_label);
+          Value* address = LoadDataAddress(b);
+          benchmark.emit(b, address);
+          b.StoreContext(offsetof(PPCContext, r) + 6 * 8,
+                         b.Add(address, b.LoadConstantUint64(16)));
+          Value* count =
+              b.Sub(b.LoadContext(offsetof(PPCContext, r) + 3 * 8, INT64_TYPE),
+                    b.LoadConstantUint64(1));
+          b.StoreContext(offsetof(PPCContext, r) + 3 * 8, count);
+          b.BranchTrue(b.CompareNE(count, b.LoadZeroInt64()), loop_label);
+          b.Return();
+          // Explicit fall-through branches, needed for the loop allocation.
+          return b.Finalize();
+        });
+    processor->AddModule(std::move(module));
+    processor->backend()->CommitExecutableRange(kFunctionAddress,
+                                                kFunctionAddress + 0x10000);
+    Function* function = processor->ResolveFunction(kFunctionAddress);
+    if (!function) {
+      XELOGE("Failed to translate the {} benchmark", benchmark.name);
+      return 0;
+    }
+    auto thread_state = std::make_unique<ThreadState>(processor.get(), 0x100);
+    PPCContext* ctx = thread_state->context();
+    // Values that stay the same in every call, without denormals.
+    ctx->v[4] = vec128f(1.0f);
+    ctx->v[5] = vec128f(1.0f);
+    uint32_t iterations = std::max(cvars::benchmark_iterations, uint32_t(1));
+    uint64_t fastest_ticks = UINT64_MAX;
+    for (uint32_t batch = 0; batch < kBatchCount; ++batch) {
+      uint64_t start_ticks = Clock::host_tick_count_raw();
+      for (uint32_t i = 0; i < iterations; ++i) {
+        ctx->lr = 0xBCBCBCBC;
+        ctx->r[3] = kLoopIterations;
+        ctx->r[6] = kDataAddress;
+        function->Call(thread_state.get(), uint32_t(ctx->lr));
+      }
+      fastest_ticks = std::min(fastest_ticks,
+                               Clock::host_tick_count_raw() - start_ticks);
+    }
+    return std::max(fastest_ticks, uint64_t(1));
+  }
+
+  // Returns the TSC ticks of the fastest batch of calls of the context access
+  // function, once on each of context_count contexts, or 0 in case of an
+  // error.
+  uint64_t MeasureContextAccess(uint32_t context_count) {
+    auto processor = CreateProcessor();
+    if (!processor) {
+      return 0;
+    }
+    auto module = std::make_unique<TestModule>(
+        processor.get(), "Benchmark",
+        [](uint64_t address) { return address == kFunctionAddress; },
+        [](HIRBuilder& b) {
+          EmitContextAccess(b);
+          b.Return();
+          return true;
+        });
+    processor->AddModule(std::move(module));
+    processor->backend()->CommitExecutableRange(kFunctionAddress,
+                                                kFunctionAddress + 0x10000);
+    Function* function = processor->ResolveFunction(kFunctionAddress);
+    if (!function) {
+      XELOGE("Failed to translate the context access benchmark");
+      return 0;
+    }
+    std::vector<std::unique_ptr<ThreadState>> thread_states;
+    for (uint32_t i = 0; i < context_count; ++i) {
+      auto& thread_state = thread_states.emplace_back(
+          std::make_unique<ThreadState>(processor.get(), 0x100 + i));
+      // Not modified by the function, so not written before the calls.
+      thread_state->context()->lr = 0xBCBCBCBC;
+    }
+    uint64_t fastest_ticks = UINT64_MAX;
+    for (uint32_t batch = 0; batch < kBatchCount; ++batch) {
+      uint64_t start_ticks = Clock::host_tick_count_raw();
+      for (auto& thread_state : thread_states) {
+        function->Call(thread_state.get(), 0xBCBCBCBC);
+      }
+      fastest_ticks = std::min(fastest_ticks,
+                               Clock::host_tick_count_raw() - start_ticks);
+    }
+    return std::max(fastest_ticks, uint64_t(1));
+  }
+
+  // Returns the seconds it takes for thread_count threads to increment the
+  // same counter with reserved loads and stores iterations times each, or a
+  // negative value in case of an error, or if an increment has been lost.
+  double MeasureReservationContention(uint32_t thread_count,
+                                      uint32_t iterations) {
+    auto processor = CreateProcessor();
+    if (!processor) {
+      return -1.0;
+    }
+    if (!memory_->LookupHeap(kFunctionAddress)
+             ->AllocFixed(kFunctionAddress, sizeof(kReservationIncrementCode),
+                          0,
+                          kMemoryAllocationReserve | kMemoryAllocationCommit,
+                          kMemoryProtectRead | kMemoryProtectWrite)) {
+      XELOGE("Failed to allocate the reservation benchmark code");
+      return -1.0;
+    }
+    auto code = memory_->TranslateVirtual<uint32_t*>(kFunctionAddress);
+    for (size_t i = 0; i < xe::countof(kReservationIncrementCode); ++i) {
+      xe::store_and_swap<uint32_t>(code + i, kReservationIncrementCode[i]);
+    }
+    auto module = std::make_unique<RawModule>(processor.get());
+    module->SetAddressRange(kFunctionAddress,
+                            sizeof(kReservationIncrementCode));
+    processor->AddModule(std::move(module));
+    Function* function = processor->ResolveFunction(kFunctionAddress);
+    if (!function) {
+      XELOGE("Failed to translate the reservation benchmark");
+      return -1.0;
+    }
+    auto counter = memory_->TranslateVirtual<uint32_t*>(kDataAddress);
+    xe::store_and_swap<uint32_t>(counter, 0);
+
+    // The threads are released together so they contend from the start.
+    std::atomic<uint32_t> ready_count = {0};
+    std::atomic<bool> start = {false};
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < thread_count; ++i) {
+      threads.emplace_back([&, i]() {
+        auto thread_state =
+            std::make_unique<ThreadState>(processor.get(), 0x100 + i);
+        ThreadState::Bind(thread_state.get());
+        PPCContext* ctx = thread_state->context();
+        ctx->r[3] = kDataAddress;
+        ctx->r[4] = iterations;
+        ctx->lr = 0xBCBCBCBC;
+        ready_count.fetch_add(1, std::memory_order_release);
+        while (!start.load(std::memory_order_acquire)) {
+          std::this_thread::yield();
+        }
+        function->Call(thread_state.get(), uint32_t(ctx->lr));
+        ThreadState::Bind(nullptr);
+      });
+    }
+    while (ready_count.load(std::memory_order_acquire) < thread_count) {
+      std::this_thread::yield();
+    }
+    auto start_time = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    double seconds = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - start_time)
+                         .count();
+    uint32_t expected = thread_count * iterations;
+    uint32_t result = xe::load_and_swap<uint32_t>(counter);
+    if (result != expected) {
+      XELOGE("Reservation benchmark with {} threads counted {} instead of {}",
+             thread_count, result, expected);
+      return -1.0;
+    }
+    return seconds;
+  }
+
+  struct TranslationResult {
+    uint32_t function_count = 0;
+    uint64_t guest_bytes = 0;
+    uint64_t host_bytes = 0;
+    double seconds = 0.0;
+  };
+
+  // Translates every test function of the binary output of a .s file.
+  bool MeasureTranslation(const std::filesystem::path& bin_path,
+                          const std::vector<uint32_t>& addresses,
+                          TranslationResult& result) {
+    auto processor = CreateProcessor();
+    if (!processor) {
+      return false;
+    }
+    auto module = std::make_unique<RawModule>(processor.get());
+    if (!module->LoadFile(kFunctionAddress, bin_path)) {
+      XELOGE("Unable to load {}", xe::path_to_utf8(bin_path));
+      return false;
+    }
+    processor->AddModule(std::move(module));
+    processor->backend()->CommitExecutableRange(kFunctionAddress,
+                                                kFunctionAddress + 0x100000);
+    for (uint32_t address : addresses) {
+      auto start_time = std::chrono::steady_clock::now();
+      Function* function = processor->ResolveFunction(address);
+      result.seconds += std::chrono::duration<double>(
+                            std::chrono::steady_clock::now() - start_time)
+                            .count();
+      if (!function || !function->is_guest()) {
+        XELOGE("Failed to translate {:08X} in {}", address,
+               xe::path_to_utf8(bin_path));
+        return false;
+      }
+      auto guest_function = static_cast<GuestFunction*>(function);
+      ++result.function_count;
+      result.guest_bytes +=
+          guest_function->end_address() - guest_function->address() + 4;
+      result.host_bytes += guest_function->machine_code_length();
+    }
+    return true;
+  }
+
+ private:
+  // Processors are created for every benchmark since the code cache of the
+  // backend is at a fixed address.
+  std::unique_ptr<Processor> CreateProcessor() {
+    memory_->Reset();
+    memory_->LookupHeap(0)->AllocFixed(
+        kDataAddress, 0xEFFF, 0,
+        kMemoryAllocationReserve | kMemoryAllocationCommit,
+        kMemoryProtectRead | kMemoryProtectWrite);
+    auto processor = std::make_unique<Processor>(memory_.get(), nullptr);
+    if (!processor->Setup(
+            std::make_unique<xe::cpu::backend::x64::X64Backend>())) {
+      XELOGE("Failed to set up the processor");
+      return nullptr;
+    }
+    return processor;
+  }
+
+  std::unique_ptr<Memory> memory_;
+};
+
+bool MatchesFilter(const std::string_view name) {
+  return cvars::benchmark_filter.empty() ||
+         name.find(cvars::benchmark_filter) != std::string_view::npos;
+}
+
+// Test function addresses from the map written by xenia-build gentests.
+bool ReadMapAddresses(const std::filesystem::path& map_path,
+                      std::vector<uint32_t>& addresses) {
+  FILE* f = filesystem::OpenFile(map_path, "r");
+  if (!f) {
+    return false;
+  }
+  char line_buffer[BUFSIZ];
+  while (fgets(line_buffer, sizeof(line_buffer), f)) {
+    // 0000000000000000 t test_add1\n
+    const char* t_test_ = strstr(line_buffer, " t test_");
+    if (!t_test_) {
+      continue;
+    }
+    std::string address(line_buffer, t_test_ - line_buffer);
+    addresses.push_back(kFunctionAddress + std::stoul(address, 0, 16));
+  }
+  fclose(f);
+  return true;
+}
+
+int main(const std::vector<std::string>& args) {
+  FILE* output = filesystem::OpenFile(cvars::benchmark_output, "wb");
+  if (!output) {
+    XELOGE("Unable to open {}", xe::path_to_utf8(cvars::benchmark_output));
+    return 1;
+  }
+  fmt::print(output, "{{\n  \"x64_extension_mask\": {},\n",
+             cvars::x64_extension_mask);
+  BenchmarkRunner runner;
+
+  // The baseline function has only the loads of the inputs and the store of
+  // the result, and is subtracted from every benchmark.
+  const SequenceBenchmark baseline = {
+      "BASELINE", INT64_TYPE, INT64_TYPE,
+      [](HIRBuilder& b, Value* v, Value* o) { return v; }};
+  uint64_t baseline_ticks = runner.MeasureSequence(baseline, 0);
+  double calls = double(std::max(cvars::benchmark_iterations, uint32_t(1)));
+  fmt::print(output, "  \"call_cycles\": {:.2f},\n",
+             double(baseline_ticks) / calls);
+  fmt::print(output, "  \"sequences\": {{");
+  bool first = true;
+  for (const SequenceBenchmark& benchmark : kSequenceBenchmarks) {
+    if (!MatchesFilter(benchmark.name)) {
+      continue;
+    }
+    uint64_t ticks = runner.MeasureSequence(benchmark, kOpsPerFunction);
+    if (!ticks) {
+      continue;
+    }
+    double cycles_per_op =
+        std::max(double(int64_t(ticks - baseline_ticks)), 0.0) / calls /
+        kOpsPerFunction;
+    XELOGI("{}: {:.2f} cycles per op", benchmark.name, cycles_per_op);
+    fmt::print(output, "{}\n    \"{}\": {{\"cycles_per_op\": {:.2f}}}",
+               first ? "" : ",", benchmark.name, cycles_per_op);
+    first = false;
+  }
+  fmt::print(output, "\n  }},\n");
+
+  fmt::print(output, "  \"loops\": {{");
+  first = true;
+  bool hoist_loop_invariants = cvars::hoist_loop_invariants;
+  for (const LoopBenchmark& benchmark : kLoopBenchmarks) {
+    if (!MatchesFilter(benchmark.name)) {
+      continue;
+    }
+    // The pass reads the option when the function is translated.
+    cvars::hoist_loop_invariants = true;
+    uint64_t hoisted_ticks = runner.MeasureLoop(benchmark);
+    cvars::hoist_loop_invariants = false;
+    uint64_t not_hoisted_ticks = runner.MeasureLoop(benchmark);
+    if (!hoisted_ticks || !not_hoisted_ticks) {
+      continue;
+    }
+    double loop_iterations = calls * kLoopIterations;
+    double hoisted_cycles = double(hoisted_ticks) / loop_iterations;
+    double not_hoisted_cycles = double(not_hoisted_ticks) / loop_iterations;
+    XELOGI("{}: {:.2f} cycles per iteration, {:.2f} without hoisting",
+           benchmark.name, hoisted_cycles, not_hoisted_cycles);
+    fmt::print(output,
+               "{}\n    \"{}\": {{\"cycles_per_iteration\": {:.2f}, "
+               "\"cycles_per_iteration_not_hoisted\": {:.2f}}}",
+               first ? "" : ",", benchmark.name, hoisted_cycles,
+               not_hoisted_cycles);
+    first = false;
+  }
+  cvars::hoist_loop_invariants = hoist_loop_invariants;
+  fmt::print(output, "\n  }},\n");
+
+  fmt::print(output, "  \"context_access\": {{");
+  first = true;
+  if (MatchesFilter("context_access")) {
+    for (uint32_t context_count = 1;
+         context_count <= kMaxContextAccessContexts; context_count *= 8) {
+      uint64_t ticks = runner.MeasureContextAccess(context_count);
+      if (!ticks) {
+        continue;
+      }
+      double cycles_per_call = double(ticks) / context_count;
+      XELOGI("Context access, {} contexts: {:.2f} cycles per call",
+             context_count, cycles_per_call);
+      fmt::print(output,
+                 "{}\n    \"contexts_{}\": {{\"cycles_per_call\": {:.2f}}}",
+                 first ? "" : ",", context_count, cycles_per_call);
+      first = false;
+    }
+  }
+  fmt::print(output, "\n  }},\n");
+
+  fmt::print(output, "  \"reservation_contention\": {{");
+  first = true;
+  if (MatchesFilter("reservation_contention")) {
+    uint32_t iterations = std::max(cvars::benchmark_iterations, uint32_t(1));
+    for (uint32_t thread_count = 1; thread_count <= 8; thread_count *= 2) {
+      double seconds =
+          runner.MeasureReservationContention(thread_count, iterations);
+      if (seconds < 0.0) {
+        continue;
+      }
+      double increments = double(thread_count) * iterations;
+      double increments_per_second = increments / std::max(seconds, 1e-9);
+      XELOGI("Reservations, {} threads: {:.0f} increments per second",
+             thread_count, increments_per_second);
+      fmt::print(output,
+                 "{}\n    \"threads_{}\": {{\"microseconds\": {:.1f}, "
+                 "\"increments_per_second\": {:.0f}}}",
+                 first ? "" : ",", thread_count, seconds * 1e6,
+                 increments_per_second);
+      first = false;
+    }
+  }
+  fmt::print(output, "\n  }},\n");
+
+  fmt::print(output, "  \"translation\": {{");
+  std::vector<std::filesystem::path> source_paths;
+  for (auto& file_info :
+       xe::filesystem::ListFiles(cvars::benchmark_corpus_path)) {
+    if (file_info.name.extension() == ".s") {
+      source_paths.push_back(file_info.name);
+    }
+  }
+  std::sort(source_paths.begin(), source_paths.end());
+  BenchmarkRunner::TranslationResult total;
+  first = true;
+  for (const std::filesystem::path& source_path : source_paths) {
+    std::filesystem::path name = source_path.stem();
+    std::string name_utf8 = xe::path_to_utf8(name);
+    if (!MatchesFilter(name_utf8)) {
+      continue;
+    }
+    std::filesystem::path bin_base_path =
+        cvars::benchmark_corpus_bin_path / name;
+    std::vector<uint32_t> addresses;
+    if (!ReadMapAddresses(
+            std::filesystem::path(bin_base_path).replace_extension(".map"),
+            addresses)) {
+      XELOGW("No map for {} - were the tests generated?", name_utf8);
+      continue;
+    }
+    BenchmarkRunner::TranslationResult result;
+    if (!runner.MeasureTranslation(
+            std::filesystem::path(bin_base_path).replace_extension(".bin"),
+            addresses, result)) {
+      continue;
+    }
+    total.function_count += result.function_count;
+    total.guest_bytes += result.guest_bytes;
+    total.host_bytes += result.host_bytes;
+    total.seconds += result.seconds;
+    fmt::print(output,
+               "{}\n    \"{}\": {{\"functions\": {}, \"guest_bytes\": {}, "
+               "\"host_bytes\": {}, \"microseconds\": {:.1f}}}",
+               first ? "" : ",", name_utf8, result.function_count,
+               result.guest_bytes, result.host_bytes, result.seconds * 1e6);
+    first = false;
+  }
+  fmt::print(output, "\n  }},\n");
+  double seconds = std::max(total.seconds, 1e-9);
+  XELOGI("Translated {} functions, {} guest bytes, in {:.3f} s",
+         total.function_count, total.guest_bytes, total.seconds);
+  fmt::print(output,
+             "  \"translation_total\": {{\"functions\": {}, "
+             "\"guest_bytes\": {}, \"host_bytes\": {}, "
+             "\"functions_per_second\": {:.0f}, "
+             "\"guest_bytes_per_second\": {:.0f}, "
+             "\"host_bytes_per_second\": {:.0f}}}\n}}\n",
+             total.function_count, total.guest_bytes, total.host_bytes,
+             total.function_count / seconds, total.guest_bytes / seconds,
+             total.host_bytes / seconds);
+  fclose(output);
+  return 0;
+}
+
+}  // namespace benchmark
+}  // namespace cpu
+}  // namespace xe
+
+XE_DEFINE_CONSOLE_APP("xenia-cpu-benchmarks", xe::cpu::benchmark::main, "");
@@ -0,0 +1,90 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/testing/util.h"
+
+#include "xenia/cpu/cpu_flags.h"
+
+using namespace xe;
+using namespace xe::cpu;
+using namespace xe::cpu::hir;
+using namespace xe::cpu::testing;
+using xe::cpu::ppc::PPCContext;
+
+// Emits a loop running the body r3 times, with explicit fall-through branches
+// so the loop registers and the invariants are allocated for it.
+void EmitCountedLoop(HIRBuilder& b, std::function<void(HIRBuilder& b)> body) {
+  Label* loop_label = b.NewLabel();
+  b.Branch(loop_label);
+  b.MarkLabel(loop_label);
+  body(b);
+  Value* count = b.Sub(LoadGPR(b, 3), b.LoadConstantUint64(1));
+  StoreGPR(b, 3, count);
+  b.BranchTrue(b.CompareNE(count, b.LoadZeroInt64()), loop_label);
+  b.Return();
+  b.Finalize();
+}
+
+// Runs the test with and without hoisting, which must give the same results.
+void RunWithAndWithoutHoisting(TestFunction& test,
+                               std::function<void(PPCContext*)> pre_call,
+                               std::function<void(PPCContext*)> post_call) {
+  bool hoist_loop_invariants = cvars::hoist_loop_invariants;
+  for (bool hoist : {false, true}) {
+    cvars::hoist_loop_invariants = hoist;
+    test.Run(pre_call, post_call);
+  }
+  cvars::hoist_loop_invariants = hoist_loop_invariants;
+}
+
+TEST_CASE("LOOP_INVARIANT_COMPUTATION", "[instr]") {
+  TestFunction test([](HIRBuilder& b) {
+    EmitCountedLoop(b, [](HIRBuilder& b) {
+      // v4 and v5 are not modified in the loop.
+      Value* invariant = b.Xor(LoadVR(b, 4), LoadVR(b, 5));
+      StoreVR(b, 3, b.VectorAdd(LoadVR(b, 3), invariant, INT32_TYPE));
+    });
+  });
+  RunWithAndWithoutHoisting(
+      test,
+      [](PPCContext* ctx) {
+        ctx->r[3] = 5;
+        ctx->v[3] = vec128i(0);
+        ctx->v[4] = vec128i(0x1, 0x2, 0x3, 0x4);
+        ctx->v[5] = vec128i(0x10, 0x20, 0x30, 0x40);
+      },
+      [](PPCContext* ctx) {
+        REQUIRE(ctx->r[3] == 0);
+        REQUIRE(ctx->v[3] == vec128i(0x55, 0xAA, 0xFF, 0x154));
+        REQUIRE(ctx->v[4] == vec128i(0x1, 0x2, 0x3, 0x4));
+        REQUIRE(ctx->v[5] == vec128i(0x10, 0x20, 0x30, 0x40));
+      });
+}
+
+TEST_CASE("LOOP_INVARIANT_VECTOR_CONSTANT", "[instr]") {
+  TestFunction test([](HIRBuilder& b) {
+    EmitCountedLoop(b, [](HIRBuilder& b) {
+      Value* sum = b.VectorAdd(LoadVR(b, 3), LoadVR(b, 4), INT32_TYPE);
+      StoreVR(b, 3,
+              b.And(sum, b.LoadConstantVec128(vec128i(0xFFFF, 0xFFFF, 0xFF,
+                                                      0x7FFFFFFF))));
+    });
+  });
+  RunWithAndWithoutHoisting(
+      test,
+      [](PPCContext* ctx) {
+        ctx->r[3] = 4;
+        ctx->v[3] = vec128i(0xFFF0, 0, 0xF0, 0x7FFFFFF0);
+        ctx->v[4] = vec128i(0x9000, 0x10002, 0x41, 0x5);
+      },
+      [](PPCContext* ctx) {
+        REQUIRE(ctx->r[3] == 0);
+        REQUIRE(ctx->v[3] == vec128i(0x3FF0, 0x8, 0xF4, 0x4));
+      });
+}
@@ -0,0 +1,83 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "third_party/catch/include/catch.hpp"
+#include "third_party/fmt/include/fmt/format.h"
+
+#include "xenia/base/clock.h"
+#include "xenia/cpu/ppc/ppc_opcode_info.h"
+
+namespace xe {
+namespace cpu {
+namespace ppc {
+namespace test {
+
+// Encodings of pseudorandomly chosen instructions, with pseudorandom values of
+// bits 11:20, which are register or immediate fields in all forms, never
+// opcode bits.
+std::vector<uint32_t> CreateInstructionCodes(uint32_t count) {
+  std::vector<uint32_t> codes(count);
+  uint32_t random = 1;
+  for (uint32_t& code : codes) {
+    random = random * 1103515245 + 12345;
+    auto opcode = PPCOpcode((random >> 8) % uint32_t(PPCOpcode::kInvalid));
+    random = random * 1103515245 + 12345;
+    code = GetOpcodeDisasmInfo(opcode).opcode | ((random >> 16) & 0x3FF) << 11;
+  }
+  return codes;
+}
+
+TEST_CASE("PPC_LOOKUP_OPCODE_TABULAR", "[ppc]") {
+  for (uint32_t i = 0; i < uint32_t(PPCOpcode::kInvalid); ++i) {
+    uint32_t code = GetOpcodeDisasmInfo(PPCOpcode(i)).opcode;
+    REQUIRE(LookupOpcodeTabular(code) == LookupOpcode(code));
+  }
+  for (uint32_t code : CreateInstructionCodes(64 * 1024)) {
+    REQUIRE(LookupOpcodeTabular(code) == LookupOpcode(code));
+  }
+}
+
+// Hidden, run with "[.benchmark]" in an optimized build. Compares the
+// generated nested switches to the generated tables for decoding a random mix
+// of all instructions, which is harder to predict the branches of than real
+// code, where some instructions are much more common than others.
+TEST_CASE("ppc_lookup_opcode_throughput", "[.benchmark]") {
+  constexpr uint32_t kCodeCount = 1024 * 1024;
+  constexpr uint32_t kIterations = 32;
+  std::vector<uint32_t> codes = CreateInstructionCodes(kCodeCount);
+  // Keeps the lookups from being optimized out.
+  volatile uint32_t sink = 0;
+
+  auto report = [&](const char* name, PPCOpcode (*lookup)(uint32_t code)) {
+    uint32_t opcode_sum = 0;
+    uint64_t start = Clock::QueryHostTickCount();
+    for (uint32_t i = 0; i < kIterations; ++i) {
+      for (uint32_t code : codes) {
+        opcode_sum += uint32_t(lookup(code));
+      }
+    }
+    uint64_t ticks = Clock::QueryHostTickCount() - start;
+    sink = opcode_sum;
+    double seconds = double(ticks) / double(Clock::QueryHostTickFrequency());
+    double megainstructions = double(kCodeCount) * kIterations / 1000000.0;
+    fmt::print("{:<24} {:>10.1f} Minstructions/s\n", name,
+               seconds > 0.0 ? megainstructions / seconds : 0.0);
+  };
+
+  report("LookupOpcode", LookupOpcode);
+  report("LookupOpcodeTabular", LookupOpcodeTabular);
+}
+
+}  // namespace test
+}  // namespace ppc
+}  // namespace cpu
+}  // namespace xe
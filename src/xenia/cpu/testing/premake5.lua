@@ -22,3 +22,35 @@ test_suite("xenia-cpu-tests", project_root, ".", {
     }
   },
 })
+
+-- Sequence benchmarks are for the x64 backend only.
+if ARCH ~= "ppc64" then
+
+group("tests")
+project("xenia-cpu-benchmarks")
+  uuid("6b1d6d6e-0c52-4e6b-9d1e-3f0f5d3a7c41")
+  kind("ConsoleApp")
+  language("C++")
+  links({
+    "capstone", -- cpu-backend-x64
+    "fmt",
+    "mspack",
+    "xenia-base",
+    "xenia-core",
+    "xenia-cpu",
+  })
+  files({
+    "benchmark_main.cc",
+    "../../base/console_app_main_"..platform_suffix..".cc",
+  })
+  filter("architecture:x86_64")
+    links({
+      "xenia-cpu-backend-x64",
+    })
+  filter("platforms:Windows")
+    debugdir(project_root)
+
+    -- xenia-base needs this
+    links({"xenia-ui"})
+
+end
@@ -0,0 +1,76 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "third_party/catch/include/catch.hpp"
+
+#include "xenia/cpu/routine_signatures.h"
+
+namespace xe {
+namespace cpu {
+namespace test {
+
+// A routine loading a global and calling another function, placed at the
+// address, with the global at global_address and the callee at
+// callee_address. loop_displacement is the displacement of the branch within
+// the routine, and immediate is an immediate not referencing any address.
+std::vector<uint32_t> CreateRoutine(uint32_t address, uint32_t global_address,
+                                    uint32_t callee_address,
+                                    int32_t loop_displacement = -4,
+                                    uint16_t immediate = 1) {
+  std::vector<uint32_t> codes;
+  uint32_t global_high = (global_address + 0x8000) >> 16;
+  uint32_t global_low = global_address & 0xFFFF;
+  // lis r11, global@ha
+  codes.push_back((15u << 26) | (11 << 21) | global_high);
+  // lwz r3, global@l(r11)
+  codes.push_back((32u << 26) | (3 << 21) | (11 << 16) | global_low);
+  // addi r3, r3, immediate
+  codes.push_back((14u << 26) | (3 << 21) | (3 << 16) | immediate);
+  // bdnz loop
+  codes.push_back((16u << 26) | (16 << 21) |
+                  (uint32_t(loop_displacement) & 0xFFFC));
+  // bl callee
+  uint32_t call_address = address + uint32_t(codes.size() * 4);
+  codes.push_back((18u << 26) | ((callee_address - call_address) & 0x03FFFFFC) |
+                  1);
+  // blr
+  codes.push_back(0x4E800020);
+  return codes;
+}
+
+uint64_t HashRoutine(uint32_t address, const std::vector<uint32_t>& codes) {
+  return RoutineSignatures::HashInstructions(address, codes.data(),
+                                             codes.size());
+}
+
+TEST_CASE("ROUTINE_SIGNATURES_RELOCATED", "[cpu]") {
+  uint64_t hash = HashRoutine(
+      0x82001000, CreateRoutine(0x82001000, 0x82800010, 0x82004000));
+  // Linked at another address, with the data and the callee elsewhere.
+  REQUIRE(HashRoutine(0x82345670, CreateRoutine(0x82345670, 0x83123450,
+                                                0x82000100)) == hash);
+}
+
+TEST_CASE("ROUTINE_SIGNATURES_DIFFERENT_CODE", "[cpu]") {
+  uint64_t hash = HashRoutine(
+      0x82001000, CreateRoutine(0x82001000, 0x82800010, 0x82004000));
+  // The branch within the routine goes elsewhere.
+  REQUIRE(HashRoutine(0x82001000, CreateRoutine(0x82001000, 0x82800010,
+                                                0x82004000, -8)) != hash);
+  // The immediate is not an address.
+  REQUIRE(HashRoutine(0x82001000, CreateRoutine(0x82001000, 0x82800010,
+                                                0x82004000, -4, 2)) != hash);
+}
+
+}  // namespace test
+}  // namespace cpu
+}  // namespace xe
@@ -14,6 +14,7 @@
 
 #include "xenia/base/platform.h"
 #include "xenia/cpu/backend/x64/x64_backend.h"
+#include "xenia/cpu/backend/x64/x64_emitter.h"
 #include "xenia/cpu/hir/hir_builder.h"
 #include "xenia/cpu/ppc/ppc_context.h"
 #include "xenia/cpu/ppc/ppc_frontend.h"
@@ -30,65 +31,88 @@ using xe::cpu::ppc::PPCContext;
 
 class TestFunction {
  public:
-  TestFunction(std::function<void(hir::HIRBuilder& b)> generator) {
+  TestFunction(std::function<void(hir::HIRBuilder& b)> generator)
+      : generator_(generator) {
     memory_size = 16 * 1024 * 1024;
     memory.reset(new Memory());
     memory->Initialize();
+  }
+
+  ~TestFunction() { memory.reset(); }
 
-    {
-      std::unique_ptr<xe::cpu::backend::Backend> backend;
+  // Runs the function with every instruction set extension allowed by the
+  // configuration, and again without AVX-512 to cover the fallback sequences.
+  // Processors are created for every run since the code cache of the backend
+  // is at a fixed address.
+  void Run(std::function<void(PPCContext*)> pre_call,
+           std::function<void(PPCContext*)> post_call) {
 #if XE_ARCH_AMD64
-      backend.reset(new xe::cpu::backend::x64::X64Backend());
-#endif  // XE_ARCH
-      if (backend) {
-        auto processor = std::make_unique<Processor>(memory.get(), nullptr);
-        processor->Setup(std::move(backend));
-        processors.emplace_back(std::move(processor));
+    int32_t extension_mask = cvars::x64_extension_mask;
+    const int32_t extension_masks[] = {
+        extension_mask,
+        extension_mask &
+            ~int32_t(backend::x64::kX64EmitAVX512Ortho |
+                     backend::x64::kX64EmitAVX512BW |
+                     backend::x64::kX64EmitAVX512DQ |
+                     backend::x64::kX64EmitAVX512VBMI),
+    };
+    for (int32_t run_extension_mask : extension_masks) {
+      // The emitter reads the mask when it's created for the translation.
+      cvars::x64_extension_mask = run_extension_mask;
+      auto processor = CreateProcessor(
+          std::make_unique<xe::cpu::backend::x64::X64Backend>());
+      if (processor) {
+        RunOnProcessor(processor.get(), pre_call, post_call);
       }
     }
-
-    for (auto& processor : processors) {
-      auto module = std::make_unique<xe::cpu::TestModule>(
-          processor.get(), "Test",
-          [](uint64_t address) { return address == 0x80000000; },
-          [generator](hir::HIRBuilder& b) {
-            generator(b);
-            return true;
-          });
-      processor->AddModule(std::move(module));
-      processor->backend()->CommitExecutableRange(0x80000000, 0x80010000);
-    }
+    cvars::x64_extension_mask = extension_mask;
+#endif  // XE_ARCH
   }
 
-  ~TestFunction() {
-    processors.clear();
-    memory.reset();
+  uint32_t memory_size;
+  std::unique_ptr<Memory> memory;
+
+ private:
+  std::unique_ptr<Processor> CreateProcessor(
+      std::unique_ptr<xe::cpu::backend::Backend> backend) {
+    auto processor = std::make_unique<Processor>(memory.get(), nullptr);
+    if (!processor->Setup(std::move(backend))) {
+      return nullptr;
+    }
+    auto generator = generator_;
+    auto module = std::make_unique<xe::cpu::TestModule>(
+        processor.get(), "Test",
+        [](uint64_t address) { return address == 0x80000000; },
+        [generator](hir::HIRBuilder& b) {
+          generator(b);
+          return true;
+        });
+    processor->AddModule(std::move(module));
+    processor->backend()->CommitExecutableRange(0x80000000, 0x80010000);
+    return processor;
   }
 
-  void Run(std::function<void(PPCContext*)> pre_call,
-           std::function<void(PPCContext*)> post_call) {
-    for (auto& processor : processors) {
-      auto fn = processor->ResolveFunction(0x80000000);
+  void RunOnProcessor(Processor* processor,
+                      std::function<void(PPCContext*)> pre_call,
+                      std::function<void(PPCContext*)> post_call) {
+    auto fn = processor->ResolveFunction(0x80000000);
 
-      uint32_t stack_size = 64 * 1024;
-      uint32_t stack_address = memory_size - stack_size;
-      uint32_t thread_state_address = stack_address - 0x1000;
-      auto thread_state = std::make_unique<ThreadState>(processor.get(), 0x100);
-      assert_always();  // TODO: Allocate a thread stack!!!
-      auto ctx = thread_state->context();
-      ctx->lr = 0xBCBCBCBC;
+    uint32_t stack_size = 64 * 1024;
+    uint32_t stack_address = memory_size - stack_size;
+    uint32_t thread_state_address = stack_address - 0x1000;
+    auto thread_state = std::make_unique<ThreadState>(processor, 0x100);
+    assert_always();  // TODO: Allocate a thread stack!!!
+    auto ctx = thread_state->context();
+    ctx->lr = 0xBCBCBCBC;
 
-      pre_call(ctx);
+    pre_call(ctx);
 
-      fn->Call(thread_state.get(), uint32_t(ctx->lr));
+    fn->Call(thread_state.get(), uint32_t(ctx->lr));
 
-      post_call(ctx);
-    }
+    post_call(ctx);
   }
 
-  uint32_t memory_size;
-  std::unique_ptr<Memory> memory;
-  std::vector<std::unique_ptr<Processor>> processors;
+  std::function<void(hir::HIRBuilder& b)> generator_;
 };
 
 inline hir::Value* LoadGPR(hir::HIRBuilder& b, int reg) {
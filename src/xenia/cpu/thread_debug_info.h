@@ -54,6 +54,11 @@ struct ThreadDebugInfo {
   State state = State::kAlive;
   // Whether the debugger has forcefully suspended this thread.
   bool suspended = false;
+  // Whether guest_context, host_context and frames have not been sampled since
+  // the thread was suspended by the debugger. Only the thread that stopped the
+  // execution is sampled immediately, others are sampled on demand via
+  // Processor::UpdateThreadExecutionState.
+  bool execution_state_stale = true;
 
   // A breakpoint managed by the stepping system, installed as required to
   // trigger a break at the next instruction.
@@ -10,13 +10,22 @@
 #include "xenia/cpu/xex_module.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "third_party/fmt/include/fmt/format.h"
 
 #include "xenia/base/byte_order.h"
+#include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
+#include "xenia/base/mapped_memory.h"
 #include "xenia/base/math.h"
 #include "xenia/base/memory.h"
+#include "xenia/base/string.h"
+#include "xenia/base/threading.h"
 #include "xenia/cpu/cpu_flags.h"
 #include "xenia/cpu/export_resolver.h"
 #include "xenia/cpu/lzx.h"
@@ -61,6 +70,304 @@ namespace cpu {
 
 using xe::kernel::KernelState;
 
+namespace {
+
+// Size of the pieces encrypted images are decrypted in on multiple threads.
+constexpr size_t kImageDecryptionSegmentSize = 256 * 1024;
+
+// Decrypts a part of an AES-128-CBC encrypted buffer. Decryption of a CBC block
+// only depends on the ciphertext of the previous block, so parts can be
+// decrypted independently, in any order, as long as the output doesn't overlap
+// the input. iv_source is the ciphertext the first block is XORed with, or
+// nullptr for the beginning of the buffer.
+void aes_decrypt_range(const uint32_t* rk, int32_t Nr,
+                       const uint8_t* iv_source, const uint8_t* input_buffer,
+                       const size_t input_size, uint8_t* output_buffer) {
+  uint8_t ivec[16] = {0};
+  if (iv_source) {
+    std::memcpy(ivec, iv_source, 16);
+  }
+  const uint8_t* ct = input_buffer;
+  uint8_t* pt = output_buffer;
+  for (size_t n = 0; n < input_size; n += 16, ct += 16, pt += 16) {
+    // Decrypt 16 uint8_ts from input -> output.
+    rijndaelDecrypt(rk, Nr, ct, pt);
+    for (size_t i = 0; i < 16; i++) {
+      // XOR with previous.
+      pt[i] ^= ivec[i];
+      // Set previous.
+      ivec[i] = ct[i];
+    }
+  }
+}
+
+uint32_t GetImageLoadThreadCount() {
+  return std::min(std::max(xe::threading::logical_processor_count(), 1u), 8u);
+}
+
+// Same as aes_decrypt_buffer, but on multiple threads for large buffers. The
+// output must not overlap the input.
+void aes_decrypt_buffer_parallel(const uint8_t* session_key,
+                                 const uint8_t* input_buffer,
+                                 const size_t input_size,
+                                 uint8_t* output_buffer) {
+  uint32_t rk[4 * (MAXNR + 1)];
+  int32_t Nr = rijndaelKeySetupDec(rk, session_key, 128);
+  size_t segment_count =
+      xe::round_up(input_size, kImageDecryptionSegmentSize, false) /
+      kImageDecryptionSegmentSize;
+  xe::threading::ParallelFor(segment_count, [&](size_t i) {
+    size_t offset = i * kImageDecryptionSegmentSize;
+    aes_decrypt_range(
+        rk, Nr, offset ? input_buffer + offset - 16 : nullptr,
+        input_buffer + offset,
+        std::min(kImageDecryptionSegmentSize, input_size - offset),
+        output_buffer + offset);
+  });
+}
+
+// Prepares the LZX data of a compressed image for decompression in a pipeline,
+// so the decompressor, the only inherently sequential part, can start as early
+// as possible and doesn't wait for the preceding stages to be completed for the
+// whole image. The image is decrypted in segments by tasks on the workers of
+// the task scheduler, and the blocks are verified and de-blocked on another
+// thread as soon as they're decrypted, while the LZX data is consumed via Read
+// once it's de-blocked.
+class CompressedImageStream {
+ public:
+  // session_key is nullptr if the image is not encrypted.
+  CompressedImageStream(const uint8_t* session_key, const uint8_t* input_buffer,
+                        size_t input_size,
+                        const xex2_compressed_block_info& first_block)
+      : input_size_(input_size),
+        first_block_(first_block),
+        compressed_(input_size) {
+    if (session_key) {
+      // Whole AES blocks are written.
+      decrypted_.resize(xe::round_up(input_size, size_t(16), false));
+      input_ = decrypted_.data();
+      rk_Nr_ = rijndaelKeySetupDec(rk_, session_key, 128);
+      size_t segment_count =
+          xe::round_up(input_size, kImageDecryptionSegmentSize, false) /
+          kImageDecryptionSegmentSize;
+      segments_decrypted_.resize(segment_count);
+      // One thread is taken by de-blocking, and one by the decompressor.
+      size_t task_count =
+          std::min(size_t(std::max(GetImageLoadThreadCount(), 3u) - 2),
+                   segment_count);
+      for (size_t i = 0; i < task_count; ++i) {
+        decryption_tasks_.Run(
+            [this, input_buffer]() { DecryptSegments(input_buffer); });
+      }
+    } else {
+      input_ = input_buffer;
+      decrypted_size_ = input_size;
+    }
+    deblocking_thread_ =
+        std::thread(&CompressedImageStream::DeblockingThread, this);
+  }
+
+  CompressedImageStream(const CompressedImageStream& stream) = delete;
+  CompressedImageStream& operator=(const CompressedImageStream& stream) =
+      delete;
+
+  ~CompressedImageStream() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cancelled_.store(true, std::memory_order_relaxed);
+    }
+    decrypted_cv_.notify_all();
+    deblocking_thread_.join();
+    decryption_tasks_.Wait();
+  }
+
+  // Waits for the first block to be verified, returns false if it doesn't
+  // match its hash, which likely means that the wrong key is used.
+  bool WaitForFirstBlock() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    deblocked_cv_.wait(lock,
+                       [this]() { return deblocked_size_ || deblocked_all_; });
+    return !deblocking_failed_;
+  }
+
+  // Whether any block doesn't match its hash or is malformed.
+  bool failed() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return deblocking_failed_;
+  }
+
+  // Blocks until more LZX data is available, then returns up to length bytes
+  // of the data, or 0 at the end of the data, or -1 if de-blocking has failed.
+  int Read(void* buffer, int length) {
+    size_t available;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      deblocked_cv_.wait(lock, [this]() {
+        return deblocked_size_ > read_offset_ || deblocked_all_;
+      });
+      if (deblocking_failed_) {
+        return -1;
+      }
+      available = deblocked_size_ - read_offset_;
+    }
+    size_t read_size = std::min(size_t(std::max(length, 0)), available);
+    std::memcpy(buffer, compressed_.data() + read_offset_, read_size);
+    read_offset_ += read_size;
+    return int(read_size);
+  }
+
+ private:
+  void DecryptSegments(const uint8_t* input_buffer) {
+    size_t segment_count = segments_decrypted_.size();
+    while (!cancelled_.load(std::memory_order_relaxed)) {
+      size_t segment =
+          next_segment_.fetch_add(1, std::memory_order_relaxed);
+      if (segment >= segment_count) {
+        break;
+      }
+      size_t offset = segment * kImageDecryptionSegmentSize;
+      aes_decrypt_range(
+          rk_, rk_Nr_, offset ? input_buffer + offset - 16 : nullptr,
+          input_buffer + offset,
+          std::min(kImageDecryptionSegmentSize, input_size_ - offset),
+          decrypted_.data() + offset);
+      bool decrypted_size_changed = false;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        segments_decrypted_[segment] = true;
+        // Publish the decrypted prefix of the image.
+        size_t first_pending_segment =
+            decrypted_size_ / kImageDecryptionSegmentSize;
+        while (first_pending_segment < segment_count &&
+               segments_decrypted_[first_pending_segment]) {
+          ++first_pending_segment;
+          decrypted_size_ =
+              std::min(first_pending_segment * kImageDecryptionSegmentSize,
+                       input_size_);
+          decrypted_size_changed = true;
+        }
+      }
+      if (decrypted_size_changed) {
+        decrypted_cv_.notify_one();
+      }
+    }
+  }
+
+  void DeblockingThread() {
+    sha1::SHA1 s;
+    uint8_t block_calced_digest[0x14];
+    bool failed = false;
+    const xex2_compressed_block_info* cur_block = &first_block_;
+    size_t block_offset = 0;
+    size_t compressed_size = 0;
+    while (cur_block->block_size) {
+      size_t block_size = cur_block->block_size;
+      if (block_size < 4 + 20 || block_size > input_size_ - block_offset) {
+        failed = true;
+        break;
+      }
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        decrypted_cv_.wait(lock, [&]() {
+          return decrypted_size_ >= block_offset + block_size ||
+                 cancelled_.load(std::memory_order_relaxed);
+        });
+        if (cancelled_.load(std::memory_order_relaxed)) {
+          break;
+        }
+      }
+      const uint8_t* p = input_ + block_offset;
+      const uint8_t* pend = p + block_size;
+
+      // Compare block hash, if no match we probably used wrong decrypt key
+      s.reset();
+      s.processBytes(p, block_size);
+      s.finalize(block_calced_digest);
+      if (memcmp(block_calced_digest, cur_block->block_hash, 0x14) != 0) {
+        failed = true;
+        break;
+      }
+      const auto* next_block =
+          reinterpret_cast<const xex2_compressed_block_info*>(p);
+
+      // skip block info
+      p += 4;
+      p += 20;
+
+      while (true) {
+        if (pend - p < 2) {
+          failed = true;
+          break;
+        }
+        const size_t chunk_size = (p[0] << 8) | p[1];
+        p += 2;
+        if (!chunk_size) {
+          break;
+        }
+        if (chunk_size > size_t(pend - p)) {
+          failed = true;
+          break;
+        }
+        // The chunks are always smaller than the blocks containing them, so
+        // the LZX data fits in the buffer sized like the input.
+        memcpy(compressed_.data() + compressed_size, p, chunk_size);
+        p += chunk_size;
+        compressed_size += chunk_size;
+      }
+      if (failed) {
+        break;
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        deblocked_size_ = compressed_size;
+      }
+      deblocked_cv_.notify_one();
+
+      block_offset += block_size;
+      cur_block = next_block;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      deblocked_all_ = true;
+      deblocking_failed_ = failed;
+      if (failed) {
+        // Stop decrypting the rest of the image.
+        cancelled_.store(true, std::memory_order_relaxed);
+      }
+    }
+    deblocked_cv_.notify_one();
+  }
+
+  size_t input_size_;
+  xex2_compressed_block_info first_block_;
+
+  uint32_t rk_[4 * (MAXNR + 1)];
+  int32_t rk_Nr_ = 0;
+  std::vector<uint8_t> decrypted_;
+  const uint8_t* input_;
+  std::vector<uint8_t> compressed_;
+
+  std::mutex mutex_;
+  std::atomic<bool> cancelled_ = {false};
+  // Protected by mutex_.
+  std::vector<bool> segments_decrypted_;
+  size_t decrypted_size_ = 0;
+  std::condition_variable decrypted_cv_;
+  size_t deblocked_size_ = 0;
+  bool deblocked_all_ = false;
+  bool deblocking_failed_ = false;
+  std::condition_variable deblocked_cv_;
+
+  std::atomic<size_t> next_segment_ = {0};
+  xe::threading::TaskScheduler::TaskGroup decryption_tasks_;
+  std::thread deblocking_thread_;
+
+  // Only accessed by the reader.
+  size_t read_offset_ = 0;
+};
+
+}  // namespace
+
 XexModule::XexModule(Processor* processor, KernelState* kernel_state)
     : Module(processor), processor_(processor), kernel_state_(kernel_state) {}
 
@@ -171,30 +478,36 @@ uint32_t XexModule::GetProcAddress(const std::string_view name) const {
       base_address_ + pe_export_directory->offset);
   assert_not_null(e);
 
-  // e->AddressOfX RVAs are relative to the IMAGE_EXPORT_DIRECTORY!
-  uint32_t* function_table =
-      reinterpret_cast<uint32_t*>(uintptr_t(e) + e->AddressOfFunctions);
-
-  // Names relative to directory
-  uint32_t* name_table =
-      reinterpret_cast<uint32_t*>(uintptr_t(e) + e->AddressOfNames);
-
-  // Table of ordinals (by name)
-  uint16_t* ordinal_table =
-      reinterpret_cast<uint16_t*>(uintptr_t(e) + e->AddressOfNameOrdinals);
-
-  for (uint32_t i = 0; i < e->NumberOfNames; i++) {
-    auto fn_name = reinterpret_cast<const char*>(uintptr_t(e) + name_table[i]);
-    uint16_t ordinal = ordinal_table[i];
-    uint32_t addr = base_address_ + function_table[ordinal];
-    if (name == std::string_view(fn_name)) {
-      // We have a match!
-      return addr;
+  std::lock_guard<std::mutex> lock(exports_by_name_mutex_);
+  if (!exports_by_name_built_) {
+    // e->AddressOfX RVAs are relative to the IMAGE_EXPORT_DIRECTORY!
+    uint32_t* function_table =
+        reinterpret_cast<uint32_t*>(uintptr_t(e) + e->AddressOfFunctions);
+
+    // Names relative to directory
+    uint32_t* name_table =
+        reinterpret_cast<uint32_t*>(uintptr_t(e) + e->AddressOfNames);
+
+    // Table of ordinals (by name)
+    uint16_t* ordinal_table =
+        reinterpret_cast<uint16_t*>(uintptr_t(e) + e->AddressOfNameOrdinals);
+
+    exports_by_name_.reserve(e->NumberOfNames);
+    for (uint32_t i = 0; i < e->NumberOfNames; i++) {
+      auto fn_name =
+          reinterpret_cast<const char*>(uintptr_t(e) + name_table[i]);
+      uint16_t ordinal = ordinal_table[i];
+      // Keeping the first of duplicate names, which a linear search would
+      // find.
+      exports_by_name_.emplace(fn_name,
+                               base_address_ + function_table[ordinal]);
     }
+    exports_by_name_built_ = true;
   }
 
+  auto it = exports_by_name_.find(std::string(name));
   // No match
-  return 0;
+  return it != exports_by_name_.cend() ? it->second : 0;
 }
 
 int XexModule::ApplyPatch(XexModule* module) {
@@ -366,8 +679,8 @@ int XexModule::ApplyPatch(XexModule* module) {
       // TODO: a way to do without a copy/alloc?
       free_input = true;
       input_buffer = (const uint8_t*)calloc(1, patch_length);
-      aes_decrypt_buffer(session_key_, patch_buffer, patch_length,
-                         (uint8_t*)input_buffer, patch_length);
+      aes_decrypt_buffer_parallel(session_key_, patch_buffer, patch_length,
+                                  (uint8_t*)input_buffer);
       break;
     default:
       assert_always();
@@ -550,8 +863,7 @@ int XexModule::ReadImageUncompressed(const void* xex_addr, size_t xex_length) {
       memcpy(buffer, p, exe_length);
       return 0;
     case XEX_ENCRYPTION_NORMAL:
-      aes_decrypt_buffer(session_key_, p, exe_length, buffer,
-                         uncompressed_size);
+      aes_decrypt_buffer_parallel(session_key_, p, exe_length, buffer);
       return 0;
     default:
       assert_always();
@@ -607,45 +919,67 @@ int XexModule::ReadImageBasicCompressed(const void* xex_addr,
 
   uint8_t* buffer = memory()->TranslateVirtual(base_address_);
   std::memset(buffer, 0, total_size);  // Quickly zero the contents.
-  uint8_t* d = buffer;
 
-  uint32_t rk[4 * (MAXNR + 1)];
-  uint8_t ivec[16] = {0};
-  int32_t Nr = rijndaelKeySetupDec(rk, session_key_, 128);
-
-  for (size_t n = 0; n < block_count; n++) {
-    const uint32_t data_size = comp_info.blocks[n].data_size;
-    const uint32_t zero_size = comp_info.blocks[n].zero_size;
-
-    switch (opt_file_format_info()->encryption_type) {
-      case XEX_ENCRYPTION_NONE:
+  switch (opt_file_format_info()->encryption_type) {
+    case XEX_ENCRYPTION_NONE: {
+      uint8_t* d = buffer;
+      for (size_t n = 0; n < block_count; n++) {
+        const uint32_t data_size = comp_info.blocks[n].data_size;
+        const uint32_t zero_size = comp_info.blocks[n].zero_size;
         if (data_size > uncompressed_size - (d - buffer)) {
           // Overflow.
           return 1;
         }
         memcpy(d, p, data_size);
-        break;
-      case XEX_ENCRYPTION_NORMAL: {
-        const uint8_t* ct = p;
-        uint8_t* pt = d;
-        for (size_t m = 0; m < data_size; m += 16, ct += 16, pt += 16) {
-          // Decrypt 16 uint8_ts from input -> output.
-          rijndaelDecrypt(rk, Nr, ct, pt);
-          for (size_t i = 0; i < 16; i++) {
-            // XOR with previous.
-            pt[i] ^= ivec[i];
-            // Set previous.
-            ivec[i] = ct[i];
-          }
+        p += data_size;
+        d += data_size + zero_size;
+      }
+    } break;
+    case XEX_ENCRYPTION_NORMAL: {
+      // The CBC chain continues across the blocks, so the blocks can be
+      // decrypted in parallel given the last ciphertext of the preceding ones.
+      struct DecryptionBlock {
+        const uint8_t* iv_source;
+        const uint8_t* source;
+        uint8_t* dest;
+        uint32_t data_size;
+      };
+      std::vector<DecryptionBlock> decryption_blocks;
+      decryption_blocks.reserve(block_count);
+      const uint8_t* iv_source = nullptr;
+      uint8_t* d = buffer;
+      // With partial AES blocks, the decryption writes past the data, which
+      // could overlap the next block.
+      bool blocks_aligned = true;
+      for (size_t n = 0; n < block_count; n++) {
+        const uint32_t data_size = comp_info.blocks[n].data_size;
+        const uint32_t zero_size = comp_info.blocks[n].zero_size;
+        if (data_size) {
+          decryption_blocks.push_back({iv_source, p, d, data_size});
+          iv_source = p + xe::round_up(data_size, uint32_t(16)) - 16;
+          blocks_aligned &= !(data_size & 15);
         }
-      } break;
-      default:
-        assert_always();
-        return 1;
-    }
-
-    p += data_size;
-    d += data_size + zero_size;
+        p += data_size;
+        d += data_size + zero_size;
+      }
+      uint32_t rk[4 * (MAXNR + 1)];
+      int32_t Nr = rijndaelKeySetupDec(rk, session_key_, 128);
+      auto decrypt_block = [&](size_t i) {
+        const DecryptionBlock& block = decryption_blocks[i];
+        aes_decrypt_range(rk, Nr, block.iv_source, block.source,
+                          block.data_size, block.dest);
+      };
+      if (blocks_aligned) {
+        xe::threading::ParallelFor(decryption_blocks.size(), decrypt_block);
+      } else {
+        for (size_t i = 0; i < decryption_blocks.size(); ++i) {
+          decrypt_block(i);
+        }
+      }
+    } break;
+    default:
+      assert_always();
+      return 1;
   }
 
   return 0;
@@ -665,26 +999,15 @@ int XexModule::ReadImageCompressed(const void* xex_addr, size_t xex_length) {
   //    Nb block uint8_ts
   // - decompress block contents
 
-  uint8_t* compress_buffer = NULL;
-  const uint8_t* p = NULL;
-  uint8_t* d = NULL;
-  sha1::SHA1 s;
-
-  // Decrypt (if needed).
-  bool free_input = false;
-  const uint8_t* input_buffer = exe_buffer;
-  size_t input_size = exe_length;
-
+  // Decrypt (if needed), verify and de-block in a pipeline overlapped with
+  // the decompression.
+  const uint8_t* session_key = nullptr;
   switch (opt_file_format_info()->encryption_type) {
     case XEX_ENCRYPTION_NONE:
       // No-op.
       break;
     case XEX_ENCRYPTION_NORMAL:
-      // TODO: a way to do without a copy/alloc?
-      free_input = true;
-      input_buffer = (const uint8_t*)calloc(1, exe_length);
-      aes_decrypt_buffer(session_key_, exe_buffer, exe_length,
-                         (uint8_t*)input_buffer, exe_length);
+      session_key = session_key_;
       break;
     default:
       assert_always();
@@ -692,83 +1015,41 @@ int XexModule::ReadImageCompressed(const void* xex_addr, size_t xex_length) {
   }
 
   const auto* compression_info = &opt_file_format_info()->compression_info;
-  const xex2_compressed_block_info* cur_block =
-      &compression_info->normal.first_block;
-
-  compress_buffer = (uint8_t*)calloc(1, exe_length);
-
-  p = input_buffer;
-  d = compress_buffer;
-
-  // De-block.
-  int result_code = 0;
-
-  uint8_t block_calced_digest[0x14];
-  while (cur_block->block_size) {
-    const uint8_t* pnext = p + cur_block->block_size;
-    const auto* next_block = (const xex2_compressed_block_info*)p;
-
-    // Compare block hash, if no match we probably used wrong decrypt key
-    s.reset();
-    s.processBytes(p, cur_block->block_size);
-    s.finalize(block_calced_digest);
-    if (memcmp(block_calced_digest, cur_block->block_hash, 0x14) != 0) {
-      result_code = 2;
-      break;
-    }
-
-    // skip block info
-    p += 4;
-    p += 20;
-
-    while (true) {
-      const size_t chunk_size = (p[0] << 8) | p[1];
-      p += 2;
-      if (!chunk_size) {
-        break;
-      }
-
-      memcpy(d, p, chunk_size);
-      p += chunk_size;
-      d += chunk_size;
-    }
-
-    p = pnext;
-    cur_block = next_block;
+  CompressedImageStream stream(session_key, exe_buffer, exe_length,
+                               compression_info->normal.first_block);
+  // Don't allocate anything if the key is wrong.
+  if (!stream.WaitForFirstBlock()) {
+    return 2;
   }
 
-  if (!result_code) {
-    uint32_t uncompressed_size = image_size();
-
-    // Allocate in-place the XEX memory.
-    bool alloc_result =
-        memory()
-            ->LookupHeap(base_address_)
-            ->AllocFixed(
-                base_address_, uncompressed_size, 4096,
-                xe::kMemoryAllocationReserve | xe::kMemoryAllocationCommit,
-                xe::kMemoryProtectRead | xe::kMemoryProtectWrite);
-
-    if (alloc_result) {
-      uint8_t* buffer = memory()->TranslateVirtual(base_address_);
-      std::memset(buffer, 0, uncompressed_size);
+  uint32_t uncompressed_size = image_size();
 
-      // Decompress into XEX base
-      result_code = lzx_decompress(
-          compress_buffer, d - compress_buffer, buffer, uncompressed_size,
-          compression_info->normal.window_size, nullptr, 0);
-    } else {
-      XELOGE("Unable to allocate XEX memory at {:08X}-{:08X}.", base_address_,
-             uncompressed_size);
-      result_code = 3;
-    }
+  // Allocate in-place the XEX memory.
+  bool alloc_result =
+      memory()
+          ->LookupHeap(base_address_)
+          ->AllocFixed(
+              base_address_, uncompressed_size, 4096,
+              xe::kMemoryAllocationReserve | xe::kMemoryAllocationCommit,
+              xe::kMemoryProtectRead | xe::kMemoryProtectWrite);
+  if (!alloc_result) {
+    XELOGE("Unable to allocate XEX memory at {:08X}-{:08X}.", base_address_,
+           uncompressed_size);
+    return 3;
   }
 
-  if (compress_buffer) {
-    free((void*)compress_buffer);
-  }
-  if (free_input) {
-    free((void*)input_buffer);
+  uint8_t* buffer = memory()->TranslateVirtual(base_address_);
+  std::memset(buffer, 0, uncompressed_size);
+
+  // Decompress into XEX base
+  int result_code = lzx_decompress(
+      [&stream](void* read_buffer, int length) {
+        return stream.Read(read_buffer, length);
+      },
+      buffer, uncompressed_size, compression_info->normal.window_size);
+  if (stream.failed()) {
+    // A block hash doesn't match the hash inside the previous block info.
+    result_code = 2;
   }
   return result_code;
 }
@@ -895,10 +1176,9 @@ void XexModule::ReadSecurityInfo() {
   }
 }
 
-bool XexModule::Load(const std::string_view name, const std::string_view path,
-                     const void* xex_addr, size_t xex_length) {
-  auto src_header = reinterpret_cast<const xex2_header*>(xex_addr);
-
+bool XexModule::LoadHeaders(const std::string_view name,
+                            const std::string_view path,
+                            const xex2_header* src_header) {
   if (src_header->magic == kXEX1Signature) {
     xex_format_ = kFormatXex1;
   } else if (src_header->magic == kXEX2Signature) {
@@ -917,8 +1197,6 @@ bool XexModule::Load(const std::string_view name, const std::string_view path,
   // Read/convert XEX1/XEX2 security info to a common format
   ReadSecurityInfo();
 
-  auto sec_header = xex_security_info();
-
   // Try setting our base_address based on XEX_HEADER_IMAGE_BASE_ADDRESS, fall
   // back to xex_security_info otherwise
   base_address_ = xex_security_info()->load_address;
@@ -930,7 +1208,15 @@ bool XexModule::Load(const std::string_view name, const std::string_view path,
   name_ = name;
   path_ = path;
 
-  uint8_t* data = memory()->TranslateVirtual(base_address_);
+  return true;
+}
+
+bool XexModule::Load(const std::string_view name, const std::string_view path,
+                     const void* xex_addr, size_t xex_length) {
+  if (!LoadHeaders(name, path,
+                   reinterpret_cast<const xex2_header*>(xex_addr))) {
+    return false;
+  }
 
   // Load in the XEX basefile
   // We'll try using both XEX2 keys to see if any give a valid PE
@@ -952,6 +1238,96 @@ bool XexModule::Load(const std::string_view name, const std::string_view path,
   return true;
 }
 
+bool XexModule::SaveImageCache(const std::filesystem::path& cache_path) const {
+  if (!loaded_ || is_patch() || finished_load_) {
+    return false;
+  }
+  if (!xe::filesystem::CreateParentFolder(cache_path)) {
+    return false;
+  }
+  // Written to a temporary file first so an interrupted write is never
+  // picked up.
+  std::filesystem::path temp_path = cache_path;
+  temp_path += ".tmp";
+  FILE* file = xe::filesystem::OpenFile(temp_path, "wb");
+  if (!file) {
+    return false;
+  }
+  ImageCacheHeader header;
+  header.magic = kImageCacheMagic;
+  header.version = kImageCacheVersion;
+  header.header_size = uint32_t(xex_header_mem_.size());
+  header.image_size = image_size();
+  header.base_address = base_address_;
+  header.is_dev_kit = is_dev_kit_ ? 1 : 0;
+  bool written =
+      fwrite(&header, sizeof(header), 1, file) == 1 &&
+      fwrite(xex_header_mem_.data(), 1, xex_header_mem_.size(), file) ==
+          xex_header_mem_.size() &&
+      fwrite(memory()->TranslateVirtual(base_address_), 1, header.image_size,
+             file) == header.image_size;
+  fclose(file);
+  std::error_code error_code;
+  if (written) {
+    std::filesystem::rename(temp_path, cache_path, error_code);
+    if (!error_code) {
+      return true;
+    }
+  }
+  std::filesystem::remove(temp_path, error_code);
+  return false;
+}
+
+bool XexModule::LoadFromImageCache(const std::string_view name,
+                                   const std::string_view path,
+                                   const std::filesystem::path& cache_path) {
+  auto mapping = MappedMemory::Open(cache_path, MappedMemory::Mode::kRead);
+  if (!mapping || mapping->size() < sizeof(ImageCacheHeader)) {
+    return false;
+  }
+  ImageCacheHeader header;
+  std::memcpy(&header, mapping->data(), sizeof(header));
+  if (header.magic != kImageCacheMagic ||
+      header.version != kImageCacheVersion ||
+      header.header_size < sizeof(xex2_header) ||
+      mapping->size() != sizeof(header) + uint64_t(header.header_size) +
+                             uint64_t(header.image_size)) {
+    return false;
+  }
+  const uint8_t* header_data = mapping->data() + sizeof(header);
+  auto src_header = reinterpret_cast<const xex2_header*>(header_data);
+  if (src_header->header_size != header.header_size) {
+    return false;
+  }
+  if (!LoadHeaders(name, path, src_header)) {
+    return false;
+  }
+  is_dev_kit_ = header.is_dev_kit != 0;
+
+  uint32_t uncompressed_size = image_size();
+  if (base_address_ != header.base_address ||
+      uncompressed_size != header.image_size) {
+    XELOGE("XEX image cache {} doesn't match its headers",
+           xe::path_to_utf8(cache_path));
+    return false;
+  }
+
+  auto heap = memory()->LookupHeap(base_address_);
+  heap->Reset();
+  bool alloc_result = heap->AllocFixed(
+      base_address_, uncompressed_size, 4096,
+      xe::kMemoryAllocationReserve | xe::kMemoryAllocationCommit,
+      xe::kMemoryProtectRead | xe::kMemoryProtectWrite);
+  if (!alloc_result) {
+    XELOGE("Unable to allocate XEX memory at {:08X}-{:08X}.", base_address_,
+           uncompressed_size);
+    return false;
+  }
+  std::memcpy(memory()->TranslateVirtual(base_address_),
+              header_data + header.header_size, uncompressed_size);
+  return is_valid_executable();
+}
+
 bool XexModule::LoadContinue() {
   // Second part of image load
   // Split from Load() so that we can patch the XEX before loading this data
@@ -1003,6 +1379,8 @@ bool XexModule::LoadContinue() {
 
   // Notify backend that we have an executable range.
   processor_->backend()->CommitExecutableRange(low_address_, high_address_);
+  // The module was added to the processor before its range was known.
+  processor_->RebuildModuleIndex();
 
   // Add all imports (variables/functions).
   xex2_opt_import_libraries* opt_import_libraries = nullptr;
@@ -1100,14 +1478,21 @@ bool XexModule::Unload() {
 
   xex_header_mem_.resize(0);
 
+  {
+    std::lock_guard<std::mutex> lock(exports_by_name_mutex_);
+    exports_by_name_.clear();
+    exports_by_name_built_ = false;
+  }
+
   return true;
 }
 
 bool XexModule::SetupLibraryImports(const std::string_view name,
                                     const xex2_import_library* library) {
-  ExportResolver* kernel_resolver = nullptr;
-  if (kernel_state_->IsKernelModule(name)) {
-    kernel_resolver = processor_->export_resolver();
+  bool is_kernel_module = kernel_state_->IsKernelModule(name);
+  const ExportResolver::Table* kernel_table = nullptr;
+  if (is_kernel_module) {
+    kernel_table = processor_->export_resolver()->GetTable(name);
   }
 
   auto user_module = kernel_state_->GetModule(name);
@@ -1136,8 +1521,10 @@ bool XexModule::SetupLibraryImports(const std::string_view name,
     Export* kernel_export = nullptr;
     uint32_t user_export_addr = 0;
 
-    if (kernel_resolver) {
-      kernel_export = kernel_resolver->GetExportByOrdinal(name, ordinal);
+    if (is_kernel_module) {
+      if (kernel_table) {
+        kernel_export = kernel_table->GetExportByOrdinal(ordinal);
+      }
     } else if (user_module) {
       user_export_addr = user_module->GetProcAddressByOrdinal(ordinal);
     }
@@ -1286,6 +1673,16 @@ bool XexModule::ContainsAddress(uint32_t address) {
   return address >= low_address_ && address < high_address_;
 }
 
+bool XexModule::GetAddressRange(uint32_t* out_low_address,
+                                uint32_t* out_high_address) {
+  if (low_address_ >= high_address_) {
+    return false;
+  }
+  *out_low_address = low_address_;
+  *out_high_address = high_address_;
+  return true;
+}
+
 std::unique_ptr<Function> XexModule::CreateFunction(uint32_t address) {
   return std::unique_ptr<Function>(
       processor_->backend()->CreateGuestFunction(this, address));
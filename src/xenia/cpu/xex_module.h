@@ -10,7 +10,10 @@
 #ifndef XENIA_CPU_XEX_MODULE_H_
 #define XENIA_CPU_XEX_MODULE_H_
 
+#include <filesystem>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "xenia/cpu/module.h"
@@ -145,10 +148,20 @@ class XexModule : public xe::cpu::Module {
   int ApplyPatch(XexModule* module);
   bool Load(const std::string_view name, const std::string_view path,
             const void* xex_addr, size_t xex_length);
+  // Saves the headers and the image as they are before LoadContinue - with the
+  // patch applied, but without the imports set up - so later launches can skip
+  // decryption, decompression and patching.
+  bool SaveImageCache(const std::filesystem::path& cache_path) const;
+  // Alternative to Load and ApplyPatch, from a file created by SaveImageCache.
+  bool LoadFromImageCache(const std::string_view name,
+                          const std::string_view path,
+                          const std::filesystem::path& cache_path);
   bool LoadContinue();
   bool Unload();
 
   bool ContainsAddress(uint32_t address) override;
+  bool GetAddressRange(uint32_t* out_low_address,
+                       uint32_t* out_high_address) override;
 
   const std::string& name() const override { return name_; }
   bool is_executable() const override {
@@ -178,6 +191,22 @@ class XexModule : public xe::cpu::Module {
   std::unique_ptr<Function> CreateFunction(uint32_t address) override;
 
  private:
+  static constexpr uint32_t kImageCacheMagic = 0x43494D58;  // 'XMIC'
+  static constexpr uint32_t kImageCacheVersion = 1;
+
+  // Followed by the XEX headers and the image.
+  struct ImageCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t image_size;
+    uint32_t base_address;
+    uint32_t is_dev_kit;
+  };
+  static_assert(sizeof(ImageCacheHeader) == 24);
+
+  bool LoadHeaders(const std::string_view name, const std::string_view path,
+                   const xex2_header* src_header);
   void ReadSecurityInfo();
 
   int ReadImage(const void* xex_addr, size_t xex_length, bool use_dev_key);
@@ -217,6 +246,12 @@ class XexModule : public xe::cpu::Module {
 
   XexFormat xex_format_ = kFormatUnknown;
   SecurityInfoContext security_info_ = {};
+
+  // Addresses of the PE exports by name, built on the first lookup by name
+  // instead of comparing against every name on each lookup.
+  mutable std::mutex exports_by_name_mutex_;
+  mutable std::unordered_map<std::string, uint32_t> exports_by_name_;
+  mutable bool exports_by_name_built_ = false;
 };
 
 }  // namespace cpu
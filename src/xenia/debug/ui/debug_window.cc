@@ -28,6 +28,7 @@
 #include "xenia/cpu/ppc/ppc_opcode_info.h"
 #include "xenia/cpu/stack_walker.h"
 #include "xenia/gpu/graphics_system.h"
+#include "xenia/kernel/util/kernel_call_profiler.h"
 #include "xenia/kernel/xmodule.h"
 #include "xenia/kernel/xthread.h"
 #include "xenia/ui/graphics_provider.h"
@@ -38,6 +39,9 @@
 
 DEFINE_bool(imgui_debug, false, "Show ImGui debugging tools.", "UI");
 
+DECLARE_bool(track_guest_allocations);
+DECLARE_path(heap_usage_dump_path);
+
 namespace xe {
 namespace debug {
 namespace ui {
@@ -163,6 +167,10 @@ void DebugWindow::DrawFrame(ImGuiIO& io) {
   float log_pane_width =
       ImGui::GetContentRegionAvail().x - breakpoints_pane_width;
 
+  if (thread_list_changed_.exchange(false, std::memory_order_relaxed)) {
+    cache_.thread_debug_infos = processor_->QueryThreadDebugInfos();
+  }
+
   ImGui::BeginChild("##toolbar", ImVec2(0, 25), true);
   DrawToolbar();
   ImGui::EndChild();
@@ -216,6 +224,9 @@ void DebugWindow::DrawFrame(ImGuiIO& io) {
   ImGui::SameLine();
   ImGui::RadioButton("Memory", &state_.right_pane_tab,
                      ImState::kRightPaneMemory);
+  ImGui::SameLine();
+  ImGui::RadioButton("Kernel Calls", &state_.right_pane_tab,
+                     ImState::kRightPaneKernelCalls);
   ImGui::EndGroup();
   ImGui::Separator();
   switch (state_.right_pane_tab) {
@@ -229,6 +240,11 @@ void DebugWindow::DrawFrame(ImGuiIO& io) {
       DrawMemoryPane();
       ImGui::EndChild();
       break;
+    case ImState::kRightPaneKernelCalls:
+      ImGui::BeginChild("##kernel_calls_pane");
+      DrawKernelCallsPane();
+      ImGui::EndChild();
+      break;
   }
   ImGui::EndChild();
   ImGui::InvisibleButton("##hsplitter0", ImVec2(-1, kSplitterWidth));
@@ -465,7 +481,7 @@ void DebugWindow::DrawGuestFunctionSource() {
   //     if historical data for memory/etc present, show combo boxes
   auto memory = emulator_->memory();
   auto function = static_cast<cpu::GuestFunction*>(state_.function);
-  auto& source_map = function->source_map();
+  std::vector<cpu::SourceMapEntry> source_map = function->source_map();
   uint32_t source_map_index = 0;
 
   bool draw_hir = false;
@@ -1040,6 +1056,9 @@ void DebugWindow::DrawThreadsPane() {
       if (thread->is_running()) {
         if (thread->suspend_count() > 1) {
           state_label = "SUSPEND";
+        } else if (thread_info->state ==
+                   cpu::ThreadDebugInfo::State::kWaiting) {
+          state_label = "WAITING";
         } else {
           state_label = "RUNNING";
         }
@@ -1058,7 +1077,19 @@ void DebugWindow::DrawThreadsPane() {
             is_current_thread ? ImGuiTreeNodeFlags_DefaultOpen : 0)) {
       //   |     (log button) detail of kernel call categories
       // log button toggles only logging that thread
+      // Threads other than the one that has stopped the execution are sampled
+      // when they're first looked at. While running, a sample of the call
+      // stack can be taken without stopping the other threads.
+      if (!cache_.is_running) {
+        processor_->UpdateThreadExecutionState(thread_info->thread_id);
+      }
       ImGui::BulletText("Call Stack");
+      if (cache_.is_running && thread->can_debugger_suspend()) {
+        ImGui::SameLine();
+        if (ImGui::SmallButton("Sample")) {
+          processor_->UpdateThreadExecutionState(thread_info->thread_id);
+        }
+      }
       ImGui::Indent();
       for (size_t j = 0; j < thread_info->frames.size(); ++j) {
         bool is_current_frame =
@@ -1108,10 +1139,186 @@ void DebugWindow::DrawThreadsPane() {
 }
 
 void DebugWindow::DrawMemoryPane() {
-  ImGui::Text("<memory>");
+  auto memory = emulator_->memory();
+  if (ImGui::Button("Refresh")) {
+    cache_.heap_usage_reports = memory->GetHeapUsageReports();
+  }
+  if (ImGui::IsItemHovered()) {
+    ImGui::SetTooltip("Update the heap usage (also done on every break).");
+  }
+  ImGui::SameLine();
+  if (ImGui::Button("Dump to File")) {
+    memory->DumpHeapUsage(cvars::heap_usage_dump_path.empty()
+                              ? std::filesystem::path("heap_usage.txt")
+                              : cvars::heap_usage_dump_path);
+  }
+  if (!cvars::track_guest_allocations) {
+    ImGui::TextDisabled(
+        "Enable --track_guest_allocations for the callers and watch faults.");
+  }
+  ImGui::Separator();
   // tools for searching:
   //   search bytes | text | pattern
   // https://github.com/ocornut/imgui/wiki/memory_editor_example
+  ImGui::BeginChild("##heaps_listing");
+  for (size_t i = 0; i < cache_.heap_usage_reports.size(); ++i) {
+    // The physical address space heap is the last one.
+    DrawHeapUsage(cache_.heap_usage_reports[i],
+                  i + 1 == cache_.heap_usage_reports.size());
+  }
+  ImGui::EndChild();
+}
+
+void DebugWindow::DrawKernelCallsPane() {
+  using xe::kernel::util::KernelCallProfiler;
+  if (!KernelCallProfiler::is_enabled()) {
+    ImGui::TextDisabled(
+        "Enable --kernel_call_profiler to collect the kernel call statistics.");
+    return;
+  }
+  if (ImGui::Button("Reset")) {
+    KernelCallProfiler::Reset();
+  }
+  ImGui::SameLine();
+  if (ImGui::Button("Dump to Log")) {
+    KernelCallProfiler::Dump();
+  }
+  ImGui::Separator();
+  // Live view, from the export with the most time spent in it. The total
+  // time includes the time blocked in waits.
+  std::vector<KernelCallProfiler::Snapshot> snapshots =
+      KernelCallProfiler::GetSnapshots();
+  double ticks_to_us = 1000000.0 / double(Clock::QueryHostTickFrequency());
+  ImGui::BeginChild("##kernel_calls_listing");
+  ImGui::Columns(8);
+  ImGui::Text("Export");
+  ImGui::NextColumn();
+  ImGui::Text("Calls");
+  ImGui::NextColumn();
+  ImGui::Text("Total ms");
+  ImGui::NextColumn();
+  ImGui::Text("Wait ms");
+  ImGui::NextColumn();
+  ImGui::Text("Average us");
+  ImGui::NextColumn();
+  ImGui::Text("p50 us");
+  ImGui::NextColumn();
+  ImGui::Text("p99 us");
+  ImGui::NextColumn();
+  ImGui::Text("Max us");
+  ImGui::NextColumn();
+  ImGui::Separator();
+  for (const KernelCallProfiler::Snapshot& snapshot : snapshots) {
+    ImGui::Text("%s!%s", snapshot.module_name, snapshot.export_name);
+    ImGui::NextColumn();
+    ImGui::Text("%" PRIu64, snapshot.call_count);
+    ImGui::NextColumn();
+    ImGui::Text("%.3f", double(snapshot.total_ticks) * ticks_to_us * 0.001);
+    ImGui::NextColumn();
+    ImGui::Text("%.3f", double(snapshot.wait_ticks) * ticks_to_us * 0.001);
+    ImGui::NextColumn();
+    ImGui::Text("%.3f", double(snapshot.total_ticks) * ticks_to_us /
+                            double(snapshot.call_count));
+    ImGui::NextColumn();
+    ImGui::Text("%.3f",
+                double(snapshot.GetPercentileTicks(50.0)) * ticks_to_us);
+    ImGui::NextColumn();
+    ImGui::Text("%.3f",
+                double(snapshot.GetPercentileTicks(99.0)) * ticks_to_us);
+    ImGui::NextColumn();
+    ImGui::Text("%.3f", double(snapshot.max_ticks) * ticks_to_us);
+    ImGui::NextColumn();
+  }
+  ImGui::Columns(1);
+  ImGui::EndChild();
+}
+
+void DebugWindow::DrawHeapUsage(const HeapUsageReport& report,
+                                bool is_physical) {
+  uint32_t page_count = report.heap_size / report.page_size;
+  char heap_label[64];
+  std::snprintf(heap_label, xe::countof(heap_label), "%.8X-%.8X%s",
+                report.heap_base, report.heap_base + (report.heap_size - 1),
+                is_physical ? " physical" : "");
+  ImGui::PushID(heap_label);
+  if (!ImGui::CollapsingHeader(heap_label)) {
+    ImGui::PopID();
+    return;
+  }
+  ImGui::Indent();
+  ImGui::Text("%u regions, %u/%u pages reserved, %u committed (%.4X pages)",
+              report.region_count, report.reserved_page_count, page_count,
+              report.committed_page_count, report.page_size);
+  ImGui::Text("%u unreserved ranges, largest %u pages, %.1f%% fragmented",
+              report.unreserved_range_count,
+              report.largest_unreserved_range_page_count,
+              report.fragmentation() * 100.0f);
+
+  // Heatmap: green for committed pages, red for watch faults, relative to the
+  // cell with the most.
+  uint32_t max_fault_count = 1;
+  for (uint32_t fault_count : report.watch_fault_heatmap) {
+    max_fault_count = std::max(max_fault_count, fault_count);
+  }
+  const uint32_t cell_count = HeapUsageReport::kHeatmapCellCount;
+  float cell_width =
+      std::max(ImGui::GetContentRegionAvail().x / float(cell_count), 1.0f);
+  const float cell_height = 16.0f;
+  ImVec2 heatmap_origin = ImGui::GetCursorScreenPos();
+  ImDrawList* draw_list = ImGui::GetWindowDrawList();
+  for (uint32_t i = 0; i < cell_count; ++i) {
+    uint32_t cell_first_page =
+        uint32_t((uint64_t(i) * page_count + cell_count - 1) / cell_count);
+    uint32_t cell_end_page = uint32_t(
+        (uint64_t(i + 1) * page_count + cell_count - 1) / cell_count);
+    uint32_t cell_page_count = cell_end_page - cell_first_page;
+    float committed = cell_page_count
+                          ? float(report.committed_page_heatmap[i]) /
+                                float(cell_page_count)
+                          : 0.0f;
+    float faults =
+        float(report.watch_fault_heatmap[i]) / float(max_fault_count);
+    ImVec2 cell_min(heatmap_origin.x + i * cell_width, heatmap_origin.y);
+    ImVec2 cell_max(cell_min.x + cell_width, cell_min.y + cell_height);
+    float green = 0.2f + 0.6f * committed * (1.0f - faults);
+    draw_list->AddRectFilled(
+        cell_min, cell_max,
+        ImGui::GetColorU32(ImVec4(faults, green, 0.2f, 1.0f)));
+  }
+  ImGui::InvisibleButton("##heatmap",
+                         ImVec2(cell_width * cell_count, cell_height));
+  if (ImGui::IsItemHovered()) {
+    uint32_t i = uint32_t(
+        (ImGui::GetIO().MousePos.x - heatmap_origin.x) / cell_width);
+    i = std::min(i, cell_count - 1);
+    uint32_t cell_size = report.heap_size / cell_count;
+    ImGui::SetTooltip("%.8X-%.8X\n%u committed pages\n%u watch faults",
+                      report.heap_base + i * cell_size,
+                      report.heap_base + (i + 1) * cell_size - 1,
+                      report.committed_page_heatmap[i],
+                      report.watch_fault_heatmap[i]);
+  }
+
+  if (!report.callers.empty() &&
+      ImGui::TreeNode("callers", "Allocating guest code (%u)",
+                      uint32_t(report.callers.size()))) {
+    for (const HeapUsageReport::Caller& caller : report.callers) {
+      ImGui::Text("lr=%.8X %6u regions %12" PRIu64 " bytes", caller.guest_lr,
+                  caller.region_count, caller.size);
+    }
+    ImGui::TreePop();
+  }
+  if (!report.watch_fault_ranges.empty() &&
+      ImGui::TreeNode("watch_faults", "Most watch faults")) {
+    for (const HeapUsageReport::WatchFaultRange& range :
+         report.watch_fault_ranges) {
+      ImGui::Text("%.8X-%.8X %10u faults", range.address,
+                  range.address + (range.length - 1), range.fault_count);
+    }
+    ImGui::TreePop();
+  }
+  ImGui::Unindent();
+  ImGui::PopID();
 }
 
 void DebugWindow::DrawBreakpointsPane() {
@@ -1159,6 +1366,10 @@ void DebugWindow::DrawBreakpointsPane() {
       ImGui::SetKeyboardFocusHere();
     }
     static char ppc_buffer[32] = {0};
+    // Conditional breakpoints and tracepoints are checked by the generated
+    // code, only stopping when the condition passes.
+    static char ppc_condition_buffer[32] = {0};
+    static bool ppc_is_tracepoint = false;
     ImGuiInputTextFlags input_flags = ImGuiInputTextFlags_CharsUppercase |
                                       ImGuiInputTextFlags_CharsNoBlank |
                                       ImGuiInputTextFlags_CharsHexadecimal |
@@ -1168,11 +1379,35 @@ void DebugWindow::DrawBreakpointsPane() {
     ImGui::PushItemWidth(50);
     if (ImGui::InputText("##guest_address", ppc_buffer, 9, input_flags)) {
       uint32_t address = string_util::from_string<uint32_t>(ppc_buffer, true);
-      ppc_buffer[0] = 0;
-      CreateCodeBreakpoint(Breakpoint::AddressType::kGuest, address);
-      ImGui::CloseCurrentPopup();
+      cpu::BreakpointCondition condition;
+      if (cpu::BreakpointCondition::Parse(ppc_condition_buffer, condition)) {
+        ppc_buffer[0] = 0;
+        if (condition.gpr >= 0 || ppc_is_tracepoint) {
+          CreateCodeBreakpoint(address, condition, ppc_is_tracepoint);
+        } else {
+          CreateCodeBreakpoint(Breakpoint::AddressType::kGuest, address);
+        }
+        ImGui::CloseCurrentPopup();
+      }
     }
     ImGui::PopItemWidth();
+    ImGui::SameLine();
+    ImGui::PushItemWidth(120);
+    ImGui::InputText("##guest_condition", ppc_condition_buffer,
+                     sizeof(ppc_condition_buffer));
+    ImGui::PopItemWidth();
+    if (ImGui::IsItemHovered()) {
+      ImGui::SetTooltip(
+          "Optional condition, like \"r3 eq 1234\" (hexadecimal, compared "
+          "in 64 bits if longer than 8 digits). Operators: eq, ne, slt, sle, "
+          "sgt, sge, ult, ule, ugt, uge.");
+    }
+    ImGui::SameLine();
+    ImGui::Checkbox("Trace", &ppc_is_tracepoint);
+    if (ImGui::IsItemHovered()) {
+      ImGui::SetTooltip(
+          "Record the registers without stopping when the condition passes.");
+    }
     ImGui::Dummy(ImVec2(0, 2));
 
     ImGui::AlignTextToFramePadding();
@@ -1346,8 +1581,12 @@ void DebugWindow::DrawBreakpointsPane() {
       ImGui::SameLine();
       auto breakpoint_str = breakpoint->to_string();
       bool is_selected = false;  // in function/stopped on line?
-      if (ImGui::Selectable(breakpoint_str.c_str(), &is_selected,
-                            ImGuiSelectableFlags_SpanAllColumns)) {
+      bool is_clicked = ImGui::Selectable(breakpoint_str.c_str(), &is_selected,
+                                          ImGuiSelectableFlags_SpanAllColumns);
+      if (breakpoint->is_compiled() && ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Passed %" PRIu64 " times", breakpoint->hit_count());
+      }
+      if (is_clicked) {
         auto function = breakpoint->guest_function();
         assert_not_null(function);
         if (breakpoint->address_type() == Breakpoint::AddressType::kGuest) {
@@ -1405,6 +1644,9 @@ void DebugWindow::SelectThreadStackFrame(cpu::ThreadDebugInfo* thread_info,
     state_.has_changed_thread = true;
     state_.thread_info = thread_info;
   }
+  if (state_.thread_info && !cache_.is_running) {
+    processor_->UpdateThreadExecutionState(state_.thread_info->thread_id);
+  }
   if (state_.thread_info) {
     stack_frame_index =
         std::min(state_.thread_info->frames.size() - 1, stack_frame_index);
@@ -1476,6 +1718,8 @@ void DebugWindow::UpdateCache() {
 
   cache_.thread_debug_infos = processor_->QueryThreadDebugInfos();
 
+  cache_.heap_usage_reports = emulator_->memory()->GetHeapUsageReports();
+
   SelectThreadStackFrame(state_.thread_info, state_.thread_stack_frame_index,
                          false);
 }
@@ -1510,6 +1754,26 @@ void DebugWindow::CreateCodeBreakpoint(Breakpoint::AddressType address_type,
   state.all_breakpoints.emplace_back(std::move(breakpoint));
 }
 
+void DebugWindow::CreateCodeBreakpoint(
+    uint32_t guest_address, const cpu::BreakpointCondition& condition,
+    bool is_tracepoint) {
+  auto& state = state_.breakpoints;
+  auto& map = state.code_breakpoints_by_guest_address;
+  if (map.find(guest_address) != map.end()) {
+    // Already exists!
+    return;
+  }
+  auto breakpoint = std::make_unique<Breakpoint>(
+      processor_, guest_address, condition, is_tracepoint,
+      [this](Breakpoint* breakpoint, cpu::ThreadDebugInfo* thread_info,
+             uint64_t host_address) {
+        OnBreakpointHit(breakpoint, thread_info);
+      });
+  map.emplace(guest_address, breakpoint.get());
+  processor_->AddBreakpoint(breakpoint.get());
+  state.all_breakpoints.emplace_back(std::move(breakpoint));
+}
+
 void DebugWindow::DeleteCodeBreakpoint(Breakpoint* breakpoint) {
   auto& state = state_.breakpoints;
   for (size_t i = 0; i < state.all_breakpoints.size(); ++i) {
@@ -1588,6 +1852,10 @@ void DebugWindow::OnBreakpointHit(Breakpoint* breakpoint,
   Focus();
 }
 
+void DebugWindow::OnThreadStateChanged(cpu::ThreadDebugInfo* thread_info) {
+  thread_list_changed_.store(true, std::memory_order_relaxed);
+}
+
 void DebugWindow::Focus() const {
   app_context_.CallInUIThread([this]() { window_->Focus(); });
 }
@@ -10,6 +10,7 @@
 #ifndef XENIA_DEBUG_UI_DEBUG_WINDOW_H_
 #define XENIA_DEBUG_UI_DEBUG_WINDOW_H_
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -18,6 +19,7 @@
 #include "xenia/cpu/debug_listener.h"
 #include "xenia/cpu/processor.h"
 #include "xenia/emulator.h"
+#include "xenia/memory.h"
 #include "xenia/ui/imgui_dialog.h"
 #include "xenia/ui/imgui_drawer.h"
 #include "xenia/ui/immediate_drawer.h"
@@ -50,6 +52,7 @@ class DebugWindow : public cpu::DebugListener {
   void OnStepCompleted(cpu::ThreadDebugInfo* thread_info) override;
   void OnBreakpointHit(cpu::Breakpoint* breakpoint,
                        cpu::ThreadDebugInfo* thread_info) override;
+  void OnThreadStateChanged(cpu::ThreadDebugInfo* thread_info) override;
 
  private:
   class DebugDialog final : public xe::ui::ImGuiDialog {
@@ -86,6 +89,8 @@ class DebugWindow : public cpu::DebugListener {
   bool DrawRegisterTextBoxes(int id, float* value);
   void DrawThreadsPane();
   void DrawMemoryPane();
+  void DrawHeapUsage(const HeapUsageReport& report, bool is_physical);
+  void DrawKernelCallsPane();
   void DrawBreakpointsPane();
   void DrawLogPane();
 
@@ -100,6 +105,10 @@ class DebugWindow : public cpu::DebugListener {
 
   void CreateCodeBreakpoint(cpu::Breakpoint::AddressType address_type,
                             uint64_t address);
+  // A conditional guest breakpoint or a tracepoint.
+  void CreateCodeBreakpoint(uint32_t guest_address,
+                            const cpu::BreakpointCondition& condition,
+                            bool is_tracepoint);
   void DeleteCodeBreakpoint(cpu::Breakpoint* breakpoint);
   cpu::Breakpoint* LookupBreakpointAtAddress(
       cpu::Breakpoint::AddressType address_type, uint64_t address);
@@ -124,7 +133,11 @@ class DebugWindow : public cpu::DebugListener {
     bool is_running = false;
     std::vector<kernel::object_ref<kernel::XModule>> modules;
     std::vector<cpu::ThreadDebugInfo*> thread_debug_infos;
+    std::vector<HeapUsageReport> heap_usage_reports;
   } cache_;
+  // Set when threads are created or change their state, to refresh the thread
+  // list on the next frame, also while running, without a full update.
+  std::atomic<bool> thread_list_changed_ = {false};
 
   enum class RegisterGroup {
     kGuestGeneral,
@@ -139,6 +152,7 @@ class DebugWindow : public cpu::DebugListener {
   struct ImState {
     static const int kRightPaneThreads = 0;
     static const int kRightPaneMemory = 1;
+    static const int kRightPaneKernelCalls = 2;
     int right_pane_tab = kRightPaneThreads;
 
     cpu::ThreadDebugInfo* thread_info = nullptr;
@@ -26,6 +26,7 @@
 #include "xenia/base/mapped_memory.h"
 #include "xenia/base/platform.h"
 #include "xenia/base/string.h"
+#include "xenia/base/threading.h"
 #include "xenia/cpu/backend/code_cache.h"
 #include "xenia/cpu/backend/null_backend.h"
 #include "xenia/cpu/cpu_flags.h"
@@ -45,6 +46,7 @@
 #include "xenia/ui/imgui_drawer.h"
 #include "xenia/ui/window.h"
 #include "xenia/ui/windowed_app_context.h"
+#include "xenia/vfs/devices/compressed_disc_image_device.h"
 #include "xenia/vfs/devices/disc_image_device.h"
 #include "xenia/vfs/devices/host_path_device.h"
 #include "xenia/vfs/devices/null_device.h"
@@ -108,6 +110,8 @@ Emulator::Emulator(const std::filesystem::path& command_line,
       restore_fence_() {}
 
 Emulator::~Emulator() {
+  WaitForSaveToFile();
+
   // Note that we delete things in the reverse order they were initialized.
 
   // Give the systems time to shutdown before we delete them.
@@ -167,6 +171,36 @@ X_STATUS Emulator::Setup(
   // Shared export resolver used to attach and query for HLE exports.
   export_resolver_ = std::make_unique<xe::cpu::ExportResolver>();
 
+  // Initialize the GPU.
+  graphics_system_ = graphics_system_factory();
+  if (!graphics_system_) {
+    return X_STATUS_NOT_IMPLEMENTED;
+  }
+
+  // Creating the host GPU device and setting up the input drivers don't
+  // depend on the guest-side subsystems, but take a significant time, so they
+  // are done in parallel with the CPU initialization. The group is waited for
+  // on early returns too, so the tasks may reference the local variables.
+  X_STATUS input_result = X_STATUS_UNSUCCESSFUL;
+  xe::threading::TaskScheduler::TaskGroup setup_tasks;
+  setup_tasks.Run([this]() {
+    graphics_system_->InitializeProvider(display_window_ != nullptr);
+  });
+  setup_tasks.Run([this, &input_driver_factory, &input_result]() {
+    // Initialize the HID.
+    input_system_ = std::make_unique<xe::hid::InputSystem>(display_window_);
+    if (input_driver_factory) {
+      auto input_drivers = input_driver_factory(display_window_);
+      for (size_t i = 0; i < input_drivers.size(); ++i) {
+        auto& input_driver = input_drivers[i];
+        input_driver->set_is_active_callback(
+            []() -> bool { return !xe::kernel::xam::xeXamIsUIActive(); });
+        input_system_->AddDriver(std::move(input_driver));
+      }
+    }
+    input_result = input_system_->Setup();
+  });
+
   std::unique_ptr<xe::cpu::backend::Backend> backend;
 #if XE_ARCH_AMD64
   if (cvars::cpu == "x64") {
@@ -180,7 +214,15 @@ X_STATUS Emulator::Setup(
 #endif  // XE_ARCH
     }
   }
-  if (!backend && !require_cpu_backend) {
+  if (!backend) {
+    if (require_cpu_backend) {
+      // No JIT exists yet for hosts other than x86-64 (such as AArch64 on
+      // Android), so guest code can't be executed on them.
+      XELOGE(
+          "No CPU backend is available for the host architecture with --cpu={}",
+          cvars::cpu);
+      return X_STATUS_NOT_IMPLEMENTED;
+    }
     backend.reset(new xe::cpu::backend::NullBackend());
   }
 
@@ -199,30 +241,9 @@ X_STATUS Emulator::Setup(
     }
   }
 
-  // Initialize the GPU.
-  graphics_system_ = graphics_system_factory();
-  if (!graphics_system_) {
-    return X_STATUS_NOT_IMPLEMENTED;
-  }
-
-  // Initialize the HID.
-  input_system_ = std::make_unique<xe::hid::InputSystem>(display_window_);
-  if (!input_system_) {
-    return X_STATUS_NOT_IMPLEMENTED;
-  }
-  if (input_driver_factory) {
-    auto input_drivers = input_driver_factory(display_window_);
-    for (size_t i = 0; i < input_drivers.size(); ++i) {
-      auto& input_driver = input_drivers[i];
-      input_driver->set_is_active_callback(
-          []() -> bool { return !xe::kernel::xam::xeXamIsUIActive(); });
-      input_system_->AddDriver(std::move(input_driver));
-    }
-  }
-
-  result = input_system_->Setup();
-  if (result) {
-    return result;
+  setup_tasks.Wait();
+  if (input_result) {
+    return input_result;
   }
 
   // Bring up the virtual filesystem used by the kernel.
@@ -266,7 +287,10 @@ X_STATUS Emulator::TerminateTitle() {
     return X_STATUS_UNSUCCESSFUL;
   }
 
+  memory_->LogHostNumaResidency();
   kernel_state_->TerminateTitle();
+  processor_->backend()->ShutdownCodeStorage();
+  storage_title_id_ = std::nullopt;
   title_id_ = std::nullopt;
   title_name_ = "";
   title_version_ = "";
@@ -309,10 +333,12 @@ X_STATUS Emulator::LaunchXexFile(const std::filesystem::path& path) {
     XELOGE("Unable to scan host path");
     return X_STATUS_NO_SUCH_FILE;
   }
+  vfs::Device* launch_device = device.get();
   if (!file_system_->RegisterDevice(std::move(device))) {
     XELOGE("Unable to register host path");
     return X_STATUS_NO_SUCH_FILE;
   }
+  launch_device_ = launch_device;
 
   // Create symlinks to the device.
   file_system_->RegisterSymbolicLink("game:", mount_path);
@@ -330,15 +356,23 @@ X_STATUS Emulator::LaunchDiscImage(const std::filesystem::path& path) {
   auto mount_path = "\\Device\\Cdrom0";
 
   // Register the disc image in the virtual filesystem.
-  auto device = std::make_unique<vfs::DiscImageDevice>(mount_path, path);
+  std::unique_ptr<vfs::Device> device;
+  if (vfs::CompressedDiscImage::IsCompressedDiscImage(path)) {
+    device =
+        std::make_unique<vfs::CompressedDiscImageDevice>(mount_path, path);
+  } else {
+    device = std::make_unique<vfs::DiscImageDevice>(mount_path, path);
+  }
   if (!device->Initialize()) {
     xe::FatalError("Unable to mount disc image; file not found or corrupt.");
     return X_STATUS_NO_SUCH_FILE;
   }
+  vfs::Device* launch_device = device.get();
   if (!file_system_->RegisterDevice(std::move(device))) {
     xe::FatalError("Unable to register disc image.");
     return X_STATUS_NO_SUCH_FILE;
   }
+  launch_device_ = launch_device;
 
   // Create symlinks to the device.
   file_system_->RegisterSymbolicLink("game:", mount_path);
@@ -359,10 +393,12 @@ X_STATUS Emulator::LaunchStfsContainer(const std::filesystem::path& path) {
         "Unable to mount STFS container; file not found or corrupt.");
     return X_STATUS_NO_SUCH_FILE;
   }
+  vfs::Device* launch_device = device.get();
   if (!file_system_->RegisterDevice(std::move(device))) {
     xe::FatalError("Unable to register STFS container.");
     return X_STATUS_NO_SUCH_FILE;
   }
+  launch_device_ = launch_device;
 
   file_system_->RegisterSymbolicLink("game:", mount_path);
   file_system_->RegisterSymbolicLink("d:", mount_path);
@@ -429,11 +465,15 @@ void Emulator::Resume() {
 }
 
 bool Emulator::SaveToFile(const std::filesystem::path& path) {
+  // Only one state is written at a time.
+  WaitForSaveToFile();
+
   Pause();
 
   filesystem::CreateEmptyFile(path);
   auto map = MappedMemory::Open(path, MappedMemory::Mode::kReadWrite, 0, 2_GiB);
   if (!map) {
+    Resume();
     return false;
   }
 
@@ -451,14 +491,35 @@ bool Emulator::SaveToFile(const std::filesystem::path& path) {
   graphics_system_->Save(&stream);
   audio_system_->Save(&stream);
   kernel_state_->Save(&stream);
-  memory_->Save(&stream);
-  map->Close(stream.offset());
+  std::vector<HeapSnapshot> memory_snapshot = memory_->TakeSnapshot();
 
   Resume();
+
+  // Compressing the memory takes most of the time, so it's done while the
+  // emulation is running.
+  save_thread_ = std::thread([map = std::move(map), offset = stream.offset(),
+                              memory_snapshot = std::move(memory_snapshot),
+                              path]() {
+    ByteStream memory_stream(map->data(), map->size(), offset);
+    if (Memory::WriteSnapshot(memory_snapshot, &memory_stream)) {
+      XELOGI("Saved the state to {}", xe::path_to_utf8(path));
+    } else {
+      XELOGE("Could not save memory to {}", xe::path_to_utf8(path));
+    }
+    map->Close(memory_stream.offset());
+  });
   return true;
 }
 
+void Emulator::WaitForSaveToFile() {
+  if (save_thread_.joinable()) {
+    save_thread_.join();
+  }
+}
+
 bool Emulator::RestoreFromFile(const std::filesystem::path& path) {
+  WaitForSaveToFile();
+
   // Restore the emulator state from a file
   auto map = MappedMemory::Open(path, MappedMemory::Mode::kReadWrite);
   if (!map) {
@@ -781,7 +842,6 @@ X_STATUS Emulator::CompleteLaunch(const std::filesystem::path& path,
     }
   }
 
-  // Try and load the resource database (xex only).
   if (module->title_id()) {
     auto title_id = fmt::format("{:08X}", module->title_id());
 
@@ -796,7 +856,44 @@ X_STATUS Emulator::CompleteLaunch(const std::filesystem::path& path,
           ->PostGameConfigLoad();
     }
     game_config_load_callback_loop_next_index_ = SIZE_MAX;
+  }
+
+  // Prefetch the data read while booting the title last time, in parallel
+  // with the shader storage initialization, and record the reads for the next
+  // launches.
+  if (launch_device_ && title_id_.value()) {
+    launch_device_->BeginBootReadRecording(
+        cache_root_ / "boot_prefetch" /
+        fmt::format("{:08X}.bin", title_id_.value()));
+  }
 
+  // A title launching another executable of its own (multi-disc games,
+  // launchers) keeps the code and the shader storages open, and the code,
+  // shaders and pipelines already loaded from them in the caches, rather than
+  // loading them again.
+  bool storage_reused = storage_title_id_ == title_id_;
+  if (storage_reused) {
+    XELOGI("Keeping the code and shader storages of title {:08X}",
+           title_id_.value());
+  }
+
+  // Initializing the shader storage in a blocking way so the user doesn't miss
+  // the initial seconds - for instance, sound from an intro video may start
+  // playing before the video can be seen if doing this in parallel with the
+  // main thread. However, it's started as soon as the title ID and the game
+  // configuration are known, and the rest of the launch preparation that
+  // doesn't depend on it is done meanwhile.
+  xe::threading::TaskScheduler::TaskGroup shader_storage_task;
+  if (!storage_reused) {
+    on_shader_storage_initialization(true);
+    shader_storage_task.Run([this]() {
+      graphics_system_->InitializeShaderStorage(cache_root_, title_id_.value(),
+                                                true);
+    });
+  }
+
+  // Try and load the resource database (xex only).
+  if (module->title_id()) {
     const kernel::util::XdbfGameData db = kernel_state_->module_xdbf(module);
     if (db.is_valid()) {
       XLanguage language =
@@ -806,13 +903,14 @@ X_STATUS Emulator::CompleteLaunch(const std::filesystem::path& path,
       XELOGI("-------------------- ACHIEVEMENTS --------------------");
       const std::vector<kernel::util::XdbfAchievementTableEntry>
           achievement_list = db.GetAchievements();
-      for (const kernel::util::XdbfAchievementTableEntry& entry :
-           achievement_list) {
-        std::string label = db.GetStringTableEntry(language, entry.label_id);
-        std::string desc =
-            db.GetStringTableEntry(language, entry.description_id);
-
-        XELOGI("{} - {} - {} - {}", entry.id, label, desc, entry.gamerscore);
+      if (!achievement_list.empty()) {
+        const kernel::util::XdbfStringTable strings =
+            db.GetStringTable(language);
+        for (const kernel::util::XdbfAchievementTableEntry& entry :
+             achievement_list) {
+          XELOGI("{} - {} - {} - {}", entry.id, strings.Get(entry.label_id),
+                 strings.Get(entry.description_id), entry.gamerscore);
+        }
       }
       XELOGI("----------------- END OF ACHIEVEMENTS ----------------");
 
@@ -823,14 +921,14 @@ X_STATUS Emulator::CompleteLaunch(const std::filesystem::path& path,
     }
   }
 
-  // Initializing the shader storage in a blocking way so the user doesn't miss
-  // the initial seconds - for instance, sound from an intro video may start
-  // playing before the video can be seen if doing this in parallel with the
-  // main thread.
-  on_shader_storage_initialization(true);
-  graphics_system_->InitializeShaderStorage(cache_root_, title_id_.value(),
-                                            true);
-  on_shader_storage_initialization(false);
+  processor_->LoadRoutineSignatures();
+  if (!storage_reused) {
+    processor_->backend()->InitializeCodeStorage(cache_root_,
+                                                 title_id_.value());
+    shader_storage_task.Wait();
+    on_shader_storage_initialization(false);
+    storage_title_id_ = title_id_;
+  }
 
   auto main_thread = kernel_state_->LaunchModule(module);
   if (!main_thread) {
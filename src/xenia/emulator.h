@@ -15,6 +15,7 @@
 #include <functional>
 #include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "xenia/base/delegate.h"
@@ -48,7 +49,8 @@ class Window;
 
 namespace xe {
 
-constexpr fourcc_t kEmulatorSaveSignature = make_fourcc("XSAV");
+// Changed with the compressed memory snapshot format.
+constexpr fourcc_t kEmulatorSaveSignature = make_fourcc("XSV2");
 
 // The main type that runs the whole emulator.
 // This is responsible for initializing and managing all the various subsystems.
@@ -191,7 +193,11 @@ class Emulator {
   void Resume();
   bool is_paused() const { return paused_; }
 
+  // The guest memory is compressed and written to the file in the background
+  // after the emulation has been resumed.
   bool SaveToFile(const std::filesystem::path& path);
+  // Waits until the state from the latest SaveToFile has been fully written.
+  void WaitForSaveToFile();
   bool RestoreFromFile(const std::filesystem::path& path);
 
   // The game can request another title to be loaded.
@@ -238,6 +244,8 @@ class Emulator {
 
   std::unique_ptr<cpu::ExportResolver> export_resolver_;
   std::unique_ptr<vfs::VirtualFileSystem> file_system_;
+  // Device the title was launched from, owned by the file system.
+  vfs::Device* launch_device_ = nullptr;
 
   std::unique_ptr<kernel::KernelState> kernel_state_;
 
@@ -252,10 +260,13 @@ class Emulator {
 
   kernel::object_ref<kernel::XThread> main_thread_;
   std::optional<uint32_t> title_id_;  // Currently running title ID
+  // Title ID the code and the shader storages have been initialized for.
+  std::optional<uint32_t> storage_title_id_;
 
   bool paused_;
   bool restoring_;
   threading::Fence restore_fence_;  // Fired on restore finish.
+  std::thread save_thread_;  // Writing the memory of the latest save state.
 };
 
 }  // namespace xe
@@ -16,8 +16,10 @@
 
 #include "third_party/fmt/include/fmt/format.h"
 #include "xenia/base/byte_stream.h"
+#include "xenia/base/clock.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
+#include "xenia/base/memory.h"
 #include "xenia/base/profiling.h"
 #include "xenia/base/ring_buffer.h"
 #include "xenia/gpu/gpu_flags.h"
@@ -33,6 +35,26 @@ namespace gpu {
 
 using namespace xe::gpu::xenos;
 
+namespace {
+// Returns the last register of the shader constant type containing the
+// register, or UINT32_MAX if it's not a shader constant.
+uint32_t GetShaderConstantTypeLastRegister(uint32_t index) {
+  if (index >= XE_GPU_REG_SHADER_CONSTANT_000_X &&
+      index <= XE_GPU_REG_SHADER_CONSTANT_511_W) {
+    return XE_GPU_REG_SHADER_CONSTANT_511_W;
+  }
+  if (index >= XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0 &&
+      index <= XE_GPU_REG_SHADER_CONSTANT_FETCH_31_5) {
+    return XE_GPU_REG_SHADER_CONSTANT_FETCH_31_5;
+  }
+  if (index >= XE_GPU_REG_SHADER_CONSTANT_BOOL_000_031 &&
+      index <= XE_GPU_REG_SHADER_CONSTANT_LOOP_31) {
+    return XE_GPU_REG_SHADER_CONSTANT_LOOP_31;
+  }
+  return UINT32_MAX;
+}
+}  // namespace
+
 CommandProcessor::CommandProcessor(GraphicsSystem* graphics_system,
                                    kernel::KernelState* kernel_state)
     : memory_(graphics_system->memory()),
@@ -41,10 +63,7 @@ CommandProcessor::CommandProcessor(GraphicsSystem* graphics_system,
       register_file_(graphics_system_->register_file()),
       trace_writer_(graphics_system->memory()->physical_membase()),
       worker_running_(true),
-      write_ptr_index_event_(xe::threading::Event::CreateAutoResetEvent(false)),
-      write_ptr_index_(0) {
-  assert_not_null(write_ptr_index_event_);
-}
+      write_ptr_index_(0) {}
 
 CommandProcessor::~CommandProcessor() = default;
 
@@ -76,6 +95,9 @@ bool CommandProcessor::Initialize() {
       }));
   worker_thread_->set_name("GPU Commands");
   worker_thread_->Create();
+  kernel_state_->host_processor_map().ApplyHostThreadAffinity(
+      worker_thread_->thread(),
+      kernel::util::HostProcessorMap::HostThread::kGpuCommandProcessor);
 
   return true;
 }
@@ -84,9 +106,20 @@ void CommandProcessor::Shutdown() {
   EndTracing();
 
   worker_running_ = false;
-  write_ptr_index_event_->Set();
+  worker_waiter_.Wake();
   worker_thread_->Wait(0, 0, 0, nullptr);
   worker_thread_.reset();
+
+  xe::threading::AdaptiveWaiter::Stats worker_stats = worker_waiter_.stats();
+  uint64_t worker_total_ticks =
+      std::max(worker_stats.total_ticks(), uint64_t(1));
+  XELOGI(
+      "GPU command processor thread: {:.1f}% busy, {:.1f}% spinning, {:.1f}% "
+      "blocked, {} waits ended while spinning, {} while blocked",
+      100.0 * worker_stats.busy_ticks / worker_total_ticks,
+      100.0 * worker_stats.spin_ticks / worker_total_ticks,
+      100.0 * worker_stats.block_ticks / worker_total_ticks,
+      worker_stats.spin_wait_count, worker_stats.block_wait_count);
 }
 
 void CommandProcessor::InitializeShaderStorage(
@@ -95,6 +128,11 @@ void CommandProcessor::InitializeShaderStorage(
 
 void CommandProcessor::RequestFrameTrace(
     const std::filesystem::path& root_path) {
+  if (trace_state_ == TraceState::kRing) {
+    // Write the frames already captured instead of waiting for the next one.
+    trace_ring_dump_requested_ = true;
+    return;
+  }
   if (trace_state_ == TraceState::kStreaming) {
     XELOGE("Streaming trace; cannot also trace frame.");
     return;
@@ -116,16 +154,33 @@ void CommandProcessor::BeginTracing(const std::filesystem::path& root_path) {
     XELOGE("Frame trace pending; ignoring streaming request.");
     return;
   }
+  if (trace_state_ == TraceState::kRing) {
+    XELOGE("Ring trace active; ignoring streaming request.");
+    return;
+  }
   // Streaming starts on the next primary buffer execute.
   trace_state_ = TraceState::kStreaming;
   trace_stream_path_ = root_path;
 }
 
+void CommandProcessor::BeginRingTracing(const std::filesystem::path& root_path,
+                                        uint32_t segment_frames) {
+  if (trace_state_ != TraceState::kDisabled) {
+    XELOGE("Tracing already active; ignoring ring trace request.");
+    return;
+  }
+  // The ring starts on the next swap.
+  trace_state_ = TraceState::kRing;
+  trace_ring_path_ = root_path;
+  trace_ring_segment_frames_ = std::max(segment_frames, uint32_t(1));
+}
+
 void CommandProcessor::EndTracing() {
   if (!trace_writer_.is_open()) {
     return;
   }
-  assert_true(trace_state_ == TraceState::kStreaming);
+  assert_true(trace_state_ == TraceState::kStreaming ||
+              trace_state_ == TraceState::kRing);
   trace_state_ = TraceState::kDisabled;
   trace_writer_.Close();
 }
@@ -154,6 +209,8 @@ void CommandProcessor::RestoreRegisters(uint32_t first_register,
   } else {
     std::memcpy(register_file_->values + first_register, register_values,
                 sizeof(uint32_t) * register_count);
+    ++draw_state_register_write_count_;
+    ++pipeline_state_register_write_count_;
   }
 }
 
@@ -176,6 +233,7 @@ void CommandProcessor::CallInThread(std::function<void()> fn) {
     fn();
   } else {
     pending_fns_.push(std::move(fn));
+    worker_waiter_.Wake();
   }
 }
 
@@ -208,25 +266,21 @@ void CommandProcessor::WorkerThreadMain() {
     uint32_t write_ptr_index = write_ptr_index_.load();
     if (write_ptr_index == 0xBAADF00D || read_ptr_index_ == write_ptr_index) {
       SCOPE_profile_cpu_i("gpu", "xe::gpu::CommandProcessor::Stall");
-      // We've run out of commands to execute.
-      // We spin here waiting for new ones, as the overhead of waiting on our
-      // event is too high.
+      // We've run out of commands to execute. Waiting for new ones, spinning
+      // for a while first, as the overhead of waiting on an event is high
+      // while commands are being written, but would burn a core between
+      // frames. UpdateWritePointer wakes the thread.
       PrepareForWait();
-      uint32_t loop_count = 0;
-      do {
-        // If we spin around too much, revert to a "low-power" state.
-        if (loop_count > 500) {
-          const int wait_time_ms = 5;
-          xe::threading::Wait(write_ptr_index_event_.get(), true,
-                              std::chrono::milliseconds(wait_time_ms));
-        }
-
-        xe::threading::MaybeYield();
-        loop_count++;
-        write_ptr_index = write_ptr_index_.load();
-      } while (worker_running_ && pending_fns_.empty() &&
-               (write_ptr_index == 0xBAADF00D ||
-                read_ptr_index_ == write_ptr_index));
+      auto has_work = [this]() {
+        uint32_t write_ptr_index = write_ptr_index_.load();
+        return !worker_running_ || !pending_fns_.empty() ||
+               (write_ptr_index != 0xBAADF00D &&
+                read_ptr_index_ != write_ptr_index);
+      };
+      while (!worker_waiter_.Wait(has_work, true,
+                                  std::chrono::milliseconds(100))) {
+      }
+      write_ptr_index = write_ptr_index_.load();
       ReturnFromWait();
       if (!worker_running_ || !pending_fns_.empty()) {
         continue;
@@ -303,7 +357,7 @@ bool CommandProcessor::Restore(ByteStream* stream) {
 
 bool CommandProcessor::SetupContext() { return true; }
 
-void CommandProcessor::ShutdownContext() {}
+void CommandProcessor::ShutdownContext() { ClearShaderAddressCache(); }
 
 void CommandProcessor::InitializeRingBuffer(uint32_t ptr, uint32_t size_log2) {
   read_ptr_index_ = 0;
@@ -324,7 +378,7 @@ void CommandProcessor::EnableReadPointerWriteBack(uint32_t ptr,
 
 void CommandProcessor::UpdateWritePointer(uint32_t value) {
   write_ptr_index_ = value;
-  write_ptr_index_event_->Set();
+  worker_waiter_.Wake();
 }
 
 void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
@@ -334,13 +388,54 @@ void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
     return;
   }
 
+  uint32_t old_value = regs.values[index].u32;
   regs.values[index].u32 = value;
-  if (!regs.GetRegisterInfo(index)) {
+  if (!RegisterFile::IsValidRegister(index)) {
     XELOGW("GPU: Write to unknown register ({:04X} = {:08X})", index, value);
   }
 
-  // Scratch register writeback.
-  if (index >= XE_GPU_REG_SCRATCH_REG0 && index <= XE_GPU_REG_SCRATCH_REG7) {
+  bool is_shader_constant =
+      GetShaderConstantTypeLastRegister(index) != UINT32_MAX;
+  switch (index) {
+    case XE_GPU_REG_VGT_DRAW_INITIATOR:
+      // Written by every draw packet - consecutive draws with the same state
+      // may differ only in the index count (bits 16:31), which is not a part
+      // of the host state.
+      if ((old_value ^ value) & ~UINT32_C(0xFFFF0000)) {
+        ++draw_state_register_write_count_;
+        ++pipeline_state_register_write_count_;
+      }
+      break;
+    case XE_GPU_REG_VGT_DMA_BASE:
+    case XE_GPU_REG_VGT_DMA_SIZE:
+      // The index buffer, written by every indexed draw packet.
+      break;
+    case XE_GPU_REG_PA_SC_SCREEN_SCISSOR_TL:
+    case XE_GPU_REG_PA_SC_SCREEN_SCISSOR_BR:
+    case XE_GPU_REG_PA_SC_WINDOW_OFFSET:
+    case XE_GPU_REG_PA_SC_WINDOW_SCISSOR_TL:
+    case XE_GPU_REG_PA_SC_WINDOW_SCISSOR_BR:
+    case XE_GPU_REG_PA_CL_VPORT_XSCALE:
+    case XE_GPU_REG_PA_CL_VPORT_XOFFSET:
+    case XE_GPU_REG_PA_CL_VPORT_YSCALE:
+    case XE_GPU_REG_PA_CL_VPORT_YOFFSET:
+    case XE_GPU_REG_PA_CL_VPORT_ZSCALE:
+    case XE_GPU_REG_PA_CL_VPORT_ZOFFSET:
+      // Viewport and scissor, dynamic rather than pipeline state on the host.
+      ++draw_state_register_write_count_;
+      break;
+    default:
+      if (!is_shader_constant) {
+        ++draw_state_register_write_count_;
+        ++pipeline_state_register_write_count_;
+      }
+  }
+
+  if (is_shader_constant) {
+    OnShaderConstantsWritten(index, 1);
+  } else if (index >= XE_GPU_REG_SCRATCH_REG0 &&
+             index <= XE_GPU_REG_SCRATCH_REG7) {
+    // Scratch register writeback.
     uint32_t scratch_reg = index - XE_GPU_REG_SCRATCH_REG0;
     if ((1 << scratch_reg) & regs.values[XE_GPU_REG_SCRATCH_UMSK].u32) {
       // Enabled - write to address.
@@ -467,6 +562,48 @@ void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
   }
 }
 
+void CommandProcessor::WriteRegistersFromMem(uint32_t start_index,
+                                             const uint32_t* base,
+                                             uint32_t num_registers) {
+  uint32_t i = 0;
+  while (i < num_registers) {
+    uint32_t index = start_index + i;
+    uint32_t constant_type_last = GetShaderConstantTypeLastRegister(index);
+    if (constant_type_last == UINT32_MAX) {
+      WriteRegister(index, xe::load_and_swap<uint32_t>(base + i));
+      ++i;
+      continue;
+    }
+    // Shader constants don't need any common handling, write all of the same
+    // type at once.
+    uint32_t count =
+        std::min(num_registers - i, constant_type_last + 1 - index);
+    xe::copy_and_swap_32_unaligned(&register_file_->values[index], base + i,
+                                   count);
+    OnShaderConstantsWritten(index, count);
+    i += count;
+  }
+}
+
+void CommandProcessor::WriteRegisterRangeFromRing(RingBuffer* ring,
+                                                  uint32_t start_index,
+                                                  uint32_t num_registers) {
+  // The range may wrap around the end of the ring buffer.
+  RingBuffer::ReadRange range =
+      ring->BeginRead(num_registers * sizeof(uint32_t));
+  uint32_t num_registers_first =
+      uint32_t(range.first_length / sizeof(uint32_t));
+  WriteRegistersFromMem(start_index,
+                        reinterpret_cast<const uint32_t*>(range.first),
+                        num_registers_first);
+  if (range.second) {
+    WriteRegistersFromMem(start_index + num_registers_first,
+                          reinterpret_cast<const uint32_t*>(range.second),
+                          uint32_t(range.second_length / sizeof(uint32_t)));
+  }
+  ring->EndRead(range);
+}
+
 void CommandProcessor::MakeCoherent() {
   SCOPE_profile_cpu_f("gpu");
 
@@ -505,7 +642,11 @@ void CommandProcessor::MakeCoherent() {
   status_host.status = 0;
 }
 
-void CommandProcessor::PrepareForWait() { trace_writer_.Flush(); }
+void CommandProcessor::PrepareForWait() {
+  trace_writer_.Flush();
+  // The guest may be waiting for the query results.
+  WriteOcclusionQuerySnapshots(true);
+}
 
 void CommandProcessor::ReturnFromWait() {}
 
@@ -533,6 +674,10 @@ uint32_t CommandProcessor::ExecutePrimaryBuffer(uint32_t read_index,
 
   trace_writer_.WritePrimaryBufferStart(start_ptr, write_index - read_index);
 
+  // With host write tracking, the CPU writes to the watched memory are only
+  // detected here.
+  memory_->TriggerHostWrittenPhysicalMemoryCallbacks();
+
   // Execute commands!
   RingBuffer reader(memory_->TranslatePhysical(primary_buffer_ptr_),
                     primary_buffer_size_);
@@ -632,10 +777,12 @@ bool CommandProcessor::ExecutePacketType0(RingBuffer* reader, uint32_t packet) {
 
   uint32_t base_index = (packet & 0x7FFF);
   uint32_t write_one_reg = (packet >> 15) & 0x1;
-  for (uint32_t m = 0; m < count; m++) {
-    uint32_t reg_data = reader->ReadAndSwap<uint32_t>();
-    uint32_t target_index = write_one_reg ? base_index : base_index + m;
-    WriteRegister(target_index, reg_data);
+  if (write_one_reg) {
+    for (uint32_t m = 0; m < count; m++) {
+      WriteRegister(base_index, reader->ReadAndSwap<uint32_t>());
+    }
+  } else {
+    WriteRegisterRangeFromRing(reader, base_index, count);
   }
 
   trace_writer_.WritePacketEnd();
@@ -836,7 +983,9 @@ bool CommandProcessor::ExecutePacketType3(RingBuffer* reader, uint32_t packet) {
   trace_writer_.WritePacketEnd();
   if (opcode == PM4_XE_SWAP) {
     // End the trace writer frame.
-    if (trace_writer_.is_open()) {
+    if (trace_state_ == TraceState::kRing) {
+      AdvanceTraceRing();
+    } else if (trace_writer_.is_open()) {
       trace_writer_.WriteEvent(EventCommand::Type::kSwap);
       trace_writer_.Flush();
       if (trace_state_ == TraceState::kSingleFrame) {
@@ -863,10 +1012,8 @@ bool CommandProcessor::ExecutePacketType3_ME_INIT(RingBuffer* reader,
                                                   uint32_t packet,
                                                   uint32_t count) {
   // initialize CP's micro-engine
-  me_bin_.clear();
-  for (uint32_t i = 0; i < count; i++) {
-    me_bin_.push_back(reader->ReadAndSwap<uint32_t>());
-  }
+  me_bin_.resize(count);
+  reader->ReadAndSwapSpan(me_bin_.data(), count);
 
   return true;
 }
@@ -886,6 +1033,7 @@ bool CommandProcessor::ExecutePacketType3_INTERRUPT(RingBuffer* reader,
 
   // generate interrupt from the command stream
   uint32_t cpu_mask = reader->ReadAndSwap<uint32_t>();
+  PrepareForCpuSync();
   for (int n = 0; n < 6; n++) {
     if (cpu_mask & (1 << n)) {
       graphics_system_->DispatchInterruptCallback(1, n);
@@ -919,6 +1067,7 @@ bool CommandProcessor::ExecutePacketType3_XE_SWAP(RingBuffer* reader,
   IssueSwap(frontbuffer_ptr, frontbuffer_width, frontbuffer_height);
 
   ++counter_;
+  WriteOcclusionQuerySnapshots(false);
   return true;
 }
 
@@ -1070,6 +1219,7 @@ bool CommandProcessor::ExecutePacketType3_MEM_WRITE(RingBuffer* reader,
                                                     uint32_t packet,
                                                     uint32_t count) {
   uint32_t write_addr = reader->ReadAndSwap<uint32_t>();
+  PrepareForCpuSync();
   for (uint32_t i = 0; i < count - 1; i++) {
     uint32_t write_data = reader->ReadAndSwap<uint32_t>();
 
@@ -1188,6 +1338,7 @@ bool CommandProcessor::ExecutePacketType3_EVENT_WRITE_SHD(RingBuffer* reader,
   auto endianness = static_cast<xenos::Endian>(address & 0x3);
   address &= ~0x3;
   data_value = GpuSwap(data_value, endianness);
+  PrepareForCpuSync();
   xe::store(memory_->TranslatePhysical(address), data_value);
   trace_writer_.WriteMemoryWrite(CpuToGpu(address), 4);
   return true;
@@ -1235,21 +1386,54 @@ bool CommandProcessor::ExecutePacketType3_EVENT_WRITE_ZPD(RingBuffer* reader,
 
   // Occlusion queries:
   // This command is send on query begin and end.
+  uint32_t sample_counts_address =
+      register_file_->values[XE_GPU_REG_RB_SAMPLE_COUNT_ADDR].u32;
+  auto* pSampleCounts =
+      memory_->TranslatePhysical<xe_gpu_depth_sample_counts*>(
+          sample_counts_address);
+  // 0xFFFFFEED is written to this two locations by D3D only on D3DISSUE_END
+  // and used to detect a finished query.
+  bool is_end_via_z_pass = pSampleCounts->ZPass_A == kQueryFinished &&
+                           pSampleCounts->ZPass_B == kQueryFinished;
+  // Older versions of D3D also checks for ZFail (4D5307D5).
+  bool is_end_via_z_fail = pSampleCounts->ZFail_A == kQueryFinished &&
+                           pSampleCounts->ZFail_B == kQueryFinished;
+  bool is_end = is_end_via_z_pass || is_end_via_z_fail;
+
+  if (cvars::query_occlusion_host && IsOcclusionQueryHostSupported()) {
+    // Stop counting for the previous snapshot.
+    if (occlusion_query_host_active_) {
+      EndOcclusionQuery();
+      occlusion_query_host_active_ = false;
+      ++occlusion_queries_host_ended_;
+    }
+    if (is_end) {
+      if (occlusion_queries_guest_active_) {
+        --occlusion_queries_guest_active_;
+      }
+    } else {
+      ++occlusion_queries_guest_active_;
+    }
+    OcclusionQuerySnapshot& snapshot =
+        occlusion_query_snapshots_.emplace_back();
+    snapshot.address = sample_counts_address;
+    snapshot.queries_before = occlusion_queries_host_ended_;
+    snapshot.frame = counter_;
+    // The samples outside guest queries don't affect the differences between
+    // the snapshots the guest calculates, no need to count them.
+    if (occlusion_queries_guest_active_) {
+      occlusion_query_host_active_ = BeginOcclusionQuery();
+    }
+    WriteOcclusionQuerySnapshots(
+        is_end && !cvars::query_occlusion_latency_frames);
+    return true;
+  }
+
   // As a workaround report some fixed amount of passed samples.
   auto fake_sample_count = cvars::query_occlusion_fake_sample_count;
   if (fake_sample_count >= 0) {
-    auto* pSampleCounts =
-        memory_->TranslatePhysical<xe_gpu_depth_sample_counts*>(
-            register_file_->values[XE_GPU_REG_RB_SAMPLE_COUNT_ADDR].u32);
-    // 0xFFFFFEED is written to this two locations by D3D only on D3DISSUE_END
-    // and used to detect a finished query.
-    bool is_end_via_z_pass = pSampleCounts->ZPass_A == kQueryFinished &&
-                             pSampleCounts->ZPass_B == kQueryFinished;
-    // Older versions of D3D also checks for ZFail (4D5307D5).
-    bool is_end_via_z_fail = pSampleCounts->ZFail_A == kQueryFinished &&
-                             pSampleCounts->ZFail_B == kQueryFinished;
     std::memset(pSampleCounts, 0, sizeof(xe_gpu_depth_sample_counts));
-    if (is_end_via_z_pass || is_end_via_z_fail) {
+    if (is_end) {
       pSampleCounts->ZPass_A = fake_sample_count;
       pSampleCounts->Total_A = fake_sample_count;
     }
@@ -1258,6 +1442,37 @@ bool CommandProcessor::ExecutePacketType3_EVENT_WRITE_ZPD(RingBuffer* reader,
   return true;
 }
 
+void CommandProcessor::WriteOcclusionQuerySnapshots(bool await_all) {
+  while (!occlusion_query_snapshots_.empty()) {
+    const OcclusionQuerySnapshot& snapshot = occlusion_query_snapshots_.front();
+    bool await = await_all || counter_ - snapshot.frame >=
+                                  cvars::query_occlusion_latency_frames;
+    while (occlusion_queries_host_read_ < snapshot.queries_before) {
+      uint64_t sample_count;
+      if (!GetOcclusionQueryResult(await, sample_count)) {
+        if (!await) {
+          return;
+        }
+        // Not supposed to happen, but don't leave the guest waiting forever.
+        assert_always();
+        sample_count = 0;
+      }
+      occlusion_query_sample_total_ += sample_count;
+      ++occlusion_queries_host_read_;
+    }
+    // The guest subtracts the beginning snapshot from the ending one, so
+    // wrapping around is fine.
+    uint32_t sample_total = uint32_t(occlusion_query_sample_total_);
+    auto* pSampleCounts =
+        memory_->TranslatePhysical<xe_gpu_depth_sample_counts*>(
+            snapshot.address);
+    std::memset(pSampleCounts, 0, sizeof(xe_gpu_depth_sample_counts));
+    pSampleCounts->ZPass_A = sample_total;
+    pSampleCounts->Total_A = sample_total;
+    occlusion_query_snapshots_.pop_front();
+  }
+}
+
 bool CommandProcessor::ExecutePacketType3Draw(RingBuffer* reader,
                                               uint32_t packet,
                                               const char* opcode_name,
@@ -1354,6 +1569,10 @@ bool CommandProcessor::ExecutePacketType3Draw(RingBuffer* reader,
       // shader has memexport.
       // TODO(Triang3l || JoelLinn): Handle this properly in the render
       // backends.
+      statistics_.Add(register_file_->Get<reg::RB_MODECONTROL>().edram_mode ==
+                              xenos::ModeControl::kCopy
+                          ? GpuStatistics::Counter::kResolves
+                          : GpuStatistics::Counter::kDraws);
       draw_succeeded = IssueDraw(
           vgt_draw_initiator.prim_type, vgt_draw_initiator.num_indices,
           is_indexed ? &index_buffer_info : nullptr,
@@ -1432,10 +1651,7 @@ bool CommandProcessor::ExecutePacketType3_SET_CONSTANT(RingBuffer* reader,
       reader->AdvanceRead((count - 1) * sizeof(uint32_t));
       return true;
   }
-  for (uint32_t n = 0; n < count - 1; n++, index++) {
-    uint32_t data = reader->ReadAndSwap<uint32_t>();
-    WriteRegister(index, data);
-  }
+  WriteRegisterRangeFromRing(reader, index, count - 1);
   return true;
 }
 
@@ -1444,10 +1660,7 @@ bool CommandProcessor::ExecutePacketType3_SET_CONSTANT2(RingBuffer* reader,
                                                         uint32_t count) {
   uint32_t offset_type = reader->ReadAndSwap<uint32_t>();
   uint32_t index = offset_type & 0xFFFF;
-  for (uint32_t n = 0; n < count - 1; n++, index++) {
-    uint32_t data = reader->ReadAndSwap<uint32_t>();
-    WriteRegister(index, data);
-  }
+  WriteRegisterRangeFromRing(reader, index, count - 1);
   return true;
 }
 
@@ -1483,11 +1696,8 @@ bool CommandProcessor::ExecutePacketType3_LOAD_ALU_CONSTANT(RingBuffer* reader,
       return true;
   }
   trace_writer_.WriteMemoryRead(CpuToGpu(address), size_dwords * 4);
-  for (uint32_t n = 0; n < size_dwords; n++, index++) {
-    uint32_t data = xe::load_and_swap<uint32_t>(
-        memory_->TranslatePhysical(address + n * 4));
-    WriteRegister(index, data);
-  }
+  WriteRegistersFromMem(index, memory_->TranslatePhysical<uint32_t*>(address),
+                        size_dwords);
   return true;
 }
 
@@ -1495,10 +1705,7 @@ bool CommandProcessor::ExecutePacketType3_SET_SHADER_CONSTANTS(
     RingBuffer* reader, uint32_t packet, uint32_t count) {
   uint32_t offset_type = reader->ReadAndSwap<uint32_t>();
   uint32_t index = offset_type & 0xFFFF;
-  for (uint32_t n = 0; n < count - 1; n++, index++) {
-    uint32_t data = reader->ReadAndSwap<uint32_t>();
-    WriteRegister(index, data);
-  }
+  WriteRegisterRangeFromRing(reader, index, count - 1);
   return true;
 }
 
@@ -1516,9 +1723,9 @@ bool CommandProcessor::ExecutePacketType3_IM_LOAD(RingBuffer* reader,
   uint32_t size_dwords = start_size & 0xFFFF;  // dwords
   assert_true(start == 0);
   trace_writer_.WriteMemoryRead(CpuToGpu(addr), size_dwords * 4);
-  auto shader =
-      LoadShader(shader_type, addr, memory_->TranslatePhysical<uint32_t*>(addr),
-                 size_dwords);
+  auto shader = LoadShaderByAddress(
+      shader_type, addr, memory_->TranslatePhysical<uint32_t*>(addr),
+      size_dwords);
   switch (shader_type) {
     case xenos::ShaderType::kVertex:
       active_vertex_shader_ = shader;
@@ -1533,6 +1740,38 @@ bool CommandProcessor::ExecutePacketType3_IM_LOAD(RingBuffer* reader,
   return true;
 }
 
+Shader* CommandProcessor::LoadShaderByAddress(xenos::ShaderType shader_type,
+                                              uint32_t guest_address,
+                                              const uint32_t* host_address,
+                                              uint32_t dword_count) {
+  size_t ucode_size = sizeof(uint32_t) * dword_count;
+  ShaderAddressCacheEntry& entry =
+      shader_address_cache_[(guest_address * UINT32_C(0x9E3779B1)) >>
+                            (32 - kShaderAddressCacheSizeLog2)];
+  if (entry.shader && entry.guest_address == guest_address &&
+      entry.shader_type == shader_type &&
+      entry.ucode_guest_endian.size() == dword_count &&
+      !std::memcmp(entry.ucode_guest_endian.data(), host_address,
+                   ucode_size)) {
+    return entry.shader;
+  }
+  Shader* shader =
+      LoadShader(shader_type, guest_address, host_address, dword_count);
+  entry.guest_address = guest_address;
+  entry.shader_type = shader_type;
+  entry.shader = shader;
+  entry.ucode_guest_endian.resize(dword_count);
+  std::memcpy(entry.ucode_guest_endian.data(), host_address, ucode_size);
+  return shader;
+}
+
+void CommandProcessor::ClearShaderAddressCache() {
+  for (ShaderAddressCacheEntry& entry : shader_address_cache_) {
+    entry.shader = nullptr;
+    entry.ucode_guest_endian.clear();
+  }
+}
+
 bool CommandProcessor::ExecutePacketType3_IM_LOAD_IMMEDIATE(RingBuffer* reader,
                                                             uint32_t packet,
                                                             uint32_t count) {
@@ -1610,6 +1849,60 @@ bool CommandProcessor::ExecutePacketType3_VIZ_QUERY(RingBuffer* reader,
   return true;
 }
 
+void CommandProcessor::AdvanceTraceRing() {
+  uint64_t swap_time = Clock::QueryHostUptimeMillis();
+  uint32_t title_id = kernel_state_->GetExecutableModule()->title_id();
+  if (!trace_writer_.is_open()) {
+    // Only starting at the beginning of a frame.
+    trace_writer_.OpenRing(title_id);
+    InitializeTrace();
+    trace_ring_frames_in_segment_ = 0;
+    trace_ring_frames_since_dump_ = 0;
+    trace_ring_dump_requested_ = false;
+    trace_ring_last_swap_time_ = Clock::QueryHostUptimeMillis();
+    return;
+  }
+
+  trace_writer_.WriteEvent(EventCommand::Type::kSwap);
+  ++trace_ring_frames_in_segment_;
+  ++trace_ring_frames_since_dump_;
+
+  bool dump = trace_ring_dump_requested_.exchange(false);
+  // Don't write frames mostly overlapping the previously written ones if
+  // hitches are frequent.
+  if (!dump && cvars::trace_gpu_ring_hitch_ms &&
+      trace_ring_frames_since_dump_ >= trace_ring_segment_frames_) {
+    uint64_t frame_time = swap_time - trace_ring_last_swap_time_;
+    if (frame_time > cvars::trace_gpu_ring_hitch_ms) {
+      XELOGI("GPU trace ring: frame took {} ms", frame_time);
+      dump = true;
+    }
+  }
+  if (dump) {
+    auto file_name = fmt::format("{:08X}_ring_{}.xtr", title_id, counter_ - 1);
+    auto path = trace_ring_path_ / file_name;
+    if (trace_writer_.DumpRing(path)) {
+      XELOGI("GPU trace ring: wrote the latest frames to {}",
+             xe::path_to_utf8(path));
+    } else {
+      XELOGE("GPU trace ring: failed to write {}", xe::path_to_utf8(path));
+    }
+    trace_ring_frames_since_dump_ = 0;
+  }
+
+  if (trace_ring_frames_in_segment_ >= trace_ring_segment_frames_) {
+    // Take a new snapshot of the state so the frames from now on can be played
+    // back after the oldest segment is dropped.
+    trace_writer_.BeginRingSegment();
+    InitializeTrace();
+    trace_ring_frames_in_segment_ = 0;
+  }
+
+  // Not counting the time taken by the snapshot and the writing to the file in
+  // the frame time.
+  trace_ring_last_swap_time_ = Clock::QueryHostUptimeMillis();
+}
+
 void CommandProcessor::InitializeTrace() {
   // Write the initial register values, to be loaded directly into the
   // RegisterFile since all registers, including those that may have side
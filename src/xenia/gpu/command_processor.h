@@ -10,8 +10,10 @@
 #ifndef XENIA_GPU_COMMAND_PROCESSOR_H_
 #define XENIA_GPU_COMMAND_PROCESSOR_H_
 
+#include <array>
 #include <atomic>
 #include <cstring>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -21,6 +23,7 @@
 
 #include "xenia/base/ring_buffer.h"
 #include "xenia/base/threading.h"
+#include "xenia/gpu/gpu_statistics.h"
 #include "xenia/gpu/register_file.h"
 #include "xenia/gpu/registers.h"
 #include "xenia/gpu/trace_writer.h"
@@ -111,6 +114,11 @@ class CommandProcessor {
 
   virtual void RequestFrameTrace(const std::filesystem::path& root_path);
   virtual void BeginTracing(const std::filesystem::path& root_path);
+  // Keeps the latest frames in memory, at least segment_frames of them, to
+  // write them to a file under root_path when a frame trace is requested or
+  // when a frame takes longer than trace_gpu_ring_hitch_ms.
+  virtual void BeginRingTracing(const std::filesystem::path& root_path,
+                                uint32_t segment_frames);
   virtual void EndTracing();
 
   virtual void TracePlaybackWroteMemory(uint32_t base_ptr, uint32_t length) = 0;
@@ -138,6 +146,20 @@ class CommandProcessor {
   bool Save(ByteStream* stream);
   bool Restore(ByteStream* stream);
 
+  // The latest frame values and the totals can be read, and the frame
+  // intervals can be recorded, from any thread.
+  GpuStatistics& statistics() { return statistics_; }
+  const GpuStatistics& statistics() const { return statistics_; }
+
+  // Incremented on writes to the registers other than shader constants that
+  // may affect the host pipeline state of draws - like
+  // draw_state_register_write_count, but not counting the viewport and scissor
+  // registers, which are dynamic state on the host. The pipeline of the
+  // previous draw can be reused if it hasn't changed.
+  uint64_t pipeline_state_register_write_count() const {
+    return pipeline_state_register_write_count_;
+  }
+
  protected:
   struct IndexBufferInfo {
     xenos::IndexFormat format = xenos::IndexFormat::kInt16;
@@ -152,6 +174,24 @@ class CommandProcessor {
   virtual void ShutdownContext() = 0;
 
   virtual void WriteRegister(uint32_t index, uint32_t value);
+  // Writes consecutive registers from big-endian values in memory, with the
+  // same effect as WriteRegister for each of them, but writing the ranges of
+  // shader constants (the majority of register writes) at once.
+  virtual void WriteRegistersFromMem(uint32_t start_index, const uint32_t* base,
+                                     uint32_t num_registers);
+  // Called after writing a range of registers within one of the shader constant
+  // types (float, fetch, or bool and loop), either individually or in bulk.
+  virtual void OnShaderConstantsWritten(uint32_t first_index, uint32_t count) {}
+  void WriteRegisterRangeFromRing(RingBuffer* ring, uint32_t start_index,
+                                  uint32_t num_registers);
+  // Incremented on writes to the registers other than shader constants that
+  // may affect the host state of draws. Doesn't change between consecutive
+  // draws that only have different index buffers or index counts, so the
+  // backends can reuse the host state derived purely from the registers for
+  // the previous draw when it hasn't changed.
+  uint64_t draw_state_register_write_count() const {
+    return draw_state_register_write_count_;
+  }
 
   const reg::DC_LUT_30_COLOR* gamma_ramp_256_entry_table() const {
     return gamma_ramp_256_entry_table_;
@@ -165,6 +205,31 @@ class CommandProcessor {
   virtual void MakeCoherent();
   virtual void PrepareForWait();
   virtual void ReturnFromWait();
+  // Called before reporting the progress of the command processor to the guest
+  // CPU (by writing to the memory or raising an interrupt), for making the
+  // results of asynchronous host work, such as readbacks, visible by then.
+  virtual void PrepareForCpuSync() {}
+
+  // Host occlusion queries for the guest sample counters written by
+  // EVENT_WRITE_ZPD. The guest counters are snapshots of a running total, and
+  // the host counts the samples between each two consecutive EVENT_WRITE_ZPD
+  // while any guest query is active with a separate query. The results of the
+  // queries are obtained in the order they're ended.
+  virtual bool IsOcclusionQueryHostSupported() const { return false; }
+  // Returns whether the query has been begun.
+  virtual bool BeginOcclusionQuery() { return false; }
+  virtual void EndOcclusionQuery() {}
+  // Returns the number of samples, at the guest resolution, that have passed
+  // during the oldest query with the result not obtained yet, or false if there
+  // are no ended queries, or if await is false and the result is not available
+  // yet.
+  virtual bool GetOcclusionQueryResult(bool await, uint64_t& sample_count_out) {
+    return false;
+  }
+  // Writes the snapshots of the sample counter to the guest memory when the
+  // results of the queries preceding them are available, or awaiting them if
+  // they're older than the latency allows.
+  void WriteOcclusionQuerySnapshots(bool await_all);
 
   uint32_t ExecutePrimaryBuffer(uint32_t start_index, uint32_t end_index);
   virtual void OnPrimaryBufferEnd() {}
@@ -232,6 +297,13 @@ class CommandProcessor {
                              uint32_t guest_address,
                              const uint32_t* host_address,
                              uint32_t dword_count) = 0;
+  // Looks up the shader previously loaded from the same guest address if its
+  // microcode hasn't been modified since, or loads it via LoadShader.
+  Shader* LoadShaderByAddress(xenos::ShaderType shader_type,
+                              uint32_t guest_address,
+                              const uint32_t* host_address,
+                              uint32_t dword_count);
+  void ClearShaderAddressCache();
 
   virtual bool IssueDraw(xenos::PrimitiveType prim_type, uint32_t index_count,
                          IndexBufferInfo* index_buffer_info,
@@ -246,20 +318,32 @@ class CommandProcessor {
 
   virtual void InitializeTrace();
 
+  // Called at swaps when keeping the latest frames in memory.
+  void AdvanceTraceRing();
+
   Memory* memory_ = nullptr;
   kernel::KernelState* kernel_state_ = nullptr;
   GraphicsSystem* graphics_system_ = nullptr;
   RegisterFile* register_file_ = nullptr;
 
+  GpuStatistics statistics_;
+
   TraceWriter trace_writer_;
   enum class TraceState {
     kDisabled,
     kStreaming,
     kSingleFrame,
+    kRing,
   };
   TraceState trace_state_ = TraceState::kDisabled;
   std::filesystem::path trace_stream_path_;
   std::filesystem::path trace_frame_path_;
+  std::filesystem::path trace_ring_path_;
+  uint32_t trace_ring_segment_frames_ = 0;
+  uint32_t trace_ring_frames_in_segment_ = 0;
+  uint32_t trace_ring_frames_since_dump_ = 0;
+  uint64_t trace_ring_last_swap_time_ = 0;
+  std::atomic<bool> trace_ring_dump_requested_ = false;
 
   std::atomic<bool> worker_running_;
   kernel::object_ref<kernel::XHostThread> worker_thread_;
@@ -271,6 +355,21 @@ class CommandProcessor {
 
   uint32_t counter_ = 0;
 
+  struct OcclusionQuerySnapshot {
+    uint32_t address;
+    // The number of host queries ended before the snapshot.
+    uint64_t queries_before;
+    uint32_t frame;
+  };
+  std::deque<OcclusionQuerySnapshot> occlusion_query_snapshots_;
+  // The number of guest queries begun but not ended yet.
+  uint32_t occlusion_queries_guest_active_ = 0;
+  bool occlusion_query_host_active_ = false;
+  uint64_t occlusion_queries_host_ended_ = 0;
+  uint64_t occlusion_queries_host_read_ = 0;
+  // The running total of the samples counted by the host queries already read.
+  uint64_t occlusion_query_sample_total_ = 0;
+
   uint32_t primary_buffer_ptr_ = 0;
   uint32_t primary_buffer_size_ = 0;
 
@@ -278,7 +377,7 @@ class CommandProcessor {
   uint32_t read_ptr_update_freq_ = 0;
   uint32_t read_ptr_writeback_ptr_ = 0;
 
-  std::unique_ptr<xe::threading::Event> write_ptr_index_event_;
+  xe::threading::AdaptiveWaiter worker_waiter_;
   std::atomic<uint32_t> write_ptr_index_;
 
   uint64_t bin_select_ = 0xFFFFFFFFull;
@@ -287,6 +386,22 @@ class CommandProcessor {
   Shader* active_vertex_shader_ = nullptr;
   Shader* active_pixel_shader_ = nullptr;
 
+  // Games usually load the same shaders from the same locations for every
+  // draw, so before hashing the microcode for the lookup in the backend's
+  // shader map, checking whether it's unchanged since the last load from that
+  // address. The microcode is kept in the guest byte order, so the check is a
+  // plain memory comparison, which is cheaper than hashing and doesn't have to
+  // finish if the microcode differs.
+  struct ShaderAddressCacheEntry {
+    uint32_t guest_address = 0;
+    xenos::ShaderType shader_type = xenos::ShaderType::kVertex;
+    Shader* shader = nullptr;
+    std::vector<uint32_t> ucode_guest_endian;
+  };
+  static constexpr uint32_t kShaderAddressCacheSizeLog2 = 6;
+  std::array<ShaderAddressCacheEntry, size_t(1) << kShaderAddressCacheSizeLog2>
+      shader_address_cache_;
+
   bool paused_ = false;
 
   // By default (such as for tools), post-processing is disabled.
@@ -298,6 +413,9 @@ class CommandProcessor {
   reg::DC_LUT_30_COLOR gamma_ramp_256_entry_table_[256] = {};
   reg::DC_LUT_PWL_DATA gamma_ramp_pwl_rgb_[128][3] = {};
   uint32_t gamma_ramp_rw_component_ = 0;
+
+  uint64_t draw_state_register_write_count_ = 0;
+  uint64_t pipeline_state_register_write_count_ = 0;
 };
 
 }  // namespace gpu
@@ -13,10 +13,13 @@
 #include <utility>
 
 #include "xenia/base/assert.h"
+#include "xenia/base/bit_range.h"
 #include "xenia/base/byte_order.h"
+#include "xenia/base/clock.h"
 #include "xenia/base/cvar.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
+#include "xenia/base/memory.h"
 #include "xenia/base/profiling.h"
 #include "xenia/gpu/d3d12/d3d12_command_processor.h"
 #include "xenia/gpu/d3d12/d3d12_graphics_system.h"
@@ -36,14 +39,14 @@ DEFINE_bool(d3d12_readback_memexport, false,
             "Read data written by memory export in shaders on the CPU. This "
             "may be needed in some games (but many only access exported data "
             "on the GPU, and this flag isn't needed to handle such behavior), "
-            "but causes mid-frame synchronization, so it has a huge "
-            "performance impact.",
+            "but causes synchronization with the GPU when the game may observe "
+            "its progress, so it has a performance impact.",
             "D3D12");
 DEFINE_bool(d3d12_readback_resolve, false,
             "Read render-to-texture results on the CPU. This may be needed in "
             "some games, for instance, for screenshots in saved games, but "
-            "causes mid-frame synchronization, so it has a huge performance "
-            "impact.",
+            "causes synchronization with the GPU when the game may observe its "
+            "progress, so it has a performance impact.",
             "D3D12");
 DEFINE_bool(d3d12_submit_on_primary_buffer_end, true,
             "Submit the command list when a PM4 primary buffer ends if it's "
@@ -78,7 +81,10 @@ void D3D12CommandProcessor::ClearCaches() {
 void D3D12CommandProcessor::InitializeShaderStorage(
     const std::filesystem::path& cache_root, uint32_t title_id, bool blocking) {
   CommandProcessor::InitializeShaderStorage(cache_root, title_id, blocking);
-  pipeline_cache_->InitializeShaderStorage(cache_root, title_id, blocking);
+  if (cvars::store_shaders) {
+    pipeline_cache_->InitializeShaderStorage(cache_root, title_id, blocking);
+  }
+  texture_cache_->InitializeStorage(cache_root, title_id);
 }
 
 void D3D12CommandProcessor::RequestFrameTrace(
@@ -133,6 +139,15 @@ void D3D12CommandProcessor::PushAliasingBarrier(ID3D12Resource* old_resource,
 }
 
 void D3D12CommandProcessor::PushUAVBarrier(ID3D12Resource* resource) {
+  // No work can be done between pending barriers, so one UAV barrier for the
+  // resource (or for all resources) is enough in a ResourceBarrier call.
+  for (const D3D12_RESOURCE_BARRIER& pending_barrier : barriers_) {
+    if (pending_barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_UAV &&
+        (!pending_barrier.UAV.pResource ||
+         pending_barrier.UAV.pResource == resource)) {
+      return;
+    }
+  }
   D3D12_RESOURCE_BARRIER barrier;
   barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
   barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
@@ -143,6 +158,8 @@ void D3D12CommandProcessor::PushUAVBarrier(ID3D12Resource* resource) {
 void D3D12CommandProcessor::SubmitBarriers() {
   UINT barrier_count = UINT(barriers_.size());
   if (barrier_count != 0) {
+    statistics_.Add(GpuStatistics::Counter::kBarrierCommands);
+    statistics_.Add(GpuStatistics::Counter::kBarriers, barrier_count);
     deferred_command_list_.D3DResourceBarrier(barrier_count, barriers_.data());
     barriers_.clear();
   }
@@ -805,6 +822,66 @@ bool D3D12CommandProcessor::SetupContext() {
     return false;
   }
 
+  // Not critical for the emulation, only for statistics.
+  D3D12_QUERY_HEAP_DESC timestamp_query_heap_desc;
+  timestamp_query_heap_desc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+  timestamp_query_heap_desc.Count = 2 * kTimestampQuerySubmissions;
+  timestamp_query_heap_desc.NodeMask = 0;
+  D3D12_RESOURCE_DESC timestamp_query_readback_buffer_desc;
+  ui::d3d12::util::FillBufferResourceDesc(
+      timestamp_query_readback_buffer_desc,
+      sizeof(uint64_t) * 2 * kTimestampQuerySubmissions,
+      D3D12_RESOURCE_FLAG_NONE);
+  if (FAILED(direct_queue->GetTimestampFrequency(&timestamp_frequency_)) ||
+      !timestamp_frequency_ ||
+      FAILED(device->CreateQueryHeap(&timestamp_query_heap_desc,
+                                     IID_PPV_ARGS(&timestamp_query_heap_))) ||
+      FAILED(device->CreateCommittedResource(
+          &ui::d3d12::util::kHeapPropertiesReadback,
+          provider.GetHeapFlagCreateNotZeroed(),
+          &timestamp_query_readback_buffer_desc,
+          D3D12_RESOURCE_STATE_COPY_DEST, nullptr,
+          IID_PPV_ARGS(&timestamp_query_readback_buffer_)))) {
+    XELOGW(
+        "Failed to create the timestamp queries, the host GPU time of "
+        "submissions won't be measured");
+    ui::d3d12::util::ReleaseAndNull(timestamp_query_readback_buffer_);
+    ui::d3d12::util::ReleaseAndNull(timestamp_query_heap_);
+  } else if (Profiler::are_gpu_timelines_supported()) {
+    UINT64 gpu_timestamp, cpu_timestamp;
+    if (SUCCEEDED(direct_queue->GetClockCalibration(&gpu_timestamp,
+                                                    &cpu_timestamp))) {
+      profiler_gpu_timeline_ = Profiler::CreateGpuTimeline(
+          Profiler::GpuTimelineType::kD3D12, "Direct queue",
+          int64_t(gpu_timestamp),
+          float(1000000000.0 / double(timestamp_frequency_)));
+    }
+  }
+
+  // Without the queries, fake sample counts are used.
+  D3D12_QUERY_HEAP_DESC occlusion_query_heap_desc;
+  occlusion_query_heap_desc.Type = D3D12_QUERY_HEAP_TYPE_OCCLUSION;
+  occlusion_query_heap_desc.Count = kOcclusionQueryHostCount;
+  occlusion_query_heap_desc.NodeMask = 0;
+  D3D12_RESOURCE_DESC occlusion_query_readback_buffer_desc;
+  ui::d3d12::util::FillBufferResourceDesc(
+      occlusion_query_readback_buffer_desc,
+      sizeof(uint64_t) * kOcclusionQueryHostCount, D3D12_RESOURCE_FLAG_NONE);
+  if (FAILED(device->CreateQueryHeap(&occlusion_query_heap_desc,
+                                     IID_PPV_ARGS(&occlusion_query_heap_))) ||
+      FAILED(device->CreateCommittedResource(
+          &ui::d3d12::util::kHeapPropertiesReadback,
+          provider.GetHeapFlagCreateNotZeroed(),
+          &occlusion_query_readback_buffer_desc,
+          D3D12_RESOURCE_STATE_COPY_DEST, nullptr,
+          IID_PPV_ARGS(&occlusion_query_readback_buffer_)))) {
+    XELOGW(
+        "Failed to create the occlusion queries, fake sample counts will be "
+        "reported");
+    ui::d3d12::util::ReleaseAndNull(occlusion_query_readback_buffer_);
+    ui::d3d12::util::ReleaseAndNull(occlusion_query_heap_);
+  }
+
   // Create the command list and one allocator because it's needed for a command
   // list.
   ID3D12CommandAllocator* command_allocator;
@@ -1589,8 +1666,18 @@ bool D3D12CommandProcessor::SetupContext() {
 void D3D12CommandProcessor::ShutdownContext() {
   AwaitAllQueueOperationsCompletion();
 
-  ui::d3d12::util::ReleaseAndNull(readback_buffer_);
-  readback_buffer_size_ = 0;
+  for (Readback& readback : readbacks_) {
+    for (const Readback::Range& range : readback.ranges) {
+      if (range.watch) {
+        shared_memory_->UnwatchMemoryRange(range.watch);
+      }
+    }
+    readback.ranges.clear();
+    readback.submission = 0;
+    ui::d3d12::util::ReleaseAndNull(readback.buffer);
+    readback.buffer_size = 0;
+  }
+  readback_next_ = 0;
 
   ui::d3d12::util::ReleaseAndNull(scratch_buffer_);
   scratch_buffer_size_ = 0;
@@ -1621,6 +1708,8 @@ void D3D12CommandProcessor::ShutdownContext() {
 
   texture_cache_.reset();
 
+  last_draw_pipeline_.pipeline_handle = nullptr;
+  last_draw_viewport_.valid = false;
   pipeline_cache_.reset();
 
   primitive_processor_.reset();
@@ -1674,6 +1763,21 @@ void D3D12CommandProcessor::ShutdownContext() {
   queue_operations_since_submission_fence_last_ = 0;
   ui::d3d12::util::ReleaseAndNull(queue_operations_since_submission_fence_);
 
+  occlusion_queries_.clear();
+  occlusion_query_active_ = false;
+  occlusion_query_host_active_ = false;
+  occlusion_query_host_next_ = 0;
+  occlusion_query_host_used_ = 0;
+  ui::d3d12::util::ReleaseAndNull(occlusion_query_readback_buffer_);
+  ui::d3d12::util::ReleaseAndNull(occlusion_query_heap_);
+
+  ui::d3d12::util::ReleaseAndNull(timestamp_query_readback_buffer_);
+  ui::d3d12::util::ReleaseAndNull(timestamp_query_heap_);
+  timestamp_frequency_ = 0;
+  profiler_gpu_timeline_ = Profiler::kGpuTimelineInvalid;
+  std::memset(timestamp_query_submissions_, 0,
+              sizeof(timestamp_query_submissions_));
+
   ui::d3d12::util::ReleaseAndNull(submission_fence_);
   submission_open_ = false;
   submission_current_ = 1;
@@ -1689,36 +1793,48 @@ void D3D12CommandProcessor::ShutdownContext() {
   CommandProcessor::ShutdownContext();
 }
 
-void D3D12CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
-  CommandProcessor::WriteRegister(index, value);
-
-  if (index >= XE_GPU_REG_SHADER_CONSTANT_000_X &&
-      index <= XE_GPU_REG_SHADER_CONSTANT_511_W) {
+void D3D12CommandProcessor::OnShaderConstantsWritten(uint32_t first_index,
+                                                     uint32_t count) {
+  uint32_t last_index = first_index + count - 1;
+  if (first_index >= XE_GPU_REG_SHADER_CONSTANT_000_X &&
+      last_index <= XE_GPU_REG_SHADER_CONSTANT_511_W) {
     if (frame_open_) {
-      uint32_t float_constant_index =
-          (index - XE_GPU_REG_SHADER_CONSTANT_000_X) >> 2;
-      if (float_constant_index >= 256) {
-        float_constant_index -= 256;
-        if (current_float_constant_map_pixel_[float_constant_index >> 6] &
-            (1ull << (float_constant_index & 63))) {
+      // Check whole 64-bit blocks of the used constant maps at once.
+      uint32_t float_constant_first =
+          (first_index - XE_GPU_REG_SHADER_CONSTANT_000_X) >> 2;
+      uint32_t float_constant_last =
+          (last_index - XE_GPU_REG_SHADER_CONSTANT_000_X) >> 2;
+      if (float_constant_first < 256 &&
+          xe::bit_range::AnyInRange(
+              current_float_constant_map_vertex_, float_constant_first,
+              std::min(float_constant_last, uint32_t(255)) + 1 -
+                  float_constant_first)) {
+        cbuffer_binding_float_vertex_.up_to_date = false;
+      }
+      if (float_constant_last >= 256) {
+        uint32_t float_constant_pixel_first =
+            std::max(float_constant_first, uint32_t(256)) - 256;
+        if (xe::bit_range::AnyInRange(
+                current_float_constant_map_pixel_, float_constant_pixel_first,
+                float_constant_last - 256 + 1 - float_constant_pixel_first)) {
           cbuffer_binding_float_pixel_.up_to_date = false;
         }
-      } else {
-        if (current_float_constant_map_vertex_[float_constant_index >> 6] &
-            (1ull << (float_constant_index & 63))) {
-          cbuffer_binding_float_vertex_.up_to_date = false;
-        }
       }
     }
-  } else if (index >= XE_GPU_REG_SHADER_CONSTANT_BOOL_000_031 &&
-             index <= XE_GPU_REG_SHADER_CONSTANT_LOOP_31) {
+  } else if (first_index >= XE_GPU_REG_SHADER_CONSTANT_BOOL_000_031 &&
+             last_index <= XE_GPU_REG_SHADER_CONSTANT_LOOP_31) {
     cbuffer_binding_bool_loop_.up_to_date = false;
-  } else if (index >= XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0 &&
-             index <= XE_GPU_REG_SHADER_CONSTANT_FETCH_31_5) {
+  } else if (first_index >= XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0 &&
+             last_index <= XE_GPU_REG_SHADER_CONSTANT_FETCH_31_5) {
     cbuffer_binding_fetch_.up_to_date = false;
     if (texture_cache_ != nullptr) {
-      texture_cache_->TextureFetchConstantWritten(
-          (index - XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) / 6);
+      uint32_t fetch_constant_last =
+          (last_index - XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) / 6;
+      for (uint32_t i =
+               (first_index - XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) / 6;
+           i <= fetch_constant_last; ++i) {
+        texture_cache_->TextureFetchConstantWritten(i);
+      }
     }
   }
 }
@@ -1731,6 +1847,154 @@ void D3D12CommandProcessor::OnGammaRampPWLValueWritten() {
   gamma_ramp_pwl_up_to_date_ = false;
 }
 
+void D3D12CommandProcessor::PrepareForWait() {
+  CommandProcessor::PrepareForWait();
+  // The guest may be waiting for the GPU to become idle to access the data.
+  CompleteReadbacks();
+}
+
+void D3D12CommandProcessor::PrepareForCpuSync() { CompleteReadbacks(); }
+
+bool D3D12CommandProcessor::BeginOcclusionQuery() {
+  assert_false(occlusion_query_active_);
+  if (!occlusion_query_heap_) {
+    return false;
+  }
+  // Before beginning the submission as this may end it.
+  FreeOcclusionQueryHost();
+  occlusion_queries_.emplace_back();
+  occlusion_query_active_ = true;
+  if (!BeginSubmission(true)) {
+    occlusion_queries_.pop_back();
+    occlusion_query_active_ = false;
+    return false;
+  }
+  // Not begun yet if the submission was already open.
+  if (!occlusion_query_host_active_) {
+    BeginOcclusionQueryHost();
+  }
+  return true;
+}
+
+void D3D12CommandProcessor::EndOcclusionQuery() {
+  assert_true(occlusion_query_active_);
+  EndOcclusionQueryHost();
+  occlusion_query_active_ = false;
+}
+
+bool D3D12CommandProcessor::GetOcclusionQueryResult(
+    bool await, uint64_t& sample_count_out) {
+  if (occlusion_queries_.size() <= size_t(occlusion_query_active_)) {
+    return false;
+  }
+  OcclusionQuery& query = occlusion_queries_.front();
+  if (query.host_query_count) {
+    if (!await) {
+      if (submission_completed_ < query.submission) {
+        CheckSubmissionFence(0);
+      }
+      if (submission_completed_ < query.submission) {
+        return false;
+      }
+    }
+    ReadOcclusionQueryHostResults(query);
+  }
+  // Samples are counted at the host resolution.
+  sample_count_out = query.sample_count /
+                     (texture_cache_->draw_resolution_scale_x() *
+                      texture_cache_->draw_resolution_scale_y());
+  occlusion_queries_.pop_front();
+  return true;
+}
+
+void D3D12CommandProcessor::BeginOcclusionQueryHost() {
+  assert_true(submission_open_);
+  assert_true(occlusion_query_active_);
+  assert_false(occlusion_query_host_active_);
+  FreeOcclusionQueryHost();
+  OcclusionQuery& query = occlusion_queries_.back();
+  if (!query.host_query_count) {
+    query.host_query_first = occlusion_query_host_next_;
+  }
+  ++query.host_query_count;
+  query.submission = submission_current_;
+  deferred_command_list_.D3DBeginQuery(occlusion_query_heap_,
+                                       D3D12_QUERY_TYPE_OCCLUSION,
+                                       occlusion_query_host_next_);
+  occlusion_query_host_next_ =
+      (occlusion_query_host_next_ + 1) % kOcclusionQueryHostCount;
+  ++occlusion_query_host_used_;
+  occlusion_query_host_active_ = true;
+}
+
+void D3D12CommandProcessor::EndOcclusionQueryHost() {
+  if (!occlusion_query_host_active_) {
+    return;
+  }
+  const OcclusionQuery& query = occlusion_queries_.back();
+  uint32_t host_query =
+      (query.host_query_first + query.host_query_count - 1) %
+      kOcclusionQueryHostCount;
+  deferred_command_list_.D3DEndQuery(occlusion_query_heap_,
+                                     D3D12_QUERY_TYPE_OCCLUSION, host_query);
+  deferred_command_list_.D3DResolveQueryData(
+      occlusion_query_heap_, D3D12_QUERY_TYPE_OCCLUSION, host_query, 1,
+      occlusion_query_readback_buffer_, sizeof(uint64_t) * host_query);
+  occlusion_query_host_active_ = false;
+}
+
+void D3D12CommandProcessor::ReadOcclusionQueryHostResults(
+    OcclusionQuery& query) {
+  if (!query.host_query_count) {
+    return;
+  }
+  // Ends the host query if it's in the current submission.
+  CheckSubmissionFence(query.submission);
+  if (occlusion_query_host_active_ && &query == &occlusion_queries_.back()) {
+    // Failed to end the submission, can't read the host query being counted.
+    return;
+  }
+  if (submission_completed_ >= query.submission) {
+    D3D12_RANGE read_range;
+    if (query.host_query_first + query.host_query_count <=
+        kOcclusionQueryHostCount) {
+      read_range.Begin = sizeof(uint64_t) * query.host_query_first;
+      read_range.End = read_range.Begin +
+                       sizeof(uint64_t) * query.host_query_count;
+    } else {
+      read_range.Begin = 0;
+      read_range.End = sizeof(uint64_t) * kOcclusionQueryHostCount;
+    }
+    void* mapping;
+    if (SUCCEEDED(
+            occlusion_query_readback_buffer_->Map(0, &read_range, &mapping))) {
+      const uint64_t* results = reinterpret_cast<const uint64_t*>(mapping);
+      for (uint32_t i = 0; i < query.host_query_count; ++i) {
+        query.sample_count +=
+            results[(query.host_query_first + i) % kOcclusionQueryHostCount];
+      }
+      D3D12_RANGE write_range = {};
+      occlusion_query_readback_buffer_->Unmap(0, &write_range);
+    }
+  }
+  // If failed to await, such as because of the device removal, the samples are
+  // dropped.
+  query.host_query_first =
+      (query.host_query_first + query.host_query_count) %
+      kOcclusionQueryHostCount;
+  occlusion_query_host_used_ -= query.host_query_count;
+  query.host_query_count = 0;
+}
+
+void D3D12CommandProcessor::FreeOcclusionQueryHost() {
+  for (OcclusionQuery& query : occlusion_queries_) {
+    if (occlusion_query_host_used_ < kOcclusionQueryHostCount) {
+      break;
+    }
+    ReadOcclusionQueryHostResults(query);
+  }
+}
+
 void D3D12CommandProcessor::IssueSwap(uint32_t frontbuffer_ptr,
                                       uint32_t frontbuffer_width,
                                       uint32_t frontbuffer_height) {
@@ -2228,15 +2492,74 @@ bool D3D12CommandProcessor::IssueDraw(xenos::PrimitiveType primitive_type,
   } else {
     bound_depth_and_color_render_target_bits = 0;
   }
+  // In runs of draws without state changes between them (such as ones only
+  // with different index buffers), skip building and looking up the pipeline
+  // description if nothing it's derived from has changed.
   void* pipeline_handle;
   ID3D12RootSignature* root_signature;
-  if (!pipeline_cache_->ConfigurePipeline(
-          vertex_shader_translation, pixel_shader_translation,
-          primitive_processing_result, normalized_depth_control,
-          normalized_color_mask, bound_depth_and_color_render_target_bits,
-          bound_depth_and_color_render_target_formats, &pipeline_handle,
-          &root_signature)) {
-    return false;
+  uint64_t pipeline_state_register_write_count =
+      this->pipeline_state_register_write_count();
+  LastDrawPipeline& last_draw_pipeline = last_draw_pipeline_;
+  if (last_draw_pipeline.pipeline_handle &&
+      last_draw_pipeline.pipeline_state_register_write_count ==
+          pipeline_state_register_write_count &&
+      last_draw_pipeline.vertex_shader == vertex_shader_translation &&
+      last_draw_pipeline.pixel_shader == pixel_shader_translation &&
+      last_draw_pipeline.host_primitive_type ==
+          primitive_processing_result.host_primitive_type &&
+      last_draw_pipeline.host_vertex_shader_type ==
+          primitive_processing_result.host_vertex_shader_type &&
+      last_draw_pipeline.tessellation_mode ==
+          primitive_processing_result.tessellation_mode &&
+      last_draw_pipeline.host_index_format ==
+          primitive_processing_result.host_index_format &&
+      last_draw_pipeline.host_primitive_reset_enabled ==
+          primitive_processing_result.host_primitive_reset_enabled &&
+      last_draw_pipeline.normalized_depth_control.value ==
+          normalized_depth_control.value &&
+      last_draw_pipeline.normalized_color_mask == normalized_color_mask &&
+      last_draw_pipeline.bound_depth_and_color_render_target_bits ==
+          bound_depth_and_color_render_target_bits &&
+      (!bound_depth_and_color_render_target_bits ||
+       !std::memcmp(
+           last_draw_pipeline.bound_depth_and_color_render_target_formats,
+           bound_depth_and_color_render_target_formats,
+           sizeof(bound_depth_and_color_render_target_formats)))) {
+    pipeline_handle = last_draw_pipeline.pipeline_handle;
+    root_signature = last_draw_pipeline.root_signature;
+  } else {
+    last_draw_pipeline.pipeline_handle = nullptr;
+    if (!pipeline_cache_->ConfigurePipeline(
+            vertex_shader_translation, pixel_shader_translation,
+            primitive_processing_result, normalized_depth_control,
+            normalized_color_mask, bound_depth_and_color_render_target_bits,
+            bound_depth_and_color_render_target_formats, &pipeline_handle,
+            &root_signature)) {
+      return false;
+    }
+    last_draw_pipeline.pipeline_state_register_write_count =
+        pipeline_state_register_write_count;
+    last_draw_pipeline.vertex_shader = vertex_shader_translation;
+    last_draw_pipeline.pixel_shader = pixel_shader_translation;
+    last_draw_pipeline.host_primitive_type =
+        primitive_processing_result.host_primitive_type;
+    last_draw_pipeline.host_vertex_shader_type =
+        primitive_processing_result.host_vertex_shader_type;
+    last_draw_pipeline.tessellation_mode =
+        primitive_processing_result.tessellation_mode;
+    last_draw_pipeline.host_index_format =
+        primitive_processing_result.host_index_format;
+    last_draw_pipeline.host_primitive_reset_enabled =
+        primitive_processing_result.host_primitive_reset_enabled;
+    last_draw_pipeline.normalized_depth_control = normalized_depth_control;
+    last_draw_pipeline.normalized_color_mask = normalized_color_mask;
+    last_draw_pipeline.bound_depth_and_color_render_target_bits =
+        bound_depth_and_color_render_target_bits;
+    std::memcpy(last_draw_pipeline.bound_depth_and_color_render_target_formats,
+                bound_depth_and_color_render_target_formats,
+                sizeof(bound_depth_and_color_render_target_formats));
+    last_draw_pipeline.pipeline_handle = pipeline_handle;
+    last_draw_pipeline.root_signature = root_signature;
   }
 
   // Update the textures - this may bind pipelines.
@@ -2256,28 +2579,47 @@ bool D3D12CommandProcessor::IssueDraw(xenos::PrimitiveType primitive_type,
     current_external_pipeline_ = nullptr;
   }
 
-  // Get dynamic rasterizer state.
+  // Get dynamic rasterizer state. The resolution scale and the render target
+  // path don't change during the lifetime of the context.
+  uint64_t draw_state_register_write_count =
+      this->draw_state_register_write_count();
+  bool convert_z_to_float24 =
+      host_render_targets_used &&
+      render_target_cache_->depth_float24_convert_in_pixel_shader();
+  bool pixel_shader_writes_depth = pixel_shader && pixel_shader->writes_depth();
+  LastDrawViewport& last_draw_viewport = last_draw_viewport_;
   uint32_t draw_resolution_scale_x = texture_cache_->draw_resolution_scale_x();
   uint32_t draw_resolution_scale_y = texture_cache_->draw_resolution_scale_y();
-  draw_util::ViewportInfo viewport_info;
-  draw_util::GetHostViewportInfo(
-      regs, draw_resolution_scale_x, draw_resolution_scale_y, true,
-      D3D12_VIEWPORT_BOUNDS_MAX, D3D12_VIEWPORT_BOUNDS_MAX, false,
-      normalized_depth_control,
-      host_render_targets_used &&
-          render_target_cache_->depth_float24_convert_in_pixel_shader(),
-      host_render_targets_used, pixel_shader && pixel_shader->writes_depth(),
-      viewport_info);
-  draw_util::Scissor scissor;
-  draw_util::GetScissor(regs, scissor);
-  scissor.offset[0] *= draw_resolution_scale_x;
-  scissor.offset[1] *= draw_resolution_scale_y;
-  scissor.extent[0] *= draw_resolution_scale_x;
-  scissor.extent[1] *= draw_resolution_scale_y;
+  if (!last_draw_viewport.valid ||
+      last_draw_viewport.draw_state_register_write_count !=
+          draw_state_register_write_count ||
+      last_draw_viewport.convert_z_to_float24 != convert_z_to_float24 ||
+      last_draw_viewport.pixel_shader_writes_depth !=
+          pixel_shader_writes_depth) {
+    draw_util::GetHostViewportInfo(
+        regs, draw_resolution_scale_x, draw_resolution_scale_y, true,
+        D3D12_VIEWPORT_BOUNDS_MAX, D3D12_VIEWPORT_BOUNDS_MAX, false,
+        normalized_depth_control, convert_z_to_float24,
+        host_render_targets_used, pixel_shader_writes_depth,
+        last_draw_viewport.viewport_info);
+    draw_util::Scissor& scissor = last_draw_viewport.scissor;
+    draw_util::GetScissor(regs, scissor);
+    scissor.offset[0] *= draw_resolution_scale_x;
+    scissor.offset[1] *= draw_resolution_scale_y;
+    scissor.extent[0] *= draw_resolution_scale_x;
+    scissor.extent[1] *= draw_resolution_scale_y;
+    last_draw_viewport.draw_state_register_write_count =
+        draw_state_register_write_count;
+    last_draw_viewport.convert_z_to_float24 = convert_z_to_float24;
+    last_draw_viewport.pixel_shader_writes_depth = pixel_shader_writes_depth;
+    last_draw_viewport.valid = true;
+  }
+  const draw_util::ViewportInfo& viewport_info =
+      last_draw_viewport.viewport_info;
 
   // Update viewport, scissor, blend factor and stencil reference.
-  UpdateFixedFunctionState(viewport_info, scissor, primitive_polygonal,
-                           normalized_depth_control);
+  UpdateFixedFunctionState(viewport_info, last_draw_viewport.scissor,
+                           primitive_polygonal, normalized_depth_control);
 
   // Update system constants before uploading them.
   // TODO(Triang3l): With ROV, pass the disabled render target mask for safety.
@@ -2520,49 +2862,26 @@ bool D3D12CommandProcessor::IssueDraw(xenos::PrimitiveType primitive_type,
           false);
     }
     if (cvars::d3d12_readback_memexport) {
-      // Read the exported data on the CPU.
-      uint32_t memexport_total_size = 0;
+      // Read the exported data on the CPU in the end of the submission, once
+      // for all the draws exporting to the same memory (such as particle
+      // updates split into multiple draws), rather than occupying a readback
+      // buffer for every draw.
       for (const draw_util::MemExportRange& memexport_range :
            memexport_ranges_) {
-        memexport_total_size += memexport_range.size_bytes;
-      }
-      if (memexport_total_size != 0) {
-        ID3D12Resource* readback_buffer =
-            RequestReadbackBuffer(memexport_total_size);
-        if (readback_buffer != nullptr) {
-          shared_memory_->UseAsCopySource();
-          SubmitBarriers();
-          ID3D12Resource* shared_memory_buffer = shared_memory_->GetBuffer();
-          uint32_t readback_buffer_offset = 0;
-          for (const draw_util::MemExportRange& memexport_range :
-               memexport_ranges_) {
-            uint32_t memexport_range_size = memexport_range.size_bytes;
-            deferred_command_list_.D3DCopyBufferRegion(
-                readback_buffer, readback_buffer_offset, shared_memory_buffer,
-                memexport_range.base_address_dwords << 2, memexport_range_size);
-            readback_buffer_offset += memexport_range_size;
-          }
-          if (AwaitAllQueueOperationsCompletion()) {
-            D3D12_RANGE readback_range;
-            readback_range.Begin = 0;
-            readback_range.End = memexport_total_size;
-            void* readback_mapping;
-            if (SUCCEEDED(readback_buffer->Map(0, &readback_range,
-                                               &readback_mapping))) {
-              const uint8_t* readback_bytes =
-                  reinterpret_cast<const uint8_t*>(readback_mapping);
-              for (const draw_util::MemExportRange& memexport_range :
-                   memexport_ranges_) {
-                std::memcpy(memory_->TranslatePhysical(
-                                memexport_range.base_address_dwords << 2),
-                            readback_bytes, memexport_range.size_bytes);
-                readback_bytes += memexport_range.size_bytes;
-              }
-              D3D12_RANGE readback_write_range = {};
-              readback_buffer->Unmap(0, &readback_write_range);
-            }
+        bool range_reused = false;
+        for (draw_util::MemExportRange& readback_range :
+             memexport_readback_ranges_) {
+          if (readback_range.base_address_dwords ==
+              memexport_range.base_address_dwords) {
+            readback_range.size_bytes =
+                std::max(readback_range.size_bytes, memexport_range.size_bytes);
+            range_reused = true;
+            break;
           }
         }
+        if (!range_reused) {
+          memexport_readback_ranges_.push_back(memexport_range);
+        }
       }
     }
   }
@@ -2607,27 +2926,18 @@ bool D3D12CommandProcessor::IssueCopy() {
   if (cvars::d3d12_readback_resolve &&
       !texture_cache_->IsDrawResolutionScaled() && written_length) {
     // Read the resolved data on the CPU.
-    ID3D12Resource* readback_buffer = RequestReadbackBuffer(written_length);
-    if (readback_buffer != nullptr) {
+    Readback* readback = BeginReadback(written_length);
+    if (readback != nullptr) {
       shared_memory_->UseAsCopySource();
       SubmitBarriers();
       ID3D12Resource* shared_memory_buffer = shared_memory_->GetBuffer();
       deferred_command_list_.D3DCopyBufferRegion(
-          readback_buffer, 0, shared_memory_buffer, written_address,
+          readback->buffer, 0, shared_memory_buffer, written_address,
           written_length);
-      if (AwaitAllQueueOperationsCompletion()) {
-        D3D12_RANGE readback_range;
-        readback_range.Begin = 0;
-        readback_range.End = written_length;
-        void* readback_mapping;
-        if (SUCCEEDED(
-                readback_buffer->Map(0, &readback_range, &readback_mapping))) {
-          std::memcpy(memory_->TranslatePhysical(written_address),
-                      readback_mapping, written_length);
-          D3D12_RANGE readback_write_range = {};
-          readback_buffer->Unmap(0, &readback_write_range);
-        }
-      }
+      Readback::Range& readback_range = readback->ranges.emplace_back();
+      readback_range.address = written_address;
+      readback_range.length = written_length;
+      EndReadback(*readback);
     }
   }
   return true;
@@ -2681,6 +2991,8 @@ void D3D12CommandProcessor::CheckSubmissionFence(uint64_t await_submission) {
     return;
   }
 
+  ReportCompletedSubmissionStatistics(submission_completed_before);
+
   // Reclaim command allocators.
   while (command_allocator_submitted_first_) {
     if (command_allocator_submitted_first_->last_usage_submission >
@@ -2731,6 +3043,44 @@ void D3D12CommandProcessor::CheckSubmissionFence(uint64_t await_submission) {
   texture_cache_->CompletedSubmissionUpdated(submission_completed_);
 }
 
+void D3D12CommandProcessor::ReportCompletedSubmissionStatistics(
+    uint64_t submission_completed_before) {
+  const uint64_t* timestamps = nullptr;
+  if (timestamp_query_readback_buffer_) {
+    D3D12_RANGE timestamp_read_range;
+    timestamp_read_range.Begin = 0;
+    timestamp_read_range.End =
+        sizeof(uint64_t) * 2 * kTimestampQuerySubmissions;
+    void* timestamp_mapping;
+    if (SUCCEEDED(timestamp_query_readback_buffer_->Map(
+            0, &timestamp_read_range, &timestamp_mapping))) {
+      timestamps = reinterpret_cast<const uint64_t*>(timestamp_mapping);
+    }
+  }
+  for (uint64_t submission = submission_completed_before + 1;
+       submission <= submission_completed_; ++submission) {
+    uint64_t gpu_time_ns = GpuStatistics::kGpuTimeUnknown;
+    uint32_t timestamp_query_pair =
+        uint32_t(submission % kTimestampQuerySubmissions);
+    if (timestamps &&
+        timestamp_query_submissions_[timestamp_query_pair] == submission) {
+      uint64_t timestamp_begin = timestamps[2 * timestamp_query_pair];
+      uint64_t timestamp_end = timestamps[2 * timestamp_query_pair + 1];
+      if (timestamp_end >= timestamp_begin) {
+        gpu_time_ns = uint64_t(double(timestamp_end - timestamp_begin) *
+                               1000000000.0 / double(timestamp_frequency_));
+        Profiler::AddGpuZone(profiler_gpu_timeline_, "Submission",
+                             int64_t(timestamp_begin), int64_t(timestamp_end));
+      }
+    }
+    statistics_.SubmissionCompleted(submission, gpu_time_ns);
+  }
+  if (timestamps) {
+    D3D12_RANGE timestamp_write_range = {};
+    timestamp_query_readback_buffer_->Unmap(0, &timestamp_write_range);
+  }
+}
+
 bool D3D12CommandProcessor::BeginSubmission(bool is_guest_command) {
 #if XE_UI_D3D12_FINE_GRAINED_DRAW_SCOPES
   SCOPE_profile_cpu_f("gpu");
@@ -2809,15 +3159,23 @@ bool D3D12CommandProcessor::BeginSubmission(bool is_guest_command) {
 
     render_target_cache_->BeginSubmission();
 
+    shared_memory_->AllocatePredictedHostGpuMemory();
+
     primitive_processor_->BeginSubmission();
 
     texture_cache_->BeginSubmission(submission_current_);
+
+    // Continue counting the samples for the occlusion query.
+    if (occlusion_query_active_) {
+      BeginOcclusionQueryHost();
+    }
   }
 
   if (is_opening_frame) {
     frame_open_ = true;
 
     // Reset bindings that depend on the data stored in the pools.
+    float_constant_upload_cache_.Reset();
     std::memset(current_float_constant_map_vertex_, 0,
                 sizeof(current_float_constant_map_vertex_));
     std::memset(current_float_constant_map_pixel_, 0,
@@ -2889,6 +3247,11 @@ bool D3D12CommandProcessor::EndSubmission(bool is_swap) {
     command_allocator_writable_last_ = command_allocator_writable_first_;
   }
 
+  // Before closing the frame, as this may begin the submission.
+  if (submission_open_) {
+    ReadBackMemExportRanges();
+  }
+
   bool is_closing_frame = is_swap && frame_open_;
 
   if (is_closing_frame) {
@@ -2900,7 +3263,17 @@ bool D3D12CommandProcessor::EndSubmission(bool is_swap) {
   if (submission_open_) {
     assert_false(scratch_buffer_used_);
 
+    // Host queries can't span multiple command lists.
+    EndOcclusionQueryHost();
+
+    // Make sure the CPU writes to the GPU-written memory can be caught.
+    shared_memory_->CommitRangesWrittenByGpu();
+
+    uint64_t pipeline_wait_start_time = Clock::QueryHostTickCount();
     pipeline_cache_->EndSubmission();
+    statistics_.Add(GpuStatistics::Counter::kPipelineWaitMicros,
+                    (Clock::QueryHostTickCount() - pipeline_wait_start_time) *
+                        1000000 / Clock::QueryHostTickFrequency());
 
     // Submit barriers now because resources with the queued barriers may be
     // destroyed between frames.
@@ -2917,7 +3290,30 @@ bool D3D12CommandProcessor::EndSubmission(bool is_swap) {
         command_allocator_writable_first_->command_allocator;
     command_allocator->Reset();
     command_list_->Reset(command_allocator, nullptr);
+    uint32_t timestamp_query_pair = UINT32_MAX;
+    if (timestamp_query_heap_) {
+      uint32_t timestamp_query_pair_current =
+          uint32_t(submission_current_ % kTimestampQuerySubmissions);
+      if (timestamp_query_submissions_[timestamp_query_pair_current] <=
+          submission_completed_) {
+        timestamp_query_pair = timestamp_query_pair_current;
+        timestamp_query_submissions_[timestamp_query_pair] =
+            submission_current_;
+        command_list_->EndQuery(timestamp_query_heap_,
+                                D3D12_QUERY_TYPE_TIMESTAMP,
+                                2 * timestamp_query_pair);
+      }
+    }
     deferred_command_list_.Execute(command_list_, command_list_1_);
+    if (timestamp_query_pair != UINT32_MAX) {
+      command_list_->EndQuery(timestamp_query_heap_,
+                              D3D12_QUERY_TYPE_TIMESTAMP,
+                              2 * timestamp_query_pair + 1);
+      command_list_->ResolveQueryData(
+          timestamp_query_heap_, D3D12_QUERY_TYPE_TIMESTAMP,
+          2 * timestamp_query_pair, 2, timestamp_query_readback_buffer_,
+          sizeof(uint64_t) * 2 * timestamp_query_pair);
+    }
     command_list_->Close();
     ID3D12CommandList* execute_command_lists[] = {command_list_};
     direct_queue->ExecuteCommandLists(1, execute_command_lists);
@@ -2938,6 +3334,38 @@ bool D3D12CommandProcessor::EndSubmission(bool is_swap) {
 
     direct_queue->Signal(submission_fence_, submission_current_++);
 
+    statistics_.SetTotal(GpuStatistics::Counter::kEdramTransfers,
+                         render_target_cache_->edram_transfers_total());
+    statistics_.SetTotal(GpuStatistics::Counter::kTextureLoads,
+                         texture_cache_->texture_loads_total());
+    statistics_.SetTotal(GpuStatistics::Counter::kTextureLoadBytes,
+                         texture_cache_->texture_load_bytes_total());
+    statistics_.SetTotal(GpuStatistics::Counter::kUploadBytes,
+                         shared_memory_->upload_bytes_total());
+    statistics_.SetTotal(GpuStatistics::Counter::kUploadBytesWasted,
+                         shared_memory_->upload_bytes_wasted_total() +
+                             constant_buffer_pool_->wasted_bytes_total());
+    statistics_.SetTotal(
+        GpuStatistics::Counter::kSharedMemoryAllocations,
+        shared_memory_->host_gpu_memory_sparse_allocations_total());
+    statistics_.SetTotal(
+        GpuStatistics::Counter::kSharedMemoryAllocatedBytes,
+        shared_memory_->host_gpu_memory_sparse_allocated_bytes_total());
+    statistics_.SetTotal(
+        GpuStatistics::Counter::kSharedMemoryPredictedBytes,
+        shared_memory_->host_gpu_memory_sparse_predicted_bytes_total());
+    statistics_.SetTotal(GpuStatistics::Counter::kPipelinesCreated,
+                         pipeline_cache_->pipelines_created_total());
+    statistics_.SetGauge(GpuStatistics::Gauge::kTextureMemoryBytes,
+                         texture_cache_->textures_total_host_memory_usage());
+    statistics_.SetGauge(GpuStatistics::Gauge::kTextureMemoryLimitSoftBytes,
+                         texture_cache_->memory_limit_soft());
+    statistics_.SetGauge(GpuStatistics::Gauge::kTextureMemoryLimitHardBytes,
+                         texture_cache_->memory_limit_hard());
+    statistics_.SetGauge(GpuStatistics::Gauge::kPipelinesPending,
+                         pipeline_cache_->GetCreatingPipelineCount());
+    statistics_.EndSubmission(submission_current_ - 1);
+
     submission_open_ = false;
 
     // Queue operations done directly (like UpdateTileMappings) will be awaited
@@ -2958,6 +3386,7 @@ bool D3D12CommandProcessor::EndSubmission(bool is_swap) {
     // Submission already closed now, so minus 1.
     closed_frame_submissions_[(frame_current_++) % kQueueFrames] =
         submission_current_ - 1;
+    statistics_.EndFrame();
 
     if (cache_clear_requested_ && AwaitAllQueueOperationsCompletion()) {
       cache_clear_requested_ = false;
@@ -3694,65 +4123,21 @@ bool D3D12CommandProcessor::UpdateBindings(const D3D12Shader* vertex_shader,
         ~(1u << root_parameter_system_constants);
   }
   if (!cbuffer_binding_float_vertex_.up_to_date) {
-    // Even if the shader doesn't need any float constants, a valid binding must
-    // still be provided, so if the first draw in the frame with the current
-    // root signature doesn't have float constants at all, still allocate an
-    // empty buffer.
-    uint8_t* float_constants = constant_buffer_pool_->Request(
-        frame_current_,
-        sizeof(float) * 4 * std::max(float_constant_count_vertex, uint32_t(1)),
-        D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT, nullptr, nullptr,
-        &cbuffer_binding_float_vertex_.address);
-    if (float_constants == nullptr) {
+    float_constant_upload_cache_.Gather(regs, XE_GPU_REG_SHADER_CONSTANT_000_X,
+                                        current_float_constant_map_vertex_);
+    if (!UploadGatheredFloatConstants(cbuffer_binding_float_vertex_.address)) {
       return false;
     }
-    for (uint32_t i = 0; i < 4; ++i) {
-      uint64_t float_constant_map_entry =
-          float_constant_map_vertex.float_bitmap[i];
-      uint32_t float_constant_index;
-      while (xe::bit_scan_forward(float_constant_map_entry,
-                                  &float_constant_index)) {
-        float_constant_map_entry &= ~(1ull << float_constant_index);
-        std::memcpy(float_constants,
-                    &regs[XE_GPU_REG_SHADER_CONSTANT_000_X + (i << 8) +
-                          (float_constant_index << 2)]
-                         .f32,
-                    4 * sizeof(float));
-        float_constants += 4 * sizeof(float);
-      }
-    }
     cbuffer_binding_float_vertex_.up_to_date = true;
     current_graphics_root_up_to_date_ &=
         ~(1u << root_parameter_float_constants_vertex);
   }
   if (!cbuffer_binding_float_pixel_.up_to_date) {
-    uint8_t* float_constants = constant_buffer_pool_->Request(
-        frame_current_,
-        sizeof(float) * 4 * std::max(float_constant_count_pixel, uint32_t(1)),
-        D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT, nullptr, nullptr,
-        &cbuffer_binding_float_pixel_.address);
-    if (float_constants == nullptr) {
+    float_constant_upload_cache_.Gather(regs, XE_GPU_REG_SHADER_CONSTANT_256_X,
+                                        current_float_constant_map_pixel_);
+    if (!UploadGatheredFloatConstants(cbuffer_binding_float_pixel_.address)) {
       return false;
     }
-    if (pixel_shader != nullptr) {
-      const Shader::ConstantRegisterMap& float_constant_map_pixel =
-          pixel_shader->constant_register_map();
-      for (uint32_t i = 0; i < 4; ++i) {
-        uint64_t float_constant_map_entry =
-            float_constant_map_pixel.float_bitmap[i];
-        uint32_t float_constant_index;
-        while (xe::bit_scan_forward(float_constant_map_entry,
-                                    &float_constant_index)) {
-          float_constant_map_entry &= ~(1ull << float_constant_index);
-          std::memcpy(float_constants,
-                      &regs[XE_GPU_REG_SHADER_CONSTANT_256_X + (i << 8) +
-                            (float_constant_index << 2)]
-                           .f32,
-                      4 * sizeof(float));
-          float_constants += 4 * sizeof(float);
-        }
-      }
-    }
     cbuffer_binding_float_pixel_.up_to_date = true;
     current_graphics_root_up_to_date_ &=
         ~(1u << root_parameter_float_constants_pixel);
@@ -4430,12 +4815,45 @@ bool D3D12CommandProcessor::UpdateBindings(const D3D12Shader* vertex_shader,
   return true;
 }
 
-ID3D12Resource* D3D12CommandProcessor::RequestReadbackBuffer(uint32_t size) {
+bool D3D12CommandProcessor::UploadGatheredFloatConstants(
+    D3D12_GPU_VIRTUAL_ADDRESS& address_out) {
+  const D3D12_GPU_VIRTUAL_ADDRESS* uploaded_address =
+      float_constant_upload_cache_.FindGathered();
+  if (uploaded_address) {
+    address_out = *uploaded_address;
+    return true;
+  }
+  // Even if the shader doesn't need any float constants, a valid binding must
+  // still be provided, so if the first draw in the frame with the current root
+  // signature doesn't have float constants at all, still allocate an empty
+  // buffer.
+  size_t float_constants_size = float_constant_upload_cache_.gathered_size();
+  uint8_t* float_constants = constant_buffer_pool_->Request(
+      frame_current_, std::max(float_constants_size, sizeof(float) * 4),
+      D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT, nullptr, nullptr,
+      &address_out);
+  if (float_constants == nullptr) {
+    return false;
+  }
+  std::memcpy(float_constants, float_constant_upload_cache_.gathered(),
+              float_constants_size);
+  float_constant_upload_cache_.AddGathered(address_out);
+  return true;
+}
+
+D3D12CommandProcessor::Readback* D3D12CommandProcessor::BeginReadback(
+    uint32_t size) {
   if (size == 0) {
     return nullptr;
   }
+  Readback& readback = readbacks_[readback_next_];
+  // The oldest readback in the ring - write its data before reusing the buffer.
+  CompleteReadback(readback);
+  if (!BeginSubmission(true)) {
+    return nullptr;
+  }
   size = xe::align(size, kReadbackBufferSizeIncrement);
-  if (size > readback_buffer_size_) {
+  if (size > readback.buffer_size) {
     const ui::d3d12::D3D12Provider& provider = GetD3D12Provider();
     ID3D12Device* device = provider.GetDevice();
     D3D12_RESOURCE_DESC buffer_desc;
@@ -4449,12 +4867,157 @@ ID3D12Resource* D3D12CommandProcessor::RequestReadbackBuffer(uint32_t size) {
       XELOGE("Failed to create a {} MB readback buffer", size >> 20);
       return nullptr;
     }
-    if (readback_buffer_ != nullptr) {
-      readback_buffer_->Release();
+    if (readback.buffer != nullptr) {
+      readback.buffer->Release();
+    }
+    readback.buffer = buffer;
+    readback.buffer_size = size;
+  }
+  readback.ranges.clear();
+  readback_next_ = (readback_next_ + 1) % kReadbackRingSize;
+  return &readback;
+}
+
+void D3D12CommandProcessor::EndReadback(Readback& readback) {
+  readback.submission = submission_current_;
+  // Storing the handles in the global critical region so the callbacks can't
+  // be invoked for the ranges before that.
+  auto global_lock = xe::global_critical_region::AcquireDirect();
+  for (size_t i = 0; i < readback.ranges.size(); ++i) {
+    Readback::Range& range = readback.ranges[i];
+    range.cpu_written = false;
+    range.watch = shared_memory_->WatchMemoryRange(
+        range.address, range.length, ReadbackRangeWatchCallback, this,
+        &readback, uint64_t(i));
+  }
+}
+
+void D3D12CommandProcessor::ReadBackMemExportRanges() {
+  if (memexport_readback_ranges_.empty()) {
+    return;
+  }
+  // Merge the overlapping ranges so the data is copied only once.
+  std::sort(memexport_readback_ranges_.begin(),
+            memexport_readback_ranges_.end(),
+            [](const draw_util::MemExportRange& a,
+               const draw_util::MemExportRange& b) {
+              return a.base_address_dwords < b.base_address_dwords;
+            });
+  size_t merged_range_count = 0;
+  uint32_t memexport_total_size = 0;
+  for (const draw_util::MemExportRange& memexport_range :
+       memexport_readback_ranges_) {
+    uint32_t range_start = memexport_range.base_address_dwords << 2;
+    if (merged_range_count) {
+      draw_util::MemExportRange& merged_range =
+          memexport_readback_ranges_[merged_range_count - 1];
+      uint32_t merged_range_start = merged_range.base_address_dwords << 2;
+      uint32_t merged_range_end = merged_range_start + merged_range.size_bytes;
+      if (range_start <= merged_range_end) {
+        uint32_t range_end = range_start + memexport_range.size_bytes;
+        if (range_end > merged_range_end) {
+          memexport_total_size += range_end - merged_range_end;
+          merged_range.size_bytes = range_end - merged_range_start;
+        }
+        continue;
+      }
+    }
+    memexport_readback_ranges_[merged_range_count++] = memexport_range;
+    memexport_total_size += memexport_range.size_bytes;
+  }
+  memexport_readback_ranges_.resize(merged_range_count,
+                                    draw_util::MemExportRange(0, 0));
+  Readback* readback = BeginReadback(memexport_total_size);
+  if (readback != nullptr) {
+    shared_memory_->UseAsCopySource();
+    SubmitBarriers();
+    ID3D12Resource* shared_memory_buffer = shared_memory_->GetBuffer();
+    uint32_t readback_buffer_offset = 0;
+    for (const draw_util::MemExportRange& memexport_range :
+         memexport_readback_ranges_) {
+      uint32_t memexport_range_address = memexport_range.base_address_dwords
+                                         << 2;
+      uint32_t memexport_range_size = memexport_range.size_bytes;
+      deferred_command_list_.D3DCopyBufferRegion(
+          readback->buffer, readback_buffer_offset, shared_memory_buffer,
+          memexport_range_address, memexport_range_size);
+      readback_buffer_offset += memexport_range_size;
+      Readback::Range& readback_range = readback->ranges.emplace_back();
+      readback_range.address = memexport_range_address;
+      readback_range.length = memexport_range_size;
+    }
+    EndReadback(*readback);
+  }
+  memexport_readback_ranges_.clear();
+}
+
+void D3D12CommandProcessor::CompleteReadback(Readback& readback) {
+  uint64_t submission = readback.submission;
+  if (!submission) {
+    return;
+  }
+  readback.submission = 0;
+  CheckSubmissionFence(submission);
+  {
+    auto global_lock = xe::global_critical_region::AcquireDirect();
+    for (Readback::Range& range : readback.ranges) {
+      if (range.watch) {
+        shared_memory_->UnwatchMemoryRange(range.watch);
+        range.watch = nullptr;
+      }
+    }
+  }
+  if (submission_completed_ < submission) {
+    // Failed to await, such as because of the device removal.
+    return;
+  }
+  uint32_t readback_size = 0;
+  for (const Readback::Range& range : readback.ranges) {
+    readback_size += range.length;
+  }
+  D3D12_RANGE readback_range;
+  readback_range.Begin = 0;
+  readback_range.End = readback_size;
+  void* readback_mapping;
+  if (FAILED(readback.buffer->Map(0, &readback_range, &readback_mapping))) {
+    return;
+  }
+  const uint8_t* readback_bytes =
+      reinterpret_cast<const uint8_t*>(readback_mapping);
+  readbacks_writing_guest_memory_ = true;
+  for (const Readback::Range& range : readback.ranges) {
+    if (!range.cpu_written) {
+      std::memcpy(memory_->TranslatePhysical(range.address), readback_bytes,
+                  range.length);
     }
-    readback_buffer_ = buffer;
+    readback_bytes += range.length;
+  }
+  readbacks_writing_guest_memory_ = false;
+  D3D12_RANGE readback_write_range = {};
+  readback.buffer->Unmap(0, &readback_write_range);
+}
+
+void D3D12CommandProcessor::CompleteReadbacks() {
+  // Including the data exported in the current submission.
+  ReadBackMemExportRanges();
+  // From the oldest to the newest, so the newer data is written last.
+  for (uint32_t i = 0; i < kReadbackRingSize; ++i) {
+    CompleteReadback(readbacks_[(readback_next_ + i) % kReadbackRingSize]);
+  }
+}
+
+void D3D12CommandProcessor::ReadbackRangeWatchCallback(
+    const std::unique_lock<std::recursive_mutex>& global_lock, void* context,
+    void* data, uint64_t argument, bool invalidated_by_gpu) {
+  auto& command_processor = *static_cast<D3D12CommandProcessor*>(context);
+  Readback::Range& range =
+      static_cast<Readback*>(data)->ranges[size_t(argument)];
+  range.watch = nullptr;
+  // Newer GPU data, if needed on the CPU, is read back by a later readback.
+  if (!invalidated_by_gpu &&
+      !command_processor.readbacks_writing_guest_memory_) {
+    range.cpu_written = true;
   }
-  return readback_buffer_;
 }
 
 void D3D12CommandProcessor::WriteGammaRampSRV(
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "xenia/base/assert.h"
+#include "xenia/base/profiling.h"
 #include "xenia/gpu/command_processor.h"
 #include "xenia/gpu/d3d12/d3d12_graphics_system.h"
 #include "xenia/gpu/d3d12/d3d12_primitive_processor.h"
@@ -32,6 +33,7 @@
 #include "xenia/gpu/draw_util.h"
 #include "xenia/gpu/dxbc_shader.h"
 #include "xenia/gpu/dxbc_shader_translator.h"
+#include "xenia/gpu/float_constant_upload_cache.h"
 #include "xenia/gpu/registers.h"
 #include "xenia/gpu/xenos.h"
 #include "xenia/kernel/kernel_state.h"
@@ -214,11 +216,21 @@ class D3D12CommandProcessor : public CommandProcessor {
   bool SetupContext() override;
   void ShutdownContext() override;
 
-  void WriteRegister(uint32_t index, uint32_t value) override;
+  void OnShaderConstantsWritten(uint32_t first_index, uint32_t count) override;
 
   void OnGammaRamp256EntryTableValueWritten() override;
   void OnGammaRampPWLValueWritten() override;
 
+  void PrepareForWait() override;
+  void PrepareForCpuSync() override;
+
+  bool IsOcclusionQueryHostSupported() const override {
+    return occlusion_query_heap_ != nullptr;
+  }
+  bool BeginOcclusionQuery() override;
+  void EndOcclusionQuery() override;
+  bool GetOcclusionQueryResult(bool await, uint64_t& sample_count_out) override;
+
   void IssueSwap(uint32_t frontbuffer_ptr, uint32_t frontbuffer_width,
                  uint32_t frontbuffer_height) override;
 
@@ -327,6 +339,10 @@ class D3D12CommandProcessor : public CommandProcessor {
   // the submission to await to simply check status, or pass submission_current_
   // to wait for all queue operations to be completed.
   void CheckSubmissionFence(uint64_t await_submission);
+  // Passes the host GPU times of the submissions completed since the specified
+  // one to the statistics.
+  void ReportCompletedSubmissionStatistics(
+      uint64_t submission_completed_before);
   // If is_guest_command is true, a new full frame - with full cleanup of
   // resources and, if needed, starting capturing - is opened if pending (as
   // opposed to simply resuming after mid-frame synchronization). Returns
@@ -378,10 +394,71 @@ class D3D12CommandProcessor : public CommandProcessor {
                       const D3D12Shader* pixel_shader,
                       ID3D12RootSignature* root_signature,
                       bool shared_memory_is_uav);
-
-  // Returns a buffer for reading GPU data back to the CPU. Assuming
-  // synchronizing immediately after use. Always in COPY_DEST state.
-  ID3D12Resource* RequestReadbackBuffer(uint32_t size);
+  // Uploads the float constants gathered in float_constant_upload_cache_, or
+  // returns an identical block uploaded earlier in the frame.
+  bool UploadGatheredFloatConstants(D3D12_GPU_VIRTUAL_ADDRESS& address_out);
+
+  // Asynchronous reading of GPU-written data back to the guest memory. The
+  // copies are written to a ring of readback buffers, and the data is written
+  // to the guest memory when the guest may expect it to be available - before
+  // the command processor reports its progress to the guest, or when it's idle
+  // - or when the buffer is reused. Ranges written by the CPU in the meantime,
+  // detected through shared memory watches, are not overwritten with the older
+  // GPU data.
+  struct Readback {
+    struct Range {
+      uint32_t address;
+      uint32_t length;
+      // nullptr if already triggered.
+      SharedMemory::WatchHandle watch = nullptr;
+      bool cpu_written = false;
+    };
+    // Always in COPY_DEST state.
+    ID3D12Resource* buffer = nullptr;
+    uint32_t buffer_size = 0;
+    // Submission with the copies to the buffer, 0 if not pending.
+    uint64_t submission = 0;
+    // In the order of the data in the buffer.
+    std::vector<Range> ranges;
+  };
+  static constexpr uint32_t kReadbackRingSize = 4;
+  // Returns a buffer with no ranges to copy the data to - the copy commands
+  // must be recorded and the ranges added, and EndReadback called. May submit
+  // and begin a new submission if the buffer needs to be awaited.
+  Readback* BeginReadback(uint32_t size);
+  void EndReadback(Readback& readback);
+  // Awaits the GPU and writes the data if the readback is pending.
+  void CompleteReadback(Readback& readback);
+  void CompleteReadbacks();
+  // Copies memexport_readback_ranges_, merged, to a readback buffer, and
+  // clears them.
+  void ReadBackMemExportRanges();
+  static void ReadbackRangeWatchCallback(
+      const std::unique_lock<std::recursive_mutex>& global_lock, void* context,
+      void* data, uint64_t argument, bool invalidated_by_gpu);
+
+  // Host queries can't span multiple command lists, so a guest-visible
+  // occlusion query is split into multiple host queries at submission
+  // boundaries.
+  struct OcclusionQuery {
+    // Sum of the results of the host queries already read.
+    uint64_t sample_count = 0;
+    // Host queries not read yet, consecutive in the ring.
+    uint32_t host_query_first = 0;
+    uint32_t host_query_count = 0;
+    // The latest submission with the host queries.
+    uint64_t submission = 0;
+  };
+  // Frees a host query if all are in use, and begins the next one for the
+  // latest occlusion query. Submission must be open.
+  void BeginOcclusionQueryHost();
+  void EndOcclusionQueryHost();
+  // Awaits and accumulates the results of all the ended host queries of the
+  // occlusion query.
+  void ReadOcclusionQueryHostResults(OcclusionQuery& query);
+  // Reads the host queries of the oldest occlusion queries until a host query
+  // is free.
+  void FreeOcclusionQueryHost();
 
   void WriteGammaRampSRV(bool is_pwl, D3D12_CPU_DESCRIPTOR_HANDLE handle) const;
 
@@ -397,6 +474,29 @@ class D3D12CommandProcessor : public CommandProcessor {
   uint64_t submission_completed_ = 0;
   ID3D12Fence* submission_fence_ = nullptr;
 
+  // Timestamps in the beginning and in the end of submissions for measuring
+  // the host GPU time, in pairs of queries reused in a ring.
+  static constexpr uint32_t kTimestampQuerySubmissions = 64;
+  ID3D12QueryHeap* timestamp_query_heap_ = nullptr;
+  ID3D12Resource* timestamp_query_readback_buffer_ = nullptr;
+  uint64_t timestamp_frequency_ = 0;
+  uint8_t profiler_gpu_timeline_ = Profiler::kGpuTimelineInvalid;
+  // Submissions that have written to each pair of queries the latest, the pair
+  // is skipped if it's still in use by a submission in flight.
+  uint64_t timestamp_query_submissions_[kTimestampQuerySubmissions] = {};
+
+  static constexpr uint32_t kOcclusionQueryHostCount = 4096;
+  ID3D12QueryHeap* occlusion_query_heap_ = nullptr;
+  ID3D12Resource* occlusion_query_readback_buffer_ = nullptr;
+  // From the oldest, the last one is being counted if occlusion_query_active_.
+  std::deque<OcclusionQuery> occlusion_queries_;
+  bool occlusion_query_active_ = false;
+  // Whether a host query of the active occlusion query is being counted in the
+  // current submission.
+  bool occlusion_query_host_active_ = false;
+  uint32_t occlusion_query_host_next_ = 0;
+  uint32_t occlusion_query_host_used_ = 0;
+
   // For awaiting non-submission queue operations such as UpdateTileMappings in
   // AwaitAllQueueOperationsCompletion when they're queued after the latest
   // ExecuteCommandLists + Signal, thus won't be awaited by just awaiting the
@@ -580,8 +680,12 @@ class D3D12CommandProcessor : public CommandProcessor {
   bool scratch_buffer_used_ = false;
 
   static constexpr uint32_t kReadbackBufferSizeIncrement = 16 * 1024 * 1024;
-  ID3D12Resource* readback_buffer_ = nullptr;
-  uint32_t readback_buffer_size_ = 0;
+  Readback readbacks_[kReadbackRingSize];
+  // The oldest readback in the ring.
+  uint32_t readback_next_ = 0;
+  // Whether the readback data is being written to the guest memory, so the
+  // watches of the other readbacks don't consider it a CPU write.
+  bool readbacks_writing_guest_memory_ = false;
 
   std::atomic<bool> pix_capture_requested_ = false;
   bool pix_capturing_;
@@ -603,6 +707,41 @@ class D3D12CommandProcessor : public CommandProcessor {
   void* current_guest_pipeline_;
   ID3D12PipelineState* current_external_pipeline_;
 
+  // The inputs and the result of the pipeline configuration for the previous
+  // draw, for skipping it if nothing has changed.
+  struct LastDrawPipeline {
+    uint64_t pipeline_state_register_write_count;
+    const D3D12Shader::D3D12Translation* vertex_shader;
+    const D3D12Shader::D3D12Translation* pixel_shader;
+    xenos::PrimitiveType host_primitive_type;
+    Shader::HostVertexShaderType host_vertex_shader_type;
+    xenos::TessellationMode tessellation_mode;
+    xenos::IndexFormat host_index_format;
+    bool host_primitive_reset_enabled;
+    reg::RB_DEPTHCONTROL normalized_depth_control;
+    uint32_t normalized_color_mask;
+    uint32_t bound_depth_and_color_render_target_bits;
+    uint32_t bound_depth_and_color_render_target_formats
+        [1 + xenos::kMaxColorRenderTargets];
+    // nullptr if not available.
+    void* pipeline_handle = nullptr;
+    ID3D12RootSignature* root_signature;
+  };
+  LastDrawPipeline last_draw_pipeline_;
+
+  // The viewport and the scissor of the previous draw, for skipping their
+  // calculation if the registers and the other state they're derived from
+  // haven't changed.
+  struct LastDrawViewport {
+    uint64_t draw_state_register_write_count;
+    bool convert_z_to_float24;
+    bool pixel_shader_writes_depth;
+    bool valid = false;
+    draw_util::ViewportInfo viewport_info;
+    draw_util::Scissor scissor;
+  };
+  LastDrawViewport last_draw_viewport_;
+
   // Currently bound graphics root signature.
   ID3D12RootSignature* current_graphics_root_signature_;
   // Extra parameters which may or may not be present.
@@ -615,7 +754,12 @@ class D3D12CommandProcessor : public CommandProcessor {
 
   // Float constant usage masks of the last draw call.
   uint64_t current_float_constant_map_vertex_[4];
+  // Zero if there's no pixel shader.
   uint64_t current_float_constant_map_pixel_[4];
+  // Float constants uploaded in the current frame, for binding identical
+  // blocks again instead of uploading them once more.
+  FloatConstantUploadCache<D3D12_GPU_VIRTUAL_ADDRESS>
+      float_constant_upload_cache_;
 
   // Constant buffer bindings.
   struct ConstantBufferBinding {
@@ -681,6 +825,9 @@ class D3D12CommandProcessor : public CommandProcessor {
 
   // Temporary storage for memexport stream constants used in the draw.
   std::vector<draw_util::MemExportRange> memexport_ranges_;
+  // With --d3d12_readback_memexport, ranges exported by the draws in the
+  // current submission, read back once in the end of the submission.
+  std::vector<draw_util::MemExportRange> memexport_readback_ranges_;
 };
 
 }  // namespace d3d12
@@ -29,11 +29,9 @@ class D3D12GraphicsSystem : public GraphicsSystem {
 
   std::string name() const override;
 
-  X_STATUS Setup(cpu::Processor* processor, kernel::KernelState* kernel_state,
-                 ui::WindowedAppContext* app_context,
-                 bool is_surface_required) override;
-
  protected:
+  std::unique_ptr<ui::GraphicsProvider> CreateProvider(
+      bool is_surface_required) override;
   std::unique_ptr<CommandProcessor> CreateCommandProcessor() override;
 };
 
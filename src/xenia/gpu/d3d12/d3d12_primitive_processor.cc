@@ -79,7 +79,7 @@ void D3D12PrimitiveProcessor::BeginFrame() {
 }
 
 void D3D12PrimitiveProcessor::EndFrame() {
-  ClearPerFrameCache();
+  EndCacheFrame();
   frame_index_buffers_.clear();
 }
 
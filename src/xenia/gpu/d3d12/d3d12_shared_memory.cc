@@ -26,6 +26,16 @@ DEFINE_bool(d3d12_tiled_shared_memory, true,
             "but allows graphics debuggers that don't support tiled resources "
             "to work.",
             "D3D12");
+DEFINE_bool(
+    d3d12_shared_memory_host_import, false,
+    "Open the guest physical memory as a Direct3D 12 heap if supported, and "
+    "upload invalidated guest memory to the GPU by copying it on the GPU "
+    "directly from there rather than through intermediate upload buffers "
+    "written by the CPU. Reduces the CPU time spent on uploads, but the data "
+    "is read by the GPU when the copy is executed rather than when it is "
+    "requested, so a game modifying the memory right after submitting a draw "
+    "using it may cause corruption.",
+    "D3D12");
 
 namespace xe {
 namespace gpu {
@@ -153,6 +163,18 @@ bool D3D12SharedMemory::Initialize() {
           uint32_t(BufferDescriptorIndex::kR32G32B32A32UintUAV)),
       buffer_, DXGI_FORMAT_R32G32B32A32_UINT, kBufferSize >> 4);
 
+  if (cvars::d3d12_shared_memory_host_import) {
+    if (InitializeHostImport()) {
+      XELOGGPU(
+          "Shared memory: Uploading directly from the guest physical memory "
+          "opened as a heap");
+    } else {
+      XELOGGPU(
+          "Shared memory: Failed to open the guest physical memory as a heap, "
+          "using upload buffers");
+    }
+  }
+
   upload_buffer_pool_ = std::make_unique<ui::d3d12::D3D12UploadBufferPool>(
       provider, xe::align(ui::d3d12::D3D12UploadBufferPool::kDefaultPageSize,
                           size_t(1) << page_size_log2()));
@@ -165,6 +187,9 @@ void D3D12SharedMemory::Shutdown(bool from_destructor) {
 
   upload_buffer_pool_.reset();
 
+  ui::d3d12::util::ReleaseAndNull(host_import_buffer_);
+  ui::d3d12::util::ReleaseAndNull(host_import_heap_);
+
   ui::d3d12::util::ReleaseAndNull(buffer_descriptor_heap_);
 
   // First free the buffer to detach it from the heaps.
@@ -413,6 +438,19 @@ bool D3D12SharedMemory::UploadRanges(
   CommitUAVWritesAndTransitionBuffer(D3D12_RESOURCE_STATE_COPY_DEST);
   command_processor_.SubmitBarriers();
   auto& command_list = command_processor_.GetDeferredCommandList();
+  if (host_import_buffer_) {
+    // The guest memory is already accessible by the GPU, only copying.
+    for (auto upload_range : upload_page_ranges) {
+      uint32_t upload_range_start = upload_range.first << page_size_log2();
+      uint32_t upload_range_length = upload_range.second << page_size_log2();
+      trace_writer_.WriteMemoryRead(upload_range_start, upload_range_length);
+      MakeRangeValid(upload_range_start, upload_range_length, false, false);
+      command_list.D3DCopyBufferRegion(buffer_, upload_range_start,
+                                       host_import_buffer_, upload_range_start,
+                                       upload_range_length);
+    }
+    return true;
+  }
   for (auto upload_range : upload_page_ranges) {
     uint32_t upload_range_start = upload_range.first;
     uint32_t upload_range_length = upload_range.second;
@@ -448,6 +486,38 @@ bool D3D12SharedMemory::UploadRanges(
   return true;
 }
 
+bool D3D12SharedMemory::InitializeHostImport() {
+  const ui::d3d12::D3D12Provider& provider =
+      command_processor_.GetD3D12Provider();
+  ID3D12Device3* device_3;
+  if (FAILED(provider.GetDevice()->QueryInterface(IID_PPV_ARGS(&device_3)))) {
+    return false;
+  }
+  // The whole view of the physical memory is opened, which begins at the
+  // guest physical address 0.
+  HRESULT open_result = device_3->OpenExistingHeapFromAddress(
+      memory().TranslatePhysical(0), IID_PPV_ARGS(&host_import_heap_));
+  device_3->Release();
+  if (FAILED(open_result)) {
+    return false;
+  }
+  if (host_import_heap_->GetDesc().SizeInBytes < kBufferSize) {
+    ui::d3d12::util::ReleaseAndNull(host_import_heap_);
+    return false;
+  }
+  // Heaps opened from an address are cross-adapter.
+  D3D12_RESOURCE_DESC buffer_desc;
+  ui::d3d12::util::FillBufferResourceDesc(
+      buffer_desc, kBufferSize, D3D12_RESOURCE_FLAG_ALLOW_CROSS_ADAPTER);
+  if (FAILED(provider.GetDevice()->CreatePlacedResource(
+          host_import_heap_, 0, &buffer_desc, D3D12_RESOURCE_STATE_COPY_SOURCE,
+          nullptr, IID_PPV_ARGS(&host_import_buffer_)))) {
+    ui::d3d12::util::ReleaseAndNull(host_import_heap_);
+    return false;
+  }
+  return true;
+}
+
 }  // namespace d3d12
 }  // namespace gpu
 }  // namespace xe
@@ -42,6 +42,10 @@ class D3D12SharedMemory : public SharedMemory {
     return buffer_gpu_address_;
   }
 
+  uint64_t upload_bytes_wasted_total() const {
+    return upload_buffer_pool_ ? upload_buffer_pool_->wasted_bytes_total() : 0;
+  }
+
   void CompletedSubmissionUpdated();
   void BeginSubmission();
 
@@ -125,6 +129,13 @@ class D3D12SharedMemory : public SharedMemory {
 
   std::unique_ptr<ui::d3d12::D3D12UploadBufferPool> upload_buffer_pool_;
 
+  // The guest physical memory opened as a heap via OpenExistingHeapFromAddress,
+  // if supported, with a buffer used as the source of uploads instead of
+  // upload_buffer_pool_ (see --d3d12_shared_memory_host_import).
+  ID3D12Heap* host_import_heap_ = nullptr;
+  ID3D12Resource* host_import_buffer_ = nullptr;
+  bool InitializeHostImport();
+
   // Created temporarily, only for downloading.
   ID3D12Resource* trace_download_buffer_ = nullptr;
   void ResetTraceDownload();
@@ -720,6 +720,32 @@ void D3D12TextureCache::ClearCache() {
   srv_descriptor_cache_.clear();
 }
 
+void D3D12TextureCache::CompletedSubmissionUpdated(
+    uint64_t completed_submission_index) {
+  TextureCache::CompletedSubmissionUpdated(completed_submission_index);
+
+  while (!storage_readbacks_.empty()) {
+    StorageReadback& readback = storage_readbacks_.front();
+    if (readback.submission > completed_submission_index) {
+      break;
+    }
+    D3D12_RANGE readback_range;
+    readback_range.Begin = 0;
+    readback_range.End = SIZE_T(readback.size);
+    void* readback_mapping;
+    if (SUCCEEDED(
+            readback.buffer->Map(0, &readback_range, &readback_mapping))) {
+      StoreTextureData(readback.storage_key, readback_mapping,
+                       size_t(readback.size));
+      D3D12_RANGE readback_write_range = {};
+      readback.buffer->Unmap(0, &readback_write_range);
+    } else {
+      XELOGE("Failed to map a texture storage readback buffer");
+    }
+    storage_readbacks_.pop_front();
+  }
+}
+
 void D3D12TextureCache::BeginSubmission(uint64_t new_submission_index) {
   TextureCache::BeginSubmission(new_submission_index);
 
@@ -983,6 +1009,9 @@ D3D12TextureCache::SamplerParameters D3D12TextureCache::GetSamplerParameters(
   texture_util::GetSubresourcesFromFetchConstant(fetch, nullptr, nullptr,
                                                  nullptr, nullptr, nullptr,
                                                  &mip_min_level, nullptr);
+  if (IsActiveTextureBaseDeferred(binding.fetch_constant)) {
+    mip_min_level = std::max(mip_min_level, UINT32_C(1));
+  }
   parameters.mip_min_level = mip_min_level;
 
   // TODO(Triang3l): Disable filtering for texture formats not supporting it.
@@ -2044,6 +2073,200 @@ bool D3D12TextureCache::LoadTextureDataFromResidentMemoryImpl(Texture& texture,
   return true;
 }
 
+bool D3D12TextureCache::CopyTextureDataFromDuplicateImpl(
+    Texture& texture, Texture& source_texture) {
+  D3D12Texture& d3d12_texture = static_cast<D3D12Texture&>(texture);
+  D3D12Texture& d3d12_source_texture =
+      static_cast<D3D12Texture&>(source_texture);
+
+  // Update LRU caching because the textures will be used by the command list.
+  d3d12_texture.MarkAsUsed();
+  d3d12_source_texture.MarkAsUsed();
+
+  // Textures with the same address-independent key have the same resource
+  // description, so the whole resource can be copied.
+  ID3D12Resource* texture_resource = d3d12_texture.resource();
+  ID3D12Resource* source_texture_resource = d3d12_source_texture.resource();
+  command_processor_.PushTransitionBarrier(
+      texture_resource,
+      d3d12_texture.SetResourceState(D3D12_RESOURCE_STATE_COPY_DEST),
+      D3D12_RESOURCE_STATE_COPY_DEST);
+  command_processor_.PushTransitionBarrier(
+      source_texture_resource,
+      d3d12_source_texture.SetResourceState(D3D12_RESOURCE_STATE_COPY_SOURCE),
+      D3D12_RESOURCE_STATE_COPY_SOURCE);
+  command_processor_.SubmitBarriers();
+  command_processor_.GetDeferredCommandList().D3DCopyResource(
+      texture_resource, source_texture_resource);
+
+  return true;
+}
+
+bool D3D12TextureCache::GetHostMemoryBudget(uint64_t& budget_out,
+                                            uint64_t& usage_out) const {
+  IDXGIAdapter3* dxgi_adapter_3 =
+      command_processor_.GetD3D12Provider().GetDXGIAdapter3();
+  if (!dxgi_adapter_3) {
+    return false;
+  }
+  DXGI_QUERY_VIDEO_MEMORY_INFO video_memory_info;
+  if (FAILED(dxgi_adapter_3->QueryVideoMemoryInfo(
+          0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &video_memory_info))) {
+    return false;
+  }
+  budget_out = video_memory_info.Budget;
+  usage_out = video_memory_info.CurrentUsage;
+  return true;
+}
+
+uint32_t D3D12TextureCache::GetStorageHostFormat(const Texture& texture) const {
+  return uint32_t(GetDXGIResourceFormat(texture.key()));
+}
+
+bool D3D12TextureCache::LoadTextureDataFromStorageImpl(Texture& texture,
+                                                       const uint8_t* data,
+                                                       size_t size) {
+  D3D12Texture& d3d12_texture = static_cast<D3D12Texture&>(texture);
+  std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts;
+  UINT64 storage_size = GetStorageLayout(d3d12_texture, layouts);
+  if (!storage_size || storage_size != size) {
+    return false;
+  }
+
+  D3D12_RESOURCE_STATES copy_buffer_state = D3D12_RESOURCE_STATE_COPY_DEST;
+  ID3D12Resource* copy_buffer = command_processor_.RequestScratchGPUBuffer(
+      uint32_t(storage_size), copy_buffer_state);
+  if (copy_buffer == nullptr) {
+    return false;
+  }
+  command_processor_.SubmitBarriers();
+  DeferredCommandList& command_list =
+      command_processor_.GetDeferredCommandList();
+  auto& upload_buffer_pool = command_processor_.GetConstantBufferPool();
+  UINT64 upload_offset = 0;
+  while (upload_offset < storage_size) {
+    ID3D12Resource* upload_buffer;
+    size_t upload_buffer_offset, upload_buffer_size;
+    uint8_t* upload_buffer_mapping = upload_buffer_pool.RequestPartial(
+        command_processor_.GetCurrentFrame(),
+        size_t(storage_size - upload_offset), 1, &upload_buffer,
+        &upload_buffer_offset, &upload_buffer_size, nullptr);
+    if (upload_buffer_mapping == nullptr) {
+      command_processor_.ReleaseScratchGPUBuffer(copy_buffer,
+                                                 copy_buffer_state);
+      return false;
+    }
+    std::memcpy(upload_buffer_mapping, data + upload_offset,
+                upload_buffer_size);
+    command_list.D3DCopyBufferRegion(copy_buffer, upload_offset, upload_buffer,
+                                     UINT64(upload_buffer_offset),
+                                     UINT64(upload_buffer_size));
+    upload_offset += upload_buffer_size;
+  }
+
+  // Update LRU caching because the texture will be used by the command list.
+  d3d12_texture.MarkAsUsed();
+
+  ID3D12Resource* texture_resource = d3d12_texture.resource();
+  command_processor_.PushTransitionBarrier(
+      texture_resource,
+      d3d12_texture.SetResourceState(D3D12_RESOURCE_STATE_COPY_DEST),
+      D3D12_RESOURCE_STATE_COPY_DEST);
+  command_processor_.PushTransitionBarrier(copy_buffer, copy_buffer_state,
+                                           D3D12_RESOURCE_STATE_COPY_SOURCE);
+  copy_buffer_state = D3D12_RESOURCE_STATE_COPY_SOURCE;
+  command_processor_.SubmitBarriers();
+  D3D12_TEXTURE_COPY_LOCATION location_source, location_dest;
+  location_source.pResource = copy_buffer;
+  location_source.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+  location_dest.pResource = texture_resource;
+  location_dest.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+  for (size_t i = 0; i < layouts.size(); ++i) {
+    location_source.PlacedFootprint = layouts[i];
+    location_dest.SubresourceIndex = UINT(i);
+    command_list.D3DCopyTextureRegion(&location_dest, 0, 0, 0,
+                                      &location_source, nullptr);
+  }
+
+  command_processor_.ReleaseScratchGPUBuffer(copy_buffer, copy_buffer_state);
+
+  return true;
+}
+
+void D3D12TextureCache::ReadBackTextureDataForStorageImpl(
+    Texture& texture, uint64_t storage_key) {
+  D3D12Texture& d3d12_texture = static_cast<D3D12Texture&>(texture);
+  std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts;
+  UINT64 storage_size = GetStorageLayout(d3d12_texture, layouts);
+  if (!storage_size) {
+    return;
+  }
+
+  const ui::d3d12::D3D12Provider& provider =
+      command_processor_.GetD3D12Provider();
+  ID3D12Device* device = provider.GetDevice();
+  StorageReadback readback;
+  D3D12_RESOURCE_DESC readback_buffer_desc;
+  ui::d3d12::util::FillBufferResourceDesc(readback_buffer_desc, storage_size,
+                                          D3D12_RESOURCE_FLAG_NONE);
+  if (FAILED(device->CreateCommittedResource(
+          &ui::d3d12::util::kHeapPropertiesReadback,
+          provider.GetHeapFlagCreateNotZeroed(), &readback_buffer_desc,
+          D3D12_RESOURCE_STATE_COPY_DEST, nullptr,
+          IID_PPV_ARGS(&readback.buffer)))) {
+    XELOGE("Failed to create a {} KB texture storage readback buffer",
+           storage_size >> 10);
+    return;
+  }
+
+  // Update LRU caching because the texture will be used by the command list.
+  d3d12_texture.MarkAsUsed();
+
+  ID3D12Resource* texture_resource = d3d12_texture.resource();
+  command_processor_.PushTransitionBarrier(
+      texture_resource,
+      d3d12_texture.SetResourceState(D3D12_RESOURCE_STATE_COPY_SOURCE),
+      D3D12_RESOURCE_STATE_COPY_SOURCE);
+  command_processor_.SubmitBarriers();
+  DeferredCommandList& command_list =
+      command_processor_.GetDeferredCommandList();
+  D3D12_TEXTURE_COPY_LOCATION location_source, location_dest;
+  location_source.pResource = texture_resource;
+  location_source.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+  location_dest.pResource = readback.buffer.Get();
+  location_dest.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+  for (size_t i = 0; i < layouts.size(); ++i) {
+    location_source.SubresourceIndex = UINT(i);
+    location_dest.PlacedFootprint = layouts[i];
+    command_list.D3DCopyTextureRegion(&location_dest, 0, 0, 0,
+                                      &location_source, nullptr);
+  }
+
+  readback.submission = command_processor_.GetCurrentSubmission();
+  readback.storage_key = storage_key;
+  readback.size = storage_size;
+  storage_readbacks_.push_back(std::move(readback));
+}
+
+UINT64 D3D12TextureCache::GetStorageLayout(
+    const D3D12Texture& texture,
+    std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT>& layouts_out) const {
+  D3D12_RESOURCE_DESC resource_desc = texture.resource()->GetDesc();
+  UINT subresource_count = UINT(resource_desc.MipLevels);
+  if (resource_desc.Dimension != D3D12_RESOURCE_DIMENSION_TEXTURE3D) {
+    subresource_count *= UINT(resource_desc.DepthOrArraySize);
+  }
+  layouts_out.resize(subresource_count);
+  UINT64 total_size = 0;
+  command_processor_.GetD3D12Provider().GetDevice()->GetCopyableFootprints(
+      &resource_desc, 0, subresource_count, 0, layouts_out.data(), nullptr,
+      nullptr, &total_size);
+  if (total_size == UINT64_MAX) {
+    return 0;
+  }
+  return total_size;
+}
+
 void D3D12TextureCache::UpdateTextureBindingsImpl(
     uint32_t fetch_constant_mask) {
   uint32_t bindings_remaining = fetch_constant_mask;
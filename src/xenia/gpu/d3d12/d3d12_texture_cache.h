@@ -11,6 +11,7 @@
 #define XENIA_GPU_D3D12_D3D12_TEXTURE_CACHE_H_
 
 #include <array>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <unordered_map>
@@ -89,6 +90,7 @@ class D3D12TextureCache final : public TextureCache {
 
   void ClearCache();
 
+  void CompletedSubmissionUpdated(uint64_t completed_submission_index) override;
   void BeginSubmission(uint64_t new_submission_index) override;
   void BeginFrame() override;
   void EndFrame();
@@ -176,6 +178,18 @@ class D3D12TextureCache final : public TextureCache {
   // This binds pipelines, allocates descriptors, and copies!
   bool LoadTextureDataFromResidentMemoryImpl(Texture& texture, bool load_base,
                                              bool load_mips) override;
+  bool CopyTextureDataFromDuplicateImpl(Texture& texture,
+                                        Texture& source_texture) override;
+
+  bool GetHostMemoryBudget(uint64_t& budget_out,
+                           uint64_t& usage_out) const override;
+
+  const char* GetStorageApiName() const override { return "d3d12"; }
+  uint32_t GetStorageHostFormat(const Texture& texture) const override;
+  bool LoadTextureDataFromStorageImpl(Texture& texture, const uint8_t* data,
+                                      size_t size) override;
+  void ReadBackTextureDataForStorageImpl(Texture& texture,
+                                         uint64_t storage_key) override;
 
   void UpdateTextureBindingsImpl(uint32_t fetch_constant_mask) override;
 
@@ -390,6 +404,12 @@ class D3D12TextureCache final : public TextureCache {
 
   LoadShaderIndex GetLoadShaderIndex(TextureKey key) const;
 
+  // Gets the layout of all the subresources of the texture in the persistent
+  // storage, as returned by GetCopyableFootprints, and returns the total size.
+  UINT64 GetStorageLayout(
+      const D3D12Texture& texture,
+      std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT>& layouts_out) const;
+
   static constexpr bool AreDimensionsCompatible(
       xenos::FetchOpDimension binding_dimension,
       xenos::DataDimension resource_dimension) {
@@ -479,6 +499,15 @@ class D3D12TextureCache final : public TextureCache {
   std::array<Microsoft::WRL::ComPtr<ID3D12PipelineState>, kLoadShaderCount>
       load_pipelines_scaled_;
 
+  // Textures being copied to the CPU for the persistent storage.
+  struct StorageReadback {
+    uint64_t submission;
+    uint64_t storage_key;
+    Microsoft::WRL::ComPtr<ID3D12Resource> buffer;
+    UINT64 size;
+  };
+  std::deque<StorageReadback> storage_readbacks_;
+
   std::vector<SRVDescriptorCachePage> srv_descriptor_cache_;
   uint32_t srv_descriptor_cache_allocated_;
   // Indices of cached descriptors used by deleted textures, for reuse.
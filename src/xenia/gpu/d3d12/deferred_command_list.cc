@@ -40,6 +40,10 @@ void DeferredCommandList::Execute(ID3D12GraphicsCommandList* command_list,
     stream += kCommandHeaderSizeElements;
     stream_remaining -= kCommandHeaderSizeElements;
     switch (header.command) {
+      case Command::kD3DBeginQuery: {
+        auto& args = *reinterpret_cast<const D3DQueryArguments*>(stream);
+        command_list->BeginQuery(args.query_heap, args.type, args.index);
+      } break;
       case Command::kD3DClearDepthStencilView: {
         auto& args =
             *reinterpret_cast<const ClearDepthStencilViewHeader*>(stream);
@@ -116,6 +120,10 @@ void DeferredCommandList::Execute(ID3D12GraphicsCommandList* command_list,
               args.start_vertex_location, args.start_instance_location);
         }
       } break;
+      case Command::kD3DEndQuery: {
+        auto& args = *reinterpret_cast<const D3DQueryArguments*>(stream);
+        command_list->EndQuery(args.query_heap, args.type, args.index);
+      } break;
       case Command::kD3DIASetIndexBuffer: {
         auto view = reinterpret_cast<const D3D12_INDEX_BUFFER_VIEW*>(stream);
         command_list->IASetIndexBuffer(
@@ -150,6 +158,13 @@ void DeferredCommandList::Execute(ID3D12GraphicsCommandList* command_list,
       case Command::kD3DOMSetStencilRef: {
         command_list->OMSetStencilRef(*reinterpret_cast<const UINT*>(stream));
       } break;
+      case Command::kD3DResolveQueryData: {
+        auto& args =
+            *reinterpret_cast<const D3DResolveQueryDataArguments*>(stream);
+        command_list->ResolveQueryData(
+            args.query_heap, args.type, args.start_index, args.num_queries,
+            args.destination_buffer, args.aligned_destination_buffer_offset);
+      } break;
       case Command::kD3DResourceBarrier: {
         static_assert(alignof(D3D12_RESOURCE_BARRIER) <= alignof(uintmax_t));
         command_list->ResourceBarrier(
@@ -37,6 +37,15 @@ class DeferredCommandList {
   void Execute(ID3D12GraphicsCommandList* command_list,
                ID3D12GraphicsCommandList1* command_list_1);
 
+  void D3DBeginQuery(ID3D12QueryHeap* query_heap, D3D12_QUERY_TYPE type,
+                     UINT index) {
+    auto& args = *reinterpret_cast<D3DQueryArguments*>(
+        WriteCommand(Command::kD3DBeginQuery, sizeof(D3DQueryArguments)));
+    args.query_heap = query_heap;
+    args.type = type;
+    args.index = index;
+  }
+
   D3D12_RECT* ClearDepthStencilViewAllocatedRects(
       D3D12_CPU_DESCRIPTOR_HANDLE depth_stencil_view,
       D3D12_CLEAR_FLAGS clear_flags, FLOAT depth, UINT8 stencil,
@@ -179,6 +188,15 @@ class DeferredCommandList {
     args.start_instance_location = start_instance_location;
   }
 
+  void D3DEndQuery(ID3D12QueryHeap* query_heap, D3D12_QUERY_TYPE type,
+                   UINT index) {
+    auto& args = *reinterpret_cast<D3DQueryArguments*>(
+        WriteCommand(Command::kD3DEndQuery, sizeof(D3DQueryArguments)));
+    args.query_heap = query_heap;
+    args.type = type;
+    args.index = index;
+  }
+
   void D3DIASetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW* view) {
     auto& args = *reinterpret_cast<D3D12_INDEX_BUFFER_VIEW*>(WriteCommand(
         Command::kD3DIASetIndexBuffer, sizeof(D3D12_INDEX_BUFFER_VIEW)));
@@ -258,6 +276,21 @@ class DeferredCommandList {
     arg = stencil_ref;
   }
 
+  void D3DResolveQueryData(ID3D12QueryHeap* query_heap, D3D12_QUERY_TYPE type,
+                           UINT start_index, UINT num_queries,
+                           ID3D12Resource* destination_buffer,
+                           UINT64 aligned_destination_buffer_offset) {
+    auto& args = *reinterpret_cast<D3DResolveQueryDataArguments*>(
+        WriteCommand(Command::kD3DResolveQueryData,
+                     sizeof(D3DResolveQueryDataArguments)));
+    args.query_heap = query_heap;
+    args.type = type;
+    args.start_index = start_index;
+    args.num_queries = num_queries;
+    args.destination_buffer = destination_buffer;
+    args.aligned_destination_buffer_offset = aligned_destination_buffer_offset;
+  }
+
   void D3DResourceBarrier(UINT num_barriers,
                           const D3D12_RESOURCE_BARRIER* barriers) {
     if (num_barriers == 0) {
@@ -402,6 +435,7 @@ class DeferredCommandList {
 
  private:
   enum class Command {
+    kD3DBeginQuery,
     kD3DClearDepthStencilView,
     kD3DClearRenderTargetView,
     kD3DClearUnorderedAccessViewUint,
@@ -412,12 +446,14 @@ class DeferredCommandList {
     kD3DDispatch,
     kD3DDrawIndexedInstanced,
     kD3DDrawInstanced,
+    kD3DEndQuery,
     kD3DIASetIndexBuffer,
     kD3DIASetPrimitiveTopology,
     kD3DIASetVertexBuffers,
     kD3DOMSetBlendFactor,
     kD3DOMSetRenderTargets,
     kD3DOMSetStencilRef,
+    kD3DResolveQueryData,
     kD3DResourceBarrier,
     kRSSetScissorRect,
     kRSSetViewport,
@@ -442,6 +478,12 @@ class DeferredCommandList {
   static constexpr size_t kCommandHeaderSizeElements =
       (sizeof(CommandHeader) + sizeof(uintmax_t) - 1) / sizeof(uintmax_t);
 
+  struct D3DQueryArguments {
+    ID3D12QueryHeap* query_heap;
+    D3D12_QUERY_TYPE type;
+    UINT index;
+  };
+
   struct ClearDepthStencilViewHeader {
     D3D12_CPU_DESCRIPTOR_HANDLE depth_stencil_view;
     D3D12_CLEAR_FLAGS clear_flags;
@@ -516,6 +558,15 @@ class DeferredCommandList {
     UINT start_instance_location;
   };
 
+  struct D3DResolveQueryDataArguments {
+    ID3D12QueryHeap* query_heap;
+    D3D12_QUERY_TYPE type;
+    UINT start_index;
+    UINT num_queries;
+    ID3D12Resource* destination_buffer;
+    UINT64 aligned_destination_buffer_offset;
+  };
+
   struct D3DIASetVertexBuffersHeader {
     UINT start_slot;
     UINT num_views;
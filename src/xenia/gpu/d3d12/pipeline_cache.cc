@@ -28,6 +28,7 @@
 #include "xenia/base/cvar.h"
 #include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
+#include "xenia/base/mapped_memory.h"
 #include "xenia/base/math.h"
 #include "xenia/base/profiling.h"
 #include "xenia/base/string.h"
@@ -268,6 +269,12 @@ void PipelineCache::InitializeShaderStorage(
         xe::path_to_utf8(pipeline_storage_file_path));
     return;
   }
+  // Multiple emulator instances (such as ones running automated tests) may use
+  // the same storage files. Every record is appended atomically, and the
+  // existing contents are modified only by the instance that manages to take
+  // the exclusive lock, which means that no other instance has the file open.
+  xe::filesystem::LockStdioFile(pipeline_storage_file_,
+                                xe::filesystem::StdioFileLock::kShared, true);
   pipeline_storage_file_flush_needed_ = false;
   // 'XEPS'.
   const uint32_t pipeline_storage_magic = 0x53504558;
@@ -282,15 +289,21 @@ void PipelineCache::InitializeShaderStorage(
     uint32_t magic_api;
     uint32_t version_swapped;
   } pipeline_storage_file_header;
-  if (fread(&pipeline_storage_file_header, sizeof(pipeline_storage_file_header),
-            1, pipeline_storage_file_) &&
-      pipeline_storage_file_header.magic == pipeline_storage_magic &&
-      pipeline_storage_file_header.magic_api == pipeline_storage_magic_api &&
-      pipeline_storage_file_header.version_swapped ==
-          pipeline_storage_version_swapped) {
+  auto read_pipeline_storage_file_header = [&]() {
+    return xe::filesystem::Seek(pipeline_storage_file_, 0, SEEK_SET) &&
+           fread(&pipeline_storage_file_header,
+                 sizeof(pipeline_storage_file_header), 1,
+                 pipeline_storage_file_) &&
+           pipeline_storage_file_header.magic == pipeline_storage_magic &&
+           pipeline_storage_file_header.magic_api ==
+               pipeline_storage_magic_api &&
+           pipeline_storage_file_header.version_swapped ==
+               pipeline_storage_version_swapped;
+  };
+  int64_t pipeline_storage_told_end = 0;
+  if (read_pipeline_storage_file_header()) {
     xe::filesystem::Seek(pipeline_storage_file_, 0, SEEK_END);
-    int64_t pipeline_storage_told_end =
-        xe::filesystem::Tell(pipeline_storage_file_);
+    pipeline_storage_told_end = xe::filesystem::Tell(pipeline_storage_file_);
     size_t pipeline_storage_told_count =
         size_t(pipeline_storage_told_end >=
                        int64_t(sizeof(pipeline_storage_file_header))
@@ -358,6 +371,8 @@ void PipelineCache::InitializeShaderStorage(
     pipeline_storage_file_ = nullptr;
     return;
   }
+  xe::filesystem::LockStdioFile(shader_storage_file_,
+                                xe::filesystem::StdioFileLock::kShared, true);
   ++shader_storage_index_;
   shader_storage_file_flush_needed_ = false;
   struct {
@@ -366,18 +381,45 @@ void PipelineCache::InitializeShaderStorage(
   } shader_storage_file_header;
   // 'XESH'.
   const uint32_t shader_storage_magic = 0x48534558;
-  if (fread(&shader_storage_file_header, sizeof(shader_storage_file_header), 1,
-            shader_storage_file_) &&
-      shader_storage_file_header.magic == shader_storage_magic &&
-      xe::byte_swap(shader_storage_file_header.version_swapped) ==
-          ShaderStoredHeader::kVersion) {
+  auto read_shader_storage_file_header = [&]() {
+    return xe::filesystem::Seek(shader_storage_file_, 0, SEEK_SET) &&
+           fread(&shader_storage_file_header,
+                 sizeof(shader_storage_file_header), 1, shader_storage_file_) &&
+           shader_storage_file_header.magic == shader_storage_magic &&
+           xe::byte_swap(shader_storage_file_header.version_swapped) ==
+               ShaderStoredHeader::kVersion;
+  };
+  if (read_shader_storage_file_header()) {
+    // Map the file instead of reading it through the stream, so the pages are
+    // shared with other instances loading the same storage rather than copied
+    // into the memory of each.
+    xe::filesystem::Seek(shader_storage_file_, 0, SEEK_END);
+    int64_t shader_storage_told_end =
+        xe::filesystem::Tell(shader_storage_file_);
+    std::unique_ptr<MappedMemory> shader_storage_mapping;
+    if (shader_storage_told_end > int64_t(sizeof(shader_storage_file_header))) {
+      shader_storage_mapping = MappedMemory::Open(
+          shader_storage_file_path, MappedMemory::Mode::kRead, 0,
+          size_t(shader_storage_told_end));
+      if (!shader_storage_mapping) {
+        XELOGE("Failed to map the guest shader storage file for reading: {}",
+               xe::path_to_utf8(shader_storage_file_path));
+      }
+    }
+    uint64_t shader_storage_mapped_bytes =
+        shader_storage_mapping ? shader_storage_mapping->size() : 0;
     uint64_t shader_storage_valid_bytes = sizeof(shader_storage_file_header);
     // Load and translate shaders written by previous Xenia executions until the
     // end of the file or until a corrupted one is detected.
     ShaderStoredHeader shader_header;
-    std::vector<uint32_t> ucode_dwords;
-    ucode_dwords.reserve(0xFFFF);
     size_t shaders_translated = 0;
+    size_t shader_ucode_bytes_read = 0;
+    // Progress report for big storages, not to look like a hang.
+    uint64_t shader_storage_progress_report_interval =
+        xe::Clock::QueryHostTickFrequency() * 2;
+    uint64_t shader_storage_next_progress_report =
+        shader_storage_initialization_start +
+        shader_storage_progress_report_interval;
 
     // Threads overlapping file reading.
     std::mutex shaders_translation_thread_mutex;
@@ -387,6 +429,7 @@ void PipelineCache::InitializeShaderStorage(
     bool shader_translation_threads_shutdown = false;
     std::mutex shaders_failed_to_translate_mutex;
     std::vector<D3D12Shader::D3D12Translation*> shaders_failed_to_translate;
+    std::atomic<size_t> shader_translations_done = {0};
     auto shader_translation_thread_function = [&]() {
       const ui::d3d12::D3D12Provider& provider =
           command_processor_.GetD3D12Provider();
@@ -450,6 +493,7 @@ void PipelineCache::InitializeShaderStorage(
             std::lock_guard<std::mutex> lock(shaders_failed_to_translate_mutex);
             shaders_failed_to_translate.push_back(translation);
           }
+          shader_translations_done.fetch_add(1, std::memory_order_relaxed);
         }
         {
           std::lock_guard<std::mutex> lock(shaders_translation_thread_mutex);
@@ -470,27 +514,32 @@ void PipelineCache::InitializeShaderStorage(
         shader_translation_threads;
 
     while (true) {
-      if (!fread(&shader_header, sizeof(shader_header), 1,
-                 shader_storage_file_)) {
+      if (shader_storage_valid_bytes + sizeof(shader_header) >
+          shader_storage_mapped_bytes) {
         break;
       }
+      const uint8_t* shader_record =
+          shader_storage_mapping->data() + shader_storage_valid_bytes;
+      // The header may be not 8-byte-aligned in the file.
+      std::memcpy(&shader_header, shader_record, sizeof(shader_header));
       size_t ucode_byte_count =
           shader_header.ucode_dword_count * sizeof(uint32_t);
-      ucode_dwords.resize(shader_header.ucode_dword_count);
-      if (shader_header.ucode_dword_count &&
-          !fread(ucode_dwords.data(), ucode_byte_count, 1,
-                 shader_storage_file_)) {
+      if (shader_storage_valid_bytes + sizeof(shader_header) +
+              ucode_byte_count >
+          shader_storage_mapped_bytes) {
         break;
       }
-      uint64_t ucode_data_hash =
-          XXH3_64bits(ucode_dwords.data(), ucode_byte_count);
+      const uint32_t* ucode_dwords = reinterpret_cast<const uint32_t*>(
+          shader_record + sizeof(shader_header));
+      uint64_t ucode_data_hash = XXH3_64bits(ucode_dwords, ucode_byte_count);
       if (shader_header.ucode_data_hash != ucode_data_hash) {
         // Validation failed.
         break;
       }
       shader_storage_valid_bytes += sizeof(shader_header) + ucode_byte_count;
+      shader_ucode_bytes_read += ucode_byte_count;
       D3D12Shader* shader =
-          LoadShader(shader_header.type, ucode_dwords.data(),
+          LoadShader(shader_header.type, ucode_dwords,
                      shader_header.ucode_dword_count, ucode_data_hash);
       if (shader->ucode_storage_index() == shader_storage_index_) {
         // Appeared twice in this file for some reason - skip, otherwise race
@@ -526,41 +575,98 @@ void PipelineCache::InitializeShaderStorage(
       }
       shaders_translation_thread_cond.notify_one();
       ++shaders_translated;
-    }
-    if (!shader_translation_threads.empty()) {
-      {
-        std::lock_guard<std::mutex> lock(shaders_translation_thread_mutex);
-        shader_translation_threads_shutdown = true;
-      }
-      shaders_translation_thread_cond.notify_all();
-      for (auto& shader_translation_thread : shader_translation_threads) {
-        xe::threading::Wait(shader_translation_thread.get(), false);
-      }
-      shader_translation_threads.clear();
-      for (D3D12Shader::D3D12Translation* translation :
-           shaders_failed_to_translate) {
-        D3D12Shader* shader = static_cast<D3D12Shader*>(&translation->shader());
-        shader->DestroyTranslation(translation->modification());
-        if (shader->translations().empty()) {
-          shaders_.erase(shader->ucode_data_hash());
-          delete shader;
-        }
+      uint64_t shader_storage_progress_time = xe::Clock::QueryHostTickCount();
+      if (shader_storage_progress_time >= shader_storage_next_progress_report) {
+        shader_storage_next_progress_report =
+            shader_storage_progress_time +
+            shader_storage_progress_report_interval;
+        XELOGGPU(
+            "Loading the shader storage: {} shaders read, {} translations "
+            "done on {} threads",
+            shaders_translated,
+            shader_translations_done.load(std::memory_order_relaxed),
+            shader_translation_threads.size());
+      }
+    }
+    // Translate the rest of the shaders on this thread too rather than only
+    // awaiting the translation threads - all the logical processors are
+    // available now, and if there's only one, no translation threads have been
+    // created.
+    {
+      std::lock_guard<std::mutex> lock(shaders_translation_thread_mutex);
+      shader_translation_threads_shutdown = true;
+    }
+    shaders_translation_thread_cond.notify_all();
+    shader_translation_thread_function();
+    size_t shader_translation_thread_count =
+        shader_translation_threads.size() + 1;
+    for (auto& shader_translation_thread : shader_translation_threads) {
+      xe::threading::Wait(shader_translation_thread.get(), false);
+    }
+    shader_translation_threads.clear();
+    size_t shader_translations_failed = shaders_failed_to_translate.size();
+    for (D3D12Shader::D3D12Translation* translation :
+         shaders_failed_to_translate) {
+      D3D12Shader* shader = static_cast<D3D12Shader*>(&translation->shader());
+      shader->DestroyTranslation(translation->modification());
+      if (shader->translations().empty()) {
+        shaders_.erase(shader->ucode_data_hash());
+        delete shader;
+      }
+    }
+    uint64_t shader_storage_initialization_ms =
+        (xe::Clock::QueryHostTickCount() -
+         shader_storage_initialization_start) *
+        1000 / xe::Clock::QueryHostTickFrequency();
+    XELOGGPU(
+        "Translated {} shaders ({} KB of microcode, {} translations, {} "
+        "failed) from the storage in {} milliseconds on {} threads, {} shaders "
+        "per second",
+        shaders_translated, shader_ucode_bytes_read / 1024,
+        shader_translations_done.load(std::memory_order_relaxed),
+        shader_translations_failed, shader_storage_initialization_ms,
+        shader_translation_thread_count,
+        shaders_translated * 1000 /
+            std::max(shader_storage_initialization_ms, uint64_t(1)));
+    // The ucode has been copied to the shaders, and a mapped file can't be
+    // truncated on Windows.
+    shader_storage_mapping.reset();
+    if (shader_storage_valid_bytes < shader_storage_mapped_bytes) {
+      // Shaders appended after the corrupted data are unreachable, but if
+      // other instances are using the file, there may be new valid shaders in
+      // the end that have not been read.
+      if (xe::filesystem::TryUpgradeStdioFileLock(shader_storage_file_)) {
+        xe::filesystem::TruncateStdioFile(shader_storage_file_,
+                                          shader_storage_valid_bytes);
+        xe::filesystem::LockStdioFile(
+            shader_storage_file_, xe::filesystem::StdioFileLock::kShared, true);
+      } else {
+        XELOGW(
+            "The guest shader storage file has corrupted data, but can't be "
+            "truncated while in use by another instance: {}",
+            xe::path_to_utf8(shader_storage_file_path));
       }
     }
-    XELOGGPU("Translated {} shaders from the storage in {} milliseconds",
-             shaders_translated,
-             (xe::Clock::QueryHostTickCount() -
-              shader_storage_initialization_start) *
-                 1000 / xe::Clock::QueryHostTickFrequency());
-    xe::filesystem::TruncateStdioFile(shader_storage_file_,
-                                      shader_storage_valid_bytes);
-  } else {
+  } else if (xe::filesystem::TryUpgradeStdioFileLock(shader_storage_file_)) {
     xe::filesystem::TruncateStdioFile(shader_storage_file_, 0);
     shader_storage_file_header.magic = shader_storage_magic;
     shader_storage_file_header.version_swapped =
         xe::byte_swap(ShaderStoredHeader::kVersion);
-    fwrite(&shader_storage_file_header, sizeof(shader_storage_file_header), 1,
-           shader_storage_file_);
+    xe::filesystem::AppendToStdioFile(shader_storage_file_,
+                                      &shader_storage_file_header,
+                                      sizeof(shader_storage_file_header));
+    xe::filesystem::LockStdioFile(shader_storage_file_,
+                                  xe::filesystem::StdioFileLock::kShared, true);
+  } else if (!read_shader_storage_file_header()) {
+    // If another instance hasn't just initialized the file (and the header is
+    // valid now), it's likely from a different version of Xenia.
+    XELOGW(
+        "The guest shader storage file is in use by another instance and has "
+        "an incompatible header, persistent shader storage will be disabled: "
+        "{}",
+        xe::path_to_utf8(shader_storage_file_path));
+    fclose(shader_storage_file_);
+    shader_storage_file_ = nullptr;
   }
 
   // Create the pipelines.
@@ -731,21 +837,41 @@ void PipelineCache::InitializeShaderStorage(
         pipelines_created,
         (xe::Clock::QueryHostTickCount() - pipeline_creation_start_) * 1000 /
             xe::Clock::QueryHostTickFrequency());
+  }
+  if (pipeline_storage_told_end) {
     // If any pipeline descriptions were corrupted (or the whole file has excess
-    // bytes in the end), truncate to the last valid pipeline description.
-    xe::filesystem::TruncateStdioFile(
-        pipeline_storage_file_,
+    // bytes in the end), truncate to the last valid pipeline description, but
+    // only if no other instance is using the file.
+    uint64_t pipeline_storage_valid_bytes =
         uint64_t(sizeof(pipeline_storage_file_header) +
                  sizeof(PipelineStoredDescription) *
-                     pipeline_stored_descriptions.size()));
-  } else {
+                     pipeline_stored_descriptions.size());
+    if (pipeline_storage_valid_bytes < uint64_t(pipeline_storage_told_end) &&
+        xe::filesystem::TryUpgradeStdioFileLock(pipeline_storage_file_)) {
+      xe::filesystem::TruncateStdioFile(pipeline_storage_file_,
+                                        pipeline_storage_valid_bytes);
+      xe::filesystem::LockStdioFile(
+          pipeline_storage_file_, xe::filesystem::StdioFileLock::kShared, true);
+    }
+  } else if (xe::filesystem::TryUpgradeStdioFileLock(pipeline_storage_file_)) {
     xe::filesystem::TruncateStdioFile(pipeline_storage_file_, 0);
     pipeline_storage_file_header.magic = pipeline_storage_magic;
     pipeline_storage_file_header.magic_api = pipeline_storage_magic_api;
     pipeline_storage_file_header.version_swapped =
         pipeline_storage_version_swapped;
-    fwrite(&pipeline_storage_file_header, sizeof(pipeline_storage_file_header),
-           1, pipeline_storage_file_);
+    xe::filesystem::AppendToStdioFile(pipeline_storage_file_,
+                                      &pipeline_storage_file_header,
+                                      sizeof(pipeline_storage_file_header));
+    xe::filesystem::LockStdioFile(pipeline_storage_file_,
+                                  xe::filesystem::StdioFileLock::kShared, true);
+  } else if (!read_pipeline_storage_file_header()) {
+    XELOGW(
+        "The Direct3D 12 pipeline description storage file is in use by "
+        "another instance and has an incompatible header, pipeline storage "
+        "will be disabled: {}",
+        xe::path_to_utf8(pipeline_storage_file_path));
+    fclose(pipeline_storage_file_);
+    pipeline_storage_file_ = nullptr;
   }
 
   shader_storage_cache_root_ = cache_root;
@@ -836,6 +962,14 @@ bool PipelineCache::IsCreatingPipelines() {
   return !creation_queue_.empty() || creation_threads_busy_ != 0;
 }
 
+size_t PipelineCache::GetCreatingPipelineCount() {
+  if (creation_threads_.empty()) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(creation_request_lock_);
+  return creation_queue_.size() + creation_threads_busy_;
+}
+
 D3D12Shader* PipelineCache::LoadShader(xenos::ShaderType shader_type,
                                        const uint32_t* host_address,
                                        uint32_t dword_count) {
@@ -3221,6 +3355,7 @@ ID3D12PipelineState* PipelineCache::CreateD3D12Pipeline(
         runtime_description.vertex_shader->shader().ucode_data_hash());
   }
   state->SetName(name.c_str());
+  pipelines_created_total_.fetch_add(1, std::memory_order_relaxed);
   return state;
 }
 
@@ -3229,8 +3364,10 @@ void PipelineCache::StorageWriteThread() {
   // Don't leak anything in unused bits.
   std::memset(&shader_header, 0, sizeof(shader_header));
 
-  std::vector<uint32_t> ucode_guest_endian;
-  ucode_guest_endian.reserve(0xFFFF);
+  // The header and the ucode, appended as a whole not to be interleaved with
+  // records written by other instances using the same file.
+  std::vector<uint8_t> shader_record;
+  shader_record.reserve(sizeof(shader_header) + sizeof(uint32_t) * 0xFFFF);
 
   bool flush_shaders = false;
   bool flush_pipelines = false;
@@ -3283,23 +3420,24 @@ void PipelineCache::StorageWriteThread() {
       shader_header.ucode_dword_count = shader->ucode_dword_count();
       shader_header.type = shader->type();
       assert_not_null(shader_storage_file_);
-      fwrite(&shader_header, sizeof(shader_header), 1, shader_storage_file_);
-      if (shader_header.ucode_dword_count) {
-        ucode_guest_endian.resize(shader_header.ucode_dword_count);
-        // Need to swap because the hash is calculated for the shader with guest
-        // endianness.
-        xe::copy_and_swap(ucode_guest_endian.data(), shader->ucode_dwords(),
-                          shader_header.ucode_dword_count);
-        fwrite(ucode_guest_endian.data(),
-               shader_header.ucode_dword_count * sizeof(uint32_t), 1,
-               shader_storage_file_);
-      }
+      shader_record.resize(sizeof(shader_header) +
+                           sizeof(uint32_t) * shader_header.ucode_dword_count);
+      std::memcpy(shader_record.data(), &shader_header, sizeof(shader_header));
+      // Need to swap because the hash is calculated for the shader with guest
+      // endianness.
+      xe::copy_and_swap(
+          reinterpret_cast<uint32_t*>(shader_record.data() +
+                                      sizeof(shader_header)),
+          shader->ucode_dwords(), shader_header.ucode_dword_count);
+      xe::filesystem::AppendToStdioFile(
+          shader_storage_file_, shader_record.data(), shader_record.size());
     }
 
     if (write_pipeline) {
       assert_not_null(pipeline_storage_file_);
-      fwrite(&pipeline_description, sizeof(pipeline_description), 1,
-             pipeline_storage_file_);
+      xe::filesystem::AppendToStdioFile(pipeline_storage_file_,
+                                        &pipeline_description,
+                                        sizeof(pipeline_description));
     }
   }
 }
@@ -10,6 +10,7 @@
 #ifndef XENIA_GPU_D3D12_PIPELINE_CACHE_H_
 #define XENIA_GPU_D3D12_PIPELINE_CACHE_H_
 
+#include <atomic>
 #include <condition_variable>
 #include <cstdio>
 #include <deque>
@@ -66,6 +67,14 @@ class PipelineCache {
 
   void EndSubmission();
   bool IsCreatingPipelines();
+  // Number of the pipelines queued for creation or being created on the
+  // creation threads, for statistics.
+  size_t GetCreatingPipelineCount();
+  // Total number of the pipelines successfully created on any thread, for
+  // statistics.
+  uint64_t pipelines_created_total() const {
+    return pipelines_created_total_.load(std::memory_order_relaxed);
+  }
 
   D3D12Shader* LoadShader(xenos::ShaderType shader_type,
                           const uint32_t* host_address, uint32_t dword_count);
@@ -409,6 +418,7 @@ class PipelineCache {
   // a pipeline is dequeued (the completion event can't be triggered before this
   // is zero). Protected with creation_request_lock_.
   size_t creation_threads_busy_ = 0;
+  std::atomic<uint64_t> pipelines_created_total_ = {0};
   // Manual-reset event set when the last queued pipeline is created and there
   // are no more pipelines to create. This is triggered by the thread creating
   // the last pipeline.
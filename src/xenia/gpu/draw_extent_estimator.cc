@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <cfloat>
 #include <cstdint>
+#include <iterator>
 
 #include "xenia/base/assert.h"
 #include "xenia/base/cvar.h"
@@ -168,6 +169,16 @@ uint32_t DrawExtentEstimator::EstimateVertexMaxY(const Shader& vertex_shader) {
 
   shader_interpreter_.SetShader(vertex_shader);
 
+  // Like the post-transform vertex cache on the GPU, skip the vertices that
+  // have recently been processed in this draw - the shader only depends on the
+  // vertex index and on the state that doesn't change during the draw, so the
+  // result would be the same. Not a real index is UINT32_MAX, as the indices
+  // are 24-bit.
+  constexpr uint32_t kProcessedVertexCacheSizeLog2 = 6;
+  uint32_t processed_vertex_cache[UINT32_C(1) << kProcessedVertexCacheSizeLog2];
+  std::fill(std::begin(processed_vertex_cache),
+            std::end(processed_vertex_cache), UINT32_MAX);
+
   PositionYExportSink position_y_export_sink;
   shader_interpreter_.SetExportSink(&position_y_export_sink);
   for (uint32_t i = 0; i < vgt_draw_initiator.num_indices; ++i) {
@@ -196,6 +207,15 @@ uint32_t DrawExtentEstimator::EstimateVertexMaxY(const Shader& vertex_shader) {
         std::min(max_index,
                  std::max(min_index, (vertex_index + index_offset) & 0xFFFFFF));
 
+    uint32_t& processed_vertex_cache_entry =
+        processed_vertex_cache[vertex_index &
+                               ((UINT32_C(1) << kProcessedVertexCacheSizeLog2) -
+                                1)];
+    if (processed_vertex_cache_entry == vertex_index) {
+      continue;
+    }
+    processed_vertex_cache_entry = vertex_index;
+
     position_y_export_sink.Reset();
 
     shader_interpreter_.temp_registers()[0] = float(vertex_index);
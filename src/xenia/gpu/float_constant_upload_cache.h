@@ -0,0 +1,122 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_GPU_FLOAT_CONSTANT_UPLOAD_CACHE_H_
+#define XENIA_GPU_FLOAT_CONSTANT_UPLOAD_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "xenia/base/hash.h"
+#include "xenia/base/math.h"
+#include "xenia/base/xxhash.h"
+#include "xenia/gpu/register_file.h"
+#include "xenia/gpu/registers.h"
+
+namespace xe {
+namespace gpu {
+
+// Gathers the float constants used by a shader from the register file into a
+// contiguous block, and finds blocks with identical contents already uploaded
+// since the last reset, so they can be bound again instead of being uploaded
+// once more. Games often switch between a few sets of constants between
+// draws, such as when changing one bone matrix for a draw and then restoring
+// it, or when drawing the same object multiple times interleaved with others.
+// Location is the backend's description of where the block has been uploaded.
+// The cache must be reset when the uploaded blocks may be reclaimed.
+template <typename Location>
+class FloatConstantUploadCache {
+ public:
+  // float_bitmap is the 256-bit bitmap of the constants used by the shader
+  // starting from first_register.
+  void Gather(const RegisterFile& regs, uint32_t first_register,
+              const uint64_t* float_bitmap) {
+    uint32_t* gathered = gathered_;
+    for (uint32_t i = 0; i < 4; ++i) {
+      uint64_t float_constant_map_entry = float_bitmap[i];
+      uint32_t float_constant_index;
+      while (xe::bit_scan_forward(float_constant_map_entry,
+                                  &float_constant_index)) {
+        float_constant_map_entry &= ~(1ull << float_constant_index);
+        std::memcpy(gathered,
+                    &regs[first_register + (i << 8) +
+                          (float_constant_index << 2)]
+                         .u32,
+                    sizeof(uint32_t) * 4);
+        gathered += 4;
+      }
+    }
+    gathered_dword_count_ = size_t(gathered - gathered_);
+    gathered_hash_ =
+        XXH3_64bits(gathered_, sizeof(uint32_t) * gathered_dword_count_);
+  }
+
+  const uint32_t* gathered() const { return gathered_; }
+  size_t gathered_size() const {
+    return sizeof(uint32_t) * gathered_dword_count_;
+  }
+
+  // Returns the location of an uploaded block identical to the gathered
+  // constants, or nullptr if there's none.
+  const Location* FindGathered() const {
+    auto range = uploads_.equal_range(gathered_hash_);
+    for (auto it = range.first; it != range.second; ++it) {
+      const Upload& upload = it->second;
+      if (upload.dword_count == gathered_dword_count_ &&
+          !std::memcmp(data_.data() + upload.data_offset, gathered_,
+                       sizeof(uint32_t) * gathered_dword_count_)) {
+        return &upload.location;
+      }
+    }
+    return nullptr;
+  }
+
+  // Records that the gathered constants have been uploaded to the location.
+  void AddGathered(const Location& location) {
+    if (!gathered_dword_count_) {
+      return;
+    }
+    Upload upload;
+    upload.location = location;
+    upload.data_offset = data_.size();
+    upload.dword_count = gathered_dword_count_;
+    data_.insert(data_.end(), gathered_, gathered_ + gathered_dword_count_);
+    uploads_.emplace(gathered_hash_, upload);
+  }
+
+  void Reset() {
+    uploads_.clear();
+    data_.clear();
+  }
+
+ private:
+  struct Upload {
+    Location location;
+    size_t data_offset;
+    size_t dword_count;
+  };
+
+  uint32_t gathered_[256 * 4];
+  size_t gathered_dword_count_ = 0;
+  uint64_t gathered_hash_ = 0;
+
+  // XXH3 hashes of the contents -> uploads, with the contents stored in data_
+  // for collision resolution.
+  std::unordered_multimap<uint64_t, Upload, xe::hash::IdentityHasher<uint64_t>>
+      uploads_;
+  std::vector<uint32_t> data_;
+};
+
+}  // namespace gpu
+}  // namespace xe
+
+#endif  // XENIA_GPU_FLOAT_CONSTANT_UPLOAD_CACHE_H_
@@ -12,6 +12,19 @@
 DEFINE_path(trace_gpu_prefix, "scratch/gpu/",
             "Prefix path for GPU trace files.", "GPU");
 DEFINE_bool(trace_gpu_stream, false, "Trace all GPU packets.", "GPU");
+DEFINE_uint32(
+    trace_gpu_ring_frames, 0,
+    "If not 0, keep at least this many latest frames of GPU packets in memory, "
+    "written to a file when a frame trace is requested or when a frame takes "
+    "longer than trace_gpu_ring_hitch_ms. Every this many frames, a snapshot "
+    "of the GPU state and memory is taken, which is slow, so this shouldn't be "
+    "too small.",
+    "GPU");
+DEFINE_uint32(
+    trace_gpu_ring_hitch_ms, 0,
+    "If not 0, with trace_gpu_ring_frames, write the latest frames to a file "
+    "when a frame takes longer than this many milliseconds.",
+    "GPU");
 
 DEFINE_path(
     dump_shaders, "",
@@ -20,6 +33,18 @@ DEFINE_path(
 
 DEFINE_bool(vsync, true, "Enable VSYNC.", "GPU");
 
+DEFINE_bool(
+    store_shaders, true,
+    "Store shaders persistently and load them when loading games to avoid "
+    "runtime spikes and freezes when playing the game not for the first time.",
+    "GPU");
+DEFINE_bool(
+    store_textures, false,
+    "Store textures converted to the host format persistently and upload them "
+    "instead of converting them again when the same texture data is loaded "
+    "later, including when playing the game not for the first time.",
+    "GPU");
+
 DEFINE_bool(
     gpu_allow_invalid_fetch_constants, false,
     "Allow texture and vertex fetch constants with invalid type - generally "
@@ -48,3 +73,16 @@ DEFINE_int32(query_occlusion_fake_sample_count, 1000,
              "EVENT_WRITE_ZPD by this number. Setting this to 0 means "
              "everything is reported as occluded.",
              "GPU");
+DEFINE_bool(
+    query_occlusion_host, true,
+    "Count the samples for occlusion queries on the host GPU if supported by "
+    "the GPU backend, rather than reporting query_occlusion_fake_sample_count.",
+    "GPU");
+DEFINE_uint32(
+    query_occlusion_latency_frames, 2,
+    "With query_occlusion_host, the number of frames after which the results "
+    "of the occlusion queries are awaited if they're still not available. "
+    "Results are also awaited when the GPU becomes idle, as the game may be "
+    "waiting for them. 0 to await the results in the end of every query, "
+    "stalling the GPU.",
+    "GPU");
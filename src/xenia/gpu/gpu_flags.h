@@ -13,15 +13,22 @@
 
 DECLARE_path(trace_gpu_prefix);
 DECLARE_bool(trace_gpu_stream);
+DECLARE_uint32(trace_gpu_ring_frames);
+DECLARE_uint32(trace_gpu_ring_hitch_ms);
 
 DECLARE_path(dump_shaders);
 
 DECLARE_bool(vsync);
 
+DECLARE_bool(store_shaders);
+DECLARE_bool(store_textures);
+
 DECLARE_bool(gpu_allow_invalid_fetch_constants);
 
 DECLARE_bool(half_pixel_offset);
 
 DECLARE_int32(query_occlusion_fake_sample_count);
+DECLARE_bool(query_occlusion_host);
+DECLARE_uint32(query_occlusion_latency_frames);
 
 #endif  // XENIA_GPU_GPU_FLAGS_H_
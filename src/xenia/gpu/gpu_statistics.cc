@@ -0,0 +1,269 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/gpu/gpu_statistics.h"
+
+#include <string>
+
+#include "third_party/fmt/include/fmt/format.h"
+#include "xenia/base/assert.h"
+#include "xenia/base/clock.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+
+DEFINE_path(
+    gpu_statistics_csv_path, "",
+    "Path to write the GPU work counters and the host GPU time of every "
+    "submission and every frame to, in the CSV format. The values of a "
+    "submission or of a frame are written when the host GPU completes it.",
+    "GPU");
+
+namespace xe {
+namespace gpu {
+
+const char* GpuStatistics::GetCounterName(Counter counter) {
+  switch (counter) {
+    case Counter::kDraws:
+      return "draws";
+    case Counter::kResolves:
+      return "resolves";
+    case Counter::kEdramTransfers:
+      return "edram_transfers";
+    case Counter::kEdramTransferRenderPasses:
+      return "edram_transfer_render_passes";
+    case Counter::kTextureLoads:
+      return "texture_loads";
+    case Counter::kTextureLoadBytes:
+      return "texture_load_bytes";
+    case Counter::kUploadBytes:
+      return "upload_bytes";
+    case Counter::kUploadBytesWasted:
+      return "upload_bytes_wasted";
+    case Counter::kSharedMemoryAllocations:
+      return "shared_memory_allocations";
+    case Counter::kSharedMemoryAllocatedBytes:
+      return "shared_memory_allocated_bytes";
+    case Counter::kSharedMemoryPredictedBytes:
+      return "shared_memory_predicted_bytes";
+    case Counter::kPipelinesCreated:
+      return "pipelines_created";
+    case Counter::kPipelinesSharedByDynamicState:
+      return "pipelines_shared_by_dynamic_state";
+    case Counter::kPipelineWaitMicros:
+      return "pipeline_wait_us";
+    case Counter::kBarrierCommands:
+      return "barrier_commands";
+    case Counter::kBarriers:
+      return "barriers";
+    default:
+      assert_unhandled_case(counter);
+      return "";
+  }
+}
+
+GpuStatistics::GpuStatistics() {
+  if (cvars::gpu_statistics_csv_path.empty()) {
+    return;
+  }
+  csv_file_ = xe::filesystem::OpenFile(cvars::gpu_statistics_csv_path, "w");
+  if (!csv_file_) {
+    XELOGE("Failed to open the GPU statistics CSV file {}",
+           xe::path_to_utf8(cvars::gpu_statistics_csv_path));
+    return;
+  }
+  std::string header = "type,index,frame,submissions,gpu_time_us";
+  for (uint32_t i = 0; i < kCounterCount; ++i) {
+    header += ',';
+    header += GetCounterName(Counter(i));
+  }
+  header += '\n';
+  std::fwrite(header.data(), 1, header.size(), csv_file_);
+}
+
+GpuStatistics::~GpuStatistics() {
+  if (csv_file_) {
+    std::fclose(csv_file_);
+  }
+}
+
+void GpuStatistics::EndSubmission(uint64_t submission) {
+  assert_true(pending_submissions_.empty() ||
+              pending_submissions_.back().submission < submission);
+  PendingSubmission& pending_submission =
+      pending_submissions_.emplace_back();
+  pending_submission.submission = submission;
+  pending_submission.frame = frame_current_;
+  pending_submission.values = current_submission_;
+  pending_submission.values.submissions = 1;
+  pending_submission.is_submission = true;
+  pending_submission.closes_frame = false;
+  current_submission_ = Values();
+}
+
+void GpuStatistics::EndFrame() {
+  uint64_t end_time = Clock::QueryHostTickCount();
+  {
+    std::lock_guard<std::mutex> lock(last_frame_mutex_);
+    if (frame_last_end_time_) {
+      frame_time_ms_history_[frame_time_ms_history_next_] =
+          float(double(end_time - frame_last_end_time_) * 1000.0 /
+                double(Clock::QueryHostTickFrequency()));
+      frame_time_ms_history_next_ =
+          (frame_time_ms_history_next_ + 1) % kFrameHistoryLength;
+    }
+    frame_ended_index_ = frame_current_;
+  }
+  frame_last_end_time_ = end_time;
+  if (frame_intervals_recording_.load(std::memory_order_relaxed)) {
+    std::lock_guard<std::mutex> lock(frame_intervals_mutex_);
+    if (frame_intervals_last_end_time_) {
+      frame_intervals_us_.push_back(
+          (end_time - frame_intervals_last_end_time_) * 1000000 /
+          Clock::QueryHostTickFrequency());
+    }
+    frame_intervals_last_end_time_ = end_time;
+  }
+
+  uint64_t frame = frame_current_++;
+  if (pending_submissions_.empty()) {
+    FinishFrame(frame);
+    return;
+  }
+  if (!pending_submissions_.back().closes_frame) {
+    pending_submissions_.back().closes_frame = true;
+    return;
+  }
+  // The latest submission already closes the previous frame - finish this one
+  // along with it.
+  uint64_t submission = pending_submissions_.back().submission;
+  PendingSubmission& pending_frame = pending_submissions_.emplace_back();
+  pending_frame.submission = submission;
+  pending_frame.frame = frame;
+  pending_frame.is_submission = false;
+  pending_frame.closes_frame = true;
+}
+
+void GpuStatistics::SubmissionCompleted(uint64_t submission,
+                                        uint64_t gpu_time_ns) {
+  while (!pending_submissions_.empty()) {
+    PendingSubmission& pending_submission = pending_submissions_.front();
+    if (pending_submission.submission > submission) {
+      break;
+    }
+    if (pending_submission.is_submission) {
+      Values& values = pending_submission.values;
+      if (pending_submission.submission == submission &&
+          gpu_time_ns != kGpuTimeUnknown) {
+        values.gpu_time_ns = gpu_time_ns;
+        values.submissions_measured = 1;
+      }
+      WriteCsvRow("submission", pending_submission.submission,
+                  pending_submission.frame, values);
+      for (uint32_t i = 0; i < kCounterCount; ++i) {
+        current_frame_.counters[i] += values.counters[i];
+      }
+      current_frame_.gpu_time_ns += values.gpu_time_ns;
+      current_frame_.submissions += values.submissions;
+      current_frame_.submissions_measured += values.submissions_measured;
+    }
+    if (pending_submission.closes_frame) {
+      FinishFrame(pending_submission.frame);
+    }
+    pending_submissions_.pop_front();
+  }
+}
+
+uint64_t GpuStatistics::GetLastFrame(
+    Values& values_out,
+    std::array<float, kFrameHistoryLength>* gpu_time_ms_history_out) const {
+  std::lock_guard<std::mutex> lock(last_frame_mutex_);
+  values_out = last_frame_;
+  if (gpu_time_ms_history_out) {
+    for (uint32_t i = 0; i < kFrameHistoryLength; ++i) {
+      (*gpu_time_ms_history_out)[i] =
+          gpu_time_ms_history_[(gpu_time_ms_history_next_ + i) %
+                               kFrameHistoryLength];
+    }
+  }
+  return last_frame_index_;
+}
+
+uint64_t GpuStatistics::GetFrameTimeHistory(
+    std::array<float, kFrameHistoryLength>& frame_time_ms_history_out) const {
+  std::lock_guard<std::mutex> lock(last_frame_mutex_);
+  for (uint32_t i = 0; i < kFrameHistoryLength; ++i) {
+    frame_time_ms_history_out[i] =
+        frame_time_ms_history_[(frame_time_ms_history_next_ + i) %
+                               kFrameHistoryLength];
+  }
+  return frame_ended_index_;
+}
+
+uint64_t GpuStatistics::GetTotals(Values& totals_out) const {
+  std::lock_guard<std::mutex> lock(last_frame_mutex_);
+  totals_out = totals_;
+  return last_frame_index_;
+}
+
+void GpuStatistics::BeginFrameIntervalRecording() {
+  std::lock_guard<std::mutex> lock(frame_intervals_mutex_);
+  frame_intervals_last_end_time_ = 0;
+  frame_intervals_us_.clear();
+  frame_intervals_recording_.store(true, std::memory_order_relaxed);
+}
+
+std::vector<uint64_t> GpuStatistics::EndFrameIntervalRecording() {
+  std::lock_guard<std::mutex> lock(frame_intervals_mutex_);
+  frame_intervals_recording_.store(false, std::memory_order_relaxed);
+  std::vector<uint64_t> frame_intervals_us;
+  frame_intervals_us.swap(frame_intervals_us_);
+  return frame_intervals_us;
+}
+
+void GpuStatistics::FinishFrame(uint64_t frame) {
+  WriteCsvRow("frame", frame, frame, current_frame_);
+  {
+    std::lock_guard<std::mutex> lock(last_frame_mutex_);
+    last_frame_ = current_frame_;
+    last_frame_index_ = frame;
+    gpu_time_ms_history_[gpu_time_ms_history_next_] =
+        float(double(current_frame_.gpu_time_ns) * 0.000001);
+    gpu_time_ms_history_next_ =
+        (gpu_time_ms_history_next_ + 1) % kFrameHistoryLength;
+    for (uint32_t i = 0; i < kCounterCount; ++i) {
+      totals_.counters[i] += current_frame_.counters[i];
+    }
+    totals_.gpu_time_ns += current_frame_.gpu_time_ns;
+    totals_.submissions += current_frame_.submissions;
+    totals_.submissions_measured += current_frame_.submissions_measured;
+  }
+  current_frame_ = Values();
+}
+
+void GpuStatistics::WriteCsvRow(const char* type, uint64_t index,
+                                uint64_t frame, const Values& values) {
+  if (!csv_file_) {
+    return;
+  }
+  std::string row = fmt::format("{},{},{},{},", type, index, frame,
+                                values.submissions);
+  // Empty if none of the submissions have been measured.
+  if (values.submissions_measured) {
+    row += fmt::format("{:.3f}", double(values.gpu_time_ns) * 0.001);
+  }
+  for (uint32_t i = 0; i < kCounterCount; ++i) {
+    row += fmt::format(",{}", values.counters[i]);
+  }
+  row += '\n';
+  std::fwrite(row.data(), 1, row.size(), csv_file_);
+}
+
+}  // namespace gpu
+}  // namespace xe
@@ -0,0 +1,214 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_GPU_GPU_STATISTICS_H_
+#define XENIA_GPU_GPU_STATISTICS_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace xe {
+namespace gpu {
+
+// Per-submission and per-frame counters of the work done by the command
+// processor and the caches, and the host GPU execution time of the
+// submissions measured with timestamp queries by the backend. Accumulated on
+// the command processor thread, the latest finished frames can be read from
+// any thread (for the overlay), as well as the totals of all completed frames
+// (for benchmarking). Optionally written to a CSV file (see
+// --gpu_statistics_csv_path).
+class GpuStatistics {
+ public:
+  enum class Counter : uint32_t {
+    kDraws,
+    kResolves,
+    // Render target ownership transfers in the EDRAM.
+    kEdramTransfers,
+    // Host render passes interrupting guest rendering to perform ownership
+    // transfers and resolve clears (Vulkan) - each means storing and reloading
+    // the attachments, which is especially expensive on tile-based GPUs.
+    kEdramTransferRenderPasses,
+    kTextureLoads,
+    // Guest bytes of the texture levels loaded from the guest memory.
+    kTextureLoadBytes,
+    // Bytes uploaded from the guest memory to the shared memory.
+    kUploadBytes,
+    // Bytes of the shared memory and the constant upload buffers skipped for
+    // alignment or left unused at the ends of their pages.
+    kUploadBytesWasted,
+    // Sparse host GPU memory allocations of the shared memory, and the bytes
+    // allocated by them in total and ahead of time, predicted from the guest
+    // physical memory allocations (see --shared_memory_sparse_prediction).
+    kSharedMemoryAllocations,
+    kSharedMemoryAllocatedBytes,
+    kSharedMemoryPredictedBytes,
+    kPipelinesCreated,
+    // Distinct guest fixed-function state combinations drawn with a pipeline
+    // created for a different one, as the state differing between them is
+    // dynamic on the host.
+    kPipelinesSharedByDynamicState,
+    // Time the command processor thread has spent awaiting the creation of
+    // pipelines used by the submission, in microseconds.
+    kPipelineWaitMicros,
+    // Host pipeline barrier commands (Vulkan) or ResourceBarrier calls
+    // (Direct3D 12), and the individual resource barriers submitted by them.
+    kBarrierCommands,
+    kBarriers,
+
+    kCount,
+  };
+  static constexpr uint32_t kCounterCount = uint32_t(Counter::kCount);
+  static const char* GetCounterName(Counter counter);
+
+  // Current values of the state of the caches rather than amounts of work,
+  // set by the command processor at the end of every submission, and readable
+  // from any thread at any time.
+  enum class Gauge : uint32_t {
+    // Host memory used by the textures, and the limits unused textures are
+    // evicted at (see --texture_cache_memory_limit_*, including the adaptation
+    // to the resolution scale and to the host memory budget).
+    kTextureMemoryBytes,
+    kTextureMemoryLimitSoftBytes,
+    kTextureMemoryLimitHardBytes,
+    // Pipelines queued for creation or being created on the creation threads.
+    kPipelinesPending,
+
+    kCount,
+  };
+  static constexpr uint32_t kGaugeCount = uint32_t(Gauge::kCount);
+
+  // Host GPU time value for submissions that haven't been measured.
+  static constexpr uint64_t kGpuTimeUnknown = UINT64_MAX;
+
+  struct Values {
+    uint64_t counters[kCounterCount] = {};
+    // Sum of the host GPU execution times of the measured submissions.
+    uint64_t gpu_time_ns = 0;
+    uint32_t submissions = 0;
+    uint32_t submissions_measured = 0;
+
+    uint64_t operator[](Counter counter) const {
+      return counters[uint32_t(counter)];
+    }
+  };
+
+  static constexpr uint32_t kFrameHistoryLength = 128;
+
+  GpuStatistics();
+  GpuStatistics(const GpuStatistics& statistics) = delete;
+  GpuStatistics& operator=(const GpuStatistics& statistics) = delete;
+  ~GpuStatistics();
+
+  // Command processor thread functions.
+
+  void Add(Counter counter, uint64_t count = 1) {
+    current_submission_.counters[uint32_t(counter)] += count;
+  }
+  // For counters that the caches track as a total since their creation.
+  void SetTotal(Counter counter, uint64_t total) {
+    uint64_t& last_total = last_totals_[uint32_t(counter)];
+    current_submission_.counters[uint32_t(counter)] += total - last_total;
+    last_total = total;
+  }
+
+  void SetGauge(Gauge gauge, uint64_t value) {
+    gauges_[uint32_t(gauge)].store(value, std::memory_order_relaxed);
+  }
+
+  // Attributes the counters accumulated since the previous submission to the
+  // host submission that has just been sent to the queue.
+  void EndSubmission(uint64_t submission);
+  // Closes the guest frame after the latest ended submission.
+  void EndFrame();
+  // Must be called in the order of the submissions once the host GPU has
+  // completed them, with kGpuTimeUnknown if the time couldn't be measured.
+  void SubmissionCompleted(uint64_t submission, uint64_t gpu_time_ns);
+
+  // Thread-safe. Returns the index of the latest completed frame, or 0 if no
+  // frames have been completed yet. The history is ordered from the oldest to
+  // the newest frame.
+  uint64_t GetLastFrame(
+      Values& values_out,
+      std::array<float, kFrameHistoryLength>* gpu_time_ms_history_out =
+          nullptr) const;
+  // Thread-safe. Returns the index of the latest frame ended on the command
+  // processor thread, and the host time between the ends of the latest frames
+  // on it, ordered from the oldest to the newest, with zeros for the frames
+  // before the first.
+  uint64_t GetFrameTimeHistory(
+      std::array<float, kFrameHistoryLength>& frame_time_ms_history_out) const;
+  // Thread-safe.
+  uint64_t GetGauge(Gauge gauge) const {
+    return gauges_[uint32_t(gauge)].load(std::memory_order_relaxed);
+  }
+  // Thread-safe. Returns the sums of the values of all completed frames, and
+  // the index of the latest completed frame.
+  uint64_t GetTotals(Values& totals_out) const;
+
+  // Thread-safe. Starts collecting the host time between the ends of the
+  // guest frames on the command processor thread, discarding the previously
+  // collected intervals.
+  void BeginFrameIntervalRecording();
+  // Thread-safe. Stops collecting the frame intervals and returns them, in
+  // microseconds.
+  std::vector<uint64_t> EndFrameIntervalRecording();
+
+ private:
+  struct PendingSubmission {
+    uint64_t submission;
+    uint64_t frame;
+    Values values;
+    // False for a frame closed without a submission of its own.
+    bool is_submission;
+    bool closes_frame;
+  };
+
+  void FinishFrame(uint64_t frame);
+  void WriteCsvRow(const char* type, uint64_t index, uint64_t frame,
+                   const Values& values);
+
+  Values current_submission_;
+  uint64_t last_totals_[kCounterCount] = {};
+  std::deque<PendingSubmission> pending_submissions_;
+  // Completed submissions of the frame that hasn't been completed yet.
+  Values current_frame_;
+  uint64_t frame_current_ = 1;
+  // 0 before the end of the first frame.
+  uint64_t frame_last_end_time_ = 0;
+
+  FILE* csv_file_ = nullptr;
+
+  mutable std::mutex last_frame_mutex_;
+  Values last_frame_;
+  uint64_t last_frame_index_ = 0;
+  std::array<float, kFrameHistoryLength> gpu_time_ms_history_ = {};
+  uint32_t gpu_time_ms_history_next_ = 0;
+  Values totals_;
+  std::array<float, kFrameHistoryLength> frame_time_ms_history_ = {};
+  uint32_t frame_time_ms_history_next_ = 0;
+  uint64_t frame_ended_index_ = 0;
+
+  std::atomic<uint64_t> gauges_[kGaugeCount] = {};
+
+  std::atomic<bool> frame_intervals_recording_ = {false};
+  std::mutex frame_intervals_mutex_;
+  // 0 before the end of the first frame since the start of the recording.
+  uint64_t frame_intervals_last_end_time_ = 0;
+  std::vector<uint64_t> frame_intervals_us_;
+};
+
+}  // namespace gpu
+}  // namespace xe
+
+#endif  // XENIA_GPU_GPU_STATISTICS_H_
@@ -23,16 +23,11 @@
 #include "xenia/base/threading.h"
 #include "xenia/gpu/command_processor.h"
 #include "xenia/gpu/gpu_flags.h"
+#include "xenia/kernel/kernel_state.h"
 #include "xenia/ui/graphics_provider.h"
 #include "xenia/ui/window.h"
 #include "xenia/ui/windowed_app_context.h"
 
-DEFINE_bool(
-    store_shaders, true,
-    "Store shaders persistently and load them when loading games to avoid "
-    "runtime spikes and freezes when playing the game not for the first time.",
-    "GPU");
-
 namespace xe {
 namespace gpu {
 
@@ -52,10 +47,20 @@ GraphicsSystem::GraphicsSystem() : vsync_worker_running_(false) {}
 
 GraphicsSystem::~GraphicsSystem() = default;
 
+void GraphicsSystem::InitializeProvider(bool is_surface_required) {
+  if (provider_initialized_) {
+    return;
+  }
+  provider_ = CreateProvider(is_surface_required);
+  provider_initialized_ = true;
+}
+
 X_STATUS GraphicsSystem::Setup(cpu::Processor* processor,
                                kernel::KernelState* kernel_state,
                                ui::WindowedAppContext* app_context,
-                               [[maybe_unused]] bool is_surface_required) {
+                               bool is_surface_required) {
+  InitializeProvider(is_surface_required);
+
   memory_ = processor->memory();
   processor_ = processor;
   kernel_state_ = kernel_state;
@@ -100,6 +105,9 @@ X_STATUS GraphicsSystem::Setup(cpu::Processor* processor,
       new kernel::XHostThread(kernel_state_, 128 * 1024, 0, [this]() {
         uint64_t vsync_duration = cvars::vsync ? 16 : 1;
         uint64_t last_frame_time = Clock::QueryGuestTickCount();
+        kernel::util::IdleTimeSkipper& idle_time_skipper =
+            kernel_state_->idle_time_skipper();
+        kernel::util::IdleTimeSkipper::Deadline vblank_deadline;
         while (vsync_worker_running_) {
           uint64_t current_time = Clock::QueryGuestTickCount();
           uint64_t elapsed = (current_time - last_frame_time) /
@@ -108,8 +116,18 @@ X_STATUS GraphicsSystem::Setup(cpu::Processor* processor,
             MarkVblank();
             last_frame_time = current_time;
           }
+          if (idle_time_skipper.is_enabled()) {
+            // Don't skip past the next vblank, and skip the time while all the
+            // guest threads are in untimed waits.
+            idle_time_skipper.SetDeadline(
+                vblank_deadline,
+                last_frame_time +
+                    vsync_duration * Clock::guest_tick_frequency() / 1000);
+            idle_time_skipper.TrySkip();
+          }
           xe::threading::Sleep(std::chrono::milliseconds(1));
         }
+        idle_time_skipper.ClearDeadline(vblank_deadline);
         return 0;
       }));
   // As we run vblank interrupts the debugger must be able to suspend us.
@@ -119,6 +137,8 @@ X_STATUS GraphicsSystem::Setup(cpu::Processor* processor,
 
   if (cvars::trace_gpu_stream) {
     BeginTracing();
+  } else if (cvars::trace_gpu_ring_frames) {
+    BeginRingTracing();
   }
 
   return X_STATUS_SUCCESS;
@@ -255,9 +275,22 @@ void GraphicsSystem::DispatchInterruptCallback(uint32_t source, uint32_t cpu) {
   // XELOGGPU("Dispatching GPU interrupt at {:08X} w/ mode {} on cpu {}",
   //          interrupt_callback_, source, cpu);
 
+  uint32_t callback = interrupt_callback_;
+  cpu::Function* callback_function =
+      interrupt_callback_function_.load(std::memory_order_relaxed);
+  if (!callback_function || callback_function->address() != callback) {
+    callback_function = processor_->ResolveFunction(callback);
+    if (!callback_function) {
+      XELOGE("Failed to resolve the interrupt callback {:08X}", callback);
+      return;
+    }
+    interrupt_callback_function_.store(callback_function,
+                                       std::memory_order_relaxed);
+  }
+
   uint64_t args[] = {source, interrupt_callback_data_};
-  processor_->ExecuteInterrupt(thread->thread_state(), interrupt_callback_,
-                               args, xe::countof(args));
+  processor_->ExecuteInterrupt(thread->thread_state(), callback_function, args,
+                               xe::countof(args));
 }
 
 void GraphicsSystem::MarkVblank() {
@@ -279,7 +312,7 @@ void GraphicsSystem::ClearCaches() {
 
 void GraphicsSystem::InitializeShaderStorage(
     const std::filesystem::path& cache_root, uint32_t title_id, bool blocking) {
-  if (!cvars::store_shaders) {
+  if (!cvars::store_shaders && !cvars::store_textures) {
     return;
   }
   if (blocking) {
@@ -310,6 +343,11 @@ void GraphicsSystem::BeginTracing() {
   command_processor_->BeginTracing(cvars::trace_gpu_prefix);
 }
 
+void GraphicsSystem::BeginRingTracing() {
+  command_processor_->BeginRingTracing(cvars::trace_gpu_prefix,
+                                       cvars::trace_gpu_ring_frames);
+}
+
 void GraphicsSystem::EndTracing() { command_processor_->EndTracing(); }
 
 void GraphicsSystem::Pause() {
@@ -48,6 +48,11 @@ class GraphicsSystem {
   ui::GraphicsProvider* provider() const { return provider_.get(); }
   ui::Presenter* presenter() const { return presenter_.get(); }
 
+  // Creates the host graphics provider and device if not done yet. Doesn't
+  // depend on the other subsystems, so may be called on any thread before
+  // Setup, in parallel with their initialization, as it may take a long time.
+  void InitializeProvider(bool is_surface_required);
+
   virtual X_STATUS Setup(cpu::Processor* processor,
                          kernel::KernelState* kernel_state,
                          ui::WindowedAppContext* app_context,
@@ -77,6 +82,7 @@ class GraphicsSystem {
 
   void RequestFrameTrace();
   void BeginTracing();
+  void BeginRingTracing();
   void EndTracing();
 
   bool is_paused() const { return paused_; }
@@ -89,6 +95,10 @@ class GraphicsSystem {
  protected:
   GraphicsSystem();
 
+  virtual std::unique_ptr<ui::GraphicsProvider> CreateProvider(
+      [[maybe_unused]] bool is_surface_required) {
+    return nullptr;
+  }
   virtual std::unique_ptr<CommandProcessor> CreateCommandProcessor() = 0;
 
   static uint32_t ReadRegisterThunk(void* ppc_context, GraphicsSystem* gs,
@@ -105,9 +115,14 @@ class GraphicsSystem {
   kernel::KernelState* kernel_state_ = nullptr;
   ui::WindowedAppContext* app_context_ = nullptr;
   std::unique_ptr<ui::GraphicsProvider> provider_;
+  // The provider may be null even after the attempt to create it.
+  bool provider_initialized_ = false;
 
   uint32_t interrupt_callback_ = 0;
   uint32_t interrupt_callback_data_ = 0;
+  // The interrupt callback resolved when it was last dispatched, so it's not
+  // looked up for every interrupt.
+  std::atomic<cpu::Function*> interrupt_callback_function_{nullptr};
 
   std::atomic<bool> vsync_worker_running_;
   kernel::object_ref<kernel::XHostThread> vsync_worker_thread_;
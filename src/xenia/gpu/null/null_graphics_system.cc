@@ -21,15 +21,11 @@ NullGraphicsSystem::NullGraphicsSystem() {}
 
 NullGraphicsSystem::~NullGraphicsSystem() {}
 
-X_STATUS NullGraphicsSystem::Setup(cpu::Processor* processor,
-                                   kernel::KernelState* kernel_state,
-                                   ui::WindowedAppContext* app_context,
-                                   bool is_surface_required) {
+std::unique_ptr<ui::GraphicsProvider> NullGraphicsSystem::CreateProvider(
+    bool is_surface_required) {
   // This is a null graphics system, but we still setup vulkan because UI needs
   // it through us :|
-  provider_ = xe::ui::vulkan::VulkanProvider::Create(is_surface_required);
-  return GraphicsSystem::Setup(processor, kernel_state, app_context,
-                               is_surface_required);
+  return xe::ui::vulkan::VulkanProvider::Create(is_surface_required);
 }
 
 std::unique_ptr<CommandProcessor> NullGraphicsSystem::CreateCommandProcessor() {
@@ -62,12 +62,20 @@ DEFINE_bool(
 DEFINE_int32(
     primitive_processor_cache_min_indices, 4096,
     "Smallest number of guest indices to store in the cache to try reusing "
-    "later in the same frame if processing (such as primitive type conversion "
-    "or reset index replacement) is performed.\n"
+    "later in the same or in the subsequent frames if processing (such as "
+    "primitive type conversion or reset index replacement) is performed.\n"
     "Setting this to a very high value may result in excessive CPU processing, "
     "while a very low value may result in excessive locking and lookups.\n"
     "Negative values disable caching.",
     "GPU");
+DEFINE_int32(
+    primitive_processor_cache_max_size_mb, 64,
+    "Maximum size of the converted index buffer cache, including the copies of "
+    "the converted indices kept for reuse in the subsequent frames, in "
+    "megabytes. The least recently used entries over the limit are evicted in "
+    "the end of every frame.\n"
+    "0 keeps the converted indices only within one frame.",
+    "GPU");
 
 namespace xe {
 namespace gpu {
@@ -248,11 +256,18 @@ void PrimitiveProcessor::ShutdownCommon() {
       auto global_lock = global_critical_region_.Acquire();
       cache_map_.clear();
       cache_bucket_free_first_entry_ = SIZE_MAX;
+      cache_lru_first_entry_ = SIZE_MAX;
+      cache_lru_last_entry_ = SIZE_MAX;
+      cache_size_bytes_ = 0;
       std::memset(cache_buckets_non_empty_l1_, 0,
                   sizeof(cache_buckets_non_empty_l1_));
       std::memset(cache_buckets_non_empty_l2_, 0,
                   sizeof(cache_buckets_non_empty_l2_));
     }
+    if (cache_shared_memory_watch_handle_) {
+      shared_memory_.UnregisterGlobalWatch(cache_shared_memory_watch_handle_);
+      cache_shared_memory_watch_handle_ = nullptr;
+    }
     memory_.UnregisterPhysicalMemoryInvalidationCallback(
         memory_invalidation_callback_handle_);
     memory_invalidation_callback_handle_ = nullptr;
@@ -260,27 +275,35 @@ void PrimitiveProcessor::ShutdownCommon() {
   }
 }
 
-void PrimitiveProcessor::ClearPerFrameCache() {
+void PrimitiveProcessor::EndCacheFrame() {
   if (!memory_invalidation_callback_handle_) {
-    // Only do clearing if cache has ever been used.
+    // Only do eviction if cache has ever been used.
     return;
   }
   auto global_lock = global_critical_region_.Acquire();
-  for (const std::pair<CacheKey, size_t>& cache_map_entry : cache_map_) {
-    cache_entry_pool_[cache_map_entry.second].free_next =
-        cache_bucket_free_first_entry_;
-    cache_bucket_free_first_entry_ = cache_map_entry.second;
+  ++cache_frame_;
+  uint64_t cache_size_limit =
+      uint64_t(std::max(cvars::primitive_processor_cache_max_size_mb, 0))
+      << 20;
+  while (cache_lru_first_entry_ != SIZE_MAX &&
+         cache_size_bytes_ > cache_size_limit) {
+    RemoveCacheEntry(cache_lru_first_entry_, global_lock);
+  }
+  // Release the host-converted indices of the invalidated and the evicted
+  // entries - safe here as they're not being read by the processor now.
+  for (size_t entry_index = cache_bucket_free_first_entry_;
+       entry_index != SIZE_MAX;
+       entry_index = cache_entry_pool_[entry_index].free_next) {
+    std::vector<uint8_t>().swap(cache_entry_pool_[entry_index].host_indices);
   }
-  cache_map_.clear();
-  std::memset(cache_buckets_non_empty_l1_, 0,
-              sizeof(cache_buckets_non_empty_l1_));
-  std::memset(cache_buckets_non_empty_l2_, 0,
-              sizeof(cache_buckets_non_empty_l2_));
 }
 
 bool PrimitiveProcessor::Process(ProcessingResult& result_out) {
   SCOPE_profile_cpu_f("gpu");
 
+  // Drop the cached conversion results overwritten by the GPU.
+  shared_memory_.CommitRangesWrittenByGpu();
+
   const RegisterFile& regs = register_file_;
   auto vgt_draw_initiator = regs.Get<reg::VGT_DRAW_INITIATOR>();
 
@@ -673,6 +696,17 @@ bool PrimitiveProcessor::Process(ProcessingResult& result_out) {
         guest_index_format == xenos::IndexFormat::kInt16
             ? UINT16_MAX
             : GpuSwap(xenos::kVertexIndexMask, guest_index_endian);
+    // TODO(Triang3l): Compute shader conversion of large index buffers (above a
+    // threshold, with the CPU path kept for small ones) directly from the
+    // shared memory buffer to a GPU-side ring buffer. Reset index usage is
+    // only known on the GPU in this case, so the host draw would need to be
+    // indirect for the primitive type conversions changing the index count
+    // (triangle fans and line loops with primitive reset), with the arguments
+    // written by the shader from prefix sums of the primitive lengths. Reset
+    // index replacement and quad list conversion can write to a buffer with
+    // the size known on the CPU directly. This also needs a RequestRange of the
+    // guest indices, a barrier before the draw, and new shaders for both
+    // backends.
     if (host_primitive_type != guest_primitive_type) {
       // Already converting to a different index type - primitive reset is
       // performed during conversion here. Also doing the endian swap here for
@@ -745,6 +779,7 @@ bool PrimitiveProcessor::Process(ProcessingResult& result_out) {
               host_indices, guest_indices, guest_primitive_type,
               PassthroughIndexTransform(), single_primitive_ranges_.cbegin(),
               single_primitive_ranges_.cend());
+          cache_transaction.SetNewResult(cacheable, host_indices);
         } else {
           // 32-bit indices - may need to pre-swap and pre-mask also if the host
           // doesn't support full 32-bit vertex indices.
@@ -819,8 +854,8 @@ bool PrimitiveProcessor::Process(ProcessingResult& result_out) {
             }
             cacheable.host_shader_index_endian = xenos::Endian::kNone;
           }
+          cache_transaction.SetNewResult(cacheable, host_indices);
         }
-        cache_transaction.SetNewResult(cacheable);
       }
     } else {
       // Using the same indices on the host as on the guest, either directly or
@@ -886,8 +921,10 @@ bool PrimitiveProcessor::Process(ProcessingResult& result_out) {
                       guest_indices, guest_draw_vertex_count,
                       guest_primitive_reset_index_guest_endian);
                 }
+                cache_transaction.SetNewResult(cacheable, host_indices_ptr);
+              } else {
+                cache_transaction.SetNewResult(cacheable);
               }
-              cache_transaction.SetNewResult(cacheable);
             }
           }
         } else {
@@ -954,8 +991,10 @@ bool PrimitiveProcessor::Process(ProcessingResult& result_out) {
               cacheable.host_shader_index_endian =
                   full_32bit_vertex_indices_used_ ? guest_index_endian
                                                   : xenos::Endian::kNone;
+              cache_transaction.SetNewResult(cacheable, host_indices);
+            } else {
+              cache_transaction.SetNewResult(cacheable);
             }
-            cache_transaction.SetNewResult(cacheable);
           }
         }
       }
@@ -1427,12 +1466,26 @@ PrimitiveProcessor::CacheTransaction::CacheTransaction(
       (key_.format == xenos::IndexFormat::kInt16 ? sizeof(uint16_t)
                                                  : sizeof(uint32_t)) *
       key_.count;
+  size_t reupload_entry_index = SIZE_MAX;
+  const uint8_t* reupload_host_indices = nullptr;
+  size_t reupload_host_indices_size = 0;
   {
     auto global_lock = processor_.global_critical_region_.Acquire();
     auto cache_map_it = processor_.cache_map_.find(key_);
     if (cache_map_it != processor_.cache_map_.end()) {
-      result_ = processor_.cache_entry_pool_[cache_map_it->second].result;
+      size_t entry_index = cache_map_it->second;
+      const CacheEntry& entry = processor_.cache_entry_pool_[entry_index];
+      result_ = entry.result;
       result_type_ = ResultType::kExisting;
+      processor_.UnlinkCacheEntryFromLru(entry_index, global_lock);
+      processor_.LinkCacheEntryToLru(entry_index, global_lock);
+      if (result_.index_buffer_type ==
+              ProcessedIndexBufferType::kHostConverted &&
+          entry.host_index_buffer_frame != processor_.cache_frame_) {
+        reupload_entry_index = entry_index;
+        reupload_host_indices = entry.host_indices.data();
+        reupload_host_indices_size = entry.host_indices.size();
+      }
     } else {
       // Inhibit writing the new result if the range happens to be modified
       // during the processing outside the lock.
@@ -1440,6 +1493,36 @@ PrimitiveProcessor::CacheTransaction::CacheTransaction(
       processor_.cache_currently_processing_size_bytes_ = size_bytes;
     }
   }
+  if (reupload_entry_index != SIZE_MAX) {
+    // The host-converted indices were written to a buffer of a previous frame -
+    // copy them to a buffer of the current frame outside the lock (the host
+    // copy is only released by the processor itself).
+    void* host_indices =
+        reupload_host_indices_size
+            ? processor_.RequestHostConvertedIndexBufferForCurrentFrame(
+                  result_.host_index_format, result_.host_draw_vertex_count,
+                  false, key_.base, result_.host_index_buffer_handle)
+            : nullptr;
+    if (!host_indices) {
+      // Process the indices without the cache.
+      key_.key = 0;
+      result_type_ = ResultType::kNewUnset;
+      return;
+    }
+    std::memcpy(host_indices, reupload_host_indices,
+                reupload_host_indices_size);
+    auto global_lock = processor_.global_critical_region_.Acquire();
+    // Let the draws in the rest of the frame reuse the new buffer if the entry
+    // hasn't been invalidated in the meantime.
+    auto cache_map_it = processor_.cache_map_.find(key_);
+    if (cache_map_it != processor_.cache_map_.end() &&
+        cache_map_it->second == reupload_entry_index) {
+      CacheEntry& entry = processor_.cache_entry_pool_[reupload_entry_index];
+      entry.result.host_index_buffer_handle = result_.host_index_buffer_handle;
+      entry.host_index_buffer_frame = processor_.cache_frame_;
+    }
+    return;
+  }
   if (result_type_ != ResultType::kExisting) {
     // Enable the invalidation callback before reading the indices.
     // Also, only enable invalidation callbacks if anything needed processing at
@@ -1449,12 +1532,37 @@ PrimitiveProcessor::CacheTransaction::CacheTransaction(
       processor_.memory_invalidation_callback_handle_ =
           processor_.memory_.RegisterPhysicalMemoryInvalidationCallback(
               MemoryInvalidationCallbackThunk, &processor_);
+      processor_.cache_shared_memory_watch_handle_ =
+          processor_.shared_memory_.RegisterGlobalWatch(
+              SharedMemoryGlobalWatchCallbackThunk, &processor_);
     }
     processor_.memory_.EnablePhysicalMemoryAccessCallbacks(
         key_.base, size_bytes, true, false);
   }
 }
 
+void PrimitiveProcessor::CacheTransaction::SetNewResult(
+    const CachedResult& new_result, const void* host_indices) {
+  // Replacement of an existing entry is not allowed.
+  assert_true(result_type_ != ResultType::kExisting);
+  result_ = new_result;
+  result_type_ = ResultType::kNewSet;
+  // Keep a copy of the converted indices for the subsequent frames, unless the
+  // entries are evicted in the end of every frame anyway.
+  if (key_.count && host_indices &&
+      new_result.index_buffer_type ==
+          ProcessedIndexBufferType::kHostConverted &&
+      cvars::primitive_processor_cache_max_size_mb > 0) {
+    size_t host_indices_size =
+        (new_result.host_index_format == xenos::IndexFormat::kInt16
+             ? sizeof(uint16_t)
+             : sizeof(uint32_t)) *
+        new_result.host_draw_vertex_count;
+    host_indices_.resize(host_indices_size);
+    std::memcpy(host_indices_.data(), host_indices, host_indices_size);
+  }
+}
+
 PrimitiveProcessor::CacheTransaction::~CacheTransaction() {
   if (!key_.count || result_type_ == ResultType::kExisting) {
     return;
@@ -1462,10 +1570,14 @@ PrimitiveProcessor::CacheTransaction::~CacheTransaction() {
 
   auto global_lock = processor_.global_critical_region_.Acquire();
 
+  // Reset by the invalidation callback if the range has been modified during
+  // the processing.
+  bool invalidated_during_processing =
+      !processor_.cache_currently_processing_size_bytes_;
   processor_.cache_currently_processing_base_ = 0;
   processor_.cache_currently_processing_size_bytes_ = 0;
 
-  if (result_type_ == ResultType::kNewSet) {
+  if (result_type_ == ResultType::kNewSet && !invalidated_during_processing) {
     size_t new_entry_index;
     if (processor_.cache_bucket_free_first_entry_ != SIZE_MAX) {
       new_entry_index = processor_.cache_bucket_free_first_entry_;
@@ -1511,11 +1623,104 @@ PrimitiveProcessor::CacheTransaction::~CacheTransaction() {
 
     new_entry.key = key_;
     new_entry.result = result_;
+    new_entry.host_index_buffer_frame = processor_.cache_frame_;
+    // The previous host indices of a reused entry, if not released yet, will be
+    // released along with the transaction.
+    new_entry.host_indices.swap(host_indices_);
+    processor_.LinkCacheEntryToLru(new_entry_index, global_lock);
+    processor_.cache_size_bytes_ += GetCacheEntrySizeBytes(new_entry);
 
     processor_.cache_map_.emplace(key_, new_entry_index);
   }
 }
 
+void PrimitiveProcessor::LinkCacheEntryToLru(
+    size_t entry_index,
+    [[maybe_unused]] const std::unique_lock<std::recursive_mutex>&
+        global_lock) {
+  CacheEntry& entry = cache_entry_pool_[entry_index];
+  entry.lru_prev = cache_lru_last_entry_;
+  entry.lru_next = SIZE_MAX;
+  if (cache_lru_last_entry_ != SIZE_MAX) {
+    cache_entry_pool_[cache_lru_last_entry_].lru_next = entry_index;
+  } else {
+    cache_lru_first_entry_ = entry_index;
+  }
+  cache_lru_last_entry_ = entry_index;
+}
+
+void PrimitiveProcessor::UnlinkCacheEntryFromLru(
+    size_t entry_index,
+    [[maybe_unused]] const std::unique_lock<std::recursive_mutex>&
+        global_lock) {
+  CacheEntry& entry = cache_entry_pool_[entry_index];
+  if (entry.lru_prev != SIZE_MAX) {
+    cache_entry_pool_[entry.lru_prev].lru_next = entry.lru_next;
+  } else {
+    cache_lru_first_entry_ = entry.lru_next;
+  }
+  if (entry.lru_next != SIZE_MAX) {
+    cache_entry_pool_[entry.lru_next].lru_prev = entry.lru_prev;
+  } else {
+    cache_lru_last_entry_ = entry.lru_prev;
+  }
+}
+
+void PrimitiveProcessor::RemoveCacheEntry(
+    size_t entry_index,
+    const std::unique_lock<std::recursive_mutex>& global_lock) {
+  CacheEntry& entry = cache_entry_pool_[entry_index];
+  CacheKey entry_key = entry.key;
+  // Remove the entry from the cache map.
+  auto entry_map_it = cache_map_.find(entry_key);
+  assert_true(entry_map_it != cache_map_.end());
+  if (entry_map_it != cache_map_.end()) {
+    cache_map_.erase(entry_map_it);
+  }
+  // Unlink the entry from the bucket's list.
+  uint32_t entry_bucket_index_first =
+      entry_key.base >> kCacheBucketSizeBytesLog2;
+  uint32_t entry_end = entry_key.base + entry_key.GetSizeBytes();
+  uint32_t entry_link_index_last =
+      ((entry_end - 1) >> kCacheBucketSizeBytesLog2) -
+      entry_bucket_index_first;
+  assert_true(entry_link_index_last <= 1,
+              "Cache entries only store list links within two buckets");
+  for (uint32_t entry_link_index = 0;
+       entry_link_index <= entry_link_index_last; ++entry_link_index) {
+    uint32_t entry_bucket_index = entry_bucket_index_first + entry_link_index;
+    size_t entry_link_prev = entry.buckets_prev[entry_link_index];
+    size_t entry_link_next = entry.buckets_next[entry_link_index];
+    if (entry_link_prev != SIZE_MAX) {
+      CacheEntry& entry_prev = cache_entry_pool_[entry_link_prev];
+      entry_prev.buckets_next[size_t(
+          (entry_prev.key.base >> kCacheBucketSizeBytesLog2) !=
+          entry_bucket_index)] = entry_link_next;
+    } else {
+      if (entry_link_next != SIZE_MAX) {
+        cache_bucket_first_entries_[entry_bucket_index] = entry_link_next;
+      } else {
+        // The only entry that was remaining in the bucket - it's empty now.
+        cache_buckets_non_empty_l1_[entry_bucket_index >> 6] &=
+            ~(uint64_t(1) << (entry_bucket_index & 63));
+        UpdateCacheBucketsNonEmptyL2(entry_bucket_index >> 6, global_lock);
+      }
+    }
+    if (entry_link_next != SIZE_MAX) {
+      CacheEntry& entry_next = cache_entry_pool_[entry_link_next];
+      entry_next.buckets_prev[size_t(
+          (entry_next.key.base >> kCacheBucketSizeBytesLog2) !=
+          entry_bucket_index)] = entry_link_prev;
+    }
+  }
+  UnlinkCacheEntryFromLru(entry_index, global_lock);
+  cache_size_bytes_ -= GetCacheEntrySizeBytes(entry);
+  // Make the entry free for reuse. The host indices are released by the
+  // processor in EndCacheFrame.
+  entry.free_next = cache_bucket_free_first_entry_;
+  cache_bucket_free_first_entry_ = entry_index;
+}
+
 std::pair<uint32_t, uint32_t> PrimitiveProcessor::MemoryInvalidationCallback(
     uint32_t physical_address_start, uint32_t length, bool exact_range) {
   if (length == 0 || physical_address_start >= SharedMemory::kBufferSize) {
@@ -1541,6 +1746,15 @@ std::pair<uint32_t, uint32_t> PrimitiveProcessor::MemoryInvalidationCallback(
   uint32_t bucket_l2_bits_index_first = bucket_index_first >> 12;
   uint32_t bucket_l2_bits_index_last = bucket_index_last >> 12;
   auto global_lock = global_critical_region_.Acquire();
+  if (cache_currently_processing_size_bytes_ &&
+      cache_currently_processing_base_ < physical_address_end &&
+      cache_currently_processing_base_ +
+              cache_currently_processing_size_bytes_ >
+          physical_address_start) {
+    // Don't store the result of the processing of the modified indices.
+    any_invalidated = true;
+    cache_currently_processing_size_bytes_ = 0;
+  }
   for (uint32_t bucket_l2_bits_index = bucket_l2_bits_index_first;
        bucket_l2_bits_index <= bucket_l2_bits_index_last;
        ++bucket_l2_bits_index) {
@@ -1608,60 +1822,11 @@ std::pair<uint32_t, uint32_t> PrimitiveProcessor::MemoryInvalidationCallback(
               entry.buckets_next[bucket_index - entry_bucket_index_first];
           // For exact_range, don't invalidate bucket entries that are outside
           // the specified range.
-          if (entry_key.base < physical_address_end) {
-            uint32_t entry_end = entry_key.base + entry_key.GetSizeBytes();
-            if (entry_end > physical_address_end) {
-              // Invalidate the entry.
-              any_invalidated = true;
-              // Remove the entry from the cache map.
-              auto entry_map_it = cache_map_.find(entry_key);
-              assert_true(entry_map_it != cache_map_.end());
-              if (entry_map_it != cache_map_.end()) {
-                cache_map_.erase(entry_map_it);
-              }
-              // Unlink the entry from the bucket's list.
-              uint32_t entry_link_index_last =
-                  ((entry_end - 1) >> kCacheBucketSizeBytesLog2) -
-                  entry_bucket_index_first;
-              assert_true(
-                  entry_link_index_last <= 1,
-                  "Cache entries only store list links within two buckets");
-              for (uint32_t entry_link_index = 0;
-                   entry_link_index <= entry_link_index_last;
-                   ++entry_link_index) {
-                uint32_t entry_bucket_index =
-                    entry_bucket_index_first + entry_link_index;
-                size_t entry_link_prev = entry.buckets_prev[entry_link_index];
-                size_t entry_link_next = entry.buckets_next[entry_link_index];
-                if (entry_link_prev != SIZE_MAX) {
-                  CacheEntry& entry_prev = cache_entry_pool_[entry_link_prev];
-                  entry_prev.buckets_next[size_t(
-                      (entry_prev.key.base >> kCacheBucketSizeBytesLog2) !=
-                      entry_bucket_index)] = entry_link_next;
-                } else {
-                  if (entry_link_next != SIZE_MAX) {
-                    cache_bucket_first_entries_[entry_bucket_index] =
-                        entry_link_next;
-                  } else {
-                    // The only entry that was remaining in the bucket - it's
-                    // empty now.
-                    cache_buckets_non_empty_l1_[entry_bucket_index >> 6] &=
-                        ~(uint64_t(1) << (entry_bucket_index & 63));
-                    UpdateCacheBucketsNonEmptyL2(entry_bucket_index >> 6,
-                                                 global_lock);
-                  }
-                }
-                if (entry_link_next != SIZE_MAX) {
-                  CacheEntry& entry_next = cache_entry_pool_[entry_link_next];
-                  entry_next.buckets_prev[size_t(
-                      (entry_next.key.base >> kCacheBucketSizeBytesLog2) !=
-                      entry_bucket_index)] = entry_link_prev;
-                }
-              }
-              // Make the entry free for reuse.
-              entry.free_next = cache_bucket_free_first_entry_;
-              cache_bucket_free_first_entry_ = entry_index;
-            }
+          if (entry_key.base < physical_address_end &&
+              entry_key.base + entry_key.GetSizeBytes() >
+                  physical_address_start) {
+            any_invalidated = true;
+            RemoveCacheEntry(entry_index, global_lock);
           }
           entry_index = next_entry_index;
         } while (entry_index != SIZE_MAX);
@@ -1682,5 +1847,16 @@ PrimitiveProcessor::MemoryInvalidationCallbackThunk(
       ->MemoryInvalidationCallback(physical_address_start, length, exact_range);
 }
 
+void PrimitiveProcessor::SharedMemoryGlobalWatchCallbackThunk(
+    const std::unique_lock<std::recursive_mutex>& global_lock, void* context,
+    uint32_t address_first, uint32_t address_last, bool invalidated_by_gpu) {
+  // CPU writes are handled by the memory invalidation callback.
+  if (!invalidated_by_gpu) {
+    return;
+  }
+  reinterpret_cast<PrimitiveProcessor*>(context)->MemoryInvalidationCallback(
+      address_first, address_last - address_first + 1, true);
+}
+
 }  // namespace gpu
 }  // namespace xe
@@ -20,6 +20,7 @@
 #include <mutex>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "xenia/base/assert.h"
 #include "xenia/base/cvar.h"
@@ -270,10 +271,14 @@ class PrimitiveProcessor {
   // destructor.
   void ShutdownCommon();
 
-  // Call at boundaries of lifespans of converted data (between frames,
-  // preferably in the end of a frame so between the swap and the next draw,
-  // access violation handlers need to do less work).
-  void ClearPerFrameCache();
+  // Call at boundaries of lifespans of the buffers returned by
+  // RequestHostConvertedIndexBufferForCurrentFrame (between frames, preferably
+  // in the end of a frame so between the swap and the next draw, access
+  // violation handlers need to do less work). Cached converted indices are kept
+  // across frames until they're invalidated by a guest memory write, reuploaded
+  // to a buffer of the new frame when used again, and evicted in the least
+  // recently used order if the cache exceeds its size limit.
+  void EndCacheFrame();
 
   static constexpr size_t GetBuiltinIndexBufferOffsetBytes(size_t handle) {
     // For simplicity, just using the handles as byte offsets.
@@ -709,7 +714,7 @@ class PrimitiveProcessor {
 
   std::deque<SinglePrimitiveRange> single_primitive_ranges_;
 
-  // Caching for reuse of converted indices within a frame.
+  // Caching for reuse of converted indices within a frame and across frames.
 
   // 256 KB as the largest possible guest index buffer - 0xFFFF 32-bit indices -
   // is slightly smaller than 256 KB, thus cache entries need store links within
@@ -790,8 +795,19 @@ class PrimitiveProcessor {
       size_t buckets_prev[2];
     };
     size_t buckets_next[2];
+    // Links in the order from the least to the most recently used entry.
+    size_t lru_prev;
+    size_t lru_next;
     CacheKey key;
     CachedResult result;
+    // cache_frame_ when result.host_index_buffer_handle was obtained. For
+    // kHostConverted, the handle is valid only within that frame, and in later
+    // frames, host_indices are uploaded to a buffer of the current frame.
+    uint64_t host_index_buffer_frame;
+    // Copy of the host-converted indices for kHostConverted. Written by the
+    // processor only, not released by the invalidation callback as the
+    // processor may be reading it outside the global critical region.
+    std::vector<uint8_t> host_indices;
     static uint32_t GetBucketCount(CacheKey key) {
       uint32_t count =
           ((key.base + (key.GetSizeBytes() - 1)) >> kCacheBucketSizeBytesLog2) -
@@ -831,12 +847,10 @@ class PrimitiveProcessor {
     const CachedResult* GetFoundResult() const {
       return result_type_ == ResultType::kExisting ? &result_ : nullptr;
     }
-    void SetNewResult(const CachedResult& new_result) {
-      // Replacement of an existing entry is not allowed.
-      assert_true(result_type_ != ResultType::kExisting);
-      result_ = new_result;
-      result_type_ = ResultType::kNewSet;
-    }
+    // For kHostConverted, host_indices must point to the indices written to
+    // the buffer of the current frame, to keep them for reuse in later frames.
+    void SetNewResult(const CachedResult& new_result,
+                      const void* host_indices = nullptr);
     ~CacheTransaction();
 
    private:
@@ -847,6 +861,8 @@ class PrimitiveProcessor {
     // vertex count below the cache usage threshold.
     CacheKey key_;
     CachedResult result_;
+    // Moved into the new entry.
+    std::vector<uint8_t> host_indices_;
     enum class ResultType {
       kNewUnset,
       kNewSet,
@@ -874,6 +890,17 @@ class PrimitiveProcessor {
   // Modified by both the processor and the invalidation callback.
   size_t cache_bucket_free_first_entry_ = SIZE_MAX;
   // Modified by both the processor and the invalidation callback.
+  size_t cache_lru_first_entry_ = SIZE_MAX;
+  size_t cache_lru_last_entry_ = SIZE_MAX;
+  // Total size of the entries in the cache map, including their host-converted
+  // indices.
+  // Modified by both the processor and the invalidation callback.
+  uint64_t cache_size_bytes_ = 0;
+  // Incremented in EndCacheFrame.
+  // Modified by the processor, read by the invalidation callback.
+  uint64_t cache_frame_ = 0;
+  SharedMemory::GlobalWatchHandle cache_shared_memory_watch_handle_ = nullptr;
+  // Modified by both the processor and the invalidation callback.
   uint64_t cache_buckets_non_empty_l1_[(kCacheBucketCount + 63) / 64] = {};
   // For even faster handling of memory invalidation - whether any bit is set in
   // each cache_buckets_non_empty_l1_.
@@ -895,6 +922,25 @@ class PrimitiveProcessor {
       cache_buckets_non_empty_l2_ref &= ~cache_buckets_non_empty_l2_bit;
     }
   }
+  // Must be called in a global critical region.
+  static uint64_t GetCacheEntrySizeBytes(const CacheEntry& entry) {
+    return sizeof(CacheEntry) + entry.host_indices.size();
+  }
+  // Must be called in a global critical region.
+  void LinkCacheEntryToLru(
+      size_t entry_index,
+      [[maybe_unused]] const std::unique_lock<std::recursive_mutex>&
+          global_lock);
+  // Must be called in a global critical region.
+  void UnlinkCacheEntryFromLru(
+      size_t entry_index,
+      [[maybe_unused]] const std::unique_lock<std::recursive_mutex>&
+          global_lock);
+  // Removes the entry from the map, the buckets and the LRU list, and frees
+  // it for reuse. Must be called in a global critical region.
+  void RemoveCacheEntry(
+      size_t entry_index,
+      const std::unique_lock<std::recursive_mutex>& global_lock);
   // cache_buckets_non_empty_l1_ (along with cache_buckets_non_empty_l2_, which
   // must be kept in sync) used for indication whether each entry is non-empty,
   // for faster clearing (there's no special index here for an empty entry).
@@ -904,6 +950,11 @@ class PrimitiveProcessor {
   static std::pair<uint32_t, uint32_t> MemoryInvalidationCallbackThunk(
       void* context_ptr, uint32_t physical_address_start, uint32_t length,
       bool exact_range);
+  // Invalidates the cache for GPU writes to the shared memory (resolves and
+  // memexport) not caught by the memory invalidation callback.
+  static void SharedMemoryGlobalWatchCallbackThunk(
+      const std::unique_lock<std::recursive_mutex>& global_lock, void* context,
+      uint32_t address_first, uint32_t address_last, bool invalidated_by_gpu);
 };
 
 }  // namespace gpu
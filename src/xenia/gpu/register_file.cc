@@ -16,6 +16,16 @@
 namespace xe {
 namespace gpu {
 
+const std::array<uint64_t, (RegisterFile::kRegisterCount + 63) / 64>
+    RegisterFile::valid_registers_ = []() {
+      std::array<uint64_t, (kRegisterCount + 63) / 64> valid_registers = {};
+#define XE_GPU_REGISTER(index, type, name) \
+  valid_registers[(index) >> 6] |= uint64_t(1) << ((index)&63);
+#include "xenia/gpu/register_table.inc"
+#undef XE_GPU_REGISTER
+      return valid_registers;
+    }();
+
 RegisterFile::RegisterFile() { std::memset(values, 0, sizeof(values)); }
 
 const RegisterInfo* RegisterFile::GetRegisterInfo(uint32_t index) {
@@ -10,6 +10,7 @@
 #ifndef XENIA_GPU_REGISTER_FILE_H_
 #define XENIA_GPU_REGISTER_FILE_H_
 
+#include <array>
 #include <cstdint>
 #include <cstdlib>
 
@@ -34,6 +35,14 @@ class RegisterFile {
   static const RegisterInfo* GetRegisterInfo(uint32_t index);
 
   static constexpr size_t kRegisterCount = 0x5003;
+
+  // Whether the register is in register_table.inc - cheaper than
+  // GetRegisterInfo for checking every register write.
+  static bool IsValidRegister(uint32_t index) {
+    return index < kRegisterCount &&
+           (valid_registers_[index >> 6] & (uint64_t(1) << (index & 63)));
+  }
+
   union RegisterValue {
     uint32_t u32;
     float f32;
@@ -68,6 +77,10 @@ class RegisterFile {
   T& Get() {
     return *reinterpret_cast<T*>(&values[T::register_index]);
   }
+
+ private:
+  static const std::array<uint64_t, (kRegisterCount + 63) / 64>
+      valid_registers_;
 };
 
 }  // namespace gpu
@@ -882,13 +882,18 @@ bool RenderTargetCache::Update(bool is_rasterization_done,
   // draw with whatever contents currently are in the render target in this
   // case).
 
+  // Color render targets are only used if they're written to, but depth /
+  // stencil may be only tested.
+  bool depth_modified = normalized_depth_control.z_write_enable ||
+                        normalized_depth_control.stencil_enable;
   for (uint32_t i = 0; i < edram_bases_sorted_count; ++i) {
     const std::pair<uint32_t, uint32_t>& rt_base_index = edram_bases_sorted[i];
     uint32_t rt_bit_index = rt_base_index.second;
     ChangeOwnership(rt_keys[rt_bit_index], 0, rt_lengths_tiles[i],
                     interlock_barrier_only
                         ? nullptr
-                        : &last_update_transfers_[rt_bit_index]);
+                        : &last_update_transfers_[rt_bit_index],
+                    nullptr, rt_bit_index || depth_modified);
   }
 
   if (interlock_barrier_only) {
@@ -1537,7 +1542,7 @@ bool RenderTargetCache::WouldOwnershipChangeRequireTransfers(
 void RenderTargetCache::ChangeOwnership(
     RenderTargetKey dest, uint32_t start_tiles_base_relative,
     uint32_t length_tiles, std::vector<Transfer>* transfers_append_out,
-    const Transfer::Rectangle* resolve_clear_cutout) {
+    const Transfer::Rectangle* resolve_clear_cutout, bool dest_modified) {
   // xenos::kEdramTileCount with length 0 is fine if both the start and the end
   // are clamped to xenos::kEdramTileCount.
   assert_true(start_tiles_base_relative <=
@@ -1546,11 +1551,22 @@ void RenderTargetCache::ChangeOwnership(
   if (length_tiles == 0) {
     return;
   }
+  // The ownership history is only needed for copying transfers.
+  if (!transfers_append_out) {
+    dest_modified = true;
+  }
+  size_t transfers_initial =
+      transfers_append_out ? transfers_append_out->size() : 0;
   uint32_t dest_pitch_tiles = dest.GetPitchTiles();
   bool dest_is_64bpp = dest.Is64bpp();
   bool host_depth_encoding_different =
       dest.is_depth && GetPath() == Path::kHostRenderTargets &&
       IsHostDepthEncodingDifferent(dest.GetDepthFormat());
+  auto is_range_change_needed = [&](const OwnershipRange& range) -> bool {
+    // Also need to drop the history if the current owner is being modified.
+    return !range.IsOwnedBy(dest, host_depth_encoding_different) ||
+           (dest_modified && !range.unmodified_previous_owner.IsEmpty());
+  };
   auto change_ownership_in_extent = [&](uint32_t extent_start,
                                         uint32_t extent_end) {
     // The map contains consecutive ranges, merged if the adjacent ones are the
@@ -1562,7 +1578,7 @@ void RenderTargetCache::ChangeOwnership(
     if (it != ownership_ranges_.begin()) {
       auto it_pre = std::prev(it);
       if (it_pre->second.end_tiles > extent_start &&
-          !it_pre->second.IsOwnedBy(dest, host_depth_encoding_different)) {
+          is_range_change_needed(it_pre->second)) {
         // Different render target overlapping the range - split the head.
         ownership_ranges_.emplace(extent_start, it_pre->second);
         it_pre->second.end_tiles = extent_start;
@@ -1576,7 +1592,7 @@ void RenderTargetCache::ChangeOwnership(
         // Outside the touched extent already.
         break;
       }
-      if (it->second.IsOwnedBy(dest, host_depth_encoding_different)) {
+      if (!is_range_change_needed(it->second)) {
         // Already owned by the needed render target - no need to transfer
         // anything.
         ++it;
@@ -1589,8 +1605,21 @@ void RenderTargetCache::ChangeOwnership(
         ownership_ranges_.emplace(extent_end, it->second);
         it->second.end_tiles = extent_end;
       }
-      if (transfers_append_out) {
-        RenderTargetKey transfer_source = it->second.render_target;
+      RenderTargetKey previous_owner = it->second.render_target;
+      // Whether dest will contain the same data as previous_owner after the
+      // ownership change.
+      bool dest_has_previous_owner_data = false;
+      // If already owned, only dropping the history as dest is being modified.
+      bool is_owner_changing =
+          !it->second.IsOwnedBy(dest, host_depth_encoding_different);
+      if (is_owner_changing && !previous_owner.IsEmpty() &&
+          previous_owner != dest &&
+          it->second.unmodified_previous_owner == dest) {
+        // The current owner has only read the data it has taken from dest,
+        // which still has it, since then.
+        dest_has_previous_owner_data = true;
+      } else if (is_owner_changing && transfers_append_out) {
+        RenderTargetKey transfer_source = previous_owner;
         // Only perform the copying when actually changing the latest owner, not
         // just the latest host depth owner - the transfer source is expected to
         // be different than the destination.
@@ -1621,6 +1650,7 @@ void RenderTargetCache::ChangeOwnership(
               // Extend the last transfer if, for example, transferring color,
               // but host depth is different.
               transfers_append_out->back().end_tiles = transfer_end_tiles;
+              dest_has_previous_owner_data = true;
             } else {
               auto transfer_source_rt_it =
                   render_targets_.find(transfer_source);
@@ -1641,6 +1671,7 @@ void RenderTargetCache::ChangeOwnership(
                       transfer_host_depth_source_rt_it != render_targets_.end()
                           ? transfer_host_depth_source_rt_it->second
                           : nullptr);
+                  dest_has_previous_owner_data = true;
                 }
               }
             }
@@ -1652,6 +1683,9 @@ void RenderTargetCache::ChangeOwnership(
       if (host_depth_encoding_different) {
         it->second.GetHostDepthRenderTarget(dest.GetDepthFormat()) = dest;
       }
+      it->second.unmodified_previous_owner =
+          (!dest_modified && dest_has_previous_owner_data) ? previous_owner
+                                                           : RenderTargetKey();
       // Check if can merge with the next range after claiming.
       std::map<uint32_t, OwnershipRange>::iterator it_next;
       if (it != ownership_ranges_.end()) {
@@ -1691,6 +1725,9 @@ void RenderTargetCache::ChangeOwnership(
     change_ownership_in_extent(
         0, std::min(end_tiles & (xenos::kEdramTileCount - 1), start_tiles));
   }
+  if (transfers_append_out) {
+    edram_transfers_total_ += transfers_append_out->size() - transfers_initial;
+  }
 }
 
 }  // namespace gpu
@@ -224,6 +224,10 @@ class RenderTargetCache {
       bool distinguish_gamma_formats,
       uint32_t* depth_and_color_formats_out = nullptr) const;
 
+  // Total number of ownership transfers between render targets requested by
+  // ChangeOwnership, for statistics.
+  uint64_t edram_transfers_total() const { return edram_transfers_total_; }
+
  protected:
   RenderTargetCache(const RegisterFile& register_file, const Memory& memory,
                     TraceWriter* trace_writer, uint32_t draw_resolution_scale_x,
@@ -650,6 +654,12 @@ class RenderTargetCache {
     // empty too.
     RenderTargetKey host_depth_render_target_unorm24;
     RenderTargetKey host_depth_render_target_float24;
+    // The previous owner of the range if its data is still up to date because
+    // render_target has taken the data from it and has only been used without
+    // writing since then (such as for depth / stencil testing without depth
+    // and stencil writes) - switching back to it requires no transfer. Empty if
+    // the current owner may have modified the data.
+    RenderTargetKey unmodified_previous_owner;
     OwnershipRange(uint32_t end_tiles, RenderTargetKey render_target,
                    RenderTargetKey host_depth_render_target_unorm24,
                    RenderTargetKey host_depth_render_target_float24)
@@ -693,7 +703,8 @@ class RenderTargetCache {
              host_depth_render_target_unorm24 ==
                  other_range.host_depth_render_target_unorm24 &&
              host_depth_render_target_float24 ==
-                 other_range.host_depth_render_target_float24;
+                 other_range.host_depth_render_target_float24 &&
+             unmodified_previous_owner == other_range.unmodified_previous_owner;
     }
   };
 
@@ -719,11 +730,14 @@ class RenderTargetCache {
                                             uint32_t start_tiles_base_relative,
                                             uint32_t length_tiles) const;
   // Updates ownership_ranges_, adds the transfers needed for the ownership
-  // change to transfers_append_out if it's not null.
+  // change to transfers_append_out if it's not null. dest_modified is false if
+  // the render target is only going to be read in the range, so switching back
+  // to the previous owner later won't require a transfer.
   void ChangeOwnership(
       RenderTargetKey dest, uint32_t start_tiles_base_relative,
       uint32_t length_tiles, std::vector<Transfer>* transfers_append_out,
-      const Transfer::Rectangle* resolve_clear_cutout = nullptr);
+      const Transfer::Rectangle* resolve_clear_cutout = nullptr,
+      bool dest_modified = true);
 
   // If failed to create, may contain nullptr to prevent attempting to create a
   // render target twice.
@@ -737,6 +751,7 @@ class RenderTargetCache {
   // since standard containers use dynamic allocation for elements, though
   // changes to this throughout a frame are pretty rare.
   std::map<uint32_t, OwnershipRange> ownership_ranges_;
+  uint64_t edram_transfers_total_ = 0;
 
   // Render targets actually used by the draw call with the last successful
   // update. 0 is depth, color starting from 1, nullptr if not bound.
@@ -818,6 +818,12 @@ class Shader {
       host_disassembly_ = std::move(disassembly);
     }
 
+    // For replacing the translated binary with a post-processed (such as
+    // optimized) version before the host objects are created from it.
+    void set_translated_binary(std::vector<uint8_t> binary) {
+      translated_binary_ = std::move(binary);
+    }
+
     // For dumping after translation. Dumps the shader's translated code, and,
     // if available, translated disassembly, to files in the given directory
     // based on ucode hash. Returns {binary path, disassembly path if written}.
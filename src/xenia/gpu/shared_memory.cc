@@ -14,11 +14,21 @@
 
 #include "xenia/base/assert.h"
 #include "xenia/base/bit_range.h"
+#include "xenia/base/cvar.h"
 #include "xenia/base/math.h"
 #include "xenia/base/memory.h"
 #include "xenia/base/profiling.h"
 #include "xenia/memory.h"
 
+DEFINE_bool(
+    shared_memory_sparse_prediction, true,
+    "When the shared memory is allocated sparsely on the host GPU, make the "
+    "ranges the guest commits physical memory in resident ahead of time, "
+    "batching the allocations in the beginning of the next submission, rather "
+    "than when the GPU first accesses them in the middle of the submission. "
+    "Reduces hitches, but makes unused guest allocations resident too.",
+    "GPU");
+
 namespace xe {
 namespace gpu {
 
@@ -44,11 +54,21 @@ void SharedMemory::InitializeSparseHostGpuMemory(uint32_t granularity_log2) {
   host_gpu_memory_sparse_allocated_.resize(
       size_t(1) << (std::max(kBufferSizeLog2 - granularity_log2, uint32_t(6)) -
                     6));
+  if (cvars::shared_memory_sparse_prediction) {
+    memory_allocation_callback_handle_ =
+        memory_.RegisterPhysicalMemoryAllocationCallback(
+            MemoryAllocationCallbackThunk, this);
+  }
 }
 
 void SharedMemory::ShutdownCommon() {
   ReleaseTraceDownloadRanges();
 
+  gpu_written_pending_page_first_ = UINT32_MAX;
+  gpu_written_pending_page_last_ = 0;
+  gpu_written_pending_cpu_page_first_ = UINT32_MAX;
+  gpu_written_pending_cpu_page_last_ = 0;
+
   FireWatches(0, (kBufferSize - 1) >> page_size_log2_, false);
   assert_true(global_watches_.empty());
   // No watches now, so no references to the pools accessible by guest threads -
@@ -72,6 +92,17 @@ void SharedMemory::ShutdownCommon() {
     memory_invalidation_callback_handle_ = nullptr;
   }
 
+  if (memory_allocation_callback_handle_ != nullptr) {
+    memory_.UnregisterPhysicalMemoryAllocationCallback(
+        memory_allocation_callback_handle_);
+    memory_allocation_callback_handle_ = nullptr;
+  }
+  host_gpu_memory_sparse_predicted_ranges_.clear();
+  host_gpu_memory_sparse_predicted_ranges_.shrink_to_fit();
+  host_gpu_memory_sparse_predicted_ranges_processed_.clear();
+  host_gpu_memory_sparse_predicted_ranges_processed_.shrink_to_fit();
+  host_gpu_memory_sparse_predicted_bytes_ = 0;
+
   if (host_gpu_memory_sparse_used_bytes_) {
     host_gpu_memory_sparse_used_bytes_ = 0;
     COUNT_profile_set("gpu/shared_memory/host_gpu_memory_sparse_used_mb", 0);
@@ -87,6 +118,7 @@ void SharedMemory::ShutdownCommon() {
 }
 
 void SharedMemory::ClearCache() {
+  CommitRangesWrittenByGpu();
   // Keeping GPU-written data, so "invalidated by GPU".
   FireWatches(0, (kBufferSize - 1) >> page_size_log2_, true);
   // No watches now, so no references to the pools accessible by guest threads -
@@ -146,6 +178,7 @@ SharedMemory::WatchHandle SharedMemory::WatchMemoryRange(
     return nullptr;
   }
   length = std::min(length, kBufferSize - start);
+  CommitRangesWrittenByGpu();
   uint32_t watch_page_first = start >> page_size_log2_;
   uint32_t watch_page_last = (start + length - 1) >> page_size_log2_;
   uint32_t bucket_first =
@@ -256,13 +289,58 @@ void SharedMemory::RangeWrittenByGpu(uint32_t start, uint32_t length,
   uint32_t page_first = start >> page_size_log2_;
   uint32_t page_last = end >> page_size_log2_;
 
+  auto global_lock = global_critical_region_.Acquire();
+  if (gpu_written_pending_page_first_ <= gpu_written_pending_page_last_) {
+    // Merge with the pending range if adjacent to it, unless the CPU has
+    // already overwritten a part of it, as the CPU data must not be dropped
+    // after being overwritten by the GPU again.
+    if (is_resolve == gpu_written_pending_is_resolve_ &&
+        gpu_written_pending_cpu_page_first_ == UINT32_MAX &&
+        page_first <= gpu_written_pending_page_last_ + 1 &&
+        page_last + 1 >= gpu_written_pending_page_first_) {
+      gpu_written_pending_page_first_ =
+          std::min(gpu_written_pending_page_first_, page_first);
+      gpu_written_pending_page_last_ =
+          std::max(gpu_written_pending_page_last_, page_last);
+      return;
+    }
+    CommitRangesWrittenByGpu();
+  }
+  gpu_written_pending_page_first_ = page_first;
+  gpu_written_pending_page_last_ = page_last;
+  gpu_written_pending_is_resolve_ = is_resolve;
+}
+
+void SharedMemory::CommitRangesWrittenByGpu() {
+  auto global_lock = global_critical_region_.Acquire();
+  uint32_t page_first = gpu_written_pending_page_first_;
+  uint32_t page_last = gpu_written_pending_page_last_;
+  if (page_first > page_last) {
+    return;
+  }
+  uint32_t cpu_page_first = gpu_written_pending_cpu_page_first_;
+  uint32_t cpu_page_last = gpu_written_pending_cpu_page_last_;
+  gpu_written_pending_page_first_ = UINT32_MAX;
+  gpu_written_pending_page_last_ = 0;
+  gpu_written_pending_cpu_page_first_ = UINT32_MAX;
+  gpu_written_pending_cpu_page_last_ = 0;
+
   // Trigger modification callbacks so, for instance, resolved data is loaded to
   // the texture.
   FireWatches(page_first, page_last, true);
 
   // Mark the range as valid (so pages are not reuploaded until modified by the
-  // CPU) and watch it so the CPU can reuse it and this will be caught.
-  MakeRangeValid(start, length, true, is_resolve);
+  // CPU) and watch it so the CPU can reuse it and this will be caught. Still in
+  // the global critical region so CPU writes done meanwhile are not missed.
+  MakeRangeValid(page_first << page_size_log2_,
+                 (page_last - page_first + 1) << page_size_log2_, true,
+                 gpu_written_pending_is_resolve_);
+
+  if (cpu_page_first <= cpu_page_last) {
+    MemoryInvalidationCallback(
+        cpu_page_first << page_size_log2_,
+        (cpu_page_last - cpu_page_first + 1) << page_size_log2_, true);
+  }
 }
 
 bool SharedMemory::AllocateSparseHostGpuMemoryRange(
@@ -363,6 +441,10 @@ bool SharedMemory::RequestRange(uint32_t start, uint32_t length,
     return false;
   }
 
+  // Make the range valid if it has been written by the GPU, so the GPU data is
+  // not overwritten by the upload.
+  CommitRangesWrittenByGpu();
+
   uint32_t page_first = start >> page_size_log2_;
   uint32_t page_last = (start + length - 1) >> page_size_log2_;
 
@@ -432,6 +514,9 @@ bool SharedMemory::RequestRange(uint32_t start, uint32_t length,
     return true;
   }
 
+  for (const std::pair<uint32_t, uint32_t>& upload_range : upload_ranges_) {
+    upload_bytes_total_ += uint64_t(upload_range.second) << page_size_log2_;
+  }
   return UploadRanges(upload_ranges_);
 }
 
@@ -457,6 +542,18 @@ std::pair<uint32_t, uint32_t> SharedMemory::MemoryInvalidationCallback(
 
   auto global_lock = global_critical_region_.Acquire();
 
+  // Only the pages actually written by the CPU, not the wider range, contain
+  // data newer than the uncommitted GPU writes.
+  if (page_first <= gpu_written_pending_page_last_ &&
+      page_last >= gpu_written_pending_page_first_) {
+    gpu_written_pending_cpu_page_first_ =
+        std::min(gpu_written_pending_cpu_page_first_,
+                 std::max(page_first, gpu_written_pending_page_first_));
+    gpu_written_pending_cpu_page_last_ =
+        std::max(gpu_written_pending_cpu_page_last_,
+                 std::min(page_last, gpu_written_pending_page_last_));
+  }
+
   if (!exact_range) {
     // Check if a somewhat wider range (up to 256 KB with 4 KB pages) can be
     // invalidated - if no GPU-written data nearby that was not intended to be
@@ -503,6 +600,7 @@ std::pair<uint32_t, uint32_t> SharedMemory::MemoryInvalidationCallback(
 }
 
 void SharedMemory::PrepareForTraceDownload() {
+  CommitRangesWrittenByGpu();
   ReleaseTraceDownloadRanges();
   assert_true(trace_download_ranges_.empty());
   assert_zero(trace_download_page_count_);
@@ -603,6 +701,46 @@ void SharedMemory::ReleaseTraceDownloadRanges() {
   trace_download_page_count_ = 0;
 }
 
+void SharedMemory::AllocatePredictedHostGpuMemory() {
+  if (memory_allocation_callback_handle_ == nullptr) {
+    return;
+  }
+  {
+    auto global_lock = global_critical_region_.Acquire();
+    if (host_gpu_memory_sparse_predicted_ranges_.empty()) {
+      return;
+    }
+    host_gpu_memory_sparse_predicted_ranges_.swap(
+        host_gpu_memory_sparse_predicted_ranges_processed_);
+  }
+  uint32_t used_bytes_before = host_gpu_memory_sparse_used_bytes_;
+  for (const std::pair<uint32_t, uint32_t>& range :
+       host_gpu_memory_sparse_predicted_ranges_processed_) {
+    // If out of memory, leave the rest to be allocated on use, when its
+    // failure will be handled.
+    if (!EnsureHostGpuMemoryAllocated(range.first, range.second)) {
+      break;
+    }
+  }
+  host_gpu_memory_sparse_predicted_ranges_processed_.clear();
+  host_gpu_memory_sparse_predicted_bytes_ +=
+      host_gpu_memory_sparse_used_bytes_ - used_bytes_before;
+}
+
+void SharedMemory::MemoryAllocationCallbackThunk(
+    void* context_ptr, uint32_t physical_address_start, uint32_t length) {
+  // Called with the global critical region locked.
+  std::vector<std::pair<uint32_t, uint32_t>>& ranges =
+      reinterpret_cast<SharedMemory*>(context_ptr)
+          ->host_gpu_memory_sparse_predicted_ranges_;
+  if (!ranges.empty() &&
+      ranges.back().first + ranges.back().second == physical_address_start) {
+    ranges.back().second += length;
+    return;
+  }
+  ranges.emplace_back(physical_address_start, length);
+}
+
 bool SharedMemory::EnsureHostGpuMemoryAllocated(uint32_t start,
                                                 uint32_t length) {
   if (host_gpu_memory_sparse_granularity_log2_ == UINT32_MAX) {
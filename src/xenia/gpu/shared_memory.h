@@ -93,7 +93,44 @@ class SharedMemory {
   // be called, to make sure, if the GPU writes don't overwrite *everything* in
   // the pages they touch, the CPU data is properly loaded to the unmodified
   // regions in those pages.
+  //
+  // Ranges written back to back (such as by resolves of multiple render targets
+  // to adjacent memory) are merged into one, and the callbacks are triggered
+  // only when the merged range is committed by CommitRangesWrittenByGpu, so the
+  // memory protection is changed once for all of them.
   void RangeWrittenByGpu(uint32_t start, uint32_t length, bool is_resolve);
+  // Triggers the modification callbacks for the ranges passed to
+  // RangeWrittenByGpu that haven't been committed yet, and makes them valid and
+  // protected. Done implicitly by RequestRange and WatchMemoryRange - must be
+  // called explicitly by the consumers that check their watches without
+  // requesting the range first (such as textures that are already loaded), and
+  // at the end of every submission so CPU writes to the range are caught.
+  void CommitRangesWrittenByGpu();
+
+  // With --shared_memory_sparse_prediction, allocates the sparse host GPU
+  // memory for the ranges the guest has committed physical memory in since the
+  // previous call, all at once, rather than when the ranges are first used.
+  // Call in the beginning of a submission.
+  void AllocatePredictedHostGpuMemory();
+
+  // Total number of bytes requested to be uploaded from the guest memory, for
+  // statistics.
+  uint64_t upload_bytes_total() const { return upload_bytes_total_; }
+  // Sparse host GPU memory statistics - the number of allocations made, the
+  // bytes allocated, and the bytes of them allocated ahead of time from the
+  // guest physical memory allocations.
+  uint64_t host_gpu_memory_sparse_allocations_total() const {
+    return host_gpu_memory_sparse_allocations_;
+  }
+  uint64_t host_gpu_memory_sparse_allocated_bytes_total() const {
+    return host_gpu_memory_sparse_used_bytes_;
+  }
+  uint64_t host_gpu_memory_sparse_predicted_bytes_total() const {
+    return host_gpu_memory_sparse_predicted_bytes_;
+  }
+
+  // The guest memory mirrored by the shared memory.
+  Memory& memory() const { return memory_; }
 
  protected:
   SharedMemory(Memory& memory);
@@ -110,8 +147,6 @@ class SharedMemory {
   static constexpr uint32_t kHostGpuMemoryOptimalSparseAllocationLog2 = 22;
   static_assert(kHostGpuMemoryOptimalSparseAllocationLog2 <= kBufferSizeLog2);
 
-  Memory& memory() const { return memory_; }
-
   uint32_t page_size_log2() const { return page_size_log2_; }
 
   uint32_t host_gpu_memory_sparse_granularity_log2() const {
@@ -170,6 +205,18 @@ class SharedMemory {
   std::vector<uint64_t> host_gpu_memory_sparse_allocated_;
   uint32_t host_gpu_memory_sparse_allocations_ = 0;
   uint32_t host_gpu_memory_sparse_used_bytes_ = 0;
+  uint32_t host_gpu_memory_sparse_predicted_bytes_ = 0;
+  void* memory_allocation_callback_handle_ = nullptr;
+  // Physical ranges committed by the guest, awaiting
+  // AllocatePredictedHostGpuMemory, protected by global_critical_region_. The
+  // ranges being processed are swapped out to the second vector.
+  std::vector<std::pair<uint32_t, uint32_t>>
+      host_gpu_memory_sparse_predicted_ranges_;
+  std::vector<std::pair<uint32_t, uint32_t>>
+      host_gpu_memory_sparse_predicted_ranges_processed_;
+  static void MemoryAllocationCallbackThunk(void* context_ptr,
+                                            uint32_t physical_address_start,
+                                            uint32_t length);
 
   void* memory_invalidation_callback_handle_ = nullptr;
   void* memory_data_provider_handle_ = nullptr;
@@ -177,6 +224,7 @@ class SharedMemory {
   // Ranges that need to be uploaded, generated by GetRangesToUpload (a
   // persistently allocated vector).
   std::vector<std::pair<uint32_t, uint32_t>> upload_ranges_;
+  uint64_t upload_bytes_total_ = 0;
 
   // GPU-written memory downloading for traces. <Start address, length>.
   std::vector<std::pair<uint32_t, uint32_t>> trace_download_ranges_;
@@ -205,6 +253,16 @@ class SharedMemory {
   // used to quickly extract ranges.
   std::vector<SystemPageFlagsBlock> system_page_flags_;
 
+  // Merged pages passed to RangeWrittenByGpu, awaiting
+  // CommitRangesWrittenByGpu, empty if the first page is after the last.
+  uint32_t gpu_written_pending_page_first_ = UINT32_MAX;
+  uint32_t gpu_written_pending_page_last_ = 0;
+  bool gpu_written_pending_is_resolve_ = false;
+  // Pending pages written by the CPU before the commit - the CPU data is newer
+  // than the GPU data in them, so they're invalidated again after committing.
+  uint32_t gpu_written_pending_cpu_page_first_ = UINT32_MAX;
+  uint32_t gpu_written_pending_cpu_page_last_ = 0;
+
   static std::pair<uint32_t, uint32_t> MemoryInvalidationCallbackThunk(
       void* context_ptr, uint32_t physical_address_start, uint32_t length,
       bool exact_range);
@@ -2898,6 +2898,50 @@ spv::Id SpirvShaderTranslator::EndianSwap32Uint(spv::Id value, spv::Id endian) {
   return value;
 }
 
+spv::Id SpirvShaderTranslator::EndianSwap32Uint(spv::Id value,
+                                                xenos::Endian endian) {
+  bool swap_8in16 =
+      endian == xenos::Endian::k8in16 || endian == xenos::Endian::k8in32;
+  bool swap_16in32 =
+      endian == xenos::Endian::k8in32 || endian == xenos::Endian::k16in32;
+  spv::Id type = builder_->getTypeId(value);
+  int num_components = builder_->getNumTypeComponents(type);
+  auto make_typed_uint_constant = [&](unsigned int constant) -> spv::Id {
+    spv::Id constant_scalar = builder_->makeUintConstant(constant);
+    if (num_components <= 1) {
+      return constant_scalar;
+    }
+    id_vector_temp_.clear();
+    id_vector_temp_.insert(id_vector_temp_.cend(), num_components,
+                           constant_scalar);
+    return builder_->makeCompositeConstant(type, id_vector_temp_);
+  };
+  if (swap_8in16) {
+    spv::Id const_uint_8_typed = make_typed_uint_constant(8);
+    spv::Id const_uint_00ff00ff_typed = make_typed_uint_constant(0x00FF00FF);
+    value = builder_->createBinOp(
+        spv::OpBitwiseOr, type,
+        builder_->createBinOp(
+            spv::OpBitwiseAnd, type,
+            builder_->createBinOp(spv::OpShiftRightLogical, type, value,
+                                  const_uint_8_typed),
+            const_uint_00ff00ff_typed),
+        builder_->createBinOp(
+            spv::OpShiftLeftLogical, type,
+            builder_->createBinOp(spv::OpBitwiseAnd, type, value,
+                                  const_uint_00ff00ff_typed),
+            const_uint_8_typed));
+  }
+  if (swap_16in32) {
+    value = builder_->createQuadOp(
+        spv::OpBitFieldInsert, type,
+        builder_->createBinOp(spv::OpShiftRightLogical, type, value,
+                              make_typed_uint_constant(16)),
+        value, builder_->makeIntConstant(16), builder_->makeIntConstant(16));
+  }
+  return value;
+}
+
 spv::Id SpirvShaderTranslator::LoadUint32FromSharedMemory(
     spv::Id address_dwords_int) {
   spv::Block& head_block = *builder_->getBuildPoint();
@@ -34,7 +34,7 @@ class SpirvShaderTranslator : public ShaderTranslator {
     // TODO(Triang3l): Change to 0xYYYYMMDD once it's out of the rapid
     // prototyping stage (easier to do small granular updates with an
     // incremental counter).
-    static constexpr uint32_t kVersion = 6;
+    static constexpr uint32_t kVersion = 7;
 
     enum class DepthStencilMode : uint32_t {
       kNoModifiers,
@@ -60,6 +60,11 @@ class SpirvShaderTranslator : public ShaderTranslator {
       // Pipeline stage and input configuration.
       Shader::HostVertexShaderType host_vertex_shader_type
           : Shader::kHostVertexShaderTypeBitCount;
+      // Whether all the vertex fetch constants used by the shader have 8-in-32
+      // endianness (the most common one), so the words are swapped the same
+      // way by every vfetch, without reading the endianness from the fetch
+      // constant and branching on it.
+      uint32_t vertex_fetch_endian_8in32 : 1;
     } vertex;
     struct PixelShaderModification {
       // uint32_t 0.
@@ -581,6 +586,9 @@ class SpirvShaderTranslator : public ShaderTranslator {
 
   // Perform endian swap of a uint scalar or vector.
   spv::Id EndianSwap32Uint(spv::Id value, spv::Id endian);
+  // Perform endian swap of a uint scalar or vector with the endianness known at
+  // translation time, without branching.
+  spv::Id EndianSwap32Uint(spv::Id value, xenos::Endian endian);
 
   spv::Id LoadUint32FromSharedMemory(spv::Id address_dwords_int);
 
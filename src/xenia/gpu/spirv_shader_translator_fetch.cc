@@ -145,25 +145,30 @@ void SpirvShaderTranslator::ProcessVertexFetchInstruction(
   }
 
   // Endian swap the words, getting the endianness from bits 0:1 of the second
-  // fetch constant word.
-  uint32_t fetch_constant_word_1_index = fetch_constant_word_0_index + 1;
-  id_vector_temp_.clear();
-  // The only element of the fetch constant buffer.
-  id_vector_temp_.push_back(const_int_0_);
-  // Vector index.
-  id_vector_temp_.push_back(
-      builder_->makeIntConstant(int(fetch_constant_word_1_index >> 2)));
-  // Component index.
-  id_vector_temp_.push_back(
-      builder_->makeIntConstant(int(fetch_constant_word_1_index & 3)));
-  spv::Id fetch_constant_word_1 = builder_->createLoad(
-      builder_->createAccessChain(spv::StorageClassUniform,
-                                  uniform_fetch_constants_, id_vector_temp_),
-      spv::NoPrecision);
-  words = EndianSwap32Uint(
-      words, builder_->createBinOp(spv::OpBitwiseAnd, type_uint_,
-                                   fetch_constant_word_1,
-                                   builder_->makeUintConstant(0b11)));
+  // fetch constant word, unless it's known to be 8-in-32 for all the vertex
+  // fetch constants used by the shader.
+  if (GetSpirvShaderModification().vertex.vertex_fetch_endian_8in32) {
+    words = EndianSwap32Uint(words, xenos::Endian::k8in32);
+  } else {
+    uint32_t fetch_constant_word_1_index = fetch_constant_word_0_index + 1;
+    id_vector_temp_.clear();
+    // The only element of the fetch constant buffer.
+    id_vector_temp_.push_back(const_int_0_);
+    // Vector index.
+    id_vector_temp_.push_back(
+        builder_->makeIntConstant(int(fetch_constant_word_1_index >> 2)));
+    // Component index.
+    id_vector_temp_.push_back(
+        builder_->makeIntConstant(int(fetch_constant_word_1_index & 3)));
+    spv::Id fetch_constant_word_1 = builder_->createLoad(
+        builder_->createAccessChain(spv::StorageClassUniform,
+                                    uniform_fetch_constants_, id_vector_temp_),
+        spv::NoPrecision);
+    words = EndianSwap32Uint(
+        words, builder_->createBinOp(spv::OpBitwiseAnd, type_uint_,
+                                     fetch_constant_word_1,
+                                     builder_->makeUintConstant(0b11)));
+  }
 
   spv::Id result = spv::NoResult;
 
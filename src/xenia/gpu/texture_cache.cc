@@ -13,12 +13,15 @@
 #include <cstdint>
 #include <utility>
 
+#include "third_party/fmt/include/fmt/format.h"
 #include "xenia/base/assert.h"
 #include "xenia/base/clock.h"
 #include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
 #include "xenia/base/profiling.h"
+#include "xenia/base/xxhash.h"
 #include "xenia/gpu/gpu_flags.h"
 #include "xenia/gpu/register_file.h"
 #include "xenia/gpu/texture_info.h"
@@ -59,6 +62,14 @@ DEFINE_uint32(
     "Maximum host texture memory usage (in megabytes) above which textures "
     "will be destroyed as soon as possible.",
     "GPU");
+DEFINE_uint32(
+    texture_cache_memory_budget_percent, 75,
+    "If the host GPU API reports the video memory budget of the process "
+    "(VK_EXT_memory_budget on Vulkan, Windows 10 on Direct3D 12), percentage "
+    "of the budget remaining after everything other than textures that may be "
+    "used as texture_cache_memory_limit_hard instead of the fixed limit. Half "
+    "of it becomes the soft limit. 0 to always use the fixed limits.",
+    "GPU");
 DEFINE_uint32(
     texture_cache_memory_limit_render_to_texture, 24,
     "Part of the host texture memory budget (in megabytes) that will be scaled "
@@ -69,6 +80,35 @@ DEFINE_uint32(
     "textures - so with 2x2 resolution scaling, the soft limit will be 360 + "
     "96 MB, and with 3x3, it will be 360 + 216 MB.",
     "GPU");
+DEFINE_uint32(
+    texture_cache_defer_base_min_size, 0,
+    "Minimum width or height of textures with mipmaps whose base level is not "
+    "loaded when they're first used, but only in the following frames if they "
+    "are used again, limited by texture_cache_deferred_base_budget, with "
+    "sampling clamped to the mips until then. Reduces the amount of data "
+    "loaded for textures used only briefly, as well as stuttering when a lot "
+    "of large textures appear at once, at the cost of them being blurry for a "
+    "few frames. 0 to always load the whole texture immediately.",
+    "GPU");
+DEFINE_uint32(
+    texture_cache_deferred_base_budget, 32,
+    "Maximum guest data size (in megabytes) of the deferred texture base "
+    "levels to load in one frame (at least one is loaded every frame if any "
+    "are needed).",
+    "GPU");
+DEFINE_bool(
+    texture_cache_deduplicate_content, false,
+    "Copy the host data of a loaded texture with the same format, size and "
+    "guest data at a different address instead of loading and converting the "
+    "texture again, for games that copy identical textures to multiple "
+    "locations. Textures containing data written by resolves are not "
+    "deduplicated. The guest data is hashed on every load when enabled.",
+    "GPU");
+DEFINE_uint32(
+    store_textures_size_limit, 4096,
+    "Maximum size of the persistent texture storage of a game (in megabytes) "
+    "above which new textures will not be stored.",
+    "GPU");
 
 namespace xe {
 namespace gpu {
@@ -154,7 +194,9 @@ TextureCache::TextureCache(const RegisterFile& register_file,
     : register_file_(register_file),
       shared_memory_(shared_memory),
       draw_resolution_scale_x_(draw_resolution_scale_x),
-      draw_resolution_scale_y_(draw_resolution_scale_y) {
+      draw_resolution_scale_y_(draw_resolution_scale_y),
+      content_deduplication_enabled_(
+          cvars::texture_cache_deduplicate_content) {
   assert_true(draw_resolution_scale_x >= 1);
   assert_true(draw_resolution_scale_x <= kMaxDrawResolutionScaleAlongAxis);
   assert_true(draw_resolution_scale_y >= 1);
@@ -196,6 +238,28 @@ bool TextureCache::GetConfigDrawResolutionScale(uint32_t& x_out,
 
 void TextureCache::ClearCache() { DestroyAllTextures(); }
 
+void TextureCache::InitializeStorage(const std::filesystem::path& cache_root,
+                                     uint32_t title_id) {
+  texture_storage_.reset();
+  const char* api_name = GetStorageApiName();
+  if (!cvars::store_textures || !api_name) {
+    return;
+  }
+  std::filesystem::path storage_root = cache_root / "textures";
+  if (!std::filesystem::exists(storage_root)) {
+    if (!std::filesystem::create_directories(storage_root)) {
+      XELOGE(
+          "Failed to create the texture storage directory, persistent texture "
+          "storage will be disabled: {}",
+          xe::path_to_utf8(storage_root));
+      return;
+    }
+  }
+  texture_storage_ = TextureStorage::Open(
+      storage_root / fmt::format("{:08X}.{}.xtex", title_id, api_name),
+      api_name, uint64_t(cvars::store_textures_size_limit) << 20);
+}
+
 void TextureCache::CompletedSubmissionUpdated(
     uint64_t completed_submission_index) {
   // If memory usage is too high, destroy unused textures.
@@ -203,30 +267,63 @@ void TextureCache::CompletedSubmissionUpdated(
   // texture_cache_memory_limit_render_to_texture is assumed to be included in
   // texture_cache_memory_limit_soft and texture_cache_memory_limit_hard, at 1x,
   // so subtracting 1 from the scale.
-  uint32_t limit_scaled_resolve_add_mb =
-      cvars::texture_cache_memory_limit_render_to_texture *
-      (draw_resolution_scale_x() * draw_resolution_scale_y() - 1);
-  uint32_t limit_soft_mb =
-      cvars::texture_cache_memory_limit_soft + limit_scaled_resolve_add_mb;
-  uint32_t limit_hard_mb =
-      cvars::texture_cache_memory_limit_hard + limit_scaled_resolve_add_mb;
-  uint32_t limit_soft_lifetime =
-      cvars::texture_cache_memory_limit_soft_lifetime * 1000;
+  uint64_t limit_scaled_resolve_add =
+      uint64_t(cvars::texture_cache_memory_limit_render_to_texture *
+               (draw_resolution_scale_x() * draw_resolution_scale_y() - 1))
+      << 20;
+  uint64_t limit_soft =
+      (uint64_t(cvars::texture_cache_memory_limit_soft) << 20) +
+      limit_scaled_resolve_add;
+  uint64_t limit_hard =
+      (uint64_t(cvars::texture_cache_memory_limit_hard) << 20) +
+      limit_scaled_resolve_add;
+  if (host_memory_budget_available_ &&
+      cvars::texture_cache_memory_budget_percent) {
+    // Adapt to the memory actually available on the device, taking into
+    // account what's used by render targets, the shared memory and other
+    // resources of the process.
+    uint64_t other_usage =
+        host_memory_budget_usage_ -
+        std::min(host_memory_budget_usage_, textures_total_host_memory_usage_);
+    uint64_t available = host_memory_budget_ > other_usage
+                             ? host_memory_budget_ - other_usage
+                             : 0;
+    limit_hard = available / 100 *
+                 std::min(cvars::texture_cache_memory_budget_percent,
+                          UINT32_C(100));
+    limit_soft = limit_hard / 2;
+  }
+  // Don't let the soft limit make the cache thrash in scenes referencing more
+  // textures than it.
+  limit_soft = std::min(
+      std::max(limit_soft, working_set_estimate_ + working_set_estimate_ / 4),
+      limit_hard);
+  memory_limit_soft_ = limit_soft;
+  memory_limit_hard_ = limit_hard;
+  uint64_t limit_soft_lifetime =
+      uint64_t(cvars::texture_cache_memory_limit_soft_lifetime) * 1000;
   bool destroyed_any = false;
-  while (texture_used_first_ != nullptr) {
-    uint64_t total_host_memory_usage_mb =
-        (textures_total_host_memory_usage_ + ((UINT32_C(1) << 20) - 1)) >> 20;
-    bool limit_hard_exceeded = total_host_memory_usage_mb > limit_hard_mb;
-    if (total_host_memory_usage_mb <= limit_soft_mb && !limit_hard_exceeded) {
-      break;
-    }
-    Texture* texture = texture_used_first_;
-    if (texture->last_usage_submission_index() > completed_submission_index) {
+  while (true) {
+    bool limit_hard_exceeded = textures_total_host_memory_usage_ > limit_hard;
+    if (textures_total_host_memory_usage_ <= limit_soft &&
+        !limit_hard_exceeded) {
       break;
     }
-    if (!limit_hard_exceeded &&
-        (texture->last_usage_time() + limit_soft_lifetime) > current_time) {
-      break;
+    // Prefer the textures that have been referenced in only one frame, but not
+    // in the latest two frames, over the long-term working set, which is
+    // evicted only after the soft lifetime, unless the hard limit is exceeded.
+    Texture* texture = texture_used_first_[size_t(UsageQueue::kRecent)];
+    if (!texture ||
+        texture->last_usage_submission_index() > completed_submission_index ||
+        (!limit_hard_exceeded &&
+         texture->last_usage_frame() + 1 >= current_frame_)) {
+      texture = texture_used_first_[size_t(UsageQueue::kFrequent)];
+      if (!texture ||
+          texture->last_usage_submission_index() > completed_submission_index ||
+          (!limit_hard_exceeded &&
+           (texture->last_usage_time() + limit_soft_lifetime) > current_time)) {
+        break;
+      }
     }
     if (!destroyed_any) {
       destroyed_any = true;
@@ -237,6 +334,14 @@ void TextureCache::CompletedSubmissionUpdated(
       // any texture has been destroyed.
       ResetTextureBindings();
     }
+    if (texture->usage_queue_ == UsageQueue::kRecent &&
+        evicted_recent_keys_.insert(texture->key()).second) {
+      evicted_recent_key_queue_.push_back(texture->key());
+      if (evicted_recent_key_queue_.size() > kEvictedRecentKeysMax) {
+        evicted_recent_keys_.erase(evicted_recent_key_queue_.front());
+        evicted_recent_key_queue_.pop_front();
+      }
+    }
     // Remove the texture from the map and destroy it via its unique_ptr.
     auto found_texture_it = textures_.find(texture->key());
     assert_true(found_texture_it != textures_.end());
@@ -244,6 +349,8 @@ void TextureCache::CompletedSubmissionUpdated(
       assert_true(found_texture_it->second.get() == texture);
       textures_.erase(found_texture_it);
       // `texture` is invalid now.
+    } else {
+      break;
     }
   }
   if (destroyed_any) {
@@ -258,6 +365,14 @@ void TextureCache::BeginSubmission(uint64_t new_submission_index) {
 }
 
 void TextureCache::BeginFrame() {
+  working_set_estimate_ =
+      std::max(working_set_current_frame_,
+               working_set_estimate_ - working_set_estimate_ / 16);
+  working_set_current_frame_ = 0;
+  ++current_frame_;
+  host_memory_budget_available_ =
+      GetHostMemoryBudget(host_memory_budget_, host_memory_budget_usage_);
+
   // In case there was a failure to create something in the previous frame, make
   // sure bindings are reset so a new attempt will surely be made if the texture
   // is requested again.
@@ -291,7 +406,8 @@ void TextureCache::MarkRangeAsResolved(uint32_t start_unscaled,
     }
   }
 
-  // Invalidate textures. Toggling individual textures between scaled and
+  // Invalidate textures (when the range is committed, by the next draw or
+  // shared memory request). Toggling individual textures between scaled and
   // unscaled also relies on invalidation through shared memory.
   shared_memory().RangeWrittenByGpu(start_unscaled, length_unscaled, true);
 }
@@ -318,6 +434,14 @@ uint32_t TextureCache::GuestToHostSwizzle(uint32_t guest_swizzle,
 void TextureCache::RequestTextures(uint32_t used_texture_mask) {
   const auto& regs = register_file();
 
+  // Invalidate the textures overwritten by the resolves since the last draw.
+  shared_memory().CommitRangesWrittenByGpu();
+
+  if (base_deferred_textures_frame_ != current_frame_) {
+    base_deferred_textures_frame_ = current_frame_;
+    LoadDeferredTextureBases();
+  }
+
   if (texture_became_outdated_.exchange(false, std::memory_order_acquire)) {
     // A texture has become outdated - make sure whether textures are outdated
     // is rechecked in this draw and in subsequent ones to reload the new data
@@ -460,7 +584,9 @@ void TextureCache::Texture::LogAction(const char* action) const {
 // after creation, the texture will likely be used immediately, and it should
 // not be destroyed immediately after creation if dropping of old textures is
 // performed somehow. The list is maintained by the Texture, not the
-// TextureCache itself (unlike the `textures_` container).
+// TextureCache itself (unlike the `textures_` container). If the texture has
+// been evicted from the recent queue not long ago, it's needed repeatedly, so
+// it's placed in the frequent queue right away.
 TextureCache::Texture::Texture(TextureCache& texture_cache,
                                const TextureKey& key)
     : texture_cache_(texture_cache),
@@ -470,14 +596,10 @@ TextureCache::Texture::Texture(TextureCache& texture_cache,
       mips_resolved_(key.scaled_resolve),
       last_usage_submission_index_(texture_cache.current_submission_index_),
       last_usage_time_(texture_cache.current_submission_time_),
-      used_previous_(texture_cache.texture_used_last_),
-      used_next_(nullptr) {
-  if (texture_cache.texture_used_last_) {
-    texture_cache.texture_used_last_->used_next_ = this;
-  } else {
-    texture_cache.texture_used_first_ = this;
-  }
-  texture_cache.texture_used_last_ = this;
+      last_usage_frame_(texture_cache.current_frame_) {
+  LinkToUsageQueue(texture_cache.evicted_recent_keys_.erase(key)
+                       ? UsageQueue::kFrequent
+                       : UsageQueue::kRecent);
 
   // Never try to upload data that doesn't exist.
   base_outdated_ = guest_layout().base.level_data_extent_bytes != 0;
@@ -485,6 +607,23 @@ TextureCache::Texture::Texture(TextureCache& texture_cache,
 }
 
 TextureCache::Texture::~Texture() {
+  if (base_deferred_) {
+    auto deferred_it =
+        std::find(texture_cache_.base_deferred_textures_.begin(),
+                  texture_cache_.base_deferred_textures_.end(), this);
+    if (deferred_it != texture_cache_.base_deferred_textures_.end()) {
+      texture_cache_.base_deferred_textures_.erase(deferred_it);
+    }
+  }
+  if (content_indexed_) {
+    auto content_it =
+        texture_cache_.texture_content_index_.find(content_hash_);
+    if (content_it != texture_cache_.texture_content_index_.end() &&
+        content_it->second == this) {
+      texture_cache_.texture_content_index_.erase(content_it);
+    }
+  }
+
   if (mips_watch_handle_) {
     texture_cache().shared_memory().UnwatchMemoryRange(mips_watch_handle_);
   }
@@ -492,24 +631,20 @@ TextureCache::Texture::~Texture() {
     texture_cache().shared_memory().UnwatchMemoryRange(base_watch_handle_);
   }
 
-  if (used_previous_) {
-    used_previous_->used_next_ = used_next_;
-  } else {
-    texture_cache_.texture_used_first_ = used_next_;
-  }
-  if (used_next_) {
-    used_next_->used_previous_ = used_previous_;
-  } else {
-    texture_cache_.texture_used_last_ = used_previous_;
-  }
+  UnlinkFromUsageQueue();
 
+  if (last_usage_frame_ == texture_cache_.current_frame_) {
+    texture_cache_.working_set_current_frame_ -= host_memory_usage_;
+  }
   texture_cache_.UpdateTexturesTotalHostMemoryUsage(0, host_memory_usage_);
 }
 
 void TextureCache::Texture::MakeUpToDateAndWatch(
     const std::unique_lock<std::recursive_mutex>& global_lock) {
   SharedMemory& shared_memory = texture_cache().shared_memory();
-  if (base_outdated_) {
+  // The base will be loaded with the current data when it's not deferred
+  // anymore, no need to watch it until then.
+  if (base_outdated_ && !base_deferred_) {
     assert_not_zero(GetGuestBaseSize());
     base_outdated_ = false;
     base_watch_handle_ = shared_memory.WatchMemoryRange(
@@ -529,26 +664,52 @@ void TextureCache::Texture::MarkAsUsed() {
   assert_true(last_usage_submission_index_ <=
               texture_cache_.current_submission_index_);
   // This is called very frequently, don't relink unless needed for caching.
-  if (last_usage_submission_index_ >=
-      texture_cache_.current_submission_index_) {
+  bool is_new_frame = last_usage_frame_ != texture_cache_.current_frame_;
+  if (!is_new_frame && last_usage_submission_index_ >=
+                           texture_cache_.current_submission_index_) {
     return;
   }
   last_usage_submission_index_ = texture_cache_.current_submission_index_;
   last_usage_time_ = texture_cache_.current_submission_time_;
-  if (used_next_ == nullptr) {
+  UsageQueue new_usage_queue = usage_queue_;
+  if (is_new_frame) {
+    last_usage_frame_ = texture_cache_.current_frame_;
+    texture_cache_.working_set_current_frame_ += host_memory_usage_;
+    // Referenced in multiple frames - likely to be needed again.
+    new_usage_queue = UsageQueue::kFrequent;
+  }
+  if (used_next_ == nullptr && new_usage_queue == usage_queue_) {
     // Already the most recently used.
     return;
   }
-  if (used_previous_ != nullptr) {
+  UnlinkFromUsageQueue();
+  LinkToUsageQueue(new_usage_queue);
+}
+
+void TextureCache::Texture::LinkToUsageQueue(UsageQueue queue) {
+  Texture*& queue_last = texture_cache_.texture_used_last_[size_t(queue)];
+  usage_queue_ = queue;
+  used_previous_ = queue_last;
+  used_next_ = nullptr;
+  if (queue_last) {
+    queue_last->used_next_ = this;
+  } else {
+    texture_cache_.texture_used_first_[size_t(queue)] = this;
+  }
+  queue_last = this;
+}
+
+void TextureCache::Texture::UnlinkFromUsageQueue() {
+  if (used_previous_) {
     used_previous_->used_next_ = used_next_;
   } else {
-    texture_cache_.texture_used_first_ = used_next_;
+    texture_cache_.texture_used_first_[size_t(usage_queue_)] = used_next_;
+  }
+  if (used_next_) {
+    used_next_->used_previous_ = used_previous_;
+  } else {
+    texture_cache_.texture_used_last_[size_t(usage_queue_)] = used_previous_;
   }
-  used_next_->used_previous_ = used_previous_;
-  used_previous_ = texture_cache_.texture_used_last_;
-  used_next_ = nullptr;
-  texture_cache_.texture_used_last_->used_next_ = this;
-  texture_cache_.texture_used_last_ = this;
 }
 
 void TextureCache::Texture::WatchCallback(
@@ -577,6 +738,10 @@ void TextureCache::WatchCallback(
 void TextureCache::DestroyAllTextures(bool from_destructor) {
   ResetTextureBindings(from_destructor);
   textures_.clear();
+  assert_true(base_deferred_textures_.empty());
+  texture_content_index_.clear();
+  evicted_recent_keys_.clear();
+  evicted_recent_key_queue_.clear();
   COUNT_profile_set("gpu/texture_cache/textures", 0);
 }
 
@@ -656,6 +821,20 @@ bool TextureCache::LoadTextureData(Texture& texture) {
 
   TextureKey texture_key = texture.key();
 
+  // On the first load of a large texture, load only the mips, and leave the
+  // base for the later frames in case the texture is actually needed (its
+  // data is requested and hashed at that point).
+  if (base_outdated && mips_outdated && !texture.ever_loaded_ &&
+      cvars::texture_cache_defer_base_min_size &&
+      !texture_key.scaled_resolve && texture.GetGuestMipsSize() &&
+      std::max(texture_key.GetWidth(), texture_key.GetHeight()) >=
+          cvars::texture_cache_defer_base_min_size) {
+    texture.base_deferred_ = true;
+    base_deferred_textures_.push_back(&texture);
+    base_outdated = false;
+  }
+  texture.ever_loaded_ = true;
+
   // Implementation may load multiple blocks at once via accesses of up to 128
   // bits (R32G32B32A32_UINT), so aligning the size to this value to make sure
   // if the texture is small (especially if it's linear), the last blocks won't
@@ -703,10 +882,115 @@ bool TextureCache::LoadTextureData(Texture& texture) {
     }
   }
 
+  // Hash the guest data to find a texture with the same contents at a
+  // different address or the stored host data to use instead of loading the
+  // texture. Data written by resolves is not in the guest memory on the CPU
+  // side, so it can't be hashed.
+  bool content_hashed = false;
+  uint64_t content_hash = 0;
+  TextureKey address_independent_key = texture_key.GetAddressIndependentKey();
+  if ((content_deduplication_enabled_ || texture_storage_) &&
+      !texture.base_deferred_ && !texture_key.scaled_resolve &&
+      !base_resolved && !mips_resolved) {
+    const Memory& memory = shared_memory().memory();
+    XXH3_state_t hash_state;
+    XXH3_64bits_reset(&hash_state);
+    XXH3_64bits_update(&hash_state, &address_independent_key,
+                       sizeof(address_independent_key));
+    uint32_t guest_base_size = texture.GetGuestBaseSize();
+    if (guest_base_size) {
+      XXH3_64bits_update(
+          &hash_state, memory.TranslatePhysical(texture_key.base_page << 12),
+          guest_base_size);
+    }
+    uint32_t guest_mips_size = texture.GetGuestMipsSize();
+    if (guest_mips_size) {
+      XXH3_64bits_update(
+          &hash_state, memory.TranslatePhysical(texture_key.mip_page << 12),
+          guest_mips_size);
+    }
+    content_hash = XXH3_64bits_digest(&hash_state);
+    content_hashed = true;
+  }
+  bool content_indexed = content_hashed && content_deduplication_enabled_;
+  Texture* content_source = nullptr;
+  if (content_indexed) {
+    auto content_it = texture_content_index_.find(content_hash);
+    if (content_it != texture_content_index_.end() &&
+        content_it->second != &texture) {
+      Texture& source = *content_it->second;
+      // The hash of the source is as of its latest load - it must not have
+      // been modified since then.
+      bool source_outdated;
+      {
+        auto global_lock = global_critical_region_.Acquire();
+        source_outdated = source.base_outdated(global_lock) ||
+                          source.mips_outdated(global_lock);
+      }
+      if (!source_outdated && source.content_hash_ == content_hash &&
+          source.key().GetAddressIndependentKey() == address_independent_key) {
+        content_source = &source;
+      }
+    }
+  }
+
+  bool storage_used = content_hashed && texture_storage_;
+  uint64_t storage_key = 0;
+  if (storage_used) {
+    uint32_t storage_host_format = GetStorageHostFormat(texture);
+    storage_key = XXH3_64bits_withSeed(
+        &storage_host_format, sizeof(storage_host_format), content_hash);
+  }
+
   // Actually load the texture data.
-  if (!LoadTextureDataFromResidentMemoryImpl(texture, base_outdated,
-                                             mips_outdated)) {
-    return false;
+  if (content_source &&
+      CopyTextureDataFromDuplicateImpl(texture, *content_source)) {
+    texture.LogAction("Copied duplicate");
+  } else {
+    const uint8_t* stored_data = nullptr;
+    size_t stored_size = 0;
+    if (storage_used) {
+      stored_data = texture_storage_->Find(storage_key, stored_size);
+    }
+    if (stored_data &&
+        LoadTextureDataFromStorageImpl(texture, stored_data, stored_size)) {
+      texture.LogAction("Uploaded stored");
+    } else {
+      if (!LoadTextureDataFromResidentMemoryImpl(texture, base_outdated,
+                                                 mips_outdated)) {
+        return false;
+      }
+      ++texture_loads_total_;
+      texture_load_bytes_total_ +=
+          (base_outdated ? texture.GetGuestBaseSize() : 0) +
+          (mips_outdated ? texture.GetGuestMipsSize() : 0);
+      // TODO(Triang3l): Optionally encode static textures of uncompressed and
+      // expanded (such as 4_4_4_4, CTX1, DXT3A) formats to BC1 / BC3 / BC4 /
+      // BC5 / BC7 after loading, and store the encoded data, to reduce the
+      // VRAM usage with resolution scaling. This needs encoding compute
+      // shaders, and the host format of the texture to be chosen after the
+      // content hash is known (currently it's chosen on creation), with the
+      // block-compressed format included in the storage key.
+      if (storage_used && texture_storage_->Reserve(storage_key)) {
+        ReadBackTextureDataForStorageImpl(texture, storage_key);
+      }
+    }
+  }
+
+  // Update the content index, preferring the texture already in it as long as
+  // it's still up to date, as that one has actually been loaded.
+  if (texture.content_indexed_ &&
+      (!content_indexed || texture.content_hash_ != content_hash)) {
+    auto content_it = texture_content_index_.find(texture.content_hash_);
+    if (content_it != texture_content_index_.end() &&
+        content_it->second == &texture) {
+      texture_content_index_.erase(content_it);
+    }
+  }
+  texture.content_indexed_ = content_indexed;
+  texture.content_hash_ = content_hash;
+  if (content_indexed && !content_source) {
+    texture_content_index_[content_hash] = &texture;
   }
 
   // Update the source of the texture (resolve vs. CPU or memexport) for
@@ -723,11 +1007,51 @@ bool TextureCache::LoadTextureData(Texture& texture) {
   // not up to date anymore.
   texture.MakeUpToDateAndWatch(global_critical_region_.Acquire());
 
-  texture.LogAction("Loaded");
+  texture.LogAction(texture.base_deferred_ ? "Loaded mips of" : "Loaded");
 
   return true;
 }
 
+void TextureCache::LoadDeferredTextureBases() {
+  if (base_deferred_textures_.empty()) {
+    return;
+  }
+  uint64_t budget = uint64_t(cvars::texture_cache_deferred_base_budget) << 20;
+  uint64_t loaded_size = 0;
+  bool loaded_any = false;
+  size_t texture_count = base_deferred_textures_.size();
+  for (size_t i = 0; i < texture_count; ++i) {
+    Texture* texture = base_deferred_textures_.front();
+    if (texture->last_usage_frame() + 1 < current_frame_) {
+      // Not needed currently - check again in the next frames, until it's
+      // evicted.
+      base_deferred_textures_.pop_front();
+      base_deferred_textures_.push_back(texture);
+      continue;
+    }
+    uint32_t base_size = texture->GetGuestBaseSize();
+    if (loaded_any && loaded_size + base_size > budget) {
+      break;
+    }
+    base_deferred_textures_.pop_front();
+    texture->base_deferred_ = false;
+    LoadTextureData(*texture);
+    loaded_size += base_size;
+    loaded_any = true;
+  }
+  if (loaded_any) {
+    // Make sure the loading is attempted again if it has failed.
+    ResetTextureBindings();
+  }
+}
+
+void TextureCache::StoreTextureData(uint64_t storage_key, const void* data,
+                                    size_t size) {
+  if (texture_storage_) {
+    texture_storage_->Store(storage_key, data, size);
+  }
+}
+
 void TextureCache::BindingInfoFromFetchConstant(
     const xenos::xe_gpu_texture_fetch_t& fetch, TextureKey& key_out,
     uint8_t* swizzled_signs_out) {
@@ -14,14 +14,18 @@
 #include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <deque>
+#include <filesystem>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "xenia/base/assert.h"
 #include "xenia/base/hash.h"
 #include "xenia/base/mutex.h"
 #include "xenia/gpu/register_file.h"
 #include "xenia/gpu/shared_memory.h"
+#include "xenia/gpu/texture_storage.h"
 #include "xenia/gpu/texture_util.h"
 #include "xenia/gpu/xenos.h"
 
@@ -76,6 +80,11 @@ class TextureCache {
 
   virtual void ClearCache();
 
+  // Opens the persistent storage of converted textures of the title if enabled
+  // (see --store_textures), closing the one of the previous title.
+  void InitializeStorage(const std::filesystem::path& cache_root,
+                         uint32_t title_id);
+
   virtual void CompletedSubmissionUpdated(uint64_t completed_submission_index);
   virtual void BeginSubmission(uint64_t new_submission_index);
   virtual void BeginFrame();
@@ -119,6 +128,30 @@ class TextureCache {
     return (binding->texture && binding->texture->IsResolved()) ||
            (binding->texture_signed && binding->texture_signed->IsResolved());
   }
+  // If true, the sampler must not access the base level.
+  bool IsActiveTextureBaseDeferred(uint32_t fetch_constant_index) const {
+    const TextureBinding* binding =
+        GetValidTextureBinding(fetch_constant_index);
+    if (!binding) {
+      return false;
+    }
+    return (binding->texture && binding->texture->IsBaseDeferred()) ||
+           (binding->texture_signed &&
+            binding->texture_signed->IsBaseDeferred());
+  }
+
+  // Total number of texture data loads from the guest memory, for statistics.
+  uint64_t texture_loads_total() const { return texture_loads_total_; }
+  uint64_t texture_load_bytes_total() const {
+    return texture_load_bytes_total_;
+  }
+  // Host memory currently used by the textures, and the limits at which unused
+  // textures were evicted last time, for statistics.
+  uint64_t textures_total_host_memory_usage() const {
+    return textures_total_host_memory_usage_;
+  }
+  uint64_t memory_limit_soft() const { return memory_limit_soft_; }
+  uint64_t memory_limit_hard() const { return memory_limit_hard_; }
 
  protected:
   struct TextureKey {
@@ -189,6 +222,26 @@ class TextureCache {
       return GetLogDimensionName(dimension);
     }
     void LogAction(const char* action) const;
+
+    // The key of textures with the same host representation regardless of the
+    // location of the guest data, for content deduplication.
+    TextureKey GetAddressIndependentKey() const {
+      TextureKey key(*this);
+      // Whether the base and the mips are present affects the layout.
+      key.base_page = uint32_t(base_page != 0);
+      key.mip_page = uint32_t(mip_page != 0);
+      return key;
+    }
+  };
+
+  // Segmented LRU queues of textures for eviction, similar to 2Q / ARC.
+  // Textures referenced in only one frame are evicted earlier than those that
+  // have been referenced in multiple frames (the long-term working set).
+  enum class UsageQueue : uint32_t {
+    kRecent,
+    kFrequent,
+
+    kCount,
   };
 
   class Texture {
@@ -217,6 +270,7 @@ class TextureCache {
       return last_usage_submission_index_;
     }
     uint64_t last_usage_time() const { return last_usage_time_; }
+    uint64_t last_usage_frame() const { return last_usage_frame_; }
 
     bool GetBaseResolved() const { return base_resolved_; }
     void SetBaseResolved(bool base_resolved) {
@@ -244,24 +298,42 @@ class TextureCache {
     void WatchCallback(
         const std::unique_lock<std::recursive_mutex>& global_lock, bool is_mip);
 
-    // For LRU caching - updates the last usage frame and moves the texture to
-    // the end of the usage queue. Must be called any time the texture is
-    // referenced by any GPU work in the implementation to make sure it's not
-    // destroyed while still in use.
+    // For LRU caching - updates the last usage submission and frame, and moves
+    // the texture to the end of its usage queue (to the queue of frequently
+    // used textures if it's referenced in a new frame). Must be called any time
+    // the texture is referenced by any GPU work in the implementation to make
+    // sure it's not destroyed while still in use.
     void MarkAsUsed();
 
     void LogAction(const char* action) const;
 
+    // Hash of the guest data and the address-independent key as of the latest
+    // load, valid if content_indexed is true.
+    uint64_t content_hash() const { return content_hash_; }
+    bool content_indexed() const { return content_indexed_; }
+
+    // Whether loading of the base level has been postponed, and only the mips
+    // can be sampled (see --texture_cache_defer_base_min_size).
+    bool IsBaseDeferred() const { return base_deferred_; }
+
    protected:
     explicit Texture(TextureCache& texture_cache, const TextureKey& key);
 
     void SetHostMemoryUsage(uint64_t new_host_memory_usage) {
       texture_cache_.UpdateTexturesTotalHostMemoryUsage(new_host_memory_usage,
                                                         host_memory_usage_);
+      if (last_usage_frame_ == texture_cache_.current_frame_) {
+        texture_cache_.working_set_current_frame_ +=
+            new_host_memory_usage - host_memory_usage_;
+      }
       host_memory_usage_ = new_host_memory_usage;
     }
 
    private:
+    // Appends the texture to the end of the usage queue.
+    void LinkToUsageQueue(UsageQueue queue);
+    void UnlinkFromUsageQueue();
+
     TextureCache& texture_cache_;
 
     TextureKey key_;
@@ -272,6 +344,8 @@ class TextureCache {
 
     uint64_t last_usage_submission_index_;
     uint64_t last_usage_time_;
+    uint64_t last_usage_frame_;
+    UsageQueue usage_queue_;
     Texture* used_previous_;
     Texture* used_next_;
 
@@ -291,6 +365,14 @@ class TextureCache {
     // Watch handles for the memory ranges.
     SharedMemory::WatchHandle base_watch_handle_ = nullptr;
     SharedMemory::WatchHandle mips_watch_handle_ = nullptr;
+
+    uint64_t content_hash_ = 0;
+    bool content_indexed_ = false;
+
+    bool ever_loaded_ = false;
+    bool base_deferred_ = false;
+
+    friend class TextureCache;
   };
 
   // Rules of data access in load shaders:
@@ -545,6 +627,17 @@ class TextureCache {
     assert_true(load_shader_index < kLoadShaderCount);
     return load_shader_info_[load_shader_index];
   }
+  // Records the loading of the outdated parts of the texture and their upload
+  // to the command list of the main graphics queue, so the loads are ordered
+  // with the draws and the resolves by the queue itself.
+  // TODO(Triang3l): Move the texture loading and the resolve dispatches to an
+  // async compute queue. This requires the shared memory and the scaled
+  // resolve buffers to be usable concurrently by both queues (queue family
+  // ownership transfers in Vulkan, common state promotion or explicit
+  // transitions on both queues in Direct3D 12), the cross-queue fences or
+  // semaphores to be waited for before the first draw sampling the texture and
+  // before the shared memory range is overwritten, and the submission tracking
+  // to know about the compute queue's submissions for resource destruction.
   bool LoadTextureData(Texture& texture);
   // Writes the texture data (for base, mips or both - but not neither) from the
   // shared memory or the scaled resolve memory. The shared memory management is
@@ -553,6 +646,50 @@ class TextureCache {
   virtual bool LoadTextureDataFromResidentMemoryImpl(Texture& texture,
                                                      bool load_base,
                                                      bool load_mips) = 0;
+  // Copies all the host data of the source texture, which has the same
+  // address-independent key and the same guest data, to the destination
+  // texture, instead of loading it (see --texture_cache_deduplicate_content).
+  // The implementation may return false if copying is not supported, in this
+  // case the data will be loaded.
+  virtual bool CopyTextureDataFromDuplicateImpl(Texture& texture,
+                                                Texture& source_texture) {
+    return false;
+  }
+  bool IsContentDeduplicationEnabled() const {
+    return content_deduplication_enabled_;
+  }
+
+  // Returns the video memory budget for the process in the local (dedicated
+  // for discrete GPUs) memory of the host GPU, and the current usage of it by
+  // the process, in bytes, or false if the host GPU API doesn't report them.
+  virtual bool GetHostMemoryBudget(uint64_t& budget_out,
+                                   uint64_t& usage_out) const {
+    return false;
+  }
+
+  // Persistent storage of the host data of textures (see --store_textures).
+  // The name of the host representation of the stored data, the storage is not
+  // used if it's null.
+  virtual const char* GetStorageApiName() const { return nullptr; }
+  // Value identifying the host format and the layout of the stored data of the
+  // texture, as they may depend on the device capabilities.
+  virtual uint32_t GetStorageHostFormat(const Texture& texture) const {
+    return 0;
+  }
+  // Uploads all the host data of the texture in the form returned by the
+  // backend to StoreTextureData. Returns false if the data is not usable, in
+  // this case the texture will be loaded from the guest data.
+  virtual bool LoadTextureDataFromStorageImpl(Texture& texture,
+                                              const uint8_t* data,
+                                              size_t size) {
+    return false;
+  }
+  // Begins copying all the host data of the loaded texture to the CPU, to call
+  // StoreTextureData with the key when it's available.
+  virtual void ReadBackTextureDataForStorageImpl(Texture& texture,
+                                                 uint64_t storage_key) {}
+  bool IsStorageOpen() const { return texture_storage_ != nullptr; }
+  void StoreTextureData(uint64_t storage_key, const void* data, size_t size);
 
   // Converts a texture fetch constant to a texture key, normalizing and
   // validating the values, or creating an invalid key, and also gets the
@@ -578,6 +715,10 @@ class TextureCache {
  private:
   void UpdateTexturesTotalHostMemoryUsage(uint64_t add, uint64_t subtract);
 
+  // Loads the postponed base levels of the textures referenced in the previous
+  // frame, within the per-frame budget.
+  void LoadDeferredTextureBases();
+
   // Shared memory callback for texture data invalidation.
   static void WatchCallback(
       const std::unique_lock<std::recursive_mutex>& global_lock, void* context,
@@ -599,6 +740,7 @@ class TextureCache {
   SharedMemory& shared_memory_;
   uint32_t draw_resolution_scale_x_;
   uint32_t draw_resolution_scale_y_;
+  bool content_deduplication_enabled_;
 
   static const LoadShaderInfo load_shader_info_[kLoadShaderCount];
 
@@ -623,8 +765,42 @@ class TextureCache {
 
   uint64_t textures_total_host_memory_usage_ = 0;
 
-  Texture* texture_used_first_ = nullptr;
-  Texture* texture_used_last_ = nullptr;
+  uint64_t texture_loads_total_ = 0;
+  uint64_t texture_load_bytes_total_ = 0;
+
+  std::unique_ptr<TextureStorage> texture_storage_;
+
+  // Loaded textures by the hash of their guest data and address-independent
+  // key, for copying the host data instead of loading it again.
+  std::unordered_map<uint64_t, Texture*> texture_content_index_;
+
+  Texture* texture_used_first_[size_t(UsageQueue::kCount)] = {};
+  Texture* texture_used_last_[size_t(UsageQueue::kCount)] = {};
+
+  // Keys of the textures evicted from the recent queue that haven't become a
+  // part of the long-term working set, in the order of eviction - the texture
+  // is placed in the frequent queue immediately if it's needed again.
+  static constexpr size_t kEvictedRecentKeysMax = 4096;
+  std::unordered_set<TextureKey, TextureKey::Hasher> evicted_recent_keys_;
+  std::deque<TextureKey> evicted_recent_key_queue_;
+
+  // Textures with the base level not loaded yet, in the order of deferral.
+  std::deque<Texture*> base_deferred_textures_;
+  uint64_t base_deferred_textures_frame_ = 0;
+
+  // Index of the current guest frame, for working set tracking.
+  uint64_t current_frame_ = 1;
+  // Host memory used by the textures referenced during the current frame.
+  uint64_t working_set_current_frame_ = 0;
+  // Peak of the working set sizes of the recent frames, decaying over time.
+  uint64_t working_set_estimate_ = 0;
+  // Queried once per frame.
+  bool host_memory_budget_available_ = false;
+  uint64_t host_memory_budget_ = 0;
+  uint64_t host_memory_budget_usage_ = 0;
+  // The limits used by the latest CompletedSubmissionUpdated.
+  uint64_t memory_limit_soft_ = 0;
+  uint64_t memory_limit_hard_ = 0;
 
   // Whether a texture has become outdated (a memory watch has been triggered),
   // so need to recheck if textures aren't outdated, disregarding whether fetch
@@ -18,6 +18,7 @@
 #include "xenia/base/math.h"
 #include "xenia/base/memory.h"
 #include "xenia/base/profiling.h"
+#include "xenia/base/threading.h"
 #include "xenia/base/xxhash.h"
 
 namespace xe {
@@ -37,11 +38,13 @@ void CopySwapBlock(xenos::Endian endian, void* output, const void* input,
       break;
     case xenos::Endian::k16in32:  // Swap high and low 16 bits within a 32 bit
                                   // word
-      xe::copy_and_swap_16_in_32_unaligned(output, input, length);
+      xe::copy_and_swap_16_in_32_unaligned(output, input, length / 4);
       break;
     default:
     case xenos::Endian::kNone:
-      std::memcpy(output, input, length);
+      if (output != input) {
+        std::memcpy(output, input, length);
+      }
       break;
   }
 }
@@ -121,36 +124,74 @@ void Untile(uint8_t* output_buffer, const uint8_t* input_buffer,
   uint32_t output_bytes_per_block =
       untile_info->output_format_info->bytes_per_block();
   uint32_t output_pitch = untile_info->output_pitch * output_bytes_per_block;
+  bool copy_with_swap = !untile_info->copy_callback;
+  assert_true(!copy_with_swap ||
+              input_bytes_per_block == output_bytes_per_block);
 
   // Bytes per pixel
   auto log2_bpp = (input_bytes_per_block / 4) +
                   ((input_bytes_per_block / 2) >> (input_bytes_per_block / 4));
-
-  // Offset to the current row, in bytes.
-  uint32_t output_row_offset = 0;
-  for (uint32_t y = 0; y < untile_info->height; y++) {
-    auto input_row_offset = TiledOffset2DRow(
-        untile_info->offset_y + y, untile_info->input_pitch, log2_bpp);
-
-    // Go block-by-block on this row.
-    uint32_t output_offset = output_row_offset;
-
-    for (uint32_t x = 0; x < untile_info->width; x++) {
-      auto input_offset = TiledOffset2DColumn(untile_info->offset_x + x,
-                                              untile_info->offset_y + y,
-                                              log2_bpp, input_row_offset);
-      input_offset >>= log2_bpp;
-
-      untile_info->copy_callback(
-          &output_buffer[output_offset],
-          &input_buffer[input_offset * input_bytes_per_block],
-          output_bytes_per_block);
-
-      output_offset += output_bytes_per_block;
+  // Blocks within a 16-byte span of a row of the tile are contiguous in the
+  // tiled memory, so the address only needs to be calculated once per span.
+  uint32_t run_length_max = std::min(uint32_t(8), uint32_t(16) >> log2_bpp);
+
+  auto untile_rows = [&](uint32_t y_first, uint32_t y_end) {
+    for (uint32_t y = y_first; y < y_end; ++y) {
+      uint32_t input_y = untile_info->offset_y + y;
+      auto input_row_offset =
+          TiledOffset2DRow(input_y, untile_info->input_pitch, log2_bpp);
+      uint8_t* output_row = &output_buffer[y * output_pitch];
+
+      // Go span-by-span on this row.
+      uint32_t x = 0;
+      while (x < untile_info->width) {
+        uint32_t input_x = untile_info->offset_x + x;
+        uint32_t run_length =
+            std::min(run_length_max - (input_x & (run_length_max - 1)),
+                     untile_info->width - x);
+        auto input_offset =
+            TiledOffset2DColumn(input_x, input_y, log2_bpp, input_row_offset);
+        input_offset >>= log2_bpp;
+        const uint8_t* input_run =
+            &input_buffer[input_offset * input_bytes_per_block];
+        uint8_t* output_run = &output_row[x * output_bytes_per_block];
+        if (copy_with_swap) {
+          std::memcpy(output_run, input_run,
+                      run_length * input_bytes_per_block);
+        } else {
+          for (uint32_t i = 0; i < run_length; ++i) {
+            untile_info->copy_callback(
+                &output_run[i * output_bytes_per_block],
+                &input_run[i * input_bytes_per_block], output_bytes_per_block);
+          }
+        }
+        x += run_length;
+      }
+
+      if (copy_with_swap) {
+        // Swap the whole row at once with the vectorized routines.
+        CopySwapBlock(untile_info->endian, output_row, output_row,
+                      untile_info->width * output_bytes_per_block);
+      }
     }
-
-    output_row_offset += output_pitch;
+  };
+
+  // Large textures (loaded on the CPU when the compute shader texture loading
+  // is not available) are untiled in groups of rows on multiple threads.
+  constexpr uint32_t kRowsPerTask = 32;
+  constexpr uint32_t kParallelMinBlocks = 256 * 256;
+  uint32_t task_count =
+      (untile_info->height + (kRowsPerTask - 1)) / kRowsPerTask;
+  if (task_count <= 1 ||
+      untile_info->width * untile_info->height < kParallelMinBlocks) {
+    untile_rows(0, untile_info->height);
+    return;
   }
+  xe::threading::ParallelFor(task_count, [&](size_t task_index) {
+    uint32_t y_first = uint32_t(task_index) * kRowsPerTask;
+    untile_rows(y_first,
+                std::min(y_first + kRowsPerTask, untile_info->height));
+  });
 }
 
 }  //  namespace texture_conversion
@@ -43,7 +43,10 @@ typedef struct UntileInfo {
   uint32_t output_pitch;
   const FormatInfo* input_format_info;
   const FormatInfo* output_format_info;
+  // If empty, the blocks are copied with the endian swap, and the input and
+  // the output formats must have the same block size.
   UntileCopyBlockCallback copy_callback;
+  xenos::Endian endian;
 } UntileInfo;
 
 void Untile(uint8_t* output_buffer, const uint8_t* input_buffer,
@@ -0,0 +1,207 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/gpu/texture_storage.h"
+
+#include <cstring>
+#include <system_error>
+
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/math.h"
+
+namespace xe {
+namespace gpu {
+
+std::unique_ptr<TextureStorage> TextureStorage::Open(
+    const std::filesystem::path& path, const char* api_name,
+    uint64_t size_limit) {
+  std::unique_ptr<TextureStorage> storage(new TextureStorage());
+  storage->path_ = path;
+  storage->new_path_ = path;
+  storage->new_path_ += ".new";
+  std::strncpy(storage->api_name_, api_name, sizeof(storage->api_name_));
+  storage->size_limit_ = size_limit;
+
+  // Validate the pack file, recreating it if it's not valid, and add the data
+  // stored during the previous session if it hasn't been closed properly.
+  if (!storage->MergeNewRecords(storage->new_path_)) {
+    XELOGE("Failed to open the texture storage pack file {}",
+           xe::path_to_utf8(path));
+    return nullptr;
+  }
+
+  storage->mapping_ = MappedMemory::Open(path, MappedMemory::Mode::kRead);
+  if (!storage->mapping_) {
+    XELOGE("Failed to map the texture storage pack file {}",
+           xe::path_to_utf8(path));
+    return nullptr;
+  }
+  TextureStorage& storage_ref = *storage;
+  storage->size_ = storage->ScanRecords(
+      storage->mapping_->data(), storage->mapping_->size(),
+      [&storage_ref](uint64_t key, size_t offset, size_t size) {
+        storage_ref.records_.emplace(key, Record{offset, size});
+      });
+
+  storage->new_file_ = xe::filesystem::OpenFile(storage->new_path_, "wb");
+  if (!storage->new_file_) {
+    XELOGE("Failed to open the texture storage file {} for writing",
+           xe::path_to_utf8(storage->new_path_));
+    return nullptr;
+  }
+  FileHeader header = storage->MakeFileHeader();
+  fwrite(&header, sizeof(header), 1, storage->new_file_);
+
+  XELOGGPU("Opened the texture storage with {} textures ({} MB)",
+           storage->records_.size(), storage->size_ >> 20);
+  return storage;
+}
+
+TextureStorage::~TextureStorage() {
+  if (new_file_) {
+    fclose(new_file_);
+  }
+  mapping_.reset();
+  if (!path_.empty()) {
+    MergeNewRecords(new_path_);
+  }
+}
+
+const uint8_t* TextureStorage::Find(uint64_t key, size_t& size_out) const {
+  auto it = records_.find(key);
+  if (it == records_.end()) {
+    size_out = 0;
+    return nullptr;
+  }
+  size_out = it->second.size;
+  return mapping_->data() + it->second.offset;
+}
+
+bool TextureStorage::Reserve(uint64_t key) {
+  if (!new_file_ || size_ >= size_limit_ || records_.count(key)) {
+    return false;
+  }
+  return keys_reserved_.insert(key).second;
+}
+
+void TextureStorage::Store(uint64_t key, const void* data, size_t size) {
+  // Not reserved if requested before the storage was reopened.
+  if (!new_file_ || !keys_reserved_.count(key)) {
+    return;
+  }
+  RecordHeader record_header;
+  record_header.key = key;
+  record_header.size = size;
+  static const uint8_t kPadding[kRecordAlignment] = {};
+  size_t padding = xe::align(size, kRecordAlignment) - size;
+  if (fwrite(&record_header, sizeof(record_header), 1, new_file_) != 1 ||
+      fwrite(data, 1, size, new_file_) != size ||
+      fwrite(kPadding, 1, padding, new_file_) != padding) {
+    XELOGE("Failed to write to the texture storage, disabling storing");
+    fclose(new_file_);
+    new_file_ = nullptr;
+    return;
+  }
+  size_ += sizeof(record_header) + size + padding;
+}
+
+TextureStorage::FileHeader TextureStorage::MakeFileHeader() const {
+  FileHeader header;
+  header.magic = kMagic;
+  header.version = kVersion;
+  std::memcpy(header.api_name, api_name_, sizeof(header.api_name));
+  return header;
+}
+
+template <typename F>
+size_t TextureStorage::ScanRecords(const uint8_t* data, size_t size,
+                                   F&& callback) const {
+  FileHeader header = MakeFileHeader();
+  if (size < sizeof(header) || std::memcmp(data, &header, sizeof(header))) {
+    return 0;
+  }
+  static_assert(sizeof(FileHeader) % kRecordAlignment == 0);
+  static_assert(sizeof(RecordHeader) % kRecordAlignment == 0);
+  size_t offset = sizeof(header);
+  while (size - offset >= sizeof(RecordHeader)) {
+    RecordHeader record_header;
+    std::memcpy(&record_header, data + offset, sizeof(record_header));
+    size_t data_offset = offset + sizeof(record_header);
+    // Stop at the incomplete record if the file has been cut off.
+    if (record_header.size > size - data_offset ||
+        xe::align(size_t(record_header.size), kRecordAlignment) >
+            size - data_offset) {
+      break;
+    }
+    callback(record_header.key, data_offset, size_t(record_header.size));
+    offset =
+        data_offset + xe::align(size_t(record_header.size), kRecordAlignment);
+  }
+  return offset;
+}
+
+bool TextureStorage::MergeNewRecords(const std::filesystem::path& new_path) {
+  size_t pack_valid_size = 0;
+  if (std::filesystem::exists(path_)) {
+    std::unique_ptr<MappedMemory> pack_mapping =
+        MappedMemory::Open(path_, MappedMemory::Mode::kRead);
+    if (pack_mapping) {
+      pack_valid_size =
+          ScanRecords(pack_mapping->data(), pack_mapping->size(),
+                      [](uint64_t key, size_t offset, size_t size) {});
+    }
+  }
+  FILE* pack_file;
+  if (pack_valid_size) {
+    pack_file = xe::filesystem::OpenFile(path_, "r+b");
+    if (!pack_file) {
+      return false;
+    }
+    // Drop the incomplete record that may be left at the end.
+    if (!xe::filesystem::TruncateStdioFile(pack_file, pack_valid_size)) {
+      fclose(pack_file);
+      return false;
+    }
+    xe::filesystem::Seek(pack_file, 0, SEEK_END);
+  } else {
+    pack_file = xe::filesystem::OpenFile(path_, "wb");
+    if (!pack_file) {
+      return false;
+    }
+    FileHeader header = MakeFileHeader();
+    fwrite(&header, sizeof(header), 1, pack_file);
+  }
+
+  if (std::filesystem::exists(new_path)) {
+    std::unique_ptr<MappedMemory> new_mapping =
+        MappedMemory::Open(new_path, MappedMemory::Mode::kRead);
+    if (new_mapping) {
+      const uint8_t* new_data = new_mapping->data();
+      ScanRecords(new_data, new_mapping->size(),
+                  [new_data, pack_file](uint64_t key, size_t offset,
+                                        size_t size) {
+                    // The record header and the padded data.
+                    fwrite(new_data + offset - sizeof(RecordHeader), 1,
+                           sizeof(RecordHeader) +
+                               xe::align(size, kRecordAlignment),
+                           pack_file);
+                  });
+    }
+    new_mapping.reset();
+    std::error_code remove_error;
+    std::filesystem::remove(new_path, remove_error);
+  }
+
+  fclose(pack_file);
+  return true;
+}
+
+}  // namespace gpu
+}  // namespace xe
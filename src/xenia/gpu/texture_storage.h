@@ -0,0 +1,103 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_GPU_TEXTURE_STORAGE_H_
+#define XENIA_GPU_TEXTURE_STORAGE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "xenia/base/mapped_memory.h"
+
+namespace xe {
+namespace gpu {
+
+// Persistent storage of host-ready texture data (in the form specific to the
+// host graphics API), addressed by a hash of the guest data and the host
+// format, in a pack file that is memory-mapped for reading.
+//
+// The pack file can't be written to while it's mapped, so the data stored
+// during the session is written to a separate file, which is appended to the
+// pack file when the storage is closed, or, if the emulator has exited without
+// closing it, when the storage is opened the next time.
+class TextureStorage {
+ public:
+  // The API name (up to 8 characters) distinguishes the host representations
+  // of the data. The size limit applies to the pack file including the data
+  // stored during the session.
+  static std::unique_ptr<TextureStorage> Open(
+      const std::filesystem::path& path, const char* api_name,
+      uint64_t size_limit);
+
+  TextureStorage(const TextureStorage& storage) = delete;
+  TextureStorage& operator=(const TextureStorage& storage) = delete;
+  ~TextureStorage();
+
+  // Returns the data stored during the previous sessions, or nullptr if it's
+  // not available. The data is 16-byte-aligned.
+  const uint8_t* Find(uint64_t key, size_t& size_out) const;
+  // Returns whether the data with the key needs to be obtained and passed to
+  // Store - false if it's already stored, has already been reserved, or the
+  // size limit has been reached.
+  bool Reserve(uint64_t key);
+  // Ignored if the key has not been reserved.
+  void Store(uint64_t key, const void* data, size_t size);
+
+ private:
+  struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    char api_name[8];
+  };
+  struct RecordHeader {
+    uint64_t key;
+    uint64_t size;
+  };
+  struct Record {
+    size_t offset;
+    size_t size;
+  };
+
+  static constexpr uint32_t kMagic = 0x58544558;  // 'XETX'.
+  static constexpr uint32_t kVersion = 1;
+  static constexpr size_t kRecordAlignment = 16;
+
+  TextureStorage() = default;
+
+  FileHeader MakeFileHeader() const;
+  // Returns the size of the valid part of the file, or 0 if the header is not
+  // valid. Calls the callback for every complete record.
+  template <typename F>
+  size_t ScanRecords(const uint8_t* data, size_t size, F&& callback) const;
+  // Appends the valid records from the new data file to the pack file and
+  // deletes the new data file.
+  bool MergeNewRecords(const std::filesystem::path& new_path);
+
+  std::filesystem::path path_;
+  std::filesystem::path new_path_;
+  char api_name_[8] = {};
+  uint64_t size_limit_ = 0;
+
+  std::unique_ptr<MappedMemory> mapping_;
+  std::unordered_map<uint64_t, Record> records_;
+  std::unordered_set<uint64_t> keys_reserved_;
+
+  FILE* new_file_ = nullptr;
+  uint64_t size_ = 0;
+};
+
+}  // namespace gpu
+}  // namespace xe
+
+#endif  // XENIA_GPU_TEXTURE_STORAGE_H_
@@ -9,7 +9,11 @@
 
 #include "xenia/gpu/trace_dump.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "third_party/stb/stb_image_write.h"
+#include "xenia/base/clock.h"
 #include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/profiling.h"
@@ -30,6 +34,28 @@
 
 DEFINE_path(target_trace_file, "", "Specifies the trace file to load.", "GPU");
 DEFINE_path(trace_dump_path, "", "Output path for dumped files.", "GPU");
+DEFINE_path(
+    trace_dump_shader_storage_root, "",
+    "Cache root to build the persistent shader and pipeline storage of the "
+    "host GPU API in, as the emulator would for the titles the traces were "
+    "recorded from. Instead of dumping the first frame, all frames of the "
+    "traces are played back, and if the trace path is a directory, all the "
+    ".xtr files in it are played back. The existing storage of the titles is "
+    "loaded and extended, and the host-specific part of it is built from the "
+    "whole storage (not only from what is used in the traces).",
+    "GPU");
+DEFINE_int32(
+    trace_dump_benchmark_iterations, 0,
+    "If not 0, instead of dumping the first frame, play back all frames of "
+    "the trace this many times, and report the percentiles of the time taken "
+    "to play back a frame (from submitting it to the command processor until "
+    "it has been processed, including host GPU waits) and the totals of every "
+    "iteration. The caches are cleared before every iteration, but the "
+    "pipelines are kept, so the first iteration, which also creates the "
+    "pipelines, is excluded from the percentiles if there are more. Use "
+    "together with --gpu_statistics_csv_path to get the host GPU time and "
+    "the work counters of every frame.",
+    "GPU");
 
 namespace xe {
 namespace gpu {
@@ -63,6 +89,10 @@ int TraceDump::Main(const std::vector<std::string>& args) {
     return 5;
   }
 
+  if (!cvars::trace_dump_shader_storage_root.empty()) {
+    return BuildShaderStorage(path);
+  }
+
   // Normalize the path and make absolute.
   auto abs_path = std::filesystem::absolute(path);
   XELOGI("Loading trace file {}...", xe::path_to_utf8(abs_path));
@@ -76,6 +106,10 @@ int TraceDump::Main(const std::vector<std::string>& args) {
     return 5;
   }
 
+  if (cvars::trace_dump_benchmark_iterations > 0) {
+    return Benchmark();
+  }
+
   // Root file name for outputs.
   if (output_path.empty()) {
     base_output_path_ = cvars::trace_dump_path;
@@ -118,6 +152,123 @@ bool TraceDump::Load(const std::filesystem::path& trace_file_path) {
   return true;
 }
 
+int TraceDump::BuildShaderStorage(const std::filesystem::path& path) {
+  std::vector<std::filesystem::path> trace_file_paths;
+  std::error_code error_code;
+  if (std::filesystem::is_directory(path, error_code)) {
+    for (const std::filesystem::directory_entry& entry :
+         std::filesystem::directory_iterator(path, error_code)) {
+      if (entry.is_regular_file(error_code) &&
+          entry.path().extension() == ".xtr") {
+        trace_file_paths.push_back(std::filesystem::absolute(entry.path()));
+      }
+    }
+    // Stable order of the shaders and the pipelines in the storage.
+    std::sort(trace_file_paths.begin(), trace_file_paths.end());
+  } else {
+    trace_file_paths.push_back(std::filesystem::absolute(path));
+  }
+  if (trace_file_paths.empty()) {
+    XELOGE("No trace files found in {}", xe::path_to_utf8(path));
+    return 5;
+  }
+
+  if (!Setup()) {
+    XELOGE("Unable to setup trace dump tool");
+    return 4;
+  }
+
+  std::filesystem::path cache_root =
+      std::filesystem::absolute(cvars::trace_dump_shader_storage_root);
+  bool shader_storage_initialized = false;
+  uint32_t shader_storage_title_id = 0;
+  size_t trace_files_played = 0;
+  for (const std::filesystem::path& trace_file_path : trace_file_paths) {
+    XELOGI("Playing back trace file {} into the shader storage...",
+           xe::path_to_utf8(trace_file_path));
+    if (!Load(trace_file_path)) {
+      XELOGE("Unable to load trace file {}, skipping",
+             xe::path_to_utf8(trace_file_path));
+      continue;
+    }
+    // Reinitializing the storage loads all of it, so only do that when the
+    // title is changed.
+    uint32_t title_id = player_->header()->title_id;
+    if (!shader_storage_initialized || title_id != shader_storage_title_id) {
+      graphics_system_->InitializeShaderStorage(cache_root, title_id, true);
+      shader_storage_initialized = true;
+      shader_storage_title_id = title_id;
+    }
+    player_->PlayAllFrames();
+    player_->WaitOnPlayback();
+    ++trace_files_played;
+  }
+  XELOGI("Played back {} of {} trace files into the shader storage in {}",
+         trace_files_played, trace_file_paths.size(),
+         xe::path_to_utf8(cache_root));
+
+  // Shutting down the graphics system closes the storage, also writing the
+  // host-specific part of it.
+  player_.reset();
+  emulator_.reset();
+  return trace_files_played ? 0 : 5;
+}
+
+int TraceDump::Benchmark() {
+  int frame_count = player_->frame_count();
+  if (!frame_count) {
+    XELOGE("No frames in the trace file {}",
+           xe::path_to_utf8(trace_file_path_));
+    player_.reset();
+    emulator_.reset();
+    return 5;
+  }
+  uint32_t iteration_count =
+      uint32_t(cvars::trace_dump_benchmark_iterations);
+  double tick_ms = 1000.0 / double(Clock::QueryHostTickFrequency());
+  std::vector<double> frame_times_ms;
+  frame_times_ms.reserve(size_t(frame_count) * iteration_count);
+  for (uint32_t i = 0; i < iteration_count; ++i) {
+    // Replaying from a clean state in every iteration, but keeping the
+    // pipelines and the other objects that are not tied to the guest memory.
+    graphics_system_->command_processor()->CallInThread([this]() {
+      graphics_system_->command_processor()->ClearCaches();
+    });
+    if (i == 1) {
+      frame_times_ms.clear();
+    }
+    uint64_t iteration_start = Clock::QueryHostTickCount();
+    for (int j = 0; j < frame_count; ++j) {
+      uint64_t frame_start = Clock::QueryHostTickCount();
+      player_->PlayFrame(j);
+      player_->WaitOnPlayback();
+      frame_times_ms.push_back(
+          double(Clock::QueryHostTickCount() - frame_start) * tick_ms);
+    }
+    XELOGI("Benchmark iteration {}: {} frames in {:.3f} ms", i, frame_count,
+           double(Clock::QueryHostTickCount() - iteration_start) * tick_ms);
+  }
+
+  std::sort(frame_times_ms.begin(), frame_times_ms.end());
+  auto percentile = [&frame_times_ms](uint32_t p) {
+    return frame_times_ms[(frame_times_ms.size() - 1) * p / 100];
+  };
+  double frame_time_sum_ms = 0.0;
+  for (double frame_time_ms : frame_times_ms) {
+    frame_time_sum_ms += frame_time_ms;
+  }
+  XELOGI(
+      "Benchmark frame playback time over {} frames: mean {:.3f} ms, median "
+      "{:.3f} ms, 90th percentile {:.3f} ms, 99th percentile {:.3f} ms, "
+      "maximum {:.3f} ms",
+      frame_times_ms.size(), frame_time_sum_ms / frame_times_ms.size(),
+      percentile(50), percentile(90), percentile(99), frame_times_ms.back());
+
+  player_.reset();
+  emulator_.reset();
+  return 0;
+}
+
 int TraceDump::Run() {
   BeginHostCapture();
   player_->SeekFrame(0);
@@ -10,6 +10,7 @@
 #ifndef XENIA_GPU_TRACE_DUMP_H_
 #define XENIA_GPU_TRACE_DUMP_H_
 
+#include <filesystem>
 #include <string>
 
 #include "xenia/emulator.h"
@@ -47,6 +48,12 @@ class TraceDump {
   bool Setup();
   bool Load(const std::filesystem::path& trace_file_path);
   int Run();
+  // Plays back all frames of one or a directory of traces with the persistent
+  // shader storage enabled.
+  int BuildShaderStorage(const std::filesystem::path& path);
+  // Plays back all frames of the trace multiple times, reporting the time of
+  // the playback of every frame.
+  int Benchmark();
 
   std::filesystem::path trace_file_path_;
   std::filesystem::path base_output_path_;
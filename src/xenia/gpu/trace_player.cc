@@ -9,6 +9,7 @@
 
 #include "xenia/gpu/trace_player.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "xenia/gpu/command_processor.h"
@@ -47,6 +48,10 @@ void TracePlayer::SeekFrame(int target_frame) {
   if (current_frame_index_ == target_frame) {
     return;
   }
+  PlayFrame(target_frame);
+}
+
+void TracePlayer::PlayFrame(int target_frame) {
   current_frame_index_ = target_frame;
   auto frame = current_frame();
   current_command_index_ = int(frame->commands.size()) - 1;
@@ -81,6 +86,18 @@ void TracePlayer::SeekCommand(int target_command) {
   }
 }
 
+void TracePlayer::PlayAllFrames() {
+  if (!trace_data_ || trace_size_ <= sizeof(TraceHeader)) {
+    return;
+  }
+  current_frame_index_ = std::max(frame_count() - 1, 0);
+  auto frame = current_frame();
+  current_command_index_ = frame ? int(frame->commands.size()) - 1 : -1;
+  PlayTrace(trace_data_ + sizeof(TraceHeader),
+            trace_size_ - sizeof(TraceHeader), TracePlaybackMode::kUntilEnd,
+            true);
+}
+
 void TracePlayer::WaitOnPlayback() {
   xe::threading::Wait(playback_event_.get(), true);
 }
@@ -239,6 +256,11 @@ void TracePlayer::PlayTraceOnThread(const uint8_t* trace_data,
             cmd->rw_component);
         break;
       }
+      case TraceCommandType::kFrameIndex: {
+        // Ends the trace.
+        trace_ptr = trace_end;
+        break;
+      }
     }
   }
 
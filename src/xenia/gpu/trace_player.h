@@ -42,7 +42,13 @@ class TracePlayer : public TraceReader {
   uint32_t playback_percent() const { return playback_percent_; }
 
   void SeekFrame(int target_frame);
+  // Plays the frame back from its beginning even if it's the current one,
+  // without clearing the caches.
+  void PlayFrame(int target_frame);
   void SeekCommand(int target_command);
+  // Plays the whole trace back from the beginning, leaving the last frame as
+  // the current one.
+  void PlayAllFrames();
 
   void WaitOnPlayback();
 
@@ -23,7 +23,10 @@ static const char kTraceExtension[] = "xtr";
 // Other changes besides the file format may require bumps, such as
 // anything that changes what is recorded into the files (new GPU
 // command processor commands, etc).
-constexpr uint32_t kTraceFormatVersion = 1;
+constexpr uint32_t kTraceFormatVersion = 2;
+// Version 2 only appends the frame index to version 1, so version 1 traces can
+// still be read, without the index.
+constexpr uint32_t kTraceFormatVersionWithoutFrameIndex = 1;
 
 // Trace file header identifying information about the trace.
 // This must be positioned at the start of the file and must only occur once.
@@ -55,6 +58,7 @@ enum class TraceCommandType : uint32_t {
   kEvent,
   kRegisters,
   kGammaRamp,
+  kFrameIndex,
 };
 
 struct PrimaryBufferStartCommand {
@@ -170,6 +174,25 @@ struct GammaRampCommand {
   uint32_t encoded_length;
 };
 
+// Offsets of the starts of all frames in the trace file, so the frames don't
+// have to be located by scanning the whole trace when it's opened. Written when
+// the trace is closed, must be the last command in the file, and nothing is
+// played back after it. Followed by frame_count uint64_t offsets from the
+// beginning of the file (possibly unaligned), and by the FrameIndexFooter
+// ending the file.
+struct FrameIndexCommand {
+  TraceCommandType type;
+  uint32_t frame_count;
+};
+
+struct FrameIndexFooter {
+  static constexpr uint32_t kMagic = 0x49525458;  // 'XTRI'.
+
+  uint32_t magic;
+  // Same as in the FrameIndexCommand, for locating it from the end.
+  uint32_t frame_count;
+};
+
 }  // namespace gpu
 }  // namespace xe
 
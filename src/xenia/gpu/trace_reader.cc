@@ -10,6 +10,8 @@
 #include "xenia/gpu/trace_reader.h"
 
 #include <cinttypes>
+#include <cstring>
+#include <memory>
 
 #include "third_party/snappy/snappy.h"
 #include "xenia/base/filesystem.h"
@@ -46,7 +48,8 @@ bool TraceReader::Open(const std::string_view path) {
 
   // Verify version.
   auto header = reinterpret_cast<const TraceHeader*>(trace_data_);
-  if (header->version != kTraceFormatVersion) {
+  if (header->version != kTraceFormatVersion &&
+      header->version != kTraceFormatVersionWithoutFrameIndex) {
     XELOGE("Trace format version mismatch, code has {}, file has {}",
            kTraceFormatVersion, header->version);
     if (header->version < kTraceFormatVersion) {
@@ -62,21 +65,101 @@ bool TraceReader::Open(const std::string_view path) {
   XELOGI("    Commit: {}", commit_str);
   XELOGI("  Title ID: {}", header->title_id);
 
-  ParseTrace();
+  if (header->version == kTraceFormatVersionWithoutFrameIndex ||
+      !ParseFrameIndex()) {
+    ParseTrace();
+  }
 
   return true;
 }
 
+const TraceReader::Frame* TraceReader::frame(int n) const {
+  Frame& frame = frames_[n];
+  if (!frame.commands_parsed) {
+    std::vector<Frame> parsed_frames;
+    ParseFrames(frame.start_ptr, frame.end_ptr, parsed_frames);
+    // Exactly one frame is expected between the indexed offsets.
+    if (!parsed_frames.empty()) {
+      Frame& parsed_frame = parsed_frames.front();
+      frame.command_count = parsed_frame.command_count;
+      frame.commands = std::move(parsed_frame.commands);
+      frame.command_tree = std::move(parsed_frame.command_tree);
+    }
+    if (!frame.command_tree) {
+      frame.command_tree = std::make_unique<CommandBuffer>();
+    }
+    frame.commands_parsed = true;
+  }
+  return &frame;
+}
+
 void TraceReader::Close() {
   mmap_.reset();
   trace_data_ = nullptr;
   trace_size_ = 0;
+  frames_.clear();
+}
+
+bool TraceReader::ParseFrameIndex() {
+  if (trace_size_ <
+      sizeof(TraceHeader) + sizeof(FrameIndexCommand) +
+          sizeof(FrameIndexFooter)) {
+    return false;
+  }
+  FrameIndexFooter footer;
+  std::memcpy(&footer, trace_data_ + trace_size_ - sizeof(footer),
+              sizeof(footer));
+  if (footer.magic != FrameIndexFooter::kMagic) {
+    return false;
+  }
+  size_t index_size = sizeof(FrameIndexCommand) +
+                      sizeof(uint64_t) * footer.frame_count + sizeof(footer);
+  if (index_size > trace_size_ - sizeof(TraceHeader)) {
+    return false;
+  }
+  size_t index_offset = trace_size_ - index_size;
+  FrameIndexCommand cmd;
+  std::memcpy(&cmd, trace_data_ + index_offset, sizeof(cmd));
+  if (cmd.type != TraceCommandType::kFrameIndex ||
+      cmd.frame_count != footer.frame_count) {
+    return false;
+  }
+  const uint8_t* frame_offsets_ptr = trace_data_ + index_offset + sizeof(cmd);
+  frames_.resize(footer.frame_count);
+  uint64_t previous_frame_offset = sizeof(TraceHeader);
+  for (uint32_t i = 0; i < footer.frame_count; ++i) {
+    uint64_t frame_offset;
+    std::memcpy(&frame_offset, frame_offsets_ptr + sizeof(uint64_t) * i,
+                sizeof(frame_offset));
+    if (frame_offset < previous_frame_offset || frame_offset >= index_offset ||
+        (!i && frame_offset != sizeof(TraceHeader))) {
+      frames_.clear();
+      return false;
+    }
+    Frame& frame = frames_[i];
+    frame.start_ptr = trace_data_ + frame_offset;
+    if (i) {
+      frames_[i - 1].end_ptr = frame.start_ptr;
+    }
+    frame.commands_parsed = false;
+    previous_frame_offset = frame_offset;
+  }
+  if (!frames_.empty()) {
+    frames_.back().end_ptr = trace_data_ + index_offset;
+  }
+  return true;
 }
 
 void TraceReader::ParseTrace() {
   // Skip file header.
-  auto trace_ptr = trace_data_;
-  trace_ptr += sizeof(TraceHeader);
+  ParseFrames(trace_data_ + sizeof(TraceHeader), trace_data_ + trace_size_,
+              frames_);
+}
+
+void TraceReader::ParseFrames(const uint8_t* trace_start,
+                              const uint8_t* trace_end,
+                              std::vector<Frame>& frames_out) {
+  auto trace_ptr = trace_start;
 
   Frame current_frame;
   current_frame.start_ptr = trace_ptr;
@@ -88,7 +171,7 @@ void TraceReader::ParseTrace() {
   current_frame.command_tree =
       std::unique_ptr<CommandBuffer>(current_command_buffer);
 
-  while (trace_ptr < trace_data_ + trace_size_) {
+  while (trace_ptr < trace_end) {
     ++current_frame.command_count;
     auto type = static_cast<TraceCommandType>(xe::load<uint32_t>(trace_ptr));
     switch (type) {
@@ -178,7 +261,7 @@ void TraceReader::ParseTrace() {
         }
         if (pending_break) {
           current_frame.end_ptr = trace_ptr;
-          frames_.push_back(std::move(current_frame));
+          frames_out.push_back(std::move(current_frame));
           current_command_buffer = new CommandBuffer();
           current_frame.command_tree =
               std::unique_ptr<CommandBuffer>(current_command_buffer);
@@ -225,6 +308,12 @@ void TraceReader::ParseTrace() {
         trace_ptr += sizeof(*cmd) + cmd->encoded_length;
         break;
       }
+      case TraceCommandType::kFrameIndex: {
+        // Ends the trace.
+        --current_frame.command_count;
+        trace_end = trace_ptr;
+        break;
+      }
       default:
         // Broken trace file?
         assert_unhandled_case(type);
@@ -233,7 +322,7 @@ void TraceReader::ParseTrace() {
   }
   if (pending_break || current_frame.command_count) {
     current_frame.end_ptr = trace_ptr;
-    frames_.push_back(std::move(current_frame));
+    frames_out.push_back(std::move(current_frame));
   }
 }
 
@@ -81,6 +81,9 @@ class TraceReader {
     const uint8_t* start_ptr = nullptr;
     const uint8_t* end_ptr = nullptr;
     int command_count = 0;
+    // If the frame has been located using the frame index, the commands are
+    // parsed when the frame is accessed for the first time.
+    bool commands_parsed = true;
 
     // Flat list of all commands in this frame.
     std::vector<Command> commands;
@@ -96,7 +99,7 @@ class TraceReader {
     return reinterpret_cast<const TraceHeader*>(trace_data_);
   }
 
-  const Frame* frame(int n) const { return &frames_[n]; }
+  const Frame* frame(int n) const;
   int frame_count() const { return int(frames_.size()); }
 
   bool Open(const std::string_view path);
@@ -104,14 +107,22 @@ class TraceReader {
   void Close();
 
  protected:
+  // Locates the frames using the frame index at the end of the trace if it's
+  // present, returns false if the index is not available or not valid.
+  bool ParseFrameIndex();
   void ParseTrace();
+  // Appends the frames between the pointers, assuming that the first one
+  // starts at trace_start.
+  static void ParseFrames(const uint8_t* trace_start, const uint8_t* trace_end,
+                          std::vector<Frame>& frames_out);
   bool DecompressMemory(MemoryEncodingFormat encoding_format, const void* src,
                         size_t src_size, void* dest, size_t dest_size);
 
   std::unique_ptr<MappedMemory> mmap_;
   const uint8_t* trace_data_ = nullptr;
   size_t trace_size_ = 0;
-  std::vector<Frame> frames_;
+  // Mutable for parsing the commands of the frames lazily.
+  mutable std::vector<Frame> frames_;
 };
 
 }  // namespace gpu
@@ -11,8 +11,8 @@
 
 #include <cstring>
 #include <memory>
+#include <utility>
 
-#include "third_party/snappy/snappy-sinksource.h"
 #include "third_party/snappy/snappy.h"
 
 #include "build/version.h"
@@ -20,6 +20,7 @@
 #include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/string.h"
+#include "xenia/base/xxhash.h"
 #include "xenia/gpu/registers.h"
 #include "xenia/gpu/xenos.h"
 
@@ -29,7 +30,7 @@ namespace gpu {
 TraceWriter::TraceWriter(uint8_t* membase)
     : membase_(membase), file_(nullptr) {}
 
-TraceWriter::~TraceWriter() = default;
+TraceWriter::~TraceWriter() { Close(); }
 
 bool TraceWriter::Open(const std::filesystem::path& path, uint32_t title_id) {
   Close();
@@ -46,35 +47,144 @@ bool TraceWriter::Open(const std::filesystem::path& path, uint32_t title_id) {
   }
 
   // Write header first. Must be at the top of the file.
+  WriteHeader(file_, title_id);
+
+  file_offset_ = sizeof(TraceHeader);
+  frame_offsets_.clear();
+  frame_offsets_.push_back(sizeof(TraceHeader));
+
+  StartWriter();
+  return true;
+}
+
+bool TraceWriter::OpenRing(uint32_t title_id) {
+  Close();
+
+  ring_open_ = true;
+  ring_title_id_ = title_id;
+  ring_segments_.clear();
+
+  StartWriter();
+  current_chunk_->begins_ring_segment = true;
+  return true;
+}
+
+void TraceWriter::BeginRingSegment() {
+  if (!ring_open_) {
+    return;
+  }
+  SubmitChunk(false);
+  current_chunk_->begins_ring_segment = true;
+  // The segment must be self-contained.
+  cached_memory_reads_.clear();
+  frame_memory_read_hashes_.clear();
+  packet_written_ = false;
+  frame_break_pending_ = false;
+}
+
+bool TraceWriter::DumpRing(const std::filesystem::path& path) {
+  if (!ring_open_) {
+    return false;
+  }
+  // After this, the writer thread doesn't access the segments until the next
+  // chunk is submitted.
+  SubmitChunk(false);
+  AwaitChunkWrites();
+
+  auto canonical_path = std::filesystem::absolute(path);
+  if (canonical_path.has_parent_path()) {
+    auto base_path = canonical_path.parent_path();
+    std::filesystem::create_directories(base_path);
+  }
+  FILE* file = xe::filesystem::OpenFile(canonical_path, "wb");
+  if (!file) {
+    return false;
+  }
+  WriteHeader(file, ring_title_id_);
+  uint64_t offset = sizeof(TraceHeader);
+  std::vector<uint64_t> frame_offsets;
+  for (const RingSegment& segment : ring_segments_) {
+    for (uint64_t frame_offset : segment.frame_offsets) {
+      frame_offsets.push_back(offset + frame_offset);
+    }
+    fwrite(segment.data.data(), 1, segment.data.size(), file);
+    offset += segment.data.size();
+  }
+  WriteFrameIndex(file, frame_offsets, offset);
+  fclose(file);
+  return true;
+}
+
+void TraceWriter::WriteHeader(FILE* file, uint32_t title_id) {
   TraceHeader header;
   header.version = kTraceFormatVersion;
   std::memcpy(header.build_commit_sha, XE_BUILD_COMMIT,
               sizeof(header.build_commit_sha));
   header.title_id = title_id;
-  fwrite(&header, sizeof(header), 1, file_);
+  fwrite(&header, sizeof(header), 1, file);
+}
 
+void TraceWriter::StartWriter() {
   cached_memory_reads_.clear();
-  return true;
+  frame_memory_read_hashes_.clear();
+  packet_written_ = false;
+  frame_break_pending_ = false;
+
+  if (!current_chunk_) {
+    current_chunk_ = std::make_unique<Chunk>();
+  }
+  current_chunk_->Reset();
+  writer_shutdown_ = false;
+  writer_thread_ =
+      xe::threading::Thread::Create({}, [this]() { WriterThread(); });
+  assert_not_null(writer_thread_);
+  writer_thread_->set_name("GPU Trace Writer");
 }
 
 void TraceWriter::Flush() {
-  if (file_) {
-    fflush(file_);
+  if (is_open()) {
+    SubmitChunk(true);
   }
 }
 
 void TraceWriter::Close() {
-  if (file_) {
-    cached_memory_reads_.clear();
+  if (!is_open()) {
+    return;
+  }
+
+  cached_memory_reads_.clear();
+  frame_memory_read_hashes_.clear();
+
+  SubmitChunk(false);
+  AwaitChunkWrites();
+  {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    writer_shutdown_ = true;
+  }
+  writer_request_cond_.notify_all();
+  xe::threading::Wait(writer_thread_.get(), false);
+  writer_thread_.reset();
+  for (std::unique_ptr<Chunk>& chunk : writer_chunks_written_) {
+    free_chunks_.push_back(std::move(chunk));
+  }
+  writer_chunks_written_.clear();
 
-    fflush(file_);
-    fclose(file_);
-    file_ = nullptr;
+  if (ring_open_) {
+    ring_segments_.clear();
+    ring_open_ = false;
+    return;
   }
+
+  WriteFrameIndex(file_, frame_offsets_, file_offset_);
+  frame_offsets_.clear();
+
+  fflush(file_);
+  fclose(file_);
+  file_ = nullptr;
 }
 
 void TraceWriter::WritePrimaryBufferStart(uint32_t base_ptr, uint32_t count) {
-  if (!file_) {
+  if (!is_open()) {
     return;
   }
   PrimaryBufferStartCommand cmd = {
@@ -82,21 +192,21 @@ void TraceWriter::WritePrimaryBufferStart(uint32_t base_ptr, uint32_t count) {
       base_ptr,
       0,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  Append(&cmd, sizeof(cmd));
 }
 
 void TraceWriter::WritePrimaryBufferEnd() {
-  if (!file_) {
+  if (!is_open()) {
     return;
   }
   PrimaryBufferEndCommand cmd = {
       TraceCommandType::kPrimaryBufferEnd,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  Append(&cmd, sizeof(cmd));
 }
 
 void TraceWriter::WriteIndirectBufferStart(uint32_t base_ptr, uint32_t count) {
-  if (!file_) {
+  if (!is_open()) {
     return;
   }
   IndirectBufferStartCommand cmd = {
@@ -104,21 +214,21 @@ void TraceWriter::WriteIndirectBufferStart(uint32_t base_ptr, uint32_t count) {
       base_ptr,
       0,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  Append(&cmd, sizeof(cmd));
 }
 
 void TraceWriter::WriteIndirectBufferEnd() {
-  if (!file_) {
+  if (!is_open()) {
     return;
   }
   IndirectBufferEndCommand cmd = {
       TraceCommandType::kIndirectBufferEnd,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  Append(&cmd, sizeof(cmd));
 }
 
 void TraceWriter::WritePacketStart(uint32_t base_ptr, uint32_t count) {
-  if (!file_) {
+  if (!is_open()) {
     return;
   }
   PacketStartCommand cmd = {
@@ -126,30 +236,35 @@ void TraceWriter::WritePacketStart(uint32_t base_ptr, uint32_t count) {
       base_ptr,
       count,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
-  fwrite(membase_ + base_ptr, 4, count, file_);
+  Append(&cmd, sizeof(cmd));
+  Append(membase_ + base_ptr, sizeof(uint32_t) * count);
+  packet_written_ = true;
 }
 
 void TraceWriter::WritePacketEnd() {
-  if (!file_) {
+  if (!is_open()) {
     return;
   }
   PacketEndCommand cmd = {
       TraceCommandType::kPacketEnd,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  Append(&cmd, sizeof(cmd));
+  if (frame_break_pending_ && packet_written_) {
+    current_chunk_->frame_offsets.push_back(current_chunk_->data.size());
+    frame_break_pending_ = false;
+  }
 }
 
 void TraceWriter::WriteMemoryRead(uint32_t base_ptr, size_t length,
                                   const void* host_ptr) {
-  if (!file_) {
+  if (!is_open()) {
     return;
   }
   WriteMemoryCommand(TraceCommandType::kMemoryRead, base_ptr, length, host_ptr);
 }
 
 void TraceWriter::WriteMemoryReadCached(uint32_t base_ptr, size_t length) {
-  if (!file_) {
+  if (!is_open()) {
     return;
   }
 
@@ -162,7 +277,7 @@ void TraceWriter::WriteMemoryReadCached(uint32_t base_ptr, size_t length) {
 }
 
 void TraceWriter::WriteMemoryReadCachedNop(uint32_t base_ptr, size_t length) {
-  if (!file_) {
+  if (!is_open()) {
     return;
   }
 
@@ -175,110 +290,85 @@ void TraceWriter::WriteMemoryReadCachedNop(uint32_t base_ptr, size_t length) {
 
 void TraceWriter::WriteMemoryWrite(uint32_t base_ptr, size_t length,
                                    const void* host_ptr) {
-  if (!file_) {
+  if (!is_open()) {
     return;
   }
   WriteMemoryCommand(TraceCommandType::kMemoryWrite, base_ptr, length,
                      host_ptr);
 }
 
-class SnappySink : public snappy::Sink {
- public:
-  SnappySink(FILE* file) : file_(file) {}
-
-  void Append(const char* bytes, size_t n) override {
-    fwrite(bytes, 1, n, file_);
-  }
-
- private:
-  FILE* file_ = nullptr;
-};
-
 void TraceWriter::WriteMemoryCommand(TraceCommandType type, uint32_t base_ptr,
                                      size_t length, const void* host_ptr) {
-  MemoryCommand cmd = {};
-  cmd.type = type;
-  cmd.base_ptr = base_ptr;
-  cmd.encoding_format = MemoryEncodingFormat::kNone;
-  cmd.encoded_length = cmd.decoded_length = static_cast<uint32_t>(length);
-
   if (!host_ptr) {
-    host_ptr = membase_ + cmd.base_ptr;
+    host_ptr = membase_ + base_ptr;
   }
 
   bool compress = compress_output_ && length > compression_threshold_;
-  if (compress) {
-    // Write the header now so we reserve space in the buffer.
-    long header_position = std::ftell(file_);
-    cmd.encoding_format = MemoryEncodingFormat::kSnappy;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-
-    // Stream the content right to the buffer.
-    snappy::ByteArraySource snappy_source(
-        reinterpret_cast<const char*>(host_ptr), cmd.decoded_length);
-    SnappySink snappy_sink(file_);
-    cmd.encoded_length =
-        static_cast<uint32_t>(snappy::Compress(&snappy_source, &snappy_sink));
-
-    // Seek back and overwrite the header with our final size.
-    std::fseek(file_, header_position, SEEK_SET);
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    std::fseek(file_, header_position + sizeof(cmd) + cmd.encoded_length,
-               SEEK_SET);
+
+  if (type == TraceCommandType::kMemoryRead) {
+    // Only the large reads are worth hashing.
+    if (compress) {
+      // HACK: length is guaranteed to be within 32-bits (guest memory)
+      uint64_t key = uint64_t(base_ptr) << 32 | uint64_t(length);
+      uint64_t hash = XXH3_64bits(host_ptr, length);
+      auto it = frame_memory_read_hashes_.emplace(key, hash);
+      if (!it.second) {
+        if (it.first->second == hash) {
+          return;
+        }
+        it.first->second = hash;
+      }
+    }
   } else {
-    // Uncompressed - write buffer directly to the file.
-    cmd.encoding_format = MemoryEncodingFormat::kNone;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    fwrite(host_ptr, 1, cmd.decoded_length, file_);
+    frame_memory_read_hashes_.clear();
   }
+
+  MemoryCommand cmd = {};
+  cmd.type = type;
+  cmd.base_ptr = base_ptr;
+  cmd.encoding_format =
+      compress ? MemoryEncodingFormat::kSnappy : MemoryEncodingFormat::kNone;
+  cmd.encoded_length = cmd.decoded_length = static_cast<uint32_t>(length);
+  AppendEncoded(&cmd, sizeof(cmd), offsetof(MemoryCommand, encoded_length),
+                compress, host_ptr, length);
 }
 
 void TraceWriter::WriteEdramSnapshot(const void* snapshot) {
+  if (!is_open()) {
+    return;
+  }
   EdramSnapshotCommand cmd = {};
   cmd.type = TraceCommandType::kEdramSnapshot;
-
-  if (compress_output_) {
-    // Write the header now so we reserve space in the buffer.
-    long header_position = std::ftell(file_);
-    cmd.encoding_format = MemoryEncodingFormat::kSnappy;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-
-    // Stream the content right to the buffer.
-    snappy::ByteArraySource snappy_source(
-        reinterpret_cast<const char*>(snapshot), xenos::kEdramSizeBytes);
-    SnappySink snappy_sink(file_);
-    cmd.encoded_length =
-        static_cast<uint32_t>(snappy::Compress(&snappy_source, &snappy_sink));
-
-    // Seek back and overwrite the header with our final size.
-    std::fseek(file_, header_position, SEEK_SET);
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    std::fseek(file_, header_position + sizeof(cmd) + cmd.encoded_length,
-               SEEK_SET);
-  } else {
-    // Uncompressed - write buffer directly to the file.
-    cmd.encoding_format = MemoryEncodingFormat::kNone;
-    cmd.encoded_length = xenos::kEdramSizeBytes;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    fwrite(snapshot, 1, xenos::kEdramSizeBytes, file_);
-  }
+  cmd.encoding_format = compress_output_ ? MemoryEncodingFormat::kSnappy
+                                         : MemoryEncodingFormat::kNone;
+  cmd.encoded_length = xenos::kEdramSizeBytes;
+  AppendEncoded(&cmd, sizeof(cmd),
+                offsetof(EdramSnapshotCommand, encoded_length),
+                compress_output_, snapshot, xenos::kEdramSizeBytes);
 }
 
 void TraceWriter::WriteEvent(EventCommand::Type event_type) {
-  if (!file_) {
+  if (!is_open()) {
     return;
   }
   EventCommand cmd = {
       TraceCommandType::kEvent,
       event_type,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  Append(&cmd, sizeof(cmd));
+  if (event_type == EventCommand::Type::kSwap) {
+    frame_break_pending_ = true;
+    frame_memory_read_hashes_.clear();
+  }
 }
 
 void TraceWriter::WriteRegisters(uint32_t first_register,
                                  const uint32_t* register_values,
                                  uint32_t register_count,
                                  bool execute_callbacks_on_play) {
+  if (!is_open()) {
+    return;
+  }
   RegistersCommand cmd = {};
   cmd.type = TraceCommandType::kRegisters;
   cmd.first_register = first_register;
@@ -286,37 +376,20 @@ void TraceWriter::WriteRegisters(uint32_t first_register,
   cmd.execute_callbacks = execute_callbacks_on_play;
 
   uint32_t uncompressed_length = uint32_t(sizeof(uint32_t) * register_count);
-  if (compress_output_) {
-    // Write the header now so we reserve space in the buffer.
-    long header_position = std::ftell(file_);
-    cmd.encoding_format = MemoryEncodingFormat::kSnappy;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-
-    // Stream the content right to the buffer.
-    snappy::ByteArraySource snappy_source(
-        reinterpret_cast<const char*>(register_values), uncompressed_length);
-    SnappySink snappy_sink(file_);
-    cmd.encoded_length =
-        static_cast<uint32_t>(snappy::Compress(&snappy_source, &snappy_sink));
-
-    // Seek back and overwrite the header with our final size.
-    std::fseek(file_, header_position, SEEK_SET);
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    std::fseek(file_, header_position + sizeof(cmd) + cmd.encoded_length,
-               SEEK_SET);
-  } else {
-    // Uncompressed - write the values directly to the file.
-    cmd.encoding_format = MemoryEncodingFormat::kNone;
-    cmd.encoded_length = uncompressed_length;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    fwrite(register_values, 1, uncompressed_length, file_);
-  }
+  cmd.encoding_format = compress_output_ ? MemoryEncodingFormat::kSnappy
+                                         : MemoryEncodingFormat::kNone;
+  cmd.encoded_length = uncompressed_length;
+  AppendEncoded(&cmd, sizeof(cmd), offsetof(RegistersCommand, encoded_length),
+                compress_output_, register_values, uncompressed_length);
 }
 
 void TraceWriter::WriteGammaRamp(
     const reg::DC_LUT_30_COLOR* gamma_ramp_256_entry_table,
     const reg::DC_LUT_PWL_DATA* gamma_ramp_pwl_rgb,
     uint32_t gamma_ramp_rw_component) {
+  if (!is_open()) {
+    return;
+  }
   GammaRampCommand cmd = {};
   cmd.type = TraceCommandType::kGammaRamp;
   cmd.rw_component = uint8_t(gamma_ramp_rw_component);
@@ -327,40 +400,197 @@ void TraceWriter::WriteGammaRamp(
       sizeof(reg::DC_LUT_PWL_DATA) * 3 * 128;
   constexpr uint32_t kUncompressedLength =
       k256EntryTableUncompressedLength + kPWLUncompressedLength;
-  if (compress_output_) {
-    // Write the header now so we reserve space in the buffer.
-    long header_position = std::ftell(file_);
-    cmd.encoding_format = MemoryEncodingFormat::kSnappy;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
+  cmd.encoding_format = compress_output_ ? MemoryEncodingFormat::kSnappy
+                                         : MemoryEncodingFormat::kNone;
+  cmd.encoded_length = kUncompressedLength;
+  AppendEncoded(&cmd, sizeof(cmd), offsetof(GammaRampCommand, encoded_length),
+                compress_output_, gamma_ramp_256_entry_table,
+                k256EntryTableUncompressedLength, gamma_ramp_pwl_rgb,
+                kPWLUncompressedLength);
+}
+
+void TraceWriter::Append(const void* data, size_t size) {
+  std::vector<uint8_t>& chunk_data = current_chunk_->data;
+  const uint8_t* data_bytes = reinterpret_cast<const uint8_t*>(data);
+  chunk_data.insert(chunk_data.end(), data_bytes, data_bytes + size);
+}
+
+void TraceWriter::AppendEncoded(const void* header, size_t header_size,
+                                size_t encoded_length_offset, bool compress,
+                                const void* data, size_t data_length,
+                                const void* data_2, size_t data_2_length) {
+  size_t header_offset = current_chunk_->data.size();
+  Append(header, header_size);
+  size_t data_offset = current_chunk_->data.size();
+  Append(data, data_length);
+  if (data_2) {
+    Append(data_2, data_2_length);
+  }
+  if (compress) {
+    Chunk::CompressedRange& compressed_range =
+        current_chunk_->compressed_ranges.emplace_back();
+    compressed_range.encoded_length_offset =
+        header_offset + encoded_length_offset;
+    compressed_range.data_offset = data_offset;
+    compressed_range.data_length = data_length + data_2_length;
+  }
+  if (current_chunk_->data.size() >= kChunkSubmitSize) {
+    SubmitChunk(false);
+  }
+}
+
+void TraceWriter::SubmitChunk(bool flush_file) {
+  std::unique_ptr<Chunk> new_chunk;
+  {
+    std::unique_lock<std::mutex> lock(writer_mutex_);
+    while (writer_chunk_queue_.size() >= kMaxChunksQueued) {
+      writer_done_cond_.wait(lock);
+    }
+    if (!current_chunk_->data.empty()) {
+      writer_chunk_queue_.push_back(std::move(current_chunk_));
+    }
+    if (flush_file) {
+      writer_flush_file_ = true;
+    }
+    for (std::unique_ptr<Chunk>& chunk : writer_chunks_written_) {
+      free_chunks_.push_back(std::move(chunk));
+    }
+    writer_chunks_written_.clear();
+  }
+  writer_request_cond_.notify_one();
+  if (!current_chunk_) {
+    if (!free_chunks_.empty()) {
+      current_chunk_ = std::move(free_chunks_.back());
+      free_chunks_.pop_back();
+    } else {
+      current_chunk_ = std::make_unique<Chunk>();
+    }
+    current_chunk_->Reset();
+  }
+}
+
+void TraceWriter::AwaitChunkWrites() {
+  std::unique_lock<std::mutex> lock(writer_mutex_);
+  while (!writer_chunk_queue_.empty() || writer_busy_) {
+    writer_done_cond_.wait(lock);
+  }
+}
 
-    // Stream the content right to the buffer.
+void TraceWriter::WriterThread() {
+  while (true) {
+    std::unique_ptr<Chunk> chunk;
+    bool flush_file = false;
+    {
+      std::unique_lock<std::mutex> lock(writer_mutex_);
+      while (writer_chunk_queue_.empty() && !writer_flush_file_ &&
+             !writer_shutdown_) {
+        writer_request_cond_.wait(lock);
+      }
+      if (!writer_chunk_queue_.empty()) {
+        chunk = std::move(writer_chunk_queue_.front());
+        writer_chunk_queue_.pop_front();
+      } else if (writer_flush_file_) {
+        writer_flush_file_ = false;
+        flush_file = true;
+      } else {
+        // Shutting down with nothing left to write.
+        return;
+      }
+      writer_busy_ = true;
+    }
+    if (chunk) {
+      WriteChunk(*chunk);
+    }
+    if (flush_file && file_) {
+      fflush(file_);
+    }
     {
-      std::unique_ptr<char[]> gamma_ramps(new char[kUncompressedLength]);
-      std::memcpy(gamma_ramps.get(), gamma_ramp_256_entry_table,
-                  k256EntryTableUncompressedLength);
-      std::memcpy(gamma_ramps.get() + k256EntryTableUncompressedLength,
-                  gamma_ramp_pwl_rgb, kPWLUncompressedLength);
-      snappy::ByteArraySource snappy_source(gamma_ramps.get(),
-                                            kUncompressedLength);
-      SnappySink snappy_sink(file_);
-      cmd.encoded_length =
-          static_cast<uint32_t>(snappy::Compress(&snappy_source, &snappy_sink));
+      std::lock_guard<std::mutex> lock(writer_mutex_);
+      if (chunk) {
+        writer_chunks_written_.push_back(std::move(chunk));
+      }
+      writer_busy_ = false;
+    }
+    writer_done_cond_.notify_all();
+  }
+}
+
+void TraceWriter::WriteChunk(Chunk& chunk) {
+  if (chunk.begins_ring_segment) {
+    // Reuse the memory of the oldest segment if dropping it.
+    RingSegment segment;
+    if (ring_segments_.size() >= kRingSegmentsRetained) {
+      segment = std::move(ring_segments_.front());
+      ring_segments_.pop_front();
+      segment.data.clear();
+      segment.frame_offsets.clear();
+    }
+    segment.frame_offsets.push_back(0);
+    ring_segments_.push_back(std::move(segment));
+    file_offset_ = 0;
+  }
+  std::vector<uint64_t>& frame_offsets =
+      ring_open_ ? ring_segments_.back().frame_offsets : frame_offsets_;
+
+  std::string compressed;
+  size_t chunk_offset = 0;
+  auto frame_offset_it = chunk.frame_offsets.cbegin();
+  auto write_uncompressed = [&](size_t end) {
+    // Locate the frames in the part of the chunk written as is.
+    for (; frame_offset_it != chunk.frame_offsets.cend() &&
+           *frame_offset_it <= end;
+         ++frame_offset_it) {
+      frame_offsets.push_back(file_offset_ + (*frame_offset_it - chunk_offset));
     }
+    Output(chunk.data.data() + chunk_offset, end - chunk_offset);
+    chunk_offset = end;
+  };
+  for (const Chunk::CompressedRange& compressed_range :
+       chunk.compressed_ranges) {
+    snappy::Compress(
+        reinterpret_cast<const char*>(chunk.data.data() +
+                                      compressed_range.data_offset),
+        compressed_range.data_length, &compressed);
+    uint32_t encoded_length = uint32_t(compressed.size());
+    std::memcpy(chunk.data.data() + compressed_range.encoded_length_offset,
+                &encoded_length, sizeof(encoded_length));
+    write_uncompressed(compressed_range.data_offset);
+    Output(compressed.data(), compressed.size());
+    chunk_offset =
+        compressed_range.data_offset + compressed_range.data_length;
+  }
+  write_uncompressed(chunk.data.size());
+}
 
-    // Seek back and overwrite the header with our final size.
-    std::fseek(file_, header_position, SEEK_SET);
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    std::fseek(file_, header_position + sizeof(cmd) + cmd.encoded_length,
-               SEEK_SET);
+void TraceWriter::Output(const void* data, size_t size) {
+  if (file_) {
+    fwrite(data, 1, size, file_);
   } else {
-    // Uncompressed - write the values directly to the file.
-    cmd.encoding_format = MemoryEncodingFormat::kNone;
-    cmd.encoded_length = kUncompressedLength;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    fwrite(gamma_ramp_256_entry_table, 1, k256EntryTableUncompressedLength,
-           file_);
-    fwrite(gamma_ramp_pwl_rgb, 1, kPWLUncompressedLength, file_);
+    std::vector<uint8_t>& segment_data = ring_segments_.back().data;
+    const uint8_t* data_bytes = reinterpret_cast<const uint8_t*>(data);
+    segment_data.insert(segment_data.end(), data_bytes, data_bytes + size);
+  }
+  file_offset_ += size;
+}
+
+void TraceWriter::WriteFrameIndex(FILE* file,
+                                  std::vector<uint64_t>& frame_offsets,
+                                  uint64_t index_offset) {
+  // The last frame is not empty if anything has been written after its start.
+  if (!frame_offsets.empty() && frame_offsets.back() >= index_offset) {
+    frame_offsets.pop_back();
   }
+  FrameIndexCommand cmd = {
+      TraceCommandType::kFrameIndex,
+      uint32_t(frame_offsets.size()),
+  };
+  fwrite(&cmd, 1, sizeof(cmd), file);
+  fwrite(frame_offsets.data(), sizeof(uint64_t), frame_offsets.size(), file);
+  FrameIndexFooter footer = {
+      FrameIndexFooter::kMagic,
+      cmd.frame_count,
+  };
+  fwrite(&footer, 1, sizeof(footer), file);
 }
 
 }  //  namespace gpu
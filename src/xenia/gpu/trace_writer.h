@@ -10,10 +10,19 @@
 #ifndef XENIA_GPU_TRACE_WRITER_H_
 #define XENIA_GPU_TRACE_WRITER_H_
 
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
+#include "xenia/base/threading.h"
 #include "xenia/gpu/registers.h"
 #include "xenia/gpu/trace_protocol.h"
 
@@ -25,9 +34,20 @@ class TraceWriter {
   explicit TraceWriter(uint8_t* membase);
   ~TraceWriter();
 
-  bool is_open() const { return file_ != nullptr; }
+  bool is_open() const { return file_ != nullptr || ring_open_; }
 
   bool Open(const std::filesystem::path& path, uint32_t title_id);
+  // Opens for keeping the latest frames in memory, to be written to a file
+  // only on request, instead of writing everything to a file. The frames are
+  // kept in segments, each beginning with the initial state written after
+  // OpenRing or BeginRingSegment, so the frames can be played back without the
+  // preceding ones, and the latest two segments are retained.
+  bool OpenRing(uint32_t title_id);
+  // Must be called at the beginning of a frame, followed by writing the initial
+  // state as after opening.
+  void BeginRingSegment();
+  // Writes the frames currently retained in the ring to a trace file.
+  bool DumpRing(const std::filesystem::path& path);
   void Flush();
   void Close();
 
@@ -52,12 +72,104 @@ class TraceWriter {
                       uint32_t gamma_ramp_rw_component);
 
  private:
+  // Commands are gathered in chunks on the calling thread, and the chunks are
+  // compressed and written to the file on the writer thread, so the calling
+  // thread only copies the data.
+  struct Chunk {
+    // A compressed command - the header with the encoded length to set, and
+    // the data to compress after it.
+    struct CompressedRange {
+      size_t encoded_length_offset;
+      size_t data_offset;
+      size_t data_length;
+    };
+    std::vector<uint8_t> data;
+    std::vector<CompressedRange> compressed_ranges;
+    // Offsets in the data, not inside compressed ranges, where frames start.
+    std::vector<size_t> frame_offsets;
+    // For the ring, whether a new segment starts with this chunk.
+    bool begins_ring_segment = false;
+
+    void Reset() {
+      data.clear();
+      compressed_ranges.clear();
+      frame_offsets.clear();
+      begins_ring_segment = false;
+    }
+  };
+  struct RingSegment {
+    std::vector<uint8_t> data;
+    // Offsets in the data where frames start.
+    std::vector<uint64_t> frame_offsets;
+  };
+  // The chunk is submitted to the writer thread after growing beyond this
+  // size, and the calling thread waits if the writer thread is that many
+  // chunks behind.
+  static constexpr size_t kChunkSubmitSize = 8 * 1024 * 1024;
+  static constexpr size_t kMaxChunksQueued = 2;
+
+  void WriteHeader(FILE* file, uint32_t title_id);
+  // Resets the per-trace state and starts the writer thread.
+  void StartWriter();
+
+  void Append(const void* data, size_t size);
+  // Appends the header and the data, with the data to be compressed on the
+  // writer thread if needed, and the encoded length of the command at
+  // encoded_length_offset in the header set accordingly then. If data_2 is not
+  // null, it's encoded together with data as one block.
+  void AppendEncoded(const void* header, size_t header_size,
+                     size_t encoded_length_offset, bool compress,
+                     const void* data, size_t data_length,
+                     const void* data_2 = nullptr, size_t data_2_length = 0);
+  void SubmitChunk(bool flush_file);
+  // Waits until all submitted chunks have been written.
+  void AwaitChunkWrites();
+  void WriterThread();
+  void WriteChunk(Chunk& chunk);
+  // Writer thread - writes to the file, or to the latest ring segment.
+  void Output(const void* data, size_t size);
+
   void WriteMemoryCommand(TraceCommandType type, uint32_t base_ptr,
                           size_t length, const void* host_ptr = nullptr);
+  static void WriteFrameIndex(FILE* file, std::vector<uint64_t>& frame_offsets,
+                              uint64_t index_offset);
 
   std::set<uint64_t> cached_memory_reads_;
+  // Hashes of the data of the memory reads done during the current frame, by
+  // the address and the length, to skip the reads of the same unchanged data
+  // again (such as indices of multiple draws). Reset on swaps and memory
+  // writes so playback doesn't miss any data between different contents.
+  std::unordered_map<uint64_t, uint64_t> frame_memory_read_hashes_;
   uint8_t* membase_;
   FILE* file_;
+  bool ring_open_ = false;
+  uint32_t ring_title_id_ = 0;
+
+  bool packet_written_ = false;
+  bool frame_break_pending_ = false;
+
+  std::unique_ptr<Chunk> current_chunk_;
+  std::vector<std::unique_ptr<Chunk>> free_chunks_;
+
+  std::mutex writer_mutex_;
+  std::condition_variable writer_request_cond_;
+  std::condition_variable writer_done_cond_;
+  // Protected by writer_mutex_.
+  std::deque<std::unique_ptr<Chunk>> writer_chunk_queue_;
+  std::vector<std::unique_ptr<Chunk>> writer_chunks_written_;
+  bool writer_flush_file_ = false;
+  bool writer_busy_ = false;
+  bool writer_shutdown_ = false;
+  std::unique_ptr<xe::threading::Thread> writer_thread_;
+
+  // Owned by the writer thread while it's running. For the ring, the offset
+  // is within the latest segment.
+  uint64_t file_offset_ = 0;
+  // Offsets of the starts of the frames for the frame index. A frame ends at
+  // the end of the first packet after a swap, as in TraceReader.
+  std::vector<uint64_t> frame_offsets_;
+  static constexpr size_t kRingSegmentsRetained = 2;
+  std::deque<RingSegment> ring_segments_;
 
   bool compress_output_ = true;
   size_t compression_threshold_ = 1024;  // Min. number of bytes to compress.
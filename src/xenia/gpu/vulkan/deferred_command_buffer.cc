@@ -9,14 +9,19 @@
 
 #include "xenia/gpu/vulkan/deferred_command_buffer.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <iterator>
 
+#include "third_party/fmt/include/fmt/format.h"
 #include "xenia/base/assert.h"
+#include "xenia/base/logging.h"
 #include "xenia/base/math.h"
 #include "xenia/base/profiling.h"
 #include "xenia/gpu/vulkan/vulkan_command_processor.h"
+#include "xenia/gpu/vulkan/vulkan_pipeline_cache.h"
 
 namespace xe {
 namespace gpu {
@@ -28,17 +33,117 @@ DeferredCommandBuffer::DeferredCommandBuffer(
   command_stream_.reserve(initial_size / sizeof(uintmax_t));
 }
 
+DeferredCommandBuffer::~DeferredCommandBuffer() {
+  ShutdownRecordingThreads();
+}
+
+void DeferredCommandBuffer::InitializeRecordingThreads(uint32_t thread_count) {
+  ShutdownRecordingThreads();
+  if (!thread_count) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(recording_mutex_);
+    recording_threads_shutdown_ = false;
+  }
+  recording_thread_count_ = thread_count;
+  for (uint32_t i = 0; i < thread_count; ++i) {
+    std::unique_ptr<xe::threading::Thread> recording_thread =
+        xe::threading::Thread::Create({}, [this, i]() { RecordingThread(i); });
+    assert_not_null(recording_thread);
+    recording_thread->set_name(fmt::format("Vulkan Command Recording {}", i));
+    recording_threads_.push_back(std::move(recording_thread));
+  }
+}
+
+void DeferredCommandBuffer::ShutdownRecordingThreads() {
+  if (recording_threads_.empty()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(recording_mutex_);
+    recording_threads_shutdown_ = true;
+  }
+  recording_request_cond_.notify_all();
+  for (size_t i = 0; i < recording_threads_.size(); ++i) {
+    xe::threading::Wait(recording_threads_[i].get(), false);
+  }
+  recording_threads_.clear();
+  recording_thread_count_ = 0;
+}
+
 void DeferredCommandBuffer::Reset() { command_stream_.clear(); }
 
-void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer) {
+void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer,
+                                    SecondaryCommandPool* secondary_pools) {
 #if XE_UI_VULKAN_FINE_GRAINED_DRAW_SCOPES
   SCOPE_profile_cpu_f("gpu");
 #endif  // XE_UI_VULKAN_FINE_GRAINED_DRAW_SCOPES
 
+  if (!secondary_pools || !recording_thread_count_ ||
+      !PrepareParallelRenderPasses()) {
+    ExecuteRange(command_buffer, 0, command_stream_.size());
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(recording_mutex_);
+    recording_pools_ = secondary_pools;
+    recording_render_pass_count_ = parallel_render_passes_.size();
+    ++recording_generation_;
+  }
+  recording_request_cond_.notify_all();
+
+  const ui::vulkan::VulkanProvider::DeviceFunctions& dfn =
+      command_processor_.GetVulkanProvider().dfn();
+  size_t offset = 0;
+  for (size_t i = 0; i < parallel_render_passes_.size(); ++i) {
+    const ParallelRenderPass& pass = parallel_render_passes_[i];
+    // Everything between the render passes recorded in parallel.
+    ExecuteRange(command_buffer, offset, pass.begin_offset - offset);
+    VkCommandBuffer secondary_command_buffer;
+    {
+      std::unique_lock<std::mutex> lock(recording_mutex_);
+      recording_completion_cond_.wait(lock, [&pass]() {
+        return pass.recorded;
+      });
+      secondary_command_buffer = pass.secondary_command_buffer;
+    }
+    const CommandHeader& end_header = *reinterpret_cast<const CommandHeader*>(
+        command_stream_.data() + pass.end_offset);
+    size_t pass_end = pass.end_offset + kCommandHeaderSizeElements +
+                      end_header.arguments_size_elements;
+    if (secondary_command_buffer != VK_NULL_HANDLE) {
+      ExecuteBeginRenderPass(
+          command_buffer,
+          *reinterpret_cast<const ArgsVkBeginRenderPass*>(
+              command_stream_.data() + pass.begin_offset +
+              kCommandHeaderSizeElements),
+          VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+      dfn.vkCmdExecuteCommands(command_buffer, 1, &secondary_command_buffer);
+      dfn.vkCmdEndRenderPass(command_buffer);
+      // The state of the primary command buffer is undefined after executing
+      // secondary command buffers.
+      ExecuteStateCommands(command_buffer, pass.state_after_first,
+                           pass.state_after_count);
+    } else {
+      ExecuteRange(command_buffer, pass.begin_offset,
+                   pass_end - pass.begin_offset);
+    }
+    offset = pass_end;
+  }
+  ExecuteRange(command_buffer, offset, command_stream_.size() - offset);
+}
+
+void DeferredCommandBuffer::ExecuteRange(VkCommandBuffer command_buffer,
+                                         size_t offset, size_t size) const {
   const ui::vulkan::VulkanProvider::DeviceFunctions& dfn =
       command_processor_.GetVulkanProvider().dfn();
-  const uintmax_t* stream = command_stream_.data();
-  size_t stream_remaining = command_stream_.size();
+  const uintmax_t* stream = command_stream_.data() + offset;
+  size_t stream_remaining = size;
+  // Whether the last bound pipeline cache pipeline couldn't be created, and
+  // draws must be dropped.
+  bool graphics_pipeline_missing = false;
   while (stream_remaining) {
     const CommandHeader& header =
         *reinterpret_cast<const CommandHeader*>(stream);
@@ -46,28 +151,50 @@ void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer) {
     stream_remaining -= kCommandHeaderSizeElements;
 
     switch (header.command) {
+      case Command::kBindGraphicsPipelineHandle: {
+        VkPipeline pipeline = VulkanPipelineCache::GetVulkanPipelineByHandle(
+            *reinterpret_cast<void* const*>(stream));
+        graphics_pipeline_missing = pipeline == VK_NULL_HANDLE;
+        if (!graphics_pipeline_missing) {
+          dfn.vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                pipeline);
+        }
+      } break;
+
+      case Command::kVkBeginQuery: {
+        auto& args = *reinterpret_cast<const ArgsVkBeginQuery*>(stream);
+        dfn.vkCmdBeginQuery(command_buffer, args.query_pool, args.query,
+                            args.flags);
+      } break;
+
       case Command::kVkBeginRenderPass: {
         auto& args = *reinterpret_cast<const ArgsVkBeginRenderPass*>(stream);
-        size_t offset_bytes = sizeof(ArgsVkBeginRenderPass);
-        VkRenderPassBeginInfo render_pass_begin_info;
-        render_pass_begin_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        render_pass_begin_info.pNext = nullptr;
-        render_pass_begin_info.renderPass = args.render_pass;
-        render_pass_begin_info.framebuffer = args.framebuffer;
-        render_pass_begin_info.renderArea = args.render_area;
-        render_pass_begin_info.clearValueCount = args.clear_value_count;
-        if (render_pass_begin_info.clearValueCount) {
-          offset_bytes = xe::align(offset_bytes, alignof(VkClearValue));
-          render_pass_begin_info.pClearValues =
-              reinterpret_cast<const VkClearValue*>(
-                  reinterpret_cast<const uint8_t*>(stream) + offset_bytes);
-          offset_bytes +=
-              sizeof(VkClearValue) * render_pass_begin_info.clearValueCount;
-        } else {
-          render_pass_begin_info.pClearValues = nullptr;
-        }
-        dfn.vkCmdBeginRenderPass(command_buffer, &render_pass_begin_info,
-                                 args.contents);
+        ExecuteBeginRenderPass(command_buffer, args, args.contents);
+      } break;
+
+      case Command::kVkBeginRendering: {
+        auto& args = *reinterpret_cast<const ArgsVkBeginRendering*>(stream);
+        auto attachments =
+            reinterpret_cast<const VkRenderingAttachmentInfoKHR*>(
+                reinterpret_cast<const uint8_t*>(stream) +
+                xe::align(sizeof(ArgsVkBeginRendering),
+                          alignof(VkRenderingAttachmentInfoKHR)));
+        VkRenderingInfoKHR rendering_info;
+        rendering_info.sType = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+        rendering_info.pNext = nullptr;
+        rendering_info.flags = args.flags;
+        rendering_info.renderArea = args.render_area;
+        rendering_info.layerCount = args.layer_count;
+        rendering_info.viewMask = args.view_mask;
+        rendering_info.colorAttachmentCount = args.color_attachment_count;
+        rendering_info.pColorAttachments =
+            args.color_attachment_count ? attachments : nullptr;
+        attachments += args.color_attachment_count;
+        rendering_info.pDepthAttachment =
+            args.has_depth_attachment ? attachments++ : nullptr;
+        rendering_info.pStencilAttachment =
+            args.has_stencil_attachment ? attachments : nullptr;
+        dfn.vkCmdBeginRenderingKHR(command_buffer, &rendering_info);
       } break;
 
       case Command::kVkBindDescriptorSets: {
@@ -99,6 +226,9 @@ void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer) {
 
       case Command::kVkBindPipeline: {
         auto& args = *reinterpret_cast<const ArgsVkBindPipeline*>(stream);
+        if (args.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+          graphics_pipeline_missing = false;
+        }
         dfn.vkCmdBindPipeline(command_buffer, args.pipeline_bind_point,
                               args.pipeline);
       } break;
@@ -165,6 +295,27 @@ void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer) {
                           alignof(VkBufferImageCopy))));
       } break;
 
+      case Command::kVkCopyImage: {
+        auto& args = *reinterpret_cast<const ArgsVkCopyImage*>(stream);
+        dfn.vkCmdCopyImage(
+            command_buffer, args.src_image, args.src_image_layout,
+            args.dst_image, args.dst_image_layout, args.region_count,
+            reinterpret_cast<const VkImageCopy*>(
+                reinterpret_cast<const uint8_t*>(stream) +
+                xe::align(sizeof(ArgsVkCopyImage), alignof(VkImageCopy))));
+      } break;
+
+      case Command::kVkCopyImageToBuffer: {
+        auto& args = *reinterpret_cast<const ArgsVkCopyImageToBuffer*>(stream);
+        dfn.vkCmdCopyImageToBuffer(
+            command_buffer, args.src_image, args.src_image_layout,
+            args.dst_buffer, args.region_count,
+            reinterpret_cast<const VkBufferImageCopy*>(
+                reinterpret_cast<const uint8_t*>(stream) +
+                xe::align(sizeof(ArgsVkCopyImageToBuffer),
+                          alignof(VkBufferImageCopy))));
+      } break;
+
       case Command::kVkDispatch: {
         auto& args = *reinterpret_cast<const ArgsVkDispatch*>(stream);
         dfn.vkCmdDispatch(command_buffer, args.group_count_x,
@@ -172,22 +323,37 @@ void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer) {
       } break;
 
       case Command::kVkDraw: {
+        if (graphics_pipeline_missing) {
+          break;
+        }
         auto& args = *reinterpret_cast<const ArgsVkDraw*>(stream);
         dfn.vkCmdDraw(command_buffer, args.vertex_count, args.instance_count,
                       args.first_vertex, args.first_instance);
       } break;
 
       case Command::kVkDrawIndexed: {
+        if (graphics_pipeline_missing) {
+          break;
+        }
         auto& args = *reinterpret_cast<const ArgsVkDrawIndexed*>(stream);
         dfn.vkCmdDrawIndexed(command_buffer, args.index_count,
                              args.instance_count, args.first_index,
                              args.vertex_offset, args.first_instance);
       } break;
 
+      case Command::kVkEndQuery: {
+        auto& args = *reinterpret_cast<const ArgsVkEndQuery*>(stream);
+        dfn.vkCmdEndQuery(command_buffer, args.query_pool, args.query);
+      } break;
+
       case Command::kVkEndRenderPass:
         dfn.vkCmdEndRenderPass(command_buffer);
         break;
 
+      case Command::kVkEndRendering:
+        dfn.vkCmdEndRenderingKHR(command_buffer);
+        break;
+
       case Command::kVkPipelineBarrier: {
         auto& args = *reinterpret_cast<const ArgsVkPipelineBarrier*>(stream);
         size_t barrier_offset_bytes = sizeof(ArgsVkPipelineBarrier);
@@ -227,6 +393,50 @@ void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer) {
             args.image_memory_barrier_count, image_memory_barriers);
       } break;
 
+      case Command::kVkPipelineBarrier2: {
+        auto& args = *reinterpret_cast<const ArgsVkPipelineBarrier2*>(stream);
+        size_t barrier_offset_bytes = sizeof(ArgsVkPipelineBarrier2);
+        VkDependencyInfoKHR dependency_info;
+        dependency_info.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+        dependency_info.pNext = nullptr;
+        dependency_info.dependencyFlags = args.dependency_flags;
+        dependency_info.memoryBarrierCount = 0;
+        dependency_info.pMemoryBarriers = nullptr;
+        dependency_info.bufferMemoryBarrierCount =
+            args.buffer_memory_barrier_count;
+        dependency_info.pBufferMemoryBarriers = nullptr;
+        if (args.buffer_memory_barrier_count) {
+          barrier_offset_bytes = xe::align(barrier_offset_bytes,
+                                           alignof(VkBufferMemoryBarrier2KHR));
+          dependency_info.pBufferMemoryBarriers =
+              reinterpret_cast<const VkBufferMemoryBarrier2KHR*>(
+                  reinterpret_cast<const uint8_t*>(stream) +
+                  barrier_offset_bytes);
+          barrier_offset_bytes += sizeof(VkBufferMemoryBarrier2KHR) *
+                                  args.buffer_memory_barrier_count;
+        }
+        dependency_info.imageMemoryBarrierCount =
+            args.image_memory_barrier_count;
+        dependency_info.pImageMemoryBarriers = nullptr;
+        if (args.image_memory_barrier_count) {
+          barrier_offset_bytes = xe::align(barrier_offset_bytes,
+                                           alignof(VkImageMemoryBarrier2KHR));
+          dependency_info.pImageMemoryBarriers =
+              reinterpret_cast<const VkImageMemoryBarrier2KHR*>(
+                  reinterpret_cast<const uint8_t*>(stream) +
+                  barrier_offset_bytes);
+          barrier_offset_bytes += sizeof(VkImageMemoryBarrier2KHR) *
+                                  args.image_memory_barrier_count;
+        }
+        dfn.vkCmdPipelineBarrier2KHR(command_buffer, &dependency_info);
+      } break;
+
+      case Command::kVkResetQueryPool: {
+        auto& args = *reinterpret_cast<const ArgsVkResetQueryPool*>(stream);
+        dfn.vkCmdResetQueryPool(command_buffer, args.query_pool,
+                                args.first_query, args.query_count);
+      } break;
+
       case Command::kVkPushConstants: {
         auto& args = *reinterpret_cast<const ArgsVkPushConstants*>(stream);
         dfn.vkCmdPushConstants(command_buffer, args.layout, args.stage_flags,
@@ -240,6 +450,12 @@ void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer) {
         dfn.vkCmdSetBlendConstants(command_buffer, args.blend_constants);
       } break;
 
+      case Command::kVkSetCullMode: {
+        auto& args =
+            *reinterpret_cast<const ArgsSetExtendedDynamicState*>(stream);
+        dfn.vkCmdSetCullModeEXT(command_buffer, VkCullModeFlags(args.value));
+      } break;
+
       case Command::kVkSetDepthBias: {
         auto& args = *reinterpret_cast<const ArgsVkSetDepthBias*>(stream);
         dfn.vkCmdSetDepthBias(command_buffer, args.depth_bias_constant_factor,
@@ -247,6 +463,37 @@ void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer) {
                               args.depth_bias_slope_factor);
       } break;
 
+      case Command::kVkSetDepthCompareOp: {
+        auto& args =
+            *reinterpret_cast<const ArgsSetExtendedDynamicState*>(stream);
+        dfn.vkCmdSetDepthCompareOpEXT(command_buffer, VkCompareOp(args.value));
+      } break;
+
+      case Command::kVkSetDepthTestEnable: {
+        auto& args =
+            *reinterpret_cast<const ArgsSetExtendedDynamicState*>(stream);
+        dfn.vkCmdSetDepthTestEnableEXT(command_buffer, VkBool32(args.value));
+      } break;
+
+      case Command::kVkSetDepthWriteEnable: {
+        auto& args =
+            *reinterpret_cast<const ArgsSetExtendedDynamicState*>(stream);
+        dfn.vkCmdSetDepthWriteEnableEXT(command_buffer, VkBool32(args.value));
+      } break;
+
+      case Command::kVkSetFrontFace: {
+        auto& args =
+            *reinterpret_cast<const ArgsSetExtendedDynamicState*>(stream);
+        dfn.vkCmdSetFrontFaceEXT(command_buffer, VkFrontFace(args.value));
+      } break;
+
+      case Command::kVkSetPrimitiveRestartEnable: {
+        auto& args =
+            *reinterpret_cast<const ArgsSetExtendedDynamicState*>(stream);
+        dfn.vkCmdSetPrimitiveRestartEnableEXT(command_buffer,
+                                              VkBool32(args.value));
+      } break;
+
       case Command::kVkSetScissor: {
         auto& args = *reinterpret_cast<const ArgsVkSetScissor*>(stream);
         dfn.vkCmdSetScissor(
@@ -277,6 +524,19 @@ void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer) {
                                      args.mask_reference);
       } break;
 
+      case Command::kVkSetStencilOp: {
+        auto& args = *reinterpret_cast<const ArgsVkSetStencilOp*>(stream);
+        dfn.vkCmdSetStencilOpEXT(command_buffer, args.face_mask, args.fail_op,
+                                 args.pass_op, args.depth_fail_op,
+                                 args.compare_op);
+      } break;
+
+      case Command::kVkSetStencilTestEnable: {
+        auto& args =
+            *reinterpret_cast<const ArgsSetExtendedDynamicState*>(stream);
+        dfn.vkCmdSetStencilTestEnableEXT(command_buffer, VkBool32(args.value));
+      } break;
+
       case Command::kVkSetViewport: {
         auto& args = *reinterpret_cast<const ArgsVkSetViewport*>(stream);
         dfn.vkCmdSetViewport(
@@ -296,6 +556,460 @@ void DeferredCommandBuffer::Execute(VkCommandBuffer command_buffer) {
   }
 }
 
+void DeferredCommandBuffer::ExecuteBeginRenderPass(
+    VkCommandBuffer command_buffer, const ArgsVkBeginRenderPass& args,
+    VkSubpassContents contents) const {
+  const ui::vulkan::VulkanProvider::DeviceFunctions& dfn =
+      command_processor_.GetVulkanProvider().dfn();
+  size_t offset_bytes = sizeof(ArgsVkBeginRenderPass);
+  VkRenderPassBeginInfo render_pass_begin_info;
+  render_pass_begin_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+  render_pass_begin_info.pNext = nullptr;
+  render_pass_begin_info.renderPass = args.render_pass;
+  render_pass_begin_info.framebuffer = args.framebuffer;
+  render_pass_begin_info.renderArea = args.render_area;
+  render_pass_begin_info.clearValueCount = args.clear_value_count;
+  if (render_pass_begin_info.clearValueCount) {
+    offset_bytes = xe::align(offset_bytes, alignof(VkClearValue));
+    render_pass_begin_info.pClearValues = reinterpret_cast<const VkClearValue*>(
+        reinterpret_cast<const uint8_t*>(&args) + offset_bytes);
+  } else {
+    render_pass_begin_info.pClearValues = nullptr;
+  }
+  dfn.vkCmdBeginRenderPass(command_buffer, &render_pass_begin_info, contents);
+}
+
+bool DeferredCommandBuffer::UpdateStateCommands(StateCommands& state,
+                                                size_t offset) const {
+  const CommandHeader& header =
+      *reinterpret_cast<const CommandHeader*>(command_stream_.data() + offset);
+  const uintmax_t* stream =
+      command_stream_.data() + offset + kCommandHeaderSizeElements;
+  switch (header.command) {
+    case Command::kVkBindDescriptorSets: {
+      auto& args = *reinterpret_cast<const ArgsVkBindDescriptorSets*>(stream);
+      uint32_t bind_point_index;
+      if (args.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+        bind_point_index = 0;
+      } else if (args.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
+        bind_point_index = 1;
+      } else {
+        return false;
+      }
+      if (args.first_set + args.descriptor_set_count >
+          StateCommands::kMaxDescriptorSets) {
+        return false;
+      }
+      for (uint32_t i = 0; i < args.descriptor_set_count; ++i) {
+        state.descriptor_sets[bind_point_index][args.first_set + i] = offset;
+      }
+    } break;
+    case Command::kVkBindIndexBuffer:
+      state.index_buffer = offset;
+      break;
+    case Command::kBindGraphicsPipelineHandle:
+      state.pipelines[0] = offset;
+      break;
+    case Command::kVkBindPipeline: {
+      auto& args = *reinterpret_cast<const ArgsVkBindPipeline*>(stream);
+      if (args.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+        state.pipelines[0] = offset;
+      } else if (args.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
+        state.pipelines[1] = offset;
+      } else {
+        return false;
+      }
+    } break;
+    case Command::kVkBindVertexBuffers: {
+      auto& args = *reinterpret_cast<const ArgsVkBindVertexBuffers*>(stream);
+      if (args.first_binding + args.binding_count >
+          StateCommands::kMaxVertexBindings) {
+        return false;
+      }
+      for (uint32_t i = 0; i < args.binding_count; ++i) {
+        state.vertex_buffers[args.first_binding + i] = offset;
+      }
+    } break;
+    case Command::kVkPushConstants: {
+      // Only the latest values for the same range and layout are needed, but
+      // ranges with different layouts or stages are kept as they may be
+      // different data.
+      auto& args = *reinterpret_cast<const ArgsVkPushConstants*>(stream);
+      for (size_t& push_constants_offset : state.push_constants) {
+        auto& push_constants_args =
+            *reinterpret_cast<const ArgsVkPushConstants*>(
+                command_stream_.data() + push_constants_offset +
+                kCommandHeaderSizeElements);
+        if (push_constants_args.layout == args.layout &&
+            push_constants_args.stage_flags == args.stage_flags &&
+            push_constants_args.offset == args.offset &&
+            push_constants_args.size == args.size) {
+          push_constants_offset = offset;
+          return true;
+        }
+      }
+      state.push_constants.push_back(offset);
+    } break;
+    case Command::kVkSetBlendConstants:
+      state.blend_constants = offset;
+      break;
+    case Command::kVkSetCullMode:
+      state.cull_mode = offset;
+      break;
+    case Command::kVkSetDepthBias:
+      state.depth_bias = offset;
+      break;
+    case Command::kVkSetDepthCompareOp:
+      state.depth_compare_op = offset;
+      break;
+    case Command::kVkSetDepthTestEnable:
+      state.depth_test_enable = offset;
+      break;
+    case Command::kVkSetDepthWriteEnable:
+      state.depth_write_enable = offset;
+      break;
+    case Command::kVkSetFrontFace:
+      state.front_face = offset;
+      break;
+    case Command::kVkSetPrimitiveRestartEnable:
+      state.primitive_restart_enable = offset;
+      break;
+    case Command::kVkSetStencilOp: {
+      auto& args = *reinterpret_cast<const ArgsVkSetStencilOp*>(stream);
+      if (args.face_mask & VK_STENCIL_FACE_FRONT_BIT) {
+        state.stencil_ops[0] = offset;
+      }
+      if (args.face_mask & VK_STENCIL_FACE_BACK_BIT) {
+        state.stencil_ops[1] = offset;
+      }
+    } break;
+    case Command::kVkSetStencilTestEnable:
+      state.stencil_test_enable = offset;
+      break;
+    case Command::kVkSetScissor: {
+      auto& args = *reinterpret_cast<const ArgsVkSetScissor*>(stream);
+      if (args.first_scissor || args.scissor_count != 1) {
+        return false;
+      }
+      state.scissor = offset;
+    } break;
+    case Command::kVkSetStencilCompareMask:
+    case Command::kVkSetStencilReference:
+    case Command::kVkSetStencilWriteMask: {
+      auto& args =
+          *reinterpret_cast<const ArgsSetStencilMaskReference*>(stream);
+      size_t* faces;
+      if (header.command == Command::kVkSetStencilCompareMask) {
+        faces = state.stencil_compare_masks;
+      } else if (header.command == Command::kVkSetStencilReference) {
+        faces = state.stencil_references;
+      } else {
+        faces = state.stencil_write_masks;
+      }
+      if (args.face_mask & VK_STENCIL_FACE_FRONT_BIT) {
+        faces[0] = offset;
+      }
+      if (args.face_mask & VK_STENCIL_FACE_BACK_BIT) {
+        faces[1] = offset;
+      }
+    } break;
+    case Command::kVkSetViewport: {
+      auto& args = *reinterpret_cast<const ArgsVkSetViewport*>(stream);
+      if (args.first_viewport || args.viewport_count != 1) {
+        return false;
+      }
+      state.viewport = offset;
+    } break;
+    default:
+      return false;
+  }
+  return true;
+}
+
+void DeferredCommandBuffer::AppendStateCommands(const StateCommands& state) {
+  size_t first = parallel_state_commands_.size();
+  auto append = [this](size_t offset) {
+    if (offset != SIZE_MAX) {
+      parallel_state_commands_.push_back(offset);
+    }
+  };
+  for (size_t offset : state.pipelines) {
+    append(offset);
+  }
+  for (const size_t(&bind_point_sets)[StateCommands::kMaxDescriptorSets] :
+       state.descriptor_sets) {
+    for (size_t offset : bind_point_sets) {
+      append(offset);
+    }
+  }
+  append(state.index_buffer);
+  for (size_t offset : state.vertex_buffers) {
+    append(offset);
+  }
+  append(state.blend_constants);
+  append(state.depth_bias);
+  append(state.scissor);
+  append(state.viewport);
+  for (uint32_t i = 0; i < 2; ++i) {
+    append(state.stencil_compare_masks[i]);
+    append(state.stencil_references[i]);
+    append(state.stencil_write_masks[i]);
+    append(state.stencil_ops[i]);
+  }
+  append(state.cull_mode);
+  append(state.front_face);
+  append(state.depth_test_enable);
+  append(state.depth_write_enable);
+  append(state.depth_compare_op);
+  append(state.stencil_test_enable);
+  append(state.primitive_restart_enable);
+  for (size_t offset : state.push_constants) {
+    append(offset);
+  }
+  // Executing in the original order, once for commands setting multiple
+  // parts of the state, so binding of pipelines with different layouts and
+  // descriptor sets interact the same way as originally.
+  auto state_begin = parallel_state_commands_.begin() + first;
+  std::sort(state_begin, parallel_state_commands_.end());
+  parallel_state_commands_.erase(
+      std::unique(state_begin, parallel_state_commands_.end()),
+      parallel_state_commands_.end());
+}
+
+void DeferredCommandBuffer::ExecuteStateCommands(VkCommandBuffer command_buffer,
+                                                 size_t first,
+                                                 size_t count) const {
+  for (size_t i = first; i < first + count; ++i) {
+    size_t offset = parallel_state_commands_[i];
+    const CommandHeader& header = *reinterpret_cast<const CommandHeader*>(
+        command_stream_.data() + offset);
+    ExecuteRange(command_buffer, offset,
+                 kCommandHeaderSizeElements + header.arguments_size_elements);
+  }
+}
+
+bool DeferredCommandBuffer::PrepareParallelRenderPasses() {
+  parallel_render_passes_.clear();
+  parallel_state_commands_.clear();
+
+  StateCommands state;
+  std::fill(std::begin(state.pipelines), std::end(state.pipelines), SIZE_MAX);
+  for (size_t(&bind_point_sets)[StateCommands::kMaxDescriptorSets] :
+       state.descriptor_sets) {
+    std::fill(std::begin(bind_point_sets), std::end(bind_point_sets),
+              SIZE_MAX);
+  }
+  state.index_buffer = SIZE_MAX;
+  std::fill(std::begin(state.vertex_buffers), std::end(state.vertex_buffers),
+            SIZE_MAX);
+  state.blend_constants = SIZE_MAX;
+  state.depth_bias = SIZE_MAX;
+  state.scissor = SIZE_MAX;
+  state.viewport = SIZE_MAX;
+  for (uint32_t i = 0; i < 2; ++i) {
+    state.stencil_compare_masks[i] = SIZE_MAX;
+    state.stencil_references[i] = SIZE_MAX;
+    state.stencil_write_masks[i] = SIZE_MAX;
+    state.stencil_ops[i] = SIZE_MAX;
+  }
+  state.cull_mode = SIZE_MAX;
+  state.front_face = SIZE_MAX;
+  state.depth_test_enable = SIZE_MAX;
+  state.depth_write_enable = SIZE_MAX;
+  state.depth_compare_op = SIZE_MAX;
+  state.stencil_test_enable = SIZE_MAX;
+  state.primitive_restart_enable = SIZE_MAX;
+
+  size_t pass_begin_offset = SIZE_MAX;
+  size_t pass_state_before_first = 0;
+  uint32_t pass_draw_count = 0;
+  bool pass_parallel = false;
+  bool query_active = false;
+  size_t offset = 0;
+  while (offset < command_stream_.size()) {
+    const CommandHeader& header = *reinterpret_cast<const CommandHeader*>(
+        command_stream_.data() + offset);
+    switch (header.command) {
+      case Command::kVkBeginRenderPass:
+        pass_begin_offset = offset;
+        pass_state_before_first = parallel_state_commands_.size();
+        pass_draw_count = 0;
+        // Secondary command buffers would need to inherit the query.
+        pass_parallel = !query_active;
+        AppendStateCommands(state);
+        break;
+      case Command::kVkEndRenderPass:
+        if (pass_begin_offset != SIZE_MAX && pass_parallel &&
+            pass_draw_count >= kParallelRenderPassMinDraws) {
+          ParallelRenderPass& pass = parallel_render_passes_.emplace_back();
+          pass.begin_offset = pass_begin_offset;
+          pass.end_offset = offset;
+          pass.state_before_first = pass_state_before_first;
+          pass.state_before_count =
+              parallel_state_commands_.size() - pass_state_before_first;
+          pass.state_after_first = parallel_state_commands_.size();
+          AppendStateCommands(state);
+          pass.state_after_count =
+              parallel_state_commands_.size() - pass.state_after_first;
+          pass.secondary_command_buffer = VK_NULL_HANDLE;
+          pass.recorded = false;
+        } else {
+          parallel_state_commands_.resize(pass_state_before_first);
+        }
+        pass_begin_offset = SIZE_MAX;
+        break;
+      case Command::kVkDraw:
+      case Command::kVkDrawIndexed:
+        ++pass_draw_count;
+        break;
+      case Command::kVkClearAttachments:
+        break;
+      case Command::kVkBeginQuery:
+        query_active = true;
+        break;
+      case Command::kVkEndQuery:
+        query_active = false;
+        break;
+      case Command::kVkResetQueryPool:
+        break;
+      case Command::kVkBeginRendering:
+      case Command::kVkEndRendering:
+        // Not recorded in parallel, as that would require beginning with
+        // VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR, and
+        // inheriting the attachment formats in the secondary command buffers.
+        break;
+      case Command::kVkClearColorImage:
+      case Command::kVkCopyBuffer:
+      case Command::kVkCopyBufferToImage:
+      case Command::kVkCopyImage:
+      case Command::kVkCopyImageToBuffer:
+      case Command::kVkDispatch:
+      case Command::kVkPipelineBarrier:
+      case Command::kVkPipelineBarrier2:
+        // Either not allowed in a render pass, or not worth handling.
+        pass_parallel = false;
+        break;
+      default:
+        if (!UpdateStateCommands(state, offset)) {
+          parallel_render_passes_.clear();
+          parallel_state_commands_.clear();
+          return false;
+        }
+        break;
+    }
+    offset += kCommandHeaderSizeElements + header.arguments_size_elements;
+  }
+  return !parallel_render_passes_.empty();
+}
+
+VkCommandBuffer DeferredCommandBuffer::RecordParallelRenderPass(
+    const ParallelRenderPass& pass, SecondaryCommandPool& pool,
+    size_t& pool_buffers_used) const {
+  const ui::vulkan::VulkanProvider& provider =
+      command_processor_.GetVulkanProvider();
+  const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
+  VkDevice device = provider.device();
+
+  if (pool_buffers_used >= pool.buffers.size()) {
+    VkCommandBufferAllocateInfo command_buffer_allocate_info;
+    command_buffer_allocate_info.sType =
+        VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    command_buffer_allocate_info.pNext = nullptr;
+    command_buffer_allocate_info.commandPool = pool.pool;
+    command_buffer_allocate_info.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+    command_buffer_allocate_info.commandBufferCount = 1;
+    VkCommandBuffer command_buffer;
+    if (dfn.vkAllocateCommandBuffers(device, &command_buffer_allocate_info,
+                                     &command_buffer) != VK_SUCCESS) {
+      XELOGE("Failed to allocate a Vulkan secondary command buffer");
+      return VK_NULL_HANDLE;
+    }
+    pool.buffers.push_back(command_buffer);
+  }
+  VkCommandBuffer command_buffer = pool.buffers[pool_buffers_used];
+
+  const uintmax_t* begin_stream =
+      command_stream_.data() + pass.begin_offset + kCommandHeaderSizeElements;
+  auto& begin_args =
+      *reinterpret_cast<const ArgsVkBeginRenderPass*>(begin_stream);
+  VkCommandBufferInheritanceInfo inheritance_info;
+  inheritance_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+  inheritance_info.pNext = nullptr;
+  inheritance_info.renderPass = begin_args.render_pass;
+  inheritance_info.subpass = 0;
+  inheritance_info.framebuffer = begin_args.framebuffer;
+  inheritance_info.occlusionQueryEnable = VK_FALSE;
+  inheritance_info.queryFlags = 0;
+  inheritance_info.pipelineStatistics = 0;
+  VkCommandBufferBeginInfo command_buffer_begin_info;
+  command_buffer_begin_info.sType =
+      VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+  command_buffer_begin_info.pNext = nullptr;
+  command_buffer_begin_info.flags =
+      VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+      VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+  command_buffer_begin_info.pInheritanceInfo = &inheritance_info;
+  if (dfn.vkBeginCommandBuffer(command_buffer, &command_buffer_begin_info) !=
+      VK_SUCCESS) {
+    XELOGE("Failed to begin a Vulkan secondary command buffer");
+    return VK_NULL_HANDLE;
+  }
+  // Not reusable until the pool is reset even if failed to record.
+  ++pool_buffers_used;
+
+  ExecuteStateCommands(command_buffer, pass.state_before_first,
+                       pass.state_before_count);
+  const CommandHeader& begin_header = *reinterpret_cast<const CommandHeader*>(
+      command_stream_.data() + pass.begin_offset);
+  size_t contents_offset = pass.begin_offset + kCommandHeaderSizeElements +
+                           begin_header.arguments_size_elements;
+  ExecuteRange(command_buffer, contents_offset,
+               pass.end_offset - contents_offset);
+
+  if (dfn.vkEndCommandBuffer(command_buffer) != VK_SUCCESS) {
+    XELOGE("Failed to end a Vulkan secondary command buffer");
+    return VK_NULL_HANDLE;
+  }
+  return command_buffer;
+}
+
+void DeferredCommandBuffer::RecordingThread(uint32_t thread_index) {
+  uint64_t generation = 0;
+  while (true) {
+    size_t render_pass_count;
+    SecondaryCommandPool* pools;
+    {
+      std::unique_lock<std::mutex> lock(recording_mutex_);
+      recording_request_cond_.wait(lock, [this, generation]() {
+        return recording_threads_shutdown_ ||
+               recording_generation_ != generation;
+      });
+      if (recording_threads_shutdown_) {
+        return;
+      }
+      generation = recording_generation_;
+      render_pass_count = recording_render_pass_count_;
+      pools = recording_pools_;
+    }
+    // Each thread has its own pool, as command pools must be externally
+    // synchronized.
+    SecondaryCommandPool& pool = pools[thread_index];
+    size_t pool_buffers_used = 0;
+    for (size_t i = thread_index; i < render_pass_count;
+         i += recording_thread_count_) {
+      ParallelRenderPass& pass = parallel_render_passes_[i];
+      VkCommandBuffer command_buffer =
+          RecordParallelRenderPass(pass, pool, pool_buffers_used);
+      {
+        std::lock_guard<std::mutex> lock(recording_mutex_);
+        pass.secondary_command_buffer = command_buffer;
+        pass.recorded = true;
+      }
+      recording_completion_cond_.notify_all();
+    }
+  }
+}
+
 void DeferredCommandBuffer::CmdVkPipelineBarrier(
     VkPipelineStageFlags src_stage_mask, VkPipelineStageFlags dst_stage_mask,
     VkDependencyFlags dependency_flags, uint32_t memory_barrier_count,
@@ -348,6 +1062,45 @@ void DeferredCommandBuffer::CmdVkPipelineBarrier(
   }
 }
 
+void DeferredCommandBuffer::CmdVkPipelineBarrier2(
+    VkDependencyFlags dependency_flags, uint32_t buffer_memory_barrier_count,
+    const VkBufferMemoryBarrier2KHR* buffer_memory_barriers,
+    uint32_t image_memory_barrier_count,
+    const VkImageMemoryBarrier2KHR* image_memory_barriers) {
+  size_t arguments_size = sizeof(ArgsVkPipelineBarrier2);
+  size_t buffer_memory_barriers_offset = 0;
+  if (buffer_memory_barrier_count) {
+    arguments_size =
+        xe::align(arguments_size, alignof(VkBufferMemoryBarrier2KHR));
+    buffer_memory_barriers_offset = arguments_size;
+    arguments_size +=
+        sizeof(VkBufferMemoryBarrier2KHR) * buffer_memory_barrier_count;
+  }
+  size_t image_memory_barriers_offset = 0;
+  if (image_memory_barrier_count) {
+    arguments_size =
+        xe::align(arguments_size, alignof(VkImageMemoryBarrier2KHR));
+    image_memory_barriers_offset = arguments_size;
+    arguments_size +=
+        sizeof(VkImageMemoryBarrier2KHR) * image_memory_barrier_count;
+  }
+  uint8_t* args_ptr = reinterpret_cast<uint8_t*>(
+      WriteCommand(Command::kVkPipelineBarrier2, arguments_size));
+  auto& args = *reinterpret_cast<ArgsVkPipelineBarrier2*>(args_ptr);
+  args.dependency_flags = dependency_flags;
+  args.buffer_memory_barrier_count = buffer_memory_barrier_count;
+  args.image_memory_barrier_count = image_memory_barrier_count;
+  if (buffer_memory_barrier_count) {
+    std::memcpy(
+        args_ptr + buffer_memory_barriers_offset, buffer_memory_barriers,
+        sizeof(VkBufferMemoryBarrier2KHR) * buffer_memory_barrier_count);
+  }
+  if (image_memory_barrier_count) {
+    std::memcpy(args_ptr + image_memory_barriers_offset, image_memory_barriers,
+                sizeof(VkImageMemoryBarrier2KHR) * image_memory_barrier_count);
+  }
+}
+
 void* DeferredCommandBuffer::WriteCommand(Command command,
                                           size_t arguments_size_bytes) {
   size_t arguments_size_elements =
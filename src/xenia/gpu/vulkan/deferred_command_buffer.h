@@ -10,12 +10,17 @@
 #ifndef XENIA_GPU_VULKAN_DEFERRED_COMMAND_BUFFER_H_
 #define XENIA_GPU_VULKAN_DEFERRED_COMMAND_BUFFER_H_
 
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "xenia/base/assert.h"
 #include "xenia/base/math.h"
+#include "xenia/base/threading.h"
 #include "xenia/ui/vulkan/vulkan_provider.h"
 
 namespace xe {
@@ -26,13 +31,53 @@ class VulkanCommandProcessor;
 
 class DeferredCommandBuffer {
  public:
+  // Secondary command buffers used by one recording thread, allocated from a
+  // pool only accessed by that thread during Execute, and reused after the
+  // owner of the pool resets it.
+  struct SecondaryCommandPool {
+    VkCommandPool pool = VK_NULL_HANDLE;
+    std::vector<VkCommandBuffer> buffers;
+  };
+
   DeferredCommandBuffer(const VulkanCommandProcessor& command_processor,
                         size_t initial_size_bytes = 1024 * 1024);
+  ~DeferredCommandBuffer();
+
+  // Threads recording the contents of render passes with many draws into
+  // secondary command buffers in parallel in Execute.
+  void InitializeRecordingThreads(uint32_t thread_count);
+  void ShutdownRecordingThreads();
+  uint32_t recording_thread_count() const { return recording_thread_count_; }
 
   void Reset();
-  void Execute(VkCommandBuffer command_buffer);
+  // If secondary_pools is not null, it must point to recording_thread_count()
+  // pools, and the render passes with many draws are recorded into secondary
+  // command buffers from them.
+  void Execute(VkCommandBuffer command_buffer,
+               SecondaryCommandPool* secondary_pools = nullptr);
 
   // render_pass_begin->pNext of all barriers must be null.
+  // Binds a graphics pipeline from the pipeline cache by its handle, resolved
+  // when the commands are executed, so the pipeline may be created while the
+  // rest of the submission is being recorded. Draws are dropped until the next
+  // pipeline if the pipeline couldn't be created.
+  void BindGraphicsPipelineHandle(void* pipeline_handle) {
+    *reinterpret_cast<void**>(WriteCommand(Command::kBindGraphicsPipelineHandle,
+                                           sizeof(void*))) = pipeline_handle;
+  }
+
+  // Queries must be begun and ended outside render passes, so render passes
+  // within queries are not recorded in parallel, as that requires query
+  // inheritance.
+  void CmdVkBeginQuery(VkQueryPool query_pool, uint32_t query,
+                       VkQueryControlFlags flags) {
+    auto& args = *reinterpret_cast<ArgsVkBeginQuery*>(
+        WriteCommand(Command::kVkBeginQuery, sizeof(ArgsVkBeginQuery)));
+    args.query_pool = query_pool;
+    args.query = query;
+    args.flags = flags;
+  }
+
   void CmdVkBeginRenderPass(const VkRenderPassBeginInfo* render_pass_begin,
                             VkSubpassContents contents) {
     assert_null(render_pass_begin->pNext);
@@ -59,6 +104,47 @@ class DeferredCommandBuffer {
     }
   }
 
+  // rendering_info->pNext and pNext of all attachments must be null.
+  void CmdVkBeginRendering(const VkRenderingInfoKHR* rendering_info) {
+    assert_null(rendering_info->pNext);
+    uint32_t color_attachment_count = rendering_info->colorAttachmentCount;
+    bool has_depth_attachment = rendering_info->pDepthAttachment != nullptr;
+    bool has_stencil_attachment =
+        rendering_info->pStencilAttachment != nullptr;
+    const size_t header_size = xe::align(sizeof(ArgsVkBeginRendering),
+                                         alignof(VkRenderingAttachmentInfoKHR));
+    uint8_t* args_ptr = reinterpret_cast<uint8_t*>(WriteCommand(
+        Command::kVkBeginRendering,
+        header_size + sizeof(VkRenderingAttachmentInfoKHR) *
+                          (color_attachment_count +
+                           uint32_t(has_depth_attachment) +
+                           uint32_t(has_stencil_attachment))));
+    auto& args = *reinterpret_cast<ArgsVkBeginRendering*>(args_ptr);
+    args.flags = rendering_info->flags;
+    args.render_area = rendering_info->renderArea;
+    args.layer_count = rendering_info->layerCount;
+    args.view_mask = rendering_info->viewMask;
+    args.color_attachment_count = color_attachment_count;
+    args.has_depth_attachment = has_depth_attachment;
+    args.has_stencil_attachment = has_stencil_attachment;
+    auto attachments =
+        reinterpret_cast<VkRenderingAttachmentInfoKHR*>(args_ptr + header_size);
+    if (color_attachment_count) {
+      std::memcpy(attachments, rendering_info->pColorAttachments,
+                  sizeof(VkRenderingAttachmentInfoKHR) *
+                      color_attachment_count);
+      attachments += color_attachment_count;
+    }
+    if (has_depth_attachment) {
+      std::memcpy(attachments++, rendering_info->pDepthAttachment,
+                  sizeof(VkRenderingAttachmentInfoKHR));
+    }
+    if (has_stencil_attachment) {
+      std::memcpy(attachments, rendering_info->pStencilAttachment,
+                  sizeof(VkRenderingAttachmentInfoKHR));
+    }
+  }
+
   void CmdVkBindDescriptorSets(VkPipelineBindPoint pipeline_bind_point,
                                VkPipelineLayout layout, uint32_t first_set,
                                uint32_t descriptor_set_count,
@@ -231,6 +317,56 @@ class DeferredCommandBuffer {
                 regions, sizeof(VkBufferImageCopy) * region_count);
   }
 
+  VkImageCopy* CmdCopyImageEmplace(VkImage src_image,
+                                   VkImageLayout src_image_layout,
+                                   VkImage dst_image,
+                                   VkImageLayout dst_image_layout,
+                                   uint32_t region_count) {
+    const size_t header_size =
+        xe::align(sizeof(ArgsVkCopyImage), alignof(VkImageCopy));
+    uint8_t* args_ptr = reinterpret_cast<uint8_t*>(
+        WriteCommand(Command::kVkCopyImage,
+                     header_size + sizeof(VkImageCopy) * region_count));
+    auto& args = *reinterpret_cast<ArgsVkCopyImage*>(args_ptr);
+    args.src_image = src_image;
+    args.src_image_layout = src_image_layout;
+    args.dst_image = dst_image;
+    args.dst_image_layout = dst_image_layout;
+    args.region_count = region_count;
+    return reinterpret_cast<VkImageCopy*>(args_ptr + header_size);
+  }
+  void CmdVkCopyImage(VkImage src_image, VkImageLayout src_image_layout,
+                      VkImage dst_image, VkImageLayout dst_image_layout,
+                      uint32_t region_count, const VkImageCopy* regions) {
+    std::memcpy(CmdCopyImageEmplace(src_image, src_image_layout, dst_image,
+                                    dst_image_layout, region_count),
+                regions, sizeof(VkImageCopy) * region_count);
+  }
+
+  VkBufferImageCopy* CmdCopyImageToBufferEmplace(VkImage src_image,
+                                                 VkImageLayout src_image_layout,
+                                                 VkBuffer dst_buffer,
+                                                 uint32_t region_count) {
+    const size_t header_size =
+        xe::align(sizeof(ArgsVkCopyImageToBuffer), alignof(VkBufferImageCopy));
+    uint8_t* args_ptr = reinterpret_cast<uint8_t*>(
+        WriteCommand(Command::kVkCopyImageToBuffer,
+                     header_size + sizeof(VkBufferImageCopy) * region_count));
+    auto& args = *reinterpret_cast<ArgsVkCopyImageToBuffer*>(args_ptr);
+    args.src_image = src_image;
+    args.src_image_layout = src_image_layout;
+    args.dst_buffer = dst_buffer;
+    args.region_count = region_count;
+    return reinterpret_cast<VkBufferImageCopy*>(args_ptr + header_size);
+  }
+  void CmdVkCopyImageToBuffer(VkImage src_image, VkImageLayout src_image_layout,
+                              VkBuffer dst_buffer, uint32_t region_count,
+                              const VkBufferImageCopy* regions) {
+    std::memcpy(CmdCopyImageToBufferEmplace(src_image, src_image_layout,
+                                            dst_buffer, region_count),
+                regions, sizeof(VkBufferImageCopy) * region_count);
+  }
+
   void CmdVkDispatch(uint32_t group_count_x, uint32_t group_count_y,
                      uint32_t group_count_z) {
     auto& args = *reinterpret_cast<ArgsVkDispatch*>(
@@ -262,8 +398,17 @@ class DeferredCommandBuffer {
     args.first_instance = first_instance;
   }
 
+  void CmdVkEndQuery(VkQueryPool query_pool, uint32_t query) {
+    auto& args = *reinterpret_cast<ArgsVkEndQuery*>(
+        WriteCommand(Command::kVkEndQuery, sizeof(ArgsVkEndQuery)));
+    args.query_pool = query_pool;
+    args.query = query;
+  }
+
   void CmdVkEndRenderPass() { WriteCommand(Command::kVkEndRenderPass, 0); }
 
+  void CmdVkEndRendering() { WriteCommand(Command::kVkEndRendering, 0); }
+
   // pNext of all barriers must be null.
   void CmdVkPipelineBarrier(VkPipelineStageFlags src_stage_mask,
                             VkPipelineStageFlags dst_stage_mask,
@@ -275,6 +420,14 @@ class DeferredCommandBuffer {
                             uint32_t image_memory_barrier_count,
                             const VkImageMemoryBarrier* image_memory_barriers);
 
+  // VK_KHR_synchronization2, with per-barrier stage masks. pNext of all
+  // barriers must be null.
+  void CmdVkPipelineBarrier2(
+      VkDependencyFlags dependency_flags, uint32_t buffer_memory_barrier_count,
+      const VkBufferMemoryBarrier2KHR* buffer_memory_barriers,
+      uint32_t image_memory_barrier_count,
+      const VkImageMemoryBarrier2KHR* image_memory_barriers);
+
   void CmdVkPushConstants(VkPipelineLayout layout,
                           VkShaderStageFlags stage_flags, uint32_t offset,
                           uint32_t size, const void* values) {
@@ -288,12 +441,26 @@ class DeferredCommandBuffer {
     std::memcpy(args_ptr + sizeof(ArgsVkPushConstants), values, size);
   }
 
+  void CmdVkResetQueryPool(VkQueryPool query_pool, uint32_t first_query,
+                           uint32_t query_count) {
+    auto& args = *reinterpret_cast<ArgsVkResetQueryPool*>(
+        WriteCommand(Command::kVkResetQueryPool, sizeof(ArgsVkResetQueryPool)));
+    args.query_pool = query_pool;
+    args.first_query = first_query;
+    args.query_count = query_count;
+  }
+
   void CmdVkSetBlendConstants(const float* blend_constants) {
     auto& args = *reinterpret_cast<ArgsVkSetBlendConstants*>(WriteCommand(
         Command::kVkSetBlendConstants, sizeof(ArgsVkSetBlendConstants)));
     std::memcpy(args.blend_constants, blend_constants, sizeof(float) * 4);
   }
 
+  // VK_EXT_extended_dynamic_state.
+  void CmdVkSetCullMode(VkCullModeFlags cull_mode) {
+    WriteExtendedDynamicStateCommand(Command::kVkSetCullMode, cull_mode);
+  }
+
   void CmdVkSetDepthBias(float depth_bias_constant_factor,
                          float depth_bias_clamp,
                          float depth_bias_slope_factor) {
@@ -304,6 +471,36 @@ class DeferredCommandBuffer {
     args.depth_bias_slope_factor = depth_bias_slope_factor;
   }
 
+  // VK_EXT_extended_dynamic_state.
+  void CmdVkSetDepthCompareOp(VkCompareOp depth_compare_op) {
+    WriteExtendedDynamicStateCommand(Command::kVkSetDepthCompareOp,
+                                     uint32_t(depth_compare_op));
+  }
+
+  // VK_EXT_extended_dynamic_state.
+  void CmdVkSetDepthTestEnable(VkBool32 depth_test_enable) {
+    WriteExtendedDynamicStateCommand(Command::kVkSetDepthTestEnable,
+                                     depth_test_enable);
+  }
+
+  // VK_EXT_extended_dynamic_state.
+  void CmdVkSetDepthWriteEnable(VkBool32 depth_write_enable) {
+    WriteExtendedDynamicStateCommand(Command::kVkSetDepthWriteEnable,
+                                     depth_write_enable);
+  }
+
+  // VK_EXT_extended_dynamic_state.
+  void CmdVkSetFrontFace(VkFrontFace front_face) {
+    WriteExtendedDynamicStateCommand(Command::kVkSetFrontFace,
+                                     uint32_t(front_face));
+  }
+
+  // VK_EXT_extended_dynamic_state2.
+  void CmdVkSetPrimitiveRestartEnable(VkBool32 primitive_restart_enable) {
+    WriteExtendedDynamicStateCommand(Command::kVkSetPrimitiveRestartEnable,
+                                     primitive_restart_enable);
+  }
+
   void CmdVkSetScissor(uint32_t first_scissor, uint32_t scissor_count,
                        const VkRect2D* scissors) {
     const size_t header_size =
@@ -327,6 +524,19 @@ class DeferredCommandBuffer {
     args.mask_reference = compare_mask;
   }
 
+  // VK_EXT_extended_dynamic_state.
+  void CmdVkSetStencilOp(VkStencilFaceFlags face_mask, VkStencilOp fail_op,
+                         VkStencilOp pass_op, VkStencilOp depth_fail_op,
+                         VkCompareOp compare_op) {
+    auto& args = *reinterpret_cast<ArgsVkSetStencilOp*>(
+        WriteCommand(Command::kVkSetStencilOp, sizeof(ArgsVkSetStencilOp)));
+    args.face_mask = face_mask;
+    args.fail_op = fail_op;
+    args.pass_op = pass_op;
+    args.depth_fail_op = depth_fail_op;
+    args.compare_op = compare_op;
+  }
+
   void CmdVkSetStencilReference(VkStencilFaceFlags face_mask,
                                 uint32_t reference) {
     auto& args = *reinterpret_cast<ArgsSetStencilMaskReference*>(WriteCommand(
@@ -343,6 +553,12 @@ class DeferredCommandBuffer {
     args.mask_reference = write_mask;
   }
 
+  // VK_EXT_extended_dynamic_state.
+  void CmdVkSetStencilTestEnable(VkBool32 stencil_test_enable) {
+    WriteExtendedDynamicStateCommand(Command::kVkSetStencilTestEnable,
+                                     stencil_test_enable);
+  }
+
   void CmdVkSetViewport(uint32_t first_viewport, uint32_t viewport_count,
                         const VkViewport* viewports) {
     const size_t header_size =
@@ -359,7 +575,10 @@ class DeferredCommandBuffer {
 
  private:
   enum class Command {
+    kBindGraphicsPipelineHandle,
+    kVkBeginQuery,
     kVkBeginRenderPass,
+    kVkBeginRendering,
     kVkBindDescriptorSets,
     kVkBindIndexBuffer,
     kVkBindPipeline,
@@ -368,17 +587,31 @@ class DeferredCommandBuffer {
     kVkClearColorImage,
     kVkCopyBuffer,
     kVkCopyBufferToImage,
+    kVkCopyImage,
+    kVkCopyImageToBuffer,
     kVkDispatch,
     kVkDraw,
     kVkDrawIndexed,
+    kVkEndQuery,
     kVkEndRenderPass,
+    kVkEndRendering,
     kVkPipelineBarrier,
+    kVkPipelineBarrier2,
     kVkPushConstants,
+    kVkResetQueryPool,
     kVkSetBlendConstants,
+    kVkSetCullMode,
     kVkSetDepthBias,
+    kVkSetDepthCompareOp,
+    kVkSetDepthTestEnable,
+    kVkSetDepthWriteEnable,
+    kVkSetFrontFace,
+    kVkSetPrimitiveRestartEnable,
     kVkSetScissor,
     kVkSetStencilCompareMask,
+    kVkSetStencilOp,
     kVkSetStencilReference,
+    kVkSetStencilTestEnable,
     kVkSetStencilWriteMask,
     kVkSetViewport,
   };
@@ -390,6 +623,12 @@ class DeferredCommandBuffer {
   static constexpr size_t kCommandHeaderSizeElements =
       (sizeof(CommandHeader) + sizeof(uintmax_t) - 1) / sizeof(uintmax_t);
 
+  struct ArgsVkBeginQuery {
+    VkQueryPool query_pool;
+    uint32_t query;
+    VkQueryControlFlags flags;
+  };
+
   struct ArgsVkBeginRenderPass {
     VkRenderPass render_pass;
     VkFramebuffer framebuffer;
@@ -400,6 +639,20 @@ class DeferredCommandBuffer {
     static_assert(alignof(VkClearValue) <= alignof(uintmax_t));
   };
 
+  struct ArgsVkBeginRendering {
+    VkRenderingFlagsKHR flags;
+    VkRect2D render_area;
+    uint32_t layer_count;
+    uint32_t view_mask;
+    uint32_t color_attachment_count;
+    bool has_depth_attachment;
+    bool has_stencil_attachment;
+    // Followed by aligned VkRenderingAttachmentInfoKHR[] of the color
+    // attachments, then optionally the depth one, then optionally the stencil
+    // one.
+    static_assert(alignof(VkRenderingAttachmentInfoKHR) <= alignof(uintmax_t));
+  };
+
   struct ArgsVkBindDescriptorSets {
     VkPipelineBindPoint pipeline_bind_point;
     VkPipelineLayout layout;
@@ -463,6 +716,25 @@ class DeferredCommandBuffer {
     static_assert(alignof(VkBufferImageCopy) <= alignof(uintmax_t));
   };
 
+  struct ArgsVkCopyImage {
+    VkImage src_image;
+    VkImageLayout src_image_layout;
+    VkImage dst_image;
+    VkImageLayout dst_image_layout;
+    uint32_t region_count;
+    // Followed by aligned VkImageCopy[].
+    static_assert(alignof(VkImageCopy) <= alignof(uintmax_t));
+  };
+
+  struct ArgsVkCopyImageToBuffer {
+    VkImage src_image;
+    VkImageLayout src_image_layout;
+    VkBuffer dst_buffer;
+    uint32_t region_count;
+    // Followed by aligned VkBufferImageCopy[].
+    static_assert(alignof(VkBufferImageCopy) <= alignof(uintmax_t));
+  };
+
   struct ArgsVkDispatch {
     uint32_t group_count_x;
     uint32_t group_count_y;
@@ -484,6 +756,11 @@ class DeferredCommandBuffer {
     uint32_t first_instance;
   };
 
+  struct ArgsVkEndQuery {
+    VkQueryPool query_pool;
+    uint32_t query;
+  };
+
   struct ArgsVkPipelineBarrier {
     VkPipelineStageFlags src_stage_mask;
     VkPipelineStageFlags dst_stage_mask;
@@ -498,6 +775,16 @@ class DeferredCommandBuffer {
     static_assert(alignof(VkImageMemoryBarrier) <= alignof(uintmax_t));
   };
 
+  struct ArgsVkPipelineBarrier2 {
+    VkDependencyFlags dependency_flags;
+    uint32_t buffer_memory_barrier_count;
+    uint32_t image_memory_barrier_count;
+    // Followed by aligned optional VkBufferMemoryBarrier2KHR[], optional
+    // VkImageMemoryBarrier2KHR[].
+    static_assert(alignof(VkBufferMemoryBarrier2KHR) <= alignof(uintmax_t));
+    static_assert(alignof(VkImageMemoryBarrier2KHR) <= alignof(uintmax_t));
+  };
+
   struct ArgsVkPushConstants {
     VkPipelineLayout layout;
     VkShaderStageFlags stage_flags;
@@ -506,6 +793,12 @@ class DeferredCommandBuffer {
     // Followed by `size` bytes of values.
   };
 
+  struct ArgsVkResetQueryPool {
+    VkQueryPool query_pool;
+    uint32_t first_query;
+    uint32_t query_count;
+  };
+
   struct ArgsVkSetBlendConstants {
     float blend_constants[4];
   };
@@ -523,11 +816,24 @@ class DeferredCommandBuffer {
     static_assert(alignof(VkRect2D) <= alignof(uintmax_t));
   };
 
+  // Single-value VK_EXT_extended_dynamic_state commands.
+  struct ArgsSetExtendedDynamicState {
+    uint32_t value;
+  };
+
   struct ArgsSetStencilMaskReference {
     VkStencilFaceFlags face_mask;
     uint32_t mask_reference;
   };
 
+  struct ArgsVkSetStencilOp {
+    VkStencilFaceFlags face_mask;
+    VkStencilOp fail_op;
+    VkStencilOp pass_op;
+    VkStencilOp depth_fail_op;
+    VkCompareOp compare_op;
+  };
+
   struct ArgsVkSetViewport {
     uint32_t first_viewport;
     uint32_t viewport_count;
@@ -536,11 +842,110 @@ class DeferredCommandBuffer {
   };
 
   void* WriteCommand(Command command, size_t arguments_size_bytes);
+  void WriteExtendedDynamicStateCommand(Command command, uint32_t value) {
+    reinterpret_cast<ArgsSetExtendedDynamicState*>(
+        WriteCommand(command, sizeof(ArgsSetExtendedDynamicState)))
+        ->value = value;
+  }
+
+  // Replays the commands in a part of the stream, which must not include a
+  // part of a command.
+  void ExecuteRange(VkCommandBuffer command_buffer, size_t offset,
+                    size_t size) const;
+  void ExecuteBeginRenderPass(VkCommandBuffer command_buffer,
+                              const ArgsVkBeginRenderPass& args,
+                              VkSubpassContents contents) const;
+
+  // Recording the contents of render passes in parallel.
+
+  // The overhead of a secondary command buffer is not worth it for render
+  // passes with fewer draws, they are recorded into the primary one.
+  static constexpr uint32_t kParallelRenderPassMinDraws = 64;
+
+  // Neither secondary command buffers inherit the state from the primary one,
+  // nor the primary command buffer has its state preserved after executing
+  // secondary ones, so the latest state is restored by executing the commands
+  // that have set it again. Offsets of the commands, SIZE_MAX if not set yet.
+  struct StateCommands {
+    static constexpr uint32_t kMaxDescriptorSets = 8;
+    static constexpr uint32_t kMaxVertexBindings = 32;
+    // Graphics and compute.
+    size_t pipelines[2];
+    size_t descriptor_sets[2][kMaxDescriptorSets];
+    size_t index_buffer;
+    size_t vertex_buffers[kMaxVertexBindings];
+    size_t blend_constants;
+    size_t depth_bias;
+    size_t scissor;
+    size_t viewport;
+    // Front and back faces.
+    size_t stencil_compare_masks[2];
+    size_t stencil_references[2];
+    size_t stencil_write_masks[2];
+    // VK_EXT_extended_dynamic_state.
+    size_t cull_mode;
+    size_t front_face;
+    size_t depth_test_enable;
+    size_t depth_write_enable;
+    size_t depth_compare_op;
+    size_t stencil_test_enable;
+    size_t stencil_ops[2];
+    // VK_EXT_extended_dynamic_state2.
+    size_t primitive_restart_enable;
+    // The latest for each distinct layout, stages and range.
+    std::vector<size_t> push_constants;
+  };
+  // Returns false if the command sets state that can't be tracked, and the
+  // stream can't be executed in parallel.
+  bool UpdateStateCommands(StateCommands& state, size_t offset) const;
+  // Appends the offsets of the commands setting the current state, in the
+  // order they are in the stream, to parallel_state_commands_.
+  void AppendStateCommands(const StateCommands& state);
+  void ExecuteStateCommands(VkCommandBuffer command_buffer, size_t first,
+                            size_t count) const;
+
+  struct ParallelRenderPass {
+    // Offsets of the kVkBeginRenderPass and the kVkEndRenderPass commands.
+    size_t begin_offset;
+    size_t end_offset;
+    // Ranges in parallel_state_commands_ for restoring the state at the
+    // beginning of the render pass in the secondary command buffer, and at its
+    // end in the primary command buffer.
+    size_t state_before_first;
+    size_t state_before_count;
+    size_t state_after_first;
+    size_t state_after_count;
+    // Written by the recording thread, VK_NULL_HANDLE if failed to record the
+    // render pass, in which case it's recorded into the primary command
+    // buffer. Protected by recording_mutex_.
+    VkCommandBuffer secondary_command_buffer;
+    bool recorded;
+  };
+  // Returns false if nothing needs to be recorded in parallel.
+  bool PrepareParallelRenderPasses();
+  VkCommandBuffer RecordParallelRenderPass(const ParallelRenderPass& pass,
+                                           SecondaryCommandPool& pool,
+                                           size_t& pool_buffers_used) const;
+  void RecordingThread(uint32_t thread_index);
 
   const VulkanCommandProcessor& command_processor_;
 
   // uintmax_t to ensure uint64_t and pointer alignment of all structures.
   std::vector<uintmax_t> command_stream_;
+
+  std::vector<ParallelRenderPass> parallel_render_passes_;
+  std::vector<size_t> parallel_state_commands_;
+
+  uint32_t recording_thread_count_ = 0;
+  std::vector<std::unique_ptr<xe::threading::Thread>> recording_threads_;
+  std::mutex recording_mutex_;
+  std::condition_variable recording_request_cond_;
+  std::condition_variable recording_completion_cond_;
+  // Protected by recording_mutex_.
+  bool recording_threads_shutdown_ = false;
+  uint64_t recording_generation_ = 0;
+  size_t recording_render_pass_count_ = 0;
+  SecondaryCommandPool* recording_pools_ = nullptr;
 };
 
 }  // namespace vulkan
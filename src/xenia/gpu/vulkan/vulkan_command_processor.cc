@@ -18,10 +18,15 @@
 #include <utility>
 
 #include "xenia/base/assert.h"
+#include "xenia/base/bit_range.h"
 #include "xenia/base/byte_order.h"
+#include "xenia/base/clock.h"
+#include "xenia/base/cvar.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
+#include "xenia/base/memory.h"
 #include "xenia/base/profiling.h"
+#include "xenia/base/threading.h"
 #include "xenia/gpu/draw_util.h"
 #include "xenia/gpu/gpu_flags.h"
 #include "xenia/gpu/registers.h"
@@ -36,6 +41,22 @@
 #include "xenia/ui/vulkan/vulkan_provider.h"
 #include "xenia/ui/vulkan/vulkan_util.h"
 
+DEFINE_int32(
+    vulkan_command_recording_threads, 0,
+    "Number of threads recording the contents of render passes with many draws "
+    "into secondary command buffers in parallel when a submission is ended. "
+    "-1 to calculate automatically (half of logical CPU cores), a positive "
+    "number to specify the number of threads explicitly (up to the number of "
+    "logical CPU cores), 0 to record everything on the command processor "
+    "thread.",
+    "Vulkan");
+DEFINE_bool(
+    vulkan_synchronization2, true,
+    "Use VK_KHR_synchronization2 if available to submit pipeline barriers with "
+    "the pipeline stages of each individual resource barrier, rather than with "
+    "the stages of all barriers submitted together.",
+    "Vulkan");
+
 namespace xe {
 namespace gpu {
 namespace vulkan {
@@ -95,6 +116,15 @@ void VulkanCommandProcessor::ClearCaches() {
   cache_clear_requested_ = true;
 }
 
+void VulkanCommandProcessor::InitializeShaderStorage(
+    const std::filesystem::path& cache_root, uint32_t title_id, bool blocking) {
+  CommandProcessor::InitializeShaderStorage(cache_root, title_id, blocking);
+  if (cvars::store_shaders) {
+    pipeline_cache_->InitializeShaderStorage(cache_root, title_id, blocking);
+  }
+  texture_cache_->InitializeStorage(cache_root, title_id);
+}
+
 void VulkanCommandProcessor::TracePlaybackWroteMemory(uint32_t base_ptr,
                                                       uint32_t length) {
   shared_memory_->MemoryInvalidationCallback(base_ptr, length, true);
@@ -169,6 +199,86 @@ bool VulkanCommandProcessor::SetupContext() {
                          size_t(16384)),
                 size_t(uniform_buffer_alignment)));
 
+  // Track the submission completion with a timeline semaphore if available,
+  // with fences otherwise.
+  if (provider.device_extensions().khr_timeline_semaphore &&
+      provider.device_timeline_semaphore_features().timelineSemaphore) {
+    VkSemaphoreTypeCreateInfoKHR semaphore_type_create_info;
+    semaphore_type_create_info.sType =
+        VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+    semaphore_type_create_info.pNext = nullptr;
+    semaphore_type_create_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+    // The index of the last completed submission.
+    semaphore_type_create_info.initialValue = submission_completed_;
+    VkSemaphoreCreateInfo semaphore_create_info;
+    semaphore_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    semaphore_create_info.pNext = &semaphore_type_create_info;
+    semaphore_create_info.flags = 0;
+    if (dfn.vkCreateSemaphore(device, &semaphore_create_info, nullptr,
+                              &submission_timeline_semaphore_) != VK_SUCCESS) {
+      XELOGW(
+          "Failed to create the Vulkan submission timeline semaphore, using "
+          "fences for submission tracking");
+      submission_timeline_semaphore_ = VK_NULL_HANDLE;
+    }
+  }
+
+  // Not critical for the emulation, only for statistics.
+  uint32_t timestamp_valid_bits =
+      provider.queue_families()[provider.queue_family_graphics_compute()]
+          .timestamp_valid_bits;
+  if (timestamp_valid_bits) {
+    VkQueryPoolCreateInfo timestamp_query_pool_create_info;
+    timestamp_query_pool_create_info.sType =
+        VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    timestamp_query_pool_create_info.pNext = nullptr;
+    timestamp_query_pool_create_info.flags = 0;
+    timestamp_query_pool_create_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    timestamp_query_pool_create_info.queryCount =
+        2 * kTimestampQuerySubmissions;
+    timestamp_query_pool_create_info.pipelineStatistics = 0;
+    if (dfn.vkCreateQueryPool(device, &timestamp_query_pool_create_info,
+                              nullptr,
+                              &timestamp_query_pool_) == VK_SUCCESS) {
+      timestamp_valid_mask_ = timestamp_valid_bits >= 64
+                                  ? UINT64_MAX
+                                  : (UINT64_C(1) << timestamp_valid_bits) - 1;
+    } else {
+      XELOGW(
+          "Failed to create the Vulkan timestamp query pool, the host GPU "
+          "time of submissions won't be measured");
+      timestamp_query_pool_ = VK_NULL_HANDLE;
+    }
+  }
+
+  synchronization2_ =
+      cvars::vulkan_synchronization2 &&
+      provider.device_extensions().khr_synchronization2 &&
+      provider.device_synchronization2_features().synchronization2;
+
+  // Without the queries, fake sample counts are used.
+  VkQueryPoolCreateInfo occlusion_query_pool_create_info;
+  occlusion_query_pool_create_info.sType =
+      VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+  occlusion_query_pool_create_info.pNext = nullptr;
+  occlusion_query_pool_create_info.flags = 0;
+  occlusion_query_pool_create_info.queryType = VK_QUERY_TYPE_OCCLUSION;
+  occlusion_query_pool_create_info.queryCount = kOcclusionQueryHostCount;
+  occlusion_query_pool_create_info.pipelineStatistics = 0;
+  if (dfn.vkCreateQueryPool(device, &occlusion_query_pool_create_info,
+                            nullptr,
+                            &occlusion_query_pool_) == VK_SUCCESS) {
+    occlusion_query_control_flags_ =
+        provider.device_features().occlusionQueryPrecise
+            ? VK_QUERY_CONTROL_PRECISE_BIT
+            : 0;
+  } else {
+    XELOGW(
+        "Failed to create the Vulkan occlusion query pool, fake sample counts "
+        "will be reported");
+    occlusion_query_pool_ = VK_NULL_HANDLE;
+  }
+
   // Descriptor set layouts that don't depend on the setup of other subsystems.
   VkShaderStageFlags guest_shader_stages =
       guest_shader_vertex_stages_ | VK_SHADER_STAGE_FRAGMENT_BIT;
@@ -1034,6 +1144,23 @@ bool VulkanCommandProcessor::SetupContext() {
   // Just not to expose uninitialized memory.
   std::memset(&system_constants_, 0, sizeof(system_constants_));
 
+  if (cvars::vulkan_command_recording_threads != 0) {
+    uint32_t logical_processor_count = xe::threading::logical_processor_count();
+    if (!logical_processor_count) {
+      // Pick some reasonable amount if couldn't determine the number of cores.
+      logical_processor_count = 6;
+    }
+    uint32_t recording_thread_count;
+    if (cvars::vulkan_command_recording_threads < 0) {
+      recording_thread_count = std::max(logical_processor_count / 2, 1u);
+    } else {
+      recording_thread_count =
+          std::min(uint32_t(cvars::vulkan_command_recording_threads),
+                   logical_processor_count);
+    }
+    deferred_command_buffer_.InitializeRecordingThreads(recording_thread_count);
+  }
+
   return true;
 }
 
@@ -1132,13 +1259,14 @@ void VulkanCommandProcessor::ShutdownContext() {
   sparse_buffer_binds_.clear();
   sparse_memory_binds_.clear();
 
+  deferred_command_buffer_.ShutdownRecordingThreads();
   deferred_command_buffer_.Reset();
   for (const auto& command_buffer_pair : command_buffers_submitted_) {
-    dfn.vkDestroyCommandPool(device, command_buffer_pair.second.pool, nullptr);
+    DestroyCommandBuffer(command_buffer_pair.second);
   }
   command_buffers_submitted_.clear();
   for (const CommandBuffer& command_buffer : command_buffers_writable_) {
-    dfn.vkDestroyCommandPool(device, command_buffer.pool, nullptr);
+    DestroyCommandBuffer(command_buffer);
   }
   command_buffers_writable_.clear();
 
@@ -1168,6 +1296,9 @@ void VulkanCommandProcessor::ShutdownContext() {
     dfn.vkDestroyFence(device, fence, nullptr);
   }
   submissions_in_flight_fences_.clear();
+  ui::vulkan::util::DestroyAndNullHandle(dfn.vkDestroySemaphore, device,
+                                         submission_timeline_semaphore_);
+  submissions_in_flight_timeline_ = 0;
   current_submission_wait_stage_masks_.clear();
   for (VkSemaphore semaphore : current_submission_wait_semaphores_) {
     dfn.vkDestroySemaphore(device, semaphore, nullptr);
@@ -1176,6 +1307,21 @@ void VulkanCommandProcessor::ShutdownContext() {
   submission_completed_ = 0;
   submission_open_ = false;
 
+  occlusion_queries_.clear();
+  occlusion_query_active_ = false;
+  occlusion_query_host_active_ = false;
+  occlusion_query_host_next_ = 0;
+  occlusion_query_host_used_ = 0;
+  ui::vulkan::util::DestroyAndNullHandle(dfn.vkDestroyQueryPool, device,
+                                         occlusion_query_pool_);
+
+  ui::vulkan::util::DestroyAndNullHandle(dfn.vkDestroyQueryPool, device,
+                                         timestamp_query_pool_);
+  timestamp_valid_mask_ = 0;
+  profiler_gpu_timeline_ = Profiler::kGpuTimelineInvalid;
+  std::memset(timestamp_query_submissions_, 0,
+              sizeof(timestamp_query_submissions_));
+
   for (VkSemaphore semaphore : semaphores_free_) {
     dfn.vkDestroySemaphore(device, semaphore, nullptr);
   }
@@ -1190,40 +1336,52 @@ void VulkanCommandProcessor::ShutdownContext() {
   CommandProcessor::ShutdownContext();
 }
 
-void VulkanCommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
-  CommandProcessor::WriteRegister(index, value);
-
-  if (index >= XE_GPU_REG_SHADER_CONSTANT_000_X &&
-      index <= XE_GPU_REG_SHADER_CONSTANT_511_W) {
+void VulkanCommandProcessor::OnShaderConstantsWritten(uint32_t first_index,
+                                                      uint32_t count) {
+  uint32_t last_index = first_index + count - 1;
+  if (first_index >= XE_GPU_REG_SHADER_CONSTANT_000_X &&
+      last_index <= XE_GPU_REG_SHADER_CONSTANT_511_W) {
     if (frame_open_) {
-      uint32_t float_constant_index =
-          (index - XE_GPU_REG_SHADER_CONSTANT_000_X) >> 2;
-      if (float_constant_index >= 256) {
-        float_constant_index -= 256;
-        if (current_float_constant_map_pixel_[float_constant_index >> 6] &
-            (1ull << (float_constant_index & 63))) {
+      // Check whole 64-bit blocks of the used constant maps at once.
+      uint32_t float_constant_first =
+          (first_index - XE_GPU_REG_SHADER_CONSTANT_000_X) >> 2;
+      uint32_t float_constant_last =
+          (last_index - XE_GPU_REG_SHADER_CONSTANT_000_X) >> 2;
+      if (float_constant_first < 256 &&
+          xe::bit_range::AnyInRange(
+              current_float_constant_map_vertex_, float_constant_first,
+              std::min(float_constant_last, uint32_t(255)) + 1 -
+                  float_constant_first)) {
+        current_constant_buffers_up_to_date_ &= ~(
+            UINT32_C(1) << SpirvShaderTranslator::kConstantBufferFloatVertex);
+      }
+      if (float_constant_last >= 256) {
+        uint32_t float_constant_pixel_first =
+            std::max(float_constant_first, uint32_t(256)) - 256;
+        if (xe::bit_range::AnyInRange(
+                current_float_constant_map_pixel_, float_constant_pixel_first,
+                float_constant_last - 256 + 1 - float_constant_pixel_first)) {
           current_constant_buffers_up_to_date_ &= ~(
               UINT32_C(1) << SpirvShaderTranslator::kConstantBufferFloatPixel);
         }
-      } else {
-        if (current_float_constant_map_vertex_[float_constant_index >> 6] &
-            (1ull << (float_constant_index & 63))) {
-          current_constant_buffers_up_to_date_ &= ~(
-              UINT32_C(1) << SpirvShaderTranslator::kConstantBufferFloatVertex);
-        }
       }
     }
-  } else if (index >= XE_GPU_REG_SHADER_CONSTANT_BOOL_000_031 &&
-             index <= XE_GPU_REG_SHADER_CONSTANT_LOOP_31) {
+  } else if (first_index >= XE_GPU_REG_SHADER_CONSTANT_BOOL_000_031 &&
+             last_index <= XE_GPU_REG_SHADER_CONSTANT_LOOP_31) {
     current_constant_buffers_up_to_date_ &=
         ~(UINT32_C(1) << SpirvShaderTranslator::kConstantBufferBoolLoop);
-  } else if (index >= XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0 &&
-             index <= XE_GPU_REG_SHADER_CONSTANT_FETCH_31_5) {
+  } else if (first_index >= XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0 &&
+             last_index <= XE_GPU_REG_SHADER_CONSTANT_FETCH_31_5) {
     current_constant_buffers_up_to_date_ &=
         ~(UINT32_C(1) << SpirvShaderTranslator::kConstantBufferFetch);
     if (texture_cache_) {
-      texture_cache_->TextureFetchConstantWritten(
-          (index - XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) / 6);
+      uint32_t fetch_constant_last =
+          (last_index - XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) / 6;
+      for (uint32_t i =
+               (first_index - XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) / 6;
+           i <= fetch_constant_last; ++i) {
+        texture_cache_->TextureFetchConstantWritten(i);
+      }
     }
   }
 }
@@ -1602,8 +1760,9 @@ bool VulkanCommandProcessor::PushBufferMemoryBarrier(
 
   // Separate different barriers for overlapping buffer ranges into different
   // pipeline barrier commands.
-  for (const VkBufferMemoryBarrier& other_buffer_memory_barrier :
-       pending_barriers_buffer_memory_barriers_) {
+  for (size_t i = 0; i < pending_barriers_buffer_memory_barriers_.size(); ++i) {
+    const VkBufferMemoryBarrier& other_buffer_memory_barrier =
+        pending_barriers_buffer_memory_barriers_[i];
     if (other_buffer_memory_barrier.buffer != buffer ||
         (size != VK_WHOLE_SIZE &&
          offset + size <= other_buffer_memory_barrier.offset) ||
@@ -1624,14 +1783,27 @@ bool VulkanCommandProcessor::PushBufferMemoryBarrier(
       // The barrier is already pending.
       current_pending_barrier_.src_stage_mask |= src_stage_mask;
       current_pending_barrier_.dst_stage_mask |= dst_stage_mask;
+      PendingBarrierStages& other_stages =
+          pending_barriers_buffer_memory_barrier_stages_[i];
+      other_stages.src_stage_mask |= src_stage_mask;
+      other_stages.dst_stage_mask |= dst_stage_mask;
       return true;
     }
+    if (i < current_pending_barrier_.buffer_memory_barriers_offset) {
+      // Already in an earlier pipeline barrier command, thus ordered before
+      // the new barrier.
+      continue;
+    }
     SplitPendingBarrier();
     break;
   }
 
   current_pending_barrier_.src_stage_mask |= src_stage_mask;
   current_pending_barrier_.dst_stage_mask |= dst_stage_mask;
+  PendingBarrierStages& buffer_memory_barrier_stages =
+      pending_barriers_buffer_memory_barrier_stages_.emplace_back();
+  buffer_memory_barrier_stages.src_stage_mask = src_stage_mask;
+  buffer_memory_barrier_stages.dst_stage_mask = dst_stage_mask;
   VkBufferMemoryBarrier& buffer_memory_barrier =
       pending_barriers_buffer_memory_barriers_.emplace_back();
   buffer_memory_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
@@ -1661,8 +1833,9 @@ bool VulkanCommandProcessor::PushImageMemoryBarrier(
 
   // Separate different barriers for overlapping image subresource ranges into
   // different pipeline barrier commands.
-  for (const VkImageMemoryBarrier& other_image_memory_barrier :
-       pending_barriers_image_memory_barriers_) {
+  for (size_t i = 0; i < pending_barriers_image_memory_barriers_.size(); ++i) {
+    const VkImageMemoryBarrier& other_image_memory_barrier =
+        pending_barriers_image_memory_barriers_[i];
     if (other_image_memory_barrier.image != image ||
         !(other_image_memory_barrier.subresourceRange.aspectMask &
           subresource_range.aspectMask) ||
@@ -1705,14 +1878,27 @@ bool VulkanCommandProcessor::PushImageMemoryBarrier(
       // The barrier is already pending.
       current_pending_barrier_.src_stage_mask |= src_stage_mask;
       current_pending_barrier_.dst_stage_mask |= dst_stage_mask;
+      PendingBarrierStages& other_stages =
+          pending_barriers_image_memory_barrier_stages_[i];
+      other_stages.src_stage_mask |= src_stage_mask;
+      other_stages.dst_stage_mask |= dst_stage_mask;
       return true;
     }
+    if (i < current_pending_barrier_.image_memory_barriers_offset) {
+      // Already in an earlier pipeline barrier command, thus ordered before
+      // the new barrier.
+      continue;
+    }
     SplitPendingBarrier();
     break;
   }
 
   current_pending_barrier_.src_stage_mask |= src_stage_mask;
   current_pending_barrier_.dst_stage_mask |= dst_stage_mask;
+  PendingBarrierStages& image_memory_barrier_stages =
+      pending_barriers_image_memory_barrier_stages_.emplace_back();
+  image_memory_barrier_stages.src_stage_mask = src_stage_mask;
+  image_memory_barrier_stages.dst_stage_mask = dst_stage_mask;
   VkImageMemoryBarrier& image_memory_barrier =
       pending_barriers_image_memory_barriers_.emplace_back();
   image_memory_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
@@ -1738,49 +1924,132 @@ bool VulkanCommandProcessor::SubmitBarriers(bool force_end_render_pass) {
     return false;
   }
   EndRenderPass();
+  statistics_.Add(GpuStatistics::Counter::kBarrierCommands,
+                  pending_barriers_.size());
+  statistics_.Add(GpuStatistics::Counter::kBarriers,
+                  pending_barriers_buffer_memory_barriers_.size() +
+                      pending_barriers_image_memory_barriers_.size());
+  if (synchronization2_) {
+    barriers_2_buffer_memory_barriers_.clear();
+    barriers_2_buffer_memory_barriers_.reserve(
+        pending_barriers_buffer_memory_barriers_.size());
+    for (size_t i = 0; i < pending_barriers_buffer_memory_barriers_.size();
+         ++i) {
+      const VkBufferMemoryBarrier& buffer_memory_barrier =
+          pending_barriers_buffer_memory_barriers_[i];
+      const PendingBarrierStages& buffer_memory_barrier_stages =
+          pending_barriers_buffer_memory_barrier_stages_[i];
+      VkBufferMemoryBarrier2KHR& buffer_memory_barrier_2 =
+          barriers_2_buffer_memory_barriers_.emplace_back();
+      buffer_memory_barrier_2.sType =
+          VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR;
+      buffer_memory_barrier_2.pNext = nullptr;
+      // The synchronization2 stage and access flags are the same as the
+      // original ones in the lower 32 bits, and a zero stage mask means no
+      // stages rather than being invalid.
+      buffer_memory_barrier_2.srcStageMask =
+          buffer_memory_barrier_stages.src_stage_mask;
+      buffer_memory_barrier_2.srcAccessMask =
+          buffer_memory_barrier.srcAccessMask;
+      buffer_memory_barrier_2.dstStageMask =
+          buffer_memory_barrier_stages.dst_stage_mask;
+      buffer_memory_barrier_2.dstAccessMask =
+          buffer_memory_barrier.dstAccessMask;
+      buffer_memory_barrier_2.srcQueueFamilyIndex =
+          buffer_memory_barrier.srcQueueFamilyIndex;
+      buffer_memory_barrier_2.dstQueueFamilyIndex =
+          buffer_memory_barrier.dstQueueFamilyIndex;
+      buffer_memory_barrier_2.buffer = buffer_memory_barrier.buffer;
+      buffer_memory_barrier_2.offset = buffer_memory_barrier.offset;
+      buffer_memory_barrier_2.size = buffer_memory_barrier.size;
+    }
+    barriers_2_image_memory_barriers_.clear();
+    barriers_2_image_memory_barriers_.reserve(
+        pending_barriers_image_memory_barriers_.size());
+    for (size_t i = 0; i < pending_barriers_image_memory_barriers_.size();
+         ++i) {
+      const VkImageMemoryBarrier& image_memory_barrier =
+          pending_barriers_image_memory_barriers_[i];
+      const PendingBarrierStages& image_memory_barrier_stages =
+          pending_barriers_image_memory_barrier_stages_[i];
+      VkImageMemoryBarrier2KHR& image_memory_barrier_2 =
+          barriers_2_image_memory_barriers_.emplace_back();
+      image_memory_barrier_2.sType =
+          VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+      image_memory_barrier_2.pNext = nullptr;
+      image_memory_barrier_2.srcStageMask =
+          image_memory_barrier_stages.src_stage_mask;
+      image_memory_barrier_2.srcAccessMask = image_memory_barrier.srcAccessMask;
+      image_memory_barrier_2.dstStageMask =
+          image_memory_barrier_stages.dst_stage_mask;
+      image_memory_barrier_2.dstAccessMask = image_memory_barrier.dstAccessMask;
+      image_memory_barrier_2.oldLayout = image_memory_barrier.oldLayout;
+      image_memory_barrier_2.newLayout = image_memory_barrier.newLayout;
+      image_memory_barrier_2.srcQueueFamilyIndex =
+          image_memory_barrier.srcQueueFamilyIndex;
+      image_memory_barrier_2.dstQueueFamilyIndex =
+          image_memory_barrier.dstQueueFamilyIndex;
+      image_memory_barrier_2.image = image_memory_barrier.image;
+      image_memory_barrier_2.subresourceRange =
+          image_memory_barrier.subresourceRange;
+    }
+  }
   for (auto it = pending_barriers_.cbegin(); it != pending_barriers_.cend();
        ++it) {
     auto it_next = std::next(it);
     bool is_last = it_next == pending_barriers_.cend();
-    // .data() + offset, not &[offset], for buffer and image barriers, because
-    // if there are no buffer or image memory barriers in the last pipeline
-    // barriers, the offsets may be equal to the sizes of the vectors.
-    deferred_command_buffer_.CmdVkPipelineBarrier(
-        it->src_stage_mask ? it->src_stage_mask
-                           : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-        it->dst_stage_mask ? it->dst_stage_mask
-                           : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-        0, 0, nullptr,
+    uint32_t buffer_memory_barrier_count =
         uint32_t((is_last ? pending_barriers_buffer_memory_barriers_.size()
                           : it_next->buffer_memory_barriers_offset) -
-                 it->buffer_memory_barriers_offset),
-        pending_barriers_buffer_memory_barriers_.data() +
-            it->buffer_memory_barriers_offset,
+                 it->buffer_memory_barriers_offset);
+    uint32_t image_memory_barrier_count =
         uint32_t((is_last ? pending_barriers_image_memory_barriers_.size()
                           : it_next->image_memory_barriers_offset) -
-                 it->image_memory_barriers_offset),
-        pending_barriers_image_memory_barriers_.data() +
-            it->image_memory_barriers_offset);
+                 it->image_memory_barriers_offset);
+    // .data() + offset, not &[offset], for buffer and image barriers, because
+    // if there are no buffer or image memory barriers in the last pipeline
+    // barriers, the offsets may be equal to the sizes of the vectors.
+    if (synchronization2_) {
+      deferred_command_buffer_.CmdVkPipelineBarrier2(
+          0, buffer_memory_barrier_count,
+          barriers_2_buffer_memory_barriers_.data() +
+              it->buffer_memory_barriers_offset,
+          image_memory_barrier_count,
+          barriers_2_image_memory_barriers_.data() +
+              it->image_memory_barriers_offset);
+    } else {
+      deferred_command_buffer_.CmdVkPipelineBarrier(
+          it->src_stage_mask ? it->src_stage_mask
+                             : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+          it->dst_stage_mask ? it->dst_stage_mask
+                             : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+          0, 0, nullptr, buffer_memory_barrier_count,
+          pending_barriers_buffer_memory_barriers_.data() +
+              it->buffer_memory_barriers_offset,
+          image_memory_barrier_count,
+          pending_barriers_image_memory_barriers_.data() +
+              it->image_memory_barriers_offset);
+    }
   }
   pending_barriers_.clear();
   pending_barriers_buffer_memory_barriers_.clear();
   pending_barriers_image_memory_barriers_.clear();
+  pending_barriers_buffer_memory_barrier_stages_.clear();
+  pending_barriers_image_memory_barrier_stages_.clear();
   current_pending_barrier_.buffer_memory_barriers_offset = 0;
   current_pending_barrier_.image_memory_barriers_offset = 0;
   return true;
 }
 
-void VulkanCommandProcessor::SubmitBarriersAndEnterRenderTargetCacheRenderPass(
+bool VulkanCommandProcessor::SubmitBarriersAndEnterRenderTargetCacheRenderPass(
     VkRenderPass render_pass,
     const VulkanRenderTargetCache::Framebuffer* framebuffer) {
   SubmitBarriers(false);
   if (current_render_pass_ == render_pass &&
       current_framebuffer_ == framebuffer) {
-    return;
-  }
-  if (current_render_pass_ != VK_NULL_HANDLE) {
-    deferred_command_buffer_.CmdVkEndRenderPass();
+    return false;
   }
+  EndRenderPass();
   current_render_pass_ = render_pass;
   current_framebuffer_ = framebuffer;
   VkRenderPassBeginInfo render_pass_begin_info;
@@ -1797,10 +2066,211 @@ void VulkanCommandProcessor::SubmitBarriersAndEnterRenderTargetCacheRenderPass(
   render_pass_begin_info.pClearValues = nullptr;
   deferred_command_buffer_.CmdVkBeginRenderPass(&render_pass_begin_info,
                                                 VK_SUBPASS_CONTENTS_INLINE);
+  return true;
+}
+
+void VulkanCommandProcessor::
+    SubmitBarriersAndEnterRenderTargetCacheDynamicRendering() {
+  SubmitBarriers(false);
+  VulkanRenderTargetCache::RenderPassKey key =
+      render_target_cache_->last_update_render_pass_key();
+  const VkImageView* views =
+      render_target_cache_->last_update_dynamic_rendering_views();
+  VkExtent2D extent =
+      render_target_cache_->last_update_dynamic_rendering_extent();
+  if (current_dynamic_rendering_ && current_dynamic_rendering_key_ == key &&
+      !std::memcmp(current_dynamic_rendering_views_, views,
+                   sizeof(current_dynamic_rendering_views_)) &&
+      current_dynamic_rendering_extent_.width == extent.width &&
+      current_dynamic_rendering_extent_.height == extent.height) {
+    return;
+  }
+  EndRenderPass();
+  current_dynamic_rendering_ = true;
+  current_dynamic_rendering_key_ = key;
+  std::memcpy(current_dynamic_rendering_views_, views,
+              sizeof(current_dynamic_rendering_views_));
+  current_dynamic_rendering_extent_ = extent;
+
+  VkRenderingAttachmentInfoKHR
+      color_attachments[xenos::kMaxColorRenderTargets];
+  VkRenderingAttachmentInfoKHR depth_stencil_attachment;
+  uint32_t color_attachment_count =
+      render_target_cache_->GetLastUpdateDynamicRenderingAttachments(
+          color_attachments, depth_stencil_attachment);
+  bool depth_stencil_used = (key.depth_and_color_used & 0b1) != 0;
+
+  VkRenderingInfoKHR rendering_info;
+  rendering_info.sType = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+  rendering_info.pNext = nullptr;
+  rendering_info.flags = 0;
+  rendering_info.renderArea.offset.x = 0;
+  rendering_info.renderArea.offset.y = 0;
+  // TODO(Triang3l): Actual dirty width / height in the deferred command
+  // buffer.
+  rendering_info.renderArea.extent = extent;
+  rendering_info.layerCount = 1;
+  rendering_info.viewMask = 0;
+  rendering_info.colorAttachmentCount = color_attachment_count;
+  rendering_info.pColorAttachments = color_attachments;
+  rendering_info.pDepthAttachment =
+      depth_stencil_used ? &depth_stencil_attachment : nullptr;
+  rendering_info.pStencilAttachment =
+      depth_stencil_used ? &depth_stencil_attachment : nullptr;
+  deferred_command_buffer_.CmdVkBeginRendering(&rendering_info);
+}
+
+bool VulkanCommandProcessor::BeginOcclusionQuery() {
+  assert_false(occlusion_query_active_);
+  if (occlusion_query_pool_ == VK_NULL_HANDLE) {
+    return false;
+  }
+  // Before beginning the submission as this may end it.
+  FreeOcclusionQueryHost();
+  occlusion_queries_.emplace_back();
+  occlusion_query_active_ = true;
+  if (!BeginSubmission(true)) {
+    occlusion_queries_.pop_back();
+    occlusion_query_active_ = false;
+    return false;
+  }
+  // Not begun yet if the submission was already open.
+  if (!occlusion_query_host_active_) {
+    BeginOcclusionQueryHost();
+  }
+  return true;
+}
+
+void VulkanCommandProcessor::EndOcclusionQuery() {
+  assert_true(occlusion_query_active_);
+  EndOcclusionQueryHost();
+  occlusion_query_active_ = false;
+}
+
+bool VulkanCommandProcessor::GetOcclusionQueryResult(
+    bool await, uint64_t& sample_count_out) {
+  if (occlusion_queries_.size() <= size_t(occlusion_query_active_)) {
+    return false;
+  }
+  OcclusionQuery& query = occlusion_queries_.front();
+  if (query.host_query_count) {
+    if (!await) {
+      if (submission_completed_ < query.submission) {
+        CheckSubmissionFenceAndDeviceLoss(0);
+      }
+      if (submission_completed_ < query.submission) {
+        return false;
+      }
+    }
+    ReadOcclusionQueryHostResults(query);
+  }
+  // Samples are counted at the host resolution.
+  sample_count_out = query.sample_count /
+                     (texture_cache_->draw_resolution_scale_x() *
+                      texture_cache_->draw_resolution_scale_y());
+  occlusion_queries_.pop_front();
+  return true;
+}
+
+void VulkanCommandProcessor::BeginOcclusionQueryHost() {
+  assert_true(submission_open_);
+  assert_true(occlusion_query_active_);
+  assert_false(occlusion_query_host_active_);
+  FreeOcclusionQueryHost();
+  OcclusionQuery& query = occlusion_queries_.back();
+  if (!query.host_query_count) {
+    query.host_query_first = occlusion_query_host_next_;
+  }
+  ++query.host_query_count;
+  query.submission = GetCurrentSubmission();
+  // Queries in a render pass must be ended in the same subpass, and the
+  // render pass is split at submission boundaries.
+  SubmitBarriers(true);
+  deferred_command_buffer_.CmdVkResetQueryPool(
+      occlusion_query_pool_, occlusion_query_host_next_, 1);
+  deferred_command_buffer_.CmdVkBeginQuery(occlusion_query_pool_,
+                                           occlusion_query_host_next_,
+                                           occlusion_query_control_flags_);
+  occlusion_query_host_next_ =
+      (occlusion_query_host_next_ + 1) % kOcclusionQueryHostCount;
+  ++occlusion_query_host_used_;
+  occlusion_query_host_active_ = true;
+}
+
+void VulkanCommandProcessor::EndOcclusionQueryHost() {
+  if (!occlusion_query_host_active_) {
+    return;
+  }
+  const OcclusionQuery& query = occlusion_queries_.back();
+  EndRenderPass();
+  deferred_command_buffer_.CmdVkEndQuery(
+      occlusion_query_pool_,
+      (query.host_query_first + query.host_query_count - 1) %
+          kOcclusionQueryHostCount);
+  occlusion_query_host_active_ = false;
+}
+
+void VulkanCommandProcessor::ReadOcclusionQueryHostResults(
+    OcclusionQuery& query) {
+  if (!query.host_query_count) {
+    return;
+  }
+  // Ends the host query if it's in the current submission.
+  CheckSubmissionFenceAndDeviceLoss(query.submission);
+  if (occlusion_query_host_active_ && &query == &occlusion_queries_.back()) {
+    // Failed to end the submission, can't read the host query being counted.
+    return;
+  }
+  if (submission_completed_ >= query.submission) {
+    const ui::vulkan::VulkanProvider& provider = GetVulkanProvider();
+    const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
+    VkDevice device = provider.device();
+    // Up to two ranges if wrapping around.
+    uint32_t host_query = query.host_query_first;
+    uint32_t host_queries_remaining = query.host_query_count;
+    while (host_queries_remaining) {
+      uint64_t results[64];
+      uint32_t host_query_count =
+          std::min(std::min(host_queries_remaining,
+                            kOcclusionQueryHostCount - host_query),
+                   uint32_t(xe::countof(results)));
+      if (dfn.vkGetQueryPoolResults(
+              device, occlusion_query_pool_, host_query, host_query_count,
+              sizeof(uint64_t) * host_query_count, results, sizeof(uint64_t),
+              VK_QUERY_RESULT_64_BIT) == VK_SUCCESS) {
+        for (uint32_t i = 0; i < host_query_count; ++i) {
+          query.sample_count += results[i];
+        }
+      }
+      host_query = (host_query + host_query_count) % kOcclusionQueryHostCount;
+      host_queries_remaining -= host_query_count;
+    }
+  }
+  // If failed to await, such as because of the device loss, the samples are
+  // dropped.
+  query.host_query_first =
+      (query.host_query_first + query.host_query_count) %
+      kOcclusionQueryHostCount;
+  occlusion_query_host_used_ -= query.host_query_count;
+  query.host_query_count = 0;
+}
+
+void VulkanCommandProcessor::FreeOcclusionQueryHost() {
+  for (OcclusionQuery& query : occlusion_queries_) {
+    if (occlusion_query_host_used_ < kOcclusionQueryHostCount) {
+      break;
+    }
+    ReadOcclusionQueryHostResults(query);
+  }
 }
 
 void VulkanCommandProcessor::EndRenderPass() {
   assert_true(submission_open_);
+  if (current_dynamic_rendering_) {
+    deferred_command_buffer_.CmdVkEndRendering();
+    current_dynamic_rendering_ = false;
+    return;
+  }
   if (current_render_pass_ == VK_NULL_HANDLE) {
     return;
   }
@@ -2088,13 +2558,23 @@ void VulkanCommandProcessor::BindExternalGraphicsPipeline(
     dynamic_stencil_reference_front_update_needed_ = true;
     dynamic_stencil_reference_back_update_needed_ = true;
   }
+  // Static in all external pipelines.
+  dynamic_cull_mode_update_needed_ = true;
+  dynamic_front_face_update_needed_ = true;
+  dynamic_depth_test_enable_update_needed_ = true;
+  dynamic_depth_write_enable_update_needed_ = true;
+  dynamic_depth_compare_op_update_needed_ = true;
+  dynamic_stencil_test_enable_update_needed_ = true;
+  dynamic_stencil_op_front_update_needed_ = true;
+  dynamic_stencil_op_back_update_needed_ = true;
+  dynamic_primitive_restart_enable_update_needed_ = true;
   if (current_external_graphics_pipeline_ == pipeline) {
     return;
   }
   deferred_command_buffer_.CmdVkBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS,
                                              pipeline);
   current_external_graphics_pipeline_ = pipeline;
-  current_guest_graphics_pipeline_ = VK_NULL_HANDLE;
+  current_guest_graphics_pipeline_ = nullptr;
   current_guest_graphics_pipeline_layout_ = VK_NULL_HANDLE;
 }
 
@@ -2358,16 +2838,23 @@ bool VulkanCommandProcessor::IssueDraw(xenos::PrimitiveType prim_type,
   // Create the pipeline (for this, need the render pass from the render target
   // cache), translating the shaders - doing this now to obtain the used
   // textures.
-  VkPipeline pipeline;
+  void* pipeline_handle;
   const VulkanPipelineCache::PipelineLayoutProvider* pipeline_layout_provider;
+  VulkanPipelineCache::ExtendedDynamicState extended_dynamic_state;
   if (!pipeline_cache_->ConfigurePipeline(
           vertex_shader_translation, pixel_shader_translation,
           primitive_processing_result, normalized_depth_control,
           normalized_color_mask,
-          render_target_cache_->last_update_render_pass_key(), pipeline,
-          pipeline_layout_provider)) {
+          render_target_cache_->last_update_render_pass_key(), pipeline_handle,
+          pipeline_layout_provider, extended_dynamic_state)) {
     return false;
   }
+  if (pipeline_cache_->pending_pipeline_draw_policy() !=
+          VulkanPipelineCache::PendingPipelineDrawPolicy::kWait &&
+      !VulkanPipelineCache::IsPipelineCreated(pipeline_handle)) {
+    // Not an error - the draw will be done once the pipeline is created.
+    return true;
+  }
 
   // Update the textures before most other work in the submission because
   // samplers depend on this (and in case of sampler overflow in a submission,
@@ -2382,10 +2869,9 @@ bool VulkanCommandProcessor::IssueDraw(xenos::PrimitiveType prim_type,
   // Update the graphics pipeline, and if the new graphics pipeline has a
   // different layout, invalidate incompatible descriptor sets before updating
   // current_guest_graphics_pipeline_layout_.
-  if (current_guest_graphics_pipeline_ != pipeline) {
-    deferred_command_buffer_.CmdVkBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                               pipeline);
-    current_guest_graphics_pipeline_ = pipeline;
+  if (current_guest_graphics_pipeline_ != pipeline_handle) {
+    deferred_command_buffer_.BindGraphicsPipelineHandle(pipeline_handle);
+    current_guest_graphics_pipeline_ = pipeline_handle;
     current_external_graphics_pipeline_ = VK_NULL_HANDLE;
   }
   auto pipeline_layout =
@@ -2445,15 +2931,32 @@ bool VulkanCommandProcessor::IssueDraw(xenos::PrimitiveType prim_type,
   // life. Or even disregard the viewport bounds range in the fragment shader
   // interlocks case completely - apply the viewport and the scissor offset
   // directly to pixel address and to things like ps_param_gen.
-  draw_util::GetHostViewportInfo(
-      regs, 1, 1, false, device_limits.maxViewportDimensions[0],
-      device_limits.maxViewportDimensions[1], true, normalized_depth_control,
-      false, host_render_targets_used,
-      pixel_shader && pixel_shader->writes_depth(), viewport_info);
+  uint64_t draw_state_register_write_count =
+      this->draw_state_register_write_count();
+  bool pixel_shader_writes_depth = pixel_shader && pixel_shader->writes_depth();
+  LastDrawViewport& last_draw_viewport = last_draw_viewport_;
+  if (last_draw_viewport.valid &&
+      last_draw_viewport.draw_state_register_write_count ==
+          draw_state_register_write_count &&
+      last_draw_viewport.pixel_shader_writes_depth ==
+          pixel_shader_writes_depth) {
+    viewport_info = last_draw_viewport.viewport_info;
+  } else {
+    draw_util::GetHostViewportInfo(
+        regs, 1, 1, false, device_limits.maxViewportDimensions[0],
+        device_limits.maxViewportDimensions[1], true, normalized_depth_control,
+        false, host_render_targets_used, pixel_shader_writes_depth,
+        viewport_info);
+    last_draw_viewport.draw_state_register_write_count =
+        draw_state_register_write_count;
+    last_draw_viewport.pixel_shader_writes_depth = pixel_shader_writes_depth;
+    last_draw_viewport.viewport_info = viewport_info;
+    last_draw_viewport.valid = true;
+  }
 
   // Update dynamic graphics pipeline state.
   UpdateDynamicState(viewport_info, primitive_polygonal,
-                     normalized_depth_control);
+                     normalized_depth_control, extended_dynamic_state);
 
   auto vgt_draw_initiator = regs.Get<reg::VGT_DRAW_INITIATOR>();
 
@@ -2532,9 +3035,13 @@ bool VulkanCommandProcessor::IssueDraw(xenos::PrimitiveType prim_type,
   // After all commands that may dispatch, copy or insert barriers, submit the
   // barriers (may end the render pass), and (re)enter the render pass before
   // drawing.
-  SubmitBarriersAndEnterRenderTargetCacheRenderPass(
-      render_target_cache_->last_update_render_pass(),
-      render_target_cache_->last_update_framebuffer());
+  if (render_target_cache_->use_dynamic_rendering()) {
+    SubmitBarriersAndEnterRenderTargetCacheDynamicRendering();
+  } else {
+    SubmitBarriersAndEnterRenderTargetCacheRenderPass(
+        render_target_cache_->last_update_render_pass(),
+        render_target_cache_->last_update_framebuffer());
+  }
 
   // Draw.
   if (primitive_processing_result.index_buffer_type ==
@@ -2633,59 +3140,111 @@ void VulkanCommandProcessor::CheckSubmissionFenceAndDeviceLoss(
   const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
   VkDevice device = provider.device();
 
-  size_t fences_total = submissions_in_flight_fences_.size();
-  size_t fences_awaited = 0;
-  if (await_submission > submission_completed_) {
-    // Await in a blocking way if requested.
-    // TODO(Triang3l): Await only one fence. "Fence signal operations that are
-    // defined by vkQueueSubmit additionally include in the first
-    // synchronization scope all commands that occur earlier in submission
-    // order."
-    VkResult wait_result = dfn.vkWaitForFences(
-        device, uint32_t(await_submission - submission_completed_),
-        submissions_in_flight_fences_.data(), VK_TRUE, UINT64_MAX);
-    if (wait_result == VK_SUCCESS) {
-      fences_awaited += await_submission - submission_completed_;
-    } else {
-      XELOGE("Failed to await submission completion Vulkan fences");
-      if (wait_result == VK_ERROR_DEVICE_LOST) {
-        device_lost_ = true;
+  uint64_t submissions_completed = 0;
+  if (submission_timeline_semaphore_ != VK_NULL_HANDLE) {
+    // The semaphore is signaled with the index of each submission, which
+    // includes the completion of all the preceding ones, so one wait or one
+    // query is enough.
+    uint64_t timeline_completed = submission_completed_;
+    if (await_submission > submission_completed_) {
+      VkSemaphoreWaitInfoKHR semaphore_wait_info;
+      semaphore_wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+      semaphore_wait_info.pNext = nullptr;
+      semaphore_wait_info.flags = 0;
+      semaphore_wait_info.semaphoreCount = 1;
+      semaphore_wait_info.pSemaphores = &submission_timeline_semaphore_;
+      semaphore_wait_info.pValues = &await_submission;
+      VkResult wait_result =
+          dfn.vkWaitSemaphoresKHR(device, &semaphore_wait_info, UINT64_MAX);
+      if (wait_result == VK_SUCCESS) {
+        timeline_completed = await_submission;
+      } else {
+        XELOGE("Failed to await the Vulkan submission timeline semaphore");
+        if (wait_result == VK_ERROR_DEVICE_LOST) {
+          device_lost_ = true;
+        }
       }
     }
-  }
-  // Check how far into the submissions the GPU currently is, in order because
-  // submission themselves can be executed out of order, but Xenia serializes
-  // that for simplicity.
-  while (fences_awaited < fences_total) {
-    VkResult fence_status = dfn.vkWaitForFences(
-        device, 1, &submissions_in_flight_fences_[fences_awaited], VK_TRUE, 0);
-    if (fence_status != VK_SUCCESS) {
-      if (fence_status == VK_ERROR_DEVICE_LOST) {
+    if (!device_lost_) {
+      uint64_t timeline_value;
+      VkResult value_result = dfn.vkGetSemaphoreCounterValueKHR(
+          device, submission_timeline_semaphore_, &timeline_value);
+      if (value_result == VK_SUCCESS) {
+        timeline_completed = std::max(
+            timeline_completed,
+            std::min(timeline_value,
+                     submission_completed_ + submissions_in_flight_timeline_));
+      } else if (value_result == VK_ERROR_DEVICE_LOST) {
         device_lost_ = true;
       }
-      break;
     }
-    ++fences_awaited;
+    submissions_completed = timeline_completed - submission_completed_;
+  } else {
+    size_t fences_total = submissions_in_flight_fences_.size();
+    size_t fences_awaited = 0;
+    if (await_submission > submission_completed_) {
+      // Await in a blocking way if requested.
+      // TODO(Triang3l): Await only one fence. "Fence signal operations that
+      // are defined by vkQueueSubmit additionally include in the first
+      // synchronization scope all commands that occur earlier in submission
+      // order."
+      VkResult wait_result = dfn.vkWaitForFences(
+          device, uint32_t(await_submission - submission_completed_),
+          submissions_in_flight_fences_.data(), VK_TRUE, UINT64_MAX);
+      if (wait_result == VK_SUCCESS) {
+        fences_awaited += await_submission - submission_completed_;
+      } else {
+        XELOGE("Failed to await submission completion Vulkan fences");
+        if (wait_result == VK_ERROR_DEVICE_LOST) {
+          device_lost_ = true;
+        }
+      }
+    }
+    // Check how far into the submissions the GPU currently is, in order
+    // because submission themselves can be executed out of order, but Xenia
+    // serializes that for simplicity.
+    while (fences_awaited < fences_total) {
+      VkResult fence_status = dfn.vkWaitForFences(
+          device, 1, &submissions_in_flight_fences_[fences_awaited], VK_TRUE,
+          0);
+      if (fence_status != VK_SUCCESS) {
+        if (fence_status == VK_ERROR_DEVICE_LOST) {
+          device_lost_ = true;
+        }
+        break;
+      }
+      ++fences_awaited;
+    }
+    if (!device_lost_ && fences_awaited) {
+      // Reclaim fences.
+      fences_free_.reserve(fences_free_.size() + fences_awaited);
+      auto submissions_in_flight_fences_awaited_end =
+          submissions_in_flight_fences_.cbegin();
+      std::advance(submissions_in_flight_fences_awaited_end, fences_awaited);
+      fences_free_.insert(fences_free_.cend(),
+                          submissions_in_flight_fences_.cbegin(),
+                          submissions_in_flight_fences_awaited_end);
+      submissions_in_flight_fences_.erase(
+          submissions_in_flight_fences_.cbegin(),
+          submissions_in_flight_fences_awaited_end);
+    }
+    submissions_completed = fences_awaited;
   }
   if (device_lost_) {
     graphics_system_->OnHostGpuLossFromAnyThread(true);
     return;
   }
-  if (!fences_awaited) {
+  if (!submissions_completed) {
     // Not updated - no need to reclaim or download things.
     return;
   }
-  // Reclaim fences.
-  fences_free_.reserve(fences_free_.size() + fences_awaited);
-  auto submissions_in_flight_fences_awaited_end =
-      submissions_in_flight_fences_.cbegin();
-  std::advance(submissions_in_flight_fences_awaited_end, fences_awaited);
-  fences_free_.insert(fences_free_.cend(),
-                      submissions_in_flight_fences_.cbegin(),
-                      submissions_in_flight_fences_awaited_end);
-  submissions_in_flight_fences_.erase(submissions_in_flight_fences_.cbegin(),
-                                      submissions_in_flight_fences_awaited_end);
-  submission_completed_ += fences_awaited;
+  if (submission_timeline_semaphore_ != VK_NULL_HANDLE) {
+    submissions_in_flight_timeline_ -= submissions_completed;
+  }
+  submission_completed_ += submissions_completed;
+
+  ReportCompletedSubmissionStatistics(submission_completed_ -
+                                      submissions_completed);
 
   // Reclaim semaphores.
   while (!submissions_in_flight_semaphores_.empty()) {
@@ -2700,11 +3259,11 @@ void VulkanCommandProcessor::CheckSubmissionFenceAndDeviceLoss(
 
   // Reclaim command pools.
   while (!command_buffers_submitted_.empty()) {
-    const auto& command_buffer_pair = command_buffers_submitted_.front();
+    auto& command_buffer_pair = command_buffers_submitted_.front();
     if (command_buffer_pair.first > submission_completed_) {
       break;
     }
-    command_buffers_writable_.push_back(command_buffer_pair.second);
+    command_buffers_writable_.push_back(std::move(command_buffer_pair.second));
     command_buffers_submitted_.pop_front();
   }
 
@@ -2743,6 +3302,43 @@ void VulkanCommandProcessor::CheckSubmissionFenceAndDeviceLoss(
   }
 }
 
+void VulkanCommandProcessor::ReportCompletedSubmissionStatistics(
+    uint64_t submission_completed_before) {
+  const ui::vulkan::VulkanProvider& provider = GetVulkanProvider();
+  const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
+  VkDevice device = provider.device();
+  for (uint64_t submission = submission_completed_before + 1;
+       submission <= submission_completed_; ++submission) {
+    uint64_t gpu_time_ns = GpuStatistics::kGpuTimeUnknown;
+    uint32_t timestamp_query_pair =
+        uint32_t(submission % kTimestampQuerySubmissions);
+    uint64_t timestamps[2];
+    if (timestamp_query_pool_ != VK_NULL_HANDLE &&
+        timestamp_query_submissions_[timestamp_query_pair] == submission &&
+        dfn.vkGetQueryPoolResults(device, timestamp_query_pool_,
+                                  2 * timestamp_query_pair, 2,
+                                  sizeof(timestamps), timestamps,
+                                  sizeof(uint64_t),
+                                  VK_QUERY_RESULT_64_BIT) == VK_SUCCESS) {
+      float timestamp_period =
+          provider.device_properties().limits.timestampPeriod;
+      gpu_time_ns = uint64_t(
+          double((timestamps[1] - timestamps[0]) & timestamp_valid_mask_) *
+          double(timestamp_period));
+      if (profiler_gpu_timeline_ == Profiler::kGpuTimelineInvalid &&
+          Profiler::are_gpu_timelines_supported()) {
+        // Approximately, as the submission has been completed a bit earlier.
+        profiler_gpu_timeline_ = Profiler::CreateGpuTimeline(
+            Profiler::GpuTimelineType::kVulkan, "Graphics queue",
+            int64_t(timestamps[1]), timestamp_period);
+      }
+      Profiler::AddGpuZone(profiler_gpu_timeline_, "Submission",
+                           int64_t(timestamps[0]), int64_t(timestamps[1]));
+    }
+    statistics_.SubmissionCompleted(submission, gpu_time_ns);
+  }
+}
+
 bool VulkanCommandProcessor::BeginSubmission(bool is_guest_command) {
 #if XE_UI_VULKAN_FINE_GRAINED_DRAW_SCOPES
   SCOPE_profile_cpu_f("gpu");
@@ -2805,23 +3401,41 @@ bool VulkanCommandProcessor::BeginSubmission(bool is_guest_command) {
     dynamic_stencil_write_mask_back_update_needed_ = true;
     dynamic_stencil_reference_front_update_needed_ = true;
     dynamic_stencil_reference_back_update_needed_ = true;
+    dynamic_cull_mode_update_needed_ = true;
+    dynamic_front_face_update_needed_ = true;
+    dynamic_depth_test_enable_update_needed_ = true;
+    dynamic_depth_write_enable_update_needed_ = true;
+    dynamic_depth_compare_op_update_needed_ = true;
+    dynamic_stencil_test_enable_update_needed_ = true;
+    dynamic_stencil_op_front_update_needed_ = true;
+    dynamic_stencil_op_back_update_needed_ = true;
+    dynamic_primitive_restart_enable_update_needed_ = true;
     current_render_pass_ = VK_NULL_HANDLE;
     current_framebuffer_ = nullptr;
-    current_guest_graphics_pipeline_ = VK_NULL_HANDLE;
+    current_dynamic_rendering_ = false;
+    current_guest_graphics_pipeline_ = nullptr;
     current_external_graphics_pipeline_ = VK_NULL_HANDLE;
     current_external_compute_pipeline_ = VK_NULL_HANDLE;
     current_guest_graphics_pipeline_layout_ = nullptr;
     current_graphics_descriptor_sets_bound_up_to_date_ = 0;
 
+    shared_memory_->AllocatePredictedHostGpuMemory();
+
     primitive_processor_->BeginSubmission();
 
     texture_cache_->BeginSubmission(GetCurrentSubmission());
+
+    // Continue counting the samples for the occlusion query.
+    if (occlusion_query_active_) {
+      BeginOcclusionQueryHost();
+    }
   }
 
   if (is_opening_frame) {
     frame_open_ = true;
 
     // Reset bindings that depend on transient data.
+    float_constant_upload_cache_.Reset();
     std::memset(current_float_constant_map_vertex_, 0,
                 sizeof(current_float_constant_map_vertex_));
     std::memset(current_float_constant_map_pixel_, 0,
@@ -2898,7 +3512,11 @@ bool VulkanCommandProcessor::EndSubmission(bool is_swap) {
 
   // Make sure everything needed for submitting exist.
   if (submission_open_) {
-    if (fences_free_.empty()) {
+    // Make sure the CPU writes to the GPU-written memory can be caught.
+    shared_memory_->CommitRangesWrittenByGpu();
+
+    if (submission_timeline_semaphore_ == VK_NULL_HANDLE &&
+        fences_free_.empty()) {
       VkFenceCreateInfo fence_create_info;
       fence_create_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
       fence_create_info.pNext = nullptr;
@@ -2953,6 +3571,19 @@ bool VulkanCommandProcessor::EndSubmission(bool is_swap) {
         dfn.vkDestroyCommandPool(device, command_buffer.pool, nullptr);
         return false;
       }
+      // Secondary command buffers are allocated by the recording threads when
+      // needed, but must live as long as the primary command buffer.
+      command_buffer.secondary_pools.resize(
+          deferred_command_buffer_.recording_thread_count());
+      for (DeferredCommandBuffer::SecondaryCommandPool& secondary_pool :
+           command_buffer.secondary_pools) {
+        if (dfn.vkCreateCommandPool(device, &command_pool_create_info, nullptr,
+                                    &secondary_pool.pool) != VK_SUCCESS) {
+          XELOGE("Failed to create a Vulkan secondary command pool");
+          DestroyCommandBuffer(command_buffer);
+          return false;
+        }
+      }
       command_buffers_writable_.push_back(command_buffer);
     }
   }
@@ -2966,8 +3597,17 @@ bool VulkanCommandProcessor::EndSubmission(bool is_swap) {
   if (submission_open_) {
     assert_false(scratch_buffer_used_);
 
+    uint64_t pipeline_wait_start_time = Clock::QueryHostTickCount();
+    pipeline_cache_->EndSubmission();
+    statistics_.Add(GpuStatistics::Counter::kPipelineWaitMicros,
+                    (Clock::QueryHostTickCount() - pipeline_wait_start_time) *
+                        1000000 / Clock::QueryHostTickFrequency());
+
     EndRenderPass();
 
+    // Host queries can't span multiple command buffers.
+    EndOcclusionQueryHost();
+
     render_target_cache_->EndSubmission();
 
     primitive_processor_->EndSubmission();
@@ -3031,11 +3671,19 @@ bool VulkanCommandProcessor::EndSubmission(bool is_swap) {
     SubmitBarriers(true);
 
     assert_false(command_buffers_writable_.empty());
-    CommandBuffer command_buffer = command_buffers_writable_.back();
+    CommandBuffer& command_buffer = command_buffers_writable_.back();
     if (dfn.vkResetCommandPool(device, command_buffer.pool, 0) != VK_SUCCESS) {
       XELOGE("Failed to reset a Vulkan command pool");
       return false;
     }
+    for (const DeferredCommandBuffer::SecondaryCommandPool& secondary_pool :
+         command_buffer.secondary_pools) {
+      if (dfn.vkResetCommandPool(device, secondary_pool.pool, 0) !=
+          VK_SUCCESS) {
+        XELOGE("Failed to reset a Vulkan secondary command pool");
+        return false;
+      }
+    }
     VkCommandBufferBeginInfo command_buffer_begin_info;
     command_buffer_begin_info.sType =
         VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -3048,7 +3696,30 @@ bool VulkanCommandProcessor::EndSubmission(bool is_swap) {
       XELOGE("Failed to begin a Vulkan command buffer");
       return false;
     }
-    deferred_command_buffer_.Execute(command_buffer.buffer);
+    uint64_t submission_current = GetCurrentSubmission();
+    uint32_t timestamp_query_pair = UINT32_MAX;
+    if (timestamp_query_pool_ != VK_NULL_HANDLE) {
+      uint32_t timestamp_query_pair_current =
+          uint32_t(submission_current % kTimestampQuerySubmissions);
+      if (timestamp_query_submissions_[timestamp_query_pair_current] <=
+          submission_completed_) {
+        timestamp_query_pair = timestamp_query_pair_current;
+        dfn.vkCmdResetQueryPool(command_buffer.buffer, timestamp_query_pool_,
+                                2 * timestamp_query_pair, 2);
+        dfn.vkCmdWriteTimestamp(
+            command_buffer.buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+            timestamp_query_pool_, 2 * timestamp_query_pair);
+      }
+    }
+    deferred_command_buffer_.Execute(
+        command_buffer.buffer, command_buffer.secondary_pools.empty()
+                                   ? nullptr
+                                   : command_buffer.secondary_pools.data());
+    if (timestamp_query_pair != UINT32_MAX) {
+      dfn.vkCmdWriteTimestamp(
+          command_buffer.buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+          timestamp_query_pool_, 2 * timestamp_query_pair + 1);
+    }
     if (dfn.vkEndCommandBuffer(command_buffer.buffer) != VK_SUCCESS) {
       XELOGE("Failed to end a Vulkan command buffer");
       return false;
@@ -3070,13 +3741,30 @@ bool VulkanCommandProcessor::EndSubmission(bool is_swap) {
     }
     submit_info.commandBufferCount = 1;
     submit_info.pCommandBuffers = &command_buffer.buffer;
-    submit_info.signalSemaphoreCount = 0;
-    submit_info.pSignalSemaphores = nullptr;
-    assert_false(fences_free_.empty());
-    VkFence fence = fences_free_.back();
-    if (dfn.vkResetFences(device, 1, &fence) != VK_SUCCESS) {
-      XELOGE("Failed to reset a Vulkan submission fence");
-      return false;
+    VkTimelineSemaphoreSubmitInfoKHR timeline_semaphore_submit_info;
+    VkFence fence = VK_NULL_HANDLE;
+    if (submission_timeline_semaphore_ != VK_NULL_HANDLE) {
+      // The wait semaphores are binary, no values for them.
+      timeline_semaphore_submit_info.sType =
+          VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+      timeline_semaphore_submit_info.pNext = nullptr;
+      timeline_semaphore_submit_info.waitSemaphoreValueCount = 0;
+      timeline_semaphore_submit_info.pWaitSemaphoreValues = nullptr;
+      timeline_semaphore_submit_info.signalSemaphoreValueCount = 1;
+      timeline_semaphore_submit_info.pSignalSemaphoreValues =
+          &submission_current;
+      submit_info.pNext = &timeline_semaphore_submit_info;
+      submit_info.signalSemaphoreCount = 1;
+      submit_info.pSignalSemaphores = &submission_timeline_semaphore_;
+    } else {
+      submit_info.signalSemaphoreCount = 0;
+      submit_info.pSignalSemaphores = nullptr;
+      assert_false(fences_free_.empty());
+      fence = fences_free_.back();
+      if (dfn.vkResetFences(device, 1, &fence) != VK_SUCCESS) {
+        XELOGE("Failed to reset a Vulkan submission fence");
+        return false;
+      }
     }
     VkResult submit_result;
     {
@@ -3093,18 +3781,63 @@ bool VulkanCommandProcessor::EndSubmission(bool is_swap) {
       }
       return false;
     }
-    uint64_t submission_current = GetCurrentSubmission();
+    if (timestamp_query_pair != UINT32_MAX) {
+      timestamp_query_submissions_[timestamp_query_pair] = submission_current;
+    }
     current_submission_wait_stage_masks_.clear();
     for (VkSemaphore semaphore : current_submission_wait_semaphores_) {
       submissions_in_flight_semaphores_.emplace_back(submission_current,
                                                      semaphore);
     }
     current_submission_wait_semaphores_.clear();
-    command_buffers_submitted_.emplace_back(submission_current, command_buffer);
+    command_buffers_submitted_.emplace_back(submission_current,
+                                            std::move(command_buffer));
     command_buffers_writable_.pop_back();
     // Increments the current submission number, going to the next submission.
-    submissions_in_flight_fences_.push_back(fence);
-    fences_free_.pop_back();
+    if (submission_timeline_semaphore_ != VK_NULL_HANDLE) {
+      ++submissions_in_flight_timeline_;
+    } else {
+      submissions_in_flight_fences_.push_back(fence);
+      fences_free_.pop_back();
+    }
+
+    statistics_.SetTotal(GpuStatistics::Counter::kEdramTransfers,
+                         render_target_cache_->edram_transfers_total());
+    statistics_.SetTotal(
+        GpuStatistics::Counter::kEdramTransferRenderPasses,
+        render_target_cache_->edram_transfer_render_passes_total());
+    statistics_.SetTotal(GpuStatistics::Counter::kTextureLoads,
+                         texture_cache_->texture_loads_total());
+    statistics_.SetTotal(GpuStatistics::Counter::kTextureLoadBytes,
+                         texture_cache_->texture_load_bytes_total());
+    statistics_.SetTotal(GpuStatistics::Counter::kUploadBytes,
+                         shared_memory_->upload_bytes_total());
+    statistics_.SetTotal(GpuStatistics::Counter::kUploadBytesWasted,
+                         shared_memory_->upload_bytes_wasted_total() +
+                             uniform_buffer_pool_->wasted_bytes_total());
+    statistics_.SetTotal(
+        GpuStatistics::Counter::kSharedMemoryAllocations,
+        shared_memory_->host_gpu_memory_sparse_allocations_total());
+    statistics_.SetTotal(
+        GpuStatistics::Counter::kSharedMemoryAllocatedBytes,
+        shared_memory_->host_gpu_memory_sparse_allocated_bytes_total());
+    statistics_.SetTotal(
+        GpuStatistics::Counter::kSharedMemoryPredictedBytes,
+        shared_memory_->host_gpu_memory_sparse_predicted_bytes_total());
+    statistics_.SetTotal(GpuStatistics::Counter::kPipelinesCreated,
+                         pipeline_cache_->pipelines_created_total());
+    statistics_.SetTotal(
+        GpuStatistics::Counter::kPipelinesSharedByDynamicState,
+        pipeline_cache_->pipelines_shared_by_dynamic_state_total());
+    statistics_.SetGauge(GpuStatistics::Gauge::kTextureMemoryBytes,
+                         texture_cache_->textures_total_host_memory_usage());
+    statistics_.SetGauge(GpuStatistics::Gauge::kTextureMemoryLimitSoftBytes,
+                         texture_cache_->memory_limit_soft());
+    statistics_.SetGauge(GpuStatistics::Gauge::kTextureMemoryLimitHardBytes,
+                         texture_cache_->memory_limit_hard());
+    statistics_.SetGauge(GpuStatistics::Gauge::kPipelinesPending,
+                         pipeline_cache_->GetCreatingPipelineCount());
+    statistics_.EndSubmission(submission_current);
 
     submission_open_ = false;
   }
@@ -3114,6 +3847,7 @@ bool VulkanCommandProcessor::EndSubmission(bool is_swap) {
     // Submission already closed now, so minus 1.
     closed_frame_submissions_[(frame_current_++) % kMaxFramesInFlight] =
         GetCurrentSubmission() - 1;
+    statistics_.EndFrame();
 
     if (cache_clear_requested_ && AwaitAllQueueOperationsCompletion()) {
       cache_clear_requested_ = false;
@@ -3127,7 +3861,7 @@ bool VulkanCommandProcessor::EndSubmission(bool is_swap) {
 
       assert_true(command_buffers_submitted_.empty());
       for (const CommandBuffer& command_buffer : command_buffers_writable_) {
-        dfn.vkDestroyCommandPool(device, command_buffer.pool, nullptr);
+        DestroyCommandBuffer(command_buffer);
       }
       command_buffers_writable_.clear();
 
@@ -3151,6 +3885,19 @@ bool VulkanCommandProcessor::EndSubmission(bool is_swap) {
   return true;
 }
 
+void VulkanCommandProcessor::DestroyCommandBuffer(
+    const CommandBuffer& command_buffer) {
+  const ui::vulkan::VulkanProvider& provider = GetVulkanProvider();
+  const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
+  VkDevice device = provider.device();
+  // Destroying the pools also frees the command buffers allocated from them.
+  for (const DeferredCommandBuffer::SecondaryCommandPool& secondary_pool :
+       command_buffer.secondary_pools) {
+    dfn.vkDestroyCommandPool(device, secondary_pool.pool, nullptr);
+  }
+  dfn.vkDestroyCommandPool(device, command_buffer.pool, nullptr);
+}
+
 void VulkanCommandProcessor::ClearTransientDescriptorPools() {
   texture_transient_descriptor_sets_free_.clear();
   texture_transient_descriptor_sets_used_.clear();
@@ -3208,7 +3955,8 @@ void VulkanCommandProcessor::DestroyScratchBuffer() {
 
 void VulkanCommandProcessor::UpdateDynamicState(
     const draw_util::ViewportInfo& viewport_info, bool primitive_polygonal,
-    reg::RB_DEPTHCONTROL normalized_depth_control) {
+    reg::RB_DEPTHCONTROL normalized_depth_control,
+    const VulkanPipelineCache::ExtendedDynamicState& extended_dynamic_state) {
 #if XE_UI_VULKAN_FINE_GRAINED_DRAW_SCOPES
   SCOPE_profile_cpu_f("gpu");
 #endif  // XE_UI_VULKAN_FINE_GRAINED_DRAW_SCOPES
@@ -3427,8 +4175,119 @@ void VulkanCommandProcessor::UpdateDynamicState(
     }
   }
 
-  // TODO(Triang3l): VK_EXT_extended_dynamic_state and
-  // VK_EXT_extended_dynamic_state2.
+  if (render_target_cache_->use_dynamic_rendering()) {
+    // Face culling and depth / stencil state (VK_EXT_extended_dynamic_state).
+    VulkanPipelineCache::ExtendedDynamicState& state = dynamic_extended_state_;
+    dynamic_cull_mode_update_needed_ |=
+        state.cull_mode != extended_dynamic_state.cull_mode;
+    if (dynamic_cull_mode_update_needed_) {
+      state.cull_mode = extended_dynamic_state.cull_mode;
+      deferred_command_buffer_.CmdVkSetCullMode(state.cull_mode);
+      dynamic_cull_mode_update_needed_ = false;
+    }
+    dynamic_front_face_update_needed_ |=
+        state.front_face != extended_dynamic_state.front_face;
+    if (dynamic_front_face_update_needed_) {
+      state.front_face = extended_dynamic_state.front_face;
+      deferred_command_buffer_.CmdVkSetFrontFace(state.front_face);
+      dynamic_front_face_update_needed_ = false;
+    }
+    dynamic_depth_test_enable_update_needed_ |=
+        state.depth_test_enable != extended_dynamic_state.depth_test_enable;
+    if (dynamic_depth_test_enable_update_needed_) {
+      state.depth_test_enable = extended_dynamic_state.depth_test_enable;
+      deferred_command_buffer_.CmdVkSetDepthTestEnable(
+          state.depth_test_enable);
+      dynamic_depth_test_enable_update_needed_ = false;
+    }
+    dynamic_depth_write_enable_update_needed_ |=
+        state.depth_write_enable != extended_dynamic_state.depth_write_enable;
+    if (dynamic_depth_write_enable_update_needed_) {
+      state.depth_write_enable = extended_dynamic_state.depth_write_enable;
+      deferred_command_buffer_.CmdVkSetDepthWriteEnable(
+          state.depth_write_enable);
+      dynamic_depth_write_enable_update_needed_ = false;
+    }
+    dynamic_depth_compare_op_update_needed_ |=
+        state.depth_compare_op != extended_dynamic_state.depth_compare_op;
+    if (dynamic_depth_compare_op_update_needed_) {
+      state.depth_compare_op = extended_dynamic_state.depth_compare_op;
+      deferred_command_buffer_.CmdVkSetDepthCompareOp(state.depth_compare_op);
+      dynamic_depth_compare_op_update_needed_ = false;
+    }
+    dynamic_stencil_test_enable_update_needed_ |=
+        state.stencil_test_enable != extended_dynamic_state.stencil_test_enable;
+    if (dynamic_stencil_test_enable_update_needed_) {
+      state.stencil_test_enable = extended_dynamic_state.stencil_test_enable;
+      deferred_command_buffer_.CmdVkSetStencilTestEnable(
+          state.stencil_test_enable);
+      dynamic_stencil_test_enable_update_needed_ = false;
+    }
+    bool* stencil_op_update_needed[] = {
+        &dynamic_stencil_op_front_update_needed_,
+        &dynamic_stencil_op_back_update_needed_,
+    };
+    for (uint32_t i = 0; i < 2; ++i) {
+      *stencil_op_update_needed[i] |=
+          state.stencil_fail_op[i] != extended_dynamic_state.stencil_fail_op[i];
+      *stencil_op_update_needed[i] |=
+          state.stencil_pass_op[i] != extended_dynamic_state.stencil_pass_op[i];
+      *stencil_op_update_needed[i] |=
+          state.stencil_depth_fail_op[i] !=
+          extended_dynamic_state.stencil_depth_fail_op[i];
+      *stencil_op_update_needed[i] |=
+          state.stencil_compare_op[i] !=
+          extended_dynamic_state.stencil_compare_op[i];
+      state.stencil_fail_op[i] = extended_dynamic_state.stencil_fail_op[i];
+      state.stencil_pass_op[i] = extended_dynamic_state.stencil_pass_op[i];
+      state.stencil_depth_fail_op[i] =
+          extended_dynamic_state.stencil_depth_fail_op[i];
+      state.stencil_compare_op[i] =
+          extended_dynamic_state.stencil_compare_op[i];
+    }
+    if (dynamic_stencil_op_front_update_needed_ ||
+        dynamic_stencil_op_back_update_needed_) {
+      if (state.stencil_fail_op[0] == state.stencil_fail_op[1] &&
+          state.stencil_pass_op[0] == state.stencil_pass_op[1] &&
+          state.stencil_depth_fail_op[0] == state.stencil_depth_fail_op[1] &&
+          state.stencil_compare_op[0] == state.stencil_compare_op[1]) {
+        deferred_command_buffer_.CmdVkSetStencilOp(
+            VK_STENCIL_FACE_FRONT_AND_BACK, state.stencil_fail_op[0],
+            state.stencil_pass_op[0], state.stencil_depth_fail_op[0],
+            state.stencil_compare_op[0]);
+      } else {
+        if (dynamic_stencil_op_front_update_needed_) {
+          deferred_command_buffer_.CmdVkSetStencilOp(
+              VK_STENCIL_FACE_FRONT_BIT, state.stencil_fail_op[0],
+              state.stencil_pass_op[0], state.stencil_depth_fail_op[0],
+              state.stencil_compare_op[0]);
+        }
+        if (dynamic_stencil_op_back_update_needed_) {
+          deferred_command_buffer_.CmdVkSetStencilOp(
+              VK_STENCIL_FACE_BACK_BIT, state.stencil_fail_op[1],
+              state.stencil_pass_op[1], state.stencil_depth_fail_op[1],
+              state.stencil_compare_op[1]);
+        }
+      }
+      dynamic_stencil_op_front_update_needed_ = false;
+      dynamic_stencil_op_back_update_needed_ = false;
+    }
+  }
+
+  if (pipeline_cache_->is_primitive_restart_dynamic()) {
+    // Primitive restart (VK_EXT_extended_dynamic_state2).
+    VulkanPipelineCache::ExtendedDynamicState& state = dynamic_extended_state_;
+    dynamic_primitive_restart_enable_update_needed_ |=
+        state.primitive_restart_enable !=
+        extended_dynamic_state.primitive_restart_enable;
+    if (dynamic_primitive_restart_enable_update_needed_) {
+      state.primitive_restart_enable =
+          extended_dynamic_state.primitive_restart_enable;
+      deferred_command_buffer_.CmdVkSetPrimitiveRestartEnable(
+          state.primitive_restart_enable);
+      dynamic_primitive_restart_enable_update_needed_ = false;
+    }
+  }
 }
 
 void VulkanCommandProcessor::UpdateSystemConstantValues(
@@ -3990,70 +4849,28 @@ bool VulkanCommandProcessor::UpdateBindings(const VulkanShader* vertex_shader,
     // Vertex shader float constants.
     if (!(current_constant_buffers_up_to_date_ &
           (UINT32_C(1) << SpirvShaderTranslator::kConstantBufferFloatVertex))) {
-      VkDescriptorBufferInfo& buffer_info = current_constant_buffer_infos_
-          [SpirvShaderTranslator::kConstantBufferFloatVertex];
-      // Even if the shader doesn't need any float constants, a valid binding
-      // must still be provided (the pipeline layout always has float constants,
-      // for both the vertex shader and the pixel shader), so if the first draw
-      // in the frame doesn't have float constants at all, still allocate a
-      // dummy buffer.
-      size_t float_constants_size =
-          sizeof(float) * 4 *
-          std::max(float_constant_count_vertex, UINT32_C(1));
-      uint8_t* mapping = uniform_buffer_pool_->Request(
-          frame_current_, float_constants_size, uniform_buffer_alignment,
-          buffer_info.buffer, buffer_info.offset);
-      if (!mapping) {
+      float_constant_upload_cache_.Gather(regs,
+                                          XE_GPU_REG_SHADER_CONSTANT_000_X,
+                                          current_float_constant_map_vertex_);
+      if (!UploadGatheredFloatConstants(
+              current_constant_buffer_infos_
+                  [SpirvShaderTranslator::kConstantBufferFloatVertex])) {
         return false;
       }
-      buffer_info.range = VkDeviceSize(float_constants_size);
-      for (uint32_t i = 0; i < 4; ++i) {
-        uint64_t float_constant_map_entry =
-            current_float_constant_map_vertex_[i];
-        uint32_t float_constant_index;
-        while (xe::bit_scan_forward(float_constant_map_entry,
-                                    &float_constant_index)) {
-          float_constant_map_entry &= ~(1ull << float_constant_index);
-          std::memcpy(mapping,
-                      &regs[XE_GPU_REG_SHADER_CONSTANT_000_X + (i << 8) +
-                            (float_constant_index << 2)]
-                           .f32,
-                      sizeof(float) * 4);
-          mapping += sizeof(float) * 4;
-        }
-      }
       current_constant_buffers_up_to_date_ |=
           UINT32_C(1) << SpirvShaderTranslator::kConstantBufferFloatVertex;
     }
     // Pixel shader float constants.
     if (!(current_constant_buffers_up_to_date_ &
           (UINT32_C(1) << SpirvShaderTranslator::kConstantBufferFloatPixel))) {
-      VkDescriptorBufferInfo& buffer_info = current_constant_buffer_infos_
-          [SpirvShaderTranslator::kConstantBufferFloatPixel];
-      size_t float_constants_size =
-          sizeof(float) * 4 * std::max(float_constant_count_pixel, UINT32_C(1));
-      uint8_t* mapping = uniform_buffer_pool_->Request(
-          frame_current_, float_constants_size, uniform_buffer_alignment,
-          buffer_info.buffer, buffer_info.offset);
-      if (!mapping) {
+      float_constant_upload_cache_.Gather(regs,
+                                          XE_GPU_REG_SHADER_CONSTANT_256_X,
+                                          current_float_constant_map_pixel_);
+      if (!UploadGatheredFloatConstants(
+              current_constant_buffer_infos_
+                  [SpirvShaderTranslator::kConstantBufferFloatPixel])) {
         return false;
       }
-      buffer_info.range = VkDeviceSize(float_constants_size);
-      for (uint32_t i = 0; i < 4; ++i) {
-        uint64_t float_constant_map_entry =
-            current_float_constant_map_pixel_[i];
-        uint32_t float_constant_index;
-        while (xe::bit_scan_forward(float_constant_map_entry,
-                                    &float_constant_index)) {
-          float_constant_map_entry &= ~(1ull << float_constant_index);
-          std::memcpy(mapping,
-                      &regs[XE_GPU_REG_SHADER_CONSTANT_256_X + (i << 8) +
-                            (float_constant_index << 2)]
-                           .f32,
-                      sizeof(float) * 4);
-          mapping += sizeof(float) * 4;
-        }
-      }
       current_constant_buffers_up_to_date_ |=
           UINT32_C(1) << SpirvShaderTranslator::kConstantBufferFloatPixel;
     }
@@ -4116,33 +4933,14 @@ bool VulkanCommandProcessor::UpdateBindings(const VulkanShader* vertex_shader,
     sampler_count_pixel = 0;
     texture_count_pixel = 0;
   }
-  // TODO(Triang3l): Reuse texture and sampler bindings if not changed.
-  current_graphics_descriptor_set_values_up_to_date_ &=
-      ~((UINT32_C(1) << SpirvShaderTranslator::kDescriptorSetTexturesVertex) |
-        (UINT32_C(1) << SpirvShaderTranslator::kDescriptorSetTexturesPixel));
-
-  // Make sure new descriptor sets are bound to the command buffer.
-
-  current_graphics_descriptor_sets_bound_up_to_date_ &=
-      current_graphics_descriptor_set_values_up_to_date_;
-
   // Fill the texture and sampler write image infos.
 
-  bool write_vertex_textures =
-      (texture_count_vertex || sampler_count_vertex) &&
-      !(current_graphics_descriptor_set_values_up_to_date_ &
-        (UINT32_C(1) << SpirvShaderTranslator::kDescriptorSetTexturesVertex));
-  bool write_pixel_textures =
-      (texture_count_pixel || sampler_count_pixel) &&
-      !(current_graphics_descriptor_set_values_up_to_date_ &
-        (UINT32_C(1) << SpirvShaderTranslator::kDescriptorSetTexturesPixel));
   descriptor_write_image_info_.clear();
   descriptor_write_image_info_.reserve(
-      (write_vertex_textures ? texture_count_vertex + sampler_count_vertex
-                             : 0) +
-      (write_pixel_textures ? texture_count_pixel + sampler_count_pixel : 0));
+      texture_count_vertex + sampler_count_vertex + texture_count_pixel +
+      sampler_count_pixel);
   size_t vertex_texture_image_info_offset = descriptor_write_image_info_.size();
-  if (write_vertex_textures && texture_count_vertex) {
+  if (texture_count_vertex) {
     for (const VulkanShader::TextureBinding& texture_binding :
          textures_vertex) {
       VkDescriptorImageInfo& descriptor_image_info =
@@ -4156,7 +4954,7 @@ bool VulkanCommandProcessor::UpdateBindings(const VulkanShader* vertex_shader,
     }
   }
   size_t vertex_sampler_image_info_offset = descriptor_write_image_info_.size();
-  if (write_vertex_textures && sampler_count_vertex) {
+  if (sampler_count_vertex) {
     for (const std::pair<VulkanTextureCache::SamplerParameters, VkSampler>&
              sampler_pair : current_samplers_vertex_) {
       VkDescriptorImageInfo& descriptor_image_info =
@@ -4165,7 +4963,7 @@ bool VulkanCommandProcessor::UpdateBindings(const VulkanShader* vertex_shader,
     }
   }
   size_t pixel_texture_image_info_offset = descriptor_write_image_info_.size();
-  if (write_pixel_textures && texture_count_pixel) {
+  if (texture_count_pixel) {
     for (const VulkanShader::TextureBinding& texture_binding :
          *textures_pixel) {
       VkDescriptorImageInfo& descriptor_image_info =
@@ -4179,7 +4977,7 @@ bool VulkanCommandProcessor::UpdateBindings(const VulkanShader* vertex_shader,
     }
   }
   size_t pixel_sampler_image_info_offset = descriptor_write_image_info_.size();
-  if (write_pixel_textures && sampler_count_pixel) {
+  if (sampler_count_pixel) {
     for (const std::pair<VulkanTextureCache::SamplerParameters, VkSampler>&
              sampler_pair : current_samplers_pixel_) {
       VkDescriptorImageInfo& descriptor_image_info =
@@ -4188,6 +4986,38 @@ bool VulkanCommandProcessor::UpdateBindings(const VulkanShader* vertex_shader,
     }
   }
 
+  // Reuse the texture and sampler descriptor sets written earlier in the frame
+  // if the bindings haven't changed since then - the sets are kept until the
+  // frame is completed by the GPU.
+  if (!UpdateCurrentTextureDescriptors(
+          true, texture_count_vertex, sampler_count_vertex,
+          descriptor_write_image_info_.data() +
+              vertex_texture_image_info_offset)) {
+    current_graphics_descriptor_set_values_up_to_date_ &=
+        ~(UINT32_C(1) << SpirvShaderTranslator::kDescriptorSetTexturesVertex);
+  }
+  if (!UpdateCurrentTextureDescriptors(
+          false, texture_count_pixel, sampler_count_pixel,
+          descriptor_write_image_info_.data() +
+              pixel_texture_image_info_offset)) {
+    current_graphics_descriptor_set_values_up_to_date_ &=
+        ~(UINT32_C(1) << SpirvShaderTranslator::kDescriptorSetTexturesPixel);
+  }
+
+  // Make sure new descriptor sets are bound to the command buffer.
+
+  current_graphics_descriptor_sets_bound_up_to_date_ &=
+      current_graphics_descriptor_set_values_up_to_date_;
+
+  bool write_vertex_textures =
+      (texture_count_vertex || sampler_count_vertex) &&
+      !(current_graphics_descriptor_set_values_up_to_date_ &
+        (UINT32_C(1) << SpirvShaderTranslator::kDescriptorSetTexturesVertex));
+  bool write_pixel_textures =
+      (texture_count_pixel || sampler_count_pixel) &&
+      !(current_graphics_descriptor_set_values_up_to_date_ &
+        (UINT32_C(1) << SpirvShaderTranslator::kDescriptorSetTexturesPixel));
+
   // Write the new descriptor sets.
 
   // Consecutive bindings updated via a single VkWriteDescriptorSet must have
@@ -4335,6 +5165,37 @@ bool VulkanCommandProcessor::UpdateBindings(const VulkanShader* vertex_shader,
   return true;
 }
 
+bool VulkanCommandProcessor::UploadGatheredFloatConstants(
+    VkDescriptorBufferInfo& buffer_info_out) {
+  const VkDescriptorBufferInfo* uploaded_buffer_info =
+      float_constant_upload_cache_.FindGathered();
+  if (uploaded_buffer_info) {
+    buffer_info_out = *uploaded_buffer_info;
+    return true;
+  }
+  // Even if the shader doesn't need any float constants, a valid binding must
+  // still be provided (the pipeline layout always has float constants, for
+  // both the vertex shader and the pixel shader), so if the first draw in the
+  // frame doesn't have float constants at all, still allocate a dummy buffer.
+  size_t float_constants_size = float_constant_upload_cache_.gathered_size();
+  size_t float_constants_allocation_size =
+      std::max(float_constants_size, sizeof(float) * 4);
+  uint8_t* mapping = uniform_buffer_pool_->Request(
+      frame_current_, float_constants_allocation_size,
+      size_t(GetVulkanProvider()
+                 .device_properties()
+                 .limits.minUniformBufferOffsetAlignment),
+      buffer_info_out.buffer, buffer_info_out.offset);
+  if (!mapping) {
+    return false;
+  }
+  buffer_info_out.range = VkDeviceSize(float_constants_allocation_size);
+  std::memcpy(mapping, float_constant_upload_cache_.gathered(),
+              float_constants_size);
+  float_constant_upload_cache_.AddGathered(buffer_info_out);
+  return true;
+}
+
 uint8_t* VulkanCommandProcessor::WriteTransientUniformBufferBinding(
     size_t size, SingleTransientDescriptorLayout transient_descriptor_layout,
     VkDescriptorBufferInfo& descriptor_buffer_info_out,
@@ -4387,6 +5248,42 @@ uint8_t* VulkanCommandProcessor::WriteTransientUniformBufferBinding(
   return mapping;
 }
 
+bool VulkanCommandProcessor::UpdateCurrentTextureDescriptors(
+    bool is_vertex, uint32_t texture_count, uint32_t sampler_count,
+    const VkDescriptorImageInfo* image_infos) {
+  uint32_t descriptor_set_index =
+      is_vertex ? SpirvShaderTranslator::kDescriptorSetTexturesVertex
+                : SpirvShaderTranslator::kDescriptorSetTexturesPixel;
+  CurrentTextureDescriptors& current =
+      current_texture_descriptors_[is_vertex ? 0 : 1];
+  size_t image_info_count = size_t(texture_count) + sampler_count;
+  if ((current_graphics_descriptor_set_values_up_to_date_ &
+       (UINT32_C(1) << descriptor_set_index)) &&
+      current.texture_count == texture_count &&
+      current.sampler_count == sampler_count) {
+    // Textures only have the image view and the layout, samplers only have
+    // the sampler.
+    bool image_infos_equal = true;
+    for (size_t i = 0; i < image_info_count; ++i) {
+      const VkDescriptorImageInfo& image_info = image_infos[i];
+      const VkDescriptorImageInfo& current_image_info = current.image_infos[i];
+      if (image_info.sampler != current_image_info.sampler ||
+          image_info.imageView != current_image_info.imageView ||
+          image_info.imageLayout != current_image_info.imageLayout) {
+        image_infos_equal = false;
+        break;
+      }
+    }
+    if (image_infos_equal) {
+      return true;
+    }
+  }
+  current.texture_count = texture_count;
+  current.sampler_count = sampler_count;
+  current.image_infos.assign(image_infos, image_infos + image_info_count);
+  return false;
+}
+
 uint32_t VulkanCommandProcessor::WriteTransientTextureBindings(
     bool is_vertex, uint32_t texture_count, uint32_t sampler_count,
     VkDescriptorSetLayout descriptor_set_layout,
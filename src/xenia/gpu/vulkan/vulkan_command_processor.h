@@ -23,8 +23,10 @@
 
 #include "xenia/base/assert.h"
 #include "xenia/base/hash.h"
+#include "xenia/base/profiling.h"
 #include "xenia/gpu/command_processor.h"
 #include "xenia/gpu/draw_util.h"
+#include "xenia/gpu/float_constant_upload_cache.h"
 #include "xenia/gpu/registers.h"
 #include "xenia/gpu/spirv_shader_translator.h"
 #include "xenia/gpu/vulkan/deferred_command_buffer.h"
@@ -139,6 +141,9 @@ class VulkanCommandProcessor : public CommandProcessor {
 
   void ClearCaches() override;
 
+  void InitializeShaderStorage(const std::filesystem::path& cache_root,
+                               uint32_t title_id, bool blocking) override;
+
   void TracePlaybackWroteMemory(uint32_t base_ptr, uint32_t length) override;
 
   void RestoreEdramSnapshot(const void* snapshot) override;
@@ -157,8 +162,7 @@ class VulkanCommandProcessor : public CommandProcessor {
 
   bool submission_open() const { return submission_open_; }
   uint64_t GetCurrentSubmission() const {
-    return submission_completed_ +
-           uint64_t(submissions_in_flight_fences_.size()) + 1;
+    return submission_completed_ + GetSubmissionsInFlightCount() + 1;
   }
   uint64_t GetCompletedSubmission() const { return submission_completed_; }
 
@@ -198,11 +202,15 @@ class VulkanCommandProcessor : public CommandProcessor {
   // render pass will also be closed.
   bool SubmitBarriers(bool force_end_render_pass);
 
-  // If not started yet, begins a render pass from the render target cache.
-  // Submission must be open.
-  void SubmitBarriersAndEnterRenderTargetCacheRenderPass(
+  // If not started yet, begins a render pass from the render target cache,
+  // returning whether a new render pass has been begun. Submission must be
+  // open.
+  bool SubmitBarriersAndEnterRenderTargetCacheRenderPass(
       VkRenderPass render_pass,
       const VulkanRenderTargetCache::Framebuffer* framebuffer);
+  // If not started yet, begins dynamic rendering to the render targets from
+  // the last render target cache update. Submission must be open.
+  void SubmitBarriersAndEnterRenderTargetCacheDynamicRendering();
   // Must be called before doing anything outside the render pass scope,
   // including adding pipeline barriers that are not a part of the render pass
   // scope. Submission must be open.
@@ -264,7 +272,7 @@ class VulkanCommandProcessor : public CommandProcessor {
   bool SetupContext() override;
   void ShutdownContext() override;
 
-  void WriteRegister(uint32_t index, uint32_t value) override;
+  void OnShaderConstantsWritten(uint32_t first_index, uint32_t count) override;
 
   void OnGammaRamp256EntryTableValueWritten() override;
   void OnGammaRampPWLValueWritten() override;
@@ -272,6 +280,13 @@ class VulkanCommandProcessor : public CommandProcessor {
   void IssueSwap(uint32_t frontbuffer_ptr, uint32_t frontbuffer_width,
                  uint32_t frontbuffer_height) override;
 
+  bool IsOcclusionQueryHostSupported() const override {
+    return occlusion_query_pool_ != VK_NULL_HANDLE;
+  }
+  bool BeginOcclusionQuery() override;
+  void EndOcclusionQuery() override;
+  bool GetOcclusionQueryResult(bool await, uint64_t& sample_count_out) override;
+
   Shader* LoadShader(xenos::ShaderType shader_type, uint32_t guest_address,
                      const uint32_t* host_address,
                      uint32_t dword_count) override;
@@ -287,6 +302,8 @@ class VulkanCommandProcessor : public CommandProcessor {
   struct CommandBuffer {
     VkCommandPool pool;
     VkCommandBuffer buffer;
+    // One for each command recording thread.
+    std::vector<DeferredCommandBuffer::SecondaryCommandPool> secondary_pools;
   };
 
   struct SparseBufferBind {
@@ -414,6 +431,10 @@ class VulkanCommandProcessor : public CommandProcessor {
   // the submission to await to simply check status, or pass
   // GetCurrentSubmission() to wait for all queue operations to be completed.
   void CheckSubmissionFenceAndDeviceLoss(uint64_t await_submission);
+  // Passes the host GPU times of the submissions completed since the specified
+  // one to the statistics.
+  void ReportCompletedSubmissionStatistics(
+      uint64_t submission_completed_before);
   // If is_guest_command is true, a new full frame - with full cleanup of
   // resources and, if needed, starting capturing - is opened if pending (as
   // opposed to simply resuming after mid-frame synchronization). Returns
@@ -423,9 +444,38 @@ class VulkanCommandProcessor : public CommandProcessor {
   // clearing and stopping capturing. Returns whether the submission was done
   // successfully, if it has failed, leaves it open.
   bool EndSubmission(bool is_swap);
+  void DestroyCommandBuffer(const CommandBuffer& command_buffer);
+
+  // Host queries can't span multiple command buffers, so a guest-visible
+  // occlusion query is split into multiple host queries at submission
+  // boundaries.
+  struct OcclusionQuery {
+    // Sum of the results of the host queries already read.
+    uint64_t sample_count = 0;
+    // Host queries not read yet, consecutive in the pool.
+    uint32_t host_query_first = 0;
+    uint32_t host_query_count = 0;
+    // The latest submission with the host queries.
+    uint64_t submission = 0;
+  };
+  // Frees a host query if all are in use, and begins the next one for the
+  // latest occlusion query. Submission must be open.
+  void BeginOcclusionQueryHost();
+  void EndOcclusionQueryHost();
+  // Awaits and accumulates the results of all the ended host queries of the
+  // occlusion query.
+  void ReadOcclusionQueryHostResults(OcclusionQuery& query);
+  // Reads the host queries of the oldest occlusion queries until a host query
+  // is free.
+  void FreeOcclusionQueryHost();
   bool AwaitAllQueueOperationsCompletion() {
     CheckSubmissionFenceAndDeviceLoss(GetCurrentSubmission());
-    return !submission_open_ && submissions_in_flight_fences_.empty();
+    return !submission_open_ && !GetSubmissionsInFlightCount();
+  }
+  uint64_t GetSubmissionsInFlightCount() const {
+    return submission_timeline_semaphore_ != VK_NULL_HANDLE
+               ? submissions_in_flight_timeline_
+               : uint64_t(submissions_in_flight_fences_.size());
   }
 
   void ClearTransientDescriptorPools();
@@ -434,9 +484,10 @@ class VulkanCommandProcessor : public CommandProcessor {
 
   void DestroyScratchBuffer();
 
-  void UpdateDynamicState(const draw_util::ViewportInfo& viewport_info,
-                          bool primitive_polygonal,
-                          reg::RB_DEPTHCONTROL normalized_depth_control);
+  void UpdateDynamicState(
+      const draw_util::ViewportInfo& viewport_info, bool primitive_polygonal,
+      reg::RB_DEPTHCONTROL normalized_depth_control,
+      const VulkanPipelineCache::ExtendedDynamicState& extended_dynamic_state);
   void UpdateSystemConstantValues(
       bool primitive_polygonal,
       const PrimitiveProcessor::ProcessingResult& primitive_processing_result,
@@ -445,6 +496,9 @@ class VulkanCommandProcessor : public CommandProcessor {
       uint32_t normalized_color_mask);
   bool UpdateBindings(const VulkanShader* vertex_shader,
                       const VulkanShader* pixel_shader);
+  // Uploads the float constants gathered in float_constant_upload_cache_, or
+  // returns an identical block uploaded earlier in the frame.
+  bool UploadGatheredFloatConstants(VkDescriptorBufferInfo& buffer_info_out);
   // Allocates a descriptor set and fills one or two VkWriteDescriptorSet
   // structure instances (for images and samplers).
   // The descriptor set layout must be the one for the given is_vertex,
@@ -459,6 +513,14 @@ class VulkanCommandProcessor : public CommandProcessor {
       const VkDescriptorImageInfo* texture_image_info,
       const VkDescriptorImageInfo* sampler_image_info,
       VkWriteDescriptorSet* descriptor_set_writes_out);
+  // Returns whether the current texture descriptor set of the stage, if it's
+  // up to date, contains exactly the given textures and samplers (texture
+  // image infos followed by sampler image infos), so it can be reused.
+  // Otherwise, remembers the bindings for the descriptor set that will be
+  // written for them.
+  bool UpdateCurrentTextureDescriptors(
+      bool is_vertex, uint32_t texture_count, uint32_t sampler_count,
+      const VkDescriptorImageInfo* image_infos);
 
   bool device_lost_ = false;
 
@@ -480,9 +542,41 @@ class VulkanCommandProcessor : public CommandProcessor {
   std::vector<VkSemaphore> current_submission_wait_semaphores_;
   std::vector<VkPipelineStageFlags> current_submission_wait_stage_masks_;
   std::vector<VkFence> submissions_in_flight_fences_;
+  // With VK_KHR_timeline_semaphore, instead of a fence for each submission, a
+  // single semaphore signaled with the index of each submission when it's
+  // completed, so the completion of all submissions can be checked or awaited
+  // with one call.
+  VkSemaphore submission_timeline_semaphore_ = VK_NULL_HANDLE;
+  uint64_t submissions_in_flight_timeline_ = 0;
   std::deque<std::pair<uint64_t, VkSemaphore>>
       submissions_in_flight_semaphores_;
 
+  // Timestamps in the beginning and in the end of submissions for measuring
+  // the host GPU time, in pairs of queries reused in a ring.
+  static constexpr uint32_t kTimestampQuerySubmissions = 64;
+  VkQueryPool timestamp_query_pool_ = VK_NULL_HANDLE;
+  uint64_t timestamp_valid_mask_ = 0;
+  // Created when the first submission is measured, as the current GPU
+  // timestamp can't be queried directly.
+  uint8_t profiler_gpu_timeline_ = Profiler::kGpuTimelineInvalid;
+  // Submissions that have written to each pair of queries the latest, the pair
+  // is skipped if it's still in use by a submission in flight.
+  uint64_t timestamp_query_submissions_[kTimestampQuerySubmissions] = {};
+
+  static constexpr uint32_t kOcclusionQueryHostCount = 4096;
+  VkQueryPool occlusion_query_pool_ = VK_NULL_HANDLE;
+  // VK_QUERY_CONTROL_PRECISE_BIT if supported, otherwise only whether any
+  // samples have passed is known.
+  VkQueryControlFlags occlusion_query_control_flags_ = 0;
+  // From the oldest, the last one is being counted if occlusion_query_active_.
+  std::deque<OcclusionQuery> occlusion_queries_;
+  bool occlusion_query_active_ = false;
+  // Whether a host query of the active occlusion query is being counted in the
+  // current submission.
+  bool occlusion_query_host_active_ = false;
+  uint32_t occlusion_query_host_next_ = 0;
+  uint32_t occlusion_query_host_used_ = 0;
+
   static constexpr uint32_t kMaxFramesInFlight = 3;
   bool frame_open_ = false;
   // Guest frame index, since some transient resources can be reused across
@@ -626,9 +720,23 @@ class VulkanCommandProcessor : public CommandProcessor {
              ui::vulkan::VulkanPresenter::kMaxActiveGuestOutputImageVersions>
       swap_framebuffers_;
 
+  // Whether pipeline barriers are submitted with VK_KHR_synchronization2, with
+  // the stage masks of each buffer and image barrier, rather than the union of
+  // the stages of all barriers in the pipeline barrier command.
+  bool synchronization2_ = false;
+
   // Pending pipeline barriers.
   std::vector<VkBufferMemoryBarrier> pending_barriers_buffer_memory_barriers_;
   std::vector<VkImageMemoryBarrier> pending_barriers_image_memory_barriers_;
+  struct PendingBarrierStages {
+    VkPipelineStageFlags src_stage_mask;
+    VkPipelineStageFlags dst_stage_mask;
+  };
+  // Parallel to the pending buffer and image memory barriers.
+  std::vector<PendingBarrierStages>
+      pending_barriers_buffer_memory_barrier_stages_;
+  std::vector<PendingBarrierStages>
+      pending_barriers_image_memory_barrier_stages_;
   struct PendingBarrier {
     VkPipelineStageFlags src_stage_mask = 0;
     VkPipelineStageFlags dst_stage_mask = 0;
@@ -637,6 +745,10 @@ class VulkanCommandProcessor : public CommandProcessor {
   };
   std::vector<PendingBarrier> pending_barriers_;
   PendingBarrier current_pending_barrier_;
+  // Reused to avoid allocations when submitting with
+  // VK_KHR_synchronization2.
+  std::vector<VkBufferMemoryBarrier2KHR> barriers_2_buffer_memory_barriers_;
+  std::vector<VkImageMemoryBarrier2KHR> barriers_2_image_memory_barriers_;
 
   // GPU-local scratch buffer.
   static constexpr VkDeviceSize kScratchBufferSizeIncrement = 16 * 1024 * 1024;
@@ -681,6 +793,19 @@ class VulkanCommandProcessor : public CommandProcessor {
   bool dynamic_stencil_write_mask_back_update_needed_;
   bool dynamic_stencil_reference_front_update_needed_;
   bool dynamic_stencil_reference_back_update_needed_;
+  // Depth / stencil and face culling state, dynamic only in guest pipelines
+  // used with dynamic rendering.
+  VulkanPipelineCache::ExtendedDynamicState dynamic_extended_state_;
+  bool dynamic_cull_mode_update_needed_;
+  bool dynamic_front_face_update_needed_;
+  bool dynamic_depth_test_enable_update_needed_;
+  bool dynamic_depth_write_enable_update_needed_;
+  bool dynamic_depth_compare_op_update_needed_;
+  bool dynamic_stencil_test_enable_update_needed_;
+  bool dynamic_stencil_op_front_update_needed_;
+  bool dynamic_stencil_op_back_update_needed_;
+  // VK_EXT_extended_dynamic_state2, if the pipeline cache uses it.
+  bool dynamic_primitive_restart_enable_update_needed_;
 
   // Currently used samplers.
   std::vector<std::pair<VulkanTextureCache::SamplerParameters, VkSampler>>
@@ -692,16 +817,32 @@ class VulkanCommandProcessor : public CommandProcessor {
   // framebuffer.
   VkRenderPass current_render_pass_;
   const VulkanRenderTargetCache::Framebuffer* current_framebuffer_;
+  // Dynamic rendering currently started in the command buffer instead of a
+  // render pass.
+  bool current_dynamic_rendering_ = false;
+  VulkanRenderTargetCache::RenderPassKey current_dynamic_rendering_key_;
+  VkImageView
+      current_dynamic_rendering_views_[1 + xenos::kMaxColorRenderTargets];
+  VkExtent2D current_dynamic_rendering_extent_;
 
   // Currently bound graphics pipeline, either from the pipeline cache (with
   // potentially deferred creation - current_external_graphics_pipeline_ is
   // VK_NULL_HANDLE in this case) or a non-Xenos one
-  // (current_guest_graphics_pipeline_ is VK_NULL_HANDLE in this case).
-  // TODO(Triang3l): Change to a deferred compilation handle.
-  VkPipeline current_guest_graphics_pipeline_;
+  // (current_guest_graphics_pipeline_ is nullptr in this case).
+  void* current_guest_graphics_pipeline_;
   VkPipeline current_external_graphics_pipeline_;
   VkPipeline current_external_compute_pipeline_;
 
+  // The viewport of the previous draw, for skipping its calculation if the
+  // registers and the other state it's derived from haven't changed.
+  struct LastDrawViewport {
+    uint64_t draw_state_register_write_count;
+    bool pixel_shader_writes_depth;
+    bool valid = false;
+    draw_util::ViewportInfo viewport_info;
+  };
+  LastDrawViewport last_draw_viewport_;
+
   // Pipeline layout of the current guest graphics pipeline.
   const PipelineLayout* current_guest_graphics_pipeline_layout_;
   VkDescriptorBufferInfo current_constant_buffer_infos_
@@ -730,10 +871,22 @@ class VulkanCommandProcessor : public CommandProcessor {
       SpirvShaderTranslator::kDescriptorSetCount <=
           sizeof(current_graphics_descriptor_sets_bound_up_to_date_) * CHAR_BIT,
       "Bit fields storing descriptor set validity must be large enough");
+  // Bindings in the current vertex (0) and pixel (1) shader texture descriptor
+  // sets, for reusing them in subsequent draws within the frame.
+  struct CurrentTextureDescriptors {
+    uint32_t texture_count = 0;
+    uint32_t sampler_count = 0;
+    std::vector<VkDescriptorImageInfo> image_infos;
+  };
+  CurrentTextureDescriptors current_texture_descriptors_[2];
 
   // Float constant usage masks of the last draw call.
   uint64_t current_float_constant_map_vertex_[4];
   uint64_t current_float_constant_map_pixel_[4];
+  // Float constants uploaded in the current frame, for binding identical
+  // blocks again instead of uploading them once more.
+  FloatConstantUploadCache<VkDescriptorBufferInfo>
+      float_constant_upload_cache_;
 
   // System shader constants.
   SpirvShaderTranslator::SystemConstants system_constants_;
@@ -11,17 +11,28 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <utility>
 #include <vector>
 
 #include "third_party/fmt/include/fmt/format.h"
 #include "xenia/base/assert.h"
+#include "xenia/base/byte_order.h"
+#include "xenia/base/clock.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
+#include "xenia/base/mapped_memory.h"
 #include "xenia/base/math.h"
+#include "xenia/base/memory.h"
 #include "xenia/base/profiling.h"
+#include "xenia/base/string_buffer.h"
 #include "xenia/base/xxhash.h"
 #include "xenia/gpu/draw_util.h"
 #include "xenia/gpu/gpu_flags.h"
@@ -34,6 +45,67 @@
 #include "xenia/gpu/xenos.h"
 #include "xenia/ui/vulkan/vulkan_util.h"
 
+DEFINE_int32(
+    vulkan_pipeline_creation_threads, -1,
+    "Number of threads used for graphics pipeline creation. -1 to calculate "
+    "automatically (75% of logical CPU cores), a positive number to specify "
+    "the number of threads explicitly (up to the number of logical CPU cores), "
+    "0 to disable multithreaded pipeline creation.",
+    "Vulkan");
+DEFINE_string(
+    vulkan_pending_pipeline_draws, "wait",
+    "What to do with draws whose graphics pipelines are still being created on "
+    "the pipeline creation threads.\n"
+    "Use: [wait, skip, fallback]\n"
+    " wait:\n"
+    "  Record the draws normally, and await the creation of the pipelines at "
+    "the end of the submission.\n"
+    "  Everything is drawn, but the first frames with new pipelines may "
+    "stutter.\n"
+    " skip:\n"
+    "  Drop the draws until their pipelines are created, prioritizing the "
+    "pipelines requested recently and by many draws.\n"
+    "  No stuttering, but objects may be missing for some frames.\n"
+    " fallback:\n"
+    "  Draw with an already created pipeline that uses the same shaders, "
+    "render pass and primitive type, but different rasterization, depth / "
+    "stencil and blending state, until the pipeline is created, or drop the "
+    "draw if there's none.\n"
+    "  No stuttering, with fewer missing objects, but some may be drawn "
+    "incorrectly for some frames.",
+    "Vulkan");
+DEFINE_bool(
+    vulkan_optimize_shaders, false,
+    "Optimize the translated SPIR-V shaders with SPIRV-Tools from the Vulkan "
+    "SDK (located via the VULKAN_SDK environment variable) before passing "
+    "them to the driver, which may reduce the pipeline creation time and "
+    "improve the GPU performance with some drivers. Shaders are optimized on "
+    "the shader storage loading and writing threads, and the results are "
+    "cached in the shader storage, so shaders first seen during gameplay are "
+    "used unoptimized until the next launch.",
+    "Vulkan");
+DEFINE_bool(
+    vulkan_vertex_fetch_endian_specialization, true,
+    "Translate separate variants of vertex shaders for draws where all the "
+    "vertex buffers have 8-in-32 endianness (the most common), swapping the "
+    "bytes of the fetched words without reading the endianness from the fetch "
+    "constants and branching on it for every vertex.",
+    "Vulkan");
+DEFINE_bool(
+    vulkan_pipeline_libraries, true,
+    "Create graphics pipelines from parts compiled separately and shared "
+    "between pipelines with VK_EXT_graphics_pipeline_library if supported. If "
+    "fast linking is supported, pipelines are linked quickly on the first "
+    "draw, and linked again with link-time optimization on the pipeline "
+    "creation threads in the background.",
+    "Vulkan");
+DEFINE_bool(
+    vulkan_dynamic_primitive_restart, true,
+    "With dynamic rendering, if VK_EXT_extended_dynamic_state2 is supported, "
+    "enable primitive restart in the command buffer rather than in the "
+    "pipelines, so draws with and without it share the pipelines.",
+    "Vulkan");
+
 namespace xe {
 namespace gpu {
 namespace vulkan {
@@ -64,6 +136,17 @@ bool VulkanPipelineCache::Initialize() {
       render_target_cache_.msaa_2x_no_attachments_supported(),
       edram_fragment_shader_interlock);
 
+  if (cvars::vulkan_optimize_shaders) {
+    if (!spirv_tools_context_.Initialize(
+            SpirvShaderTranslator::Features(provider).spirv_version) ||
+        !spirv_tools_context_.IsOptimizerAvailable()) {
+      XELOGW(
+          "VulkanPipelineCache: SPIRV-Tools optimizer unavailable, shaders "
+          "will not be optimized");
+      spirv_tools_context_.Shutdown();
+    }
+  }
+
   if (edram_fragment_shader_interlock) {
     std::vector<uint8_t> depth_only_fragment_shader_code =
         shader_translator_->CreateDepthOnlyFragmentShader();
@@ -81,6 +164,60 @@ bool VulkanPipelineCache::Initialize() {
     }
   }
 
+  primitive_restart_dynamic_ =
+      cvars::vulkan_dynamic_primitive_restart &&
+      render_target_cache_.use_dynamic_rendering() &&
+      provider.device_extensions().ext_extended_dynamic_state2 &&
+      provider.device_extended_dynamic_state2_features().extendedDynamicState2;
+
+  pipeline_libraries_used_ =
+      cvars::vulkan_pipeline_libraries &&
+      provider.device_extensions().ext_graphics_pipeline_library &&
+      provider.device_graphics_pipeline_library_features()
+          .graphicsPipelineLibrary;
+  pipeline_libraries_fast_linking_ =
+      pipeline_libraries_used_ &&
+      provider.device_graphics_pipeline_library_properties()
+          .graphicsPipelineLibraryFastLinking;
+
+  if (cvars::vulkan_pending_pipeline_draws == "skip") {
+    pending_pipeline_draw_policy_ = PendingPipelineDrawPolicy::kSkip;
+  } else if (cvars::vulkan_pending_pipeline_draws == "fallback") {
+    pending_pipeline_draw_policy_ = PendingPipelineDrawPolicy::kFallback;
+  } else {
+    pending_pipeline_draw_policy_ = PendingPipelineDrawPolicy::kWait;
+  }
+
+  uint32_t logical_processor_count = xe::threading::logical_processor_count();
+  if (!logical_processor_count) {
+    // Pick some reasonable amount if couldn't determine the number of cores.
+    logical_processor_count = 6;
+  }
+  creation_threads_busy_ = 0;
+  creation_completion_event_ =
+      xe::threading::Event::CreateManualResetEvent(true);
+  assert_not_null(creation_completion_event_);
+  creation_completion_set_event_ = false;
+  creation_threads_shutdown_ = false;
+  if (cvars::vulkan_pipeline_creation_threads != 0) {
+    size_t creation_thread_count;
+    if (cvars::vulkan_pipeline_creation_threads < 0) {
+      creation_thread_count =
+          std::max(logical_processor_count * 3 / 4, uint32_t(1));
+    } else {
+      creation_thread_count =
+          std::min(uint32_t(cvars::vulkan_pipeline_creation_threads),
+                   logical_processor_count);
+    }
+    for (size_t i = 0; i < creation_thread_count; ++i) {
+      std::unique_ptr<xe::threading::Thread> creation_thread =
+          xe::threading::Thread::Create({}, [this, i]() { CreationThread(i); });
+      assert_not_null(creation_thread);
+      creation_thread->set_name("Vulkan Pipelines");
+      creation_threads_.push_back(std::move(creation_thread));
+    }
+  }
+
   return true;
 }
 
@@ -90,14 +227,55 @@ void VulkanPipelineCache::Shutdown() {
   const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
   VkDevice device = provider.device();
 
+  // Shut down all threads, before destroying the pipelines since they may be
+  // creating them.
+  if (!creation_threads_.empty()) {
+    {
+      std::lock_guard<std::mutex> lock(creation_request_lock_);
+      creation_threads_shutdown_ = true;
+    }
+    creation_request_cond_.notify_all();
+    for (size_t i = 0; i < creation_threads_.size(); ++i) {
+      xe::threading::Wait(creation_threads_[i].get(), false);
+    }
+    creation_threads_.clear();
+  }
+  creation_queue_.clear();
+  optimized_link_queue_.clear();
+  creation_completion_event_.reset();
+
+  // Shut down the persistent shader / pipeline storage.
+  ShutdownShaderStorage();
+
   // Destroy all pipelines.
   last_pipeline_ = nullptr;
+  last_pipeline_inputs_valid_ = false;
+  fallback_pipelines_.clear();
   for (const auto& pipeline_pair : pipelines_) {
     if (pipeline_pair.second.pipeline != VK_NULL_HANDLE) {
       dfn.vkDestroyPipeline(device, pipeline_pair.second.pipeline, nullptr);
     }
+    if (pipeline_pair.second.unoptimized_pipeline != VK_NULL_HANDLE) {
+      dfn.vkDestroyPipeline(device, pipeline_pair.second.unoptimized_pipeline,
+                            nullptr);
+    }
   }
   pipelines_.clear();
+  for (const std::pair<Pipeline*, VkPipeline>& optimized_link :
+       optimized_links_completed_) {
+    dfn.vkDestroyPipeline(device, optimized_link.second, nullptr);
+  }
+  optimized_links_completed_.clear();
+  for (size_t i = 0; i < size_t(PipelineLibraryType::kCount); ++i) {
+    for (const auto& pipeline_library_pair : pipeline_libraries_[i]) {
+      if (pipeline_library_pair.second != VK_NULL_HANDLE) {
+        dfn.vkDestroyPipeline(device, pipeline_library_pair.second, nullptr);
+      }
+    }
+    pipeline_libraries_[i].clear();
+  }
+  dynamic_state_full_description_hashes_.clear();
+  last_dynamic_state_full_description_hash_ = 0;
 
   // Destroy all internal shaders.
   ui::vulkan::util::DestroyAndNullHandle(dfn.vkDestroyShaderModule, device,
@@ -119,14 +297,766 @@ void VulkanPipelineCache::Shutdown() {
 
   // Shut down shader translation.
   shader_translator_.reset();
+  optimized_spirv_.clear();
+  spirv_tools_context_.Shutdown();
+}
+
+void VulkanPipelineCache::InitializeShaderStorage(
+    const std::filesystem::path& cache_root, uint32_t title_id, bool blocking) {
+  ShutdownShaderStorage();
+
+  const ui::vulkan::VulkanProvider& provider =
+      command_processor_.GetVulkanProvider();
+  const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
+  VkDevice device = provider.device();
+
+  auto shader_storage_root = cache_root / "shaders";
+  // For files that can be moved between different hosts.
+  auto shader_storage_shareable_root = shader_storage_root / "shareable";
+  if (!std::filesystem::exists(shader_storage_shareable_root)) {
+    if (!std::filesystem::create_directories(shader_storage_shareable_root)) {
+      XELOGE(
+          "Failed to create the shareable shader storage directory, persistent "
+          "shader storage will be disabled: {}",
+          xe::path_to_utf8(shader_storage_shareable_root));
+      return;
+    }
+  }
+
+  bool edram_fragment_shader_interlock =
+      render_target_cache_.GetPath() ==
+      RenderTargetCache::Path::kPixelShaderInterlock;
+
+  // Initialize the pipeline storage stream - read pipeline descriptions and
+  // collect used shader modifications to translate.
+  std::vector<PipelineStoredDescription> pipeline_stored_descriptions;
+  // <Shader hash, modification bits>.
+  std::set<std::pair<uint64_t, uint64_t>> shader_translations_needed;
+  auto pipeline_storage_file_path =
+      shader_storage_shareable_root /
+      fmt::format("{:08X}.{}.vulkan.xpso", title_id,
+                  edram_fragment_shader_interlock ? "fsi" : "rtv");
+  pipeline_storage_file_ =
+      xe::filesystem::OpenFile(pipeline_storage_file_path, "a+b");
+  if (!pipeline_storage_file_) {
+    XELOGE(
+        "Failed to open the Vulkan pipeline description storage file for "
+        "writing, persistent shader storage will be disabled: {}",
+        xe::path_to_utf8(pipeline_storage_file_path));
+    return;
+  }
+  // Multiple emulator instances (such as ones running automated tests) may use
+  // the same storage files. Every record is appended atomically, and the
+  // existing contents are modified only by the instance that manages to take
+  // the exclusive lock, which means that no other instance has the file open.
+  xe::filesystem::LockStdioFile(pipeline_storage_file_,
+                                xe::filesystem::StdioFileLock::kShared, true);
+  pipeline_storage_file_flush_needed_ = false;
+  // 'XEPS'.
+  const uint32_t pipeline_storage_magic = 0x53504558;
+  // 'VKFS' or 'VKRT'.
+  const uint32_t pipeline_storage_magic_api =
+      edram_fragment_shader_interlock ? 0x53464B56 : 0x54524B56;
+  const uint32_t pipeline_storage_version_swapped =
+      xe::byte_swap(std::max(PipelineDescription::kVersion,
+                             SpirvShaderTranslator::Modification::kVersion));
+  struct {
+    uint32_t magic;
+    uint32_t magic_api;
+    uint32_t version_swapped;
+  } pipeline_storage_file_header;
+  auto read_pipeline_storage_file_header = [&]() {
+    return xe::filesystem::Seek(pipeline_storage_file_, 0, SEEK_SET) &&
+           fread(&pipeline_storage_file_header,
+                 sizeof(pipeline_storage_file_header), 1,
+                 pipeline_storage_file_) &&
+           pipeline_storage_file_header.magic == pipeline_storage_magic &&
+           pipeline_storage_file_header.magic_api ==
+               pipeline_storage_magic_api &&
+           pipeline_storage_file_header.version_swapped ==
+               pipeline_storage_version_swapped;
+  };
+  int64_t pipeline_storage_told_end = 0;
+  if (read_pipeline_storage_file_header()) {
+    xe::filesystem::Seek(pipeline_storage_file_, 0, SEEK_END);
+    pipeline_storage_told_end = xe::filesystem::Tell(pipeline_storage_file_);
+    size_t pipeline_storage_told_count =
+        size_t(pipeline_storage_told_end >=
+                       int64_t(sizeof(pipeline_storage_file_header))
+                   ? (uint64_t(pipeline_storage_told_end) -
+                      sizeof(pipeline_storage_file_header)) /
+                         sizeof(PipelineStoredDescription)
+                   : 0);
+    if (pipeline_storage_told_count &&
+        xe::filesystem::Seek(pipeline_storage_file_,
+                             int64_t(sizeof(pipeline_storage_file_header)),
+                             SEEK_SET)) {
+      pipeline_stored_descriptions.resize(pipeline_storage_told_count);
+      pipeline_stored_descriptions.resize(
+          fread(pipeline_stored_descriptions.data(),
+                sizeof(PipelineStoredDescription), pipeline_storage_told_count,
+                pipeline_storage_file_));
+      size_t pipeline_storage_read_count = pipeline_stored_descriptions.size();
+      for (size_t i = 0; i < pipeline_storage_read_count; ++i) {
+        const PipelineStoredDescription& pipeline_stored_description =
+            pipeline_stored_descriptions[i];
+        // Validate file integrity, stop and truncate the stream if data is
+        // corrupted.
+        if (pipeline_stored_description.description.GetHash() !=
+            pipeline_stored_description.description_hash) {
+          pipeline_stored_descriptions.resize(i);
+          break;
+        }
+        // Pipelines requiring unsupported device features are kept in the
+        // file so it stays shareable between devices, but not created.
+        if (!ArePipelineRequirementsMet(
+                pipeline_stored_description.description)) {
+          continue;
+        }
+        // Mark the shader modifications as needed for translation.
+        shader_translations_needed.emplace(
+            pipeline_stored_description.description.vertex_shader_hash,
+            pipeline_stored_description.description.vertex_shader_modification);
+        if (pipeline_stored_description.description.pixel_shader_hash) {
+          shader_translations_needed.emplace(
+              pipeline_stored_description.description.pixel_shader_hash,
+              pipeline_stored_description.description
+                  .pixel_shader_modification);
+        }
+      }
+    }
+  }
+
+  size_t logical_processor_count = xe::threading::logical_processor_count();
+  if (!logical_processor_count) {
+    // Pick some reasonable amount if couldn't determine the number of cores.
+    logical_processor_count = 6;
+  }
+
+  // Load the optimized SPIR-V before translating the shaders from the storage.
+  if (spirv_tools_context_.IsOptimizerAvailable()) {
+    InitializeOptimizedSpirvStorage(shader_storage_shareable_root, title_id);
+  }
+
+  // Initialize the Xenos shader storage stream. The contents are the same as
+  // in the Direct3D 12 shader storage, so the file is shared with it.
+  uint64_t shader_storage_initialization_start =
+      xe::Clock::QueryHostTickCount();
+  auto shader_storage_file_path =
+      shader_storage_shareable_root / fmt::format("{:08X}.xsh", title_id);
+  shader_storage_file_ =
+      xe::filesystem::OpenFile(shader_storage_file_path, "a+b");
+  if (!shader_storage_file_) {
+    XELOGE(
+        "Failed to open the guest shader storage file for writing, persistent "
+        "shader storage will be disabled: {}",
+        xe::path_to_utf8(shader_storage_file_path));
+    fclose(pipeline_storage_file_);
+    pipeline_storage_file_ = nullptr;
+    return;
+  }
+  xe::filesystem::LockStdioFile(shader_storage_file_,
+                                xe::filesystem::StdioFileLock::kShared, true);
+  ++shader_storage_index_;
+  shader_storage_file_flush_needed_ = false;
+  struct {
+    uint32_t magic;
+    uint32_t version_swapped;
+  } shader_storage_file_header;
+  // 'XESH'.
+  const uint32_t shader_storage_magic = 0x48534558;
+  auto read_shader_storage_file_header = [&]() {
+    return xe::filesystem::Seek(shader_storage_file_, 0, SEEK_SET) &&
+           fread(&shader_storage_file_header,
+                 sizeof(shader_storage_file_header), 1, shader_storage_file_) &&
+           shader_storage_file_header.magic == shader_storage_magic &&
+           xe::byte_swap(shader_storage_file_header.version_swapped) ==
+               ShaderStoredHeader::kVersion;
+  };
+  if (read_shader_storage_file_header()) {
+    // Map the file instead of reading it through the stream, so the pages are
+    // shared with other instances loading the same storage rather than copied
+    // into the memory of each.
+    xe::filesystem::Seek(shader_storage_file_, 0, SEEK_END);
+    int64_t shader_storage_told_end =
+        xe::filesystem::Tell(shader_storage_file_);
+    std::unique_ptr<MappedMemory> shader_storage_mapping;
+    if (shader_storage_told_end > int64_t(sizeof(shader_storage_file_header))) {
+      shader_storage_mapping = MappedMemory::Open(
+          shader_storage_file_path, MappedMemory::Mode::kRead, 0,
+          size_t(shader_storage_told_end));
+      if (!shader_storage_mapping) {
+        XELOGE("Failed to map the guest shader storage file for reading: {}",
+               xe::path_to_utf8(shader_storage_file_path));
+      }
+    }
+    uint64_t shader_storage_mapped_bytes =
+        shader_storage_mapping ? shader_storage_mapping->size() : 0;
+    uint64_t shader_storage_valid_bytes = sizeof(shader_storage_file_header);
+    // Load and translate shaders written by previous Xenia executions until the
+    // end of the file or until a corrupted one is detected.
+    ShaderStoredHeader shader_header;
+    size_t shaders_translated = 0;
+    size_t shader_ucode_bytes_read = 0;
+    // Progress report for big storages, not to look like a hang.
+    uint64_t shader_storage_progress_report_interval =
+        xe::Clock::QueryHostTickFrequency() * 2;
+    uint64_t shader_storage_next_progress_report =
+        shader_storage_initialization_start +
+        shader_storage_progress_report_interval;
+
+    // Threads overlapping file reading.
+    std::mutex shaders_translation_thread_mutex;
+    std::condition_variable shaders_translation_thread_cond;
+    std::deque<VulkanShader*> shaders_to_translate;
+    size_t shader_translation_threads_busy = 0;
+    bool shader_translation_threads_shutdown = false;
+    std::mutex shaders_failed_to_translate_mutex;
+    std::vector<VulkanShader::VulkanTranslation*> shaders_failed_to_translate;
+    std::atomic<size_t> shader_translations_done = {0};
+    auto shader_translation_thread_function = [&]() {
+      StringBuffer ucode_disasm_buffer;
+      SpirvShaderTranslator translator(
+          SpirvShaderTranslator::Features(provider),
+          render_target_cache_.msaa_2x_attachments_supported(),
+          render_target_cache_.msaa_2x_no_attachments_supported(),
+          edram_fragment_shader_interlock);
+      for (;;) {
+        VulkanShader* shader_to_translate;
+        for (;;) {
+          std::unique_lock<std::mutex> lock(shaders_translation_thread_mutex);
+          if (shaders_to_translate.empty()) {
+            if (shader_translation_threads_shutdown) {
+              return;
+            }
+            shaders_translation_thread_cond.wait(lock);
+            continue;
+          }
+          shader_to_translate = shaders_to_translate.front();
+          shaders_to_translate.pop_front();
+          ++shader_translation_threads_busy;
+          break;
+        }
+        shader_to_translate->AnalyzeUcode(ucode_disasm_buffer);
+        // Translate each needed modification on this thread after performing
+        // modification-independent analysis of the whole shader.
+        uint64_t ucode_data_hash = shader_to_translate->ucode_data_hash();
+        for (auto modification_it = shader_translations_needed.lower_bound(
+                 std::make_pair(ucode_data_hash, uint64_t(0)));
+             modification_it != shader_translations_needed.end() &&
+             modification_it->first == ucode_data_hash;
+             ++modification_it) {
+          VulkanShader::VulkanTranslation* translation =
+              static_cast<VulkanShader::VulkanTranslation*>(
+                  shader_to_translate->GetOrCreateTranslation(
+                      modification_it->second));
+          // Only try (and delete in case of failure) if it's a new translation.
+          // If it's a shader previously encountered in the game, translation of
+          // which has failed, and the shader storage is loaded later, keep it
+          // this way not to try to translate it again.
+          if (!translation->is_translated() &&
+              !TranslateAnalyzedShader(translator, *translation, true)) {
+            std::lock_guard<std::mutex> lock(shaders_failed_to_translate_mutex);
+            shaders_failed_to_translate.push_back(translation);
+          }
+          shader_translations_done.fetch_add(1, std::memory_order_relaxed);
+        }
+        {
+          std::lock_guard<std::mutex> lock(shaders_translation_thread_mutex);
+          --shader_translation_threads_busy;
+        }
+      }
+    };
+    std::vector<std::unique_ptr<xe::threading::Thread>>
+        shader_translation_threads;
+
+    while (true) {
+      if (shader_storage_valid_bytes + sizeof(shader_header) >
+          shader_storage_mapped_bytes) {
+        break;
+      }
+      const uint8_t* shader_record =
+          shader_storage_mapping->data() + shader_storage_valid_bytes;
+      // The header may be not 8-byte-aligned in the file.
+      std::memcpy(&shader_header, shader_record, sizeof(shader_header));
+      size_t ucode_byte_count =
+          shader_header.ucode_dword_count * sizeof(uint32_t);
+      if (shader_storage_valid_bytes + sizeof(shader_header) +
+              ucode_byte_count >
+          shader_storage_mapped_bytes) {
+        break;
+      }
+      const uint32_t* ucode_dwords = reinterpret_cast<const uint32_t*>(
+          shader_record + sizeof(shader_header));
+      uint64_t ucode_data_hash = XXH3_64bits(ucode_dwords, ucode_byte_count);
+      if (shader_header.ucode_data_hash != ucode_data_hash) {
+        // Validation failed.
+        break;
+      }
+      shader_storage_valid_bytes += sizeof(shader_header) + ucode_byte_count;
+      shader_ucode_bytes_read += ucode_byte_count;
+      VulkanShader* shader =
+          LoadShader(shader_header.type, ucode_dwords,
+                     shader_header.ucode_dword_count, ucode_data_hash);
+      if (shader->ucode_storage_index() == shader_storage_index_) {
+        // Appeared twice in this file for some reason - skip, otherwise race
+        // condition will be caused by translating twice in parallel.
+        continue;
+      }
+      // Loaded from the current storage - don't write again.
+      shader->set_ucode_storage_index(shader_storage_index_);
+      // Create new threads if the currently existing threads can't keep up
+      // with file reading, but not more than the number of logical processors
+      // minus one.
+      size_t shader_translation_threads_needed;
+      {
+        std::lock_guard<std::mutex> lock(shaders_translation_thread_mutex);
+        shader_translation_threads_needed =
+            std::min(shader_translation_threads_busy +
+                         shaders_to_translate.size() + size_t(1),
+                     std::max(logical_processor_count, size_t(2)) - size_t(1));
+      }
+      while (shader_translation_threads.size() <
+             shader_translation_threads_needed) {
+        auto thread = xe::threading::Thread::Create(
+            {}, shader_translation_thread_function);
+        assert_not_null(thread);
+        thread->set_name("Shader Translation");
+        shader_translation_threads.push_back(std::move(thread));
+      }
+      // Request ucode information gathering and translation of all the needed
+      // shaders.
+      {
+        std::lock_guard<std::mutex> lock(shaders_translation_thread_mutex);
+        shaders_to_translate.push_back(shader);
+      }
+      shaders_translation_thread_cond.notify_one();
+      ++shaders_translated;
+      uint64_t shader_storage_progress_time = xe::Clock::QueryHostTickCount();
+      if (shader_storage_progress_time >= shader_storage_next_progress_report) {
+        shader_storage_next_progress_report =
+            shader_storage_progress_time +
+            shader_storage_progress_report_interval;
+        XELOGGPU(
+            "Loading the shader storage: {} shaders read, {} translations "
+            "done on {} threads",
+            shaders_translated,
+            shader_translations_done.load(std::memory_order_relaxed),
+            shader_translation_threads.size());
+      }
+    }
+    // Translate the rest of the shaders on this thread too rather than only
+    // awaiting the translation threads - all the logical processors are
+    // available now, and if there's only one, no translation threads have been
+    // created.
+    {
+      std::lock_guard<std::mutex> lock(shaders_translation_thread_mutex);
+      shader_translation_threads_shutdown = true;
+    }
+    shaders_translation_thread_cond.notify_all();
+    shader_translation_thread_function();
+    size_t shader_translation_thread_count =
+        shader_translation_threads.size() + 1;
+    for (auto& shader_translation_thread : shader_translation_threads) {
+      xe::threading::Wait(shader_translation_thread.get(), false);
+    }
+    shader_translation_threads.clear();
+    size_t shader_translations_failed = shaders_failed_to_translate.size();
+    for (VulkanShader::VulkanTranslation* translation :
+         shaders_failed_to_translate) {
+      VulkanShader* shader =
+          static_cast<VulkanShader*>(&translation->shader());
+      shader->DestroyTranslation(translation->modification());
+      if (shader->translations().empty()) {
+        shaders_.erase(shader->ucode_data_hash());
+        delete shader;
+      }
+    }
+    uint64_t shader_storage_initialization_ms =
+        (xe::Clock::QueryHostTickCount() -
+         shader_storage_initialization_start) *
+        1000 / xe::Clock::QueryHostTickFrequency();
+    XELOGGPU(
+        "Translated {} shaders ({} KB of microcode, {} translations, {} "
+        "failed) from the storage in {} milliseconds on {} threads, {} shaders "
+        "per second",
+        shaders_translated, shader_ucode_bytes_read / 1024,
+        shader_translations_done.load(std::memory_order_relaxed),
+        shader_translations_failed, shader_storage_initialization_ms,
+        shader_translation_thread_count,
+        shaders_translated * 1000 /
+            std::max(shader_storage_initialization_ms, uint64_t(1)));
+    // The ucode has been copied to the shaders, and a mapped file can't be
+    // truncated on Windows.
+    shader_storage_mapping.reset();
+    if (shader_storage_valid_bytes < shader_storage_mapped_bytes) {
+      // Shaders appended after the corrupted data are unreachable, but if
+      // other instances are using the file, there may be new valid shaders in
+      // the end that have not been read.
+      if (xe::filesystem::TryUpgradeStdioFileLock(shader_storage_file_)) {
+        xe::filesystem::TruncateStdioFile(shader_storage_file_,
+                                          shader_storage_valid_bytes);
+        xe::filesystem::LockStdioFile(
+            shader_storage_file_, xe::filesystem::StdioFileLock::kShared, true);
+      } else {
+        XELOGW(
+            "The guest shader storage file has corrupted data, but can't be "
+            "truncated while in use by another instance: {}",
+            xe::path_to_utf8(shader_storage_file_path));
+      }
+    }
+  } else if (xe::filesystem::TryUpgradeStdioFileLock(shader_storage_file_)) {
+    xe::filesystem::TruncateStdioFile(shader_storage_file_, 0);
+    shader_storage_file_header.magic = shader_storage_magic;
+    shader_storage_file_header.version_swapped =
+        xe::byte_swap(ShaderStoredHeader::kVersion);
+    xe::filesystem::AppendToStdioFile(shader_storage_file_,
+                                      &shader_storage_file_header,
+                                      sizeof(shader_storage_file_header));
+    xe::filesystem::LockStdioFile(shader_storage_file_,
+                                  xe::filesystem::StdioFileLock::kShared, true);
+  } else if (!read_shader_storage_file_header()) {
+    // If another instance hasn't just initialized the file (and the header is
+    // valid now), it's likely from a different version of Xenia.
+    XELOGW(
+        "The guest shader storage file is in use by another instance and has "
+        "an incompatible header, persistent shader storage will be disabled: "
+        "{}",
+        xe::path_to_utf8(shader_storage_file_path));
+    fclose(shader_storage_file_);
+    shader_storage_file_ = nullptr;
+  }
+
+  // Create the Vulkan pipeline cache object with the data from the previous
+  // runs on the same device and driver. The driver rejects incompatible data
+  // too, but it's checked here to avoid relying on that.
+  // For files that are specific to the host device and driver.
+  auto shader_storage_local_root = shader_storage_root / "local";
+  vk_pipeline_cache_file_path_ =
+      shader_storage_local_root /
+      fmt::format("{:08X}.{}.vulkan.vkpc", title_id,
+                  edram_fragment_shader_interlock ? "fsi" : "rtv");
+  std::vector<uint8_t> vk_pipeline_cache_data;
+  if (FILE* vk_pipeline_cache_file =
+          xe::filesystem::OpenFile(vk_pipeline_cache_file_path_, "rb")) {
+    xe::filesystem::Seek(vk_pipeline_cache_file, 0, SEEK_END);
+    int64_t vk_pipeline_cache_file_size =
+        xe::filesystem::Tell(vk_pipeline_cache_file);
+    if (vk_pipeline_cache_file_size > 0 &&
+        xe::filesystem::Seek(vk_pipeline_cache_file, 0, SEEK_SET)) {
+      vk_pipeline_cache_data.resize(size_t(vk_pipeline_cache_file_size));
+      if (!fread(vk_pipeline_cache_data.data(), vk_pipeline_cache_data.size(),
+                 1, vk_pipeline_cache_file)) {
+        vk_pipeline_cache_data.clear();
+      }
+    }
+    fclose(vk_pipeline_cache_file);
+  }
+  if (!vk_pipeline_cache_data.empty()) {
+    const VkPhysicalDeviceProperties& device_properties =
+        provider.device_properties();
+    // VkPipelineCacheHeaderVersionOne.
+    struct {
+      uint32_t header_size;
+      uint32_t header_version;
+      uint32_t vendor_id;
+      uint32_t device_id;
+      uint8_t pipeline_cache_uuid[VK_UUID_SIZE];
+    } vk_pipeline_cache_header;
+    if (vk_pipeline_cache_data.size() < sizeof(vk_pipeline_cache_header)) {
+      vk_pipeline_cache_data.clear();
+    } else {
+      std::memcpy(&vk_pipeline_cache_header, vk_pipeline_cache_data.data(),
+                  sizeof(vk_pipeline_cache_header));
+      if (vk_pipeline_cache_header.header_size <
+              sizeof(vk_pipeline_cache_header) ||
+          vk_pipeline_cache_header.header_version !=
+              VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+          vk_pipeline_cache_header.vendor_id != device_properties.vendorID ||
+          vk_pipeline_cache_header.device_id != device_properties.deviceID ||
+          std::memcmp(vk_pipeline_cache_header.pipeline_cache_uuid,
+                      device_properties.pipelineCacheUUID, VK_UUID_SIZE)) {
+        XELOGGPU(
+            "Vulkan pipeline cache data is for a different device or driver, "
+            "discarding");
+        vk_pipeline_cache_data.clear();
+      }
+    }
+  }
+  VkPipelineCacheCreateInfo vk_pipeline_cache_create_info;
+  vk_pipeline_cache_create_info.sType =
+      VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+  vk_pipeline_cache_create_info.pNext = nullptr;
+  vk_pipeline_cache_create_info.flags = 0;
+  vk_pipeline_cache_create_info.initialDataSize = vk_pipeline_cache_data.size();
+  vk_pipeline_cache_create_info.pInitialData =
+      vk_pipeline_cache_data.empty() ? nullptr : vk_pipeline_cache_data.data();
+  if (dfn.vkCreatePipelineCache(device, &vk_pipeline_cache_create_info,
+                                nullptr, &vk_pipeline_cache_) != VK_SUCCESS) {
+    XELOGE("Failed to create a Vulkan pipeline cache object");
+    vk_pipeline_cache_ = VK_NULL_HANDLE;
+  }
+
+  // Create the pipelines.
+  if (!pipeline_stored_descriptions.empty()) {
+    uint64_t pipeline_creation_start = xe::Clock::QueryHostTickCount();
+
+    // Gather everything needed for creation on this thread, then create the
+    // pipelines on all cores.
+    std::vector<PipelineCreationArguments> pipelines_to_create;
+    pipelines_to_create.reserve(pipeline_stored_descriptions.size());
+    for (const PipelineStoredDescription& pipeline_stored_description :
+         pipeline_stored_descriptions) {
+      const PipelineDescription& pipeline_description =
+          pipeline_stored_description.description;
+      // Skip already known pipelines and pipelines not supported by the
+      // device.
+      if (pipelines_.find(pipeline_description) != pipelines_.end() ||
+          !ArePipelineRequirementsMet(pipeline_description)) {
+        continue;
+      }
+
+      auto vertex_shader_it =
+          shaders_.find(pipeline_description.vertex_shader_hash);
+      if (vertex_shader_it == shaders_.end()) {
+        continue;
+      }
+      auto vertex_shader = static_cast<VulkanShader::VulkanTranslation*>(
+          vertex_shader_it->second->GetTranslation(
+              pipeline_description.vertex_shader_modification));
+      if (!vertex_shader || !vertex_shader->is_translated() ||
+          !vertex_shader->is_valid()) {
+        continue;
+      }
+      VulkanShader::VulkanTranslation* pixel_shader = nullptr;
+      if (pipeline_description.pixel_shader_hash) {
+        auto pixel_shader_it =
+            shaders_.find(pipeline_description.pixel_shader_hash);
+        if (pixel_shader_it == shaders_.end()) {
+          continue;
+        }
+        pixel_shader = static_cast<VulkanShader::VulkanTranslation*>(
+            pixel_shader_it->second->GetTranslation(
+                pipeline_description.pixel_shader_modification));
+        if (!pixel_shader || !pixel_shader->is_translated() ||
+            !pixel_shader->is_valid()) {
+          continue;
+        }
+      }
+
+      const PipelineLayoutProvider* pipeline_layout;
+      PipelineCreationArguments& creation_arguments =
+          pipelines_to_create.emplace_back();
+      if (!GetPipelineCreationObjects(
+              pipeline_description, vertex_shader, pixel_shader,
+              pipeline_layout, creation_arguments.geometry_shader,
+              creation_arguments.render_pass)) {
+        pipelines_to_create.pop_back();
+        continue;
+      }
+      creation_arguments.pipeline =
+          &*pipelines_.emplace(pipeline_description, pipeline_layout).first;
+      creation_arguments.vertex_shader = vertex_shader;
+      creation_arguments.pixel_shader = pixel_shader;
+    }
+
+    // Using the current thread too.
+    std::atomic<size_t> pipeline_creation_next_index = {0};
+    auto pipeline_creation_thread_function = [&]() {
+      for (;;) {
+        size_t pipeline_index = pipeline_creation_next_index.fetch_add(
+            1, std::memory_order_relaxed);
+        if (pipeline_index >= pipelines_to_create.size()) {
+          return;
+        }
+        EnsurePipelineCreated(pipelines_to_create[pipeline_index]);
+      }
+    };
+    std::vector<std::unique_ptr<xe::threading::Thread>>
+        pipeline_creation_threads;
+    size_t pipeline_creation_thread_count =
+        std::min(pipelines_to_create.size(), logical_processor_count);
+    for (size_t i = 1; i < pipeline_creation_thread_count; ++i) {
+      auto thread = xe::threading::Thread::Create(
+          {}, pipeline_creation_thread_function);
+      assert_not_null(thread);
+      thread->set_name("Vulkan Pipelines");
+      pipeline_creation_threads.push_back(std::move(thread));
+    }
+    pipeline_creation_thread_function();
+    for (auto& pipeline_creation_thread : pipeline_creation_threads) {
+      xe::threading::Wait(pipeline_creation_thread.get(), false);
+    }
+
+    XELOGGPU(
+        "Created {} graphics pipelines (not including reading the "
+        "descriptions) from the storage in {} milliseconds",
+        pipelines_to_create.size(),
+        (xe::Clock::QueryHostTickCount() - pipeline_creation_start) * 1000 /
+            xe::Clock::QueryHostTickFrequency());
+  }
+  if (pipeline_storage_told_end) {
+    // If any pipeline descriptions were corrupted (or the whole file has excess
+    // bytes in the end), truncate to the last valid pipeline description, but
+    // only if no other instance is using the file.
+    uint64_t pipeline_storage_valid_bytes =
+        uint64_t(sizeof(pipeline_storage_file_header) +
+                 sizeof(PipelineStoredDescription) *
+                     pipeline_stored_descriptions.size());
+    if (pipeline_storage_valid_bytes < uint64_t(pipeline_storage_told_end) &&
+        xe::filesystem::TryUpgradeStdioFileLock(pipeline_storage_file_)) {
+      xe::filesystem::TruncateStdioFile(pipeline_storage_file_,
+                                        pipeline_storage_valid_bytes);
+      xe::filesystem::LockStdioFile(
+          pipeline_storage_file_, xe::filesystem::StdioFileLock::kShared, true);
+    }
+  } else if (xe::filesystem::TryUpgradeStdioFileLock(pipeline_storage_file_)) {
+    xe::filesystem::TruncateStdioFile(pipeline_storage_file_, 0);
+    pipeline_storage_file_header.magic = pipeline_storage_magic;
+    pipeline_storage_file_header.magic_api = pipeline_storage_magic_api;
+    pipeline_storage_file_header.version_swapped =
+        pipeline_storage_version_swapped;
+    xe::filesystem::AppendToStdioFile(pipeline_storage_file_,
+                                      &pipeline_storage_file_header,
+                                      sizeof(pipeline_storage_file_header));
+    xe::filesystem::LockStdioFile(pipeline_storage_file_,
+                                  xe::filesystem::StdioFileLock::kShared, true);
+  } else if (!read_pipeline_storage_file_header()) {
+    XELOGW(
+        "The Vulkan pipeline description storage file is in use by another "
+        "instance and has an incompatible header, pipeline storage will be "
+        "disabled: {}",
+        xe::path_to_utf8(pipeline_storage_file_path));
+    fclose(pipeline_storage_file_);
+    pipeline_storage_file_ = nullptr;
+  }
+
+  shader_storage_cache_root_ = cache_root;
+  shader_storage_title_id_ = title_id;
+
+  // Start the storage writing thread.
+  storage_write_flush_shaders_ = false;
+  storage_write_flush_pipelines_ = false;
+  storage_write_thread_shutdown_ = false;
+  storage_write_thread_ =
+      xe::threading::Thread::Create({}, [this]() { StorageWriteThread(); });
+  assert_not_null(storage_write_thread_);
+  storage_write_thread_->set_name("Vulkan Storage writer");
+}
+
+void VulkanPipelineCache::ShutdownShaderStorage() {
+  // The creation threads may be using the Vulkan pipeline cache object.
+  CreateQueuedPipelines();
+
+  if (storage_write_thread_) {
+    {
+      std::lock_guard<std::mutex> lock(storage_write_request_lock_);
+      storage_write_thread_shutdown_ = true;
+    }
+    storage_write_request_cond_.notify_all();
+    xe::threading::Wait(storage_write_thread_.get(), false);
+    storage_write_thread_.reset();
+  }
+  storage_write_shader_queue_.clear();
+  storage_write_pipeline_queue_.clear();
+  storage_write_spirv_queue_.clear();
+
+  if (optimized_spirv_storage_file_) {
+    fclose(optimized_spirv_storage_file_);
+    optimized_spirv_storage_file_ = nullptr;
+  }
+
+  if (pipeline_storage_file_) {
+    fclose(pipeline_storage_file_);
+    pipeline_storage_file_ = nullptr;
+    pipeline_storage_file_flush_needed_ = false;
+  }
+
+  if (shader_storage_file_) {
+    fclose(shader_storage_file_);
+    shader_storage_file_ = nullptr;
+    shader_storage_file_flush_needed_ = false;
+  }
+
+  if (vk_pipeline_cache_ != VK_NULL_HANDLE) {
+    WriteVulkanPipelineCacheData();
+    const ui::vulkan::VulkanProvider& provider =
+        command_processor_.GetVulkanProvider();
+    provider.dfn().vkDestroyPipelineCache(provider.device(),
+                                          vk_pipeline_cache_, nullptr);
+    vk_pipeline_cache_ = VK_NULL_HANDLE;
+  }
+  vk_pipeline_cache_file_path_.clear();
+
+  shader_storage_cache_root_.clear();
+  shader_storage_title_id_ = 0;
+}
+
+void VulkanPipelineCache::EndSubmission() {
+  if (shader_storage_file_flush_needed_ ||
+      pipeline_storage_file_flush_needed_) {
+    {
+      std::lock_guard<std::mutex> lock(storage_write_request_lock_);
+      if (shader_storage_file_flush_needed_) {
+        storage_write_flush_shaders_ = true;
+      }
+      if (pipeline_storage_file_flush_needed_) {
+        storage_write_flush_pipelines_ = true;
+      }
+    }
+    storage_write_request_cond_.notify_one();
+    shader_storage_file_flush_needed_ = false;
+    pipeline_storage_file_flush_needed_ = false;
+  }
+  // With the other policies, draws never use pipelines that are still being
+  // created, so they don't need to be awaited.
+  if (pending_pipeline_draw_policy_ == PendingPipelineDrawPolicy::kWait) {
+    CreateQueuedPipelines();
+  }
+  // Switch to the link-time optimized pipelines. Pipeline handles are resolved
+  // when the deferred command buffer is executed, so the switch is safe at any
+  // point on the command processor thread.
+  if (pipeline_libraries_fast_linking_ && !creation_threads_.empty()) {
+    std::lock_guard<std::mutex> lock(creation_request_lock_);
+    for (const std::pair<Pipeline*, VkPipeline>& optimized_link :
+         optimized_links_completed_) {
+      Pipeline& pipeline = *optimized_link.first;
+      assert_true(pipeline.unoptimized_pipeline == VK_NULL_HANDLE);
+      pipeline.unoptimized_pipeline = pipeline.pipeline;
+      pipeline.pipeline = optimized_link.second;
+    }
+    optimized_links_completed_.clear();
+  }
+}
+
+bool VulkanPipelineCache::IsCreatingPipelines() {
+  if (creation_threads_.empty()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(creation_request_lock_);
+  return !creation_queue_.empty() || creation_threads_busy_ != 0;
+}
+
+size_t VulkanPipelineCache::GetCreatingPipelineCount() {
+  if (creation_threads_.empty()) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(creation_request_lock_);
+  return creation_queue_.size() + creation_threads_busy_;
 }
 
 VulkanShader* VulkanPipelineCache::LoadShader(xenos::ShaderType shader_type,
                                               const uint32_t* host_address,
                                               uint32_t dword_count) {
   // Hash the input memory and lookup the shader.
-  uint64_t data_hash =
-      XXH3_64bits(host_address, dword_count * sizeof(uint32_t));
+  return LoadShader(shader_type, host_address, dword_count,
+                    XXH3_64bits(host_address, dword_count * sizeof(uint32_t)));
+}
+
+VulkanShader* VulkanPipelineCache::LoadShader(xenos::ShaderType shader_type,
+                                              const uint32_t* host_address,
+                                              uint32_t dword_count,
+                                              uint64_t data_hash) {
   auto it = shaders_.find(data_hash);
   if (it != shaders_.end()) {
     // Shader has been previously loaded.
@@ -160,6 +1090,22 @@ VulkanPipelineCache::GetCurrentVertexShaderModification(
 
   modification.vertex.interpolator_mask = interpolator_mask;
 
+  if (cvars::vulkan_vertex_fetch_endian_specialization) {
+    bool vertex_fetch_endian_8in32 = true;
+    for (const Shader::VertexBinding& vertex_binding :
+         shader.vertex_bindings()) {
+      if (regs.Get<xenos::xe_gpu_vertex_fetch_t>(
+                  XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0 +
+                  vertex_binding.fetch_constant * 2)
+              .endian != xenos::Endian::k8in32) {
+        vertex_fetch_endian_8in32 = false;
+        break;
+      }
+    }
+    modification.vertex.vertex_fetch_endian_8in32 =
+        uint32_t(vertex_fetch_endian_8in32);
+  }
+
   if (host_vertex_shader_type ==
       Shader::HostVertexShaderType::kPointListAsTriangleStrip) {
     modification.vertex.output_point_parameters = uint32_t(ps_param_gen_used);
@@ -234,10 +1180,12 @@ bool VulkanPipelineCache::EnsureShadersTranslated(
   assert_false(register_file_.Get<reg::SQ_PROGRAM_CNTL>().gen_index_vtx);
   if (!vertex_shader->is_translated()) {
     vertex_shader->shader().AnalyzeUcode(ucode_disasm_buffer_);
-    if (!TranslateAnalyzedShader(*shader_translator_, *vertex_shader)) {
+    if (!TranslateAnalyzedShader(*shader_translator_, *vertex_shader,
+                                 false)) {
       XELOGE("Failed to translate the vertex shader!");
       return false;
     }
+    StoreShader(vertex_shader->shader());
   }
   if (!vertex_shader->is_valid()) {
     // Translation attempted previously, but not valid.
@@ -246,10 +1194,12 @@ bool VulkanPipelineCache::EnsureShadersTranslated(
   if (pixel_shader != nullptr) {
     if (!pixel_shader->is_translated()) {
       pixel_shader->shader().AnalyzeUcode(ucode_disasm_buffer_);
-      if (!TranslateAnalyzedShader(*shader_translator_, *pixel_shader)) {
+      if (!TranslateAnalyzedShader(*shader_translator_, *pixel_shader,
+                                   false)) {
         XELOGE("Failed to translate the pixel shader!");
         return false;
       }
+      StoreShader(pixel_shader->shader());
     }
     if (!pixel_shader->is_valid()) {
       // Translation attempted previously, but not valid.
@@ -259,45 +1209,12 @@ bool VulkanPipelineCache::EnsureShadersTranslated(
   return true;
 }
 
-bool VulkanPipelineCache::ConfigurePipeline(
-    VulkanShader::VulkanTranslation* vertex_shader,
-    VulkanShader::VulkanTranslation* pixel_shader,
-    const PrimitiveProcessor::ProcessingResult& primitive_processing_result,
-    reg::RB_DEPTHCONTROL normalized_depth_control,
-    uint32_t normalized_color_mask,
-    VulkanRenderTargetCache::RenderPassKey render_pass_key,
-    VkPipeline& pipeline_out,
-    const PipelineLayoutProvider*& pipeline_layout_out) {
-#if XE_UI_VULKAN_FINE_GRAINED_DRAW_SCOPES
-  SCOPE_profile_cpu_f("gpu");
-#endif  // XE_UI_VULKAN_FINE_GRAINED_DRAW_SCOPES
-
-  // Ensure shaders are translated - needed now for GetCurrentStateDescription.
-  if (!EnsureShadersTranslated(vertex_shader, pixel_shader)) {
-    return false;
-  }
-
-  PipelineDescription description;
-  if (!GetCurrentStateDescription(
-          vertex_shader, pixel_shader, primitive_processing_result,
-          normalized_depth_control, normalized_color_mask, render_pass_key,
-          description)) {
-    return false;
-  }
-  if (last_pipeline_ && last_pipeline_->first == description) {
-    pipeline_out = last_pipeline_->second.pipeline;
-    pipeline_layout_out = last_pipeline_->second.pipeline_layout;
-    return true;
-  }
-  auto it = pipelines_.find(description);
-  if (it != pipelines_.end()) {
-    last_pipeline_ = &*it;
-    pipeline_out = it->second.pipeline;
-    pipeline_layout_out = it->second.pipeline_layout;
-    return true;
-  }
-
-  // Create the pipeline if not the latest and not already existing.
+bool VulkanPipelineCache::GetPipelineCreationObjects(
+    const PipelineDescription& description,
+    const VulkanShader::VulkanTranslation* vertex_shader,
+    const VulkanShader::VulkanTranslation* pixel_shader,
+    const PipelineLayoutProvider*& pipeline_layout_out,
+    VkShaderModule& geometry_shader_out, VkRenderPass& render_pass_out) {
   const PipelineLayoutProvider* pipeline_layout =
       command_processor_.GetPipelineLayout(
           pixel_shader
@@ -332,34 +1249,168 @@ bool VulkanPipelineCache::ConfigurePipeline(
       return false;
     }
   }
-  VkRenderPass render_pass =
-      render_target_cache_.GetPath() ==
-              RenderTargetCache::Path::kPixelShaderInterlock
-          ? render_target_cache_.GetFragmentShaderInterlockRenderPass()
-          : render_target_cache_.GetHostRenderTargetsRenderPass(
-                render_pass_key);
-  if (render_pass == VK_NULL_HANDLE) {
+  VkRenderPass render_pass = VK_NULL_HANDLE;
+  if (!description.dynamic_rendering) {
+    render_pass =
+        render_target_cache_.GetPath() ==
+                RenderTargetCache::Path::kPixelShaderInterlock
+            ? render_target_cache_.GetFragmentShaderInterlockRenderPass()
+            : render_target_cache_.GetHostRenderTargetsRenderPass(
+                  description.render_pass_key);
+    if (render_pass == VK_NULL_HANDLE) {
+      return false;
+    }
+  }
+  pipeline_layout_out = pipeline_layout;
+  geometry_shader_out = geometry_shader;
+  render_pass_out = render_pass;
+  return true;
+}
+
+bool VulkanPipelineCache::ConfigurePipeline(
+    VulkanShader::VulkanTranslation* vertex_shader,
+    VulkanShader::VulkanTranslation* pixel_shader,
+    const PrimitiveProcessor::ProcessingResult& primitive_processing_result,
+    reg::RB_DEPTHCONTROL normalized_depth_control,
+    uint32_t normalized_color_mask,
+    VulkanRenderTargetCache::RenderPassKey render_pass_key,
+    void*& pipeline_handle_out,
+    const PipelineLayoutProvider*& pipeline_layout_out,
+    ExtendedDynamicState& extended_dynamic_state_out) {
+#if XE_UI_VULKAN_FINE_GRAINED_DRAW_SCOPES
+  SCOPE_profile_cpu_f("gpu");
+#endif  // XE_UI_VULKAN_FINE_GRAINED_DRAW_SCOPES
+
+  // In runs of draws without state changes between them (such as ones only
+  // with different index buffers), skip building and looking up the pipeline
+  // description if nothing it's derived from has changed. The shaders have
+  // already been translated in this case.
+  uint64_t pipeline_state_register_write_count =
+      command_processor_.pipeline_state_register_write_count();
+  LastPipelineInputs& last_pipeline_inputs = last_pipeline_inputs_;
+  if (last_pipeline_inputs_valid_ &&
+      last_pipeline_inputs.pipeline_state_register_write_count ==
+          pipeline_state_register_write_count &&
+      last_pipeline_inputs.vertex_shader == vertex_shader &&
+      last_pipeline_inputs.pixel_shader == pixel_shader &&
+      last_pipeline_inputs.host_primitive_type ==
+          primitive_processing_result.host_primitive_type &&
+      last_pipeline_inputs.host_primitive_reset_enabled ==
+          primitive_processing_result.host_primitive_reset_enabled &&
+      last_pipeline_inputs.normalized_depth_control.value ==
+          normalized_depth_control.value &&
+      last_pipeline_inputs.normalized_color_mask == normalized_color_mask &&
+      last_pipeline_inputs.render_pass_key == render_pass_key) {
+    extended_dynamic_state_out = last_pipeline_inputs.extended_dynamic_state;
+    return ResolvePipelineForDraw(*last_pipeline_, pipeline_handle_out,
+                                  pipeline_layout_out);
+  }
+  last_pipeline_inputs_valid_ = false;
+
+  // Ensure shaders are translated - needed now for GetCurrentStateDescription.
+  if (!EnsureShadersTranslated(vertex_shader, pixel_shader)) {
     return false;
   }
+
+  PipelineDescription description;
+  if (!GetCurrentStateDescription(
+          vertex_shader, pixel_shader, primitive_processing_result,
+          normalized_depth_control, normalized_color_mask, render_pass_key,
+          description)) {
+    return false;
+  }
+  last_pipeline_inputs.pipeline_state_register_write_count =
+      pipeline_state_register_write_count;
+  last_pipeline_inputs.vertex_shader = vertex_shader;
+  last_pipeline_inputs.pixel_shader = pixel_shader;
+  last_pipeline_inputs.host_primitive_type =
+      primitive_processing_result.host_primitive_type;
+  last_pipeline_inputs.host_primitive_reset_enabled =
+      primitive_processing_result.host_primitive_reset_enabled;
+  last_pipeline_inputs.normalized_depth_control = normalized_depth_control;
+  last_pipeline_inputs.normalized_color_mask = normalized_color_mask;
+  last_pipeline_inputs.render_pass_key = render_pass_key;
+  // Whether the full state hasn't been seen before, but the pipeline may
+  // already exist for a different full state.
+  bool full_state_new = false;
+  if (description.dynamic_rendering) {
+    uint64_t full_description_hash = description.GetHash();
+    if (full_description_hash != last_dynamic_state_full_description_hash_) {
+      last_dynamic_state_full_description_hash_ = full_description_hash;
+      full_state_new =
+          dynamic_state_full_description_hashes_.insert(full_description_hash)
+              .second;
+    }
+    ExtractExtendedDynamicState(description, extended_dynamic_state_out);
+    last_pipeline_inputs.extended_dynamic_state = extended_dynamic_state_out;
+  }
+  if (last_pipeline_ && last_pipeline_->first == description) {
+    if (full_state_new) {
+      ++pipelines_shared_by_dynamic_state_total_;
+    }
+    last_pipeline_inputs_valid_ = true;
+    return ResolvePipelineForDraw(*last_pipeline_, pipeline_handle_out,
+                                  pipeline_layout_out);
+  }
+  auto it = pipelines_.find(description);
+  if (it != pipelines_.end()) {
+    if (full_state_new) {
+      ++pipelines_shared_by_dynamic_state_total_;
+    }
+    last_pipeline_ = &*it;
+    last_pipeline_inputs_valid_ = true;
+    return ResolvePipelineForDraw(*it, pipeline_handle_out,
+                                  pipeline_layout_out);
+  }
+
+  // Create the pipeline if not the latest and not already existing.
   PipelineCreationArguments creation_arguments;
-  auto& pipeline =
-      *pipelines_.emplace(description, Pipeline(pipeline_layout)).first;
+  const PipelineLayoutProvider* pipeline_layout;
+  if (!GetPipelineCreationObjects(description, vertex_shader, pixel_shader,
+                                  pipeline_layout,
+                                  creation_arguments.geometry_shader,
+                                  creation_arguments.render_pass)) {
+    return false;
+  }
+  auto& pipeline = *pipelines_.emplace(description, pipeline_layout).first;
+  last_pipeline_ = &pipeline;
+  last_pipeline_inputs_valid_ = true;
   creation_arguments.pipeline = &pipeline;
   creation_arguments.vertex_shader = vertex_shader;
   creation_arguments.pixel_shader = pixel_shader;
-  creation_arguments.geometry_shader = geometry_shader;
-  creation_arguments.render_pass = render_pass;
-  if (!EnsurePipelineCreated(creation_arguments)) {
-    return false;
+  if (!creation_threads_.empty()) {
+    // Submit the pipeline for creation to any available thread.
+    {
+      std::lock_guard<std::mutex> lock(creation_request_lock_);
+      creation_queue_.push_back(creation_arguments);
+    }
+    creation_request_cond_.notify_one();
+  } else {
+    EnsurePipelineCreated(creation_arguments);
   }
-  pipeline_out = pipeline.second.pipeline;
-  pipeline_layout_out = pipeline_layout;
-  return true;
+
+  if (pipeline_storage_file_) {
+    assert_not_null(storage_write_thread_);
+    pipeline_storage_file_flush_needed_ = true;
+    {
+      std::lock_guard<std::mutex> lock(storage_write_request_lock_);
+      storage_write_pipeline_queue_.emplace_back();
+      PipelineStoredDescription& stored_description =
+          storage_write_pipeline_queue_.back();
+      stored_description.description_hash = description.GetHash();
+      std::memcpy(&stored_description.description, &description,
+                  sizeof(description));
+    }
+    storage_write_request_cond_.notify_all();
+  }
+
+  return ResolvePipelineForDraw(pipeline, pipeline_handle_out,
+                                pipeline_layout_out);
 }
 
 bool VulkanPipelineCache::TranslateAnalyzedShader(
     SpirvShaderTranslator& translator,
-    VulkanShader::VulkanTranslation& translation) {
+    VulkanShader::VulkanTranslation& translation, bool storage_loading) {
   VulkanShader& shader = static_cast<VulkanShader&>(translation.shader());
 
   // Perform translation.
@@ -369,6 +1420,49 @@ bool VulkanPipelineCache::TranslateAnalyzedShader(
            shader.ucode_data_hash());
     return false;
   }
+
+  // Replace the SPIR-V with the optimized one if available. Cached by the
+  // unoptimized SPIR-V rather than by the ucode and the modification as the
+  // translation depends on the device features too.
+  if (spirv_tools_context_.IsOptimizerAvailable()) {
+    const std::vector<uint8_t>& unoptimized_binary =
+        translation.translated_binary();
+    uint64_t unoptimized_hash =
+        XXH3_64bits(unoptimized_binary.data(), unoptimized_binary.size());
+    std::vector<uint8_t> optimized_binary;
+    {
+      std::lock_guard<std::mutex> lock(optimized_spirv_mutex_);
+      auto optimized_it = optimized_spirv_.find(unoptimized_hash);
+      if (optimized_it != optimized_spirv_.end()) {
+        optimized_binary = optimized_it->second;
+      }
+    }
+    if (optimized_binary.empty()) {
+      const uint32_t* unoptimized_words =
+          reinterpret_cast<const uint32_t*>(unoptimized_binary.data());
+      size_t unoptimized_word_count =
+          unoptimized_binary.size() / sizeof(uint32_t);
+      if (storage_loading) {
+        OptimizeSpirv(unoptimized_hash, unoptimized_words,
+                      unoptimized_word_count, optimized_binary);
+      } else if (storage_write_thread_) {
+        // Don't stall the command processor thread with the optimization.
+        {
+          std::lock_guard<std::mutex> lock(storage_write_request_lock_);
+          storage_write_spirv_queue_.emplace_back(
+              unoptimized_hash,
+              std::vector<uint32_t>(
+                  unoptimized_words,
+                  unoptimized_words + unoptimized_word_count));
+        }
+        storage_write_request_cond_.notify_one();
+      }
+    }
+    if (!optimized_binary.empty()) {
+      translation.set_translated_binary(std::move(optimized_binary));
+    }
+  }
+
   if (translation.GetOrCreateShaderModule() == VK_NULL_HANDLE) {
     return false;
   }
@@ -385,6 +1479,9 @@ bool VulkanPipelineCache::TranslateAnalyzedShader(
         shader.GetTextureBindingsAfterTranslation();
     size_t texture_binding_count = texture_bindings.size();
     if (texture_binding_count) {
+      // May be called from multiple shader translation threads when loading
+      // the shader storage.
+      std::lock_guard<std::mutex> layouts_lock(layouts_mutex_);
       size_t texture_binding_layout_bytes =
           texture_binding_count * sizeof(*texture_bindings.data());
       uint64_t texture_binding_layout_hash =
@@ -436,6 +1533,156 @@ bool VulkanPipelineCache::TranslateAnalyzedShader(
   return true;
 }
 
+void VulkanPipelineCache::InitializeOptimizedSpirvStorage(
+    const std::filesystem::path& storage_root, uint32_t title_id) {
+  auto storage_file_path =
+      storage_root / fmt::format("{:08X}.vulkan.xspv", title_id);
+  optimized_spirv_storage_file_ =
+      xe::filesystem::OpenFile(storage_file_path, "a+b");
+  if (!optimized_spirv_storage_file_) {
+    XELOGE(
+        "Failed to open the optimized SPIR-V storage file for writing, "
+        "optimized shaders will not be stored: {}",
+        xe::path_to_utf8(storage_file_path));
+    return;
+  }
+  xe::filesystem::LockStdioFile(optimized_spirv_storage_file_,
+                                xe::filesystem::StdioFileLock::kShared, true);
+  struct {
+    uint32_t magic;
+    uint32_t version_swapped;
+  } storage_file_header;
+  // 'XESV'.
+  const uint32_t storage_magic = 0x56534558;
+  auto read_storage_file_header = [&]() {
+    return xe::filesystem::Seek(optimized_spirv_storage_file_, 0, SEEK_SET) &&
+           fread(&storage_file_header, sizeof(storage_file_header), 1,
+                 optimized_spirv_storage_file_) &&
+           storage_file_header.magic == storage_magic &&
+           xe::byte_swap(storage_file_header.version_swapped) ==
+               OptimizedSpirvStoredHeader::kVersion;
+  };
+  if (read_storage_file_header()) {
+    xe::filesystem::Seek(optimized_spirv_storage_file_, 0, SEEK_END);
+    int64_t storage_told_end =
+        xe::filesystem::Tell(optimized_spirv_storage_file_);
+    uint64_t storage_valid_bytes = sizeof(storage_file_header);
+    std::vector<uint8_t> storage_data;
+    if (storage_told_end > int64_t(sizeof(storage_file_header)) &&
+        xe::filesystem::Seek(optimized_spirv_storage_file_,
+                             int64_t(sizeof(storage_file_header)), SEEK_SET)) {
+      storage_data.resize(size_t(storage_told_end) -
+                          sizeof(storage_file_header));
+      storage_data.resize(fread(storage_data.data(), 1, storage_data.size(),
+                                optimized_spirv_storage_file_));
+    }
+    size_t storage_data_offset = 0;
+    std::lock_guard<std::mutex> lock(optimized_spirv_mutex_);
+    while (storage_data_offset + sizeof(OptimizedSpirvStoredHeader) <=
+           storage_data.size()) {
+      OptimizedSpirvStoredHeader spirv_header;
+      std::memcpy(&spirv_header, storage_data.data() + storage_data_offset,
+                  sizeof(spirv_header));
+      size_t spirv_offset = storage_data_offset + sizeof(spirv_header);
+      size_t spirv_size = sizeof(uint32_t) * spirv_header.optimized_word_count;
+      if (!spirv_size || spirv_offset + spirv_size > storage_data.size()) {
+        break;
+      }
+      const uint8_t* spirv = storage_data.data() + spirv_offset;
+      if (XXH3_64bits(spirv, spirv_size) != spirv_header.optimized_hash) {
+        // Validation failed.
+        break;
+      }
+      optimized_spirv_.emplace(spirv_header.unoptimized_hash,
+                               std::vector<uint8_t>(spirv, spirv + spirv_size));
+      storage_data_offset = spirv_offset + spirv_size;
+    }
+    storage_valid_bytes += storage_data_offset;
+    XELOGGPU("Loaded {} optimized SPIR-V shaders from the storage",
+             optimized_spirv_.size());
+    if (storage_valid_bytes < uint64_t(storage_told_end) &&
+        xe::filesystem::TryUpgradeStdioFileLock(
+            optimized_spirv_storage_file_)) {
+      // Truncate the corrupted data if no other instance is using the file.
+      xe::filesystem::TruncateStdioFile(optimized_spirv_storage_file_,
+                                        storage_valid_bytes);
+      xe::filesystem::LockStdioFile(optimized_spirv_storage_file_,
+                                    xe::filesystem::StdioFileLock::kShared,
+                                    true);
+    }
+  } else if (xe::filesystem::TryUpgradeStdioFileLock(
+                 optimized_spirv_storage_file_)) {
+    xe::filesystem::TruncateStdioFile(optimized_spirv_storage_file_, 0);
+    storage_file_header.magic = storage_magic;
+    storage_file_header.version_swapped =
+        xe::byte_swap(OptimizedSpirvStoredHeader::kVersion);
+    xe::filesystem::AppendToStdioFile(optimized_spirv_storage_file_,
+                                      &storage_file_header,
+                                      sizeof(storage_file_header));
+    xe::filesystem::LockStdioFile(optimized_spirv_storage_file_,
+                                  xe::filesystem::StdioFileLock::kShared, true);
+  } else if (!read_storage_file_header()) {
+    XELOGW(
+        "The optimized SPIR-V storage file is in use by another instance and "
+        "has an incompatible header, optimized shaders will not be stored: {}",
+        xe::path_to_utf8(storage_file_path));
+    fclose(optimized_spirv_storage_file_);
+    optimized_spirv_storage_file_ = nullptr;
+  }
+}
+
+bool VulkanPipelineCache::OptimizeSpirv(
+    uint64_t unoptimized_hash, const uint32_t* words, size_t word_count,
+    std::vector<uint8_t>& optimized_binary_out) {
+  optimized_binary_out.clear();
+  {
+    // May have been optimized already if translated multiple times before the
+    // optimization was done.
+    std::lock_guard<std::mutex> lock(optimized_spirv_mutex_);
+    auto optimized_it = optimized_spirv_.find(unoptimized_hash);
+    if (optimized_it != optimized_spirv_.end()) {
+      optimized_binary_out = optimized_it->second;
+      return true;
+    }
+  }
+  std::vector<uint32_t> optimized_words;
+  spv_result_t result =
+      spirv_tools_context_.Optimize(words, word_count, optimized_words);
+  if (result != SPV_SUCCESS || optimized_words.empty()) {
+    XELOGE("Failed to optimize SPIR-V {:016X}, error {}", unoptimized_hash,
+           int(result));
+    return false;
+  }
+  size_t optimized_size = sizeof(uint32_t) * optimized_words.size();
+  // The header and the SPIR-V, appended as a whole not to be interleaved with
+  // records written by other threads and instances.
+  std::vector<uint8_t> record(sizeof(OptimizedSpirvStoredHeader) +
+                              optimized_size);
+  OptimizedSpirvStoredHeader spirv_header;
+  spirv_header.unoptimized_hash = unoptimized_hash;
+  spirv_header.optimized_hash =
+      XXH3_64bits(optimized_words.data(), optimized_size);
+  spirv_header.optimized_word_count = uint32_t(optimized_words.size());
+  std::memcpy(record.data(), &spirv_header, sizeof(spirv_header));
+  std::memcpy(record.data() + sizeof(spirv_header), optimized_words.data(),
+              optimized_size);
+  optimized_binary_out.assign(record.cbegin() + sizeof(spirv_header),
+                              record.cend());
+  {
+    std::lock_guard<std::mutex> lock(optimized_spirv_mutex_);
+    if (!optimized_spirv_.emplace(unoptimized_hash, optimized_binary_out)
+             .second) {
+      // Optimized and stored on another thread meanwhile.
+      return true;
+    }
+  }
+  if (optimized_spirv_storage_file_) {
+    xe::filesystem::AppendToStdioFile(optimized_spirv_storage_file_,
+                                      record.data(), record.size());
+  }
+  return true;
+}
+
 void VulkanPipelineCache::WritePipelineRenderTargetDescription(
     reg::RB_BLENDCONTROL blend_control, uint32_t write_mask,
     PipelineRenderTarget& render_target_out) const {
@@ -506,6 +1753,80 @@ void VulkanPipelineCache::WritePipelineRenderTargetDescription(
   render_target_out.color_write_mask = write_mask;
 }
 
+void VulkanPipelineCache::ExtractExtendedDynamicState(
+    PipelineDescription& description,
+    ExtendedDynamicState& extended_dynamic_state_out) {
+  extended_dynamic_state_out.cull_mode = VK_CULL_MODE_NONE;
+  if (description.cull_front) {
+    extended_dynamic_state_out.cull_mode |= VK_CULL_MODE_FRONT_BIT;
+  }
+  if (description.cull_back) {
+    extended_dynamic_state_out.cull_mode |= VK_CULL_MODE_BACK_BIT;
+  }
+  extended_dynamic_state_out.front_face =
+      description.front_face_clockwise ? VK_FRONT_FACE_CLOCKWISE
+                                       : VK_FRONT_FACE_COUNTER_CLOCKWISE;
+  extended_dynamic_state_out.depth_test_enable =
+      (description.depth_write_enable ||
+       description.depth_compare_op != xenos::CompareFunction::kAlways)
+          ? VK_TRUE
+          : VK_FALSE;
+  extended_dynamic_state_out.depth_write_enable =
+      description.depth_write_enable ? VK_TRUE : VK_FALSE;
+  extended_dynamic_state_out.depth_compare_op = VkCompareOp(
+      uint32_t(VK_COMPARE_OP_NEVER) + uint32_t(description.depth_compare_op));
+  extended_dynamic_state_out.stencil_test_enable =
+      description.stencil_test_enable ? VK_TRUE : VK_FALSE;
+  extended_dynamic_state_out.stencil_fail_op[0] =
+      VkStencilOp(uint32_t(VK_STENCIL_OP_KEEP) +
+                  uint32_t(description.stencil_front_fail_op));
+  extended_dynamic_state_out.stencil_pass_op[0] =
+      VkStencilOp(uint32_t(VK_STENCIL_OP_KEEP) +
+                  uint32_t(description.stencil_front_pass_op));
+  extended_dynamic_state_out.stencil_depth_fail_op[0] =
+      VkStencilOp(uint32_t(VK_STENCIL_OP_KEEP) +
+                  uint32_t(description.stencil_front_depth_fail_op));
+  extended_dynamic_state_out.stencil_compare_op[0] =
+      VkCompareOp(uint32_t(VK_COMPARE_OP_NEVER) +
+                  uint32_t(description.stencil_front_compare_op));
+  extended_dynamic_state_out.stencil_fail_op[1] =
+      VkStencilOp(uint32_t(VK_STENCIL_OP_KEEP) +
+                  uint32_t(description.stencil_back_fail_op));
+  extended_dynamic_state_out.stencil_pass_op[1] =
+      VkStencilOp(uint32_t(VK_STENCIL_OP_KEEP) +
+                  uint32_t(description.stencil_back_pass_op));
+  extended_dynamic_state_out.stencil_depth_fail_op[1] =
+      VkStencilOp(uint32_t(VK_STENCIL_OP_KEEP) +
+                  uint32_t(description.stencil_back_depth_fail_op));
+  extended_dynamic_state_out.stencil_compare_op[1] =
+      VkCompareOp(uint32_t(VK_COMPARE_OP_NEVER) +
+                  uint32_t(description.stencil_back_compare_op));
+
+  // Share the pipeline between all the states.
+  description.cull_front = 0;
+  description.cull_back = 0;
+  description.front_face_clockwise = 0;
+  description.depth_write_enable = 0;
+  description.depth_compare_op = xenos::CompareFunction::kNever;
+  description.stencil_test_enable = 0;
+  description.stencil_front_fail_op = xenos::StencilOp::kKeep;
+  description.stencil_front_pass_op = xenos::StencilOp::kKeep;
+  description.stencil_front_depth_fail_op = xenos::StencilOp::kKeep;
+  description.stencil_front_compare_op = xenos::CompareFunction::kNever;
+  description.stencil_back_fail_op = xenos::StencilOp::kKeep;
+  description.stencil_back_pass_op = xenos::StencilOp::kKeep;
+  description.stencil_back_depth_fail_op = xenos::StencilOp::kKeep;
+  description.stencil_back_compare_op = xenos::CompareFunction::kNever;
+
+  if (description.dynamic_primitive_restart) {
+    extended_dynamic_state_out.primitive_restart_enable =
+        description.primitive_restart ? VK_TRUE : VK_FALSE;
+    description.primitive_restart = 0;
+  } else {
+    extended_dynamic_state_out.primitive_restart_enable = VK_FALSE;
+  }
+}
+
 bool VulkanPipelineCache::GetCurrentStateDescription(
     const VulkanShader::VulkanTranslation* vertex_shader,
     const VulkanShader::VulkanTranslation* pixel_shader,
@@ -640,6 +1961,10 @@ bool VulkanPipelineCache::GetCurrentStateDescription(
 
   if (render_target_cache_.GetPath() ==
       RenderTargetCache::Path::kHostRenderTargets) {
+    description_out.dynamic_rendering =
+        render_target_cache_.use_dynamic_rendering();
+    description_out.dynamic_primitive_restart = primitive_restart_dynamic_;
+
     if (render_pass_key.depth_and_color_used & 1) {
       if (normalized_depth_control.z_enable) {
         description_out.depth_write_enable =
@@ -779,6 +2104,16 @@ bool VulkanPipelineCache::ArePipelineRequirementsMet(
     return false;
   }
 
+  // Not compatible with render passes, and the other way around.
+  if (bool(description.dynamic_rendering) !=
+      render_target_cache_.use_dynamic_rendering()) {
+    return false;
+  }
+  if (bool(description.dynamic_primitive_restart) !=
+      (description.dynamic_rendering && primitive_restart_dynamic_)) {
+    return false;
+  }
+
   const ui::vulkan::VulkanProvider& provider =
       command_processor_.GetVulkanProvider();
 
@@ -1885,10 +3220,75 @@ VkShaderModule VulkanPipelineCache::GetGeometryShader(GeometryShaderKey key) {
 
 bool VulkanPipelineCache::EnsurePipelineCreated(
     const PipelineCreationArguments& creation_arguments) {
-  if (creation_arguments.pipeline->second.pipeline != VK_NULL_HANDLE) {
-    return true;
+  Pipeline& pipeline = creation_arguments.pipeline->second;
+  if (!pipeline.is_created.load(std::memory_order_acquire)) {
+    pipeline.pipeline = CreateVulkanPipeline(creation_arguments);
+    pipeline.is_created.store(true, std::memory_order_release);
+  }
+  return pipeline.pipeline != VK_NULL_HANDLE;
+}
+
+bool VulkanPipelineCache::ResolvePipelineForDraw(
+    std::pair<const PipelineDescription, Pipeline>& pipeline,
+    void*& pipeline_handle_out,
+    const PipelineLayoutProvider*& pipeline_layout_out) {
+  Pipeline* draw_pipeline = &pipeline.second;
+  if (IsPipelineCreated(draw_pipeline)) {
+    if (draw_pipeline->pipeline == VK_NULL_HANDLE) {
+      return false;
+    }
+    if (pending_pipeline_draw_policy_ == PendingPipelineDrawPolicy::kFallback &&
+        !draw_pipeline->is_fallback_registered) {
+      draw_pipeline->is_fallback_registered = true;
+      fallback_pipelines_.emplace(GetFallbackPipelineKey(pipeline.first),
+                                  draw_pipeline);
+    }
+  } else {
+    UpdatePipelineCreationPriority(*draw_pipeline);
+    if (pending_pipeline_draw_policy_ == PendingPipelineDrawPolicy::kFallback) {
+      auto fallback_it =
+          fallback_pipelines_.find(GetFallbackPipelineKey(pipeline.first));
+      if (fallback_it != fallback_pipelines_.end()) {
+        draw_pipeline = fallback_it->second;
+      }
+    }
   }
+  // The pipeline layout depends only on the shaders, which are the same for the
+  // fallback.
+  pipeline_handle_out = draw_pipeline;
+  pipeline_layout_out = draw_pipeline->pipeline_layout;
+  return true;
+}
+
+VulkanPipelineCache::PipelineDescription
+VulkanPipelineCache::GetFallbackPipelineKey(
+    const PipelineDescription& description) {
+  // Everything else (rasterization, depth / stencil and blending state) may be
+  // different.
+  PipelineDescription key;
+  key.vertex_shader_hash = description.vertex_shader_hash;
+  key.vertex_shader_modification = description.vertex_shader_modification;
+  key.pixel_shader_hash = description.pixel_shader_hash;
+  key.pixel_shader_modification = description.pixel_shader_modification;
+  key.render_pass_key = description.render_pass_key;
+  key.geometry_shader = description.geometry_shader;
+  key.primitive_topology = description.primitive_topology;
+  key.primitive_restart = description.primitive_restart;
+  return key;
+}
 
+void VulkanPipelineCache::UpdatePipelineCreationPriority(Pipeline& pipeline) {
+  if (creation_threads_.empty() ||
+      pipeline.is_created.load(std::memory_order_acquire)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(creation_request_lock_);
+  pipeline.last_request_submission = command_processor_.GetCurrentSubmission();
+  ++pipeline.request_count;
+}
+
+VkPipeline VulkanPipelineCache::CreateVulkanPipeline(
+    const PipelineCreationArguments& creation_arguments) {
   // This function preferably should validate the description to prevent
   // unsupported behavior that may be dangerous/crashing because pipelines can
   // be created from the disk storage.
@@ -1908,7 +3308,7 @@ bool VulkanPipelineCache::EnsurePipelineCreated(
         "When creating a new pipeline, the description must not require "
         "unsupported features, and when loading the pipeline storage, "
         "pipelines with unsupported features must be filtered out");
-    return false;
+    return VK_NULL_HANDLE;
   }
 
   const ui::vulkan::VulkanProvider& provider =
@@ -1925,7 +3325,7 @@ bool VulkanPipelineCache::EnsurePipelineCreated(
   // Vertex or tessellation evaluation shader.
   assert_true(creation_arguments.vertex_shader->is_translated());
   if (!creation_arguments.vertex_shader->is_valid()) {
-    return false;
+    return VK_NULL_HANDLE;
   }
   VkPipelineShaderStageCreateInfo& shader_stage_vertex =
       shader_stages[shader_stage_count++];
@@ -1966,7 +3366,7 @@ bool VulkanPipelineCache::EnsurePipelineCreated(
   if (creation_arguments.pixel_shader) {
     assert_true(creation_arguments.pixel_shader->is_translated());
     if (!creation_arguments.pixel_shader->is_valid()) {
-      return false;
+      return VK_NULL_HANDLE;
     }
     shader_stage_fragment.module =
         creation_arguments.pixel_shader->shader_module();
@@ -1994,14 +3394,14 @@ bool VulkanPipelineCache::EnsurePipelineCreated(
       input_assembly_state.topology = VK_PRIMITIVE_TOPOLOGY_POINT_LIST;
       assert_false(description.primitive_restart);
       if (description.primitive_restart) {
-        return false;
+        return VK_NULL_HANDLE;
       }
       break;
     case PipelinePrimitiveTopology::kLineList:
       input_assembly_state.topology = VK_PRIMITIVE_TOPOLOGY_LINE_LIST;
       assert_false(description.primitive_restart);
       if (description.primitive_restart) {
-        return false;
+        return VK_NULL_HANDLE;
       }
       break;
     case PipelinePrimitiveTopology::kLineStrip:
@@ -2011,7 +3411,7 @@ bool VulkanPipelineCache::EnsurePipelineCreated(
       input_assembly_state.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
       assert_false(description.primitive_restart);
       if (description.primitive_restart) {
-        return false;
+        return VK_NULL_HANDLE;
       }
       break;
     case PipelinePrimitiveTopology::kTriangleStrip:
@@ -2025,20 +3425,21 @@ bool VulkanPipelineCache::EnsurePipelineCreated(
           VK_PRIMITIVE_TOPOLOGY_LINE_LIST_WITH_ADJACENCY;
       assert_false(description.primitive_restart);
       if (description.primitive_restart) {
-        return false;
+        return VK_NULL_HANDLE;
       }
       break;
     case PipelinePrimitiveTopology::kPatchList:
       input_assembly_state.topology = VK_PRIMITIVE_TOPOLOGY_PATCH_LIST;
       assert_false(description.primitive_restart);
       if (description.primitive_restart) {
-        return false;
+        return VK_NULL_HANDLE;
       }
       break;
     default:
       assert_unhandled_case(description.primitive_topology);
-      return false;
+      return VK_NULL_HANDLE;
   }
+  // Ignored if dynamic_primitive_restart, primitive_restart is zero then.
   input_assembly_state.primitiveRestartEnable =
       description.primitive_restart ? VK_TRUE : VK_FALSE;
 
@@ -2068,8 +3469,9 @@ bool VulkanPipelineCache::EnsurePipelineCreated(
       break;
     default:
       assert_unhandled_case(description.polygon_mode);
-      return false;
+      return VK_NULL_HANDLE;
   }
+  // Dynamic with dynamic rendering.
   rasterization_state.cullMode = VK_CULL_MODE_NONE;
   if (description.cull_front) {
     rasterization_state.cullMode |= VK_CULL_MODE_FRONT_BIT;
@@ -2118,7 +3520,7 @@ bool VulkanPipelineCache::EnsurePipelineCreated(
   depth_stencil_state.sType =
       VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
   depth_stencil_state.pNext = nullptr;
-  if (!edram_fragment_shader_interlock) {
+  if (!edram_fragment_shader_interlock && !description.dynamic_rendering) {
     if (description.depth_write_enable ||
         description.depth_compare_op != xenos::CompareFunction::kAlways) {
       depth_stencil_state.depthTestEnable = VK_TRUE;
@@ -2246,7 +3648,7 @@ bool VulkanPipelineCache::EnsurePipelineCreated(
     }
   }
 
-  std::array<VkDynamicState, 7> dynamic_states;
+  std::array<VkDynamicState, 15> dynamic_states;
   VkPipelineDynamicStateCreateInfo dynamic_state;
   dynamic_state.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
   dynamic_state.pNext = nullptr;
@@ -2271,10 +3673,50 @@ bool VulkanPipelineCache::EnsurePipelineCreated(
     dynamic_states[dynamic_state.dynamicStateCount++] =
         VK_DYNAMIC_STATE_STENCIL_REFERENCE;
   }
+  if (description.dynamic_rendering) {
+    dynamic_states[dynamic_state.dynamicStateCount++] =
+        VK_DYNAMIC_STATE_CULL_MODE_EXT;
+    dynamic_states[dynamic_state.dynamicStateCount++] =
+        VK_DYNAMIC_STATE_FRONT_FACE_EXT;
+    dynamic_states[dynamic_state.dynamicStateCount++] =
+        VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT;
+    dynamic_states[dynamic_state.dynamicStateCount++] =
+        VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT;
+    dynamic_states[dynamic_state.dynamicStateCount++] =
+        VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT;
+    dynamic_states[dynamic_state.dynamicStateCount++] =
+        VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT;
+    dynamic_states[dynamic_state.dynamicStateCount++] =
+        VK_DYNAMIC_STATE_STENCIL_OP_EXT;
+  }
+  if (description.dynamic_primitive_restart) {
+    dynamic_states[dynamic_state.dynamicStateCount++] =
+        VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE_EXT;
+  }
+
+  // With dynamic rendering, the attachment formats are specified directly
+  // instead of a compatible render pass.
+  VkFormat rendering_color_formats[xenos::kMaxColorRenderTargets];
+  VkPipelineRenderingCreateInfoKHR rendering_create_info;
+  if (description.dynamic_rendering) {
+    rendering_create_info.sType =
+        VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+    rendering_create_info.pNext = nullptr;
+    rendering_create_info.viewMask = 0;
+    VkFormat depth_stencil_format;
+    rendering_create_info.colorAttachmentCount =
+        render_target_cache_.GetHostRenderTargetsAttachmentFormats(
+            description.render_pass_key, rendering_color_formats,
+            depth_stencil_format);
+    rendering_create_info.pColorAttachmentFormats = rendering_color_formats;
+    rendering_create_info.depthAttachmentFormat = depth_stencil_format;
+    rendering_create_info.stencilAttachmentFormat = depth_stencil_format;
+  }
 
   VkGraphicsPipelineCreateInfo pipeline_create_info;
   pipeline_create_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-  pipeline_create_info.pNext = nullptr;
+  pipeline_create_info.pNext =
+      description.dynamic_rendering ? &rendering_create_info : nullptr;
   pipeline_create_info.flags = 0;
   pipeline_create_info.stageCount = shader_stage_count;
   pipeline_create_info.pStages = shader_stages.data();
@@ -2294,10 +3736,43 @@ bool VulkanPipelineCache::EnsurePipelineCreated(
   pipeline_create_info.basePipelineHandle = VK_NULL_HANDLE;
   pipeline_create_info.basePipelineIndex = -1;
 
+  if (pipeline_libraries_used_) {
+    PipelineLibraries libraries;
+    for (size_t i = 0; i < size_t(PipelineLibraryType::kCount); ++i) {
+      libraries.libraries[i] = GetPipelineLibrary(
+          description, PipelineLibraryType(i), pipeline_create_info);
+      if (libraries.libraries[i] == VK_NULL_HANDLE) {
+        return VK_NULL_HANDLE;
+      }
+    }
+    // If fast linking is available, link quickly for the first draws, and
+    // replace the pipeline with the optimized one after linking it in the
+    // background.
+    bool link_optimized_later =
+        pipeline_libraries_fast_linking_ && !creation_threads_.empty();
+    VkPipeline pipeline = LinkPipelineLibraries(
+        libraries, pipeline_create_info.layout, !link_optimized_later);
+    if (pipeline == VK_NULL_HANDLE) {
+      return VK_NULL_HANDLE;
+    }
+    if (link_optimized_later) {
+      {
+        std::lock_guard<std::mutex> lock(creation_request_lock_);
+        PipelineOptimizedLinkRequest& optimized_link_request =
+            optimized_link_queue_.emplace_back();
+        optimized_link_request.pipeline = &creation_arguments.pipeline->second;
+        optimized_link_request.libraries = libraries;
+      }
+      creation_request_cond_.notify_one();
+    }
+    pipelines_created_total_.fetch_add(1, std::memory_order_relaxed);
+    return pipeline;
+  }
+
   const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
   VkDevice device = provider.device();
   VkPipeline pipeline;
-  if (dfn.vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1,
+  if (dfn.vkCreateGraphicsPipelines(device, vk_pipeline_cache_, 1,
                                     &pipeline_create_info, nullptr,
                                     &pipeline) != VK_SUCCESS) {
     // TODO(Triang3l): Move these error messages outside.
@@ -2310,10 +3785,480 @@ bool VulkanPipelineCache::EnsurePipelineCreated(
       XELOGE("Failed to create graphics pipeline with VS {:016X}",
              creation_arguments.vertex_shader->shader().ucode_data_hash());
     } */
-    return false;
+    return VK_NULL_HANDLE;
   }
-  creation_arguments.pipeline->second.pipeline = pipeline;
-  return true;
+  pipelines_created_total_.fetch_add(1, std::memory_order_relaxed);
+  return pipeline;
+}
+
+VulkanPipelineCache::PipelineDescription
+VulkanPipelineCache::GetPipelineLibraryKey(
+    const PipelineDescription& description, PipelineLibraryType type) {
+  PipelineDescription key;
+  // The render pass and the dynamic state are used by all the parts.
+  key.render_pass_key = description.render_pass_key;
+  key.dynamic_rendering = description.dynamic_rendering;
+  if (type != PipelineLibraryType::kFragmentOutput) {
+    // The pipeline layout depends on the bindings of both shaders, and the
+    // geometry shader depends on the modifications of both.
+    key.vertex_shader_hash = description.vertex_shader_hash;
+    key.vertex_shader_modification = description.vertex_shader_modification;
+    key.pixel_shader_hash = description.pixel_shader_hash;
+    key.pixel_shader_modification = description.pixel_shader_modification;
+  }
+  switch (type) {
+    case PipelineLibraryType::kPreRasterization:
+      key.geometry_shader = description.geometry_shader;
+      key.primitive_topology = description.primitive_topology;
+      key.primitive_restart = description.primitive_restart;
+      key.dynamic_primitive_restart = description.dynamic_primitive_restart;
+      key.depth_clamp_enable = description.depth_clamp_enable;
+      key.polygon_mode = description.polygon_mode;
+      key.cull_front = description.cull_front;
+      key.cull_back = description.cull_back;
+      key.front_face_clockwise = description.front_face_clockwise;
+      break;
+    case PipelineLibraryType::kFragmentShader:
+      key.depth_write_enable = description.depth_write_enable;
+      key.depth_compare_op = description.depth_compare_op;
+      key.stencil_test_enable = description.stencil_test_enable;
+      key.stencil_front_fail_op = description.stencil_front_fail_op;
+      key.stencil_front_pass_op = description.stencil_front_pass_op;
+      key.stencil_front_depth_fail_op =
+          description.stencil_front_depth_fail_op;
+      key.stencil_front_compare_op = description.stencil_front_compare_op;
+      key.stencil_back_fail_op = description.stencil_back_fail_op;
+      key.stencil_back_pass_op = description.stencil_back_pass_op;
+      key.stencil_back_depth_fail_op = description.stencil_back_depth_fail_op;
+      key.stencil_back_compare_op = description.stencil_back_compare_op;
+      break;
+    case PipelineLibraryType::kFragmentOutput:
+      std::memcpy(key.render_targets, description.render_targets,
+                  sizeof(key.render_targets));
+      break;
+    default:
+      assert_unhandled_case(type);
+      break;
+  }
+  return key;
+}
+
+VkPipeline VulkanPipelineCache::GetPipelineLibrary(
+    const PipelineDescription& description, PipelineLibraryType type,
+    const VkGraphicsPipelineCreateInfo& pipeline_create_info) {
+  PipelineDescription key = GetPipelineLibraryKey(description, type);
+  auto& libraries = pipeline_libraries_[size_t(type)];
+  {
+    std::lock_guard<std::mutex> lock(pipeline_libraries_mutex_);
+    auto it = libraries.find(key);
+    if (it != libraries.end()) {
+      return it->second;
+    }
+  }
+
+  // Create without holding the lock not to block the other creation threads.
+  VkGraphicsPipelineLibraryCreateInfoEXT library_create_info;
+  library_create_info.sType =
+      VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+  library_create_info.pNext = pipeline_create_info.pNext;
+  VkGraphicsPipelineCreateInfo library_pipeline_create_info =
+      pipeline_create_info;
+  library_pipeline_create_info.pNext = &library_create_info;
+  library_pipeline_create_info.flags |=
+      VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+      VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+  // Only the state belonging to the part of the pipeline.
+  std::array<VkPipelineShaderStageCreateInfo, 3> shader_stages;
+  library_pipeline_create_info.stageCount = 0;
+  library_pipeline_create_info.pStages = shader_stages.data();
+  if (type != PipelineLibraryType::kFragmentOutput) {
+    for (uint32_t i = 0; i < pipeline_create_info.stageCount; ++i) {
+      const VkPipelineShaderStageCreateInfo& shader_stage =
+          pipeline_create_info.pStages[i];
+      if ((shader_stage.stage == VK_SHADER_STAGE_FRAGMENT_BIT) ==
+          (type == PipelineLibraryType::kFragmentShader)) {
+        shader_stages[library_pipeline_create_info.stageCount++] =
+            shader_stage;
+      }
+    }
+  }
+  switch (type) {
+    case PipelineLibraryType::kPreRasterization:
+      library_create_info.flags =
+          VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT |
+          VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+      library_pipeline_create_info.pMultisampleState = nullptr;
+      library_pipeline_create_info.pDepthStencilState = nullptr;
+      library_pipeline_create_info.pColorBlendState = nullptr;
+      break;
+    case PipelineLibraryType::kFragmentShader:
+      library_create_info.flags =
+          VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
+      library_pipeline_create_info.pVertexInputState = nullptr;
+      library_pipeline_create_info.pInputAssemblyState = nullptr;
+      library_pipeline_create_info.pTessellationState = nullptr;
+      library_pipeline_create_info.pViewportState = nullptr;
+      library_pipeline_create_info.pRasterizationState = nullptr;
+      library_pipeline_create_info.pColorBlendState = nullptr;
+      break;
+    case PipelineLibraryType::kFragmentOutput:
+      library_create_info.flags =
+          VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+      library_pipeline_create_info.pVertexInputState = nullptr;
+      library_pipeline_create_info.pInputAssemblyState = nullptr;
+      library_pipeline_create_info.pTessellationState = nullptr;
+      library_pipeline_create_info.pViewportState = nullptr;
+      library_pipeline_create_info.pRasterizationState = nullptr;
+      library_pipeline_create_info.pDepthStencilState = nullptr;
+      library_pipeline_create_info.layout = VK_NULL_HANDLE;
+      break;
+    default:
+      assert_unhandled_case(type);
+      return VK_NULL_HANDLE;
+  }
+
+  const ui::vulkan::VulkanProvider& provider =
+      command_processor_.GetVulkanProvider();
+  const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
+  VkDevice device = provider.device();
+  VkPipeline library;
+  if (dfn.vkCreateGraphicsPipelines(device, vk_pipeline_cache_, 1,
+                                    &library_pipeline_create_info, nullptr,
+                                    &library) != VK_SUCCESS) {
+    library = VK_NULL_HANDLE;
+  }
+
+  std::lock_guard<std::mutex> lock(pipeline_libraries_mutex_);
+  auto it_inserted = libraries.emplace(key, library);
+  if (!it_inserted.second) {
+    // Created by another thread in the meantime.
+    if (library != VK_NULL_HANDLE) {
+      dfn.vkDestroyPipeline(device, library, nullptr);
+    }
+  }
+  return it_inserted.first->second;
+}
+
+VkPipeline VulkanPipelineCache::LinkPipelineLibraries(
+    const PipelineLibraries& libraries, VkPipelineLayout pipeline_layout,
+    bool link_time_optimization) {
+  VkPipelineLibraryCreateInfoKHR library_create_info;
+  library_create_info.sType =
+      VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+  library_create_info.pNext = nullptr;
+  library_create_info.libraryCount = uint32_t(xe::countof(libraries.libraries));
+  library_create_info.pLibraries = libraries.libraries;
+
+  VkGraphicsPipelineCreateInfo pipeline_create_info = {};
+  pipeline_create_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  pipeline_create_info.pNext = &library_create_info;
+  if (link_time_optimization) {
+    pipeline_create_info.flags =
+        VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT;
+  }
+  pipeline_create_info.layout = pipeline_layout;
+  pipeline_create_info.basePipelineIndex = -1;
+
+  const ui::vulkan::VulkanProvider& provider =
+      command_processor_.GetVulkanProvider();
+  const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
+  VkDevice device = provider.device();
+  VkPipeline pipeline;
+  if (dfn.vkCreateGraphicsPipelines(device, vk_pipeline_cache_, 1,
+                                    &pipeline_create_info, nullptr,
+                                    &pipeline) != VK_SUCCESS) {
+    return VK_NULL_HANDLE;
+  }
+  return pipeline;
+}
+
+void VulkanPipelineCache::StoreShader(Shader& shader) {
+  if (!shader_storage_file_ ||
+      shader.ucode_storage_index() == shader_storage_index_) {
+    return;
+  }
+  shader.set_ucode_storage_index(shader_storage_index_);
+  assert_not_null(storage_write_thread_);
+  shader_storage_file_flush_needed_ = true;
+  {
+    std::lock_guard<std::mutex> lock(storage_write_request_lock_);
+    storage_write_shader_queue_.push_back(&shader);
+  }
+  storage_write_request_cond_.notify_all();
+}
+
+void VulkanPipelineCache::WriteVulkanPipelineCacheData() {
+  assert_true(vk_pipeline_cache_ != VK_NULL_HANDLE);
+  const ui::vulkan::VulkanProvider& provider =
+      command_processor_.GetVulkanProvider();
+  const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
+  VkDevice device = provider.device();
+  size_t data_size = 0;
+  if (dfn.vkGetPipelineCacheData(device, vk_pipeline_cache_, &data_size,
+                                 nullptr) != VK_SUCCESS ||
+      !data_size) {
+    return;
+  }
+  std::vector<uint8_t> data(data_size);
+  // VK_INCOMPLETE if pipelines have been added in between, still valid data.
+  VkResult data_result = dfn.vkGetPipelineCacheData(device, vk_pipeline_cache_,
+                                                    &data_size, data.data());
+  if ((data_result != VK_SUCCESS && data_result != VK_INCOMPLETE) ||
+      !data_size) {
+    return;
+  }
+  if (!xe::filesystem::CreateParentFolder(vk_pipeline_cache_file_path_)) {
+    XELOGE("Failed to create the local shader storage directory for {}",
+           xe::path_to_utf8(vk_pipeline_cache_file_path_));
+    return;
+  }
+  // Other instances may be reading or replacing the file concurrently, so
+  // write a temporary file and then replace the old one with it as a whole.
+  std::filesystem::path temp_file_path = vk_pipeline_cache_file_path_;
+  temp_file_path +=
+      fmt::format(".{:016X}.tmp", xe::Clock::QueryHostTickCount());
+  FILE* file = xe::filesystem::OpenFile(temp_file_path, "wb");
+  if (!file) {
+    XELOGE("Failed to open the Vulkan pipeline cache file for writing: {}",
+           xe::path_to_utf8(temp_file_path));
+    return;
+  }
+  bool written = fwrite(data.data(), data_size, 1, file) != 0;
+  written = !fclose(file) && written;
+  std::error_code error_code;
+  if (written) {
+    std::filesystem::rename(temp_file_path, vk_pipeline_cache_file_path_,
+                            error_code);
+  }
+  if (!written || error_code) {
+    XELOGE("Failed to write the Vulkan pipeline cache file: {}",
+           xe::path_to_utf8(vk_pipeline_cache_file_path_));
+    std::filesystem::remove(temp_file_path, error_code);
+  }
+}
+
+void VulkanPipelineCache::StorageWriteThread() {
+  ShaderStoredHeader shader_header;
+  // Don't leak anything in unused bits.
+  std::memset(&shader_header, 0, sizeof(shader_header));
+
+  // The header and the ucode, appended as a whole not to be interleaved with
+  // records written by other instances using the same file.
+  std::vector<uint8_t> shader_record;
+  shader_record.reserve(sizeof(shader_header) + sizeof(uint32_t) * 0xFFFF);
+
+  bool flush_shaders = false;
+  bool flush_pipelines = false;
+
+  while (true) {
+    if (flush_shaders) {
+      flush_shaders = false;
+      assert_not_null(shader_storage_file_);
+      fflush(shader_storage_file_);
+    }
+    if (flush_pipelines) {
+      flush_pipelines = false;
+      assert_not_null(pipeline_storage_file_);
+      fflush(pipeline_storage_file_);
+    }
+
+    const Shader* shader = nullptr;
+    PipelineStoredDescription pipeline_description;
+    bool write_pipeline = false;
+    uint64_t spirv_hash = 0;
+    std::vector<uint32_t> spirv;
+    bool optimize_spirv = false;
+    {
+      std::unique_lock<std::mutex> lock(storage_write_request_lock_);
+      if (storage_write_thread_shutdown_) {
+        return;
+      }
+      if (!storage_write_shader_queue_.empty()) {
+        shader = storage_write_shader_queue_.front();
+        storage_write_shader_queue_.pop_front();
+      } else if (storage_write_flush_shaders_) {
+        storage_write_flush_shaders_ = false;
+        flush_shaders = true;
+      }
+      if (!storage_write_pipeline_queue_.empty()) {
+        std::memcpy(&pipeline_description,
+                    &storage_write_pipeline_queue_.front(),
+                    sizeof(pipeline_description));
+        storage_write_pipeline_queue_.pop_front();
+        write_pipeline = true;
+      } else if (storage_write_flush_pipelines_) {
+        storage_write_flush_pipelines_ = false;
+        flush_pipelines = true;
+      }
+      if (!storage_write_spirv_queue_.empty()) {
+        spirv_hash = storage_write_spirv_queue_.front().first;
+        spirv = std::move(storage_write_spirv_queue_.front().second);
+        storage_write_spirv_queue_.pop_front();
+        optimize_spirv = true;
+      }
+      if (!shader && !write_pipeline && !optimize_spirv) {
+        if (!flush_shaders && !flush_pipelines) {
+          storage_write_request_cond_.wait(lock);
+        }
+        continue;
+      }
+    }
+
+    if (shader) {
+      shader_header.ucode_data_hash = shader->ucode_data_hash();
+      shader_header.ucode_dword_count = shader->ucode_dword_count();
+      shader_header.type = shader->type();
+      assert_not_null(shader_storage_file_);
+      shader_record.resize(sizeof(shader_header) +
+                           sizeof(uint32_t) * shader_header.ucode_dword_count);
+      std::memcpy(shader_record.data(), &shader_header, sizeof(shader_header));
+      // Need to swap because the hash is calculated for the shader with guest
+      // endianness.
+      xe::copy_and_swap(
+          reinterpret_cast<uint32_t*>(shader_record.data() +
+                                      sizeof(shader_header)),
+          shader->ucode_dwords(), shader_header.ucode_dword_count);
+      xe::filesystem::AppendToStdioFile(
+          shader_storage_file_, shader_record.data(), shader_record.size());
+    }
+
+    if (write_pipeline) {
+      assert_not_null(pipeline_storage_file_);
+      xe::filesystem::AppendToStdioFile(pipeline_storage_file_,
+                                        &pipeline_description,
+                                        sizeof(pipeline_description));
+    }
+
+    if (optimize_spirv) {
+      std::vector<uint8_t> optimized_binary;
+      OptimizeSpirv(spirv_hash, spirv.data(), spirv.size(), optimized_binary);
+    }
+  }
+}
+
+void VulkanPipelineCache::CreationThread(size_t thread_index) {
+  while (true) {
+    PipelineCreationArguments pipeline_to_create;
+    PipelineOptimizedLinkRequest link_to_optimize;
+    link_to_optimize.pipeline = nullptr;
+
+    // Check if need to shut down or set the completion event and dequeue the
+    // pipeline if there is any.
+    {
+      std::unique_lock<std::mutex> lock(creation_request_lock_);
+      if (creation_threads_shutdown_ || creation_queue_.empty()) {
+        if (creation_completion_set_event_ && creation_threads_busy_ == 0) {
+          // Last pipeline in the queue created - signal the event if requested.
+          creation_completion_set_event_ = false;
+          creation_completion_event_->Set();
+        }
+        if (creation_threads_shutdown_) {
+          return;
+        }
+        // Optimizing pipelines that are already usable in their fast-linked
+        // form has the lowest priority, and is not awaited.
+        if (optimized_link_queue_.empty()) {
+          creation_request_cond_.wait(lock);
+          continue;
+        }
+        link_to_optimize = optimized_link_queue_.front();
+        optimized_link_queue_.pop_front();
+      } else {
+        // Take the pipeline from the queue and increment the busy thread count
+        // until the pipeline is created - other threads must be able to
+        // dequeue requests, but can't set the completion event until the
+        // pipelines are fully created (rather than just started creating).
+        pipeline_to_create = PopHighestPriorityCreationRequest();
+        ++creation_threads_busy_;
+      }
+    }
+
+    if (link_to_optimize.pipeline) {
+      VkPipeline optimized_pipeline = LinkPipelineLibraries(
+          link_to_optimize.libraries,
+          link_to_optimize.pipeline->pipeline_layout->GetPipelineLayout(),
+          true);
+      // If failed, keep using the fast-linked pipeline.
+      if (optimized_pipeline != VK_NULL_HANDLE) {
+        std::lock_guard<std::mutex> lock(creation_request_lock_);
+        optimized_links_completed_.emplace_back(link_to_optimize.pipeline,
+                                                optimized_pipeline);
+      }
+      continue;
+    }
+
+    EnsurePipelineCreated(pipeline_to_create);
+
+    // Pipeline created - the thread is not busy anymore, safe to set the
+    // completion event if needed (at the next iteration, or in some other
+    // thread).
+    {
+      std::lock_guard<std::mutex> lock(creation_request_lock_);
+      --creation_threads_busy_;
+    }
+  }
+}
+
+void VulkanPipelineCache::CreateQueuedPipelines() {
+  if (creation_threads_.empty()) {
+    return;
+  }
+  CreateQueuedPipelinesOnProcessorThread();
+  // Await creation of all queued pipelines.
+  bool await_creation_completion_event;
+  {
+    std::lock_guard<std::mutex> lock(creation_request_lock_);
+    // Assuming the creation queue is already empty (because the processor
+    // thread also worked on creating the leftover pipelines), so only check if
+    // there are threads with pipelines currently being created.
+    await_creation_completion_event = creation_threads_busy_ != 0;
+    if (await_creation_completion_event) {
+      creation_completion_event_->Reset();
+      creation_completion_set_event_ = true;
+    }
+  }
+  if (await_creation_completion_event) {
+    creation_request_cond_.notify_one();
+    xe::threading::Wait(creation_completion_event_.get(), false);
+  }
+}
+
+void VulkanPipelineCache::CreateQueuedPipelinesOnProcessorThread() {
+  assert_false(creation_threads_.empty());
+  while (true) {
+    PipelineCreationArguments pipeline_to_create;
+    {
+      std::lock_guard<std::mutex> lock(creation_request_lock_);
+      if (creation_queue_.empty()) {
+        break;
+      }
+      pipeline_to_create = PopHighestPriorityCreationRequest();
+    }
+    EnsurePipelineCreated(pipeline_to_create);
+  }
+}
+
+VulkanPipelineCache::PipelineCreationArguments
+VulkanPipelineCache::PopHighestPriorityCreationRequest() {
+  assert_false(creation_queue_.empty());
+  auto it = std::max_element(
+      creation_queue_.begin(), creation_queue_.end(),
+      [](const PipelineCreationArguments& a,
+         const PipelineCreationArguments& b) {
+        const Pipeline& pipeline_a = a.pipeline->second;
+        const Pipeline& pipeline_b = b.pipeline->second;
+        if (pipeline_a.last_request_submission !=
+            pipeline_b.last_request_submission) {
+          return pipeline_a.last_request_submission <
+                 pipeline_b.last_request_submission;
+        }
+        return pipeline_a.request_count < pipeline_b.request_count;
+      });
+  PipelineCreationArguments creation_arguments = *it;
+  // The order of the rest of the queue doesn't matter.
+  *it = creation_queue_.back();
+  creation_queue_.pop_back();
+  return creation_arguments;
 }
 
 }  // namespace vulkan
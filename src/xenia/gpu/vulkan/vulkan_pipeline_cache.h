@@ -10,15 +10,24 @@
 #ifndef XENIA_GPU_VULKAN_VULKAN_PIPELINE_STATE_CACHE_H_
 #define XENIA_GPU_VULKAN_VULKAN_PIPELINE_STATE_CACHE_H_
 
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdio>
 #include <cstring>
+#include <deque>
+#include <filesystem>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "xenia/base/hash.h"
 #include "xenia/base/platform.h"
+#include "xenia/base/threading.h"
 #include "xenia/base/xxhash.h"
 #include "xenia/gpu/primitive_processor.h"
 #include "xenia/gpu/register_file.h"
@@ -27,6 +36,7 @@
 #include "xenia/gpu/vulkan/vulkan_render_target_cache.h"
 #include "xenia/gpu/vulkan/vulkan_shader.h"
 #include "xenia/gpu/xenos.h"
+#include "xenia/ui/vulkan/spirv_tools_context.h"
 #include "xenia/ui/vulkan/vulkan_provider.h"
 
 namespace xe {
@@ -59,6 +69,32 @@ class VulkanPipelineCache {
   bool Initialize();
   void Shutdown();
 
+  void InitializeShaderStorage(const std::filesystem::path& cache_root,
+                               uint32_t title_id, bool blocking);
+  void ShutdownShaderStorage();
+
+  void EndSubmission();
+  bool IsCreatingPipelines();
+  // Number of the pipelines queued for creation or being created on the
+  // creation threads, for statistics.
+  size_t GetCreatingPipelineCount();
+  // Total number of the pipelines successfully created on any thread, for
+  // statistics.
+  uint64_t pipelines_created_total() const {
+    return pipelines_created_total_.load(std::memory_order_relaxed);
+  }
+  // Total number of the distinct guest fixed-function state combinations that
+  // have been drawn with an existing pipeline because the state differing
+  // between them is dynamic, for statistics.
+  uint64_t pipelines_shared_by_dynamic_state_total() const {
+    return pipelines_shared_by_dynamic_state_total_;
+  }
+  // Whether primitive restart is set in the command buffer rather than in the
+  // pipelines (VK_EXT_extended_dynamic_state2).
+  bool is_primitive_restart_dynamic() const {
+    return primitive_restart_dynamic_;
+  }
+
   VulkanShader* LoadShader(xenos::ShaderType shader_type,
                            const uint32_t* host_address, uint32_t dword_count);
   // Analyze shader microcode on the translator thread.
@@ -78,7 +114,31 @@ class VulkanPipelineCache {
 
   bool EnsureShadersTranslated(VulkanShader::VulkanTranslation* vertex_shader,
                                VulkanShader::VulkanTranslation* pixel_shader);
-  // TODO(Triang3l): Return a deferred creation handle.
+
+  // Fixed-function state that is set in the command buffer rather than baked
+  // into the guest pipelines when they're used with dynamic rendering, via
+  // VK_EXT_extended_dynamic_state and, for primitive restart, if
+  // is_primitive_restart_dynamic(), VK_EXT_extended_dynamic_state2.
+  struct ExtendedDynamicState {
+    VkCullModeFlags cull_mode;
+    VkFrontFace front_face;
+    VkBool32 depth_test_enable;
+    VkBool32 depth_write_enable;
+    VkCompareOp depth_compare_op;
+    VkBool32 stencil_test_enable;
+    // 0 - front, 1 - back.
+    VkStencilOp stencil_fail_op[2];
+    VkStencilOp stencil_pass_op[2];
+    VkStencilOp stencil_depth_fail_op[2];
+    VkCompareOp stencil_compare_op[2];
+    VkBool32 primitive_restart_enable;
+  };
+
+  // Returns a handle to the pipeline with deferred creation. With creation
+  // threads, the pipeline may still be being created when this returns - it
+  // will be created by the end of the submission. If the render target cache
+  // uses dynamic rendering, the state not included in the pipeline is written
+  // to extended_dynamic_state_out.
   bool ConfigurePipeline(
       VulkanShader::VulkanTranslation* vertex_shader,
       VulkanShader::VulkanTranslation* pixel_shader,
@@ -86,10 +146,62 @@ class VulkanPipelineCache {
       reg::RB_DEPTHCONTROL normalized_depth_control,
       uint32_t normalized_color_mask,
       VulkanRenderTargetCache::RenderPassKey render_pass_key,
-      VkPipeline& pipeline_out,
-      const PipelineLayoutProvider*& pipeline_layout_out);
+      void*& pipeline_handle_out,
+      const PipelineLayoutProvider*& pipeline_layout_out,
+      ExtendedDynamicState& extended_dynamic_state_out);
+
+  // What to do with draws whose pipelines are still being created on the
+  // creation threads.
+  enum class PendingPipelineDrawPolicy {
+    // Record the draws normally, awaiting the creation of the pipelines at the
+    // end of the submission.
+    kWait,
+    // Drop the draws.
+    kSkip,
+    // Draw with an already created pipeline with the same shaders, render pass
+    // and primitive type, but different fixed-function state, dropping the
+    // draws if there's no such pipeline.
+    kFallback,
+  };
+  PendingPipelineDrawPolicy pending_pipeline_draw_policy() const {
+    return pending_pipeline_draw_policy_;
+  }
+  // Whether the creation of the pipeline has been finished, successfully or
+  // not.
+  static bool IsPipelineCreated(void* handle) {
+    return reinterpret_cast<const Pipeline*>(handle)->is_created.load(
+        std::memory_order_acquire);
+  }
+  // Returns a pipeline with deferred creation by its handle. May return
+  // VK_NULL_HANDLE if failed to create the pipeline, or if it's not created
+  // yet, which is not the case after EndSubmission.
+  static VkPipeline GetVulkanPipelineByHandle(void* handle) {
+    const Pipeline& pipeline = *reinterpret_cast<const Pipeline*>(handle);
+    return pipeline.is_created.load(std::memory_order_acquire)
+               ? pipeline.pipeline
+               : VK_NULL_HANDLE;
+  }
 
  private:
+  XEPACKEDSTRUCT(ShaderStoredHeader, {
+    uint64_t ucode_data_hash;
+
+    uint32_t ucode_dword_count : 31;
+    xenos::ShaderType type : 1;
+
+    static constexpr uint32_t kVersion = 0x20201219;
+  });
+
+  XEPACKEDSTRUCT(OptimizedSpirvStoredHeader, {
+    uint64_t unoptimized_hash;
+    uint64_t optimized_hash;
+    uint32_t optimized_word_count;
+
+    // Must be updated when the optimization passes in SpirvToolsContext are
+    // changed.
+    static constexpr uint32_t kVersion = 0x20221114;
+  });
+
   enum class PipelineGeometryShader : uint32_t {
     kNone,
     kPointList,
@@ -175,10 +287,19 @@ class VulkanPipelineCache {
     xenos::StencilOp stencil_back_pass_op : 3;           // 3
     xenos::StencilOp stencil_back_depth_fail_op : 3;     // 6
     xenos::CompareFunction stencil_back_compare_op : 3;  // 9
+    // Used with dynamic rendering rather than a render pass object, and with
+    // face culling and depth / stencil state being dynamic - if set, all of
+    // them are zero in the description.
+    uint32_t dynamic_rendering : 1;  // 10
+    // Used with dynamic_rendering if primitive restart is dynamic - if set,
+    // primitive_restart is zero in the description.
+    uint32_t dynamic_primitive_restart : 1;  // 11
 
     // Filled only for the attachments present in the render pass object.
     PipelineRenderTarget render_targets[xenos::kMaxColorRenderTargets];
 
+    static constexpr uint32_t kVersion = 0x20261016;
+
     // Including all the padding, for a stable hash.
     PipelineDescription() { Reset(); }
     PipelineDescription(const PipelineDescription& description) {
@@ -200,11 +321,33 @@ class VulkanPipelineCache {
     };
   });
 
+  XEPACKEDSTRUCT(PipelineStoredDescription, {
+    uint64_t description_hash;
+    PipelineDescription description;
+  });
+
   struct Pipeline {
+    // VK_NULL_HANDLE if creation has failed. Written by the thread creating the
+    // pipeline before is_created is set. With pipeline libraries, may be
+    // replaced with the link-time optimized pipeline on the command processor
+    // thread later.
     VkPipeline pipeline = VK_NULL_HANDLE;
+    // The fast-linked pipeline replaced with the link-time optimized one, kept
+    // until shutdown as it may still be referenced by submitted command
+    // buffers.
+    VkPipeline unoptimized_pipeline = VK_NULL_HANDLE;
+    std::atomic<bool> is_created = {false};
     // The layouts are owned by the VulkanCommandProcessor, and must not be
     // destroyed by it while the pipeline cache is active.
     const PipelineLayoutProvider* pipeline_layout;
+    // Creation priority while the pipeline is waiting in the creation queue -
+    // pipelines needed in later submissions, and then the ones requested by
+    // more draws, are created first. Protected with creation_request_lock_.
+    uint64_t last_request_submission = 0;
+    uint32_t request_count = 0;
+    // Whether the pipeline has been added to fallback_pipelines_ after being
+    // created. Only accessed on the command processor thread.
+    bool is_fallback_registered = false;
     Pipeline(const PipelineLayoutProvider* pipeline_layout_provider)
         : pipeline_layout(pipeline_layout_provider) {}
   };
@@ -219,6 +362,28 @@ class VulkanPipelineCache {
     VkRenderPass render_pass;
   };
 
+  // Parts of the pipeline state compiled separately with
+  // VK_EXT_graphics_pipeline_library to be shared between pipelines.
+  enum class PipelineLibraryType {
+    // Including the vertex input interface.
+    kPreRasterization,
+    kFragmentShader,
+    kFragmentOutput,
+
+    kCount,
+  };
+
+  struct PipelineLibraries {
+    VkPipeline libraries[size_t(PipelineLibraryType::kCount)];
+  };
+
+  // A fast-linked pipeline to link again with link-time optimization on the
+  // creation threads when they're not busy creating new pipelines.
+  struct PipelineOptimizedLinkRequest {
+    Pipeline* pipeline;
+    PipelineLibraries libraries;
+  };
+
   union GeometryShaderKey {
     uint32_t key;
     struct {
@@ -246,13 +411,38 @@ class VulkanPipelineCache {
     }
   };
 
-  // Can be called from multiple threads.
+  VulkanShader* LoadShader(xenos::ShaderType shader_type,
+                           const uint32_t* host_address, uint32_t dword_count,
+                           uint64_t data_hash);
+
+  // Can be called from multiple threads. If the SPIR-V optimization is
+  // enabled, and the optimized SPIR-V is not cached yet, it's optimized on the
+  // current thread if storage_loading is true (when called from the shader
+  // storage loading threads), or queued for optimization on the storage
+  // writing thread for the next translations otherwise.
   bool TranslateAnalyzedShader(SpirvShaderTranslator& translator,
-                               VulkanShader::VulkanTranslation& translation);
+                               VulkanShader::VulkanTranslation& translation,
+                               bool storage_loading);
+  // Loads the optimized SPIR-V from the storage and opens it for appending.
+  void InitializeOptimizedSpirvStorage(
+      const std::filesystem::path& storage_root, uint32_t title_id);
+  // Optimizes the SPIR-V, adds the result to optimized_spirv_, and appends it
+  // to the storage if it's open. Can be called from multiple threads.
+  bool OptimizeSpirv(uint64_t unoptimized_hash, const uint32_t* words,
+                     size_t word_count,
+                     std::vector<uint8_t>& optimized_binary_out);
+  // Queues the shader for writing to the storage if it hasn't been written to
+  // the currently open one yet.
+  void StoreShader(Shader& shader);
 
   void WritePipelineRenderTargetDescription(
       reg::RB_BLENDCONTROL blend_control, uint32_t write_mask,
       PipelineRenderTarget& render_target_out) const;
+  // Moves the fixed-function state controlled with extended dynamic state from
+  // the description, converting it to the Vulkan values.
+  static void ExtractExtendedDynamicState(
+      PipelineDescription& description,
+      ExtendedDynamicState& extended_dynamic_state_out);
   bool GetCurrentStateDescription(
       const VulkanShader::VulkanTranslation* vertex_shader,
       const VulkanShader::VulkanTranslation* pixel_shader,
@@ -272,11 +462,62 @@ class VulkanPipelineCache {
       GeometryShaderKey& key_out);
   VkShaderModule GetGeometryShader(GeometryShaderKey key);
 
+  // Looks up the pipeline layout, the geometry shader and the render pass for
+  // creating a pipeline with the description using already translated shaders.
+  // The render pass is VK_NULL_HANDLE for pipelines used with dynamic
+  // rendering.
+  bool GetPipelineCreationObjects(
+      const PipelineDescription& description,
+      const VulkanShader::VulkanTranslation* vertex_shader,
+      const VulkanShader::VulkanTranslation* pixel_shader,
+      const PipelineLayoutProvider*& pipeline_layout_out,
+      VkShaderModule& geometry_shader_out, VkRenderPass& render_pass_out);
+
   // Can be called from creation threads - all needed data must be fully set up
   // at the point of the call: shaders must be translated, pipeline layout and
   // render pass objects must be available.
   bool EnsurePipelineCreated(
       const PipelineCreationArguments& creation_arguments);
+  // Returns VK_NULL_HANDLE in case of failure.
+  VkPipeline CreateVulkanPipeline(
+      const PipelineCreationArguments& creation_arguments);
+
+  // Returns the description with only the parts that affect the pipeline
+  // library of the type.
+  static PipelineDescription GetPipelineLibraryKey(
+      const PipelineDescription& description, PipelineLibraryType type);
+  // Returns the existing pipeline library for the description or creates it
+  // from the subset of the state in the complete pipeline creation info. Can
+  // be called from creation threads. Returns VK_NULL_HANDLE in case of
+  // failure.
+  VkPipeline GetPipelineLibrary(
+      const PipelineDescription& description, PipelineLibraryType type,
+      const VkGraphicsPipelineCreateInfo& pipeline_create_info);
+  // Returns VK_NULL_HANDLE in case of failure.
+  VkPipeline LinkPipelineLibraries(const PipelineLibraries& libraries,
+                                   VkPipelineLayout pipeline_layout,
+                                   bool link_time_optimization);
+
+  // Raises the creation priority of a pipeline that is still in the creation
+  // queue.
+  void UpdatePipelineCreationPriority(Pipeline& pipeline);
+
+  // Returns the handle to draw with - of the pipeline itself, or of its
+  // fallback if it's still being created, in which case its creation priority
+  // is raised. Makes created pipelines available as fallbacks if needed.
+  // Returns false if the creation of the pipeline has failed.
+  bool ResolvePipelineForDraw(
+      std::pair<const PipelineDescription, Pipeline>& pipeline,
+      void*& pipeline_handle_out,
+      const PipelineLayoutProvider*& pipeline_layout_out);
+  // Returns the description with only the parts that must match for a pipeline
+  // to be usable as a fallback for one that is still being created.
+  static PipelineDescription GetFallbackPipelineKey(
+      const PipelineDescription& description);
+
+  // Writes the contents of the Vulkan pipeline cache object to the local
+  // storage.
+  void WriteVulkanPipelineCacheData();
 
   VulkanCommandProcessor& command_processor_;
   const RegisterFile& register_file_;
@@ -288,6 +529,15 @@ class VulkanPipelineCache {
   // Reusable shader translator on the command processor thread.
   std::unique_ptr<SpirvShaderTranslator> shader_translator_;
 
+  // Optional optimization of the translated SPIR-V, as some drivers compile
+  // unoptimized SPIR-V much more slowly and generate worse code for it.
+  ui::vulkan::SpirvToolsContext spirv_tools_context_;
+  std::mutex optimized_spirv_mutex_;
+  // XXH3 hash of the unoptimized SPIR-V -> optimized SPIR-V.
+  std::unordered_map<uint64_t, std::vector<uint8_t>,
+                     xe::hash::IdentityHasher<uint64_t>>
+      optimized_spirv_;
+
   struct LayoutUID {
     size_t uid;
     size_t vector_span_offset;
@@ -321,9 +571,134 @@ class VulkanPipelineCache {
   std::unordered_map<PipelineDescription, Pipeline, PipelineDescription::Hasher>
       pipelines_;
 
+  // Whether pipelines are linked from libraries with
+  // VK_EXT_graphics_pipeline_library.
+  bool pipeline_libraries_used_ = false;
+  // Whether linking without link-time optimization is fast, so pipelines are
+  // linked quickly first, and then with optimization in the background.
+  bool pipeline_libraries_fast_linking_ = false;
+  std::mutex pipeline_libraries_mutex_;
+  // Library keys (from GetPipelineLibraryKey) -> libraries, for each
+  // PipelineLibraryType. Stores VK_NULL_HANDLE if failed to create.
+  std::unordered_map<PipelineDescription, VkPipeline,
+                     PipelineDescription::Hasher>
+      pipeline_libraries_[size_t(PipelineLibraryType::kCount)];
+
+  // Created pipelines to draw with while pipelines with the same fallback key
+  // are being created, for the fallback pending pipeline draw policy.
+  std::unordered_map<PipelineDescription, Pipeline*,
+                     PipelineDescription::Hasher>
+      fallback_pipelines_;
+
   // Previously used pipeline, to avoid lookups if the state wasn't changed.
-  const std::pair<const PipelineDescription, Pipeline>* last_pipeline_ =
-      nullptr;
+  std::pair<const PipelineDescription, Pipeline>* last_pipeline_ = nullptr;
+  // The arguments of the ConfigurePipeline call that has resulted in
+  // last_pipeline_, for skipping building and comparing the description in
+  // runs of draws without changes of the state it's derived from.
+  struct LastPipelineInputs {
+    uint64_t pipeline_state_register_write_count;
+    const VulkanShader::VulkanTranslation* vertex_shader;
+    const VulkanShader::VulkanTranslation* pixel_shader;
+    xenos::PrimitiveType host_primitive_type;
+    bool host_primitive_reset_enabled;
+    reg::RB_DEPTHCONTROL normalized_depth_control;
+    uint32_t normalized_color_mask;
+    VulkanRenderTargetCache::RenderPassKey render_pass_key;
+    ExtendedDynamicState extended_dynamic_state;
+  };
+  LastPipelineInputs last_pipeline_inputs_;
+  bool last_pipeline_inputs_valid_ = false;
+
+  bool primitive_restart_dynamic_ = false;
+
+  // Hashes of the descriptions before the removal of the dynamic state, for
+  // statistics of the pipelines not created because of dynamic state.
+  std::unordered_set<uint64_t> dynamic_state_full_description_hashes_;
+  uint64_t last_dynamic_state_full_description_hash_ = 0;
+  uint64_t pipelines_shared_by_dynamic_state_total_ = 0;
+
+  // Currently open shader storage path.
+  std::filesystem::path shader_storage_cache_root_;
+  uint32_t shader_storage_title_id_ = 0;
+
+  // Shader storage output stream, for preload in the next emulator runs.
+  FILE* shader_storage_file_ = nullptr;
+  // For only writing shaders to the currently open storage once, incremented
+  // when switching the storage.
+  uint32_t shader_storage_index_ = 0;
+  bool shader_storage_file_flush_needed_ = false;
+
+  // Optimized SPIR-V storage output stream, appended to directly (but
+  // atomically) by the threads optimizing the SPIR-V.
+  FILE* optimized_spirv_storage_file_ = nullptr;
+
+  // Pipeline storage output stream, for preload in the next emulator runs.
+  FILE* pipeline_storage_file_ = nullptr;
+  bool pipeline_storage_file_flush_needed_ = false;
+
+  // Driver-specific compiled pipeline data, loaded from and written to the
+  // local (not shareable between hosts) part of the storage, VK_NULL_HANDLE
+  // if the storage is not open.
+  VkPipelineCache vk_pipeline_cache_ = VK_NULL_HANDLE;
+  std::filesystem::path vk_pipeline_cache_file_path_;
+
+  // Threads creating pipelines requested on the command processor thread, for
+  // the pipeline compilation to overlap with the rest of the submission.
+  PendingPipelineDrawPolicy pending_pipeline_draw_policy_ =
+      PendingPipelineDrawPolicy::kWait;
+  void CreationThread(size_t thread_index);
+  // Creates all the queued pipelines and awaits the completion of their
+  // creation on the creation threads.
+  void CreateQueuedPipelines();
+  void CreateQueuedPipelinesOnProcessorThread();
+  // Dequeues the pipeline with the highest creation priority, must be called
+  // with creation_request_lock_ locked, and the queue must not be empty.
+  PipelineCreationArguments PopHighestPriorityCreationRequest();
+  std::mutex creation_request_lock_;
+  std::condition_variable creation_request_cond_;
+  // Protected with creation_request_lock_, notify_one creation_request_cond_
+  // when set.
+  std::vector<PipelineCreationArguments> creation_queue_;
+  // Number of threads that are currently creating a pipeline - incremented when
+  // a pipeline is dequeued (the completion event can't be triggered before this
+  // is zero). Protected with creation_request_lock_.
+  size_t creation_threads_busy_ = 0;
+  // Fast-linked pipelines to link again with link-time optimization, with a
+  // lower priority than the creation queue, and the resulting pipelines to
+  // replace the fast-linked ones with on the command processor thread.
+  // Protected with creation_request_lock_, notify_one creation_request_cond_
+  // when adding requests.
+  std::deque<PipelineOptimizedLinkRequest> optimized_link_queue_;
+  std::vector<std::pair<Pipeline*, VkPipeline>> optimized_links_completed_;
+  std::atomic<uint64_t> pipelines_created_total_ = {0};
+  // Manual-reset event set when the last queued pipeline is created and there
+  // are no more pipelines to create. This is triggered by the thread creating
+  // the last pipeline.
+  std::unique_ptr<xe::threading::Event> creation_completion_event_;
+  // Whether setting the event on completion is queued. Protected with
+  // creation_request_lock_, notify_one creation_request_cond_ when set.
+  bool creation_completion_set_event_ = false;
+  // Whether to shut down the creation threads as soon as possible. Protected
+  // with creation_request_lock_, notify_all creation_request_cond_ when set.
+  bool creation_threads_shutdown_ = false;
+  std::vector<std::unique_ptr<xe::threading::Thread>> creation_threads_;
+
+  // Thread for asynchronous writing to the storage streams.
+  void StorageWriteThread();
+  std::mutex storage_write_request_lock_;
+  std::condition_variable storage_write_request_cond_;
+  // Storage thread input is protected with storage_write_request_lock_, and the
+  // thread is notified about its change via storage_write_request_cond_.
+  std::deque<const Shader*> storage_write_shader_queue_;
+  std::deque<PipelineStoredDescription> storage_write_pipeline_queue_;
+  // Hashes of unoptimized SPIR-V translated on the command processor thread
+  // and the SPIR-V, to optimize.
+  std::deque<std::pair<uint64_t, std::vector<uint32_t>>>
+      storage_write_spirv_queue_;
+  bool storage_write_flush_shaders_ = false;
+  bool storage_write_flush_pipelines_ = false;
+  bool storage_write_thread_shutdown_ = false;
+  std::unique_ptr<xe::threading::Thread> storage_write_thread_;
 };
 
 }  // namespace vulkan
@@ -14,12 +14,21 @@
 #include <memory>
 
 #include "xenia/base/assert.h"
+#include "xenia/base/cvar.h"
 #include "xenia/base/logging.h"
 #include "xenia/gpu/vulkan/deferred_command_buffer.h"
 #include "xenia/gpu/vulkan/vulkan_command_processor.h"
 #include "xenia/ui/vulkan/vulkan_provider.h"
 #include "xenia/ui/vulkan/vulkan_util.h"
 
+DEFINE_bool(
+    vulkan_primitive_expansion_in_vs, false,
+    "Expand point sprites in vertex shaders and convert quad lists to triangle "
+    "lists even if geometry shaders are supported, rather than using geometry "
+    "shaders, which are slow on many GPUs. Rectangle lists still use geometry "
+    "shaders if they're supported.",
+    "Vulkan");
+
 namespace xe {
 namespace gpu {
 namespace vulkan {
@@ -33,11 +42,14 @@ bool VulkanPrimitiveProcessor::Initialize() {
   const VkPhysicalDevicePortabilitySubsetFeaturesKHR*
       device_portability_subset_features =
           provider.device_portability_subset_features();
+  // Vertex shader expansion is the only option without geometry shaders.
+  bool geometry_shader_expansion = device_features.geometryShader &&
+                                   !cvars::vulkan_primitive_expansion_in_vs;
   if (!InitializeCommon(device_features.fullDrawIndexUint32,
                         !device_portability_subset_features ||
                             device_portability_subset_features->triangleFans,
-                        false, device_features.geometryShader,
-                        device_features.geometryShader,
+                        false, geometry_shader_expansion,
+                        geometry_shader_expansion,
                         device_features.geometryShader)) {
     Shutdown();
     return false;
@@ -125,7 +137,7 @@ void VulkanPrimitiveProcessor::EndSubmission() {
 }
 
 void VulkanPrimitiveProcessor::EndFrame() {
-  ClearPerFrameCache();
+  EndCacheFrame();
   frame_index_buffers_.clear();
 }
 
@@ -54,6 +54,14 @@ DEFINE_string(
     "  Choose what is considered the most optimal for the system (currently "
     "always FB because the FSI path is much slower now).",
     "GPU");
+DEFINE_bool(
+    vulkan_dynamic_rendering, true,
+    "With host framebuffers, draw using VK_KHR_dynamic_rendering and "
+    "VK_EXT_extended_dynamic_state if supported by the device, instead of "
+    "creating render pass and framebuffer objects for each render target "
+    "configuration, and separate pipelines for each depth / stencil and face "
+    "culling state.",
+    "GPU");
 
 namespace xe {
 namespace gpu {
@@ -273,6 +281,19 @@ bool VulkanRenderTargetCache::Initialize(uint32_t shared_memory_binding_count) {
       (depth_unorm24_properties.optimalTilingFeatures &
        kUsedDepthFormatFeatures) == kUsedDepthFormatFeatures;
 
+  // With host render targets, guest render target configurations change very
+  // often, and every new combination of render targets needs a framebuffer
+  // object, and possibly a render pass object and pipelines compatible with
+  // it. Dynamic rendering removes the need for them, and extended dynamic
+  // state allows for the depth / stencil and face culling state to be changed
+  // without switching the pipelines.
+  use_dynamic_rendering_ =
+      path_ == Path::kHostRenderTargets && cvars::vulkan_dynamic_rendering &&
+      provider.device_extensions().khr_dynamic_rendering &&
+      provider.device_dynamic_rendering_features().dynamicRendering &&
+      provider.device_extensions().ext_extended_dynamic_state &&
+      provider.device_extended_dynamic_state_features().extendedDynamicState;
+
   // 2x MSAA support.
   // TODO(Triang3l): Handle sampledImageIntegerSampleCounts 4 not supported in
   // transfers.
@@ -876,6 +897,9 @@ bool VulkanRenderTargetCache::Initialize(uint32_t shared_memory_binding_count) {
   std::memset(last_update_framebuffer_attachments_, 0,
               sizeof(last_update_framebuffer_attachments_));
   last_update_framebuffer_ = VK_NULL_HANDLE;
+  std::memset(last_update_dynamic_rendering_views_, 0,
+              sizeof(last_update_dynamic_rendering_views_));
+  last_update_dynamic_rendering_extent_ = VkExtent2D{};
 
   InitializeCommon();
   return true;
@@ -1002,6 +1026,8 @@ void VulkanRenderTargetCache::ClearCache() {
   // Framebuffer objects must be destroyed because they reference views of
   // attachment images, which may be removed by the common ClearCache.
   last_update_framebuffer_ = VK_NULL_HANDLE;
+  std::memset(last_update_dynamic_rendering_views_, 0,
+              sizeof(last_update_dynamic_rendering_views_));
   for (const auto& framebuffer_pair : framebuffers_) {
     dfn.vkDestroyFramebuffer(device, framebuffer_pair.second.framebuffer,
                              nullptr);
@@ -1336,50 +1362,76 @@ bool VulkanRenderTargetCache::Update(
                 : depth_and_color_render_targets[4]->key().GetColorFormat();
       }
 
-      const Framebuffer* framebuffer = last_update_framebuffer_;
-      VkRenderPass render_pass = last_update_render_pass_key_ == render_pass_key
-                                     ? last_update_render_pass_
-                                     : VK_NULL_HANDLE;
-      if (render_pass == VK_NULL_HANDLE) {
-        render_pass = GetHostRenderTargetsRenderPass(render_pass_key);
-        if (render_pass == VK_NULL_HANDLE) {
-          return false;
-        }
-        // Framebuffer for a different render pass needed now.
-        framebuffer = nullptr;
-      }
-
       uint32_t pitch_tiles_at_32bpp =
           ((rb_surface_info.surface_pitch << uint32_t(
                 rb_surface_info.msaa_samples >= xenos::MsaaSamples::k4X)) +
            (xenos::kEdramTileWidthSamples - 1)) /
           xenos::kEdramTileWidthSamples;
-      if (framebuffer) {
-        if (last_update_framebuffer_pitch_tiles_at_32bpp_ !=
-                pitch_tiles_at_32bpp ||
-            std::memcmp(last_update_framebuffer_attachments_,
-                        depth_and_color_render_targets,
-                        sizeof(last_update_framebuffer_attachments_))) {
+
+      if (use_dynamic_rendering_) {
+        // No objects to create - the attachments are specified directly when
+        // beginning rendering.
+        for (uint32_t i = 0; i < 1 + xenos::kMaxColorRenderTargets; ++i) {
+          const RenderTarget* rt = depth_and_color_render_targets[i];
+          last_update_dynamic_rendering_views_[i] =
+              rt ? (i ? static_cast<const VulkanRenderTarget*>(rt)
+                            ->view_depth_color()
+                      : static_cast<const VulkanRenderTarget*>(rt)
+                            ->view_depth_stencil())
+                 : VK_NULL_HANDLE;
+        }
+        last_update_dynamic_rendering_extent_ =
+            GetHostRenderTargetsFramebufferExtent(render_pass_key,
+                                                  pitch_tiles_at_32bpp);
+        last_update_render_pass_key_ = render_pass_key;
+        last_update_render_pass_ = VK_NULL_HANDLE;
+        last_update_framebuffer_pitch_tiles_at_32bpp_ = pitch_tiles_at_32bpp;
+        std::memcpy(last_update_framebuffer_attachments_,
+                    depth_and_color_render_targets,
+                    sizeof(last_update_framebuffer_attachments_));
+        last_update_framebuffer_ = nullptr;
+      } else {
+        const Framebuffer* framebuffer = last_update_framebuffer_;
+        VkRenderPass render_pass =
+            last_update_render_pass_key_ == render_pass_key
+                ? last_update_render_pass_
+                : VK_NULL_HANDLE;
+        if (render_pass == VK_NULL_HANDLE) {
+          render_pass = GetHostRenderTargetsRenderPass(render_pass_key);
+          if (render_pass == VK_NULL_HANDLE) {
+            return false;
+          }
+          // Framebuffer for a different render pass needed now.
           framebuffer = nullptr;
         }
-      }
-      if (!framebuffer) {
-        framebuffer = GetHostRenderTargetsFramebuffer(
-            render_pass_key, pitch_tiles_at_32bpp,
-            depth_and_color_render_targets);
+
+        if (framebuffer) {
+          if (last_update_framebuffer_pitch_tiles_at_32bpp_ !=
+                  pitch_tiles_at_32bpp ||
+              std::memcmp(last_update_framebuffer_attachments_,
+                          depth_and_color_render_targets,
+                          sizeof(last_update_framebuffer_attachments_))) {
+            framebuffer = nullptr;
+          }
+        }
         if (!framebuffer) {
-          return false;
+          framebuffer = GetHostRenderTargetsFramebuffer(
+              render_pass_key, pitch_tiles_at_32bpp,
+              depth_and_color_render_targets);
+          if (!framebuffer) {
+            return false;
+          }
         }
-      }
 
-      // Successful update - write the new configuration.
-      last_update_render_pass_key_ = render_pass_key;
-      last_update_render_pass_ = render_pass;
-      last_update_framebuffer_pitch_tiles_at_32bpp_ = pitch_tiles_at_32bpp;
-      std::memcpy(last_update_framebuffer_attachments_,
-                  depth_and_color_render_targets,
-                  sizeof(last_update_framebuffer_attachments_));
-      last_update_framebuffer_ = framebuffer;
+        // Successful update - write the new configuration.
+        last_update_render_pass_key_ = render_pass_key;
+        last_update_render_pass_ = render_pass;
+        last_update_framebuffer_pitch_tiles_at_32bpp_ = pitch_tiles_at_32bpp;
+        std::memcpy(last_update_framebuffer_attachments_,
+                    depth_and_color_render_targets,
+                    sizeof(last_update_framebuffer_attachments_));
+        last_update_framebuffer_ = framebuffer;
+      }
 
       // Transition the used render targets.
       for (uint32_t i = 0; i < 1 + xenos::kMaxColorRenderTargets; ++i) {
@@ -1578,6 +1630,71 @@ VkRenderPass VulkanRenderTargetCache::GetHostRenderTargetsRenderPass(
   return render_pass;
 }
 
+uint32_t VulkanRenderTargetCache::GetLastUpdateDynamicRenderingAttachments(
+    VkRenderingAttachmentInfoKHR* color_attachments_out,
+    VkRenderingAttachmentInfoKHR& depth_stencil_attachment_out) const {
+  assert_true(use_dynamic_rendering_);
+  // Same load and store operations and layouts as in the render pass objects.
+  uint32_t color_rts_used =
+      last_update_render_pass_key_.depth_and_color_used >> 1;
+  uint32_t color_attachment_count = 32 - xe::lzcnt(color_rts_used);
+  for (uint32_t i = 0; i < color_attachment_count; ++i) {
+    VkRenderingAttachmentInfoKHR& color_attachment = color_attachments_out[i];
+    color_attachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+    color_attachment.pNext = nullptr;
+    color_attachment.imageView = last_update_dynamic_rendering_views_[1 + i];
+    color_attachment.imageLayout = VulkanRenderTarget::kColorDrawLayout;
+    color_attachment.resolveMode = VK_RESOLVE_MODE_NONE;
+    color_attachment.resolveImageView = VK_NULL_HANDLE;
+    color_attachment.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    color_attachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+    color_attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    color_attachment.clearValue = {};
+  }
+  depth_stencil_attachment_out.sType =
+      VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+  depth_stencil_attachment_out.pNext = nullptr;
+  depth_stencil_attachment_out.imageView =
+      last_update_dynamic_rendering_views_[0];
+  depth_stencil_attachment_out.imageLayout =
+      VulkanRenderTarget::kDepthDrawLayout;
+  depth_stencil_attachment_out.resolveMode = VK_RESOLVE_MODE_NONE;
+  depth_stencil_attachment_out.resolveImageView = VK_NULL_HANDLE;
+  depth_stencil_attachment_out.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+  depth_stencil_attachment_out.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+  depth_stencil_attachment_out.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+  depth_stencil_attachment_out.clearValue = {};
+  return color_attachment_count;
+}
+
+uint32_t VulkanRenderTargetCache::GetHostRenderTargetsAttachmentFormats(
+    RenderPassKey key, VkFormat* color_formats_out,
+    VkFormat& depth_stencil_format_out) const {
+  // Same as the attachments of render pass objects.
+  depth_stencil_format_out = (key.depth_and_color_used & 0b1)
+                                 ? GetDepthVulkanFormat(key.depth_format)
+                                 : VK_FORMAT_UNDEFINED;
+  xenos::ColorRenderTargetFormat color_formats[] = {
+      key.color_0_view_format,
+      key.color_1_view_format,
+      key.color_2_view_format,
+      key.color_3_view_format,
+  };
+  uint32_t color_attachment_count =
+      32 - xe::lzcnt(uint32_t(key.depth_and_color_used >> 1));
+  for (uint32_t i = 0; i < color_attachment_count; ++i) {
+    if (!(key.depth_and_color_used & (uint32_t(1) << (1 + i)))) {
+      color_formats_out[i] = VK_FORMAT_UNDEFINED;
+      continue;
+    }
+    color_formats_out[i] =
+        key.color_rts_use_transfer_formats
+            ? GetColorOwnershipTransferVulkanFormat(color_formats[i])
+            : GetColorVulkanFormat(color_formats[i]);
+  }
+  return color_attachment_count;
+}
+
 VkFormat VulkanRenderTargetCache::GetDepthVulkanFormat(
     xenos::DepthRenderTargetFormat format) const {
   if (format == xenos::DepthRenderTargetFormat::kD24S8 &&
@@ -2049,6 +2166,32 @@ void VulkanRenderTargetCache::CommitEdramBufferShaderWrites(
   PixelShaderInterlockFullEdramBarrierPlaced();
 }
 
+VkExtent2D VulkanRenderTargetCache::GetHostRenderTargetsFramebufferExtent(
+    RenderPassKey render_pass_key, uint32_t pitch_tiles_at_32bpp) const {
+  VkExtent2D host_extent;
+  if (pitch_tiles_at_32bpp) {
+    host_extent.width = RenderTargetKey::GetWidth(pitch_tiles_at_32bpp,
+                                                  render_pass_key.msaa_samples);
+    host_extent.height = GetRenderTargetHeight(pitch_tiles_at_32bpp,
+                                               render_pass_key.msaa_samples);
+  } else {
+    assert_zero(render_pass_key.depth_and_color_used);
+    // Still needed for occlusion queries.
+    host_extent.width = xenos::kTexture2DCubeMaxWidthHeight;
+    host_extent.height = xenos::kTexture2DCubeMaxWidthHeight;
+  }
+  // Limiting to the device limit for the case of no attachments, for which
+  // there's no limit imposed by the sizes of the attachments that have been
+  // created successfully.
+  const VkPhysicalDeviceLimits& device_limits =
+      command_processor_.GetVulkanProvider().device_properties().limits;
+  host_extent.width = std::min(host_extent.width * draw_resolution_scale_x(),
+                               device_limits.maxFramebufferWidth);
+  host_extent.height = std::min(host_extent.height * draw_resolution_scale_y(),
+                                device_limits.maxFramebufferHeight);
+  return host_extent;
+}
+
 const VulkanRenderTargetCache::Framebuffer*
 VulkanRenderTargetCache::GetHostRenderTargetsFramebuffer(
     RenderPassKey render_pass_key, uint32_t pitch_tiles_at_32bpp,
@@ -2084,8 +2227,6 @@ VulkanRenderTargetCache::GetHostRenderTargetsFramebuffer(
       command_processor_.GetVulkanProvider();
   const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
   VkDevice device = provider.device();
-  const VkPhysicalDeviceLimits& device_limits =
-      provider.device_properties().limits;
 
   VkRenderPass render_pass = GetHostRenderTargetsRenderPass(render_pass_key);
   if (render_pass == VK_NULL_HANDLE) {
@@ -2118,25 +2259,8 @@ VulkanRenderTargetCache::GetHostRenderTargetsFramebuffer(
   framebuffer_create_info.renderPass = render_pass;
   framebuffer_create_info.attachmentCount = attachment_count;
   framebuffer_create_info.pAttachments = attachments;
-  VkExtent2D host_extent;
-  if (pitch_tiles_at_32bpp) {
-    host_extent.width = RenderTargetKey::GetWidth(pitch_tiles_at_32bpp,
-                                                  render_pass_key.msaa_samples);
-    host_extent.height = GetRenderTargetHeight(pitch_tiles_at_32bpp,
-                                               render_pass_key.msaa_samples);
-  } else {
-    assert_zero(render_pass_key.depth_and_color_used);
-    // Still needed for occlusion queries.
-    host_extent.width = xenos::kTexture2DCubeMaxWidthHeight;
-    host_extent.height = xenos::kTexture2DCubeMaxWidthHeight;
-  }
-  // Limiting to the device limit for the case of no attachments, for which
-  // there's no limit imposed by the sizes of the attachments that have been
-  // created successfully.
-  host_extent.width = std::min(host_extent.width * draw_resolution_scale_x(),
-                               device_limits.maxFramebufferWidth);
-  host_extent.height = std::min(host_extent.height * draw_resolution_scale_y(),
-                                device_limits.maxFramebufferHeight);
+  VkExtent2D host_extent = GetHostRenderTargetsFramebufferExtent(
+      render_pass_key, pitch_tiles_at_32bpp);
   framebuffer_create_info.width = host_extent.width;
   framebuffer_create_info.height = host_extent.height;
   framebuffer_create_info.layers = 1;
@@ -4969,8 +5093,10 @@ void VulkanRenderTargetCache::PerformTransfersAndResolveClears(
 
       // Perform the transfers for the render target.
 
-      command_processor_.SubmitBarriersAndEnterRenderTargetCacheRenderPass(
-          transfer_render_pass, transfer_framebuffer);
+      if (command_processor_.SubmitBarriersAndEnterRenderTargetCacheRenderPass(
+              transfer_render_pass, transfer_framebuffer)) {
+        ++edram_transfer_render_passes_total_;
+      }
 
       if (stencil_clear_rectangle_count) {
         VkClearAttachment* stencil_clear_attachment;
@@ -5336,8 +5462,10 @@ void VulkanRenderTargetCache::PerformTransfersAndResolveClears(
 
     // Perform the clear.
     if (resolve_clear_needed) {
-      command_processor_.SubmitBarriersAndEnterRenderTargetCacheRenderPass(
-          transfer_render_pass, transfer_framebuffer);
+      if (command_processor_.SubmitBarriersAndEnterRenderTargetCacheRenderPass(
+              transfer_render_pass, transfer_framebuffer)) {
+        ++edram_transfer_render_passes_total_;
+      }
       VkClearAttachment resolve_clear_attachment;
       resolve_clear_attachment.colorAttachment = 0;
       std::memset(&resolve_clear_attachment.clearValue, 0,
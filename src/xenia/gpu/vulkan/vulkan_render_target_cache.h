@@ -137,6 +137,33 @@ class VulkanRenderTargetCache final : public RenderTargetCache {
   const Framebuffer* last_update_framebuffer() const {
     return last_update_framebuffer_;
   }
+  // With dynamic rendering, instead of the render pass and the framebuffer,
+  // the views of the attachments (depth / stencil, then color, VK_NULL_HANDLE
+  // if not used) and the render area.
+  const VkImageView* last_update_dynamic_rendering_views() const {
+    return last_update_dynamic_rendering_views_;
+  }
+  VkExtent2D last_update_dynamic_rendering_extent() const {
+    return last_update_dynamic_rendering_extent_;
+  }
+  // Writes the attachments from the last update for beginning dynamic
+  // rendering, returning the color attachment count (up to and including the
+  // last used one). The depth / stencil attachment is written even if not used.
+  uint32_t GetLastUpdateDynamicRenderingAttachments(
+      VkRenderingAttachmentInfoKHR* color_attachments_out,
+      VkRenderingAttachmentInfoKHR& depth_stencil_attachment_out) const;
+
+  // Whether guest draws with host render targets are done with dynamic
+  // rendering, and their pipelines use extended dynamic state for depth /
+  // stencil and face culling, instead of render pass and framebuffer objects.
+  // Transfers and clears still use render passes.
+  bool use_dynamic_rendering() const { return use_dynamic_rendering_; }
+
+  // Total number of render passes begun for ownership transfers and resolve
+  // clears, for statistics.
+  uint64_t edram_transfer_render_passes_total() const {
+    return edram_transfer_render_passes_total_;
+  }
 
   // Using R16G16[B16A16]_SNORM, which are -1...1, not the needed -32...32.
   // Persistent data doesn't depend on this, so can be overriden by per-game
@@ -172,6 +199,13 @@ class VulkanRenderTargetCache final : public RenderTargetCache {
   // A render pass managed by the render target cache may be ended and resumed
   // at any time (to allow for things like copying and texture loading).
   VkRenderPass GetHostRenderTargetsRenderPass(RenderPassKey key);
+  // For creating pipelines used with dynamic rendering, returns the number of
+  // color attachments (up to and including the last used one, with
+  // VK_FORMAT_UNDEFINED for the unused ones), and the depth / stencil format
+  // (VK_FORMAT_UNDEFINED if not used).
+  uint32_t GetHostRenderTargetsAttachmentFormats(
+      RenderPassKey key, VkFormat* color_formats_out,
+      VkFormat& depth_stencil_format_out) const;
   VkRenderPass GetFragmentShaderInterlockRenderPass() const {
     assert_true(GetPath() == Path::kPixelShaderInterlock);
     return fsi_render_pass_;
@@ -306,6 +340,14 @@ class VulkanRenderTargetCache final : public RenderTargetCache {
       last_update_framebuffer_attachments_[1 + xenos::kMaxColorRenderTargets] =
           {};
   const Framebuffer* last_update_framebuffer_ = VK_NULL_HANDLE;
+  VkImageView
+      last_update_dynamic_rendering_views_[1 + xenos::kMaxColorRenderTargets] =
+          {};
+  VkExtent2D last_update_dynamic_rendering_extent_{};
+
+  bool use_dynamic_rendering_ = false;
+
+  uint64_t edram_transfer_render_passes_total_ = 0;
 
   // For host render targets.
 
@@ -835,6 +877,8 @@ class VulkanRenderTargetCache final : public RenderTargetCache {
     }
   };
 
+  VkExtent2D GetHostRenderTargetsFramebufferExtent(
+      RenderPassKey render_pass_key, uint32_t pitch_tiles_at_32bpp) const;
   // Returns the framebuffer object, or VK_NULL_HANDLE if failed to create.
   const Framebuffer* GetHostRenderTargetsFramebuffer(
       RenderPassKey render_pass_key, uint32_t pitch_tiles_at_32bpp,
@@ -28,6 +28,16 @@ DEFINE_bool(vulkan_sparse_shared_memory, true,
             "allows graphics debuggers that don't support sparse binding to "
             "work.",
             "Vulkan");
+DEFINE_bool(
+    vulkan_shared_memory_host_import, false,
+    "Import the guest physical memory into Vulkan via "
+    "VK_EXT_external_memory_host if supported, and upload invalidated guest "
+    "memory to the GPU by copying it on the GPU directly from there rather "
+    "than through intermediate upload buffers written by the CPU. Reduces the "
+    "CPU time spent on uploads, but the data is read by the GPU when the copy "
+    "is executed rather than when it is requested, so a game modifying the "
+    "memory right after submitting a draw using it may cause corruption.",
+    "Vulkan");
 
 namespace xe {
 namespace gpu {
@@ -179,6 +189,18 @@ bool VulkanSharedMemory::Initialize() {
     }
   }
 
+  if (cvars::vulkan_shared_memory_host_import) {
+    if (InitializeHostImport()) {
+      XELOGGPU(
+          "Shared memory: Uploading directly from the guest physical memory "
+          "imported via VK_EXT_external_memory_host");
+    } else {
+      XELOGGPU(
+          "Shared memory: Failed to import the guest physical memory via "
+          "VK_EXT_external_memory_host, using upload buffers");
+    }
+  }
+
   // The first usage will likely be uploading.
   last_usage_ = Usage::kTransferDestination;
   last_written_range_ = std::make_pair<uint32_t, uint32_t>(0, 0);
@@ -201,6 +223,11 @@ void VulkanSharedMemory::Shutdown(bool from_destructor) {
   const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
   VkDevice device = provider.device();
 
+  ui::vulkan::util::DestroyAndNullHandle(dfn.vkDestroyBuffer, device,
+                                         host_import_buffer_);
+  ui::vulkan::util::DestroyAndNullHandle(dfn.vkFreeMemory, device,
+                                         host_import_buffer_memory_);
+
   ui::vulkan::util::DestroyAndNullHandle(dfn.vkDestroyBuffer, device, buffer_);
   for (VkDeviceMemory memory : buffer_memory_) {
     dfn.vkFreeMemory(device, memory, nullptr);
@@ -391,9 +418,28 @@ bool VulkanSharedMemory::UploadRanges(
   command_processor_.SubmitBarriers(true);
   DeferredCommandBuffer& command_buffer =
       command_processor_.deferred_command_buffer();
+  upload_regions_.clear();
+  if (host_import_buffer_ != VK_NULL_HANDLE) {
+    // The guest memory is already accessible by the GPU, and the host writes
+    // done before the submission are visible to it as the memory is coherent.
+    for (auto upload_range : upload_page_ranges) {
+      uint32_t upload_range_start = upload_range.first << page_size_log2();
+      uint32_t upload_range_length = upload_range.second << page_size_log2();
+      trace_writer_.WriteMemoryRead(upload_range_start, upload_range_length);
+      MakeRangeValid(upload_range_start, upload_range_length, false, false);
+      VkBufferCopy& upload_region = upload_regions_.emplace_back();
+      upload_region.srcOffset = VkDeviceSize(upload_range_start);
+      upload_region.dstOffset = VkDeviceSize(upload_range_start);
+      upload_region.size = VkDeviceSize(upload_range_length);
+    }
+    command_buffer.CmdVkCopyBuffer(host_import_buffer_, buffer_,
+                                   uint32_t(upload_regions_.size()),
+                                   upload_regions_.data());
+    upload_regions_.clear();
+    return true;
+  }
   uint64_t submission_current = command_processor_.GetCurrentSubmission();
   bool successful = true;
-  upload_regions_.clear();
   VkBuffer upload_buffer_previous = VK_NULL_HANDLE;
   for (auto upload_range : upload_page_ranges) {
     uint32_t upload_range_start = upload_range.first;
@@ -482,6 +528,94 @@ void VulkanSharedMemory::GetUsageMasks(Usage usage,
   }
 }
 
+bool VulkanSharedMemory::InitializeHostImport() {
+  const ui::vulkan::VulkanProvider& provider =
+      command_processor_.GetVulkanProvider();
+  if (!provider.device_extensions().ext_external_memory_host) {
+    return false;
+  }
+  const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
+  VkDevice device = provider.device();
+
+  void* host_pointer = memory().TranslatePhysical(0);
+  VkDeviceSize host_pointer_alignment =
+      provider.device_external_memory_host_properties()
+          .minImportedHostPointerAlignment;
+  if (!host_pointer_alignment ||
+      (reinterpret_cast<uintptr_t>(host_pointer) |
+       uintptr_t(kBufferSize)) &
+          uintptr_t(host_pointer_alignment - 1)) {
+    return false;
+  }
+
+  VkExternalMemoryBufferCreateInfoKHR external_memory_buffer_create_info;
+  external_memory_buffer_create_info.sType =
+      VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO_KHR;
+  external_memory_buffer_create_info.pNext = nullptr;
+  external_memory_buffer_create_info.handleTypes =
+      VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+  VkBufferCreateInfo buffer_create_info;
+  buffer_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+  buffer_create_info.pNext = &external_memory_buffer_create_info;
+  buffer_create_info.flags = 0;
+  buffer_create_info.size = kBufferSize;
+  buffer_create_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+  buffer_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+  buffer_create_info.queueFamilyIndexCount = 0;
+  buffer_create_info.pQueueFamilyIndices = nullptr;
+  if (dfn.vkCreateBuffer(device, &buffer_create_info, nullptr,
+                         &host_import_buffer_) != VK_SUCCESS) {
+    return false;
+  }
+
+  VkMemoryHostPointerPropertiesEXT memory_host_pointer_properties;
+  memory_host_pointer_properties.sType =
+      VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT;
+  memory_host_pointer_properties.pNext = nullptr;
+  VkMemoryRequirements buffer_memory_requirements;
+  dfn.vkGetBufferMemoryRequirements(device, host_import_buffer_,
+                                    &buffer_memory_requirements);
+  uint32_t memory_type;
+  // Not mapping the memory via Vulkan, so it must be coherent for the writes
+  // done by the emulated CPU to be visible to the GPU without flushing.
+  if (dfn.vkGetMemoryHostPointerPropertiesEXT(
+          device, VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT,
+          host_pointer, &memory_host_pointer_properties) != VK_SUCCESS ||
+      buffer_memory_requirements.size > kBufferSize ||
+      !xe::bit_scan_forward(memory_host_pointer_properties.memoryTypeBits &
+                                buffer_memory_requirements.memoryTypeBits &
+                                provider.memory_types_host_coherent(),
+                            &memory_type)) {
+    ui::vulkan::util::DestroyAndNullHandle(dfn.vkDestroyBuffer, device,
+                                           host_import_buffer_);
+    return false;
+  }
+
+  VkImportMemoryHostPointerInfoEXT import_memory_host_pointer_info;
+  import_memory_host_pointer_info.sType =
+      VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT;
+  import_memory_host_pointer_info.pNext = nullptr;
+  import_memory_host_pointer_info.handleType =
+      VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+  import_memory_host_pointer_info.pHostPointer = host_pointer;
+  VkMemoryAllocateInfo memory_allocate_info;
+  memory_allocate_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+  memory_allocate_info.pNext = &import_memory_host_pointer_info;
+  memory_allocate_info.allocationSize = kBufferSize;
+  memory_allocate_info.memoryTypeIndex = memory_type;
+  if (dfn.vkAllocateMemory(device, &memory_allocate_info, nullptr,
+                           &host_import_buffer_memory_) != VK_SUCCESS ||
+      dfn.vkBindBufferMemory(device, host_import_buffer_,
+                             host_import_buffer_memory_, 0) != VK_SUCCESS) {
+    ui::vulkan::util::DestroyAndNullHandle(dfn.vkDestroyBuffer, device,
+                                           host_import_buffer_);
+    ui::vulkan::util::DestroyAndNullHandle(dfn.vkFreeMemory, device,
+                                           host_import_buffer_memory_);
+    return false;
+  }
+  return true;
+}
+
 void VulkanSharedMemory::ResetTraceDownload() {
   const ui::vulkan::VulkanProvider& provider =
       command_processor_.GetVulkanProvider();
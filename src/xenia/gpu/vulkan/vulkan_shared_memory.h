@@ -54,6 +54,10 @@ class VulkanSharedMemory : public SharedMemory {
 
   VkBuffer buffer() const { return buffer_; }
 
+  uint64_t upload_bytes_wasted_total() const {
+    return upload_buffer_pool_ ? upload_buffer_pool_->wasted_bytes_total() : 0;
+  }
+
   // Returns true if any downloads were submitted to the command processor.
   bool InitializeTraceSubmitDownloads();
   void InitializeTraceCompleteDownloads();
@@ -69,6 +73,10 @@ class VulkanSharedMemory : public SharedMemory {
   void GetUsageMasks(Usage usage, VkPipelineStageFlags& stage_mask,
                      VkAccessFlags& access_mask) const;
 
+  // Imports the guest physical memory mapping as a host-visible buffer that
+  // uploads are copied from directly (see --vulkan_shared_memory_host_import).
+  bool InitializeHostImport();
+
   VulkanCommandProcessor& command_processor_;
   TraceWriter& trace_writer_;
   VkPipelineStageFlags guest_shader_pipeline_stages_;
@@ -81,6 +89,11 @@ class VulkanSharedMemory : public SharedMemory {
   Usage last_usage_;
   std::pair<uint32_t, uint32_t> last_written_range_;
 
+  // The guest physical memory imported via VK_EXT_external_memory_host, if
+  // available, used as the source of uploads instead of upload_buffer_pool_.
+  VkBuffer host_import_buffer_ = VK_NULL_HANDLE;
+  VkDeviceMemory host_import_buffer_memory_ = VK_NULL_HANDLE;
+
   std::unique_ptr<ui::vulkan::VulkanUploadBufferPool> upload_buffer_pool_;
   std::vector<VkBufferCopy> upload_regions_;
 
@@ -17,6 +17,7 @@
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
 #include "xenia/base/profiling.h"
+#include "xenia/gpu/gpu_flags.h"
 #include "xenia/gpu/texture_info.h"
 #include "xenia/gpu/texture_util.h"
 #include "xenia/gpu/vulkan/deferred_command_buffer.h"
@@ -470,15 +471,70 @@ VulkanTextureCache::~VulkanTextureCache() {
     dfn.vkDestroyPipelineLayout(device, load_pipeline_layout_, nullptr);
   }
 
+  for (const StorageReadback& readback : storage_readbacks_) {
+    dfn.vkDestroyBuffer(device, readback.buffer, nullptr);
+    dfn.vkFreeMemory(device, readback.memory, nullptr);
+  }
+  storage_readbacks_.clear();
+  storage_upload_buffer_pool_.reset();
+
   // Textures memory is allocated using the Vulkan Memory Allocator, destroy all
   // textures before destroying VMA.
   DestroyAllTextures(true);
 
+  for (VmaPool& small_texture_pool : small_texture_pools_) {
+    if (small_texture_pool != VK_NULL_HANDLE) {
+      vmaDestroyPool(vma_allocator_, small_texture_pool);
+      small_texture_pool = VK_NULL_HANDLE;
+    }
+  }
+
   if (vma_allocator_ != VK_NULL_HANDLE) {
     vmaDestroyAllocator(vma_allocator_);
   }
 }
 
+void VulkanTextureCache::CompletedSubmissionUpdated(
+    uint64_t completed_submission_index) {
+  TextureCache::CompletedSubmissionUpdated(completed_submission_index);
+
+  storage_upload_buffer_pool_->Reclaim(completed_submission_index);
+
+  if (storage_readbacks_.empty()) {
+    return;
+  }
+  const ui::vulkan::VulkanProvider& provider =
+      command_processor_.GetVulkanProvider();
+  const ui::vulkan::VulkanProvider::DeviceFunctions& dfn = provider.dfn();
+  VkDevice device = provider.device();
+  while (!storage_readbacks_.empty()) {
+    const StorageReadback& readback = storage_readbacks_.front();
+    if (readback.submission > completed_submission_index) {
+      break;
+    }
+    void* readback_mapping;
+    if (dfn.vkMapMemory(device, readback.memory, 0, VK_WHOLE_SIZE, 0,
+                        &readback_mapping) == VK_SUCCESS) {
+      // The readback memory may be non-coherent.
+      VkMappedMemoryRange readback_range;
+      readback_range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+      readback_range.pNext = nullptr;
+      readback_range.memory = readback.memory;
+      readback_range.offset = 0;
+      readback_range.size = VK_WHOLE_SIZE;
+      dfn.vkInvalidateMappedMemoryRanges(device, 1, &readback_range);
+      StoreTextureData(readback.storage_key, readback_mapping,
+                       size_t(readback.size));
+      dfn.vkUnmapMemory(device, readback.memory);
+    } else {
+      XELOGE("Failed to map a texture storage readback buffer");
+    }
+    dfn.vkDestroyBuffer(device, readback.buffer, nullptr);
+    dfn.vkFreeMemory(device, readback.memory, nullptr);
+    storage_readbacks_.pop_front();
+  }
+}
+
 void VulkanTextureCache::BeginSubmission(uint64_t new_submission_index) {
   TextureCache::BeginSubmission(new_submission_index);
 
@@ -679,6 +735,9 @@ VulkanTextureCache::SamplerParameters VulkanTextureCache::GetSamplerParameters(
   texture_util::GetSubresourcesFromFetchConstant(fetch, nullptr, nullptr,
                                                  nullptr, nullptr, nullptr,
                                                  &mip_min_level, nullptr);
+  if (IsActiveTextureBaseDeferred(binding.fetch_constant)) {
+    mip_min_level = std::max(mip_min_level, UINT32_C(1));
+  }
   parameters.mip_min_level = mip_min_level;
 
   return parameters;
@@ -1045,6 +1104,11 @@ std::unique_ptr<TextureCache::Texture> VulkanTextureCache::CreateTexture(
   image_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
   image_create_info.usage =
       VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+  if (IsContentDeduplicationEnabled() || cvars::store_textures) {
+    // May be copied to a texture with the same contents at another address, or
+    // read back for the persistent storage.
+    image_create_info.usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+  }
   image_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
   image_create_info.queueFamilyIndexCount = 0;
   image_create_info.pQueueFamilyIndices = nullptr;
@@ -1062,13 +1126,35 @@ std::unique_ptr<TextureCache::Texture> VulkanTextureCache::CreateTexture(
     image_format_list_create_info.pViewFormats = formats;
   }
 
-  VmaAllocationCreateInfo allocation_create_info = {};
-  allocation_create_info.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
-
+  // Creating the image first to choose the size class of the allocation.
   VkImage image;
+  if (dfn.vkCreateImage(device, &image_create_info, nullptr, &image) !=
+      VK_SUCCESS) {
+    return nullptr;
+  }
+  VkMemoryRequirements image_memory_requirements;
+  dfn.vkGetImageMemoryRequirements(device, image, &image_memory_requirements);
+
+  VmaAllocationCreateInfo allocation_create_info = {};
+  // Best fit rather than the fastest allocation to keep the free space in
+  // larger contiguous ranges.
+  allocation_create_info.flags = VMA_ALLOCATION_CREATE_STRATEGY_MIN_MEMORY_BIT;
+  // VMA_MEMORY_USAGE_AUTO requires the image creation parameters.
+  allocation_create_info.usage = VMA_MEMORY_USAGE_UNKNOWN;
+  allocation_create_info.preferredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+  if (image_memory_requirements.size <= kSmallTextureMaxSize) {
+    allocation_create_info.pool =
+        GetSmallTexturePool(image_memory_requirements.memoryTypeBits);
+  }
   VmaAllocation allocation;
-  if (vmaCreateImage(vma_allocator_, &image_create_info,
-                     &allocation_create_info, &image, &allocation, nullptr)) {
+  if (vmaAllocateMemoryForImage(vma_allocator_, image, &allocation_create_info,
+                                &allocation, nullptr) != VK_SUCCESS) {
+    dfn.vkDestroyImage(device, image, nullptr);
+    return nullptr;
+  }
+  if (vmaBindImageMemory(vma_allocator_, allocation, image) != VK_SUCCESS) {
+    vmaFreeMemory(vma_allocator_, allocation);
+    dfn.vkDestroyImage(device, image, nullptr);
     return nullptr;
   }
 
@@ -1076,6 +1162,36 @@ std::unique_ptr<TextureCache::Texture> VulkanTextureCache::CreateTexture(
       new VulkanTexture(*this, key, image, allocation));
 }
 
+VmaPool VulkanTextureCache::GetSmallTexturePool(uint32_t memory_type_bits) {
+  VmaAllocationCreateInfo allocation_create_info = {};
+  allocation_create_info.usage = VMA_MEMORY_USAGE_UNKNOWN;
+  allocation_create_info.preferredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+  uint32_t memory_type_index;
+  if (vmaFindMemoryTypeIndex(vma_allocator_, memory_type_bits,
+                             &allocation_create_info,
+                             &memory_type_index) != VK_SUCCESS) {
+    return VK_NULL_HANDLE;
+  }
+  VmaPool& pool = small_texture_pools_[memory_type_index];
+  if (pool == VK_NULL_HANDLE &&
+      !(small_texture_pools_failed_ & (uint32_t(1) << memory_type_index))) {
+    VmaPoolCreateInfo pool_create_info = {};
+    pool_create_info.memoryTypeIndex = memory_type_index;
+    pool_create_info.blockSize = kSmallTexturePoolBlockSize;
+    if (vmaCreatePool(vma_allocator_, &pool_create_info, &pool) !=
+        VK_SUCCESS) {
+      XELOGW(
+          "VulkanTextureCache: Failed to create a pool for small textures in "
+          "memory type {}",
+          memory_type_index);
+      pool = VK_NULL_HANDLE;
+      // Don't retry for every texture.
+      small_texture_pools_failed_ |= uint32_t(1) << memory_type_index;
+    }
+  }
+  return pool;
+}
+
 bool VulkanTextureCache::LoadTextureDataFromResidentMemoryImpl(Texture& texture,
                                                                bool load_base,
                                                                bool load_mips) {
@@ -1083,17 +1199,7 @@ bool VulkanTextureCache::LoadTextureDataFromResidentMemoryImpl(Texture& texture,
   TextureKey texture_key = vulkan_texture.key();
 
   // Get the pipeline.
-  const HostFormatPair& host_format_pair = GetHostFormatPair(texture_key);
-  bool host_format_is_signed;
-  if (IsSignedVersionSeparateForFormat(texture_key)) {
-    host_format_is_signed = bool(texture_key.signed_separate);
-  } else {
-    host_format_is_signed =
-        host_format_pair.format_unsigned.load_shader == kLoadShaderIndexUnknown;
-  }
-  const HostFormat& host_format = host_format_is_signed
-                                      ? host_format_pair.format_signed
-                                      : host_format_pair.format_unsigned;
+  const HostFormat& host_format = GetHostFormat(texture_key);
   LoadShaderIndex load_shader = host_format.load_shader;
   if (load_shader == kLoadShaderIndexUnknown) {
     return false;
@@ -1537,6 +1643,244 @@ bool VulkanTextureCache::LoadTextureDataFromResidentMemoryImpl(Texture& texture,
   return true;
 }
 
+bool VulkanTextureCache::CopyTextureDataFromDuplicateImpl(
+    Texture& texture, Texture& source_texture) {
+  VulkanTexture& vulkan_texture = static_cast<VulkanTexture&>(texture);
+  VulkanTexture& vulkan_source_texture =
+      static_cast<VulkanTexture&>(source_texture);
+
+  // Both textures will be referenced by the command buffer.
+  vulkan_texture.MarkAsUsed();
+  vulkan_source_texture.MarkAsUsed();
+  for (uint32_t i = 0; i < 2; ++i) {
+    VulkanTexture& barrier_texture = i ? vulkan_source_texture : vulkan_texture;
+    VulkanTexture::Usage new_usage =
+        i ? VulkanTexture::Usage::kTransferSource
+          : VulkanTexture::Usage::kTransferDestination;
+    VulkanTexture::Usage old_usage = barrier_texture.SetUsage(new_usage);
+    if (old_usage == new_usage) {
+      continue;
+    }
+    VkPipelineStageFlags src_stage_mask, dst_stage_mask;
+    VkAccessFlags src_access_mask, dst_access_mask;
+    VkImageLayout old_layout, new_layout;
+    GetTextureUsageMasks(old_usage, src_stage_mask, src_access_mask,
+                         old_layout);
+    GetTextureUsageMasks(new_usage, dst_stage_mask, dst_access_mask,
+                         new_layout);
+    command_processor_.PushImageMemoryBarrier(
+        barrier_texture.image(), ui::vulkan::util::InitializeSubresourceRange(),
+        src_stage_mask, dst_stage_mask, src_access_mask, dst_access_mask,
+        old_layout, new_layout);
+  }
+  command_processor_.SubmitBarriers(true);
+
+  // Textures with the same address-independent key have the same image
+  // creation parameters, so all the levels can be copied as a whole.
+  const TextureKey& texture_key = texture.key();
+  bool is_3d = texture_key.dimension == xenos::DataDimension::k3D;
+  uint32_t width = texture_key.GetWidth();
+  uint32_t height = texture_key.GetHeight();
+  uint32_t depth_or_array_size = texture_key.GetDepthOrArraySize();
+  uint32_t depth = is_3d ? depth_or_array_size : 1;
+  uint32_t array_size = is_3d ? 1 : depth_or_array_size;
+  uint32_t level_count = texture_key.mip_max_level + 1;
+  VkImageCopy* copy_regions =
+      command_processor_.deferred_command_buffer().CmdCopyImageEmplace(
+          vulkan_source_texture.image(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+          vulkan_texture.image(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+          level_count);
+  for (uint32_t level = 0; level < level_count; ++level) {
+    VkImageCopy& copy_region = copy_regions[level];
+    copy_region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    copy_region.srcSubresource.mipLevel = level;
+    copy_region.srcSubresource.baseArrayLayer = 0;
+    copy_region.srcSubresource.layerCount = array_size;
+    copy_region.srcOffset.x = 0;
+    copy_region.srcOffset.y = 0;
+    copy_region.srcOffset.z = 0;
+    copy_region.dstSubresource = copy_region.srcSubresource;
+    copy_region.dstOffset = copy_region.srcOffset;
+    copy_region.extent.width = std::max(width >> level, UINT32_C(1));
+    copy_region.extent.height = std::max(height >> level, UINT32_C(1));
+    copy_region.extent.depth = std::max(depth >> level, UINT32_C(1));
+  }
+
+  return true;
+}
+
+bool VulkanTextureCache::GetHostMemoryBudget(uint64_t& budget_out,
+                                             uint64_t& usage_out) const {
+  const ui::vulkan::VulkanProvider& provider =
+      command_processor_.GetVulkanProvider();
+  // Without VK_EXT_memory_budget, the Vulkan Memory Allocator only estimates
+  // the budget, and doesn't know about the memory not allocated through it.
+  if (!provider.device_extensions().ext_memory_budget ||
+      !provider.instance_extensions().khr_get_physical_device_properties2) {
+    return false;
+  }
+  const VkPhysicalDeviceMemoryProperties* memory_properties;
+  vmaGetMemoryProperties(vma_allocator_, &memory_properties);
+  VmaBudget heap_budgets[VK_MAX_MEMORY_HEAPS];
+  vmaGetHeapBudgets(vma_allocator_, heap_budgets);
+  budget_out = 0;
+  usage_out = 0;
+  for (uint32_t i = 0; i < memory_properties->memoryHeapCount; ++i) {
+    if (!(memory_properties->memoryHeaps[i].flags &
+          VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)) {
+      continue;
+    }
+    budget_out += heap_budgets[i].budget;
+    usage_out += heap_budgets[i].usage;
+  }
+  return budget_out != 0;
+}
+
+uint32_t VulkanTextureCache::GetStorageHostFormat(
+    const Texture& texture) const {
+  return uint32_t(GetHostFormat(texture.key()).format);
+}
+
+bool VulkanTextureCache::LoadTextureDataFromStorageImpl(Texture& texture,
+                                                        const uint8_t* data,
+                                                        size_t size) {
+  VulkanTexture& vulkan_texture = static_cast<VulkanTexture&>(texture);
+  TextureKey texture_key = vulkan_texture.key();
+  VkBufferImageCopy copy_regions_storage[xenos::kTextureMaxMips];
+  VkDeviceSize storage_size = GetStorageLayout(
+      texture_key, GetHostFormat(texture_key), copy_regions_storage);
+  if (!storage_size || storage_size != size) {
+    return false;
+  }
+
+  VulkanCommandProcessor::ScratchBufferAcquisition scratch_buffer_acquisition(
+      command_processor_.AcquireScratchGpuBuffer(
+          storage_size, VK_PIPELINE_STAGE_TRANSFER_BIT,
+          VK_ACCESS_TRANSFER_WRITE_BIT));
+  VkBuffer scratch_buffer = scratch_buffer_acquisition.buffer();
+  if (scratch_buffer == VK_NULL_HANDLE) {
+    return false;
+  }
+  command_processor_.SubmitBarriers(true);
+  DeferredCommandBuffer& command_buffer =
+      command_processor_.deferred_command_buffer();
+  uint64_t submission_current = command_processor_.GetCurrentSubmission();
+  VkDeviceSize upload_offset = 0;
+  while (upload_offset < storage_size) {
+    VkBuffer upload_buffer;
+    VkDeviceSize upload_buffer_offset, upload_buffer_size;
+    uint8_t* upload_buffer_mapping =
+        storage_upload_buffer_pool_->RequestPartial(
+            submission_current, size_t(storage_size - upload_offset), 1,
+            upload_buffer, upload_buffer_offset, upload_buffer_size);
+    if (upload_buffer_mapping == nullptr) {
+      return false;
+    }
+    std::memcpy(upload_buffer_mapping, data + upload_offset,
+                size_t(upload_buffer_size));
+    VkBufferCopy* upload_region =
+        command_buffer.CmdCopyBufferEmplace(upload_buffer, scratch_buffer, 1);
+    upload_region->srcOffset = upload_buffer_offset;
+    upload_region->dstOffset = upload_offset;
+    upload_region->size = upload_buffer_size;
+    upload_offset += upload_buffer_size;
+  }
+  storage_upload_buffer_pool_->FlushWrites();
+
+  // Submit copying from the scratch buffer to the host texture.
+  command_processor_.PushBufferMemoryBarrier(
+      scratch_buffer, 0, VK_WHOLE_SIZE,
+      scratch_buffer_acquisition.SetStageMask(VK_PIPELINE_STAGE_TRANSFER_BIT),
+      VK_PIPELINE_STAGE_TRANSFER_BIT,
+      scratch_buffer_acquisition.SetAccessMask(VK_ACCESS_TRANSFER_READ_BIT),
+      VK_ACCESS_TRANSFER_READ_BIT);
+  vulkan_texture.MarkAsUsed();
+  VulkanTexture::Usage texture_old_usage =
+      vulkan_texture.SetUsage(VulkanTexture::Usage::kTransferDestination);
+  if (texture_old_usage != VulkanTexture::Usage::kTransferDestination) {
+    VkPipelineStageFlags texture_src_stage_mask, texture_dst_stage_mask;
+    VkAccessFlags texture_src_access_mask, texture_dst_access_mask;
+    VkImageLayout texture_old_layout, texture_new_layout;
+    GetTextureUsageMasks(texture_old_usage, texture_src_stage_mask,
+                         texture_src_access_mask, texture_old_layout);
+    GetTextureUsageMasks(VulkanTexture::Usage::kTransferDestination,
+                         texture_dst_stage_mask, texture_dst_access_mask,
+                         texture_new_layout);
+    command_processor_.PushImageMemoryBarrier(
+        vulkan_texture.image(), ui::vulkan::util::InitializeSubresourceRange(),
+        texture_src_stage_mask, texture_dst_stage_mask, texture_src_access_mask,
+        texture_dst_access_mask, texture_old_layout, texture_new_layout);
+  }
+  command_processor_.SubmitBarriers(true);
+  uint32_t level_count = texture_key.mip_max_level + 1;
+  VkBufferImageCopy* copy_regions = command_buffer.CmdCopyBufferToImageEmplace(
+      scratch_buffer, vulkan_texture.image(),
+      VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, level_count);
+  std::memcpy(copy_regions, copy_regions_storage,
+              sizeof(VkBufferImageCopy) * level_count);
+
+  return true;
+}
+
+void VulkanTextureCache::ReadBackTextureDataForStorageImpl(
+    Texture& texture, uint64_t storage_key) {
+  VulkanTexture& vulkan_texture = static_cast<VulkanTexture&>(texture);
+  TextureKey texture_key = vulkan_texture.key();
+  VkBufferImageCopy copy_regions_storage[xenos::kTextureMaxMips];
+  VkDeviceSize storage_size = GetStorageLayout(
+      texture_key, GetHostFormat(texture_key), copy_regions_storage);
+  if (!storage_size) {
+    return;
+  }
+
+  StorageReadback readback;
+  if (!ui::vulkan::util::CreateDedicatedAllocationBuffer(
+          command_processor_.GetVulkanProvider(), storage_size,
+          VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+          ui::vulkan::util::MemoryPurpose::kReadback, readback.buffer,
+          readback.memory)) {
+    XELOGE("Failed to create a {} KB texture storage readback buffer",
+           storage_size >> 10);
+    return;
+  }
+
+  // The texture will be referenced by the command buffer.
+  vulkan_texture.MarkAsUsed();
+  VulkanTexture::Usage texture_old_usage =
+      vulkan_texture.SetUsage(VulkanTexture::Usage::kTransferSource);
+  if (texture_old_usage != VulkanTexture::Usage::kTransferSource) {
+    VkPipelineStageFlags texture_src_stage_mask, texture_dst_stage_mask;
+    VkAccessFlags texture_src_access_mask, texture_dst_access_mask;
+    VkImageLayout texture_old_layout, texture_new_layout;
+    GetTextureUsageMasks(texture_old_usage, texture_src_stage_mask,
+                         texture_src_access_mask, texture_old_layout);
+    GetTextureUsageMasks(VulkanTexture::Usage::kTransferSource,
+                         texture_dst_stage_mask, texture_dst_access_mask,
+                         texture_new_layout);
+    command_processor_.PushImageMemoryBarrier(
+        vulkan_texture.image(), ui::vulkan::util::InitializeSubresourceRange(),
+        texture_src_stage_mask, texture_dst_stage_mask, texture_src_access_mask,
+        texture_dst_access_mask, texture_old_layout, texture_new_layout);
+  }
+  command_processor_.SubmitBarriers(true);
+  uint32_t level_count = texture_key.mip_max_level + 1;
+  VkBufferImageCopy* copy_regions =
+      command_processor_.deferred_command_buffer().CmdCopyImageToBufferEmplace(
+          vulkan_texture.image(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+          readback.buffer, level_count);
+  std::memcpy(copy_regions, copy_regions_storage,
+              sizeof(VkBufferImageCopy) * level_count);
+  command_processor_.PushBufferMemoryBarrier(
+      readback.buffer, 0, VK_WHOLE_SIZE, VK_PIPELINE_STAGE_TRANSFER_BIT,
+      VK_PIPELINE_STAGE_HOST_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+      VK_ACCESS_HOST_READ_BIT);
+
+  readback.submission = command_processor_.GetCurrentSubmission();
+  readback.storage_key = storage_key;
+  readback.size = storage_size;
+  storage_readbacks_.push_back(readback);
+}
+
 void VulkanTextureCache::UpdateTextureBindingsImpl(
     uint32_t fetch_constant_mask) {
   uint32_t bindings_remaining = fetch_constant_mask;
@@ -2598,6 +2942,10 @@ bool VulkanTextureCache::Initialize() {
     max_anisotropy_ = xenos::AnisoFilter::kDisabled;
   }
 
+  storage_upload_buffer_pool_ =
+      std::make_unique<ui::vulkan::VulkanUploadBufferPool>(
+          provider, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
   return true;
 }
 
@@ -2614,6 +2962,68 @@ const VulkanTextureCache::HostFormatPair& VulkanTextureCache::GetHostFormatPair(
   return host_formats_[uint32_t(key.format)];
 }
 
+const VulkanTextureCache::HostFormat& VulkanTextureCache::GetHostFormat(
+    TextureKey key) const {
+  const HostFormatPair& host_format_pair = GetHostFormatPair(key);
+  bool host_format_is_signed;
+  if (IsSignedVersionSeparateForFormat(key)) {
+    host_format_is_signed = bool(key.signed_separate);
+  } else {
+    host_format_is_signed =
+        host_format_pair.format_unsigned.load_shader == kLoadShaderIndexUnknown;
+  }
+  return host_format_is_signed ? host_format_pair.format_signed
+                               : host_format_pair.format_unsigned;
+}
+
+VkDeviceSize VulkanTextureCache::GetStorageLayout(
+    TextureKey key, const HostFormat& host_format,
+    VkBufferImageCopy* regions_out) const {
+  if (host_format.load_shader == kLoadShaderIndexUnknown) {
+    return 0;
+  }
+  const LoadShaderInfo& load_shader_info =
+      GetLoadShaderInfo(host_format.load_shader);
+  const FormatInfo* guest_format_info = FormatInfo::Get(key.format);
+  uint32_t host_block_width =
+      host_format.block_compressed ? guest_format_info->block_width : 1;
+  uint32_t host_block_height =
+      host_format.block_compressed ? guest_format_info->block_height : 1;
+  bool is_3d = key.dimension == xenos::DataDimension::k3D;
+  uint32_t width = key.GetWidth();
+  uint32_t height = key.GetHeight();
+  uint32_t depth_or_array_size = key.GetDepthOrArraySize();
+  uint32_t depth = is_3d ? depth_or_array_size : 1;
+  uint32_t array_size = is_3d ? 1 : depth_or_array_size;
+  VkDeviceSize size = 0;
+  for (uint32_t level = 0; level <= key.mip_max_level; ++level) {
+    VkBufferImageCopy& region = regions_out[level];
+    region.bufferOffset = size;
+    // Tightly packed.
+    region.bufferRowLength = 0;
+    region.bufferImageHeight = 0;
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel = level;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = array_size;
+    region.imageOffset.x = 0;
+    region.imageOffset.y = 0;
+    region.imageOffset.z = 0;
+    region.imageExtent.width = std::max(width >> level, UINT32_C(1));
+    region.imageExtent.height = std::max(height >> level, UINT32_C(1));
+    region.imageExtent.depth = std::max(depth >> level, UINT32_C(1));
+    size += xe::align(
+        VkDeviceSize(load_shader_info.bytes_per_host_block) *
+            xe::align(region.imageExtent.width, host_block_width) /
+            host_block_width *
+            (xe::align(region.imageExtent.height, host_block_height) /
+             host_block_height) *
+            region.imageExtent.depth * array_size,
+        VkDeviceSize(16));
+  }
+  return size;
+}
+
 void VulkanTextureCache::GetTextureUsageMasks(VulkanTexture::Usage usage,
                                               VkPipelineStageFlags& stage_mask,
                                               VkAccessFlags& access_mask,
@@ -2629,6 +3039,11 @@ void VulkanTextureCache::GetTextureUsageMasks(VulkanTexture::Usage usage,
       access_mask = VK_ACCESS_TRANSFER_WRITE_BIT;
       layout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
       break;
+    case VulkanTexture::Usage::kTransferSource:
+      stage_mask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+      access_mask = VK_ACCESS_TRANSFER_READ_BIT;
+      layout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+      break;
     case VulkanTexture::Usage::kGuestShaderSampled:
       stage_mask = guest_shader_pipeline_stages_;
       access_mask = VK_ACCESS_SHADER_READ_BIT;
@@ -11,6 +11,7 @@
 #define XENIA_GPU_VULKAN_VULKAN_TEXTURE_CACHE_H_
 
 #include <array>
+#include <deque>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -21,6 +22,7 @@
 #include "xenia/gpu/vulkan/vulkan_shared_memory.h"
 #include "xenia/ui/vulkan/vulkan_mem_alloc.h"
 #include "xenia/ui/vulkan/vulkan_provider.h"
+#include "xenia/ui/vulkan/vulkan_upload_buffer_pool.h"
 
 namespace xe {
 namespace gpu {
@@ -82,6 +84,7 @@ class VulkanTextureCache final : public TextureCache {
 
   ~VulkanTextureCache();
 
+  void CompletedSubmissionUpdated(uint64_t completed_submission_index) override;
   void BeginSubmission(uint64_t new_submission_index) override;
 
   // Must be called within a frame - creates and untiles textures needed by
@@ -135,6 +138,18 @@ class VulkanTextureCache final : public TextureCache {
 
   bool LoadTextureDataFromResidentMemoryImpl(Texture& texture, bool load_base,
                                              bool load_mips) override;
+  bool CopyTextureDataFromDuplicateImpl(Texture& texture,
+                                        Texture& source_texture) override;
+
+  bool GetHostMemoryBudget(uint64_t& budget_out,
+                           uint64_t& usage_out) const override;
+
+  const char* GetStorageApiName() const override { return "vulkan"; }
+  uint32_t GetStorageHostFormat(const Texture& texture) const override;
+  bool LoadTextureDataFromStorageImpl(Texture& texture, const uint8_t* data,
+                                      size_t size) override;
+  void ReadBackTextureDataForStorageImpl(Texture& texture,
+                                         uint64_t storage_key) override;
 
   void UpdateTextureBindingsImpl(uint32_t fetch_constant_mask) override;
 
@@ -179,6 +194,7 @@ class VulkanTextureCache final : public TextureCache {
     enum class Usage {
       kUndefined,
       kTransferDestination,
+      kTransferSource,
       kGuestShaderSampled,
       kSwapSampled,
     };
@@ -308,6 +324,15 @@ class VulkanTextureCache final : public TextureCache {
   bool Initialize();
 
   const HostFormatPair& GetHostFormatPair(TextureKey key) const;
+  // The format of the image of the texture (signed or unsigned depending on
+  // which one the image is created for).
+  const HostFormat& GetHostFormat(TextureKey key) const;
+
+  // Writes one tightly packed region per mip level (with all array layers) of
+  // the texture in the persistent storage to regions_out, and returns the total
+  // size, or 0 if the texture can't be stored.
+  VkDeviceSize GetStorageLayout(TextureKey key, const HostFormat& host_format,
+                                VkBufferImageCopy* regions_out) const;
 
   void GetTextureUsageMasks(VulkanTexture::Usage usage,
                             VkPipelineStageFlags& stage_mask,
@@ -323,6 +348,18 @@ class VulkanTextureCache final : public TextureCache {
   // on Windows versions before 10, may have an allocation count limit as low as
   // 4096.
   VmaAllocator vma_allocator_ = VK_NULL_HANDLE;
+  // Small textures are allocated from separate pools so, being numerous and
+  // evicted at different times, they don't leave holes in the blocks used for
+  // large textures, preventing those from being reused for other large
+  // textures or freed.
+  static constexpr VkDeviceSize kSmallTextureMaxSize = 256 * 1024;
+  static constexpr VkDeviceSize kSmallTexturePoolBlockSize = 8 * 1024 * 1024;
+  // Created on demand for each memory type, VK_NULL_HANDLE if not created yet.
+  std::array<VmaPool, VK_MAX_MEMORY_TYPES> small_texture_pools_{};
+  uint32_t small_texture_pools_failed_ = 0;
+  // Returns VK_NULL_HANDLE if failed to create, so the default pool should be
+  // used.
+  VmaPool GetSmallTexturePool(uint32_t memory_type_bits);
 
   static const HostFormatPair kBestHostFormats[64];
   static const HostFormatPair kHostFormatGBGRUnaligned;
@@ -333,6 +370,19 @@ class VulkanTextureCache final : public TextureCache {
   std::array<VkPipeline, kLoadShaderCount> load_pipelines_{};
   std::array<VkPipeline, kLoadShaderCount> load_pipelines_scaled_{};
 
+  // For uploading the texture data from the persistent storage.
+  std::unique_ptr<ui::vulkan::VulkanUploadBufferPool>
+      storage_upload_buffer_pool_;
+  // Textures being copied to the CPU for the persistent storage.
+  struct StorageReadback {
+    uint64_t submission;
+    uint64_t storage_key;
+    VkBuffer buffer;
+    VkDeviceMemory memory;
+    VkDeviceSize size;
+  };
+  std::deque<StorageReadback> storage_readbacks_;
+
   // If both images can be placed in the same allocation, it's one allocation,
   // otherwise it's two separate.
   std::array<VkDeviceMemory, 2> null_images_memory_{};
@@ -11,3 +11,34 @@
 
 DEFINE_bool(guide_button, false, "Forward guide button presses to guest.",
             "HID");
+
+DEFINE_uint32(
+    hid_poll_rate, 0,
+    "Rate, in hertz, at which to sample the state of the controllers on a "
+    "separate thread, so the guest reads the latest sampled state instead of "
+    "calling the input drivers every time it polls the controllers. The "
+    "vibration requested by the guest is also applied once per poll, and the "
+    "keystrokes are collected into a queue. 0 to call the drivers directly "
+    "from the guest threads.",
+    "HID");
+
+DEFINE_path(
+    hid_record_path, "",
+    "File to record the results of the controller state and keystroke "
+    "queries made by the guest to, with the guest time of each, for replaying "
+    "them with --hid_replay_path.",
+    "HID");
+DEFINE_path(
+    hid_replay_path, "",
+    "Recording made with --hid_record_path to return the results of the "
+    "controller state and keystroke queries from instead of the input "
+    "drivers, to repeat the same gameplay segment in every run, such as for "
+    "comparing the results of --benchmark_frames across builds.",
+    "HID");
+DEFINE_bool(
+    hid_replay_lockstep, false,
+    "Advance the --hid_replay_path playback by one recorded result per guest "
+    "query instead of by the guest time, so the guest receives the same "
+    "sequence of results regardless of the timing differences between the "
+    "runs, as long as it makes the same queries.",
+    "HID");
@@ -14,4 +14,10 @@
 
 DECLARE_bool(guide_button);
 
+DECLARE_uint32(hid_poll_rate);
+
+DECLARE_path(hid_record_path);
+DECLARE_path(hid_replay_path);
+DECLARE_bool(hid_replay_lockstep);
+
 #endif  // XENIA_HID_HID_FLAGS_H_
@@ -0,0 +1,351 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/hid/input_recording.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "third_party/fmt/include/fmt/format.h"
+#include "xenia/base/assert.h"
+#include "xenia/base/clock.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+
+namespace xe {
+namespace hid {
+
+size_t InputRecording::GetStreamIndex(Query query, uint32_t user_index) {
+  uint32_t user_slot = user_index == kUserAny ? kUserSlotCount - 1 : user_index;
+  assert_true(user_slot < kUserSlotCount);
+  return size_t(query) * kUserSlotCount + user_slot;
+}
+
+std::unique_ptr<InputRecorder> InputRecorder::Create(
+    const std::filesystem::path& path) {
+  FILE* file = xe::filesystem::OpenFile(path, "wb");
+  if (!file) {
+    XELOGE("Failed to create the input recording {}", xe::path_to_utf8(path));
+    return nullptr;
+  }
+  fmt::print(file, "xenia-input-recording {} {}\n", kVersion,
+             Clock::guest_tick_frequency());
+  XELOGI("Recording the input to {}", xe::path_to_utf8(path));
+  return std::unique_ptr<InputRecorder>(new InputRecorder(file));
+}
+
+InputRecorder::InputRecorder(FILE* file)
+    : file_(file), start_guest_ticks_(Clock::QueryGuestTickCount()) {}
+
+InputRecorder::~InputRecorder() {
+  for (size_t i = 0; i < kStreamCount; ++i) {
+    if (pending_records_[i].count) {
+      WriteRecord(i, pending_records_[i]);
+    }
+  }
+  fclose(file_);
+  XELOGI("Input recording: {} queries recorded", query_count_);
+}
+
+void InputRecorder::RecordState(uint32_t user_index, X_RESULT result,
+                                const X_INPUT_STATE& state) {
+  AddQuery(Query::kState, user_index, result, &state, sizeof(state));
+}
+
+void InputRecorder::RecordKeystroke(uint32_t user_index, X_RESULT result,
+                                    const X_INPUT_KEYSTROKE& keystroke) {
+  AddQuery(Query::kKeystroke, user_index, result, &keystroke,
+           sizeof(keystroke));
+}
+
+void InputRecorder::AddQuery(Query query, uint32_t user_index,
+                             X_RESULT result, const void* data,
+                             size_t data_size) {
+  Record record;
+  record.guest_ticks = Clock::QueryGuestTickCount() - start_guest_ticks_;
+  record.count = 1;
+  record.result = result;
+  std::memset(record.data, 0, sizeof(record.data));
+  if (result == X_ERROR_SUCCESS) {
+    std::memcpy(record.data, data, data_size);
+  }
+  size_t stream_index = GetStreamIndex(query, user_index);
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++query_count_;
+  Record& pending_record = pending_records_[stream_index];
+  if (pending_record.count) {
+    if (pending_record.result == record.result &&
+        !std::memcmp(pending_record.data, record.data, sizeof(record.data)) &&
+        pending_record.count < UINT32_MAX) {
+      ++pending_record.count;
+      return;
+    }
+    WriteRecord(stream_index, pending_record);
+  }
+  pending_record = record;
+}
+
+void InputRecorder::WriteRecord(size_t stream_index,
+                                const Record& record) {
+  uint32_t user_slot = uint32_t(stream_index % kUserSlotCount);
+  uint32_t user = user_slot == kUserSlotCount - 1 ? kUserAny : user_slot;
+  if (Query(stream_index / kUserSlotCount) == Query::kState) {
+    X_INPUT_STATE state;
+    std::memcpy(&state, record.data, sizeof(state));
+    fmt::print(file_, "state {} {} {} {:X} {} {:X} {} {} {} {} {} {}\n", user,
+               record.guest_ticks, record.count, record.result,
+               uint32_t(state.packet_number), uint16_t(state.gamepad.buttons),
+               state.gamepad.left_trigger, state.gamepad.right_trigger,
+               int16_t(state.gamepad.thumb_lx), int16_t(state.gamepad.thumb_ly),
+               int16_t(state.gamepad.thumb_rx),
+               int16_t(state.gamepad.thumb_ry));
+  } else {
+    X_INPUT_KEYSTROKE keystroke;
+    std::memcpy(&keystroke, record.data, sizeof(keystroke));
+    fmt::print(file_, "keystroke {} {} {} {:X} {:X} {:X} {:X} {} {}\n", user,
+               record.guest_ticks, record.count, record.result,
+               uint16_t(keystroke.virtual_key), uint16_t(keystroke.unicode),
+               uint16_t(keystroke.flags), keystroke.user_index,
+               keystroke.hid_code);
+  }
+}
+
+std::unique_ptr<InputReplayer> InputReplayer::Create(
+    const std::filesystem::path& path, bool lockstep) {
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    XELOGE("Failed to open the input recording {}", xe::path_to_utf8(path));
+    return nullptr;
+  }
+  std::string line;
+  std::string magic;
+  uint32_t version = 0;
+  uint64_t guest_tick_frequency = 0;
+  if (std::getline(file, line)) {
+    std::istringstream(line) >> magic >> version >> guest_tick_frequency;
+  }
+  if (magic != "xenia-input-recording" || version != kVersion ||
+      !guest_tick_frequency) {
+    XELOGE("{} is not a supported input recording", xe::path_to_utf8(path));
+    return nullptr;
+  }
+  uint64_t current_guest_tick_frequency = Clock::guest_tick_frequency();
+
+  std::array<Stream, kStreamCount> streams;
+  uint32_t line_number = 1;
+  while (std::getline(file, line)) {
+    ++line_number;
+    std::istringstream tokens(line);
+    std::string query_name;
+    if (!(tokens >> query_name)) {
+      continue;
+    }
+    uint32_t user = UINT32_MAX;
+    Record record = {};
+    tokens >> user >> record.guest_ticks >> record.count >> std::hex >>
+        record.result;
+    Query query;
+    // Parsing into wider types to detect out-of-range values.
+    bool valid = user < kUserSlotCount - 1 || user == kUserAny;
+    if (query_name == "state") {
+      query = Query::kState;
+      uint32_t packet_number = 0, buttons = 0;
+      int32_t axes[6] = {};
+      tokens >> std::dec >> packet_number >> std::hex >> buttons >> std::dec;
+      for (int32_t& axis : axes) {
+        tokens >> axis;
+      }
+      valid = valid && user != kUserAny && buttons <= UINT16_MAX;
+      for (size_t i = 0; valid && i < 6; ++i) {
+        valid = i < 2 ? axes[i] >= 0 && axes[i] <= UINT8_MAX
+                      : axes[i] >= INT16_MIN && axes[i] <= INT16_MAX;
+      }
+      if (valid) {
+        X_INPUT_STATE state;
+        state.packet_number = packet_number;
+        state.gamepad.buttons = uint16_t(buttons);
+        state.gamepad.left_trigger = uint8_t(axes[0]);
+        state.gamepad.right_trigger = uint8_t(axes[1]);
+        state.gamepad.thumb_lx = int16_t(axes[2]);
+        state.gamepad.thumb_ly = int16_t(axes[3]);
+        state.gamepad.thumb_rx = int16_t(axes[4]);
+        state.gamepad.thumb_ry = int16_t(axes[5]);
+        std::memcpy(record.data, &state, sizeof(state));
+      }
+    } else if (query_name == "keystroke") {
+      query = Query::kKeystroke;
+      uint32_t virtual_key = 0, unicode = 0, flags = 0,
+               keystroke_user_index = 0, hid_code = 0;
+      tokens >> virtual_key >> unicode >> flags >> std::dec >>
+          keystroke_user_index >> hid_code;
+      valid = valid && virtual_key <= UINT16_MAX && unicode <= UINT16_MAX &&
+              flags <= UINT16_MAX && keystroke_user_index <= UINT8_MAX &&
+              hid_code <= UINT8_MAX;
+      if (valid) {
+        X_INPUT_KEYSTROKE keystroke;
+        keystroke.virtual_key = uint16_t(virtual_key);
+        keystroke.unicode = uint16_t(unicode);
+        keystroke.flags = uint16_t(flags);
+        keystroke.user_index = uint8_t(keystroke_user_index);
+        keystroke.hid_code = uint8_t(hid_code);
+        std::memcpy(record.data, &keystroke, sizeof(keystroke));
+      }
+    } else {
+      valid = false;
+    }
+    if (!valid || tokens.fail() || !record.count) {
+      XELOGE("Invalid line {} in the input recording {}", line_number,
+             xe::path_to_utf8(path));
+      return nullptr;
+    }
+    if (record.result != X_ERROR_SUCCESS) {
+      std::memset(record.data, 0, sizeof(record.data));
+    }
+    if (guest_tick_frequency != current_guest_tick_frequency) {
+      record.guest_ticks = uint64_t(double(record.guest_ticks) *
+                                    double(current_guest_tick_frequency) /
+                                    double(guest_tick_frequency));
+    }
+    streams[GetStreamIndex(query, user)].records.push_back(record);
+  }
+
+  size_t record_count = 0;
+  for (const Stream& stream : streams) {
+    record_count += stream.records.size();
+  }
+  XELOGI("Replaying {} input records from {}{}", record_count,
+         xe::path_to_utf8(path), lockstep ? " in lockstep" : "");
+  return std::unique_ptr<InputReplayer>(
+      new InputReplayer(std::move(streams), lockstep));
+}
+
+InputReplayer::InputReplayer(std::array<Stream, kStreamCount> streams,
+                             bool lockstep)
+    : lockstep_(lockstep),
+      streams_(std::move(streams)),
+      start_guest_ticks_(Clock::QueryGuestTickCount()) {}
+
+InputReplayer::~InputReplayer() {
+  // A different number of queries indicates that the guest has been querying
+  // the input differently than during the recording, such as because of
+  // timing differences, and may have received different results in the
+  // lockstep mode.
+  uint64_t recorded_query_count = 0;
+  for (const Stream& stream : streams_) {
+    for (const Record& record : stream.records) {
+      recorded_query_count += record.count;
+    }
+  }
+  XELOGI("Input replay: {} queries, {} recorded", query_count_,
+         recorded_query_count);
+}
+
+X_RESULT InputReplayer::GetState(uint32_t user_index,
+                                 X_INPUT_STATE* out_state) {
+  uint64_t guest_ticks = Clock::QueryGuestTickCount() - start_guest_ticks_;
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++query_count_;
+  Stream& stream = streams_[GetStreamIndex(Query::kState, user_index)];
+  if (stream.records.empty()) {
+    return X_ERROR_DEVICE_NOT_CONNECTED;
+  }
+  const Record* record;
+  if (lockstep_) {
+    record = ConsumeLockstepRecord(stream);
+    if (!record) {
+      // Keep the last state after the end of the recording.
+      record = &stream.records.back();
+    }
+  } else {
+    // The latest state at the time, or the first one if none has been
+    // recorded yet by this time, not to report the controller as disconnected
+    // if the guest queries it slightly earlier than during the recording.
+    while (stream.position + 1 < stream.records.size() &&
+           stream.records[stream.position + 1].guest_ticks <= guest_ticks) {
+      ++stream.position;
+    }
+    record = &stream.records[stream.position];
+  }
+  if (out_state && record->result == X_ERROR_SUCCESS) {
+    std::memcpy(out_state, record->data, sizeof(*out_state));
+  }
+  return record->result;
+}
+
+X_RESULT InputReplayer::GetKeystroke(uint32_t user_index,
+                                     X_INPUT_KEYSTROKE* out_keystroke) {
+  uint64_t guest_ticks = Clock::QueryGuestTickCount() - start_guest_ticks_;
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++query_count_;
+  Stream& stream = streams_[GetStreamIndex(Query::kKeystroke, user_index)];
+  if (stream.records.empty()) {
+    return X_ERROR_DEVICE_NOT_CONNECTED;
+  }
+  const Record* record = nullptr;
+  if (lockstep_) {
+    record = ConsumeLockstepRecord(stream);
+  } else {
+    // Every recorded keystroke is returned once, by the first query after its
+    // time, while the other results are only returned while they're current.
+    while (stream.position < stream.records.size()) {
+      const Record& position_record =
+          stream.records[stream.position];
+      if (position_record.guest_ticks > guest_ticks) {
+        break;
+      }
+      if (position_record.result == X_ERROR_SUCCESS) {
+        record = &position_record;
+        if (++stream.position_queries >= position_record.count) {
+          ++stream.position;
+          stream.position_queries = 0;
+        }
+        break;
+      }
+      if (stream.position + 1 >= stream.records.size() ||
+          stream.records[stream.position + 1].guest_ticks > guest_ticks) {
+        record = &position_record;
+        break;
+      }
+      ++stream.position;
+      stream.position_queries = 0;
+    }
+  }
+  if (!record) {
+    // No keystroke yet or anymore - whether the controller is connected based
+    // on the nearest result.
+    const Record& nearest_record =
+        stream.records[std::min(stream.position, stream.records.size() - 1)];
+    return nearest_record.result == X_ERROR_SUCCESS ? X_ERROR_EMPTY
+                                                    : nearest_record.result;
+  }
+  if (record->result == X_ERROR_SUCCESS) {
+    std::memcpy(out_keystroke, record->data, sizeof(*out_keystroke));
+  }
+  return record->result;
+}
+
+const InputRecording::Record* InputReplayer::ConsumeLockstepRecord(
+    Stream& stream) {
+  if (stream.position >= stream.records.size()) {
+    return nullptr;
+  }
+  const Record* record = &stream.records[stream.position];
+  if (++stream.position_queries >= record->count) {
+    ++stream.position;
+    stream.position_queries = 0;
+  }
+  return record;
+}
+
+}  // namespace hid
+}  // namespace xe
@@ -0,0 +1,148 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_HID_INPUT_RECORDING_H_
+#define XENIA_HID_INPUT_RECORDING_H_
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "xenia/hid/input.h"
+#include "xenia/xbox.h"
+
+namespace xe {
+namespace hid {
+
+// Recording of the results of the controller state and keystroke queries made
+// by the guest, with the guest time of each, and the playback of them, so the
+// guest receives the same input in every run, such as for comparable
+// benchmarks.
+//
+// The recording is a text file starting with a
+// "xenia-input-recording <version> <guest tick frequency>" line, followed by
+// one line per run of identical consecutive results of one kind of query for
+// one user:
+// state <user> <guest ticks> <count> <result> <packet number> <buttons>
+// <left trigger> <right trigger> <left thumb x> <left thumb y> <right thumb x>
+// <right thumb y>
+// keystroke <user> <guest ticks> <count> <result> <virtual key> <unicode>
+// <flags> <user index> <hid code>
+// The guest ticks are counted from the creation of the recorder, the user is
+// 255 for the keystroke queries for any user, and the result, the buttons, the
+// virtual key, the character and the keystroke flags are hexadecimal. The
+// lines are only ordered by the time for the same query and user.
+class InputRecording {
+ public:
+  static constexpr uint32_t kVersion = 1;
+  // The users are 0 to 3, or kUserAny for the keystroke queries for any user.
+  static constexpr uint32_t kUserAny = 0xFF;
+
+ protected:
+  enum class Query {
+    kState,
+    kKeystroke,
+  };
+
+  static constexpr uint32_t kUserSlotCount = 5;
+  static constexpr size_t kStreamCount = 2 * kUserSlotCount;
+
+  struct Record {
+    uint64_t guest_ticks;
+    // Number of consecutive queries with this result.
+    uint32_t count;
+    X_RESULT result;
+    // X_INPUT_STATE or X_INPUT_KEYSTROKE if the result is X_ERROR_SUCCESS,
+    // zeros otherwise.
+    uint64_t data[2];
+  };
+  static_assert(sizeof(Record::data) >= sizeof(X_INPUT_STATE) &&
+                sizeof(Record::data) >= sizeof(X_INPUT_KEYSTROKE));
+
+  static size_t GetStreamIndex(Query query, uint32_t user_index);
+};
+
+class InputRecorder : public InputRecording {
+ public:
+  // Returns nullptr if the file can't be created.
+  static std::unique_ptr<InputRecorder> Create(
+      const std::filesystem::path& path);
+
+  InputRecorder(const InputRecorder& recorder) = delete;
+  InputRecorder& operator=(const InputRecorder& recorder) = delete;
+  ~InputRecorder();
+
+  // Thread-safe.
+  void RecordState(uint32_t user_index, X_RESULT result,
+                   const X_INPUT_STATE& state);
+  void RecordKeystroke(uint32_t user_index, X_RESULT result,
+                       const X_INPUT_KEYSTROKE& keystroke);
+
+ private:
+  explicit InputRecorder(FILE* file);
+
+  void AddQuery(Query query, uint32_t user_index, X_RESULT result,
+                const void* data, size_t data_size);
+  void WriteRecord(size_t stream_index, const Record& record);
+
+  std::mutex mutex_;
+  FILE* file_;
+  uint64_t start_guest_ticks_;
+  // The current runs of identical results, written when a different result is
+  // recorded (empty if the count is 0).
+  std::array<Record, kStreamCount> pending_records_ = {};
+  uint64_t query_count_ = 0;
+};
+
+class InputReplayer : public InputRecording {
+ public:
+  // By default, the result recorded for the current guest time is returned.
+  // In the lockstep mode, every query returns the next recorded result
+  // instead, regardless of the time. Returns nullptr if the file can't be
+  // loaded.
+  static std::unique_ptr<InputReplayer> Create(
+      const std::filesystem::path& path, bool lockstep);
+
+  InputReplayer(const InputReplayer& replayer) = delete;
+  InputReplayer& operator=(const InputReplayer& replayer) = delete;
+  ~InputReplayer();
+
+  // Thread-safe.
+  X_RESULT GetState(uint32_t user_index, X_INPUT_STATE* out_state);
+  X_RESULT GetKeystroke(uint32_t user_index, X_INPUT_KEYSTROKE* out_keystroke);
+
+ private:
+  struct Stream {
+    std::vector<Record> records;
+    // The current record and the number of the queries it has been returned
+    // for.
+    size_t position = 0;
+    uint32_t position_queries = 0;
+  };
+
+  InputReplayer(std::array<Stream, kStreamCount> streams, bool lockstep);
+
+  // Returns the next record in the lockstep mode, or nullptr after the end.
+  const Record* ConsumeLockstepRecord(Stream& stream);
+
+  bool lockstep_;
+  std::mutex mutex_;
+  std::array<Stream, kStreamCount> streams_;
+  uint64_t start_guest_ticks_;
+  uint64_t query_count_ = 0;
+};
+
+}  // namespace hid
+}  // namespace xe
+
+#endif  // XENIA_HID_INPUT_RECORDING_H_
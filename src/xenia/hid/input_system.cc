@@ -9,6 +9,13 @@
 
 #include "xenia/hid/input_system.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "xenia/base/clock.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/math.h"
 #include "xenia/base/profiling.h"
 #include "xenia/hid/hid_flags.h"
 #include "xenia/hid/input_driver.h"
@@ -18,9 +25,63 @@ namespace hid {
 
 InputSystem::InputSystem(xe::ui::Window* window) : window_(window) {}
 
-InputSystem::~InputSystem() = default;
+InputSystem::~InputSystem() {
+  if (polling_thread_) {
+    polling_running_.store(false, std::memory_order_relaxed);
+    xe::threading::Wait(polling_thread_.get(), false);
+    polling_thread_.reset();
+    uint64_t read_count = polled_state_read_count_.load();
+    if (read_count) {
+      double ticks_to_us = 1000000.0 / double(Clock::QueryHostTickFrequency());
+      XELOGI(
+          "Input polling: {} states read, sample age average {:.1f} us, "
+          "maximum {:.1f} us",
+          read_count,
+          double(polled_state_age_ticks_total_.load()) * ticks_to_us /
+              double(read_count),
+          double(polled_state_age_ticks_max_.load()) * ticks_to_us);
+    }
+    XELOGI("Input polling: {} vibration requests, {} applied",
+           vibration_request_count_.load(), vibration_apply_count_);
+    if (keystroke_read_count_) {
+      XELOGI("Input polling: {} keystrokes read, queue age average {:.1f} us",
+             keystroke_read_count_,
+             double(keystroke_age_ticks_total_) * 1000000.0 /
+                 double(Clock::QueryHostTickFrequency()) /
+                 double(keystroke_read_count_));
+    }
+  }
+}
+
+X_STATUS InputSystem::Setup() {
+  // Starting the timelines of the recording and the replay at the same point
+  // of the emulator initialization. If the files can't be opened, using the
+  // drivers rather than failing.
+  if (!cvars::hid_replay_path.empty()) {
+    replayer_ = InputReplayer::Create(cvars::hid_replay_path,
+                                      cvars::hid_replay_lockstep);
+  } else if (!cvars::hid_record_path.empty()) {
+    recorder_ = InputRecorder::Create(cvars::hid_record_path);
+  }
 
-X_STATUS InputSystem::Setup() { return X_STATUS_SUCCESS; }
+  if (!cvars::hid_poll_rate) {
+    return X_STATUS_SUCCESS;
+  }
+  // Publish the initial states before the guest can read them.
+  PollStates();
+  polling_running_.store(true, std::memory_order_relaxed);
+  xe::threading::Thread::CreationParameters params;
+  params.stack_size = 256 * 1024;
+  params.initial_priority = xe::threading::ThreadPriority::kAboveNormal;
+  polling_thread_ =
+      xe::threading::Thread::Create(params, [this]() { PollingThread(); });
+  if (!polling_thread_) {
+    polling_running_.store(false, std::memory_order_relaxed);
+    return X_STATUS_UNSUCCESSFUL;
+  }
+  polling_thread_->set_name("Input Polling");
+  return X_STATUS_SUCCESS;
+}
 
 void InputSystem::AddDriver(std::unique_ptr<InputDriver> driver) {
   drivers_.push_back(std::move(driver));
@@ -46,6 +107,47 @@ X_RESULT InputSystem::GetCapabilities(uint32_t user_index, uint32_t flags,
 X_RESULT InputSystem::GetState(uint32_t user_index, X_INPUT_STATE* out_state) {
   SCOPE_profile_cpu_f("hid");
 
+  if (user_index < kMaxUsers) {
+    if (replayer_) {
+      return replayer_->GetState(user_index, out_state);
+    }
+    if (recorder_ && out_state) {
+      X_RESULT result = GetCurrentState(user_index, out_state);
+      recorder_->RecordState(user_index, result, *out_state);
+      return result;
+    }
+  }
+  return GetCurrentState(user_index, out_state);
+}
+
+X_RESULT InputSystem::GetCurrentState(uint32_t user_index,
+                                      X_INPUT_STATE* out_state) {
+  if (!polling_thread_ || user_index >= kMaxUsers) {
+    return GetDriverState(user_index, out_state);
+  }
+
+  X_INPUT_STATE state;
+  uint64_t host_ticks;
+  X_RESULT result = ReadPolledState(user_index, &state, &host_ticks);
+
+  uint64_t age_ticks = Clock::QueryHostTickCount() - host_ticks;
+  polled_state_read_count_.fetch_add(1, std::memory_order_relaxed);
+  polled_state_age_ticks_total_.fetch_add(age_ticks, std::memory_order_relaxed);
+  uint64_t age_ticks_max =
+      polled_state_age_ticks_max_.load(std::memory_order_relaxed);
+  while (age_ticks > age_ticks_max &&
+         !polled_state_age_ticks_max_.compare_exchange_weak(
+             age_ticks_max, age_ticks, std::memory_order_relaxed)) {
+  }
+
+  if (out_state && result == X_ERROR_SUCCESS) {
+    *out_state = state;
+  }
+  return result;
+}
+
+X_RESULT InputSystem::GetDriverState(uint32_t user_index,
+                                     X_INPUT_STATE* out_state) {
   bool any_connected = false;
   for (auto& driver : drivers_) {
     X_RESULT result = driver->GetState(user_index, out_state);
@@ -63,6 +165,26 @@ X_RESULT InputSystem::SetState(uint32_t user_index,
                                X_INPUT_VIBRATION* vibration) {
   SCOPE_profile_cpu_f("hid");
 
+  if (!polling_thread_ || user_index >= kMaxUsers) {
+    return SetDriverState(user_index, vibration);
+  }
+
+  // Only the latest vibration requested before a poll is applied, and only if
+  // it's different than the one already applied - games may update the
+  // vibration many times per frame.
+  uint64_t requested =
+      kVibrationValid |
+      (uint64_t(uint16_t(vibration->left_motor_speed)) << 16) |
+      uint64_t(uint16_t(vibration->right_motor_speed));
+  vibration_requested_[user_index].store(requested, std::memory_order_relaxed);
+  vibration_request_count_.fetch_add(1, std::memory_order_relaxed);
+  X_RESULT state_result = ReadPolledState(user_index);
+  return state_result == X_ERROR_DEVICE_NOT_CONNECTED ? state_result
+                                                      : X_ERROR_SUCCESS;
+}
+
+X_RESULT InputSystem::SetDriverState(uint32_t user_index,
+                                     X_INPUT_VIBRATION* vibration) {
   bool any_connected = false;
   for (auto& driver : drivers_) {
     X_RESULT result = driver->SetState(user_index, vibration);
@@ -80,6 +202,56 @@ X_RESULT InputSystem::GetKeystroke(uint32_t user_index, uint32_t flags,
                                    X_INPUT_KEYSTROKE* out_keystroke) {
   SCOPE_profile_cpu_f("hid");
 
+  bool user_any = (user_index & 0xFF) == 0xFF;
+  if (user_any || user_index < kMaxUsers) {
+    uint32_t recording_user_index =
+        user_any ? InputRecording::kUserAny : user_index;
+    if (replayer_) {
+      return replayer_->GetKeystroke(recording_user_index, out_keystroke);
+    }
+    if (recorder_) {
+      X_RESULT result = GetCurrentKeystroke(user_index, flags, out_keystroke);
+      recorder_->RecordKeystroke(recording_user_index, result, *out_keystroke);
+      return result;
+    }
+  }
+  return GetCurrentKeystroke(user_index, flags, out_keystroke);
+}
+
+X_RESULT InputSystem::GetCurrentKeystroke(uint32_t user_index, uint32_t flags,
+                                          X_INPUT_KEYSTROKE* out_keystroke) {
+  bool user_any = (user_index & 0xFF) == 0xFF;
+  if (!polling_thread_ || (!user_any && user_index >= kMaxUsers)) {
+    return GetDriverKeystroke(user_index, flags, out_keystroke);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(keystrokes_mutex_);
+    for (auto it = keystrokes_.begin(); it != keystrokes_.end(); ++it) {
+      if (!user_any && it->keystroke.user_index != user_index) {
+        continue;
+      }
+      *out_keystroke = it->keystroke;
+      ++keystroke_read_count_;
+      keystroke_age_ticks_total_ +=
+          Clock::QueryHostTickCount() - it->host_ticks;
+      keystrokes_.erase(it);
+      return X_ERROR_SUCCESS;
+    }
+  }
+
+  bool any_connected = false;
+  for (uint32_t i = user_any ? 0 : user_index;
+       i < (user_any ? kMaxUsers : user_index + 1); ++i) {
+    if (ReadPolledState(i) != X_ERROR_DEVICE_NOT_CONNECTED) {
+      any_connected = true;
+    }
+  }
+  return any_connected ? X_ERROR_EMPTY : X_ERROR_DEVICE_NOT_CONNECTED;
+}
+
+X_RESULT InputSystem::GetDriverKeystroke(uint32_t user_index, uint32_t flags,
+                                         X_INPUT_KEYSTROKE* out_keystroke) {
   bool any_connected = false;
   for (auto& driver : drivers_) {
     X_RESULT result = driver->GetKeystroke(user_index, flags, out_keystroke);
@@ -93,5 +265,125 @@ X_RESULT InputSystem::GetKeystroke(uint32_t user_index, uint32_t flags,
   return any_connected ? X_ERROR_EMPTY : X_ERROR_DEVICE_NOT_CONNECTED;
 }
 
+X_RESULT InputSystem::ReadPolledState(uint32_t user_index,
+                                      X_INPUT_STATE* out_state,
+                                      uint64_t* out_host_ticks) const {
+  const PolledState& polled_state = polled_states_[user_index];
+  uint64_t words[4];
+  while (true) {
+    uint32_t sequence = polled_state.sequence.load(std::memory_order_acquire);
+    if (sequence & 1) {
+      xe::threading::MaybeYield();
+      continue;
+    }
+    for (size_t i = 0; i < xe::countof(words); ++i) {
+      words[i] = polled_state.words[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (polled_state.sequence.load(std::memory_order_relaxed) == sequence) {
+      break;
+    }
+  }
+  if (out_state) {
+    std::memcpy(out_state, words, sizeof(X_INPUT_STATE));
+  }
+  if (out_host_ticks) {
+    *out_host_ticks = words[3];
+  }
+  return X_RESULT(words[2]);
+}
+
+void InputSystem::PollStates() {
+  SCOPE_profile_cpu_f("hid");
+
+  for (uint32_t i = 0; i < kMaxUsers; ++i) {
+    X_INPUT_STATE state = {};
+    X_RESULT result = GetDriverState(i, &state);
+    uint64_t words[4] = {};
+    std::memcpy(words, &state, sizeof(state));
+    words[2] = result;
+    words[3] = Clock::QueryHostTickCount();
+    // Only written by one thread at a time - by Setup before the polling
+    // thread is started, and then by the polling thread.
+    PolledState& polled_state = polled_states_[i];
+    uint32_t sequence = polled_state.sequence.load(std::memory_order_relaxed);
+    polled_state.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t j = 0; j < xe::countof(words); ++j) {
+      polled_state.words[j].store(words[j], std::memory_order_relaxed);
+    }
+    polled_state.sequence.store(sequence + 2, std::memory_order_release);
+  }
+}
+
+void InputSystem::ApplyVibrations() {
+  SCOPE_profile_cpu_f("hid");
+
+  for (uint32_t i = 0; i < kMaxUsers; ++i) {
+    if (ReadPolledState(i) != X_ERROR_SUCCESS) {
+      // Apply the vibration again when the controller is reconnected.
+      vibration_applied_[i] = 0;
+      continue;
+    }
+    uint64_t requested =
+        vibration_requested_[i].load(std::memory_order_relaxed);
+    if (!requested || requested == vibration_applied_[i]) {
+      continue;
+    }
+    X_INPUT_VIBRATION vibration;
+    vibration.left_motor_speed = uint16_t(requested >> 16);
+    vibration.right_motor_speed = uint16_t(requested);
+    ++vibration_apply_count_;
+    if (SetDriverState(i, &vibration) == X_ERROR_SUCCESS) {
+      vibration_applied_[i] = requested;
+    }
+  }
+}
+
+void InputSystem::PollKeystrokes() {
+  SCOPE_profile_cpu_f("hid");
+
+  // The drivers may keep generating repeat keystrokes, so limit the number of
+  // the keystrokes received from a user's controller in one poll.
+  static constexpr uint32_t kMaxKeystrokesPerPoll = 16;
+  for (uint32_t i = 0; i < kMaxUsers; ++i) {
+    for (uint32_t j = 0; j < kMaxKeystrokesPerPoll; ++j) {
+      QueuedKeystroke queued_keystroke;
+      if (GetDriverKeystroke(i, 0, &queued_keystroke.keystroke) !=
+          X_ERROR_SUCCESS) {
+        break;
+      }
+      queued_keystroke.host_ticks = Clock::QueryHostTickCount();
+      std::lock_guard<std::mutex> lock(keystrokes_mutex_);
+      if (keystrokes_.size() >= kMaxQueuedKeystrokes) {
+        keystrokes_.pop_front();
+      }
+      keystrokes_.push_back(queued_keystroke);
+    }
+  }
+}
+
+void InputSystem::PollingThread() {
+  using Clock = std::chrono::steady_clock;
+  // Sleeping rather than waiting for a shutdown event because waits have a
+  // granularity of milliseconds, too coarse for high polling rates.
+  const Clock::duration interval =
+      std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(
+          1.0 / double(std::min(cvars::hid_poll_rate, uint32_t(8000)))));
+  Clock::time_point next_poll_time = Clock::now() + interval;
+  while (polling_running_.load(std::memory_order_relaxed)) {
+    Clock::time_point now = Clock::now();
+    if (next_poll_time > now) {
+      xe::threading::Sleep(next_poll_time - now);
+    }
+    PollStates();
+    ApplyVibrations();
+    PollKeystrokes();
+    // Don't try to catch up with the missed polls, for instance, if the thread
+    // has been suspended by the debugger.
+    next_poll_time = std::max(next_poll_time + interval, Clock::now());
+  }
+}
+
 }  // namespace hid
 }  // namespace xe
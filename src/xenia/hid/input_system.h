@@ -10,11 +10,18 @@
 #ifndef XENIA_HID_INPUT_SYSTEM_H_
 #define XENIA_HID_INPUT_SYSTEM_H_
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <vector>
 
+#include "xenia/base/threading.h"
 #include "xenia/hid/input.h"
 #include "xenia/hid/input_driver.h"
+#include "xenia/hid/input_recording.h"
 #include "xenia/xbox.h"
 
 namespace xe {
@@ -28,11 +35,19 @@ namespace hid {
 
 class InputSystem {
  public:
+  static constexpr uint32_t kMaxUsers = 4;
+
   explicit InputSystem(xe::ui::Window* window);
   ~InputSystem();
 
   xe::ui::Window* window() const { return window_; }
 
+  // Must be called after adding the drivers. Starts sampling the state of
+  // the controllers on a separate thread if --hid_poll_rate is not 0. The
+  // thread also applies the latest vibration requested for every user once
+  // per poll, and collects the keystrokes from the drivers into a queue.
+  // Also starts recording or replaying the input with --hid_record_path or
+  // --hid_replay_path.
   X_STATUS Setup();
 
   void AddDriver(std::unique_ptr<InputDriver> driver);
@@ -45,9 +60,77 @@ class InputSystem {
                         X_INPUT_KEYSTROKE* out_keystroke);
 
  private:
+  // The latest state of a user's controller sampled by the polling thread,
+  // published with a sequence lock so the guest threads can read it without
+  // waiting for the polling thread or calling the drivers. The sequence is odd
+  // while the state is being written.
+  struct PolledState {
+    std::atomic<uint32_t> sequence{0};
+    // X_INPUT_STATE (16 bytes), the X_RESULT of the driver GetState call, and
+    // the host tick count when the state was sampled.
+    std::atomic<uint64_t> words[4] = {};
+  };
+  static_assert(sizeof(X_INPUT_STATE) == sizeof(uint64_t) * 2);
+
+  struct QueuedKeystroke {
+    X_INPUT_KEYSTROKE keystroke;
+    // Host tick count when the keystroke was received from the driver.
+    uint64_t host_ticks;
+  };
+  // Older keystrokes are dropped if the guest doesn't read them.
+  static constexpr size_t kMaxQueuedKeystrokes = 64;
+
+  // Requested vibration, with the motor speeds in bits 0:15 (right) and 16:31
+  // (left), and kVibrationValid set if the guest has requested any.
+  static constexpr uint64_t kVibrationValid = uint64_t(1) << 32;
+
+  // The state or the keystroke from the polling thread or the drivers, without
+  // the recording and the replay.
+  X_RESULT GetCurrentState(uint32_t user_index, X_INPUT_STATE* out_state);
+  X_RESULT GetCurrentKeystroke(uint32_t user_index, uint32_t flags,
+                               X_INPUT_KEYSTROKE* out_keystroke);
+  X_RESULT GetDriverState(uint32_t user_index, X_INPUT_STATE* out_state);
+  X_RESULT SetDriverState(uint32_t user_index, X_INPUT_VIBRATION* vibration);
+  X_RESULT GetDriverKeystroke(uint32_t user_index, uint32_t flags,
+                              X_INPUT_KEYSTROKE* out_keystroke);
+  // Returns the X_RESULT of the latest sampled state, and optionally the state
+  // itself and its host tick count.
+  X_RESULT ReadPolledState(uint32_t user_index,
+                           X_INPUT_STATE* out_state = nullptr,
+                           uint64_t* out_host_ticks = nullptr) const;
+  void PollStates();
+  void ApplyVibrations();
+  void PollKeystrokes();
+  void PollingThread();
+
   xe::ui::Window* window_ = nullptr;
 
   std::vector<std::unique_ptr<InputDriver>> drivers_;
+
+  std::unique_ptr<InputRecorder> recorder_;
+  std::unique_ptr<InputReplayer> replayer_;
+
+  std::array<PolledState, kMaxUsers> polled_states_;
+  std::atomic<bool> polling_running_{false};
+  std::unique_ptr<xe::threading::Thread> polling_thread_;
+  // For the latency statistics logged on shutdown - the age of the sampled
+  // states when the guest reads them.
+  std::atomic<uint64_t> polled_state_read_count_{0};
+  std::atomic<uint64_t> polled_state_age_ticks_total_{0};
+  std::atomic<uint64_t> polled_state_age_ticks_max_{0};
+
+  // Vibration requested by the guest, and the last vibration applied by the
+  // polling thread (only accessed by it, 0 if not applied or if the controller
+  // has been disconnected since it was applied).
+  std::array<std::atomic<uint64_t>, kMaxUsers> vibration_requested_ = {};
+  std::array<uint64_t, kMaxUsers> vibration_applied_ = {};
+  std::atomic<uint64_t> vibration_request_count_{0};
+  uint64_t vibration_apply_count_ = 0;
+
+  std::mutex keystrokes_mutex_;
+  std::deque<QueuedKeystroke> keystrokes_;
+  uint64_t keystroke_read_count_ = 0;
+  uint64_t keystroke_age_ticks_total_ = 0;
 };
 
 }  // namespace hid
@@ -0,0 +1,211 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/hid/scripted_input_driver.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "xenia/base/clock.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/utf8.h"
+#include "xenia/hid/input.h"
+
+namespace xe {
+namespace hid {
+
+namespace {
+
+bool ParseButtons(const std::string_view buttons, uint16_t& buttons_out) {
+  static const std::pair<std::string_view, uint16_t> kButtonNames[] = {
+      {"up", X_INPUT_GAMEPAD_DPAD_UP},
+      {"down", X_INPUT_GAMEPAD_DPAD_DOWN},
+      {"left", X_INPUT_GAMEPAD_DPAD_LEFT},
+      {"right", X_INPUT_GAMEPAD_DPAD_RIGHT},
+      {"start", X_INPUT_GAMEPAD_START},
+      {"back", X_INPUT_GAMEPAD_BACK},
+      {"ls", X_INPUT_GAMEPAD_LEFT_THUMB},
+      {"rs", X_INPUT_GAMEPAD_RIGHT_THUMB},
+      {"lb", X_INPUT_GAMEPAD_LEFT_SHOULDER},
+      {"rb", X_INPUT_GAMEPAD_RIGHT_SHOULDER},
+      {"guide", X_INPUT_GAMEPAD_GUIDE},
+      {"a", X_INPUT_GAMEPAD_A},
+      {"b", X_INPUT_GAMEPAD_B},
+      {"x", X_INPUT_GAMEPAD_X},
+      {"y", X_INPUT_GAMEPAD_Y},
+  };
+  buttons_out = 0;
+  if (buttons == "-") {
+    return true;
+  }
+  for (std::string_view button : xe::utf8::split(buttons, "+")) {
+    auto it = std::find_if(
+        std::begin(kButtonNames), std::end(kButtonNames),
+        [button](const std::pair<std::string_view, uint16_t>& name) {
+          return xe::utf8::equal_case(name.first, button);
+        });
+    if (it == std::end(kButtonNames)) {
+      return false;
+    }
+    buttons_out |= it->second;
+  }
+  return true;
+}
+
+}  // namespace
+
+std::unique_ptr<ScriptedInputDriver> ScriptedInputDriver::Create(
+    xe::ui::Window* window, size_t window_z_order,
+    const std::filesystem::path& script_path) {
+  std::ifstream script_file(script_path);
+  if (!script_file.is_open()) {
+    XELOGE("Failed to open the input script {}",
+           xe::path_to_utf8(script_path));
+    return nullptr;
+  }
+  std::vector<Event> events;
+  std::string line;
+  uint32_t line_number = 0;
+  while (std::getline(script_file, line)) {
+    ++line_number;
+    std::istringstream tokens(line);
+    std::string time_token, buttons_token;
+    if (!(tokens >> time_token) || time_token[0] == '#') {
+      continue;
+    }
+    tokens >> buttons_token;
+    std::vector<int64_t> axes;
+    int64_t axis;
+    while (tokens >> axis) {
+      axes.push_back(axis);
+    }
+    Event event = {};
+    char* time_token_end;
+    event.time_ms = std::strtoull(time_token.c_str(), &time_token_end, 10);
+    uint16_t buttons;
+    // Only the numbers may follow the buttons.
+    bool valid = std::isdigit(uint8_t(time_token[0])) && !*time_token_end &&
+                 ParseButtons(buttons_token, buttons) && tokens.eof() &&
+                 (axes.empty() || axes.size() == 6);
+    for (size_t i = 0; valid && i < axes.size(); ++i) {
+      valid = i < 2 ? axes[i] >= 0 && axes[i] <= UINT8_MAX
+                    : axes[i] >= INT16_MIN && axes[i] <= INT16_MAX;
+    }
+    if (!valid) {
+      XELOGE("Invalid line {} in the input script {}", line_number,
+             xe::path_to_utf8(script_path));
+      return nullptr;
+    }
+    event.gamepad.buttons = buttons;
+    if (!axes.empty()) {
+      event.gamepad.left_trigger = uint8_t(axes[0]);
+      event.gamepad.right_trigger = uint8_t(axes[1]);
+      event.gamepad.thumb_lx = int16_t(axes[2]);
+      event.gamepad.thumb_ly = int16_t(axes[3]);
+      event.gamepad.thumb_rx = int16_t(axes[4]);
+      event.gamepad.thumb_ry = int16_t(axes[5]);
+    }
+    events.push_back(event);
+  }
+  std::stable_sort(events.begin(), events.end(),
+                   [](const Event& a, const Event& b) {
+                     return a.time_ms < b.time_ms;
+                   });
+  XELOGI("Loaded {} input states from the script {}", events.size(),
+         xe::path_to_utf8(script_path));
+  return std::unique_ptr<ScriptedInputDriver>(
+      new ScriptedInputDriver(window, window_z_order, std::move(events)));
+}
+
+ScriptedInputDriver::ScriptedInputDriver(xe::ui::Window* window,
+                                         size_t window_z_order,
+                                         std::vector<Event> events)
+    : InputDriver(window, window_z_order), events_(std::move(events)) {}
+
+X_STATUS ScriptedInputDriver::Setup() { return X_STATUS_SUCCESS; }
+
+void ScriptedInputDriver::Start() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  start_time_ms_ = Clock::QueryHostUptimeMillis();
+  current_event_ = 0;
+}
+
+X_RESULT ScriptedInputDriver::GetCapabilities(uint32_t user_index,
+                                              uint32_t flags,
+                                              X_INPUT_CAPABILITIES* out_caps) {
+  if (user_index) {
+    return X_ERROR_DEVICE_NOT_CONNECTED;
+  }
+  if (!out_caps) {
+    return X_ERROR_BAD_ARGUMENTS;
+  }
+  std::memset(out_caps, 0, sizeof(*out_caps));
+  out_caps->type = 0x01;      // XINPUT_DEVTYPE_GAMEPAD
+  out_caps->sub_type = 0x01;  // XINPUT_DEVSUBTYPE_GAMEPAD
+  out_caps->gamepad.buttons = 0xF7FF;
+  out_caps->gamepad.left_trigger = 0xFF;
+  out_caps->gamepad.right_trigger = 0xFF;
+  out_caps->gamepad.thumb_lx = static_cast<int16_t>(0xFFFFu);
+  out_caps->gamepad.thumb_ly = static_cast<int16_t>(0xFFFFu);
+  out_caps->gamepad.thumb_rx = static_cast<int16_t>(0xFFFFu);
+  out_caps->gamepad.thumb_ry = static_cast<int16_t>(0xFFFFu);
+  return X_ERROR_SUCCESS;
+}
+
+X_RESULT ScriptedInputDriver::GetState(uint32_t user_index,
+                                       X_INPUT_STATE* out_state) {
+  if (user_index) {
+    return X_ERROR_DEVICE_NOT_CONNECTED;
+  }
+  uint64_t now_ms = Clock::QueryHostUptimeMillis();
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t previous_event = current_event_;
+  if (start_time_ms_ != UINT64_MAX) {
+    uint64_t time_ms = now_ms - std::min(start_time_ms_, now_ms);
+    while (current_event_ < events_.size() &&
+           events_[current_event_].time_ms <= time_ms) {
+      ++current_event_;
+    }
+  }
+  if (current_event_ != previous_event) {
+    ++packet_number_;
+  }
+  if (out_state) {
+    out_state->packet_number = packet_number_;
+    if (current_event_) {
+      out_state->gamepad = events_[current_event_ - 1].gamepad;
+    } else {
+      std::memset(&out_state->gamepad, 0, sizeof(out_state->gamepad));
+    }
+  }
+  return X_ERROR_SUCCESS;
+}
+
+X_RESULT ScriptedInputDriver::SetState(uint32_t user_index,
+                                       X_INPUT_VIBRATION* vibration) {
+  return user_index ? X_ERROR_DEVICE_NOT_CONNECTED : X_ERROR_SUCCESS;
+}
+
+X_RESULT ScriptedInputDriver::GetKeystroke(uint32_t user_index, uint32_t flags,
+                                           X_INPUT_KEYSTROKE* out_keystroke) {
+  return user_index && (user_index & 0xFF) != 0xFF
+             ? X_ERROR_DEVICE_NOT_CONNECTED
+             : X_ERROR_EMPTY;
+}
+
+}  // namespace hid
+}  // namespace xe
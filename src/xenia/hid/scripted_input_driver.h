@@ -0,0 +1,79 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_HID_SCRIPTED_INPUT_DRIVER_H_
+#define XENIA_HID_SCRIPTED_INPUT_DRIVER_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "xenia/hid/input_driver.h"
+
+namespace xe {
+namespace hid {
+
+// Plays back a predefined sequence of gamepad states as the controller of the
+// first user, for reproducible automated runs such as benchmarks.
+//
+// The script is a text file with one state per line:
+// <milliseconds> <buttons> [<left trigger> <right trigger> <left thumb x>
+// <left thumb y> <right thumb x> <right thumb y>]
+// The time is counted from the call of Start, and the state stays until the
+// time of the next line. The buttons are "-" for none,
+// or a "+"-separated list of up, down, left, right, start, back, ls, rs, lb,
+// rb, guide, a, b, x and y. The triggers are 0 to 255, the thumbsticks are
+// -32768 to 32767. Empty lines and lines starting with # are ignored.
+//
+// Keystrokes aren't generated from the states.
+class ScriptedInputDriver final : public InputDriver {
+ public:
+  // Returns nullptr if the script can't be loaded.
+  static std::unique_ptr<ScriptedInputDriver> Create(
+      xe::ui::Window* window, size_t window_z_order,
+      const std::filesystem::path& script_path);
+
+  X_STATUS Setup() override;
+
+  // Starts playing the script back from the beginning. Until the first call,
+  // the controller is connected, but in the neutral state. Thread-safe.
+  void Start();
+
+  X_RESULT GetCapabilities(uint32_t user_index, uint32_t flags,
+                           X_INPUT_CAPABILITIES* out_caps) override;
+  X_RESULT GetState(uint32_t user_index, X_INPUT_STATE* out_state) override;
+  X_RESULT SetState(uint32_t user_index, X_INPUT_VIBRATION* vibration) override;
+  X_RESULT GetKeystroke(uint32_t user_index, uint32_t flags,
+                        X_INPUT_KEYSTROKE* out_keystroke) override;
+
+ private:
+  struct Event {
+    uint64_t time_ms;
+    X_INPUT_GAMEPAD gamepad;
+  };
+
+  ScriptedInputDriver(xe::ui::Window* window, size_t window_z_order,
+                      std::vector<Event> events);
+
+  // Sorted by the time.
+  std::vector<Event> events_;
+
+  std::mutex mutex_;
+  // UINT64_MAX before the playback has been started.
+  uint64_t start_time_ms_ = UINT64_MAX;
+  size_t current_event_ = 0;
+  uint32_t packet_number_ = 0;
+};
+
+}  // namespace hid
+}  // namespace xe
+
+#endif  // XENIA_HID_SCRIPTED_INPUT_DRIVER_H_
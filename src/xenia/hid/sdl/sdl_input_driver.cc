@@ -699,15 +699,9 @@ void SDLInputDriver::UpdateXCapabilities(ControllerState& state) {
 
 void SDLInputDriver::QueueControllerUpdate() {
   // To minimize consecutive event pumps do not queue before previous pump is
-  // finished.
-  bool is_queued = false;
-  sdl_pumpevents_queued_.compare_exchange_strong(is_queued, true);
-  if (!is_queued) {
-    window()->app_context().CallInUIThread([this]() {
-      SDL_PumpEvents();
-      sdl_pumpevents_queued_ = false;
-    });
-  }
+  // started.
+  window()->app_context().CallInUIThreadCoalesced(sdl_pumpevents_queued_,
+                                                  []() { SDL_PumpEvents(); });
 }
 
 // Check if the analog inputs exceed their thresholds to become a button press
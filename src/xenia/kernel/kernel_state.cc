@@ -9,6 +9,7 @@
 
 #include "xenia/kernel/kernel_state.h"
 
+#include <algorithm>
 #include <string>
 
 #include "third_party/fmt/include/fmt/format.h"
@@ -19,6 +20,7 @@
 #include "xenia/cpu/processor.h"
 #include "xenia/emulator.h"
 #include "xenia/kernel/user_module.h"
+#include "xenia/kernel/util/kernel_call_profiler.h"
 #include "xenia/kernel/util/shim_utils.h"
 #include "xenia/kernel/xam/xam_module.h"
 #include "xenia/kernel/xboxkrnl/xboxkrnl_module.h"
@@ -43,8 +45,7 @@ KernelState* kernel_state() { return shared_kernel_state_; }
 KernelState::KernelState(Emulator* emulator)
     : emulator_(emulator),
       memory_(emulator->memory()),
-      dispatch_thread_running_(false),
-      dpc_list_(emulator->memory()) {
+      dispatch_thread_running_(false) {
   processor_ = emulator->processor();
   file_system_ = emulator->file_system();
 
@@ -60,6 +61,9 @@ KernelState::KernelState(Emulator* emulator)
   assert_null(shared_kernel_state_);
   shared_kernel_state_ = this;
 
+  host_processor_map_.Initialize(memory_->host_numa_node());
+  idle_time_skipper_.Initialize();
+
   // Hardcoded maximum of 2048 TLS slots.
   tls_bitmap_.Resize(2048);
 
@@ -69,12 +73,29 @@ KernelState::KernelState(Emulator* emulator)
 KernelState::~KernelState() {
   SetExecutableModule(nullptr);
 
+  {
+    std::lock_guard<std::mutex> lock(dpc_mutex_);
+    dpc_shutting_down_ = true;
+  }
+  for (DpcProcessor& dpc_processor : dpc_processors_) {
+    if (dpc_processor.thread) {
+      dpc_processor.dpc_queued.notify_all();
+      dpc_processor.thread->Wait(0, 0, 0, nullptr);
+    }
+  }
+
   if (dispatch_thread_running_) {
     dispatch_thread_running_ = false;
     dispatch_cond_.notify_all();
     dispatch_thread_->Wait(0, 0, 0, nullptr);
   }
 
+  io_thread_pool_.Shutdown();
+
+  if (util::KernelCallProfiler::is_enabled()) {
+    util::KernelCallProfiler::Dump();
+  }
+
   executable_module_.reset();
   user_modules_.clear();
   kernel_modules_.clear();
@@ -591,6 +612,40 @@ void KernelState::UnregisterThread(XThread* thread) {
   */
 }
 
+bool KernelState::AcquirePooledThreadStack(uint32_t alloc_size,
+                                           uint32_t& alloc_base_out) {
+  std::lock_guard<std::mutex> lock(thread_stack_pool_mutex_);
+  // Taking the most recently released stack, which is the most likely to
+  // still be resident in the host caches and memory.
+  for (auto it = thread_stack_pool_.rbegin(); it != thread_stack_pool_.rend();
+       ++it) {
+    if (it->alloc_size == alloc_size) {
+      alloc_base_out = it->alloc_base;
+      thread_stack_pool_.erase(std::next(it).base());
+      return true;
+    }
+  }
+  return false;
+}
+
+bool KernelState::ReleaseThreadStackToPool(uint32_t alloc_base,
+                                           uint32_t alloc_size) {
+  std::lock_guard<std::mutex> lock(thread_stack_pool_mutex_);
+  if (thread_stack_pool_.size() >= kThreadStackPoolMaxSize) {
+    return false;
+  }
+  thread_stack_pool_.push_back({alloc_base, alloc_size});
+  return true;
+}
+
+void KernelState::ReleaseThreadStackPool() {
+  std::lock_guard<std::mutex> lock(thread_stack_pool_mutex_);
+  for (const PooledThreadStack& stack : thread_stack_pool_) {
+    memory_->LookupHeap(stack.alloc_base)->Release(stack.alloc_base);
+  }
+  thread_stack_pool_.clear();
+}
+
 void KernelState::OnThreadExecute(XThread* thread) {
   auto global_lock = global_critical_region_.Acquire();
 
@@ -689,6 +744,87 @@ void KernelState::BroadcastNotification(XNotificationID id, uint32_t data) {
   }
 }
 
+bool KernelState::InsertQueueDpc(uint32_t dpc_ptr, uint32_t arg1,
+                                 uint32_t arg2) {
+  uint32_t processor = 0;
+  if (XThread::IsInThread()) {
+    processor = XThread::GetCurrentThread()->active_cpu() % kDpcProcessorCount;
+  }
+
+  std::unique_lock<std::mutex> lock(dpc_mutex_);
+  if (dpc_shutting_down_ ||
+      !queued_dpc_processors_.emplace(dpc_ptr, processor).second) {
+    return false;
+  }
+  auto dpc = memory()->TranslateVirtual<XDPC*>(dpc_ptr);
+  dpc->arg1 = arg1;
+  dpc->arg2 = arg2;
+  DpcProcessor& dpc_processor = dpc_processors_[processor];
+  dpc_processor.dpcs.push_back(dpc_ptr);
+  if (!dpc_processor.thread) {
+    dpc_processor.thread = object_ref<XHostThread>(new XHostThread(
+        this, 128 * 1024, 0,
+        [this, processor]() { return DpcThreadMain(processor); }));
+    dpc_processor.thread->set_name(fmt::format("DPC {}", processor));
+    dpc_processor.thread->Create();
+  }
+  lock.unlock();
+  dpc_processor.dpc_queued.notify_one();
+  return true;
+}
+
+bool KernelState::RemoveQueueDpc(uint32_t dpc_ptr) {
+  std::lock_guard<std::mutex> lock(dpc_mutex_);
+  auto it = queued_dpc_processors_.find(dpc_ptr);
+  if (it == queued_dpc_processors_.end()) {
+    return false;
+  }
+  std::deque<uint32_t>& dpcs = dpc_processors_[it->second].dpcs;
+  auto dpc_it = std::find(dpcs.begin(), dpcs.end(), dpc_ptr);
+  assert_true(dpc_it != dpcs.end());
+  dpcs.erase(dpc_it);
+  queued_dpc_processors_.erase(it);
+  return true;
+}
+
+int KernelState::DpcThreadMain(uint32_t processor) {
+  XThread* thread = XThread::GetCurrentThread();
+  // As we run guest callbacks the debugger must be able to suspend us.
+  thread->set_can_debugger_suspend(true);
+  thread->SetActiveCpu(uint8_t(processor));
+  // Sharing the host processors with the guest threads of the processor, as
+  // the DPCs would preempt them on the console.
+  if (host_processor_map_.is_enabled()) {
+    thread->thread()->set_affinity_mask(
+        host_processor_map_.GetGuestThreadAffinity(processor));
+  }
+  thread->RaiseIrql(uint32_t(cpu::Irql::DPC));
+
+  DpcProcessor& dpc_processor = dpc_processors_[processor];
+  std::unique_lock<std::mutex> lock(dpc_mutex_);
+  while (true) {
+    dpc_processor.dpc_queued.wait(lock, [this, &dpc_processor] {
+      return dpc_shutting_down_ || !dpc_processor.dpcs.empty();
+    });
+    if (dpc_shutting_down_) {
+      break;
+    }
+    uint32_t dpc_ptr = dpc_processor.dpcs.front();
+    dpc_processor.dpcs.pop_front();
+    // Dequeued before calling, so the routine can queue the DPC again.
+    queued_dpc_processors_.erase(dpc_ptr);
+    auto dpc = memory()->TranslateVirtual<const XDPC*>(dpc_ptr);
+    uint32_t routine = dpc->routine;
+    // routine(dpc, context, arg1, arg2)
+    uint64_t args[] = {dpc_ptr, dpc->context, dpc->arg1, dpc->arg2};
+    lock.unlock();
+    processor_->Execute(thread->thread_state(), routine, args,
+                        xe::countof(args));
+    lock.lock();
+  }
+  return 0;
+}
+
 void KernelState::CompleteOverlapped(uint32_t overlapped_ptr, X_RESULT result) {
   CompleteOverlappedEx(overlapped_ptr, result, result, 0);
 }
@@ -803,6 +939,13 @@ bool KernelState::Save(ByteStream* stream) {
   XELOGD("Serializing the kernel...");
   stream->Write(kKernelSaveSignature);
 
+  // The asynchronous I/O requests are not saved, complete them instead.
+  io_thread_pool_.WaitForIdle();
+
+  // The pool is not saved, so its stacks would be leaked in the restored
+  // memory.
+  ReleaseThreadStackPool();
+
   // Save the object table
   object_table_.Save(stream);
 
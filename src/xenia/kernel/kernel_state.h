@@ -10,18 +10,24 @@
 #ifndef XENIA_KERNEL_KERNEL_STATE_H_
 #define XENIA_KERNEL_KERNEL_STATE_H_
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "xenia/base/bit_map.h"
 #include "xenia/base/cvar.h"
 #include "xenia/base/mutex.h"
 #include "xenia/cpu/export_resolver.h"
-#include "xenia/kernel/util/native_list.h"
+#include "xenia/kernel/util/host_processor_map.h"
+#include "xenia/kernel/util/idle_time_skipper.h"
+#include "xenia/kernel/util/io_thread_pool.h"
 #include "xenia/kernel/util/object_table.h"
 #include "xenia/kernel/util/xdbf_utils.h"
 #include "xenia/kernel/xam/app_manager.h"
@@ -112,6 +118,14 @@ class KernelState {
   // Access must be guarded by the global critical region.
   util::ObjectTable* object_table() { return &object_table_; }
 
+  const util::HostProcessorMap& host_processor_map() const {
+    return host_processor_map_;
+  }
+
+  util::IoThreadPool& io_thread_pool() { return io_thread_pool_; }
+
+  util::IdleTimeSkipper& idle_time_skipper() { return idle_time_skipper_; }
+
   uint32_t process_type() const;
   void set_process_type(uint32_t value);
   uint32_t process_info_block_address() const {
@@ -163,11 +177,35 @@ class KernelState {
   void OnThreadExit(XThread* thread);
   object_ref<XThread> GetThreadByID(uint32_t thread_id);
 
+  // Exited threads' guest stacks are kept for reuse by new threads needing a
+  // stack of the same allocation size, as allocating a stack and setting up
+  // its guard pages takes multiple host memory management calls, which is
+  // expensive in titles creating many short-lived threads.
+  // Returns whether a stack was taken from the pool.
+  bool AcquirePooledThreadStack(uint32_t alloc_size, uint32_t& alloc_base_out);
+  // Returns false if the pool is full, and the stack must be released.
+  bool ReleaseThreadStackToPool(uint32_t alloc_base, uint32_t alloc_size);
+  void ReleaseThreadStackPool();
+
   void RegisterNotifyListener(XNotifyListener* listener);
   void UnregisterNotifyListener(XNotifyListener* listener);
   void BroadcastNotification(XNotificationID id, uint32_t data);
+  // Whether any listener may have queued notifications, for skipping the
+  // listener lookup when polling in the common case of none. Thread-safe.
+  bool has_pending_notifications() const {
+    return pending_notification_count_.load(std::memory_order_acquire) != 0;
+  }
+  // Called by the listeners when notifications are added or removed.
+  void AddPendingNotifications(int64_t count) {
+    pending_notification_count_.fetch_add(uint64_t(count),
+                                          std::memory_order_acq_rel);
+  }
 
-  util::NativeList* dpc_list() { return &dpc_list_; }
+  // Queues the DPC (XDPC) for execution on the DPC worker of the guest
+  // processor the calling thread is running on. Returns false if the DPC is
+  // already queued.
+  bool InsertQueueDpc(uint32_t dpc_ptr, uint32_t arg1, uint32_t arg2);
+  bool RemoveQueueDpc(uint32_t dpc_ptr);
 
   void CompleteOverlapped(uint32_t overlapped_ptr, X_RESULT result);
   void CompleteOverlappedEx(uint32_t overlapped_ptr, X_RESULT result,
@@ -213,11 +251,20 @@ class KernelState {
 
   xe::global_critical_region global_critical_region_;
 
+  util::HostProcessorMap host_processor_map_;
+
+  util::IdleTimeSkipper idle_time_skipper_;
+
+  // The requests hold references to the objects, so must be shut down before
+  // the object table is reset.
+  util::IoThreadPool io_thread_pool_;
+
   // Must be guarded by the global critical region.
   util::ObjectTable object_table_;
   std::unordered_map<uint32_t, XThread*> threads_by_id_;
   std::vector<object_ref<XNotifyListener>> notify_listeners_;
   bool has_notified_startup_ = false;
+  std::atomic<uint64_t> pending_notification_count_ = {0};
 
   uint32_t process_type_ = X_PROCTYPE_USER;
   object_ref<UserModule> executable_module_;
@@ -229,13 +276,35 @@ class KernelState {
 
   std::atomic<bool> dispatch_thread_running_;
   object_ref<XHostThread> dispatch_thread_;
-  // Must be guarded by the global critical region.
-  util::NativeList dpc_list_;
   std::condition_variable_any dispatch_cond_;
   std::list<std::function<void()>> dispatch_queue_;
 
+  // DPCs are executed on a host thread per guest processor, created when a
+  // DPC is queued to the processor for the first time, so they're delivered
+  // without waiting for the guest threads to reach a specific point.
+  static constexpr uint32_t kDpcProcessorCount = 6;
+  struct DpcProcessor {
+    std::condition_variable dpc_queued;
+    std::deque<uint32_t> dpcs;
+    object_ref<XHostThread> thread;
+  };
+  int DpcThreadMain(uint32_t processor);
+  std::mutex dpc_mutex_;
+  std::array<DpcProcessor, kDpcProcessorCount> dpc_processors_;
+  // Guest addresses of the queued DPCs to their processors.
+  std::unordered_map<uint32_t, uint32_t> queued_dpc_processors_;
+  bool dpc_shutting_down_ = false;
+
   BitMap tls_bitmap_;
 
+  static constexpr size_t kThreadStackPoolMaxSize = 16;
+  struct PooledThreadStack {
+    uint32_t alloc_base;
+    uint32_t alloc_size;
+  };
+  std::mutex thread_stack_pool_mutex_;
+  std::vector<PooledThreadStack> thread_stack_pool_;
+
   friend class XObject;
 };
 
@@ -13,6 +13,8 @@
 
 #include "xenia/base/byte_stream.h"
 #include "xenia/base/logging.h"
+#include "xenia/base/string.h"
+#include "xenia/base/xxhash.h"
 #include "xenia/cpu/elf_module.h"
 #include "xenia/cpu/processor.h"
 #include "xenia/cpu/xex_module.h"
@@ -21,10 +23,45 @@
 #include "xenia/kernel/xthread.h"
 
 DEFINE_bool(xex_apply_patches, true, "Apply XEX patches.", "Kernel");
+DEFINE_bool(xex_image_cache, false,
+            "Save the decrypted, decompressed and patched images of XEX files "
+            "in the cache, and load them from there on later launches instead "
+            "of processing the XEX files again. Keyed by the contents of the "
+            "XEX file and its patch.",
+            "Kernel");
 
 namespace xe {
 namespace kernel {
 
+namespace {
+
+bool HashFileEntry(vfs::Entry* entry, uint64_t seed, uint64_t* hash_out) {
+  if (entry->can_map()) {
+    auto mmap = entry->OpenMapped(MappedMemory::Mode::kRead);
+    if (!mmap) {
+      return false;
+    }
+    *hash_out = XXH3_64bits_withSeed(mmap->data(), mmap->size(), seed);
+    return true;
+  }
+  std::vector<uint8_t> buffer(entry->size());
+  vfs::File* file = nullptr;
+  if (XFAILED(entry->Open(vfs::FileAccess::kGenericRead, &file))) {
+    return false;
+  }
+  size_t bytes_read = 0;
+  X_STATUS result =
+      file->ReadSync(buffer.data(), buffer.size(), 0, &bytes_read);
+  file->Destroy();
+  if (XFAILED(result)) {
+    return false;
+  }
+  *hash_out = XXH3_64bits_withSeed(buffer.data(), bytes_read, seed);
+  return true;
+}
+
+}  // namespace
+
 UserModule::UserModule(KernelState* kernel_state)
     : XModule(kernel_state, ModuleType::kUserModule) {}
 
@@ -62,6 +99,9 @@ X_STATUS UserModule::LoadFromFile(const std::string_view path) {
   path_ = fs_entry->absolute_path();
   name_ = utf8::find_base_name_from_guest_path(path_);
 
+  std::filesystem::path image_cache_path;
+  bool loaded_from_image_cache = false;
+
   // If the FS supports mapping, map the file in and load from that.
   if (fs_entry->can_map()) {
     // Map.
@@ -71,7 +111,11 @@ X_STATUS UserModule::LoadFromFile(const std::string_view path) {
     }
 
     // Load the module.
-    result = LoadFromMemory(mmap->data(), mmap->size());
+    image_cache_path = GetXexImageCachePath(mmap->data(), mmap->size());
+    loaded_from_image_cache = LoadXexFromImageCache(image_cache_path);
+    result = loaded_from_image_cache
+                 ? X_STATUS_PENDING
+                 : LoadFromMemory(mmap->data(), mmap->size());
   } else {
     std::vector<uint8_t> buffer(fs_entry->size());
 
@@ -91,7 +135,11 @@ X_STATUS UserModule::LoadFromFile(const std::string_view path) {
     }
 
     // Load the module.
-    result = LoadFromMemory(buffer.data(), bytes_read);
+    image_cache_path = GetXexImageCachePath(buffer.data(), bytes_read);
+    loaded_from_image_cache = LoadXexFromImageCache(image_cache_path);
+    result = loaded_from_image_cache
+                 ? X_STATUS_PENDING
+                 : LoadFromMemory(buffer.data(), bytes_read);
 
     // Close the file.
     file->Destroy();
@@ -102,7 +150,8 @@ X_STATUS UserModule::LoadFromFile(const std::string_view path) {
     return result;
   }
 
-  if (cvars::xex_apply_patches) {
+  // The cached image already has the patch applied.
+  if (cvars::xex_apply_patches && !loaded_from_image_cache) {
     // Search for xexp patch file
     auto patch_entry = kernel_state()->file_system()->ResolvePath(path_ + "p");
 
@@ -128,9 +177,73 @@ X_STATUS UserModule::LoadFromFile(const std::string_view path) {
     }
   }
 
+  if (!loaded_from_image_cache && !image_cache_path.empty()) {
+    if (xex_module()->SaveImageCache(image_cache_path)) {
+      XELOGI("Saved the XEX image to the cache as {}",
+             xe::path_to_utf8(image_cache_path));
+    } else {
+      XELOGW("Failed to save the XEX image to the cache as {}",
+             xe::path_to_utf8(image_cache_path));
+    }
+  }
+
   return LoadXexContinue();
 }
 
+std::filesystem::path UserModule::GetXexImageCachePath(const void* addr,
+                                                       const size_t length) {
+  if (!cvars::xex_image_cache || length < sizeof(xex2_header)) {
+    return std::filesystem::path();
+  }
+  auto header = reinterpret_cast<const xex2_header*>(addr);
+  if (header->magic != xe::cpu::kXEX2Signature &&
+      header->magic != xe::cpu::kXEX1Signature) {
+    return std::filesystem::path();
+  }
+  // Patches are applied to the image of the executable being patched.
+  if (header->module_flags & (XEX_MODULE_MODULE_PATCH | XEX_MODULE_PATCH_DELTA |
+                              XEX_MODULE_PATCH_FULL)) {
+    return std::filesystem::path();
+  }
+  const std::filesystem::path& cache_root =
+      kernel_state()->emulator()->cache_root();
+  if (cache_root.empty()) {
+    return std::filesystem::path();
+  }
+  uint64_t hash = XXH3_64bits(addr, length);
+  if (cvars::xex_apply_patches) {
+    auto patch_entry = kernel_state()->file_system()->ResolvePath(path_ + "p");
+    if (patch_entry && !HashFileEntry(patch_entry, hash, &hash)) {
+      return std::filesystem::path();
+    }
+  }
+  return cache_root / "xex_image_cache" / fmt::format("{:016X}.bin", hash);
+}
+
+bool UserModule::LoadXexFromImageCache(
+    const std::filesystem::path& cache_path) {
+  std::error_code error_code;
+  if (cache_path.empty() || !std::filesystem::exists(cache_path, error_code)) {
+    return false;
+  }
+  auto processor = kernel_state()->processor();
+  auto xex_module = std::make_unique<cpu::XexModule>(processor, kernel_state());
+  if (!xex_module->LoadFromImageCache(name_, path_, cache_path)) {
+    XELOGW("Failed to load the XEX image from the cache file {}",
+           xe::path_to_utf8(cache_path));
+    return false;
+  }
+  cpu::XexModule* xex_module_ptr = xex_module.get();
+  if (!processor->AddModule(std::move(xex_module))) {
+    return false;
+  }
+  module_format_ = kModuleFormatXex;
+  processor_module_ = xex_module_ptr;
+  XELOGI("Loaded the XEX image from the cache file {}",
+         xe::path_to_utf8(cache_path));
+  return true;
+}
+
 X_STATUS UserModule::LoadFromMemory(const void* addr, const size_t length) {
   auto processor = kernel_state()->processor();
 
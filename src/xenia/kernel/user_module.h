@@ -10,6 +10,7 @@
 #ifndef XENIA_KERNEL_USER_MODULE_H_
 #define XENIA_KERNEL_USER_MODULE_H_
 
+#include <filesystem>
 #include <string>
 
 #include "xenia/cpu/export_resolver.h"
@@ -96,6 +97,13 @@ class UserModule : public XModule {
                                         const std::string_view path);
 
  private:
+  // Returns the path to the cached image of the XEX file with the contents in
+  // the memory and its patch, or an empty path if the XEX image cache is not
+  // used for it.
+  std::filesystem::path GetXexImageCachePath(const void* addr,
+                                             const size_t length);
+  // Loads the XEX with the patch applied if there is an image cache file.
+  bool LoadXexFromImageCache(const std::filesystem::path& cache_path);
   X_STATUS LoadXexContinue();
 
   std::string name_;
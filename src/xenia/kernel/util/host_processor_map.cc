@@ -0,0 +1,250 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/kernel/util/host_processor_map.h"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "xenia/base/cvar.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/string_util.h"
+#include "xenia/base/threading.h"
+#include "xenia/base/utf8.h"
+
+DEFINE_bool(
+    host_processor_map, false,
+    "Place the threads of the guest hardware threads, the GPU command "
+    "processor and the audio on specific host processors based on the host "
+    "processor topology (SMT siblings, shared caches, hybrid core types). The "
+    "guest thread affinities are honored within the processors of the guest "
+    "hardware threads unless --ignore_thread_affinities is enabled.",
+    "Kernel");
+DEFINE_string(
+    host_processor_map_guest, "",
+    "Comma-separated indices of the host logical processors for the guest "
+    "hardware threads 0-5 with --host_processor_map, to override the "
+    "automatic selection.",
+    "Kernel");
+
+DECLARE_bool(ignore_thread_affinities);
+
+namespace xe {
+namespace kernel {
+namespace util {
+
+void HostProcessorMap::Initialize(uint32_t numa_node) {
+  enabled_ = false;
+  if (!cvars::host_processor_map && numa_node == UINT32_MAX) {
+    return;
+  }
+
+  std::vector<xe::threading::LogicalProcessor> processors =
+      xe::threading::GetLogicalProcessors();
+  if (numa_node != UINT32_MAX) {
+    processors.erase(
+        std::remove_if(processors.begin(), processors.end(),
+                       [numa_node](const auto& processor) {
+                         return processor.numa_node != numa_node;
+                       }),
+        processors.end());
+  }
+  if (processors.empty()) {
+    XELOGW("Host processor map: Failed to get the host processor topology");
+    return;
+  }
+
+  if (!cvars::host_processor_map) {
+    // Only keeping all the threads on the processors local to the guest
+    // memory, leaving the placement within the node to the host.
+    uint64_t node_affinity = 0;
+    for (const xe::threading::LogicalProcessor& processor : processors) {
+      node_affinity |= uint64_t(1) << processor.index;
+    }
+    hardware_thread_affinities_.fill(node_affinity);
+    all_hardware_threads_affinity_ = node_affinity;
+    host_thread_affinities_.fill(node_affinity);
+    enabled_ = true;
+    XELOGI("Host processor map: All threads on NUMA node {} ({:016X})",
+           numa_node, node_affinity);
+    return;
+  }
+
+  struct Core {
+    uint32_t efficiency_class;
+    uint32_t cache_group;
+    std::vector<uint32_t> processors;
+  };
+  std::vector<Core> cores;
+  {
+    std::unordered_map<uint32_t, size_t> core_indices;
+    for (const xe::threading::LogicalProcessor& processor : processors) {
+      auto core_it = core_indices.emplace(processor.core, cores.size()).first;
+      if (core_it->second == cores.size()) {
+        Core& core = cores.emplace_back();
+        core.efficiency_class = processor.efficiency_class;
+        core.cache_group = processor.cache_group;
+      }
+      cores[core_it->second].processors.push_back(processor.index);
+    }
+  }
+
+  // Order the cores from the most performant, preferring the cache group with
+  // the most of the most performant cores so the guest hardware threads share
+  // the cache if possible.
+  uint32_t best_efficiency_class = 0;
+  for (const Core& core : cores) {
+    best_efficiency_class =
+        std::max(best_efficiency_class, core.efficiency_class);
+  }
+  std::unordered_map<uint32_t, uint32_t> cache_group_best_core_counts;
+  uint32_t best_cache_group = 0;
+  uint32_t best_cache_group_core_count = 0;
+  for (const Core& core : cores) {
+    if (core.efficiency_class != best_efficiency_class) {
+      continue;
+    }
+    uint32_t core_count = ++cache_group_best_core_counts[core.cache_group];
+    if (core_count > best_cache_group_core_count) {
+      best_cache_group = core.cache_group;
+      best_cache_group_core_count = core_count;
+    }
+  }
+  std::stable_sort(cores.begin(), cores.end(),
+                   [best_cache_group](const Core& a, const Core& b) {
+                     if (a.efficiency_class != b.efficiency_class) {
+                       return a.efficiency_class > b.efficiency_class;
+                     }
+                     return (a.cache_group == best_cache_group) &&
+                            (b.cache_group != best_cache_group);
+                   });
+
+  std::vector<bool> cores_used(cores.size(), false);
+  if (!cvars::host_processor_map_guest.empty()) {
+    std::vector<std::string_view> indices =
+        xe::utf8::split(cvars::host_processor_map_guest, ",", true);
+    if (indices.size() != kHardwareThreadCount) {
+      XELOGE(
+          "Host processor map: {} host processors must be specified for the "
+          "guest hardware threads",
+          kHardwareThreadCount);
+      return;
+    }
+    for (uint32_t i = 0; i < kHardwareThreadCount; ++i) {
+      uint32_t index = xe::string_util::from_string<uint32_t>(indices[i]);
+      bool found = false;
+      for (size_t j = 0; j < cores.size() && !found; ++j) {
+        const std::vector<uint32_t>& core_processors = cores[j].processors;
+        if (std::find(core_processors.begin(), core_processors.end(),
+                      index) != core_processors.end()) {
+          cores_used[j] = true;
+          found = true;
+        }
+      }
+      if (!found) {
+        XELOGE(
+            "Host processor map: Host processor {} is not available to the "
+            "process",
+            index);
+        return;
+      }
+      hardware_thread_affinities_[i] = uint64_t(1) << index;
+    }
+  } else {
+    // With few cores, keep the cores for the host threads by placing the
+    // hardware threads of each guest core on SMT siblings, like on the Xenon.
+    static_assert(kHardwareThreadCount % 2 == 0);
+    constexpr uint32_t kGuestCoreCount = kHardwareThreadCount / 2;
+    constexpr size_t kHostThreadCount = size_t(HostThread::kCount);
+    bool smt_available = cores.size() >= kGuestCoreCount;
+    for (uint32_t i = 0; i < kGuestCoreCount && smt_available; ++i) {
+      smt_available = cores[i].processors.size() >= 2;
+    }
+    if (cores.size() >= kHardwareThreadCount + kHostThreadCount ||
+        (!smt_available && cores.size() >= kHardwareThreadCount)) {
+      for (uint32_t i = 0; i < kHardwareThreadCount; ++i) {
+        hardware_thread_affinities_[i] = uint64_t(1)
+                                         << cores[i].processors[0];
+        cores_used[i] = true;
+      }
+    } else if (smt_available) {
+      for (uint32_t i = 0; i < kGuestCoreCount; ++i) {
+        hardware_thread_affinities_[i * 2] = uint64_t(1)
+                                             << cores[i].processors[0];
+        hardware_thread_affinities_[i * 2 + 1] = uint64_t(1)
+                                                 << cores[i].processors[1];
+        cores_used[i] = true;
+      }
+    } else {
+      XELOGW(
+          "Host processor map: Too few host processor cores ({}) for the "
+          "guest hardware threads",
+          cores.size());
+      return;
+    }
+  }
+
+  all_hardware_threads_affinity_ = 0;
+  for (uint64_t affinity : hardware_thread_affinities_) {
+    all_hardware_threads_affinity_ |= affinity;
+  }
+
+  // Place every host thread on its own physical core not used by the guest,
+  // or leave it unpinned if there are no such cores left.
+  size_t next_core = 0;
+  for (size_t i = 0; i < size_t(HostThread::kCount); ++i) {
+    while (next_core < cores.size() && cores_used[next_core]) {
+      ++next_core;
+    }
+    uint64_t affinity = 0;
+    if (next_core < cores.size()) {
+      for (uint32_t index : cores[next_core].processors) {
+        affinity |= uint64_t(1) << index;
+      }
+      cores_used[next_core] = true;
+    }
+    host_thread_affinities_[i] = affinity;
+  }
+
+  enabled_ = true;
+  XELOGI(
+      "Host processor map: Guest hardware threads on {:016X} {:016X} {:016X} "
+      "{:016X} {:016X} {:016X}, GPU command processor on {:016X}, audio on "
+      "{:016X}",
+      hardware_thread_affinities_[0], hardware_thread_affinities_[1],
+      hardware_thread_affinities_[2], hardware_thread_affinities_[3],
+      hardware_thread_affinities_[4], hardware_thread_affinities_[5],
+      host_thread_affinities_[size_t(HostThread::kGpuCommandProcessor)],
+      host_thread_affinities_[size_t(HostThread::kAudio)]);
+}
+
+uint64_t HostProcessorMap::GetGuestThreadAffinity(
+    uint32_t hardware_thread) const {
+  if (!enabled_) {
+    return 0;
+  }
+  if (cvars::ignore_thread_affinities) {
+    return all_hardware_threads_affinity_;
+  }
+  return hardware_thread_affinities_[hardware_thread % kHardwareThreadCount];
+}
+
+void HostProcessorMap::ApplyHostThreadAffinity(
+    xe::threading::Thread* thread, HostThread host_thread) const {
+  uint64_t affinity = GetHostThreadAffinity(host_thread);
+  if (thread && affinity) {
+    thread->set_affinity_mask(affinity);
+  }
+}
+
+}  // namespace util
+}  // namespace kernel
+}  // namespace xe
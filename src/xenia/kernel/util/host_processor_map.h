@@ -0,0 +1,76 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_KERNEL_UTIL_HOST_PROCESSOR_MAP_H_
+#define XENIA_KERNEL_UTIL_HOST_PROCESSOR_MAP_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace xe {
+namespace threading {
+class Thread;
+}  // namespace threading
+}  // namespace xe
+
+namespace xe {
+namespace kernel {
+namespace util {
+
+// Placement of the threads on the host logical processors, with
+// --host_processor_map. The six guest hardware threads are assigned to host
+// logical processors based on the host processor topology - preferring the
+// most performant cores sharing the last-level cache, and, if there are not
+// enough physical cores, placing the two hardware threads of each guest core
+// on the SMT siblings of one host core. The busiest host threads are placed
+// on other physical cores if available. If the guest memory is placed on a
+// host NUMA node, only the processors of the node are used, and without
+// --host_processor_map, all the threads are kept on the node's processors.
+class HostProcessorMap {
+ public:
+  static constexpr uint32_t kHardwareThreadCount = 6;
+
+  enum class HostThread {
+    kGpuCommandProcessor,
+    kAudio,
+
+    kCount,
+  };
+
+  // numa_node is the host NUMA node the guest memory is placed on, or
+  // UINT32_MAX if any processors may be used.
+  void Initialize(uint32_t numa_node);
+
+  bool is_enabled() const { return enabled_; }
+
+  // The affinity for a guest thread running on the guest hardware thread -
+  // all the processors of the guest hardware threads if the thread affinities
+  // are ignored. 0 if the placement is disabled.
+  uint64_t GetGuestThreadAffinity(uint32_t hardware_thread) const;
+  // 0 if the thread should not be pinned.
+  uint64_t GetHostThreadAffinity(HostThread host_thread) const {
+    return enabled_ ? host_thread_affinities_[size_t(host_thread)] : 0;
+  }
+  void ApplyHostThreadAffinity(xe::threading::Thread* thread,
+                               HostThread host_thread) const;
+
+ private:
+  bool enabled_ = false;
+  std::array<uint64_t, kHardwareThreadCount> hardware_thread_affinities_ = {};
+  uint64_t all_hardware_threads_affinity_ = 0;
+  std::array<uint64_t, size_t(HostThread::kCount)> host_thread_affinities_ =
+      {};
+};
+
+}  // namespace util
+}  // namespace kernel
+}  // namespace xe
+
+#endif  // XENIA_KERNEL_UTIL_HOST_PROCESSOR_MAP_H_
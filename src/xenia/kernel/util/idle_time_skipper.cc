@@ -0,0 +1,241 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/kernel/util/idle_time_skipper.h"
+
+#include <algorithm>
+
+#include "xenia/base/assert.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/logging.h"
+
+DEFINE_bool(
+    clock_idle_skip, false,
+    "Skip the guest time ahead to the nearest timed wait, timer or vertical "
+    "blanking deadline instead of waiting while all the guest threads are "
+    "blocked, for running titles as fast as the host allows in automated "
+    "runs. Not supported with --clock_no_scaling.",
+    "Kernel");
+
+namespace xe {
+namespace kernel {
+namespace util {
+
+// Host time all the guest threads must stay idle for before skipping, so the
+// threads woken by the previous skip or by host events have a chance to run.
+constexpr uint64_t kSettleMicros = 200;
+
+void IdleTimeSkipper::Initialize() {
+  enabled_ = cvars::clock_idle_skip;
+  if (enabled_ && cvars::clock_no_scaling) {
+    XELOGW("Idle time skipping is not supported with --clock_no_scaling");
+    enabled_ = false;
+  }
+  if (enabled_) {
+    XELOGI("Idle time skipping enabled");
+  }
+}
+
+void IdleTimeSkipper::AddGuestThread(GuestThread& thread) {
+  if (!enabled_) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (thread.is_added_) {
+    return;
+  }
+  thread.is_added_ = true;
+  ++guest_thread_count_;
+  UpdateAllIdle();
+}
+
+void IdleTimeSkipper::RemoveGuestThread(GuestThread& thread) {
+  if (!enabled_) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!thread.is_added_) {
+    return;
+  }
+  if (thread.is_idle_) {
+    UnlinkIdleThread(thread);
+  }
+  thread.is_added_ = false;
+  --guest_thread_count_;
+  UpdateAllIdle();
+}
+
+void IdleTimeSkipper::SetDeadline(
+    Deadline& deadline, uint64_t due_ticks, uint64_t period_ticks,
+    std::function<void(uint64_t due_ticks)> rearm) {
+  if (!enabled_) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  rearm_done_.wait(lock, [this] { return !rearming_; });
+  deadline.due_ticks_ = due_ticks;
+  deadline.period_ticks_ = period_ticks;
+  deadline.rearm_ = std::move(rearm);
+  if (!deadline.is_scheduled_) {
+    deadline.is_scheduled_ = true;
+    deadlines_.push_back(&deadline);
+  }
+}
+
+void IdleTimeSkipper::ClearDeadline(Deadline& deadline) {
+  if (!enabled_) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  rearm_done_.wait(lock, [this] { return !rearming_; });
+  if (!deadline.is_scheduled_) {
+    return;
+  }
+  deadline.is_scheduled_ = false;
+  deadline.rearm_ = nullptr;
+  auto it = std::find(deadlines_.begin(), deadlines_.end(), &deadline);
+  assert_true(it != deadlines_.end());
+  *it = deadlines_.back();
+  deadlines_.pop_back();
+}
+
+uint64_t IdleTimeSkipper::GetNextDue(const Deadline& deadline,
+                                     uint64_t after_ticks) {
+  if (deadline.due_ticks_ > after_ticks || !deadline.period_ticks_) {
+    return deadline.due_ticks_;
+  }
+  return deadline.due_ticks_ +
+         ((after_ticks - deadline.due_ticks_) / deadline.period_ticks_ + 1) *
+             deadline.period_ticks_;
+}
+
+void IdleTimeSkipper::TrySkip() {
+  if (!enabled_) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (rearming_ || !all_idle_host_ticks_ ||
+      (Clock::QueryHostTickCount() - all_idle_host_ticks_) * 1000000 <
+          kSettleMicros * Clock::QueryHostTickFrequency()) {
+    return;
+  }
+
+  uint64_t now = Clock::QueryGuestTickCount();
+  uint64_t target = UINT64_MAX;
+  for (GuestThread* thread = idle_threads_; thread;
+       thread = thread->next_idle_) {
+    target = std::min(target, thread->deadline_ticks_);
+  }
+  for (const Deadline* deadline : deadlines_) {
+    uint64_t due = GetNextDue(*deadline, now);
+    if (due <= now) {
+      if (!deadline->rearm_) {
+        // Not handled by the owner yet.
+        return;
+      }
+      // The host timer has already fired or is about to.
+      continue;
+    }
+    target = std::min(target, due);
+  }
+  if (target == UINT64_MAX || target <= now) {
+    return;
+  }
+
+  Clock::AdvanceGuestTickCount(target - now);
+  skipped_ticks_ += target - now;
+  // Let the threads woken by the skip run before skipping further.
+  all_idle_host_ticks_ = Clock::QueryHostTickCount();
+
+  // The host timers have been scheduled in the host time, reschedule the ones
+  // that have become due earlier.
+  deadlines_to_rearm_.clear();
+  for (Deadline* deadline : deadlines_) {
+    uint64_t due = GetNextDue(*deadline, now);
+    if (due > now && deadline->rearm_) {
+      deadline->due_ticks_ = due;
+      deadlines_to_rearm_.emplace_back(deadline, due);
+    }
+  }
+  if (deadlines_to_rearm_.empty()) {
+    return;
+  }
+  rearming_ = true;
+  lock.unlock();
+  for (const std::pair<Deadline*, uint64_t>& rearm : deadlines_to_rearm_) {
+    rearm.first->rearm_(rearm.second);
+  }
+  lock.lock();
+  rearming_ = false;
+  lock.unlock();
+  rearm_done_.notify_all();
+}
+
+uint64_t IdleTimeSkipper::skipped_ticks() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return skipped_ticks_;
+}
+
+void IdleTimeSkipper::BeginIdle(GuestThread& thread,
+                                uint64_t deadline_ticks) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!thread.is_added_ || thread.is_idle_) {
+      return;
+    }
+    thread.deadline_ticks_ = deadline_ticks;
+    thread.is_idle_ = true;
+    thread.previous_idle_ = nullptr;
+    thread.next_idle_ = idle_threads_;
+    if (idle_threads_) {
+      idle_threads_->previous_idle_ = &thread;
+    }
+    idle_threads_ = &thread;
+    ++idle_thread_count_;
+    UpdateAllIdle();
+  }
+  TrySkip();
+}
+
+void IdleTimeSkipper::EndIdle(GuestThread& thread) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!thread.is_idle_) {
+    return;
+  }
+  UnlinkIdleThread(thread);
+  UpdateAllIdle();
+}
+
+void IdleTimeSkipper::UnlinkIdleThread(GuestThread& thread) {
+  assert_true(thread.is_idle_);
+  if (thread.previous_idle_) {
+    thread.previous_idle_->next_idle_ = thread.next_idle_;
+  } else {
+    idle_threads_ = thread.next_idle_;
+  }
+  if (thread.next_idle_) {
+    thread.next_idle_->previous_idle_ = thread.previous_idle_;
+  }
+  thread.previous_idle_ = nullptr;
+  thread.next_idle_ = nullptr;
+  thread.is_idle_ = false;
+  --idle_thread_count_;
+}
+
+void IdleTimeSkipper::UpdateAllIdle() {
+  if (!guest_thread_count_ || idle_thread_count_ < guest_thread_count_) {
+    all_idle_host_ticks_ = 0;
+  } else if (!all_idle_host_ticks_) {
+    all_idle_host_ticks_ = std::max(Clock::QueryHostTickCount(), uint64_t(1));
+  }
+}
+
+}  // namespace util
+}  // namespace kernel
+}  // namespace xe
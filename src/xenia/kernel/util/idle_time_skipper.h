@@ -0,0 +1,192 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_KERNEL_UTIL_IDLE_TIME_SKIPPER_H_
+#define XENIA_KERNEL_UTIL_IDLE_TIME_SKIPPER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "xenia/base/clock.h"
+#include "xenia/base/threading.h"
+
+namespace xe {
+namespace kernel {
+namespace util {
+
+// Virtual guest time for automated runs, with --clock_idle_skip. While all the
+// guest threads are blocked, instead of waiting for the host time to pass, the
+// guest time (see Clock::AdvanceGuestTickCount) jumps to the nearest deadline
+// - of a timed wait or a delay of a guest thread, of a guest timer, or of the
+// next vertical blanking interval. The timed waits of the guest threads are
+// performed in short host slices checking the deadline in the guest time.
+// Suspended guest threads are considered busy, so time is not skipped while
+// any guest thread is suspended by another one.
+class IdleTimeSkipper {
+ public:
+  // Maximum host duration of one slice of a timed guest wait.
+  static constexpr uint32_t kWaitSliceMillis = 1;
+
+  // A guest time event not bound to a wait of a guest thread, such as a guest
+  // timer or the vertical blanking interrupt.
+  class Deadline {
+   public:
+    Deadline() = default;
+    Deadline(const Deadline& deadline) = delete;
+    Deadline& operator=(const Deadline& deadline) = delete;
+
+   private:
+    friend class IdleTimeSkipper;
+    uint64_t due_ticks_ = 0;
+    uint64_t period_ticks_ = 0;
+    // Called without the lock after the time has been skipped, with the new
+    // next due time, for host timers to be rescheduled to the new host time
+    // corresponding to it.
+    std::function<void(uint64_t due_ticks)> rearm_;
+    bool is_scheduled_ = false;
+  };
+
+  // Idle state of a guest thread, owned by the thread object, so a thread
+  // terminated during a wait can still be removed.
+  class GuestThread {
+   public:
+    GuestThread() = default;
+    GuestThread(const GuestThread& thread) = delete;
+    GuestThread& operator=(const GuestThread& thread) = delete;
+
+   private:
+    friend class IdleTimeSkipper;
+    uint64_t deadline_ticks_ = 0;
+    GuestThread* previous_idle_ = nullptr;
+    GuestThread* next_idle_ = nullptr;
+    bool is_added_ = false;
+    bool is_idle_ = false;
+  };
+
+  IdleTimeSkipper() = default;
+  IdleTimeSkipper(const IdleTimeSkipper& skipper) = delete;
+  IdleTimeSkipper& operator=(const IdleTimeSkipper& skipper) = delete;
+
+  void Initialize();
+
+  bool is_enabled() const { return enabled_; }
+
+  // Called when the guest thread starts executing, and when it exits or is
+  // terminated.
+  void AddGuestThread(GuestThread& thread);
+  void RemoveGuestThread(GuestThread& thread);
+
+  // Schedules the deadline, in guest ticks (see Clock::QueryGuestTickCount),
+  // repeating with the period if it's not 0, replacing the previous schedule.
+  // A deadline with a rearm callback is handled by a host timer firing by
+  // itself. One without it is polled by its owner, and once it's reached, no
+  // time is skipped until the owner reschedules or clears it.
+  void SetDeadline(Deadline& deadline, uint64_t due_ticks,
+                   uint64_t period_ticks = 0,
+                   std::function<void(uint64_t due_ticks)> rearm = nullptr);
+  void ClearDeadline(Deadline& deadline);
+
+  // Skips the guest time to the nearest deadline if all the guest threads
+  // have been idle for a while. Called at the end of every wait slice, and
+  // also periodically by the vertical blanking worker, so the time is skipped
+  // even while all the guest threads are in untimed waits.
+  void TrySkip();
+
+  // Performs a wait of the current thread, with the timeout in guest
+  // milliseconds, or an untimed one if there's no timeout. wait_function
+  // performs the host wait with the std::chrono::milliseconds host timeout,
+  // and its result is returned once the wait is completed. Unless the thread
+  // is a guest one (not null) and idle time skipping is enabled, this is a
+  // single host wait with the scaled guest timeout.
+  template <typename WaitFunction>
+  auto Wait(GuestThread* thread, std::optional<uint32_t> guest_timeout_ms,
+            WaitFunction wait_function) {
+    if (!enabled_ || !thread ||
+        (guest_timeout_ms && !*guest_timeout_ms)) {
+      return wait_function(
+          guest_timeout_ms ? std::chrono::milliseconds(
+                                 Clock::ScaleGuestDurationMillis(
+                                     *guest_timeout_ms))
+                           : std::chrono::milliseconds::max());
+    }
+    if (!guest_timeout_ms) {
+      BeginIdle(*thread, UINT64_MAX);
+      auto result = wait_function(std::chrono::milliseconds::max());
+      EndIdle(*thread);
+      return result;
+    }
+    uint64_t deadline = Clock::QueryGuestTickCount() +
+                        uint64_t(*guest_timeout_ms) *
+                            Clock::guest_tick_frequency() / 1000;
+    BeginIdle(*thread, deadline);
+    while (true) {
+      uint32_t slice_ms =
+          Clock::QueryGuestTickCount() < deadline ? kWaitSliceMillis : 0;
+      auto result = wait_function(std::chrono::milliseconds(slice_ms));
+      if (!IsTimeout(result) || Clock::QueryGuestTickCount() >= deadline) {
+        EndIdle(*thread);
+        return result;
+      }
+      TrySkip();
+    }
+  }
+
+  // Total guest ticks skipped during the run.
+  uint64_t skipped_ticks() const;
+
+ private:
+  static bool IsTimeout(xe::threading::WaitResult result) {
+    return result == xe::threading::WaitResult::kTimeout;
+  }
+  static bool IsTimeout(
+      const std::pair<xe::threading::WaitResult, size_t>& result) {
+    return result.first == xe::threading::WaitResult::kTimeout;
+  }
+  static bool IsTimeout(xe::threading::SleepResult result) {
+    return result == xe::threading::SleepResult::kSuccess;
+  }
+
+  static uint64_t GetNextDue(const Deadline& deadline, uint64_t after_ticks);
+
+  void BeginIdle(GuestThread& thread, uint64_t deadline_ticks);
+  void EndIdle(GuestThread& thread);
+  // Requires the lock.
+  void UnlinkIdleThread(GuestThread& thread);
+  void UpdateAllIdle();
+
+  bool enabled_ = false;
+
+  mutable std::mutex mutex_;
+  // Signaled when the rearming of the deadlines after a skip is done.
+  std::condition_variable rearm_done_;
+  uint32_t guest_thread_count_ = 0;
+  uint32_t idle_thread_count_ = 0;
+  GuestThread* idle_threads_ = nullptr;
+  std::vector<Deadline*> deadlines_;
+  // Deadlines being rearmed without the lock, during which they can't be
+  // modified.
+  std::vector<std::pair<Deadline*, uint64_t>> deadlines_to_rearm_;
+  bool rearming_ = false;
+  // Host tick count when all the guest threads became idle, or 0 if some are
+  // busy.
+  uint64_t all_idle_host_ticks_ = 0;
+  uint64_t skipped_ticks_ = 0;
+};
+
+}  // namespace util
+}  // namespace kernel
+}  // namespace xe
+
+#endif  // XENIA_KERNEL_UTIL_IDLE_TIME_SKIPPER_H_
@@ -0,0 +1,112 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/kernel/util/io_thread_pool.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "third_party/fmt/include/fmt/format.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/logging.h"
+
+DEFINE_uint32(
+    async_io_threads, 2,
+    "Number of the host threads performing the asynchronous file reads of the "
+    "guest, allowing the guest threads requesting them (such as the streaming "
+    "threads of the titles) to continue while the host is reading the file. "
+    "0 to perform all file reads synchronously on the guest thread requesting "
+    "them.",
+    "Kernel");
+
+namespace xe {
+namespace kernel {
+namespace util {
+
+bool IoThreadPool::is_enabled() const { return cvars::async_io_threads != 0; }
+
+bool IoThreadPool::Queue(std::function<void()> request) {
+  if (!is_enabled()) {
+    return false;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (shutting_down_) {
+    return false;
+  }
+  if (threads_.empty()) {
+    uint32_t thread_count = std::min(cvars::async_io_threads, uint32_t(16));
+    xe::threading::Thread::CreationParameters params;
+    params.stack_size = 256 * 1024;
+    for (uint32_t i = 0; i < thread_count; ++i) {
+      std::unique_ptr<xe::threading::Thread> thread =
+          xe::threading::Thread::Create(params, [this]() { ThreadMain(); });
+      if (!thread) {
+        XELOGE("Failed to create an asynchronous I/O thread");
+        break;
+      }
+      thread->set_name(fmt::format("Asynchronous I/O {}", i));
+      threads_.push_back(std::move(thread));
+    }
+    if (threads_.empty()) {
+      return false;
+    }
+  }
+  requests_.push_back(std::move(request));
+  lock.unlock();
+  request_queued_.notify_one();
+  return true;
+}
+
+void IoThreadPool::WaitForIdle() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  idle_.wait(lock,
+             [this]() { return requests_.empty() && !requests_executing_; });
+}
+
+void IoThreadPool::Shutdown() {
+  std::vector<std::unique_ptr<xe::threading::Thread>> threads;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shutting_down_ = true;
+    threads = std::move(threads_);
+    threads_.clear();
+  }
+  request_queued_.notify_all();
+  for (const std::unique_ptr<xe::threading::Thread>& thread : threads) {
+    xe::threading::Wait(thread.get(), false);
+  }
+}
+
+void IoThreadPool::ThreadMain() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    request_queued_.wait(
+        lock, [this]() { return shutting_down_ || !requests_.empty(); });
+    if (requests_.empty()) {
+      // Shutting down, with all the queued requests completed.
+      break;
+    }
+    std::function<void()> request = std::move(requests_.front());
+    requests_.pop_front();
+    ++requests_executing_;
+    lock.unlock();
+    request();
+    // Release the references held by the request before becoming idle.
+    request = nullptr;
+    lock.lock();
+    --requests_executing_;
+    if (requests_.empty() && !requests_executing_) {
+      idle_.notify_all();
+    }
+  }
+}
+
+}  // namespace util
+}  // namespace kernel
+}  // namespace xe
@@ -0,0 +1,69 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_KERNEL_UTIL_IO_THREAD_POOL_H_
+#define XENIA_KERNEL_UTIL_IO_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "xenia/base/threading.h"
+
+namespace xe {
+namespace kernel {
+namespace util {
+
+// Host threads performing the guest asynchronous (overlapped) I/O requests, so
+// the guest thread issuing the request can continue while the host is reading
+// the file. The threads are created on the first request. The number of the
+// threads is --async_io_threads, and with 0, asynchronous I/O is disabled and
+// the requests must be completed synchronously by the caller.
+class IoThreadPool {
+ public:
+  IoThreadPool() = default;
+  IoThreadPool(const IoThreadPool& pool) = delete;
+  IoThreadPool& operator=(const IoThreadPool& pool) = delete;
+  ~IoThreadPool() { Shutdown(); }
+
+  bool is_enabled() const;
+
+  // The request is executed on one of the threads of the pool, in no specific
+  // order relatively to the requests executed on the other threads. Returns
+  // false if the request can't be queued, in which case the caller must
+  // perform the I/O synchronously.
+  bool Queue(std::function<void()> request);
+
+  // Waits for all the queued requests to be completed.
+  void WaitForIdle();
+
+  // Completes the queued requests and stops the threads.
+  void Shutdown();
+
+ private:
+  void ThreadMain();
+
+  std::mutex mutex_;
+  std::condition_variable request_queued_;
+  std::condition_variable idle_;
+  std::deque<std::function<void()>> requests_;
+  uint32_t requests_executing_ = 0;
+  bool shutting_down_ = false;
+  std::vector<std::unique_ptr<xe::threading::Thread>> threads_;
+};
+
+}  // namespace util
+}  // namespace kernel
+}  // namespace xe
+
+#endif  // XENIA_KERNEL_UTIL_IO_THREAD_POOL_H_
@@ -0,0 +1,183 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/kernel/util/kernel_call_profiler.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
+#include "xenia/base/cvar.h"
+#include "xenia/base/logging.h"
+
+DEFINE_bool(
+    kernel_call_profiler, false,
+    "Collect the number of calls, the host time spent (separately in the "
+    "waits) and the latency histogram of every kernel export, shown in the "
+    "debugger and written to the log on exit. Makes the kernel calls slower.",
+    "Kernel");
+
+namespace xe {
+namespace kernel {
+namespace util {
+
+namespace {
+std::mutex& statistics_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+std::vector<std::unique_ptr<KernelCallProfiler::ExportStatistics>>&
+export_statistics() {
+  static std::vector<std::unique_ptr<KernelCallProfiler::ExportStatistics>>
+      statistics;
+  return statistics;
+}
+}  // namespace
+
+bool KernelCallProfiler::collecting_ = false;
+thread_local uint64_t KernelCallProfiler::thread_wait_ticks_ = 0;
+
+uint64_t KernelCallProfiler::Snapshot::GetPercentileTicks(
+    double percentile) const {
+  if (!call_count) {
+    return 0;
+  }
+  uint64_t histogram_count = 0;
+  for (uint32_t bucket_count : histogram) {
+    histogram_count += bucket_count;
+  }
+  uint64_t rank = std::max(
+      uint64_t(double(histogram_count) * std::min(percentile, 100.0) * 0.01 +
+               0.5),
+      uint64_t(1));
+  uint64_t count = 0;
+  for (uint32_t i = 0; i < kBucketCount; ++i) {
+    count += histogram[i];
+    if (count >= rank) {
+      // Never above the maximum that has been observed.
+      return i + 1 < kBucketCount
+                 ? std::min(GetBucketLowerBound(i + 1) - 1, max_ticks)
+                 : max_ticks;
+    }
+  }
+  return max_ticks;
+}
+
+bool KernelCallProfiler::is_enabled() { return cvars::kernel_call_profiler; }
+
+void KernelCallProfiler::AddExport(const char* module_name,
+                                   cpu::Export* export_entry) {
+  if (export_entry->function_data.call_statistics) {
+    return;
+  }
+  auto statistics = std::make_unique<ExportStatistics>();
+  statistics->module_name = module_name;
+  statistics->export_entry = export_entry;
+  statistics->call_count = 0;
+  statistics->total_ticks = 0;
+  statistics->wait_ticks = 0;
+  statistics->max_ticks = 0;
+  for (std::atomic<uint32_t>& bucket_count : statistics->histogram) {
+    bucket_count = 0;
+  }
+  export_entry->function_data.call_statistics = statistics.get();
+  std::lock_guard<std::mutex> lock(statistics_mutex());
+  export_statistics().push_back(std::move(statistics));
+  collecting_ = true;
+}
+
+std::vector<KernelCallProfiler::Snapshot> KernelCallProfiler::GetSnapshots() {
+  std::vector<Snapshot> snapshots;
+  {
+    std::lock_guard<std::mutex> lock(statistics_mutex());
+    for (const std::unique_ptr<ExportStatistics>& statistics :
+         export_statistics()) {
+      uint64_t call_count =
+          statistics->call_count.load(std::memory_order_relaxed);
+      if (!call_count) {
+        continue;
+      }
+      Snapshot& snapshot = snapshots.emplace_back();
+      snapshot.module_name = statistics->module_name;
+      snapshot.export_name = statistics->export_entry->name;
+      snapshot.call_count = call_count;
+      snapshot.total_ticks =
+          statistics->total_ticks.load(std::memory_order_relaxed);
+      snapshot.wait_ticks =
+          statistics->wait_ticks.load(std::memory_order_relaxed);
+      snapshot.max_ticks =
+          statistics->max_ticks.load(std::memory_order_relaxed);
+      for (uint32_t i = 0; i < kBucketCount; ++i) {
+        snapshot.histogram[i] =
+            statistics->histogram[i].load(std::memory_order_relaxed);
+      }
+    }
+  }
+  std::sort(snapshots.begin(), snapshots.end(),
+            [](const Snapshot& a, const Snapshot& b) {
+              return a.total_ticks > b.total_ticks;
+            });
+  return snapshots;
+}
+
+void KernelCallProfiler::Reset() {
+  std::lock_guard<std::mutex> lock(statistics_mutex());
+  for (const std::unique_ptr<ExportStatistics>& statistics :
+       export_statistics()) {
+    statistics->call_count.store(0, std::memory_order_relaxed);
+    statistics->total_ticks.store(0, std::memory_order_relaxed);
+    statistics->wait_ticks.store(0, std::memory_order_relaxed);
+    statistics->max_ticks.store(0, std::memory_order_relaxed);
+    for (std::atomic<uint32_t>& bucket_count : statistics->histogram) {
+      bucket_count.store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+void KernelCallProfiler::Dump() {
+  std::vector<Snapshot> snapshots = GetSnapshots();
+  if (snapshots.empty()) {
+    return;
+  }
+  double ticks_to_us = 1000000.0 / double(Clock::QueryHostTickFrequency());
+  XELOGI(
+      "Kernel call profiler: export, calls, total ms, wait ms, average us, "
+      "p50 us, p99 us, maximum us");
+  for (const Snapshot& snapshot : snapshots) {
+    XELOGI("{}!{}: {}, {:.3f}, {:.3f}, {:.3f}, {:.3f}, {:.3f}, {:.3f}",
+           snapshot.module_name, snapshot.export_name, snapshot.call_count,
+           double(snapshot.total_ticks) * ticks_to_us * 0.001,
+           double(snapshot.wait_ticks) * ticks_to_us * 0.001,
+           double(snapshot.total_ticks) * ticks_to_us /
+               double(snapshot.call_count),
+           double(snapshot.GetPercentileTicks(50.0)) * ticks_to_us,
+           double(snapshot.GetPercentileTicks(99.0)) * ticks_to_us,
+           double(snapshot.max_ticks) * ticks_to_us);
+  }
+}
+
+void KernelCallProfiler::Record(ExportStatistics& statistics, uint64_t ticks,
+                                uint64_t wait_ticks) {
+  statistics.call_count.fetch_add(1, std::memory_order_relaxed);
+  statistics.total_ticks.fetch_add(ticks, std::memory_order_relaxed);
+  if (wait_ticks) {
+    statistics.wait_ticks.fetch_add(wait_ticks, std::memory_order_relaxed);
+  }
+  uint64_t max_ticks = statistics.max_ticks.load(std::memory_order_relaxed);
+  while (ticks > max_ticks &&
+         !statistics.max_ticks.compare_exchange_weak(
+             max_ticks, ticks, std::memory_order_relaxed)) {
+  }
+  statistics.histogram[GetBucket(ticks)].fetch_add(1,
+                                                   std::memory_order_relaxed);
+}
+
+}  // namespace util
+}  // namespace kernel
+}  // namespace xe
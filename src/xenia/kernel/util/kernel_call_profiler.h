@@ -0,0 +1,152 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_KERNEL_UTIL_KERNEL_CALL_PROFILER_H_
+#define XENIA_KERNEL_UTIL_KERNEL_CALL_PROFILER_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "xenia/base/clock.h"
+#include "xenia/base/math.h"
+#include "xenia/cpu/export_resolver.h"
+
+namespace xe {
+namespace kernel {
+namespace util {
+
+// Per-export statistics of the host time spent in the kernel calls, enabled
+// with --kernel_call_profiler. The time spent blocked in waits within the
+// calls is tracked separately (the waits are marked with WaitScope), so the
+// exports doing much work on the host can be told apart from the ones only
+// waiting for the other guest threads. The latencies are recorded in a
+// log-linear histogram, with kSubBucketCount buckets per power of two of the
+// host ticks.
+class KernelCallProfiler {
+ public:
+  static constexpr uint32_t kSubBucketBits = 3;
+  static constexpr uint32_t kSubBucketCount = uint32_t(1) << kSubBucketBits;
+  static constexpr uint32_t kBucketCount =
+      (64 - kSubBucketBits + 1) * kSubBucketCount;
+
+  struct ExportStatistics {
+    const char* module_name;
+    const cpu::Export* export_entry;
+    std::atomic<uint64_t> call_count;
+    std::atomic<uint64_t> total_ticks;
+    std::atomic<uint64_t> wait_ticks;
+    std::atomic<uint64_t> max_ticks;
+    std::array<std::atomic<uint32_t>, kBucketCount> histogram;
+  };
+
+  struct Snapshot {
+    const char* module_name;
+    const char* export_name;
+    uint64_t call_count;
+    uint64_t total_ticks;
+    uint64_t wait_ticks;
+    uint64_t max_ticks;
+    std::array<uint32_t, kBucketCount> histogram;
+
+    // Upper bound of the latency of the calls at the percentile (0 to 100).
+    uint64_t GetPercentileTicks(double percentile) const;
+  };
+
+  // Whether --kernel_call_profiler is enabled.
+  static bool is_enabled();
+
+  // Starts collecting the statistics of the calls to the export, which must
+  // be called through its full trampoline.
+  static void AddExport(const char* module_name, cpu::Export* export_entry);
+
+  // Only the exports that have been called, from the one with the most time
+  // spent in it.
+  static std::vector<Snapshot> GetSnapshots();
+  static void Reset();
+  // Writes the statistics of the called exports to the log.
+  static void Dump();
+
+  static uint32_t GetBucket(uint64_t ticks) {
+    if (ticks < kSubBucketCount) {
+      return uint32_t(ticks);
+    }
+    uint32_t exponent = uint32_t(63 - xe::lzcnt(ticks)) - kSubBucketBits;
+    return (exponent + 1) * kSubBucketCount +
+           (uint32_t(ticks >> exponent) & (kSubBucketCount - 1));
+  }
+  static uint64_t GetBucketLowerBound(uint32_t bucket) {
+    if (bucket < kSubBucketCount) {
+      return bucket;
+    }
+    uint32_t exponent = bucket / kSubBucketCount - 1;
+    return uint64_t(kSubBucketCount | (bucket % kSubBucketCount)) << exponent;
+  }
+
+  // Wraps the body of a kernel export when the profiling is enabled.
+  class CallScope {
+   public:
+    // The statistics are Export::function_data::call_statistics, or nullptr
+    // to skip the profiling.
+    explicit CallScope(ExportStatistics* statistics) : statistics_(statistics) {
+      if (statistics_) {
+        start_wait_ticks_ = thread_wait_ticks_;
+        start_ticks_ = Clock::QueryHostTickCount();
+      }
+    }
+    CallScope(const CallScope& scope) = delete;
+    CallScope& operator=(const CallScope& scope) = delete;
+    ~CallScope() {
+      if (statistics_) {
+        Record(*statistics_, Clock::QueryHostTickCount() - start_ticks_,
+               thread_wait_ticks_ - start_wait_ticks_);
+      }
+    }
+
+   private:
+    ExportStatistics* statistics_;
+    uint64_t start_ticks_ = 0;
+    uint64_t start_wait_ticks_ = 0;
+  };
+
+  // Wraps the host waits done by the kernel on behalf of the guest.
+  class WaitScope {
+   public:
+    WaitScope()
+        : start_ticks_(collecting_ ? Clock::QueryHostTickCount() : 0) {}
+    WaitScope(const WaitScope& scope) = delete;
+    WaitScope& operator=(const WaitScope& scope) = delete;
+    ~WaitScope() {
+      if (start_ticks_) {
+        thread_wait_ticks_ += Clock::QueryHostTickCount() - start_ticks_;
+      }
+    }
+
+   private:
+    uint64_t start_ticks_;
+  };
+
+ private:
+  static void Record(ExportStatistics& statistics, uint64_t ticks,
+                     uint64_t wait_ticks);
+
+  // Whether any exports have been added.
+  static bool collecting_;
+  // Total time the thread has spent in waits, only the differences are
+  // meaningful.
+  static thread_local uint64_t thread_wait_ticks_;
+};
+
+}  // namespace util
+}  // namespace kernel
+}  // namespace xe
+
+#endif  // XENIA_KERNEL_UTIL_KERNEL_CALL_PROFILER_H_
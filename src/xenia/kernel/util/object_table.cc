@@ -10,10 +10,11 @@
 #include "xenia/kernel/util/object_table.h"
 
 #include <algorithm>
-#include <cstring>
+#include <new>
 
 #include "xenia/base/byte_stream.h"
 #include "xenia/base/logging.h"
+#include "xenia/base/threading.h"
 #include "xenia/kernel/xobject.h"
 #include "xenia/kernel/xthread.h"
 
@@ -21,7 +22,12 @@ namespace xe {
 namespace kernel {
 namespace util {
 
-ObjectTable::ObjectTable() {}
+ObjectTable::ObjectTable()
+    : segments_(new std::atomic<ObjectTableEntry*>[kMaxSegmentCount]) {
+  for (uint32_t i = 0; i < kMaxSegmentCount; ++i) {
+    segments_[i].store(nullptr, std::memory_order_relaxed);
+  }
+}
 
 ObjectTable::~ObjectTable() { Reset(); }
 
@@ -29,17 +35,32 @@ void ObjectTable::Reset() {
   auto global_lock = global_critical_region_.Acquire();
 
   // Release all objects.
+  std::vector<XObject*> objects;
   for (uint32_t n = 0; n < table_capacity_; n++) {
-    ObjectTableEntry& entry = table_[n];
-    if (entry.object) {
-      entry.object->Release();
+    ObjectTableEntry& entry = *GetEntry(n);
+    XObject* object = entry.object.exchange(nullptr, std::memory_order_relaxed);
+    if (object) {
+      objects.push_back(object);
     }
   }
+  WaitForLookups();
+  for (XObject* object : objects) {
+    object->Release();
+  }
 
+  // Not expecting any lookups on reset, but still not freeing the segments
+  // while they may still be accessed.
+  std::vector<ObjectTableEntry*> segments;
+  for (uint32_t i = 0; i < table_capacity_ / kSegmentSize; ++i) {
+    segments.push_back(
+        segments_[i].exchange(nullptr, std::memory_order_relaxed));
+  }
   table_capacity_ = 0;
   last_free_entry_ = 0;
-  free(table_);
-  table_ = nullptr;
+  WaitForLookups();
+  for (ObjectTableEntry* segment : segments) {
+    delete[] segment;
+  }
 }
 
 X_STATUS ObjectTable::FindFreeSlot(uint32_t* out_slot) {
@@ -47,8 +68,8 @@ X_STATUS ObjectTable::FindFreeSlot(uint32_t* out_slot) {
   uint32_t slot = last_free_entry_;
   uint32_t scan_count = 0;
   while (scan_count < table_capacity_) {
-    ObjectTableEntry& entry = table_[slot];
-    if (!entry.object) {
+    ObjectTableEntry& entry = *GetEntry(slot);
+    if (!entry.object.load(std::memory_order_relaxed)) {
       *out_slot = slot;
       return X_STATUS_SUCCESS;
     }
@@ -75,23 +96,24 @@ X_STATUS ObjectTable::FindFreeSlot(uint32_t* out_slot) {
 }
 
 bool ObjectTable::Resize(uint32_t new_capacity) {
-  uint32_t new_size = new_capacity * sizeof(ObjectTableEntry);
-  uint32_t old_size = table_capacity_ * sizeof(ObjectTableEntry);
-  auto new_table =
-      reinterpret_cast<ObjectTableEntry*>(realloc(table_, new_size));
-  if (!new_table) {
+  // The table can only grow, in whole segments.
+  if (new_capacity > kMaxSlotCount) {
     return false;
   }
-
-  // Zero out new entries.
-  if (new_size > old_size) {
-    std::memset(reinterpret_cast<uint8_t*>(new_table) + old_size, 0,
-                new_size - old_size);
+  uint32_t old_segment_count = table_capacity_ / kSegmentSize;
+  uint32_t new_segment_count =
+      std::max((new_capacity + kSegmentSize - 1) / kSegmentSize,
+               old_segment_count);
+  for (uint32_t i = old_segment_count; i < new_segment_count; ++i) {
+    auto segment = new (std::nothrow) ObjectTableEntry[kSegmentSize];
+    if (!segment) {
+      return false;
+    }
+    segments_[i].store(segment, std::memory_order_release);
+    table_capacity_ += kSegmentSize;
   }
 
-  last_free_entry_ = table_capacity_;
-  table_capacity_ = new_capacity;
-  table_ = new_table;
+  last_free_entry_ = old_segment_count * kSegmentSize;
 
   return true;
 }
@@ -109,8 +131,8 @@ X_STATUS ObjectTable::AddHandle(XObject* object, X_HANDLE* out_handle) {
 
     // Stash.
     if (XSUCCEEDED(result)) {
-      ObjectTableEntry& entry = table_[slot];
-      entry.object = object;
+      ObjectTableEntry& entry = *GetEntry(slot);
+      entry.object.store(object, std::memory_order_release);
       entry.handle_ref_count = 1;
       handle = XObject::kHandleBase + (slot << 2);
       object->handles().push_back(handle);
@@ -135,7 +157,7 @@ X_STATUS ObjectTable::DuplicateHandle(X_HANDLE handle, X_HANDLE* out_handle) {
   X_STATUS result = X_STATUS_SUCCESS;
   handle = TranslateHandle(handle);
 
-  XObject* object = LookupObject(handle, false);
+  XObject* object = LookupObject(handle);
   if (object) {
     result = AddHandle(object, out_handle);
     object->Release();  // Release the ref that LookupObject took
@@ -184,15 +206,14 @@ X_STATUS ObjectTable::RemoveHandle(X_HANDLE handle) {
     return X_STATUS_INVALID_HANDLE;
   }
 
+  auto global_lock = global_critical_region_.Acquire();
   ObjectTableEntry* entry = LookupTable(handle);
   if (!entry) {
     return X_STATUS_INVALID_HANDLE;
   }
 
-  auto global_lock = global_critical_region_.Acquire();
-  if (entry->object) {
-    auto object = entry->object;
-    entry->object = nullptr;
+  auto object = entry->object.exchange(nullptr, std::memory_order_relaxed);
+  if (object) {
     assert_zero(entry->handle_ref_count);
     entry->handle_ref_count = 0;
 
@@ -209,7 +230,9 @@ X_STATUS ObjectTable::RemoveHandle(X_HANDLE handle) {
     if (!object->name().empty()) {
       RemoveNameMapping(object->name());
     }
-    // Release now that the object has been removed from the table.
+    // Release now that the object has been removed from the table and can't
+    // be retained by the lookups anymore.
+    WaitForLookups();
     object->Release();
   }
 
@@ -221,11 +244,12 @@ std::vector<object_ref<XObject>> ObjectTable::GetAllObjects() {
   std::vector<object_ref<XObject>> results;
 
   for (uint32_t slot = 0; slot < table_capacity_; slot++) {
-    auto& entry = table_[slot];
-    if (entry.object && std::find(results.begin(), results.end(),
-                                  entry.object) == results.end()) {
-      entry.object->Retain();
-      results.push_back(object_ref<XObject>(entry.object));
+    XObject* object =
+        GetEntry(slot)->object.load(std::memory_order_relaxed);
+    if (object &&
+        std::find(results.begin(), results.end(), object) == results.end()) {
+      object->Retain();
+      results.push_back(object_ref<XObject>(object));
     }
   }
 
@@ -234,15 +258,20 @@ std::vector<object_ref<XObject>> ObjectTable::GetAllObjects() {
 
 void ObjectTable::PurgeAllObjects() {
   auto lock = global_critical_region_.Acquire();
+  std::vector<XObject*> objects;
   for (uint32_t slot = 0; slot < table_capacity_; slot++) {
-    auto& entry = table_[slot];
-    if (entry.object && !entry.object->is_host_object()) {
+    auto& entry = *GetEntry(slot);
+    XObject* object = entry.object.load(std::memory_order_relaxed);
+    if (object && !object->is_host_object()) {
       entry.handle_ref_count = 0;
-      entry.object->Release();
-
-      entry.object = nullptr;
+      entry.object.store(nullptr, std::memory_order_relaxed);
+      objects.push_back(object);
     }
   }
+  WaitForLookups();
+  for (XObject* object : objects) {
+    object->Release();
+  }
 }
 
 ObjectTable::ObjectTableEntry* ObjectTable::LookupTable(X_HANDLE handle) {
@@ -254,65 +283,76 @@ ObjectTable::ObjectTableEntry* ObjectTable::LookupTable(X_HANDLE handle) {
   auto global_lock = global_critical_region_.Acquire();
 
   // Lower 2 bits are ignored.
-  uint32_t slot = GetHandleSlot(handle);
-  if (slot <= table_capacity_) {
-    return &table_[slot];
-  }
-
-  return nullptr;
+  return GetEntry(GetHandleSlot(handle));
 }
 
 // Generic lookup
 template <>
 object_ref<XObject> ObjectTable::LookupObject<XObject>(X_HANDLE handle) {
-  auto object = ObjectTable::LookupObject(handle, false);
+  auto object = ObjectTable::LookupObject(handle);
   auto result = object_ref<XObject>(reinterpret_cast<XObject*>(object));
   return result;
 }
 
-XObject* ObjectTable::LookupObject(X_HANDLE handle, bool already_locked) {
+XObject* ObjectTable::LookupObject(X_HANDLE handle) {
   handle = TranslateHandle(handle);
   if (!handle) {
     return nullptr;
   }
 
-  XObject* object = nullptr;
-  if (!already_locked) {
-    global_critical_region_.mutex().lock();
-  }
-
-  // Lower 2 bits are ignored.
+  // Lower 2 bits are ignored. Handles below the base wrap around to slots
+  // beyond the maximum.
   uint32_t slot = GetHandleSlot(handle);
+  if (slot >= kMaxSlotCount) {
+    return nullptr;
+  }
 
-  // Verify slot.
-  if (slot < table_capacity_) {
-    ObjectTableEntry& entry = table_[slot];
-    if (entry.object) {
-      object = entry.object;
+  // Enter the epoch, retrying if it has been switched concurrently, as the
+  // writer may have not seen this reader in the previous epoch.
+  uint32_t epoch;
+  while (true) {
+    epoch = lookup_epoch_.load();
+    lookup_readers_[epoch].fetch_add(1);
+    if (lookup_epoch_.load() == epoch) {
+      break;
     }
+    lookup_readers_[epoch].fetch_sub(1);
   }
 
   // Retain the object pointer.
-  if (object) {
-    object->Retain();
+  XObject* object = nullptr;
+  ObjectTableEntry* segment =
+      segments_[slot / kSegmentSize].load(std::memory_order_acquire);
+  if (segment) {
+    object =
+        segment[slot % kSegmentSize].object.load(std::memory_order_acquire);
+    if (object) {
+      object->Retain();
+    }
   }
 
-  if (!already_locked) {
-    global_critical_region_.mutex().unlock();
-  }
+  lookup_readers_[epoch].fetch_sub(1, std::memory_order_release);
 
   return object;
 }
 
+void ObjectTable::WaitForLookups() {
+  uint32_t epoch = lookup_epoch_.load(std::memory_order_relaxed);
+  lookup_epoch_.store(epoch ^ 1);
+  while (lookup_readers_[epoch].load(std::memory_order_acquire)) {
+    xe::threading::MaybeYield();
+  }
+}
+
 void ObjectTable::GetObjectsByType(XObject::Type type,
                                    std::vector<object_ref<XObject>>* results) {
   auto global_lock = global_critical_region_.Acquire();
   for (uint32_t slot = 0; slot < table_capacity_; ++slot) {
-    auto& entry = table_[slot];
-    if (entry.object) {
-      if (entry.object->type() == type) {
-        entry.object->Retain();
-        results->push_back(object_ref<XObject>(entry.object));
+    XObject* object = GetEntry(slot)->object.load(std::memory_order_relaxed);
+    if (object) {
+      if (object->type() == type) {
+        object->Retain();
+        results->push_back(object_ref<XObject>(object));
       }
     }
   }
@@ -362,7 +402,7 @@ X_STATUS ObjectTable::GetObjectByName(const std::string_view name,
   *out_handle = it->second;
 
   // We need to ref the handle. I think.
-  auto obj = LookupObject(it->second, true);
+  auto obj = LookupObject(it->second);
   if (obj) {
     obj->RetainHandle();
     obj->Release();
@@ -374,17 +414,19 @@ X_STATUS ObjectTable::GetObjectByName(const std::string_view name,
 bool ObjectTable::Save(ByteStream* stream) {
   stream->Write<uint32_t>(table_capacity_);
   for (uint32_t i = 0; i < table_capacity_; i++) {
-    auto& entry = table_[i];
-    stream->Write<int32_t>(entry.handle_ref_count);
+    stream->Write<int32_t>(GetEntry(i)->handle_ref_count);
   }
 
   return true;
 }
 
 bool ObjectTable::Restore(ByteStream* stream) {
-  Resize(stream->Read<uint32_t>());
-  for (uint32_t i = 0; i < table_capacity_; i++) {
-    auto& entry = table_[i];
+  uint32_t capacity = stream->Read<uint32_t>();
+  if (!Resize(capacity)) {
+    return false;
+  }
+  for (uint32_t i = 0; i < capacity; i++) {
+    auto& entry = *GetEntry(i);
     // entry.object = nullptr;
     entry.handle_ref_count = stream->Read<int32_t>();
   }
@@ -393,12 +435,13 @@ bool ObjectTable::Restore(ByteStream* stream) {
 }
 
 X_STATUS ObjectTable::RestoreHandle(X_HANDLE handle, XObject* object) {
+  auto global_lock = global_critical_region_.Acquire();
   uint32_t slot = GetHandleSlot(handle);
-  assert_true(table_capacity_ >= slot);
+  ObjectTableEntry* entry = GetEntry(slot);
+  assert_not_null(entry);
 
-  if (table_capacity_ >= slot) {
-    auto& entry = table_[slot];
-    entry.object = object;
+  if (entry) {
+    entry->object.store(object, std::memory_order_release);
     object->Retain();
   }
 
@@ -10,6 +10,8 @@
 #ifndef XENIA_KERNEL_UTIL_OBJECT_TABLE_H_
 #define XENIA_KERNEL_UTIL_OBJECT_TABLE_H_
 
+#include <atomic>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -47,9 +49,10 @@ class ObjectTable {
   // not use.
   X_STATUS RestoreHandle(X_HANDLE handle, XObject* object);
 
+  // Lookups don't take the lock of the table.
   template <typename T>
   object_ref<T> LookupObject(X_HANDLE handle) {
-    auto object = LookupObject(handle, false);
+    auto object = LookupObject(handle);
     if (object) {
       assert_true(object->type() == T::kObjectType);
     }
@@ -83,11 +86,31 @@ class ObjectTable {
  private:
   struct ObjectTableEntry {
     int handle_ref_count = 0;
-    XObject* object = nullptr;
+    // Written with the lock held, read without it by LookupObject.
+    std::atomic<XObject*> object{nullptr};
   };
 
+  // The entries are allocated in segments that are never moved or freed while
+  // the table is in use, so lookups can access them without the lock.
+  static constexpr uint32_t kSegmentSize = 16 * 1024;
+  static constexpr uint32_t kMaxSlotCount =
+      uint32_t((uint64_t(UINT32_MAX) + 1 - XObject::kHandleBase) >> 2);
+  static constexpr uint32_t kMaxSegmentCount = kMaxSlotCount / kSegmentSize;
+
+  // Requires the lock to be held.
+  ObjectTableEntry* GetEntry(uint32_t slot) const {
+    if (slot >= table_capacity_) {
+      return nullptr;
+    }
+    return &segments_[slot / kSegmentSize].load(
+        std::memory_order_relaxed)[slot % kSegmentSize];
+  }
   ObjectTableEntry* LookupTable(X_HANDLE handle);
-  XObject* LookupObject(X_HANDLE handle, bool already_locked);
+  XObject* LookupObject(X_HANDLE handle);
+  // Must be called with the lock held after clearing entries and before
+  // releasing the references of the table to their objects, to wait for the
+  // lookups that may still be retaining them.
+  void WaitForLookups();
   void GetObjectsByType(XObject::Type type,
                         std::vector<object_ref<XObject>>* results);
 
@@ -100,8 +123,13 @@ class ObjectTable {
 
   xe::global_critical_region global_critical_region_;
   uint32_t table_capacity_ = 0;
-  ObjectTableEntry* table_ = nullptr;
+  std::unique_ptr<std::atomic<ObjectTableEntry*>[]> segments_;
   uint32_t last_free_entry_ = 0;
+  // Lookups increment the reader count of the current epoch while accessing
+  // the table. WaitForLookups switches the epoch and waits for the readers of
+  // the previous one to finish.
+  std::atomic<uint32_t> lookup_epoch_{0};
+  std::atomic<uint32_t> lookup_readers_[2] = {};
   std::unordered_map<string_key_case, X_HANDLE> name_table_;
 };
 
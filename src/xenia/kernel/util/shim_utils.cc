@@ -17,6 +17,35 @@ thread_local StringBuffer string_buffer_;
 
 StringBuffer* thread_local_string_buffer() { return &string_buffer_; }
 
+void SelectExportTrampolines(const char* module_name,
+                             const std::vector<xe::cpu::Export*>& exports) {
+  bool profile_calls = util::KernelCallProfiler::is_enabled();
+  for (xe::cpu::Export* export_entry : exports) {
+    if (!export_entry ||
+        export_entry->type != xe::cpu::Export::Type::kFunction ||
+        !export_entry->function_data.fast_trampoline) {
+      continue;
+    }
+    if (profile_calls) {
+      // Profiled in the full trampoline.
+      util::KernelCallProfiler::AddExport(module_name, export_entry);
+      continue;
+    }
+    bool log_call =
+        (export_entry->tags & xe::cpu::ExportTag::kLog) &&
+        (!(export_entry->tags & xe::cpu::ExportTag::kHighFrequency) ||
+         cvars::log_high_frequency_kernel_calls) &&
+        xe::logging::internal::ShouldLog(
+            (export_entry->tags & xe::cpu::ExportTag::kImportant)
+                ? xe::LogLevel::Info
+                : xe::LogLevel::Debug);
+    if (!log_call) {
+      export_entry->function_data.trampoline =
+          export_entry->function_data.fast_trampoline;
+    }
+  }
+}
+
 }  // namespace shim
 }  // namespace kernel
 }  // namespace xe
@@ -13,6 +13,7 @@
 #include <cstring>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "third_party/fmt/include/fmt/format.h"
 #include "xenia/base/byte_order.h"
@@ -23,6 +24,7 @@
 #include "xenia/cpu/ppc/ppc_context.h"
 #include "xenia/kernel/kernel_flags.h"
 #include "xenia/kernel/kernel_state.h"
+#include "xenia/kernel/util/kernel_call_profiler.h"
 
 namespace xe {
 namespace kernel {
@@ -493,6 +495,13 @@ StringBuffer* thread_local_string_buffer();
 
 template <typename Tuple>
 void PrintKernelCall(cpu::Export* export_entry, const Tuple& params) {
+  // Don't format the call if it will be dropped anyway.
+  if (!xe::logging::internal::ShouldLog(
+          (export_entry->tags & xe::cpu::ExportTag::kImportant)
+              ? xe::LogLevel::Info
+              : xe::LogLevel::Debug)) {
+    return;
+  }
   auto& string_buffer = *thread_local_string_buffer();
   string_buffer.Reset();
   string_buffer.Append(export_entry->name);
@@ -513,6 +522,49 @@ auto KernelTrampoline(F&& f, Tuple&& t, std::index_sequence<I...>) {
   return std::forward<F>(f)(std::get<I>(std::forward<Tuple>(t))...);
 }
 
+// With kLogCall false, the checks of whether the call needs to be logged are
+// skipped entirely.
+template <bool kLogCall, typename R, typename... Ps>
+void CallExport(xe::cpu::Export* export_entry, R (*fn)(Ps&...),
+                PPCContext* ppc_context) {
+  ++export_entry->function_data.call_count;
+  Param::Init init = {
+      ppc_context,
+      0,
+  };
+  // Using braces initializer instead of make_tuple because braces
+  // enforce execution order across compilers.
+  // The make_tuple order is undefined per the C++ standard and
+  // cause inconsitencies between msvc and clang.
+  std::tuple<Ps...> params = {Ps(init)...};
+  if constexpr (kLogCall) {
+    if (export_entry->tags & xe::cpu::ExportTag::kLog &&
+        (!(export_entry->tags & xe::cpu::ExportTag::kHighFrequency) ||
+         cvars::log_high_frequency_kernel_calls)) {
+      PrintKernelCall(export_entry, params);
+    }
+  }
+  // Only the full trampolines are used when the calls are profiled.
+  util::KernelCallProfiler::CallScope profiler_scope(
+      kLogCall ? static_cast<util::KernelCallProfiler::ExportStatistics*>(
+                     export_entry->function_data.call_statistics)
+               : nullptr);
+  if constexpr (std::is_void<R>::value) {
+    KernelTrampoline(fn, std::forward<std::tuple<Ps...>>(params),
+                     std::make_index_sequence<sizeof...(Ps)>());
+  } else {
+    auto result = KernelTrampoline(fn, std::forward<std::tuple<Ps...>>(params),
+                                   std::make_index_sequence<sizeof...(Ps)>());
+    result.Store(ppc_context);
+    if constexpr (kLogCall) {
+      if (export_entry->tags &
+          (xe::cpu::ExportTag::kLog | xe::cpu::ExportTag::kLogResult)) {
+        // TODO(benvanik): log result.
+      }
+    }
+  }
+}
+
 template <KernelModuleId MODULE, uint16_t ORDINAL, typename R, typename... Ps>
 xe::cpu::Export* RegisterExport(R (*fn)(Ps&...), const char* name,
                                 xe::cpu::ExportTag::type tags) {
@@ -527,40 +579,24 @@ xe::cpu::Export* RegisterExport(R (*fn)(Ps&...), const char* name,
   static R (*FN)(Ps & ...) = fn;
   struct X {
     static void Trampoline(PPCContext* ppc_context) {
-      ++export_entry->function_data.call_count;
-      Param::Init init = {
-          ppc_context,
-          0,
-      };
-      // Using braces initializer instead of make_tuple because braces
-      // enforce execution order across compilers.
-      // The make_tuple order is undefined per the C++ standard and
-      // cause inconsitencies between msvc and clang.
-      std::tuple<Ps...> params = {Ps(init)...};
-      if (export_entry->tags & xe::cpu::ExportTag::kLog &&
-          (!(export_entry->tags & xe::cpu::ExportTag::kHighFrequency) ||
-           cvars::log_high_frequency_kernel_calls)) {
-        PrintKernelCall(export_entry, params);
-      }
-      if constexpr (std::is_void<R>::value) {
-        KernelTrampoline(FN, std::forward<std::tuple<Ps...>>(params),
-                         std::make_index_sequence<sizeof...(Ps)>());
-      } else {
-        auto result =
-            KernelTrampoline(FN, std::forward<std::tuple<Ps...>>(params),
-                             std::make_index_sequence<sizeof...(Ps)>());
-        result.Store(ppc_context);
-        if (export_entry->tags &
-            (xe::cpu::ExportTag::kLog | xe::cpu::ExportTag::kLogResult)) {
-          // TODO(benvanik): log result.
-        }
-      }
+      CallExport<true>(export_entry, FN, ppc_context);
+    }
+    static void FastTrampoline(PPCContext* ppc_context) {
+      CallExport<false>(export_entry, FN, ppc_context);
     }
   };
   export_entry->function_data.trampoline = &X::Trampoline;
+  export_entry->function_data.fast_trampoline = &X::FastTrampoline;
   return export_entry;
 }
 
+// Switches the exports which calls wouldn't be logged with the current
+// logging configuration to their fast trampolines, or adds them to the kernel
+// call profiler if it's enabled. Must be done before the imports are
+// resolved, but after the configuration has been loaded.
+void SelectExportTrampolines(const char* module_name,
+                             const std::vector<xe::cpu::Export*>& exports);
+
 }  // namespace shim
 
 using xe::cpu::ExportTag;
@@ -86,6 +86,34 @@ std::string XdbfWrapper::GetStringTableEntry(XLanguage language,
   return "";
 }
 
+XdbfStringTable XdbfWrapper::GetStringTable(XLanguage language) const {
+  XdbfStringTable table;
+
+  auto language_block =
+      GetEntry(XdbfSection::kStringTable, static_cast<uint64_t>(language));
+  if (!language_block) {
+    return table;
+  }
+
+  auto xstr_head =
+      reinterpret_cast<const XdbfSectionHeader*>(language_block.buffer);
+  assert_true(xstr_head->magic == kXdbfSignatureXstr);
+  assert_true(xstr_head->version == 1);
+
+  table.strings_.reserve(xstr_head->count);
+  const uint8_t* ptr = language_block.buffer + sizeof(XdbfSectionHeader);
+  for (uint16_t i = 0; i < xstr_head->count; ++i) {
+    auto entry = reinterpret_cast<const XdbfStringTableEntry*>(ptr);
+    ptr += sizeof(XdbfStringTableEntry);
+    // Keeping the first occurrence, like GetStringTableEntry.
+    table.strings_.emplace(
+        entry->id, std::string_view(reinterpret_cast<const char*>(ptr),
+                                    entry->string_length));
+    ptr += entry->string_length;
+  }
+  return table;
+}
+
 std::vector<XdbfAchievementTableEntry> XdbfWrapper::GetAchievements() const {
   std::vector<XdbfAchievementTableEntry> achievements;
 
@@ -11,6 +11,8 @@
 #define XENIA_KERNEL_UTIL_XDBF_UTILS_H_
 
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "xenia/base/memory.h"
@@ -100,6 +102,22 @@ struct XdbfBlock {
   operator bool() const { return buffer != nullptr; }
 };
 
+// All strings of one language from an XDBF string table, for looking up many
+// of them without scanning the entries and the table for each. The strings
+// point into the database memory.
+class XdbfStringTable {
+ public:
+  // Returns the empty string if the entry is not found.
+  std::string_view Get(uint16_t string_id) const {
+    auto it = strings_.find(string_id);
+    return it != strings_.cend() ? it->second : std::string_view();
+  }
+
+ private:
+  friend class XdbfWrapper;
+  std::unordered_map<uint16_t, std::string_view> strings_;
+};
+
 // Wraps an XBDF (XboxDataBaseFormat) in-memory database.
 // https://free60project.github.io/wiki/XDBF.html
 class XdbfWrapper {
@@ -116,6 +134,8 @@ class XdbfWrapper {
   // Gets a string from the string table in the given language.
   // Returns the empty string if the entry is not found.
   std::string GetStringTableEntry(XLanguage language, uint16_t string_id) const;
+  // Gets the whole string table in the given language, empty if not found.
+  XdbfStringTable GetStringTable(XLanguage language) const;
   std::vector<XdbfAchievementTableEntry> GetAchievements() const;
 
  private:
@@ -12,6 +12,7 @@
 #include <string>
 
 #include "third_party/fmt/include/fmt/format.h"
+#include "xenia/base/clock.h"
 #include "xenia/base/filesystem.h"
 #include "xenia/base/string.h"
 #include "xenia/kernel/kernel_state.h"
@@ -29,18 +30,20 @@ static const char* kGameUserContentDirName = "profile";
 
 static int content_device_id_ = 0;
 
+// Listings of directories modified less than this long ago (in 100 ns units)
+// are not reused, as the modification time may have a resolution of up to 2
+// seconds depending on the host file system.
+static const uint64_t kPackageRootListingTimestampMargin = 3 * 10000000ull;
+
 ContentPackage::ContentPackage(KernelState* kernel_state,
                                const std::string_view root_name,
                                const XCONTENT_AGGREGATE_DATA& data,
-                               const std::filesystem::path& package_path)
+                               std::shared_ptr<vfs::Device> device)
     : kernel_state_(kernel_state), root_name_(root_name) {
-  device_path_ = fmt::format("\\Device\\Content\\{0}\\", ++content_device_id_);
+  device_path_ = device->mount_path();
   content_data_ = data;
 
   auto fs = kernel_state_->file_system();
-  auto device =
-      std::make_unique<vfs::HostPathDevice>(device_path_, package_path, false);
-  device->Initialize();
   fs->RegisterDevice(std::move(device));
   fs->RegisterSymbolicLink(root_name_ + ":", device_path_);
 }
@@ -89,22 +92,69 @@ std::vector<XCONTENT_AGGREGATE_DATA> ContentManager::ListContent(
   // Search path:
   // content_root/title_id/type_name/*
   auto package_root = ResolvePackageRoot(content_type, title_id);
-  auto file_infos = xe::filesystem::ListFiles(package_root);
-  for (const auto& file_info : file_infos) {
+  auto packages = ListPackages(package_root, content_type, title_id);
+  if (packages) {
+    result.reserve(packages->size());
+    for (const XCONTENT_AGGREGATE_DATA& package : *packages) {
+      XCONTENT_AGGREGATE_DATA& content_data = result.emplace_back(package);
+      content_data.device_id = device_id;
+    }
+  }
+
+  return result;
+}
+
+std::shared_ptr<const std::vector<XCONTENT_AGGREGATE_DATA>>
+ContentManager::ListPackages(const std::filesystem::path& package_root,
+                             XContentType content_type, uint32_t title_id) {
+  std::string key = xe::path_to_utf8(package_root);
+  std::lock_guard<std::mutex> lock(package_root_listings_mutex_);
+
+  // Titles may enumerate the content every frame, so instead of listing the
+  // directory and querying all its children, only its modification time,
+  // which changes when children are added, removed or renamed, is checked.
+  xe::filesystem::FileInfo root_info;
+  if (!xe::filesystem::GetInfo(package_root, &root_info) ||
+      root_info.type != xe::filesystem::FileInfo::Type::kDirectory) {
+    package_root_listings_.erase(key);
+    return nullptr;
+  }
+  auto it = package_root_listings_.find(key);
+  if (it != package_root_listings_.end() && it->second.reusable &&
+      it->second.write_timestamp == root_info.write_timestamp) {
+    return it->second.packages;
+  }
+
+  PackageRootListing listing;
+  listing.write_timestamp = root_info.write_timestamp;
+  uint64_t list_time = Clock::QueryHostSystemTime();
+  listing.reusable =
+      list_time >= root_info.write_timestamp &&
+      list_time - root_info.write_timestamp >=
+          kPackageRootListingTimestampMargin;
+  auto packages = std::make_shared<std::vector<XCONTENT_AGGREGATE_DATA>>();
+  for (const auto& file_info : xe::filesystem::ListFiles(package_root)) {
     if (file_info.type != xe::filesystem::FileInfo::Type::kDirectory) {
       // Directories only.
       continue;
     }
-    XCONTENT_AGGREGATE_DATA content_data;
-    content_data.device_id = device_id;
+    XCONTENT_AGGREGATE_DATA& content_data = packages->emplace_back();
+    content_data.device_id = 0;
     content_data.content_type = content_type;
     content_data.set_display_name(xe::path_to_utf16(file_info.name));
     content_data.set_file_name(xe::path_to_utf8(file_info.name));
+    content_data.unk134 = 0;
     content_data.title_id = title_id;
-    result.emplace_back(std::move(content_data));
   }
+  listing.packages = packages;
+  package_root_listings_[key] = std::move(listing);
+  return packages;
+}
 
-  return result;
+void ContentManager::InvalidatePackageRootListing(
+    const std::filesystem::path& package_root) {
+  std::lock_guard<std::mutex> lock(package_root_listings_mutex_);
+  package_root_listings_.erase(xe::path_to_utf8(package_root));
 }
 
 std::unique_ptr<ContentPackage> ContentManager::ResolvePackage(
@@ -116,11 +166,41 @@ std::unique_ptr<ContentPackage> ContentManager::ResolvePackage(
 
   auto global_lock = global_critical_region_.Acquire();
 
-  auto package = std::make_unique<ContentPackage>(kernel_state_, root_name,
-                                                  data, package_path);
+  auto package = std::make_unique<ContentPackage>(
+      kernel_state_, root_name, data, GetPackageDevice(package_path));
   return package;
 }
 
+std::shared_ptr<vfs::Device> ContentManager::GetPackageDevice(
+    const std::filesystem::path& package_path) {
+  std::string key = xe::path_to_utf8(package_path);
+  auto it = package_devices_.find(key);
+  bool is_cacheable = true;
+  if (it != package_devices_.end()) {
+    if (it->second.write_timestamp == UINT64_MAX) {
+      // Already open with a different root name.
+      is_cacheable = false;
+    } else {
+      xe::filesystem::FileInfo package_info;
+      if (xe::filesystem::GetInfo(package_path, &package_info) &&
+          package_info.write_timestamp == it->second.write_timestamp) {
+        it->second.write_timestamp = UINT64_MAX;
+        return it->second.device;
+      }
+      package_devices_.erase(it);
+    }
+  }
+
+  auto device = std::make_shared<vfs::HostPathDevice>(
+      fmt::format("\\Device\\Content\\{0}\\", ++content_device_id_),
+      package_path, false);
+  device->Initialize();
+  if (is_cacheable) {
+    package_devices_.emplace(key, PackageDevice{device, UINT64_MAX});
+  }
+  return device;
+}
+
 bool ContentManager::ContentExists(const XCONTENT_AGGREGATE_DATA& data) {
   auto path = ResolvePackagePath(data);
   return std::filesystem::exists(path);
@@ -144,6 +224,8 @@ X_RESULT ContentManager::CreateContent(const std::string_view root_name,
   if (!std::filesystem::create_directories(package_path)) {
     return X_ERROR_ACCESS_DENIED;
   }
+  InvalidatePackageRootListing(
+      ResolvePackageRoot(data.content_type, data.title_id));
 
   auto package = ResolvePackage(root_name, data);
   assert_not_null(package);
@@ -188,8 +270,23 @@ X_RESULT ContentManager::CloseContent(const std::string_view root_name) {
 
   auto package = it->second;
   open_packages_.erase(it);
+  auto package_path = ResolvePackagePath(package->GetPackageContentData());
+  std::string device_path = package->device_path();
   delete package;
 
+  // Allow reusing the device if the package is opened again without being
+  // modified on the host.
+  auto device_it = package_devices_.find(xe::path_to_utf8(package_path));
+  if (device_it != package_devices_.end() &&
+      device_it->second.device->mount_path() == device_path) {
+    xe::filesystem::FileInfo package_info;
+    if (xe::filesystem::GetInfo(package_path, &package_info)) {
+      device_it->second.write_timestamp = package_info.write_timestamp;
+    } else {
+      package_devices_.erase(device_it);
+    }
+  }
+
   return X_ERROR_SUCCESS;
 }
 
@@ -218,6 +315,8 @@ X_RESULT ContentManager::SetContentThumbnail(
   auto package_path = ResolvePackagePath(data);
   std::filesystem::create_directories(package_path);
   if (std::filesystem::exists(package_path)) {
+    // Written directly on the host, bypassing the entry tree of the device.
+    package_devices_.erase(xe::path_to_utf8(package_path));
     auto thumb_path = package_path / kThumbnailFileName;
     auto file = xe::filesystem::OpenFile(thumb_path, "wb");
     fwrite(buffer.data(), 1, buffer.size(), file);
@@ -237,6 +336,9 @@ X_RESULT ContentManager::DeleteContent(const XCONTENT_AGGREGATE_DATA& data) {
   }
 
   auto package_path = ResolvePackagePath(data);
+  package_devices_.erase(xe::path_to_utf8(package_path));
+  InvalidatePackageRootListing(
+      ResolvePackageRoot(data.content_type, data.title_id));
   if (std::filesystem::remove_all(package_path) > 0) {
     return X_ERROR_SUCCESS;
   } else {
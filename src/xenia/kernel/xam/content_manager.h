@@ -10,7 +10,9 @@
 #ifndef XENIA_KERNEL_XAM_CONTENT_MANAGER_H_
 #define XENIA_KERNEL_XAM_CONTENT_MANAGER_H_
 
+#include <filesystem>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -19,6 +21,7 @@
 #include "xenia/base/mutex.h"
 #include "xenia/base/string_key.h"
 #include "xenia/base/string_util.h"
+#include "xenia/vfs/device.h"
 #include "xenia/xbox.h"
 
 namespace xe {
@@ -119,14 +122,16 @@ static_assert_size(XCONTENT_AGGREGATE_DATA, 0x148);
 
 class ContentPackage {
  public:
+  // The device must be initialized and not registered in the file system.
   ContentPackage(KernelState* kernel_state, const std::string_view root_name,
                  const XCONTENT_AGGREGATE_DATA& data,
-                 const std::filesystem::path& package_path);
+                 std::shared_ptr<vfs::Device> device);
   ~ContentPackage();
 
   const XCONTENT_AGGREGATE_DATA& GetPackageContentData() const {
     return content_data_;
   }
+  const std::string& device_path() const { return device_path_; }
 
  private:
   KernelState* kernel_state_;
@@ -168,12 +173,48 @@ class ContentManager {
                                            uint32_t title_id = -1);
   std::filesystem::path ResolvePackagePath(const XCONTENT_AGGREGATE_DATA& data);
 
+  // Returns the content data, without the device ID, of the package
+  // directories in the package root, listing the directory only if it has been
+  // modified since the last call. The list is immutable and shared between the
+  // callers until the directory is modified. Null if the root doesn't exist.
+  std::shared_ptr<const std::vector<XCONTENT_AGGREGATE_DATA>> ListPackages(
+      const std::filesystem::path& package_root, XContentType content_type,
+      uint32_t title_id);
+  void InvalidatePackageRootListing(const std::filesystem::path& package_root);
+  // Requires the global lock.
+  std::shared_ptr<vfs::Device> GetPackageDevice(
+      const std::filesystem::path& package_path);
+
   KernelState* kernel_state_;
   std::filesystem::path root_path_;
 
+  struct PackageRootListing {
+    // Modification time of the package root when it was listed.
+    uint64_t write_timestamp;
+    // Whether the package root was modified long enough before listing that no
+    // changes within the resolution of its modification time could be missed.
+    bool reusable;
+    std::shared_ptr<const std::vector<XCONTENT_AGGREGATE_DATA>> packages;
+  };
+  std::mutex package_root_listings_mutex_;
+  std::unordered_map<std::string, PackageRootListing> package_root_listings_;
+
   // TODO(benvanik): remove use of global lock, it's bad here!
   xe::global_critical_region global_critical_region_;
   std::unordered_map<string_key, ContentPackage*> open_packages_;
+  // Devices of the packages, with the entry trees kept populated after the
+  // packages are closed, so mounting them again doesn't walk the whole package
+  // directory. Changes made from the guest are reflected in the tree, however,
+  // ones made on the host while the package is closed are only detected by the
+  // modification time of the package directory itself.
+  // Requires the global lock.
+  struct PackageDevice {
+    std::shared_ptr<vfs::Device> device;
+    // Modification time of the package directory when it was last closed, or
+    // UINT64_MAX if it's open.
+    uint64_t write_timestamp;
+  };
+  std::unordered_map<std::string, PackageDevice> package_devices_;
 };
 
 }  // namespace xam
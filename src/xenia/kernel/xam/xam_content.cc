@@ -98,6 +98,7 @@ dword_result_t XamContentCreateEnumerator_entry(
     auto content_datas = kernel_state()->content_manager()->ListContent(
         static_cast<uint32_t>(DummyDeviceId::HDD),
         XContentType(uint32_t(content_type)));
+    e->ReserveItems(content_datas.size());
     for (const auto& content_data : content_datas) {
       auto item = e->AppendItem();
       *item = content_data;
@@ -117,6 +117,7 @@ dword_result_t XamContentAggregateCreateEnumerator_entry(qword_t xuid,
       auto content_datas = kernel_state()->content_manager()->ListContent(
           static_cast<uint32_t>(DummyDeviceId::HDD), content_type_enum,
           title_id);
+      e->ReserveItems(content_datas.size());
       for (const auto& content_data : content_datas) {
         auto item = e->AppendItem();
         assert_not_null(item);
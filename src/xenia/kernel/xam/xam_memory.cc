@@ -0,0 +1,142 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#include "xenia/base/memory.h"
+#include "xenia/base/mutex.h"
+#include "xenia/base/threading.h"
+#include "xenia/kernel/kernel_state.h"
+#include "xenia/kernel/util/shim_utils.h"
+#include "xenia/kernel/xam/xam_private.h"
+#include "xenia/memory.h"
+#include "xenia/xbox.h"
+
+namespace xe {
+namespace kernel {
+namespace xam {
+
+// Copies and fills larger than this are split across the task scheduler
+// workers.
+constexpr uint32_t kXMemParallelMinSize = 4 * 1024 * 1024;
+constexpr uint32_t kXMemParallelChunkSize = 1024 * 1024;
+// Copies larger than this are likely to exceed the host caches, and bypass
+// them.
+constexpr uint32_t kXMemNonTemporalMinSize = 2 * 1024 * 1024;
+
+// Games often copy to texture and vertex buffer memory - in this case, if the
+// whole destination is in one physical heap and writable, writing through the
+// physical memory mapping, bypassing the host protection, so after writing,
+// the invalidation callbacks are triggered once for the entire range instead
+// of from access violations page by page.
+static uint8_t* TranslateXMemDestination(uint32_t address, uint32_t length,
+                                         xe::PhysicalHeap** physical_heap_out) {
+  Memory* memory = kernel_memory();
+  *physical_heap_out = nullptr;
+  uint32_t high_address = address + length - 1;
+  xe::BaseHeap* heap = memory->LookupHeap(address);
+  if (heap && heap->heap_type() == HeapType::kGuestPhysical &&
+      heap == memory->LookupHeap(high_address) &&
+      heap->QueryRangeAccess(address, high_address) ==
+          xe::memory::PageAccess::kReadWrite) {
+    auto physical_heap = static_cast<xe::PhysicalHeap*>(heap);
+    *physical_heap_out = physical_heap;
+    return memory->TranslatePhysical(
+        physical_heap->GetPhysicalAddress(address));
+  }
+  return memory->TranslateVirtual(address);
+}
+
+static void XMemFinishDestination(uint32_t address, uint32_t length,
+                                  xe::PhysicalHeap* physical_heap) {
+  if (physical_heap) {
+    physical_heap->TriggerCallbacks(xe::global_critical_region::AcquireDirect(),
+                                    address, length, true, true);
+  }
+}
+
+static void XMemForEachChunk(
+    uint32_t length,
+    const std::function<void(size_t offset, size_t size)>& function) {
+  if (length < kXMemParallelMinSize) {
+    function(0, length);
+    return;
+  }
+  size_t chunk_count =
+      (length + kXMemParallelChunkSize - 1) / kXMemParallelChunkSize;
+  xe::threading::ParallelFor(chunk_count, [&](size_t index) {
+    size_t offset = index * kXMemParallelChunkSize;
+    function(offset,
+             std::min(size_t(kXMemParallelChunkSize), length - offset));
+  });
+}
+
+static void XMemCopy(uint32_t dest_address, uint32_t src_address,
+                     uint32_t length, bool streaming) {
+  if (!length) {
+    return;
+  }
+  xe::PhysicalHeap* dest_physical_heap;
+  uint8_t* dest =
+      TranslateXMemDestination(dest_address, length, &dest_physical_heap);
+  const uint8_t* src = kernel_memory()->TranslateVirtual(src_address);
+  if (dest_address < src_address + length &&
+      src_address < dest_address + length) {
+    // Overlapping, must be copied sequentially.
+    std::memmove(dest, src, length);
+  } else {
+    bool non_temporal = streaming || length >= kXMemNonTemporalMinSize;
+    XMemForEachChunk(length, [&](size_t offset, size_t size) {
+      if (non_temporal) {
+        xe::copy_non_temporal(dest + offset, src + offset, size);
+      } else {
+        std::memcpy(dest + offset, src + offset, size);
+      }
+    });
+  }
+  XMemFinishDestination(dest_address, length, dest_physical_heap);
+}
+
+dword_result_t XMemCpy_entry(lpvoid_t dest, lpvoid_t src, dword_t length) {
+  XMemCopy(dest.guest_address(), src.guest_address(), length, false);
+  return dest.guest_address();
+}
+DECLARE_XAM_EXPORT2(XMemCpy, kMemory, kImplemented, kHighFrequency);
+
+dword_result_t XMemCpyStreaming_entry(lpvoid_t dest, lpvoid_t src,
+                                      dword_t length) {
+  // Streaming copies are for data not accessed by the CPU soon, such as
+  // GPU resources.
+  XMemCopy(dest.guest_address(), src.guest_address(), length, true);
+  return dest.guest_address();
+}
+DECLARE_XAM_EXPORT2(XMemCpyStreaming, kMemory, kImplemented, kHighFrequency);
+
+dword_result_t XMemSet_entry(lpvoid_t dest, dword_t value, dword_t length) {
+  uint32_t dest_address = dest.guest_address();
+  if (length) {
+    xe::PhysicalHeap* dest_physical_heap;
+    uint8_t* dest_host =
+        TranslateXMemDestination(dest_address, length, &dest_physical_heap);
+    XMemForEachChunk(length, [&](size_t offset, size_t size) {
+      std::memset(dest_host + offset, uint8_t(value), size);
+    });
+    XMemFinishDestination(dest_address, length, dest_physical_heap);
+  }
+  return dest_address;
+}
+DECLARE_XAM_EXPORT2(XMemSet, kMemory, kImplemented, kHighFrequency);
+
+}  // namespace xam
+}  // namespace kernel
+}  // namespace xe
+
+DECLARE_XAM_EMPTY_REGISTER_EXPORTS(Memory);
@@ -7,6 +7,8 @@
  ******************************************************************************
  */
 
+#include <algorithm>
+#include <climits>
 #include <cstring>
 
 #include "xenia/base/clock.h"
@@ -30,6 +32,7 @@
 #include <arpa/inet.h>
 #include <netinet/in.h>
 #include <netinet/ip.h>
+#include <poll.h>
 #include <sys/socket.h>
 #endif
 
@@ -331,25 +334,31 @@ dword_result_t NetDll_WSASendTo_entry(
     return -1;
   }
 
-  // Our sockets implementation doesn't support multiple buffers, so we need
-  // to combine the buffers the game has given us!
-  std::vector<uint8_t> combined_buffer_mem;
-  uint32_t combined_buffer_size = 0;
-  uint32_t combined_buffer_offset = 0;
-  for (uint32_t i = 0; i < num_buffers; i++) {
-    combined_buffer_size += buffers[i].len;
-    combined_buffer_mem.resize(combined_buffer_size);
-    uint8_t* combined_buffer = combined_buffer_mem.data();
-
-    std::memcpy(combined_buffer + combined_buffer_offset,
-                kernel_memory()->TranslateVirtual(buffers[i].buf_ptr),
-                buffers[i].len);
-    combined_buffer_offset += buffers[i].len;
-  }
-
   N_XSOCKADDR_IN native_to(to_ptr);
-  socket->SendTo(combined_buffer_mem.data(), combined_buffer_size, flags,
-                 &native_to, to_len);
+
+  // A single buffer can be sent directly from guest memory.
+  if (num_buffers == 1) {
+    socket->SendTo(
+        kernel_memory()->TranslateVirtual<uint8_t*>(buffers[0].buf_ptr),
+        buffers[0].len, flags, &native_to, to_len);
+  } else {
+    // Our sockets implementation doesn't support multiple buffers, so we need
+    // to combine the buffers the game has given us!
+    uint32_t combined_buffer_size = 0;
+    for (uint32_t i = 0; i < num_buffers; i++) {
+      combined_buffer_size += buffers[i].len;
+    }
+    std::vector<uint8_t> combined_buffer_mem(combined_buffer_size);
+    uint32_t combined_buffer_offset = 0;
+    for (uint32_t i = 0; i < num_buffers; i++) {
+      std::memcpy(combined_buffer_mem.data() + combined_buffer_offset,
+                  kernel_memory()->TranslateVirtual(buffers[i].buf_ptr),
+                  buffers[i].len);
+      combined_buffer_offset += buffers[i].len;
+    }
+    socket->SendTo(combined_buffer_mem.data(), combined_buffer_size, flags,
+                   &native_to, to_len);
+  }
 
   // TODO: Instantly complete overlapped
 
@@ -825,8 +834,9 @@ struct host_set {
   object_ref<XSocket> sockets[64];
 
   void Load(const x_fd_set* guest_set) {
-    assert_true(guest_set->fd_count < 64);
-    this->count = guest_set->fd_count;
+    assert_true(guest_set->fd_count <= xe::countof(guest_set->fd_array));
+    this->count = std::min(uint32_t(guest_set->fd_count),
+                           uint32_t(xe::countof(guest_set->fd_array)));
     for (uint32_t i = 0; i < this->count; ++i) {
       auto socket_handle = static_cast<X_HANDLE>(guest_set->fd_array[i]);
       if (socket_handle == -1) {
@@ -849,75 +859,109 @@ struct host_set {
     }
   }
 
-  void Store(fd_set* native_set) {
-    FD_ZERO(native_set);
+  void AddPollDescriptors(pollfd* fds, uint32_t& fd_count, short events) {
     for (uint32_t i = 0; i < this->count; ++i) {
-      FD_SET(this->sockets[i]->native_handle(), native_set);
+      pollfd& fd = fds[fd_count++];
+      fd.fd = static_cast<decltype(fd.fd)>(this->sockets[i]->native_handle());
+      fd.events = events;
+      fd.revents = 0;
     }
   }
 
-  void UpdateFrom(fd_set* native_set) {
+  // Keeps only the sockets whose poll descriptors, placed consecutively
+  // starting from fds, have any of ready_events.
+  void UpdateFrom(const pollfd* fds, short ready_events) {
     uint32_t new_count = 0;
     for (uint32_t i = 0; i < this->count; ++i) {
-      auto socket = this->sockets[i];
-      if (FD_ISSET(socket->native_handle(), native_set)) {
-        this->sockets[new_count++] = socket;
+      if (fds[i].revents & ready_events) {
+        this->sockets[new_count++] = std::move(this->sockets[i]);
       }
     }
     this->count = new_count;
   }
 };
 
+// Polled events corresponding to the select sets, and the returned events that
+// make a socket considered ready for each set.
+constexpr short kPollReadEvents = POLLIN;
+constexpr short kPollReadReadyEvents = POLLIN | POLLHUP | POLLERR;
+constexpr short kPollWriteEvents = POLLOUT;
+constexpr short kPollWriteReadyEvents = POLLOUT | POLLERR;
+#ifdef XE_PLATFORM_WIN32
+// WSAPoll rejects POLLPRI, and on Windows, failed connection attempts are
+// reported in exceptfds by select.
+constexpr short kPollExceptEvents = POLLRDBAND;
+constexpr short kPollExceptReadyEvents = POLLRDBAND | POLLERR;
+#else
+constexpr short kPollExceptEvents = POLLPRI;
+constexpr short kPollExceptReadyEvents = POLLPRI;
+#endif
+
 int_result_t NetDll_select_entry(int_t caller, int_t nfds,
                                  pointer_t<x_fd_set> readfds,
                                  pointer_t<x_fd_set> writefds,
                                  pointer_t<x_fd_set> exceptfds,
                                  lpvoid_t timeout_ptr) {
+  // nfds is ignored, like on Windows - it's the guest's value, not related to
+  // the host descriptors. Polling the descriptors directly rather than going
+  // through host fd_sets, which on POSIX are bitmaps scanned up to the largest
+  // descriptor and limited to FD_SETSIZE.
+  pollfd fds[3 * 64];
+  uint32_t fd_count = 0;
   host_set host_readfds = {0};
-  fd_set native_readfds = {0};
+  uint32_t readfds_first = fd_count;
   if (readfds) {
     host_readfds.Load(readfds);
-    host_readfds.Store(&native_readfds);
+    host_readfds.AddPollDescriptors(fds, fd_count, kPollReadEvents);
   }
   host_set host_writefds = {0};
-  fd_set native_writefds = {0};
+  uint32_t writefds_first = fd_count;
   if (writefds) {
     host_writefds.Load(writefds);
-    host_writefds.Store(&native_writefds);
+    host_writefds.AddPollDescriptors(fds, fd_count, kPollWriteEvents);
   }
   host_set host_exceptfds = {0};
-  fd_set native_exceptfds = {0};
+  uint32_t exceptfds_first = fd_count;
   if (exceptfds) {
     host_exceptfds.Load(exceptfds);
-    host_exceptfds.Store(&native_exceptfds);
+    host_exceptfds.AddPollDescriptors(fds, fd_count, kPollExceptEvents);
   }
-  timeval* timeout_in = nullptr;
-  timeval timeout;
+  int timeout_ms = -1;
   if (timeout_ptr) {
-    timeout = {static_cast<int32_t>(timeout_ptr.as_array<int32_t>()[0]),
-               static_cast<int32_t>(timeout_ptr.as_array<int32_t>()[1])};
-    Clock::ScaleGuestDurationTimeval(
-        reinterpret_cast<int32_t*>(&timeout.tv_sec),
-        reinterpret_cast<int32_t*>(&timeout.tv_usec));
-    timeout_in = &timeout;
+    int32_t timeout_sec = timeout_ptr.as_array<int32_t>()[0];
+    int32_t timeout_usec = timeout_ptr.as_array<int32_t>()[1];
+    Clock::ScaleGuestDurationTimeval(&timeout_sec, &timeout_usec);
+    // Round up so a short non-zero timeout doesn't become a non-blocking poll.
+    int64_t timeout_ms_64 =
+        int64_t(timeout_sec) * 1000 + (int64_t(timeout_usec) + 999) / 1000;
+    timeout_ms =
+        int(std::clamp(timeout_ms_64, int64_t(0), int64_t(INT32_MAX)));
+  }
+#ifdef XE_PLATFORM_WIN32
+  int ret = WSAPoll(fds, fd_count, timeout_ms);
+#else
+  int ret = poll(fds, fd_count, timeout_ms);
+#endif
+  if (ret < 0) {
+    return ret;
   }
-  int ret = select(nfds, readfds ? &native_readfds : nullptr,
-                   writefds ? &native_writefds : nullptr,
-                   exceptfds ? &native_exceptfds : nullptr, timeout_in);
+  ret = 0;
   if (readfds) {
-    host_readfds.UpdateFrom(&native_readfds);
+    host_readfds.UpdateFrom(fds + readfds_first, kPollReadReadyEvents);
     host_readfds.Store(readfds);
+    ret += int(host_readfds.count);
   }
   if (writefds) {
-    host_writefds.UpdateFrom(&native_writefds);
+    host_writefds.UpdateFrom(fds + writefds_first, kPollWriteReadyEvents);
     host_writefds.Store(writefds);
+    ret += int(host_writefds.count);
   }
   if (exceptfds) {
-    host_exceptfds.UpdateFrom(&native_exceptfds);
+    host_exceptfds.UpdateFrom(fds + exceptfds_first, kPollExceptReadyEvents);
     host_exceptfds.Store(exceptfds);
+    ret += int(host_exceptfds.count);
   }
-
-  // TODO(gibbed): modify ret to be what's actually copied to the guest fd_sets?
+  // The total number of sockets stored in the guest sets, like on Windows.
   return ret;
 }
 DECLARE_XAM_EXPORT1(NetDll_select, kNetworking, kImplemented);
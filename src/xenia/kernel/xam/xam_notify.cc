@@ -61,6 +61,11 @@ dword_result_t XNotifyGetNext_entry(dword_t handle, dword_t match_id,
   }
   *id_ptr = 0;
 
+  // Most calls are polling with no notifications queued for any listener.
+  if (!kernel_state()->has_pending_notifications()) {
+    return 0;
+  }
+
   // Grab listener.
   auto listener =
       kernel_state()->object_table()->LookupObject<XNotifyListener>(handle);
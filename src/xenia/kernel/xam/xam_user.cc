@@ -681,13 +681,14 @@ dword_result_t XamUserCreateAchievementEnumerator_entry(
         db.GetExistingLanguage(static_cast<XLanguage>(cvars::user_language));
     const std::vector<util::XdbfAchievementTableEntry> achievement_list =
         db.GetAchievements();
+    const util::XdbfStringTable strings = db.GetStringTable(language);
 
     for (const util::XdbfAchievementTableEntry& entry : achievement_list) {
       auto item = XStaticAchievementEnumerator::AchievementDetails{
           entry.id,
-          xe::to_utf16(db.GetStringTableEntry(language, entry.label_id)),
-          xe::to_utf16(db.GetStringTableEntry(language, entry.description_id)),
-          xe::to_utf16(db.GetStringTableEntry(language, entry.unachieved_id)),
+          xe::to_utf16(strings.Get(entry.label_id)),
+          xe::to_utf16(strings.Get(entry.description_id)),
+          xe::to_utf16(strings.Get(entry.unachieved_id)),
           entry.image_id,
           entry.gamerscore,
           {0, 0},
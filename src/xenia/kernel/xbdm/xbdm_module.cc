@@ -13,6 +13,7 @@
 
 #include "xenia/base/math.h"
 #include "xenia/kernel/kernel_state.h"
+#include "xenia/kernel/util/shim_utils.h"
 #include "xenia/kernel/xbdm/xbdm_private.h"
 
 namespace xe {
@@ -54,6 +55,7 @@ void XbdmModule::RegisterExportTable(xe::cpu::ExportResolver* export_resolver) {
       xbdm_exports[export_entry.ordinal] = &export_entry;
     }
   }
+  xe::kernel::shim::SelectExportTrampolines("xbdm", xbdm_exports);
   export_resolver->RegisterTable("xbdm.xex", &xbdm_exports);
 }
 
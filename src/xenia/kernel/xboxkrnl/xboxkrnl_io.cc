@@ -30,6 +30,8 @@ namespace xboxkrnl {
 struct CreateOptions {
   // https://processhacker.sourceforge.io/doc/ntioapi_8h.html
   static const uint32_t FILE_DIRECTORY_FILE = 0x00000001;
+  // Writes must not be delayed by buffering.
+  static const uint32_t FILE_WRITE_THROUGH = 0x00000002;
   // Optimization - files access will be sequential, not random.
   static const uint32_t FILE_SEQUENTIAL_ONLY = 0x00000004;
   static const uint32_t FILE_SYNCHRONOUS_IO_ALERT = 0x00000010;
@@ -153,6 +155,8 @@ dword_result_t NtCreateFile_entry(lpdword_t handle_out, dword_t desired_access,
     bool synchronous =
         (create_options & CreateOptions::FILE_SYNCHRONOUS_IO_ALERT) ||
         (create_options & CreateOptions::FILE_SYNCHRONOUS_IO_NONALERT);
+    vfs_file->set_write_through(
+        (create_options & CreateOptions::FILE_WRITE_THROUGH) != 0);
     file = object_ref<XFile>(new XFile(kernel_state(), vfs_file, synchronous));
 
     // Handle ref is incremented, so return that.
@@ -200,56 +204,73 @@ dword_result_t NtReadFile_entry(dword_t file_handle, dword_t event_handle,
   }
 
   if (XSUCCEEDED(result)) {
-    if (true || file->is_synchronous()) {
-      // Synchronous.
-      uint32_t bytes_read = 0;
-      result = file->Read(
-          buffer.guest_address(), buffer_length,
-          byte_offset_ptr ? static_cast<uint64_t>(*byte_offset_ptr) : -1,
-          &bytes_read, apc_context);
-      if (io_status_block) {
-        io_status_block->status = result;
-        io_status_block->information = bytes_read;
+    uint64_t byte_offset =
+        byte_offset_ptr ? static_cast<uint64_t>(*byte_offset_ptr) : -1;
+    // Low bit probably means do not queue to IO ports.
+    uint32_t apc_routine = static_cast<uint32_t>(apc_routine_ptr) & ~1u;
+    if (!file->is_synchronous()) {
+      // Reset the event first so only the completion of this read signals it.
+      if (ev) {
+        ev->Reset();
       }
-
-      // Queue the APC callback. It must be delivered via the APC mechanism even
-      // though were are completing immediately.
-      // Low bit probably means do not queue to IO ports.
-      if ((uint32_t)apc_routine_ptr & ~1) {
-        if (apc_context) {
-          auto thread = XThread::GetCurrentThread();
-          thread->EnqueueApc(static_cast<uint32_t>(apc_routine_ptr) & ~1u,
-                             apc_context, io_status_block, 0);
-        }
+      if (io_status_block) {
+        io_status_block->status = X_STATUS_PENDING;
+        io_status_block->information = 0;
       }
-
-      if (!file->is_synchronous()) {
-        result = X_STATUS_PENDING;
+      // The status block, the APC and the event are completed on the I/O
+      // thread, before the I/O completion ports and the file are signaled.
+      object_ref<XThread> thread = retain_object(XThread::GetCurrentThread());
+      uint32_t io_status_block_ptr = io_status_block.guest_address();
+      uint32_t apc_context_ptr = apc_context.guest_address();
+      if (file->ReadAsync(
+              buffer.guest_address(), buffer_length, byte_offset,
+              apc_context_ptr,
+              [ev, thread, io_status_block_ptr, apc_routine, apc_context_ptr](
+                  X_STATUS read_result, uint32_t bytes_read) {
+                if (io_status_block_ptr) {
+                  auto io_status_block_async =
+                      kernel_memory()->TranslateVirtual<X_IO_STATUS_BLOCK*>(
+                          io_status_block_ptr);
+                  io_status_block_async->status = read_result;
+                  io_status_block_async->information = bytes_read;
+                }
+                if (apc_routine && apc_context_ptr && thread) {
+                  thread->EnqueueApc(apc_routine, apc_context_ptr,
+                                     io_status_block_ptr, 0);
+                }
+                if (ev) {
+                  ev->Set(0, false);
+                }
+              })) {
+        return X_STATUS_PENDING;
       }
+    }
 
-      // Mark that we should signal the event now. We do this after
-      // we have written the info out.
-      signal_event = true;
-    } else {
-      // TODO(benvanik): async.
+    // Synchronous (or asynchronous I/O is not available).
+    uint32_t bytes_read = 0;
+    result = file->Read(buffer.guest_address(), buffer_length, byte_offset,
+                        &bytes_read, apc_context);
+    if (io_status_block) {
+      io_status_block->status = result;
+      io_status_block->information = bytes_read;
+    }
 
-      // X_STATUS_PENDING if not returning immediately.
-      // XFile is waitable and signalled after each async req completes.
-      // reset the input event (->Reset())
-      /*xeNtReadFileState* call_state = new xeNtReadFileState();
-      XAsyncRequest* request = new XAsyncRequest(
-      state, file,
-      (XAsyncRequest::CompletionCallback)xeNtReadFileCompleted,
-      call_state);*/
-      // result = file->Read(buffer.guest_address(), buffer_length, byte_offset,
-      //                     request);
-      if (io_status_block) {
-        io_status_block->status = X_STATUS_PENDING;
-        io_status_block->information = 0;
+    // Queue the APC callback. It must be delivered via the APC mechanism even
+    // though were are completing immediately.
+    if (apc_routine) {
+      if (apc_context) {
+        auto thread = XThread::GetCurrentThread();
+        thread->EnqueueApc(apc_routine, apc_context, io_status_block, 0);
       }
+    }
 
+    if (!file->is_synchronous()) {
       result = X_STATUS_PENDING;
     }
+
+    // Mark that we should signal the event now. We do this after
+    // we have written the info out.
+    signal_event = true;
   }
 
   if (XFAILED(result) && io_status_block) {
@@ -592,6 +613,13 @@ dword_result_t NtFlushBuffersFile_entry(
     dword_t file_handle, pointer_t<X_IO_STATUS_BLOCK> io_status_block_ptr) {
   auto result = X_STATUS_SUCCESS;
 
+  auto file = kernel_state()->object_table()->LookupObject<XFile>(file_handle);
+  if (!file) {
+    result = X_STATUS_INVALID_HANDLE;
+  } else {
+    result = file->Flush();
+  }
+
   if (io_status_block_ptr) {
     io_status_block_ptr->status = result;
     io_status_block_ptr->information = 0;
@@ -599,7 +627,7 @@ dword_result_t NtFlushBuffersFile_entry(
 
   return result;
 }
-DECLARE_XBOXKRNL_EXPORT1(NtFlushBuffersFile, kFileSystem, kStub);
+DECLARE_XBOXKRNL_EXPORT1(NtFlushBuffersFile, kFileSystem, kImplemented);
 
 // https://docs.microsoft.com/en-us/windows/win32/devnotes/ntopensymboliclinkobject
 dword_result_t NtOpenSymbolicLinkObject_entry(
@@ -15,6 +15,7 @@
 #include "xenia/base/atomic.h"
 #include "xenia/base/chrono.h"
 #include "xenia/base/logging.h"
+#include "xenia/base/memory.h"
 #include "xenia/base/string.h"
 #include "xenia/base/threading.h"
 #include "xenia/kernel/kernel_state.h"
@@ -32,21 +33,11 @@ namespace xboxkrnl {
 // https://msdn.microsoft.com/en-us/library/ff561778
 dword_result_t RtlCompareMemory_entry(lpvoid_t source1, lpvoid_t source2,
                                       dword_t length) {
-  uint8_t* p1 = source1;
-  uint8_t* p2 = source2;
-
   // Note that the return value is the number of bytes that match, so it's best
   // we just do this ourselves vs. using memcmp.
   // On Windows we could use the builtin function.
-
-  uint32_t c = 0;
-  for (uint32_t n = 0; n < length; n++, p1++, p2++) {
-    if (*p1 == *p2) {
-      c++;
-    }
-  }
-
-  return c;
+  return uint32_t(xe::count_equal_bytes(source1.as<const void*>(),
+                                        source2.as<const void*>(), length));
 }
 DECLARE_XBOXKRNL_EXPORT1(RtlCompareMemory, kMemory, kImplemented);
 
@@ -58,16 +49,10 @@ dword_result_t RtlCompareMemoryUlong_entry(lpvoid_t source, dword_t length,
     return 0;
   }
 
-  uint32_t n = 0;
-  for (uint32_t i = 0; i < (length / 4); i++) {
-    // FIXME: This assumes as_array returns xe::be
-    uint32_t val = source.as_array<uint32_t>()[i];
-    if (val == pattern) {
-      n++;
-    }
-  }
-
-  return n;
+  // The memory is big-endian, so the pattern is swapped instead of the values.
+  return uint32_t(xe::count_equal_32(source.as<const void*>(),
+                                     xe::byte_swap(pattern.value()),
+                                     length / 4));
 }
 DECLARE_XBOXKRNL_EXPORT1(RtlCompareMemoryUlong, kMemory, kImplemented);
 
@@ -75,13 +60,8 @@ DECLARE_XBOXKRNL_EXPORT1(RtlCompareMemoryUlong, kMemory, kImplemented);
 void RtlFillMemoryUlong_entry(lpvoid_t destination, dword_t length,
                               dword_t pattern) {
   // NOTE: length must be % 4, so we can work on uint32s.
-  uint32_t count = length >> 2;
-
-  uint32_t* p = destination.as<uint32_t*>();
-  uint32_t swapped_pattern = xe::byte_swap(pattern.value());
-  for (uint32_t n = 0; n < count; n++, p++) {
-    *p = swapped_pattern;
-  }
+  xe::fill_32(destination.as<void*>(), xe::byte_swap(pattern.value()),
+              length >> 2);
 }
 DECLARE_XBOXKRNL_EXPORT1(RtlFillMemoryUlong, kMemory, kImplemented);
 
@@ -375,6 +355,32 @@ struct X_RTL_CRITICAL_SECTION {
 #pragma pack(pop)
 static_assert_size(X_RTL_CRITICAL_SECTION, 28);
 
+// The lock is handed over to a waiter by signaling the synchronization event
+// in the header of the critical section. Rather than creating a host event
+// object for it, which is done under the kernel locks and costs multiple host
+// system calls per wait, the signal state in the guest memory is used as a
+// futex word directly.
+static volatile int32_t* GetCriticalSectionSignalState(
+    X_RTL_CRITICAL_SECTION* cs) {
+  return reinterpret_cast<volatile int32_t*>(&cs->header.signal_state);
+}
+static const int32_t kCriticalSectionSignaled =
+    int32_t(xe::byte_swap(uint32_t(1)));
+
+static void WaitForCriticalSection(X_RTL_CRITICAL_SECTION* cs) {
+  volatile int32_t* signal_state = GetCriticalSectionSignalState(cs);
+  util::KernelCallProfiler::WaitScope profiler_wait_scope;
+  while (!xe::atomic_cas(kCriticalSectionSignaled, 0, signal_state)) {
+    xe::threading::WaitOnAddress(signal_state, 0);
+  }
+}
+
+static void SignalCriticalSection(X_RTL_CRITICAL_SECTION* cs) {
+  volatile int32_t* signal_state = GetCriticalSectionSignalState(cs);
+  xe::atomic_exchange(kCriticalSectionSignaled, signal_state);
+  xe::threading::WakeByAddressSingle(signal_state);
+}
+
 void xeRtlInitializeCriticalSection(X_RTL_CRITICAL_SECTION* cs,
                                     uint32_t cs_ptr) {
   cs->header.type = 1;      // EventSynchronizationObject (auto reset)
@@ -440,9 +446,8 @@ void RtlEnterCriticalSection_entry(pointer_t<X_RTL_CRITICAL_SECTION> cs) {
   }
 
   if (xe::atomic_inc(&cs->lock_count) != 0) {
-    // Create a full waiter.
-    xeKeWaitForSingleObject(reinterpret_cast<void*>(cs.host_address()), 8, 0, 0,
-                            nullptr);
+    // Wait for the owner to hand the lock over.
+    WaitForCriticalSection(cs);
   }
 
   assert_true(cs->owning_thread == 0);
@@ -490,7 +495,7 @@ void RtlLeaveCriticalSection_entry(pointer_t<X_RTL_CRITICAL_SECTION> cs) {
   cs->owning_thread = 0;
   if (xe::atomic_dec(&cs->lock_count) != -1) {
     // There were waiters - wake one of them.
-    xeKeSetEvent(reinterpret_cast<X_KEVENT*>(cs.host_address()), 1, 0);
+    SignalCriticalSection(cs);
   }
 }
 DECLARE_XBOXKRNL_EXPORT2(RtlLeaveCriticalSection, kNone, kImplemented,
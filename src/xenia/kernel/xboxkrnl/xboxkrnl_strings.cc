@@ -7,9 +7,10 @@
  ******************************************************************************
  */
 
+#include <algorithm>
+#include <cstdio>
 #include <cstring>
-#include <iomanip>
-#include <sstream>
+#include <limits>
 #include <string>
 
 #include "xenia/base/logging.h"
@@ -84,37 +85,37 @@ class ArgList {
 // "Format Specification Syntax: printf and wprintf Functions"
 // https://msdn.microsoft.com/en-us/library/56e442dc.aspx
 
-std::string format_double(double value, int32_t precision, uint16_t c,
-                          uint32_t flags) {
+// Writes directly into the caller's work buffer rather than through a stream,
+// as this is called for every floating-point argument. Returns the length, or
+// a negative value on failure.
+int32_t format_double(char* buffer, size_t buffer_size, double value,
+                      int32_t precision, uint16_t c, uint32_t flags) {
   if (precision < 0) {
     precision = 6;
   } else if (precision == 0 && c == 'g') {
     precision = 1;
   }
 
-  std::ostringstream temp;
-  temp << std::setprecision(precision);
-
-  if (c == 'f') {
-    temp << std::fixed;
-  } else if (c == 'e' || c == 'E') {
-    temp << std::scientific;
-  } else if (c == 'a' || c == 'A') {
-    temp << std::hexfloat;
-  } else if (c == 'g' || c == 'G') {
-    temp << std::defaultfloat;
-  }
-
-  if (c == 'E' || c == 'G' || c == 'A') {
-    temp << std::uppercase;
-  }
-
+  char spec[8];
+  size_t spec_length = 0;
+  spec[spec_length++] = '%';
   if (flags & FF_AddPrefix) {
-    temp << std::showpoint;
+    spec[spec_length++] = '#';
   }
-
-  temp << value;
-  return temp.str();
+  if (c == 'a' || c == 'A') {
+    // Hexadecimal output is exact, the precision is ignored like with
+    // std::hexfloat.
+    spec[spec_length++] = char(c);
+    spec[spec_length] = '\0';
+    return std::snprintf(buffer, buffer_size, spec, value);
+  }
+  spec[spec_length++] = '.';
+  spec[spec_length++] = '*';
+  spec[spec_length++] = (c == 'f' || c == 'e' || c == 'E' || c == 'G')
+                            ? char(c)
+                            : 'g';
+  spec[spec_length] = '\0';
+  return std::snprintf(buffer, buffer_size, spec, int(precision), value);
 }
 
 int32_t format_core(PPCContext* ppc_context, FormatData& data, ArgList& args,
@@ -480,18 +481,16 @@ int32_t format_core(PPCContext* ppc_context, FormatData& data, ArgList& args,
               flags |= FF_AddNegative;
             }
 
-            auto s = format_double(value, precision, c, flags);
-            auto length = (int32_t)s.size();
+            auto length = format_double(work8, xe::countof(work8), value,
+                                        precision, c, flags);
+            if (length < 0) {
+              return -1;
+            }
             assert_true(length < xe::countof(work8));
+            length = std::min(length, int32_t(xe::countof(work8) - 1));
 
-            auto start = &work8[0];
-            auto end = &start[length];
-
-            std::memcpy(start, s.c_str(), length);
-            end[0] = '\0';
-
-            text.buffer = start;
-            text.length = (int32_t)(end - start);
+            text.buffer = work8;
+            text.length = length;
             text.is_wide = false;
             break;
           }
@@ -719,9 +718,9 @@ class ArrayArgList : public ArgList {
   int32_t index_;
 };
 
-class StringFormatData : public FormatData {
+class StringInputFormatData : public FormatData {
  public:
-  StringFormatData(const uint8_t* input) : input_(input) {}
+  StringInputFormatData(const uint8_t* input) : input_(input) {}
 
   uint16_t get() {
     uint16_t result = *input_;
@@ -741,6 +740,14 @@ class StringFormatData : public FormatData {
     }
   }
 
+ private:
+  const uint8_t* input_;
+};
+
+class StringFormatData : public StringInputFormatData {
+ public:
+  StringFormatData(const uint8_t* input) : StringInputFormatData(input) {}
+
   bool put(uint16_t c) {
     if (c >= 0x100) {
       return false;
@@ -752,13 +759,40 @@ class StringFormatData : public FormatData {
   const std::string& str() const { return output_; }
 
  private:
-  const uint8_t* input_;
   std::string output_;
 };
 
-class WideStringFormatData : public FormatData {
+// Writes the output directly to the guest buffer, without an intermediate
+// host string, up to the capacity. Characters past the capacity are only
+// counted.
+class GuestStringFormatData : public StringInputFormatData {
+ public:
+  GuestStringFormatData(const uint8_t* input, uint8_t* output,
+                        size_t output_capacity)
+      : StringInputFormatData(input),
+        output_(output),
+        output_capacity_(output_capacity) {}
+
+  bool put(uint16_t c) {
+    if (c >= 0x100) {
+      return false;
+    }
+    if (output_length_ < output_capacity_) {
+      output_[output_length_] = uint8_t(c);
+    }
+    ++output_length_;
+    return true;
+  }
+
+ private:
+  uint8_t* output_;
+  size_t output_capacity_;
+  size_t output_length_ = 0;
+};
+
+class WideStringInputFormatData : public FormatData {
  public:
-  WideStringFormatData(const uint16_t* input) : input_(input) {}
+  WideStringInputFormatData(const uint16_t* input) : input_(input) {}
 
   uint16_t get() {
     uint16_t result = *input_;
@@ -778,39 +812,36 @@ class WideStringFormatData : public FormatData {
     }
   }
 
-  bool put(uint16_t c) {
-    output_.push_back(char16_t(c));
-    return true;
-  }
-
-  const std::u16string& wstr() const { return output_; }
-
  private:
   const uint16_t* input_;
-  std::u16string output_;
 };
 
-class WideCountFormatData : public FormatData {
+class GuestWideStringFormatData : public WideStringInputFormatData {
  public:
-  WideCountFormatData(const uint16_t* input) : input_(input), count_(0) {}
+  GuestWideStringFormatData(const uint16_t* input, uint16_t* output,
+                            size_t output_capacity)
+      : WideStringInputFormatData(input),
+        output_(output),
+        output_capacity_(output_capacity) {}
 
-  uint16_t get() {
-    uint16_t result = *input_;
-    if (result) {
-      input_++;
+  bool put(uint16_t c) {
+    if (output_length_ < output_capacity_) {
+      output_[output_length_] = xe::byte_swap(c);
     }
-    return xe::byte_swap(result);
+    ++output_length_;
+    return true;
   }
 
-  uint16_t peek(int32_t offset) { return xe::byte_swap(input_[offset]); }
+ private:
+  uint16_t* output_;
+  size_t output_capacity_;
+  size_t output_length_ = 0;
+};
 
-  void skip(int32_t count) {
-    while (count-- > 0) {
-      if (!get()) {
-        break;
-      }
-    }
-  }
+class WideCountFormatData : public WideStringInputFormatData {
+ public:
+  WideCountFormatData(const uint16_t* input)
+      : WideStringInputFormatData(input), count_(0) {}
 
   bool put(uint16_t c) {
     ++count_;
@@ -820,7 +851,6 @@ class WideCountFormatData : public FormatData {
   const int32_t count() const { return count_; }
 
  private:
-  const uint16_t* input_;
   int32_t count_;
 };
 
@@ -874,20 +904,16 @@ SHIM_CALL _snprintf_entry(PPCContext* ppc_context, KernelState* kernel_state) {
   auto format = (const uint8_t*)SHIM_MEM_ADDR(format_ptr);
 
   StackArgList args(ppc_context, 3);
-  StringFormatData data(format);
+  GuestStringFormatData data(format, buffer, size_t(buffer_count));
 
   int32_t count = format_core(ppc_context, data, args, false);
   if (count < 0) {
     if (buffer_count > 0) {
       buffer[0] = '\0';  // write a null, just to be safe
     }
-  } else if (count <= buffer_count) {
-    std::memcpy(buffer, data.str().c_str(), count);
-    if (count < buffer_count) {
-      buffer[count] = '\0';
-    }
-  } else {
-    std::memcpy(buffer, data.str().c_str(), buffer_count);
+  } else if (count < buffer_count) {
+    buffer[count] = '\0';
+  } else if (count > buffer_count) {
     count = -1;  // for return value
   }
   SHIM_SET_RETURN_32(count);
@@ -912,15 +938,11 @@ SHIM_CALL sprintf_entry(PPCContext* ppc_context, KernelState* kernel_state) {
   auto format = (const uint8_t*)SHIM_MEM_ADDR(format_ptr);
 
   StackArgList args(ppc_context, 2);
-  StringFormatData data(format);
+  GuestStringFormatData data(format, buffer,
+                             std::numeric_limits<size_t>::max());
 
   int32_t count = format_core(ppc_context, data, args, false);
-  if (count <= 0) {
-    buffer[0] = '\0';
-  } else {
-    std::memcpy(buffer, data.str().c_str(), count);
-    buffer[count] = '\0';
-  }
+  buffer[std::max(count, int32_t(0))] = '\0';
   SHIM_SET_RETURN_32(count);
 }
 
@@ -946,20 +968,16 @@ SHIM_CALL _snwprintf_entry(PPCContext* ppc_context, KernelState* kernel_state) {
   auto format = (const uint16_t*)SHIM_MEM_ADDR(format_ptr);
 
   StackArgList args(ppc_context, 3);
-  WideStringFormatData data(format);
+  GuestWideStringFormatData data(format, buffer, size_t(buffer_count));
 
   int32_t count = format_core(ppc_context, data, args, true);
   if (count < 0) {
     if (buffer_count > 0) {
       buffer[0] = '\0';  // write a null, just to be safe
     }
-  } else if (count <= buffer_count) {
-    xe::copy_and_swap(buffer, (uint16_t*)data.wstr().c_str(), count);
-    if (count < buffer_count) {
-      buffer[count] = '\0';
-    }
-  } else {
-    xe::copy_and_swap(buffer, (uint16_t*)data.wstr().c_str(), buffer_count);
+  } else if (count < buffer_count) {
+    buffer[count] = '\0';
+  } else if (count > buffer_count) {
     count = -1;  // for return value
   }
   SHIM_SET_RETURN_32(count);
@@ -985,15 +1003,11 @@ SHIM_CALL swprintf_entry(PPCContext* ppc_context, KernelState* kernel_state) {
   auto format = (const uint16_t*)SHIM_MEM_ADDR(format_ptr);
 
   StackArgList args(ppc_context, 2);
-  WideStringFormatData data(format);
+  GuestWideStringFormatData data(format, buffer,
+                                 std::numeric_limits<size_t>::max());
 
   int32_t count = format_core(ppc_context, data, args, false);
-  if (count <= 0) {
-    buffer[0] = '\0';
-  } else {
-    xe::copy_and_swap(buffer, (uint16_t*)data.wstr().c_str(), count);
-    buffer[count] = '\0';
-  }
+  buffer[std::max(count, int32_t(0))] = '\0';
   SHIM_SET_RETURN_32(count);
 }
 
@@ -1019,7 +1033,7 @@ SHIM_CALL _vsnprintf_entry(PPCContext* ppc_context, KernelState* kernel_state) {
   auto format = (const uint8_t*)SHIM_MEM_ADDR(format_ptr);
 
   ArrayArgList args(ppc_context, arg_ptr);
-  StringFormatData data(format);
+  GuestStringFormatData data(format, buffer, size_t(buffer_count));
 
   int32_t count = format_core(ppc_context, data, args, false);
   if (count < 0) {
@@ -1027,16 +1041,12 @@ SHIM_CALL _vsnprintf_entry(PPCContext* ppc_context, KernelState* kernel_state) {
     if (buffer_count > 0) {
       buffer[0] = '\0';  // write a null, just to be safe
     }
-  } else if (count <= buffer_count) {
+  } else if (count < buffer_count) {
     // Fit within the buffer.
-    std::memcpy(buffer, data.str().c_str(), count);
-    if (count < buffer_count) {
-      buffer[count] = '\0';
-    }
-  } else {
-    // Overflowed buffer. We still return the count we would have written.
-    std::memcpy(buffer, data.str().c_str(), buffer_count);
+    buffer[count] = '\0';
   }
+  // If overflowed the buffer, still returning the count that would have been
+  // written.
   SHIM_SET_RETURN_32(count);
 }
 
@@ -1065,7 +1075,7 @@ SHIM_CALL _vsnwprintf_entry(PPCContext* ppc_context,
   auto format = (const uint16_t*)SHIM_MEM_ADDR(format_ptr);
 
   ArrayArgList args(ppc_context, arg_ptr);
-  WideStringFormatData data(format);
+  GuestWideStringFormatData data(format, buffer, size_t(buffer_count));
 
   int32_t count = format_core(ppc_context, data, args, true);
   if (count < 0) {
@@ -1073,16 +1083,12 @@ SHIM_CALL _vsnwprintf_entry(PPCContext* ppc_context,
     if (buffer_count > 0) {
       buffer[0] = '\0';  // write a null, just to be safe
     }
-  } else if (count <= buffer_count) {
+  } else if (count < buffer_count) {
     // Fit within the buffer.
-    xe::copy_and_swap(buffer, (uint16_t*)data.wstr().c_str(), count);
-    if (count < buffer_count) {
-      buffer[count] = '\0';
-    }
-  } else {
-    // Overflowed buffer. We still return the count we would have written.
-    xe::copy_and_swap(buffer, (uint16_t*)data.wstr().c_str(), buffer_count);
+    buffer[count] = '\0';
   }
+  // If overflowed the buffer, still returning the count that would have been
+  // written.
   SHIM_SET_RETURN_32(count);
 }
 
@@ -1106,15 +1112,11 @@ SHIM_CALL vsprintf_entry(PPCContext* ppc_context, KernelState* kernel_state) {
   auto format = (const uint8_t*)SHIM_MEM_ADDR(format_ptr);
 
   ArrayArgList args(ppc_context, arg_ptr);
-  StringFormatData data(format);
+  GuestStringFormatData data(format, buffer,
+                             std::numeric_limits<size_t>::max());
 
   int32_t count = format_core(ppc_context, data, args, false);
-  if (count <= 0) {
-    buffer[0] = '\0';
-  } else {
-    std::memcpy(buffer, data.str().c_str(), count);
-    buffer[count] = '\0';
-  }
+  buffer[std::max(count, int32_t(0))] = '\0';
   SHIM_SET_RETURN_32(count);
 }
 
@@ -1168,15 +1170,11 @@ SHIM_CALL vswprintf_entry(PPCContext* ppc_context, KernelState* kernel_state) {
   auto format = (const uint16_t*)SHIM_MEM_ADDR(format_ptr);
 
   ArrayArgList args(ppc_context, arg_ptr);
-  WideStringFormatData data(format);
+  GuestWideStringFormatData data(format, buffer,
+                                 std::numeric_limits<size_t>::max());
 
   int32_t count = format_core(ppc_context, data, args, true);
-  if (count <= 0) {
-    buffer[0] = '\0';
-  } else {
-    xe::copy_and_swap(buffer, (uint16_t*)data.wstr().c_str(), count);
-    buffer[count] = '\0';
-  }
+  buffer[std::max(count, int32_t(0))] = '\0';
   SHIM_SET_RETURN_32(count);
 }
 
@@ -832,7 +832,12 @@ dword_result_t KeWaitForMultipleObjects_entry(
     lpqword_t timeout_ptr, lpvoid_t wait_block_array_ptr) {
   assert_true(wait_type <= 1);
 
-  std::vector<object_ref<XObject>> objects;
+  // Not allocating the references on the heap as titles often wait for a few
+  // objects every frame.
+  if (count > XObject::kMaxWaitObjectCount) {
+    return X_STATUS_INVALID_PARAMETER;
+  }
+  object_ref<XObject> objects[XObject::kMaxWaitObjectCount];
   for (uint32_t n = 0; n < count; n++) {
     auto object_ptr = kernel_memory()->TranslateVirtual(objects_ptr[n]);
     auto object_ref =
@@ -841,12 +846,11 @@ dword_result_t KeWaitForMultipleObjects_entry(
       return X_STATUS_INVALID_PARAMETER;
     }
 
-    objects.push_back(std::move(object_ref));
+    objects[n] = std::move(object_ref);
   }
 
   uint64_t timeout = timeout_ptr ? static_cast<uint64_t>(*timeout_ptr) : 0u;
-  return XObject::WaitMultiple(uint32_t(objects.size()),
-                               reinterpret_cast<XObject**>(objects.data()),
+  return XObject::WaitMultiple(count, reinterpret_cast<XObject**>(objects),
                                wait_type, wait_reason, processor_mode,
                                alertable, timeout_ptr ? &timeout : nullptr);
 }
@@ -859,7 +863,10 @@ uint32_t xeNtWaitForMultipleObjectsEx(uint32_t count, xe::be<uint32_t>* handles,
                                       uint64_t* timeout_ptr) {
   assert_true(wait_type <= 1);
 
-  std::vector<object_ref<XObject>> objects;
+  if (count > XObject::kMaxWaitObjectCount) {
+    return X_STATUS_INVALID_PARAMETER;
+  }
+  object_ref<XObject> objects[XObject::kMaxWaitObjectCount];
   for (uint32_t n = 0; n < count; n++) {
     uint32_t object_handle = handles[n];
     auto object =
@@ -867,11 +874,10 @@ uint32_t xeNtWaitForMultipleObjectsEx(uint32_t count, xe::be<uint32_t>* handles,
     if (!object) {
       return X_STATUS_INVALID_PARAMETER;
     }
-    objects.push_back(std::move(object));
+    objects[n] = std::move(object);
   }
 
-  return XObject::WaitMultiple(count,
-                               reinterpret_cast<XObject**>(objects.data()),
+  return XObject::WaitMultiple(count, reinterpret_cast<XObject**>(objects),
                                wait_type, 6, wait_mode, alertable, timeout_ptr);
 }
 
@@ -1117,16 +1123,6 @@ dword_result_t KiApcNormalRoutineNop_entry(dword_t unk0 /* output? */,
 }
 DECLARE_XBOXKRNL_EXPORT1(KiApcNormalRoutineNop, kThreading, kStub);
 
-typedef struct {
-  xe::be<uint32_t> unknown;
-  xe::be<uint32_t> flink;
-  xe::be<uint32_t> blink;
-  xe::be<uint32_t> routine;
-  xe::be<uint32_t> context;
-  xe::be<uint32_t> arg1;
-  xe::be<uint32_t> arg2;
-} XDPC;
-
 void KeInitializeDpc_entry(pointer_t<XDPC> dpc, lpvoid_t routine,
                            lpvoid_t context) {
   // KDPC (maybe) 0x18 bytes?
@@ -1145,42 +1141,14 @@ DECLARE_XBOXKRNL_EXPORT2(KeInitializeDpc, kThreading, kImplemented, kSketchy);
 
 dword_result_t KeInsertQueueDpc_entry(pointer_t<XDPC> dpc, dword_t arg1,
                                       dword_t arg2) {
-  assert_always("DPC does not dispatch yet; going to hang!");
-
-  uint32_t list_entry_ptr = dpc.guest_address() + 4;
-
-  // Lock dispatcher.
-  auto global_lock = xe::global_critical_region::AcquireDirect();
-  auto dpc_list = kernel_state()->dpc_list();
-
-  // If already in a queue, abort.
-  if (dpc_list->IsQueued(list_entry_ptr)) {
-    return 0;
-  }
-
-  // Prep DPC.
-  dpc->arg1 = (uint32_t)arg1;
-  dpc->arg2 = (uint32_t)arg2;
-
-  dpc_list->Insert(list_entry_ptr);
-
-  return 1;
+  bool inserted =
+      kernel_state()->InsertQueueDpc(dpc.guest_address(), arg1, arg2);
+  return inserted ? 1 : 0;
 }
-DECLARE_XBOXKRNL_EXPORT2(KeInsertQueueDpc, kThreading, kStub, kSketchy);
+DECLARE_XBOXKRNL_EXPORT1(KeInsertQueueDpc, kThreading, kImplemented);
 
 dword_result_t KeRemoveQueueDpc_entry(pointer_t<XDPC> dpc) {
-  bool result = false;
-
-  uint32_t list_entry_ptr = dpc.guest_address() + 4;
-
-  auto global_lock = xe::global_critical_region::AcquireDirect();
-  auto dpc_list = kernel_state()->dpc_list();
-  if (dpc_list->IsQueued(list_entry_ptr)) {
-    dpc_list->Remove(list_entry_ptr);
-    result = true;
-  }
-
-  return result ? 1 : 0;
+  return kernel_state()->RemoveQueueDpc(dpc.guest_address()) ? 1 : 0;
 }
 DECLARE_XBOXKRNL_EXPORT1(KeRemoveQueueDpc, kThreading, kImplemented);
 
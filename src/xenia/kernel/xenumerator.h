@@ -85,6 +85,11 @@ class XStaticUntypedEnumerator : public XEnumerator {
 
   size_t item_count() const { return item_count_; }
 
+  // Preallocates the storage for the number of items about to be appended.
+  void ReserveItems(size_t count) {
+    buffer_.reserve(buffer_.size() + count * item_size());
+  }
+
   uint8_t* AppendItem();
 
   uint32_t WriteItems(uint32_t buffer_ptr, uint8_t* buffer_data,
@@ -10,6 +10,9 @@
 #include "xenia/kernel/xfile.h"
 #include "xenia/vfs/virtual_file_system.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "xenia/base/byte_stream.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
@@ -102,64 +105,10 @@ X_STATUS XFile::Read(uint32_t buffer_guest_address, uint32_t buffer_length,
   }
 
   size_t bytes_read = 0;
-  X_STATUS result = X_STATUS_SUCCESS;
-  // Zero length means success for a valid file object according to Windows
-  // tests.
-  if (buffer_length) {
-    if (UINT32_MAX - buffer_guest_address < buffer_length) {
-      result = X_STATUS_ACCESS_VIOLATION;
-    } else {
-      // Games often read directly to texture/vertex buffer memory - in this
-      // case, invalidation notifications must be sent. However, having any
-      // memory callbacks in the range will result in STATUS_ACCESS_VIOLATION at
-      // least on Windows, without anything being read or any callbacks being
-      // triggered. So for physical memory, host protection must be bypassed,
-      // and invalidation callbacks must be triggered manually (it's also wrong
-      // to trigger invalidation callbacks before reading in this case, because
-      // during the read, the guest may still access the data around the buffer
-      // that is located in the same host pages as the buffer's start and end,
-      // on the GPU - and that must not trigger a race condition).
-      uint32_t buffer_guest_high_address =
-          buffer_guest_address + buffer_length - 1;
-      xe::BaseHeap* buffer_start_heap =
-          memory()->LookupHeap(buffer_guest_address);
-      const xe::BaseHeap* buffer_end_heap =
-          memory()->LookupHeap(buffer_guest_high_address);
-      if (!buffer_start_heap || !buffer_end_heap ||
-          (buffer_start_heap->heap_type() == HeapType::kGuestPhysical) !=
-              (buffer_end_heap->heap_type() == HeapType::kGuestPhysical) ||
-          (buffer_start_heap->heap_type() == HeapType::kGuestPhysical &&
-           buffer_start_heap != buffer_end_heap)) {
-        result = X_STATUS_ACCESS_VIOLATION;
-      } else {
-        xe::PhysicalHeap* buffer_physical_heap =
-            buffer_start_heap->heap_type() == HeapType::kGuestPhysical
-                ? static_cast<xe::PhysicalHeap*>(buffer_start_heap)
-                : nullptr;
-        if (buffer_physical_heap &&
-            buffer_physical_heap->QueryRangeAccess(buffer_guest_address,
-                                                   buffer_guest_high_address) !=
-                memory::PageAccess::kReadWrite) {
-          result = X_STATUS_ACCESS_VIOLATION;
-        } else {
-          result = file_->ReadSync(
-              buffer_physical_heap
-                  ? memory()->TranslatePhysical(
-                        buffer_physical_heap->GetPhysicalAddress(
-                            buffer_guest_address))
-                  : memory()->TranslateVirtual(buffer_guest_address),
-              buffer_length, size_t(byte_offset), &bytes_read);
-          if (XSUCCEEDED(result)) {
-            if (buffer_physical_heap) {
-              buffer_physical_heap->TriggerCallbacks(
-                  xe::global_critical_region::AcquireDirect(),
-                  buffer_guest_address, buffer_length, true, true);
-            }
-            position_ += bytes_read;
-          }
-        }
-      }
-    }
+  X_STATUS result = ReadToGuest(buffer_guest_address, buffer_length,
+                                byte_offset, &bytes_read);
+  if (XSUCCEEDED(result)) {
+    position_ += bytes_read;
   }
 
   if (out_bytes_read) {
@@ -167,16 +116,114 @@ X_STATUS XFile::Read(uint32_t buffer_guest_address, uint32_t buffer_length,
   }
 
   if (notify_completion) {
-    XIOCompletion::IONotification notify;
-    notify.apc_context = apc_context;
-    notify.num_bytes = uint32_t(bytes_read);
-    notify.status = result;
+    CompleteIO(result, uint32_t(bytes_read), apc_context);
+  }
 
-    NotifyIOCompletionPorts(notify);
+  return result;
+}
 
-    async_event_->Set();
+bool XFile::ReadAsync(uint32_t buffer_guest_address, uint32_t buffer_length,
+                      uint64_t byte_offset, uint32_t apc_context,
+                      IOCompletionCallback completion_callback) {
+  uint64_t position = position_;
+  if (byte_offset == uint64_t(-1)) {
+    byte_offset = position;
+  }
+  // The position is only accessed by the guest threads - advance it to where
+  // the read is expected to end.
+  size_t file_size = entry()->size();
+  set_position(std::max(
+      position, std::min(byte_offset + buffer_length, uint64_t(file_size))));
+  async_event_->Reset();
+  object_ref<XFile> file = retain_object(this);
+  bool queued = kernel_state()->io_thread_pool().Queue(
+      [file, buffer_guest_address, buffer_length, byte_offset, apc_context,
+       completion_callback = std::move(completion_callback)]() {
+        size_t bytes_read = 0;
+        X_STATUS result = file->ReadToGuest(buffer_guest_address, buffer_length,
+                                            byte_offset, &bytes_read);
+        if (completion_callback) {
+          completion_callback(result, uint32_t(bytes_read));
+        }
+        file->CompleteIO(result, uint32_t(bytes_read), apc_context);
+      });
+  if (!queued) {
+    set_position(position);
+  }
+  return queued;
+}
+
+X_STATUS XFile::TranslateReadBuffer(uint32_t buffer_guest_address,
+                                    uint32_t buffer_length,
+                                    void** host_buffer_out,
+                                    xe::PhysicalHeap** physical_heap_out) {
+  if (UINT32_MAX - buffer_guest_address < buffer_length) {
+    return X_STATUS_ACCESS_VIOLATION;
+  }
+  // Games often read directly to texture/vertex buffer memory - in this case,
+  // invalidation notifications must be sent. However, having any memory
+  // callbacks in the range will result in STATUS_ACCESS_VIOLATION at least on
+  // Windows, without anything being read or any callbacks being triggered. So
+  // for physical memory, host protection must be bypassed, and invalidation
+  // callbacks must be triggered manually (it's also wrong to trigger
+  // invalidation callbacks before reading in this case, because during the
+  // read, the guest may still access the data around the buffer that is
+  // located in the same host pages as the buffer's start and end, on the GPU -
+  // and that must not trigger a race condition).
+  uint32_t buffer_guest_high_address = buffer_guest_address + buffer_length - 1;
+  xe::BaseHeap* buffer_start_heap = memory()->LookupHeap(buffer_guest_address);
+  const xe::BaseHeap* buffer_end_heap =
+      memory()->LookupHeap(buffer_guest_high_address);
+  if (!buffer_start_heap || !buffer_end_heap ||
+      (buffer_start_heap->heap_type() == HeapType::kGuestPhysical) !=
+          (buffer_end_heap->heap_type() == HeapType::kGuestPhysical) ||
+      (buffer_start_heap->heap_type() == HeapType::kGuestPhysical &&
+       buffer_start_heap != buffer_end_heap)) {
+    return X_STATUS_ACCESS_VIOLATION;
+  }
+  xe::PhysicalHeap* buffer_physical_heap =
+      buffer_start_heap->heap_type() == HeapType::kGuestPhysical
+          ? static_cast<xe::PhysicalHeap*>(buffer_start_heap)
+          : nullptr;
+  if (buffer_physical_heap &&
+      buffer_physical_heap->QueryRangeAccess(buffer_guest_address,
+                                             buffer_guest_high_address) !=
+          memory::PageAccess::kReadWrite) {
+    return X_STATUS_ACCESS_VIOLATION;
+  }
+  *host_buffer_out = buffer_physical_heap
+                         ? memory()->TranslatePhysical(
+                               buffer_physical_heap->GetPhysicalAddress(
+                                   buffer_guest_address))
+                         : memory()->TranslateVirtual(buffer_guest_address);
+  *physical_heap_out = buffer_physical_heap;
+  return X_STATUS_SUCCESS;
+}
+
+X_STATUS XFile::ReadToGuest(uint32_t buffer_guest_address,
+                            uint32_t buffer_length, uint64_t byte_offset,
+                            size_t* bytes_read_out) {
+  size_t bytes_read = 0;
+  X_STATUS result = X_STATUS_SUCCESS;
+  // Zero length means success for a valid file object according to Windows
+  // tests.
+  if (buffer_length) {
+    void* host_buffer;
+    xe::PhysicalHeap* buffer_physical_heap;
+    result = TranslateReadBuffer(buffer_guest_address, buffer_length,
+                                 &host_buffer, &buffer_physical_heap);
+    if (XSUCCEEDED(result)) {
+      result = file_->ReadSync(host_buffer, buffer_length, size_t(byte_offset),
+                               &bytes_read);
+      if (XSUCCEEDED(result) && buffer_physical_heap) {
+        buffer_physical_heap->TriggerCallbacks(
+            xe::global_critical_region::AcquireDirect(), buffer_guest_address,
+            buffer_length, true, true);
+      }
+    }
   }
 
+  *bytes_read_out = bytes_read;
   return result;
 }
 
@@ -194,30 +241,72 @@ X_STATUS XFile::ReadScatter(uint32_t segments_guest_address, uint32_t length,
   // (only game seen using this always seems to use 4096-byte buffers)
   uint32_t page_size = 4096;
 
-  uint32_t read_total = 0;
-  uint32_t read_remain = length;
-  while (read_remain) {
-    uint32_t read_length = read_remain;
-    uint32_t read_buffer = *segments;
-    if (read_length > page_size) {
-      read_length = page_size;
-      segments++;
+  // Translate all the segments, and read them at once up to the first invalid
+  // one.
+  struct GuestSegment {
+    uint32_t guest_address;
+    uint32_t length;
+    xe::PhysicalHeap* physical_heap;
+  };
+  std::vector<GuestSegment> guest_segments;
+  std::vector<vfs::ReadSegment> read_segments;
+  X_STATUS translation_result = X_STATUS_SUCCESS;
+  for (uint32_t segment_offset = 0; segment_offset < length;
+       segment_offset += page_size) {
+    GuestSegment guest_segment;
+    guest_segment.guest_address = segments[segment_offset / page_size];
+    guest_segment.length = std::min(page_size, length - segment_offset);
+    vfs::ReadSegment read_segment;
+    read_segment.length = guest_segment.length;
+    translation_result = TranslateReadBuffer(
+        guest_segment.guest_address, guest_segment.length,
+        &read_segment.buffer, &guest_segment.physical_heap);
+    if (XFAILED(translation_result)) {
+      break;
     }
+    guest_segments.push_back(guest_segment);
+    read_segments.push_back(read_segment);
+  }
 
-    uint32_t bytes_read = 0;
-    result = Read(read_buffer, read_length,
-                  byte_offset ? ((byte_offset != -1 && byte_offset != -2)
-                                     ? byte_offset + read_total
-                                     : byte_offset)
-                              : -1,
-                  &bytes_read, apc_context, false);
+  if (byte_offset == 0 || byte_offset == uint64_t(-1) ||
+      byte_offset == uint64_t(-2)) {
+    // Read from current position.
+    byte_offset = position_;
+  }
 
-    if (result != X_STATUS_SUCCESS) {
-      break;
+  size_t read_total = 0;
+  if (!read_segments.empty()) {
+    result = file_->ReadScatterSync(read_segments.data(), read_segments.size(),
+                                    size_t(byte_offset), &read_total);
+  }
+  if (XSUCCEEDED(result)) {
+    position_ += read_total;
+
+    // Trigger the invalidation callbacks for the physical memory written,
+    // merging adjacent segments.
+    size_t triggered_length = 0;
+    size_t i = 0;
+    while (i < guest_segments.size() && triggered_length < read_total) {
+      const GuestSegment& range_start = guest_segments[i];
+      uint32_t range_length = 0;
+      do {
+        range_length += guest_segments[i].length;
+        triggered_length += guest_segments[i].length;
+        ++i;
+      } while (i < guest_segments.size() && triggered_length < read_total &&
+               guest_segments[i].physical_heap == range_start.physical_heap &&
+               guest_segments[i].guest_address ==
+                   range_start.guest_address + range_length);
+      if (range_start.physical_heap) {
+        range_start.physical_heap->TriggerCallbacks(
+            xe::global_critical_region::AcquireDirect(),
+            range_start.guest_address, range_length, true, true);
+      }
     }
 
-    read_total += bytes_read;
-    read_remain -= read_length;
+    if (XFAILED(translation_result)) {
+      result = translation_result;
+    }
   }
 
   if (out_bytes_read) {
@@ -350,5 +439,17 @@ void XFile::NotifyIOCompletionPorts(
   }
 }
 
+void XFile::CompleteIO(X_STATUS result, uint32_t bytes_transferred,
+                       uint32_t apc_context) {
+  XIOCompletion::IONotification notify;
+  notify.apc_context = apc_context;
+  notify.num_bytes = bytes_transferred;
+  notify.status = result;
+
+  NotifyIOCompletionPorts(notify);
+
+  async_event_->Set();
+}
+
 }  // namespace kernel
 }  // namespace xe
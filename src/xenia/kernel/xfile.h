@@ -10,6 +10,7 @@
 #ifndef XENIA_KERNEL_XFILE_H_
 #define XENIA_KERNEL_XFILE_H_
 
+#include <functional>
 #include <string>
 
 #include "xenia/kernel/xevent.h"
@@ -101,6 +102,18 @@ class XFile : public XObject {
                 uint64_t byte_offset, uint32_t* out_bytes_read,
                 uint32_t apc_context, bool notify_completion = true);
 
+  // Invoked on the thread performing the I/O before the I/O completion ports
+  // and the file object are signaled.
+  using IOCompletionCallback =
+      std::function<void(X_STATUS result, uint32_t bytes_transferred)>;
+
+  // Queues the read to the asynchronous I/O thread pool of the kernel.
+  // Returns false if asynchronous I/O is not available, in which case Read
+  // must be used instead.
+  bool ReadAsync(uint32_t buffer_guest_address, uint32_t buffer_length,
+                 uint64_t byte_offset, uint32_t apc_context,
+                 IOCompletionCallback completion_callback);
+
   X_STATUS ReadScatter(uint32_t segments_guest_address, uint32_t length,
                        uint64_t byte_offset, uint32_t* out_bytes_read,
                        uint32_t apc_context);
@@ -110,6 +123,7 @@ class XFile : public XObject {
                  uint32_t apc_context);
 
   X_STATUS SetLength(size_t length);
+  X_STATUS Flush() { return file_->Flush(); }
 
   void RegisterIOCompletionPort(uint32_t key, object_ref<XIOCompletion> port);
   void RemoveIOCompletionPort(uint32_t key);
@@ -122,6 +136,8 @@ class XFile : public XObject {
 
  protected:
   void NotifyIOCompletionPorts(XIOCompletion::IONotification& notification);
+  void CompleteIO(X_STATUS result, uint32_t bytes_transferred,
+                  uint32_t apc_context);
 
   xe::threading::WaitHandle* GetWaitHandle() override {
     return async_event_.get();
@@ -130,6 +146,17 @@ class XFile : public XObject {
  private:
   XFile();
 
+  // Validates a guest buffer for reading into it and returns the host pointer
+  // to it. For physical memory, physical_heap_out is the heap, and the
+  // invalidation callbacks must be triggered after writing to the buffer.
+  X_STATUS TranslateReadBuffer(uint32_t buffer_guest_address,
+                               uint32_t buffer_length, void** host_buffer_out,
+                               xe::PhysicalHeap** physical_heap_out);
+  // Reads to the guest memory without updating the position, triggering the
+  // physical memory invalidation callbacks.
+  X_STATUS ReadToGuest(uint32_t buffer_guest_address, uint32_t buffer_length,
+                       uint64_t byte_offset, size_t* bytes_read_out);
+
   vfs::File* file_ = nullptr;
   std::unique_ptr<threading::Event> async_event_ = nullptr;
 
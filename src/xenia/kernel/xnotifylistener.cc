@@ -20,7 +20,11 @@ namespace kernel {
 XNotifyListener::XNotifyListener(KernelState* kernel_state)
     : XObject(kernel_state, kObjectType) {}
 
-XNotifyListener::~XNotifyListener() {}
+XNotifyListener::~XNotifyListener() {
+  if (kernel_state_ && !notifications_.empty()) {
+    kernel_state_->AddPendingNotifications(-int64_t(notifications_.size()));
+  }
+}
 
 void XNotifyListener::Initialize(uint64_t mask, uint32_t max_version) {
   assert_false(wait_handle_);
@@ -43,21 +47,29 @@ void XNotifyListener::EnqueueNotification(XNotificationID id, uint32_t data) {
   if (key.version > max_version_) {
     return;
   }
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::mutex> lock(notifications_mutex_);
   notifications_.push_back(std::pair<XNotificationID, uint32_t>(id, data));
+  notification_count_.store(notifications_.size(), std::memory_order_release);
+  kernel_state_->AddPendingNotifications(1);
   wait_handle_->Set();
 }
 
 bool XNotifyListener::DequeueNotification(XNotificationID* out_id,
                                           uint32_t* out_data) {
-  auto global_lock = global_critical_region_.Acquire();
+  // Polled every frame by many games, usually with nothing queued.
+  if (!notification_count_.load(std::memory_order_acquire)) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(notifications_mutex_);
   bool dequeued = false;
   if (notifications_.size()) {
     dequeued = true;
-    auto it = notifications_.begin();
-    *out_id = it->first;
-    *out_data = it->second;
-    notifications_.erase(it);
+    *out_id = notifications_.front().first;
+    *out_data = notifications_.front().second;
+    notifications_.pop_front();
+    notification_count_.store(notifications_.size(),
+                              std::memory_order_release);
+    kernel_state_->AddPendingNotifications(-1);
     if (!notifications_.size()) {
       wait_handle_->Reset();
     }
@@ -67,7 +79,10 @@ bool XNotifyListener::DequeueNotification(XNotificationID* out_id,
 
 bool XNotifyListener::DequeueNotification(XNotificationID id,
                                           uint32_t* out_data) {
-  auto global_lock = global_critical_region_.Acquire();
+  if (!notification_count_.load(std::memory_order_acquire)) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(notifications_mutex_);
   if (!notifications_.size()) {
     return false;
   }
@@ -79,6 +94,9 @@ bool XNotifyListener::DequeueNotification(XNotificationID id,
     dequeued = true;
     *out_data = it->second;
     notifications_.erase(it);
+    notification_count_.store(notifications_.size(),
+                              std::memory_order_release);
+    kernel_state_->AddPendingNotifications(-1);
     if (!notifications_.size()) {
       wait_handle_->Reset();
     }
@@ -119,6 +137,10 @@ object_ref<XNotifyListener> XNotifyListener::Restore(KernelState* kernel_state,
     pair.second = stream->Read<uint32_t>();
     notify->notifications_.push_back(pair);
   }
+  notify->notification_count_.store(notify->notifications_.size(),
+                                    std::memory_order_release);
+  kernel_state->AddPendingNotifications(
+      int64_t(notify->notifications_.size()));
 
   return object_ref<XNotifyListener>(notify);
 }
@@ -10,7 +10,10 @@
 #ifndef XENIA_KERNEL_XNOTIFYLISTENER_H_
 #define XENIA_KERNEL_XNOTIFYLISTENER_H_
 
+#include <atomic>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include "xenia/base/assert.h"
@@ -67,8 +70,13 @@ class XNotifyListener : public XObject {
 
  private:
   std::unique_ptr<xe::threading::Event> wait_handle_;
-  xe::global_critical_region global_critical_region_;
-  std::vector<std::pair<XNotificationID, uint32_t>> notifications_;
+  // Not the global critical region, as notifications are often broadcast to
+  // all listeners and polled every frame.
+  std::mutex notifications_mutex_;
+  std::deque<std::pair<XNotificationID, uint32_t>> notifications_;
+  // The size of notifications_, for checking whether there are notifications
+  // without locking.
+  std::atomic<size_t> notification_count_ = {0};
   uint64_t mask_ = 0;
   uint32_t max_version_ = 0;
 };
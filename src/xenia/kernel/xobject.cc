@@ -9,11 +9,13 @@
 
 #include "xenia/kernel/xobject.h"
 
+#include <optional>
 #include <vector>
 
 #include "xenia/base/byte_stream.h"
 #include "xenia/base/clock.h"
 #include "xenia/kernel/kernel_state.h"
+#include "xenia/kernel/util/kernel_call_profiler.h"
 #include "xenia/kernel/util/shim_utils.h"
 #include "xenia/kernel/xboxkrnl/xboxkrnl_private.h"
 #include "xenia/kernel/xenumerator.h"
@@ -56,12 +58,18 @@ XObject::~XObject() {
     uint32_t ptr = guest_object_ptr_ - sizeof(X_OBJECT_HEADER);
     auto header = memory()->TranslateVirtual<X_OBJECT_HEADER*>(ptr);
 
-    // Free the object creation info
-    if (header->object_type_ptr) {
+    if (header->object_type_ptr == ptr - kNativeObjectTypeSpace) {
+      // The object type is the beginning of the allocation.
       memory()->SystemHeapFree(header->object_type_ptr);
+    } else {
+      // Allocated separately before, restored from an older state.
+      // Free the object creation info
+      if (header->object_type_ptr) {
+        memory()->SystemHeapFree(header->object_type_ptr);
+      }
+
+      memory()->SystemHeapFree(ptr);
     }
-
-    memory()->SystemHeapFree(ptr);
   }
 }
 
@@ -199,13 +207,21 @@ X_STATUS XObject::Wait(uint32_t wait_reason, uint32_t processor_mode,
     return X_STATUS_SUCCESS;
   }
 
-  auto timeout_ms =
-      opt_timeout ? std::chrono::milliseconds(Clock::ScaleGuestDurationMillis(
-                        TimeoutTicksToMs(*opt_timeout)))
-                  : std::chrono::milliseconds::max();
+  std::optional<uint32_t> timeout_ms;
+  if (opt_timeout) {
+    timeout_ms = TimeoutTicksToMs(*opt_timeout);
+  }
 
-  auto result =
-      xe::threading::Wait(wait_handle, alertable ? true : false, timeout_ms);
+  xe::threading::WaitResult result;
+  {
+    util::KernelCallProfiler::WaitScope profiler_wait_scope;
+    result = kernel_state()->idle_time_skipper().Wait(
+        XThread::GetCurrentIdleTimeSkipperThread(), timeout_ms,
+        [&](std::chrono::milliseconds timeout) {
+          return xe::threading::Wait(wait_handle, alertable ? true : false,
+                                     timeout);
+        });
+  }
   switch (result) {
     case xe::threading::WaitResult::kSuccess:
       WaitCallback();
@@ -226,14 +242,30 @@ X_STATUS XObject::Wait(uint32_t wait_reason, uint32_t processor_mode,
 X_STATUS XObject::SignalAndWait(XObject* signal_object, XObject* wait_object,
                                 uint32_t wait_reason, uint32_t processor_mode,
                                 uint32_t alertable, uint64_t* opt_timeout) {
-  auto timeout_ms =
-      opt_timeout ? std::chrono::milliseconds(Clock::ScaleGuestDurationMillis(
-                        TimeoutTicksToMs(*opt_timeout)))
-                  : std::chrono::milliseconds::max();
-
-  auto result = xe::threading::SignalAndWait(
-      signal_object->GetWaitHandle(), wait_object->GetWaitHandle(),
-      alertable ? true : false, timeout_ms);
+  std::optional<uint32_t> timeout_ms;
+  if (opt_timeout) {
+    timeout_ms = TimeoutTicksToMs(*opt_timeout);
+  }
+
+  xe::threading::WaitResult result;
+  {
+    util::KernelCallProfiler::WaitScope profiler_wait_scope;
+    // With idle time skipping, the wait may be done in multiple slices, and
+    // the object must be signaled only once.
+    bool signaled = false;
+    result = signal_object->kernel_state()->idle_time_skipper().Wait(
+        XThread::GetCurrentIdleTimeSkipperThread(), timeout_ms,
+        [&](std::chrono::milliseconds timeout) {
+          if (signaled) {
+            return xe::threading::Wait(wait_object->GetWaitHandle(),
+                                       alertable ? true : false, timeout);
+          }
+          signaled = true;
+          return xe::threading::SignalAndWait(
+              signal_object->GetWaitHandle(), wait_object->GetWaitHandle(),
+              alertable ? true : false, timeout);
+        });
+  }
   switch (result) {
     case xe::threading::WaitResult::kSuccess:
       wait_object->WaitCallback();
@@ -255,20 +287,28 @@ X_STATUS XObject::WaitMultiple(uint32_t count, XObject** objects,
                                uint32_t wait_type, uint32_t wait_reason,
                                uint32_t processor_mode, uint32_t alertable,
                                uint64_t* opt_timeout) {
-  std::vector<xe::threading::WaitHandle*> wait_handles(count);
+  assert_true(count <= kMaxWaitObjectCount);
+  xe::threading::WaitHandle* wait_handles[kMaxWaitObjectCount];
   for (size_t i = 0; i < count; ++i) {
     wait_handles[i] = objects[i]->GetWaitHandle();
     assert_not_null(wait_handles[i]);
   }
 
-  auto timeout_ms =
-      opt_timeout ? std::chrono::milliseconds(Clock::ScaleGuestDurationMillis(
-                        TimeoutTicksToMs(*opt_timeout)))
-                  : std::chrono::milliseconds::max();
+  std::optional<uint32_t> timeout_ms;
+  if (opt_timeout) {
+    timeout_ms = TimeoutTicksToMs(*opt_timeout);
+  }
 
+  util::IdleTimeSkipper& idle_time_skipper =
+      KernelState::shared()->idle_time_skipper();
+  util::KernelCallProfiler::WaitScope profiler_wait_scope;
   if (wait_type) {
-    auto result = xe::threading::WaitAny(std::move(wait_handles),
-                                         alertable ? true : false, timeout_ms);
+    auto result = idle_time_skipper.Wait(
+        XThread::GetCurrentIdleTimeSkipperThread(), timeout_ms,
+        [&](std::chrono::milliseconds timeout) {
+          return xe::threading::WaitAny(wait_handles, count,
+                                        alertable ? true : false, timeout);
+        });
     switch (result.first) {
       case xe::threading::WaitResult::kSuccess:
         objects[result.second]->WaitCallback();
@@ -287,8 +327,12 @@ X_STATUS XObject::WaitMultiple(uint32_t count, XObject** objects,
         return X_STATUS_UNSUCCESSFUL;
     }
   } else {
-    auto result = xe::threading::WaitAll(std::move(wait_handles),
-                                         alertable ? true : false, timeout_ms);
+    auto result = idle_time_skipper.Wait(
+        XThread::GetCurrentIdleTimeSkipperThread(), timeout_ms,
+        [&](std::chrono::milliseconds timeout) {
+          return xe::threading::WaitAll(wait_handles, count,
+                                        alertable ? true : false, timeout);
+        });
     switch (result) {
       case xe::threading::WaitResult::kSuccess:
         for (uint32_t i = 0; i < count; i++) {
@@ -313,27 +357,27 @@ X_STATUS XObject::WaitMultiple(uint32_t count, XObject** objects,
 uint8_t* XObject::CreateNative(uint32_t size) {
   auto global_lock = xe::global_critical_region::AcquireDirect();
 
-  uint32_t total_size = size + sizeof(X_OBJECT_HEADER);
+  // The object type is placed in the same allocation, so creating an object
+  // takes one system heap allocation. The memory is zeroed by the allocator.
+  uint32_t total_size =
+      kNativeObjectTypeSpace + sizeof(X_OBJECT_HEADER) + size;
 
-  auto mem = memory()->SystemHeapAlloc(total_size);
-  if (!mem) {
+  auto object_type = memory()->SystemHeapAlloc(total_size);
+  if (!object_type) {
     // Out of memory!
     return nullptr;
   }
+  uint32_t mem = object_type + kNativeObjectTypeSpace;
 
   allocated_guest_object_ = true;
-  memory()->Zero(mem, total_size);
   SetNativePointer(mem + sizeof(X_OBJECT_HEADER), true);
 
   auto header = memory()->TranslateVirtual<X_OBJECT_HEADER*>(mem);
 
-  auto object_type = memory()->SystemHeapAlloc(sizeof(X_OBJECT_TYPE));
-  if (object_type) {
-    // Set it up in the header.
-    // Some kernel method is accessing this struct and dereferencing a member
-    // @ offset 0x14
-    header->object_type_ptr = object_type;
-  }
+  // Set it up in the header.
+  // Some kernel method is accessing this struct and dereferencing a member
+  // @ offset 0x14
+  header->object_type_ptr = object_type;
 
   return memory()->TranslateVirtual(guest_object_ptr_);
 }
@@ -185,6 +185,8 @@ class XObject {
   static X_STATUS SignalAndWait(XObject* signal_object, XObject* wait_object,
                                 uint32_t wait_reason, uint32_t processor_mode,
                                 uint32_t alertable, uint64_t* opt_timeout);
+  // Like MAXIMUM_WAIT_OBJECTS on Windows.
+  static constexpr uint32_t kMaxWaitObjectCount = 64;
   static X_STATUS WaitMultiple(uint32_t count, XObject** objects,
                                uint32_t wait_type, uint32_t wait_reason,
                                uint32_t processor_mode, uint32_t alertable,
@@ -234,6 +236,11 @@ class XObject {
   std::vector<X_HANDLE> handles_;
   std::string name_;  // May be zero length.
 
+  // CreateNative allocates the X_OBJECT_TYPE in the same system heap block,
+  // before the X_OBJECT_HEADER, at this offset from the block's start.
+  static constexpr uint32_t kNativeObjectTypeSpace = 32;
+  static_assert(sizeof(X_OBJECT_TYPE) <= kNativeObjectTypeSpace);
+
   // Guest pointer for kernel object. Remember: X_OBJECT_HEADER precedes this
   // if we allocated it!
   uint32_t guest_object_ptr_ = 0;
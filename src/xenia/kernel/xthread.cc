@@ -24,6 +24,7 @@
 #include "xenia/cpu/processor.h"
 #include "xenia/emulator.h"
 #include "xenia/kernel/kernel_state.h"
+#include "xenia/kernel/util/kernel_call_profiler.h"
 #include "xenia/kernel/user_module.h"
 #include "xenia/kernel/xevent.h"
 #include "xenia/kernel/xmutant.h"
@@ -119,6 +120,12 @@ XThread* XThread::GetCurrentThread() {
   return thread;
 }
 
+util::IdleTimeSkipper::GuestThread*
+XThread::GetCurrentIdleTimeSkipperThread() {
+  XThread* thread = reinterpret_cast<XThread*>(current_xthread_tls_);
+  return thread ? thread->idle_time_skipper_thread() : nullptr;
+}
+
 uint32_t XThread::GetCurrentThreadHandle() {
   XThread* thread = XThread::GetCurrentThread();
   return thread->handle();
@@ -152,6 +159,10 @@ void XThread::set_name(const std::string_view name) {
     // May be getting set before the thread is created.
     // One the thread is ready it will handle it.
     thread_->set_name(thread_name_);
+    // The profiler can only rename the calling thread.
+    if (IsInThread(this)) {
+      xe::Profiler::SetThreadName(thread_name_.c_str());
+    }
   }
 }
 
@@ -233,7 +244,9 @@ bool XThread::AllocateStack(uint32_t size) {
   auto actual_size = size + padding;
 
   uint32_t address = 0;
-  if (!heap->AllocRange(
+  bool pooled = kernel_state()->AcquirePooledThreadStack(actual_size, address);
+  if (!pooled &&
+      !heap->AllocRange(
           kStackAddressRangeBegin, kStackAddressRangeEnd, actual_size,
           alignment, kMemoryAllocationReserve | kMemoryAllocationCommit,
           kMemoryProtectRead | kMemoryProtectWrite, false, &address)) {
@@ -245,6 +258,12 @@ bool XThread::AllocateStack(uint32_t size) {
   stack_limit_ = address + (padding / 2);
   stack_base_ = stack_limit_ + size;
 
+  if (pooled) {
+    // The guard pages are already set up, and not accessible.
+    memory()->Fill(stack_limit_, size, 0xBE);
+    return true;
+  }
+
   // Initialize the stack with junk
   memory()->Fill(stack_alloc_base_, actual_size, 0xBE);
 
@@ -257,8 +276,11 @@ bool XThread::AllocateStack(uint32_t size) {
 
 void XThread::FreeStack() {
   if (stack_alloc_base_) {
-    auto heap = memory()->LookupHeap(kStackAddressRangeBegin);
-    heap->Release(stack_alloc_base_);
+    if (!kernel_state()->ReleaseThreadStackToPool(stack_alloc_base_,
+                                                  stack_alloc_size_)) {
+      auto heap = memory()->LookupHeap(kStackAddressRangeBegin);
+      heap->Release(stack_alloc_base_);
+    }
 
     stack_alloc_base_ = 0;
     stack_alloc_size_ = 0;
@@ -446,6 +468,8 @@ X_STATUS XThread::Exit(int exit_code) {
 
   // Notify processor of our exit.
   emulator()->processor()->OnThreadExit(thread_id_);
+  kernel_state()->idle_time_skipper().RemoveGuestThread(
+      idle_time_skipper_thread_);
 
   // NOTE: unless PlatformExit fails, expect it to never return!
   current_xthread_tls_ = nullptr;
@@ -470,6 +494,8 @@ X_STATUS XThread::Terminate(int exit_code) {
 
   // Notify processor of our exit.
   emulator()->processor()->OnThreadExit(thread_id_);
+  kernel_state()->idle_time_skipper().RemoveGuestThread(
+      idle_time_skipper_thread_);
 
   running_ = false;
   if (XThread::IsInThread(this)) {
@@ -499,6 +525,10 @@ void XThread::Execute() {
 
   // Let the kernel know we are starting.
   kernel_state()->OnThreadExecute(this);
+  if (guest_thread_) {
+    kernel_state()->idle_time_skipper().AddGuestThread(
+        idle_time_skipper_thread_);
+  }
 
   // All threads get a mandatory sleep. This is to deal with some buggy
   // games that are assuming the 360 is so slow to create threads that they
@@ -586,16 +616,16 @@ void XThread::LockApc() { global_critical_region_.mutex().lock(); }
 
 void XThread::UnlockApc(bool queue_delivery) {
   bool needs_apc = apc_list_.HasPending();
+  apc_list_pending_.store(needs_apc, std::memory_order_release);
   global_critical_region_.mutex().unlock();
-  if (needs_apc && queue_delivery) {
+  if (queue_delivery &&
+      (needs_apc || apc_inbox_head_.load(std::memory_order_acquire))) {
     thread_->QueueUserCallback([this]() { DeliverAPCs(); });
   }
 }
 
 void XThread::EnqueueApc(uint32_t normal_routine, uint32_t normal_context,
                          uint32_t arg1, uint32_t arg2) {
-  LockApc();
-
   // Allocate APC.
   // We'll tag it as special and free it when dispatched.
   uint32_t apc_ptr = memory()->SystemHeapAlloc(XAPC::kSize);
@@ -610,17 +640,56 @@ void XThread::EnqueueApc(uint32_t normal_routine, uint32_t normal_context,
   apc->arg2 = arg2;
   apc->enqueued = 1;
 
+  // Push to the inbox, without contending with the target thread delivering
+  // its APCs and the other threads for the global lock. Only this pushes and
+  // only DrainApcInbox pops (all of the entries at once), so there's no ABA
+  // problem.
   uint32_t list_entry_ptr = apc_ptr + 8;
-  apc_list_.Insert(list_entry_ptr);
+  uint32_t inbox_head = apc_inbox_head_.load(std::memory_order_relaxed);
+  do {
+    apc->flink = inbox_head;
+  } while (!apc_inbox_head_.compare_exchange_weak(inbox_head, list_entry_ptr,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed));
+
+  // Wakes the thread if it's in an alertable wait.
+  thread_->QueueUserCallback([this]() { DeliverAPCs(); });
+}
 
-  UnlockApc(true);
+void XThread::DrainApcInbox() {
+  uint32_t list_entry_ptr =
+      apc_inbox_head_.exchange(0, std::memory_order_acquire);
+  if (!list_entry_ptr) {
+    return;
+  }
+  // Reverse the stack to insert the APCs in the order they were queued in.
+  uint32_t reversed_ptr = 0;
+  while (list_entry_ptr) {
+    auto flink = memory()->TranslateVirtual<xe::be<uint32_t>*>(list_entry_ptr);
+    uint32_t next_ptr = *flink;
+    *flink = reversed_ptr;
+    reversed_ptr = list_entry_ptr;
+    list_entry_ptr = next_ptr;
+  }
+  while (reversed_ptr) {
+    uint32_t next_ptr = xe::load_and_swap<uint32_t>(
+        memory()->TranslateVirtual(reversed_ptr));
+    apc_list_.Insert(reversed_ptr);
+    reversed_ptr = next_ptr;
+  }
 }
 
 void XThread::DeliverAPCs() {
   // https://www.drdobbs.com/inside-nts-asynchronous-procedure-call/184416590?pgno=1
   // https://www.drdobbs.com/inside-nts-asynchronous-procedure-call/184416590?pgno=7
+  // Called very frequently, at every IRQL lowering for instance, so avoiding
+  // the global lock if there's nothing to deliver.
+  if (!HasPendingApcs()) {
+    return;
+  }
   auto processor = kernel_state()->processor();
   LockApc();
+  DrainApcInbox();
   auto kthread = guest_object<X_KTHREAD>();
   while (apc_list_.HasPending() && kthread->apc_disable_count == 0) {
     // Get APC entry (offset for LIST_ENTRY offset) and cache what we need.
@@ -686,6 +755,7 @@ void XThread::DeliverAPCs() {
 void XThread::RundownAPCs() {
   assert_true(XThread::GetCurrentThread() == this);
   LockApc();
+  DrainApcInbox();
   while (apc_list_.HasPending()) {
     // Get APC entry (offset for LIST_ENTRY offset) and cache what we need.
     // Calling the routine may delete the memory/overwrite it.
@@ -758,7 +828,15 @@ void XThread::SetActiveCpu(uint8_t cpu_index) {
     thread_object.current_cpu = cpu_index;
   }
 
-  if (xe::threading::logical_processor_count() >= 6) {
+  const util::HostProcessorMap& host_processor_map =
+      kernel_state()->host_processor_map();
+  if (host_processor_map.is_enabled()) {
+    // The host threads are placed by their owners.
+    if (is_guest_thread()) {
+      thread_->set_affinity_mask(
+          host_processor_map.GetGuestThreadAffinity(cpu_index));
+    }
+  } else if (xe::threading::logical_processor_count() >= 6) {
     if (!cvars::ignore_thread_affinities) {
       thread_->set_affinity_mask(uint64_t(1) << cpu_index);
     }
@@ -833,10 +911,13 @@ X_STATUS XThread::Delay(uint32_t processor_mode, uint32_t alertable,
   } else {
     timeout_ms = 0;
   }
-  timeout_ms = Clock::ScaleGuestDurationMillis(timeout_ms);
+  util::KernelCallProfiler::WaitScope profiler_wait_scope;
   if (alertable) {
-    auto result =
-        xe::threading::AlertableSleep(std::chrono::milliseconds(timeout_ms));
+    auto result = kernel_state()->idle_time_skipper().Wait(
+        idle_time_skipper_thread(), timeout_ms,
+        [](std::chrono::milliseconds timeout) {
+          return xe::threading::AlertableSleep(timeout);
+        });
     switch (result) {
       default:
       case xe::threading::SleepResult::kSuccess:
@@ -845,7 +926,12 @@ X_STATUS XThread::Delay(uint32_t processor_mode, uint32_t alertable,
         return X_STATUS_USER_APC;
     }
   } else {
-    xe::threading::Sleep(std::chrono::milliseconds(timeout_ms));
+    kernel_state()->idle_time_skipper().Wait(
+        idle_time_skipper_thread(), timeout_ms,
+        [](std::chrono::milliseconds timeout) {
+          xe::threading::Sleep(timeout);
+          return xe::threading::SleepResult::kSuccess;
+        });
     return X_STATUS_SUCCESS;
   }
 }
@@ -912,7 +998,10 @@ bool XThread::Save(ByteStream* stream) {
   state.thread_id = thread_id_;
   state.is_main_thread = main_thread_;
   state.is_running = running_;
+  LockApc();
+  DrainApcInbox();
   state.apc_head = apc_list_.head();
+  UnlockApc(false);
   state.tls_static_address = tls_static_address_;
   state.tls_dynamic_address = tls_dynamic_address_;
   state.tls_total_size = tls_total_size_;
@@ -986,6 +1075,7 @@ object_ref<XThread> XThread::Restore(KernelState* kernel_state,
   thread->stack_alloc_size_ = state.stack_alloc_size;
 
   thread->apc_list_.set_memory(kernel_state->memory());
+  thread->apc_list_pending_ = thread->apc_list_.HasPending();
 
   // Register now that we know our thread ID.
   kernel_state->RegisterThread(thread);
@@ -17,6 +17,7 @@
 #include "xenia/base/threading.h"
 #include "xenia/cpu/thread.h"
 #include "xenia/cpu/thread_state.h"
+#include "xenia/kernel/util/idle_time_skipper.h"
 #include "xenia/kernel/util/native_list.h"
 #include "xenia/kernel/xmutant.h"
 #include "xenia/kernel/xobject.h"
@@ -69,6 +70,18 @@ struct XAPC {
   }
 };
 
+struct XDPC {
+  // KDPC, 0x1C bytes.
+  // NOTE: stored in guest memory.
+  xe::be<uint32_t> unknown;  // +0
+  xe::be<uint32_t> flink;    // +4
+  xe::be<uint32_t> blink;    // +8
+  xe::be<uint32_t> routine;  // +12
+  xe::be<uint32_t> context;  // +16
+  xe::be<uint32_t> arg1;     // +20
+  xe::be<uint32_t> arg2;     // +24
+};
+
 // Processor Control Region
 struct X_KPCR {
   xe::be<uint32_t> tls_ptr;         // 0x0
@@ -183,6 +196,14 @@ class XThread : public XObject, public cpu::Thread {
   bool is_guest_thread() const { return guest_thread_; }
   bool main_thread() const { return main_thread_; }
   bool is_running() const { return running_; }
+  // For the waits of the thread with idle time skipping, null for host
+  // threads.
+  util::IdleTimeSkipper::GuestThread* idle_time_skipper_thread() {
+    return guest_thread_ ? &idle_time_skipper_thread_ : nullptr;
+  }
+  // Null if not called from a guest thread.
+  static util::IdleTimeSkipper::GuestThread*
+  GetCurrentIdleTimeSkipperThread();
 
   uint32_t thread_id() const { return thread_id_; }
   uint32_t last_error();
@@ -203,9 +224,15 @@ class XThread : public XObject, public cpu::Thread {
   void LowerIrql(uint32_t new_irql);
 
   void CheckApcs();
+  // The APC list must be accessed only between LockApc and UnlockApc. With
+  // queue_delivery, the thread is woken from an alertable wait if APCs are
+  // pending.
   void LockApc();
   void UnlockApc(bool queue_delivery);
   util::NativeList* apc_list() { return &apc_list_; }
+  // Queues a kernel-allocated APC without taking the APC lock, from any
+  // thread. Such APCs are moved to the APC list by the target thread when it
+  // delivers the APCs.
   void EnqueueApc(uint32_t normal_routine, uint32_t normal_context,
                   uint32_t arg1, uint32_t arg2);
 
@@ -251,6 +278,12 @@ class XThread : public XObject, public cpu::Thread {
 
   void DeliverAPCs();
   void RundownAPCs();
+  // Requires the APC lock.
+  void DrainApcInbox();
+  bool HasPendingApcs() const {
+    return apc_list_pending_.load(std::memory_order_acquire) ||
+           apc_inbox_head_.load(std::memory_order_acquire);
+  }
 
   xe::threading::WaitHandle* GetWaitHandle() override { return thread_.get(); }
 
@@ -272,12 +305,20 @@ class XThread : public XObject, public cpu::Thread {
   bool guest_thread_ = false;
   bool main_thread_ = false;  // Entry-point thread
   bool running_ = false;
+  util::IdleTimeSkipper::GuestThread idle_time_skipper_thread_;
 
   int32_t priority_ = 0;
 
   xe::global_critical_region global_critical_region_;
   std::atomic<uint32_t> irql_ = {0};
   util::NativeList apc_list_;
+  // Whether apc_list_ is not empty, updated in UnlockApc, for checking if
+  // there are APCs to deliver without taking the lock.
+  std::atomic<bool> apc_list_pending_ = {false};
+  // Guest address of the most recently queued APC of the lock-free stack of
+  // APCs queued with EnqueueApc and not moved to apc_list_ yet, linked through
+  // the flink of their list entries, or 0 if there are none.
+  std::atomic<uint32_t> apc_inbox_head_ = {0};
 };
 
 class XHostThread : public XThread {
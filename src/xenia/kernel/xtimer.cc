@@ -9,9 +9,13 @@
 
 #include "xenia/kernel/xtimer.h"
 
+#include <algorithm>
+
 #include "xenia/base/chrono.h"
 #include "xenia/base/logging.h"
+#include "xenia/base/math.h"
 #include "xenia/cpu/processor.h"
+#include "xenia/kernel/kernel_state.h"
 #include "xenia/kernel/xthread.h"
 
 namespace xe {
@@ -20,7 +24,10 @@ namespace kernel {
 XTimer::XTimer(KernelState* kernel_state)
     : XObject(kernel_state, kObjectType) {}
 
-XTimer::~XTimer() = default;
+XTimer::~XTimer() {
+  kernel_state()->idle_time_skipper().ClearDeadline(
+      idle_time_skipper_deadline_);
+}
 
 void XTimer::Initialize(uint32_t timer_type) {
   assert_false(timer_);
@@ -47,16 +54,26 @@ X_STATUS XTimer::SetTimer(int64_t due_time, uint32_t period_ms,
     return X_STATUS_TIMER_RESUME_IGNORED;
   }
 
+  util::IdleTimeSkipper& idle_time_skipper =
+      kernel_state()->idle_time_skipper();
+  idle_time_skipper.ClearDeadline(idle_time_skipper_deadline_);
+
+  uint32_t guest_period_ms = period_ms;
   period_ms = Clock::ScaleGuestDurationMillis(period_ms);
+  period_ms_ = period_ms;
   WinSystemClock::time_point due_tp;
+  // Relative to the current guest time, for idle time skipping.
+  int64_t guest_due_delay;
   if (due_time < 0) {
     // Any timer implementation uses absolute times eventually, convert as early
     // as possible for increased accuracy
     auto after = xe::chrono::hundrednanoseconds(-due_time);
     due_tp = date::clock_cast<WinSystemClock>(XSystemClock::now() + after);
+    guest_due_delay = -due_time;
   } else {
     due_tp = date::clock_cast<WinSystemClock>(
         XSystemClock::from_file_time(due_time));
+    guest_due_delay = due_time - int64_t(Clock::QueryGuestSystemTime());
   }
 
   // Stash routine for callback.
@@ -81,6 +98,10 @@ X_STATUS XTimer::SetTimer(int64_t due_time, uint32_t period_ms,
     };
   }
 
+  if (idle_time_skipper.is_enabled()) {
+    timer_callback_ = callback;
+  }
+
   bool result;
   if (!period_ms) {
     result = timer_->SetOnceAt(due_tp, std::move(callback));
@@ -89,10 +110,47 @@ X_STATUS XTimer::SetTimer(int64_t due_time, uint32_t period_ms,
         due_tp, std::chrono::milliseconds(period_ms), std::move(callback));
   }
 
+  if (result && idle_time_skipper.is_enabled()) {
+    uint64_t tick_frequency = Clock::guest_tick_frequency();
+    uint64_t numerator = tick_frequency;
+    uint64_t denominator = 10000000;
+    reduce_fraction(numerator, denominator);
+    idle_time_skipper.SetDeadline(
+        idle_time_skipper_deadline_,
+        Clock::QueryGuestTickCount() +
+            uint64_t(std::max(guest_due_delay, int64_t(0))) * numerator /
+                denominator,
+        uint64_t(guest_period_ms) * tick_frequency / 1000,
+        [this](uint64_t due_ticks) { RearmAfterTimeSkip(due_ticks); });
+  }
+
   return result ? X_STATUS_SUCCESS : X_STATUS_UNSUCCESSFUL;
 }
 
+void XTimer::RearmAfterTimeSkip(uint64_t due_ticks) {
+  using xe::chrono::WinSystemClock;
+  using xe::chrono::XSystemClock;
+  uint64_t now_ticks = Clock::QueryGuestTickCount();
+  uint64_t numerator = 10000000;
+  uint64_t denominator = Clock::guest_tick_frequency();
+  reduce_fraction(numerator, denominator);
+  auto after = xe::chrono::hundrednanoseconds(
+      due_ticks > now_ticks
+          ? int64_t((due_ticks - now_ticks) * numerator / denominator)
+          : 0);
+  WinSystemClock::time_point due_tp =
+      date::clock_cast<WinSystemClock>(XSystemClock::now() + after);
+  if (!period_ms_) {
+    timer_->SetOnceAt(due_tp, timer_callback_);
+  } else {
+    timer_->SetRepeatingAt(due_tp, std::chrono::milliseconds(period_ms_),
+                           timer_callback_);
+  }
+}
+
 X_STATUS XTimer::Cancel() {
+  kernel_state()->idle_time_skipper().ClearDeadline(
+      idle_time_skipper_deadline_);
   return timer_->Cancel() ? X_STATUS_SUCCESS : X_STATUS_UNSUCCESSFUL;
 }
 
@@ -10,7 +10,10 @@
 #ifndef XENIA_KERNEL_XTIMER_H_
 #define XENIA_KERNEL_XTIMER_H_
 
+#include <functional>
+
 #include "xenia/base/threading.h"
+#include "xenia/kernel/util/idle_time_skipper.h"
 #include "xenia/kernel/xobject.h"
 #include "xenia/xbox.h"
 
@@ -36,7 +39,14 @@ class XTimer : public XObject {
   xe::threading::WaitHandle* GetWaitHandle() override { return timer_.get(); }
 
  private:
+  // Reschedules the host timer after the guest time has been skipped ahead.
+  void RearmAfterTimeSkip(uint64_t due_ticks);
+
   std::unique_ptr<xe::threading::Timer> timer_;
+  // For rearming with idle time skipping.
+  std::function<void()> timer_callback_;
+  uint32_t period_ms_ = 0;
+  util::IdleTimeSkipper::Deadline idle_time_skipper_deadline_;
 
   XThread* callback_thread_ = nullptr;
   uint32_t callback_routine_ = 0;
@@ -10,18 +10,25 @@
 #include "xenia/memory.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 
 #include "third_party/fmt/include/fmt/format.h"
+#include "third_party/snappy/snappy.h"
 #include "xenia/base/assert.h"
 #include "xenia/base/byte_stream.h"
 #include "xenia/base/clock.h"
 #include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
 #include "xenia/base/threading.h"
 #include "xenia/cpu/mmio_handler.h"
+#include "xenia/cpu/thread_state.h"
 
 // TODO(benvanik): move xbox.h out
 #include "xenia/xbox.h"
@@ -32,6 +39,41 @@ DEFINE_bool(protect_on_release, false,
             "Protect released memory to prevent accesses.", "Memory");
 DEFINE_bool(scribble_heap, false,
             "Scribble 0xCD into all allocated heap memory.", "Memory");
+DEFINE_bool(
+    host_write_tracking, false,
+    "Detect writes to the physical memory watched by the GPU emulation by "
+    "polling the host tracking of written pages, instead of protecting the "
+    "pages and handling access violations, if supported by the host (Linux "
+    "6.7+). The writes are detected when the GPU starts executing commands.",
+    "Memory");
+
+DEFINE_bool(
+    host_large_pages, false,
+    "Request backing the guest memory with large host pages (transparent huge "
+    "pages on Linux, which must be enabled in the \"always\" or \"madvise\" "
+    "mode) to reduce TLB misses. Large pages are split back into normal pages "
+    "where smaller ranges are protected, such as for memory watches, so this "
+    "works best with --host_write_tracking.",
+    "Memory");
+DEFINE_int32(
+    host_numa_node, -1,
+    "NUMA node to place the guest memory, the generated code and the emulator "
+    "threads on, on hosts with multiple NUMA nodes, to avoid accessing the "
+    "memory of a remote node.\n"
+    " -2 = Leave the placement to the host.\n"
+    " -1 = The node with the most logical processors available to the "
+    "process (on hosts with more than one node).\n"
+    " Other values = The node with the specified index.",
+    "Memory");
+
+DEFINE_bool(track_guest_allocations, false,
+            "Track the guest code allocating each region of memory and the "
+            "access violations caused by memory watches in each range, for "
+            "the memory pane of the debugger and --heap_usage_dump_path.",
+            "Memory");
+DEFINE_path(heap_usage_dump_path, "",
+            "File to write the usage of the memory heaps to on shutdown.",
+            "Memory");
 
 namespace xe {
 uint32_t get_page_count(uint32_t value, uint32_t page_size) {
@@ -95,6 +137,10 @@ Memory::~Memory() {
   assert_true(active_memory_ == this);
   active_memory_ = nullptr;
 
+  if (!cvars::heap_usage_dump_path.empty()) {
+    DumpHeapUsage(cvars::heap_usage_dump_path);
+  }
+
   // Uninstall the MMIO handler, as we won't be able to service more
   // requests.
   mmio_handler_.reset();
@@ -102,6 +148,9 @@ Memory::~Memory() {
   for (auto invalidation_callback : physical_memory_invalidation_callbacks_) {
     delete invalidation_callback;
   }
+  for (auto allocation_callback : physical_memory_allocation_callbacks_) {
+    delete allocation_callback;
+  }
 
   heaps_.v00000000.Dispose();
   heaps_.v40000000.Dispose();
@@ -157,6 +206,28 @@ bool Memory::Initialize() {
   virtual_membase_ = mapping_base_;
   physical_membase_ = mapping_base_ + 0x100000000ull;
 
+  if (cvars::host_large_pages) {
+    // The views cover the 4 GB virtual and the 512 MB physical address space
+    // contiguously.
+    host_large_pages_ =
+        xe::memory::AdviseLargePages(mapping_base_, 0x120000000);
+    if (host_large_pages_) {
+      XELOGI("Requested large host pages for the guest memory");
+    } else {
+      XELOGW("Large host pages are not supported for the guest memory");
+    }
+  }
+
+  host_numa_node_ = SelectHostNumaNode();
+  if (host_numa_node_ != UINT32_MAX) {
+    // First touch places the pages on the node of the accessing thread if
+    // binding is not supported, and the emulator threads are kept on the node.
+    host_numa_bound_ = xe::memory::BindToNumaNode(mapping_base_, 0x120000000,
+                                                  host_numa_node_);
+    XELOGI("Placing the guest memory on NUMA node {}{}", host_numa_node_,
+           host_numa_bound_ ? "" : " by first touch");
+  }
+
   // Prepare virtual heaps.
   heaps_.v00000000.Initialize(this, virtual_membase_, HeapType::kGuestVirtual,
                               0x00000000, 0x40000000, 4096);
@@ -205,6 +276,18 @@ bool Memory::Initialize() {
     return false;
   }
 
+  if (cvars::host_write_tracking) {
+    if (heaps_.vA0000000.EnableHostWriteTracking() &&
+        heaps_.vC0000000.EnableHostWriteTracking() &&
+        heaps_.vE0000000.EnableHostWriteTracking()) {
+      XELOGI("Using host write tracking for physical memory watches");
+    } else {
+      XELOGW(
+          "Host write tracking is not supported, protecting the physical "
+          "memory watched pages instead");
+    }
+  }
+
   // ?
   uint32_t unk_phys_alloc;
   heaps_.vA0000000.Alloc(0x340000, 64 * 1024, kMemoryAllocationReserve,
@@ -303,12 +386,82 @@ void Memory::UnmapViews() {
   }
 }
 
+uint32_t Memory::SelectHostNumaNode() {
+  if (cvars::host_numa_node < -1) {
+    return UINT32_MAX;
+  }
+  std::vector<uint32_t> node_processor_counts;
+  for (const xe::threading::LogicalProcessor& processor :
+       xe::threading::GetLogicalProcessors()) {
+    if (processor.numa_node >= node_processor_counts.size()) {
+      node_processor_counts.resize(processor.numa_node + 1);
+    }
+    ++node_processor_counts[processor.numa_node];
+  }
+  if (cvars::host_numa_node >= 0) {
+    uint32_t node = uint32_t(cvars::host_numa_node);
+    if (node >= node_processor_counts.size() ||
+        !node_processor_counts[node]) {
+      XELOGW("No logical processors available on NUMA node {}, leaving the "
+             "placement to the host",
+             node);
+      return UINT32_MAX;
+    }
+    return node;
+  }
+  uint32_t node = UINT32_MAX;
+  uint32_t node_count = 0;
+  for (uint32_t i = 0; i < uint32_t(node_processor_counts.size()); ++i) {
+    if (!node_processor_counts[i]) {
+      continue;
+    }
+    ++node_count;
+    if (node == UINT32_MAX ||
+        node_processor_counts[i] > node_processor_counts[node]) {
+      node = i;
+    }
+  }
+  // Not restricting anything on a uniform memory access host.
+  return node_count > 1 ? node : UINT32_MAX;
+}
+
+void Memory::ApplyHostPagePolicies(void* host_address, size_t length) const {
+  if (host_large_pages_) {
+    xe::memory::AdviseLargePages(host_address, length);
+  }
+  if (host_numa_bound_) {
+    xe::memory::BindToNumaNode(host_address, length, host_numa_node_);
+  }
+}
+
+void Memory::LogHostNumaResidency() const {
+  if (host_numa_node_ == UINT32_MAX) {
+    return;
+  }
+  // Remote accesses themselves are only visible to hardware performance
+  // counters, but pages resident on other nodes indicate them.
+  std::vector<uint64_t> node_bytes;
+  if (!xe::memory::GetNumaNodeResidentBytes(mapping_base_, 0x120000000,
+                                            node_bytes)) {
+    return;
+  }
+  uint64_t total_bytes = 0;
+  for (uint64_t bytes : node_bytes) {
+    total_bytes += bytes;
+  }
+  uint64_t local_bytes =
+      host_numa_node_ < node_bytes.size() ? node_bytes[host_numa_node_] : 0;
+  XELOGI("Guest memory resident on NUMA node {}: {} of {} KB", host_numa_node_,
+         local_bytes >> 10, total_bytes >> 10);
+}
+
 void Memory::Reset() {
   heaps_.v00000000.Reset();
   heaps_.v40000000.Reset();
   heaps_.v80000000.Reset();
   heaps_.v90000000.Reset();
   heaps_.physical.Reset();
+  ResetSystemHeapPools();
 }
 
 const BaseHeap* Memory::LookupHeap(uint32_t address) const {
@@ -400,19 +553,17 @@ uint32_t Memory::SearchAligned(uint32_t start, uint32_t end,
   assert_true(start <= end);
   auto p = TranslateVirtual<const uint32_t*>(start);
   auto pe = TranslateVirtual<const uint32_t*>(end);
-  while (p != pe) {
-    if (*p == values[0]) {
-      const uint32_t* pc = p + 1;
-      size_t matched = 1;
-      for (size_t n = 1; n < value_count; n++, pc++) {
-        if (*pc != values[n]) {
-          break;
-        }
-        matched++;
-      }
-      if (matched == value_count) {
-        return HostToGuestVirtual(p);
+  while ((p = xe::find_32(p, pe, values[0])) != pe) {
+    const uint32_t* pc = p + 1;
+    size_t matched = 1;
+    for (size_t n = 1; n < value_count; n++, pc++) {
+      if (*pc != values[n]) {
+        break;
       }
+      matched++;
+    }
+    if (matched == value_count) {
+      return HostToGuestVirtual(p);
     }
     p++;
   }
@@ -438,8 +589,8 @@ cpu::MMIORange* Memory::LookupVirtualMappedRange(uint32_t virtual_address) {
 }
 
 bool Memory::AccessViolationCallback(
-    std::unique_lock<std::recursive_mutex> global_lock_locked_once,
-    void* host_address, bool is_write) {
+    std::unique_lock<std::recursive_mutex> global_lock, void* host_address,
+    bool is_write) {
   // Access via physical_membase_ is special, when need to bypass everything
   // (for instance, for a data provider to actually write the data) so only
   // triggering callbacks on virtual memory regions.
@@ -451,8 +602,42 @@ bool Memory::AccessViolationCallback(
   }
   uint32_t virtual_address = HostToGuestVirtual(host_address);
   BaseHeap* heap = LookupHeap(virtual_address);
-  if (heap->heap_type() != HeapType::kGuestPhysical) {
-    return false;
+  PhysicalHeap* physical_heap =
+      heap->heap_type() == HeapType::kGuestPhysical
+          ? static_cast<PhysicalHeap*>(heap)
+          : nullptr;
+
+  // When many threads write to a watched page, all but the one that has
+  // triggered the callbacks only need to wait for the page to become writable,
+  // which is checked without locking so they don't serialize.
+  if (physical_heap && is_write &&
+      physical_heap->IsWriteWatchResolved(virtual_address)) {
+    return true;
+  }
+
+  global_lock.lock();
+
+  // Recheck if the pages are still protected (race condition - another thread
+  // clears the watch we just hit).
+  // Do this under the lock so we don't introduce another race condition.
+  if (physical_heap && is_write &&
+      physical_heap->IsWriteWatchResolved(virtual_address)) {
+    return true;
+  }
+  memory::PageAccess cur_access;
+  size_t page_length = memory::page_size();
+  if (memory::QueryProtect(host_address, page_length, cur_access) &&
+      cur_access != memory::PageAccess::kNoAccess &&
+      (!is_write || cur_access != memory::PageAccess::kReadOnly)) {
+    // Another thread has cleared this watch. Abort.
+    return true;
+  }
+
+  heap->RecordWatchFault(virtual_address);
+
+  if (!physical_heap) {
+    // Only guest code is watched in the virtual memory heaps.
+    return is_write && heap->TriggerCodeWriteWatches(virtual_address, 1);
   }
 
   // Access violation callbacks from the guest are triggered when the global
@@ -460,16 +645,15 @@ bool Memory::AccessViolationCallback(
   //
   // Will be rounded to physical page boundaries internally, so just pass 1 as
   // the length - guranteed not to cross page boundaries also.
-  auto physical_heap = static_cast<PhysicalHeap*>(heap);
-  return physical_heap->TriggerCallbacks(std::move(global_lock_locked_once),
+  return physical_heap->TriggerCallbacks(std::move(global_lock),
                                          virtual_address, 1, is_write, false);
 }
 
 bool Memory::AccessViolationCallbackThunk(
-    std::unique_lock<std::recursive_mutex> global_lock_locked_once,
-    void* context, void* host_address, bool is_write) {
+    std::unique_lock<std::recursive_mutex> global_lock, void* context,
+    void* host_address, bool is_write) {
   return reinterpret_cast<Memory*>(context)->AccessViolationCallback(
-      std::move(global_lock_locked_once), host_address, is_write);
+      std::move(global_lock), host_address, is_write);
 }
 
 bool Memory::TriggerPhysicalMemoryCallbacks(
@@ -486,6 +670,27 @@ bool Memory::TriggerPhysicalMemoryCallbacks(
   return false;
 }
 
+void Memory::TriggerHostWrittenPhysicalMemoryCallbacks() {
+  heaps_.vA0000000.TriggerHostWrittenCallbacks();
+  heaps_.vC0000000.TriggerHostWrittenCallbacks();
+  heaps_.vE0000000.TriggerHostWrittenCallbacks();
+}
+
+void Memory::SetCodeWriteCallback(CodeWriteCallback callback,
+                                  void* callback_context) {
+  auto global_lock = global_critical_region_.Acquire();
+  code_write_callback_ = callback;
+  code_write_callback_context_ = callback_context;
+}
+
+void Memory::WatchCodeWrites(uint32_t virtual_address, uint32_t length) {
+  BaseHeap* heap = LookupHeap(virtual_address);
+  if (!heap || heap->heap_type() == HeapType::kGuestPhysical) {
+    return;
+  }
+  heap->WatchCodeWrites(virtual_address, length);
+}
+
 void* Memory::RegisterPhysicalMemoryInvalidationCallback(
     PhysicalMemoryInvalidationCallback callback, void* callback_context) {
   auto entry = new std::pair<PhysicalMemoryInvalidationCallback, void*>(
@@ -512,6 +717,31 @@ void Memory::UnregisterPhysicalMemoryInvalidationCallback(
   delete entry;
 }
 
+void* Memory::RegisterPhysicalMemoryAllocationCallback(
+    PhysicalMemoryAllocationCallback callback, void* callback_context) {
+  auto entry = new std::pair<PhysicalMemoryAllocationCallback, void*>(
+      callback, callback_context);
+  auto lock = global_critical_region_.Acquire();
+  physical_memory_allocation_callbacks_.push_back(entry);
+  return entry;
+}
+
+void Memory::UnregisterPhysicalMemoryAllocationCallback(void* callback_handle) {
+  auto entry =
+      reinterpret_cast<std::pair<PhysicalMemoryAllocationCallback, void*>*>(
+          callback_handle);
+  {
+    auto lock = global_critical_region_.Acquire();
+    auto it = std::find(physical_memory_allocation_callbacks_.begin(),
+                        physical_memory_allocation_callbacks_.end(), entry);
+    assert_true(it != physical_memory_allocation_callbacks_.end());
+    if (it != physical_memory_allocation_callbacks_.end()) {
+      physical_memory_allocation_callbacks_.erase(it);
+    }
+  }
+  delete entry;
+}
+
 void Memory::EnablePhysicalMemoryAccessCallbacks(
     uint32_t physical_address, uint32_t length,
     bool enable_invalidation_notifications, bool enable_data_providers) {
@@ -526,15 +756,55 @@ void Memory::EnablePhysicalMemoryAccessCallbacks(
                                          enable_data_providers);
 }
 
+namespace {
+// Small system heap allocations (kernel objects and such) are carved out of
+// slabs of equally sized blocks instead of each taking at least a page. The
+// header of a slab occupies its first block, in guest memory, so the slabs are
+// saved and restored along with the rest of the heap.
+constexpr uint32_t kSystemHeapSlabSize = 64 * 1024;
+constexpr uint32_t kSystemHeapSlabMagic = 0x534C4142;  // 'SLAB'
+constexpr uint32_t kSystemHeapPoolMinBlockSizeLog2 = 5;
+constexpr uint32_t kSystemHeapPoolMaxBlockSize =
+    uint32_t(1) << (kSystemHeapPoolMinBlockSizeLog2 +
+                    Memory::kSystemHeapPoolSizeClassCount - 1);
+
+struct SystemHeapSlabHeader {
+  uint32_t magic;
+  uint32_t block_size;
+  // Guest address of the first freed block, with each free block containing
+  // the address of the next one in its first 4 bytes.
+  uint32_t free_list;
+  // Guest address of the first block never allocated, 0 if none are left.
+  uint32_t bump;
+  // Links in the list of slabs with free blocks of the size class.
+  uint32_t next;
+  uint32_t prev;
+  uint32_t used_count;
+  // Memory::system_heap_pool_generation_ when the slab was linked, the links
+  // of slabs from before a reset or a restore are stale.
+  uint32_t generation;
+};
+static_assert(sizeof(SystemHeapSlabHeader) <=
+                  (uint32_t(1) << kSystemHeapPoolMinBlockSizeLog2),
+              "The slab header must fit in the first block");
+}  // namespace
+
 uint32_t Memory::SystemHeapAlloc(uint32_t size, uint32_t alignment,
                                  uint32_t system_heap_flags) {
-  // TODO(benvanik): lightweight pool.
   bool is_physical = !!(system_heap_flags & kSystemHeapPhysical);
   auto heap = LookupHeapByType(is_physical, 4096);
   uint32_t address;
-  if (!heap->Alloc(size, alignment,
-                   kMemoryAllocationReserve | kMemoryAllocationCommit,
-                   kMemoryProtectRead | kMemoryProtectWrite, false, &address)) {
+  uint32_t block_size = std::max(size, alignment);
+  if (block_size <= kSystemHeapPoolMaxBlockSize) {
+    address = SystemHeapPoolAlloc(heap, system_heap_pools_[is_physical],
+                                  block_size);
+    if (!address) {
+      return 0;
+    }
+  } else if (!heap->Alloc(size, alignment,
+                          kMemoryAllocationReserve | kMemoryAllocationCommit,
+                          kMemoryProtectRead | kMemoryProtectWrite, false,
+                          &address)) {
     return 0;
   }
   Zero(address, size);
@@ -545,11 +815,143 @@ void Memory::SystemHeapFree(uint32_t address) {
   if (!address) {
     return;
   }
-  // TODO(benvanik): lightweight pool.
   auto heap = LookupHeap(address);
+  if (heap == &heaps_.v00000000 &&
+      SystemHeapPoolFree(heap, system_heap_pools_[0], address)) {
+    return;
+  }
+  if (heap == &heaps_.vE0000000 &&
+      SystemHeapPoolFree(heap, system_heap_pools_[1], address)) {
+    return;
+  }
   heap->Release(address);
 }
 
+uint32_t Memory::SystemHeapPoolAlloc(BaseHeap* heap, SystemHeapPool& pool,
+                                     uint32_t block_size) {
+  block_size = std::max(xe::next_pow2(block_size),
+                        uint32_t(1) << kSystemHeapPoolMinBlockSizeLog2);
+  uint32_t size_class =
+      uint32_t(31 - xe::lzcnt(block_size)) - kSystemHeapPoolMinBlockSizeLog2;
+
+  // The heaps themselves are protected by the global critical region, and the
+  // kernel often allocates while holding it already, so taking it for the pool
+  // too avoids a lock order inversion.
+  auto global_lock = global_critical_region_.Acquire();
+  uint32_t slab_base = pool.partial_slabs[size_class];
+  SystemHeapSlabHeader* header;
+  if (slab_base) {
+    header = TranslateVirtual<SystemHeapSlabHeader*>(slab_base);
+  } else {
+    if (!heap->Alloc(kSystemHeapSlabSize, kSystemHeapSlabSize,
+                     kMemoryAllocationReserve | kMemoryAllocationCommit,
+                     kMemoryProtectRead | kMemoryProtectWrite, false,
+                     &slab_base)) {
+      return 0;
+    }
+    header = TranslateVirtual<SystemHeapSlabHeader*>(slab_base);
+    header->magic = kSystemHeapSlabMagic;
+    header->block_size = block_size;
+    header->free_list = 0;
+    header->bump = slab_base + block_size;
+    header->next = 0;
+    header->prev = 0;
+    header->used_count = 0;
+    header->generation = system_heap_pool_generation_;
+    pool.partial_slabs[size_class] = slab_base;
+  }
+
+  uint32_t address;
+  if (header->free_list) {
+    address = header->free_list;
+    header->free_list = *TranslateVirtual<uint32_t*>(address);
+  } else {
+    address = header->bump;
+    header->bump += block_size;
+    if (header->bump - slab_base >= kSystemHeapSlabSize) {
+      header->bump = 0;
+    }
+  }
+  ++header->used_count;
+
+  if (!header->free_list && !header->bump) {
+    // Full, only slabs with free blocks are kept in the list.
+    pool.partial_slabs[size_class] = header->next;
+    if (header->next) {
+      TranslateVirtual<SystemHeapSlabHeader*>(header->next)->prev = 0;
+    }
+    header->next = 0;
+  }
+  return address;
+}
+
+bool Memory::SystemHeapPoolFree(BaseHeap* heap, SystemHeapPool& pool,
+                                uint32_t address) {
+  // Blocks are never at the beginning of a slab since the header is there,
+  // while other allocations are freed by their base address.
+  uint32_t slab_base = address & ~(kSystemHeapSlabSize - 1);
+  if (slab_base == address) {
+    return false;
+  }
+  auto global_lock = global_critical_region_.Acquire();
+  uint32_t region_base = address;
+  uint32_t region_size;
+  if (!heap->QueryBaseAndSize(&region_base, &region_size)) {
+    return false;
+  }
+  // The page table stores the base addresses relative to the heap.
+  region_base += heap->heap_base();
+  if (region_base != slab_base || region_size != kSystemHeapSlabSize) {
+    return false;
+  }
+  auto header = TranslateVirtual<SystemHeapSlabHeader*>(slab_base);
+  if (header->magic != kSystemHeapSlabMagic) {
+    return false;
+  }
+  uint32_t size_class =
+      uint32_t(31 - xe::lzcnt(header->block_size)) -
+      kSystemHeapPoolMinBlockSizeLog2;
+  assert_true(size_class < kSystemHeapPoolSizeClassCount);
+  assert_not_zero(header->used_count);
+
+  bool was_listed = header->generation == system_heap_pool_generation_ &&
+                    (header->free_list || header->bump);
+  *TranslateVirtual<uint32_t*>(address) = header->free_list;
+  header->free_list = address;
+  --header->used_count;
+
+  if (!was_listed) {
+    header->prev = 0;
+    header->next = pool.partial_slabs[size_class];
+    if (header->next) {
+      TranslateVirtual<SystemHeapSlabHeader*>(header->next)->prev = slab_base;
+    }
+    header->generation = system_heap_pool_generation_;
+    pool.partial_slabs[size_class] = slab_base;
+  } else if (!header->used_count &&
+             pool.partial_slabs[size_class] != slab_base) {
+    // Keep only the slab at the head of the list when it becomes empty, so
+    // alternating allocations and frees don't allocate and release slabs.
+    TranslateVirtual<SystemHeapSlabHeader*>(header->prev)->next = header->next;
+    if (header->next) {
+      TranslateVirtual<SystemHeapSlabHeader*>(header->next)->prev =
+          header->prev;
+    }
+    header->magic = 0;
+    heap->Release(slab_base);
+  }
+  return true;
+}
+
+void Memory::ResetSystemHeapPools() {
+  auto global_lock = global_critical_region_.Acquire();
+  for (SystemHeapPool& pool : system_heap_pools_) {
+    std::fill(std::begin(pool.partial_slabs), std::end(pool.partial_slabs),
+              uint32_t(0));
+  }
+  ++system_heap_pool_generation_;
+}
+
 void Memory::DumpMap() {
   XELOGE("==================================================================");
   XELOGE("Memory Dump");
@@ -580,28 +982,105 @@ void Memory::DumpMap() {
   XELOGE("");
 }
 
-bool Memory::Save(ByteStream* stream) {
-  XELOGD("Serializing memory...");
-  heaps_.v00000000.Save(stream);
-  heaps_.v40000000.Save(stream);
-  heaps_.v80000000.Save(stream);
-  heaps_.v90000000.Save(stream);
-  heaps_.physical.Save(stream);
+std::vector<HeapUsageReport> Memory::GetHeapUsageReports() {
+  BaseHeap* heaps[] = {
+      &heaps_.v00000000, &heaps_.v40000000, &heaps_.v80000000,
+      &heaps_.v90000000, &heaps_.vA0000000, &heaps_.vC0000000,
+      &heaps_.vE0000000, &heaps_.physical,
+  };
+  std::vector<HeapUsageReport> reports(xe::countof(heaps));
+  for (size_t i = 0; i < xe::countof(heaps); ++i) {
+    heaps[i]->GetUsageReport(reports[i]);
+  }
+  return reports;
+}
 
+bool Memory::DumpHeapUsage(const std::filesystem::path& path) {
+  FILE* file = xe::filesystem::OpenFile(path, "w");
+  if (!file) {
+    XELOGE("Failed to open {} for writing the heap usage",
+           xe::path_to_utf8(path));
+    return false;
+  }
+  std::vector<HeapUsageReport> reports = GetHeapUsageReports();
+  for (size_t i = 0; i < reports.size(); ++i) {
+    const HeapUsageReport& report = reports[i];
+    // The physical address space heap is the last one.
+    fmt::print(file, "Heap {:08X}-{:08X}{}\n", report.heap_base,
+               report.heap_base + (report.heap_size - 1),
+               i + 1 == reports.size() ? " (physical)" : "");
+    fmt::print(file, "  Page size: {:X}\n", report.page_size);
+    fmt::print(file, "  Regions: {}\n", report.region_count);
+    fmt::print(file, "  Reserved: {} pages, {} bytes\n",
+               report.reserved_page_count,
+               uint64_t(report.reserved_page_count) * report.page_size);
+    fmt::print(file, "  Committed: {} pages, {} bytes\n",
+               report.committed_page_count,
+               uint64_t(report.committed_page_count) * report.page_size);
+    fmt::print(file,
+               "  Unreserved ranges: {}, largest {} pages, fragmentation "
+               "{:.1f}%\n",
+               report.unreserved_range_count,
+               report.largest_unreserved_range_page_count,
+               report.fragmentation() * 100.0f);
+    if (!report.callers.empty()) {
+      fmt::print(file, "  Allocating guest code (LR, regions, bytes):\n");
+      for (const HeapUsageReport::Caller& caller : report.callers) {
+        fmt::print(file, "    {:08X} {:8} {:12}\n", caller.guest_lr,
+                   caller.region_count, caller.size);
+      }
+    }
+    if (!report.watch_fault_ranges.empty()) {
+      fmt::print(file, "  Most watch faults (range, faults):\n");
+      for (const HeapUsageReport::WatchFaultRange& range :
+           report.watch_fault_ranges) {
+        fmt::print(file, "    {:08X}-{:08X} {:10}\n", range.address,
+                   range.address + (range.length - 1), range.fault_count);
+      }
+    }
+    fmt::print(file, "\n");
+  }
+  fclose(file);
+  XELOGI("Wrote the heap usage to {}", xe::path_to_utf8(path));
   return true;
 }
 
-bool Memory::Restore(ByteStream* stream) {
-  XELOGD("Restoring memory...");
-  heaps_.v00000000.Restore(stream);
-  heaps_.v40000000.Restore(stream);
-  heaps_.v80000000.Restore(stream);
-  heaps_.v90000000.Restore(stream);
-  heaps_.physical.Restore(stream);
+std::vector<HeapSnapshot> Memory::TakeSnapshot() {
+  XELOGD("Taking a memory snapshot...");
+  std::vector<HeapSnapshot> snapshot(5);
+  heaps_.v00000000.TakeSnapshot(snapshot[0]);
+  heaps_.v40000000.TakeSnapshot(snapshot[1]);
+  heaps_.v80000000.TakeSnapshot(snapshot[2]);
+  heaps_.v90000000.TakeSnapshot(snapshot[3]);
+  heaps_.physical.TakeSnapshot(snapshot[4]);
+  return snapshot;
+}
 
+bool Memory::WriteSnapshot(const std::vector<HeapSnapshot>& snapshot,
+                           ByteStream* stream) {
+  XELOGD("Serializing memory...");
+  for (const HeapSnapshot& heap_snapshot : snapshot) {
+    if (!heap_snapshot.Write(stream)) {
+      return false;
+    }
+  }
   return true;
 }
 
+bool Memory::Save(ByteStream* stream) {
+  return WriteSnapshot(TakeSnapshot(), stream);
+}
+
+bool Memory::Restore(ByteStream* stream) {
+  XELOGD("Restoring memory...");
+  // Slabs with free blocks in the restored heaps are relinked when freed to.
+  ResetSystemHeapPools();
+  return heaps_.v00000000.Restore(stream) &&
+         heaps_.v40000000.Restore(stream) &&
+         heaps_.v80000000.Restore(stream) &&
+         heaps_.v90000000.Restore(stream) && heaps_.physical.Restore(stream);
+}
+
 xe::memory::PageAccess ToPageAccess(uint32_t protect) {
   if ((protect & kMemoryProtectRead) && !(protect & kMemoryProtectWrite)) {
     return xe::memory::PageAccess::kReadOnly;
@@ -650,6 +1129,259 @@ void BaseHeap::Initialize(Memory* memory, uint8_t* membase, HeapType heap_type,
   page_size_ = page_size;
   host_address_offset_ = host_address_offset;
   page_table_.resize(heap_size / page_size);
+  RebuildUnreservedPageIndex();
+  RebuildPageAccessIndex();
+  if (cvars::track_guest_allocations) {
+    allocation_callers_.resize(page_table_.size());
+    watch_fault_counts_.resize(
+        xe::round_up(heap_size, HeapUsageReport::kWatchFaultGranuleSize) /
+        HeapUsageReport::kWatchFaultGranuleSize);
+  }
+}
+
+void BaseHeap::SetPagesUnreserved(uint32_t start_page_number,
+                                  uint32_t page_count, bool unreserved) {
+  uint32_t end_page_number = start_page_number + page_count;
+  uint32_t page_number = start_page_number;
+  while (page_number < end_page_number) {
+    size_t word_index = page_number >> 6;
+    uint32_t word_first_bit = page_number & 63;
+    uint32_t word_bit_count =
+        std::min(end_page_number - page_number, 64 - word_first_bit);
+    uint64_t mask = (word_bit_count == 64
+                         ? ~uint64_t(0)
+                         : (uint64_t(1) << word_bit_count) - 1)
+                    << word_first_bit;
+    uint64_t& word = unreserved_pages_[word_index];
+    uint64_t old_word = word;
+    if (unreserved) {
+      word |= mask;
+      unreserved_page_count_ += xe::bit_count(word ^ old_word);
+    } else {
+      word &= ~mask;
+      unreserved_page_count_ -= xe::bit_count(word ^ old_word);
+    }
+    uint64_t summary_bit = uint64_t(1) << (word_index & 63);
+    if (word) {
+      unreserved_page_words_any_[word_index >> 6] |= summary_bit;
+    } else {
+      unreserved_page_words_any_[word_index >> 6] &= ~summary_bit;
+    }
+    if (word == ~uint64_t(0)) {
+      unreserved_page_words_all_[word_index >> 6] |= summary_bit;
+    } else {
+      unreserved_page_words_all_[word_index >> 6] &= ~summary_bit;
+    }
+    page_number += word_bit_count;
+  }
+}
+
+void BaseHeap::RebuildUnreservedPageIndex() {
+  // The bits past the last page are never set, so they are reserved pages.
+  size_t word_count = (page_table_.size() + 63) >> 6;
+  size_t summary_word_count = (word_count + 63) >> 6;
+  unreserved_pages_.clear();
+  unreserved_pages_.resize(word_count);
+  unreserved_page_words_any_.clear();
+  unreserved_page_words_any_.resize(summary_word_count);
+  unreserved_page_words_all_.clear();
+  unreserved_page_words_all_.resize(summary_word_count);
+  unreserved_page_count_ = 0;
+  uint32_t page_count = uint32_t(page_table_.size());
+  uint32_t page_number = 0;
+  while (page_number < page_count) {
+    if (page_table_[page_number].state) {
+      ++page_number;
+      continue;
+    }
+    uint32_t span_start_page_number = page_number;
+    while (page_number < page_count && !page_table_[page_number].state) {
+      ++page_number;
+    }
+    SetPagesUnreserved(span_start_page_number,
+                       page_number - span_start_page_number, true);
+  }
+}
+
+// Sets or clears the bits for a range of pages in a page bit index, and
+// updates the bits for whether all pages in each 64-bit word have them set.
+static void SetPageIndexBits(std::vector<uint64_t>& pages,
+                             std::vector<uint64_t>& page_words_all,
+                             uint32_t start_page_number, uint32_t page_count,
+                             bool set) {
+  uint32_t end_page_number = start_page_number + page_count;
+  uint32_t page_number = start_page_number;
+  while (page_number < end_page_number) {
+    size_t word_index = page_number >> 6;
+    uint32_t word_first_bit = page_number & 63;
+    uint32_t word_bit_count =
+        std::min(end_page_number - page_number, 64 - word_first_bit);
+    uint64_t mask = (word_bit_count == 64
+                         ? ~uint64_t(0)
+                         : (uint64_t(1) << word_bit_count) - 1)
+                    << word_first_bit;
+    uint64_t& word = pages[word_index];
+    if (set) {
+      word |= mask;
+    } else {
+      word &= ~mask;
+    }
+    uint64_t summary_bit = uint64_t(1) << (word_index & 63);
+    if (word == ~uint64_t(0)) {
+      page_words_all[word_index >> 6] |= summary_bit;
+    } else {
+      page_words_all[word_index >> 6] &= ~summary_bit;
+    }
+    page_number += word_bit_count;
+  }
+}
+
+// Returns whether the bits for all pages within the inclusive range are set in
+// a page bit index, checking the whole 64-bit words in the middle of the range
+// via the summary bits, 4096 pages at a time.
+static bool AreAllPageIndexBitsSet(const std::vector<uint64_t>& pages,
+                                   const std::vector<uint64_t>& page_words_all,
+                                   uint32_t first_page_number,
+                                   uint32_t last_page_number) {
+  size_t first_word_index = first_page_number >> 6;
+  size_t last_word_index = last_page_number >> 6;
+  uint64_t first_word_mask = ~uint64_t(0) << (first_page_number & 63);
+  uint64_t last_word_mask = ~uint64_t(0) >> (63 - (last_page_number & 63));
+  if (first_word_index == last_word_index) {
+    uint64_t mask = first_word_mask & last_word_mask;
+    return (pages[first_word_index] & mask) == mask;
+  }
+  if ((pages[first_word_index] & first_word_mask) != first_word_mask ||
+      (pages[last_word_index] & last_word_mask) != last_word_mask) {
+    return false;
+  }
+  size_t word_index = first_word_index + 1;
+  while (word_index < last_word_index) {
+    size_t summary_index = word_index >> 6;
+    size_t summary_end_word_index =
+        std::min((summary_index + 1) << 6, last_word_index);
+    size_t summary_bit_count = summary_end_word_index - word_index;
+    uint64_t mask = (summary_bit_count == 64
+                         ? ~uint64_t(0)
+                         : (uint64_t(1) << summary_bit_count) - 1)
+                    << (word_index & 63);
+    if ((page_words_all[summary_index] & mask) != mask) {
+      return false;
+    }
+    word_index = summary_end_word_index;
+  }
+  return true;
+}
+
+void BaseHeap::SetPagesAccessIndex(uint32_t start_page_number,
+                                   uint32_t page_count, uint32_t protect) {
+  SetPageIndexBits(readable_pages_, readable_page_words_all_,
+                   start_page_number, page_count,
+                   (protect & kMemoryProtectRead) != 0);
+  SetPageIndexBits(writable_pages_, writable_page_words_all_,
+                   start_page_number, page_count,
+                   (protect & kMemoryProtectWrite) != 0);
+}
+
+void BaseHeap::RebuildPageAccessIndex() {
+  // The bits past the last page are never set, so they are inaccessible.
+  size_t word_count = (page_table_.size() + 63) >> 6;
+  size_t summary_word_count = (word_count + 63) >> 6;
+  readable_pages_.clear();
+  readable_pages_.resize(word_count);
+  readable_page_words_all_.clear();
+  readable_page_words_all_.resize(summary_word_count);
+  writable_pages_.clear();
+  writable_pages_.resize(word_count);
+  writable_page_words_all_.clear();
+  writable_page_words_all_.resize(summary_word_count);
+  uint32_t page_count = uint32_t(page_table_.size());
+  uint32_t page_number = 0;
+  while (page_number < page_count) {
+    uint32_t protect = page_table_[page_number].current_protect;
+    uint32_t span_start_page_number = page_number;
+    while (++page_number < page_count &&
+           page_table_[page_number].current_protect == protect) {
+    }
+    if (protect & (kMemoryProtectRead | kMemoryProtectWrite)) {
+      SetPagesAccessIndex(span_start_page_number,
+                          page_number - span_start_page_number, protect);
+    }
+  }
+}
+
+uint32_t BaseHeap::FindPage(uint32_t first_page_number,
+                            uint32_t last_page_number, bool unreserved,
+                            bool reverse) const {
+  if (first_page_number > last_page_number) {
+    return UINT32_MAX;
+  }
+  uint64_t invert = unreserved ? 0 : ~uint64_t(0);
+  auto page_word = [&](size_t word_index) {
+    return unreserved_pages_[word_index] ^ invert;
+  };
+  // Bits for the words that may contain a matching page.
+  auto summary_word = [&](size_t summary_index) {
+    return unreserved ? unreserved_page_words_any_[summary_index]
+                      : ~unreserved_page_words_all_[summary_index];
+  };
+  size_t first_word_index = first_page_number >> 6;
+  size_t last_word_index = last_page_number >> 6;
+
+  if (!reverse) {
+    size_t word_index = first_word_index;
+    uint64_t bits =
+        page_word(word_index) & (~uint64_t(0) << (first_page_number & 63));
+    while (!bits) {
+      if (++word_index > last_word_index) {
+        return UINT32_MAX;
+      }
+      // Skip the words without matching pages.
+      size_t summary_index = word_index >> 6;
+      uint64_t summary_bits =
+          summary_word(summary_index) & (~uint64_t(0) << (word_index & 63));
+      while (!summary_bits) {
+        if ((++summary_index << 6) > last_word_index) {
+          return UINT32_MAX;
+        }
+        summary_bits = summary_word(summary_index);
+      }
+      word_index = (summary_index << 6) + xe::tzcnt(summary_bits);
+      if (word_index > last_word_index) {
+        return UINT32_MAX;
+      }
+      bits = page_word(word_index);
+    }
+    uint32_t page_number = uint32_t(word_index << 6) + xe::tzcnt(bits);
+    return page_number <= last_page_number ? page_number : UINT32_MAX;
+  }
+
+  size_t word_index = last_word_index;
+  uint64_t bits = page_word(word_index) &
+                  (~uint64_t(0) >> (63 - (last_page_number & 63)));
+  while (!bits) {
+    if (word_index == first_word_index) {
+      return UINT32_MAX;
+    }
+    --word_index;
+    // Skip the words without matching pages.
+    size_t summary_index = word_index >> 6;
+    uint64_t summary_bits = summary_word(summary_index) &
+                            (~uint64_t(0) >> (63 - (word_index & 63)));
+    while (!summary_bits) {
+      if (summary_index == (first_word_index >> 6)) {
+        return UINT32_MAX;
+      }
+      summary_bits = summary_word(--summary_index);
+    }
+    word_index = (summary_index << 6) + 63 - xe::lzcnt(summary_bits);
+    if (word_index < first_word_index) {
+      return UINT32_MAX;
+    }
+    bits = page_word(word_index);
+  }
+  uint32_t page_number = uint32_t(word_index << 6) + 63 - xe::lzcnt(bits);
+  return page_number >= first_page_number ? page_number : UINT32_MAX;
 }
 
 void BaseHeap::Dispose() {
@@ -675,23 +1407,25 @@ void BaseHeap::DumpMap() {
   XELOGE("            Page Size: {0} ({0:08X})", page_size_);
   XELOGE("           Page Count: {}", page_table_.size());
   XELOGE("  Host Address Offset: {0} ({0:08X})", host_address_offset_);
-  bool is_empty_span = false;
-  uint32_t empty_span_start = 0;
-  for (uint32_t i = 0; i < uint32_t(page_table_.size()); ++i) {
+  uint32_t page_count = uint32_t(page_table_.size());
+  for (uint32_t i = 0; i < page_count; ++i) {
     auto& page = page_table_[i];
     if (!page.state) {
-      if (!is_empty_span) {
-        is_empty_span = true;
-        empty_span_start = i;
+      uint32_t empty_span_start = i;
+      uint32_t empty_span_end = FindPage(i, page_count - 1, false, false);
+      if (empty_span_end == UINT32_MAX) {
+        XELOGE("  {:08X}-{:08X} - {} unreserved pages)",
+               heap_base_ + empty_span_start * page_size_,
+               heap_base_ + (heap_size_ - 1), page_count - empty_span_start);
+        break;
       }
-      continue;
-    }
-    if (is_empty_span) {
       XELOGE("  {:08X}-{:08X} {:6d}p {:10d}b unreserved",
              heap_base_ + empty_span_start * page_size_,
-             heap_base_ + i * page_size_, i - empty_span_start,
-             (i - empty_span_start) * page_size_);
-      is_empty_span = false;
+             heap_base_ + empty_span_end * page_size_,
+             empty_span_end - empty_span_start,
+             (empty_span_end - empty_span_start) * page_size_);
+      i = empty_span_end - 1;
+      continue;
     }
     const char* state_name = "   ";
     if (page.state & kMemoryAllocationCommit) {
@@ -708,118 +1442,296 @@ void BaseHeap::DumpMap() {
            state_name, access_r, access_w);
     i += page.region_page_count - 1;
   }
-  if (is_empty_span) {
-    XELOGE("  {:08X}-{:08X} - {} unreserved pages)",
-           heap_base_ + empty_span_start * page_size_,
-           heap_base_ + (heap_size_ - 1),
-           page_table_.size() - empty_span_start);
-  }
 }
 
 uint32_t BaseHeap::GetTotalPageCount() { return uint32_t(page_table_.size()); }
 
 uint32_t BaseHeap::GetUnreservedPageCount() {
   auto global_lock = global_critical_region_.Acquire();
-  uint32_t count = 0;
-  bool is_empty_span = false;
-  uint32_t empty_span_start = 0;
-  uint32_t size = uint32_t(page_table_.size());
-  for (uint32_t i = 0; i < size; ++i) {
-    auto& page = page_table_[i];
+  return unreserved_page_count_;
+}
+
+void BaseHeap::GetUsageReport(HeapUsageReport& report_out) {
+  report_out = HeapUsageReport();
+  report_out.heap_base = heap_base_;
+  report_out.heap_size = heap_size_;
+  report_out.page_size = page_size_;
+  report_out.committed_page_heatmap.resize(HeapUsageReport::kHeatmapCellCount);
+  report_out.watch_fault_heatmap.resize(HeapUsageReport::kHeatmapCellCount);
+
+  auto global_lock = global_critical_region_.Acquire();
+
+  uint32_t page_count = uint32_t(page_table_.size());
+  std::unordered_map<uint32_t, size_t> caller_indices;
+  uint32_t unreserved_range_page_count = 0;
+  for (uint32_t i = 0; i < page_count; ++i) {
+    const PageEntry& page = page_table_[i];
     if (!page.state) {
-      if (!is_empty_span) {
-        is_empty_span = true;
-        empty_span_start = i;
+      if (!unreserved_range_page_count++) {
+        ++report_out.unreserved_range_count;
       }
+      report_out.largest_unreserved_range_page_count =
+          std::max(report_out.largest_unreserved_range_page_count,
+                   unreserved_range_page_count);
       continue;
     }
-    if (is_empty_span) {
-      is_empty_span = false;
-      count += i - empty_span_start;
+    unreserved_range_page_count = 0;
+    ++report_out.reserved_page_count;
+    if (page.state & kMemoryAllocationCommit) {
+      ++report_out.committed_page_count;
+      ++report_out.committed_page_heatmap[uint64_t(i) *
+                                          HeapUsageReport::kHeatmapCellCount /
+                                          page_count];
     }
-    i += page.region_page_count - 1;
-  }
-  if (is_empty_span) {
-    count += size - empty_span_start;
+    if (page.base_address != i) {
+      continue;
+    }
+    ++report_out.region_count;
+    if (allocation_callers_.empty()) {
+      continue;
+    }
+    uint32_t guest_lr = allocation_callers_[i];
+    auto caller_index_it = caller_indices.find(guest_lr);
+    if (caller_index_it == caller_indices.end()) {
+      caller_index_it =
+          caller_indices.emplace(guest_lr, report_out.callers.size()).first;
+      report_out.callers.push_back({guest_lr, 0, 0});
+    }
+    HeapUsageReport::Caller& caller =
+        report_out.callers[caller_index_it->second];
+    ++caller.region_count;
+    caller.size += uint64_t(page.region_page_count) * page_size_;
+  }
+  std::sort(report_out.callers.begin(), report_out.callers.end(),
+            [](const HeapUsageReport::Caller& a,
+               const HeapUsageReport::Caller& b) { return a.size > b.size; });
+
+  uint32_t granule_count = uint32_t(watch_fault_counts_.size());
+  for (uint32_t i = 0; i < granule_count; ++i) {
+    uint32_t fault_count = watch_fault_counts_[i];
+    if (!fault_count) {
+      continue;
+    }
+    report_out.watch_fault_heatmap[uint64_t(i) *
+                                   HeapUsageReport::kHeatmapCellCount /
+                                   granule_count] += fault_count;
+    report_out.watch_fault_ranges.push_back(
+        {heap_base_ + i * HeapUsageReport::kWatchFaultGranuleSize,
+         HeapUsageReport::kWatchFaultGranuleSize, fault_count});
+  }
+  auto more_faults = [](const HeapUsageReport::WatchFaultRange& a,
+                        const HeapUsageReport::WatchFaultRange& b) {
+    return a.fault_count > b.fault_count;
+  };
+  if (report_out.watch_fault_ranges.size() >
+      HeapUsageReport::kMaxWatchFaultRanges) {
+    std::partial_sort(report_out.watch_fault_ranges.begin(),
+                      report_out.watch_fault_ranges.begin() +
+                          HeapUsageReport::kMaxWatchFaultRanges,
+                      report_out.watch_fault_ranges.end(), more_faults);
+    report_out.watch_fault_ranges.resize(HeapUsageReport::kMaxWatchFaultRanges);
+  } else {
+    std::sort(report_out.watch_fault_ranges.begin(),
+              report_out.watch_fault_ranges.end(), more_faults);
   }
-  return count;
 }
 
-bool BaseHeap::Save(ByteStream* stream) {
-  XELOGD("Heap {:08X}-{:08X}", heap_base_, heap_base_ + (heap_size_ - 1));
+void BaseHeap::RecordWatchFault(uint32_t address) {
+  if (watch_fault_counts_.empty()) {
+    return;
+  }
+  uint32_t& fault_count =
+      watch_fault_counts_[(address - heap_base_) /
+                          HeapUsageReport::kWatchFaultGranuleSize];
+  fault_count = std::min(fault_count, UINT32_MAX - 1) + 1;
+}
 
-  for (size_t i = 0; i < page_table_.size(); i++) {
-    auto& page = page_table_[i];
-    stream->Write(page.qword);
-    if (!page.state) {
-      // Unallocated.
-      continue;
-    }
+void BaseHeap::TrackAllocation(uint32_t start_page_number) {
+  if (allocation_callers_.empty()) {
+    return;
+  }
+  cpu::ThreadState* thread_state = cpu::ThreadState::Get();
+  allocation_callers_[start_page_number] =
+      thread_state ? uint32_t(thread_state->context()->lr) : 0;
+}
 
-    // TODO(DrChat): write compressed with snappy.
-    if (page.state & kMemoryAllocationCommit) {
-      void* addr = TranslateRelative(i * page_size_);
+namespace {
+// Committed pages are compressed and decompressed in chunks of at least this
+// size in parallel.
+constexpr uint32_t kSnapshotChunkSize = 1024 * 1024;
 
-      memory::PageAccess old_access;
-      memory::Protect(addr, page_size_, memory::PageAccess::kReadWrite,
-                      &old_access);
+bool IsZeroFilled(const uint8_t* data, size_t size) {
+  return !size || (!data[0] && !std::memcmp(data, data + 1, size - 1));
+}
+}  // namespace
+
+bool HeapSnapshot::Write(ByteStream* stream) const {
+  stream->Write(page_table.data(), sizeof(PageEntry) * page_table.size());
+
+  uint32_t chunk_size = std::max(kSnapshotChunkSize, page_size);
+  stream->Write(chunk_size);
+  size_t chunk_count =
+      (committed_pages.size() + (chunk_size - 1)) / chunk_size;
+  std::vector<std::string> compressed_chunks(chunk_count);
+  xe::threading::ParallelFor(chunk_count, [&](size_t chunk_index) {
+    size_t offset = chunk_index * chunk_size;
+    size_t size = std::min(size_t(chunk_size), committed_pages.size() - offset);
+    const uint8_t* chunk = committed_pages.data() + offset;
+    if (!IsZeroFilled(chunk, size)) {
+      snappy::Compress(reinterpret_cast<const char*>(chunk), size,
+                       &compressed_chunks[chunk_index]);
+    }
+  });
+  for (const std::string& compressed_chunk : compressed_chunks) {
+    if (stream->data_length() - stream->offset() <
+        sizeof(uint32_t) + compressed_chunk.size()) {
+      XELOGE("Not enough space in the stream for the memory snapshot");
+      return false;
+    }
+    stream->Write(uint32_t(compressed_chunk.size()));
+    stream->Write(compressed_chunk.data(), compressed_chunk.size());
+  }
+  return true;
+}
 
-      stream->Write(addr, page_size_);
+void BaseHeap::TakeSnapshot(HeapSnapshot& snapshot_out) {
+  XELOGD("Heap {:08X}-{:08X}", heap_base_, heap_base_ + (heap_size_ - 1));
+  auto global_lock = global_critical_region_.Acquire();
 
-      memory::Protect(addr, page_size_, old_access, nullptr);
+  snapshot_out.page_size = page_size_;
+  snapshot_out.page_table = page_table_;
+  size_t committed_page_count = 0;
+  for (const PageEntry& page : page_table_) {
+    if (page.state & kMemoryAllocationCommit) {
+      ++committed_page_count;
     }
   }
+  snapshot_out.committed_pages.resize(committed_page_count * page_size_);
 
-  return true;
+  uint8_t* committed_page_data = snapshot_out.committed_pages.data();
+  for (size_t i = 0; i < page_table_.size(); i++) {
+    const PageEntry& page = page_table_[i];
+    if (!(page.state & kMemoryAllocationCommit)) {
+      continue;
+    }
+    void* addr = TranslateRelative(i * page_size_);
+    // Watches only make the pages read-only, but the pages may be inaccessible
+    // to the guest.
+    bool readable = (page.current_protect & kMemoryProtectRead) != 0;
+    if (!readable) {
+      xe::memory::Protect(addr, page_size_, memory::PageAccess::kReadOnly,
+                          nullptr);
+    }
+    std::memcpy(committed_page_data, addr, page_size_);
+    if (!readable) {
+      xe::memory::Protect(addr, page_size_, memory::PageAccess::kNoAccess,
+                          nullptr);
+    }
+    committed_page_data += page_size_;
+  }
 }
 
 bool BaseHeap::Restore(ByteStream* stream) {
   XELOGD("Heap {:08X}-{:08X}", heap_base_, heap_base_ + (heap_size_ - 1));
 
+  stream->Read(page_table_.data(), sizeof(PageEntry) * page_table_.size());
+  // The callers are not saved.
+  std::fill(allocation_callers_.begin(), allocation_callers_.end(), 0);
+
+  // Commit the memory if it isn't already. We do not need to reserve any
+  // memory, as the mapping has already taken care of that. The pages are
+  // writable while restoring, and their protection is set afterwards.
+  std::vector<uint8_t*> committed_pages;
   for (size_t i = 0; i < page_table_.size(); i++) {
     auto& page = page_table_[i];
-    page.qword = stream->Read<uint64_t>();
-    if (!page.state) {
-      // Unallocated.
+    if (!(page.state & kMemoryAllocationCommit)) {
       continue;
     }
-
-    memory::PageAccess page_access = memory::PageAccess::kNoAccess;
-    if ((page.current_protect & kMemoryProtectRead) &&
-        (page.current_protect & kMemoryProtectWrite)) {
-      page_access = memory::PageAccess::kReadWrite;
-    } else if (page.current_protect & kMemoryProtectRead) {
-      page_access = memory::PageAccess::kReadOnly;
+    void* result = xe::memory::AllocFixed(
+        TranslateRelative(i * page_size_), page_size_,
+        memory::AllocationType::kCommit, memory::PageAccess::kReadWrite);
+    if (result) {
+      memory_->ApplyHostPagePolicies(result, page_size_);
     }
+    uint8_t* addr = TranslateRelative(i * page_size_);
+    xe::memory::Protect(addr, page_size_, memory::PageAccess::kReadWrite,
+                        nullptr);
+    committed_pages.push_back(addr);
+  }
 
-    // Commit the memory if it isn't already. We do not need to reserve any
-    // memory, as the mapping has already taken care of that.
-    if (page.state & kMemoryAllocationCommit) {
-      xe::memory::AllocFixed(TranslateRelative(i * page_size_), page_size_,
-                             memory::AllocationType::kCommit,
-                             memory::PageAccess::kReadWrite);
+  // The compressed chunks are decompressed directly from the mapped file.
+  uint32_t chunk_size = stream->Read<uint32_t>();
+  if (chunk_size < page_size_ || chunk_size % page_size_) {
+    XELOGE("Invalid memory snapshot chunk size {}", chunk_size);
+    return false;
+  }
+  size_t pages_per_chunk = chunk_size / page_size_;
+  size_t chunk_count =
+      (committed_pages.size() + (pages_per_chunk - 1)) / pages_per_chunk;
+  std::vector<std::pair<const char*, uint32_t>> compressed_chunks;
+  compressed_chunks.reserve(chunk_count);
+  for (size_t i = 0; i < chunk_count; i++) {
+    uint32_t compressed_size = stream->Read<uint32_t>();
+    compressed_chunks.emplace_back(
+        reinterpret_cast<const char*>(stream->data() + stream->offset()),
+        compressed_size);
+    stream->Advance(compressed_size);
+  }
+  std::atomic<bool> chunks_valid(true);
+  xe::threading::ParallelFor(chunk_count, [&](size_t chunk_index) {
+    size_t first_page = chunk_index * pages_per_chunk;
+    size_t page_count =
+        std::min(pages_per_chunk, committed_pages.size() - first_page);
+    const auto& compressed_chunk = compressed_chunks[chunk_index];
+    if (!compressed_chunk.second) {
+      for (size_t i = 0; i < page_count; i++) {
+        std::memset(committed_pages[first_page + i], 0, page_size_);
+      }
+      return;
+    }
+    std::vector<uint8_t> chunk(page_count * page_size_);
+    size_t uncompressed_size;
+    if (!snappy::GetUncompressedLength(compressed_chunk.first,
+                                       compressed_chunk.second,
+                                       &uncompressed_size) ||
+        uncompressed_size != chunk.size() ||
+        !snappy::RawUncompress(compressed_chunk.first, compressed_chunk.second,
+                               reinterpret_cast<char*>(chunk.data()))) {
+      chunks_valid.store(false, std::memory_order_relaxed);
+      return;
     }
+    for (size_t i = 0; i < page_count; i++) {
+      std::memcpy(committed_pages[first_page + i],
+                  chunk.data() + i * page_size_, page_size_);
+    }
+  });
 
-    // Now read into memory. We'll set R/W protection first, then set the
-    // protection back to its previous state.
-    // TODO(DrChat): read compressed with snappy.
+  size_t committed_page_index = 0;
+  for (size_t i = 0; i < page_table_.size(); i++) {
+    auto& page = page_table_[i];
     if (page.state & kMemoryAllocationCommit) {
-      void* addr = TranslateRelative(i * page_size_);
-      xe::memory::Protect(addr, page_size_, memory::PageAccess::kReadWrite,
-                          nullptr);
-
-      stream->Read(addr, page_size_);
-
-      xe::memory::Protect(addr, page_size_, page_access, nullptr);
+      xe::memory::Protect(committed_pages[committed_page_index++], page_size_,
+                          ToPageAccess(page.current_protect), nullptr);
     }
   }
 
+  RebuildUnreservedPageIndex();
+  RebuildPageAccessIndex();
+  if (!chunks_valid.load(std::memory_order_relaxed)) {
+    XELOGE("Heap {:08X}-{:08X} memory snapshot is corrupted", heap_base_,
+           heap_base_ + (heap_size_ - 1));
+    return false;
+  }
   return true;
 }
 
 void BaseHeap::Reset() {
   // TODO(DrChat): protect pages.
   std::memset(page_table_.data(), 0, sizeof(PageEntry) * page_table_.size());
+  RebuildUnreservedPageIndex();
+  RebuildPageAccessIndex();
+  std::fill(allocation_callers_.begin(), allocation_callers_.end(), 0);
+  std::fill(watch_fault_counts_.begin(), watch_fault_counts_.end(), 0);
   // TODO(Triang3l): Remove access callbacks from pages if this is a physical
   // memory heap.
 }
@@ -891,6 +1803,7 @@ bool BaseHeap::AllocFixed(uint32_t base_address, uint32_t size,
       XELOGE("BaseHeap::AllocFixed failed to alloc range from host");
       return false;
     }
+    memory_->ApplyHostPagePolicies(result, page_count * page_size_);
 
     if (cvars::scribble_heap && protect & kMemoryProtectWrite) {
       std::memset(result, 0xCD, page_count * page_size_);
@@ -910,6 +1823,11 @@ bool BaseHeap::AllocFixed(uint32_t base_address, uint32_t size,
     page_entry.current_protect = protect;
     page_entry.state = kMemoryAllocationReserve | allocation_type;
   }
+  SetPagesUnreserved(start_page_number, page_count, false);
+  SetPagesAccessIndex(start_page_number, page_count, protect);
+  if (allocation_type & kMemoryAllocationReserve) {
+    TrackAllocation(start_page_number);
+  }
 
   return true;
 }
@@ -939,86 +1857,68 @@ bool BaseHeap::AllocRange(uint32_t low_address, uint32_t high_address,
   auto global_lock = global_critical_region_.Acquire();
 
   // Find a free page range.
-  // The base page must match the requested alignment, so we first scan for
-  // a free aligned page and only then check for continuous free pages.
-  // TODO(benvanik): optimized searching (free list buckets, bitmap, etc).
+  // The base page must match the requested alignment. The unreserved page
+  // index is used to skip to the next free page, and to the first reserved
+  // page within a candidate range, rather than checking every page.
   uint32_t start_page_number = UINT_MAX;
-  uint32_t end_page_number = UINT_MAX;
   uint32_t page_scan_stride = alignment / page_size_;
   high_page_number = high_page_number - (high_page_number % page_scan_stride);
-  if (top_down) {
-    for (int64_t base_page_number =
-             high_page_number - xe::round_up(page_count, page_scan_stride);
-         base_page_number >= low_page_number;
-         base_page_number -= page_scan_stride) {
-      if (page_table_[base_page_number].state != 0) {
-        // Base page not free, skip to next usable page.
-        continue;
-      }
-      // Check requested range to ensure free.
-      start_page_number = uint32_t(base_page_number);
-      end_page_number = uint32_t(base_page_number) + page_count - 1;
-      assert_true(end_page_number < page_table_.size());
-      bool any_taken = false;
-      for (uint32_t page_number = uint32_t(base_page_number);
-           !any_taken && page_number <= end_page_number; ++page_number) {
-        bool is_free = page_table_[page_number].state == 0;
-        if (!is_free) {
-          // At least one page in the range is used, skip to next.
-          // We know we'll be starting at least before this page.
-          any_taken = true;
-          if (page_count > page_number) {
-            // Not enough space left to fit entire page range. Breaks outer
-            // loop.
-            base_page_number = -1;
-          } else {
-            base_page_number = page_number - page_count;
-            base_page_number -= base_page_number % page_scan_stride;
-            base_page_number += page_scan_stride;  // cancel out loop logic
-          }
+  // The range must end before high_page_number.
+  if (high_page_number >= low_page_number + page_count) {
+    if (top_down) {
+      uint32_t last_page_number = high_page_number - 1;
+      while (true) {
+        uint32_t free_page_number =
+            FindPage(low_page_number, last_page_number, true, true);
+        if (free_page_number == UINT32_MAX ||
+            free_page_number + 1 < low_page_number + page_count) {
           break;
         }
-      }
-      if (!any_taken) {
-        // Found our place.
-        break;
-      }
-      // Retry.
-      start_page_number = end_page_number = UINT_MAX;
-    }
-  } else {
-    for (uint32_t base_page_number = low_page_number;
-         base_page_number <= high_page_number - page_count;
-         base_page_number += page_scan_stride) {
-      if (page_table_[base_page_number].state != 0) {
-        // Base page not free, skip to next usable page.
-        continue;
-      }
-      // Check requested range to ensure free.
-      start_page_number = base_page_number;
-      end_page_number = base_page_number + page_count - 1;
-      bool any_taken = false;
-      for (uint32_t page_number = base_page_number;
-           !any_taken && page_number <= end_page_number; ++page_number) {
-        bool is_free = page_table_[page_number].state == 0;
-        if (!is_free) {
-          // At least one page in the range is used, skip to next.
-          // We know we'll be starting at least after this page.
-          any_taken = true;
-          base_page_number = xe::round_up(page_number + 1, page_scan_stride);
-          base_page_number -= page_scan_stride;  // cancel out loop logic
+        uint32_t base_page_number = free_page_number + 1 - page_count;
+        base_page_number -= base_page_number % page_scan_stride;
+        if (base_page_number < low_page_number) {
           break;
         }
+        uint32_t taken_page_number = FindPage(
+            base_page_number, base_page_number + page_count - 1, false, true);
+        if (taken_page_number == UINT32_MAX) {
+          // Found our place.
+          start_page_number = base_page_number;
+          break;
+        }
+        // We know we'll be ending before the last taken page.
+        if (taken_page_number <= low_page_number) {
+          break;
+        }
+        last_page_number = taken_page_number - 1;
       }
-      if (!any_taken) {
-        // Found our place.
-        break;
+    } else {
+      uint32_t first_page_number = low_page_number;
+      while (true) {
+        uint32_t free_page_number =
+            FindPage(first_page_number, high_page_number - 1, true, false);
+        if (free_page_number == UINT32_MAX) {
+          break;
+        }
+        uint32_t base_page_number =
+            xe::round_up(free_page_number, page_scan_stride, false);
+        if (base_page_number + page_count > high_page_number) {
+          break;
+        }
+        uint32_t taken_page_number = FindPage(
+            base_page_number, base_page_number + page_count - 1, false, false);
+        if (taken_page_number == UINT32_MAX) {
+          // Found our place.
+          start_page_number = base_page_number;
+          break;
+        }
+        // We know we'll be starting after the first taken page.
+        first_page_number = taken_page_number + 1;
       }
-      // Retry.
-      start_page_number = end_page_number = UINT_MAX;
     }
   }
-  if (start_page_number == UINT_MAX || end_page_number == UINT_MAX) {
+  uint32_t end_page_number = start_page_number + page_count - 1;
+  if (start_page_number == UINT_MAX) {
     // Out of memory.
     XELOGE("BaseHeap::Alloc failed to find contiguous range");
     assert_always("Heap exhausted!");
@@ -1039,6 +1939,7 @@ bool BaseHeap::AllocRange(uint32_t low_address, uint32_t high_address,
       XELOGE("BaseHeap::Alloc failed to alloc range from host");
       return false;
     }
+    memory_->ApplyHostPagePolicies(result, page_count * page_size_);
 
     if (cvars::scribble_heap && (protect & kMemoryProtectWrite)) {
       std::memset(result, 0xCD, page_count * page_size_);
@@ -1055,6 +1956,9 @@ bool BaseHeap::AllocRange(uint32_t low_address, uint32_t high_address,
     page_entry.current_protect = protect;
     page_entry.state = kMemoryAllocationReserve | allocation_type;
   }
+  SetPagesUnreserved(start_page_number, page_count, false);
+  SetPagesAccessIndex(start_page_number, page_count, protect);
+  TrackAllocation(start_page_number);
 
   *out_address = heap_base_ + (start_page_number * page_size_);
   return true;
@@ -1070,6 +1974,10 @@ bool BaseHeap::Decommit(uint32_t address, uint32_t size) {
 
   auto global_lock = global_critical_region_.Acquire();
 
+  TriggerCodeWriteWatches(heap_base_ + start_page_number * page_size_,
+                          (end_page_number - start_page_number + 1) *
+                              page_size_);
+
   // Release from host.
   // TODO(benvanik): find a way to actually decommit memory;
   //     mapped memory cannot be decommitted.
@@ -1111,6 +2019,9 @@ bool BaseHeap::Release(uint32_t base_address, uint32_t* out_region_size) {
     *out_region_size = (base_page_entry.region_page_count * page_size_);
   }
 
+  TriggerCodeWriteWatches(base_address,
+                          base_page_entry.region_page_count * page_size_);
+
   // Release from host not needed as mapping reserves the range for us.
   // TODO(benvanik): protect with NOACCESS?
   /*BOOL result = VirtualFree(
@@ -1145,6 +2056,12 @@ bool BaseHeap::Release(uint32_t base_address, uint32_t* out_region_size) {
     auto& page_entry = page_table_[page_number];
     page_entry.qword = 0;
   }
+  SetPagesUnreserved(base_page_number, base_page_entry.region_page_count,
+                     true);
+  SetPagesAccessIndex(base_page_number, base_page_entry.region_page_count, 0);
+  if (!allocation_callers_.empty()) {
+    allocation_callers_[base_page_number] = 0;
+  }
 
   return true;
 }
@@ -1206,6 +2123,9 @@ bool BaseHeap::Protect(uint32_t address, uint32_t size, uint32_t protect,
   // Attempt host change (hopefully won't fail).
   // We can only do this if our size matches system page granularity.
   uint32_t page_count = end_page_number - start_page_number + 1;
+  // Code is often made writable to be patched.
+  TriggerCodeWriteWatches(heap_base_ + start_page_number * page_size_,
+                          page_count * page_size_);
   if (page_size_ == xe::memory::page_size() ||
       (((page_count * page_size_) % xe::memory::page_size() == 0) &&
        ((start_page_number * page_size_) % xe::memory::page_size() == 0))) {
@@ -1231,10 +2151,117 @@ bool BaseHeap::Protect(uint32_t address, uint32_t size, uint32_t protect,
     auto& page_entry = page_table_[page_number];
     page_entry.current_protect = protect;
   }
+  SetPagesAccessIndex(start_page_number, page_count, protect);
 
   return true;
 }
 
+void BaseHeap::WatchCodeWrites(uint32_t address, uint32_t length) {
+  uint32_t heap_relative_address = address - heap_base_;
+  if (!length || heap_relative_address >= heap_size_) {
+    return;
+  }
+  length = std::min(length, heap_size_ - heap_relative_address);
+  uint32_t system_page_size = uint32_t(xe::memory::page_size());
+  uint32_t system_page_first =
+      (heap_relative_address + host_address_offset_) / system_page_size;
+  uint32_t system_page_last =
+      (heap_relative_address + length - 1 + host_address_offset_) /
+      system_page_size;
+
+  uint8_t* protect_base = membase_ + heap_base_;
+  auto global_lock = global_critical_region_.Acquire();
+  if (code_write_watches_.empty()) {
+    uint32_t system_page_count =
+        (heap_size_ + host_address_offset_ + (system_page_size - 1)) /
+        system_page_size;
+    code_write_watches_.resize((system_page_count + 63) / 64);
+  }
+  for (uint32_t i = system_page_first; i <= system_page_last; ++i) {
+    uint64_t& watches_block = code_write_watches_[i >> 6];
+    uint64_t watch_bit = uint64_t(1) << (i & 63);
+    if (watches_block & watch_bit) {
+      continue;
+    }
+    const PageEntry& page_entry =
+        page_table_[xe::sat_sub(i * system_page_size, host_address_offset_) /
+                    page_size_];
+    if (!(page_entry.state & kMemoryAllocationCommit)) {
+      continue;
+    }
+    watches_block |= watch_bit;
+    // Pages already read-only for the guest are only watched for protection
+    // changes.
+    if (ToPageAccess(page_entry.current_protect) ==
+        xe::memory::PageAccess::kReadWrite) {
+      xe::memory::Protect(protect_base + i * system_page_size,
+                          system_page_size, xe::memory::PageAccess::kReadOnly);
+    }
+  }
+}
+
+bool BaseHeap::TriggerCodeWriteWatches(uint32_t address, uint32_t length) {
+  uint32_t heap_relative_address = address - heap_base_;
+  if (code_write_watches_.empty() || !length ||
+      heap_relative_address >= heap_size_) {
+    return false;
+  }
+  length = std::min(length, heap_size_ - heap_relative_address);
+  uint32_t system_page_size = uint32_t(xe::memory::page_size());
+  uint32_t system_page_first =
+      (heap_relative_address + host_address_offset_) / system_page_size;
+  uint32_t system_page_last =
+      (heap_relative_address + length - 1 + host_address_offset_) /
+      system_page_size;
+
+  uint8_t* protect_base = membase_ + heap_base_;
+  bool any_watched = false;
+  uint32_t unwatched_system_page_first = UINT32_MAX;
+  auto report_unwatched = [&](uint32_t system_page_end) {
+    if (!memory_->code_write_callback_) {
+      return;
+    }
+    uint32_t unwatched_start = xe::sat_sub(
+        unwatched_system_page_first * system_page_size, host_address_offset_);
+    uint32_t unwatched_end =
+        std::min(xe::sat_sub(system_page_end * system_page_size,
+                             host_address_offset_),
+                 heap_size_);
+    memory_->code_write_callback_(memory_->code_write_callback_context_,
+                                  heap_base_ + unwatched_start,
+                                  unwatched_end - unwatched_start);
+  };
+  for (uint32_t i = system_page_first; i <= system_page_last; ++i) {
+    uint64_t& watches_block = code_write_watches_[i >> 6];
+    uint64_t watch_bit = uint64_t(1) << (i & 63);
+    if (!(watches_block & watch_bit)) {
+      if (unwatched_system_page_first != UINT32_MAX) {
+        report_unwatched(i);
+        unwatched_system_page_first = UINT32_MAX;
+      }
+      continue;
+    }
+    watches_block &= ~watch_bit;
+    any_watched = true;
+    if (unwatched_system_page_first == UINT32_MAX) {
+      unwatched_system_page_first = i;
+    }
+    const PageEntry& page_entry =
+        page_table_[xe::sat_sub(i * system_page_size, host_address_offset_) /
+                    page_size_];
+    if (ToPageAccess(page_entry.current_protect) ==
+        xe::memory::PageAccess::kReadWrite) {
+      xe::memory::Protect(protect_base + i * system_page_size,
+                          system_page_size,
+                          xe::memory::PageAccess::kReadWrite);
+    }
+  }
+  if (unwatched_system_page_first != UINT32_MAX) {
+    report_unwatched(system_page_last + 1);
+  }
+  return any_watched;
+}
+
 bool BaseHeap::QueryRegionInfo(uint32_t base_address,
                                HeapAllocationInfo* out_info) {
   uint32_t start_page_number = (base_address - heap_base_) / page_size_;
@@ -1338,11 +2365,16 @@ xe::memory::PageAccess BaseHeap::QueryRangeAccess(uint32_t low_address,
   }
   uint32_t low_page_number = (low_address - heap_base_) / page_size_;
   uint32_t high_page_number = (high_address - heap_base_) / page_size_;
-  uint32_t protect = kMemoryProtectRead | kMemoryProtectWrite;
+  uint32_t protect = 0;
   {
     auto global_lock = global_critical_region_.Acquire();
-    for (uint32_t i = low_page_number; protect && i <= high_page_number; ++i) {
-      protect &= page_table_[i].current_protect;
+    if (AreAllPageIndexBitsSet(readable_pages_, readable_page_words_all_,
+                               low_page_number, high_page_number)) {
+      protect |= kMemoryProtectRead;
+    }
+    if (AreAllPageIndexBitsSet(writable_pages_, writable_page_words_all_,
+                               low_page_number, high_page_number)) {
+      protect |= kMemoryProtectWrite;
     }
   }
   return ToPageAccess(protect);
@@ -1383,7 +2415,9 @@ void PhysicalHeap::Initialize(Memory* memory, uint8_t* membase,
   system_page_count_ =
       (size_t(heap_size_) + host_address_offset + (system_page_size_ - 1)) /
       system_page_size_;
-  system_page_flags_.resize((system_page_count_ + 63) / 64);
+  // The atomics are not movable, so the vector can't be resized.
+  system_page_flags_ =
+      std::vector<SystemPageFlagsBlock>((system_page_count_ + 63) / 64);
 }
 
 bool PhysicalHeap::Alloc(uint32_t size, uint32_t alignment,
@@ -1423,6 +2457,8 @@ bool PhysicalHeap::Alloc(uint32_t size, uint32_t alignment,
     // TODO(benvanik): don't leak parent memory.
     return false;
   }
+  ClearWriteWatchesResolved(address, size);
+  NotifyAllocated(parent_address, size, allocation_type);
   *out_address = address;
   return true;
 }
@@ -1459,6 +2495,8 @@ bool PhysicalHeap::AllocFixed(uint32_t base_address, uint32_t size,
     // TODO(benvanik): don't leak parent memory.
     return false;
   }
+  ClearWriteWatchesResolved(address, size);
+  NotifyAllocated(parent_base_address, size, allocation_type);
 
   return true;
 }
@@ -1500,6 +2538,8 @@ bool PhysicalHeap::AllocRange(uint32_t low_address, uint32_t high_address,
     // TODO(benvanik): don't leak parent memory.
     return false;
   }
+  ClearWriteWatchesResolved(address, size);
+  NotifyAllocated(parent_address, size, allocation_type);
   *out_address = address;
   return true;
 }
@@ -1515,6 +2555,7 @@ bool PhysicalHeap::Decommit(uint32_t address, uint32_t size) {
 
   // Not caring about the contents anymore.
   TriggerCallbacks(std::move(global_lock), address, size, true, true);
+  ClearWriteWatchesResolved(address, size);
 
   return BaseHeap::Decommit(address, size);
 }
@@ -1540,6 +2581,7 @@ bool PhysicalHeap::Release(uint32_t base_address, uint32_t* out_region_size) {
   if (QuerySize(base_address, &region_size)) {
     TriggerCallbacks(std::move(global_lock), base_address, region_size, true,
                      true);
+    ClearWriteWatchesResolved(base_address, region_size);
   }
 
   return BaseHeap::Release(base_address, out_region_size);
@@ -1561,6 +2603,7 @@ bool PhysicalHeap::Protect(uint32_t address, uint32_t size, uint32_t protect,
     return false;
   }
 
+  ClearWriteWatchesResolved(address, size);
   return BaseHeap::Protect(address, size, protect);
 }
 
@@ -1649,9 +2692,14 @@ void PhysicalHeap::EnableAccessCallbacks(uint32_t physical_address,
           // stricter protection.
           protect_system_page = true;
           page_flags_block.notify_on_invalidation |= page_flags_bit;
+          page_flags_block.write_watch_resolved &= ~page_flags_bit;
         }
       }
     }
+    if (host_write_tracking_) {
+      // Writes are detected by polling instead.
+      continue;
+    }
     if (protect_system_page) {
       if (protect_system_page_first == UINT32_MAX) {
         protect_system_page_first = i;
@@ -1792,8 +2840,19 @@ bool PhysicalHeap::TriggerCallbacks(
   }
 
   // Unprotect ranges that need unprotection.
-  if (unprotect) {
+  if (unprotect && !host_write_tracking_) {
     uint8_t* protect_base = membase_ + heap_base_;
+    auto unprotect_system_pages = [&](uint32_t first, uint32_t end) {
+      xe::memory::Protect(protect_base + first * system_page_size_,
+                          (end - first) * system_page_size_,
+                          xe::memory::PageAccess::kReadWrite);
+      // Published only after the pages have become writable, for
+      // IsWriteWatchResolved.
+      for (uint32_t i = first; i < end; ++i) {
+        system_page_flags_[i >> 6].write_watch_resolved.fetch_or(
+            uint64_t(1) << (i & 63), std::memory_order_release);
+      }
+    };
     uint32_t unprotect_system_page_first = UINT32_MAX;
     for (uint32_t i = system_page_first; i <= system_page_last; ++i) {
       // Check if need to allow writing to this page.
@@ -1814,20 +2873,14 @@ bool PhysicalHeap::TriggerCallbacks(
         }
       } else {
         if (unprotect_system_page_first != UINT32_MAX) {
-          xe::memory::Protect(
-              protect_base + unprotect_system_page_first * system_page_size_,
-              (i - unprotect_system_page_first) * system_page_size_,
-              xe::memory::PageAccess::kReadWrite);
+          unprotect_system_pages(unprotect_system_page_first, i);
           unprotect_system_page_first = UINT32_MAX;
         }
       }
     }
     if (unprotect_system_page_first != UINT32_MAX) {
-      xe::memory::Protect(
-          protect_base + unprotect_system_page_first * system_page_size_,
-          (system_page_last + 1 - unprotect_system_page_first) *
-              system_page_size_,
-          xe::memory::PageAccess::kReadWrite);
+      unprotect_system_pages(unprotect_system_page_first,
+                             system_page_last + 1);
     }
   }
 
@@ -1846,6 +2899,107 @@ bool PhysicalHeap::TriggerCallbacks(
   return true;
 }
 
+bool PhysicalHeap::EnableHostWriteTracking() {
+  host_write_tracking_ = xe::memory::EnableWriteTracking(
+      membase_ + heap_base_, size_t(system_page_count_) * system_page_size_);
+  return host_write_tracking_;
+}
+
+void PhysicalHeap::TriggerHostWrittenCallbacks() {
+  if (!host_write_tracking_) {
+    return;
+  }
+  uint8_t* tracking_base = membase_ + heap_base_;
+  std::vector<std::pair<void*, size_t>> written_ranges;
+  if (!xe::memory::GetAndResetWrittenRanges(
+          tracking_base, size_t(system_page_count_) * system_page_size_,
+          written_ranges)) {
+    return;
+  }
+  for (const auto& written_range : written_ranges) {
+    uint32_t host_relative_start = uint32_t(
+        static_cast<uint8_t*>(written_range.first) - tracking_base);
+    uint32_t heap_relative_start =
+        xe::sat_sub(host_relative_start, host_address_offset());
+    uint32_t heap_relative_end =
+        xe::sat_sub(host_relative_start + uint32_t(written_range.second),
+                    host_address_offset());
+    if (heap_relative_start >= heap_relative_end) {
+      continue;
+    }
+    TriggerCallbacks(global_critical_region_.Acquire(),
+                     heap_base_ + heap_relative_start,
+                     heap_relative_end - heap_relative_start, true, true,
+                     false);
+  }
+}
+
+bool PhysicalHeap::IsWriteWatchResolved(uint32_t virtual_address) const {
+  if (virtual_address < heap_base_ ||
+      virtual_address - heap_base_ >= heap_size_) {
+    return false;
+  }
+  uint32_t system_page =
+      (virtual_address - heap_base_ + host_address_offset()) /
+      system_page_size_;
+  if (system_page >= system_page_count_) {
+    return false;
+  }
+  return (system_page_flags_[system_page >> 6].write_watch_resolved.load(
+              std::memory_order_acquire) &
+          (uint64_t(1) << (system_page & 63))) != 0;
+}
+
+void PhysicalHeap::ClearWriteWatchesResolved(uint32_t virtual_address,
+                                             uint32_t length) {
+  if (virtual_address < heap_base_) {
+    if (heap_base_ - virtual_address >= length) {
+      return;
+    }
+    length -= heap_base_ - virtual_address;
+    virtual_address = heap_base_;
+  }
+  uint32_t heap_relative_address = virtual_address - heap_base_;
+  if (heap_relative_address >= heap_size_) {
+    return;
+  }
+  length = std::min(length, heap_size_ - heap_relative_address);
+  if (length == 0) {
+    return;
+  }
+  uint32_t system_page_first =
+      (heap_relative_address + host_address_offset()) / system_page_size_;
+  uint32_t system_page_last =
+      (heap_relative_address + length - 1 + host_address_offset()) /
+      system_page_size_;
+  system_page_last = std::min(system_page_last, system_page_count_ - 1);
+  uint32_t block_index_first = system_page_first >> 6;
+  uint32_t block_index_last = system_page_last >> 6;
+  for (uint32_t i = block_index_first; i <= block_index_last; ++i) {
+    uint64_t mask = 0;
+    if (i == block_index_first) {
+      mask |= (uint64_t(1) << (system_page_first & 63)) - 1;
+    }
+    if (i == block_index_last && (system_page_last & 63) != 63) {
+      mask |= ~((uint64_t(1) << ((system_page_last & 63) + 1)) - 1);
+    }
+    system_page_flags_[i].write_watch_resolved.fetch_and(
+        mask, std::memory_order_relaxed);
+  }
+}
+
+void PhysicalHeap::NotifyAllocated(uint32_t physical_address, uint32_t length,
+                                   uint32_t allocation_type) {
+  if (!(allocation_type & kMemoryAllocationCommit) || !length) {
+    return;
+  }
+  for (auto allocation_callback :
+       memory_->physical_memory_allocation_callbacks_) {
+    allocation_callback->first(allocation_callback->second, physical_address,
+                               length);
+  }
+}
+
 uint32_t PhysicalHeap::GetPhysicalAddress(uint32_t address) const {
   assert_true(address >= heap_base_);
   address -= heap_base_;
@@ -10,6 +10,7 @@
 #ifndef XENIA_MEMORY_H_
 #define XENIA_MEMORY_H_
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -98,6 +99,69 @@ union PageEntry {
   };
 };
 
+// Occupancy and fragmentation of a heap, and, with --track_guest_allocations,
+// the guest code allocating in it and the watch faults in it.
+struct HeapUsageReport {
+  // Number of equal parts of the heap in the heatmaps.
+  static constexpr uint32_t kHeatmapCellCount = 256;
+  // Granularity of the watch fault counts.
+  static constexpr uint32_t kWatchFaultGranuleSize = 64 * 1024;
+  static constexpr uint32_t kMaxWatchFaultRanges = 32;
+
+  struct Caller {
+    // Link register of the guest thread when the allocation was made.
+    uint32_t guest_lr;
+    uint32_t region_count;
+    uint64_t size;
+  };
+  struct WatchFaultRange {
+    uint32_t address;
+    uint32_t length;
+    uint32_t fault_count;
+  };
+
+  uint32_t heap_base = 0;
+  uint32_t heap_size = 0;
+  uint32_t page_size = 0;
+  uint32_t region_count = 0;
+  uint32_t reserved_page_count = 0;
+  uint32_t committed_page_count = 0;
+  uint32_t unreserved_range_count = 0;
+  uint32_t largest_unreserved_range_page_count = 0;
+  // Regions still allocated, by total size, descending.
+  std::vector<Caller> callers;
+  // Watch fault granules with the most faults, descending.
+  std::vector<WatchFaultRange> watch_fault_ranges;
+  std::vector<uint32_t> committed_page_heatmap;
+  std::vector<uint32_t> watch_fault_heatmap;
+
+  // Part of the unreserved pages outside the largest unreserved range, from 0
+  // if all of them are contiguous towards 1.
+  float fragmentation() const {
+    uint32_t unreserved_page_count =
+        heap_size / page_size - reserved_page_count;
+    if (!unreserved_page_count) {
+      return 0.0f;
+    }
+    return 1.0f - float(largest_unreserved_range_page_count) /
+                      float(unreserved_page_count);
+  }
+};
+
+// Copy of the page table and the contents of the committed pages of a heap for
+// a save state, taken while the emulation is paused, so it can be compressed
+// and written while the emulation is running again.
+struct HeapSnapshot {
+  uint32_t page_size = 0;
+  std::vector<PageEntry> page_table;
+  // Contents of the committed pages in the order of the page table.
+  std::vector<uint8_t> committed_pages;
+
+  // Writes the page table and the committed pages compressed in parallel, with
+  // zero-filled chunks of pages stored as empty, for BaseHeap::Restore.
+  bool Write(ByteStream* stream) const;
+};
+
 // Heap abstraction for page-based allocation.
 class BaseHeap {
  public:
@@ -135,6 +199,12 @@ class BaseHeap {
   uint32_t GetTotalPageCount();
   uint32_t GetUnreservedPageCount();
 
+  void GetUsageReport(HeapUsageReport& report_out);
+  // Counts an access violation caused by a watch (of code or of physical
+  // memory) with --track_guest_allocations. Must be called with the global
+  // critical region locked.
+  void RecordWatchFault(uint32_t address);
+
   // Allocates pages with the given properties and allocation strategy.
   // This can reserve and commit the pages as well as set protection modes.
   // This will fail if not enough contiguous pages can be found.
@@ -187,7 +257,17 @@ class BaseHeap {
   xe::memory::PageAccess QueryRangeAccess(uint32_t low_address,
                                           uint32_t high_address);
 
-  bool Save(ByteStream* stream);
+  // Watches the committed system pages containing the range for the first
+  // write to them, by the guest or by the host, and for changes of their
+  // protection, decommitment and release (see Memory::WatchCodeWrites).
+  void WatchCodeWrites(uint32_t address, uint32_t length);
+  // Unwatches the watched system pages in the range, restoring their
+  // protection, and reports them to the code write callback of Memory.
+  // Returns true if any page in the range was watched. Must be called with the
+  // global critical region locked.
+  bool TriggerCodeWriteWatches(uint32_t address, uint32_t length);
+
+  void TakeSnapshot(HeapSnapshot& snapshot_out);
   bool Restore(ByteStream* stream);
 
   void Reset();
@@ -199,6 +279,27 @@ class BaseHeap {
                   uint32_t heap_base, uint32_t heap_size, uint32_t page_size,
                   uint32_t host_address_offset = 0);
 
+  // Marks pages as unreserved or reserved in the unreserved page index, which
+  // must be done whenever the state of page table entries changes from or to
+  // 0.
+  void SetPagesUnreserved(uint32_t start_page_number, uint32_t page_count,
+                          bool unreserved);
+  // Recreates the unreserved page index from the page table.
+  void RebuildUnreservedPageIndex();
+  // Updates the page access index, which must be done whenever current_protect
+  // of page table entries changes.
+  void SetPagesAccessIndex(uint32_t start_page_number, uint32_t page_count,
+                           uint32_t protect);
+  // Recreates the page access index from the page table.
+  void RebuildPageAccessIndex();
+  // Stores the guest caller of a new region with --track_guest_allocations.
+  void TrackAllocation(uint32_t start_page_number);
+  // Returns the first page (or the last if reverse is true) within the
+  // inclusive range that is unreserved (or reserved if unreserved is false),
+  // or UINT32_MAX if there's none.
+  uint32_t FindPage(uint32_t first_page_number, uint32_t last_page_number,
+                    bool unreserved, bool reverse) const;
+
   Memory* memory_;
   uint8_t* membase_;
   HeapType heap_type_;
@@ -208,6 +309,33 @@ class BaseHeap {
   uint32_t host_address_offset_;
   xe::global_critical_region global_critical_region_;
   std::vector<PageEntry> page_table_;
+  // Protected by global_critical_region. Index of the pages with the state of
+  // 0 in page_table_ for finding free ranges without checking every page
+  // entry - a bit for each unreserved page, and, for each 64-bit word of it,
+  // a bit in unreserved_page_words_any_ if any of its pages is unreserved, and
+  // in unreserved_page_words_all_ if all of them are.
+  std::vector<uint64_t> unreserved_pages_;
+  std::vector<uint64_t> unreserved_page_words_any_;
+  std::vector<uint64_t> unreserved_page_words_all_;
+  uint32_t unreserved_page_count_ = 0;
+  // Protected by global_critical_region. Index of current_protect in
+  // page_table_ for checking the access to ranges without checking every page
+  // entry - a bit for each page with kMemoryProtectRead, and for each with
+  // kMemoryProtectWrite, and, for each 64-bit word of them, a bit in the
+  // respective *_words_all_ if all of its pages have the access.
+  std::vector<uint64_t> readable_pages_;
+  std::vector<uint64_t> readable_page_words_all_;
+  std::vector<uint64_t> writable_pages_;
+  std::vector<uint64_t> writable_page_words_all_;
+  // Protected by global_critical_region. A bit for each system page watched
+  // by WatchCodeWrites, allocated when the first one is.
+  std::vector<uint64_t> code_write_watches_;
+  // Protected by global_critical_region, with --track_guest_allocations. The
+  // guest link register when each region was allocated, at the index of its
+  // first page, and the number of watch faults per
+  // HeapUsageReport::kWatchFaultGranuleSize.
+  std::vector<uint32_t> allocation_callers_;
+  std::vector<uint32_t> watch_fault_counts_;
 };
 
 // Normal heap allowing allocations from guest virtual address ranges.
@@ -260,22 +388,48 @@ class PhysicalHeap : public BaseHeap {
       std::unique_lock<std::recursive_mutex> global_lock_locked_once,
       uint32_t virtual_address, uint32_t length, bool is_write,
       bool unwatch_exact_range, bool unprotect = true);
+  // Whether the system page containing the address has been made writable by
+  // TriggerCallbacks, with the guest protection unchanged since then, so a
+  // write access violation in it has been caused by a watch already triggered
+  // by another thread. Can be called without global_critical_region locked.
+  bool IsWriteWatchResolved(uint32_t virtual_address) const;
+
+  // Makes the host track the writes to the heap (see
+  // Memory::TriggerHostWrittenPhysicalMemoryCallbacks) instead of watched
+  // pages being protected. Must be called before any page is watched.
+  bool EnableHostWriteTracking();
+  // Triggers the callbacks for the watched pages written to since the last
+  // call if the host tracks the writes.
+  void TriggerHostWrittenCallbacks();
 
   uint32_t GetPhysicalAddress(uint32_t address) const;
 
  protected:
+  // Called when the guest protection of the pages in the range may be changed.
+  void ClearWriteWatchesResolved(uint32_t virtual_address, uint32_t length);
+  // Calls the physical memory allocation callbacks if the pages in the range
+  // have been committed.
+  void NotifyAllocated(uint32_t physical_address, uint32_t length,
+                       uint32_t allocation_type);
+
   VirtualHeap* parent_heap_;
 
   uint32_t system_page_size_;
   uint32_t system_page_count_;
 
+  bool host_write_tracking_ = false;
+
   struct SystemPageFlagsBlock {
     // Whether writing to each page should result trigger invalidation
     // callbacks.
-    uint64_t notify_on_invalidation;
+    std::atomic<uint64_t> notify_on_invalidation;
+    // Whether each page has been made writable by TriggerCallbacks (see
+    // IsWriteWatchResolved).
+    std::atomic<uint64_t> write_watch_resolved;
   };
-  // Protected by global_critical_region. Flags for each 64 system pages,
-  // interleaved as blocks, so bit scan can be used to quickly extract ranges.
+  // Modified with global_critical_region locked, but can be read without it.
+  // Flags for each 64 system pages, interleaved as blocks, so bit scan can be
+  // used to quickly extract ranges.
   std::vector<SystemPageFlagsBlock> system_page_flags_;
 };
 
@@ -330,6 +484,20 @@ class Memory {
   // This is often something like 0x200000000.
   inline uint8_t* physical_membase() const { return physical_membase_; }
 
+  // Whether the host has been requested to back the guest memory with large
+  // pages (see --host_large_pages).
+  bool uses_host_large_pages() const { return host_large_pages_; }
+  // The host NUMA node the guest memory is placed on (see --host_numa_node),
+  // or UINT32_MAX if the placement is left to the host. The emulator threads
+  // should be kept on the node's processors.
+  uint32_t host_numa_node() const { return host_numa_node_; }
+  // Host allocations in the heaps may replace the mappings, so they request
+  // large pages and the NUMA node placement for the new mappings again.
+  void ApplyHostPagePolicies(void* host_address, size_t length) const;
+  // Logs how much of the guest memory is resident on each host NUMA node, if
+  // the guest memory is placed on a specific node.
+  void LogHostNumaResidency() const;
+
   // Translates a guest physical address to a host address that can be accessed
   // as a normal pointer.
   // Note that the contents at the specified host address are big-endian.
@@ -432,6 +600,19 @@ class Memory {
   // RegisterPhysicalMemoryInvalidationCallback.
   void UnregisterPhysicalMemoryInvalidationCallback(void* callback_handle);
 
+  // Called with the global critical region locked after the guest has
+  // committed physical memory, so the users of the physical memory can prepare
+  // for the range being accessed (for instance, by making its host GPU memory
+  // resident ahead of time).
+  typedef void (*PhysicalMemoryAllocationCallback)(
+      void* context_ptr, uint32_t physical_address_start, uint32_t length);
+  // Returns a handle for unregistering.
+  void* RegisterPhysicalMemoryAllocationCallback(
+      PhysicalMemoryAllocationCallback callback, void* callback_context);
+  // Unregisters a physical memory allocation callback previously added with
+  // RegisterPhysicalMemoryAllocationCallback.
+  void UnregisterPhysicalMemoryAllocationCallback(void* callback_handle);
+
   // Enables physical memory access callbacks for the specified memory range,
   // snapped to system page boundaries.
   void EnablePhysicalMemoryAccessCallbacks(
@@ -448,6 +629,28 @@ class Memory {
       uint32_t virtual_address, uint32_t length, bool is_write,
       bool unwatch_exact_range, bool unprotect = true);
 
+  // With --host_write_tracking, watched pages are not protected, and the
+  // invalidation callbacks are instead triggered for the pages that the host
+  // has detected writes to when this is called. Must be called without the
+  // global critical region locked.
+  void TriggerHostWrittenPhysicalMemoryCallbacks();
+
+  // Write watches on the guest code in the virtual memory heaps, for
+  // invalidating the code translated from it.
+  //
+  // Watched pages are read-only on the host until they're written to or their
+  // protection is changed, decommitted or released, after which they're
+  // unwatched and the callback is called for them, with the global critical
+  // region locked, from the access violation handler or the heap operation.
+  // Physical memory heaps have their own access callbacks (see
+  // EnablePhysicalMemoryAccessCallbacks), and are not watched.
+  typedef void (*CodeWriteCallback)(void* context, uint32_t virtual_address,
+                                    uint32_t length);
+  void SetCodeWriteCallback(CodeWriteCallback callback,
+                            void* callback_context);
+  // Watches the system pages containing the range until the next write.
+  void WatchCodeWrites(uint32_t virtual_address, uint32_t length);
+
   // Allocates virtual memory from the 'system' heap.
   // System memory is kept separate from game memory but is still accessible
   // using normal guest virtual addresses. Kernel structures and other internal
@@ -458,6 +661,10 @@ class Memory {
   // Frees memory allocated with SystemHeapAlloc.
   void SystemHeapFree(uint32_t address);
 
+  // Power of two block sizes of the pool for small system heap allocations,
+  // from 32 to 2048 bytes.
+  static constexpr uint32_t kSystemHeapPoolSizeClassCount = 7;
+
   // Gets the heap for the address space containing the given address.
   const BaseHeap* LookupHeap(uint32_t address) const;
 
@@ -475,22 +682,48 @@ class Memory {
   // Dumps a map of all allocated memory to the log.
   void DumpMap();
 
+  // Usage of all heaps, in the order of their addresses, for the debugger.
+  std::vector<HeapUsageReport> GetHeapUsageReports();
+  // Writes the usage reports of all heaps as text.
+  bool DumpHeapUsage(const std::filesystem::path& path);
+
+  // Saving is split into taking a snapshot of the heaps, which must be done
+  // while the emulation is paused, and writing it, which may be done after the
+  // emulation has been resumed.
+  std::vector<HeapSnapshot> TakeSnapshot();
+  static bool WriteSnapshot(const std::vector<HeapSnapshot>& snapshot,
+                            ByteStream* stream);
   bool Save(ByteStream* stream);
   bool Restore(ByteStream* stream);
 
  private:
+  struct SystemHeapPool {
+    // Guest addresses of the first slabs with free blocks, per size class.
+    uint32_t partial_slabs[kSystemHeapPoolSizeClassCount] = {};
+  };
+
   int MapViews(uint8_t* mapping_base);
   void UnmapViews();
 
+  // Returns the NUMA node for --host_numa_node, or UINT32_MAX if none.
+  static uint32_t SelectHostNumaNode();
+
   static uint32_t HostToGuestVirtualThunk(const void* context,
                                           const void* host_address);
 
   bool AccessViolationCallback(
-      std::unique_lock<std::recursive_mutex> global_lock_locked_once,
-      void* host_address, bool is_write);
+      std::unique_lock<std::recursive_mutex> global_lock, void* host_address,
+      bool is_write);
   static bool AccessViolationCallbackThunk(
-      std::unique_lock<std::recursive_mutex> global_lock_locked_once,
-      void* context, void* host_address, bool is_write);
+      std::unique_lock<std::recursive_mutex> global_lock, void* context,
+      void* host_address, bool is_write);
+
+  uint32_t SystemHeapPoolAlloc(BaseHeap* heap, SystemHeapPool& pool,
+                               uint32_t block_size);
+  // Returns false if the address is not a block from the pool.
+  bool SystemHeapPoolFree(BaseHeap* heap, SystemHeapPool& pool,
+                          uint32_t address);
+  void ResetSystemHeapPools();
 
   std::filesystem::path file_name_;
   uint32_t system_page_size_ = 0;
@@ -501,6 +734,9 @@ class Memory {
   xe::memory::FileMappingHandle mapping_ =
       xe::memory::kFileMappingHandleInvalid;
   uint8_t* mapping_base_ = nullptr;
+  bool host_large_pages_ = false;
+  uint32_t host_numa_node_ = UINT32_MAX;
+  bool host_numa_bound_ = false;
   union {
     struct {
       uint8_t* v00000000;
@@ -536,6 +772,14 @@ class Memory {
   xe::global_critical_region global_critical_region_;
   std::vector<std::pair<PhysicalMemoryInvalidationCallback, void*>*>
       physical_memory_invalidation_callbacks_;
+  std::vector<std::pair<PhysicalMemoryAllocationCallback, void*>*>
+      physical_memory_allocation_callbacks_;
+  CodeWriteCallback code_write_callback_ = nullptr;
+  void* code_write_callback_context_ = nullptr;
+
+  // Virtual and physical, protected by the global critical region.
+  SystemHeapPool system_heap_pools_[2];
+  uint32_t system_heap_pool_generation_ = 0;
 };
 
 }  // namespace xe
@@ -28,6 +28,14 @@ DEFINE_bool(
     "it. On displays not supporting VRR, screen tearing may occur in certain "
     "cases.",
     "D3D12");
+DEFINE_bool(
+    d3d12_low_latency_presentation, false,
+    "Use a waitable swap chain with the maximum frame latency of 1, and wait "
+    "for the swap chain to be able to accept a new frame before painting it, "
+    "so the frame is painted from the latest guest output rather than queued "
+    "behind the previously presented ones. Reduces the presentation latency "
+    "at the cost of possibly more time spent waiting on the UI thread.",
+    "D3D12");
 
 namespace xe {
 namespace ui {
@@ -227,9 +235,10 @@ D3D12Presenter::ConnectOrReconnectPaintingToSurfaceFromUIThread(
       return SurfacePaintConnectResult::kSuccessUnchanged;
     }
     paint_context_.AwaitSwapChainUsageCompletion();
-    // Using the current swap_chain_allows_tearing_ value that's consistent with
-    // the creation of the swap chain because ResizeBuffers can't toggle the
-    // tearing flag.
+    // Using the current swap_chain_allows_tearing_ value and the waitable
+    // object existence that are consistent with the creation of the swap chain
+    // because ResizeBuffers can't toggle the tearing and the waitable object
+    // flags.
     for (Microsoft::WRL::ComPtr<ID3D12Resource>& swap_chain_buffer_ref :
          paint_context_.swap_chain_buffers) {
       swap_chain_buffer_ref.Reset();
@@ -238,9 +247,12 @@ D3D12Presenter::ConnectOrReconnectPaintingToSurfaceFromUIThread(
         SUCCEEDED(paint_context_.swap_chain->ResizeBuffers(
             0, UINT(new_swap_chain_width), UINT(new_swap_chain_height),
             DXGI_FORMAT_UNKNOWN,
-            paint_context_.swap_chain_allows_tearing
-                ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING
-                : 0));
+            (paint_context_.swap_chain_allows_tearing
+                 ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING
+                 : 0) |
+                (paint_context_.swap_chain_frame_latency_waitable_object
+                     ? DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT
+                     : 0)));
     if (swap_chain_resized) {
       for (uint32_t i = 0; i < PaintContext::kSwapChainBufferCount; ++i) {
         if (FAILED(paint_context_.swap_chain->GetBuffer(
@@ -291,6 +303,10 @@ D3D12Presenter::ConnectOrReconnectPaintingToSurfaceFromUIThread(
       // rate.
       swap_chain_desc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
     }
+    if (cvars::d3d12_low_latency_presentation) {
+      swap_chain_desc.Flags |=
+          DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+    }
     IDXGIFactory2* dxgi_factory = provider_.GetDXGIFactory();
     ID3D12CommandQueue* direct_queue = provider_.GetDirectQueue();
     Microsoft::WRL::ComPtr<IDXGISwapChain1> swap_chain_1;
@@ -333,6 +349,16 @@ D3D12Presenter::ConnectOrReconnectPaintingToSurfaceFromUIThread(
     paint_context_.swap_chain_height = new_swap_chain_height;
     paint_context_.swap_chain_allows_tearing =
         (swap_chain_desc.Flags & DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING) != 0;
+    if (swap_chain_desc.Flags &
+        DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT) {
+      // Only one frame queued for presentation - painting will wait for it to
+      // be taken by the presentation engine.
+      if (FAILED(paint_context_.swap_chain->SetMaximumFrameLatency(1))) {
+        XELOGW("D3D12Presenter: Failed to set the maximum frame latency to 1");
+      }
+      paint_context_.swap_chain_frame_latency_waitable_object =
+          paint_context_.swap_chain->GetFrameLatencyWaitableObject();
+    }
     for (uint32_t i = 0; i < PaintContext::kSwapChainBufferCount; ++i) {
       if (FAILED(paint_context_.swap_chain->GetBuffer(
               i, IID_PPV_ARGS(&paint_context_.swap_chain_buffers[i])))) {
@@ -442,6 +468,10 @@ void D3D12Presenter::PaintContext::DestroySwapChain() {
        swap_chain_buffers) {
     swap_chain_buffer_ref.Reset();
   }
+  if (swap_chain_frame_latency_waitable_object) {
+    CloseHandle(swap_chain_frame_latency_waitable_object);
+    swap_chain_frame_latency_waitable_object = nullptr;
+  }
   swap_chain.Reset();
   swap_chain_allows_tearing = false;
   swap_chain_height = 0;
@@ -450,6 +480,14 @@ void D3D12Presenter::PaintContext::DestroySwapChain() {
 
 Presenter::PaintResult D3D12Presenter::PaintAndPresentImpl(
     bool execute_ui_drawers) {
+  // In the low-latency mode, wait until the swap chain can take a new frame
+  // before consuming the guest output, so the latest guest frame is painted.
+  // Not infinitely in case presentation is stuck for some reason.
+  if (paint_context_.swap_chain_frame_latency_waitable_object) {
+    WaitForSingleObjectEx(
+        paint_context_.swap_chain_frame_latency_waitable_object, 1000, TRUE);
+  }
+
   // Begin the command list with the command allocator not currently potentially
   // used on the GPU.
   UINT64 current_paint_submission =
@@ -269,6 +269,9 @@ class D3D12Presenter final : public Presenter {
     uint32_t swap_chain_height = 0;
     bool swap_chain_allows_tearing = false;
     Microsoft::WRL::ComPtr<IDXGISwapChain3> swap_chain;
+    // Signaled when the swap chain can accept a new frame, if created with
+    // DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT, or nullptr.
+    HANDLE swap_chain_frame_latency_waitable_object = nullptr;
     std::array<Microsoft::WRL::ComPtr<ID3D12Resource>, kSwapChainBufferCount>
         swap_chain_buffers;
   };
@@ -36,6 +36,8 @@ class D3D12Provider : public GraphicsProvider {
   std::unique_ptr<ImmediateDrawer> CreateImmediateDrawer() override;
 
   IDXGIFactory2* GetDXGIFactory() const { return dxgi_factory_; }
+  // nullptr if IDXGIAdapter3 (Windows 10) is not supported.
+  IDXGIAdapter3* GetDXGIAdapter3() const { return dxgi_adapter_3_; }
   // nullptr if PIX not attached.
   IDXGraphicsAnalysis* GetGraphicsAnalysis() const {
     return graphics_analysis_;
@@ -177,6 +179,7 @@ class D3D12Provider : public GraphicsProvider {
   DxcCreateInstanceProc pfn_dxcompiler_dxc_create_instance_ = nullptr;
 
   IDXGIFactory2* dxgi_factory_ = nullptr;
+  IDXGIAdapter3* dxgi_adapter_3_ = nullptr;
   ID3D12Device* device_ = nullptr;
   ID3D12CommandQueue* direct_queue_ = nullptr;
   IDXGraphicsAnalysis* graphics_analysis_ = nullptr;
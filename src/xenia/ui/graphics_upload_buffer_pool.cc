@@ -36,6 +36,32 @@ void GraphicsUploadBufferPool::Reclaim(uint64_t completed_submission_index) {
   if (!submitted_first_) {
     submitted_last_ = nullptr;
   }
+
+  // Destroy the idle pages beyond the limit, keeping the current page.
+  size_t idle_page_count_max =
+      std::max(kMaxIdlePagesSize / page_size_, size_t(1));
+  size_t idle_page_count = 0;
+  Page* page_last_kept = nullptr;
+  Page* page = writable_first_;
+  while (page) {
+    if (!(page == writable_first_ && current_page_used_)) {
+      if (idle_page_count >= idle_page_count_max) {
+        break;
+      }
+      ++idle_page_count;
+    }
+    page_last_kept = page;
+    page = page->next_;
+  }
+  if (page) {
+    page_last_kept->next_ = nullptr;
+    writable_last_ = page_last_kept;
+    while (page) {
+      Page* page_next = page->next_;
+      delete page;
+      page = page_next;
+    }
+  }
 }
 
 void GraphicsUploadBufferPool::ChangeSubmissionTimeline() {
@@ -106,6 +132,7 @@ GraphicsUploadBufferPool::Page* GraphicsUploadBufferPool::Request(
     // Start a new page if can't fit all the bytes or don't have an open page.
     if (writable_first_) {
       // Close the page that was current.
+      wasted_bytes_total_ += page_size_ - current_page_used_;
       FlushWrites();
       if (submitted_last_) {
         submitted_last_->next_ = writable_first_;
@@ -137,6 +164,7 @@ GraphicsUploadBufferPool::Page* GraphicsUploadBufferPool::Request(
     current_page_flushed_ = 0;
   }
   writable_first_->last_submission_index_ = submission_index;
+  wasted_bytes_total_ += current_page_used_aligned - current_page_used_;
   offset_out = current_page_used_aligned;
   current_page_used_ = current_page_used_aligned + size;
   return writable_first_;
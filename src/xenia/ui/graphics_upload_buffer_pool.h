@@ -28,6 +28,9 @@ class GraphicsUploadBufferPool {
   // Taken from the Direct3D 12 MiniEngine sample (LinearAllocator
   // kCpuAllocatorPageSize). Large enough for most cases.
   static constexpr size_t kDefaultPageSize = 2_MiB;
+  // Pages not used by the GPU anymore beyond this total size are destroyed on
+  // reclamation, so a burst of uploads doesn't keep the memory allocated.
+  static constexpr size_t kMaxIdlePagesSize = 32_MiB;
 
   virtual ~GraphicsUploadBufferPool();
 
@@ -39,6 +42,10 @@ class GraphicsUploadBufferPool {
   // implementation doesn't require explicit flushing.
   void FlushWrites();
 
+  // Bytes skipped for alignment and left unused at the ends of the pages that
+  // have been closed because the next request didn't fit in them.
+  uint64_t wasted_bytes_total() const { return wasted_bytes_total_; }
+
  protected:
   // Extended by the implementation.
   struct Page {
@@ -77,6 +84,8 @@ class GraphicsUploadBufferPool {
 
   size_t current_page_used_ = 0;
   size_t current_page_flushed_ = 0;
+
+  uint64_t wasted_bytes_total_ = 0;
 };
 
 }  // namespace ui
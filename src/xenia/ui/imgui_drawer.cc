@@ -334,35 +334,87 @@ void ImGuiDrawer::RenderDrawLists(ImDrawData* data,
 
   immediate_drawer_->Begin(ui_draw_context, io.DisplaySize.x, io.DisplaySize.y);
 
+  // Combine all the command lists into one batch so the vertices and the
+  // indices are uploaded and bound once per frame rather than once per window.
+  // The indices are relative to the beginning of each command list, which is
+  // handled via the base vertex.
+  frame_vertices_.clear();
+  frame_indices_.clear();
   for (int i = 0; i < data->CmdListsCount; ++i) {
     const auto cmd_list = data->CmdLists[i];
+    const ImmediateVertex* list_vertices =
+        reinterpret_cast<const ImmediateVertex*>(cmd_list->VtxBuffer.Data);
+    frame_vertices_.insert(frame_vertices_.cend(), list_vertices,
+                           list_vertices + cmd_list->VtxBuffer.size());
+    const uint16_t* list_indices = cmd_list->IdxBuffer.Data;
+    frame_indices_.insert(frame_indices_.cend(), list_indices,
+                          list_indices + cmd_list->IdxBuffer.size());
+  }
+  if (frame_indices_.empty()) {
+    immediate_drawer_->End();
+    return;
+  }
 
-    ImmediateDrawBatch batch;
-    batch.vertices =
-        reinterpret_cast<ImmediateVertex*>(cmd_list->VtxBuffer.Data);
-    batch.vertex_count = cmd_list->VtxBuffer.size();
-    batch.indices = cmd_list->IdxBuffer.Data;
-    batch.index_count = cmd_list->IdxBuffer.size();
-    immediate_drawer_->BeginDrawBatch(batch);
+  ImmediateDrawBatch batch;
+  batch.vertices = frame_vertices_.data();
+  batch.vertex_count = int(frame_vertices_.size());
+  batch.indices = frame_indices_.data();
+  batch.index_count = int(frame_indices_.size());
+  immediate_drawer_->BeginDrawBatch(batch);
+
+  // Consecutive commands with the same state and contiguous indices (split by
+  // ImGui for reasons not relevant to the immediate drawer, such as channels)
+  // are merged into one draw. The order of the draws is preserved as they're
+  // alpha-blended.
+  ImmediateDraw pending_draw;
+  int list_vertex_offset = 0;
+  int list_index_offset = 0;
+  for (int i = 0; i < data->CmdListsCount; ++i) {
+    const auto cmd_list = data->CmdLists[i];
 
     for (int j = 0; j < cmd_list->CmdBuffer.size(); ++j) {
       const auto& cmd = cmd_list->CmdBuffer[j];
+      if (!cmd.ElemCount) {
+        continue;
+      }
 
       ImmediateDraw draw;
       draw.primitive_type = ImmediatePrimitiveType::kTriangles;
       draw.count = cmd.ElemCount;
-      draw.index_offset = cmd.IdxOffset;
+      draw.index_offset = list_index_offset + int(cmd.IdxOffset);
+      draw.base_vertex = list_vertex_offset;
       draw.texture = reinterpret_cast<ImmediateTexture*>(cmd.TextureId);
       draw.scissor = true;
       draw.scissor_left = cmd.ClipRect.x;
       draw.scissor_top = cmd.ClipRect.y;
       draw.scissor_right = cmd.ClipRect.z;
       draw.scissor_bottom = cmd.ClipRect.w;
-      immediate_drawer_->Draw(draw);
+
+      if (pending_draw.count) {
+        if (pending_draw.index_offset + pending_draw.count ==
+                draw.index_offset &&
+            pending_draw.base_vertex == draw.base_vertex &&
+            pending_draw.texture == draw.texture &&
+            pending_draw.scissor_left == draw.scissor_left &&
+            pending_draw.scissor_top == draw.scissor_top &&
+            pending_draw.scissor_right == draw.scissor_right &&
+            pending_draw.scissor_bottom == draw.scissor_bottom) {
+          pending_draw.count += draw.count;
+          continue;
+        }
+        immediate_drawer_->Draw(pending_draw);
+      }
+      pending_draw = draw;
     }
 
-    immediate_drawer_->EndDrawBatch();
+    list_vertex_offset += cmd_list->VtxBuffer.size();
+    list_index_offset += cmd_list->IdxBuffer.size();
   }
+  if (pending_draw.count) {
+    immediate_drawer_->Draw(pending_draw);
+  }
+
+  immediate_drawer_->EndDrawBatch();
 
   immediate_drawer_->End();
 }
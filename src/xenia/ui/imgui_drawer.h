@@ -101,6 +101,12 @@ class ImGuiDrawer : public WindowInputListener, public UIDrawer {
   // detaching the presenter.
   std::unique_ptr<ImmediateTexture> font_texture_;
 
+  // Vertices and indices of all ImGui command lists of the frame, combined to
+  // be uploaded as a single immediate drawer batch, kept across frames to
+  // avoid reallocation.
+  std::vector<ImmediateVertex> frame_vertices_;
+  std::vector<uint16_t> frame_indices_;
+
   // If there's an active pointer, the ImGui mouse is controlled by this touch.
   // If it's TouchEvent::kPointerIDNone, the ImGui mouse is controlled by the
   // mouse.
@@ -385,6 +385,14 @@ class Presenter {
     }
   };
 
+  // TODO(Triang3l): Each effect is a separate full-screen pass with an
+  // intermediate image, in addition to the gamma ramp (and optionally FXAA)
+  // passes of the command processors writing the guest output image. Compute
+  // variants of the effects loading the guest output tile with the apron to
+  // groupshared memory, and applying the gamma ramp (and calculating the luma)
+  // there, could merge the gamma ramp pass into CAS and FSR EASU, as well as
+  // EASU with RCAS at the final pass, on hosts where the swap chain images
+  // are storage-capable.
   enum class GuestOutputPaintEffect {
     kBilinear,
     kBilinearDither,
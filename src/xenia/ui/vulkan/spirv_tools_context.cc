@@ -63,17 +63,31 @@ bool SpirvToolsContext::Initialize(unsigned int spirv_version) {
     Shutdown();
     return false;
   }
-  spv_target_env target_env;
+  if (!LoadLibraryFunction(fn_spvOptimizerCreate_, "spvOptimizerCreate") ||
+      !LoadLibraryFunction(fn_spvOptimizerDestroy_, "spvOptimizerDestroy") ||
+      !LoadLibraryFunction(fn_spvOptimizerRegisterPassFromFlag_,
+                           "spvOptimizerRegisterPassFromFlag") ||
+      !LoadLibraryFunction(fn_spvOptimizerRun_, "spvOptimizerRun") ||
+      !LoadLibraryFunction(fn_spvOptimizerOptionsCreate_,
+                           "spvOptimizerOptionsCreate") ||
+      !LoadLibraryFunction(fn_spvOptimizerOptionsDestroy_,
+                           "spvOptimizerOptionsDestroy") ||
+      !LoadLibraryFunction(fn_spvOptimizerOptionsSetRunValidator_,
+                           "spvOptimizerOptionsSetRunValidator") ||
+      !LoadLibraryFunction(fn_spvBinaryDestroy_, "spvBinaryDestroy")) {
+    XELOGW("SPIRV-Tools: The optimizer is not available in the library");
+    fn_spvOptimizerCreate_ = nullptr;
+  }
   if (spirv_version >= 0x10500) {
-    target_env = SPV_ENV_VULKAN_1_2;
+    target_env_ = SPV_ENV_VULKAN_1_2;
   } else if (spirv_version >= 0x10400) {
-    target_env = SPV_ENV_VULKAN_1_1_SPIRV_1_4;
+    target_env_ = SPV_ENV_VULKAN_1_1_SPIRV_1_4;
   } else if (spirv_version >= 0x10300) {
-    target_env = SPV_ENV_VULKAN_1_1;
+    target_env_ = SPV_ENV_VULKAN_1_1;
   } else {
-    target_env = SPV_ENV_VULKAN_1_0;
+    target_env_ = SPV_ENV_VULKAN_1_0;
   }
-  context_ = fn_spvContextCreate_(target_env);
+  context_ = fn_spvContextCreate_(target_env_);
   if (!context_) {
     XELOGE("SPIRV-Tools: Failed to create a Vulkan 1.0 context");
     Shutdown();
@@ -95,6 +109,7 @@ void SpirvToolsContext::Shutdown() {
 #endif
     library_ = nullptr;
   }
+  fn_spvOptimizerCreate_ = nullptr;
 }
 
 spv_result_t SpirvToolsContext::Validate(const uint32_t* words,
@@ -118,6 +133,72 @@ spv_result_t SpirvToolsContext::Validate(const uint32_t* words,
   return result;
 }
 
+spv_result_t SpirvToolsContext::Optimize(
+    const uint32_t* words, size_t num_words,
+    std::vector<uint32_t>& optimized_words_out) const {
+  optimized_words_out.clear();
+  if (!IsOptimizerAvailable()) {
+    return SPV_UNSUPPORTED;
+  }
+  // Translated shaders are mostly straight-line code with all the registers
+  // in function-local variables, so the bulk of the work is promoting them to
+  // SSA values, folding what's known at translation time (such as constant
+  // register indices and values of the modification bits), and removing what
+  // becomes dead. Loop unrolling only applies to loops with a trip count
+  // known at translation time, as the Xenos loop counts are loop constants
+  // specified at draw time.
+  static const char* const kPassFlags[] = {
+      "--eliminate-dead-functions",
+      "--eliminate-local-single-block",
+      "--eliminate-local-single-store",
+      "--ssa-rewrite",
+      "--ccp",
+      "--simplify-instructions",
+      "--eliminate-dead-branches",
+      "--merge-blocks",
+      "--loop-unroll",
+      "--ssa-rewrite",
+      "--ccp",
+      "--simplify-instructions",
+      "--redundancy-elimination",
+      "--eliminate-dead-branches",
+      "--merge-blocks",
+      "--eliminate-dead-code-aggressive",
+  };
+  // The optimizer object is not thread-safe, create one for every call.
+  spv_optimizer_t* optimizer = fn_spvOptimizerCreate_(target_env_);
+  if (!optimizer) {
+    return SPV_ERROR_OUT_OF_MEMORY;
+  }
+  for (const char* pass_flag : kPassFlags) {
+    if (!fn_spvOptimizerRegisterPassFromFlag_(optimizer, pass_flag)) {
+      XELOGW("SPIRV-Tools: Failed to register the optimizer pass {}",
+             pass_flag);
+    }
+  }
+  spv_optimizer_options options = fn_spvOptimizerOptionsCreate_();
+  if (!options) {
+    fn_spvOptimizerDestroy_(optimizer);
+    return SPV_ERROR_OUT_OF_MEMORY;
+  }
+  // The translator output is trusted, and the driver doesn't validate either.
+  fn_spvOptimizerOptionsSetRunValidator_(options, false);
+  spv_binary optimized_binary = nullptr;
+  spv_result_t result = fn_spvOptimizerRun_(optimizer, words, num_words,
+                                            &optimized_binary, options);
+  if (optimized_binary) {
+    if (result == SPV_SUCCESS) {
+      optimized_words_out.assign(
+          optimized_binary->code,
+          optimized_binary->code + optimized_binary->wordCount);
+    }
+    fn_spvBinaryDestroy_(optimized_binary);
+  }
+  fn_spvOptimizerOptionsDestroy_(options);
+  fn_spvOptimizerDestroy_(optimizer);
+  return result;
+}
+
 }  // namespace vulkan
 }  // namespace ui
 }  // namespace xe
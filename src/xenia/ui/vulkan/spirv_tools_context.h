@@ -12,6 +12,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "third_party/SPIRV-Tools/include/spirv-tools/libspirv.h"
 #include "xenia/base/platform.h"
@@ -38,6 +39,15 @@ class SpirvToolsContext {
   spv_result_t Validate(const uint32_t* words, size_t num_words,
                         std::string* error) const;
 
+  // Whether the optimizer is available in the loaded library (it's not in old
+  // versions).
+  bool IsOptimizerAvailable() const {
+    return context_ && fn_spvOptimizerCreate_;
+  }
+  // Runs the optimization passes used for translated shaders. Thread-safe.
+  spv_result_t Optimize(const uint32_t* words, size_t num_words,
+                        std::vector<uint32_t>& optimized_words_out) const;
+
  private:
 #if XE_PLATFORM_LINUX
   void* library_ = nullptr;
@@ -61,6 +71,20 @@ class SpirvToolsContext {
   decltype(&spvContextDestroy) fn_spvContextDestroy_ = nullptr;
   decltype(&spvValidateBinary) fn_spvValidateBinary_ = nullptr;
   decltype(&spvDiagnosticDestroy) fn_spvDiagnosticDestroy_ = nullptr;
+  // Optional.
+  decltype(&spvOptimizerCreate) fn_spvOptimizerCreate_ = nullptr;
+  decltype(&spvOptimizerDestroy) fn_spvOptimizerDestroy_ = nullptr;
+  decltype(&spvOptimizerRegisterPassFromFlag)
+      fn_spvOptimizerRegisterPassFromFlag_ = nullptr;
+  decltype(&spvOptimizerRun) fn_spvOptimizerRun_ = nullptr;
+  decltype(&spvOptimizerOptionsCreate) fn_spvOptimizerOptionsCreate_ = nullptr;
+  decltype(&spvOptimizerOptionsDestroy) fn_spvOptimizerOptionsDestroy_ =
+      nullptr;
+  decltype(&spvOptimizerOptionsSetRunValidator)
+      fn_spvOptimizerOptionsSetRunValidator_ = nullptr;
+  decltype(&spvBinaryDestroy) fn_spvBinaryDestroy_ = nullptr;
+
+  spv_target_env target_env_ = SPV_ENV_VULKAN_1_0;
 
   spv_context context_ = nullptr;
 };
@@ -9,6 +9,7 @@
 
 #include "xenia/ui/vulkan/vulkan_provider.h"
 
+#include <algorithm>
 #include <cfloat>
 #include <cstddef>
 #include <cstring>
@@ -567,6 +568,10 @@ bool VulkanProvider::Initialize() {
     // Initialize all queue families to unused.
     queue_families_.clear();
     queue_families_.resize(queue_family_count);
+    for (uint32_t j = 0; j < queue_family_count; ++j) {
+      queue_families_[j].timestamp_valid_bits =
+          queue_families_properties[j].timestampValidBits;
+    }
     // First, try to obtain a graphics and compute queue. Preferably find a
     // queue with sparse binding support as well.
     // The family indices here are listed from the best to the worst.
@@ -689,15 +694,21 @@ bool VulkanProvider::Initialize() {
     if (device_properties_.apiVersion >= VK_MAKE_API_VERSION(0, 1, 1, 0)) {
       device_extensions_.khr_bind_memory2 = true;
       device_extensions_.khr_dedicated_allocation = true;
+      device_extensions_.khr_external_memory = true;
       device_extensions_.khr_get_memory_requirements2 = true;
       device_extensions_.khr_sampler_ycbcr_conversion = true;
       if (device_properties_.apiVersion >= VK_MAKE_API_VERSION(0, 1, 2, 0)) {
         device_extensions_.khr_image_format_list = true;
         device_extensions_.khr_shader_float_controls = true;
         device_extensions_.khr_spirv_1_4 = true;
+        device_extensions_.khr_timeline_semaphore = true;
         if (device_properties_.apiVersion >= VK_MAKE_API_VERSION(0, 1, 3, 0)) {
+          device_extensions_.ext_extended_dynamic_state = true;
+          device_extensions_.ext_extended_dynamic_state2 = true;
           device_extensions_.ext_shader_demote_to_helper_invocation = true;
+          device_extensions_.khr_dynamic_rendering = true;
           device_extensions_.khr_maintenance4 = true;
+          device_extensions_.khr_synchronization2 = true;
         }
       }
     }
@@ -707,8 +718,16 @@ bool VulkanProvider::Initialize() {
     // core to device_extensions_enabled. Adding literals to
     // device_extensions_enabled for the most C string lifetime safety.
     static const std::pair<const char*, size_t> kUsedDeviceExtensions[] = {
+        {"VK_EXT_extended_dynamic_state",
+         offsetof(DeviceExtensions, ext_extended_dynamic_state)},
+        {"VK_EXT_extended_dynamic_state2",
+         offsetof(DeviceExtensions, ext_extended_dynamic_state2)},
+        {"VK_EXT_external_memory_host",
+         offsetof(DeviceExtensions, ext_external_memory_host)},
         {"VK_EXT_fragment_shader_interlock",
          offsetof(DeviceExtensions, ext_fragment_shader_interlock)},
+        {"VK_EXT_graphics_pipeline_library",
+         offsetof(DeviceExtensions, ext_graphics_pipeline_library)},
         {"VK_EXT_memory_budget", offsetof(DeviceExtensions, ext_memory_budget)},
         {"VK_EXT_shader_demote_to_helper_invocation",
          offsetof(DeviceExtensions, ext_shader_demote_to_helper_invocation)},
@@ -717,11 +736,17 @@ bool VulkanProvider::Initialize() {
         {"VK_KHR_bind_memory2", offsetof(DeviceExtensions, khr_bind_memory2)},
         {"VK_KHR_dedicated_allocation",
          offsetof(DeviceExtensions, khr_dedicated_allocation)},
+        {"VK_KHR_dynamic_rendering",
+         offsetof(DeviceExtensions, khr_dynamic_rendering)},
+        {"VK_KHR_external_memory",
+         offsetof(DeviceExtensions, khr_external_memory)},
         {"VK_KHR_get_memory_requirements2",
          offsetof(DeviceExtensions, khr_get_memory_requirements2)},
         {"VK_KHR_image_format_list",
          offsetof(DeviceExtensions, khr_image_format_list)},
         {"VK_KHR_maintenance4", offsetof(DeviceExtensions, khr_maintenance4)},
+        {"VK_KHR_pipeline_library",
+         offsetof(DeviceExtensions, khr_pipeline_library)},
         {"VK_KHR_portability_subset",
          offsetof(DeviceExtensions, khr_portability_subset)},
         // While vkGetPhysicalDeviceFormatProperties should be used to check the
@@ -735,6 +760,10 @@ bool VulkanProvider::Initialize() {
          offsetof(DeviceExtensions, khr_shader_float_controls)},
         {"VK_KHR_spirv_1_4", offsetof(DeviceExtensions, khr_spirv_1_4)},
         {"VK_KHR_swapchain", offsetof(DeviceExtensions, khr_swapchain)},
+        {"VK_KHR_synchronization2",
+         offsetof(DeviceExtensions, khr_synchronization2)},
+        {"VK_KHR_timeline_semaphore",
+         offsetof(DeviceExtensions, khr_timeline_semaphore)},
     };
     for (const VkExtensionProperties& device_extension :
          device_extension_properties) {
@@ -754,6 +783,52 @@ bool VulkanProvider::Initialize() {
     if (is_surface_required_ && !device_extensions_.khr_swapchain) {
       continue;
     }
+    // VK_KHR_dynamic_rendering requires VK_KHR_depth_stencil_resolve, which
+    // requires VK_KHR_create_renderpass2, both core since 1.2.0 - not enabling
+    // them on earlier versions.
+    if (device_extensions_.khr_dynamic_rendering &&
+        device_properties_.apiVersion < VK_MAKE_API_VERSION(0, 1, 2, 0)) {
+      device_extensions_.khr_dynamic_rendering = false;
+      device_extensions_enabled.erase(
+          std::remove_if(device_extensions_enabled.begin(),
+                         device_extensions_enabled.end(),
+                         [](const char* extension_name) {
+                           return !std::strcmp(extension_name,
+                                               "VK_KHR_dynamic_rendering");
+                         }),
+          device_extensions_enabled.end());
+    }
+    // The features of VK_EXT_graphics_pipeline_library can only be queried
+    // with VK_KHR_get_physical_device_properties2, and pipeline libraries are
+    // created using VK_KHR_pipeline_library.
+    if (device_extensions_.ext_graphics_pipeline_library &&
+        (!device_extensions_.khr_pipeline_library ||
+         !instance_extensions_.khr_get_physical_device_properties2)) {
+      device_extensions_.ext_graphics_pipeline_library = false;
+      device_extensions_enabled.erase(
+          std::remove_if(device_extensions_enabled.begin(),
+                         device_extensions_enabled.end(),
+                         [](const char* extension_name) {
+                           return !std::strcmp(
+                               extension_name,
+                               "VK_EXT_graphics_pipeline_library");
+                         }),
+          device_extensions_enabled.end());
+    }
+    // VK_KHR_synchronization2 requires VK_KHR_get_physical_device_properties2,
+    // and its feature can only be queried with it.
+    if (device_extensions_.khr_synchronization2 &&
+        !instance_extensions_.khr_get_physical_device_properties2) {
+      device_extensions_.khr_synchronization2 = false;
+      device_extensions_enabled.erase(
+          std::remove_if(device_extensions_enabled.begin(),
+                         device_extensions_enabled.end(),
+                         [](const char* extension_name) {
+                           return !std::strcmp(extension_name,
+                                               "VK_KHR_synchronization2");
+                         }),
+          device_extensions_enabled.end());
+    }
 
     // Get portability subset features.
     // VK_KHR_portability_subset reduces, not increases, the capabilities, skip
@@ -817,6 +892,35 @@ bool VulkanProvider::Initialize() {
   }
 
   // Get additional device properties.
+  std::memset(&device_dynamic_rendering_features_, 0,
+              sizeof(device_dynamic_rendering_features_));
+  device_dynamic_rendering_features_.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+  std::memset(&device_extended_dynamic_state_features_, 0,
+              sizeof(device_extended_dynamic_state_features_));
+  device_extended_dynamic_state_features_.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+  // Core and not optional since 1.3.0, and the structure may be unavailable
+  // if the extension is not exposed.
+  bool device_extended_dynamic_state_core =
+      device_properties_.apiVersion >= VK_MAKE_API_VERSION(0, 1, 3, 0);
+  if (device_extended_dynamic_state_core) {
+    device_extended_dynamic_state_features_.extendedDynamicState = VK_TRUE;
+  }
+  std::memset(&device_extended_dynamic_state2_features_, 0,
+              sizeof(device_extended_dynamic_state2_features_));
+  device_extended_dynamic_state2_features_.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT;
+  // Only the base functionality of VK_EXT_extended_dynamic_state2 is core and
+  // not optional since 1.3.0, the logic op and the patch control points are
+  // still optional, but not used by Xenia.
+  if (device_extended_dynamic_state_core) {
+    device_extended_dynamic_state2_features_.extendedDynamicState2 = VK_TRUE;
+  }
+  std::memset(&device_external_memory_host_properties_, 0,
+              sizeof(device_external_memory_host_properties_));
+  device_external_memory_host_properties_.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT;
   std::memset(&device_float_controls_properties_, 0,
               sizeof(device_float_controls_properties_));
   device_float_controls_properties_.sType =
@@ -825,10 +929,26 @@ bool VulkanProvider::Initialize() {
               sizeof(device_fragment_shader_interlock_features_));
   device_fragment_shader_interlock_features_.sType =
       VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_INTERLOCK_FEATURES_EXT;
+  std::memset(&device_graphics_pipeline_library_features_, 0,
+              sizeof(device_graphics_pipeline_library_features_));
+  device_graphics_pipeline_library_features_.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+  std::memset(&device_graphics_pipeline_library_properties_, 0,
+              sizeof(device_graphics_pipeline_library_properties_));
+  device_graphics_pipeline_library_properties_.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
   std::memset(&device_shader_demote_to_helper_invocation_features_, 0,
               sizeof(device_shader_demote_to_helper_invocation_features_));
   device_shader_demote_to_helper_invocation_features_.sType =
       VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES_EXT;
+  std::memset(&device_synchronization2_features_, 0,
+              sizeof(device_synchronization2_features_));
+  device_synchronization2_features_.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+  std::memset(&device_timeline_semaphore_features_, 0,
+              sizeof(device_timeline_semaphore_features_));
+  device_timeline_semaphore_features_.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
   if (instance_extensions_.khr_get_physical_device_properties2) {
     VkPhysicalDeviceProperties2KHR device_properties_2;
     device_properties_2.sType =
@@ -836,6 +956,14 @@ bool VulkanProvider::Initialize() {
     device_properties_2.pNext = nullptr;
     VkPhysicalDeviceProperties2KHR* device_properties_2_last =
         &device_properties_2;
+    if (device_extensions_.ext_external_memory_host) {
+      device_external_memory_host_properties_.pNext = nullptr;
+      device_properties_2_last->pNext =
+          &device_external_memory_host_properties_;
+      device_properties_2_last =
+          reinterpret_cast<VkPhysicalDeviceProperties2KHR*>(
+              &device_external_memory_host_properties_);
+    }
     if (device_extensions_.khr_shader_float_controls) {
       device_float_controls_properties_.pNext = nullptr;
       device_properties_2_last->pNext = &device_float_controls_properties_;
@@ -843,6 +971,14 @@ bool VulkanProvider::Initialize() {
           reinterpret_cast<VkPhysicalDeviceProperties2KHR*>(
               &device_float_controls_properties_);
     }
+    if (device_extensions_.ext_graphics_pipeline_library) {
+      device_graphics_pipeline_library_properties_.pNext = nullptr;
+      device_properties_2_last->pNext =
+          &device_graphics_pipeline_library_properties_;
+      device_properties_2_last =
+          reinterpret_cast<VkPhysicalDeviceProperties2KHR*>(
+              &device_graphics_pipeline_library_properties_);
+    }
     if (device_properties_2_last != &device_properties_2) {
       ifn_.vkGetPhysicalDeviceProperties2KHR(physical_device_,
                                              &device_properties_2);
@@ -851,6 +987,20 @@ bool VulkanProvider::Initialize() {
     device_features_2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
     device_features_2.pNext = nullptr;
     VkPhysicalDeviceFeatures2KHR* device_features_2_last = &device_features_2;
+    if (device_extensions_.ext_extended_dynamic_state &&
+        !device_extended_dynamic_state_core) {
+      device_extended_dynamic_state_features_.pNext = nullptr;
+      device_features_2_last->pNext = &device_extended_dynamic_state_features_;
+      device_features_2_last = reinterpret_cast<VkPhysicalDeviceFeatures2KHR*>(
+          &device_extended_dynamic_state_features_);
+    }
+    if (device_extensions_.ext_extended_dynamic_state2 &&
+        !device_extended_dynamic_state_core) {
+      device_extended_dynamic_state2_features_.pNext = nullptr;
+      device_features_2_last->pNext = &device_extended_dynamic_state2_features_;
+      device_features_2_last = reinterpret_cast<VkPhysicalDeviceFeatures2KHR*>(
+          &device_extended_dynamic_state2_features_);
+    }
     if (device_extensions_.ext_fragment_shader_interlock) {
       device_fragment_shader_interlock_features_.pNext = nullptr;
       device_features_2_last->pNext =
@@ -858,6 +1008,13 @@ bool VulkanProvider::Initialize() {
       device_features_2_last = reinterpret_cast<VkPhysicalDeviceFeatures2KHR*>(
           &device_fragment_shader_interlock_features_);
     }
+    if (device_extensions_.ext_graphics_pipeline_library) {
+      device_graphics_pipeline_library_features_.pNext = nullptr;
+      device_features_2_last->pNext =
+          &device_graphics_pipeline_library_features_;
+      device_features_2_last = reinterpret_cast<VkPhysicalDeviceFeatures2KHR*>(
+          &device_graphics_pipeline_library_features_);
+    }
     if (device_extensions_.ext_shader_demote_to_helper_invocation) {
       device_shader_demote_to_helper_invocation_features_.pNext = nullptr;
       device_features_2_last->pNext =
@@ -865,6 +1022,24 @@ bool VulkanProvider::Initialize() {
       device_features_2_last = reinterpret_cast<VkPhysicalDeviceFeatures2KHR*>(
           &device_shader_demote_to_helper_invocation_features_);
     }
+    if (device_extensions_.khr_dynamic_rendering) {
+      device_dynamic_rendering_features_.pNext = nullptr;
+      device_features_2_last->pNext = &device_dynamic_rendering_features_;
+      device_features_2_last = reinterpret_cast<VkPhysicalDeviceFeatures2KHR*>(
+          &device_dynamic_rendering_features_);
+    }
+    if (device_extensions_.khr_synchronization2) {
+      device_synchronization2_features_.pNext = nullptr;
+      device_features_2_last->pNext = &device_synchronization2_features_;
+      device_features_2_last = reinterpret_cast<VkPhysicalDeviceFeatures2KHR*>(
+          &device_synchronization2_features_);
+    }
+    if (device_extensions_.khr_timeline_semaphore) {
+      device_timeline_semaphore_features_.pNext = nullptr;
+      device_features_2_last->pNext = &device_timeline_semaphore_features_;
+      device_features_2_last = reinterpret_cast<VkPhysicalDeviceFeatures2KHR*>(
+          &device_timeline_semaphore_features_);
+    }
     if (device_features_2_last != &device_features_2) {
       ifn_.vkGetPhysicalDeviceFeatures2KHR(physical_device_,
                                            &device_features_2);
@@ -921,6 +1096,25 @@ bool VulkanProvider::Initialize() {
     device_create_info_last = reinterpret_cast<VkDeviceCreateInfo*>(
         &device_portability_subset_features_);
   }
+  if (device_extensions_.ext_extended_dynamic_state &&
+      !device_extended_dynamic_state_core) {
+    device_extended_dynamic_state_features_.pNext = nullptr;
+    device_create_info_last->pNext = &device_extended_dynamic_state_features_;
+    device_create_info_last = reinterpret_cast<VkDeviceCreateInfo*>(
+        &device_extended_dynamic_state_features_);
+  }
+  if (device_extensions_.ext_extended_dynamic_state2 &&
+      !device_extended_dynamic_state_core) {
+    // Only the base functionality is used.
+    device_extended_dynamic_state2_features_.extendedDynamicState2LogicOp =
+        VK_FALSE;
+    device_extended_dynamic_state2_features_
+        .extendedDynamicState2PatchControlPoints = VK_FALSE;
+    device_extended_dynamic_state2_features_.pNext = nullptr;
+    device_create_info_last->pNext = &device_extended_dynamic_state2_features_;
+    device_create_info_last = reinterpret_cast<VkDeviceCreateInfo*>(
+        &device_extended_dynamic_state2_features_);
+  }
   if (device_extensions_.ext_fragment_shader_interlock) {
     // TODO(Triang3l): Enable only needed fragment shader interlock features.
     device_fragment_shader_interlock_features_.pNext = nullptr;
@@ -929,6 +1123,13 @@ bool VulkanProvider::Initialize() {
     device_create_info_last = reinterpret_cast<VkDeviceCreateInfo*>(
         &device_fragment_shader_interlock_features_);
   }
+  if (device_extensions_.ext_graphics_pipeline_library) {
+    device_graphics_pipeline_library_features_.pNext = nullptr;
+    device_create_info_last->pNext =
+        &device_graphics_pipeline_library_features_;
+    device_create_info_last = reinterpret_cast<VkDeviceCreateInfo*>(
+        &device_graphics_pipeline_library_features_);
+  }
   if (device_extensions_.ext_shader_demote_to_helper_invocation) {
     device_shader_demote_to_helper_invocation_features_.pNext = nullptr;
     device_create_info_last->pNext =
@@ -936,6 +1137,24 @@ bool VulkanProvider::Initialize() {
     device_create_info_last = reinterpret_cast<VkDeviceCreateInfo*>(
         &device_shader_demote_to_helper_invocation_features_);
   }
+  if (device_extensions_.khr_dynamic_rendering) {
+    device_dynamic_rendering_features_.pNext = nullptr;
+    device_create_info_last->pNext = &device_dynamic_rendering_features_;
+    device_create_info_last = reinterpret_cast<VkDeviceCreateInfo*>(
+        &device_dynamic_rendering_features_);
+  }
+  if (device_extensions_.khr_synchronization2) {
+    device_synchronization2_features_.pNext = nullptr;
+    device_create_info_last->pNext = &device_synchronization2_features_;
+    device_create_info_last = reinterpret_cast<VkDeviceCreateInfo*>(
+        &device_synchronization2_features_);
+  }
+  if (device_extensions_.khr_timeline_semaphore) {
+    device_timeline_semaphore_features_.pNext = nullptr;
+    device_create_info_last->pNext = &device_timeline_semaphore_features_;
+    device_create_info_last = reinterpret_cast<VkDeviceCreateInfo*>(
+        &device_timeline_semaphore_features_);
+  }
   if (ifn_.vkCreateDevice(physical_device_, &device_create_info, nullptr,
                           &device_) != VK_SUCCESS) {
     XELOGE("Failed to create a Vulkan device");
@@ -967,6 +1186,37 @@ bool VulkanProvider::Initialize() {
     }
   }
   // Extensions - disable the specific extension if failed to get its functions.
+  if (device_extensions_.ext_extended_dynamic_state) {
+    bool functions_loaded = true;
+    if (device_extended_dynamic_state_core) {
+#define XE_UI_VULKAN_FUNCTION_PROMOTED XE_UI_VULKAN_FUNCTION_PROMOTE
+#include "xenia/ui/vulkan/functions/device_ext_extended_dynamic_state.inc"
+#undef XE_UI_VULKAN_FUNCTION_PROMOTED
+    } else {
+#define XE_UI_VULKAN_FUNCTION_PROMOTED XE_UI_VULKAN_FUNCTION_DONT_PROMOTE
+#include "xenia/ui/vulkan/functions/device_ext_extended_dynamic_state.inc"
+#undef XE_UI_VULKAN_FUNCTION_PROMOTED
+    }
+    device_extensions_.ext_extended_dynamic_state = functions_loaded;
+  }
+  if (device_extensions_.ext_extended_dynamic_state2) {
+    bool functions_loaded = true;
+    if (device_extended_dynamic_state_core) {
+#define XE_UI_VULKAN_FUNCTION_PROMOTED XE_UI_VULKAN_FUNCTION_PROMOTE
+#include "xenia/ui/vulkan/functions/device_ext_extended_dynamic_state2.inc"
+#undef XE_UI_VULKAN_FUNCTION_PROMOTED
+    } else {
+#define XE_UI_VULKAN_FUNCTION_PROMOTED XE_UI_VULKAN_FUNCTION_DONT_PROMOTE
+#include "xenia/ui/vulkan/functions/device_ext_extended_dynamic_state2.inc"
+#undef XE_UI_VULKAN_FUNCTION_PROMOTED
+    }
+    device_extensions_.ext_extended_dynamic_state2 = functions_loaded;
+  }
+  if (device_extensions_.ext_external_memory_host) {
+    bool functions_loaded = true;
+#include "xenia/ui/vulkan/functions/device_ext_external_memory_host.inc"
+    device_extensions_.ext_external_memory_host = functions_loaded;
+  }
   if (device_extensions_.khr_bind_memory2) {
     bool functions_loaded = true;
     if (device_properties_.apiVersion >= VK_MAKE_API_VERSION(0, 1, 1, 0)) {
@@ -980,6 +1230,19 @@ bool VulkanProvider::Initialize() {
     }
     device_extensions_.khr_bind_memory2 = functions_loaded;
   }
+  if (device_extensions_.khr_dynamic_rendering) {
+    bool functions_loaded = true;
+    if (device_properties_.apiVersion >= VK_MAKE_API_VERSION(0, 1, 3, 0)) {
+#define XE_UI_VULKAN_FUNCTION_PROMOTED XE_UI_VULKAN_FUNCTION_PROMOTE
+#include "xenia/ui/vulkan/functions/device_khr_dynamic_rendering.inc"
+#undef XE_UI_VULKAN_FUNCTION_PROMOTED
+    } else {
+#define XE_UI_VULKAN_FUNCTION_PROMOTED XE_UI_VULKAN_FUNCTION_DONT_PROMOTE
+#include "xenia/ui/vulkan/functions/device_khr_dynamic_rendering.inc"
+#undef XE_UI_VULKAN_FUNCTION_PROMOTED
+    }
+    device_extensions_.khr_dynamic_rendering = functions_loaded;
+  }
   if (device_extensions_.khr_get_memory_requirements2) {
     bool functions_loaded = true;
     if (device_properties_.apiVersion >= VK_MAKE_API_VERSION(0, 1, 1, 0)) {
@@ -1022,6 +1285,32 @@ bool VulkanProvider::Initialize() {
     }
     device_extensions_.khr_swapchain = functions_loaded;
   }
+  if (device_extensions_.khr_synchronization2) {
+    bool functions_loaded = true;
+    if (device_properties_.apiVersion >= VK_MAKE_API_VERSION(0, 1, 3, 0)) {
+#define XE_UI_VULKAN_FUNCTION_PROMOTED XE_UI_VULKAN_FUNCTION_PROMOTE
+#include "xenia/ui/vulkan/functions/device_khr_synchronization2.inc"
+#undef XE_UI_VULKAN_FUNCTION_PROMOTED
+    } else {
+#define XE_UI_VULKAN_FUNCTION_PROMOTED XE_UI_VULKAN_FUNCTION_DONT_PROMOTE
+#include "xenia/ui/vulkan/functions/device_khr_synchronization2.inc"
+#undef XE_UI_VULKAN_FUNCTION_PROMOTED
+    }
+    device_extensions_.khr_synchronization2 = functions_loaded;
+  }
+  if (device_extensions_.khr_timeline_semaphore) {
+    bool functions_loaded = true;
+    if (device_properties_.apiVersion >= VK_MAKE_API_VERSION(0, 1, 2, 0)) {
+#define XE_UI_VULKAN_FUNCTION_PROMOTED XE_UI_VULKAN_FUNCTION_PROMOTE
+#include "xenia/ui/vulkan/functions/device_khr_timeline_semaphore.inc"
+#undef XE_UI_VULKAN_FUNCTION_PROMOTED
+    } else {
+#define XE_UI_VULKAN_FUNCTION_PROMOTED XE_UI_VULKAN_FUNCTION_DONT_PROMOTE
+#include "xenia/ui/vulkan/functions/device_khr_timeline_semaphore.inc"
+#undef XE_UI_VULKAN_FUNCTION_PROMOTED
+    }
+    device_extensions_.khr_timeline_semaphore = functions_loaded;
+  }
 #undef XE_UI_VULKAN_FUNCTION_PROMOTE
 #undef XE_UI_VULKAN_FUNCTION_DONT_PROMOTE
 #undef XE_UI_VULKAN_FUNCTION
@@ -1041,6 +1330,23 @@ bool VulkanProvider::Initialize() {
       VK_VERSION_MINOR(device_properties_.apiVersion),
       VK_VERSION_PATCH(device_properties_.apiVersion));
   XELOGVK("Vulkan device extensions:");
+  XELOGVK("* VK_EXT_extended_dynamic_state: {}",
+          device_extended_dynamic_state_features_.extendedDynamicState &&
+                  device_extensions_.ext_extended_dynamic_state
+              ? "yes"
+              : "no");
+  XELOGVK("* VK_EXT_extended_dynamic_state2: {}",
+          device_extended_dynamic_state2_features_.extendedDynamicState2 &&
+                  device_extensions_.ext_extended_dynamic_state2
+              ? "yes"
+              : "no");
+  XELOGVK("* VK_EXT_external_memory_host: {}",
+          device_extensions_.ext_external_memory_host ? "yes" : "no");
+  if (device_extensions_.ext_external_memory_host) {
+    XELOGVK("  * Minimum imported host pointer alignment: {}",
+            device_external_memory_host_properties_
+                .minImportedHostPointerAlignment);
+  }
   XELOGVK("* VK_EXT_fragment_shader_interlock: {}",
           device_extensions_.ext_fragment_shader_interlock ? "yes" : "no");
   if (device_extensions_.ext_fragment_shader_interlock) {
@@ -1055,6 +1361,19 @@ bool VulkanProvider::Initialize() {
             ? "yes"
             : "no");
   }
+  XELOGVK("* VK_EXT_graphics_pipeline_library: {}",
+          device_extensions_.ext_graphics_pipeline_library &&
+                  device_graphics_pipeline_library_features_
+                      .graphicsPipelineLibrary
+              ? "yes"
+              : "no");
+  if (device_extensions_.ext_graphics_pipeline_library) {
+    XELOGVK("  * Fast linking: {}",
+            device_graphics_pipeline_library_properties_
+                    .graphicsPipelineLibraryFastLinking
+                ? "yes"
+                : "no");
+  }
   XELOGVK("* VK_EXT_memory_budget: {}",
           device_extensions_.ext_memory_budget ? "yes" : "no");
   XELOGVK(
@@ -1073,12 +1392,21 @@ bool VulkanProvider::Initialize() {
           device_extensions_.khr_bind_memory2 ? "yes" : "no");
   XELOGVK("* VK_KHR_dedicated_allocation: {}",
           device_extensions_.khr_dedicated_allocation ? "yes" : "no");
+  XELOGVK("* VK_KHR_dynamic_rendering: {}",
+          device_extensions_.khr_dynamic_rendering &&
+                  device_dynamic_rendering_features_.dynamicRendering
+              ? "yes"
+              : "no");
+  XELOGVK("* VK_KHR_external_memory: {}",
+          device_extensions_.khr_external_memory ? "yes" : "no");
   XELOGVK("* VK_KHR_get_memory_requirements2: {}",
           device_extensions_.khr_get_memory_requirements2 ? "yes" : "no");
   XELOGVK("* VK_KHR_image_format_list: {}",
           device_extensions_.khr_image_format_list ? "yes" : "no");
   XELOGVK("* VK_KHR_maintenance4: {}",
           device_extensions_.khr_maintenance4 ? "yes" : "no");
+  XELOGVK("* VK_KHR_pipeline_library: {}",
+          device_extensions_.khr_pipeline_library ? "yes" : "no");
   XELOGVK("* VK_KHR_portability_subset: {}",
           device_extensions_.khr_portability_subset ? "yes" : "no");
   if (device_extensions_.khr_portability_subset) {
@@ -1126,6 +1454,16 @@ bool VulkanProvider::Initialize() {
     XELOGVK("* VK_KHR_swapchain: {}",
             device_extensions_.khr_swapchain ? "yes" : "no");
   }
+  XELOGVK("* VK_KHR_synchronization2: {}",
+          device_extensions_.khr_synchronization2 &&
+                  device_synchronization2_features_.synchronization2
+              ? "yes"
+              : "no");
+  XELOGVK("* VK_KHR_timeline_semaphore: {}",
+          device_extensions_.khr_timeline_semaphore &&
+                  device_timeline_semaphore_features_.timelineSemaphore
+              ? "yes"
+              : "no");
   // TODO(Triang3l): Report properties, features.
 
   // Get the queues.
@@ -131,7 +131,15 @@ class VulkanProvider : public GraphicsProvider {
     return device_features_;
   }
   struct DeviceExtensions {
+    // Core since 1.3.0.
+    bool ext_extended_dynamic_state;
+    // Core since 1.3.0.
+    bool ext_extended_dynamic_state2;
+    // Requires VK_KHR_external_memory.
+    bool ext_external_memory_host;
     bool ext_fragment_shader_interlock;
+    // Requires VK_KHR_pipeline_library.
+    bool ext_graphics_pipeline_library;
     bool ext_memory_budget;
     // Core since 1.3.0.
     bool ext_shader_demote_to_helper_invocation;
@@ -140,12 +148,18 @@ class VulkanProvider : public GraphicsProvider {
     bool khr_bind_memory2;
     // Core since 1.1.0.
     bool khr_dedicated_allocation;
+    // Core since 1.3.0. Used only on Vulkan 1.2 and newer, where its
+    // dependencies are core.
+    bool khr_dynamic_rendering;
+    // Core since 1.1.0.
+    bool khr_external_memory;
     // Core since 1.1.0.
     bool khr_get_memory_requirements2;
     // Core since 1.2.0.
     bool khr_image_format_list;
     // Core since 1.3.0.
     bool khr_maintenance4;
+    bool khr_pipeline_library;
     // Requires the VK_KHR_get_physical_device_properties2 instance extension.
     bool khr_portability_subset;
     // Core since 1.1.0.
@@ -155,6 +169,10 @@ class VulkanProvider : public GraphicsProvider {
     // Core since 1.2.0.
     bool khr_spirv_1_4;
     bool khr_swapchain;
+    // Core since 1.3.0.
+    bool khr_synchronization2;
+    // Core since 1.2.0.
+    bool khr_timeline_semaphore;
   };
   const DeviceExtensions& device_extensions() const {
     return device_extensions_;
@@ -183,6 +201,8 @@ class VulkanProvider : public GraphicsProvider {
     uint32_t queue_first_index = 0;
     uint32_t queue_count = 0;
     bool potentially_supports_present = false;
+    // 0 if timestamp queries are not supported.
+    uint32_t timestamp_valid_bits = 0;
   };
   const std::vector<QueueFamily>& queue_families() const {
     return queue_families_;
@@ -196,6 +216,22 @@ class VulkanProvider : public GraphicsProvider {
   uint32_t queue_family_sparse_binding() const {
     return queue_family_sparse_binding_;
   }
+  const VkPhysicalDeviceDynamicRenderingFeaturesKHR&
+  device_dynamic_rendering_features() const {
+    return device_dynamic_rendering_features_;
+  }
+  const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT&
+  device_extended_dynamic_state_features() const {
+    return device_extended_dynamic_state_features_;
+  }
+  const VkPhysicalDeviceExtendedDynamicState2FeaturesEXT&
+  device_extended_dynamic_state2_features() const {
+    return device_extended_dynamic_state2_features_;
+  }
+  const VkPhysicalDeviceExternalMemoryHostPropertiesEXT&
+  device_external_memory_host_properties() const {
+    return device_external_memory_host_properties_;
+  }
   const VkPhysicalDeviceFloatControlsPropertiesKHR&
   device_float_controls_properties() const {
     return device_float_controls_properties_;
@@ -204,10 +240,26 @@ class VulkanProvider : public GraphicsProvider {
   device_fragment_shader_interlock_features() const {
     return device_fragment_shader_interlock_features_;
   }
+  const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT&
+  device_graphics_pipeline_library_features() const {
+    return device_graphics_pipeline_library_features_;
+  }
+  const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT&
+  device_graphics_pipeline_library_properties() const {
+    return device_graphics_pipeline_library_properties_;
+  }
   const VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT&
   device_shader_demote_to_helper_invocation_features() const {
     return device_shader_demote_to_helper_invocation_features_;
   }
+  const VkPhysicalDeviceSynchronization2FeaturesKHR&
+  device_synchronization2_features() const {
+    return device_synchronization2_features_;
+  }
+  const VkPhysicalDeviceTimelineSemaphoreFeaturesKHR&
+  device_timeline_semaphore_features() const {
+    return device_timeline_semaphore_features_;
+  }
 
   struct Queue {
     VkQueue queue = VK_NULL_HANDLE;
@@ -237,10 +289,16 @@ class VulkanProvider : public GraphicsProvider {
 #define XE_UI_VULKAN_FUNCTION_PROMOTED(extension_name, core_name) \
   PFN_##extension_name extension_name;
 #include "xenia/ui/vulkan/functions/device_1_0.inc"
+#include "xenia/ui/vulkan/functions/device_ext_extended_dynamic_state.inc"
+#include "xenia/ui/vulkan/functions/device_ext_extended_dynamic_state2.inc"
+#include "xenia/ui/vulkan/functions/device_ext_external_memory_host.inc"
 #include "xenia/ui/vulkan/functions/device_khr_bind_memory2.inc"
+#include "xenia/ui/vulkan/functions/device_khr_dynamic_rendering.inc"
 #include "xenia/ui/vulkan/functions/device_khr_get_memory_requirements2.inc"
 #include "xenia/ui/vulkan/functions/device_khr_maintenance4.inc"
 #include "xenia/ui/vulkan/functions/device_khr_swapchain.inc"
+#include "xenia/ui/vulkan/functions/device_khr_synchronization2.inc"
+#include "xenia/ui/vulkan/functions/device_khr_timeline_semaphore.inc"
 #undef XE_UI_VULKAN_FUNCTION_PROMOTED
 #undef XE_UI_VULKAN_FUNCTION
   };
@@ -329,11 +387,26 @@ class VulkanProvider : public GraphicsProvider {
   std::vector<QueueFamily> queue_families_;
   uint32_t queue_family_graphics_compute_;
   uint32_t queue_family_sparse_binding_;
+  VkPhysicalDeviceDynamicRenderingFeaturesKHR
+      device_dynamic_rendering_features_;
+  VkPhysicalDeviceExtendedDynamicStateFeaturesEXT
+      device_extended_dynamic_state_features_;
+  VkPhysicalDeviceExtendedDynamicState2FeaturesEXT
+      device_extended_dynamic_state2_features_;
+  VkPhysicalDeviceExternalMemoryHostPropertiesEXT
+      device_external_memory_host_properties_;
   VkPhysicalDeviceFloatControlsPropertiesKHR device_float_controls_properties_;
   VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT
       device_fragment_shader_interlock_features_;
+  VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT
+      device_graphics_pipeline_library_features_;
+  VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT
+      device_graphics_pipeline_library_properties_;
   VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT
       device_shader_demote_to_helper_invocation_features_;
+  VkPhysicalDeviceSynchronization2FeaturesKHR device_synchronization2_features_;
+  VkPhysicalDeviceTimelineSemaphoreFeaturesKHR
+      device_timeline_semaphore_features_;
 
   VkDevice device_ = VK_NULL_HANDLE;
   DeviceFunctions dfn_ = {};
@@ -47,6 +47,7 @@ WindowedAppContext::~WindowedAppContext() {
 
 bool WindowedAppContext::CallInUIThreadDeferred(
     std::function<void()> function) {
+  bool notify;
   {
     std::unique_lock<std::mutex> pending_functions_lock(
         pending_functions_mutex_);
@@ -55,8 +56,12 @@ bool WindowedAppContext::CallInUIThreadDeferred(
       return false;
     }
     pending_functions_.emplace_back(std::move(function));
+    // If already notified, the UI thread hasn't started executing the pending
+    // functions since, and will take this one in the same batch.
+    notify = !pending_functions_notified_;
+    pending_functions_notified_ = true;
   }
-  // Notify unconditionally, even if currently running pending functions. It's
+  // Notify if needed even if currently running pending functions. It's
   // possible for pending functions themselves to run inner platform message
   // loops, such as when displaying dialogs - in this case, the notification is
   // needed to run the new function from such an inner loop. A modal loop can be
@@ -75,7 +80,7 @@ bool WindowedAppContext::CallInUIThreadDeferred(
   // lock the mutex afterwards to execute pending functions (and encouters
   // contention), nothing will be able to receive from the pipe anymore and thus
   // free the space, causing a deadlock.
-  if (!is_in_destructor_) {
+  if (notify && !is_in_destructor_) {
     NotifyUILoopOfPendingFunctions();
   }
   return true;
@@ -91,6 +96,21 @@ bool WindowedAppContext::CallInUIThread(std::function<void()> function) {
   return CallInUIThreadDeferred(std::move(function));
 }
 
+bool WindowedAppContext::CallInUIThreadCoalesced(
+    std::atomic<bool>& is_queued, std::function<void()> function) {
+  if (is_queued.exchange(true, std::memory_order_acq_rel)) {
+    return true;
+  }
+  if (!CallInUIThread([&is_queued, function = std::move(function)]() {
+        is_queued.store(false, std::memory_order_release);
+        function();
+      })) {
+    is_queued.store(false, std::memory_order_release);
+    return false;
+  }
+  return true;
+}
+
 bool WindowedAppContext::CallInUIThreadSynchronous(
     std::function<void()> function) {
   if (IsInUIThread()) {
@@ -140,6 +160,9 @@ void WindowedAppContext::QuitFromUIThread() {
 void WindowedAppContext::ExecutePendingFunctionsFromUIThread(bool is_final) {
   assert_true(IsInUIThread());
   std::unique_lock<std::mutex> pending_functions_lock(pending_functions_mutex_);
+  // All functions enqueued before this point will be executed by this loop,
+  // the ones enqueued later need a new notification.
+  pending_functions_notified_ = false;
   while (!pending_functions_.empty()) {
     // Removing the function from the queue before executing it, as the function
     // itself may call ExecutePendingFunctionsFromUIThread - if it's kept, the
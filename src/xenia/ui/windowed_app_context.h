@@ -10,6 +10,7 @@
 #ifndef XENIA_UI_WINDOWED_APP_CONTEXT_H_
 #define XENIA_UI_WINDOWED_APP_CONTEXT_H_
 
+#include <atomic>
 #include <cstdint>
 #include <deque>
 #include <functional>
@@ -72,6 +73,15 @@ class WindowedAppContext {
   // Executes the function immediately if already in the UI thread, enqueues it
   // otherwise.
   bool CallInUIThread(std::function<void()> function);
+  // Like CallInUIThread, but for requests that only need to be handled once no
+  // matter how many times they're made before the UI thread gets to them (such
+  // as pumping events or refreshing something) - if is_queued is already true,
+  // the function is dropped (returning true as the earlier one is still going
+  // to be called), otherwise is_queued is set and the function is enqueued.
+  // is_queued is reset before calling the function, so requests made while it's
+  // being executed enqueue it again. is_queued must outlive the call.
+  bool CallInUIThreadCoalesced(std::atomic<bool>& is_queued,
+                               std::function<void()> function);
   bool CallInUIThreadSynchronous(std::function<void()> function);
   // It's okay to call this function from the queued functions themselves (such
   // as in the case of waiting for a pending async CallInUIThreadDeferred
@@ -170,6 +180,17 @@ class WindowedAppContext {
   // will never return, for instance).
   std::mutex pending_functions_mutex_;
   std::deque<std::function<void()>> pending_functions_;
+  // Protected by pending_functions_mutex_. Whether
+  // NotifyUILoopOfPendingFunctions has been called after the last time the UI
+  // thread started executing the pending functions, so functions enqueued in
+  // bursts (faster than the UI thread handles them) wake the platform loop once
+  // per batch rather than for each function - on some platforms, such as
+  // Windows, each notification is a separate message, and posting may even
+  // have to wait for space in the message queue. Reset when starting
+  // executing, not when finishing, so functions enqueued while executing the
+  // others (including for inner platform loops such as those of modal dialogs)
+  // still wake the platform loop.
+  bool pending_functions_notified_ = false;
   // Protected by pending_functions_mutex_, writable by the UI thread, readable
   // by any thread. Must be set to false before exiting the main platform loop,
   // but before that, all pending functions must be executed no matter what, as
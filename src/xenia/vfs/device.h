@@ -10,6 +10,7 @@
 #ifndef XENIA_VFS_DEVICE_H_
 #define XENIA_VFS_DEVICE_H_
 
+#include <filesystem>
 #include <memory>
 #include <string>
 
@@ -42,6 +43,12 @@ class Device {
   virtual uint32_t sectors_per_allocation_unit() const = 0;
   virtual uint32_t bytes_per_sector() const = 0;
 
+  // Called when a title is launched from the device, for prefetching the data
+  // read during the previous boots of the title, and recording the reads for
+  // the next ones (see BootReadRecorder).
+  virtual void BeginBootReadRecording(
+      const std::filesystem::path& record_path) {}
+
  protected:
   xe::global_critical_region global_critical_region_;
   std::string mount_path_;
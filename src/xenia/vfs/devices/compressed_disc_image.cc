@@ -0,0 +1,482 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/vfs/devices/compressed_disc_image.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "third_party/fmt/include/fmt/format.h"
+#include "third_party/snappy/snappy.h"
+#include "xenia/base/assert.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+
+DEFINE_uint32(compressed_disc_image_cache_size_mb, 64,
+              "Size of the cache of the decompressed blocks of compressed "
+              "disc images, in megabytes.",
+              "Storage");
+DEFINE_uint32(
+    compressed_disc_image_readahead_blocks, 16,
+    "Number of the blocks of a compressed disc image decompressed ahead of "
+    "sequential reads. 0 to disable readahead.",
+    "Storage");
+DEFINE_uint32(compressed_disc_image_readahead_threads, 2,
+              "Number of the host threads decompressing the blocks of "
+              "compressed disc images ahead of sequential reads.",
+              "Storage");
+
+namespace xe {
+namespace vfs {
+
+// Enough for every reader to hold a block while the readahead threads are
+// filling the others.
+constexpr size_t kMinCachedBlocks = 32;
+constexpr size_t kMaxReadaheadQueueSize = 256;
+
+bool CompressedDiscImage::IsCompressedDiscImage(
+    const std::filesystem::path& path) {
+  FILE* file = xe::filesystem::OpenFile(path, "rb");
+  if (!file) {
+    return false;
+  }
+  uint32_t magic;
+  bool is_compressed =
+      fread(&magic, sizeof(magic), 1, file) == 1 && magic == kMagic;
+  fclose(file);
+  return is_compressed;
+}
+
+std::unique_ptr<CompressedDiscImage> CompressedDiscImage::Open(
+    const std::filesystem::path& path) {
+  auto mmap = MappedMemory::Open(path, MappedMemory::Mode::kRead);
+  if (!mmap) {
+    XELOGE("Compressed disc image could not be mapped");
+    return nullptr;
+  }
+  if (mmap->size() < sizeof(Header)) {
+    XELOGE("Compressed disc image is too small for the header");
+    return nullptr;
+  }
+  Header header;
+  std::memcpy(&header, mmap->data(), sizeof(header));
+  if (header.magic != kMagic || header.version != kVersion) {
+    XELOGE("Compressed disc image has unsupported magic {:08X} version {}",
+           header.magic, header.version);
+    return nullptr;
+  }
+  if (header.block_size_log2 < kMinBlockSizeLog2 ||
+      header.block_size_log2 > kMaxBlockSizeLog2) {
+    XELOGE("Compressed disc image has unsupported block size 2^{}",
+           header.block_size_log2);
+    return nullptr;
+  }
+  uint64_t block_count =
+      (header.image_size + (uint64_t(1) << header.block_size_log2) - 1) >>
+      header.block_size_log2;
+  size_t data_offset = sizeof(Header) + sizeof(uint64_t) * (block_count + 1);
+  if (mmap->size() < data_offset) {
+    XELOGE("Compressed disc image is too small for the block index");
+    return nullptr;
+  }
+  const uint64_t* index =
+      reinterpret_cast<const uint64_t*>(mmap->data() + sizeof(Header));
+  uint64_t previous_offset = data_offset;
+  for (uint64_t i = 0; i <= block_count; ++i) {
+    uint64_t offset = index[i] & kIndexOffsetMask;
+    BlockType type = BlockType(index[i] >> kIndexTypeShift);
+    if (offset < previous_offset || offset > mmap->size() ||
+        (i < block_count && type != BlockType::kZero &&
+         type != BlockType::kStored && type != BlockType::kSnappy)) {
+      XELOGE("Compressed disc image has an invalid index entry for block {}",
+             i);
+      return nullptr;
+    }
+    previous_offset = offset;
+  }
+
+  std::unique_ptr<CompressedDiscImage> image(new CompressedDiscImage());
+  image->mmap_ = std::move(mmap);
+  image->size_ = header.image_size;
+  image->block_size_log2_ = header.block_size_log2;
+  image->block_count_ = block_count;
+  image->index_ = index;
+
+  size_t cached_block_count = std::max(
+      size_t((uint64_t(cvars::compressed_disc_image_cache_size_mb) << 20) >>
+             header.block_size_log2),
+      kMinCachedBlocks);
+  image->cached_blocks_ = std::vector<CachedBlock>(cached_block_count);
+  image->cached_block_map_.reserve(cached_block_count);
+
+  if (cvars::compressed_disc_image_readahead_blocks) {
+    uint32_t thread_count =
+        std::min(cvars::compressed_disc_image_readahead_threads, uint32_t(16));
+    xe::threading::Thread::CreationParameters params;
+    params.stack_size = 256 * 1024;
+    for (uint32_t i = 0; i < thread_count; ++i) {
+      CompressedDiscImage* image_ptr = image.get();
+      std::unique_ptr<xe::threading::Thread> thread =
+          xe::threading::Thread::Create(
+              params, [image_ptr]() { image_ptr->ReadaheadThreadMain(); });
+      if (!thread) {
+        XELOGE("Failed to create a compressed disc image readahead thread");
+        break;
+      }
+      thread->set_name(fmt::format("Disc Image Readahead {}", i));
+      image->readahead_threads_.push_back(std::move(thread));
+    }
+  }
+
+  XELOGI(
+      "Compressed disc image: {} bytes in {} blocks of {} bytes, {} bytes "
+      "compressed",
+      image->size_, image->block_count_, image->block_size(),
+      image->mmap_->size());
+  return image;
+}
+
+static bool IsZeroBlock(const uint8_t* data, size_t size) {
+  uint64_t value_or = 0;
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t value;
+    std::memcpy(&value, data + i, sizeof(value));
+    value_or |= value;
+  }
+  for (; i < size; ++i) {
+    value_or |= data[i];
+  }
+  return !value_or;
+}
+
+bool CompressedDiscImage::Compress(const std::filesystem::path& source_path,
+                                   const std::filesystem::path& target_path,
+                                   uint32_t block_size_log2) {
+  if (block_size_log2 < kMinBlockSizeLog2 ||
+      block_size_log2 > kMaxBlockSizeLog2) {
+    XELOGE("Unsupported compressed disc image block size 2^{}",
+           block_size_log2);
+    return false;
+  }
+  auto source = MappedMemory::Open(source_path, MappedMemory::Mode::kRead);
+  if (!source) {
+    XELOGE("Failed to map the source disc image {}",
+           xe::path_to_utf8(source_path));
+    return false;
+  }
+  FILE* file = xe::filesystem::OpenFile(target_path, "wb");
+  if (!file) {
+    XELOGE("Failed to create the compressed disc image {}",
+           xe::path_to_utf8(target_path));
+    return false;
+  }
+
+  Header header = {};
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.block_size_log2 = block_size_log2;
+  header.image_size = source->size();
+  size_t block_size = size_t(1) << block_size_log2;
+  uint64_t block_count =
+      (header.image_size + block_size - 1) >> block_size_log2;
+  // Written once all the blocks are compressed.
+  std::vector<uint64_t> index(block_count + 1);
+  bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                 fwrite(index.data(), sizeof(uint64_t), index.size(), file) ==
+                     index.size();
+
+  uint64_t data_offset = sizeof(Header) + sizeof(uint64_t) * index.size();
+  std::vector<char> compressed(snappy::MaxCompressedLength(block_size));
+  for (uint64_t i = 0; i < block_count && written; ++i) {
+    const uint8_t* block = source->data() + (i << block_size_log2);
+    size_t block_length = size_t(std::min(
+        uint64_t(block_size), header.image_size - (i << block_size_log2)));
+    BlockType type;
+    size_t data_length = 0;
+    if (IsZeroBlock(block, block_length)) {
+      type = BlockType::kZero;
+    } else {
+      snappy::RawCompress(reinterpret_cast<const char*>(block), block_length,
+                          compressed.data(), &data_length);
+      if (data_length < block_length) {
+        type = BlockType::kSnappy;
+        written = fwrite(compressed.data(), 1, data_length, file) ==
+                  data_length;
+      } else {
+        type = BlockType::kStored;
+        data_length = block_length;
+        written = fwrite(block, 1, data_length, file) == data_length;
+      }
+    }
+    index[i] = data_offset | (uint64_t(type) << kIndexTypeShift);
+    data_offset += data_length;
+  }
+  index[block_count] = data_offset;
+  written = written && xe::filesystem::Seek(file, sizeof(Header), SEEK_SET) &&
+            fwrite(index.data(), sizeof(uint64_t), index.size(), file) ==
+                index.size();
+  written = (fclose(file) == 0) && written;
+  if (!written) {
+    XELOGE("Failed to write the compressed disc image {}",
+           xe::path_to_utf8(target_path));
+    return false;
+  }
+
+  XELOGI("Compressed the disc image from {} bytes to {} bytes",
+         header.image_size, data_offset);
+  return true;
+}
+
+CompressedDiscImage::~CompressedDiscImage() {
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    shutting_down_ = true;
+  }
+  readahead_queued_.notify_all();
+  for (const std::unique_ptr<xe::threading::Thread>& thread :
+       readahead_threads_) {
+    xe::threading::Wait(thread.get(), false);
+  }
+}
+
+bool CompressedDiscImage::Read(uint64_t offset, void* buffer, size_t length,
+                               Stream* stream) {
+  if (offset > size_ || length > size_ - offset) {
+    return false;
+  }
+  if (!length) {
+    return true;
+  }
+  uint64_t first_block_index = offset >> block_size_log2_;
+  uint64_t end_block_index =
+      ((offset + length - 1) >> block_size_log2_) + uint64_t(1);
+
+  if (stream) {
+    if (stream->next_offset_.load(std::memory_order_relaxed) == offset) {
+      uint64_t readahead_begin = std::max(
+          end_block_index,
+          stream->readahead_end_.load(std::memory_order_relaxed));
+      uint64_t readahead_end =
+          std::min(end_block_index +
+                       cvars::compressed_disc_image_readahead_blocks,
+                   block_count_);
+      if (readahead_begin < readahead_end && !readahead_threads_.empty()) {
+        QueueReadahead(readahead_begin, readahead_end - readahead_begin);
+        stream->readahead_end_.store(readahead_end, std::memory_order_relaxed);
+      }
+    } else {
+      stream->readahead_end_.store(0, std::memory_order_relaxed);
+    }
+    stream->next_offset_.store(offset + length, std::memory_order_relaxed);
+  }
+
+  auto dest = static_cast<uint8_t*>(buffer);
+  for (uint64_t block_index = first_block_index;
+       block_index < end_block_index; ++block_index) {
+    uint64_t block_offset = block_index << block_size_log2_;
+    size_t copy_offset = size_t(std::max(offset, block_offset) - block_offset);
+    size_t copy_length =
+        size_t(std::min(offset + length, block_offset + block_size()) -
+               block_offset) -
+        copy_offset;
+    switch (GetBlockType(block_index)) {
+      case BlockType::kZero:
+        std::memset(dest, 0, copy_length);
+        break;
+      case BlockType::kStored: {
+        size_t data_size;
+        const uint8_t* data = GetBlockData(block_index, &data_size);
+        if (data_size < copy_offset + copy_length) {
+          return false;
+        }
+        std::memcpy(dest, data + copy_offset, copy_length);
+      } break;
+      case BlockType::kSnappy: {
+        CachedBlock* block = AcquireBlock(block_index);
+        if (!block) {
+          return false;
+        }
+        std::memcpy(dest, block->data.get() + copy_offset, copy_length);
+        ReleaseBlock(block);
+      } break;
+      default:
+        return false;
+    }
+    dest += copy_length;
+  }
+  return true;
+}
+
+void CompressedDiscImage::Prefetch(uint64_t offset, uint64_t length) {
+  if (offset >= size_ || !length) {
+    return;
+  }
+  length = std::min(length, size_ - offset);
+  uint64_t first_block_index = offset >> block_size_log2_;
+  uint64_t end_block_index =
+      ((offset + length - 1) >> block_size_log2_) + uint64_t(1);
+  uint64_t data_begin = index_[first_block_index] & kIndexOffsetMask;
+  uint64_t data_end = index_[end_block_index] & kIndexOffsetMask;
+  if (data_begin < data_end) {
+    mmap_->Prefetch(size_t(data_begin), size_t(data_end - data_begin));
+  }
+}
+
+const uint8_t* CompressedDiscImage::GetBlockData(uint64_t block_index,
+                                                 size_t* size_out) const {
+  uint64_t offset = index_[block_index] & kIndexOffsetMask;
+  *size_out = size_t((index_[block_index + 1] & kIndexOffsetMask) - offset);
+  return mmap_->data() + offset;
+}
+
+bool CompressedDiscImage::DecompressBlock(uint64_t block_index,
+                                          uint8_t* data) const {
+  assert_true(GetBlockType(block_index) == BlockType::kSnappy);
+  size_t expected_size = size_t(std::min(
+      uint64_t(block_size()), size_ - (block_index << block_size_log2_)));
+  size_t compressed_size;
+  auto compressed = reinterpret_cast<const char*>(
+      GetBlockData(block_index, &compressed_size));
+  size_t decompressed_size;
+  if (!snappy::GetUncompressedLength(compressed, compressed_size,
+                                     &decompressed_size) ||
+      decompressed_size != expected_size ||
+      !snappy::RawUncompress(compressed, compressed_size,
+                             reinterpret_cast<char*>(data))) {
+    XELOGE("Compressed disc image block {} is corrupt", block_index);
+    return false;
+  }
+  return true;
+}
+
+CompressedDiscImage::CachedBlock* CompressedDiscImage::AcquireBlock(
+    uint64_t block_index) {
+  std::unique_lock<std::mutex> lock(cache_mutex_);
+  while (true) {
+    auto it = cached_block_map_.find(block_index);
+    if (it != cached_block_map_.end()) {
+      CachedBlock* block = it->second;
+      ++block->users;
+      block->last_use = ++cache_use_counter_;
+      // May be being decompressed by another thread.
+      cache_updated_.wait(lock, [block]() { return block->is_loaded; });
+      if (!block->is_valid) {
+        --block->users;
+        return nullptr;
+      }
+      return block;
+    }
+
+    // Evict the least recently used block not being read.
+    CachedBlock* block = nullptr;
+    for (CachedBlock& cached_block : cached_blocks_) {
+      if (!cached_block.users &&
+          (!block || cached_block.last_use < block->last_use)) {
+        block = &cached_block;
+      }
+    }
+    if (!block) {
+      cache_updated_.wait(lock);
+      continue;
+    }
+    if (block->block_index != UINT64_MAX) {
+      cached_block_map_.erase(block->block_index);
+    }
+    block->block_index = block_index;
+    block->last_use = ++cache_use_counter_;
+    block->users = 1;
+    block->is_loaded = false;
+    block->is_valid = false;
+    cached_block_map_.emplace(block_index, block);
+
+    // Decompressing without the lock so other blocks can be decompressed on
+    // other threads in parallel.
+    lock.unlock();
+    if (!block->data) {
+      block->data = std::make_unique<uint8_t[]>(block_size());
+    }
+    bool is_valid = DecompressBlock(block_index, block->data.get());
+    lock.lock();
+    block->is_loaded = true;
+    block->is_valid = is_valid;
+    if (!is_valid) {
+      // Threads still waiting for it will release it.
+      cached_block_map_.erase(block_index);
+      block->block_index = UINT64_MAX;
+      block->last_use = 0;
+      --block->users;
+    }
+    lock.unlock();
+    cache_updated_.notify_all();
+    return is_valid ? block : nullptr;
+  }
+}
+
+void CompressedDiscImage::ReleaseBlock(CachedBlock* block) {
+  bool is_unused;
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    assert_not_zero(block->users);
+    is_unused = !--block->users;
+  }
+  if (is_unused) {
+    cache_updated_.notify_all();
+  }
+}
+
+void CompressedDiscImage::QueueReadahead(uint64_t first_block_index,
+                                         uint64_t block_count) {
+  bool queued = false;
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    for (uint64_t i = 0; i < block_count; ++i) {
+      uint64_t block_index = first_block_index + i;
+      if (readahead_queue_.size() >= kMaxReadaheadQueueSize) {
+        break;
+      }
+      if (GetBlockType(block_index) != BlockType::kSnappy ||
+          cached_block_map_.find(block_index) != cached_block_map_.end()) {
+        continue;
+      }
+      readahead_queue_.push_back(block_index);
+      queued = true;
+    }
+  }
+  if (queued) {
+    readahead_queued_.notify_all();
+  }
+}
+
+void CompressedDiscImage::ReadaheadThreadMain() {
+  std::unique_lock<std::mutex> lock(cache_mutex_);
+  while (true) {
+    readahead_queued_.wait(lock, [this]() {
+      return shutting_down_ || !readahead_queue_.empty();
+    });
+    if (shutting_down_) {
+      break;
+    }
+    uint64_t block_index = readahead_queue_.front();
+    readahead_queue_.pop_front();
+    if (cached_block_map_.find(block_index) != cached_block_map_.end()) {
+      continue;
+    }
+    lock.unlock();
+    CachedBlock* block = AcquireBlock(block_index);
+    if (block) {
+      ReleaseBlock(block);
+    }
+    lock.lock();
+  }
+}
+
+}  // namespace vfs
+}  // namespace xe
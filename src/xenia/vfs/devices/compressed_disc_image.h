@@ -0,0 +1,157 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_VFS_DEVICES_COMPRESSED_DISC_IMAGE_H_
+#define XENIA_VFS_DEVICES_COMPRESSED_DISC_IMAGE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "xenia/base/mapped_memory.h"
+#include "xenia/base/threading.h"
+
+namespace xe {
+namespace vfs {
+
+// Disc image split into fixed-size blocks compressed independently, for
+// random access without decompressing the whole image (.xcdi, created with
+// xenia-vfs-compress).
+//
+// File layout (little-endian):
+// - Header.
+// - uint64_t index[block_count + 1] - offsets of the data of the blocks in
+//   the file, with the BlockType in the upper bits. The size of the data of a
+//   block is the difference between its offset and the offset of the next
+//   block (the last index element is the end of the data).
+// - Data of the blocks. Blocks consisting only of zeros (the padding of the
+//   discs) have no data.
+//
+// Decompressed blocks are kept in a cache shared by all the readers, and with
+// sequential reads, the next blocks are decompressed ahead of time on
+// readahead threads.
+class CompressedDiscImage {
+ public:
+  static constexpr uint32_t kMagic = 0x49444358;  // 'XCDI'
+  static constexpr uint32_t kVersion = 1;
+  static constexpr uint32_t kDefaultBlockSizeLog2 = 16;
+  static constexpr uint32_t kMinBlockSizeLog2 = 11;
+  static constexpr uint32_t kMaxBlockSizeLog2 = 24;
+
+  struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t block_size_log2;
+    uint32_t reserved;
+    uint64_t image_size;
+  };
+  static_assert(sizeof(Header) == 24);
+
+  enum class BlockType : uint32_t {
+    kZero,
+    kStored,
+    kSnappy,
+  };
+  static constexpr uint32_t kIndexTypeShift = 62;
+  static constexpr uint64_t kIndexOffsetMask =
+      (uint64_t(1) << kIndexTypeShift) - 1;
+
+  // Per-reader state for detecting sequential access. Can be used by
+  // multiple threads, the heuristics just become less precise.
+  class Stream {
+   private:
+    friend class CompressedDiscImage;
+    std::atomic<uint64_t> next_offset_ = {UINT64_MAX};
+    // End of the blocks already queued for readahead.
+    std::atomic<uint64_t> readahead_end_ = {0};
+  };
+
+  static bool IsCompressedDiscImage(const std::filesystem::path& path);
+  static std::unique_ptr<CompressedDiscImage> Open(
+      const std::filesystem::path& path);
+
+  // Compresses a raw disc image. Returns false if failed, with the reason
+  // logged.
+  static bool Compress(const std::filesystem::path& source_path,
+                       const std::filesystem::path& target_path,
+                       uint32_t block_size_log2 = kDefaultBlockSizeLog2);
+
+  CompressedDiscImage(const CompressedDiscImage& image) = delete;
+  CompressedDiscImage& operator=(const CompressedDiscImage& image) = delete;
+  ~CompressedDiscImage();
+
+  uint64_t size() const { return size_; }
+  uint32_t block_size() const { return uint32_t(1) << block_size_log2_; }
+  uint64_t block_count() const { return block_count_; }
+  // Size of the compressed image file.
+  size_t file_size() const { return mmap_->size(); }
+
+  // Thread-safe. The stream may be null if the read is not a part of a
+  // sequential stream. Returns false if the image data is corrupt.
+  bool Read(uint64_t offset, void* buffer, size_t length,
+            Stream* stream = nullptr);
+
+  // Hints that the range of the image is going to be read soon, loading the
+  // compressed data of its blocks from the file asynchronously. Thread-safe.
+  void Prefetch(uint64_t offset, uint64_t length);
+
+ private:
+  struct CachedBlock {
+    std::unique_ptr<uint8_t[]> data;
+    uint64_t block_index = UINT64_MAX;
+    uint64_t last_use = 0;
+    uint32_t users = 0;
+    bool is_loaded = false;
+    bool is_valid = false;
+  };
+
+  CompressedDiscImage() = default;
+
+  BlockType GetBlockType(uint64_t block_index) const {
+    return BlockType(index_[block_index] >> kIndexTypeShift);
+  }
+  const uint8_t* GetBlockData(uint64_t block_index, size_t* size_out) const;
+  bool DecompressBlock(uint64_t block_index, uint8_t* data) const;
+
+  // Returns the cached block with the decompressed data, locked from being
+  // evicted until ReleaseBlock, or null if the block is corrupt.
+  CachedBlock* AcquireBlock(uint64_t block_index);
+  void ReleaseBlock(CachedBlock* block);
+  void QueueReadahead(uint64_t first_block_index, uint64_t block_count);
+  void ReadaheadThreadMain();
+
+  std::unique_ptr<MappedMemory> mmap_;
+  uint64_t size_ = 0;
+  uint32_t block_size_log2_ = 0;
+  uint64_t block_count_ = 0;
+  const uint64_t* index_ = nullptr;
+
+  std::mutex cache_mutex_;
+  // For the blocks being loaded and for the blocks not used anymore.
+  std::condition_variable cache_updated_;
+  std::vector<CachedBlock> cached_blocks_;
+  std::unordered_map<uint64_t, CachedBlock*> cached_block_map_;
+  uint64_t cache_use_counter_ = 0;
+
+  std::condition_variable readahead_queued_;
+  std::deque<uint64_t> readahead_queue_;
+  bool shutting_down_ = false;
+  std::vector<std::unique_ptr<xe::threading::Thread>> readahead_threads_;
+};
+
+}  // namespace vfs
+}  // namespace xe
+
+#endif  // XENIA_VFS_DEVICES_COMPRESSED_DISC_IMAGE_H_
@@ -0,0 +1,187 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/vfs/devices/compressed_disc_image_device.h"
+
+#include <cstring>
+
+#include "xenia/base/literals.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/math.h"
+#include "xenia/vfs/devices/compressed_disc_image_entry.h"
+
+namespace xe {
+namespace vfs {
+
+using namespace xe::literals;
+
+constexpr size_t kXESectorSize = 2_KiB;
+
+CompressedDiscImageDevice::CompressedDiscImageDevice(
+    const std::string_view mount_path, const std::filesystem::path& host_path)
+    : Device(mount_path), name_("GDFX"), host_path_(host_path) {}
+
+CompressedDiscImageDevice::~CompressedDiscImageDevice() = default;
+
+bool CompressedDiscImageDevice::Initialize() {
+  image_ = CompressedDiscImage::Open(host_path_);
+  if (!image_) {
+    return false;
+  }
+  boot_read_recorder_ = std::make_unique<BootReadRecorder>(
+      image_->size(), [this](uint64_t offset, uint64_t length) {
+        image_->Prefetch(offset, length);
+      });
+
+  if (!FindGamePartition()) {
+    XELOGE("Failed to verify compressed disc image header");
+    return false;
+  }
+
+  // Read sector 32 to get FS state.
+  uint8_t fs_sector[kXESectorSize];
+  if (!image_->Read(game_offset_ + (32 * kXESectorSize), fs_sector,
+                    sizeof(fs_sector))) {
+    XELOGE("Failed to read the compressed disc image file system header");
+    return false;
+  }
+  uint64_t root_sector = xe::load<uint32_t>(fs_sector + 20);
+  size_t root_size = xe::load<uint32_t>(fs_sector + 24);
+  if (root_size < 13 || root_size > 32_MiB) {
+    XELOGE("Compressed disc image has a damaged root directory");
+    return false;
+  }
+  std::vector<uint8_t> root_buffer(root_size);
+  if (!image_->Read(game_offset_ + (root_sector * kXESectorSize),
+                    root_buffer.data(), root_size)) {
+    XELOGE("Failed to read the compressed disc image root directory");
+    return false;
+  }
+
+  auto root_entry =
+      new CompressedDiscImageEntry(this, nullptr, "", image_.get());
+  root_entry->attributes_ = kFileAttributeDirectory;
+  root_entry_ = std::unique_ptr<Entry>(root_entry);
+  if (!ReadEntry(root_buffer, 0, root_entry)) {
+    XELOGE("Failed to read all GDFX entries");
+    return false;
+  }
+
+  return true;
+}
+
+void CompressedDiscImageDevice::Dump(StringBuffer* string_buffer) {
+  auto global_lock = global_critical_region_.Acquire();
+  root_entry_->Dump(string_buffer, 0);
+}
+
+Entry* CompressedDiscImageDevice::ResolvePath(const std::string_view path) {
+  // The filesystem will have stripped our prefix off already, so the path will
+  // be in the form:
+  // some\PATH.foo
+  XELOGFS("CompressedDiscImageDevice::ResolvePath({})", path);
+  return root_entry_->ResolvePath(path);
+}
+
+bool CompressedDiscImageDevice::FindGamePartition() {
+  // Find sector 32 of the game partition - try at a few points, like in
+  // DiscImageDevice.
+  static const size_t likely_offsets[] = {
+      0x00000000, 0x0000FB20, 0x00020600, 0x02080000, 0x0FD90000,
+  };
+  for (size_t n = 0; n < xe::countof(likely_offsets); n++) {
+    uint64_t magic_offset = likely_offsets[n] + (32 * kXESectorSize);
+    char magic[20];
+    if (magic_offset + sizeof(magic) <= image_->size() &&
+        image_->Read(magic_offset, magic, sizeof(magic)) &&
+        std::memcmp(magic, "MICROSOFT*XBOX*MEDIA", sizeof(magic)) == 0) {
+      game_offset_ = likely_offsets[n];
+      return true;
+    }
+  }
+  return false;
+}
+
+bool CompressedDiscImageDevice::ReadEntry(const std::vector<uint8_t>& buffer,
+                                          uint16_t entry_ordinal,
+                                          CompressedDiscImageEntry* parent) {
+  size_t entry_offset = size_t(entry_ordinal) * 4;
+  if (entry_offset + 14 > buffer.size()) {
+    return false;
+  }
+  const uint8_t* p = buffer.data() + entry_offset;
+
+  uint16_t node_l = xe::load<uint16_t>(p + 0);
+  uint16_t node_r = xe::load<uint16_t>(p + 2);
+  uint64_t sector = xe::load<uint32_t>(p + 4);
+  size_t length = xe::load<uint32_t>(p + 8);
+  uint8_t attributes = xe::load<uint8_t>(p + 12);
+  uint8_t name_length = xe::load<uint8_t>(p + 13);
+  auto name_buffer = reinterpret_cast<const char*>(p + 14);
+  if (entry_offset + 14 + name_length > buffer.size()) {
+    return false;
+  }
+
+  if (node_l && !ReadEntry(buffer, node_l, parent)) {
+    return false;
+  }
+
+  auto name = std::string(name_buffer, name_length);
+
+  auto entry =
+      CompressedDiscImageEntry::Create(this, parent, name, image_.get());
+  entry->attributes_ = attributes | kFileAttributeReadOnly;
+  entry->size_ = length;
+  entry->allocation_size_ = xe::round_up(length, bytes_per_sector());
+
+  // Set to January 1, 1970 (UTC) in 100-nanosecond intervals
+  entry->create_timestamp_ = 10000 * 11644473600000LL;
+  entry->access_timestamp_ = 10000 * 11644473600000LL;
+  entry->write_timestamp_ = 10000 * 11644473600000LL;
+
+  uint64_t data_offset = game_offset_ + (sector * kXESectorSize);
+  if (attributes & kFileAttributeDirectory) {
+    // Folder.
+    entry->data_offset_ = 0;
+    entry->data_size_ = 0;
+    if (length) {
+      // Not a leaf - read in children.
+      if (length > 32_MiB) {
+        return false;
+      }
+      std::vector<uint8_t> folder_buffer(length);
+      if (!image_->Read(data_offset, folder_buffer.data(), length) ||
+          !ReadEntry(folder_buffer, 0, entry.get())) {
+        return false;
+      }
+    }
+  } else {
+    // File.
+    if (data_offset > image_->size() ||
+        length > image_->size() - data_offset) {
+      // Out of bounds.
+      return false;
+    }
+    entry->data_offset_ = data_offset;
+    entry->data_size_ = length;
+  }
+
+  // Add to parent.
+  parent->children_.emplace_back(std::move(entry));
+
+  // Read next file in the list.
+  if (node_r && !ReadEntry(buffer, node_r, parent)) {
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace vfs
+}  // namespace xe
@@ -0,0 +1,75 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_VFS_DEVICES_COMPRESSED_DISC_IMAGE_DEVICE_H_
+#define XENIA_VFS_DEVICES_COMPRESSED_DISC_IMAGE_DEVICE_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "xenia/vfs/device.h"
+#include "xenia/vfs/devices/compressed_disc_image.h"
+#include "xenia/vfs/read_prefetcher.h"
+
+namespace xe {
+namespace vfs {
+
+class CompressedDiscImageEntry;
+
+// GDFX disc image in the CompressedDiscImage format.
+class CompressedDiscImageDevice : public Device {
+ public:
+  CompressedDiscImageDevice(const std::string_view mount_path,
+                            const std::filesystem::path& host_path);
+  ~CompressedDiscImageDevice() override;
+
+  bool Initialize() override;
+  void Dump(StringBuffer* string_buffer) override;
+  Entry* ResolvePath(const std::string_view path) override;
+
+  const std::string& name() const override { return name_; }
+  uint32_t attributes() const override { return 0; }
+  uint32_t component_name_max_length() const override { return 255; }
+
+  uint32_t total_allocation_units() const override {
+    return uint32_t(image_->size() / sectors_per_allocation_unit() /
+                    bytes_per_sector());
+  }
+  uint32_t available_allocation_units() const override { return 0; }
+  uint32_t sectors_per_allocation_unit() const override { return 1; }
+  uint32_t bytes_per_sector() const override { return 0x200; }
+
+  void BeginBootReadRecording(
+      const std::filesystem::path& record_path) override {
+    boot_read_recorder_->Begin(record_path);
+  }
+  // Offsets are in the decompressed image.
+  BootReadRecorder* boot_read_recorder() const {
+    return boot_read_recorder_.get();
+  }
+
+ private:
+  bool FindGamePartition();
+  bool ReadEntry(const std::vector<uint8_t>& buffer, uint16_t entry_ordinal,
+                 CompressedDiscImageEntry* parent);
+
+  std::string name_;
+  std::filesystem::path host_path_;
+  std::unique_ptr<Entry> root_entry_;
+  std::unique_ptr<CompressedDiscImage> image_;
+  // Must be destroyed before the image, as it may be prefetching from it.
+  std::unique_ptr<BootReadRecorder> boot_read_recorder_;
+  uint64_t game_offset_ = 0;
+};
+
+}  // namespace vfs
+}  // namespace xe
+
+#endif  // XENIA_VFS_DEVICES_COMPRESSED_DISC_IMAGE_DEVICE_H_
@@ -0,0 +1,69 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/vfs/devices/compressed_disc_image_file.h"
+
+#include <algorithm>
+
+#include "xenia/vfs/devices/compressed_disc_image_device.h"
+#include "xenia/vfs/devices/compressed_disc_image_entry.h"
+
+namespace xe {
+namespace vfs {
+
+CompressedDiscImageFile::CompressedDiscImageFile(
+    uint32_t file_access, CompressedDiscImageEntry* entry)
+    : File(file_access, entry), entry_(entry) {}
+
+CompressedDiscImageFile::~CompressedDiscImageFile() = default;
+
+void CompressedDiscImageFile::Destroy() { delete this; }
+
+X_STATUS CompressedDiscImageFile::ReadSync(void* buffer, size_t buffer_length,
+                                           size_t byte_offset,
+                                           size_t* out_bytes_read) {
+  ReadSegment segment = {buffer, buffer_length};
+  return ReadScatterSync(&segment, 1, byte_offset, out_bytes_read);
+}
+
+X_STATUS CompressedDiscImageFile::ReadScatterSync(const ReadSegment* segments,
+                                                  size_t segment_count,
+                                                  size_t byte_offset,
+                                                  size_t* out_bytes_read) {
+  if (byte_offset >= entry_->size()) {
+    return X_STATUS_END_OF_FILE;
+  }
+  size_t buffer_length = 0;
+  for (size_t i = 0; i < segment_count; ++i) {
+    buffer_length += segments[i].length;
+  }
+  size_t real_length =
+      std::min(buffer_length, entry_->data_size() - byte_offset);
+  static_cast<CompressedDiscImageDevice*>(entry_->device())
+      ->boot_read_recorder()
+      ->OnRead(entry_->data_offset() + byte_offset, real_length);
+  // The stream keeps the last decompressed block, so the segments within one
+  // block don't decompress it again.
+  uint64_t offset = entry_->data_offset() + byte_offset;
+  size_t remaining_length = real_length;
+  for (size_t i = 0; remaining_length; ++i) {
+    size_t copy_length = std::min(segments[i].length, remaining_length);
+    if (!entry_->image()->Read(offset, segments[i].buffer, copy_length,
+                               &stream_)) {
+      return X_STATUS_DATA_ERROR;
+    }
+    offset += copy_length;
+    remaining_length -= copy_length;
+  }
+  *out_bytes_read = real_length;
+  return X_STATUS_SUCCESS;
+}
+
+}  // namespace vfs
+}  // namespace xe
@@ -33,6 +33,10 @@ bool DiscImageDevice::Initialize() {
     XELOGE("Disc image could not be mapped");
     return false;
   }
+  boot_read_recorder_ = std::make_unique<BootReadRecorder>(
+      mmap_->size(), [this](uint64_t offset, uint64_t length) {
+        mmap_->Prefetch(size_t(offset), size_t(length));
+      });
 
   ParseState state = {0};
   state.ptr = mmap_->data();
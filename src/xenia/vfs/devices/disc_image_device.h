@@ -15,6 +15,7 @@
 
 #include "xenia/base/mapped_memory.h"
 #include "xenia/vfs/device.h"
+#include "xenia/vfs/read_prefetcher.h"
 
 namespace xe {
 namespace vfs {
@@ -43,6 +44,15 @@ class DiscImageDevice : public Device {
   uint32_t sectors_per_allocation_unit() const override { return 1; }
   uint32_t bytes_per_sector() const override { return 0x200; }
 
+  void BeginBootReadRecording(
+      const std::filesystem::path& record_path) override {
+    boot_read_recorder_->Begin(record_path);
+  }
+  // Offsets are in the image file.
+  BootReadRecorder* boot_read_recorder() const {
+    return boot_read_recorder_.get();
+  }
+
  private:
   enum class Error {
     kSuccess = 0,
@@ -56,6 +66,8 @@ class DiscImageDevice : public Device {
   std::filesystem::path host_path_;
   std::unique_ptr<Entry> root_entry_;
   std::unique_ptr<MappedMemory> mmap_;
+  // Must be destroyed before the mapping, as it may be prefetching from it.
+  std::unique_ptr<BootReadRecorder> boot_read_recorder_;
 
   typedef struct {
     uint8_t* ptr;
@@ -11,13 +11,16 @@
 
 #include <algorithm>
 
+#include "xenia/vfs/devices/disc_image_device.h"
 #include "xenia/vfs/devices/disc_image_entry.h"
 
 namespace xe {
 namespace vfs {
 
 DiscImageFile::DiscImageFile(uint32_t file_access, DiscImageEntry* entry)
-    : File(file_access, entry), entry_(entry) {}
+    : File(file_access, entry),
+      entry_(entry),
+      read_tracker_(entry->data_size()) {}
 
 DiscImageFile::~DiscImageFile() = default;
 
@@ -25,13 +28,41 @@ void DiscImageFile::Destroy() { delete this; }
 
 X_STATUS DiscImageFile::ReadSync(void* buffer, size_t buffer_length,
                                  size_t byte_offset, size_t* out_bytes_read) {
+  ReadSegment segment = {buffer, buffer_length};
+  return ReadScatterSync(&segment, 1, byte_offset, out_bytes_read);
+}
+
+X_STATUS DiscImageFile::ReadScatterSync(const ReadSegment* segments,
+                                        size_t segment_count,
+                                        size_t byte_offset,
+                                        size_t* out_bytes_read) {
   if (byte_offset >= entry_->size()) {
     return X_STATUS_END_OF_FILE;
   }
+  size_t buffer_length = 0;
+  for (size_t i = 0; i < segment_count; ++i) {
+    buffer_length += segments[i].length;
+  }
   size_t real_offset = entry_->data_offset() + byte_offset;
   size_t real_length =
       std::min(buffer_length, entry_->data_size() - byte_offset);
-  std::memcpy(buffer, entry_->mmap()->data() + real_offset, real_length);
+  uint64_t prefetch_offset, prefetch_length;
+  if (read_tracker_.OnRead(byte_offset, real_length, &prefetch_offset,
+                           &prefetch_length)) {
+    entry_->mmap()->Prefetch(entry_->data_offset() + size_t(prefetch_offset),
+                             size_t(prefetch_length));
+  }
+  static_cast<DiscImageDevice*>(entry_->device())
+      ->boot_read_recorder()
+      ->OnRead(real_offset, real_length);
+  const uint8_t* src = entry_->mmap()->data() + real_offset;
+  size_t remaining_length = real_length;
+  for (size_t i = 0; remaining_length; ++i) {
+    size_t copy_length = std::min(segments[i].length, remaining_length);
+    std::memcpy(segments[i].buffer, src, copy_length);
+    src += copy_length;
+    remaining_length -= copy_length;
+  }
   *out_bytes_read = real_length;
   return X_STATUS_SUCCESS;
 }
@@ -11,6 +11,7 @@
 #define XENIA_VFS_DEVICES_DISC_IMAGE_FILE_H_
 
 #include "xenia/vfs/file.h"
+#include "xenia/vfs/read_prefetcher.h"
 
 namespace xe {
 namespace vfs {
@@ -26,6 +27,8 @@ class DiscImageFile : public File {
 
   X_STATUS ReadSync(void* buffer, size_t buffer_length, size_t byte_offset,
                     size_t* out_bytes_read) override;
+  X_STATUS ReadScatterSync(const ReadSegment* segments, size_t segment_count,
+                           size_t byte_offset, size_t* out_bytes_read) override;
   X_STATUS WriteSync(const void* buffer, size_t buffer_length,
                      size_t byte_offset, size_t* out_bytes_written) override {
     return X_STATUS_ACCESS_DENIED;
@@ -34,6 +37,7 @@ class DiscImageFile : public File {
 
  private:
   DiscImageEntry* entry_;
+  SequentialReadTracker read_tracker_;
 };
 
 }  // namespace vfs
@@ -9,6 +9,10 @@
 
 #include "xenia/vfs/devices/host_path_entry.h"
 
+#include <algorithm>
+#include <cstring>
+
+#include "xenia/base/cvar.h"
 #include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/mapped_memory.h"
@@ -17,6 +21,12 @@
 #include "xenia/vfs/device.h"
 #include "xenia/vfs/devices/host_path_file.h"
 
+DEFINE_uint32(host_write_buffer_kb, 64,
+              "Size of the buffer for combining small sequential writes to "
+              "files in host directories into larger ones, in KB, 0 to write "
+              "directly. Files opened for write-through are never buffered.",
+              "Storage");
+
 namespace xe {
 namespace vfs {
 
@@ -70,6 +80,11 @@ X_STATUS HostPathEntry::Open(uint32_t desired_access, File** out_file) {
 std::unique_ptr<MappedMemory> HostPathEntry::OpenMapped(MappedMemory::Mode mode,
                                                         size_t offset,
                                                         size_t length) {
+  FlushWriteBuffer(offset, length ? length : SIZE_MAX);
+  if (mode != MappedMemory::Mode::kRead) {
+    // May be extended and written.
+    MarkInfoOutdated();
+  }
   return MappedMemory::Open(host_path_, mode, offset, length);
 }
 
@@ -109,11 +124,75 @@ bool HostPathEntry::DeleteEntryInternal(Entry* entry) {
   }
 }
 
+bool HostPathEntry::BufferWrite(xe::filesystem::FileHandle* file_handle,
+                                const void* buffer, size_t buffer_length,
+                                size_t byte_offset) {
+  size_t capacity = size_t(cvars::host_write_buffer_kb) << 10;
+  std::lock_guard<std::mutex> lock(write_buffer_mutex_);
+  if (write_buffer_file_handle_) {
+    // Only append to the buffered data, so a single write flushes all of it,
+    // and the order relative to the other writes doesn't matter.
+    if (write_buffer_file_handle_ == file_handle &&
+        byte_offset == write_buffer_offset_ + write_buffer_.size() &&
+        write_buffer_.size() + buffer_length <= capacity) {
+      write_buffer_.insert(write_buffer_.end(),
+                           static_cast<const uint8_t*>(buffer),
+                           static_cast<const uint8_t*>(buffer) + buffer_length);
+      return true;
+    }
+    FlushWriteBufferLocked();
+  }
+  // Writes as large as the buffer gain nothing from buffering.
+  if (buffer_length >= capacity) {
+    return false;
+  }
+  write_buffer_file_handle_ = file_handle;
+  write_buffer_offset_ = byte_offset;
+  write_buffer_.reserve(capacity);
+  write_buffer_.insert(write_buffer_.end(),
+                       static_cast<const uint8_t*>(buffer),
+                       static_cast<const uint8_t*>(buffer) + buffer_length);
+  return true;
+}
+
+bool HostPathEntry::FlushWriteBuffer(size_t byte_offset, size_t length) {
+  std::lock_guard<std::mutex> lock(write_buffer_mutex_);
+  if (!write_buffer_file_handle_ ||
+      byte_offset >= write_buffer_offset_ + write_buffer_.size() ||
+      (write_buffer_offset_ > byte_offset &&
+       write_buffer_offset_ - byte_offset >= length)) {
+    return true;
+  }
+  return FlushWriteBufferLocked();
+}
+
+bool HostPathEntry::FlushWriteBufferLocked() {
+  size_t bytes_written;
+  bool written = write_buffer_file_handle_->Write(
+      write_buffer_offset_, write_buffer_.data(), write_buffer_.size(),
+      &bytes_written);
+  if (!written) {
+    XELOGE("Failed to write the buffered data to {}",
+           xe::path_to_utf8(host_path_));
+  }
+  write_buffer_file_handle_ = nullptr;
+  write_buffer_.clear();
+  MarkInfoOutdated();
+  return written;
+}
+
 void HostPathEntry::update() {
+  // Include the buffered writes in the size.
+  FlushWriteBuffer();
+  if (!info_outdated_.exchange(false, std::memory_order_relaxed)) {
+    return;
+  }
   xe::filesystem::FileInfo file_info;
   if (!xe::filesystem::GetInfo(host_path_, &file_info)) {
     return;
   }
+  access_timestamp_ = file_info.access_timestamp;
+  write_timestamp_ = file_info.write_timestamp;
   if (file_info.type == xe::filesystem::FileInfo::Type::kFile) {
     size_ = file_info.total_size;
     allocation_size_ =
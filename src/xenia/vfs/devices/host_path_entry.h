@@ -10,7 +10,10 @@
 #ifndef XENIA_VFS_DEVICES_HOST_PATH_ENTRY_H_
 #define XENIA_VFS_DEVICES_HOST_PATH_ENTRY_H_
 
+#include <atomic>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "xenia/base/filesystem.h"
 #include "xenia/vfs/entry.h"
@@ -40,6 +43,25 @@ class HostPathEntry : public Entry {
                                            size_t length) override;
   void update() override;
 
+  // Called when the file is modified through the entry, so the next update
+  // queries the information of the host file again.
+  void MarkInfoOutdated() {
+    info_outdated_.store(true, std::memory_order_relaxed);
+  }
+
+  // Small writes through the files opened from the entry may be buffered, and
+  // written to the host file later as one larger write. The buffer is shared by
+  // all files of the entry so the buffered data is flushed before any of them
+  // accesses the overlapping part of the host file.
+
+  // Buffers a write to be done through the file handle, returning false if it
+  // can't be buffered and must be written directly after this call.
+  bool BufferWrite(xe::filesystem::FileHandle* file_handle, const void* buffer,
+                   size_t buffer_length, size_t byte_offset);
+  // Writes the buffered data overlapping the range to the host file, returning
+  // false if that has failed.
+  bool FlushWriteBuffer(size_t byte_offset = 0, size_t length = SIZE_MAX);
+
  private:
   friend class HostPathDevice;
 
@@ -47,7 +69,20 @@ class HostPathEntry : public Entry {
                                              uint32_t attributes) override;
   bool DeleteEntryInternal(Entry* entry) override;
 
+  // Requires the write buffer lock, and data to be buffered.
+  bool FlushWriteBufferLocked();
+
   std::filesystem::path host_path_;
+  // The information is taken from the host when the entry is created, and only
+  // needs to be queried again after the file is modified.
+  std::atomic<bool> info_outdated_ = {false};
+
+  std::mutex write_buffer_mutex_;
+  // The handle of the file the buffered data is written through, null if
+  // nothing is buffered.
+  xe::filesystem::FileHandle* write_buffer_file_handle_ = nullptr;
+  size_t write_buffer_offset_ = 0;
+  std::vector<uint8_t> write_buffer_;
 };
 
 }  // namespace vfs
@@ -19,10 +19,17 @@ HostPathFile::HostPathFile(
     std::unique_ptr<xe::filesystem::FileHandle> file_handle)
     : File(file_access, entry), file_handle_(std::move(file_handle)) {}
 
-HostPathFile::~HostPathFile() = default;
+HostPathFile::~HostPathFile() {
+  // The buffered data may be written through this file's handle.
+  host_path_entry()->FlushWriteBuffer();
+}
 
 void HostPathFile::Destroy() { delete this; }
 
+HostPathEntry* HostPathFile::host_path_entry() const {
+  return static_cast<HostPathEntry*>(entry_);
+}
+
 X_STATUS HostPathFile::ReadSync(void* buffer, size_t buffer_length,
                                 size_t byte_offset, size_t* out_bytes_read) {
   if (!(file_access_ &
@@ -30,6 +37,7 @@ X_STATUS HostPathFile::ReadSync(void* buffer, size_t buffer_length,
     return X_STATUS_ACCESS_DENIED;
   }
 
+  host_path_entry()->FlushWriteBuffer(byte_offset, buffer_length);
   if (file_handle_->Read(byte_offset, buffer, buffer_length, out_bytes_read)) {
     return X_STATUS_SUCCESS;
   } else {
@@ -37,6 +45,28 @@ X_STATUS HostPathFile::ReadSync(void* buffer, size_t buffer_length,
   }
 }
 
+X_STATUS HostPathFile::ReadScatterSync(const ReadSegment* segments,
+                                       size_t segment_count,
+                                       size_t byte_offset,
+                                       size_t* out_bytes_read) {
+  if (!(file_access_ &
+        (FileAccess::kGenericRead | FileAccess::kFileReadData))) {
+    return X_STATUS_ACCESS_DENIED;
+  }
+
+  size_t length = 0;
+  for (size_t i = 0; i < segment_count; ++i) {
+    length += segments[i].length;
+  }
+  host_path_entry()->FlushWriteBuffer(byte_offset, length);
+  if (file_handle_->ReadVectored(byte_offset, segments, segment_count,
+                                 out_bytes_read)) {
+    return X_STATUS_SUCCESS;
+  } else {
+    return X_STATUS_END_OF_FILE;
+  }
+}
+
 X_STATUS HostPathFile::WriteSync(const void* buffer, size_t buffer_length,
                                  size_t byte_offset,
                                  size_t* out_bytes_written) {
@@ -45,8 +75,17 @@ X_STATUS HostPathFile::WriteSync(const void* buffer, size_t buffer_length,
     return X_STATUS_ACCESS_DENIED;
   }
 
+  if (is_write_through()) {
+    host_path_entry()->FlushWriteBuffer(byte_offset, buffer_length);
+  } else if (host_path_entry()->BufferWrite(file_handle_.get(), buffer,
+                                            buffer_length, byte_offset)) {
+    *out_bytes_written = buffer_length;
+    return X_STATUS_SUCCESS;
+  }
+
   if (file_handle_->Write(byte_offset, buffer, buffer_length,
                           out_bytes_written)) {
+    host_path_entry()->MarkInfoOutdated();
     return X_STATUS_SUCCESS;
   } else {
     return X_STATUS_END_OF_FILE;
@@ -59,12 +98,22 @@ X_STATUS HostPathFile::SetLength(size_t length) {
     return X_STATUS_ACCESS_DENIED;
   }
 
+  host_path_entry()->FlushWriteBuffer();
   if (file_handle_->SetLength(length)) {
+    host_path_entry()->MarkInfoOutdated();
     return X_STATUS_SUCCESS;
   } else {
     return X_STATUS_END_OF_FILE;
   }
 }
 
+X_STATUS HostPathFile::Flush() {
+  if (!host_path_entry()->FlushWriteBuffer()) {
+    return X_STATUS_UNSUCCESSFUL;
+  }
+  file_handle_->Flush();
+  return X_STATUS_SUCCESS;
+}
+
 }  // namespace vfs
 }  // namespace xe
@@ -30,11 +30,16 @@ class HostPathFile : public File {
 
   X_STATUS ReadSync(void* buffer, size_t buffer_length, size_t byte_offset,
                     size_t* out_bytes_read) override;
+  X_STATUS ReadScatterSync(const ReadSegment* segments, size_t segment_count,
+                           size_t byte_offset, size_t* out_bytes_read) override;
   X_STATUS WriteSync(const void* buffer, size_t buffer_length,
                      size_t byte_offset, size_t* out_bytes_written) override;
   X_STATUS SetLength(size_t length) override;
+  X_STATUS Flush() override;
 
  private:
+  HostPathEntry* host_path_entry() const;
+
   std::unique_ptr<xe::filesystem::FileHandle> file_handle_;
 };
 
@@ -32,7 +32,11 @@ StfsContainerDevice::StfsContainerDevice(const std::string_view mount_path,
       blocks_per_hash_table_(1),
       block_step{0, 0} {}
 
-StfsContainerDevice::~StfsContainerDevice() { CloseFiles(); }
+StfsContainerDevice::~StfsContainerDevice() {
+  // The recorder may be prefetching from the files.
+  boot_read_recorder_.reset();
+  CloseFiles();
+}
 
 bool StfsContainerDevice::Initialize() {
   // Resolve a valid STFS file if a directory is given.
@@ -55,6 +59,16 @@ bool StfsContainerDevice::Initialize() {
     XELOGE("Failed to open STFS container: {}", open_result);
     return false;
   }
+  boot_read_recorder_ = std::make_unique<BootReadRecorder>(
+      files_total_size_, [this](uint64_t offset, uint64_t length) {
+        auto file = files_.find(size_t(offset >> kBootReadFileIndexShift));
+        if (file != files_.end()) {
+          xe::filesystem::PrefetchStdioFile(
+              file->second,
+              offset & ((uint64_t(1) << kBootReadFileIndexShift) - 1),
+              length);
+        }
+      });
 
   switch (header_.metadata.volume_type) {
     case XContentVolumeType::kStfs:
@@ -430,7 +444,8 @@ StfsContainerDevice::Error StfsContainerDevice::ReadEntrySVOD(
         block_index++;
         remaining_size -= BLOCK_SIZE;
 
-        if (offset - last_offset == 0x800) {
+        if (offset - last_offset == 0x800 &&
+            entry->block_list_[last_record].file == file_index) {
           // Consecutive, so append to last entry.
           entry->block_list_[last_record].length += BLOCK_SIZE;
           last_offset = offset;
@@ -441,6 +456,7 @@ StfsContainerDevice::Error StfsContainerDevice::ReadEntrySVOD(
         last_record = entry->block_list_.size() - 1;
         last_offset = offset;
       }
+      entry->BuildBlockRecordIndex();
     }
   }
 
@@ -582,18 +598,30 @@ StfsContainerDevice::Error StfsContainerDevice::ReadSTFS() {
 
       // Fill in all block records.
       // It's easier to do this now and just look them up later, at the cost
-      // of some memory. Nasty chain walk.
-      // TODO(benvanik): optimize if flags.contiguous is set.
+      // of some memory. Nasty chain walk, unless the blocks of the file are
+      // consecutive - in this case, the hash tables (each covering 0xAA
+      // blocks, and needing a read from the host file) don't have to be
+      // accessed to follow the chain.
       if (entry->attributes() & X_FILE_ATTRIBUTE_NORMAL) {
+        bool blocks_contiguous = dir_entry.flags.contiguous != 0;
         uint32_t block_index = dir_entry.start_block_number();
         size_t remaining_size = dir_entry.length;
+        entry->block_list_.reserve(
+            (size_t(dir_entry.length) + kBlockSize - 1) / kBlockSize);
         while (remaining_size && block_index != kEndOfChain) {
           size_t block_size =
               std::min(static_cast<size_t>(kBlockSize), remaining_size);
           size_t offset = BlockToOffsetSTFS(block_index);
           entry->block_list_.push_back({0, offset, block_size});
           remaining_size -= block_size;
+          if (blocks_contiguous) {
+            ++block_index;
+            continue;
+          }
           auto block_hash = GetBlockHash(block_index);
+          if (!block_hash) {
+            break;
+          }
           block_index = block_hash->level0_next_block();
         }
 
@@ -617,6 +645,8 @@ StfsContainerDevice::Error StfsContainerDevice::ReadSTFS() {
               dir_entry.allocated_data_blocks());
           assert_always();
         }
+
+        entry->BuildBlockRecordIndex();
       }
 
       parent_entry->children_.emplace_back(std::move(entry));
@@ -706,7 +736,8 @@ const StfsHashEntry* StfsContainerDevice::GetBlockHash(uint32_t block_index) {
       descriptor.flags.bits.root_active_index ? kBlockSize : 0;
 
   auto hash_offset_lv0 = BlockToHashBlockOffsetSTFS(block_index, 0);
-  if (!cached_hash_tables_.count(hash_offset_lv0)) {
+  auto table_lv0_it = cached_hash_tables_.find(hash_offset_lv0);
+  if (table_lv0_it == cached_hash_tables_.end()) {
     // If this is read_only_format then it doesn't contain secondary blocks, no
     // need to check upper hash levels
     if (descriptor.flags.bits.read_only_format) {
@@ -775,11 +806,12 @@ const StfsHashEntry* StfsContainerDevice::GetBlockHash(uint32_t block_index) {
              hash_offset_lv0 + secondary_table_offset);
       return nullptr;
     }
-    cached_hash_tables_[hash_offset_lv0] = table_lv0;
+    table_lv0_it =
+        cached_hash_tables_.emplace(hash_offset_lv0, table_lv0).first;
   }
 
   auto record = block_index % kBlocksPerHashLevel[0];
-  auto record_data = &cached_hash_tables_[hash_offset_lv0].entries[record];
+  auto record_data = &table_lv0_it->second.entries[record];
 
   return record_data;
 }
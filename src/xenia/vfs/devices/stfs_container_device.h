@@ -20,6 +20,7 @@
 #include "xenia/kernel/util/xex2_info.h"
 #include "xenia/vfs/device.h"
 #include "xenia/vfs/devices/stfs_xbox.h"
+#include "xenia/vfs/read_prefetcher.h"
 
 namespace xe {
 namespace vfs {
@@ -31,6 +32,9 @@ class StfsContainerEntry;
 class StfsContainerDevice : public Device {
  public:
   const static uint32_t kBlockSize = 0x1000;
+  // Offsets for the BootReadRecorder are the offsets in the data files, with
+  // the file index in the upper bits.
+  const static uint32_t kBootReadFileIndexShift = 40;
 
   StfsContainerDevice(const std::string_view mount_path,
                       const std::filesystem::path& host_path);
@@ -81,6 +85,14 @@ class StfsContainerDevice : public Device {
     return files_total_size_ - sizeof(StfsHeader);
   }
 
+  void BeginBootReadRecording(
+      const std::filesystem::path& record_path) override {
+    boot_read_recorder_->Begin(record_path);
+  }
+  BootReadRecorder* boot_read_recorder() const {
+    return boot_read_recorder_.get();
+  }
+
  private:
   const uint32_t kBlocksPerHashLevel[3] = {170, 28900, 4913000};
   const uint32_t kEndOfChain = 0xFFFFFF;
@@ -130,6 +142,7 @@ class StfsContainerDevice : public Device {
 
   std::map<size_t, FILE*> files_;
   size_t files_total_size_;
+  std::unique_ptr<BootReadRecorder> boot_read_recorder_;
 
   size_t svod_base_offset_;
 
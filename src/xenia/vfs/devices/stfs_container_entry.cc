@@ -11,6 +11,7 @@
 #include "xenia/base/math.h"
 #include "xenia/vfs/devices/stfs_container_file.h"
 
+#include <algorithm>
 #include <map>
 
 namespace xe {
@@ -37,6 +38,39 @@ std::unique_ptr<StfsContainerEntry> StfsContainerEntry::Create(
   return std::move(entry);
 }
 
+size_t StfsContainerEntry::FindBlockRecord(size_t offset) const {
+  // The first record ending after the offset.
+  return size_t(std::upper_bound(block_record_offsets_.cbegin() + 1,
+                                 block_record_offsets_.cend(), offset) -
+                (block_record_offsets_.cbegin() + 1));
+}
+
+void StfsContainerEntry::BuildBlockRecordIndex() {
+  size_t merged_count = 0;
+  for (const BlockRecord& record : block_list_) {
+    if (merged_count) {
+      BlockRecord& last_record = block_list_[merged_count - 1];
+      if (last_record.file == record.file &&
+          last_record.offset + last_record.length == record.offset) {
+        last_record.length += record.length;
+        continue;
+      }
+    }
+    block_list_[merged_count++] = record;
+  }
+  block_list_.resize(merged_count);
+  block_list_.shrink_to_fit();
+
+  block_record_offsets_.clear();
+  block_record_offsets_.reserve(block_list_.size() + 1);
+  size_t offset = 0;
+  block_record_offsets_.push_back(offset);
+  for (const BlockRecord& record : block_list_) {
+    offset += record.length;
+    block_record_offsets_.push_back(offset);
+  }
+}
+
 X_STATUS StfsContainerEntry::Open(uint32_t desired_access, File** out_file) {
   *out_file = new StfsContainerFile(desired_access, this);
   return X_STATUS_SUCCESS;
@@ -41,21 +41,36 @@ class StfsContainerEntry : public Entry {
 
   X_STATUS Open(uint32_t desired_access, File** out_file) override;
 
+  // Extent of the data of the file in one of the host files.
   struct BlockRecord {
     size_t file;
     size_t offset;
     size_t length;
   };
   const std::vector<BlockRecord>& block_list() const { return block_list_; }
+  // Offset of the block record in the data of the entry.
+  size_t block_record_offset(size_t record_index) const {
+    return block_record_offsets_[record_index];
+  }
+  // Returns the index of the block record containing the offset in the data
+  // of the entry, or block_list().size() if it's beyond the end.
+  size_t FindBlockRecord(size_t offset) const;
 
  private:
   friend class StfsContainerDevice;
 
+  // Merges the block records contiguous in the host files, and builds the
+  // index for looking them up by the offset. Must be called by the device
+  // once all the block records have been added.
+  void BuildBlockRecordIndex();
+
   MultiFileHandles* files_;
   size_t data_offset_;
   size_t data_size_;
   size_t block_;
   std::vector<BlockRecord> block_list_;
+  // Offsets of the records in the data, plus the total size at the end.
+  std::vector<size_t> block_record_offsets_ = {0};
 };
 
 }  // namespace vfs
@@ -13,6 +13,7 @@
 #include <cmath>
 
 #include "xenia/base/math.h"
+#include "xenia/vfs/devices/stfs_container_device.h"
 #include "xenia/vfs/devices/stfs_container_entry.h"
 
 namespace xe {
@@ -20,7 +21,7 @@ namespace vfs {
 
 StfsContainerFile::StfsContainerFile(uint32_t file_access,
                                      StfsContainerEntry* entry)
-    : File(file_access, entry), entry_(entry) {}
+    : File(file_access, entry), entry_(entry), read_tracker_(entry->size()) {}
 
 StfsContainerFile::~StfsContainerFile() = default;
 
@@ -29,44 +30,95 @@ void StfsContainerFile::Destroy() { delete this; }
 X_STATUS StfsContainerFile::ReadSync(void* buffer, size_t buffer_length,
                                      size_t byte_offset,
                                      size_t* out_bytes_read) {
+  ReadSegment segment = {buffer, buffer_length};
+  return ReadScatterSync(&segment, 1, byte_offset, out_bytes_read);
+}
+
+X_STATUS StfsContainerFile::ReadScatterSync(const ReadSegment* segments,
+                                            size_t segment_count,
+                                            size_t byte_offset,
+                                            size_t* out_bytes_read) {
   if (byte_offset >= entry_->size()) {
     return X_STATUS_END_OF_FILE;
   }
 
-  size_t src_offset = 0;
-  uint8_t* p = reinterpret_cast<uint8_t*>(buffer);
+  size_t buffer_length = 0;
+  for (size_t i = 0; i < segment_count; ++i) {
+    buffer_length += segments[i].length;
+  }
   size_t remaining_length =
       std::min(buffer_length, entry_->size() - byte_offset);
 
+  uint64_t prefetch_offset, prefetch_length;
+  if (read_tracker_.OnRead(byte_offset, remaining_length, &prefetch_offset,
+                           &prefetch_length)) {
+    Prefetch(size_t(prefetch_offset), size_t(prefetch_length));
+  }
+  BootReadRecorder* boot_read_recorder =
+      static_cast<StfsContainerDevice*>(entry_->device())
+          ->boot_read_recorder();
+
+  // The records are extents contiguous in the host files, so this is one seek
+  // per extent rather than per block, and the segments within an extent are
+  // read consecutively.
   *out_bytes_read = 0;
-  for (size_t i = 0; i < entry_->block_list().size(); i++) {
+  size_t segment_index = 0;
+  size_t segment_offset = 0;
+  size_t src_offset = byte_offset;
+  for (size_t i = entry_->FindBlockRecord(byte_offset);
+       remaining_length && i < entry_->block_list().size(); ++i) {
     auto& record = entry_->block_list()[i];
-    if (src_offset + record.length <= byte_offset) {
-      // Doesn't begin in this region. Skip it.
-      src_offset += record.length;
-      continue;
-    }
-
-    size_t read_offset =
-        (byte_offset > src_offset) ? byte_offset - src_offset : 0;
+    size_t read_offset = src_offset - entry_->block_record_offset(i);
     size_t read_length =
         std::min(record.length - read_offset, remaining_length);
 
+    boot_read_recorder->OnRead(
+        (uint64_t(record.file)
+         << StfsContainerDevice::kBootReadFileIndexShift) +
+            record.offset + read_offset,
+        read_length);
     auto& file = entry_->files()->at(record.file);
     xe::filesystem::Seek(file, record.offset + read_offset, SEEK_SET);
-    auto num_read = fread(p, 1, read_length, file);
-
-    *out_bytes_read += num_read;
-    p += num_read;
-    src_offset += record.length;
-    remaining_length -= read_length;
-    if (remaining_length == 0) {
-      break;
+    size_t extent_remaining_length = read_length;
+    while (extent_remaining_length) {
+      const ReadSegment& segment = segments[segment_index];
+      size_t chunk_length = std::min(extent_remaining_length,
+                                     segment.length - segment_offset);
+      auto num_read =
+          fread(static_cast<uint8_t*>(segment.buffer) + segment_offset, 1,
+                chunk_length, file);
+      *out_bytes_read += num_read;
+      if (num_read != chunk_length) {
+        return X_STATUS_SUCCESS;
+      }
+      extent_remaining_length -= chunk_length;
+      segment_offset += chunk_length;
+      if (segment_offset == segment.length) {
+        ++segment_index;
+        segment_offset = 0;
+      }
     }
+    src_offset += read_length;
+    remaining_length -= read_length;
   }
 
   return X_STATUS_SUCCESS;
 }
 
+void StfsContainerFile::Prefetch(size_t offset, size_t length) {
+  size_t end = offset + length;
+  for (size_t i = entry_->FindBlockRecord(offset);
+       offset < end && i < entry_->block_list().size(); ++i) {
+    auto& record = entry_->block_list()[i];
+    size_t record_offset = offset - entry_->block_record_offset(i);
+    size_t record_length =
+        std::min(record.length - record_offset, end - offset);
+    xe::filesystem::PrefetchStdioFile(entry_->files()->at(record.file),
+                                      record.offset + record_offset,
+                                      record_length);
+    offset += record_length;
+  }
+}
+
 }  // namespace vfs
 }  // namespace xe
\ No newline at end of file
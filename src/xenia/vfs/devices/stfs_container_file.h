@@ -11,6 +11,7 @@
 #define XENIA_VFS_DEVICES_STFS_CONTAINER_FILE_H_
 
 #include "xenia/vfs/file.h"
+#include "xenia/vfs/read_prefetcher.h"
 
 #include "xenia/xbox.h"
 
@@ -28,6 +29,8 @@ class StfsContainerFile : public File {
 
   X_STATUS ReadSync(void* buffer, size_t buffer_length, size_t byte_offset,
                     size_t* out_bytes_read) override;
+  X_STATUS ReadScatterSync(const ReadSegment* segments, size_t segment_count,
+                           size_t byte_offset, size_t* out_bytes_read) override;
   X_STATUS WriteSync(const void* buffer, size_t buffer_length,
                      size_t byte_offset, size_t* out_bytes_written) override {
     return X_STATUS_ACCESS_DENIED;
@@ -35,7 +38,11 @@ class StfsContainerFile : public File {
   X_STATUS SetLength(size_t length) override { return X_STATUS_ACCESS_DENIED; }
 
  private:
+  // Hints the host file ranges of the range of the file to be loaded.
+  void Prefetch(size_t offset, size_t length);
+
   StfsContainerEntry* entry_;
+  SequentialReadTracker read_tracker_;
 };
 
 }  // namespace vfs
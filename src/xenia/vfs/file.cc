@@ -0,0 +1,39 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/vfs/file.h"
+
+namespace xe {
+namespace vfs {
+
+X_STATUS File::ReadScatterSync(const ReadSegment* segments,
+                               size_t segment_count, size_t byte_offset,
+                               size_t* out_bytes_read) {
+  *out_bytes_read = 0;
+  for (size_t i = 0; i < segment_count; ++i) {
+    size_t bytes_read = 0;
+    X_STATUS result = ReadSync(segments[i].buffer, segments[i].length,
+                               byte_offset + *out_bytes_read, &bytes_read);
+    if (result == X_STATUS_END_OF_FILE && *out_bytes_read) {
+      // Partially read.
+      break;
+    }
+    if (XFAILED(result)) {
+      return result;
+    }
+    *out_bytes_read += bytes_read;
+    if (bytes_read != segments[i].length) {
+      break;
+    }
+  }
+  return X_STATUS_SUCCESS;
+}
+
+}  // namespace vfs
+}  // namespace xe
@@ -12,6 +12,7 @@
 
 #include <cstdint>
 
+#include "xenia/base/filesystem.h"
 #include "xenia/xbox.h"
 
 namespace xe {
@@ -19,6 +20,8 @@ namespace vfs {
 
 class Entry;
 
+using ReadSegment = xe::filesystem::ReadSegment;
+
 class File {
  public:
   File(uint32_t file_access, Entry* entry)
@@ -32,6 +35,13 @@ class File {
   virtual X_STATUS WriteSync(const void* buffer, size_t buffer_length,
                              size_t byte_offset, size_t* out_bytes_written) = 0;
 
+  // Reads consecutive data starting at byte_offset into the segments in order,
+  // like ReadSync into their concatenation. By default, calls ReadSync for each
+  // segment, devices may do it in one pass.
+  virtual X_STATUS ReadScatterSync(const ReadSegment* segments,
+                                   size_t segment_count, size_t byte_offset,
+                                   size_t* out_bytes_read);
+
   // TODO: Parameters
   virtual X_STATUS ReadAsync(void* buffer, size_t buffer_length,
                              size_t byte_offset, size_t* out_bytes_read) {
@@ -46,6 +56,16 @@ class File {
 
   virtual X_STATUS SetLength(size_t length) { return X_STATUS_NOT_IMPLEMENTED; }
 
+  // Writes the data buffered by the device to the storage.
+  virtual X_STATUS Flush() { return X_STATUS_SUCCESS; }
+
+  // Whether writes must reach the storage before completing (opened with
+  // FILE_WRITE_THROUGH), so the device must not buffer them.
+  bool is_write_through() const { return is_write_through_; }
+  void set_write_through(bool is_write_through) {
+    is_write_through_ = is_write_through;
+  }
+
   // xe::filesystem::FileAccess
   uint32_t file_access() const { return file_access_; }
   const Entry* entry() const { return entry_; }
@@ -55,6 +75,7 @@ class File {
   // xe::filesystem::FileAccess
   uint32_t file_access_ = 0;
   Entry* entry_ = nullptr;
+  bool is_write_through_ = false;
 };
 
 }  // namespace vfs
@@ -7,12 +7,16 @@ project("xenia-vfs")
   kind("StaticLib")
   language("C++")
   links({
+    "snappy",
     "xenia-base",
   })
   defines({
   })
   recursive_platform_files()
-  removefiles({"vfs_dump.cc"})
+  removefiles({
+    "vfs_compress.cc",
+    "vfs_dump.cc",
+  })
 
 project("xenia-vfs-dump")
   uuid("2EF270C7-41A8-4D0E-ACC5-59693A9CCE32")
@@ -32,5 +36,26 @@ project("xenia-vfs-dump")
   resincludedirs({
     project_root,
   })
+
+project("xenia-vfs-compress")
+  uuid("6c1a41e1-6f0d-4b4e-9a53-6d1f3f7c2b84")
+  kind("ConsoleApp")
+  language("C++")
+  links({
+    "fmt",
+    "snappy",
+    "xenia-base",
+    "xenia-vfs",
+  })
+  defines({})
+
+  files({
+    "vfs_compress.cc",
+    project_root.."/src/xenia/base/console_app_main_"..platform_suffix..".cc",
+  })
+  resincludedirs({
+    project_root,
+  })
+
 include("testing")
 
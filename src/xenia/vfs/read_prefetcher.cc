@@ -0,0 +1,214 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/vfs/read_prefetcher.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+
+#include "xenia/base/clock.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+
+DEFINE_uint32(read_prefetch_max_window_kb, 4096,
+              "Maximum size of the data prefetched ahead of sequential reads "
+              "of files in disc images and STFS containers, in KB, 0 to "
+              "disable prefetching.",
+              "Storage");
+DEFINE_bool(boot_prefetch, true,
+            "Record which parts of the disc image or the STFS container are "
+            "read while a title is booting, and prefetch them when the title "
+            "is launched again.",
+            "Storage");
+DEFINE_uint32(boot_prefetch_record_seconds, 60,
+              "Duration of recording the reads after launching a title for "
+              "--boot_prefetch.",
+              "Storage");
+
+namespace xe {
+namespace vfs {
+
+bool SequentialReadTracker::OnRead(uint64_t offset, uint64_t length,
+                                   uint64_t* prefetch_offset_out,
+                                   uint64_t* prefetch_length_out) {
+  uint64_t max_window = uint64_t(cvars::read_prefetch_max_window_kb) << 10;
+  if (!max_window || offset >= size_) {
+    return false;
+  }
+  uint64_t end = offset + std::min(length, size_ - offset);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  bool is_sequential = offset == next_offset_;
+  next_offset_ = end;
+  if (!is_sequential) {
+    // Random access - don't prefetch until the reads become sequential again.
+    window_ = kInitialWindow;
+    prefetched_end_ = end;
+    next_prefetch_offset_ = end;
+    return false;
+  }
+  if (end < next_prefetch_offset_) {
+    return false;
+  }
+  uint64_t window = std::min(window_, max_window);
+  uint64_t prefetch_begin = std::max(prefetched_end_, end);
+  uint64_t prefetch_end = std::min(end + window, size_);
+  if (prefetch_begin >= prefetch_end) {
+    return false;
+  }
+  prefetched_end_ = prefetch_end;
+  next_prefetch_offset_ = end + (prefetch_end - end) / 2;
+  window_ = std::min(window * 2, max_window);
+  *prefetch_offset_out = prefetch_begin;
+  *prefetch_length_out = prefetch_end - prefetch_begin;
+  return true;
+}
+
+BootReadRecorder::BootReadRecorder(uint64_t source_size,
+                                   PrefetchFunction prefetch_function)
+    : source_size_(source_size),
+      prefetch_function_(std::move(prefetch_function)) {}
+
+BootReadRecorder::~BootReadRecorder() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (is_recording_.load(std::memory_order_relaxed)) {
+      EndRecording();
+    }
+  }
+  StopReplay();
+}
+
+void BootReadRecorder::Begin(const std::filesystem::path& record_path) {
+  if (!cvars::boot_prefetch) {
+    return;
+  }
+  StopReplay();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (is_recording_.load(std::memory_order_relaxed)) {
+    EndRecording();
+  }
+
+  // Load the previous record, merging adjacent granules into ranges.
+  std::vector<std::pair<uint64_t, uint64_t>> ranges;
+  FILE* file = xe::filesystem::OpenFile(record_path, "rb");
+  if (file) {
+    Header header;
+    if (fread(&header, sizeof(header), 1, file) == 1 &&
+        header.magic == kMagic && header.version == kVersion &&
+        header.source_size == source_size_ &&
+        header.granule_size_log2 == kGranuleSizeLog2) {
+      std::vector<uint64_t> granules(header.granule_count);
+      if (fread(granules.data(), sizeof(uint64_t), granules.size(), file) ==
+          granules.size()) {
+        for (uint64_t granule : granules) {
+          uint64_t offset = granule << kGranuleSizeLog2;
+          if (!ranges.empty() &&
+              ranges.back().first + ranges.back().second == offset) {
+            ranges.back().second += uint64_t(1) << kGranuleSizeLog2;
+          } else {
+            ranges.emplace_back(offset, uint64_t(1) << kGranuleSizeLog2);
+          }
+        }
+      }
+    }
+    fclose(file);
+  }
+
+  if (!ranges.empty()) {
+    XELOGI("Prefetching {} ranges read during the previous boot",
+           ranges.size());
+    xe::threading::Thread::CreationParameters params;
+    params.stack_size = 64 * 1024;
+    replay_thread_ = xe::threading::Thread::Create(
+        params, [this, ranges = std::move(ranges)]() {
+          for (const std::pair<uint64_t, uint64_t>& range : ranges) {
+            if (replay_cancelled_.load(std::memory_order_relaxed)) {
+              break;
+            }
+            prefetch_function_(range.first, range.second);
+          }
+        });
+    if (replay_thread_) {
+      replay_thread_->set_name("Boot Prefetch");
+    }
+  }
+
+  record_path_ = record_path;
+  record_end_millis_ = Clock::QueryHostUptimeMillis() +
+                       uint64_t(cvars::boot_prefetch_record_seconds) * 1000;
+  is_recording_.store(true, std::memory_order_relaxed);
+}
+
+void BootReadRecorder::Record(uint64_t offset, uint64_t length) {
+  if (!length) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!is_recording_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  if (Clock::QueryHostUptimeMillis() >= record_end_millis_) {
+    EndRecording();
+    return;
+  }
+  uint64_t last_granule = (offset + length - 1) >> kGranuleSizeLog2;
+  for (uint64_t granule = offset >> kGranuleSizeLog2;
+       granule <= last_granule; ++granule) {
+    if (recorded_granule_set_.insert(granule).second) {
+      recorded_granules_.push_back(granule);
+    }
+  }
+}
+
+void BootReadRecorder::EndRecording() {
+  is_recording_.store(false, std::memory_order_relaxed);
+  if (!recorded_granules_.empty()) {
+    FILE* file = nullptr;
+    if (xe::filesystem::CreateParentFolder(record_path_)) {
+      file = xe::filesystem::OpenFile(record_path_, "wb");
+    }
+    if (file) {
+      Header header;
+      header.magic = kMagic;
+      header.version = kVersion;
+      header.source_size = source_size_;
+      header.granule_size_log2 = kGranuleSizeLog2;
+      header.granule_count = uint32_t(recorded_granules_.size());
+      fwrite(&header, sizeof(header), 1, file);
+      fwrite(recorded_granules_.data(), sizeof(uint64_t),
+             recorded_granules_.size(), file);
+      fclose(file);
+      XELOGI("Recorded {} bytes read during the boot to {}",
+             recorded_granules_.size() << kGranuleSizeLog2,
+             xe::path_to_utf8(record_path_));
+    } else {
+      XELOGW("Failed to save the boot read record to {}",
+             xe::path_to_utf8(record_path_));
+    }
+  }
+  recorded_granule_set_.clear();
+  recorded_granules_.clear();
+}
+
+void BootReadRecorder::StopReplay() {
+  if (!replay_thread_) {
+    return;
+  }
+  replay_cancelled_.store(true, std::memory_order_relaxed);
+  xe::threading::Wait(replay_thread_.get(), false);
+  replay_thread_.reset();
+  replay_cancelled_.store(false, std::memory_order_relaxed);
+}
+
+}  // namespace vfs
+}  // namespace xe
@@ -0,0 +1,123 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_VFS_READ_PREFETCHER_H_
+#define XENIA_VFS_READ_PREFETCHER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "xenia/base/threading.h"
+
+namespace xe {
+namespace vfs {
+
+// Detects sequential reads of an open file, and tells which range following
+// them should be prefetched, so on slow storage, the reads don't wait for the
+// data to be loaded synchronously on the first access. The window grows while
+// the reads stay sequential, and resets on a seek. Thread-safe.
+class SequentialReadTracker {
+ public:
+  static constexpr uint64_t kInitialWindow = 128 * 1024;
+
+  explicit SequentialReadTracker(uint64_t size) : size_(size) {}
+
+  // Called before a read of the file. Returns true and the range to prefetch,
+  // relative to the file, if more data should be prefetched.
+  bool OnRead(uint64_t offset, uint64_t length, uint64_t* prefetch_offset_out,
+              uint64_t* prefetch_length_out);
+
+ private:
+  std::mutex mutex_;
+  uint64_t size_;
+  // The first read of a file is considered sequential if it's from the
+  // beginning.
+  uint64_t next_offset_ = 0;
+  uint64_t prefetched_end_ = 0;
+  // The next prefetch is done once the reads reach the middle of the
+  // previously prefetched range.
+  uint64_t next_prefetch_offset_ = 0;
+  uint64_t window_ = kInitialWindow;
+};
+
+// Records which parts of a device are read during the boot of a title, in
+// granules, in the order of the first access, and on the next launch of the
+// title, prefetches them in the same order on a separate thread. The offsets
+// are in the address space of the device (for instance, offsets in the image
+// file), the prefetch function maps them to the host storage.
+class BootReadRecorder {
+ public:
+  static constexpr uint32_t kGranuleSizeLog2 = 16;
+  static constexpr uint32_t kMagic = 0x46504258;  // 'XBPF'
+  static constexpr uint32_t kVersion = 1;
+
+  struct Header {
+    uint32_t magic;
+    uint32_t version;
+    // To discard the record if a different image of the same title is used.
+    uint64_t source_size;
+    uint32_t granule_size_log2;
+    uint32_t granule_count;
+  };
+  static_assert(sizeof(Header) == 24);
+
+  using PrefetchFunction =
+      std::function<void(uint64_t offset, uint64_t length)>;
+
+  // source_size is the size of the device's address space for validating the
+  // record.
+  BootReadRecorder(uint64_t source_size, PrefetchFunction prefetch_function);
+  BootReadRecorder(const BootReadRecorder& recorder) = delete;
+  BootReadRecorder& operator=(const BootReadRecorder& recorder) = delete;
+  // Saves the record if still recording.
+  ~BootReadRecorder();
+
+  // Called when a title is launched from the device. Starts prefetching the
+  // ranges from the record at the path, and starts recording the reads into
+  // it for the next launches, replacing the previous recording if there's an
+  // active one. Does nothing if --boot_prefetch is disabled.
+  void Begin(const std::filesystem::path& record_path);
+
+  // Called for every read of the device.
+  void OnRead(uint64_t offset, uint64_t length) {
+    if (is_recording_.load(std::memory_order_relaxed)) {
+      Record(offset, length);
+    }
+  }
+
+ private:
+  void Record(uint64_t offset, uint64_t length);
+  // Requires the lock.
+  void EndRecording();
+  void StopReplay();
+
+  uint64_t source_size_;
+  PrefetchFunction prefetch_function_;
+
+  std::atomic<bool> is_recording_ = {false};
+  std::mutex mutex_;
+  std::filesystem::path record_path_;
+  uint64_t record_end_millis_ = 0;
+  std::unordered_set<uint64_t> recorded_granule_set_;
+  std::vector<uint64_t> recorded_granules_;
+
+  std::unique_ptr<xe::threading::Thread> replay_thread_;
+  std::atomic<bool> replay_cancelled_ = {false};
+};
+
+}  // namespace vfs
+}  // namespace xe
+
+#endif  // XENIA_VFS_READ_PREFETCHER_H_
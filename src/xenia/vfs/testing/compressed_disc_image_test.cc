@@ -0,0 +1,100 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/vfs/devices/compressed_disc_image.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <vector>
+
+#include "xenia/base/filesystem.h"
+
+#include "third_party/catch/include/catch.hpp"
+
+namespace xe::vfs::test {
+
+TEST_CASE("Compressed disc image round trip", "[compressed_disc_image]") {
+  constexpr uint32_t kBlockSizeLog2 = 12;
+  constexpr size_t kBlockSize = size_t(1) << kBlockSizeLog2;
+
+  // Zero, compressible, incompressible and partial last blocks.
+  std::vector<uint8_t> image(kBlockSize * 37 + 123);
+  std::mt19937 random(1);
+  for (size_t i = 0; i < image.size(); ++i) {
+    size_t block = i / kBlockSize;
+    if (block % 3 == 0) {
+      image[i] = 0;
+    } else if (block % 3 == 1) {
+      image[i] = uint8_t(i / 16);
+    } else {
+      image[i] = uint8_t(random());
+    }
+  }
+
+  std::filesystem::path temp_path = std::filesystem::temp_directory_path();
+  std::filesystem::path source_path = temp_path / "xenia_test_image.iso";
+  std::filesystem::path target_path = temp_path / "xenia_test_image.xcdi";
+  FILE* source_file = xe::filesystem::OpenFile(source_path, "wb");
+  REQUIRE(source_file);
+  REQUIRE(fwrite(image.data(), 1, image.size(), source_file) == image.size());
+  fclose(source_file);
+
+  REQUIRE(CompressedDiscImage::Compress(source_path, target_path,
+                                        kBlockSizeLog2));
+  REQUIRE(CompressedDiscImage::IsCompressedDiscImage(target_path));
+  REQUIRE_FALSE(CompressedDiscImage::IsCompressedDiscImage(source_path));
+
+  {
+    std::unique_ptr<CompressedDiscImage> compressed =
+        CompressedDiscImage::Open(target_path);
+    REQUIRE(compressed);
+    REQUIRE(compressed->size() == image.size());
+    REQUIRE(compressed->block_count() == 38);
+    REQUIRE(compressed->file_size() < image.size());
+
+    std::vector<uint8_t> read(image.size());
+
+    SECTION("Whole image") {
+      REQUIRE(compressed->Read(0, read.data(), read.size()));
+      REQUIRE(read == image);
+    }
+
+    SECTION("Sequential stream") {
+      CompressedDiscImage::Stream stream;
+      constexpr size_t kChunkSize = 1000;
+      for (size_t offset = 0; offset < image.size(); offset += kChunkSize) {
+        size_t length = std::min(kChunkSize, image.size() - offset);
+        REQUIRE(compressed->Read(offset, read.data() + offset, length,
+                                 &stream));
+      }
+      REQUIRE(read == image);
+    }
+
+    SECTION("Random ranges") {
+      for (uint32_t i = 0; i < 256; ++i) {
+        size_t offset = random() % image.size();
+        size_t length = random() % (image.size() - offset + 1);
+        REQUIRE(compressed->Read(offset, read.data(), length));
+        REQUIRE(std::memcmp(read.data(), image.data() + offset, length) == 0);
+      }
+    }
+
+    SECTION("Out of bounds") {
+      REQUIRE_FALSE(compressed->Read(image.size() - 1, read.data(), 2));
+      REQUIRE(compressed->Read(image.size(), read.data(), 0));
+    }
+  }
+
+  std::filesystem::remove(source_path);
+  std::filesystem::remove(target_path);
+}
+
+}  // namespace xe::vfs::test
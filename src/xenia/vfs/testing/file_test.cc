@@ -0,0 +1,171 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/vfs/file.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+#include "xenia/base/filesystem.h"
+#include "xenia/vfs/devices/host_path_device.h"
+#include "xenia/vfs/devices/host_path_entry.h"
+#include "xenia/vfs/entry.h"
+
+#include "third_party/catch/include/catch.hpp"
+
+namespace xe::vfs::test {
+
+// Uses the default ReadScatterSync implementation.
+class SegmentedReadFile : public File {
+ public:
+  explicit SegmentedReadFile(File* file)
+      : File(file->file_access(), file->entry()), file_(file) {}
+  void Destroy() override { delete this; }
+  X_STATUS ReadSync(void* buffer, size_t buffer_length, size_t byte_offset,
+                    size_t* out_bytes_read) override {
+    return file_->ReadSync(buffer, buffer_length, byte_offset,
+                           out_bytes_read);
+  }
+  X_STATUS WriteSync(const void* buffer, size_t buffer_length,
+                     size_t byte_offset, size_t* out_bytes_written) override {
+    return X_STATUS_ACCESS_DENIED;
+  }
+
+ private:
+  File* file_;
+};
+
+TEST_CASE("Scatter read", "[file]") {
+  std::filesystem::path host_path =
+      std::filesystem::temp_directory_path() / "xenia_test_scatter";
+  std::filesystem::remove_all(host_path);
+  REQUIRE(std::filesystem::create_directories(host_path));
+  std::vector<uint8_t> data(10000);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = uint8_t(i * 7);
+  }
+  FILE* host_file = xe::filesystem::OpenFile(host_path / "a.bin", "wb");
+  REQUIRE(host_file);
+  REQUIRE(fwrite(data.data(), 1, data.size(), host_file) == data.size());
+  fclose(host_file);
+
+  {
+    HostPathDevice device("\\Device\\Harddisk0", host_path, true);
+    REQUIRE(device.Initialize());
+    Entry* entry = device.ResolvePath("a.bin");
+    REQUIRE(entry);
+    File* file = nullptr;
+    REQUIRE(entry->Open(FileAccess::kGenericRead, &file) == X_STATUS_SUCCESS);
+    SegmentedReadFile segmented_file(file);
+
+    for (File* tested_file : {file, static_cast<File*>(&segmented_file)}) {
+      std::vector<uint8_t> buffers[3] = {std::vector<uint8_t>(4096),
+                                         std::vector<uint8_t>(0),
+                                         std::vector<uint8_t>(8192)};
+      ReadSegment segments[3];
+      for (size_t i = 0; i < 3; ++i) {
+        segments[i].buffer = buffers[i].data();
+        segments[i].length = buffers[i].size();
+      }
+      // Reaches the end of the file in the last segment.
+      size_t bytes_read = 0;
+      REQUIRE(tested_file->ReadScatterSync(segments, 3, 100, &bytes_read) ==
+              X_STATUS_SUCCESS);
+      REQUIRE(bytes_read == data.size() - 100);
+      REQUIRE(std::memcmp(buffers[0].data(), data.data() + 100, 4096) == 0);
+      REQUIRE(std::memcmp(buffers[2].data(), data.data() + 100 + 4096,
+                          data.size() - 100 - 4096) == 0);
+    }
+
+    file->Destroy();
+  }
+
+  std::filesystem::remove_all(host_path);
+}
+
+TEST_CASE("Buffered writes", "[file]") {
+  std::filesystem::path host_path =
+      std::filesystem::temp_directory_path() / "xenia_test_write_buffer";
+  std::filesystem::remove_all(host_path);
+  REQUIRE(std::filesystem::create_directories(host_path));
+  REQUIRE(xe::filesystem::CreateEmptyFile(host_path / "a.bin"));
+
+  auto host_file_contents = [&]() {
+    std::vector<uint8_t> contents(
+        std::filesystem::file_size(host_path / "a.bin"));
+    FILE* host_file = xe::filesystem::OpenFile(host_path / "a.bin", "rb");
+    fread(contents.data(), 1, contents.size(), host_file);
+    fclose(host_file);
+    return contents;
+  };
+
+  {
+    HostPathDevice device("\\Device\\Harddisk0", host_path, false);
+    REQUIRE(device.Initialize());
+    Entry* entry = device.ResolvePath("a.bin");
+    REQUIRE(entry);
+    File* file = nullptr;
+    REQUIRE(entry->Open(FileAccess::kGenericRead | FileAccess::kGenericWrite,
+                        &file) == X_STATUS_SUCCESS);
+    File* other_file = nullptr;
+    REQUIRE(entry->Open(FileAccess::kGenericRead, &other_file) ==
+            X_STATUS_SUCCESS);
+
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); ++i) {
+      data[i] = uint8_t(i * 3);
+    }
+    size_t bytes_written = 0;
+    for (size_t offset = 0; offset < data.size(); offset += 100) {
+      REQUIRE(file->WriteSync(data.data() + offset, 100, offset,
+                              &bytes_written) == X_STATUS_SUCCESS);
+      REQUIRE(bytes_written == 100);
+    }
+    REQUIRE(host_file_contents().empty());
+
+    // Visible through the other files of the entry.
+    std::vector<uint8_t> read(data.size());
+    size_t bytes_read = 0;
+    REQUIRE(other_file->ReadSync(read.data(), read.size(), 0, &bytes_read) ==
+            X_STATUS_SUCCESS);
+    REQUIRE(bytes_read == data.size());
+    REQUIRE(read == data);
+    REQUIRE(host_file_contents() == data);
+
+    // Included in the size.
+    REQUIRE(file->WriteSync(data.data(), 100, data.size(), &bytes_written) ==
+            X_STATUS_SUCCESS);
+    entry->update();
+    REQUIRE(entry->size() == data.size() + 100);
+
+    // Not buffered with write-through.
+    file->set_write_through(true);
+    REQUIRE(file->WriteSync(data.data(), 100, 0, &bytes_written) ==
+            X_STATUS_SUCCESS);
+    REQUIRE(std::filesystem::file_size(host_path / "a.bin") ==
+            data.size() + 100);
+    file->set_write_through(false);
+
+    // Flushed when the file is closed.
+    REQUIRE(file->WriteSync(data.data(), 100, data.size() + 100,
+                            &bytes_written) == X_STATUS_SUCCESS);
+    REQUIRE(std::filesystem::file_size(host_path / "a.bin") ==
+            data.size() + 100);
+    file->Destroy();
+    REQUIRE(std::filesystem::file_size(host_path / "a.bin") ==
+            data.size() + 200);
+    other_file->Destroy();
+  }
+
+  std::filesystem::remove_all(host_path);
+}
+
+}  // namespace xe::vfs::test
@@ -0,0 +1,120 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/vfs/read_prefetcher.h"
+
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "third_party/catch/include/catch.hpp"
+
+namespace xe::vfs::test {
+
+TEST_CASE("Sequential read tracker", "[read_prefetcher]") {
+  constexpr uint64_t kSize = 64 * 1024 * 1024;
+  SequentialReadTracker tracker(kSize);
+  uint64_t prefetch_offset, prefetch_length;
+
+  // The first read from the beginning is sequential.
+  REQUIRE(tracker.OnRead(0, 4096, &prefetch_offset, &prefetch_length));
+  REQUIRE(prefetch_offset == 4096);
+  REQUIRE(prefetch_length == SequentialReadTracker::kInitialWindow);
+
+  // Nothing more until half of the window has been consumed.
+  REQUIRE_FALSE(
+      tracker.OnRead(4096, 4096, &prefetch_offset, &prefetch_length));
+  uint64_t offset = 8192;
+  while (!tracker.OnRead(offset, 4096, &prefetch_offset, &prefetch_length)) {
+    offset += 4096;
+  }
+  REQUIRE(offset + 4096 >= SequentialReadTracker::kInitialWindow / 2);
+  // Continues from the end of the previous prefetch with a larger window.
+  REQUIRE(prefetch_offset == 4096 + SequentialReadTracker::kInitialWindow);
+  REQUIRE(prefetch_offset + prefetch_length ==
+          offset + 4096 + SequentialReadTracker::kInitialWindow * 2);
+
+  // Random access.
+  REQUIRE_FALSE(tracker.OnRead(kSize / 2, 4096, &prefetch_offset,
+                               &prefetch_length));
+  REQUIRE(tracker.OnRead(kSize / 2 + 4096, 4096, &prefetch_offset,
+                         &prefetch_length));
+  REQUIRE(prefetch_offset == kSize / 2 + 8192);
+  REQUIRE(prefetch_length == SequentialReadTracker::kInitialWindow);
+
+  // Clamped to the end of the file.
+  REQUIRE_FALSE(tracker.OnRead(kSize - 65536, 4096, &prefetch_offset,
+                               &prefetch_length));
+  REQUIRE(tracker.OnRead(kSize - 61440, 4096, &prefetch_offset,
+                         &prefetch_length));
+  REQUIRE(prefetch_offset == kSize - 57344);
+  REQUIRE(prefetch_offset + prefetch_length == kSize);
+  REQUIRE_FALSE(
+      tracker.OnRead(kSize, 4096, &prefetch_offset, &prefetch_length));
+}
+
+TEST_CASE("Boot read recorder", "[read_prefetcher]") {
+  constexpr uint64_t kSourceSize = 1024 * 1024 * 1024;
+  constexpr uint64_t kGranuleSize = uint64_t(1)
+                                    << BootReadRecorder::kGranuleSizeLog2;
+  std::filesystem::path record_path =
+      std::filesystem::temp_directory_path() / "xenia_test_boot_read.bin";
+  std::filesystem::remove(record_path);
+
+  std::mutex prefetched_mutex;
+  std::vector<std::pair<uint64_t, uint64_t>> prefetched;
+  auto prefetch = [&](uint64_t offset, uint64_t length) {
+    std::lock_guard<std::mutex> lock(prefetched_mutex);
+    prefetched.emplace_back(offset, length);
+  };
+
+  {
+    BootReadRecorder recorder(kSourceSize, prefetch);
+    recorder.Begin(record_path);
+    recorder.OnRead(kGranuleSize * 10 + 100, kGranuleSize);
+    recorder.OnRead(kGranuleSize * 3, 1);
+    recorder.OnRead(kGranuleSize * 10, 1);
+  }
+  REQUIRE(prefetched.empty());
+
+  auto prefetched_count = [&]() {
+    std::lock_guard<std::mutex> lock(prefetched_mutex);
+    return prefetched.size();
+  };
+
+  {
+    BootReadRecorder recorder(kSourceSize, prefetch);
+    recorder.Begin(record_path);
+    // Replayed asynchronously, and cancelled if the recorder is destroyed.
+    for (uint32_t i = 0; i < 1000 && prefetched_count() < 2; ++i) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+  // In the order of the first access, with adjacent granules merged.
+  REQUIRE(prefetched.size() == 2);
+  REQUIRE(prefetched[0].first == kGranuleSize * 10);
+  REQUIRE(prefetched[0].second == kGranuleSize * 2);
+  REQUIRE(prefetched[1].first == kGranuleSize * 3);
+  REQUIRE(prefetched[1].second == kGranuleSize);
+
+  // Not replayed for a different source.
+  prefetched.clear();
+  {
+    BootReadRecorder recorder(kSourceSize * 2, prefetch);
+    recorder.Begin(record_path);
+  }
+  REQUIRE(prefetched.empty());
+
+  std::filesystem::remove(record_path);
+}
+
+}  // namespace xe::vfs::test
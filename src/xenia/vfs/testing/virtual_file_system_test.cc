@@ -0,0 +1,75 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/vfs/virtual_file_system.h"
+
+#include <filesystem>
+
+#include "xenia/base/filesystem.h"
+#include "xenia/vfs/devices/host_path_device.h"
+
+#include "third_party/catch/include/catch.hpp"
+
+namespace xe::vfs::test {
+
+TEST_CASE("Virtual file system path resolution", "[virtual_file_system]") {
+  std::filesystem::path host_path =
+      std::filesystem::temp_directory_path() / "xenia_test_vfs";
+  std::filesystem::remove_all(host_path);
+  REQUIRE(std::filesystem::create_directories(host_path / "dir"));
+  REQUIRE(xe::filesystem::CreateEmptyFile(host_path / "dir" / "a.bin"));
+
+  {
+    VirtualFileSystem file_system;
+    auto device = std::make_unique<HostPathDevice>("\\Device\\Harddisk0",
+                                                   host_path, false);
+    REQUIRE(device->Initialize());
+    REQUIRE(file_system.RegisterDevice(std::move(device)));
+    REQUIRE(file_system.RegisterSymbolicLink("game:", "\\Device\\Harddisk0"));
+
+    Entry* entry = file_system.ResolvePath("game:\\dir\\a.bin");
+    REQUIRE(entry);
+    REQUIRE(entry->name() == "a.bin");
+    // Cached.
+    REQUIRE(file_system.ResolvePath("game:\\dir\\a.bin") == entry);
+    REQUIRE(file_system.ResolvePath("\\Device\\Harddisk0\\dir\\a.bin") ==
+            entry);
+    REQUIRE_FALSE(file_system.ResolvePath("game:\\dir\\b.bin"));
+
+    SECTION("Create and delete") {
+      Entry* created_entry =
+          file_system.CreatePath("game:\\dir\\b.bin", kFileAttributeNormal);
+      REQUIRE(created_entry);
+      REQUIRE(file_system.ResolvePath("game:\\dir\\b.bin") == created_entry);
+
+      REQUIRE(file_system.DeletePath("game:\\dir\\a.bin"));
+      REQUIRE_FALSE(file_system.ResolvePath("game:\\dir\\a.bin"));
+      REQUIRE(file_system.ResolvePath("game:\\dir\\b.bin") == created_entry);
+    }
+
+    SECTION("Symbolic link changes") {
+      REQUIRE(file_system.UnregisterSymbolicLink("game:"));
+      REQUIRE_FALSE(file_system.ResolvePath("game:\\dir\\a.bin"));
+      REQUIRE(file_system.RegisterSymbolicLink("d:", "\\Device\\Harddisk0"));
+      REQUIRE(file_system.ResolvePath("d:\\dir\\a.bin") == entry);
+      std::string target;
+      REQUIRE(file_system.FindSymbolicLink("d:\\dir", target));
+      REQUIRE(target == "\\Device\\Harddisk0");
+    }
+
+    SECTION("Device unregistration") {
+      REQUIRE(file_system.UnregisterDevice("\\Device\\Harddisk0"));
+      REQUIRE_FALSE(file_system.ResolvePath("game:\\dir\\a.bin"));
+    }
+  }
+
+  std::filesystem::remove_all(host_path);
+}
+
+}  // namespace xe::vfs::test
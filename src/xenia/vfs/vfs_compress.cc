@@ -0,0 +1,60 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2022 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include <string>
+#include <vector>
+
+#include "xenia/base/console_app_main.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/logging.h"
+
+#include "xenia/vfs/devices/compressed_disc_image.h"
+
+namespace xe {
+namespace vfs {
+
+DEFINE_transient_path(source, "", "Specifies the disc image to compress.",
+                      "General");
+
+DEFINE_transient_path(target, "",
+                      "Specifies the compressed disc image to create.",
+                      "General");
+
+DEFINE_uint32(block_size_log2,
+              CompressedDiscImage::kDefaultBlockSizeLog2,
+              "Base-2 logarithm of the size of the independently compressed "
+              "blocks. Smaller blocks are faster to read randomly, larger ones "
+              "are compressed better.",
+              "General");
+
+int vfs_compress_main(const std::vector<std::string>& args) {
+  if (cvars::source.empty() || cvars::target.empty()) {
+    XELOGE("Usage: {} [source] [target]", xe::path_to_utf8(args[0]));
+    return 1;
+  }
+
+  if (!CompressedDiscImage::Compress(cvars::source, cvars::target,
+                                     cvars::block_size_log2)) {
+    return 1;
+  }
+
+  // Verify the result by opening it.
+  if (!CompressedDiscImage::Open(cvars::target)) {
+    XELOGE("Failed to open the created compressed disc image");
+    return 1;
+  }
+
+  return 0;
+}
+
+}  // namespace vfs
+}  // namespace xe
+
+XE_DEFINE_CONSOLE_APP("xenia-vfs-compress", xe::vfs::vfs_compress_main,
+                      "[source] [target]", "source", "target");
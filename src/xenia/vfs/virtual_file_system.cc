@@ -16,27 +16,40 @@
 namespace xe {
 namespace vfs {
 
-VirtualFileSystem::VirtualFileSystem() {}
+VirtualFileSystem::VirtualFileSystem()
+    : mount_table_(std::make_shared<MountTable>()) {}
 
 VirtualFileSystem::~VirtualFileSystem() {
   // Delete all devices.
   // This will explode if anyone is still using data from them.
-  devices_.clear();
-  symlinks_.clear();
+  InvalidatePathCache();
+  SetMountTable(std::make_shared<MountTable>());
 }
 
-bool VirtualFileSystem::RegisterDevice(std::unique_ptr<Device> device) {
+void VirtualFileSystem::SetMountTable(
+    std::shared_ptr<const MountTable> mount_table) {
+  std::atomic_store_explicit(&mount_table_, std::move(mount_table),
+                             std::memory_order_release);
+  InvalidatePathCache();
+}
+
+bool VirtualFileSystem::RegisterDevice(std::shared_ptr<Device> device) {
   auto global_lock = global_critical_region_.Acquire();
-  devices_.emplace_back(std::move(device));
+  auto mount_table = std::make_shared<MountTable>(*GetMountTable());
+  mount_table->devices.emplace_back(std::move(device));
+  SetMountTable(std::move(mount_table));
   return true;
 }
 
 bool VirtualFileSystem::UnregisterDevice(const std::string_view path) {
   auto global_lock = global_critical_region_.Acquire();
-  for (auto it = devices_.begin(); it != devices_.end(); ++it) {
+  auto mount_table = std::make_shared<MountTable>(*GetMountTable());
+  for (auto it = mount_table->devices.begin();
+       it != mount_table->devices.end(); ++it) {
     if ((*it)->mount_path() == path) {
       XELOGD("Unregistered device: {}", (*it)->mount_path());
-      devices_.erase(it);
+      mount_table->devices.erase(it);
+      SetMountTable(std::move(mount_table));
       return true;
     }
   }
@@ -46,7 +59,9 @@ bool VirtualFileSystem::UnregisterDevice(const std::string_view path) {
 bool VirtualFileSystem::RegisterSymbolicLink(const std::string_view path,
                                              const std::string_view target) {
   auto global_lock = global_critical_region_.Acquire();
-  symlinks_.insert({std::string(path), std::string(target)});
+  auto mount_table = std::make_shared<MountTable>(*GetMountTable());
+  mount_table->symlinks.insert({std::string(path), std::string(target)});
+  SetMountTable(std::move(mount_table));
   XELOGD("Registered symbolic link: {} => {}", path, target);
 
   return true;
@@ -54,40 +69,45 @@ bool VirtualFileSystem::RegisterSymbolicLink(const std::string_view path,
 
 bool VirtualFileSystem::UnregisterSymbolicLink(const std::string_view path) {
   auto global_lock = global_critical_region_.Acquire();
+  auto mount_table = std::make_shared<MountTable>(*GetMountTable());
   auto it = std::find_if(
-      symlinks_.cbegin(), symlinks_.cend(),
+      mount_table->symlinks.cbegin(), mount_table->symlinks.cend(),
       [&](const auto& s) { return xe::utf8::equal_case(path, s.first); });
-  if (it == symlinks_.end()) {
+  if (it == mount_table->symlinks.end()) {
     return false;
   }
   XELOGD("Unregistered symbolic link: {} => {}", it->first, it->second);
 
-  symlinks_.erase(it);
+  mount_table->symlinks.erase(it);
+  SetMountTable(std::move(mount_table));
   return true;
 }
 
 bool VirtualFileSystem::FindSymbolicLink(const std::string_view path,
                                          std::string& target) {
+  auto mount_table = GetMountTable();
   auto it = std::find_if(
-      symlinks_.cbegin(), symlinks_.cend(),
+      mount_table->symlinks.cbegin(), mount_table->symlinks.cend(),
       [&](const auto& s) { return xe::utf8::starts_with_case(path, s.first); });
-  if (it == symlinks_.cend()) {
+  if (it == mount_table->symlinks.cend()) {
     return false;
   }
   target = (*it).second;
   return true;
 }
 
-bool VirtualFileSystem::ResolveSymbolicLink(const std::string_view path,
+bool VirtualFileSystem::ResolveSymbolicLink(const MountTable& mount_table,
+                                            const std::string_view path,
                                             std::string& result) {
   result = path;
   bool was_resolved = false;
   while (true) {
-    auto it =
-        std::find_if(symlinks_.cbegin(), symlinks_.cend(), [&](const auto& s) {
+    auto it = std::find_if(
+        mount_table.symlinks.cbegin(), mount_table.symlinks.cend(),
+        [&](const auto& s) {
           return xe::utf8::starts_with_case(result, s.first);
         });
-    if (it == symlinks_.cend()) {
+    if (it == mount_table.symlinks.cend()) {
       break;
     }
     // Found symlink!
@@ -100,23 +120,53 @@ bool VirtualFileSystem::ResolveSymbolicLink(const std::string_view path,
 }
 
 Entry* VirtualFileSystem::ResolvePath(const std::string_view path) {
-  auto global_lock = global_critical_region_.Acquire();
+  std::string path_string(path);
+  uint64_t generation;
+  {
+    std::lock_guard<std::mutex> lock(path_cache_mutex_);
+    auto it = path_cache_.find(path_string);
+    if (it != path_cache_.end()) {
+      return it->second;
+    }
+    generation = path_cache_generation_.load(std::memory_order_relaxed);
+  }
+
+  Entry* entry = ResolvePathUncached(path);
+
+  {
+    std::lock_guard<std::mutex> lock(path_cache_mutex_);
+    // Don't cache if the entries or the mounts have been modified during the
+    // lookup, the result may be from before the modification.
+    if (path_cache_generation_.load(std::memory_order_relaxed) ==
+        generation) {
+      if (path_cache_.size() >= kMaxCachedPaths) {
+        path_cache_.clear();
+      }
+      path_cache_.emplace(std::move(path_string), entry);
+    }
+  }
+  return entry;
+}
+
+Entry* VirtualFileSystem::ResolvePathUncached(const std::string_view path) {
+  std::shared_ptr<const MountTable> mount_table = GetMountTable();
 
   // Resolve relative paths
   auto normalized_path(xe::utf8::canonicalize_guest_path(path));
 
   // Resolve symlinks.
   std::string resolved_path;
-  if (ResolveSymbolicLink(normalized_path, resolved_path)) {
+  if (ResolveSymbolicLink(*mount_table, normalized_path, resolved_path)) {
     normalized_path = resolved_path;
   }
 
   // Find the device.
-  auto it =
-      std::find_if(devices_.cbegin(), devices_.cend(), [&](const auto& d) {
+  auto it = std::find_if(
+      mount_table->devices.cbegin(), mount_table->devices.cend(),
+      [&](const auto& d) {
         return xe::utf8::starts_with(normalized_path, d->mount_path());
       });
-  if (it == devices_.cend()) {
+  if (it == mount_table->devices.cend()) {
     // Supress logging the error for ShaderDumpxe:\CompareBackEnds as this is
     // not an actual problem nor something we care about.
     if (path != "ShaderDumpxe:\\CompareBackEnds") {
@@ -130,6 +180,12 @@ Entry* VirtualFileSystem::ResolvePath(const std::string_view path) {
   return device->ResolvePath(relative_path);
 }
 
+void VirtualFileSystem::InvalidatePathCache() {
+  std::lock_guard<std::mutex> lock(path_cache_mutex_);
+  path_cache_generation_.fetch_add(1, std::memory_order_relaxed);
+  path_cache_.clear();
+}
+
 Entry* VirtualFileSystem::CreatePath(const std::string_view path,
                                      uint32_t attributes) {
   // Create all required directories recursively.
@@ -149,14 +205,17 @@ Entry* VirtualFileSystem::CreatePath(const std::string_view path,
     if (!child_entry) {
       child_entry =
           parent_entry->CreateEntry(path_parts[i], kFileAttributeDirectory);
+      InvalidatePathCache();
     }
     if (!child_entry) {
       return nullptr;
     }
     parent_entry = child_entry;
   }
-  return parent_entry->CreateEntry(path_parts[path_parts.size() - 1],
-                                   attributes);
+  Entry* entry =
+      parent_entry->CreateEntry(path_parts[path_parts.size() - 1], attributes);
+  InvalidatePathCache();
+  return entry;
 }
 
 bool VirtualFileSystem::DeletePath(const std::string_view path) {
@@ -169,7 +228,9 @@ bool VirtualFileSystem::DeletePath(const std::string_view path) {
     // Can't delete root.
     return false;
   }
-  return parent->Delete(entry);
+  bool deleted = parent->Delete(entry);
+  InvalidatePathCache();
+  return deleted;
 }
 
 X_STATUS VirtualFileSystem::OpenFile(Entry* root_entry,
@@ -271,6 +332,7 @@ X_STATUS VirtualFileSystem::OpenFile(Entry* root_entry,
         if (!entry->Delete()) {
           return X_STATUS_ACCESS_DENIED;
         }
+        InvalidatePathCache();
         entry = nullptr;
         *out_action = FileAction::kSuperseded;
         break;
@@ -285,6 +347,7 @@ X_STATUS VirtualFileSystem::OpenFile(Entry* root_entry,
         if (!entry->Delete()) {
           return X_STATUS_ACCESS_DENIED;
         }
+        InvalidatePathCache();
         entry = nullptr;
         *out_action = FileAction::kOverwritten;
         break;
@@ -10,7 +10,10 @@
 #ifndef XENIA_VFS_VIRTUAL_FILE_SYSTEM_H_
 #define XENIA_VFS_VIRTUAL_FILE_SYSTEM_H_
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -28,7 +31,7 @@ class VirtualFileSystem {
   VirtualFileSystem();
   ~VirtualFileSystem();
 
-  bool RegisterDevice(std::unique_ptr<Device> device);
+  bool RegisterDevice(std::shared_ptr<Device> device);
   bool UnregisterDevice(const std::string_view path);
 
   bool RegisterSymbolicLink(const std::string_view path,
@@ -48,11 +51,43 @@ class VirtualFileSystem {
                     FileAction* out_action);
 
  private:
+  // Immutable snapshot of the mounted devices and the symbolic links, replaced
+  // as a whole when they're modified, so resolving paths doesn't need a lock.
+  // Also keeps the devices alive while a lookup is using them.
+  struct MountTable {
+    std::vector<std::shared_ptr<Device>> devices;
+    std::unordered_map<std::string, std::string> symlinks;
+  };
+
+  // Maximum number of paths in the resolution cache before it's flushed.
+  static constexpr size_t kMaxCachedPaths = 16384;
+
+  std::shared_ptr<const MountTable> GetMountTable() const {
+    return std::atomic_load_explicit(&mount_table_, std::memory_order_acquire);
+  }
+  // Requires the global lock.
+  void SetMountTable(std::shared_ptr<const MountTable> mount_table);
+
+  static bool ResolveSymbolicLink(const MountTable& mount_table,
+                                  const std::string_view path,
+                                  std::string& result);
+  Entry* ResolvePathUncached(const std::string_view path);
+
+  // Called whenever entries are created or deleted through the file system,
+  // or the mount table is changed.
+  void InvalidatePathCache();
+
+  // Serializes the modifications of the mount table.
   xe::global_critical_region global_critical_region_;
-  std::vector<std::unique_ptr<Device>> devices_;
-  std::unordered_map<std::string, std::string> symlinks_;
+  std::shared_ptr<const MountTable> mount_table_;
 
-  bool ResolveSymbolicLink(const std::string_view path, std::string& result);
+  // Results of ResolvePath (including failed lookups), by the path exactly as
+  // it was requested.
+  std::mutex path_cache_mutex_;
+  std::unordered_map<std::string, Entry*> path_cache_;
+  // Incremented on invalidation, for not caching the results of lookups done
+  // concurrently with a modification.
+  std::atomic<uint64_t> path_cache_generation_ = {0};
 };
 
 }  // namespace vfs
@@ -0,0 +1,14 @@
+group("third_party")
+project("tracy")
+  uuid("9dc40f5b-cc94-429d-9e94-0955f5e64166")
+  kind("StaticLib")
+  language("C++")
+  defines({
+    "_LIB",
+  })
+  files({
+    "tracy/public/TracyClient.cpp",
+  })
+
+  filter("platforms:Windows")
+    warnings("Off")